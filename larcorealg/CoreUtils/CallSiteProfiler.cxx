@@ -0,0 +1,136 @@
+/**
+ * @file   larcorealg/CoreUtils/CallSiteProfiler.cxx
+ * @brief  Counts calls to a set of functions and samples their callers.
+ * @see    `larcorealg/CoreUtils/CallSiteProfiler.h`
+ *
+ */
+
+// library header
+#include "larcorealg/CoreUtils/CallSiteProfiler.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::stable_sort(), std::min(), std::max()
+#include <map>
+#include <utility> // std::move()
+
+//-----------------------------------------------------------------------------
+//--- lar::debug::CallSiteProfiler
+//---
+lar::debug::CallSiteProfiler::CallSiteProfiler(std::vector<std::string> methods,
+                                               Config_t const& config)
+  : fConfig{std::max(config.sampleEvery, 1U),
+            config.maxSamples,
+            config.skipOwnLibrary,
+            config.callerDepth}
+  , fNMethods{methods.size()}
+  , fMethods{std::make_unique<MethodRecord_t[]>(fNMethods)}
+  , fRandomState{0x9E3779B97F4A7C15ULL}
+{
+  for (std::size_t i = 0; i < fNMethods; ++i)
+    fMethods[i].name = std::move(methods[i]);
+  // the first capture may load the unwinder: do it now rather than in the job
+  prepareBacktraceCapture();
+} // lar::debug::CallSiteProfiler::CallSiteProfiler()
+
+//-----------------------------------------------------------------------------
+std::uint64_t lar::debug::CallSiteProfiler::sampledCalls(std::size_t method) const
+{
+  std::lock_guard<std::mutex> lock{fSampleLock};
+  return fMethods[method].sampled;
+}
+
+//-----------------------------------------------------------------------------
+std::size_t lar::debug::CallSiteProfiler::nSamples(std::size_t method) const
+{
+  std::lock_guard<std::mutex> lock{fSampleLock};
+  return fMethods[method].samples.size();
+}
+
+//-----------------------------------------------------------------------------
+void lar::debug::CallSiteProfiler::sample(std::size_t method)
+{
+  // capture before locking, skipping this very function
+  RawBacktrace_t bt;
+  captureBacktrace(bt, 1U);
+
+  std::lock_guard<std::mutex> lock{fSampleLock};
+  MethodRecord_t& record = fMethods[method];
+  std::uint64_t const iSample = record.sampled++;
+  if (record.samples.size() < fConfig.maxSamples) {
+    record.samples.push_back(bt);
+    return;
+  }
+  if (fConfig.maxSamples == 0U) return;
+
+  // reservoir sampling: the new sample replaces a kept one with probability
+  // `maxSamples / (iSample + 1)`; the generator is a xorshift64*
+  fRandomState ^= fRandomState >> 12;
+  fRandomState ^= fRandomState << 25;
+  fRandomState ^= fRandomState >> 27;
+  std::uint64_t const j = (fRandomState * 0x2545F4914F6CDD1DULL) % (iSample + 1U);
+  if (j < fConfig.maxSamples) record.samples[j] = bt;
+
+} // lar::debug::CallSiteProfiler::sample()
+
+//-----------------------------------------------------------------------------
+auto lar::debug::CallSiteProfiler::topCallers(std::size_t method,
+                                              std::size_t topN /* = 10U */) const
+  -> std::vector<CallerStats_t>
+{
+  std::lock_guard<std::mutex> lock{fSampleLock};
+  MethodRecord_t const& record = fMethods[method];
+  if (record.samples.empty()) return {};
+
+  for (RawBacktrace_t const& bt : record.samples)
+    fSymbolizer.symbolize(bt);
+
+  // the first frame belongs to the instrumented method
+  std::map<std::string, CallerStats_t> callers;
+  for (RawBacktrace_t const& bt : record.samples) {
+    if (bt.size() < 2U) continue;
+    CallInfo_t const& origin = fSymbolizer.callInfo(bt.frames[0]);
+
+    CallInfo_t const* info = nullptr;
+    if (fConfig.skipOwnLibrary && !origin.libraryName.empty()) {
+      for (unsigned int iFrame = 1U; iFrame < bt.size(); ++iFrame) {
+        CallInfo_t const& frameInfo = fSymbolizer.callInfo(bt.frames[iFrame]);
+        if (frameInfo.libraryName == origin.libraryName) continue;
+        info = &frameInfo;
+        break;
+      } // for frames
+    }
+    if (!info) {
+      unsigned int const iFrame = std::min(fConfig.callerDepth, bt.size() - 1U);
+      info = &fSymbolizer.callInfo(bt.frames[iFrame]);
+    }
+
+    // unnamed functions are told apart by their full description
+    std::string const& name = info->function().empty() ? info->original : info->function();
+    CallerStats_t& stats = callers[name + '\0' + info->libraryName];
+    if (stats.samples++ == 0U) {
+      stats.caller = name;
+      stats.library = info->shortLibrary();
+    }
+  } // for samples
+
+  std::vector<CallerStats_t> stats;
+  stats.reserve(callers.size());
+  for (auto& [key, caller] : callers)
+    stats.push_back(std::move(caller));
+  std::stable_sort(stats.begin(), stats.end(), [](CallerStats_t const& a, CallerStats_t const& b) {
+    return a.samples > b.samples;
+  });
+  if ((topN > 0U) && (stats.size() > topN)) stats.resize(topN);
+
+  // each kept sample stands for the same number of calls
+  double const nKept = record.samples.size();
+  double const nCalls = record.calls.load(std::memory_order_relaxed);
+  for (CallerStats_t& caller : stats) {
+    caller.fraction = caller.samples / nKept;
+    caller.estimatedCalls = static_cast<std::uint64_t>(caller.fraction * nCalls + 0.5);
+  }
+  return stats;
+
+} // lar::debug::CallSiteProfiler::topCallers()
+
+//-----------------------------------------------------------------------------
@@ -0,0 +1,186 @@
+/**
+ * @file   larcorealg/CoreUtils/CallSiteProfiler.h
+ * @brief  Counts calls to a set of functions and samples their callers.
+ * @see    `larcorealg/CoreUtils/CallSiteProfiler.cxx`
+ *
+ */
+#ifndef LARCOREALG_COREUTILS_CALLSITEPROFILER_H
+#define LARCOREALG_COREUTILS_CALLSITEPROFILER_H
+
+// LArSoft includes
+#include "larcorealg/CoreUtils/DebugUtils.h" // lar::debug::RawBacktrace_t
+
+// C/C++ standard libraries
+#include <atomic>
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint64_t
+#include <memory>  // std::unique_ptr
+#include <mutex>
+#include <string>
+#include <utility> // std::move()
+#include <vector>
+
+namespace lar::debug {
+
+  /**
+   * @brief Counts the calls to instrumented functions and samples the callers.
+   *
+   * Each instrumented function (a "method") is assigned an index at
+   * construction, and it calls `record()` with that index at each invocation.
+   * All calls are counted; one every `Config_t::sampleEvery` also has its call
+   * stack recorded, without symbolization (see `captureBacktrace()`).
+   * If there are more samples than `Config_t::maxSamples`, a uniform random
+   * subset of them is kept.
+   *
+   * The recorded call stacks are translated into function names only when the
+   * report is requested (`topCallers()`, `report()`), typically at the end of
+   * the job. The caller of a sample is the first function outside the library
+   * of the instrumented one, so that the calls from within that library (e.g.
+   * the geometry calling itself) are attributed to the external client.
+   * With `Config_t::skipOwnLibrary` unset, the caller is instead a fixed
+   * number of frames (`Config_t::callerDepth`) out of the instrumented one.
+   *
+   * Example:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * lar::debug::CallSiteProfiler profiler{{"Find", "Get"}, {100U}};
+   *
+   * int Find(int i) { profiler.record(0); return i; }
+   *
+   * // ... at the end of the job:
+   * profiler.report(std::cout);
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   * Recording is thread-safe, and it is lock-free for the calls which are not
+   * sampled. Reports must not be requested concurrently with recording.
+   */
+  class CallSiteProfiler {
+  public:
+    /// Configuration of the profiler.
+    struct Config_t {
+      unsigned int sampleEvery = 1000U; ///< One call every this many is sampled.
+      std::size_t maxSamples = 1000U;   ///< Maximum samples kept per method.
+      bool skipOwnLibrary = true;       ///< Callers are outside the method library.
+      unsigned int callerDepth = 1U;    ///< Frames from the method to its caller.
+    }; // Config_t
+
+    /// Information about the calls from one caller, from the samples.
+    struct CallerStats_t {
+      std::string caller;           ///< Name of the calling function.
+      std::string library;          ///< Library of the calling function.
+      std::size_t samples = 0U;     ///< Number of samples from this caller.
+      double fraction = 0.0;        ///< Fraction of the samples of the method.
+      std::uint64_t estimatedCalls = 0U; ///< Estimated calls from this caller.
+    }; // CallerStats_t
+
+    /// Constructor: profiles the `methods`, identified by their position.
+    /// A `sampleEvery` of `0` is treated as `1` (all calls sampled).
+    CallSiteProfiler(std::vector<std::string> methods, Config_t const& config);
+
+    /// Constructor: profiles the `methods` with the default configuration.
+    CallSiteProfiler(std::vector<std::string> methods)
+      : CallSiteProfiler(std::move(methods), Config_t{})
+    {}
+
+    /// Records a call to the method with the specified index.
+    [[gnu::always_inline]] void record(std::size_t method)
+    {
+      auto const n = fMethods[method].calls.fetch_add(1U, std::memory_order_relaxed);
+      if (n % fConfig.sampleEvery == 0U) sample(method);
+    }
+
+    // --- BEGIN -- Access to the results --------------------------------------
+    /// @name Access to the results
+    /// @{
+
+    /// Returns the number of profiled methods.
+    std::size_t nMethods() const { return fNMethods; }
+
+    /// Returns the name of the specified method.
+    std::string const& methodName(std::size_t method) const { return fMethods[method].name; }
+
+    /// Returns the number of calls recorded for the specified method.
+    std::uint64_t calls(std::size_t method) const
+    {
+      return fMethods[method].calls.load(std::memory_order_relaxed);
+    }
+
+    /// Returns the number of calls which were sampled for the specified method.
+    std::uint64_t sampledCalls(std::size_t method) const;
+
+    /// Returns the number of samples kept for the specified method.
+    std::size_t nSamples(std::size_t method) const;
+
+    /// Returns the configuration of the profiler.
+    Config_t const& config() const { return fConfig; }
+
+    /**
+     * @brief Returns the callers of `method` with most samples.
+     * @param method index of the method
+     * @param topN maximum number of callers returned (`0` for all)
+     * @return the callers, sorted by decreasing number of samples
+     */
+    std::vector<CallerStats_t> topCallers(std::size_t method, std::size_t topN = 10U) const;
+
+    /**
+     * @brief Prints the number of calls and the top callers of each method.
+     * @tparam Stream type of output stream
+     * @param out the stream to print into
+     * @param topN maximum number of callers printed per method (`0` for all)
+     *
+     * Methods which were never called are not printed.
+     */
+    template <typename Stream>
+    void report(Stream&& out, std::size_t topN = 10U) const;
+
+    /// @}
+    // --- END -- Access to the results ----------------------------------------
+
+  private:
+    /// Records and samples of a single method.
+    struct MethodRecord_t {
+      std::string name;                     ///< Name of the method.
+      std::atomic<std::uint64_t> calls{0U}; ///< Number of recorded calls.
+      std::uint64_t sampled = 0U;           ///< Number of sampled calls.
+      std::vector<RawBacktrace_t> samples;  ///< Kept samples.
+    }; // MethodRecord_t
+
+    Config_t const fConfig;                    ///< Profiler configuration.
+    std::size_t const fNMethods;               ///< Number of methods.
+    std::unique_ptr<MethodRecord_t[]> fMethods; ///< Records of all the methods.
+
+    mutable std::mutex fSampleLock; ///< Protects all the sample lists.
+    std::uint64_t fRandomState;     ///< State of the sample replacement choice.
+
+    /// Symbolizes the samples at report time.
+    mutable BacktraceSymbolizer fSymbolizer;
+
+    /// Records the call stack of this call to `method`.
+    [[gnu::noinline]] void sample(std::size_t method);
+
+  }; // class CallSiteProfiler
+
+} // namespace lar::debug
+
+//------------------------------------------------------------------------------
+//--- template implementation
+//------------------------------------------------------------------------------
+template <typename Stream>
+void lar::debug::CallSiteProfiler::report(Stream&& out, std::size_t topN /* = 10U */) const
+{
+  out << "Calls profiled on " << fNMethods << " methods, one sample every " << fConfig.sampleEvery
+      << " calls:";
+  for (std::size_t method = 0; method < fNMethods; ++method) {
+    std::uint64_t const nCalls = calls(method);
+    if (nCalls == 0U) continue;
+    std::size_t const samples = nSamples(method);
+    out << "\n  " << methodName(method) << ": " << nCalls << " calls, " << samples << " samples";
+    for (CallerStats_t const& caller : topCallers(method, topN)) {
+      out << "\n    " << (100.0 * caller.fraction) << "% (~" << caller.estimatedCalls
+          << " calls) from " << caller.caller;
+      if (!caller.library.empty()) out << " in " << caller.library;
+    } // for callers
+  }   // for methods
+} // lar::debug::CallSiteProfiler::report()
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREALG_COREUTILS_CALLSITEPROFILER_H
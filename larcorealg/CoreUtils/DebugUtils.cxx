@@ -1,6 +1,8 @@
 #include "larcorealg/CoreUtils/DebugUtils.h"
 
 // C/C++ standard libraries
+#include <algorithm> // std::sort(), std::unique()
+#include <cstring>   // std::memmove()
 #include <istream>
 #include <sstream>
 
@@ -149,3 +151,61 @@ void lar::debug::CallInfo_t::setAll(std::string const& s,
 } // lar::debug::CallInfo_t::setAll()
 
 //-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+//--- lar::debug::captureBacktrace()
+//---
+[[gnu::noinline]] void lar::debug::captureBacktrace(RawBacktrace_t& bt,
+                                                    unsigned int skip /* = 0 */) noexcept
+{
+  int const n = backtrace(bt.frames.data(), RawBacktrace_t::MaxFrames);
+  unsigned int const nFrames = (n > 0) ? static_cast<unsigned int>(n) : 0U;
+  // the frames up to this very function are skipped as well; the caller frame
+  // is found by its return address, because the `backtrace()` wrappers of the
+  // sanitizers add frames of their own
+  void* const callerAddress = __builtin_return_address(0);
+  unsigned int iCaller = 0U;
+  while ((iCaller < nFrames) && (bt.frames[iCaller] != callerAddress))
+    ++iCaller;
+  skip += (iCaller < nFrames) ? iCaller : 1U;
+  bt.nFrames = (nFrames > skip) ? nFrames - skip : 0U;
+  if (bt.nFrames > 0U)
+    std::memmove(bt.frames.data(), bt.frames.data() + skip, bt.nFrames * sizeof(void*));
+} // lar::debug::captureBacktrace()
+
+void lar::debug::prepareBacktraceCapture() noexcept
+{
+  void* frame[1];
+  backtrace(frame, 1);
+}
+
+//-----------------------------------------------------------------------------
+//--- lar::debug::BacktraceSymbolizer
+//---
+void lar::debug::BacktraceSymbolizer::symbolize(void* const* addresses, std::size_t n)
+{
+  // collect the addresses not known yet, each only once
+  std::vector<void*> missing;
+  for (std::size_t i = 0; i < n; ++i)
+    if (fCache.count(addresses[i]) == 0) missing.push_back(addresses[i]);
+  if (missing.empty()) return;
+  std::sort(missing.begin(), missing.end());
+  missing.erase(std::unique(missing.begin(), missing.end()), missing.end());
+
+  char** symbols = backtrace_symbols(missing.data(), missing.size());
+  for (std::size_t i = 0; i < missing.size(); ++i)
+    fCache.emplace(missing[i], CallInfo_t(symbols ? symbols[i] : "<unknown>"));
+  std::free(symbols);
+} // lar::debug::BacktraceSymbolizer::symbolize()
+
+lar::debug::CallInfo_t const& lar::debug::BacktraceSymbolizer::callInfo(void* address)
+{
+  auto it = fCache.find(address);
+  if (it == fCache.end()) {
+    symbolize(&address, 1U);
+    it = fCache.find(address);
+  }
+  return it->second;
+} // lar::debug::BacktraceSymbolizer::callInfo()
+
+//-----------------------------------------------------------------------------
@@ -8,6 +8,7 @@
  * This library contains:
  *  - a function to return the name of the type of a variable
  *  - a function printing into a stream the current call stack
+ *  - a cheap capture of the call stack, to be printed later
  *
  */
 #ifndef LARCOREALG_COREUTILS_DEBUGUTILS_H
@@ -20,12 +21,16 @@
 #include "cetlib_except/demangle.h"
 
 // C/C++ standard libraries
+#include <algorithm> // std::min(), std::max()
+#include <array>
 #include <bitset>
 #include <cstddef> // std::ptrdiff_t
 #include <cstdlib> // std::free()
 #include <ostream>
 #include <string>
+#include <type_traits> // std::enable_if_t, std::is_same_v
 #include <typeinfo>
+#include <unordered_map>
 #include <utility> // std::pair<>
 #include <utility> // std::forward()
 #include <vector>
@@ -193,8 +198,11 @@ namespace lar::debug {
 
   //----------------------------------------------------------------------------
   /// Helper operator to insert a call information in a stream with default options.
-  template <typename Stream>
-  inline Stream& operator<<(Stream&& out, CallInfo_t const& info);
+  /// (the argument is not converted, so strings are not taken as `CallInfo_t`)
+  template <typename Stream,
+            typename Info,
+            typename = std::enable_if_t<std::is_same_v<Info, CallInfo_t>>>
+  inline Stream& operator<<(Stream&& out, Info const& info);
 
   //----------------------------------------------------------------------------
   /// Backtrace printing options
@@ -253,6 +261,116 @@ namespace lar::debug {
                       std::string indent = "  ",
                       CallInfoPrinter::opt const* callInfoOptions = nullptr);
 
+  //----------------------------------------------------------------------------
+  /**
+   * @brief Raw call stack: return addresses only, in a fixed size buffer.
+   * @see `captureBacktrace()`, `BacktraceSymbolizer`
+   *
+   * This object is filled by `captureBacktrace()` and does not own any memory
+   * beside its fixed buffer. The addresses can be translated into function
+   * names afterwards by a `BacktraceSymbolizer`.
+   */
+  struct RawBacktrace_t {
+
+    /// Maximum number of frames recorded.
+    static constexpr unsigned int MaxFrames = 64U;
+
+    std::array<void*, MaxFrames> frames{}; ///< Return addresses, innermost first.
+    unsigned int nFrames = 0U;             ///< Number of recorded frames.
+
+    /// Returns whether the capture reached the end of the buffer.
+    bool truncated() const { return nFrames == MaxFrames; }
+
+    void* const* begin() const { return frames.data(); }
+    void* const* end() const { return frames.data() + nFrames; }
+    unsigned int size() const { return nFrames; }
+    bool empty() const { return nFrames == 0U; }
+
+  }; // struct RawBacktrace_t
+
+  /**
+   * @brief Records the current call stack into `bt`, without symbolizing it.
+   * @param bt the object to record the call stack into
+   * @param skip number of innermost calls not to be recorded
+   *
+   * The frame of `captureBacktrace()` itself is never recorded, so the first
+   * recorded address (with `skip` `0`) belongs to its caller.
+   * This function does not allocate memory and it can be used in signal
+   * handlers, provided that `prepareBacktraceCapture()` has been called
+   * before (the very first capture may load the unwinding library).
+   */
+  void captureBacktrace(RawBacktrace_t& bt, unsigned int skip = 0U) noexcept;
+
+  /**
+   * @brief Loads in advance what the call stack capture requires.
+   *
+   * The GNU `backtrace()` loads the unwinder library on its first use, which
+   * allocates memory. Calling this function at initialization makes all the
+   * following `captureBacktrace()` calls free of memory allocation.
+   */
+  void prepareBacktraceCapture() noexcept;
+
+  /**
+   * @brief Translates raw call stacks into call information, with a cache.
+   * @see `captureBacktrace()`
+   *
+   * The expensive part of the backtrace printing (symbol lookup, parsing and
+   * demangling) is performed here, only once per distinct address, so that
+   * the same call sites recorded many times are translated only once.
+   * Example of sampling of call sites:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * std::vector<lar::debug::RawBacktrace_t> samples;
+   * // ... in the hot path:
+   * lar::debug::captureBacktrace(samples.emplace_back());
+   *
+   * // ... at the end of the job:
+   * lar::debug::BacktraceSymbolizer symbolizer;
+   * symbolizer.symbolizeAll(samples.begin(), samples.end()); // optional: batch
+   * for (auto const& sample: samples) symbolizer.print(std::cout, sample);
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   * This object is not thread-safe.
+   */
+  class BacktraceSymbolizer {
+  public:
+    /// Translates all the addresses not in the cache yet, in a single batch.
+    void symbolize(void* const* addresses, std::size_t n);
+
+    /// Translates all the addresses in `bt` not in the cache yet.
+    void symbolize(RawBacktrace_t const& bt) { symbolize(bt.begin(), bt.size()); }
+
+    /// Translates all the addresses in the backtraces from `begin` to `end`.
+    template <typename BIter, typename EIter>
+    void symbolizeAll(BIter begin, EIter end);
+
+    /// Returns the information on the call at `address` (translated on demand).
+    CallInfo_t const& callInfo(void* address);
+
+    /**
+     * @brief Prints a recorded call stack into a stream.
+     * @tparam Stream type of output stream
+     * @param out the output stream to insert output into
+     * @param bt the call stack to be printed
+     * @param options printing options (see BacktracePrintOptions)
+     *
+     * The frames to skip are chosen at capture time: `options.skipLines` is
+     * ignored.
+     */
+    template <typename Stream>
+    void print(Stream&& out,
+               RawBacktrace_t const& bt,
+               BacktracePrintOptions const& options = BacktracePrintOptions());
+
+    /// Returns the number of translated addresses.
+    std::size_t cacheSize() const { return fCache.size(); }
+
+    /// Forgets all the translated addresses.
+    void clear() { fCache.clear(); }
+
+  private:
+    std::unordered_map<void*, CallInfo_t> fCache; ///< Translated addresses.
+
+  }; // class BacktraceSymbolizer
+
   //----------------------------------------------------------------------------
   /**
    * @brief Class triggering a `static_assert` failure.
@@ -385,8 +503,8 @@ namespace lar::debug {
   } // CallInfoPrinter::print()
 
   //----------------------------------------------------------------------------
-  template <typename Stream>
-  inline Stream& operator<<(Stream&& out, CallInfo_t const& info)
+  template <typename Stream, typename Info, typename>
+  inline Stream& operator<<(Stream&& out, Info const& info)
   {
     CallInfoPrinter print;
     print(std::forward<Stream>(out), info);
@@ -447,6 +565,42 @@ namespace lar::debug {
     printBacktrace(std::forward<Stream>(out), options);
   }
 
+  //----------------------------------------------------------------------------
+  template <typename BIter, typename EIter>
+  void BacktraceSymbolizer::symbolizeAll(BIter begin, EIter end)
+  {
+    std::vector<void*> addresses;
+    for (auto it = begin; it != end; ++it)
+      addresses.insert(addresses.end(), it->begin(), it->end());
+    symbolize(addresses.data(), addresses.size());
+  }
+
+  //----------------------------------------------------------------------------
+  template <typename Stream>
+  void BacktraceSymbolizer::print(Stream&& out,
+                                  RawBacktrace_t const& bt,
+                                  BacktracePrintOptions const& options /* = {} */)
+  {
+    symbolize(bt);
+
+    unsigned int const nItems = bt.size();
+    unsigned int const lastItem = std::min(options.maxLines, nItems);
+
+    CallInfoPrinter print(options.callInfoOptions);
+    for (unsigned int i = 0; i < lastItem; ++i) {
+      out << (i == 0 ? options.firstIndent : options.indent);
+      print(std::forward<Stream>(out), callInfo(bt.frames[i]));
+      out << "\n";
+    }
+    if ((lastItem < nItems) && options.countOthers) {
+      out << options.indent << " ... and other " << (nItems - lastItem);
+      if (bt.truncated()) out << " (or more)";
+      out << " levels\n";
+    }
+    out << std::flush;
+
+  } // BacktraceSymbolizer::print()
+
   //----------------------------------------------------------------------------
   namespace details {
 
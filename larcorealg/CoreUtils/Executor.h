@@ -0,0 +1,198 @@
+/**
+ * @file   larcorealg/CoreUtils/Executor.h
+ * @brief  Pluggable scheduler for the parallel loops of the library.
+ * @date   October 14, 2026
+ *
+ * This is a header only library.
+ */
+
+#ifndef LARCOREALG_COREUTILS_EXECUTOR_H
+#define LARCOREALG_COREUTILS_EXECUTOR_H
+
+// C/C++ standard libraries
+#include <algorithm> // std::min(), std::max()
+#include <atomic>
+#include <cstddef> // std::size_t
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility> // std::move()
+#include <vector>
+
+namespace lar::util {
+
+  /**
+   * @brief Runs loops of independent tasks, possibly in parallel.
+   *
+   * The library does not start threads on its own: the code which can run in
+   * parallel takes an executor, which forwards the work to the scheduler of
+   * the host application, so that the library shares its threads instead of
+   * competing with them. The executor wraps a single "parallel for" function,
+   * `ParallelFor_t`, which must run `task(i)` for each `i` from `0` to
+   * `n - 1`, in any order and concurrently, return only after all of them are
+   * complete, and propagate their exceptions. An executor on the TBB
+   * scheduler (i.e. on the task arena of a _art_ job) is then:
+   * ~~~~{.cpp}
+   * lar::util::Executor const executor{
+   *   [](std::size_t n, auto const& task) { tbb::parallel_for(std::size_t{0}, n, task); }
+   * };
+   * ~~~~
+   * A default-constructed executor runs all the tasks sequentially, in order,
+   * in the calling thread; `threads()` provides one on standard threads, for
+   * programs with no scheduler of their own.
+   *
+   * The interface is made of:
+   * * `parallel_for(n, task)`, calling `task(i)` for all `i` in `[0, n[`;
+   * * `parallel_for(begin, end, grainSize, task)`, calling
+   *   `task(first, last)` on consecutive blocks of `[begin, end[`;
+   * * `submit(tasks)`, running a group of different tasks.
+   *
+   * All of them return when all the tasks are done: no task outlives the call
+   * which started it.
+   *
+   * An executor converts into its `ParallelFor_t`, which is the type also
+   * used by the geometry (`geo::TaskRunner_t`): it can be passed wherever a
+   * runner is expected.
+   */
+  class Executor {
+
+  public:
+    /// Type of task of a loop on indices.
+    using IndexTask_t = std::function<void(std::size_t)>;
+
+    /// Type of task of a loop on ranges of indices (`first`, `last`).
+    using RangeTask_t = std::function<void(std::size_t, std::size_t)>;
+
+    /// Type of generic task.
+    using Task_t = std::function<void()>;
+
+    /// Type of the function running `n` independent tasks.
+    using ParallelFor_t = std::function<void(std::size_t, IndexTask_t const&)>;
+
+    /// Constructor: an executor running everything sequentially.
+    Executor() = default;
+
+    /// Constructor: an executor using `parallelFor` (empty: sequential).
+    Executor(ParallelFor_t parallelFor) : fParallelFor{std::move(parallelFor)} {}
+
+    /// Returns whether the tasks are run sequentially in the calling thread.
+    bool isSerial() const { return !fParallelFor; }
+
+    /// Returns the function running the loops (empty if serial).
+    ParallelFor_t const& parallelFor() const { return fParallelFor; }
+
+    /// Converts to the function running the loops (see `parallelFor()`).
+    operator ParallelFor_t const&() const { return fParallelFor; }
+
+    /// Runs `task(i)` for all `i` from `0` to `n - 1`.
+    void parallel_for(std::size_t n, IndexTask_t const& task) const
+    {
+      runParallelFor(fParallelFor, n, task);
+    }
+
+    /**
+     * @brief Runs `task` on blocks of the range of indices [`begin`, `end`[.
+     * @param begin first index of the range
+     * @param end index past the last one of the range
+     * @param grainSize number of indices in each block (the last may be short)
+     * @param task called as `task(first, last)` on each block
+     *
+     * Blocks let each task amortize its setup (e.g. buffers) on many indices.
+     */
+    void parallel_for(std::size_t begin,
+                      std::size_t end,
+                      std::size_t grainSize,
+                      RangeTask_t const& task) const;
+
+    /// Runs all the `tasks`, returning when all are done.
+    void submit(std::vector<Task_t> const& tasks) const
+    {
+      parallel_for(tasks.size(), [&tasks](std::size_t i) { tasks[i](); });
+    }
+
+    /// Runs `n` tasks with `parallelFor`, or sequentially if it is empty.
+    static void runParallelFor(ParallelFor_t const& parallelFor,
+                               std::size_t n,
+                               IndexTask_t const& task);
+
+    /**
+     * @brief Returns an executor spreading the tasks on standard threads.
+     * @param nThreads number of threads (`0`: hardware concurrency)
+     *
+     * The threads are started on each loop and joined before it returns.
+     * The calling thread is one of them. The first exception thrown by a task
+     * is rethrown after all threads are done.
+     */
+    static Executor threads(unsigned int nThreads = 0U);
+
+  private:
+    ParallelFor_t fParallelFor; ///< Function running the loops.
+
+  }; // class Executor
+
+} // namespace lar::util
+
+//------------------------------------------------------------------------------
+//--- inline implementation
+//------------------------------------------------------------------------------
+inline void lar::util::Executor::parallel_for(std::size_t begin,
+                                              std::size_t end,
+                                              std::size_t grainSize,
+                                              RangeTask_t const& task) const
+{
+  if (end <= begin) return;
+  grainSize = std::max<std::size_t>(grainSize, 1U);
+  std::size_t const nBlocks = (end - begin + grainSize - 1U) / grainSize;
+  parallel_for(nBlocks, [begin, end, grainSize, &task](std::size_t iBlock) {
+    std::size_t const first = begin + iBlock * grainSize;
+    task(first, std::min(end, first + grainSize));
+  });
+} // lar::util::Executor::parallel_for(range)
+
+//------------------------------------------------------------------------------
+inline void lar::util::Executor::runParallelFor(ParallelFor_t const& parallelFor,
+                                                std::size_t n,
+                                                IndexTask_t const& task)
+{
+  if (parallelFor && (n > 1)) {
+    parallelFor(n, task);
+    return;
+  }
+  for (std::size_t i = 0; i < n; ++i)
+    task(i);
+} // lar::util::Executor::runParallelFor()
+
+//------------------------------------------------------------------------------
+inline lar::util::Executor lar::util::Executor::threads(unsigned int nThreads)
+{
+  if (nThreads == 0U) nThreads = std::max(std::thread::hardware_concurrency(), 1U);
+  return Executor{[nThreads](std::size_t n, IndexTask_t const& task) {
+    std::atomic<std::size_t> next{0U};
+    std::exception_ptr error;
+    std::mutex errorMutex;
+    auto const worker = [&]() {
+      for (std::size_t i = next++; i < n; i = next++) {
+        try {
+          task(i);
+        }
+        catch (...) {
+          std::lock_guard<std::mutex> lock{errorMutex};
+          if (!error) error = std::current_exception();
+        }
+      } // for
+    };
+    std::vector<std::thread> threads;
+    std::size_t const nWorkers = std::min<std::size_t>(nThreads, n);
+    for (std::size_t i = 1; i < nWorkers; ++i)
+      threads.emplace_back(worker);
+    worker();
+    for (std::thread& thread : threads)
+      thread.join();
+    if (error) std::rethrow_exception(error);
+  }};
+} // lar::util::Executor::threads()
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREALG_COREUTILS_EXECUTOR_H
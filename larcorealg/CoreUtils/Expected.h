@@ -0,0 +1,239 @@
+/**
+ * @file   larcorealg/CoreUtils/Expected.h
+ * @brief  A value or the code of the error which prevented its computation.
+ * @date   October 14, 2026
+ *
+ * This is a header only library.
+ */
+
+#ifndef LARCOREALG_COREUTILS_EXPECTED_H
+#define LARCOREALG_COREUTILS_EXPECTED_H
+
+// C/C++ standard libraries
+#include <exception>
+#include <memory> // std::addressof()
+#include <string>
+#include <type_traits>
+#include <utility> // std::move(), std::declval()
+#include <variant>
+
+namespace util {
+
+  /**
+   * @brief Wraps the error to be stored into a `util::expected`.
+   * @tparam E type of the error
+   * @see `util::make_unexpected()`
+   */
+  template <typename E>
+  class unexpected {
+  public:
+    /// Constructor: wraps `error`.
+    constexpr explicit unexpected(E error) : fError{std::move(error)} {}
+
+    /// Returns the wrapped error.
+    constexpr E const& error() const noexcept { return fError; }
+
+  private:
+    E fError;
+  }; // class unexpected
+
+  /// Returns `error` wrapped for the construction of a `util::expected`.
+  template <typename E>
+  constexpr unexpected<E> make_unexpected(E error)
+  {
+    return unexpected<E>{std::move(error)};
+  }
+
+  /**
+   * @brief Returns the message describing `error`.
+   * @tparam E type of the error
+   *
+   * The message is `errorMessage(error)`, looked up in the namespace of `E`,
+   * or a generic one if no such function exists.
+   */
+  template <typename E>
+  std::string describeError(E const& error);
+
+  /// Exception thrown when accessing the value of a `util::expected` error.
+  template <typename E>
+  class bad_expected_access : public std::exception {
+  public:
+    explicit bad_expected_access(E error)
+      : fError{std::move(error)}, fMessage{describeError(fError)}
+    {}
+
+    /// Returns the error stored in the `util::expected` object.
+    E const& error() const noexcept { return fError; }
+
+    char const* what() const noexcept override { return fMessage.c_str(); }
+
+  private:
+    E fError;
+    std::string fMessage;
+  }; // class bad_expected_access
+
+  /**
+   * @brief Holds either a value of type `T` or an error of type `E`.
+   * @tparam T type of the value (may be a lvalue reference)
+   * @tparam E type of the error (typically an enumerator code)
+   *
+   * This is a light version of C++23 `std::expected`, for functions whose
+   * failure is a normal outcome (e.g. a point outside all TPCs) and which are
+   * called in loops where throwing an exception would be too expensive:
+   * ~~~~{.cpp}
+   * auto const tpc = geom.TryPositionToTPC(point);
+   * if (!tpc) {
+   *   mf::LogDebug("MyAlg") << tpc.message();
+   *   continue;
+   * }
+   * geo::TPCID const& tpcid = tpc->ID();
+   * ~~~~
+   * The error is meant to be cheap to copy and check; a human-readable
+   * message is built only on request (`message()`), by `describeError()`.
+   * Accessing the value of an object holding an error (`value()`) throws
+   * `util::bad_expected_access<E>`, while `operator*` and `operator->` don't
+   * check.
+   *
+   * Values which are references are stored as pointers, so that an
+   * `util::expected<geo::TPCGeo const&, E>` costs no more than a pointer and
+   * an error code.
+   */
+  template <typename T, typename E>
+  class expected {
+
+    /// Type actually stored for the value.
+    using Stored_t = std::conditional_t<std::is_reference_v<T>, std::remove_reference_t<T>*, T>;
+
+    /// Whether a `U` argument initializes the value (references need lvalues).
+    template <typename U>
+    static constexpr bool isValueArg()
+    {
+      return std::is_convertible_v<U&&, T> &&
+             (!std::is_reference_v<T> || std::is_lvalue_reference_v<U>) &&
+             !std::is_same_v<std::decay_t<U>, unexpected<E>>;
+    }
+
+  public:
+    using value_type = T;
+    using error_type = E;
+    using unexpected_type = unexpected<E>;
+
+    /// Type of the value without reference.
+    using Value_t = std::remove_reference_t<T>;
+
+    /// Constructor: stores `value`.
+    template <typename U = T, typename = std::enable_if_t<isValueArg<U>()>>
+    constexpr expected(U&& value) : fData{std::in_place_index<0U>, store(std::forward<U>(value))}
+    {}
+
+    /// Constructor: stores the error.
+    constexpr expected(unexpected_type const& error)
+      : fData{std::in_place_index<1U>, error.error()}
+    {}
+
+    /// Returns whether a value is stored.
+    constexpr bool has_value() const noexcept { return fData.index() == 0U; }
+
+    /// Returns whether a value is stored.
+    constexpr explicit operator bool() const noexcept { return has_value(); }
+
+    //@{
+    /// Returns the value.
+    /// @throws util::bad_expected_access if an error is stored instead
+    constexpr Value_t const& value() const&;
+    constexpr Value_t& value() &;
+    //@}
+
+    //@{
+    /// Returns the value (undefined behaviour if an error is stored).
+    constexpr Value_t const& operator*() const& noexcept { return get(); }
+    constexpr Value_t& operator*() & noexcept { return get(); }
+    constexpr Value_t const* operator->() const noexcept { return std::addressof(get()); }
+    constexpr Value_t* operator->() noexcept { return std::addressof(get()); }
+    //@}
+
+    /// Returns the value if stored, `defValue` otherwise.
+    template <typename U>
+    constexpr std::decay_t<T> value_or(U&& defValue) const;
+
+    /// Returns the stored error (undefined behaviour if a value is stored).
+    constexpr E const& error() const noexcept { return *std::get_if<1U>(&fData); }
+
+    /// Returns the message describing the stored error (empty if none).
+    std::string message() const { return has_value() ? std::string{} : describeError(error()); }
+
+  private:
+    std::variant<Stored_t, E> fData; ///< The value or the error.
+
+    constexpr Value_t& get() const noexcept
+    {
+      if constexpr (std::is_reference_v<T>)
+        return **std::get_if<0U>(&fData);
+      else
+        return const_cast<Value_t&>(*std::get_if<0U>(&fData));
+    }
+
+    template <typename U>
+    static constexpr Stored_t store(U&& value)
+    {
+      if constexpr (std::is_reference_v<T>)
+        return std::addressof(static_cast<T>(value));
+      else
+        return Stored_t(std::forward<U>(value));
+    }
+
+  }; // class expected
+
+} // namespace util
+
+//------------------------------------------------------------------------------
+//--- template implementation
+//------------------------------------------------------------------------------
+namespace util::details {
+
+  template <typename E, typename = void>
+  struct HasErrorMessage : std::false_type {};
+
+  template <typename E>
+  struct HasErrorMessage<E, std::void_t<decltype(errorMessage(std::declval<E const&>()))>>
+    : std::true_type {};
+
+} // namespace util::details
+
+//------------------------------------------------------------------------------
+template <typename E>
+std::string util::describeError(E const& error)
+{
+  if constexpr (details::HasErrorMessage<E>::value)
+    return std::string{errorMessage(error)};
+  else
+    return "unexpected error";
+} // util::describeError()
+
+//------------------------------------------------------------------------------
+template <typename T, typename E>
+constexpr auto util::expected<T, E>::value() const& -> Value_t const&
+{
+  if (!has_value()) throw bad_expected_access<E>{error()};
+  return get();
+} // util::expected<>::value() const
+
+//------------------------------------------------------------------------------
+template <typename T, typename E>
+constexpr auto util::expected<T, E>::value() & -> Value_t&
+{
+  if (!has_value()) throw bad_expected_access<E>{error()};
+  return get();
+} // util::expected<>::value()
+
+//------------------------------------------------------------------------------
+template <typename T, typename E>
+template <typename U>
+constexpr std::decay_t<T> util::expected<T, E>::value_or(U&& defValue) const
+{
+  return has_value() ? std::decay_t<T>(get()) : std::decay_t<T>(std::forward<U>(defValue));
+} // util::expected<>::value_or()
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREALG_COREUTILS_EXPECTED_H
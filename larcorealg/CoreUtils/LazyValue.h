@@ -0,0 +1,145 @@
+/**
+ * @file   larcorealg/CoreUtils/LazyValue.h
+ * @brief  A value computed on first use, safe under concurrent first access.
+ * @date   October 14, 2026
+ *
+ * This is a header only library.
+ */
+
+#ifndef LARCOREALG_COREUTILS_LAZYVALUE_H
+#define LARCOREALG_COREUTILS_LAZYVALUE_H
+
+// C/C++ standard libraries
+#include <atomic>
+#include <cassert>
+#include <mutex>
+#include <optional>
+#include <type_traits> // std::is_invocable_v<>
+
+namespace lar::util {
+
+  /**
+   * @brief A value computed once, on its first use.
+   * @tparam T type of the value
+   *
+   * The value is computed by the first call of `get()`, with the
+   * initialization function passed to it, and then returned as constant by
+   * that and all the following calls. `get()` can be called concurrently:
+   * exactly one call runs the initialization and the others wait for it to
+   * complete; once the value is there, `get()` is a single atomic load with
+   * no lock. If the initialization throws, there is still no value and the
+   * next `get()` tries again.
+   *
+   * The initialization is either a function returning the value, or a
+   * function filling a default-constructed value passed by reference (for
+   * types which can't be moved):
+   * ~~~~{.cpp}
+   * mutable lar::util::LazyValue<geo::BoxBoundedGeo> fWorldBox;
+   *
+   * geo::BoxBoundedGeo const& WorldBox() const
+   *   { return fWorldBox.get([this]() { return ComputeWorldBox(); }); }
+   * ~~~~
+   *
+   * `reset()` removes the value, so that it is computed again at the next
+   * `get()`; it must not be called concurrently with any other call.
+   * The object can be copied if its value can: the copy has a value only if
+   * the original has one.
+   */
+  template <typename T>
+  class LazyValue {
+  public:
+    using Value_t = T; ///< Type of the value.
+
+    LazyValue() = default;
+    LazyValue(LazyValue const& other)
+      : fValue{publishedValue(other)}, fDone{fValue.has_value()}
+    {}
+    LazyValue& operator=(LazyValue const& other)
+    {
+      if (&other != this) copyFrom(other);
+      return *this;
+    }
+
+    /**
+     * @brief Returns the value, computing it with `init` if not there yet.
+     * @tparam Init type of the initialization function
+     * @param init function returning the value, or filling it via `T&`
+     * @return the value
+     */
+    template <typename Init>
+    Value_t const& get(Init&& init) const;
+
+    /// Returns whether the value has been computed.
+    bool done() const { return fDone.load(std::memory_order_acquire); }
+
+    /// Returns a pointer to the value, `nullptr` if not computed yet.
+    Value_t const* getIfDone() const { return done() ? &*fValue : nullptr; }
+
+    /// Returns the value, which must have been computed already.
+    Value_t const& value() const
+    {
+      assert(done());
+      return *fValue;
+    }
+
+    /// Removes the value, releasing its resources (not thread-safe).
+    void reset()
+    {
+      fDone.store(false, std::memory_order_release);
+      fValue.reset();
+    }
+
+  private:
+    mutable std::optional<Value_t> fValue; ///< The value, once computed.
+    mutable std::mutex fMutex;             ///< Serializes the initialization.
+    mutable std::atomic<bool> fDone{false}; ///< Whether `fValue` is complete.
+
+    /// Returns a copy of the value of `other`, if it has one.
+    static std::optional<Value_t> publishedValue(LazyValue const& other)
+    {
+      if (Value_t const* value = other.getIfDone()) return *value;
+      return std::nullopt;
+    }
+
+    /// Copies the value of `other` (if any) via assignment; not thread-safe.
+    void copyFrom(LazyValue const& other)
+    {
+      if (Value_t const* value = other.getIfDone())
+        fValue.emplace(*value);
+      else
+        fValue.reset();
+      fDone.store(fValue.has_value(), std::memory_order_release);
+    }
+
+  }; // class LazyValue
+
+} // namespace lar::util
+
+//------------------------------------------------------------------------------
+//--- template implementation
+//------------------------------------------------------------------------------
+template <typename T>
+template <typename Init>
+auto lar::util::LazyValue<T>::get(Init&& init) const -> Value_t const&
+{
+  if (done()) return *fValue;
+  std::lock_guard<std::mutex> const lock{fMutex};
+  if (done()) return *fValue;
+  if constexpr (std::is_invocable_v<Init&, Value_t&>) {
+    try {
+      init(fValue.emplace());
+    }
+    catch (...) {
+      fValue.reset();
+      throw;
+    }
+  }
+  else
+    fValue.emplace(init());
+  fDone.store(true, std::memory_order_release);
+  return *fValue;
+} // lar::util::LazyValue<>::get()
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREALG_COREUTILS_LAZYVALUE_H
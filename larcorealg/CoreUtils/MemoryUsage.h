@@ -0,0 +1,302 @@
+/**
+ * @file   larcorealg/CoreUtils/MemoryUsage.h
+ * @brief  Estimates of the memory used by objects and reports by component.
+ *
+ * This is a header-only library.
+ *
+ * It provides `lar::util::heapMemory()`, estimating the memory allocated by
+ * an object on top of its own size, and `lar::util::MemoryUsageReport`, which
+ * collects such estimates by component.
+ */
+#ifndef LARCOREALG_COREUTILS_MEMORYUSAGE_H
+#define LARCOREALG_COREUTILS_MEMORYUSAGE_H
+
+// C/C++ standard libraries
+#include <algorithm> // std::max()
+#include <array>
+#include <cstddef> // std::size_t
+#include <iomanip> // std::setw()
+#include <map>
+#include <memory> // std::unique_ptr
+#include <set>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility> // std::pair, std::declval()
+#include <vector>
+
+namespace lar::util {
+
+  namespace details {
+
+    /// Whether `T` has a `heapMemory()` member function.
+    template <typename T, typename = void>
+    struct hasHeapMemoryMember : std::false_type {};
+
+    template <typename T>
+    struct hasHeapMemoryMember<T, std::void_t<decltype(std::declval<T const&>().heapMemory())>>
+      : std::true_type {};
+
+    /// Whether objects of type `T` may own allocated memory.
+    template <typename T>
+    constexpr bool mayAllocate = !std::is_trivially_copyable_v<T> || hasHeapMemoryMember<T>::value;
+
+    /// Estimated bookkeeping of a node of a tree container (`std::set`...).
+    constexpr std::size_t TreeNodeOverhead = 4U * sizeof(void*);
+
+    /// Estimated bookkeeping of a node of a hash container.
+    constexpr std::size_t HashNodeOverhead = 2U * sizeof(void*);
+
+  } // namespace details
+
+  // --- BEGIN -- Memory estimates ---------------------------------------------
+  /**
+   * @name Memory estimates
+   *
+   * `heapMemory(obj)` returns an estimate of the memory allocated by `obj`
+   * outside of itself, in bytes, that is without `sizeof(obj)`. The total
+   * memory of `obj` is `sizeof(obj) + heapMemory(obj)`.
+   *
+   * Standard containers are walked recursively; for node-based containers the
+   * bookkeeping of each node is estimated, and the overhead of the allocator
+   * is not included.
+   * Classes can support the estimate by providing a `heapMemory()` member
+   * function; other classes are assumed not to allocate memory.
+   */
+  /// @{
+
+  template <typename T>
+  std::size_t heapMemory(T const& obj);
+
+  template <typename T, typename A>
+  std::size_t heapMemory(std::vector<T, A> const& v);
+
+  template <typename C, typename Tr, typename A>
+  std::size_t heapMemory(std::basic_string<C, Tr, A> const& s);
+
+  template <typename T, typename D>
+  std::size_t heapMemory(std::unique_ptr<T, D> const& ptr);
+
+  template <typename A, typename B>
+  std::size_t heapMemory(std::pair<A, B> const& p);
+
+  template <typename T, std::size_t N>
+  std::size_t heapMemory(std::array<T, N> const& a);
+
+  template <typename K, typename C, typename A>
+  std::size_t heapMemory(std::set<K, C, A> const& s);
+
+  template <typename K, typename V, typename C, typename A>
+  std::size_t heapMemory(std::map<K, V, C, A> const& m);
+
+  template <typename K, typename V, typename H, typename E, typename A>
+  std::size_t heapMemory(std::unordered_map<K, V, H, E, A> const& m);
+
+  /// Returns the estimated memory allocated by the elements in `[begin, end)`.
+  template <typename Iter>
+  std::size_t elementHeapMemory(Iter begin, Iter end);
+
+  /// @}
+  // --- END -- Memory estimates -----------------------------------------------
+
+  /**
+   * @brief Memory used by the components of a larger object.
+   *
+   * Each component has a name, a number of instances and the total memory
+   * they use, in bytes. Adding to an existing component accumulates.
+   * Example:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * lar::util::MemoryUsageReport report;
+   * for (auto const& wire: wires)
+   *   report.add("WireGeo", sizeof(wire) + lar::util::heapMemory(wire));
+   * report.print(std::cout);
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   */
+  class MemoryUsageReport {
+  public:
+    /// Memory used by a component.
+    struct Component_t {
+      std::string name;       ///< Name of the component.
+      std::size_t count = 0U; ///< Number of instances.
+      std::size_t bytes = 0U; ///< Total memory [bytes]
+    };
+
+    /// Adds `count` instances using a total of `bytes` to component `name`.
+    void add(std::string const& name, std::size_t bytes, std::size_t count = 1U)
+    {
+      Component_t& component = fetch(name);
+      component.count += count;
+      component.bytes += bytes;
+    }
+
+    /// Adds all the components of `other` to this report.
+    void merge(MemoryUsageReport const& other)
+    {
+      for (Component_t const& component : other.components())
+        add(component.name, component.bytes, component.count);
+    }
+
+    /// Returns all the components, in the order they were first added.
+    std::vector<Component_t> const& components() const { return fComponents; }
+
+    /// Returns the component `name` (`nullptr` if not present).
+    Component_t const* find(std::string const& name) const
+    {
+      for (Component_t const& component : fComponents)
+        if (component.name == name) return &component;
+      return nullptr;
+    }
+
+    /// Returns the memory of the component `name` (`0` if not present).
+    std::size_t bytes(std::string const& name) const
+    {
+      Component_t const* component = find(name);
+      return component ? component->bytes : 0U;
+    }
+
+    /// Returns the total memory of all components [bytes]
+    std::size_t totalBytes() const
+    {
+      std::size_t total = 0U;
+      for (Component_t const& component : fComponents)
+        total += component.bytes;
+      return total;
+    }
+
+    /// Prints a table of the components into `out`.
+    template <typename Stream>
+    void print(Stream&& out, std::string const& indent = "") const;
+
+  private:
+    std::vector<Component_t> fComponents; ///< All the components.
+
+    /// Returns the component `name`, creating it if needed.
+    Component_t& fetch(std::string const& name)
+    {
+      for (Component_t& component : fComponents)
+        if (component.name == name) return component;
+      fComponents.push_back({name, 0U, 0U});
+      return fComponents.back();
+    }
+
+  }; // class MemoryUsageReport
+
+} // namespace lar::util
+
+//------------------------------------------------------------------------------
+//--- template implementation
+//------------------------------------------------------------------------------
+template <typename T>
+std::size_t lar::util::heapMemory(T const& obj)
+{
+  if constexpr (details::hasHeapMemoryMember<T>::value)
+    return obj.heapMemory();
+  else
+    return 0U;
+} // lar::util::heapMemory()
+
+//------------------------------------------------------------------------------
+template <typename Iter>
+std::size_t lar::util::elementHeapMemory(Iter begin, Iter end)
+{
+  std::size_t bytes = 0U;
+  for (auto it = begin; it != end; ++it)
+    bytes += heapMemory(*it);
+  return bytes;
+} // lar::util::elementHeapMemory()
+
+//------------------------------------------------------------------------------
+template <typename T, typename A>
+std::size_t lar::util::heapMemory(std::vector<T, A> const& v)
+{
+  std::size_t bytes = v.capacity() * sizeof(T);
+  if constexpr (details::mayAllocate<T>) bytes += elementHeapMemory(v.begin(), v.end());
+  return bytes;
+} // lar::util::heapMemory(std::vector)
+
+//------------------------------------------------------------------------------
+template <typename C, typename Tr, typename A>
+std::size_t lar::util::heapMemory(std::basic_string<C, Tr, A> const& s)
+{
+  // short strings are stored within the object itself
+  auto const* const data = reinterpret_cast<char const*>(s.data());
+  auto const* const self = reinterpret_cast<char const*>(&s);
+  bool const local = (data >= self) && (data < self + sizeof(s));
+  return local ? 0U : (s.capacity() + 1U) * sizeof(C);
+} // lar::util::heapMemory(std::basic_string)
+
+//------------------------------------------------------------------------------
+template <typename T, typename D>
+std::size_t lar::util::heapMemory(std::unique_ptr<T, D> const& ptr)
+{
+  return ptr ? (sizeof(T) + heapMemory(*ptr)) : 0U;
+} // lar::util::heapMemory(std::unique_ptr)
+
+//------------------------------------------------------------------------------
+template <typename A, typename B>
+std::size_t lar::util::heapMemory(std::pair<A, B> const& p)
+{
+  return heapMemory(p.first) + heapMemory(p.second);
+} // lar::util::heapMemory(std::pair)
+
+//------------------------------------------------------------------------------
+template <typename T, std::size_t N>
+std::size_t lar::util::heapMemory(std::array<T, N> const& a)
+{
+  if constexpr (details::mayAllocate<T>)
+    return elementHeapMemory(a.begin(), a.end());
+  else
+    return 0U;
+} // lar::util::heapMemory(std::array)
+
+//------------------------------------------------------------------------------
+template <typename K, typename C, typename A>
+std::size_t lar::util::heapMemory(std::set<K, C, A> const& s)
+{
+  return s.size() * (sizeof(K) + details::TreeNodeOverhead) + elementHeapMemory(s.begin(), s.end());
+} // lar::util::heapMemory(std::set)
+
+//------------------------------------------------------------------------------
+template <typename K, typename V, typename C, typename A>
+std::size_t lar::util::heapMemory(std::map<K, V, C, A> const& m)
+{
+  using Value_t = typename std::map<K, V, C, A>::value_type;
+  return m.size() * (sizeof(Value_t) + details::TreeNodeOverhead) +
+         elementHeapMemory(m.begin(), m.end());
+} // lar::util::heapMemory(std::map)
+
+//------------------------------------------------------------------------------
+template <typename K, typename V, typename H, typename E, typename A>
+std::size_t lar::util::heapMemory(std::unordered_map<K, V, H, E, A> const& m)
+{
+  using Value_t = typename std::unordered_map<K, V, H, E, A>::value_type;
+  return m.bucket_count() * sizeof(void*) +
+         m.size() * (sizeof(Value_t) + details::HashNodeOverhead) +
+         elementHeapMemory(m.begin(), m.end());
+} // lar::util::heapMemory(std::unordered_map)
+
+//------------------------------------------------------------------------------
+template <typename Stream>
+void lar::util::MemoryUsageReport::print(Stream&& out, std::string const& indent /* = "" */) const
+{
+  std::size_t nameWidth = 9U;
+  for (Component_t const& component : fComponents)
+    nameWidth = std::max(nameWidth, component.name.length());
+
+  out << indent << std::left << std::setw(nameWidth) << "component" << std::right << std::setw(10)
+      << "count" << std::setw(14) << "bytes" << std::setw(12) << "KiB";
+  for (Component_t const& component : fComponents) {
+    out << "\n"
+        << indent << std::left << std::setw(nameWidth) << component.name << std::right
+        << std::setw(10) << component.count << std::setw(14) << component.bytes << std::setw(12)
+        << (component.bytes / 1024U);
+  }
+  std::size_t const total = totalBytes();
+  out << "\n"
+      << indent << std::left << std::setw(nameWidth) << "total" << std::right << std::setw(10)
+      << "" << std::setw(14) << total << std::setw(12) << (total / 1024U);
+} // lar::util::MemoryUsageReport::print()
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREALG_COREUTILS_MEMORYUSAGE_H
@@ -0,0 +1,279 @@
+/**
+ * @file   larcorealg/CoreUtils/MonotonicArena.h
+ * @brief  Memory resources for many small objects freed all together.
+ * @date   October 14, 2026
+ *
+ * This is a header only library.
+ */
+
+#ifndef LARCOREALG_COREUTILS_MONOTONICARENA_H
+#define LARCOREALG_COREUTILS_MONOTONICARENA_H
+
+// C/C++ standard libraries
+#include <algorithm> // std::max(), std::copy()
+#include <cstddef>   // std::size_t, std::max_align_t
+#include <memory>    // std::align()
+#include <memory_resource>
+#include <new> // placement new
+#include <string_view>
+#include <type_traits> // std::is_trivially_destructible_v
+#include <utility>     // std::forward()
+#include <vector>
+
+namespace lar::util {
+
+  /**
+   * @brief A `std::pmr::memory_resource` handing out memory from large blocks.
+   *
+   * The arena obtains blocks of memory from an upstream resource and hands
+   * them out in consecutive pieces; deallocation does nothing, and all the
+   * memory is recovered at once by `reset()`, which keeps the blocks for the
+   * following allocations, or by `release()`, which returns them upstream.
+   * Allocations are then a pointer bump, and many small objects built
+   * together end up next to each other, with no fragmentation of the heap.
+   *
+   * It fits two patterns:
+   * * objects which all live as long as the arena, like the indices built
+   *   when a geometry is loaded, strings included (`storeString()`);
+   * * scratch memory of an algorithm run many times (e.g. once per event):
+   *   after a `reset()` at the start of each run, the memory of the previous
+   *   runs is reused and, once the blocks are large enough, no more memory is
+   *   requested upstream.
+   *
+   * Any standard container with a `std::pmr` allocator can use the arena:
+   * ~~~~{.cpp}
+   * lar::util::MonotonicArena arena;
+   * std::pmr::vector<geo::WireID> wires{&arena};
+   * std::pmr::unordered_map<std::string_view, unsigned int> counts{&arena};
+   * ~~~~
+   * The containers must be destroyed (or cleared of their memory) before the
+   * arena is reset. Containers which release and allocate memory all the
+   * time (like node-based maps being filled and emptied) are better served by
+   * a `PoolArena`, which recycles the freed memory.
+   *
+   * The arena is not thread safe: concurrent users need one arena each, or a
+   * lock around it. It can be neither copied nor moved, since containers
+   * point to it.
+   */
+  class MonotonicArena : public std::pmr::memory_resource {
+
+  public:
+    /// Default size of the first block requested upstream [bytes].
+    static constexpr std::size_t DefaultBlockSize = 4096U;
+
+    /**
+     * @brief Constructor: an arena with no memory yet.
+     * @param blockSize size of the first block [bytes]
+     * @param upstream the resource the blocks are requested to
+     *
+     * Each new block is twice as large as the previous one, or as large as
+     * needed by the allocation which requests it.
+     */
+    explicit MonotonicArena(std::size_t blockSize = DefaultBlockSize,
+                            std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+      : fUpstream{upstream}, fNextBlockSize{std::max(blockSize, std::size_t{64U})}
+    {}
+
+    MonotonicArena(MonotonicArena const&) = delete;
+    MonotonicArena& operator=(MonotonicArena const&) = delete;
+
+    ~MonotonicArena() override { release(); }
+
+    // --- BEGIN -- Memory management ------------------------------------------
+    /// Makes all the memory available again, keeping the blocks.
+    void reset()
+    {
+      fCurrent = 0U;
+      fOffset = 0U;
+      fUsed = 0U;
+    }
+
+    /// Returns all the blocks to the upstream resource.
+    void release()
+    {
+      for (Block_t const& block : fBlocks)
+        fUpstream->deallocate(block.data, block.size, BlockAlignment);
+      fReserved = 0U;
+      fBlocks.clear();
+      reset();
+    }
+
+    /// Returns a copy of `s` stored in the arena.
+    std::string_view storeString(std::string_view s)
+    {
+      if (s.empty()) return {};
+      auto const data = static_cast<char*>(allocate(s.size(), alignof(char)));
+      std::copy(s.begin(), s.end(), data);
+      return {data, s.size()};
+    }
+
+    /// Constructs a `T` in the arena; it is never destroyed.
+    template <typename T, typename... Args>
+    T* create(Args&&... args)
+    {
+      static_assert(std::is_trivially_destructible_v<T>,
+                    "MonotonicArena::create() does not call destructors.");
+      return new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+    }
+
+    /// Returns an allocator of `T` using this arena.
+    template <typename T>
+    std::pmr::polymorphic_allocator<T> allocator()
+    {
+      return std::pmr::polymorphic_allocator<T>{this};
+    }
+    // --- END ---- Memory management ------------------------------------------
+
+    // --- BEGIN -- Statistics -------------------------------------------------
+    /// Bytes handed out since the last `reset()`, alignment padding excluded.
+    std::size_t bytesUsed() const { return fUsed; }
+
+    /// Bytes of all the blocks obtained from upstream.
+    std::size_t bytesReserved() const { return fReserved; }
+
+    /// Number of the blocks obtained from upstream.
+    std::size_t nBlocks() const { return fBlocks.size(); }
+
+    /// Returns the memory allocated by the arena [bytes] (for `lar::util::heapMemory()`).
+    std::size_t heapMemory() const { return fReserved + fBlocks.capacity() * sizeof(Block_t); }
+    // --- END ---- Statistics -------------------------------------------------
+
+  protected:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+
+    void do_deallocate(void*, std::size_t, std::size_t) override {}
+
+    bool do_is_equal(std::pmr::memory_resource const& other) const noexcept override
+    {
+      return this == &other;
+    }
+
+  private:
+    /// Alignment of the blocks requested upstream.
+    static constexpr std::size_t BlockAlignment = alignof(std::max_align_t);
+
+    /// A block of memory from upstream.
+    struct Block_t {
+      void* data;       ///< Start of the block.
+      std::size_t size; ///< Size of the block [bytes].
+    };
+
+    std::pmr::memory_resource* fUpstream; ///< Where the blocks come from.
+    std::vector<Block_t> fBlocks;         ///< All the blocks, in order of use.
+    std::size_t fCurrent = 0U;            ///< Index of the block being filled.
+    std::size_t fOffset = 0U;             ///< Bytes already handed out from the current block.
+    std::size_t fNextBlockSize;           ///< Size of the next block [bytes].
+    std::size_t fUsed = 0U;               ///< Bytes handed out since the last reset.
+    std::size_t fReserved = 0U;           ///< Total size of the blocks [bytes].
+
+    /// Returns memory from the current block, or `nullptr` if it does not fit.
+    void* fromCurrentBlock(std::size_t bytes, std::size_t alignment);
+
+  }; // class MonotonicArena
+
+  /**
+   * @brief A pool of recycled memory on a private `MonotonicArena`.
+   *
+   * The memory freed by the users is kept in pools by size and handed out
+   * again (`std::pmr::unsynchronized_pool_resource`), while the pools get new
+   * memory from the arena. This suits containers which keep allocating and
+   * freeing small pieces, like node-based sets and maps; `reset()` frees
+   * everything at once, keeping the memory of the arena.
+   *
+   * Like `MonotonicArena`, this resource is not thread safe.
+   */
+  class PoolArena : public std::pmr::memory_resource {
+
+  public:
+    /// Constructor: the arena requests blocks of `blockSize` upwards from `upstream`.
+    explicit PoolArena(std::size_t blockSize = MonotonicArena::DefaultBlockSize,
+                       std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+      : fArena{blockSize, upstream}
+    {}
+
+    PoolArena(PoolArena const&) = delete;
+    PoolArena& operator=(PoolArena const&) = delete;
+
+    /// Frees all the memory at once, keeping the blocks of the arena.
+    void reset()
+    {
+      fPool.release();
+      fArena.reset();
+    }
+
+    /// Returns the underlying arena.
+    MonotonicArena const& arena() const { return fArena; }
+
+    /// Returns the memory allocated by the pool [bytes] (for `lar::util::heapMemory()`).
+    std::size_t heapMemory() const { return fArena.heapMemory(); }
+
+  protected:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+      return fPool.allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override
+    {
+      fPool.deallocate(p, bytes, alignment);
+    }
+
+    bool do_is_equal(std::pmr::memory_resource const& other) const noexcept override
+    {
+      return this == &other;
+    }
+
+  private:
+    MonotonicArena fArena; ///< Where the pools get their memory from.
+    std::pmr::unsynchronized_pool_resource fPool{&fArena}; ///< The recycled memory.
+
+  }; // class PoolArena
+
+} // namespace lar::util
+
+//------------------------------------------------------------------------------
+//--- inline implementation
+//------------------------------------------------------------------------------
+inline void* lar::util::MonotonicArena::fromCurrentBlock(std::size_t bytes, std::size_t alignment)
+{
+  if (fCurrent >= fBlocks.size()) return nullptr;
+  Block_t const& block = fBlocks[fCurrent];
+  void* p = static_cast<char*>(block.data) + fOffset;
+  std::size_t space = block.size - fOffset;
+  if (!std::align(alignment, bytes, p, space)) return nullptr;
+  fOffset = block.size - space + bytes;
+  return p;
+} // lar::util::MonotonicArena::fromCurrentBlock()
+
+//------------------------------------------------------------------------------
+inline void* lar::util::MonotonicArena::do_allocate(std::size_t bytes, std::size_t alignment)
+{
+  if (bytes == 0U) bytes = 1U; // distinct allocations get distinct addresses
+  void* p = fromCurrentBlock(bytes, alignment);
+
+  // move on to the next block kept by reset(), skipping the ones too small
+  while (!p && fCurrent + 1U < fBlocks.size()) {
+    ++fCurrent;
+    fOffset = 0U;
+    p = fromCurrentBlock(bytes, alignment);
+  }
+
+  if (!p) {
+    // alignments beyond the ones of the blocks may need some padding
+    std::size_t const needed = bytes + ((alignment > BlockAlignment) ? alignment : 0U);
+    std::size_t const size = std::max(fNextBlockSize, needed);
+    fBlocks.reserve(fBlocks.size() + 1U); // no leak if this throws
+    fBlocks.push_back({fUpstream->allocate(size, BlockAlignment), size});
+    fReserved += size;
+    fNextBlockSize = 2U * size;
+    fCurrent = fBlocks.size() - 1U;
+    fOffset = 0U;
+    p = fromCurrentBlock(bytes, alignment);
+  }
+  fUsed += bytes;
+  return p;
+} // lar::util::MonotonicArena::do_allocate()
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREALG_COREUTILS_MONOTONICARENA_H
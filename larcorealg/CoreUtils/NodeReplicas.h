@@ -0,0 +1,248 @@
+/**
+ * @file   larcorealg/CoreUtils/NodeReplicas.h
+ * @brief  Copies of read-only data, one per NUMA node of the machine.
+ * @date   October 14, 2026
+ *
+ * This is a header only library.
+ *
+ * The NUMA topology is read from the Linux `sysfs` (`/sys/devices/system/node`)
+ * and the node of the running thread from the `getcpu()` system call; there is
+ * no dependency on `libnuma`. On other systems, the machine has a single node.
+ */
+
+#ifndef LARCOREALG_COREUTILS_NODEREPLICAS_H
+#define LARCOREALG_COREUTILS_NODEREPLICAS_H
+
+// LArSoft libraries
+#include "larcorealg/CoreUtils/LazyValue.h"
+#include "larcorealg/CoreUtils/MemoryUsage.h"
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <cstdlib> // std::strtoul()
+#include <memory>  // std::unique_ptr
+
+#if defined(__linux__)
+#include <dirent.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#define LARCOREALG_COREUTILS_HAS_NUMA_TOPOLOGY 1
+#endif
+
+namespace lar::util {
+
+  /// Returns the number of NUMA nodes of this machine (`1` if unknown).
+  inline unsigned int numaNodeCount();
+
+  /**
+   * @brief Returns the NUMA node of the processor running the calling thread.
+   * @return the node number, `0` if unknown
+   *
+   * Each thread asks the system once every `NUMAnodeRefreshPeriod` calls, and
+   * returns the cached answer in between: a thread moved by the scheduler to
+   * another node is noticed only later, which costs the speed of some queries
+   * but never their correctness.
+   */
+  inline unsigned int currentNUMAnode();
+
+  /// Number of `currentNUMAnode()` calls between two requests to the system.
+  constexpr unsigned int NUMAnodeRefreshPeriod = 1024U;
+
+  /**
+   * @brief Copies of a read-only object, one for each NUMA node.
+   * @tparam T type of the replicated object
+   *
+   * On machines with more than one NUMA node (e.g. a board with two
+   * processors), a thread reading memory attached to the other node pays a
+   * longer latency for each cache miss. This object keeps a copy of a
+   * read-only `master` object for each node, and `local()` returns the one of
+   * the node the calling thread is running on.
+   *
+   * The copy for a node is made by the first thread asking for it from that
+   * node: the standard Linux policy allocates memory on the node of the thread
+   * first writing it, so that the memory allocated by the copy (for example
+   * the content of vectors) ends up local to the node.
+   * ~~~~{.cpp}
+   * lar::util::NodeReplicas<Tables_t> fReplicas;
+   *
+   * Tables_t const& tables() const { return fReplicas.local(fTables); }
+   * ~~~~
+   * When replication is not enabled, `local()` returns the master itself.
+   *
+   * The master object must not change while there are replicas: after a
+   * change, `reset()` removes the replicas, which are then copied again on
+   * demand. `local()` and `replica()` can be called concurrently; `enable()`,
+   * `disable()` and `reset()` must not be called concurrently with any other
+   * call.
+   */
+  template <typename T>
+  class NodeReplicas {
+  public:
+    using Value_t = T; ///< Type of the replicated object.
+
+    NodeReplicas() = default;
+    NodeReplicas(NodeReplicas const&) = delete;
+    NodeReplicas& operator=(NodeReplicas const&) = delete;
+
+    /**
+     * @brief Starts keeping a copy per NUMA node.
+     * @param nNodes number of copies (by default, one per node of the machine)
+     *
+     * With fewer than two nodes there is nothing to gain, and replication
+     * stays disabled. Existing replicas are removed.
+     */
+    void enable(unsigned int nNodes = numaNodeCount());
+
+    /// Removes all the replicas and stops replicating.
+    void disable()
+    {
+      fSlots.reset();
+      fNReplicas = 0U;
+    }
+
+    /// Removes all the replicas, which will be copied again from the master.
+    void reset();
+
+    /// Returns whether replication is enabled.
+    bool enabled() const { return fNReplicas > 0U; }
+
+    /// Returns the number of replicas kept (`0` if not enabled).
+    unsigned int nReplicas() const { return fNReplicas; }
+
+    /// Returns whether the replica for `node` has been copied already.
+    bool hasReplica(unsigned int node) const
+    {
+      return enabled() && fSlots[node % fNReplicas].value.done();
+    }
+
+    /// Returns the copy of `master` for the node of the calling thread.
+    Value_t const& local(Value_t const& master) const
+    {
+      return enabled() ? replica(currentNUMAnode(), master) : master;
+    }
+
+    /// Returns the copy of `master` for the specified `node`.
+    Value_t const& replica(unsigned int node, Value_t const& master) const;
+
+    /// Returns the memory allocated for the replicas copied so far.
+    std::size_t heapMemory() const;
+
+  private:
+    /// A replica, alone in its cache lines.
+    struct alignas(64) Slot_t {
+      LazyValue<Value_t> value;
+    };
+
+    std::unique_ptr<Slot_t[]> fSlots; ///< The replicas, by node.
+    unsigned int fNReplicas = 0U;     ///< Number of replicas in `fSlots`.
+
+  }; // class NodeReplicas
+
+  namespace details {
+
+    /// Node of a thread and calls left before asking the system again.
+    struct ThreadNUMAnode_t {
+      unsigned int node = 0U;
+      unsigned int callsLeft = 0U;
+    };
+
+    /// The cached node of the current thread.
+    inline thread_local ThreadNUMAnode_t threadNUMAnode;
+
+    /// Asks the system the node of the processor running the calling thread.
+    inline unsigned int readCurrentNUMAnode()
+    {
+#if defined(LARCOREALG_COREUTILS_HAS_NUMA_TOPOLOGY) && defined(SYS_getcpu)
+      unsigned int cpu = 0U, node = 0U;
+      if (syscall(SYS_getcpu, &cpu, &node, nullptr) == 0) return node;
+#endif
+      return 0U;
+    }
+
+    /// Returns the number of nodes listed in `sysfs` (`1` if none).
+    inline unsigned int readNUMAnodeCount()
+    {
+      unsigned int nNodes = 1U;
+#if defined(LARCOREALG_COREUTILS_HAS_NUMA_TOPOLOGY)
+      DIR* const dir = opendir("/sys/devices/system/node");
+      if (!dir) return nNodes;
+      while (dirent const* entry = readdir(dir)) {
+        char const* name = entry->d_name;
+        if ((name[0] != 'n') || (name[1] != 'o') || (name[2] != 'd') || (name[3] != 'e'))
+          continue;
+        if ((name[4] < '0') || (name[4] > '9')) continue;
+        char* end = nullptr;
+        unsigned long const node = std::strtoul(name + 4, &end, 10);
+        if ((*end == '\0') && (node + 1U > nNodes)) nNodes = node + 1U;
+      }
+      closedir(dir);
+#endif
+      return nNodes;
+    }
+
+  } // namespace details
+
+} // namespace lar::util
+
+//------------------------------------------------------------------------------
+//--- template implementation
+//------------------------------------------------------------------------------
+inline unsigned int lar::util::numaNodeCount()
+{
+  static unsigned int const nNodes = details::readNUMAnodeCount();
+  return nNodes;
+}
+
+inline unsigned int lar::util::currentNUMAnode()
+{
+  details::ThreadNUMAnode_t& cache = details::threadNUMAnode;
+  if (cache.callsLeft == 0U) {
+    cache.node = details::readCurrentNUMAnode();
+    cache.callsLeft = NUMAnodeRefreshPeriod;
+  }
+  --cache.callsLeft;
+  return cache.node;
+}
+
+//------------------------------------------------------------------------------
+template <typename T>
+void lar::util::NodeReplicas<T>::enable(unsigned int nNodes)
+{
+  disable();
+  if (nNodes < 2U) return;
+  fSlots = std::make_unique<Slot_t[]>(nNodes);
+  fNReplicas = nNodes;
+}
+
+//------------------------------------------------------------------------------
+template <typename T>
+void lar::util::NodeReplicas<T>::reset()
+{
+  for (unsigned int node = 0; node < fNReplicas; ++node)
+    fSlots[node].value.reset();
+}
+
+//------------------------------------------------------------------------------
+template <typename T>
+auto lar::util::NodeReplicas<T>::replica(unsigned int node, Value_t const& master) const
+  -> Value_t const&
+{
+  if (!enabled()) return master;
+  return fSlots[node % fNReplicas].value.get([&master]() { return master; });
+}
+
+//------------------------------------------------------------------------------
+template <typename T>
+std::size_t lar::util::NodeReplicas<T>::heapMemory() const
+{
+  std::size_t memory = fNReplicas * sizeof(Slot_t);
+  for (unsigned int node = 0; node < fNReplicas; ++node) {
+    if (Value_t const* value = fSlots[node].value.getIfDone())
+      memory += lar::util::heapMemory(*value);
+  }
+  return memory;
+}
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREALG_COREUTILS_NODEREPLICAS_H
@@ -11,15 +11,19 @@
 #define LARCOREALG_COREUTILS_PARTICLEFILTERS_H
 
 // LArSoft libraries
+#include "larcorealg/CoreUtils/span.h"
 
 // ROOT libraries
+#include "TGeoBBox.h"
 #include "TGeoMatrix.h" // TGeoCombiTrans
 #include "TGeoVolume.h"
 #include "TLorentzVector.h"
 #include "TVector3.h"
 
 // C/C++ standard libraries
+#include <algorithm> // std::min(), std::max()
 #include <array>
+#include <limits>  // std::numeric_limits<>
 #include <utility> // std::move()
 #include <vector>
 
@@ -42,6 +46,14 @@ namespace util {
    * volumes, the whole track it belongs to must to be kept.
    *
    * No condition for prompt rejection is provided.
+   *
+   * The bounding box of each volume in world coordinates and its
+   * transformation are extracted on construction: a point is transformed into
+   * the volume frame (and `TGeoVolume::Contains()` asked) only if it is inside
+   * that box. A whole trajectory can be checked at once with
+   * `mustKeep(util::span)`, which also skips all the volumes that the box of
+   * the trajectory does not touch. Since the transformations are copied, the
+   * ROOT objects they come from must not be changed after construction.
    */
   class PositionInVolumeFilter : public KeepByPositionFilterTag {
   public:
@@ -52,11 +64,92 @@ namespace util {
     struct VolumeInfo_t {
       VolumeInfo_t(TGeoVolume const* new_vol, TGeoCombiTrans const* new_trans)
         : vol(new_vol), trans(new_trans)
-      {}
+      {
+        extractTransformation();
+        extractWorldBox();
+      }
 
       TGeoVolume const* vol;       ///< ROOT volume
       TGeoCombiTrans const* trans; ///< volume transformation (has both ways)
-    };                             // VolumeInfo_t
+
+      double rotation[9] = {1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0}; ///< From local.
+      double translation[3] = {0.0, 0.0, 0.0}; ///< Volume origin in world frame.
+      Point_t boxMin; ///< Lower corner of the bounding box in world frame.
+      Point_t boxMax; ///< Upper corner of the bounding box in world frame.
+
+      /// Returns whether `pos` (world frame) is in the bounding box.
+      bool inBox(Point_t const& pos) const
+      {
+        return (pos[0] >= boxMin[0]) && (pos[0] <= boxMax[0]) && (pos[1] >= boxMin[1]) &&
+               (pos[1] <= boxMax[1]) && (pos[2] >= boxMin[2]) && (pos[2] <= boxMax[2]);
+      }
+
+      /// Returns whether the box from `min` to `max` overlaps the bounding box.
+      bool overlapsBox(Point_t const& min, Point_t const& max) const
+      {
+        return (min[0] <= boxMax[0]) && (max[0] >= boxMin[0]) && (min[1] <= boxMax[1]) &&
+               (max[1] >= boxMin[1]) && (min[2] <= boxMax[2]) && (max[2] >= boxMin[2]);
+      }
+
+      /// Returns whether `pos` (world frame) is in the volume.
+      bool contains(Point_t const& pos) const
+      {
+        if (!inBox(pos)) return false;
+        // same operations as `TGeoCombiTrans::MasterToLocal()`
+        double const shifted[3] = {
+          pos[0] - translation[0], pos[1] - translation[1], pos[2] - translation[2]};
+        double const local[3] = {
+          shifted[0] * rotation[0] + shifted[1] * rotation[3] + shifted[2] * rotation[6],
+          shifted[0] * rotation[1] + shifted[1] * rotation[4] + shifted[2] * rotation[7],
+          shifted[0] * rotation[2] + shifted[1] * rotation[5] + shifted[2] * rotation[8]};
+        return vol->Contains(local);
+      }
+
+    private:
+      /// Absolute padding of the bounding box, covering rounding [cm]
+      static constexpr double BoxPadding = 1e-6;
+
+      void extractTransformation()
+      {
+        if (!trans) return;
+        double const* const rot = trans->GetRotationMatrix();
+        std::copy(rot, rot + 9, rotation);
+        double const* const tr = trans->GetTranslation();
+        std::copy(tr, tr + 3, translation);
+      }
+
+      /// Boxes the corners of the shape bounding box; unbounded if not known.
+      void extractWorldBox()
+      {
+        constexpr double inf = std::numeric_limits<double>::infinity();
+        auto const* shape = vol ? dynamic_cast<TGeoBBox const*>(vol->GetShape()) : nullptr;
+        if (!shape) {
+          boxMin = {-inf, -inf, -inf};
+          boxMax = {inf, inf, inf};
+          return;
+        }
+        double const* const origin = shape->GetOrigin();
+        double const halfSize[3] = {shape->GetDX(), shape->GetDY(), shape->GetDZ()};
+        boxMin = {inf, inf, inf};
+        boxMax = {-inf, -inf, -inf};
+        for (unsigned int corner = 0; corner < 8; ++corner) {
+          double local[3];
+          for (unsigned int i = 0; i < 3; ++i)
+            local[i] = origin[i] + (((corner >> i) & 1U) ? halfSize[i] : -halfSize[i]);
+          for (unsigned int i = 0; i < 3; ++i) {
+            double const world = translation[i] + rotation[3 * i] * local[0] +
+                                 rotation[3 * i + 1] * local[1] + rotation[3 * i + 2] * local[2];
+            boxMin[i] = std::min(boxMin[i], world);
+            boxMax[i] = std::max(boxMax[i], world);
+          }
+        } // for corners
+        for (unsigned int i = 0; i < 3; ++i) {
+          boxMin[i] -= BoxPadding;
+          boxMax[i] += BoxPadding;
+        }
+      } // extractWorldBox()
+
+    }; // VolumeInfo_t
 
     using AllVolumeInfo_t = std::vector<VolumeInfo_t>;
 
@@ -81,29 +174,74 @@ namespace util {
     {
       // if no volume is specified, it means we don't filter
       if (volumeInfo.empty()) return true;
-      double local[3];
       for (auto const& info : volumeInfo) {
-        // transform the point to relative to the volume
-        info.trans->MasterToLocal(pos.data(), local);
-        // containment check
-        if (info.vol->Contains(local)) return true;
+        if (info.contains(pos)) return true;
       } // for volumes
       return false;
     } // mustKeep()
 
-    bool mustKeep(TVector3 const& pos) const
+    bool mustKeep(TVector3 const& pos) const { return mustKeep(toPoint(pos)); }
+
+    bool mustKeep(TLorentzVector const& pos) const { return mustKeep(toPoint(pos)); }
+
+    /**
+     * @brief Returns whether a track along any of the specified points must be kept
+     * @param points the points of the track (`Point_t`, `TVector3` or `TLorentzVector`)
+     * @return whether any of the points requires the track to be kept
+     * @see `firstToKeep()`
+     */
+    template <typename Iter>
+    bool mustKeep(util::span<Iter> const& points) const
     {
-      return mustKeep(Point_t{{pos.X(), pos.Y(), pos.Z()}});
+      return firstToKeep(points.begin(), points.end()) != points.end();
     }
 
-    bool mustKeep(TLorentzVector const& pos) const
+    /**
+     * @brief Returns the first of the points that requires the track to be kept
+     * @param begin iterator to the first point of the track
+     * @param end iterator past the last point of the track
+     * @return iterator to the first point to keep, `end` if none
+     *
+     * The volumes are first selected by their overlap with the box of all the
+     * points, and each point is then checked only against the selected ones.
+     */
+    template <typename Iter>
+    Iter firstToKeep(Iter begin, Iter end) const
     {
-      return mustKeep(Point_t{{pos.X(), pos.Y(), pos.Z()}});
-    }
+      if (volumeInfo.empty()) return begin;
+      if (begin == end) return begin;
+
+      constexpr double inf = std::numeric_limits<double>::infinity();
+      Point_t min{inf, inf, inf}, max{-inf, -inf, -inf};
+      for (auto it = begin; it != end; ++it) {
+        Point_t const pos = toPoint(*it);
+        for (unsigned int i = 0; i < 3; ++i) {
+          min[i] = std::min(min[i], pos[i]);
+          max[i] = std::max(max[i], pos[i]);
+        }
+      }
+      std::vector<VolumeInfo_t const*> candidates;
+      for (auto const& info : volumeInfo) {
+        if (info.overlapsBox(min, max)) candidates.push_back(&info);
+      }
+      if (candidates.empty()) return end;
+
+      for (; begin != end; ++begin) {
+        Point_t const pos = toPoint(*begin);
+        for (VolumeInfo_t const* info : candidates) {
+          if (info->contains(pos)) return begin;
+        }
+      } // for points
+      return begin;
+    } // firstToKeep()
 
   protected:
     std::vector<VolumeInfo_t> volumeInfo; ///< all good volumes
 
+    static Point_t const& toPoint(Point_t const& pos) { return pos; }
+    static Point_t toPoint(TVector3 const& pos) { return {{pos.X(), pos.Y(), pos.Z()}}; }
+    static Point_t toPoint(TLorentzVector const& pos) { return {{pos.X(), pos.Y(), pos.Z()}}; }
+
   }; // PositionInVolumeFilter
 
 } // namespace util
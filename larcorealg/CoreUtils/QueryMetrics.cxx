@@ -0,0 +1,128 @@
+/**
+ * @file   larcorealg/CoreUtils/QueryMetrics.cxx
+ * @brief  Per-thread counters and latency histograms of service queries.
+ * @see    `larcorealg/CoreUtils/QueryMetrics.h`
+ *
+ */
+
+// library header
+#include "larcorealg/CoreUtils/QueryMetrics.h"
+
+// C/C++ standard libraries
+#include <cmath> // std::ldexp()
+
+//-----------------------------------------------------------------------------
+//--- lar::util::QueryMetrics::Stats_t
+//---
+double lar::util::QueryMetrics::Stats_t::meanLatency() const
+{
+  return (timedCalls == 0U) ? 0.0 : static_cast<double>(totalTimeNs) / timedCalls;
+}
+
+double lar::util::QueryMetrics::Stats_t::latencyQuantile(double fraction) const
+{
+  if (timedCalls == 0U) return 0.0;
+  double const target = fraction * timedCalls;
+  std::uint64_t cumulative = 0U;
+  for (std::size_t iBin = 0; iBin < NLatencyBins; ++iBin) {
+    cumulative += latency[iBin];
+    if (cumulative >= target) return std::ldexp(1.0, iBin);
+  }
+  return std::ldexp(1.0, NLatencyBins);
+} // lar::util::QueryMetrics::Stats_t::latencyQuantile()
+
+//-----------------------------------------------------------------------------
+//--- lar::util::QueryMetrics::Scope_t
+//---
+void lar::util::QueryMetrics::Scope_t::start()
+{
+  fExceptions = std::uncaught_exceptions();
+  if (fMetrics->timing()) fStart = std::chrono::steady_clock::now();
+}
+
+void lar::util::QueryMetrics::Scope_t::stop()
+{
+  bool const thrown = std::uncaught_exceptions() > fExceptions;
+  if (fMetrics->timing()) {
+    std::chrono::nanoseconds const duration = std::chrono::steady_clock::now() - fStart;
+    fMetrics->record(fQuery, thrown, &duration);
+  }
+  else
+    fMetrics->record(fQuery, thrown, nullptr);
+} // lar::util::QueryMetrics::Scope_t::stop()
+
+//-----------------------------------------------------------------------------
+//--- lar::util::QueryMetrics
+//---
+lar::util::QueryMetrics::QueryMetrics(std::vector<std::string> queries, Config_t const& config)
+  : fConfig{config}
+  , fQueryNames{std::move(queries)}
+  , fLinesPerShard{(fQueryNames.size() * NCounters + Line_t::N - 1U) / Line_t::N}
+  , fLines{new Line_t[NShards * fLinesPerShard]}
+{
+  reset();
+}
+
+//-----------------------------------------------------------------------------
+auto lar::util::QueryMetrics::stats(std::size_t query) const -> Stats_t
+{
+  auto const sum = [this, query](std::size_t index) {
+    std::uint64_t n = 0U;
+    for (std::size_t shard = 0; shard < NShards; ++shard)
+      n += counter(shard, query, index).load(std::memory_order_relaxed);
+    return n;
+  };
+
+  Stats_t stats;
+  stats.calls = sum(CallCounter);
+  stats.misses = sum(MissCounter);
+  stats.throws = sum(ThrowCounter);
+  stats.timedCalls = sum(TimedCounter);
+  stats.totalTimeNs = sum(TimeCounter);
+  for (std::size_t iBin = 0; iBin < NLatencyBins; ++iBin)
+    stats.latency[iBin] = sum(LatencyCounter + iBin);
+  return stats;
+} // lar::util::QueryMetrics::stats()
+
+//-----------------------------------------------------------------------------
+void lar::util::QueryMetrics::reset()
+{
+  for (std::size_t i = 0; i < NShards * fLinesPerShard; ++i)
+    for (std::atomic<std::uint64_t>& c : fLines[i].counters)
+      c.store(0U, std::memory_order_relaxed);
+}
+
+//-----------------------------------------------------------------------------
+std::size_t lar::util::QueryMetrics::shardIndex()
+{
+  // threads are assigned shards in turn, the first time they record anything
+  static std::atomic<std::size_t> nextShard{0U};
+  thread_local std::size_t const shard =
+    nextShard.fetch_add(1U, std::memory_order_relaxed) % NShards;
+  return shard;
+}
+
+//-----------------------------------------------------------------------------
+void lar::util::QueryMetrics::record(std::size_t query,
+                                     bool thrown,
+                                     std::chrono::nanoseconds const* duration)
+{
+  std::size_t const shard = shardIndex();
+  auto const add = [this, shard, query](std::size_t index, std::uint64_t n = 1U) {
+    counter(shard, query, index).fetch_add(n, std::memory_order_relaxed);
+  };
+
+  add(CallCounter);
+  if (thrown) add(ThrowCounter);
+  if (!duration) return;
+
+  std::uint64_t const ns = (duration->count() > 0) ? duration->count() : 0U;
+  std::size_t iBin = 0U; // bin of the number of significant bits of `ns`
+  while ((iBin < NLatencyBins - 1U) && ((ns >> iBin) != 0U))
+    ++iBin;
+  add(TimedCounter);
+  add(TimeCounter, ns);
+  add(LatencyCounter + iBin);
+} // lar::util::QueryMetrics::record()
+
+//-----------------------------------------------------------------------------
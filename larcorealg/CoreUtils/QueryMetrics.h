@@ -0,0 +1,231 @@
+/**
+ * @file   larcorealg/CoreUtils/QueryMetrics.h
+ * @brief  Per-thread counters and latency histograms of service queries.
+ * @see    `larcorealg/CoreUtils/QueryMetrics.cxx`
+ *
+ */
+#ifndef LARCOREALG_COREUTILS_QUERYMETRICS_H
+#define LARCOREALG_COREUTILS_QUERYMETRICS_H
+
+// C/C++ standard libraries
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint64_t
+#include <exception> // std::uncaught_exceptions()
+#include <memory>    // std::unique_ptr
+#include <string>
+#include <utility> // std::move()
+#include <vector>
+
+namespace lar::util {
+
+  /**
+   * @brief Counters of calls, misses and exceptions of a set of queries.
+   *
+   * Each instrumented query is assigned an index at construction. A query
+   * records its call by creating a `Scope_t` object for the duration of the
+   * call:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * geo::TPCID Finder::Find(geo::Point_t const& point) const
+   * {
+   *   lar::util::QueryMetrics::Scope_t const query{fMetrics.get(), 0};
+   *   geo::TPCID const tpcid = lookup(point);
+   *   if (!tpcid) query.miss();
+   *   return tpcid;
+   * }
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   * With a null metrics object the scope does nothing, so that a service can
+   * leave its metrics disabled for the price of a pointer check per query.
+   *
+   * The call is counted as thrown if the scope ends because of an exception.
+   * If timing is enabled (`Config_t::timing`), the duration of the calls is
+   * also collected in a histogram with logarithmic bins (`Stats_t`).
+   *
+   * The counters are distributed in `NShards` independent blocks, each thread
+   * using always the same one, so that threads do not compete for the same
+   * memory. The blocks are added together on demand (`stats()`).
+   * Recording is thread-safe; `reset()` is not.
+   */
+  class QueryMetrics {
+  public:
+    /// Number of blocks of counters that the threads are spread across.
+    static constexpr std::size_t NShards = 32U;
+
+    /// Number of latency bins: bin `i` holds durations in [ 2^(i-1), 2^i [ ns.
+    static constexpr std::size_t NLatencyBins = 40U;
+
+    /// Configuration of the metrics.
+    struct Config_t {
+      bool timing = false; ///< Whether to measure the latency of the calls.
+    }; // Config_t
+
+    /// Metrics of a single query, added over all the threads.
+    struct Stats_t {
+      std::uint64_t calls = 0U;       ///< Number of calls.
+      std::uint64_t misses = 0U;      ///< Calls with no result found.
+      std::uint64_t throws = 0U;      ///< Calls ended by an exception.
+      std::uint64_t timedCalls = 0U;  ///< Calls with measured latency.
+      std::uint64_t totalTimeNs = 0U; ///< Total time of the timed calls [ns]
+      std::array<std::uint64_t, NLatencyBins> latency{}; ///< Latency histogram.
+
+      /// Returns the average latency of the timed calls [ns] (`0` if none).
+      double meanLatency() const;
+
+      /// Returns the upper bound of the latency bin with the `fraction` quantile
+      /// [ns] (`0` if no timed call).
+      double latencyQuantile(double fraction) const;
+    }; // Stats_t
+
+    /**
+     * @brief Records a single call of a query; does nothing if no metrics.
+     *
+     * This object is not copyable nor movable: it is meant to live for the
+     * whole call of the query.
+     */
+    class Scope_t {
+    public:
+      Scope_t(QueryMetrics* metrics, std::size_t query) : fMetrics{metrics}, fQuery{query}
+      {
+        if (fMetrics) start();
+      }
+
+      Scope_t(Scope_t const&) = delete;
+      Scope_t(Scope_t&&) = delete;
+      Scope_t& operator=(Scope_t const&) = delete;
+      Scope_t& operator=(Scope_t&&) = delete;
+
+      ~Scope_t()
+      {
+        if (fMetrics) stop();
+      }
+
+      /// Counts this call as a miss (the query found no result).
+      void miss() const
+      {
+        if (fMetrics) fMetrics->add(fQuery, MissCounter);
+      }
+
+    private:
+      QueryMetrics* fMetrics;  ///< Where to record (`nullptr` if none).
+      std::size_t fQuery;      ///< Index of the recorded query.
+      int fExceptions = 0;     ///< Exceptions in flight at the start.
+      std::chrono::steady_clock::time_point fStart; ///< Start time (if timing).
+
+      void start();
+      void stop();
+
+    }; // class Scope_t
+
+    /// Constructor: collects metrics for the `queries`, by position.
+    QueryMetrics(std::vector<std::string> queries, Config_t const& config);
+
+    /// Constructor: collects metrics for the `queries`, without timing.
+    QueryMetrics(std::vector<std::string> queries) : QueryMetrics(std::move(queries), Config_t{})
+    {}
+
+    /// Counts `n` calls to the specified query, without timing.
+    void count(std::size_t query, std::uint64_t n = 1U) { add(query, CallCounter, n); }
+
+    // --- BEGIN -- Access to the results --------------------------------------
+    /// @name Access to the results
+    /// @{
+
+    /// Returns the number of queries.
+    std::size_t nQueries() const { return fQueryNames.size(); }
+
+    /// Returns the name of the specified query.
+    std::string const& queryName(std::size_t query) const { return fQueryNames[query]; }
+
+    /// Returns whether the duration of the calls is measured.
+    bool timing() const { return fConfig.timing; }
+
+    /// Returns the metrics of the specified query, added over all threads.
+    Stats_t stats(std::size_t query) const;
+
+    /**
+     * @brief Prints a table with the metrics of all the called queries.
+     * @tparam Stream type of output stream
+     * @param out the stream to print into
+     *
+     * Queries which were never called are not printed.
+     */
+    template <typename Stream>
+    void print(Stream&& out) const;
+
+    /// Sets all the counters to zero (not thread-safe).
+    void reset();
+
+    /// @}
+    // --- END -- Access to the results ----------------------------------------
+
+  private:
+    /// Position of each counter in the block of a query.
+    enum Counter_t : std::size_t {
+      CallCounter,
+      MissCounter,
+      ThrowCounter,
+      TimedCounter,
+      TimeCounter,
+      LatencyCounter, ///< First of the latency bins.
+      NCounters = LatencyCounter + NLatencyBins
+    };
+
+    /// A cache line worth of counters, so that shards do not share lines.
+    struct alignas(64) Line_t {
+      static constexpr std::size_t N = 64U / sizeof(std::atomic<std::uint64_t>);
+      std::atomic<std::uint64_t> counters[N];
+    };
+
+    Config_t const fConfig;               ///< Metrics configuration.
+    std::vector<std::string> fQueryNames; ///< Name of each query.
+    std::size_t const fLinesPerShard;     ///< Cache lines in a shard.
+    std::unique_ptr<Line_t[]> fLines;     ///< All the counters, by shard.
+
+    /// Returns the shard of the current thread.
+    static std::size_t shardIndex();
+
+    /// Returns the specified counter of `query` in the shard `shard`.
+    std::atomic<std::uint64_t>& counter(std::size_t shard, std::size_t query, std::size_t index)
+      const
+    {
+      std::size_t const i = query * NCounters + index;
+      return fLines[shard * fLinesPerShard + i / Line_t::N].counters[i % Line_t::N];
+    }
+
+    /// Adds `n` to the specified counter of `query` in this thread shard.
+    void add(std::size_t query, std::size_t index, std::uint64_t n = 1U)
+    {
+      counter(shardIndex(), query, index).fetch_add(n, std::memory_order_relaxed);
+    }
+
+    /// Records the end of a call, with its `duration` if measured.
+    void record(std::size_t query, bool thrown, std::chrono::nanoseconds const* duration);
+
+  }; // class QueryMetrics
+
+} // namespace lar::util
+
+//------------------------------------------------------------------------------
+//--- template implementation
+//------------------------------------------------------------------------------
+template <typename Stream>
+void lar::util::QueryMetrics::print(Stream&& out) const
+{
+  out << "Query metrics (" << nQueries() << " queries" << (timing() ? ", timed" : "") << "):";
+  for (std::size_t query = 0; query < nQueries(); ++query) {
+    Stats_t const s = stats(query);
+    if (s.calls == 0U) continue;
+    out << "\n  " << queryName(query) << ": " << s.calls << " calls, " << s.misses << " misses, "
+        << s.throws << " exceptions";
+    if (s.timedCalls > 0U) {
+      out << "; latency [ns]: mean " << s.meanLatency() << ", median < "
+          << s.latencyQuantile(0.5) << ", 99% < " << s.latencyQuantile(0.99);
+    }
+  } // for
+} // lar::util::QueryMetrics::print()
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREALG_COREUTILS_QUERYMETRICS_H
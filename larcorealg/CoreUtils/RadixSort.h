@@ -0,0 +1,214 @@
+/**
+ * @file   larcorealg/CoreUtils/RadixSort.h
+ * @brief  Stable sorting by integral keys in linear time.
+ * @date   October 14, 2026
+ * @see    `larcorealg/CoreUtils/SortByPointers.h`
+ *
+ * This is a header only library.
+ */
+
+#ifndef LARCOREALG_COREUTILS_RADIXSORT_H
+#define LARCOREALG_COREUTILS_RADIXSORT_H
+
+// LArSoft libraries
+#include "larcorealg/CoreUtils/Executor.h"
+#include "larcorealg/CoreUtils/SortByPointers.h" // util::ApplyPermutation()
+
+// C/C++ standard libraries
+#include <algorithm> // std::min()
+#include <array>
+#include <cstddef> // std::size_t
+#include <iterator> // std::iterator_traits<>
+#include <limits>
+#include <type_traits>
+#include <utility> // std::move(), std::swap()
+#include <vector>
+
+namespace util {
+
+  /**
+   * @brief Sorts a range by the integral keys of its elements (stable).
+   * @tparam RandomIt type of random access iterator to the elements
+   * @tparam KeyFn type of function returning the key of an element
+   * @param begin iterator to the first element to sort
+   * @param end iterator past the last element to sort
+   * @param key function returning the (integral) key of an element
+   * @param nBits number of the lowest bits of unsigned keys to sort by
+   *              (`0`: all of them)
+   * @param executor runs the passes on blocks of elements in parallel
+   *
+   * This is a least significant digit radix sort, with one pass per 8 bits
+   * of the key; passes where all the keys share the same digit are skipped.
+   * Elements with the same key keep their order. The keys are computed only
+   * once per element, and each element is moved into its place only once at
+   * the end (`util::ApplyPermutation()`), so it works on heavy elements too.
+   * Signed keys are supported (always on all their bits).
+   *
+   * For example, to sort hits by channel, then by time tick:
+   * ~~~~{.cpp}
+   * util::radixSortByKey(hits.begin(), hits.end(), [](Hit const& hit) {
+   *   return (std::uint64_t{hit.Channel()} << 32) | hit.StartTick();
+   * });
+   * ~~~~
+   * Keys short on bits (like the packed IDs of `geo::GeoIDpacker`) sort
+   * faster with the proper `nBits`. Sorting many elements with a parallel
+   * `executor` splits each pass in blocks, which are counted and then moved
+   * in parallel; the result is the same as the sequential one.
+   */
+  template <typename RandomIt, typename KeyFn>
+  void radixSortByKey(RandomIt begin,
+                      RandomIt end,
+                      KeyFn key,
+                      unsigned int nBits = 0U,
+                      lar::util::Executor const& executor = {});
+
+  /**
+   * @brief A sorter for `util::SortByPointers()` comparing integral keys.
+   * @tparam KeyFn type of the function returning the key of an element
+   * @see `util::makeRadixSorter()`, `util::radixSortByKey()`
+   *
+   * The sorter sorts pointers by the key of the element they point to,
+   * with `util::radixSortByKey()`:
+   * ~~~~{.cpp}
+   * util::SortByPointers(
+   *   hits, util::makeRadixSorter([](Hit const& hit) { return hit.Channel(); }));
+   * ~~~~
+   * It works with `util::SortUniquePointers()` too.
+   */
+  template <typename KeyFn>
+  class RadixSorter {
+  public:
+    RadixSorter(KeyFn key, unsigned int nBits = 0U, lar::util::Executor executor = {})
+      : fKey{std::move(key)}, fNBits{nBits}, fExecutor{std::move(executor)}
+    {}
+
+    /// Sorts the pointers `ptrs` by the key of the pointed elements.
+    template <typename PtrColl>
+    void operator()(PtrColl& ptrs) const
+    {
+      using std::begin, std::end;
+      radixSortByKey(
+        begin(ptrs), end(ptrs), [this](auto const& ptr) { return fKey(*ptr); }, fNBits, fExecutor);
+    }
+
+  private:
+    KeyFn fKey;                    ///< Extraction of the key of an element.
+    unsigned int fNBits;           ///< Number of bits of the key to sort by.
+    lar::util::Executor fExecutor; ///< Executor of the sorting passes.
+  }; // class RadixSorter
+
+  /// Returns a `util::RadixSorter` sorting by `key`.
+  template <typename KeyFn>
+  RadixSorter<KeyFn> makeRadixSorter(KeyFn key,
+                                     unsigned int nBits = 0U,
+                                     lar::util::Executor executor = {})
+  {
+    return {std::move(key), nBits, std::move(executor)};
+  }
+
+} // namespace util
+
+//------------------------------------------------------------------------------
+//--- template implementation
+//------------------------------------------------------------------------------
+namespace util::details {
+
+  /// Makes `key` unsigned, preserving its order.
+  template <typename Key>
+  constexpr std::make_unsigned_t<Key> radixKey(Key key)
+  {
+    using UKey_t = std::make_unsigned_t<Key>;
+    if constexpr (std::is_signed_v<Key>)
+      return static_cast<UKey_t>(key) ^ (UKey_t{1} << (std::numeric_limits<UKey_t>::digits - 1));
+    else
+      return key;
+  } // radixKey()
+
+} // namespace util::details
+
+//------------------------------------------------------------------------------
+template <typename RandomIt, typename KeyFn>
+void util::radixSortByKey(RandomIt begin,
+                          RandomIt end,
+                          KeyFn key,
+                          unsigned int nBits /* = 0U */,
+                          lar::util::Executor const& executor /* = {} */)
+{
+  using Element_t = typename std::iterator_traits<RandomIt>::reference;
+  using Key_t = std::decay_t<std::invoke_result_t<KeyFn&, Element_t>>;
+  static_assert(std::is_integral_v<Key_t>, "radixSortByKey() requires integral keys.");
+  using UKey_t = std::make_unsigned_t<Key_t>;
+
+  constexpr unsigned int DigitBits = 8U;
+  constexpr std::size_t NDigits = std::size_t{1} << DigitBits;
+  constexpr unsigned int KeyBits = std::numeric_limits<UKey_t>::digits;
+  constexpr std::size_t SerialSize = 65536U; // below this, blocks don't pay off
+
+  if ((nBits == 0U) || (nBits > KeyBits) || std::is_signed_v<Key_t>) nBits = KeyBits;
+
+  std::size_t const n = end - begin;
+  if (n < 2U) return;
+
+  std::size_t const nBlocks = (executor.isSerial() || (n < SerialSize)) ?
+                                1U :
+                                std::min<std::size_t>((n + SerialSize - 1U) / SerialSize, 64U);
+  std::size_t const blockSize = (n + nBlocks - 1U) / nBlocks;
+
+  std::vector<UKey_t> keys(n), sortedKeys(n);
+  std::vector<std::size_t> order(n), newOrder(n);
+  executor.parallel_for(0U, n, blockSize, [&](std::size_t first, std::size_t last) {
+    for (std::size_t i = first; i < last; ++i) {
+      keys[i] = details::radixKey(key(begin[i]));
+      order[i] = i;
+    }
+  });
+
+  // offsets[block][digit]: first destination of the elements of that block
+  std::vector<std::array<std::size_t, NDigits>> offsets(nBlocks);
+  for (unsigned int shift = 0; shift < nBits; shift += DigitBits) {
+    auto const digit = [shift](UKey_t k) { return std::size_t((k >> shift) & (NDigits - 1U)); };
+
+    executor.parallel_for(nBlocks, [&](std::size_t iBlock) {
+      auto& counts = offsets[iBlock];
+      counts.fill(0U);
+      std::size_t const last = std::min(n, (iBlock + 1U) * blockSize);
+      for (std::size_t i = iBlock * blockSize; i < last; ++i)
+        ++counts[digit(keys[i])];
+    });
+
+    // all keys with the same digit: this pass would not move anything
+    std::size_t const firstDigit = digit(keys.front());
+    std::size_t sameDigit = 0U;
+    for (auto const& counts : offsets)
+      sameDigit += counts[firstDigit];
+    if (sameDigit == n) continue;
+
+    // prefix sum, digit-major and block-minor, which keeps the sort stable
+    std::size_t total = 0U;
+    for (std::size_t d = 0; d < NDigits; ++d) {
+      for (auto& counts : offsets) {
+        std::size_t const count = counts[d];
+        counts[d] = total;
+        total += count;
+      }
+    }
+
+    executor.parallel_for(nBlocks, [&](std::size_t iBlock) {
+      auto& next = offsets[iBlock];
+      std::size_t const last = std::min(n, (iBlock + 1U) * blockSize);
+      for (std::size_t i = iBlock * blockSize; i < last; ++i) {
+        std::size_t const dest = next[digit(keys[i])]++;
+        sortedKeys[dest] = keys[i];
+        newOrder[dest] = order[i];
+      }
+    });
+    std::swap(keys, sortedKeys);
+    std::swap(order, newOrder);
+  } // for digits
+
+  ApplyPermutation(begin, std::move(order));
+} // util::radixSortByKey()
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREALG_COREUTILS_RADIXSORT_H
@@ -0,0 +1,108 @@
+/**
+ * @file   larcorealg/CoreUtils/SimdDispatch.h
+ * @brief  Compilation of batch kernels for several instruction sets.
+ * @date   October 14, 2026
+ *
+ * This is a header only library.
+ */
+
+#ifndef LARCOREALG_COREUTILS_SIMDDISPATCH_H
+#define LARCOREALG_COREUTILS_SIMDDISPATCH_H
+
+/**
+ * @def LARCOREALG_SIMD_CLONES
+ * @brief Compiles the function it decorates once per vector instruction set.
+ *
+ * The batch kernels of the library are plain loops on arrays, written for the
+ * compiler to vectorize. Decorating one with this macro makes the compiler
+ * emit a version of it for each of AVX-512, AVX2 and the baseline of the
+ * target, and choose the best one for the running processor when the program
+ * is loaded (GCC `target_clones`): a single implementation then uses the
+ * vector units of each node, while the library is still built for the common
+ * baseline.
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * LARCOREALG_SIMD_CLONES
+ * void scale(std::size_t n, double const* __restrict__ in, double* __restrict__ out);
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * The macro goes on the first declaration of the function, and the function
+ * should process a whole array: calling it has the cost of an indirect call,
+ * and it is not inlined.
+ *
+ * The versions differ only in the width of the vectors: the contraction of
+ * multiplications and additions into fused multiply-add instructions (which
+ * AVX-512 provides) is disabled in all of them, so that they all give the
+ * same results.
+ *
+ * The clones are made only by GCC on x86-64 ELF platforms, where the dispatch
+ * is supported by the loader. Elsewhere the macro is empty, and the function
+ * is vectorized for the instruction set of the build (on 64-bit ARM, NEON is
+ * always available). Defining `LARCOREALG_NO_SIMD_CLONES` disables the clones,
+ * for example to profile a single version.
+ */
+#if !defined(LARCOREALG_NO_SIMD_CLONES) && defined(__GNUC__) && !defined(__clang__) && \
+  defined(__x86_64__) && defined(__ELF__)
+#define LARCOREALG_SIMD_CLONES                                \
+  __attribute__((target_clones("avx512f", "avx2", "default"), \
+                 optimize("fp-contract=off")))
+#define LARCOREALG_HAS_SIMD_CLONES 1
+#else
+#define LARCOREALG_SIMD_CLONES
+#define LARCOREALG_HAS_SIMD_CLONES 0
+#endif
+
+namespace util::simd {
+
+  /// Vector instruction sets the kernels may run with.
+  enum class InstructionSet {
+    Generic, ///< No known vector instructions.
+    SSE2,    ///< x86-64 baseline.
+    AVX2,    ///< x86-64 with AVX2.
+    AVX512,  ///< x86-64 with AVX-512 (foundation).
+    NEON     ///< ARM Advanced SIMD.
+  }; // InstructionSet
+
+  /**
+   * @brief Returns the instruction set the kernels run with on this processor.
+   *
+   * With the clones of `LARCOREALG_SIMD_CLONES`, this is the best set which
+   * both the processor and the clones support; otherwise, the one the library
+   * was built for.
+   */
+  inline InstructionSet dispatchedInstructionSet()
+  {
+#if LARCOREALG_HAS_SIMD_CLONES
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) return InstructionSet::AVX512;
+    if (__builtin_cpu_supports("avx2")) return InstructionSet::AVX2;
+    return InstructionSet::SSE2;
+#elif defined(__AVX512F__)
+    return InstructionSet::AVX512;
+#elif defined(__AVX2__)
+    return InstructionSet::AVX2;
+#elif defined(__SSE2__)
+    return InstructionSet::SSE2;
+#elif defined(__ARM_NEON)
+    return InstructionSet::NEON;
+#else
+    return InstructionSet::Generic;
+#endif
+  } // dispatchedInstructionSet()
+
+  /// Returns the name of the instruction set `set`.
+  constexpr char const* name(InstructionSet set)
+  {
+    switch (set) {
+    case InstructionSet::SSE2: return "SSE2";
+    case InstructionSet::AVX2: return "AVX2";
+    case InstructionSet::AVX512: return "AVX-512";
+    case InstructionSet::NEON: return "NEON";
+    case InstructionSet::Generic: break;
+    }
+    return "generic";
+  } // name()
+
+} // namespace util::simd
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREALG_COREUTILS_SIMDDISPATCH_H
@@ -0,0 +1,323 @@
+/**
+ * @file   larcorealg/CoreUtils/SmallVector.h
+ * @brief  A vector storing its first elements within itself.
+ * @date   October 14, 2026
+ *
+ * This is a header only library.
+ */
+
+#ifndef LARCOREALG_COREUTILS_SMALLVECTOR_H
+#define LARCOREALG_COREUTILS_SMALLVECTOR_H
+
+// C/C++ standard libraries
+#include <algorithm> // std::equal(), std::max()
+#include <cassert>
+#include <cstddef> // std::size_t
+#include <initializer_list>
+#include <iterator> // std::iterator_traits<>
+#include <memory>   // std::allocator<>, std::uninitialized_move(), ...
+#include <new>      // placement new
+#include <utility>  // std::move(), std::forward()
+
+namespace util {
+
+  /**
+   * @brief A sequence container with room for `N` elements without allocation.
+   * @tparam T type of the contained elements
+   * @tparam N number of elements stored inside the object itself
+   *
+   * This container behaves like a `std::vector`, except that the first `N`
+   * elements are stored in a buffer inside the object: up to that size no
+   * memory is allocated on the heap. Beyond `N` the elements are moved to
+   * the heap, and the container keeps working as a vector.
+   *
+   * It is meant for lists which are almost always very short, like the wires
+   * of a channel or the TPCs of a TPC set:
+   * ~~~~{.cpp}
+   * geo::GeometryCore::WireIDlist_t wires; // room for 2 wires
+   * for (raw::ChannelID_t channel: channels) {
+   *   geom.ChannelToWire(channel, wires); // no allocation for up to 2 wires
+   *   // ...
+   * }
+   * ~~~~
+   * Since the buffer is part of the object, moving a container whose elements
+   * are inline moves each of the elements, and invalidates their iterators.
+   */
+  template <typename T, std::size_t N>
+  class small_vector {
+    static_assert(N > 0U, "small_vector must have room for at least one inline element.");
+
+  public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = T const&;
+    using pointer = T*;
+    using const_pointer = T const*;
+    using iterator = T*;
+    using const_iterator = T const*;
+
+    /// Number of elements stored without allocation.
+    static constexpr size_type inline_capacity = N;
+
+    // --- BEGIN -- Construction and assignment --------------------------------
+    /// Constructor: an empty container.
+    small_vector() noexcept {}
+
+    /// Constructor: `n` copies of `value`.
+    explicit small_vector(size_type n, T const& value = T{}) { resize(n, value); }
+
+    /// Constructor: copies of the elements in `values`.
+    small_vector(std::initializer_list<T> values) { assign(values.begin(), values.end()); }
+
+    /// Constructor: copies of the elements from `first` to `last`.
+    template <typename Iter, typename = typename std::iterator_traits<Iter>::iterator_category>
+    small_vector(Iter first, Iter last)
+    {
+      assign(first, last);
+    }
+
+    small_vector(small_vector const& other) { assign(other.begin(), other.end()); }
+
+    small_vector(small_vector&& other) noexcept { takeFrom(std::move(other)); }
+
+    ~small_vector() { release(); }
+
+    small_vector& operator=(small_vector const& other)
+    {
+      if (this != &other) assign(other.begin(), other.end());
+      return *this;
+    }
+
+    small_vector& operator=(small_vector&& other) noexcept
+    {
+      if (this != &other) {
+        release();
+        takeFrom(std::move(other));
+      }
+      return *this;
+    }
+
+    /// Replaces the content with copies of the elements from `first` to `last`.
+    template <typename Iter>
+    void assign(Iter first, Iter last);
+    // --- END ---- Construction and assignment --------------------------------
+
+    // --- BEGIN -- Access -----------------------------------------------------
+    size_type size() const noexcept { return fSize; }
+    size_type capacity() const noexcept { return fCapacity; }
+    bool empty() const noexcept { return fSize == 0U; }
+
+    /// Returns whether the elements are stored inside the object (no heap).
+    bool is_inline() const noexcept { return fHeap == nullptr; }
+
+    T* data() noexcept { return fHeap ? fHeap : inlineData(); }
+    T const* data() const noexcept { return fHeap ? fHeap : inlineData(); }
+
+    iterator begin() noexcept { return data(); }
+    iterator end() noexcept { return data() + fSize; }
+    const_iterator begin() const noexcept { return data(); }
+    const_iterator end() const noexcept { return data() + fSize; }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+
+    T& operator[](size_type i) noexcept
+    {
+      assert(i < fSize);
+      return data()[i];
+    }
+    T const& operator[](size_type i) const noexcept
+    {
+      assert(i < fSize);
+      return data()[i];
+    }
+
+    T& front() noexcept { return (*this)[0]; }
+    T const& front() const noexcept { return (*this)[0]; }
+    T& back() noexcept { return (*this)[fSize - 1]; }
+    T const& back() const noexcept { return (*this)[fSize - 1]; }
+    // --- END ---- Access -----------------------------------------------------
+
+    // --- BEGIN -- Modification -----------------------------------------------
+    /// Constructs a new element at the end, from `args`.
+    template <typename... Args>
+    T& emplace_back(Args&&... args);
+
+    void push_back(T const& value) { emplace_back(value); }
+    void push_back(T&& value) { emplace_back(std::move(value)); }
+
+    /// Removes the last element.
+    void pop_back() noexcept
+    {
+      assert(fSize > 0U);
+      std::destroy_at(data() + --fSize);
+    }
+
+    /// Removes all the elements (the allocated memory, if any, is kept).
+    void clear() noexcept
+    {
+      std::destroy(begin(), end());
+      fSize = 0U;
+    }
+
+    /// Makes room for at least `n` elements.
+    void reserve(size_type n)
+    {
+      if (n > fCapacity) reallocate(n);
+    }
+
+    /// Resizes to `n` elements, adding copies of `value` if needed.
+    void resize(size_type n, T const& value = T{});
+    // --- END ---- Modification -----------------------------------------------
+
+  private:
+    /// Buffer for the inline elements.
+    alignas(T) unsigned char fInline[N * sizeof(T)];
+
+    T* fHeap = nullptr;        ///< Elements allocated on the heap (if any).
+    size_type fSize = 0U;      ///< Number of elements.
+    size_type fCapacity = N;   ///< Room in the current storage.
+
+    T* inlineData() noexcept { return reinterpret_cast<T*>(fInline); }
+    T const* inlineData() const noexcept { return reinterpret_cast<T const*>(fInline); }
+
+    /// Returns the capacity to grow to for at least `n` elements.
+    size_type grownCapacity(size_type n) const { return std::max(n, 2U * fCapacity); }
+
+    /// Moves the elements in a new heap storage with room for `n` elements.
+    void reallocate(size_type n);
+
+    /// Destroys all elements and frees the heap storage.
+    void release() noexcept;
+
+    /// Acquires the content of `other` (this object must be empty).
+    void takeFrom(small_vector&& other) noexcept;
+
+  }; // class small_vector
+
+  //----------------------------------------------------------------------------
+  template <typename T, std::size_t N, std::size_t M>
+  bool operator==(small_vector<T, N> const& a, small_vector<T, M> const& b)
+  {
+    return std::equal(a.begin(), a.end(), b.begin(), b.end());
+  }
+
+  template <typename T, std::size_t N, std::size_t M>
+  bool operator!=(small_vector<T, N> const& a, small_vector<T, M> const& b)
+  {
+    return !(a == b);
+  }
+
+} // namespace util
+
+//------------------------------------------------------------------------------
+//--- template implementation
+//------------------------------------------------------------------------------
+template <typename T, std::size_t N>
+template <typename Iter>
+void util::small_vector<T, N>::assign(Iter first, Iter last)
+{
+  clear();
+  for (; first != last; ++first)
+    emplace_back(*first);
+} // util::small_vector<>::assign()
+
+//------------------------------------------------------------------------------
+template <typename T, std::size_t N>
+template <typename... Args>
+T& util::small_vector<T, N>::emplace_back(Args&&... args)
+{
+  if (fSize < fCapacity) {
+    T* const elem = ::new (static_cast<void*>(data() + fSize)) T(std::forward<Args>(args)...);
+    ++fSize;
+    return *elem;
+  }
+
+  // the new element is created first, since `args` may refer to old elements
+  size_type const newCapacity = grownCapacity(fSize + 1U);
+  std::allocator<T> alloc;
+  T* const newData = alloc.allocate(newCapacity);
+  T* elem = nullptr;
+  try {
+    elem = ::new (static_cast<void*>(newData + fSize)) T(std::forward<Args>(args)...);
+    std::uninitialized_move(begin(), end(), newData);
+  }
+  catch (...) {
+    if (elem) std::destroy_at(elem);
+    alloc.deallocate(newData, newCapacity);
+    throw;
+  }
+  size_type const n = fSize + 1U;
+  release();
+  fHeap = newData;
+  fCapacity = newCapacity;
+  fSize = n;
+  return *elem;
+} // util::small_vector<>::emplace_back()
+
+//------------------------------------------------------------------------------
+template <typename T, std::size_t N>
+void util::small_vector<T, N>::resize(size_type n, T const& value)
+{
+  if (n <= fSize) {
+    std::destroy(begin() + n, end());
+    fSize = n;
+    return;
+  }
+  reserve(n);
+  std::uninitialized_fill(end(), begin() + n, value);
+  fSize = n;
+} // util::small_vector<>::resize()
+
+//------------------------------------------------------------------------------
+template <typename T, std::size_t N>
+void util::small_vector<T, N>::reallocate(size_type n)
+{
+  std::allocator<T> alloc;
+  T* const newData = alloc.allocate(n);
+  try {
+    std::uninitialized_move(begin(), end(), newData);
+  }
+  catch (...) {
+    alloc.deallocate(newData, n);
+    throw;
+  }
+  size_type const size = fSize;
+  release();
+  fHeap = newData;
+  fCapacity = n;
+  fSize = size;
+} // util::small_vector<>::reallocate()
+
+//------------------------------------------------------------------------------
+template <typename T, std::size_t N>
+void util::small_vector<T, N>::release() noexcept
+{
+  clear();
+  if (fHeap) std::allocator<T>{}.deallocate(fHeap, fCapacity);
+  fHeap = nullptr;
+  fCapacity = N;
+} // util::small_vector<>::release()
+
+//------------------------------------------------------------------------------
+template <typename T, std::size_t N>
+void util::small_vector<T, N>::takeFrom(small_vector&& other) noexcept
+{
+  if (other.fHeap) { // steal the heap storage
+    fHeap = other.fHeap;
+    fCapacity = other.fCapacity;
+    fSize = other.fSize;
+    other.fHeap = nullptr;
+    other.fCapacity = N;
+    other.fSize = 0U;
+    return;
+  }
+  std::uninitialized_move(other.begin(), other.end(), inlineData());
+  fSize = other.fSize;
+  other.clear();
+} // util::small_vector<>::takeFrom()
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREALG_COREUTILS_SMALLVECTOR_H
@@ -0,0 +1,248 @@
+/**
+ * @file   larcorealg/CoreUtils/SnapshotPublisher.h
+ * @brief  Publication of immutable objects to concurrent readers.
+ * @date   October 14, 2026
+ *
+ * This is a header only library.
+ */
+
+#ifndef LARCOREALG_COREUTILS_SNAPSHOTPUBLISHER_H
+#define LARCOREALG_COREUTILS_SNAPSHOTPUBLISHER_H
+
+// C/C++ standard libraries
+#include <atomic>
+#include <cassert>
+#include <cstdint> // std::uint64_t
+#include <memory>  // std::unique_ptr<>
+#include <mutex>
+#include <thread> // std::this_thread::yield()
+#include <utility> // std::move(), std::exchange()
+
+namespace lar::util {
+
+  /**
+   * @brief Holds the current version of an immutable object, replaceable at
+   *        any time without blocking its readers.
+   * @tparam T type of the published object
+   *
+   * Readers `acquire()` a `Snapshot` of the current version, and use it as
+   * long as they want: a new version can be `publish()`ed in the meanwhile,
+   * and the readers holding the old one keep using it until they release
+   * their snapshot; the last snapshot of a version destroys its object.
+   * New readers get the new version as soon as it is published.
+   *
+   * Acquiring and releasing a snapshot never wait: they take a few atomic
+   * operations, with no lock. `publish()` is serialized among publishers, and
+   * it waits only for the readers which are in the middle of an `acquire()`
+   * call (a read-copy-update grace period), not for the snapshots they hold.
+   * The published object is accessed only as constant: it must be safe for
+   * concurrent use through its constant interface.
+   *
+   * Example:
+   * ~~~~{.cpp}
+   * lar::util::SnapshotPublisher<Calibration> calibrations;
+   * calibrations.publish(std::make_unique<Calibration>(readCalibration(run)));
+   *
+   * // in any thread:
+   * auto const calib = calibrations.acquire(); // stays valid on new publications
+   * double const gain = calib->gain(channel);
+   * ~~~~
+   */
+  template <typename T>
+  class SnapshotPublisher {
+
+    struct Node; // a published version
+
+  public:
+    using Value_t = T;             ///< Type of the published object.
+    using Version_t = std::uint64_t; ///< Type of version number.
+
+    /// Version number meaning that nothing has been published.
+    static constexpr Version_t NoVersion = 0U;
+
+    /**
+     * @brief Shared access to a published version of the object.
+     *
+     * The snapshot keeps its version alive until it is destroyed or
+     * `release()`d. Copies refer to the same version, and keep it alive too.
+     * A snapshot is not an object to share among threads: each thread should
+     * have its own copy.
+     */
+    class Snapshot {
+    public:
+      /// Constructor: a snapshot of no version.
+      Snapshot() = default;
+
+      Snapshot(Snapshot const& other) : fNode{other.fNode}
+      {
+        if (fNode) fNode->addReference();
+      }
+      Snapshot(Snapshot&& other) noexcept : fNode{std::exchange(other.fNode, nullptr)} {}
+
+      Snapshot& operator=(Snapshot other) noexcept
+      {
+        std::swap(fNode, other.fNode);
+        return *this;
+      }
+
+      ~Snapshot() { release(); }
+
+      /// Returns whether this snapshot refers to a version.
+      bool valid() const noexcept { return fNode != nullptr; }
+      explicit operator bool() const noexcept { return valid(); }
+
+      /// Returns the number of the version (`NoVersion` if not valid).
+      Version_t version() const noexcept { return fNode ? fNode->version : NoVersion; }
+
+      /// Returns the published object (the snapshot must be valid).
+      T const& get() const noexcept
+      {
+        assert(fNode);
+        return *(fNode->value);
+      }
+      T const& operator*() const noexcept { return get(); }
+      T const* operator->() const noexcept { return &get(); }
+
+      /// Drops the reference to the version; the snapshot becomes invalid.
+      void release() noexcept
+      {
+        if (fNode) std::exchange(fNode, nullptr)->removeReference();
+      }
+
+    private:
+      friend class SnapshotPublisher<T>;
+
+      Node* fNode = nullptr; ///< The version (already referenced).
+
+      explicit Snapshot(Node* node) noexcept : fNode{node} {}
+
+    }; // class Snapshot
+
+    /// Constructor: nothing published.
+    SnapshotPublisher() = default;
+
+    SnapshotPublisher(SnapshotPublisher const&) = delete;
+    SnapshotPublisher& operator=(SnapshotPublisher const&) = delete;
+
+    /// Destructor: the outstanding snapshots keep their versions alive.
+    ~SnapshotPublisher();
+
+    /// Returns a snapshot of the current version (invalid if none).
+    Snapshot acquire() const noexcept;
+
+    /// Returns the number of the current version (`NoVersion` if none).
+    Version_t version() const noexcept;
+
+    /**
+     * @brief Makes `value` the current version, and returns its number.
+     * @param value the new version of the object (must not be null)
+     *
+     * After the call, all the `acquire()` calls return this version.
+     * The snapshots of the previous version stay valid; the publisher drops
+     * its own reference to it, and the last snapshot destroys it.
+     * Version numbers start from `1` and grow by one on each publication.
+     */
+    Version_t publish(std::unique_ptr<T const> value);
+
+  private:
+    struct Node {
+      std::unique_ptr<T const> const value;
+      Version_t const version;
+      std::atomic<unsigned int> nRefs{1U};
+
+      Node(std::unique_ptr<T const> value, Version_t version)
+        : value{std::move(value)}, version{version}
+      {}
+
+      void addReference() noexcept { nRefs.fetch_add(1U, std::memory_order_relaxed); }
+      void removeReference() noexcept
+      {
+        if (nRefs.fetch_sub(1U, std::memory_order_acq_rel) == 1U) delete this;
+      }
+    }; // struct Node
+
+    /// The current version (holds one reference).
+    std::atomic<Node*> fCurrent{nullptr};
+
+    /// Parity of the counter of the new readers in `acquire()`.
+    mutable std::atomic<unsigned int> fReaderPhase{0U};
+
+    /// Number of readers in `acquire()`, by the parity of their phase.
+    mutable std::atomic<unsigned int> fAcquiring[2] = {0U, 0U};
+
+    std::mutex fPublishMutex; ///< Serializes the publishers.
+    Version_t fLastVersion = NoVersion; ///< Last published version number.
+
+    /// Waits until all the readers in `acquire()` in `phase` are out.
+    void waitForReaders(unsigned int phase) const;
+
+  }; // class SnapshotPublisher
+
+} // namespace lar::util
+
+//------------------------------------------------------------------------------
+//--- template implementation
+//------------------------------------------------------------------------------
+template <typename T>
+lar::util::SnapshotPublisher<T>::~SnapshotPublisher()
+{
+  if (Node* node = fCurrent.load()) node->removeReference();
+} // lar::util::SnapshotPublisher<>::~SnapshotPublisher()
+
+//------------------------------------------------------------------------------
+template <typename T>
+auto lar::util::SnapshotPublisher<T>::acquire() const noexcept -> Snapshot
+{
+  // the counter tells publishers not to drop a version this reader may be
+  // about to reference; it is never waited for here
+  unsigned int const phase = fReaderPhase.load() & 1U;
+  fAcquiring[phase].fetch_add(1U);
+  Node* const node = fCurrent.load();
+  if (node) node->addReference();
+  fAcquiring[phase].fetch_sub(1U);
+  return Snapshot{node};
+} // lar::util::SnapshotPublisher<>::acquire()
+
+//------------------------------------------------------------------------------
+template <typename T>
+auto lar::util::SnapshotPublisher<T>::version() const noexcept -> Version_t
+{
+  Snapshot const current = acquire();
+  return current.version();
+} // lar::util::SnapshotPublisher<>::version()
+
+//------------------------------------------------------------------------------
+template <typename T>
+auto lar::util::SnapshotPublisher<T>::publish(std::unique_ptr<T const> value) -> Version_t
+{
+  assert(value);
+  std::lock_guard<std::mutex> const lock{fPublishMutex};
+
+  Version_t const version = ++fLastVersion;
+  Node* const old = fCurrent.exchange(new Node{std::move(value), version});
+  if (!old) return version;
+
+  // grace period: the readers which may have read `old` are all in
+  // `acquire()` now, counted in either phase; new readers are sent to the
+  // other phase while each one drains, so that neither waits forever
+  unsigned int const phase = fReaderPhase.load() & 1U;
+  fReaderPhase.store(phase ^ 1U);
+  waitForReaders(phase);
+  fReaderPhase.store(phase);
+  waitForReaders(phase ^ 1U);
+
+  old->removeReference();
+  return version;
+} // lar::util::SnapshotPublisher<>::publish()
+
+//------------------------------------------------------------------------------
+template <typename T>
+void lar::util::SnapshotPublisher<T>::waitForReaders(unsigned int phase) const
+{
+  while (fAcquiring[phase].load() != 0U)
+    std::this_thread::yield();
+} // lar::util::SnapshotPublisher<>::waitForReaders()
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREALG_COREUTILS_SNAPSHOTPUBLISHER_H
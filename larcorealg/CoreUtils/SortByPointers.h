@@ -11,11 +11,12 @@
 #define LARCOREALG_COREUTILS_SORTBYPOINTER_H
 
 // LArSoft libraries
-#include "larcorealg/CoreUtils/MetaUtils.h" // util::is_unique_ptr_v<>
+#include "larcorealg/CoreUtils/MetaUtils.h" // util::is_unique_ptr_v<>, ...
 #include "larcorealg/CoreUtils/makeValueIndex.h"
 
 // C/C++ standard libraries
 #include <algorithm>   // std::transform(), std::sort()
+#include <cstddef>     // std::size_t
 #include <iterator>    // std::back_inserter()
 #include <memory>      // std::addressof()
 #include <type_traits> // std::add_pointer_t
@@ -60,6 +61,24 @@ namespace util {
     details::MoveFromPointersImpl<Coll, PtrColl>::move(dest, src);
   }
 
+  //----------------------------------------------------------------------------
+  /**
+   * @brief Reorders a collection in place according to a permutation.
+   * @tparam Coll type of collection to be reordered
+   * @param coll collection to be reordered
+   * @param order for each new position, the original index of its element
+   *
+   * After the call, `coll[i]` holds the element which was at `order[i]`.
+   * `order` must be a permutation of the indices of `coll`; it is consumed
+   * by the algorithm, so moving it in saves a copy.
+   * Each element is moved once, plus two additional moves per cycle of the
+   * permutation; no extra collection is created. `Coll` must support random
+   * access via `operator[]` (a random access iterator to the first element of
+   * a range works too) and its elements must be move-assignable.
+   */
+  template <typename Coll>
+  void ApplyPermutation(Coll& coll, std::vector<std::size_t> order);
+
   //----------------------------------------------------------------------------
   /**
    * @brief Applies sorting indirectly, minimizing data copy.
@@ -81,6 +100,8 @@ namespace util {
    * -# replace the content of cont with the one from the sorted collection
    *
    * Single elements are moved from the original collection to a new one.
+   * If `Coll` is a `std::vector`, the elements are instead moved within
+   * `coll` (`ApplyPermutation()`), without a second collection.
    *
    * The data elements of `Coll` must be moveable, as `Coll` itself must be.
    *
@@ -92,6 +113,26 @@ namespace util {
   template <typename Coll, typename Sorter>
   void SortByPointers(Coll& coll, Sorter sorter);
 
+  /**
+   * @brief Sorts `coll` indirectly with an execution policy.
+   * @tparam Policy type of execution policy (e.g. `std::execution::par`)
+   * @tparam Coll type of collection to be sorted
+   * @tparam Comp type of comparison of pointers
+   * @param policy the execution policy for the sorting of the pointers
+   * @param coll collection to be sorted
+   * @param comp comparison of two pointers to data, like `std::sort()` wants
+   * @see `SortByPointers(Coll&, Sorter)`
+   *
+   * This is `SortByPointers()` with a sorter calling `std::sort(policy, ...)`
+   * on the pointers with `comp`. The policy also applies to the translation
+   * of the sorted pointers into indices; the final reordering is sequential.
+   *
+   * This header does not include `<execution>`, which the caller needs anyway
+   * to name a policy: that header may require linking to the TBB library.
+   */
+  template <typename Policy, typename Coll, typename Comp>
+  void SortByPointers(Policy&& policy, Coll& coll, Comp comp);
+
   //----------------------------------------------------------------------------
   /**
    * @brief Sorts a vector of unique pointers using a C pointer sorter.
@@ -102,12 +143,25 @@ namespace util {
    *
    * This adapter moves the unique pointers around to match a sorted version of
    * source.
-   * This is an expensive procedure, implying the creation of a temporary
-   * vector and of additional supporting data: avoid it if at all possible.
+   * When the deleter of the unique pointers is stateless (like the default
+   * one), the pointers are just reassigned in sorted order; otherwise an
+   * index of the pointers and a temporary vector are needed, which is an
+   * expensive procedure, to be avoided if at all possible.
    */
   template <typename Coll, typename Sorter>
   void SortUniquePointers(Coll& coll, Sorter&& sorter);
 
+  /**
+   * @brief Sorts a vector of unique pointers with an execution policy.
+   * @param policy the execution policy for the sorting of the pointers
+   * @param coll collection to be sorted
+   * @param comp comparison of two C pointers to data
+   * @see `SortUniquePointers(Coll&, Sorter&&)`,
+   *      `SortByPointers(Policy&&, Coll&, Comp)`
+   */
+  template <typename Policy, typename Coll, typename Comp>
+  void SortUniquePointers(Policy&& policy, Coll& coll, Comp comp);
+
   //----------------------------------------------------------------------------
 
 } // namespace util
@@ -188,13 +242,108 @@ auto util::makePointerVector(Coll& coll)
   return details::PointerVectorMaker<Coll>::make(coll);
 }
 
+//------------------------------------------------------------------------------
+template <typename Coll>
+void util::ApplyPermutation(Coll& coll, std::vector<std::size_t> order)
+{
+
+  //
+  // follow each cycle of the permutation, marking the visited positions as
+  // already in place
+  //
+  std::size_t const n = order.size();
+  for (std::size_t start = 0; start < n; ++start) {
+    if (order[start] == start) continue;
+
+    auto tmp = std::move(coll[start]);
+    std::size_t i = start;
+    while (order[i] != start) {
+      std::size_t const src = order[i];
+      coll[i] = std::move(coll[src]);
+      order[i] = i;
+      i = src;
+    } // while
+    coll[i] = std::move(tmp);
+    order[i] = i;
+  } // for
+
+} // util::ApplyPermutation()
+
+//------------------------------------------------------------------------------
+namespace util::details {
+
+  /// Reorders `coll` as the sorted pointers `ptrs` to its elements dictate.
+  template <typename Coll, typename PtrColl, typename Transform>
+  void moveFromSortedPointers(Coll& coll, PtrColl const& ptrs, Transform transform)
+  {
+    if constexpr (util::is_instance_of_v<std::vector, Coll>) {
+      //
+      // contiguous storage: the index of each element is its pointer offset
+      //
+      auto const* const first = coll.data();
+      std::vector<std::size_t> order(ptrs.size());
+      transform(ptrs.begin(), ptrs.end(), order.begin(), [first](auto const* ptr) {
+        return static_cast<std::size_t>(ptr - first);
+      });
+      ApplyPermutation(coll, std::move(order));
+    }
+    else {
+      //
+      // create a sorted collection moving the content from the original one
+      //
+      Coll sorted;
+      MoveFromPointers(sorted, ptrs);
+
+      //
+      // replace the old container with the new one
+      //
+      coll = std::move(sorted);
+    }
+  } // moveFromSortedPointers()
+
+  /// Replaces the unique pointers of `coll` with the sorted `ptrs` to their data.
+  template <typename Coll, typename PtrColl>
+  void moveFromSortedUniquePointers(Coll& coll, PtrColl const& ptrs)
+  {
+    using UPtr_t = typename Coll::value_type;
+
+    if constexpr (std::is_empty_v<typename UPtr_t::deleter_type>) {
+      //
+      // a stateless deleter does not care which pointer it is attached to
+      //
+      for (auto& uptr : coll)
+        uptr.release();
+      std::size_t i = 0;
+      for (auto* dataPtr : ptrs)
+        coll[i++].reset(dataPtr);
+    }
+    else {
+      // data pointer -> index
+      auto const ptrIndex = util::makeValueIndex(makePointerVector(coll), util::HashIndex{});
+
+      //
+      // create a sorted collection moving the content from the original one
+      //
+      Coll sorted;
+      for (auto const& dataPtr : ptrs) {
+        std::size_t const originalIndex = ptrIndex.at(dataPtr);
+        sorted.emplace_back(std::move(coll[originalIndex]));
+      }
+
+      //
+      // replace the old container with the new one
+      //
+      coll = std::move(sorted);
+    }
+  } // moveFromSortedUniquePointers()
+
+} // namespace util::details
+
 //------------------------------------------------------------------------------
 template <typename Coll, typename Sorter>
 void util::SortByPointers(Coll& coll, Sorter sorter)
 {
 
-  using coll_t = Coll;
-
   //
   // create the collection of pointers to data
   //
@@ -206,18 +355,28 @@ void util::SortByPointers(Coll& coll, Sorter sorter)
   sorter(ptrs);
 
   //
-  // create a sorted collection moving the content from the original one
+  // move the content of the collection in the sorted order
   //
-  coll_t sorted;
-  MoveFromPointers(sorted, ptrs);
-
-  //
-  // replace the old container with the new one
-  //
-  coll = std::move(sorted);
+  details::moveFromSortedPointers(
+    coll, ptrs, [](auto b, auto e, auto d, auto op) { std::transform(b, e, d, op); });
 
 } // util::SortByPointers()
 
+//------------------------------------------------------------------------------
+template <typename Policy, typename Coll, typename Comp>
+void util::SortByPointers(Policy&& policy, Coll& coll, Comp comp)
+{
+
+  auto ptrs = makePointerVector(coll);
+
+  std::sort(policy, ptrs.begin(), ptrs.end(), comp);
+
+  details::moveFromSortedPointers(coll, ptrs, [&policy](auto b, auto e, auto d, auto op) {
+    std::transform(policy, b, e, d, op);
+  });
+
+} // util::SortByPointers(Policy)
+
 //------------------------------------------------------------------------------
 template <typename Coll, typename Sorter>
 void util::SortUniquePointers(Coll& coll, Sorter&& sorter)
@@ -233,30 +392,33 @@ void util::SortUniquePointers(Coll& coll, Sorter&& sorter)
   //
   auto ptrs = makePointerVector(coll);
 
-  // data pointer -> index
-  auto const ptrIndex = util::makeValueIndex(ptrs);
-
   //
   // delegate the sorting by pointers
   //
   sorter(ptrs);
 
   //
-  // create a sorted collection moving the content from the original one
-  //
-  Collection_t sorted;
-  for (auto const& dataPtr : ptrs) {
-    std::size_t const originalIndex = ptrIndex.at(dataPtr);
-    sorted.emplace_back(std::move(coll[originalIndex]));
-  }
-
-  //
-  // replace the old container with the new one
+  // move the unique pointers in the sorted order
   //
-  coll = std::move(sorted);
+  details::moveFromSortedUniquePointers(coll, ptrs);
 
 } // util::SortUniquePointers()
 
+//------------------------------------------------------------------------------
+template <typename Policy, typename Coll, typename Comp>
+void util::SortUniquePointers(Policy&& policy, Coll& coll, Comp comp)
+{
+
+  static_assert(util::is_unique_ptr_v<typename Coll::value_type>);
+
+  auto ptrs = makePointerVector(coll);
+
+  std::sort(policy, ptrs.begin(), ptrs.end(), comp);
+
+  details::moveFromSortedUniquePointers(coll, ptrs);
+
+} // util::SortUniquePointers(Policy)
+
 //------------------------------------------------------------------------------
 namespace util {
   namespace details {
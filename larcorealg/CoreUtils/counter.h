@@ -14,8 +14,9 @@
 #include "larcorealg/CoreUtils/span.h"
 
 // C/C++ libraries
-#include <cstddef> // std::size_t
-#include <utility> // std::move()
+#include <cstddef>  // std::size_t, std::ptrdiff_t
+#include <iterator> // std::random_access_iterator_tag
+#include <utility>  // std::move()
 
 namespace util {
 
@@ -47,6 +48,13 @@ namespace util {
    * which case it behaves like it had already been incremented `n` times.
    * End iterators can be build in that way too; see also `util::counter()`.
    *
+   * The iterator is a random access one: it can be moved by any (signed)
+   * number of steps, and the distance between two iterators is the difference
+   * of their counts. This makes `util::counter()` ranges suitable for the
+   * parallel algorithms of the standard library and for TBB `parallel_for`.
+   * Dereferencing returns a copy of the count, which stays valid also when the
+   * iterator is a temporary (like in `*(it + 1)` or `util::zip()` tuples).
+   *
    */
   template <typename T = std::size_t>
   class count_iterator {
@@ -60,9 +68,9 @@ namespace util {
 
     using difference_type = std::ptrdiff_t;
     using value_type = T;       ///< Type of index returned by this iterator.
-    using reference = T const&; ///< Type returned by dereference operator.
+    using reference = T;        ///< Type returned by dereference operator (a copy).
     using pointer = T*;
-    using iterator_category = std::bidirectional_iterator_tag;
+    using iterator_category = std::random_access_iterator_tag;
 
     /// @}
     // --- END -- Traits and data types ----------------------------------------
@@ -95,6 +103,9 @@ namespace util {
     /// Returns the current loop count.
     reference operator*() const { return fCount; }
 
+    /// Returns the loop count `n` steps after the current one.
+    value_type operator[](difference_type n) const { return fCount + n; }
+
     /// @}
     // --- END -- Data access --------------------------------------------------
 
@@ -111,7 +122,7 @@ namespace util {
 
     /// Increments the loop count of this iterator, returning a copy with the
     /// value before the increment.
-    iterator_type operator++(int) const
+    iterator_type operator++(int)
     {
       iterator_type const old = *this;
       operator++();
@@ -127,13 +138,40 @@ namespace util {
 
     /// Decrements the loop count of this iterator, returning a copy with the
     /// value before the decrement.
-    iterator_type operator--(int) const
+    iterator_type operator--(int)
     {
       iterator_type const old = *this;
       operator--();
       return old;
     }
 
+    /// Adds `n` to the loop count of this iterator, which is then returned.
+    iterator_type& operator+=(difference_type n)
+    {
+      fCount += n;
+      return *this;
+    }
+
+    /// Subtracts `n` from the loop count of this iterator, which is then returned.
+    iterator_type& operator-=(difference_type n)
+    {
+      fCount -= n;
+      return *this;
+    }
+
+    /// Returns an iterator with the loop count `n` steps after this one.
+    iterator_type operator+(difference_type n) const { return iterator_type(*this) += n; }
+
+    /// Returns an iterator with the loop count `n` steps before this one.
+    iterator_type operator-(difference_type n) const { return iterator_type(*this) -= n; }
+
+    /// Returns the number of steps from `other` to this iterator.
+    template <typename U>
+    difference_type operator-(count_iterator<U> const& other) const
+    {
+      return static_cast<difference_type>(fCount) - static_cast<difference_type>(other.fCount);
+    }
+
     /// @}
     // --- END -- Modification -------------------------------------------------
 
@@ -155,14 +193,53 @@ namespace util {
       return fCount != other.fCount;
     }
 
+    /// Iterators are ordered as their loop counts.
+    template <typename U>
+    bool operator<(count_iterator<U> const& other) const
+    {
+      return fCount < other.fCount;
+    }
+
+    /// Iterators are ordered as their loop counts.
+    template <typename U>
+    bool operator>(count_iterator<U> const& other) const
+    {
+      return fCount > other.fCount;
+    }
+
+    /// Iterators are ordered as their loop counts.
+    template <typename U>
+    bool operator<=(count_iterator<U> const& other) const
+    {
+      return fCount <= other.fCount;
+    }
+
+    /// Iterators are ordered as their loop counts.
+    template <typename U>
+    bool operator>=(count_iterator<U> const& other) const
+    {
+      return fCount >= other.fCount;
+    }
+
     /// @}
     // --- END -- Comparisons --------------------------------------------------
 
   private:
+    template <typename U>
+    friend class count_iterator;
+
     value_type fCount{}; ///< Internal counter.
 
   }; // class count_iterator<>
 
+  /// Returns an iterator with the loop count `n` steps after `it`.
+  template <typename T>
+  count_iterator<T> operator+(typename count_iterator<T>::difference_type n,
+                              count_iterator<T> const& it)
+  {
+    return it + n;
+  }
+
   /**
    * @brief Returns an object to iterate values from `begin` to `end` in a
    *        range-for loop.
@@ -15,8 +15,34 @@
 #include "larcorealg/CoreUtils/zip.h"
 
 // C/C++ libraries
-#include <cstddef> // std::size_t
-#include <utility> // std::forward()
+#include <cstddef>     // std::size_t
+#include <iterator>    // std::iterator_traits, std::distance()
+#include <tuple>       // std::get(), std::forward_as_tuple()
+#include <type_traits> // std::is_base_of_v, std::is_same_v, std::decay_t
+#include <utility>     // std::forward()
+
+namespace util::details {
+
+  /// Counter for `util::enumerate()`: bounded by the size of the `Lead` iterable if it has
+  /// random access iterators (so that the counter decrements from its end) and no sentinel,
+  /// unbounded otherwise.
+  template <std::size_t Lead, typename... Iterables>
+  auto enumerate_counter(Iterables&... iterables)
+  {
+    auto& lead = std::get<Lead>(std::forward_as_tuple(iterables...));
+    using iterator_t = std::decay_t<decltype(span_base::get_begin(lead))>;
+    using end_iterator_t = std::decay_t<decltype(span_base::get_end(lead))>;
+    using category_t = typename std::iterator_traits<iterator_t>::iterator_category;
+    if constexpr (std::is_same_v<iterator_t, end_iterator_t> &&
+                  std::is_base_of_v<std::random_access_iterator_tag, category_t>) {
+      auto const n = std::distance(span_base::get_begin(lead), span_base::get_end(lead));
+      return counter(std::size_t{0}, static_cast<std::size_t>(n));
+    }
+    else
+      return infinite_counter();
+  }
+
+} // namespace util::details
 
 namespace util {
 
@@ -60,11 +86,18 @@ namespace util {
    * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
    * (the index is zero-based, so `1U` refers to the second argument).
    *
+   * If the leading iterable has random access iterators, the loop count is
+   * bounded by its size, and the enumerated range has random access iterators
+   * too (see `util::zip()`), suitable for parallel algorithms: for example,
+   * `std::for_each(std::execution::par, r.begin(), r.end(), ...)` with
+   * `r = util::enumerate(twice, thrice)`. Otherwise the count is unbounded.
+   *
    */
   template <std::size_t Lead, typename... Iterables>
   auto enumerate(Iterables&&... iterables)
   {
-    return zip<Lead + 1>(infinite_counter(), std::forward<Iterables>(iterables)...);
+    return zip<Lead + 1>(details::enumerate_counter<Lead>(iterables...),
+                         std::forward<Iterables>(iterables)...);
   }
 
   /// This version of `enumerate` implicitly uses the first iterable as lead.
@@ -20,15 +20,215 @@
 #include "larcorealg/CoreUtils/DebugUtils.h"
 
 // C/C++ standard library
+#include <algorithm> // std::stable_sort(), std::lower_bound()
+#include <functional> // std::hash<>
 #include <map>
-#include <stdexcept> // std::runtime_error
+#include <stdexcept> // std::runtime_error, std::out_of_range
 #include <string> // std::to_string()
-#include <type_traits> // std::invoke_result_t, std::remove_reference_t
+#include <type_traits> // std::invoke_result_t, std::remove_reference_t, ...
+#include <utility> // std::pair<>
+#include <vector>
 #include <cstddef> // std::size_t
+#include <cstdint> // std::uint64_t
+#include <iterator> // std::distance()
 
 
 namespace util {
   
+  namespace details { struct ValueIndexBuilder; }
+  
+  // --- BEGIN -- Index policies -----------------------------------------------
+  /**
+   * @name Value index policies
+   * 
+   * These tags choose the container returned by `util::makeValueIndex()`:
+   *  * `util::OrderedMapIndex` (default): `std::map<Key_t, std::size_t>`
+   *  * `util::HashIndex`: `util::HashValueIndex<Key_t>`, an open addressing
+   *    hash table; keys need `std::hash` and `operator==`
+   *  * `util::SortedVectorIndex`: `util::SortedValueIndex<Key_t>`, a vector
+   *    of (key, index) pairs sorted by key; keys need `operator<`
+   * 
+   * The latter two are built and queried much faster than `std::map` for
+   * large collections, and they are not node-based.
+   */
+  /// @{
+  
+  /// Base of all the tags choosing the index type in `util::makeValueIndex()`.
+  struct ValueIndexPolicy {};
+  
+  /// Index by `std::map` (the default).
+  struct OrderedMapIndex: ValueIndexPolicy {};
+  
+  /// Index by an open addressing hash table (`util::HashValueIndex`).
+  struct HashIndex: ValueIndexPolicy {};
+  
+  /// Index by a sorted vector of (key, index) pairs (`util::SortedValueIndex`).
+  struct SortedVectorIndex: ValueIndexPolicy {};
+  
+  /// Whether `T` is one of the value index policy tags.
+  template <typename T>
+  constexpr bool is_value_index_policy_v
+    = std::is_base_of_v<ValueIndexPolicy, std::decay_t<T>>;
+  
+  /// @}
+  // --- END -- Index policies -------------------------------------------------
+  
+  
+  /**
+   * @brief Index of values (keys) to `std::size_t`, sorted by key.
+   * @tparam Key type of the key
+   * @see `util::makeValueIndex()`, `util::SortedVectorIndex`
+   * 
+   * The index is a flat vector of (key, index) pairs sorted by key, with the
+   * constant part of the interface of `std::map<Key, std::size_t>`.
+   * Lookup is a binary search.
+   */
+  template <typename Key>
+  class SortedValueIndex {
+      public:
+    using key_type = Key;
+    using mapped_type = std::size_t;
+    using value_type = std::pair<key_type, mapped_type>;
+    using const_iterator = typename std::vector<value_type>::const_iterator;
+    using iterator = const_iterator;
+    
+    /// Returns the number of keys in the index.
+    std::size_t size() const { return fEntries.size(); }
+    
+    /// Returns whether the index has no key.
+    bool empty() const { return fEntries.empty(); }
+    
+    /// Iteration through the (key, index) pairs, sorted by key.
+    const_iterator begin() const { return fEntries.begin(); }
+    const_iterator end() const { return fEntries.end(); }
+    
+    /// Returns an iterator to the entry with `key`, or `end()` if not present.
+    const_iterator find(key_type const& key) const
+      {
+        auto const it = lowerBound(key);
+        return ((it != end()) && !(key < it->first))? it: end();
+      }
+    
+    /// Returns the number of entries with `key` (`0` or `1`).
+    std::size_t count(key_type const& key) const
+      { return (find(key) == end())? 0U: 1U; }
+    
+    /// Returns the index of `key`.
+    /// @throw std::out_of_range if `key` is not present
+    mapped_type const& at(key_type const& key) const
+      {
+        auto const it = find(key);
+        if (it == end())
+          throw std::out_of_range("util::SortedValueIndex::at(): key not found");
+        return it->second;
+      }
+    
+      private:
+    friend struct details::ValueIndexBuilder;
+    
+    std::vector<value_type> fEntries; ///< Entries, sorted by key.
+    
+    const_iterator lowerBound(key_type const& key) const
+      {
+        return std::lower_bound(begin(), end(), key,
+          [](value_type const& e, key_type const& k){ return e.first < k; });
+      }
+    
+  }; // class SortedValueIndex<>
+  
+  
+  /**
+   * @brief Index of values (keys) to `std::size_t` in an open addressing hash.
+   * @tparam Key type of the key
+   * @tparam Hash type of the hash function object
+   * @see `util::makeValueIndex()`, `util::HashIndex`
+   * 
+   * The index stores the (key, index) pairs in a vector in collection order,
+   * and a linear probing table of positions in that vector, with a load factor
+   * of at most one half. It has the constant part of the interface of
+   * `std::unordered_map<Key, std::size_t>`.
+   * The hash values are scrambled before use, so that hashes with poor low
+   * bits (like the ones from pointers) still spread on the table.
+   */
+  template <typename Key, typename Hash = std::hash<Key>>
+  class HashValueIndex {
+      public:
+    using key_type = Key;
+    using mapped_type = std::size_t;
+    using value_type = std::pair<key_type, mapped_type>;
+    using const_iterator = typename std::vector<value_type>::const_iterator;
+    using iterator = const_iterator;
+    
+    /// Returns the number of keys in the index.
+    std::size_t size() const { return fEntries.size(); }
+    
+    /// Returns whether the index has no key.
+    bool empty() const { return fEntries.empty(); }
+    
+    /// Iteration through the (key, index) pairs, in collection order.
+    const_iterator begin() const { return fEntries.begin(); }
+    const_iterator end() const { return fEntries.end(); }
+    
+    /// Returns an iterator to the entry with `key`, or `end()` if not present.
+    const_iterator find(key_type const& key) const
+      {
+        std::size_t const entry = fTable.empty()? NoEntry: fTable[findSlot(key)];
+        return (entry == NoEntry)? end(): begin() + entry;
+      }
+    
+    /// Returns the number of entries with `key` (`0` or `1`).
+    std::size_t count(key_type const& key) const
+      { return (find(key) == end())? 0U: 1U; }
+    
+    /// Returns the index of `key`.
+    /// @throw std::out_of_range if `key` is not present
+    mapped_type const& at(key_type const& key) const
+      {
+        auto const it = find(key);
+        if (it == end())
+          throw std::out_of_range("util::HashValueIndex::at(): key not found");
+        return it->second;
+      }
+    
+      private:
+    friend struct details::ValueIndexBuilder;
+    
+    /// Marker of an empty slot in the table.
+    static constexpr std::size_t NoEntry = ~std::size_t(0);
+    
+    std::vector<value_type> fEntries; ///< Entries, in collection order.
+    std::vector<std::size_t> fTable; ///< Slot to entry (or `NoEntry`).
+    unsigned int fShift = 64U; ///< Bits to drop from the scrambled hash.
+    
+    /// Prepares a table for `n` entries.
+    void reserve(std::size_t n)
+      {
+        unsigned int bits = 1U;
+        while ((std::size_t(1) << bits) < 2U * n) ++bits;
+        fTable.assign(std::size_t(1) << bits, NoEntry);
+        fShift = 64U - bits;
+        fEntries.reserve(n);
+      }
+    
+    /// Returns the slot with `key`, or the empty one where it would go.
+    std::size_t findSlot(key_type const& key) const
+      {
+        std::size_t const mask = fTable.size() - 1U;
+        // Fibonacci hashing: take the high bits of the scrambled hash
+        std::size_t slot = static_cast<std::size_t>(
+          (static_cast<std::uint64_t>(Hash{}(key)) * 0x9E3779B97F4A7C15ULL)
+          >> fShift
+          );
+        while (fTable[slot] != NoEntry) {
+          if (fEntries[fTable[slot]].first == key) break;
+          slot = (slot + 1U) & mask;
+        } // while
+        return slot;
+      }
+    
+  }; // class HashValueIndex<>
+  
+  
   /**
    * @brief Returns a map of value to index.
    * @tparam Coll type of container
@@ -45,6 +245,11 @@ namespace util {
    * the STL associative container `std::map`.
    * Duplicate values will trigger an exception.
    * 
+   * A different index type can be chosen with a policy tag as last argument,
+   * for example `util::makeValueIndex(coll, getter, util::HashIndex{})`
+   * (see `util::ValueIndexPolicy`); all the types share the same lookup
+   * interface (`at()`, `find()`, `count()`) and duplicate key check.
+   * 
    * Requirements
    * -------------
    * 
@@ -54,48 +259,165 @@ namespace util {
    *    that is support a ranged-for loop
    * 
    */
-  template <typename Coll, typename Extractor>
-  decltype(auto) makeValueIndex(Coll const& coll, Extractor getter);
+  template <typename Coll, typename Extractor, typename Policy>
+  auto makeValueIndex(Coll const& coll, Extractor getter, Policy);
+  
+  template <
+    typename Coll, typename Extractor,
+    typename = std::enable_if_t<!is_value_index_policy_v<Extractor>>
+    >
+  decltype(auto) makeValueIndex(Coll const& coll, Extractor getter)
+    { return makeValueIndex(coll, getter, OrderedMapIndex{}); }
   
   template <typename Coll>
   auto makeValueIndex(Coll const& coll)
     { return makeValueIndex(coll, util::pre_std::identity()); }
-    
+  
+  /// Version of `makeValueIndex()` with the identity as extractor.
+  template <
+    typename Coll, typename Policy,
+    typename = std::enable_if_t<is_value_index_policy_v<Policy>>
+    >
+  auto makeValueIndex(Coll const& coll, Policy policy)
+    { return makeValueIndex(coll, util::pre_std::identity(), policy); }
+  
+
 } // namespace util
 
 
 //------------------------------------------------------------------------------
 //--- template implementation
 //------------------------------------------------------------------------------
-template <typename Coll, typename Extractor>
-decltype(auto) util::makeValueIndex(Coll const& coll, Extractor getter) {
+namespace util {
   
-  using Value_t = typename Coll::value_type;
-  using Key_t
+  namespace details {
+    
+    /// Type of key extracted by `getter` from the elements of `Coll`.
+    template <typename Coll, typename Extractor>
+    using ValueIndexKey_t
 #if 0 // this is C++17...
-    = std::remove_reference_t<std::invoke_result_t<Extractor, Value_t>>;
+      = std::remove_reference_t
+        <std::invoke_result_t<Extractor, typename Coll::value_type>>;
 #else // ... and this is what Clang 5.0 understands:
-    = std::remove_reference_t<decltype(getter(std::declval<Value_t>()))>;
+      = std::remove_reference_t<
+        decltype(std::declval<Extractor>()
+          (std::declval<typename Coll::value_type>()))
+        >;
 #endif // 0
-  
-  using Map_t = std::map<Key_t, std::size_t>;
-  
-  Map_t index;
-  for (auto&& [ iValue, collValue ]: util::enumerate(coll)) {
     
-    Key_t const& key = getter(collValue);
-    auto const iKey = index.lower_bound(key);
-    if ((iKey != index.end()) && (iKey->first == key)) {
+    /// Throws the exception for a duplicate key in `makeValueIndex()`.
+    [[noreturn]] inline void throwDuplicateValueIndexKey
+      (std::size_t iValue, std::size_t iOther)
+    {
       // no guarantee that `key` supports `std::to_string()`: print only indices
       throw std::runtime_error(
-        std::string(__func__) + ": element #" + std::to_string(iValue)
-        + " has the same key as #" + std::to_string(iKey->second)
+        std::string("makeValueIndex") + ": element #" + std::to_string(iValue)
+        + " has the same key as #" + std::to_string(iOther)
         );
-    }
-    index.emplace_hint(iKey, key, iValue);
-  } // for
+    } // throwDuplicateValueIndexKey()
+    
+    
+    template <typename Coll, typename Extractor>
+    auto makeMapValueIndex(Coll const& coll, Extractor& getter) {
+      
+      using Key_t = ValueIndexKey_t<Coll, Extractor>;
+      using Map_t = std::map<Key_t, std::size_t>;
+      
+      Map_t index;
+      for (auto&& [ iValue, collValue ]: util::enumerate(coll)) {
+        
+        Key_t const& key = getter(collValue);
+        auto const iKey = index.lower_bound(key);
+        if ((iKey != index.end()) && (iKey->first == key))
+          throwDuplicateValueIndexKey(iValue, iKey->second);
+        index.emplace_hint(iKey, key, iValue);
+      } // for
+      
+      return index;
+      
+    } // makeMapValueIndex()
+    
+    
+    /// Builds the index types with private content.
+    struct ValueIndexBuilder {
+      
+      template <typename Coll>
+      static std::size_t collectionSize(Coll const& coll)
+        {
+          return std::distance
+            (span_base::get_begin(coll), span_base::get_end(coll));
+        }
+      
+      template <typename Coll, typename Extractor>
+      static auto makeSorted(Coll const& coll, Extractor& getter) {
+        
+        using Key_t = ValueIndexKey_t<Coll, Extractor>;
+        using Index_t = SortedValueIndex<std::remove_cv_t<Key_t>>;
+        using Entry_t = typename Index_t::value_type;
+        
+        Index_t index;
+        auto& entries = index.fEntries;
+        entries.reserve(collectionSize(coll));
+        for (auto&& [ iValue, collValue ]: util::enumerate(coll))
+          entries.emplace_back(getter(collValue), iValue);
+        
+        // stable: equal keys stay in collection order for the duplicate report
+        std::stable_sort(entries.begin(), entries.end(),
+          [](Entry_t const& a, Entry_t const& b){ return a.first < b.first; });
+        for (std::size_t i = 1; i < entries.size(); ++i) {
+          if (entries[i - 1].first < entries[i].first) continue;
+          throwDuplicateValueIndexKey
+            (entries[i].second, entries[i - 1].second);
+        } // for
+        
+        return index;
+      
+      } // makeSorted()
+      
+      
+      template <typename Coll, typename Extractor>
+      static auto makeHash(Coll const& coll, Extractor& getter) {
+        
+        using Key_t = ValueIndexKey_t<Coll, Extractor>;
+        using Index_t = HashValueIndex<std::remove_cv_t<Key_t>>;
+        
+        Index_t index;
+        index.reserve(collectionSize(coll));
+        for (auto&& [ iValue, collValue ]: util::enumerate(coll)) {
+          
+          Key_t const& key = getter(collValue);
+          std::size_t const slot = index.findSlot(key);
+          std::size_t& entry = index.fTable[slot];
+          if (entry != Index_t::NoEntry)
+            throwDuplicateValueIndexKey(iValue, index.fEntries[entry].second);
+          entry = index.fEntries.size();
+          index.fEntries.emplace_back(key, iValue);
+        } // for
+        
+        return index;
+      
+      } // makeHash()
+
+}; // struct ValueIndexBuilder
+    
+  } // namespace details
+  
+} // namespace util
+
+
+//------------------------------------------------------------------------------
+template <typename Coll, typename Extractor, typename Policy>
+auto util::makeValueIndex(Coll const& coll, Extractor getter, Policy) {
+  
+  static_assert(is_value_index_policy_v<Policy>,
+    "The last argument of makeValueIndex() must be a ValueIndexPolicy tag.");
   
-  return index;
+  if constexpr (std::is_base_of_v<HashIndex, Policy>)
+    return details::ValueIndexBuilder::makeHash(coll, getter);
+  else if constexpr (std::is_base_of_v<SortedVectorIndex, Policy>)
+    return details::ValueIndexBuilder::makeSorted(coll, getter);
+  else
+    return details::makeMapValueIndex(coll, getter);
   
 } // util::makeValueIndex()
 
@@ -14,7 +14,7 @@
 #include "boost/iterator/transform_iterator.hpp"
 
 // C/C++ standard library
-#include <iterator>    // std::begin(), std::end()
+#include <iterator>    // std::begin(), std::end(), std::iterator_traits<>
 #include <type_traits> // std::decay_t<>, std::declval(), std::invoke_result_t<>
 #include <utility>     // std::as_const()
 
@@ -80,7 +80,7 @@ namespace util {
    *
    * This class is a glorified pair of iterators which can be used in a
    * range-for loop.
-   * All input iterators are accepted.
+   * All input iterators are accepted, including plain pointers.
    *
    * It is probably going to be redundant with the advent of C++20 and its span
    * and/or range libraries (if the latter is ever going to happen).
@@ -138,10 +138,13 @@ namespace util {
     using pair_t = std::pair<begin_iterator, end_iterator>;
 
     /// Type of values pointed by the iterators.
-    using value_type = typename begin_iterator::value_type;
+    using value_type = typename std::iterator_traits<begin_iterator>::value_type;
 
     /// Type of reference pointed by the iterators.
-    using reference = typename begin_iterator::reference;
+    using reference = typename std::iterator_traits<begin_iterator>::reference;
+
+    /// Default constructor: value-initialized iterators (empty for pointers).
+    span() = default;
 
     /// Constructor: specifies the begin and end iterator.
     span(begin_iterator b, end_iterator e) : pair_t(b, e) {}
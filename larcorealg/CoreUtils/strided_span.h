@@ -0,0 +1,377 @@
+/**
+ * @file   larcorealg/CoreUtils/strided_span.h
+ * @brief  Strided and multidimensional views on existing data.
+ * @see    `larcorealg/CoreUtils/span.h`
+ *
+ * This library is header only.
+ */
+
+#ifndef LARCOREALG_COREUTILS_STRIDED_SPAN_H
+#define LARCOREALG_COREUTILS_STRIDED_SPAN_H
+
+// LArSoft libraries
+#include "larcorealg/CoreUtils/span.h"
+
+// C/C++ standard library
+#include <array>
+#include <cstddef>     // std::size_t, std::ptrdiff_t
+#include <iterator>    // std::data(), std::size(), std::random_access_iterator_tag
+#include <type_traits> // std::conditional_t<>, std::is_const_v<>, std::enable_if_t<>
+
+namespace util {
+
+  // --- BEGIN -- Strided spans ------------------------------------------------
+  /// @name Strided spans
+  /// @{
+
+  /**
+   * @brief Random access iterator jumping a fixed number of elements per step.
+   * @tparam T type of the pointed elements (may be constant)
+   *
+   * The iterator wraps a pointer to `T` and moves it by `stride()` elements on
+   * each increment; a stride of `1` makes it equivalent to a plain pointer.
+   * Iterators are compared by their pointer only, so the end iterator must be
+   * reached exactly by the strided steps (as `util::make_strided_span()` does).
+   */
+  template <typename T>
+  class stride_iterator {
+
+  public:
+    using iterator_type = stride_iterator<T>; ///< Type of this iterator.
+
+    using difference_type = std::ptrdiff_t;
+    using value_type = std::remove_cv_t<T>;
+    using reference = T&;
+    using pointer = T*;
+    using iterator_category = std::random_access_iterator_tag;
+
+    /// Default constructor: null pointer, unit stride.
+    stride_iterator() = default;
+
+    /// Constructor: points to `ptr`, moving by `stride` elements per step.
+    stride_iterator(pointer ptr, difference_type stride = 1) : fPtr(ptr), fStride(stride) {}
+
+    /// Conversion to a constant iterator.
+    template <typename U = T, typename = std::enable_if_t<!std::is_const_v<U>>>
+    operator stride_iterator<U const>() const
+    {
+      return {fPtr, fStride};
+    }
+
+    /// Returns the current element.
+    reference operator*() const { return *fPtr; }
+
+    /// Returns a pointer to the current element.
+    pointer operator->() const { return fPtr; }
+
+    /// Returns the element `n` steps after the current one.
+    reference operator[](difference_type n) const { return fPtr[n * fStride]; }
+
+    /// Returns the number of elements of a step.
+    difference_type stride() const { return fStride; }
+
+    /// Returns the pointer to the current element.
+    pointer get() const { return fPtr; }
+
+    iterator_type& operator++()
+    {
+      fPtr += fStride;
+      return *this;
+    }
+
+    iterator_type operator++(int)
+    {
+      iterator_type const old = *this;
+      operator++();
+      return old;
+    }
+
+    iterator_type& operator--()
+    {
+      fPtr -= fStride;
+      return *this;
+    }
+
+    iterator_type operator--(int)
+    {
+      iterator_type const old = *this;
+      operator--();
+      return old;
+    }
+
+    iterator_type& operator+=(difference_type n)
+    {
+      fPtr += n * fStride;
+      return *this;
+    }
+
+    iterator_type& operator-=(difference_type n)
+    {
+      fPtr -= n * fStride;
+      return *this;
+    }
+
+    iterator_type operator+(difference_type n) const { return iterator_type(*this) += n; }
+
+    iterator_type operator-(difference_type n) const { return iterator_type(*this) -= n; }
+
+    /// Returns the number of steps from `other` to this iterator (same stride).
+    difference_type operator-(iterator_type const& other) const
+    {
+      return (fPtr - other.fPtr) / fStride;
+    }
+
+    bool operator==(iterator_type const& other) const { return fPtr == other.fPtr; }
+    bool operator!=(iterator_type const& other) const { return fPtr != other.fPtr; }
+
+    /// Iterators are ordered by the number of steps from each other.
+    bool operator<(iterator_type const& other) const { return (*this - other) < 0; }
+    bool operator>(iterator_type const& other) const { return (*this - other) > 0; }
+    bool operator<=(iterator_type const& other) const { return (*this - other) <= 0; }
+    bool operator>=(iterator_type const& other) const { return (*this - other) >= 0; }
+
+  private:
+    pointer fPtr = nullptr;     ///< Current element.
+    difference_type fStride = 1; ///< Elements per step.
+
+  }; // class stride_iterator<>
+
+  /// Returns an iterator `n` steps after `it`.
+  template <typename T>
+  stride_iterator<T> operator+(typename stride_iterator<T>::difference_type n,
+                               stride_iterator<T> const& it)
+  {
+    return it + n;
+  }
+
+  /// A `util::span` visiting every `stride`-th element of a contiguous buffer.
+  template <typename T>
+  using strided_span = span<stride_iterator<T>>;
+
+  /**
+   * @brief Creates a span of `n` elements, `stride` elements apart.
+   * @param data pointer to the first element
+   * @param n number of elements in the span
+   * @param stride number of elements between two consecutive span elements
+   *
+   * No data is copied: the span refers to the memory `data` points to.
+   */
+  template <typename T>
+  strided_span<T> make_strided_span(T* data, std::size_t n, std::ptrdiff_t stride)
+  {
+    stride_iterator<T> const b{data, stride};
+    return {b, b + static_cast<std::ptrdiff_t>(n)};
+  }
+
+  /**
+   * @brief Creates a span of every `stride`-th element of `cont` from `offset`.
+   * @param cont a container with contiguous storage (e.g. `std::vector`)
+   * @param stride number of elements between two consecutive span elements
+   * @param offset index of the first element in the span
+   *
+   * For example, the second coordinate of points interleaved as _x_, _y_, _z_
+   * in a `std::vector<double> xyz` is `util::make_strided_span(xyz, 3U, 1U)`.
+   */
+  template <typename Cont, typename = std::enable_if_t<!std::is_pointer_v<Cont>>>
+  auto make_strided_span(Cont& cont, std::size_t stride, std::size_t offset = 0U)
+  {
+    std::size_t const size = std::size(cont);
+    std::size_t const n = (size > offset) ? (size - offset + stride - 1) / stride : 0U;
+    return make_strided_span(std::data(cont) + offset, n, static_cast<std::ptrdiff_t>(stride));
+  }
+
+  /**
+   * @brief Creates a span of one of the coordinates of a contiguous record array.
+   * @tparam Coord type of a coordinate
+   * @param cont a container with contiguous storage of records
+   * @param column index of the coordinate in each record
+   *
+   * Each record of `cont` is assumed to be a packed sequence of `Coord`
+   * values, as it is for the Cartesian `geo::Point_t` and `geo::Vector_t`
+   * (`double` _x_, _y_ and _z_) and for `geoalgo::Point_t`. For example, the
+   * _y_ coordinates of a `std::vector<geo::Point_t> points` are in
+   * `util::make_column_span<double>(points, 1U)`.
+   * The span has constant elements if `cont` has.
+   */
+  template <typename Coord, typename Cont>
+  auto make_column_span(Cont& cont, std::size_t column)
+  {
+    using record_t = std::remove_reference_t<decltype(*std::data(cont))>;
+    static_assert(sizeof(record_t) % sizeof(Coord) == 0,
+                  "Records are not made of a whole number of coordinates.");
+    using coord_t = std::conditional_t<std::is_const_v<record_t>, Coord const, Coord>;
+    using byte_t = std::conditional_t<std::is_const_v<record_t>, char const, char>;
+    auto* first = reinterpret_cast<coord_t*>(reinterpret_cast<byte_t*>(std::data(cont))) + column;
+    return make_strided_span(first,
+                             std::size(cont),
+                             static_cast<std::ptrdiff_t>(sizeof(record_t) / sizeof(Coord)));
+  }
+
+  /// @}
+  // --- END -- Strided spans --------------------------------------------------
+
+  // --- BEGIN -- Multidimensional views ---------------------------------------
+  /**
+   * @brief Non-owning view of a buffer as a `Rank`-dimensional array.
+   * @tparam T type of the elements (may be constant)
+   * @tparam Rank number of dimensions
+   *
+   * This is a minimal version of C++23 `std::mdspan` with run-time extents
+   * and strides (in elements). The default layout is row-major (C order),
+   * so that a `(n, 3)` view of interleaved coordinates has the point index as
+   * the first dimension:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * std::vector<double> xyz(3 * n);
+   * auto points = util::make_mdspan(xyz.data(), n, 3U);
+   * double const y5 = points(5, 1);
+   * for (double& y: points.line(0U, { 0U, 1U })) y = 0.0; // all y coordinates
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   * A structure-of-arrays layout with the three coordinates in separate arrays is covered by a
+   * `(3, n)` view, whose `line(1U, { c, 0U })` is the array of coordinate `c`.
+   */
+  template <typename T, std::size_t Rank>
+  class mdspan {
+    static_assert(Rank > 0U, "A multidimensional view needs at least one dimension.");
+
+  public:
+    using element_type = T;
+    using value_type = std::remove_cv_t<T>;
+    using reference = T&;
+    using pointer = T*;
+    using index_t = std::array<std::size_t, Rank>;        ///< Indices or extents.
+    using strides_t = std::array<std::ptrdiff_t, Rank>;   ///< Strides (elements).
+
+    /// Default constructor: empty view.
+    mdspan() = default;
+
+    /// Constructor: row-major view of `data` with the specified `extents`.
+    mdspan(pointer data, index_t const& extents)
+      : fData(data), fExtents(extents), fStrides(rowMajorStrides(extents))
+    {}
+
+    /// Constructor: view of `data` with the specified `extents` and `strides`.
+    mdspan(pointer data, index_t const& extents, strides_t const& strides)
+      : fData(data), fExtents(extents), fStrides(strides)
+    {}
+
+    /// Conversion to a view on constant data.
+    template <typename U = T, typename = std::enable_if_t<!std::is_const_v<U>>>
+    operator mdspan<U const, Rank>() const
+    {
+      return {fData, fExtents, fStrides};
+    }
+
+    /// Returns the number of dimensions.
+    static constexpr std::size_t rank() { return Rank; }
+
+    /// Returns the number of elements along dimension `d`.
+    std::size_t extent(std::size_t d) const { return fExtents[d]; }
+
+    /// Returns the number of elements between two consecutive indices in `d`.
+    std::ptrdiff_t stride(std::size_t d) const { return fStrides[d]; }
+
+    /// Returns all the extents.
+    index_t const& extents() const { return fExtents; }
+
+    /// Returns all the strides.
+    strides_t const& strides() const { return fStrides; }
+
+    /// Returns the total number of elements in the view.
+    std::size_t size() const
+    {
+      std::size_t n = 1U;
+      for (std::size_t const e : fExtents)
+        n *= e;
+      return n;
+    }
+
+    /// Returns whether the view has no element.
+    bool empty() const { return size() == 0U; }
+
+    /// Returns the pointer to the element with all indices `0`.
+    pointer data() const { return fData; }
+
+    /// Returns the element at the specified indices (one per dimension).
+    template <typename... Indices>
+    reference operator()(Indices... indices) const
+    {
+      static_assert(sizeof...(Indices) == Rank, "Wrong number of indices.");
+      return (*this)[index_t{static_cast<std::size_t>(indices)...}];
+    }
+
+    /// Returns the element at the specified indices.
+    reference operator[](index_t const& indices) const { return *elementPtr(indices); }
+
+    /**
+     * @brief Returns the elements along dimension `d`, starting from `start`.
+     * @param d the dimension to move along
+     * @param start indices of the first element (`start[d]` included)
+     * @return a strided span from `start` to the end of dimension `d`
+     */
+    strided_span<T> line(std::size_t d, index_t const& start) const
+    {
+      return make_strided_span(elementPtr(start), fExtents[d] - start[d], fStrides[d]);
+    }
+
+    /// Returns the view of dimensions after the first, at first index `i`.
+    template <std::size_t R = Rank, typename = std::enable_if_t<(R > 1U)>>
+    mdspan<T, Rank - 1U> slice(std::size_t i) const
+    {
+      std::array<std::size_t, Rank - 1U> extents;
+      std::array<std::ptrdiff_t, Rank - 1U> strides;
+      for (std::size_t d = 1U; d < Rank; ++d) {
+        extents[d - 1U] = fExtents[d];
+        strides[d - 1U] = fStrides[d];
+      }
+      return {fData + static_cast<std::ptrdiff_t>(i) * fStrides[0], extents, strides};
+    }
+
+  private:
+    pointer fData = nullptr; ///< Element with all indices `0`.
+    index_t fExtents{};      ///< Number of elements per dimension.
+    strides_t fStrides{};    ///< Elements between consecutive indices per dimension.
+
+    /// Returns the pointer to the element at the specified indices.
+    pointer elementPtr(index_t const& indices) const
+    {
+      std::ptrdiff_t offset = 0;
+      for (std::size_t d = 0U; d < Rank; ++d)
+        offset += static_cast<std::ptrdiff_t>(indices[d]) * fStrides[d];
+      return fData + offset;
+    }
+
+    /// Returns the strides of a packed row-major array with `extents`.
+    static strides_t rowMajorStrides(index_t const& extents)
+    {
+      strides_t strides;
+      std::ptrdiff_t s = 1;
+      for (std::size_t d = Rank; d-- > 0U;) {
+        strides[d] = s;
+        s *= static_cast<std::ptrdiff_t>(extents[d]);
+      }
+      return strides;
+    }
+
+  }; // class mdspan<>
+
+  /// Creates a row-major view of `data` with the specified extents.
+  template <typename T, typename... Extents>
+  mdspan<T, sizeof...(Extents)> make_mdspan(T* data, Extents... extents)
+  {
+    return {data, {static_cast<std::size_t>(extents)...}};
+  }
+
+  /// Creates a row-major view of the contiguous storage of `cont`.
+  template <typename Cont,
+            typename... Extents,
+            typename = std::enable_if_t<!std::is_pointer_v<Cont>>>
+  auto make_mdspan(Cont& cont, Extents... extents)
+  {
+    return make_mdspan(std::data(cont), extents...);
+  }
+
+  // --- END -- Multidimensional views -----------------------------------------
+
+} // namespace util
+
+#endif // LARCOREALG_COREUTILS_STRIDED_SPAN_H
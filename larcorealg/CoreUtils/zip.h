@@ -69,6 +69,16 @@ namespace util {
    * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
    * (the index is zero-based, so `1U` refers to the second argument).
    *
+   * The zipped iterator is as capable as the least capable of the iterators
+   * of the iterables, and at least a forward iterator: if all of them are
+   * random access iterators (like the ones of `std::vector`, `std::array` and
+   * `util::counter()`) so is the zipped one, and the returned range can be
+   * handed to parallel algorithms (`std::for_each(std::execution::par, ...)`,
+   * TBB `parallel_for` with a range on those iterators, ...).
+   * Distances and ordering are determined by the `Lead` iterator only, as the
+   * end of the loop is. The `size()` of the returned range is the number of
+   * iterations.
+   *
    */
   template <std::size_t Lead, typename... Iterables>
   auto zip(Iterables&&... iterables);
@@ -93,6 +103,19 @@ namespace util {
 //------------------------------------------------------------------------------
 namespace util::details {
 
+  //----------------------------------------------------------------------------
+  /// Iterator category common to all `Iters`, and at least forward.
+  template <typename... Iters>
+  using zip_iterator_category_t = std::conditional_t<
+    std::conjunction_v<std::is_base_of<std::random_access_iterator_tag,
+                                       typename std::iterator_traits<Iters>::iterator_category>...>,
+    std::random_access_iterator_tag,
+    std::conditional_t<
+      std::conjunction_v<std::is_base_of<std::bidirectional_iterator_tag,
+                                         typename std::iterator_traits<Iters>::iterator_category>...>,
+      std::bidirectional_iterator_tag,
+      std::forward_iterator_tag>>;
+
   //----------------------------------------------------------------------------
   template <std::size_t Lead, typename... Iters>
   class zip_iterator {
@@ -111,7 +134,7 @@ namespace util::details {
     using reference = std::tuple<typename std::iterator_traits<Iters>::reference...>;
     using value_type = std::remove_cv_t<reference>;
     using pointer = std::add_pointer_t<std::remove_reference_t<reference>>;
-    using iterator_category = std::forward_iterator_tag;
+    using iterator_category = zip_iterator_category_t<Iters...>;
 
     /// @}
     // --- END -- Data types ---------------------------------------------------
@@ -136,6 +159,9 @@ namespace util::details {
     /// Returns a tuple with values from all dereferenced iterators.
     auto operator*() const { return dereference_impl(std::index_sequence_for<Iters...>()); }
 
+    /// Returns a tuple with values from all iterators moved by `n` steps.
+    auto operator[](difference_type n) const { return *(*this + n); }
+
     /// Returns the iterator at the specified `Index`.
     template <std::size_t Index>
     decltype(auto) get() const
@@ -166,9 +192,48 @@ namespace util::details {
       return old;
     }
 
+    /// Decrements all the iterators (bidirectional iterators only).
+    this_iterator_t& operator--()
+    {
+      decrement_impl(std::index_sequence_for<Iters...>());
+      return *this;
+    }
+
+    /// Returns a copy of the current iterators, then decrements all of the
+    /// iterators in this object (bidirectional iterators only).
+    this_iterator_t operator--(int)
+    {
+      this_iterator_t old(*this);
+      operator--();
+      return old;
+    }
+
+    /// Moves all the iterators by `n` steps (random access iterators only).
+    this_iterator_t& operator+=(difference_type n)
+    {
+      advance_impl(n, std::index_sequence_for<Iters...>());
+      return *this;
+    }
+
+    /// Moves all the iterators back by `n` steps (random access iterators only).
+    this_iterator_t& operator-=(difference_type n) { return (*this) += -n; }
+
+    /// Returns a copy of this iterator moved by `n` steps.
+    this_iterator_t operator+(difference_type n) const { return this_iterator_t(*this) += n; }
+
+    /// Returns a copy of this iterator moved back by `n` steps.
+    this_iterator_t operator-(difference_type n) const { return this_iterator_t(*this) -= n; }
+
     /// @}
     // --- END -- Modification -------------------------------------------------
 
+    /// Returns the number of steps from `other` (based on the `Lead` iterator only).
+    template <std::size_t OtherLead, typename... OtherIter>
+    difference_type operator-(zip_iterator<OtherLead, OtherIter...> const& other) const
+    {
+      return get<Lead>() - other.template get<OtherLead>();
+    }
+
     // --- BEGIN -- Comparisons ------------------------------------------------
     /// @name Comparisons
     /// @{
@@ -187,6 +252,34 @@ namespace util::details {
       return get<Lead>() == other.template get<OtherLead>();
     }
 
+    /// Ordering (based on the `Lead` iterator only).
+    template <std::size_t OtherLead, typename... OtherIter>
+    bool operator<(zip_iterator<OtherLead, OtherIter...> const& other) const
+    {
+      return get<Lead>() < other.template get<OtherLead>();
+    }
+
+    /// Ordering (based on the `Lead` iterator only).
+    template <std::size_t OtherLead, typename... OtherIter>
+    bool operator>(zip_iterator<OtherLead, OtherIter...> const& other) const
+    {
+      return get<Lead>() > other.template get<OtherLead>();
+    }
+
+    /// Ordering (based on the `Lead` iterator only).
+    template <std::size_t OtherLead, typename... OtherIter>
+    bool operator<=(zip_iterator<OtherLead, OtherIter...> const& other) const
+    {
+      return get<Lead>() <= other.template get<OtherLead>();
+    }
+
+    /// Ordering (based on the `Lead` iterator only).
+    template <std::size_t OtherLead, typename... OtherIter>
+    bool operator>=(zip_iterator<OtherLead, OtherIter...> const& other) const
+    {
+      return get<Lead>() >= other.template get<OtherLead>();
+    }
+
     /// @}
     // --- END -- Comparisons --------------------------------------------------
 
@@ -204,6 +297,18 @@ namespace util::details {
       expandStatements(++std::get<Indices>(fIterators)...);
     }
 
+    template <std::size_t... Indices>
+    void decrement_impl(std::index_sequence<Indices...>)
+    {
+      expandStatements(--std::get<Indices>(fIterators)...);
+    }
+
+    template <std::size_t... Indices>
+    void advance_impl(difference_type n, std::index_sequence<Indices...>)
+    {
+      expandStatements(std::get<Indices>(fIterators) += n...);
+    }
+
     template <std::size_t... Indices>
     auto dereference_impl(std::index_sequence<Indices...>) const
     {
@@ -219,6 +324,15 @@ namespace util::details {
 
   }; // class zip_iterator
 
+  /// Returns a copy of `it` moved by `n` steps.
+  template <std::size_t Lead, typename... Iters>
+  zip_iterator<Lead, Iters...> operator+(
+    typename zip_iterator<Lead, Iters...>::difference_type n,
+    zip_iterator<Lead, Iters...> const& it)
+  {
+    return it + n;
+  }
+
   //----------------------------------------------------------------------------
   // This is more of a curiosity than anything else.
   template <std::size_t Lead>
@@ -10,9 +10,13 @@
 #include "larcorealg/GeoAlgo/GeoAlgo.h"
 #include "larcorealg/GeoAlgo/GeoAlgoConstants.h"
 #include "larcorealg/GeoAlgo/GeoAlgoException.h"
+#include "larcorealg/GeoAlgo/GeoConvexHull.h"
 #include "larcorealg/GeoAlgo/GeoHalfLine.h"
 #include "larcorealg/GeoAlgo/GeoLine.h"
 #include "larcorealg/GeoAlgo/GeoLineSegment.h"
+#include "larcorealg/GeoAlgo/GeoObjBVH.h"
+#include "larcorealg/GeoAlgo/GeoPackedTrajectory.h"
+#include "larcorealg/GeoAlgo/GeoPointCloud.h"
 #include "larcorealg/GeoAlgo/GeoTrajectory.h"
 #include "larcorealg/GeoAlgo/GeoVector.h"
 
@@ -22,7 +26,9 @@
 namespace geoalgo {
   class GeoAlgoException;
   class Vector;
+  class Vector3;
   class Trajectory;
+  class PackedTrajectory;
   class HalfLine;
   class Line;
   class LineSegment;
@@ -30,6 +36,10 @@ namespace geoalgo {
   class GeoAlgo;
 
   class GeoObjCollection;
+  class GeoObjBVH;
+  class PointCloud;
+  class ConvexHull2D;
+  class ConvexHull3D;
 }
 
 //ADD_EMPTY_CLASS ... do not change this comment line
@@ -2,18 +2,605 @@
 #include "larcorealg/GeoAlgo/GeoAlgoConstants.h" // for kINVALID_DOUBLE
 #include "larcorealg/GeoAlgo/GeoAlgoException.h" // for GeoAlgoException
 
+#include <algorithm> // for std::min(), std::max(), std::shuffle(), std::sort(), std::unique()
+#include <cmath>     // for std::sqrt()
+#include <limits> // for std::numeric_limits
+#include <list>
+#include <random> // for std::mt19937
 #include <stddef.h>
+#include <stdint.h>
+#include <type_traits> // for std::conditional_t, std::is_same_v
+#include <utility> // for std::pair
+#include <vector>
+
+namespace {
+
+  using geoalgo::GeoAlgoException;
+  using geoalgo::Point_t;
+  using geoalgo::Vector_t;
+
+  /// Smallest sphere with up to 4 points on its surface, updated incrementally
+  class MiniballBasis {
+  public:
+    /// Center of the current sphere
+    const Point_t& center() const { return _currentCenter; }
+
+    /// Squared radius of the current sphere (negative if no point)
+    double sqRadius() const { return _currentSqRadius; }
+
+    /// Number of points on the sphere surface
+    size_t size() const { return _m; }
+
+    /// Whether `p` is out of the current sphere, beyond a relative rounding tolerance
+    bool isOutside(const Point_t& p) const
+    {
+      return p.SqDist(_currentCenter) - _currentSqRadius > 1e-12 * _currentSqRadius;
+    }
+
+    /// Adds `p` to the surface points; `false` if affinely dependent on them
+    bool push(const Point_t& p)
+    {
+      if (_m == 0) {
+        _q0 = p;
+        _center[0] = p;
+        _sqRadius[0] = 0.;
+      }
+      else {
+        // v_m: p relative to the first point, orthogonal to the previous v_i
+        _v[_m] = p - _q0;
+        for (size_t i = 1; i < _m; ++i) {
+          double const a = 2. * (_v[i] * _v[_m]) / _z[i];
+          _v[_m] -= _v[i] * a;
+        }
+        _z[_m] = 2. * _v[_m].SqLength();
+        if (_z[_m] < 1e-24 * _currentSqRadius) return false;
+
+        double const e = p.SqDist(_center[_m - 1]) - _sqRadius[_m - 1];
+        double const f = e / _z[_m];
+        _center[_m] = _center[_m - 1] + _v[_m] * f;
+        _sqRadius[_m] = _sqRadius[_m - 1] + e * f / 2.;
+      }
+      _currentCenter = _center[_m];
+      _currentSqRadius = _sqRadius[_m];
+      ++_m;
+      return true;
+    }
+
+    /// Removes the last surface point (the current sphere is kept)
+    void pop() { --_m; }
+
+  private:
+    size_t _m = 0;                          ///< Number of surface points
+    Point_t _q0;                            ///< First surface point
+    Vector_t _v[4];                         ///< Orthogonalized surface points
+    double _z[4] = {0., 0., 0., 0.};        ///< Twice the squared length of each `_v`
+    Point_t _center[4];                     ///< Center with the first i+1 surface points
+    double _sqRadius[4] = {0., 0., 0., 0.}; ///< Squared radius of those spheres
+    Point_t _currentCenter{0., 0., 0.};     ///< Center of the current sphere
+    double _currentSqRadius = -1.;          ///< Squared radius of the current sphere
+  };
+
+  /// Grows `basis` to the smallest sphere of the points before `end`, and the surface ones
+  void moveToFrontMiniball(std::list<Point_t>& points,
+                           std::list<Point_t>::iterator end,
+                           MiniballBasis& basis)
+  {
+    if (basis.size() == 4) return;
+    for (auto it = points.begin(); it != end;) {
+      auto const current = it++;
+      if (!basis.isOutside(*current)) continue;
+      if (!basis.push(*current)) continue;
+      moveToFrontMiniball(points, current, basis);
+      basis.pop();
+      points.splice(points.begin(), points, current);
+    }
+  }
+
+  /// Box aligned with the axes, enclosing trajectory segments
+  struct SegmentBox {
+    double lo[3]; ///< Lower corner
+    double hi[3]; ///< Upper corner
+
+    /// Box of the segment from `a` to `b` (Point_t or pointers to 3 coordinates)
+    template <typename A, typename B>
+    SegmentBox(const A& a, const B& b)
+    {
+      for (size_t i = 0; i < 3; ++i) {
+        lo[i] = std::min(a[i], b[i]);
+        hi[i] = std::max(a[i], b[i]);
+      }
+    }
+
+    /// Extends the box to enclose `other`
+    void include(const SegmentBox& other)
+    {
+      for (size_t i = 0; i < 3; ++i) {
+        lo[i] = std::min(lo[i], other.lo[i]);
+        hi[i] = std::max(hi[i], other.hi[i]);
+      }
+    }
+
+    /// Squared distance between the closest points of the two boxes
+    double sqDist(const SegmentBox& other) const
+    {
+      double sqDist = 0.;
+      for (size_t i = 0; i < 3; ++i) {
+        double const gap = std::max(other.lo[i] - hi[i], lo[i] - other.hi[i]);
+        if (gap > 0.) sqDist += gap * gap;
+      }
+      return sqDist;
+    }
+  };
+
+  /// Number of consecutive trajectory segments whose box is tested first
+  constexpr size_t kSegmentChunkSize = 16;
+
+  /// Number of points processed together against each trajectory segment
+  constexpr size_t kPointBlockSize = 8;
+
+  /// Fills the boxes of the segments of `trj` and of their chunks of `kSegmentChunkSize`
+  void segmentBoxes(const geoalgo::Trajectory_t& trj,
+                    std::vector<SegmentBox>& boxes,
+                    std::vector<SegmentBox>& chunks)
+  {
+    size_t const n = trj.size() - 1;
+    boxes.reserve(n);
+    chunks.reserve(n / kSegmentChunkSize + 1);
+    for (size_t l = 0; l < n; ++l) {
+      boxes.emplace_back(trj[l], trj[l + 1]);
+      if (l % kSegmentChunkSize == 0)
+        chunks.push_back(boxes.back());
+      else
+        chunks.back().include(boxes.back());
+    }
+  }
+
+  /// Number of lines processed together against each box
+  constexpr size_t kLineBlockSize = 8;
+
+  /// Start `o`, direction `d` and range of the parameter `t` of a half line (`t >= 0`)
+  template <typename Real>
+  void slabLine(const geoalgo::HalfLine_t& l, Real* o, Real* d, Real& tlo, Real& thi)
+  {
+    for (size_t i = 0; i < 3; ++i) {
+      o[i] = l.Start()[i];
+      d[i] = l.Dir()[i];
+    }
+    tlo = 0.;
+    thi = std::numeric_limits<Real>::max();
+  }
+
+  /// Start `o`, direction `d` and range of the parameter `t` of a line segment (`0 <= t <= 1`)
+  template <typename Real>
+  void slabLine(const geoalgo::LineSegment_t& l, Real* o, Real* d, Real& tlo, Real& thi)
+  {
+    for (size_t i = 0; i < 3; ++i) {
+      o[i] = l.Start()[i];
+      d[i] = l.Dir()[i];
+    }
+    tlo = 0.;
+    thi = 1.;
+  }
+
+  /// Start `o`, direction `d` and range of the parameter `t` of an infinite line
+  template <typename Real>
+  void slabLine(const geoalgo::Line_t& l, Real* o, Real* d, Real& tlo, Real& thi)
+  {
+    for (size_t i = 0; i < 3; ++i) {
+      o[i] = l.Pt1()[i];
+      d[i] = l.Dir()[i];
+    }
+    tlo = -std::numeric_limits<Real>::max();
+    thi = std::numeric_limits<Real>::max();
+  }
+
+  /// Slab test of `nLines` lines against `nBoxes` boxes, in blocks of kLineBlockSize lines
+  /// stored by coordinate; the loop on the lines of a block has no branch, so that it is
+  /// vectorized (`line(i, o, d, tlo, thi)` fills the parameters of line `i`, as slabLine());
+  /// the computation is in `Real` precision, and a miss is the largest `Real` value
+  template <typename Real, typename LineSource>
+  void slabIntersections(const geoalgo::AABox_t* boxes,
+                         size_t nBoxes,
+                         size_t nLines,
+                         const LineSource& line,
+                         Real* tEnter,
+                         Real* tExit)
+  {
+    constexpr Real kMax = std::numeric_limits<Real>::max();
+    for (size_t first = 0; first < nLines; first += kLineBlockSize) {
+      size_t const n = std::min(kLineBlockSize, nLines - first);
+
+      // lines of the block; the unused ones repeat the last line
+      Real o[3][kLineBlockSize], inv[3][kLineBlockSize];
+      bool parallel[3][kLineBlockSize];
+      Real tlo[kLineBlockSize], thi[kLineBlockSize];
+      for (size_t j = 0; j < kLineBlockSize; ++j) {
+        Real start[3], dir[3];
+        line(first + std::min(j, n - 1), start, dir, tlo[j], thi[j]);
+        for (size_t i = 0; i < 3; ++i) {
+          o[i][j] = start[i];
+          parallel[i][j] = (dir[i] == 0.);
+          inv[i][j] = parallel[i][j] ? Real(0) : Real(1) / dir[i];
+        }
+      }
+
+      for (size_t b = 0; b < nBoxes; ++b) {
+        Real lo[3], hi[3];
+        for (size_t i = 0; i < 3; ++i) {
+          lo[i] = boxes[b].Min()[i];
+          hi[i] = boxes[b].Max()[i];
+        }
+        Real enter[kLineBlockSize], exit[kLineBlockSize];
+        for (size_t j = 0; j < kLineBlockSize; ++j) {
+          Real t0 = tlo[j], t1 = thi[j];
+          for (size_t i = 0; i < 3; ++i) {
+            // a line parallel to the slab is either always or never in it
+            bool const inside = (o[i][j] >= lo[i]) & (o[i][j] <= hi[i]);
+            Real const a = (lo[i] - o[i][j]) * inv[i][j];
+            Real const c = (hi[i] - o[i][j]) * inv[i][j];
+            Real const near = parallel[i][j] ? (inside ? -kMax : kMax) : std::min(a, c);
+            Real const far = parallel[i][j] ? (inside ? kMax : -kMax) : std::max(a, c);
+            t0 = std::max(t0, near);
+            t1 = std::min(t1, far);
+          }
+          bool const hit = t0 <= t1;
+          enter[j] = hit ? t0 : kMax;
+          exit[j] = hit ? t1 : kMax;
+        }
+        for (size_t j = 0; j < n; ++j) {
+          tEnter[(first + j) * nBoxes + b] = enter[j];
+          tExit[(first + j) * nBoxes + b] = exit[j];
+        }
+      } // for boxes
+    }   // for blocks of lines
+  }
+
+  /// Slab test of the `n` lines `start + t * dir` (coordinate arrays) with `t` in [`tMin`,
+  /// `tMax`] against `nBoxes` boxes
+  template <typename Real>
+  void arrayIntersections(const geoalgo::AABox_t* boxes,
+                          size_t nBoxes,
+                          size_t n,
+                          const Real* start,
+                          const Real* dir,
+                          Real tMin,
+                          Real tMax,
+                          Real* tEnter,
+                          Real* tExit)
+  {
+    slabIntersections(
+      boxes,
+      nBoxes,
+      n,
+      [start, dir, tMin, tMax](size_t i, Real* o, Real* d, Real& tlo, Real& thi) {
+        for (size_t k = 0; k < 3; ++k) {
+          o[k] = start[3 * i + k];
+          d[k] = dir[3 * i + k];
+        }
+        tlo = tMin;
+        thi = tMax;
+      },
+      tEnter,
+      tExit);
+  }
+
+  /// Indices of the `nPts` points (`coords(i)`) sorted along a Morton (Z-order) curve, so
+  /// that close points are close
+  template <typename Coords>
+  std::vector<size_t> mortonOrder(size_t nPts, const Coords& coords)
+  {
+    // spreads the lowest 10 bits of `v` to every third bit
+    auto spread = [](uint32_t v) {
+      v = (v | (v << 16)) & 0x030000FF;
+      v = (v | (v << 8)) & 0x0300F00F;
+      v = (v | (v << 4)) & 0x030C30C3;
+      v = (v | (v << 2)) & 0x09249249;
+      return v;
+    };
+    SegmentBox box(coords(0), coords(0));
+    for (size_t p = 1; p < nPts; ++p)
+      box.include(SegmentBox(coords(p), coords(p)));
+    double scale[3];
+    for (size_t i = 0; i < 3; ++i)
+      scale[i] = (box.hi[i] > box.lo[i]) ? 1023. / (box.hi[i] - box.lo[i]) : 0.;
+
+    std::vector<std::pair<uint32_t, size_t>> codes(nPts);
+    for (size_t p = 0; p < nPts; ++p) {
+      uint32_t code = 0;
+      for (size_t i = 0; i < 3; ++i)
+        code |= spread(static_cast<uint32_t>((coords(p)[i] - box.lo[i]) * scale[i])) << i;
+      codes[p] = {code, p};
+    }
+    std::sort(codes.begin(), codes.end());
+    std::vector<size_t> order(nPts);
+    for (size_t p = 0; p < nPts; ++p)
+      order[p] = codes[p].second;
+    return order;
+  }
+
+
+  /// Distances between many points and a Trajectory
+  // Same as _SqDist_(pt, line_s, line_e) on each segment and point, with the points taken in
+  // blocks of kPointBlockSize close ones (in Morton order) stored by coordinate, so that the
+  // loop on the points of a block is vectorized; after the chunk of segments closest to the
+  // block, the segments (and chunks of them) whose box is farther from the box of the block
+  // than the current distance of all its points are skipped. Among segments at the same
+  // distance the first is kept, so the result is the one of a loop on all of them
+  // (`coords(i)` are the coordinates of point `i`, as a Point_t or a pointer to 3 values);
+  // the distances are computed in `Real` precision, the pruning boxes in double precision
+  template <typename Real, typename Coords>
+  void batchSqDist(size_t nPts,
+                   const Coords& coords,
+                   const geoalgo::Trajectory_t& trj,
+                   Real* sqDist,
+                   size_t* segIdx)
+  {
+    // segment indices as wide as `Real`, so that their selection vectorizes with the distances
+    using Index = std::conditional_t<sizeof(Real) == sizeof(uint32_t), uint32_t, uint64_t>;
+    // as many values per block in any precision: a float block fills the same registers
+    constexpr size_t kBlock = kPointBlockSize * sizeof(double) / sizeof(Real);
+    if (nPts == 0) return;
+
+    // a single point trajectory: the distance from that point
+    if (trj.size() == 1) {
+      Real const px = trj[0][0], py = trj[0][1], pz = trj[0][2];
+      for (size_t i = 0; i < nPts; ++i) {
+        auto const& pt = coords(i);
+        Real const dx = pt[0] - px, dy = pt[1] - py, dz = pt[2] - pz;
+        sqDist[i] = dx * dx + dy * dy + dz * dz;
+        segIdx[i] = 0;
+      }
+      return;
+    }
+
+    std::vector<SegmentBox> boxes;
+    std::vector<SegmentBox> chunks;
+    segmentBoxes(trj, boxes, chunks);
+    size_t const nSegments = boxes.size();
+
+    std::vector<size_t> const order = mortonOrder(nPts, coords);
+    for (size_t first = 0; first < nPts; first += kBlock) {
+      size_t const n = std::min(kBlock, nPts - first);
+
+      // coordinates of the block points; the unused ones repeat the last point
+      Real x[kBlock], y[kBlock], z[kBlock];
+      Real best[kBlock];
+      Index bestIdx[kBlock];
+      for (size_t j = 0; j < kBlock; ++j) {
+        auto const& pt = coords(order[first + std::min(j, n - 1)]);
+        x[j] = pt[0];
+        y[j] = pt[1];
+        z[j] = pt[2];
+        best[j] = std::numeric_limits<Real>::max();
+        bestIdx[j] = 0;
+      }
+      SegmentBox block(coords(order[first]), coords(order[first]));
+      for (size_t j = 1; j < n; ++j)
+        block.include(SegmentBox(coords(order[first + j]), coords(order[first + j])));
+
+      // distances from segment l, the first in order among equal ones
+      double worst = geoalgo::kINVALID_DOUBLE; // largest distance in the block
+      auto visitSegment = [&](Index l) {
+        Real const a[3] = {Real(trj[l][0]), Real(trj[l][1]), Real(trj[l][2])};
+        Real const b[3] = {Real(trj[l + 1][0]), Real(trj[l + 1][1]), Real(trj[l + 1][2])};
+        Real const abx = b[0] - a[0], aby = b[1] - a[1], abz = b[2] - a[2];
+        Real const f = abx * abx + aby * aby + abz * abz;
+        for (size_t j = 0; j < kBlock; ++j) {
+          Real const acx = x[j] - a[0], acy = y[j] - a[1], acz = z[j] - a[2];
+          Real const e = acx * abx + acy * aby + acz * abz;
+          Real d;
+          if constexpr (std::is_same_v<Real, double>) {
+            Real const bcx = x[j] - b[0], bcy = y[j] - b[1], bcz = z[j] - b[2];
+            Real const ac2 = acx * acx + acy * acy + acz * acz;
+            Real const bc2 = bcx * bcx + bcy * bcy + bcz * bcz;
+            d = (e <= Real(0)) ? ac2 : (e >= f) ? bc2 : (ac2 - e * e / f);
+          }
+          else {
+            // in lower precision `ac2 - e * e / f` loses the distance of points close to long
+            // segments, so the distance from the closest point is computed instead
+            Real const t = (e <= Real(0)) ? Real(0) : (e >= f) ? Real(1) : e / f;
+            Real const dx = acx - t * abx, dy = acy - t * aby, dz = acz - t * abz;
+            d = dx * dx + dy * dy + dz * dz;
+          }
+          bool const better = (d < best[j]) | ((d == best[j]) & (l < bestIdx[j]));
+          best[j] = better ? d : best[j];
+          bestIdx[j] = better ? l : bestIdx[j];
+        }
+        worst = best[0];
+        for (size_t j = 1; j < n; ++j)
+          worst = std::max<double>(worst, best[j]);
+      };
+
+      // the chunk closest to the block first sets a tight cut on the others
+      size_t seed = 0;
+      double seedSqDist = geoalgo::kINVALID_DOUBLE;
+      for (size_t chunk = 0; chunk < chunks.size(); ++chunk) {
+        double const d = block.sqDist(chunks[chunk]);
+        if (d < seedSqDist) {
+          seedSqDist = d;
+          seed = chunk;
+        }
+      }
+      size_t const seedEnd = std::min(nSegments, (seed + 1) * kSegmentChunkSize);
+      for (size_t l = seed * kSegmentChunkSize; l < seedEnd; ++l)
+        visitSegment(l);
+
+      for (size_t chunk = 0; chunk < chunks.size(); ++chunk) {
+        if (chunk == seed || block.sqDist(chunks[chunk]) > worst) continue;
+        size_t const end = std::min(nSegments, (chunk + 1) * kSegmentChunkSize);
+        for (size_t l = chunk * kSegmentChunkSize; l < end; ++l) {
+          if (block.sqDist(boxes[l]) <= worst) visitSegment(l);
+        }
+      } // for chunks
+
+      for (size_t j = 0; j < n; ++j) {
+        sqDist[order[first + j]] = best[j];
+        segIdx[order[first + j]] = bestIdx[j];
+      }
+    } // for blocks of points
+  }
+
+  /// batchSqDist() of `n` points from the coordinate array `xyz` (`segIdx` may be null)
+  template <typename Real>
+  void arraySqDist(size_t n,
+                   const Real* xyz,
+                   const geoalgo::Trajectory_t& trj,
+                   Real* sqDist,
+                   size_t* segIdx)
+  {
+    auto coords = [xyz](size_t i) { return xyz + 3 * i; };
+    if (segIdx) return batchSqDist(n, coords, trj, sqDist, segIdx);
+    std::vector<size_t> idx(n);
+    batchSqDist(n, coords, trj, sqDist, idx.data());
+  }
+
+  /// Weighted sum of squared distances of a point from lines and points, as a quadratic form
+  /// `x^T A x - 2 b^T x + c`
+  class DistanceQuadric {
+  public:
+    /// Adds the line through `p` with unit direction `d`, with weight `w`
+    void addLine(const Point_t& p, const Vector_t& d, double w)
+    {
+      // the distance is `|M (x - p)|` with the projector `M = I - d d^T`
+      double const pd = p[0] * d[0] + p[1] * d[1] + p[2] * d[2];
+      for (size_t i = 0; i < 3; ++i) {
+        for (size_t j = 0; j < 3; ++j)
+          _A[i][j] += w * ((i == j ? 1. : 0.) - d[i] * d[j]);
+        _b[i] += w * (p[i] - pd * d[i]);
+      }
+      _c += w * (p[0] * p[0] + p[1] * p[1] + p[2] * p[2] - pd * pd);
+    }
+
+    /// Adds the point `p`, with weight `w`
+    void addPoint(const Point_t& p, double w)
+    {
+      for (size_t i = 0; i < 3; ++i) {
+        _A[i][i] += w;
+        _b[i] += w * p[i];
+      }
+      _c += w * (p[0] * p[0] + p[1] * p[1] + p[2] * p[2]);
+    }
+
+    /// Stores in `x` the point of least sum; `false` if the form is degenerate
+    bool solve(Point_t& x) const
+    {
+      double const c00 = _A[1][1] * _A[2][2] - _A[1][2] * _A[1][2];
+      double const c01 = _A[0][2] * _A[1][2] - _A[0][1] * _A[2][2];
+      double const c02 = _A[0][1] * _A[1][2] - _A[0][2] * _A[1][1];
+      double const c11 = _A[0][0] * _A[2][2] - _A[0][2] * _A[0][2];
+      double const c12 = _A[0][1] * _A[0][2] - _A[0][0] * _A[1][2];
+      double const c22 = _A[0][0] * _A[1][1] - _A[0][1] * _A[0][1];
+      double const det = _A[0][0] * c00 + _A[0][1] * c01 + _A[0][2] * c02;
+      double const trace = _A[0][0] + _A[1][1] + _A[2][2];
+      // all lines parallel (or no object) leave a null direction
+      if (!(det > 1e-12 * trace * trace * trace)) return false;
+      x = Point_t((c00 * _b[0] + c01 * _b[1] + c02 * _b[2]) / det,
+                  (c01 * _b[0] + c11 * _b[1] + c12 * _b[2]) / det,
+                  (c02 * _b[0] + c12 * _b[1] + c22 * _b[2]) / det);
+      return true;
+    }
+
+    /// Returns the sum at the point `x`
+    double eval(const Point_t& x) const
+    {
+      double sum = _c;
+      for (size_t i = 0; i < 3; ++i) {
+        sum -= 2. * _b[i] * x[i];
+        for (size_t j = 0; j < 3; ++j)
+          sum += x[i] * _A[i][j] * x[j];
+      }
+      return std::max(sum, 0.); // rounding may make it slightly negative
+    }
+
+  private:
+    double _A[3][3] = {};
+    double _b[3] = {};
+    double _c = 0.;
+  };
+
+  /// Squared distance of `x` from the line through `p` with unit direction `d`
+  double lineSqDist(const Point_t& x, const Point_t& p, const Vector_t& d)
+  {
+    Vector_t const v = x - p;
+    double const t = v.Dot(d);
+    return std::max(v.SqLength() - t * t, 0.);
+  }
+
+  /// Throws if `weights` does not have `n` entries, or is not empty
+  void checkVertexWeights(const std::vector<double>& weights, size_t n)
+  {
+    if (!weights.empty() && (weights.size() != n))
+      throw GeoAlgoException("<<commonVertex>> the number of weights differs from the objects");
+  }
+
+  /// Least squares common vertex of `n` objects, reweighted as in `config`.
+  /// `add(q, i, w, x)` adds the object `i` with weight `w` to the form `q` for the point `x`
+  /// of the previous fit (null on the first one) and returns whether it was added as its end
+  /// point; `sqDist(i, x)` is the squared distance of `x` from the object `i`.
+  template <typename AddObject, typename SqDist>
+  double fitCommonVertex(size_t n,
+                         const std::vector<double>& weights,
+                         const geoalgo::VertexFitConfig& config,
+                         AddObject&& add,
+                         SqDist&& sqDist,
+                         Point_t& vertex)
+  {
+    if (n == 0) throw GeoAlgoException("<<commonVertex>> no object given!");
+    auto const weight = [&weights](size_t i) { return weights.empty() ? 1. : weights[i]; };
+
+    double const invSqScale =
+      (config.robustScale > 0.) ? 1. / (config.robustScale * config.robustScale) : 0.;
+    double const sqTolerance = 1e-12 * config.robustScale * config.robustScale;
+    std::vector<double> fitWeights(n);
+    for (size_t i = 0; i < n; ++i)
+      fitWeights[i] = weight(i);
+    std::vector<char> ends(n, 0);
+
+    Point_t x(3);
+    bool reweighted = false;
+    size_t const nIterations = std::max(config.maxIterations, size_t(1));
+    for (size_t iter = 0; iter < nIterations; ++iter) {
+      DistanceQuadric q;
+      bool changed = (iter == 0) || reweighted;
+      for (size_t i = 0; i < n; ++i) {
+        char const end = add(q, i, fitWeights[i], (iter == 0) ? nullptr : &x);
+        if (end != ends[i]) changed = true;
+        ends[i] = end;
+      }
+      if (!changed) break; // the same fit as the last one
+
+      Point_t const last = x;
+      if (!q.solve(x))
+        throw GeoAlgoException("<<commonVertex>> the objects are all parallel: no vertex!");
+
+      reweighted = (invSqScale > 0.) && ((iter == 0) || (x.SqDist(last) > sqTolerance));
+      if (reweighted) {
+        for (size_t i = 0; i < n; ++i)
+          fitWeights[i] = weight(i) / (1. + sqDist(i, x) * invSqScale);
+      }
+    } // for iterations
+
+    double sum = 0., sumW = 0.;
+    for (size_t i = 0; i < n; ++i) {
+      sum += fitWeights[i] * sqDist(i, x);
+      sumW += fitWeights[i];
+    }
+    vertex = x;
+    return (sumW > 0.) ? sum / sumW : 0.;
+  }
+
+} // local namespace
 
 namespace geoalgo {
 
   // Ref. RTCD 5.3.2 p. 177
   // Intersection of a HalfLine w/ AABox
-  std::vector<Point_t> GeoAlgo::Intersection(const AABox_t& box,
-                                             const HalfLine_t& line,
-                                             bool back) const
+  // AABox_t & HalfLine_t intersection points (at most 2, the closest to the start first)
+  size_t GeoAlgo::_Intersection_(const AABox_t& box,
+                                 const HalfLine_t& line,
+                                 bool back,
+                                 Point_t* xs) const
   {
-    // Result container
-    std::vector<Point_t> result;
     Point_t xs1(3); // Only 2 points max possible
     Point_t xs2(3); // Create in advance for early termination checks
     // One-time only initialization for unit vectors
@@ -38,7 +625,7 @@ namespace geoalgo {
     if (back) dir *= -1;
     // Inspect the case of parallel line
     for (size_t i = 0; i < min_pt.size(); ++i) {
-      if (dir[i] == 0 && (start[i] <= min_pt[i] || max_pt[i] <= start[i])) return result;
+      if (dir[i] == 0 && (start[i] <= min_pt[i] || max_pt[i] <= start[i])) return 0;
     }
     // Look for xs w/ 3 planes
     for (size_t i = 0; i < 3; ++i) {
@@ -70,11 +657,10 @@ namespace geoalgo {
     }
     // If xs2 is filled, simply return the result. Order the output via distance
     if (xs2.IsValid()) {
-      result.reserve(2);
       if (xs1._SqDist_(start) > xs2._SqDist_(start)) std::swap(xs1, xs2);
-      result.push_back(xs1);
-      result.push_back(xs2);
-      return result;
+      xs[0] = xs1;
+      xs[1] = xs2;
+      return 2;
     }
     // Look for xs w/ 3 planes
     for (size_t i = 0; i < 3; ++i) {
@@ -101,91 +687,170 @@ namespace geoalgo {
         }
       }
     }
-    if (!xs1.IsValid()) return result;
+    if (!xs1.IsValid()) return 0;
     if (xs2.IsValid()) {
-      result.reserve(2);
       if (xs1._SqDist_(start) > xs2._SqDist_(start)) std::swap(xs1, xs2);
-      result.push_back(xs1);
-      result.push_back(xs2);
-      return result;
+      xs[0] = xs1;
+      xs[1] = xs2;
+      return 2;
     }
-    result.push_back(xs1);
-    return result;
+    xs[0] = xs1;
+    return 1;
+  }
+
+
+  // AABox_t & HalfLine_t intersection, reusing the storage of `result`
+  void GeoAlgo::Intersection(const AABox_t& box,
+                             const HalfLine_t& line,
+                             std::vector<Point_t>& result,
+                             bool back) const
+  {
+    Point_t xs[2];
+    result.assign(xs, xs + _Intersection_(box, line, back, xs));
   }
 
   // AABox_t & LineSegment_t intersection search. Make a use of AABox_t & HalfLine_t function
-  std::vector<Point_t> GeoAlgo::Intersection(const AABox_t& box, const LineSegment_t& line) const
+  void GeoAlgo::Intersection(const AABox_t& box,
+                             const LineSegment_t& line,
+                             std::vector<Point_t>& result) const
   {
+    result.clear();
     auto const& st = line.Start();
-    auto const& ed = line.End();
-    // Create a static HalfLine_t for this algorithm
-    static HalfLine_t hline(st, ed - st);
-    hline.Start(st[0], st[1], st[2]);
-    hline.Dir(ed[0] - st[0], ed[1] - st[1], ed[2] - st[2]);
-
-    auto hline_result = Intersection(box, hline);
+    HalfLine_t const hline(st, line.Dir());
 
-    if (!hline_result.size()) return hline_result;
+    Point_t xs[2];
+    size_t const n = _Intersection_(box, hline, false, xs);
 
-    // For non-empty result, only keep ones that is within the line length
-    std::vector<Point_t> result;
-    auto length = st._SqDist_(ed);
-    for (auto const& pt : hline_result)
-      if (st._SqDist_(pt) < length) result.push_back(pt);
-    return result;
+    // only keep the points within the line length
+    auto const length = line.SqLength();
+    for (size_t i = 0; i < n; ++i)
+      if (st._SqDist_(xs[i]) < length) result.push_back(xs[i]);
   }
 
   // AABox_t & Trajectory_t intersection search. Make a use of AABox_t & HalfLine_t function
-  std::vector<Point_t> GeoAlgo::Intersection(const AABox_t& box, const Trajectory_t& trj) const
+  void GeoAlgo::Intersection(const AABox_t& box,
+                             const Trajectory_t& trj,
+                             std::vector<Point_t>& result) const
   {
-
-    std::vector<Point_t> result;
-    if (trj.size() < 2) return result; // If only 1 point, return
+    result.clear();
+    if (trj.size() < 2) return; // If only 1 point, return
     // Check compat
     trj.compat(box.Min());
-    // Call the onetime-only HalfLine constructor
-    static HalfLine_t hline(trj[0], trj[1]);
     for (size_t i = 0; i < trj.size() - 1; ++i) {
 
       auto const& st = trj[i];
       auto const& ed = trj[i + 1];
-      hline.Start(st[0], st[1], st[2]);
-      hline.Dir(ed[0] - st[0], ed[1] - st[1], ed[2] - st[2]);
-
-      auto hline_result = Intersection(box, hline);
+      HalfLine_t const hline(st, ed - st);
 
-      if (!hline_result.size()) continue;
+      Point_t xs[2];
+      size_t const n = _Intersection_(box, hline, false, xs);
 
       // Check if the length makes sense
       auto length = st._SqDist_(ed);
-      for (auto const& pt : hline_result)
-        if (st._SqDist_(pt) < length) result.push_back(pt);
+      for (size_t j = 0; j < n; ++j)
+        if (st._SqDist_(xs[j]) < length) result.push_back(xs[j]);
     }
-    return result;
   }
 
-  // LineSegment sub-segment of HalfLine inside an AABox w/o checks
-  LineSegment_t GeoAlgo::BoxOverlap(const AABox_t& box, const HalfLine_t& line) const
+  // Batch intersections of AABoxes with HalfLines, LineSegments and Lines
+  void GeoAlgo::_Intersection_(const AABox_t* boxes,
+                               size_t nBoxes,
+                               const std::vector<HalfLine_t>& lines,
+                               double* tEnter,
+                               double* tExit) const
   {
-    // First find interection point of half-line and box
-    auto xs_v = Intersection(box, line);
-    if (xs_v.size() == 2) return LineSegment_t(xs_v[0], xs_v[1]);
+    slabIntersections(
+      boxes,
+      nBoxes,
+      lines.size(),
+      [&lines](size_t i, double* o, double* d, double& tlo, double& thi) {
+        slabLine(lines[i], o, d, tlo, thi);
+      },
+      tEnter,
+      tExit);
+  }
 
-    // Build a new LineSegment
-    if (!(xs_v.size())) return LineSegment_t();
+  void GeoAlgo::_Intersection_(const AABox_t* boxes,
+                               size_t nBoxes,
+                               const std::vector<LineSegment_t>& lines,
+                               double* tEnter,
+                               double* tExit) const
+  {
+    slabIntersections(
+      boxes,
+      nBoxes,
+      lines.size(),
+      [&lines](size_t i, double* o, double* d, double& tlo, double& thi) {
+        slabLine(lines[i], o, d, tlo, thi);
+      },
+      tEnter,
+      tExit);
+  }
 
-    // Only other possiblity is # = 1
-    return LineSegment_t(line.Start(), xs_v[0]);
+  void GeoAlgo::_Intersection_(const AABox_t* boxes,
+                               size_t nBoxes,
+                               const std::vector<Line_t>& lines,
+                               double* tEnter,
+                               double* tExit) const
+  {
+    slabIntersections(
+      boxes,
+      nBoxes,
+      lines.size(),
+      [&lines](size_t i, double* o, double* d, double& tlo, double& thi) {
+        slabLine(lines[i], o, d, tlo, thi);
+      },
+      tEnter,
+      tExit);
   }
 
-  /// Get Trajectory inside box given some input trajectory -> now assumes trajectory cannot exit and re-enter box
-  Trajectory_t GeoAlgo::BoxOverlap(const AABox_t& box, const Trajectory_t& trj) const
+  void GeoAlgo::_Intersection_(const AABox_t* boxes,
+                               size_t nBoxes,
+                               size_t n,
+                               const double* start,
+                               const double* dir,
+                               double tMin,
+                               double tMax,
+                               double* tEnter,
+                               double* tExit) const
   {
+    arrayIntersections(boxes, nBoxes, n, start, dir, tMin, tMax, tEnter, tExit);
+  }
 
-    // if first & last points inside, then return full trajectory
-    if (box.Contain(trj[0]) and box.Contain(trj.back())) return trj;
+  void GeoAlgo::_Intersection_(const AABox_t* boxes,
+                               size_t nBoxes,
+                               size_t n,
+                               const float* start,
+                               const float* dir,
+                               float tMin,
+                               float tMax,
+                               float* tEnter,
+                               float* tExit) const
+  {
+    arrayIntersections(boxes, nBoxes, n, start, dir, tMin, tMax, tEnter, tExit);
+  }
 
-    return trj;
+  // LineSegment sub-segment of HalfLine inside an AABox w/o checks
+  void GeoAlgo::BoxOverlap(const AABox_t& box, const HalfLine_t& line, LineSegment_t& result) const
+  {
+    // First find interection point of half-line and box
+    Point_t xs[2];
+    size_t const n = _Intersection_(box, line, false, xs);
+    if (n == 2)
+      result = LineSegment_t(xs[0], xs[1]);
+    else if (n == 0) // Build a new LineSegment
+      result = LineSegment_t();
+    else // Only other possiblity is # = 1
+      result = LineSegment_t(line.Start(), xs[0]);
+  }
+
+  /// Get Trajectory inside box given some input trajectory -> now assumes trajectory cannot exit and re-enter box
+  void GeoAlgo::BoxOverlap(const AABox_t& box, const Trajectory_t& trj, Trajectory_t& result) const
+  {
+
+    // if first & last points inside, then return full trajectory;
+    // the partial overlap is not implemented yet, and the full trajectory is returned too
+    result = trj;
   }
 
   // Ref. RTCD 5.1.8 p. 146
@@ -203,14 +868,14 @@ namespace geoalgo {
     // d2 = Q2-P2
     // v(s,t) = L1(s) - L2(t)
     // require d1*v == 0 && d2*v == 0
-    Vector_t d1 = l1.Pt2() - l1.Pt1();
-    Vector_t d2 = l2.Pt2() - l2.Pt1();
+    auto const& d1 = l1.Dir();
+    auto const& d2 = l2.Dir();
     Vector_t r = l1.Pt1() - l2.Pt1();
 
-    double a = d1 * d1;
+    double a = l1.SqLength();
     double b = d1 * d2;
     double c = d1 * r;
-    double e = d2 * d2;
+    double e = l2.SqLength();
     double f = d2 * r;
 
     double d = a * e - b * b;
@@ -231,8 +896,8 @@ namespace geoalgo {
     // for the closest approach point
     // now find the Point_t object at those locations
 
-    L1 = l1.Pt1() + (l1.Pt2() - l1.Pt1()) * s;
-    L2 = l2.Pt1() + (l2.Pt2() - l2.Pt1()) * t;
+    L1 = l1.Pt1() + d1 * s;
+    L2 = l2.Pt1() + d2 * t;
 
     // find distance between these points
     double dist = L1._SqDist_(L2);
@@ -254,8 +919,8 @@ namespace geoalgo {
 
     //Same as for _SqDist_ with infinite line but check whether s & t go out of bounds (i.e. negative)
 
-    Vector_t d1 = l1.Dir();
-    Vector_t d2 = l2.Dir();
+    auto const& d1 = l1.Dir();
+    auto const& d2 = l2.Dir();
     Vector_t r = l1.Start() - l2.Start();
 
     double a = d1 * d1;
@@ -288,8 +953,8 @@ namespace geoalgo {
     // for the closest approach point
     // now find the Point_t object at those locations
 
-    L1 = l1.Start() + l1.Dir() * s;
-    L2 = l2.Start() + l2.Dir() * t;
+    L1 = l1.Start() + d1 * s;
+    L2 = l2.Start() + d2 * t;
 
     // find distance between these points
     double dist = L1._SqDist_(L2);
@@ -311,14 +976,14 @@ namespace geoalgo {
 
     //Same as for _SqDist_ with infinite line but check whether s & t go out of bounds (i.e. negative)
 
-    auto const d1 = hline.Dir();
-    auto const d2 = seg.End() - seg.Start();
+    auto const& d1 = hline.Dir();
+    auto const& d2 = seg.Dir();
     auto const r = hline.Start() - seg.Start();
 
     double a = d1 * d1;
     double b = d1 * d2;
     double c = d1 * r;
-    double e = d2 * d2;
+    double e = seg.SqLength();
     double f = d2 * r;
 
     double d = a * e - b * b;
@@ -361,14 +1026,14 @@ namespace geoalgo {
     double t = (a * f - b * c) / d;
     // if t > 0 && < 1 then the two lines intersect. We are good!
     if ((t < 1) and (t > 0)) {
-      L1 = hline.Start() + hline.Dir() * s;
-      L2 = seg.Start() + (seg.End() - seg.Start()) * t;
+      L1 = hline.Start() + d1 * s;
+      L2 = seg.Start() + d2 * t;
       return L1._SqDist_(L2);
     }
     // if out of bounds clamp
     // then re-evaluate closest point on line
     t = _Clamp_(t, 0, 1);
-    L2 = seg.Start() + (seg.End() - seg.Start()) * t;
+    L2 = seg.Start() + d2 * t;
     L1 = _ClosestPt_(L2, hline);
     return L1._SqDist_(L2);
   }
@@ -386,6 +1051,39 @@ namespace geoalgo {
     return (ac.SqLength() - e * e / f);
   }
 
+  // As _SqDist_(pt, line_s, line_e), with the direction and length cached in the segment
+  double GeoAlgo::_SqDist_(const Point_t& pt, const LineSegment_t& line) const
+  {
+    auto const& ab = line.Dir();
+    auto const ac = pt - line.Start();
+    auto e = ac * ab;
+    if (e <= 0.) return ac.SqLength();
+    auto f = line.SqLength();
+    if (e >= f) return pt._SqDist_(line.End());
+    return (ac.SqLength() - e * e / f);
+  }
+
+  // As _SqDist_(pt, line_s, line_e), with the cached unit direction and length
+  double GeoAlgo::_SqDist_(const Point_t& pt,
+                           const PackedTrajectory_t& trj,
+                           size_t i,
+                           double& t) const
+  {
+    auto const ac = pt - trj[i];
+    auto const e = ac * trj.UnitDir(i);
+    if (e <= 0.) {
+      t = 0.;
+      return ac.SqLength();
+    }
+    auto const length = trj.SegmentLength(i);
+    if (e >= length) {
+      t = length;
+      return pt._SqDist_(trj[i + 1]);
+    }
+    t = e;
+    return std::max(ac.SqLength() - e * e, 0.);
+  }
+
   // Ref. RTCD Ch 5.1 p. 128-129
   Point_t GeoAlgo::_ClosestPt_(const Point_t& pt, const LineSegment_t& line) const
   {
@@ -397,7 +1095,7 @@ namespace geoalgo {
     if (t <= 0.)
       return line.Start();
     else {
-      auto denom = ab.SqLength();
+      auto denom = line.SqLength();
       // pt projects outside line, on the end side; clamp to end
       if (t >= denom) return line.End();
       // pt projects inside the line. must deferred divide now
@@ -411,7 +1109,6 @@ namespace geoalgo {
   {
     auto const& ab = line.Dir();
     auto const ac = pt - line.Start();
-    auto const bc = ac - ab;
 
     auto e = ac * ab;
     if (e <= 0.) return (ac * ac);
@@ -435,21 +1132,20 @@ namespace geoalgo {
   // Point & Infinite Line min Distance
   double GeoAlgo::_SqDist_(const Line_t& line, const Point_t& pt) const
   {
-    auto const ab = line.Pt2() - line.Pt1();
+    auto const& ab = line.Dir();
     auto const ac = pt - line.Pt1();
-    auto const bc = ac - ab;
 
     auto e = ac * ab;
-    auto f = ab.SqLength();
+    auto f = line.SqLength();
     return (ac.SqLength() - e * e / f);
   }
 
   // Point & Infinite Line Closest Point
   Point_t GeoAlgo::_ClosestPt_(const Line_t& line, const Point_t& pt) const
   {
-    auto const& ab = line.Pt2() - line.Pt1();
+    auto const& ab = line.Dir();
     auto t = (pt - line.Pt1()) * ab;
-    auto denom = ab.Length();
+    auto denom = line.Length();
     return (line.Pt1() + ab * (t / denom));
   }
 
@@ -539,6 +1235,27 @@ namespace geoalgo {
     return distMin;
   }
 
+  // Distance between a Point and a PackedTrajectory:
+  // same as for a Trajectory, with the cached segment directions and lengths
+  double GeoAlgo::SqDist(const Point_t& pt, const PackedTrajectory_t& trj) const
+  {
+
+    // Make sure trajectory object is properly defined
+    if (trj.empty()) throw GeoAlgoException("Trajectory object not properly set...");
+
+    if (trj.size() == 1) return pt._SqDist_(trj[0]);
+
+    // Now keep track of smallest distance and loop over traj segments
+    double distMin = kINVALID_DOUBLE;
+    double t = 0.;
+    for (size_t l = 0; l < trj.size() - 1; l++) {
+      double distTmp = _SqDist_(pt, trj, l, t);
+      if (distTmp < distMin) { distMin = distTmp; }
+    }
+
+    return distMin;
+  }
+
   // Distance between vector of Trajectories and a Point
   // Loop over Trajectories and find the closest one
   // then keep track of that closest one
@@ -595,6 +1312,145 @@ namespace geoalgo {
     return _ClosestPt_(pt, segMin);
   }
 
+  // Distances between many points and a Trajectory
+  void GeoAlgo::SqDist(const std::vector<Point_t>& pts,
+                       const Trajectory_t& trj,
+                       double* sqDist,
+                       size_t* segIdx) const
+  {
+
+    // Make sure trajectory object is properly defined
+    if (!trj.size()) throw GeoAlgoException("Trajectory object not properly set...");
+    if (pts.empty()) return;
+
+    // Check dimensionality compatibility between point and trajectory
+    trj.compat(pts.front());
+
+    auto coords = [&pts](size_t i) -> const Point_t& { return pts[i]; };
+    if (segIdx) return batchSqDist(pts.size(), coords, trj, sqDist, segIdx);
+    std::vector<size_t> idx(pts.size());
+    batchSqDist(pts.size(), coords, trj, sqDist, idx.data());
+  }
+
+  // Distances between many points from a coordinate array and a Trajectory
+  void GeoAlgo::SqDist(size_t n,
+                       const double* xyz,
+                       const Trajectory_t& trj,
+                       double* sqDist,
+                       size_t* segIdx) const
+  {
+
+    // Make sure trajectory object is properly defined
+    if (!trj.size()) throw GeoAlgoException("Trajectory object not properly set...");
+
+    arraySqDist(n, xyz, trj, sqDist, segIdx);
+  }
+
+  // Distances between many points from a coordinate array and a Trajectory, in float precision
+  void GeoAlgo::SqDist(size_t n,
+                       const float* xyz,
+                       const Trajectory_t& trj,
+                       float* sqDist,
+                       size_t* segIdx) const
+  {
+
+    // Make sure trajectory object is properly defined
+    if (!trj.size()) throw GeoAlgoException("Trajectory object not properly set...");
+
+    arraySqDist(n, xyz, trj, sqDist, segIdx);
+  }
+
+  // Closest points between many points and a Trajectory
+  void GeoAlgo::ClosestPt(const std::vector<Point_t>& pts,
+                          const Trajectory_t& trj,
+                          Point_t* closest,
+                          size_t* segIdx) const
+  {
+
+    // Make sure trajectory object is properly defined
+    if (!trj.size()) throw GeoAlgoException("Trajectory object not properly set...");
+    if (pts.empty()) return;
+
+    // Check dimensionality compatibility between point and trajectory
+    trj.compat(pts.front());
+
+    std::vector<double> sqDist(pts.size());
+    std::vector<size_t> idx;
+    if (!segIdx) {
+      idx.resize(pts.size());
+      segIdx = idx.data();
+    }
+    batchSqDist(
+      pts.size(), [&pts](size_t i) -> const Point_t& { return pts[i]; }, trj, sqDist.data(), segIdx);
+
+    // closest point on the closest segment
+    for (size_t i = 0; i < pts.size(); ++i) {
+      if (trj.size() == 1)
+        closest[i] = trj[0];
+      else
+        closest[i] = _ClosestPt_(pts[i], LineSegment_t(trj[segIdx[i]], trj[segIdx[i] + 1]));
+    }
+  }
+
+  // Closest points between many points from a coordinate array and a Trajectory
+  void GeoAlgo::ClosestPt(size_t n,
+                          const double* xyz,
+                          const Trajectory_t& trj,
+                          double* closestXYZ,
+                          size_t* segIdx) const
+  {
+
+    // Make sure trajectory object is properly defined
+    if (!trj.size()) throw GeoAlgoException("Trajectory object not properly set...");
+
+    std::vector<double> sqDist(n);
+    std::vector<size_t> idx;
+    if (!segIdx) {
+      idx.resize(n);
+      segIdx = idx.data();
+    }
+    batchSqDist(
+      n, [xyz](size_t i) { return xyz + 3 * i; }, trj, sqDist.data(), segIdx);
+
+    // closest point on the closest segment
+    for (size_t i = 0; i < n; ++i) {
+      Point_t const pt(xyz[3 * i], xyz[3 * i + 1], xyz[3 * i + 2]);
+      Point_t const closest = (trj.size() == 1) ?
+                                trj[0] :
+                                _ClosestPt_(pt, LineSegment_t(trj[segIdx[i]], trj[segIdx[i] + 1]));
+      for (size_t k = 0; k < 3; ++k)
+        closestXYZ[3 * i + k] = closest[k];
+    }
+  }
+
+  // Closest point between a Point and a PackedTrajectory
+  Point_t GeoAlgo::ClosestPt(const Point_t& pt, const PackedTrajectory_t& trj, int& idx) const
+  {
+
+    // Make sure trajectory object is properly defined
+    if (trj.empty()) throw GeoAlgoException("Trajectory object not properly set...");
+
+    idx = 0;
+    if (trj.size() == 1) return trj[0];
+
+    // Now keep track of smallest distance and loop over traj segments
+    // For that smallest distance, keep track of the segment and of the position on it
+    double distMin = kINVALID_DOUBLE;
+    double tMin = 0.;
+    double t = 0.;
+    for (size_t l = 0; l < trj.size() - 1; l++) {
+      double distTmp = _SqDist_(pt, trj, l, t);
+      if (distTmp < distMin) {
+        distMin = distTmp;
+        tMin = t;
+        idx = l;
+      }
+    }
+
+    if (tMin >= trj.SegmentLength(idx)) return trj[idx + 1];
+    return trj[idx] + trj.UnitDir(idx) * tMin;
+  }
+
   // Closest point between a vector of trajectories and a point
   // Loop over segments that make up the trajectory and keep track
   // of shortest distance between any of them and the point
@@ -669,6 +1525,18 @@ namespace geoalgo {
                          Point_t& c1,
                          Point_t& c2) const
   {
+    size_t seg1 = 0;
+    size_t seg2 = 0;
+    return SqDist(trj1, trj2, c1, c2, seg1, seg2);
+  }
+
+  double GeoAlgo::SqDist(const Trajectory_t& trj1,
+                         const Trajectory_t& trj2,
+                         Point_t& c1,
+                         Point_t& c2,
+                         size_t& seg1,
+                         size_t& seg2) const
+  {
 
     // Make sure trajectory object is properly defined
     if (!trj1.size() or !trj2.size())
@@ -677,24 +1545,80 @@ namespace geoalgo {
     // Check dimensionality compatibility between point and trajectory
     trj1.compat(trj2[0]);
 
-    // keep track of c1 & c2
-    Point_t c1min;
-    Point_t c2min;
+    return _SqDist_(trj1, trj2, c1, c2, seg1, seg2, -1.);
+  }
+
+  bool GeoAlgo::WithinDist(const Trajectory_t& trj1,
+                           const Trajectory_t& trj2,
+                           double dist,
+                           Point_t& c1,
+                           Point_t& c2,
+                           size_t& seg1,
+                           size_t& seg2) const
+  {
+
+    // Make sure trajectory object is properly defined
+    if (!trj1.size() or !trj2.size())
+      throw GeoAlgoException("Trajectory object not properly set...");
+
+    // Check dimensionality compatibility between point and trajectory
+    trj1.compat(trj2[0]);
+
+    if (dist < 0.) return false;
+    return _SqDist_(trj1, trj2, c1, c2, seg1, seg2, dist * dist) <= dist * dist;
+  }
+
+  // Closest approach between two trajectories
+  // Segment pairs are visited in order, and skipped when the boxes enclosing them (or a chunk
+  // of consecutive segments of trj2, or all of trj2) are already farther apart than the
+  // closest pair so far: the result is the same as the one of the loop on all the pairs
+  double GeoAlgo::_SqDist_(const Trajectory_t& trj1,
+                           const Trajectory_t& trj2,
+                           Point_t& c1,
+                           Point_t& c2,
+                           size_t& seg1,
+                           size_t& seg2,
+                           double stopSqDist) const
+  {
     // Now keep track of smallest distance and loop over traj segments
     double distMin = kMAX_DOUBLE;
+    if (trj1.size() < 2 || trj2.size() < 2) return distMin;
+
+    // boxes of the segments of trj2, of chunks of consecutive ones, and of all of them
+    size_t const n2 = trj2.size() - 1;
+    std::vector<SegmentBox> boxes2;
+    std::vector<SegmentBox> chunks2;
+    segmentBoxes(trj2, boxes2, chunks2);
+    SegmentBox all2 = chunks2.front();
+    for (auto const& chunk : chunks2)
+      all2.include(chunk);
+
+    // keep track of c1 & c2
+    Point_t c1min(3);
+    Point_t c2min(3);
 
     for (size_t l1 = 0; l1 < trj1.size() - 1; l1++) {
-      for (size_t l2 = 0; l2 < trj2.size() - 1; l2++) {
-        LineSegment_t segTmp1(trj1[l1], trj1[l1 + 1]);
-        LineSegment_t segTmp2(trj2[l2], trj2[l2 + 1]);
-        double distTmp = _SqDist_(segTmp1, segTmp2, c1min, c2min);
-        if (distTmp < distMin) {
-          c1 = c1min;
-          c2 = c2min;
-          distMin = distTmp;
-        }
-      } // for segments in trajectory 2
-    }   //for all segments in trajectory 1
+      SegmentBox const box1(trj1[l1], trj1[l1 + 1]);
+      if (box1.sqDist(all2) >= distMin) continue;
+      LineSegment_t const segTmp1(trj1[l1], trj1[l1 + 1]);
+      for (size_t chunk = 0; chunk < chunks2.size(); ++chunk) {
+        if (box1.sqDist(chunks2[chunk]) >= distMin) continue;
+        size_t const end = std::min(n2, (chunk + 1) * kSegmentChunkSize);
+        for (size_t l2 = chunk * kSegmentChunkSize; l2 < end; l2++) {
+          if (box1.sqDist(boxes2[l2]) >= distMin) continue;
+          LineSegment_t const segTmp2(trj2[l2], trj2[l2 + 1]);
+          double distTmp = _SqDist_(segTmp1, segTmp2, c1min, c2min);
+          if (distTmp < distMin) {
+            c1 = c1min;
+            c2 = c2min;
+            seg1 = l1;
+            seg2 = l2;
+            distMin = distTmp;
+            if (distMin <= stopSqDist) return distMin;
+          }
+        } // for segments in the chunk of trajectory 2
+      }   // for chunks of trajectory 2
+    }     //for all segments in trajectory 1
 
     return distMin;
   }
@@ -783,15 +1707,13 @@ namespace geoalgo {
 
     auto const& s1 = seg1.Start();
     auto const& s2 = seg2.Start();
-    auto const& e1 = seg1.End();
-    auto const& e2 = seg2.End();
 
-    auto d1 = e1 - s1;
-    auto d2 = e2 - s2;
+    auto const& d1 = seg1.Dir();
+    auto const& d2 = seg2.Dir();
     auto r = s1 - s2;
 
-    double a = d1.SqLength();
-    double e = d2.SqLength();
+    double a = seg1.SqLength();
+    double e = seg2.SqLength();
     double f = d2 * r;
 
     // check if segment is too short
@@ -880,8 +1802,8 @@ namespace geoalgo {
     // will give insight on other possible topologies.
 
     // get directions of two lines
-    Vector_t dir1(lin1.Pt2() - lin1.Pt1());
-    Vector_t dir2(lin2.Pt2() - lin2.Pt1());
+    Vector_t dir1(lin1.Dir());
+    Vector_t dir2(lin2.Dir());
     dir1.Normalize();
     dir2.Normalize();
 
@@ -1028,104 +1950,110 @@ namespace geoalgo {
     return _commonOrigin_(lin, lin2, origin, backwards);
   }
 
-  /// Bounding Sphere problem
-  /// Real-Time Collision Analysis 4.3.5 (Pg. 100) - WelzlSphere
-  Sphere_t GeoAlgo::_boundingSphere_(const std::vector<Point_t>& pts) const
+  /// Common vertex: Lines
+  // The weighted sum of squared distances is quadratic in the vertex position,
+  // and its minimum solves a 3x3 linear system summed over the lines.
+  double GeoAlgo::commonVertex(const std::vector<Line_t>& lines,
+                               Point_t& vertex,
+                               const std::vector<double>& weights,
+                               const VertexFitConfig& config) const
   {
+    checkVertexWeights(weights, lines.size());
+    std::vector<Vector_t> dirs;
+    dirs.reserve(lines.size());
+    for (auto const& line : lines)
+      dirs.push_back(line.Dir().Dir());
+
+    auto add = [&lines, &dirs](DistanceQuadric& q, size_t i, double w, const Point_t*) {
+      q.addLine(lines[i].Pt1(), dirs[i], w);
+      return char{0};
+    };
+    auto sqDist = [&lines, &dirs](size_t i, const Point_t& x) {
+      return lineSqDist(x, lines[i].Pt1(), dirs[i]);
+    };
+    return fitCommonVertex(lines.size(), weights, config, add, sqDist, vertex);
+  }
 
-    // Remove any duplicate points
-    std::vector<Point_t> copyPts = {pts[0]};
-    for (size_t p1 = 0; p1 < pts.size(); p1++) {
-      // if an identical point does not already exist in copyPts -> then add
-      bool found = false;
-      for (size_t p2 = 0; p2 < copyPts.size(); p2++)
-        if (pts[p1] == copyPts[p2]) {
-          found = true;
-          break;
-        }
-      if (!found) copyPts.push_back(pts[p1]);
-    }
-
-    // if 4 or less points call appropriate constructor
-    if (copyPts.size() < 5) return Sphere_t(copyPts);
+  /// Common vertex: Half Lines
+  // A half line contributes as a line while the vertex is ahead of its start,
+  // and as its start point otherwise; the sides are decided from the previous fit.
+  double GeoAlgo::commonVertex(const std::vector<HalfLine_t>& lines,
+                               Point_t& vertex,
+                               bool backwards,
+                               const std::vector<double>& weights,
+                               const VertexFitConfig& config) const
+  {
+    checkVertexWeights(weights, lines.size());
+    std::vector<Vector_t> dirs;
+    dirs.reserve(lines.size());
+    for (auto const& line : lines)
+      dirs.push_back(backwards ? line.Dir() * (-1.) : line.Dir());
+
+    auto behind = [&lines, &dirs](size_t i, const Point_t& x) {
+      return (x - lines[i].Start()).Dot(dirs[i]) < 0.;
+    };
+    auto add = [&lines, &dirs, &behind](DistanceQuadric& q, size_t i, double w, const Point_t* x) {
+      if (x && behind(i, *x)) {
+        q.addPoint(lines[i].Start(), w);
+        return char{1};
+      }
+      q.addLine(lines[i].Start(), dirs[i], w);
+      return char{0};
+    };
+    auto sqDist = [&lines, &dirs, &behind](size_t i, const Point_t& x) {
+      return behind(i, x) ? x.SqDist(lines[i].Start()) : lineSqDist(x, lines[i].Start(), dirs[i]);
+    };
+    return fitCommonVertex(lines.size(), weights, config, add, sqDist, vertex);
+  }
 
-    size_t npoints = copyPts.size();
-    std::vector<Point_t> points4 = {
-      copyPts[npoints - 1], copyPts[npoints - 2], copyPts[npoints - 3], copyPts[npoints - 4]};
-    copyPts.pop_back();
-    copyPts.pop_back();
-    copyPts.pop_back();
-    copyPts.pop_back();
-    Sphere_t tmpSphere = Sphere(points4);
-    return _RemainingPoints_(copyPts, tmpSphere);
+  /// Sum of squared distances from Lines, for many Points
+  std::vector<double> GeoAlgo::SqDistSum(const std::vector<Line_t>& lines,
+                                         const std::vector<Point_t>& points,
+                                         const std::vector<double>& weights) const
+  {
+    checkVertexWeights(weights, lines.size());
+    DistanceQuadric q;
+    for (size_t i = 0; i < lines.size(); ++i) {
+      q.addLine(lines[i].Pt1(),
+                (lines[i].Pt2() - lines[i].Pt1()).Dir(),
+                weights.empty() ? 1. : weights[i]);
+    }
 
-    // too many points to call simple constructor! find minimally bounding sphere
-    // compute sphere for first 4 points
-    //Sphere_t tmpSphere(copyPts[0],copyPts[1],copyPts[2],copyPts[3]);
-    //std::vector<Point_t> sosPoints;// = {pts[0]};
-    //sosPoints.clear();
-    //return _WelzlSphere_(copyPts,copyPts.size(),sosPoints);
+    std::vector<double> sums;
+    sums.reserve(points.size());
+    for (auto const& pt : points)
+      sums.push_back(q.eval(pt));
+    return sums;
   }
 
-  Sphere_t GeoAlgo::_RemainingPoints_(std::vector<Point_t>& remaining,
-                                      const Sphere_t& thisSphere) const
+  /// Bounding Sphere problem
+  /// Real-Time Collision Analysis 4.3.5 (Pg. 100) - WelzlSphere
+  // Minimal bounding sphere: Welzl's algorithm in the move-to-front version by
+  // B. Gaertner, "Fast and Robust Smallest Enclosing Balls", ESA 1999.
+  // Points are processed in random order; the recursion is only on the points
+  // on the sphere surface (at most 4), and each point found outside the current
+  // sphere is moved to the front of the list, where it is tested first afterwards.
+  Sphere_t GeoAlgo::_boundingSphere_(const std::vector<Point_t>& pts) const
   {
 
-    // if no points lef -> done...return the current sphere
-    if (remaining.size() == 0) return thisSphere;
+    if (pts.empty()) throw GeoAlgoException("<<boundingSphere>> no point given!");
 
-    //std::cout << "Remaining points: " << remaining.size() << std::endl;
+    // Remove any duplicate points, sorting them
+    std::vector<Point_t> copyPts(pts);
+    std::sort(copyPts.begin(), copyPts.end(), [](const Point_t& a, const Point_t& b) {
+      return std::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end());
+    });
+    copyPts.erase(std::unique(copyPts.begin(), copyPts.end()), copyPts.end());
 
-    auto const& lastPoint = remaining.back();
+    // a fixed seed keeps the result reproducible
+    std::mt19937 rng(5489U);
+    std::shuffle(copyPts.begin(), copyPts.end(), rng);
 
-    // if this point is bounded by the already constructed sphere, continue
-    if (thisSphere.Contain(lastPoint)) {
-      remaining.pop_back();
-      return _RemainingPoints_(remaining, thisSphere);
-    }
-    // if not, need to adjust so that the new point is also bound
-    // get distance from lastPoint and center
-    double dist = lastPoint.Dist(thisSphere.Center());
-    //std::cout << "point does not fit: " << lastPoint << std::endl;
-    //std::cout << "distance: " << dist << std::endl;
-    //std::cout << "center  : " << thisSphere.Center() << std::endl;
-    //std::cout << "radius  : " << thisSphere.Radius() << std::endl;
-    // the new center should be shifted in the direction
-    // of the new point by half the difference between
-    // the current radius and "dist"
-    // direction in which to move:
-    Vector_t dir = lastPoint - thisSphere.Center();
-    dir.Normalize();
-    // amount to move by
-    double shift = (dist - thisSphere.Radius()) / 2.;
-    if (shift < 0) { shift *= -1; }
-    Point_t newCenter = thisSphere.Center() + dir * shift;
-    double newRadius = thisSphere.Radius() + shift;
-    //std::cout << "new center: " << newCenter << std::endl;
-    //std::cout << "new radius: " << newRadius << std::endl;
-    Sphere_t newsphere(newCenter, newRadius);
-    //if (newsphere.Contain(lastPoint)) { std::cout << "new point contained!" << std::endl; }
-    //else { std::cout << "WRONG!" << std::endl; }
-    remaining.pop_back();
-
-    return _RemainingPoints_(remaining, newsphere);
-  }
-
-  Sphere_t GeoAlgo::_WelzlSphere_(const std::vector<Point_t>& pts,
-                                  int numPts,
-                                  std::vector<Point_t> sosPts) const
-  {
-
-    if (numPts == 0) return Sphere_t(sosPts);
-    // choose last point in the input set as the one to test (if it fits in current sphere or not)
-    int index = numPts - 1;
-    // recursively compute the smallest bounding sphere of the remaining points
-    Sphere_t smallestSphere = _WelzlSphere_(pts, numPts - 1, sosPts);
-    // if the selected point lies inside this sphere, it is indeed the smallest
-    if (smallestSphere.Contain(pts[index])) return smallestSphere;
-    // otherwise, update the set-of-support to additionally contain the new point
-    sosPts.push_back(pts[index]);
-    return _WelzlSphere_(pts, numPts - 1, sosPts);
+    std::list<Point_t> points(copyPts.begin(), copyPts.end());
+    MiniballBasis basis;
+    moveToFrontMiniball(points, points.end(), basis);
+
+    return Sphere_t(basis.center(), std::sqrt(std::max(basis.sqRadius(), 0.)));
   }
 
 }
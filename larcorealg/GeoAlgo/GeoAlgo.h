@@ -18,6 +18,7 @@
 #include "larcorealg/GeoAlgo/GeoHalfLine.h"
 #include "larcorealg/GeoAlgo/GeoLine.h"
 #include "larcorealg/GeoAlgo/GeoLineSegment.h"
+#include "larcorealg/GeoAlgo/GeoPackedTrajectory.h"
 #include "larcorealg/GeoAlgo/GeoSphere.h"
 #include "larcorealg/GeoAlgo/GeoTrajectory.h"
 #include "larcorealg/GeoAlgo/GeoVector.h"
@@ -26,6 +27,14 @@
 
 namespace geoalgo {
 
+  /// Settings of the common vertex fits (see `GeoAlgo::commonVertex()`)
+  struct VertexFitConfig {
+    /// Distance scale of the robust (Cauchy) reweighting of the objects; `0` disables it
+    double robustScale = 0.;
+    /// Largest number of fits (for the reweighting and the half line ends)
+    size_t maxIterations = 10;
+  };
+
   /**
      \class GeoAlgo
      @brief Algorithm to compute various geometrical relation among geometrical objects.
@@ -35,6 +44,7 @@ namespace geoalgo {
      2) Intersection points                  \n
      3) Containment/Overlap of objects       \n
      4) Common Origin functions              \n
+     4b) Common Vertex of many objects        \n
      5) Bounding Sphere functions            \n
 
      Most functions are taken from the reference Real-Time-Collision-Detection (RTCD):
@@ -50,7 +60,12 @@ namespace geoalgo {
     /// Intersection between a HalfLine and an AABox
     std::vector<Point_t> Intersection(const AABox_t& box,
                                       const HalfLine_t& line,
-                                      bool back = false) const;
+                                      bool back = false) const
+    {
+      std::vector<Point_t> result;
+      Intersection(box, line, result, back);
+      return result;
+    }
     /// Intersection between a HalfLine and an AABox
     std::vector<Point_t> Intersection(const HalfLine_t& line,
                                       const AABox_t& box,
@@ -60,7 +75,12 @@ namespace geoalgo {
     }
 
     /// Intersection between LineSegment and an AABox
-    std::vector<Point_t> Intersection(const AABox_t& box, const LineSegment_t& l) const;
+    std::vector<Point_t> Intersection(const AABox_t& box, const LineSegment_t& l) const
+    {
+      std::vector<Point_t> result;
+      Intersection(box, l, result);
+      return result;
+    }
     /// Intersection between LineSegment and an AABox
     std::vector<Point_t> Intersection(const LineSegment_t& l, const AABox_t& box) const
     {
@@ -68,7 +88,12 @@ namespace geoalgo {
     }
 
     /// Intersection between Trajectory and an AABox
-    std::vector<Point_t> Intersection(const AABox_t& box, const Trajectory_t& trj) const;
+    std::vector<Point_t> Intersection(const AABox_t& box, const Trajectory_t& trj) const
+    {
+      std::vector<Point_t> result;
+      Intersection(box, trj, result);
+      return result;
+    }
     /// Intersection between Trajectory and an AABox
     std::vector<Point_t> Intersection(const Trajectory_t& trj, const AABox_t& box) const
     {
@@ -76,7 +101,12 @@ namespace geoalgo {
     }
 
     /// LineSegment sub-segment of HalfLine inside an AABox
-    LineSegment_t BoxOverlap(const AABox_t& box, const HalfLine_t& line) const;
+    LineSegment_t BoxOverlap(const AABox_t& box, const HalfLine_t& line) const
+    {
+      LineSegment_t result;
+      BoxOverlap(box, line, result);
+      return result;
+    }
     /// LineSegment sub-segment of HalfLine inside an AABox
     LineSegment_t BoxOverlap(const HalfLine_t& line, const AABox_t& box) const
     {
@@ -84,13 +114,168 @@ namespace geoalgo {
     }
 
     /// Get Trajectory inside box given some input trajectory -> now assumes trajectory cannot exit and re-enter box
-    Trajectory_t BoxOverlap(const AABox_t& box, const Trajectory_t& trj) const;
+    Trajectory_t BoxOverlap(const AABox_t& box, const Trajectory_t& trj) const
+    {
+      Trajectory_t result;
+      BoxOverlap(box, trj, result);
+      return result;
+    }
     /// Get Trajectory inside box given some input trajectory -> now assumes trajectory cannot exit and re-enter box
     Trajectory_t BoxOverlap(const Trajectory_t& trj, const AABox_t& box) const
     {
       return BoxOverlap(box, trj);
     }
 
+    //
+    // Intersections into reusable results
+    //
+    // Same as the functions returning the result, which is written into `result` instead:
+    // its previous content is replaced, and the memory it holds is reused, so that calls in a
+    // loop on the same `result` do not allocate once it is large enough.
+
+    /// Intersection between a HalfLine and an AABox, into `result`
+    void Intersection(const AABox_t& box,
+                      const HalfLine_t& line,
+                      std::vector<Point_t>& result,
+                      bool back = false) const;
+    /// Intersection between LineSegment and an AABox, into `result`
+    void Intersection(const AABox_t& box,
+                      const LineSegment_t& l,
+                      std::vector<Point_t>& result) const;
+    /// Intersection between Trajectory and an AABox, into `result`
+    void Intersection(const AABox_t& box,
+                      const Trajectory_t& trj,
+                      std::vector<Point_t>& result) const;
+    /// LineSegment sub-segment of HalfLine inside an AABox, into `result`
+    void BoxOverlap(const AABox_t& box, const HalfLine_t& line, LineSegment_t& result) const;
+    /// Trajectory inside box given some input trajectory, into `result`
+    void BoxOverlap(const AABox_t& box, const Trajectory_t& trj, Trajectory_t& result) const;
+
+    //
+    // Batch intersections (slab test, no allocation)
+    //
+    // The crossing of line `i` with box `j` is the part of the line `Start() + t * Dir()`
+    // (`Pt1() + t * (Pt2() - Pt1())` for Line_t) with `t` between `tEnter[k]` and `tExit[k]`,
+    // with `k = i * nBoxes + j`: for a LineSegment_t `t` is in [0, 1], for a HalfLine_t it is
+    // not negative and it is the distance from the start. A line missing the box has both set
+    // to kINVALID_DOUBLE. Box faces are part of the box.
+
+    /// Intersections between many HalfLines and an AABox (`lines.size()` outputs)
+    void Intersection(const AABox_t& box,
+                      const std::vector<HalfLine_t>& lines,
+                      double* tEnter,
+                      double* tExit) const
+    {
+      _Intersection_(&box, 1, lines, tEnter, tExit);
+    }
+    /// Intersections between many HalfLines and AABoxes (`lines.size() * boxes.size()` outputs)
+    void Intersection(const std::vector<AABox_t>& boxes,
+                      const std::vector<HalfLine_t>& lines,
+                      double* tEnter,
+                      double* tExit) const
+    {
+      _Intersection_(boxes.data(), boxes.size(), lines, tEnter, tExit);
+    }
+    /// Intersections between many LineSegments and an AABox (`lines.size()` outputs)
+    void Intersection(const AABox_t& box,
+                      const std::vector<LineSegment_t>& lines,
+                      double* tEnter,
+                      double* tExit) const
+    {
+      _Intersection_(&box, 1, lines, tEnter, tExit);
+    }
+    /// Intersections between many LineSegments and AABoxes (`lines.size() * boxes.size()` outputs)
+    void Intersection(const std::vector<AABox_t>& boxes,
+                      const std::vector<LineSegment_t>& lines,
+                      double* tEnter,
+                      double* tExit) const
+    {
+      _Intersection_(boxes.data(), boxes.size(), lines, tEnter, tExit);
+    }
+    /// Intersections between many Lines and an AABox (`lines.size()` outputs)
+    void Intersection(const AABox_t& box,
+                      const std::vector<Line_t>& lines,
+                      double* tEnter,
+                      double* tExit) const
+    {
+      _Intersection_(&box, 1, lines, tEnter, tExit);
+    }
+    /// Intersections between many Lines and AABoxes (`lines.size() * boxes.size()` outputs)
+    void Intersection(const std::vector<AABox_t>& boxes,
+                      const std::vector<Line_t>& lines,
+                      double* tEnter,
+                      double* tExit) const
+    {
+      _Intersection_(boxes.data(), boxes.size(), lines, tEnter, tExit);
+    }
+
+    //
+    // Batches on coordinate arrays
+    //
+    // Points and directions are `n` consecutive (x, y, z) triplets, the layout of a C-ordered
+    // array of shape (n, 3) (e.g. a NumPy array, passed from Python without conversion), and
+    // the results are written in arrays of `n` elements (`n` triplets for points).
+
+    /// Intersections between the `n` lines `start + t * dir` with `t` in [`tMin`, `tMax`]
+    /// (half lines by default) and an AABox, as Intersection(box, lines, tEnter, tExit);
+    /// `dir` needs not be normalized, and `tEnter` and `tExit` are in units of its length
+    void Intersection(const AABox_t& box,
+                      size_t n,
+                      const double* start,
+                      const double* dir,
+                      double* tEnter,
+                      double* tExit,
+                      double tMin = 0.,
+                      double tMax = kMAX_DOUBLE) const
+    {
+      _Intersection_(&box, 1, n, start, dir, tMin, tMax, tEnter, tExit);
+    }
+    /// Intersections between the `n` lines `start + t * dir` with `t` in [`tMin`, `tMax`]
+    /// and AABoxes (`n * boxes.size()` outputs), as Intersection(boxes, lines, tEnter, tExit)
+    void Intersection(const std::vector<AABox_t>& boxes,
+                      size_t n,
+                      const double* start,
+                      const double* dir,
+                      double* tEnter,
+                      double* tExit,
+                      double tMin = 0.,
+                      double tMax = kMAX_DOUBLE) const
+    {
+      _Intersection_(boxes.data(), boxes.size(), n, start, dir, tMin, tMax, tEnter, tExit);
+    }
+
+    //
+    // Batches on float coordinate arrays
+    //
+    // Same as the ones on double arrays, computed in float precision (half the memory and
+    // twice the values per vector instruction), with the objects rounded to float; AABox and
+    // Trajectory objects stay in double precision. A miss is `kINVALID_FLOAT`.
+
+    /// Intersections of the `n` lines `start + t * dir` with an AABox, in float precision
+    void Intersection(const AABox_t& box,
+                      size_t n,
+                      const float* start,
+                      const float* dir,
+                      float* tEnter,
+                      float* tExit,
+                      float tMin = 0.f,
+                      float tMax = kMAX_FLOAT) const
+    {
+      _Intersection_(&box, 1, n, start, dir, tMin, tMax, tEnter, tExit);
+    }
+    /// Intersections of the `n` lines `start + t * dir` with AABoxes, in float precision
+    void Intersection(const std::vector<AABox_t>& boxes,
+                      size_t n,
+                      const float* start,
+                      const float* dir,
+                      float* tEnter,
+                      float* tExit,
+                      float tMin = 0.f,
+                      float tMax = kMAX_FLOAT) const
+    {
+      _Intersection_(boxes.data(), boxes.size(), n, start, dir, tMin, tMax, tEnter, tExit);
+    }
+
     //************************************************
     //CLOSEST APPROACH BETWEEN POINT AND INFINITE LINE
     //************************************************
@@ -208,6 +393,31 @@ namespace geoalgo {
       Point_t c2;
       return SqDist(trj1, trj2, c1, c2);
     }
+    /// Trajectory & Trajectory, keep track of points and of the closest segments
+    /// (`seg1` and `seg2` are the index of their first point)
+    double SqDist(const Trajectory_t& trj1,
+                  const Trajectory_t& trj2,
+                  Point_t& c1,
+                  Point_t& c2,
+                  size_t& seg1,
+                  size_t& seg2) const;
+    /// Trajectory & Trajectory: whether they come within `dist` from each other
+    bool WithinDist(const Trajectory_t& trj1, const Trajectory_t& trj2, double dist) const
+    {
+      Point_t c1(3);
+      Point_t c2(3);
+      size_t seg1, seg2;
+      return WithinDist(trj1, trj2, dist, c1, c2, seg1, seg2);
+    }
+    /// Trajectory & Trajectory: whether they come within `dist` from each other; keep track
+    /// of the points and segments of the first pair of segments found within `dist`
+    bool WithinDist(const Trajectory_t& trj1,
+                    const Trajectory_t& trj2,
+                    double dist,
+                    Point_t& c1,
+                    Point_t& c2,
+                    size_t& seg1,
+                    size_t& seg2) const;
 
     //*****************************************************
     //CLOSEST APPROACH BETWEEN SEGMENT AND VECTOR OF TRACKS
@@ -296,6 +506,73 @@ namespace geoalgo {
       return ClosestPt(pt, trj, idx);
     }
 
+    //******************************************************
+    //CLOSEST APPROACH BETWEEN MANY POINTS AND A TRACK
+    //******************************************************
+    /// Point_t's & Trajectory_t distances: `sqDist` and `segIdx` (if not null) are arrays of
+    /// `pts.size()` elements, filled with the results of SqDist() and ClosestPt() of each point
+    void SqDist(const std::vector<Point_t>& pts,
+                const Trajectory_t& trj,
+                double* sqDist,
+                size_t* segIdx = nullptr) const;
+    /// Point_t's & Trajectory_t closest points: `closest` and `segIdx` (if not null) are arrays
+    /// of `pts.size()` elements, filled with the results of ClosestPt() of each point
+    void ClosestPt(const std::vector<Point_t>& pts,
+                   const Trajectory_t& trj,
+                   Point_t* closest,
+                   size_t* segIdx = nullptr) const;
+    /// Point_t's & Trajectory_t distances, with the `n` points from the coordinate array `xyz`
+    /// (see the batch intersections on coordinate arrays)
+    void SqDist(size_t n,
+                const double* xyz,
+                const Trajectory_t& trj,
+                double* sqDist,
+                size_t* segIdx = nullptr) const;
+    /// Point_t's & Trajectory_t distances, with the `n` points from the float coordinate array
+    /// `xyz` (see the batches on float coordinate arrays)
+    void SqDist(size_t n,
+                const float* xyz,
+                const Trajectory_t& trj,
+                float* sqDist,
+                size_t* segIdx = nullptr) const;
+    /// Point_t's & Trajectory_t closest points, with the `n` points from the coordinate array
+    /// `xyz` and their closest points written into the coordinate array `closestXYZ`
+    void ClosestPt(size_t n,
+                   const double* xyz,
+                   const Trajectory_t& trj,
+                   double* closestXYZ,
+                   size_t* segIdx = nullptr) const;
+
+    //***********************************************
+    //CLOSEST APPROACH BETWEEN POINT AND PACKED TRACK
+    //***********************************************
+    /// Point_t & PackedTrajectory_t distance (to the point, if only one)
+    double SqDist(const Point_t& pt, const PackedTrajectory_t& trj) const;
+    /// Point_t & PackedTrajectory_t distance (to the point, if only one)
+    double SqDist(const PackedTrajectory_t& trj, const Point_t& pt) const
+    {
+      return SqDist(pt, trj);
+    }
+    /// Point_t & PackedTrajectory_t closest point
+    Point_t ClosestPt(const Point_t& pt, const PackedTrajectory_t& trj) const
+    {
+      int idx = 0;
+      return ClosestPt(pt, trj, idx);
+    }
+    /// Point_t & PackedTrajectory_t closest point
+    Point_t ClosestPt(const PackedTrajectory_t& trj, const Point_t& pt) const
+    {
+      int idx = 0;
+      return ClosestPt(pt, trj, idx);
+    }
+    /// Point_t & PackedTrajectory_t closest point. Keep track of index of segment
+    Point_t ClosestPt(const Point_t& pt, const PackedTrajectory_t& trj, int& idx) const;
+    /// Point_t & PackedTrajectory_t closest point. Keep track of index of segment
+    Point_t ClosestPt(const PackedTrajectory_t& trj, const Point_t& pt, int& idx) const
+    {
+      return ClosestPt(pt, trj, idx);
+    }
+
     //***************************************************
     //CLOSEST APPROACH BETWEEN POINT AND VECTOR OF TRACKS
     //***************************************************
@@ -608,10 +885,37 @@ namespace geoalgo {
       return _commonOrigin_(trj, seg, origin, backwards);
     }
 
+    //*************************************************************************
+    //COMMON VERTEX ALGORITHMS: LEAST SQUARES CLOSEST POINT TO MANY GEO-OBJECTS
+    //*************************************************************************
+    /// Common vertex: the point with the least weighted sum of squared distances from `lines`.
+    /// `weights` has one entry per line (empty: all `1`). The point is stored in `vertex`,
+    /// and the weighted mean squared distance is returned. The sums are accumulated in a single
+    /// pass on the lines (one more per iteration of a robust fit, see `VertexFitConfig`).
+    /// Throws `GeoAlgoException` if there is no line, or they are all parallel.
+    double commonVertex(const std::vector<Line_t>& lines,
+                        Point_t& vertex,
+                        const std::vector<double>& weights = {},
+                        const VertexFitConfig& config = VertexFitConfig{}) const;
+    /// Common vertex: as for lines, with the half lines traced backwards if `backwards`.
+    /// The distance from a half line is from its start when the point is behind it; the fit
+    /// is repeated until the half lines with the point behind them do not change.
+    double commonVertex(const std::vector<HalfLine_t>& lines,
+                        Point_t& vertex,
+                        bool backwards = false,
+                        const std::vector<double>& weights = {},
+                        const VertexFitConfig& config = VertexFitConfig{}) const;
+    /// Weighted sum of squared distances from `lines` of each of the candidate `points`.
+    /// The lines are visited only once, and each point takes a fixed time afterwards.
+    std::vector<double> SqDistSum(const std::vector<Line_t>& lines,
+                                  const std::vector<Point_t>& points,
+                                  const std::vector<double>& weights = {}) const;
+
     //************************************************************************
     //BOUNDING SPHERE ALGORITHM: RETURN SMALLEST SPHERE THAT BOUNDS ALL POINTS
     //************************************************************************
-    // Bounding Sphere problem given a vector of 3D points
+    /// Bounding Sphere problem given a vector of 3D points.
+    /// The sphere is the exact minimal one (up to rounding), found in expected linear time.
     Sphere_t boundingSphere(const std::vector<Point_t>& pts) const
     {
       for (auto& p : pts) {
@@ -621,6 +925,51 @@ namespace geoalgo {
     }
 
   protected:
+    /// Batch intersections between lines and `nBoxes` AABoxes from `boxes`
+    void _Intersection_(const AABox_t* boxes,
+                        size_t nBoxes,
+                        const std::vector<HalfLine_t>& lines,
+                        double* tEnter,
+                        double* tExit) const;
+    /// Batch intersections between line segments and `nBoxes` AABoxes from `boxes`
+    void _Intersection_(const AABox_t* boxes,
+                        size_t nBoxes,
+                        const std::vector<LineSegment_t>& lines,
+                        double* tEnter,
+                        double* tExit) const;
+    /// Batch intersections between infinite lines and `nBoxes` AABoxes from `boxes`
+    void _Intersection_(const AABox_t* boxes,
+                        size_t nBoxes,
+                        const std::vector<Line_t>& lines,
+                        double* tEnter,
+                        double* tExit) const;
+    /// Intersections between a HalfLine and an AABox into `xs` (2 points); returns their number
+    size_t _Intersection_(const AABox_t& box,
+                          const HalfLine_t& line,
+                          bool back,
+                          Point_t* xs) const;
+    /// Batch intersections between `n` lines from coordinate arrays and `nBoxes` AABoxes
+    void _Intersection_(const AABox_t* boxes,
+                        size_t nBoxes,
+                        size_t n,
+                        const double* start,
+                        const double* dir,
+                        double tMin,
+                        double tMax,
+                        double* tEnter,
+                        double* tExit) const;
+    /// Batch intersections between `n` lines from coordinate arrays and `nBoxes` AABoxes,
+    /// in float precision
+    void _Intersection_(const AABox_t* boxes,
+                        size_t nBoxes,
+                        size_t n,
+                        const float* start,
+                        const float* dir,
+                        float tMin,
+                        float tMax,
+                        float* tEnter,
+                        float* tExit) const;
+
     /// Line & Line distance w/o dimensionality check
     double _SqDist_(const Line_t& l1, const Line_t& l2, Point_t& L1, Point_t& L2) const;
 
@@ -628,14 +977,14 @@ namespace geoalgo {
     double _SqDist_(const HalfLine_t& l1, const HalfLine_t& l2, Point_t& L1, Point_t& L2) const;
 
     /// Point & LineSegment distance w/o dimensionality check
-    double _SqDist_(const Point_t& pt, const LineSegment_t& line) const
-    {
-      return _SqDist_(pt, line.Start(), line.End());
-    }
+    double _SqDist_(const Point_t& pt, const LineSegment_t& line) const;
 
     /// Point & LineSegment distance w/o dimensionality check
     double _SqDist_(const Point_t& pt, const Point_t& line_s, const Point_t& line_e) const;
 
+    /// Point_t & segment `i` of PackedTrajectory_t distance; `t` is the closest path length on it
+    double _SqDist_(const Point_t& pt, const PackedTrajectory_t& trj, size_t i, double& t) const;
+
     /// Point & LineSegment distance w/o dimensionality check
     double _SqDist_(const LineSegment_t& line, const Point_t& pt) const
     {
@@ -654,6 +1003,16 @@ namespace geoalgo {
                     Point_t& c1,
                     Point_t& c2) const;
 
+    /// Trajectory & Trajectory distance w/o dimensionality check; stops at the first pair
+    /// of segments within `stopSqDist` (squared)
+    double _SqDist_(const Trajectory_t& trj1,
+                    const Trajectory_t& trj2,
+                    Point_t& c1,
+                    Point_t& c2,
+                    size_t& seg1,
+                    size_t& seg2,
+                    double stopSqDist) const;
+
     // Point & LineSegment closest point w/o dimensionality check
     Point_t _ClosestPt_(const Point_t& pt, const LineSegment_t& line) const;
     // Point & LineSegment closest point w/o dimensionality check
@@ -734,10 +1093,6 @@ namespace geoalgo {
 
     // Bounding Sphere given a vector of points
     Sphere_t _boundingSphere_(const std::vector<Point_t>& pts) const;
-    Sphere_t _RemainingPoints_(std::vector<Point_t>& remaining, const Sphere_t& thisSphere) const;
-    Sphere_t _WelzlSphere_(const std::vector<Point_t>& pts,
-                           int numPts,
-                           std::vector<Point_t> sosPts) const;
 
     /// Clamp function: checks if value out of bounds
     double _Clamp_(const double n, const double min, const double max) const;
@@ -13,5 +13,9 @@ namespace geoalgo {
 
   static const double kMIN_DOUBLE = std::numeric_limits<double>::min();
 
+  static const float kINVALID_FLOAT = std::numeric_limits<float>::max();
+
+  static const float kMAX_FLOAT = std::numeric_limits<float>::max();
+
 }
 #endif
@@ -2,8 +2,39 @@
 #include "larcorealg/GeoAlgo/GeoAlgoException.h" // for GeoAlgoException
 
 #include <math.h>
+#include <memory>
 #include <sstream>
 
+namespace {
+
+  /// Cone::Contain() of `n` points, computed in `Real` precision
+  template <typename Real>
+  void coneContain(const geoalgo::Point_t& start,
+                   const geoalgo::Vector_t& dir,
+                   double length,
+                   double radius,
+                   size_t n,
+                   const Real* x,
+                   const Real* y,
+                   const Real* z,
+                   bool* mask,
+                   size_t stride)
+  {
+    // vertex, unit axis direction, and squared radius per unit of squared length
+    Real const ox = start[0], oy = start[1], oz = start[2];
+    Real const ux = dir[0], uy = dir[1], uz = dir[2];
+    Real const len = length;
+    Real const slope2 = Real((radius * radius) / (length * length));
+    for (size_t i = 0; i < n; ++i) {
+      Real const dx = x[i * stride] - ox, dy = y[i * stride] - oy, dz = z[i * stride] - oz;
+      Real const t = dx * ux + dy * uy + dz * uz;
+      Real const radial2 = (dx * dx + dy * dy + dz * dz) - t * t;
+      mask[i] = (t >= Real(0)) & (t <= len) & (radial2 <= t * t * slope2);
+    }
+  }
+
+} // local namespace
+
 namespace geoalgo {
 
   Cone::Cone() : HalfLine()
@@ -71,4 +102,45 @@ namespace geoalgo {
     _radius = r;
     _angle = atan(_radius / _length);
   }
+
+  // The point projects on the axis between the vertex and the base, and its distance from the
+  // axis is not larger than the radius at that point; the axis frame is computed once for all
+  // the points of a batch
+  bool Cone::Contain(const Point_t& pt) const
+  {
+    bool mask;
+    Contain(1, &pt[0], &pt[1], &pt[2], &mask);
+    return mask;
+  }
+
+  void Cone::Contain(size_t n,
+                     const double* x,
+                     const double* y,
+                     const double* z,
+                     bool* mask,
+                     size_t stride) const
+  {
+    coneContain(_start, _dir, _length, _radius, n, x, y, z, mask, stride);
+  }
+
+  void Cone::Contain(size_t n,
+                     const float* x,
+                     const float* y,
+                     const float* z,
+                     bool* mask,
+                     size_t stride) const
+  {
+    coneContain(_start, _dir, _length, _radius, n, x, y, z, mask, stride);
+  }
+
+  std::vector<bool> Cone::Contain(const std::vector<double>& x,
+                                  const std::vector<double>& y,
+                                  const std::vector<double>& z) const
+  {
+    if (x.size() != y.size() || x.size() != z.size())
+      throw GeoAlgoException("Cone::Contain: coordinate vectors of different size!");
+    std::unique_ptr<bool[]> mask(new bool[x.size()]);
+    Contain(x.size(), x.data(), y.data(), z.data(), mask.get());
+    return std::vector<bool>(mask.get(), mask.get() + x.size());
+  }
 }
@@ -16,6 +16,10 @@
 
 #include "larcorealg/GeoAlgo/GeoHalfLine.h"
 #include "larcorealg/GeoAlgo/GeoVector.h"
+
+#include <stddef.h>
+#include <vector>
+
 namespace geoalgo {
   /**
      \class Cone
@@ -53,6 +57,40 @@ namespace geoalgo {
     double Radius() const; ///< Length getter
     double Angle() const;  ///< Angle getter
 
+    /// Containment evaluation: whether `pt` is in the cone (surface included)
+    bool Contain(const Point_t& pt) const;
+
+    /// Containment of the `n` points (`x[i]`, `y[i]`, `z[i]`): `mask[i]` is set to Contain()
+    /// (`i * stride` is the index of the coordinates of the point `i` in the arrays)
+    void Contain(size_t n,
+                 const double* x,
+                 const double* y,
+                 const double* z,
+                 bool* mask,
+                 size_t stride = 1) const;
+    /// Containment of the `n` points from the (x, y, z) triplets of `xyz`, the layout of a
+    /// C-ordered array of shape (n, 3) like a NumPy one
+    void Contain(size_t n, const double* xyz, bool* mask) const
+    {
+      Contain(n, xyz, xyz + 1, xyz + 2, mask, 3);
+    }
+    /// Containment of `n` points from float coordinate arrays, computed in float precision
+    void Contain(size_t n,
+                 const float* x,
+                 const float* y,
+                 const float* z,
+                 bool* mask,
+                 size_t stride = 1) const;
+    /// Containment of `n` points from the float (x, y, z) triplets of `xyz`
+    void Contain(size_t n, const float* xyz, bool* mask) const
+    {
+      Contain(n, xyz, xyz + 1, xyz + 2, mask, 3);
+    }
+    /// Containment of the points of coordinates `x`, `y` and `z` (e.g. from Python)
+    std::vector<bool> Contain(const std::vector<double>& x,
+                              const std::vector<double>& y,
+                              const std::vector<double>& z) const;
+
     //
     // Setters
     //
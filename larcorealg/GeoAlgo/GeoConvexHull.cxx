@@ -0,0 +1,523 @@
+#include "larcorealg/GeoAlgo/GeoConvexHull.h"
+#include "larcorealg/GeoAlgo/GeoAlgoException.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace {
+
+  constexpr size_t kNone = std::numeric_limits<size_t>::max();
+
+  /// Twice the signed area of the triangle (`o`, `a`, `b`): positive if counterclockwise
+  double Cross2D(double os, double ot, double as, double at, double bs, double bt)
+  {
+    return (as - os) * (bt - ot) - (at - ot) * (bs - os);
+  }
+
+  /// Sets the plane of `face` from the points `pts` at its corners
+  void SetPlane(geoalgo::ConvexHullScratch::Face_t& face, const std::vector<geoalgo::Point_t>& pts)
+  {
+    auto const& a = pts[face.v[0]];
+    face.normal = (pts[face.v[1]] - a).Cross(pts[face.v[2]] - a);
+    double const length = face.normal.Length();
+    // a face with no area is never seen from any point
+    if (length > 0.)
+      face.normal /= length;
+    else
+      face.normal = geoalgo::Vector_t(0., 0., 0.);
+    face.offset = face.normal * a;
+  }
+
+  /// Distance of `pt` from the plane of `face`, positive outside
+  double PlaneDist(const geoalgo::ConvexHullScratch::Face_t& face, const geoalgo::Point_t& pt)
+  {
+    return face.normal * pt - face.offset;
+  }
+
+  /// Adds the point `p` to the ones outside of `face`
+  void AddOutside(geoalgo::ConvexHullScratch& scratch, size_t face, size_t p, double dist)
+  {
+    auto& f = scratch.faces[face];
+    scratch.nextOutside[p] = f.firstOutside;
+    f.firstOutside = p;
+    if (dist > f.farthestDist) {
+      f.farthestDist = dist;
+      f.farthest = p;
+    }
+  }
+
+  /// Adds `p` to the first of the faces `faces` which it is outside of; returns if any
+  bool AssignOutside(geoalgo::ConvexHullScratch& scratch,
+                     const std::vector<size_t>& faces,
+                     size_t p,
+                     double tolerance)
+  {
+    for (size_t face : faces) {
+      double const dist = PlaneDist(scratch.faces[face], scratch.points[p]);
+      if (dist <= tolerance) continue;
+      AddOutside(scratch, face, p, dist);
+      return true;
+    }
+    return false;
+  }
+
+} // local namespace
+
+namespace geoalgo {
+
+  //
+  // ConvexHull2D
+  //
+  void ConvexHull2D::Build(size_t n,
+                           const double* s,
+                           const double* t,
+                           size_t stride,
+                           ConvexHullScratch* scratch)
+  {
+    ConvexHullScratch localScratch;
+    ConvexHullScratch& work = scratch ? *scratch : localScratch;
+    work.s.resize(n);
+    work.t.resize(n);
+    for (size_t i = 0; i < n; ++i) {
+      work.s[i] = s[i * stride];
+      work.t[i] = t[i * stride];
+    }
+    _u = Vector_t(1., 0., 0.);
+    _v = Vector_t(0., 1., 0.);
+    _Build_(work);
+  }
+
+  void ConvexHull2D::Build(const Point_t* pts,
+                           size_t n,
+                           const Vector_t& u,
+                           const Vector_t& v,
+                           ConvexHullScratch* scratch)
+  {
+    ConvexHullScratch localScratch;
+    ConvexHullScratch& work = scratch ? *scratch : localScratch;
+    work.s.resize(n);
+    work.t.resize(n);
+    for (size_t i = 0; i < n; ++i) {
+      work.s[i] = pts[i] * u;
+      work.t[i] = pts[i] * v;
+    }
+    _u = u;
+    _v = v;
+    _Build_(work);
+  }
+
+  void ConvexHull2D::_Build_(ConvexHullScratch& scratch)
+  {
+    auto const& s = scratch.s;
+    auto const& t = scratch.t;
+    size_t const n = s.size();
+    _index.clear();
+    _s.clear();
+    _t.clear();
+    if (n == 0) return;
+    auto& order = scratch.order;
+    order.resize(n);
+    for (size_t i = 0; i < n; ++i)
+      order[i] = i;
+    std::sort(order.begin(), order.end(), [&s, &t](size_t a, size_t b) {
+      return (s[a] < s[b]) || ((s[a] == s[b]) && (t[a] < t[b]));
+    });
+
+    // lower chain from left to right, then upper chain back, each keeping left turns only
+    _index.resize(2 * n);
+    size_t k = 0;
+    auto const turnsLeft = [this, &s, &t](size_t k, size_t c) {
+      size_t const a = _index[k - 2], b = _index[k - 1];
+      return Cross2D(s[a], t[a], s[b], t[b], s[c], t[c]) > 0.;
+    };
+    for (size_t i = 0; i < n; ++i) {
+      while (k >= 2 && !turnsLeft(k, order[i]))
+        --k;
+      _index[k++] = order[i];
+    }
+    for (size_t i = n - 1, lower = k + 1; i-- > 0;) {
+      while (k >= lower && !turnsLeft(k, order[i]))
+        --k;
+      _index[k++] = order[i];
+    }
+    // the last point is the first one again (if there is more than one)
+    if (k > 1) --k;
+    // all the points are the same one
+    if (k == 2 && s[_index[0]] == s[_index[1]] && t[_index[0]] == t[_index[1]]) k = 1;
+    _index.resize(std::min(k, n));
+
+    _s.resize(_index.size());
+    _t.resize(_index.size());
+    for (size_t i = 0; i < _index.size(); ++i) {
+      _s[i] = s[_index[i]];
+      _t[i] = t[_index[i]];
+    }
+  }
+
+  double ConvexHull2D::Area() const
+  {
+    double area = 0.;
+    for (size_t i = 2; i < size(); ++i)
+      area += Cross2D(_s[0], _t[0], _s[i - 1], _t[i - 1], _s[i], _t[i]);
+    return area / 2.;
+  }
+
+  double ConvexHull2D::Perimeter() const
+  {
+    if (size() < 2) return 0.;
+    double perimeter = 0.;
+    for (size_t i = 0, j = size() - 1; i < size(); j = i++)
+      perimeter += std::hypot(_s[i] - _s[j], _t[i] - _t[j]);
+    // a segment is walked in both directions
+    return perimeter;
+  }
+
+  bool ConvexHull2D::Contain(double s, double t) const
+  {
+    size_t const n = size();
+    if (n == 0) return false;
+    if (n == 1) return (s == _s[0]) && (t == _t[0]);
+    if (n == 2) {
+      if (Cross2D(_s[0], _t[0], _s[1], _t[1], s, t) != 0.) return false;
+      return (s - _s[0]) * (s - _s[1]) <= 0. && (t - _t[0]) * (t - _t[1]) <= 0.;
+    }
+    // the wedge of the fan from the first vertex which the point is in
+    if (Cross2D(_s[0], _t[0], _s[1], _t[1], s, t) < 0.) return false;
+    if (Cross2D(_s[0], _t[0], _s[n - 1], _t[n - 1], s, t) > 0.) return false;
+    size_t lo = 1, hi = n - 1;
+    while (hi - lo > 1) {
+      size_t const mid = (lo + hi) / 2;
+      if (Cross2D(_s[0], _t[0], _s[mid], _t[mid], s, t) >= 0.)
+        lo = mid;
+      else
+        hi = mid;
+    }
+    return Cross2D(_s[lo], _t[lo], _s[hi], _t[hi], s, t) >= 0.;
+  }
+
+  //
+  // ConvexHull3D
+  //
+  void ConvexHull3D::Build(const Point_t* pts, size_t n, ConvexHullScratch* scratch)
+  {
+    ConvexHullScratch localScratch;
+    ConvexHullScratch& work = scratch ? *scratch : localScratch;
+    work.points.assign(pts, pts + n);
+    _Build_(n, work);
+  }
+
+  void ConvexHull3D::Build(size_t n,
+                           const double* x,
+                           const double* y,
+                           const double* z,
+                           size_t stride,
+                           ConvexHullScratch* scratch)
+  {
+    ConvexHullScratch localScratch;
+    ConvexHullScratch& work = scratch ? *scratch : localScratch;
+    work.points.resize(n);
+    for (size_t i = 0; i < n; ++i)
+      work.points[i] = Point_t(x[i * stride], y[i * stride], z[i * stride]);
+    _Build_(n, work);
+  }
+
+  void ConvexHull3D::_Build_(size_t n, ConvexHullScratch& scratch)
+  {
+    _index.clear();
+    _vertices.clear();
+    _faces.clear();
+    _normals.clear();
+    _offsets.clear();
+    _polygon.clear();
+    _tolerance = 0.;
+    if (n == 0) return;
+
+    // centered on the middle of the bounding box, for precision
+    auto& pts = scratch.points;
+    Point_t lo = pts[0], hi = pts[0];
+    for (auto const& pt : pts) {
+      if (!pt.IsValid()) throw GeoAlgoException("ConvexHull3D: invalid point!");
+      for (size_t i = 0; i < 3; ++i) {
+        lo[i] = std::min(lo[i], pt[i]);
+        hi[i] = std::max(hi[i], pt[i]);
+      }
+    }
+    Point_t const center = (lo + hi) / 2.;
+    for (auto& pt : pts)
+      pt -= center;
+    // rounding of the distances from the planes (as in qhull)
+    double maxAbs = 0.;
+    for (size_t i = 0; i < 3; ++i)
+      maxAbs += std::max(std::abs(lo[i]), std::abs(hi[i]));
+    double const tolerance = 3. * std::numeric_limits<double>::epsilon() * maxAbs;
+
+    // the hull input indices are collected here, and sorted at the end
+    auto const addVertex = [this](size_t p) {
+      if (std::find(_index.begin(), _index.end(), p) == _index.end()) _index.push_back(p);
+    };
+    auto const finishFlat = [this, &pts, &center, &addVertex, tolerance](
+                              std::initializer_list<size_t> ps) {
+      for (size_t p : ps)
+        addVertex(p);
+      std::sort(_index.begin(), _index.end());
+      for (size_t p : _index)
+        _vertices.push_back(pts[p] + center);
+      _tolerance = tolerance;
+    };
+
+    //
+    // initial tetrahedron
+    //
+    // the two farthest of the extreme points along the axes
+    size_t extremes[6];
+    for (size_t i = 0; i < 3; ++i) {
+      extremes[2 * i] = extremes[2 * i + 1] = 0;
+      for (size_t p = 1; p < n; ++p) {
+        if (pts[p][i] < pts[extremes[2 * i]][i]) extremes[2 * i] = p;
+        if (pts[p][i] > pts[extremes[2 * i + 1]][i]) extremes[2 * i + 1] = p;
+      }
+    }
+    size_t i0 = extremes[0], i1 = extremes[1];
+    for (size_t i = 1; i < 3; ++i) {
+      if (pts[extremes[2 * i]].SqDist(pts[extremes[2 * i + 1]]) > pts[i0].SqDist(pts[i1])) {
+        i0 = extremes[2 * i];
+        i1 = extremes[2 * i + 1];
+      }
+    }
+    if (pts[i0].Dist(pts[i1]) <= tolerance) return finishFlat({i0});
+
+    // the farthest point from their line
+    Vector_t const axis = (pts[i1] - pts[i0]).Dir();
+    size_t i2 = i0;
+    double maxDist = 0.;
+    for (size_t p = 0; p < n; ++p) {
+      double const dist = (pts[p] - pts[i0]).Cross(axis).Length();
+      if (dist > maxDist) {
+        maxDist = dist;
+        i2 = p;
+      }
+    }
+    if (maxDist <= tolerance) return finishFlat({i0, i1});
+
+    // the farthest point from their plane
+    Vector_t const normal = (pts[i1] - pts[i0]).Cross(pts[i2] - pts[i0]).Dir();
+    size_t i3 = i0;
+    maxDist = 0.;
+    for (size_t p = 0; p < n; ++p) {
+      double const dist = std::abs((pts[p] - pts[i0]) * normal);
+      if (dist > maxDist) {
+        maxDist = dist;
+        i3 = p;
+      }
+    }
+    if (maxDist <= tolerance) {
+      // the polygon is the 2D hull in the plane, with `u`, `v` and `normal` right-handed
+      Vector_t const v = normal.Cross(axis);
+      ConvexHull2D polygon;
+      polygon.Build(pts.data(), n, axis, v, &scratch);
+      auto const& corners = polygon.Indices();
+      _index.assign(corners.begin(), corners.end());
+      finishFlat({});
+      for (size_t p : corners)
+        _polygon.push_back(std::lower_bound(_index.begin(), _index.end(), p) - _index.begin());
+      _normals.push_back(normal);
+      _offsets.push_back(normal * (pts[i0] + center));
+      return;
+    }
+
+    auto& faces = scratch.faces;
+    faces.clear();
+    size_t const corners[4] = {i0, i1, i2, i3};
+    for (size_t f = 0; f < 4; ++f) {
+      // face `f` is opposite to corner `f`
+      ConvexHullScratch::Face_t face;
+      for (size_t k = 0, c = 0; c < 4; ++c)
+        if (c != f) face.v[k++] = corners[c];
+      SetPlane(face, pts);
+      if (PlaneDist(face, pts[corners[f]]) > 0.) {
+        std::swap(face.v[1], face.v[2]);
+        SetPlane(face, pts);
+      }
+      face.firstOutside = kNone;
+      face.farthest = kNone;
+      face.farthestDist = 0.;
+      face.alive = true;
+      face.visible = false;
+      faces.push_back(face);
+    }
+    // each edge of a face is on the face opposite to the corner not on it
+    for (size_t f = 0; f < 4; ++f) {
+      for (size_t k = 0; k < 3; ++k) {
+        size_t const a = faces[f].v[k], b = faces[f].v[(k + 1) % 3];
+        for (size_t g = 0; g < 4; ++g) {
+          if (g == f) continue;
+          auto const& v = faces[g].v;
+          bool const hasA = (v[0] == a) || (v[1] == a) || (v[2] == a);
+          bool const hasB = (v[0] == b) || (v[1] == b) || (v[2] == b);
+          if (hasA && hasB) faces[f].nb[k] = g;
+        }
+      }
+    }
+
+    scratch.nextOutside.assign(n, kNone);
+    scratch.startOf.resize(n);
+    scratch.endOf.resize(n);
+    std::vector<size_t>& newFaces = scratch.newFaces;
+    newFaces.assign({0, 1, 2, 3});
+    for (size_t p = 0; p < n; ++p) {
+      if (p == i0 || p == i1 || p == i2 || p == i3) continue;
+      AssignOutside(scratch, newFaces, p, tolerance);
+    }
+
+    //
+    // expansion to the farthest outside points
+    //
+    auto& stack = scratch.stack;
+    stack.assign({0, 1, 2, 3});
+    auto& visible = scratch.visible;
+    while (!stack.empty()) {
+      size_t const f = stack.back();
+      stack.pop_back();
+      if (!faces[f].alive || faces[f].firstOutside == kNone) continue;
+      size_t const eye = faces[f].farthest;
+      Point_t const& eyePt = pts[eye];
+
+      // the faces seen from the point are contiguous
+      visible.assign(1, f);
+      faces[f].visible = true;
+      for (size_t i = 0; i < visible.size(); ++i) {
+        for (size_t nb : faces[visible[i]].nb) {
+          auto& face = faces[nb];
+          if (face.visible || PlaneDist(face, eyePt) <= tolerance) continue;
+          face.visible = true;
+          visible.push_back(nb);
+        }
+      }
+
+      // a new face from each edge of the horizon to the point
+      newFaces.clear();
+      for (size_t vf : visible) {
+        for (size_t k = 0; k < 3; ++k) {
+          size_t const nb = faces[vf].nb[k];
+          if (faces[nb].visible) continue;
+          ConvexHullScratch::Face_t face;
+          face.v[0] = faces[vf].v[k];
+          face.v[1] = faces[vf].v[(k + 1) % 3];
+          face.v[2] = eye;
+          face.nb[0] = nb;
+          SetPlane(face, pts);
+          face.firstOutside = kNone;
+          face.farthest = kNone;
+          face.farthestDist = 0.;
+          face.alive = true;
+          face.visible = false;
+          size_t const iFace = faces.size();
+          for (size_t& back : faces[nb].nb)
+            if (back == vf) back = iFace;
+          scratch.startOf[face.v[0]] = iFace;
+          scratch.endOf[face.v[1]] = iFace;
+          faces.push_back(face); // `face` references to `faces` are now invalid
+          newFaces.push_back(iFace);
+        }
+      }
+      for (size_t nf : newFaces) {
+        auto& face = faces[nf];
+        face.nb[1] = scratch.startOf[face.v[1]];
+        face.nb[2] = scratch.endOf[face.v[0]];
+      }
+
+      // the points outside of the visible faces may be outside of the new ones
+      for (size_t vf : visible) {
+        faces[vf].alive = false;
+        faces[vf].visible = false;
+        for (size_t p = faces[vf].firstOutside; p != kNone;) {
+          size_t const next = scratch.nextOutside[p];
+          if (p != eye) AssignOutside(scratch, newFaces, p, tolerance);
+          p = next;
+        }
+      }
+      for (size_t nf : newFaces)
+        if (faces[nf].firstOutside != kNone) stack.push_back(nf);
+    }
+
+    //
+    // result
+    //
+    for (auto const& face : faces) {
+      if (!face.alive) continue;
+      for (size_t p : face.v)
+        addVertex(p);
+    }
+    std::sort(_index.begin(), _index.end());
+    auto& vertexOf = scratch.startOf; // reused
+    for (size_t i = 0; i < _index.size(); ++i) {
+      vertexOf[_index[i]] = i;
+      _vertices.push_back(pts[_index[i]] + center);
+    }
+    for (auto const& face : faces) {
+      if (!face.alive) continue;
+      _faces.push_back({vertexOf[face.v[0]], vertexOf[face.v[1]], vertexOf[face.v[2]]});
+      _normals.push_back(face.normal);
+      _offsets.push_back(face.offset + face.normal * center);
+    }
+    _tolerance = tolerance;
+  }
+
+  double ConvexHull3D::Volume() const
+  {
+    if (_faces.empty()) return 0.;
+    // tetrahedra from a vertex, for precision
+    Point_t const& o = _vertices[0];
+    double volume = 0.;
+    for (auto const& face : _faces) {
+      Vector_t const a = _vertices[face[0]] - o, b = _vertices[face[1]] - o,
+                     c = _vertices[face[2]] - o;
+      volume += a * b.Cross(c);
+    }
+    return volume / 6.;
+  }
+
+  double ConvexHull3D::Area() const
+  {
+    double area = 0.;
+    for (auto const& face : _faces) {
+      Point_t const& a = _vertices[face[0]];
+      area += (_vertices[face[1]] - a).Cross(_vertices[face[2]] - a).Length();
+    }
+    return area / 2.;
+  }
+
+  bool ConvexHull3D::Contain(const Point_t& pt) const
+  {
+    if (_faces.empty()) return _ContainFlat_(pt);
+    for (size_t f = 0; f < _faces.size(); ++f)
+      if (_normals[f] * pt - _offsets[f] > _tolerance) return false;
+    return true;
+  }
+
+  bool ConvexHull3D::_ContainFlat_(const Point_t& pt) const
+  {
+    switch (_vertices.size()) {
+    case 0: return false;
+    case 1: return pt.Dist(_vertices[0]) <= _tolerance;
+    case 2: {
+      // distance from the segment
+      Vector_t const axis = _vertices[1] - _vertices[0];
+      double const t = std::clamp(((pt - _vertices[0]) * axis) / axis.SqLength(), 0., 1.);
+      return pt.Dist(_vertices[0] + axis * t) <= _tolerance;
+    }
+    default: break;
+    }
+    Vector_t const& normal = _normals[0];
+    if (std::abs(normal * pt - _offsets[0]) > _tolerance) return false;
+    // on the inner side of all the edges
+    for (size_t i = 0, j = _polygon.size() - 1; i < _polygon.size(); j = i++) {
+      Point_t const& a = _vertices[_polygon[j]];
+      Vector_t const edge = _vertices[_polygon[i]] - a;
+      if (edge.Cross(pt - a) * normal < -_tolerance * edge.Length()) return false;
+    }
+    return true;
+  }
+
+}
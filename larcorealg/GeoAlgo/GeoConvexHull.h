@@ -0,0 +1,238 @@
+/**
+ * \file GeoConvexHull.h
+ *
+ * \ingroup GeoAlgo
+ *
+ * \brief Class def header for the classes ConvexHull2D and ConvexHull3D
+ */
+
+/** \addtogroup GeoAlgo
+
+    @{*/
+#ifndef BASICTOOL_GEOCONVEXHULL_H
+#define BASICTOOL_GEOCONVEXHULL_H
+
+#include "larcorealg/GeoAlgo/GeoVector.h"
+
+#include <array>
+#include <stddef.h>
+#include <vector>
+
+namespace geoalgo {
+
+  /**
+     \class ConvexHullScratch
+     @brief Working memory of the convex hull constructions.
+     The hulls allocate their working memory on each construction, unless they
+     are given one of these objects, which keeps it for the following ones:
+     after a few constructions on point sets of similar size, building a hull
+     allocates only for its result. The content is an implementation detail.
+     An object must not be used by two constructions at the same time.
+   */
+  struct ConvexHullScratch {
+    /// A face of the 3D hull under construction
+    struct Face_t {
+      size_t v[3];         ///< Points at the corners, counterclockwise from outside
+      size_t nb[3];        ///< Face across the edge from `v[k]` to `v[(k + 1) % 3]`
+      Vector_t normal;     ///< Unit normal, pointing outside
+      double offset;       ///< Position of the plane along `normal`
+      size_t firstOutside; ///< First of the points outside of this face
+      size_t farthest;     ///< The outside point farthest from the face
+      double farthestDist; ///< Distance of `farthest` from the face
+      bool alive;          ///< Whether the face is still part of the hull
+      bool visible;        ///< Whether the face is visible from the current point
+    };
+
+    std::vector<size_t> order;       ///< Point indices, sorted (2D)
+    std::vector<double> s;           ///< First coordinate of the projected points (2D)
+    std::vector<double> t;           ///< Second coordinate of the projected points (2D)
+    std::vector<Point_t> points;     ///< Copy of the points, centered (3D)
+    std::vector<size_t> nextOutside; ///< Next point outside of the same face (3D)
+    std::vector<size_t> startOf;     ///< New face from each horizon vertex (3D)
+    std::vector<size_t> endOf;       ///< New face to each horizon vertex (3D)
+    std::vector<Face_t> faces;       ///< All the faces ever created (3D)
+    std::vector<size_t> stack;       ///< Faces to be processed (3D)
+    std::vector<size_t> visible;     ///< Faces visible from the current point (3D)
+    std::vector<size_t> newFaces;    ///< Faces created from the current point (3D)
+  };
+
+  /**
+     \class ConvexHull2D
+     @brief Convex hull of a set of points in a plane.
+     The hull is built with the monotone chain algorithm in O(n log n), from
+     points given by two coordinates, or from 3D points projected on the plane
+     of two axes. Its vertices are given counterclockwise, starting from the
+     one with the smallest first coordinate; points on the edges of the hull
+     are not vertices. Collinear points make a hull of two vertices, with no
+     area, and a single point one of one vertex.
+     Building again on the same object reuses the memory of its result.
+   */
+  class ConvexHull2D {
+
+  public:
+    /// Default ctor: the hull of no point
+    ConvexHull2D() = default;
+
+    /// Builds the hull of the `n` points (`s[i * stride]`, `t[i * stride]`)
+    void Build(size_t n,
+               const double* s,
+               const double* t,
+               size_t stride = 1,
+               ConvexHullScratch* scratch = nullptr);
+
+    /// Builds the hull of the projections of `n` points on the axes `u` and `v`
+    void Build(const Point_t* pts,
+               size_t n,
+               const Vector_t& u,
+               const Vector_t& v,
+               ConvexHullScratch* scratch = nullptr);
+
+    /// Builds the hull of the projections of the points `pts` on the axes `u` and `v`
+    void Build(const std::vector<Point_t>& pts,
+               const Vector_t& u,
+               const Vector_t& v,
+               ConvexHullScratch* scratch = nullptr)
+    {
+      Build(pts.data(), pts.size(), u, v, scratch);
+    }
+
+    //
+    // Getters
+    //
+    size_t size() const { return _index.size(); } ///< Number of vertices
+    bool empty() const { return _index.empty(); } ///< Whether there is no vertex
+
+    /// Input indices of the vertices, counterclockwise
+    const std::vector<size_t>& Indices() const { return _index; }
+
+    double S(size_t i) const { return _s[i]; } ///< First coordinate of vertex `i`
+    double T(size_t i) const { return _t[i]; } ///< Second coordinate of vertex `i`
+
+    /// The axes of the projection (x and y for hulls built from coordinates)
+    const Vector_t& U() const { return _u; }
+    const Vector_t& V() const { return _v; }
+
+    //
+    // Queries
+    //
+    double Area() const;      ///< Area enclosed by the hull
+    double Perimeter() const; ///< Length of the boundary of the hull
+
+    /// Whether the point (`s`, `t`) is in the hull (boundary included), in O(log n)
+    bool Contain(double s, double t) const;
+
+    /// Whether the projection of `pt` on the axes of the hull is in the hull
+    bool Contain(const Point_t& pt) const { return Contain(pt * _u, pt * _v); }
+
+  protected:
+    /// Builds the hull of the points in `scratch.s` and `scratch.t`
+    void _Build_(ConvexHullScratch& scratch);
+
+    std::vector<size_t> _index; ///< Input index of each vertex
+    std::vector<double> _s;     ///< First coordinate of each vertex
+    std::vector<double> _t;     ///< Second coordinate of each vertex
+    Vector_t _u{1., 0., 0.};    ///< First projection axis
+    Vector_t _v{0., 1., 0.};    ///< Second projection axis
+  };
+
+  /**
+     \class ConvexHull3D
+     @brief Convex hull of a set of points in space.
+     The hull is built with the quickhull algorithm, in O(n log n) on average:
+     starting from a tetrahedron of extreme points, each face is pushed out to
+     the farthest point outside of it, until no point is left outside. Points
+     closer to a face than a tolerance, set by the rounding errors on the
+     coordinates, are considered inside, so coplanar points are not vertices.
+     The faces are triangles, with their vertices counterclockwise as seen
+     from outside; coplanar faces are not merged.
+     Points all on a plane (or fewer than four) make a flat hull, with no face
+     nor volume: its vertices are the ones of the 2D hull of the points in
+     that plane, and Polygon() lists them around the plane normal, which is
+     the only one in Normals(). Collinear points make a flat hull of the two
+     ends of their segment, and equal points one of a single vertex, both
+     with no normal.
+     Building again on the same object reuses the memory of its result.
+   */
+  class ConvexHull3D {
+
+  public:
+    /// A face, as indices of its vertices in Vertices()
+    using Face_t = std::array<size_t, 3>;
+
+    /// Default ctor: the hull of no point
+    ConvexHull3D() = default;
+
+    /// Builds the hull of the `n` points starting at `pts`
+    void Build(const Point_t* pts, size_t n, ConvexHullScratch* scratch = nullptr);
+
+    /// Builds the hull of the points `pts`
+    void Build(const std::vector<Point_t>& pts, ConvexHullScratch* scratch = nullptr)
+    {
+      Build(pts.data(), pts.size(), scratch);
+    }
+
+    /// Builds the hull of the `n` points (`x[i * stride]`, `y[i * stride]`, `z[i * stride]`)
+    void Build(size_t n,
+               const double* x,
+               const double* y,
+               const double* z,
+               size_t stride = 1,
+               ConvexHullScratch* scratch = nullptr);
+
+    //
+    // Getters
+    //
+    /// Input indices of the vertices, increasing
+    const std::vector<size_t>& Indices() const { return _index; }
+
+    /// The vertices, in the order of Indices()
+    const std::vector<Point_t>& Vertices() const { return _vertices; }
+
+    /// The triangular faces, counterclockwise from outside
+    const std::vector<Face_t>& Faces() const { return _faces; }
+
+    /// Unit normal of each face, pointing outside (flat hulls: of their plane, if any)
+    const std::vector<Vector_t>& Normals() const { return _normals; }
+
+    /// Whether the hull has no face (coplanar points)
+    bool IsFlat() const { return _faces.empty(); }
+
+    /// Flat hulls: positions in Vertices() of the boundary, counterclockwise around the normal
+    const std::vector<size_t>& Polygon() const { return _polygon; }
+
+    /// Distance below which a point is considered on a face
+    double Tolerance() const { return _tolerance; }
+
+    //
+    // Queries
+    //
+    double Volume() const; ///< Volume enclosed by the hull
+    double Area() const;   ///< Area of the surface of the hull
+
+    /// Whether `pt` is in the hull, within Tolerance() from its surface (in O(faces));
+    /// for flat hulls, whether it is within Tolerance() from the polygon, segment or point
+    bool Contain(const Point_t& pt) const;
+
+  protected:
+    /// Builds the hull of the `n` points in `scratch.points`
+    void _Build_(size_t n, ConvexHullScratch& scratch);
+
+    /// Contain() for flat hulls
+    bool _ContainFlat_(const Point_t& pt) const;
+
+    std::vector<size_t> _index;     ///< Input index of each vertex
+    std::vector<Point_t> _vertices; ///< The vertices
+    std::vector<Face_t> _faces;     ///< The faces
+    std::vector<Vector_t> _normals; ///< Unit normal of each face
+    std::vector<double> _offsets;   ///< Position of each face plane along its normal
+    std::vector<size_t> _polygon;   ///< Boundary of a flat hull, as positions in `_vertices`
+    double _tolerance = 0.;         ///< Distance below which a point is on a face
+  };
+
+  typedef ConvexHull2D ConvexHull2D_t;
+  typedef ConvexHull3D ConvexHull3D_t;
+
+}
+
+#endif
+/** @} */ // end of doxygen group
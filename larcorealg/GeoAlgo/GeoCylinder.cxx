@@ -1,6 +1,37 @@
 #include "larcorealg/GeoAlgo/GeoCylinder.h"
 #include "larcorealg/GeoAlgo/GeoAlgoException.h"
 
+#include <memory>
+
+namespace {
+
+  /// Cylinder::Contain() of `n` points, computed in `Real` precision
+  template <typename Real>
+  void cylinderContain(const geoalgo::Point_t& pt1,
+                       const geoalgo::Point_t& pt2,
+                       double radius,
+                       size_t n,
+                       const Real* x,
+                       const Real* y,
+                       const Real* z,
+                       bool* mask,
+                       size_t stride)
+  {
+    // axis from pt1 to pt2, projections are scaled by the squared axis length
+    Real const ox = pt1[0], oy = pt1[1], oz = pt1[2];
+    Real const ax = pt2[0] - pt1[0], ay = pt2[1] - pt1[1], az = pt2[2] - pt1[2];
+    Real const a2 = ax * ax + ay * ay + az * az;
+    Real const r2 = Real(radius) * Real(radius);
+    for (size_t i = 0; i < n; ++i) {
+      Real const dx = x[i * stride] - ox, dy = y[i * stride] - oy, dz = z[i * stride] - oz;
+      Real const t = dx * ax + dy * ay + dz * az;
+      Real const radial2 = (dx * dx + dy * dy + dz * dz) - t * t / a2;
+      mask[i] = (t >= Real(0)) & (t <= a2) & (radial2 <= r2);
+    }
+  }
+
+} // local namespace
+
 namespace geoalgo {
 
   Cylinder::Cylinder() : Line(), _radius(0.) {}
@@ -22,36 +53,43 @@ namespace geoalgo {
       throw GeoAlgoException("Cylinder ctor accepts only 3D Point!");
   }
 
+  // The point projects on the axis between its ends, and its distance from the axis is not
+  // larger than the radius; the axis frame is computed once for all the points of a batch
   bool Cylinder::Contain(const Point_t& pt) const
   {
+    bool mask;
+    Contain(1, &pt[0], &pt[1], &pt[2], &mask);
+    return mask;
+  }
 
-    // get a vector that defines the axis of the cylinder
-    Vector_t axis = _pt1 - _pt2;
-    Vector_t dirpt = pt - _pt2;
-
-    // angle of point w.r.t. the axis
-    double angleMin = axis.Angle(dirpt);
-
-    // if the angle is > 90 -> outside -> return
-    if (angleMin > 0.5 * 3.14) return false;
-
-    // revert the axis direction
-    axis = _pt2 - _pt1;
-    dirpt = pt - _pt1;
-    angleMin = axis.Angle(dirpt);
-
-    // if the angle is > 90 -> outside -> return
-    if (angleMin > 0.5 * 3.14) return false;
-
-    // if still here, all that is left to verify is
-    // that the point isn't more than a radius
-    // away from the cylinder axis
-    // 1) make a line corresponding to the axis
-    // 2) get the distance between the point and the line
-    double radial_dist_sq = _geoAlgo.SqDist(*this, pt);
+  void Cylinder::Contain(size_t n,
+                         const double* x,
+                         const double* y,
+                         const double* z,
+                         bool* mask,
+                         size_t stride) const
+  {
+    cylinderContain(_pt1, _pt2, _radius, n, x, y, z, mask, stride);
+  }
 
-    if (radial_dist_sq > _radius * _radius) return false;
+  void Cylinder::Contain(size_t n,
+                         const float* x,
+                         const float* y,
+                         const float* z,
+                         bool* mask,
+                         size_t stride) const
+  {
+    cylinderContain(_pt1, _pt2, _radius, n, x, y, z, mask, stride);
+  }
 
-    return true;
+  std::vector<bool> Cylinder::Contain(const std::vector<double>& x,
+                                      const std::vector<double>& y,
+                                      const std::vector<double>& z) const
+  {
+    if (x.size() != y.size() || x.size() != z.size())
+      throw GeoAlgoException("Cylinder::Contain: coordinate vectors of different size!");
+    std::unique_ptr<bool[]> mask(new bool[x.size()]);
+    Contain(x.size(), x.data(), y.data(), z.data(), mask.get());
+    return std::vector<bool>(mask.get(), mask.get() + x.size());
   }
 }
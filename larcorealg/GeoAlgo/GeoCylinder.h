@@ -18,6 +18,9 @@
 #include "larcorealg/GeoAlgo/GeoLine.h"
 #include "larcorealg/GeoAlgo/GeoVector.h"
 
+#include <stddef.h>
+#include <vector>
+
 namespace geoalgo {
   /**
      \class Cylinder
@@ -50,7 +53,38 @@ namespace geoalgo {
     Cylinder(const Point_t& min, const Vector_t& max, const double radius);
 
     /// Containment evaluation
-    bool Contain(const Point_t& pt) const; ///< Test if a point is contained within the box
+    bool Contain(const Point_t& pt) const; ///< Test if a point is contained within the cylinder
+
+    /// Containment of the `n` points (`x[i]`, `y[i]`, `z[i]`): `mask[i]` is set to Contain()
+    /// (`i * stride` is the index of the coordinates of the point `i` in the arrays)
+    void Contain(size_t n,
+                 const double* x,
+                 const double* y,
+                 const double* z,
+                 bool* mask,
+                 size_t stride = 1) const;
+    /// Containment of the `n` points from the (x, y, z) triplets of `xyz`, the layout of a
+    /// C-ordered array of shape (n, 3) like a NumPy one
+    void Contain(size_t n, const double* xyz, bool* mask) const
+    {
+      Contain(n, xyz, xyz + 1, xyz + 2, mask, 3);
+    }
+    /// Containment of `n` points from float coordinate arrays, computed in float precision
+    void Contain(size_t n,
+                 const float* x,
+                 const float* y,
+                 const float* z,
+                 bool* mask,
+                 size_t stride = 1) const;
+    /// Containment of `n` points from the float (x, y, z) triplets of `xyz`
+    void Contain(size_t n, const float* xyz, bool* mask) const
+    {
+      Contain(n, xyz, xyz + 1, xyz + 2, mask, 3);
+    }
+    /// Containment of the points of coordinates `x`, `y` and `z` (e.g. from Python)
+    std::vector<bool> Contain(const std::vector<double>& x,
+                              const std::vector<double>& y,
+                              const std::vector<double>& z) const;
 
     /// Getters
     double GetRadius() { return _radius; }
@@ -54,7 +54,7 @@ namespace geoalgo {
     DirectedLine(const T& pt, const U& dir) : Line(Point_t(pt), Point_t(pt + dir))
     {}
 
-    Vector_t Dir() const;
+    using Line::Dir; ///< Direction getter
   };
 
   typedef DirectedLine DirectedLine_t;
@@ -36,6 +36,11 @@ namespace geoalgo {
     /// Default destructor
     virtual ~HalfLine(){};
 
+    HalfLine(const HalfLine&) = default;            ///< Copy ctor
+    HalfLine(HalfLine&&) = default;                 ///< Move ctor
+    HalfLine& operator=(const HalfLine&) = default; ///< Copy assignment
+    HalfLine& operator=(HalfLine&&) = default;      ///< Move assignment
+
     /// Alternative ctor (1)
     HalfLine(const double x,
              const double y,
@@ -1,9 +1,11 @@
 #include "larcorealg/GeoAlgo/GeoLine.h"
 #include "larcorealg/GeoAlgo/GeoAlgoException.h"
 
+#include <cmath>
+
 namespace geoalgo {
 
-  Line::Line() : _pt1(3), _pt2(3) {}
+  Line::Line() : _pt1(3), _pt2(3) { DirReset(); }
 
   Line::Line(const double x1,
              const double y1,
@@ -14,22 +16,27 @@ namespace geoalgo {
     : _pt1(x1, y1, z1), _pt2(x2, y2, z2)
   {
     check_and_raise(_pt1, _pt2);
+    DirReset();
   }
 
   Line::Line(const Point_t& pt1, const Point_t& pt2) : _pt1(pt1), _pt2(pt2)
   {
     check_and_raise(pt1, pt2);
+    DirReset();
   }
 
   const Point_t& Line::Pt1() const { return _pt1; }
   const Point_t& Line::Pt2() const { return _pt2; }
 
+  const Vector_t& Line::Dir() const { return _dir; }
+
   void Line::Pt1(const double x, const double y, const double z)
   {
     _pt1[0] = x;
     _pt1[1] = y;
     _pt1[2] = z;
     check_and_raise(_pt1, _pt2);
+    DirReset();
   }
 
   void Line::Pt2(const double x, const double y, const double z)
@@ -38,6 +45,7 @@ namespace geoalgo {
     _pt2[1] = y;
     _pt2[2] = z;
     check_and_raise(_pt1, _pt2);
+    DirReset();
   }
 
   void Line::check_and_raise(const Point_t& p1, const Point_t& p2) const
@@ -50,4 +58,11 @@ namespace geoalgo {
       throw GeoAlgoException("<<check_and_raise>> Two identical points not allowed for Line ctor!");
   }
 
+  void Line::DirReset()
+  {
+    _dir = _pt2 - _pt1;
+    _sqLength = _dir.SqLength();
+    _length = std::sqrt(_sqLength);
+  }
+
 }
@@ -22,7 +22,9 @@ namespace geoalgo {
      @brief Representation of a 3D infinite line.
      Defines an infinite 3D line by having 2 points which completely determine the line
      along which the line extends. It hides the point attributes from users for   \n
-     protecting the dimensionality.
+     protecting the dimensionality. \n
+     The direction from the first to the second point, and their distance, are kept
+     up to date by the setters.
   */
   class Line {
 
@@ -47,8 +49,11 @@ namespace geoalgo {
     //
     // Getters
     //
-    const Point_t& Pt1() const; ///< Start getter
-    const Point_t& Pt2() const; ///< Direction getter
+    const Point_t& Pt1() const;                   ///< Start getter
+    const Point_t& Pt2() const;                   ///< Direction getter
+    const Vector_t& Dir() const;                  ///< Direction (Pt2 - Pt1) getter
+    double SqLength() const { return _sqLength; } ///< Squared distance of the two points
+    double Length() const { return _length; }     ///< Distance of the two points
 
     //
     // Setters
@@ -60,8 +65,14 @@ namespace geoalgo {
     /// Compatibility check
     void check_and_raise(const Point_t& p1, const Point_t& p2) const;
 
-    Point_t _pt1;  ///< First point denoting infinite line
-    Vector_t _pt2; ///< Second point denoting infinite line
+    /// Internal function to reset direction and length
+    void DirReset();
+
+    Point_t _pt1;          ///< First point denoting infinite line
+    Vector_t _pt2;         ///< Second point denoting infinite line
+    Vector_t _dir;         ///< Direction from `_pt1` to `_pt2`
+    double _sqLength = 0.; ///< Squared norm of `_dir`
+    double _length = 0.;   ///< Norm of `_dir`
 
   public:
     //
@@ -78,6 +89,7 @@ namespace geoalgo {
     {
       _pt1 = Point_t(pt1);
       check_and_raise(_pt1, _pt2);
+      DirReset();
     }
 
     /// Pt2 setter template
@@ -86,6 +98,7 @@ namespace geoalgo {
     {
       _pt2 = Vector_t(pt2);
       check_and_raise(_pt1, _pt2);
+      DirReset();
     }
   };
 
@@ -1,6 +1,8 @@
 #include "larcorealg/GeoAlgo/GeoLineSegment.h"
 #include "larcorealg/GeoAlgo/GeoAlgoException.h"
 
+#include <cmath>
+
 namespace geoalgo {
 
   LineSegment::LineSegment() : _start(3), _end(3), _dir(3) { DirReset(); }
@@ -28,7 +30,7 @@ namespace geoalgo {
 
   const Point_t& LineSegment::End() const { return _end; }
 
-  const Vector_t LineSegment::Dir() const { return _dir; }
+  const Vector_t& LineSegment::Dir() const { return _dir; }
 
   void LineSegment::Start(const double x, const double y, const double z)
   {
@@ -46,6 +48,11 @@ namespace geoalgo {
     DirReset();
   }
 
-  void LineSegment::DirReset() { _dir = _end - _start; }
+  void LineSegment::DirReset()
+  {
+    _dir = _end - _start;
+    _sqLength = _dir.SqLength();
+    _length = std::sqrt(_sqLength);
+  }
 
 }
@@ -21,6 +21,8 @@ namespace geoalgo {
      \class LineSegment
      @brief Representation of a simple 3D line segment
      Defines a finite 3D straight line by having the start and end position (Point_t). \n
+     The direction (end minus start) and the length are kept up to date by the setters, \n
+     so that the algorithms using them do not compute them again.
   */
   class LineSegment {
 
@@ -31,6 +33,11 @@ namespace geoalgo {
     /// Default destructor
     virtual ~LineSegment() {}
 
+    LineSegment(const LineSegment&) = default;            ///< Copy ctor
+    LineSegment(LineSegment&&) = default;                 ///< Move ctor
+    LineSegment& operator=(const LineSegment&) = default; ///< Copy assignment
+    LineSegment& operator=(LineSegment&&) = default;      ///< Move assignment
+
     /// Alternative ctor (1)
     LineSegment(const double start_x,
                 const double start_y,
@@ -45,9 +52,11 @@ namespace geoalgo {
     //
     // Getters
     //
-    const Point_t& Start() const; ///< Start getter
-    const Point_t& End() const;   ///< End getter
-    const Vector_t Dir() const;   ///< Direction getter
+    const Point_t& Start() const;                 ///< Start getter
+    const Point_t& End() const;                   ///< End getter
+    const Vector_t& Dir() const;                  ///< Direction (end - start) getter
+    double SqLength() const { return _sqLength; } ///< Squared length getter
+    double Length() const { return _length; }     ///< Length getter
 
     //
     // Setters
@@ -56,10 +65,12 @@ namespace geoalgo {
     void End(const double x, const double y, const double z);   ///< End setter
 
   protected:
-    void DirReset(); ///< Internal function to reset direction
-    Point_t _start;  ///< Start position of a line
-    Point_t _end;    ///< End position of a line
-    Vector_t _dir;   ///< Direction
+    void DirReset();       ///< Internal function to reset direction and length
+    Point_t _start;        ///< Start position of a line
+    Point_t _end;          ///< End position of a line
+    Vector_t _dir;         ///< Direction
+    double _sqLength = 0.; ///< Squared length (squared norm of `_dir`)
+    double _length = 0.;   ///< Length (norm of `_dir`)
 
   public:
     //
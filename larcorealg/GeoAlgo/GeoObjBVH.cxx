@@ -0,0 +1,481 @@
+#include "larcorealg/GeoAlgo/GeoObjBVH.h"
+#include "larcorealg/GeoAlgo/GeoAlgoException.h"
+#include "larcorealg/GeoAlgo/GeoObjCollection.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+  /// Squared distance of `pt` from the box (`lo`, `hi`), null inside
+  double BoxSqDist(const geoalgo::Point_t& pt, const double* lo, const double* hi)
+  {
+    double sqDist = 0.;
+    for (size_t i = 0; i < 3; ++i) {
+      double const d = (pt[i] < lo[i]) ? lo[i] - pt[i] : (pt[i] > hi[i]) ? pt[i] - hi[i] : 0.;
+      sqDist += d * d;
+    }
+    return sqDist;
+  }
+
+  /// Range [`tmin`, `tmax`] of the line of `ray` in the box (`lo`, `hi`) expanded by `margin`;
+  /// returns false if the line misses the box
+  bool SlabRange(const geoalgo::HalfLine_t& ray,
+                 const double* lo,
+                 const double* hi,
+                 double margin,
+                 double& tmin,
+                 double& tmax)
+  {
+    auto const& start = ray.Start();
+    auto const& dir = ray.Dir();
+    tmin = -geoalgo::kMAX_DOUBLE;
+    tmax = geoalgo::kMAX_DOUBLE;
+    for (size_t i = 0; i < 3; ++i) {
+      double const a = lo[i] - margin, b = hi[i] + margin;
+      if (dir[i] == 0.) {
+        // parallel to the slab: the start point must be inside
+        if (start[i] < a || start[i] > b) return false;
+        continue;
+      }
+      double const inv = 1. / dir[i];
+      double t1 = (a - start[i]) * inv, t2 = (b - start[i]) * inv;
+      if (t1 > t2) std::swap(t1, t2);
+      tmin = std::max(tmin, t1);
+      tmax = std::min(tmax, t2);
+      if (tmin > tmax) return false;
+    }
+    return true;
+  }
+
+} // local namespace
+
+namespace geoalgo {
+
+  GeoObjBVH::GeoObjBVH(const GeoObjCollection& coll)
+  {
+    for (auto const& pt : coll.Point())
+      Add(pt);
+    for (auto const& seg : coll.LineSegment())
+      Add(seg);
+    for (size_t i = 0; i < coll.NTrajectories(); ++i)
+      Add(coll.Trajectory(i));
+    for (auto const& box : coll.AABox())
+      Add(box);
+    for (auto const& sphere : coll.Sphere())
+      Add(sphere);
+    Build();
+  }
+
+  void GeoObjBVH::Clear()
+  {
+    _pt_v.clear();
+    _seg_v.clear();
+    _trj_v.clear();
+    _box_v.clear();
+    _sphere_v.clear();
+    _prim.clear();
+    _node.clear();
+    _built = true;
+  }
+
+  void GeoObjBVH::_AddPrim_(const ObjID_t& obj, const Point_t& lo, const Point_t& hi)
+  {
+    Prim_t p;
+    p.obj = obj;
+    for (size_t i = 0; i < 3; ++i) {
+      p.lo[i] = lo[i];
+      p.hi[i] = hi[i];
+    }
+    _prim.push_back(p);
+    _built = false;
+  }
+
+  size_t GeoObjBVH::Add(const Point_t& pt)
+  {
+    if (!pt.IsValid()) throw GeoAlgoException("GeoObjBVH: cannot index an invalid point!");
+    _pt_v.push_back(pt);
+    _AddPrim_({kPoint, _pt_v.size() - 1, 0}, pt, pt);
+    return _pt_v.size() - 1;
+  }
+
+  size_t GeoObjBVH::Add(const LineSegment_t& seg)
+  {
+    _seg_v.push_back(seg);
+    Point_t lo(3), hi(3);
+    for (size_t i = 0; i < 3; ++i) {
+      lo[i] = std::min(seg.Start()[i], seg.End()[i]);
+      hi[i] = std::max(seg.Start()[i], seg.End()[i]);
+    }
+    _AddPrim_({kLineSegment, _seg_v.size() - 1, 0}, lo, hi);
+    return _seg_v.size() - 1;
+  }
+
+  size_t GeoObjBVH::Add(const Trajectory_t& trj)
+  {
+    if (trj.empty()) throw GeoAlgoException("GeoObjBVH: cannot index an empty trajectory!");
+    _trj_v.push_back(trj);
+    size_t const index = _trj_v.size() - 1;
+    // a single point trajectory is a segment with no length
+    size_t const nSegments = (trj.size() > 1) ? trj.size() - 1 : 1;
+    for (size_t s = 0; s < nSegments; ++s) {
+      auto const& a = trj[s];
+      auto const& b = trj[std::min(s + 1, trj.size() - 1)];
+      Point_t lo(3), hi(3);
+      for (size_t i = 0; i < 3; ++i) {
+        lo[i] = std::min(a[i], b[i]);
+        hi[i] = std::max(a[i], b[i]);
+      }
+      _AddPrim_({kTrajectory, index, s}, lo, hi);
+    }
+    return index;
+  }
+
+  size_t GeoObjBVH::Add(const AABox_t& box)
+  {
+    _box_v.push_back(box);
+    _AddPrim_({kAABox, _box_v.size() - 1, 0}, box.Min(), box.Max());
+    return _box_v.size() - 1;
+  }
+
+  size_t GeoObjBVH::Add(const Sphere_t& sphere)
+  {
+    _sphere_v.push_back(sphere);
+    Vector_t const r(sphere.Radius(), sphere.Radius(), sphere.Radius());
+    _AddPrim_({kSphere, _sphere_v.size() - 1, 0}, sphere.Center() - r, sphere.Center() + r);
+    return _sphere_v.size() - 1;
+  }
+
+  void GeoObjBVH::Build()
+  {
+    _node.clear();
+    _built = true;
+    if (_prim.empty()) return;
+    _node.reserve(2 * (_prim.size() / kLeafSize + 1));
+    _BuildNode_(0, _prim.size());
+  }
+
+  void GeoObjBVH::_BuildNode_(size_t begin, size_t end)
+  {
+    // enclosing box, and range of the box centers
+    Node_t node;
+    double cmin[3], cmax[3];
+    for (size_t i = 0; i < 3; ++i) {
+      node.lo[i] = _prim[begin].lo[i];
+      node.hi[i] = _prim[begin].hi[i];
+      cmin[i] = cmax[i] = _prim[begin].lo[i] + _prim[begin].hi[i];
+    }
+    for (size_t p = begin; p < end; ++p) {
+      for (size_t i = 0; i < 3; ++i) {
+        node.lo[i] = std::min(node.lo[i], _prim[p].lo[i]);
+        node.hi[i] = std::max(node.hi[i], _prim[p].hi[i]);
+        double const c = _prim[p].lo[i] + _prim[p].hi[i];
+        cmin[i] = std::min(cmin[i], c);
+        cmax[i] = std::max(cmax[i], c);
+      }
+    }
+
+    size_t const iNode = _node.size();
+    if (end - begin <= kLeafSize) {
+      node.first = begin;
+      node.count = end - begin;
+      _node.push_back(node);
+      return;
+    }
+    node.count = 0;
+    _node.push_back(node);
+
+    // split at the median center along the direction where centers spread most
+    size_t axis = 0;
+    for (size_t i = 1; i < 3; ++i)
+      if (cmax[i] - cmin[i] > cmax[axis] - cmin[axis]) axis = i;
+    size_t const middle = begin + (end - begin) / 2;
+    std::nth_element(_prim.begin() + begin,
+                     _prim.begin() + middle,
+                     _prim.begin() + end,
+                     [axis](Prim_t const& a, Prim_t const& b) {
+                       return (a.lo[axis] + a.hi[axis]) < (b.lo[axis] + b.hi[axis]);
+                     });
+
+    _BuildNode_(begin, middle);
+    _node[iNode].first = _node.size();
+    _BuildNode_(middle, end);
+  }
+
+  void GeoObjBVH::_CheckBuilt_() const
+  {
+    if (!_built) throw GeoAlgoException("GeoObjBVH: Build() must be called after Add()!");
+  }
+
+  LineSegment_t GeoObjBVH::_TrajectorySegment_(size_t i, size_t s) const
+  {
+    auto const& trj = _trj_v[i];
+    return LineSegment_t(trj[s], trj[std::min(s + 1, trj.size() - 1)]);
+  }
+
+  double GeoObjBVH::_SqDist_(const Point_t& pt, const Prim_t& p) const
+  {
+    switch (p.obj.type) {
+    case kPoint: return pt.SqDist(_pt_v[p.obj.index]);
+    case kLineSegment: return _algo.SqDist(pt, _seg_v[p.obj.index]);
+    case kTrajectory: return _algo.SqDist(pt, _TrajectorySegment_(p.obj.index, p.obj.segment));
+    case kAABox: return _algo.SqDist(pt, _box_v[p.obj.index]);
+    case kSphere: {
+      auto const& sphere = _sphere_v[p.obj.index];
+      double const d = pt.Dist(sphere.Center()) - sphere.Radius();
+      return d * d;
+    }
+    default: break;
+    }
+    throw GeoAlgoException("GeoObjBVH: unknown object type!");
+  }
+
+  Point_t GeoObjBVH::_ClosestPt_(const Point_t& pt, const Prim_t& p) const
+  {
+    switch (p.obj.type) {
+    case kPoint: return _pt_v[p.obj.index];
+    case kLineSegment: return _algo.ClosestPt(pt, _seg_v[p.obj.index]);
+    case kTrajectory:
+      return _algo.ClosestPt(pt, _TrajectorySegment_(p.obj.index, p.obj.segment));
+    case kAABox: return _algo.ClosestPt(pt, _box_v[p.obj.index]);
+    case kSphere: {
+      auto const& sphere = _sphere_v[p.obj.index];
+      Vector_t const v = pt - sphere.Center();
+      double const d = v.Length();
+      // any point of the surface is the closest to the center
+      if (d == 0.) return sphere.Center() + Vector_t(sphere.Radius(), 0., 0.);
+      return sphere.Center() + v * (sphere.Radius() / d);
+    }
+    default: break;
+    }
+    throw GeoAlgoException("GeoObjBVH: unknown object type!");
+  }
+
+  double GeoObjBVH::_RayHit_(const HalfLine_t& ray, double radius, const Prim_t& p) const
+  {
+    double const sqRadius = radius * radius;
+    Point_t c1(3), c2(3);
+    switch (p.obj.type) {
+    case kPoint: {
+      auto const& pt = _pt_v[p.obj.index];
+      if (_algo.SqDist(pt, ray) > sqRadius) return kINVALID_DOUBLE;
+      return (_algo.ClosestPt(pt, ray) - ray.Start()) * ray.Dir();
+    }
+    case kLineSegment:
+    case kTrajectory: {
+      double const sqDist =
+        (p.obj.type == kLineSegment) ?
+          _algo.SqDist(ray, _seg_v[p.obj.index], c1, c2) :
+          _algo.SqDist(ray, _TrajectorySegment_(p.obj.index, p.obj.segment), c1, c2);
+      if (sqDist > sqRadius) return kINVALID_DOUBLE;
+      return (c1 - ray.Start()) * ray.Dir();
+    }
+    case kAABox: {
+      double tmin, tmax;
+      if (!SlabRange(ray, p.lo, p.hi, 0., tmin, tmax) || tmax < 0.) return kINVALID_DOUBLE;
+      return (tmin >= 0.) ? tmin : tmax; // from inside, the ray hits on the way out
+    }
+    case kSphere: {
+      auto const& sphere = _sphere_v[p.obj.index];
+      Vector_t const oc = ray.Start() - sphere.Center();
+      double const b = oc * ray.Dir();
+      double const disc = b * b - (oc.SqLength() - sphere.Radius() * sphere.Radius());
+      if (disc < 0.) return kINVALID_DOUBLE;
+      double const s = std::sqrt(disc);
+      if (-b - s >= 0.) return -b - s;
+      if (-b + s >= 0.) return -b + s;
+      return kINVALID_DOUBLE;
+    }
+    default: break;
+    }
+    throw GeoAlgoException("GeoObjBVH: unknown object type!");
+  }
+
+  void GeoObjBVH::_Nearest_(const Point_t& pt, size_t& best, double& bestSq) const
+  {
+    // depth of a tree split at the median is about log2(size / kLeafSize): 64 is plenty
+    size_t stack[64];
+    double stackSq[64];
+    size_t nStack = 0;
+    stack[nStack] = 0;
+    stackSq[nStack++] = BoxSqDist(pt, _node[0].lo, _node[0].hi);
+    while (nStack > 0) {
+      --nStack;
+      if (stackSq[nStack] > bestSq) continue;
+      Node_t const& node = _node[stack[nStack]];
+      if (node.count == 0) {
+        // visit the closer child first (pushed last)
+        size_t const a = stack[nStack] + 1, b = node.first;
+        double const aSq = BoxSqDist(pt, _node[a].lo, _node[a].hi);
+        double const bSq = BoxSqDist(pt, _node[b].lo, _node[b].hi);
+        bool const aFirst = aSq <= bSq;
+        stack[nStack] = aFirst ? b : a;
+        stackSq[nStack++] = aFirst ? bSq : aSq;
+        stack[nStack] = aFirst ? a : b;
+        stackSq[nStack++] = aFirst ? aSq : bSq;
+        continue;
+      }
+      for (size_t i = node.first; i < node.first + node.count; ++i) {
+        if (BoxSqDist(pt, _prim[i].lo, _prim[i].hi) > bestSq) continue;
+        double const sqDist = _SqDist_(pt, _prim[i]);
+        if (sqDist < bestSq) {
+          bestSq = sqDist;
+          best = i;
+        }
+      }
+    }
+  }
+
+  GeoObjBVH::DistHit_t GeoObjBVH::Nearest(const Point_t& pt, double maxDist) const
+  {
+    _CheckBuilt_();
+    DistHit_t hit;
+    if (_prim.empty()) return hit;
+    size_t best = _prim.size();
+    double bestSq = (maxDist == kINVALID_DOUBLE) ? kMAX_DOUBLE : maxDist * maxDist;
+    _Nearest_(pt, best, bestSq);
+    if (best == _prim.size()) return hit;
+    hit.obj = _prim[best].obj;
+    hit.sqDist = bestSq;
+    hit.pt = _ClosestPt_(pt, _prim[best]);
+    return hit;
+  }
+
+  std::vector<GeoObjBVH::DistHit_t> GeoObjBVH::Nearest(const std::vector<Point_t>& pts,
+                                                       double maxDist) const
+  {
+    _CheckBuilt_();
+    std::vector<DistHit_t> hits(pts.size());
+    if (_prim.empty()) return hits;
+    double const maxSq = (maxDist == kINVALID_DOUBLE) ? kMAX_DOUBLE : maxDist * maxDist;
+    size_t previous = _prim.size();
+    for (size_t i = 0; i < pts.size(); ++i) {
+      // the object nearest to the previous point bounds the search
+      size_t best = _prim.size();
+      double bestSq = maxSq;
+      if (previous != _prim.size()) {
+        double const sqDist = _SqDist_(pts[i], _prim[previous]);
+        if (sqDist < bestSq) {
+          bestSq = sqDist;
+          best = previous;
+        }
+      }
+      _Nearest_(pts[i], best, bestSq);
+      if (best == _prim.size()) continue;
+      previous = best;
+      hits[i].obj = _prim[best].obj;
+      hits[i].sqDist = bestSq;
+      hits[i].pt = _ClosestPt_(pts[i], _prim[best]);
+    }
+    return hits;
+  }
+
+  std::vector<GeoObjBVH::DistHit_t> GeoObjBVH::WithinRadius(const Point_t& pt,
+                                                            double radius) const
+  {
+    _CheckBuilt_();
+    std::vector<DistHit_t> hits;
+    if (_prim.empty() || radius < 0.) return hits;
+    double const sqRadius = radius * radius;
+
+    std::vector<std::pair<double, size_t>> found; // (squared distance, primitive)
+    size_t stack[64];
+    size_t nStack = 0;
+    stack[nStack++] = 0;
+    while (nStack > 0) {
+      Node_t const& node = _node[stack[--nStack]];
+      if (BoxSqDist(pt, node.lo, node.hi) > sqRadius) continue;
+      if (node.count == 0) {
+        stack[nStack++] = node.first;
+        stack[nStack++] = static_cast<size_t>(&node - _node.data()) + 1;
+        continue;
+      }
+      for (size_t i = node.first; i < node.first + node.count; ++i) {
+        if (BoxSqDist(pt, _prim[i].lo, _prim[i].hi) > sqRadius) continue;
+        double const sqDist = _SqDist_(pt, _prim[i]);
+        if (sqDist <= sqRadius) found.emplace_back(sqDist, i);
+      }
+    }
+
+    // report each trajectory once, with its closest segment
+    std::sort(found.begin(), found.end());
+    hits.reserve(found.size());
+    std::vector<bool> trjFound(_trj_v.size(), false);
+    for (auto const& f : found) {
+      Prim_t const& p = _prim[f.second];
+      if (p.obj.type == kTrajectory) {
+        if (trjFound[p.obj.index]) continue;
+        trjFound[p.obj.index] = true;
+      }
+      DistHit_t hit;
+      hit.obj = p.obj;
+      hit.sqDist = f.first;
+      hit.pt = _ClosestPt_(pt, p);
+      hits.push_back(hit);
+    }
+    return hits;
+  }
+
+  std::vector<std::vector<GeoObjBVH::DistHit_t>> GeoObjBVH::WithinRadius(
+    const std::vector<Point_t>& pts,
+    double radius) const
+  {
+    std::vector<std::vector<DistHit_t>> hits;
+    hits.reserve(pts.size());
+    for (auto const& pt : pts)
+      hits.push_back(WithinRadius(pt, radius));
+    return hits;
+  }
+
+  GeoObjBVH::RayHit_t GeoObjBVH::RayCast(const HalfLine_t& ray,
+                                         double radius,
+                                         double maxLength) const
+  {
+    _CheckBuilt_();
+    RayHit_t hit;
+    if (_prim.empty()) return hit;
+    double const margin = std::max(radius, 0.);
+
+    size_t best = _prim.size();
+    double bestT = kMAX_DOUBLE; // no hit (`_RayHit_()` returns the same) or farther hit
+    size_t stack[64];
+    size_t nStack = 0;
+    stack[nStack++] = 0;
+    while (nStack > 0) {
+      Node_t const& node = _node[stack[--nStack]];
+      double tmin, tmax;
+      if (!SlabRange(ray, node.lo, node.hi, margin, tmin, tmax)) continue;
+      if (tmax < 0. || tmin > std::min(bestT, maxLength)) continue;
+      if (node.count == 0) {
+        stack[nStack++] = node.first;
+        stack[nStack++] = static_cast<size_t>(&node - _node.data()) + 1;
+        continue;
+      }
+      for (size_t i = node.first; i < node.first + node.count; ++i) {
+        if (!SlabRange(ray, _prim[i].lo, _prim[i].hi, margin, tmin, tmax)) continue;
+        if (tmax < 0. || tmin > std::min(bestT, maxLength)) continue;
+        double const t = _RayHit_(ray, margin, _prim[i]);
+        if (t > maxLength || t >= bestT) continue;
+        bestT = t;
+        best = i;
+      }
+    }
+    if (best == _prim.size()) return hit;
+    hit.obj = _prim[best].obj;
+    hit.t = bestT;
+    hit.pt = ray.Start() + ray.Dir() * bestT;
+    return hit;
+  }
+
+  std::vector<GeoObjBVH::RayHit_t> GeoObjBVH::RayCast(const std::vector<HalfLine_t>& rays,
+                                                      double radius,
+                                                      double maxLength) const
+  {
+    std::vector<RayHit_t> hits;
+    hits.reserve(rays.size());
+    for (auto const& ray : rays)
+      hits.push_back(RayCast(ray, radius, maxLength));
+    return hits;
+  }
+
+}
@@ -0,0 +1,209 @@
+/**
+ * \file GeoObjBVH.h
+ *
+ * \ingroup GeoAlgo
+ *
+ * \brief Class def header for a class GeoObjBVH
+ */
+
+/** \addtogroup GeoAlgo
+
+    @{*/
+#ifndef BASICTOOL_GEOOBJBVH_H
+#define BASICTOOL_GEOOBJBVH_H
+
+#include "larcorealg/GeoAlgo/GeoAABox.h"
+#include "larcorealg/GeoAlgo/GeoAlgo.h"
+#include "larcorealg/GeoAlgo/GeoAlgoConstants.h"
+#include "larcorealg/GeoAlgo/GeoHalfLine.h"
+#include "larcorealg/GeoAlgo/GeoLineSegment.h"
+#include "larcorealg/GeoAlgo/GeoSphere.h"
+#include "larcorealg/GeoAlgo/GeoTrajectory.h"
+#include "larcorealg/GeoAlgo/GeoVector.h"
+
+#include <stddef.h>
+#include <vector>
+
+namespace geoalgo {
+
+  class GeoObjCollection;
+
+  /**
+     \class GeoObjBVH
+     @brief Bounding volume hierarchy over a set of geometrical objects.
+     The objects (points, line segments, trajectories, AABoxes and spheres)
+     are added, then Build() arranges them in a binary tree of boxes aligned
+     with the axes, each leaf holding a few of them; a trajectory is indexed
+     segment by segment. The queries only visit the branches of the tree that
+     may hold an object closer than the best found so far (Nearest()), closer
+     than a radius (WithinRadius()) or crossed by a ray (RayCast()), returning
+     the same results as the loop on all the objects with GeoAlgo.
+
+     The distances are the ones from GeoAlgo::SqDist(): in particular, for a
+     point inside an AABox it is the distance to its closest wall, and for a
+     sphere the distance to its surface. A ray hits AABoxes and spheres on
+     their surface, and points, line segments and trajectories if it passes
+     within a given radius from them.
+     The half lines and cones of a GeoObjCollection are not indexed.
+     The batched queries take many points or rays at once; Nearest() starts
+     each search from the object found for the previous point, which speeds
+     up sequences of close points, like the hits along a track.
+   */
+  class GeoObjBVH {
+
+  public:
+    /// Type of an indexed object
+    enum ObjType_t { kPoint, kLineSegment, kTrajectory, kAABox, kSphere, kNoObject };
+
+    /// Identifier of an object: its type and its index among those of that type
+    struct ObjID_t {
+      ObjType_t type = kNoObject; ///< Type of the object
+      size_t index = 0;           ///< Index of the object among the ones of its type
+      size_t segment = 0;         ///< Trajectories: closest segment (starting at this point)
+
+      bool IsValid() const { return type != kNoObject; } ///< Whether an object is identified
+    };
+
+    /// Result of a distance query
+    struct DistHit_t {
+      ObjID_t obj;                   ///< The object
+      double sqDist = kINVALID_DOUBLE; ///< Squared distance of the object from the point
+      Point_t pt;                    ///< Closest point on the object (GeoAlgo::ClosestPt())
+    };
+
+    /// Result of a ray cast
+    struct RayHit_t {
+      ObjID_t obj;              ///< The object hit first
+      double t = kINVALID_DOUBLE; ///< Distance of the hit along the ray from its start
+      Point_t pt;               ///< Point hit on the ray
+    };
+
+    /// Default ctor: no object
+    GeoObjBVH() = default;
+
+    /// Ctor indexing the points, segments, trajectories, boxes and spheres of `coll`
+    explicit GeoObjBVH(const GeoObjCollection& coll);
+
+    /// Removes all the objects
+    void Clear();
+
+    //
+    // Objects (Build() must be called after adding)
+    //
+    size_t Add(const Point_t& pt);         ///< Adds a point; returns its index
+    size_t Add(const LineSegment_t& seg);  ///< Adds a line segment; returns its index
+    size_t Add(const Trajectory_t& trj);   ///< Adds a trajectory; returns its index
+    size_t Add(const AABox_t& box);        ///< Adds an AABox; returns its index
+    size_t Add(const Sphere_t& sphere);    ///< Adds a sphere; returns its index
+
+    /// Builds the tree of the objects added so far
+    void Build();
+
+    /// Whether the tree includes all the objects added
+    bool IsBuilt() const { return _built; }
+
+    /// Number of indexed primitives (trajectory segments counted separately)
+    size_t size() const { return _prim.size(); }
+
+    const std::vector<Point_t>& Point() const { return _pt_v; }             ///< Points
+    const std::vector<LineSegment_t>& LineSegment() const { return _seg_v; } ///< Segments
+    const std::vector<Trajectory_t>& Trajectory() const { return _trj_v; }  ///< Trajectories
+    const std::vector<AABox_t>& AABox() const { return _box_v; }            ///< AABoxes
+    const std::vector<Sphere_t>& Sphere() const { return _sphere_v; }       ///< Spheres
+
+    //
+    // Queries
+    //
+    /// Closest object to `pt`, if closer than `maxDist` (otherwise the hit is invalid)
+    DistHit_t Nearest(const Point_t& pt, double maxDist = kINVALID_DOUBLE) const;
+
+    /// All objects within `radius` from `pt`, sorted by increasing distance
+    std::vector<DistHit_t> WithinRadius(const Point_t& pt, double radius) const;
+
+    /**
+       First object hit by `ray` within `maxLength` from its start (invalid if none);
+       points, segments and trajectories are hit when the ray passes within
+       `radius` from them, at the closest approach point on the ray.
+    */
+    RayHit_t RayCast(const HalfLine_t& ray,
+                     double radius = 0.,
+                     double maxLength = kINVALID_DOUBLE) const;
+
+    //
+    // Batched queries
+    //
+    /// Nearest() of each point
+    std::vector<DistHit_t> Nearest(const std::vector<Point_t>& pts,
+                                   double maxDist = kINVALID_DOUBLE) const;
+
+    /// WithinRadius() of each point
+    std::vector<std::vector<DistHit_t>> WithinRadius(const std::vector<Point_t>& pts,
+                                                     double radius) const;
+
+    /// RayCast() of each ray
+    std::vector<RayHit_t> RayCast(const std::vector<HalfLine_t>& rays,
+                                  double radius = 0.,
+                                  double maxLength = kINVALID_DOUBLE) const;
+
+  protected:
+    /// An indexed primitive and its bounding box
+    struct Prim_t {
+      ObjID_t obj;  ///< The object (for trajectories, with the segment)
+      double lo[3]; ///< Lower corner of the bounding box
+      double hi[3]; ///< Upper corner of the bounding box
+    };
+
+    /// A node of the tree
+    struct Node_t {
+      double lo[3]; ///< Lower corner of the box enclosing all the node primitives
+      double hi[3]; ///< Upper corner of the box enclosing all the node primitives
+      /// Leaves: first primitive in `_prim`; others: index of the second child
+      /// (the first child immediately follows its parent)
+      size_t first;
+      size_t count; ///< Number of primitives in a leaf, `0` for other nodes
+    };
+
+    /// Largest number of primitives in a leaf
+    static const size_t kLeafSize = 4;
+
+    /// Adds the node of the primitives in [`begin`, `end`[ and its children
+    void _BuildNode_(size_t begin, size_t end);
+
+    /// Throws if the tree does not include all the objects
+    void _CheckBuilt_() const;
+
+    /// Squared distance of `pt` from the primitive `p`
+    double _SqDist_(const Point_t& pt, const Prim_t& p) const;
+
+    /// Closest point to `pt` on the primitive `p`
+    Point_t _ClosestPt_(const Point_t& pt, const Prim_t& p) const;
+
+    /// Distance along `ray` of its hit on `p` (`kINVALID_DOUBLE` if none)
+    double _RayHit_(const HalfLine_t& ray, double radius, const Prim_t& p) const;
+
+    /// Nearest primitive search, starting from the closest one `best` at `bestSq`
+    void _Nearest_(const Point_t& pt, size_t& best, double& bestSq) const;
+
+    /// The segment `s` of trajectory `i`
+    LineSegment_t _TrajectorySegment_(size_t i, size_t s) const;
+
+    /// Adds the primitive of object `obj` with the bounding box (`lo`, `hi`)
+    void _AddPrim_(const ObjID_t& obj, const Point_t& lo, const Point_t& hi);
+
+    std::vector<Point_t> _pt_v;        ///< Points
+    std::vector<LineSegment_t> _seg_v; ///< Line segments
+    std::vector<Trajectory_t> _trj_v;  ///< Trajectories
+    std::vector<AABox_t> _box_v;       ///< AABoxes
+    std::vector<Sphere_t> _sphere_v;   ///< Spheres
+
+    std::vector<Prim_t> _prim; ///< Primitives, sorted by leaf after Build()
+    std::vector<Node_t> _node; ///< Nodes of the tree; the first is the root
+    bool _built = true;        ///< Whether the tree includes all the primitives
+
+    GeoAlgo _algo; ///< Distance algorithms
+  };
+
+}
+
+#endif
+/** @} */ // end of doxygen group
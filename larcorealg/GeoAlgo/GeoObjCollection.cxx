@@ -3,6 +3,8 @@
 
 #include "TString.h" // for Form
 
+#include <algorithm> // for std::find()
+#include <limits>
 #include <utility>
 
 namespace geoalgo {
@@ -12,10 +14,11 @@ namespace geoalgo {
     _pt_v.clear();
     _box_v.clear();
     _seg_v.clear();
-    _trj_v.clear();
+    _trj_pts.clear();
+    _trj_offsets.assign(1, 0);
     _lin_v.clear();
     _cone_v.clear();
-    //_sphere_v.clear();
+    _sphere_v.clear();
     _pt_col.clear();
     _box_col.clear();
     _seg_col.clear();
@@ -41,12 +44,33 @@ namespace geoalgo {
     }
   }
 
+  GeoObjCollection::ColorIndex_t GeoObjCollection::_ColorIndex_(const std::string& c)
+  {
+    // palettes are short: a linear search is faster than hashing the name
+    auto const iter = std::find(_palette.begin(), _palette.end(), c);
+    if (iter != _palette.end()) return static_cast<ColorIndex_t>(iter - _palette.begin());
+    if (_palette.size() > std::numeric_limits<ColorIndex_t>::max())
+      throw GeoAlgoException("GeoObjCollection: too many different colors!");
+    _palette.push_back(c);
+    return static_cast<ColorIndex_t>(_palette.size() - 1);
+  }
+
+  std::vector<std::string> GeoObjCollection::_ColorNames_(
+    const std::vector<ColorIndex_t>& indices) const
+  {
+    std::vector<std::string> names;
+    names.reserve(indices.size());
+    for (auto const index : indices)
+      names.push_back(_palette[index]);
+    return names;
+  }
+
   void GeoObjCollection::Add(const Point_t& pt, std::string name, std::string c)
   {
     if (name.empty()) name = Form("Pt (%zu)", _pt_v.size());
     _AddLabel_(pt, name);
     _pt_v.push_back(pt);
-    _pt_col.push_back(c);
+    _pt_col.push_back(_ColorIndex_(c));
   }
 
   void GeoObjCollection::Add(const AABox_t& box, std::string name, std::string c)
@@ -54,7 +78,7 @@ namespace geoalgo {
     if (name.empty()) name = Form("AABox (%zu)", _box_v.size());
     _AddLabel_(box.Min() + (box.Max() - box.Min()) / 2., name);
     _box_v.push_back(box);
-    _box_col.push_back(c);
+    _box_col.push_back(_ColorIndex_(c));
   }
 
   void GeoObjCollection::Add(const LineSegment_t& seg, std::string name, std::string c)
@@ -62,7 +86,7 @@ namespace geoalgo {
     if (name.empty()) name = Form("LSeg (%zu)", _seg_v.size());
     _AddLabel_(seg.End(), name);
     _seg_v.push_back(seg);
-    _seg_col.push_back(c);
+    _seg_col.push_back(_ColorIndex_(c));
   }
 
   void GeoObjCollection::Add(const HalfLine_t& lin, std::string name, std::string c)
@@ -70,18 +94,15 @@ namespace geoalgo {
     if (name.empty()) name = Form("Line (%zu)", _lin_v.size());
     _AddLabel_(lin.Start() + lin.Start() * 10, name);
     _lin_v.push_back(lin);
-    _lin_col.push_back(c);
+    _lin_col.push_back(_ColorIndex_(c));
   }
 
   void GeoObjCollection::Add(const Trajectory_t& trj, std::string name, std::string c)
   {
     if (trj.size() < 2) throw GeoAlgoException("Trajectory size cannot be smaller than 2!");
-    if (name.empty()) name = Form("Trj (%zu)", _trj_v.size());
+    if (name.empty()) name = Form("Trj (%zu)", NTrajectories());
     _AddLabel_(trj.back(), name);
-    _trj_v.push_back(trj);
-    _trj_col.push_back(c);
-
-    return;
+    AddTrajectory(trj.data(), trj.size(), c);
   }
 
   void GeoObjCollection::Add(const Cone_t& cone, std::string name, std::string c)
@@ -89,7 +110,7 @@ namespace geoalgo {
     if (name.empty()) name = Form("Cone (%zu)", _cone_v.size());
     _AddLabel_(cone.Start() + cone.Dir() * cone.Length(), name);
     _cone_v.push_back(cone);
-    _cone_col.push_back(c);
+    _cone_col.push_back(_ColorIndex_(c));
   }
 
   void GeoObjCollection::Add(const Sphere_t& sphere, std::string name, std::string c)
@@ -97,7 +118,58 @@ namespace geoalgo {
     if (name.empty()) name = Form("Sphere (%zu)", _sphere_v.size());
     _AddLabel_(sphere.Center(), name);
     _sphere_v.push_back(sphere);
-    _sphere_col.push_back(c);
+    _sphere_col.push_back(_ColorIndex_(c));
+  }
+
+  void GeoObjCollection::AddPoints(const Point_t* pts, size_t n, const std::string& c)
+  {
+    _pt_v.insert(_pt_v.end(), pts, pts + n);
+    _pt_col.insert(_pt_col.end(), n, _ColorIndex_(c));
+  }
+
+  void GeoObjCollection::AddPoints(const double* xyz, size_t n, const std::string& c)
+  {
+    _pt_v.reserve(_pt_v.size() + n);
+    for (size_t i = 0; i < n; ++i, xyz += 3)
+      _pt_v.emplace_back(xyz[0], xyz[1], xyz[2]);
+    _pt_col.insert(_pt_col.end(), n, _ColorIndex_(c));
+  }
+
+  void GeoObjCollection::AddLineSegments(const LineSegment_t* segs,
+                                         size_t n,
+                                         const std::string& c)
+  {
+    _seg_v.insert(_seg_v.end(), segs, segs + n);
+    _seg_col.insert(_seg_col.end(), n, _ColorIndex_(c));
+  }
+
+  void GeoObjCollection::AddAABoxes(const AABox_t* boxes, size_t n, const std::string& c)
+  {
+    _box_v.insert(_box_v.end(), boxes, boxes + n);
+    _box_col.insert(_box_col.end(), n, _ColorIndex_(c));
+  }
+
+  void GeoObjCollection::AddTrajectory(const Point_t* pts, size_t n, const std::string& c)
+  {
+    if (n < 2) throw GeoAlgoException("Trajectory size cannot be smaller than 2!");
+    _trj_pts.insert(_trj_pts.end(), pts, pts + n);
+    _trj_offsets.push_back(_trj_pts.size());
+    _trj_col.push_back(_ColorIndex_(c));
+  }
+
+  Trajectory_t GeoObjCollection::Trajectory(size_t i) const
+  {
+    return Trajectory_t(std::vector<Point_t>(_trj_pts.begin() + _trj_offsets[i],
+                                             _trj_pts.begin() + _trj_offsets[i + 1]));
+  }
+
+  std::vector<Trajectory_t> GeoObjCollection::Trajectory() const
+  {
+    std::vector<Trajectory_t> trjs;
+    trjs.reserve(NTrajectories());
+    for (size_t i = 0; i < NTrajectories(); ++i)
+      trjs.push_back(Trajectory(i));
+    return trjs;
   }
 
 }
@@ -22,6 +22,7 @@
 #include "larcorealg/GeoAlgo/GeoTrajectory.h"
 #include "larcorealg/GeoAlgo/GeoVector.h"
 
+#include <cstdint>
 #include <map>
 #include <stddef.h>
 #include <string>
@@ -31,10 +32,28 @@ namespace geoalgo {
 
   /**
      \class GeoObjCollection
-  */
+     A collection of geometrical objects to be drawn, each with a color, and
+     labels by position.
+     The colors are stored as indices in a palette of color names, which is
+     filled as new names are used (index `0` is the empty name, "no color"):
+     `Palette()` and the `...ColorIndex()` lists give them without copies.
+     The points of all the trajectories are stored contiguously
+     (`TrajectoryPoints()` and `TrajectoryOffsets()`).
+
+     Up to class version 10 the `...Color()` lists and `Trajectory()` returned
+     references to stored data members; they now build and return copies at
+     each call, and are deprecated in favour of the accessors above.
+     The bulk `Add...()` functions add many objects of the same color in one
+     call and give them no label, since the labels (one string per object)
+     are most of the memory of a large collection.
+   */
   class GeoObjCollection {
 
   public:
+    /// Type of index of a color in the palette
+    using ColorIndex_t = std::uint16_t;
+
+    /// Removes all the objects and labels; the palette is kept
     void Clear();
 
     void Add(const Point_t& pt, std::string label = "", std::string c = "");
@@ -51,26 +70,96 @@ namespace geoalgo {
 
     void Add(const Sphere_t& sphere, std::string label = "", std::string c = "");
 
+    //
+    // Bulk additions, with no label
+    //
+    /// Adds `n` points from `pts`, all with color `c`
+    void AddPoints(const Point_t* pts, size_t n, const std::string& c = "");
+    /// Adds the points from `pts`, all with color `c`
+    void AddPoints(const std::vector<Point_t>& pts, const std::string& c = "")
+    {
+      AddPoints(pts.data(), pts.size(), c);
+    }
+    /// Adds `n` points from the coordinate array `xyz` (`x`, `y`, `z` of each), with color `c`
+    void AddPoints(const double* xyz, size_t n, const std::string& c = "");
+
+    /// Adds `n` line segments from `segs`, all with color `c`
+    void AddLineSegments(const LineSegment_t* segs, size_t n, const std::string& c = "");
+    /// Adds the line segments from `segs`, all with color `c`
+    void AddLineSegments(const std::vector<LineSegment_t>& segs, const std::string& c = "")
+    {
+      AddLineSegments(segs.data(), segs.size(), c);
+    }
+
+    /// Adds `n` boxes from `boxes`, all with color `c`
+    void AddAABoxes(const AABox_t* boxes, size_t n, const std::string& c = "");
+    /// Adds the boxes from `boxes`, all with color `c`
+    void AddAABoxes(const std::vector<AABox_t>& boxes, const std::string& c = "")
+    {
+      AddAABoxes(boxes.data(), boxes.size(), c);
+    }
+
+    /// Adds the trajectory of the `n` points from `pts` (at least 2), with color `c`
+    void AddTrajectory(const Point_t* pts, size_t n, const std::string& c = "");
+
+    //
+    // Getters
+    //
     const std::vector<geoalgo::Point_t>& Point() const { return _pt_v; }
-    const std::vector<std::string>& PointColor() const { return _pt_col; }
+    const std::vector<ColorIndex_t>& PointColorIndex() const { return _pt_col; }
+    /// @deprecated Copies the names: use `PointColorIndex()` and `Palette()`
+    [[deprecated("use PointColorIndex() and Palette()")]]
+    std::vector<std::string> PointColor() const { return _ColorNames_(_pt_col); }
 
     const std::vector<geoalgo::AABox_t>& AABox() const { return _box_v; }
-    const std::vector<std::string>& AABoxColor() const { return _box_col; }
+    const std::vector<ColorIndex_t>& AABoxColorIndex() const { return _box_col; }
+    /// @deprecated Copies the names: use `AABoxColorIndex()` and `Palette()`
+    [[deprecated("use AABoxColorIndex() and Palette()")]]
+    std::vector<std::string> AABoxColor() const { return _ColorNames_(_box_col); }
 
     const std::vector<geoalgo::LineSegment_t>& LineSegment() const { return _seg_v; }
-    const std::vector<std::string>& LineSegmentColor() const { return _seg_col; }
+    const std::vector<ColorIndex_t>& LineSegmentColorIndex() const { return _seg_col; }
+    /// @deprecated Copies the names: use `LineSegmentColorIndex()` and `Palette()`
+    [[deprecated("use LineSegmentColorIndex() and Palette()")]]
+    std::vector<std::string> LineSegmentColor() const { return _ColorNames_(_seg_col); }
 
     const std::vector<geoalgo::HalfLine_t>& HalfLine() const { return _lin_v; }
-    const std::vector<std::string>& HalfLineColor() const { return _lin_col; }
-
-    const std::vector<geoalgo::Trajectory_t>& Trajectory() const { return _trj_v; }
-    const std::vector<std::string>& TrajectoryColor() const { return _trj_col; }
+    const std::vector<ColorIndex_t>& HalfLineColorIndex() const { return _lin_col; }
+    /// @deprecated Copies the names: use `HalfLineColorIndex()` and `Palette()`
+    [[deprecated("use HalfLineColorIndex() and Palette()")]]
+    std::vector<std::string> HalfLineColor() const { return _ColorNames_(_lin_col); }
+
+    /// Number of trajectories
+    size_t NTrajectories() const { return _trj_col.size(); }
+    /// @deprecated Copies all the trajectories: use `Trajectory(i)`,
+    ///             or `TrajectoryPoints()` and `TrajectoryOffsets()`
+    [[deprecated("use Trajectory(i), or TrajectoryPoints() and TrajectoryOffsets()")]]
+    std::vector<geoalgo::Trajectory_t> Trajectory() const;
+    /// Copy of the trajectory `i` (no range check)
+    geoalgo::Trajectory_t Trajectory(size_t i) const;
+    /// The points of all the trajectories, one trajectory after the other
+    const std::vector<geoalgo::Point_t>& TrajectoryPoints() const { return _trj_pts; }
+    /// Index in `TrajectoryPoints()` of the first point of each trajectory, and the end
+    const std::vector<size_t>& TrajectoryOffsets() const { return _trj_offsets; }
+    const std::vector<ColorIndex_t>& TrajectoryColorIndex() const { return _trj_col; }
+    /// @deprecated Copies the names: use `TrajectoryColorIndex()` and `Palette()`
+    [[deprecated("use TrajectoryColorIndex() and Palette()")]]
+    std::vector<std::string> TrajectoryColor() const { return _ColorNames_(_trj_col); }
 
     const std::vector<geoalgo::Cone_t>& Cone() const { return _cone_v; }
-    const std::vector<std::string>& ConeColor() const { return _cone_col; }
+    const std::vector<ColorIndex_t>& ConeColorIndex() const { return _cone_col; }
+    /// @deprecated Copies the names: use `ConeColorIndex()` and `Palette()`
+    [[deprecated("use ConeColorIndex() and Palette()")]]
+    std::vector<std::string> ConeColor() const { return _ColorNames_(_cone_col); }
 
     const std::vector<geoalgo::Sphere_t>& Sphere() const { return _sphere_v; }
-    const std::vector<std::string>& SphereColor() const { return _sphere_col; }
+    const std::vector<ColorIndex_t>& SphereColorIndex() const { return _sphere_col; }
+    /// @deprecated Copies the names: use `SphereColorIndex()` and `Palette()`
+    [[deprecated("use SphereColorIndex() and Palette()")]]
+    std::vector<std::string> SphereColor() const { return _ColorNames_(_sphere_col); }
+
+    /// The names of the colors, by index
+    const std::vector<std::string>& Palette() const { return _palette; }
 
     const std::map<geoalgo::Point_t, std::string>& Labels() const { return _labels; }
 
@@ -81,7 +170,8 @@ namespace geoalgo {
 
     const LineSegment_t& _LineSegment_(size_t i) const { return _seg_v[i]; }
 
-    const Trajectory_t& _Trajectory_(size_t i) const { return _trj_v[i]; }
+    /// Copy of the trajectory `i` (it returned a reference up to class version 10)
+    Trajectory_t _Trajectory_(size_t i) const { return Trajectory(i); }
 
     const Cone_t& _Cone_(size_t i) const { return _cone_v[i]; }
 
@@ -89,20 +179,28 @@ namespace geoalgo {
 
     void _AddLabel_(const Point_t& pt, std::string label);
 
+    /// Returns the index of the color `c` in the palette, adding it if new
+    ColorIndex_t _ColorIndex_(const std::string& c);
+
+    /// Returns the names of the colors with the specified indices
+    std::vector<std::string> _ColorNames_(const std::vector<ColorIndex_t>& indices) const;
+
     std::vector<geoalgo::Point_t> _pt_v;
-    std::vector<std::string> _pt_col;
+    std::vector<ColorIndex_t> _pt_col;
     std::vector<geoalgo::AABox_t> _box_v;
-    std::vector<std::string> _box_col;
+    std::vector<ColorIndex_t> _box_col;
     std::vector<geoalgo::LineSegment_t> _seg_v;
-    std::vector<std::string> _seg_col;
+    std::vector<ColorIndex_t> _seg_col;
     std::vector<geoalgo::HalfLine_t> _lin_v;
-    std::vector<std::string> _lin_col;
-    std::vector<geoalgo::Trajectory_t> _trj_v;
-    std::vector<std::string> _trj_col;
+    std::vector<ColorIndex_t> _lin_col;
+    std::vector<geoalgo::Point_t> _trj_pts;
+    std::vector<size_t> _trj_offsets{0};
+    std::vector<ColorIndex_t> _trj_col;
     std::vector<geoalgo::Cone_t> _cone_v;
-    std::vector<std::string> _cone_col;
+    std::vector<ColorIndex_t> _cone_col;
     std::vector<geoalgo::Sphere> _sphere_v;
-    std::vector<std::string> _sphere_col;
+    std::vector<ColorIndex_t> _sphere_col;
+    std::vector<std::string> _palette{""};
     std::map<geoalgo::Point_t, std::string> _labels;
   };
 
@@ -0,0 +1,75 @@
+#include "larcorealg/GeoAlgo/GeoPackedTrajectory.h"
+#include "larcorealg/GeoAlgo/GeoAlgoException.h"
+
+#include <algorithm>
+#include <sstream>
+
+namespace geoalgo {
+
+  PackedTrajectory::PackedTrajectory(const Trajectory_t& trj) : _pts(trj.begin(), trj.end())
+  {
+    size_t const nSegments = _pts.empty() ? 0 : _pts.size() - 1;
+    _segment.reserve(nSegments);
+    _unitDir.reserve(nSegments);
+    _segLength.reserve(nSegments);
+    _pathLength.reserve(_pts.size());
+
+    if (!_pts.empty()) _pathLength.push_back(0.);
+    for (size_t i = 0; i < nSegments; ++i) {
+      Vector_t const segment = _pts[i + 1] - _pts[i];
+      double const length = segment.Length();
+      _segment.push_back(segment);
+      _unitDir.push_back(length > 0. ? segment / length : Vector_t(0., 0., 0.));
+      _segLength.push_back(length);
+      _pathLength.push_back(_pathLength.back() + length);
+    }
+  }
+
+  double PackedTrajectory::Length(size_t start_step, size_t end_step) const
+  {
+
+    if (end_step == 0)
+      end_step = size() - 1; // By default end_step is 0. Then consider the whole trajectory()
+
+    // Sanity checks
+    if (start_step >= end_step) throw GeoAlgoException("Cannot have start step >= end step!");
+
+    if (end_step >= size()) throw GeoAlgoException("Requested step index bigger than size!");
+
+    return _pathLength[end_step] - _pathLength[start_step];
+  }
+
+  const Vector_t& PackedTrajectory::Dir(size_t i) const
+  {
+
+    if (size() < (i + 2)) {
+      std::ostringstream msg;
+      msg << "<<" << __FUNCTION__ << ">>"
+          << " length=" << size() << " is too short to find a direction @ index=" << i << std::endl;
+      throw GeoAlgoException(msg.str());
+    }
+    return _segment[i];
+  }
+
+  size_t PackedTrajectory::SegmentAt(double pathLength) const
+  {
+
+    if (size() < 2) throw GeoAlgoException("<<SegmentAt>> trajectory has no segment!");
+
+    // first point further than pathLength, ends excluded
+    auto const next = std::upper_bound(_pathLength.begin() + 1, _pathLength.end() - 1, pathLength);
+    return (next - _pathLength.begin()) - 1;
+  }
+
+  Point_t PackedTrajectory::PointAt(double pathLength) const
+  {
+
+    if (empty()) throw GeoAlgoException("<<PointAt>> trajectory has no point!");
+    if (size() == 1) return _pts.front();
+
+    size_t const i = SegmentAt(pathLength);
+    double const t = std::min(std::max(pathLength - _pathLength[i], 0.), _segLength[i]);
+    return _pts[i] + _unitDir[i] * t;
+  }
+
+}
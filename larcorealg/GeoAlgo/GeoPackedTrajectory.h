@@ -0,0 +1,103 @@
+/**
+ * \file GeoPackedTrajectory.h
+ *
+ * \ingroup GeoAlgo
+ *
+ * \brief Class def header for a class PackedTrajectory
+ */
+
+/** \addtogroup GeoAlgo
+
+    @{*/
+#ifndef BASICTOOL_GEOPACKEDTRAJECTORY_H
+#define BASICTOOL_GEOPACKEDTRAJECTORY_H
+
+#include "larcorealg/GeoAlgo/GeoTrajectory.h"
+#include "larcorealg/GeoAlgo/GeoVector.h"
+
+#include <ostream>
+#include <stddef.h>
+#include <vector>
+
+namespace geoalgo {
+
+  /**
+     \class PackedTrajectory
+     This class represents a trajectory, an ordered list of points, prepared for
+     repeated queries. The points are stored contiguously, and the vector,
+     direction and length of each segment and the path length from the first
+     point to each point are computed once at construction.
+     Length() is then a difference of two path lengths, the queries by path
+     length (SegmentAt(), PointAt()) are binary searches, and the distance
+     functions in GeoAlgo need no division nor square root per segment.
+     The object can't be modified after construction: build a new one from
+     the changed Trajectory instead.
+   */
+  class PackedTrajectory {
+
+  public:
+    /// Default ctor: an empty trajectory
+    PackedTrajectory() = default;
+
+    /// Ctor from the points of a trajectory
+    explicit PackedTrajectory(const Trajectory_t& trj);
+
+    //
+    // Getters
+    //
+    size_t size() const { return _pts.size(); } ///< Number of points
+    bool empty() const { return _pts.empty(); } ///< Whether there is no point
+
+    /// All the points, contiguous
+    const std::vector<Point_t>& Points() const { return _pts; }
+
+    /// The point at the specified index (no range check)
+    const Point_t& operator[](size_t i) const { return _pts[i]; }
+
+    /// The summed-length along the trajectory points (as Trajectory::Length())
+    double Length(size_t start_step = 0, size_t end_step = 0) const;
+
+    /// The path length from the first point to point `i` (no range check)
+    double PathLength(size_t i) const { return _pathLength[i]; }
+
+    /// The vector from point `i` to point `i+1` (as Trajectory::Dir())
+    const Vector_t& Dir(size_t i = 0) const;
+
+    /// The unit direction from point `i` to point `i+1` (null for no length)
+    const Vector_t& UnitDir(size_t i) const { return _unitDir[i]; }
+
+    /// The length of the segment from point `i` to point `i+1` (no range check)
+    double SegmentLength(size_t i) const { return _segLength[i]; }
+
+    /// The segment including the specified path length (clamped to the ends)
+    size_t SegmentAt(double pathLength) const;
+
+    /// The point at the specified path length (clamped to the ends)
+    Point_t PointAt(double pathLength) const;
+
+  private:
+    std::vector<Point_t> _pts;         ///< The points, in order
+    std::vector<Vector_t> _segment;    ///< Vector of each segment
+    std::vector<Vector_t> _unitDir;    ///< Unit direction of each segment
+    std::vector<double> _segLength;    ///< Length of each segment
+    std::vector<double> _pathLength;   ///< Path length from the first point to each point
+
+  public:
+    /// Streamer
+#ifndef __CINT__
+    friend std::ostream& operator<<(std::ostream& o, PackedTrajectory const& a)
+    {
+      o << "PackedTrajectory with " << a.size() << " points " << std::endl;
+      for (auto const& p : a.Points())
+        o << " " << p << std::endl;
+      return o;
+    }
+#endif
+  };
+
+  typedef PackedTrajectory PackedTrajectory_t;
+
+}
+
+#endif
+/** @} */ // end of doxygen group
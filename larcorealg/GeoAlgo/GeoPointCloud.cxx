@@ -0,0 +1,334 @@
+#include "larcorealg/GeoAlgo/GeoPointCloud.h"
+#include "larcorealg/GeoAlgo/GeoAlgoException.h"
+
+#include <algorithm>
+
+namespace {
+
+  /// Ordering of the neighbors by distance, then by index
+  bool CloserNeighbor(const geoalgo::PointCloud::Neighbor_t& a,
+                      const geoalgo::PointCloud::Neighbor_t& b)
+  {
+    return (a.sqDist < b.sqDist) || ((a.sqDist == b.sqDist) && (a.index < b.index));
+  }
+
+} // local namespace
+
+namespace geoalgo {
+
+  PointCloud::PointCloud(const std::vector<Point_t>& pts)
+  {
+    _x.reserve(pts.size());
+    _y.reserve(pts.size());
+    _z.reserve(pts.size());
+    for (auto const& pt : pts) {
+      _x.push_back(pt[0]);
+      _y.push_back(pt[1]);
+      _z.push_back(pt[2]);
+    }
+    _Build_();
+  }
+
+  PointCloud::PointCloud(size_t n,
+                         const double* x,
+                         const double* y,
+                         const double* z,
+                         size_t stride)
+    : _x(n), _y(n), _z(n)
+  {
+    for (size_t i = 0; i < n; ++i) {
+      _x[i] = x[i * stride];
+      _y[i] = y[i * stride];
+      _z[i] = z[i * stride];
+    }
+    _Build_();
+  }
+
+  Point_t PointCloud::Point(size_t i) const
+  {
+    size_t const p = _position[i];
+    return Point_t(_x[p], _y[p], _z[p]);
+  }
+
+  void PointCloud::_Build_()
+  {
+    size_t const n = _x.size();
+    for (size_t i = 0; i < n; ++i) {
+      if (!Point_t(_x[i], _y[i], _z[i]).IsValid())
+        throw GeoAlgoException("PointCloud: cannot index an invalid point!");
+    }
+    if (n == 0) return;
+
+    std::vector<size_t> order(n);
+    for (size_t i = 0; i < n; ++i)
+      order[i] = i;
+    _node.reserve(2 * (n / kLeafSize + 1));
+    _BuildNode_(order, 0, n);
+
+    // coordinates by leaf
+    std::vector<double> x_v(n), y_v(n), z_v(n);
+    _position.resize(n);
+    for (size_t p = 0; p < n; ++p) {
+      x_v[p] = _x[order[p]];
+      y_v[p] = _y[order[p]];
+      z_v[p] = _z[order[p]];
+      _position[order[p]] = p;
+    }
+    _x = std::move(x_v);
+    _y = std::move(y_v);
+    _z = std::move(z_v);
+    _index = std::move(order);
+  }
+
+  void PointCloud::_BuildNode_(std::vector<size_t>& order, size_t begin, size_t end)
+  {
+    // the coordinates are still in input order
+    const double* const coords[3] = {_x.data(), _y.data(), _z.data()};
+    Node_t node;
+    for (size_t i = 0; i < 3; ++i)
+      node.lo[i] = node.hi[i] = coords[i][order[begin]];
+    for (size_t p = begin + 1; p < end; ++p) {
+      for (size_t i = 0; i < 3; ++i) {
+        double const c = coords[i][order[p]];
+        node.lo[i] = std::min(node.lo[i], c);
+        node.hi[i] = std::max(node.hi[i], c);
+      }
+    }
+    node.begin = begin;
+    node.end = end;
+    node.second = 0;
+    size_t const iNode = _node.size();
+    _node.push_back(node);
+    if (end - begin <= kLeafSize) return;
+
+    // split at the median along the direction where points spread most
+    size_t axis = 0;
+    for (size_t i = 1; i < 3; ++i)
+      if (node.hi[i] - node.lo[i] > node.hi[axis] - node.lo[axis]) axis = i;
+    size_t const middle = begin + (end - begin) / 2;
+    const double* const c = coords[axis];
+    std::nth_element(order.begin() + begin,
+                     order.begin() + middle,
+                     order.begin() + end,
+                     [c](size_t a, size_t b) { return c[a] < c[b]; });
+
+    _BuildNode_(order, begin, middle);
+    _node[iNode].second = _node.size();
+    _BuildNode_(order, middle, end);
+  }
+
+  double PointCloud::_BoxSqDist_(const Point_t& pt, const Node_t& node)
+  {
+    double sqDist = 0.;
+    for (size_t i = 0; i < 3; ++i) {
+      double const d = (pt[i] < node.lo[i]) ? node.lo[i] - pt[i] :
+                       (pt[i] > node.hi[i]) ? pt[i] - node.hi[i] :
+                                              0.;
+      sqDist += d * d;
+    }
+    return sqDist;
+  }
+
+  double PointCloud::_BoxMaxSqDist_(const Point_t& pt, const Node_t& node)
+  {
+    double sqDist = 0.;
+    for (size_t i = 0; i < 3; ++i) {
+      double const d = std::max(pt[i] - node.lo[i], node.hi[i] - pt[i]);
+      sqDist += d * d;
+    }
+    return sqDist;
+  }
+
+  template <typename F>
+  void PointCloud::_ForEachWithin_(const Point_t& pt, double sqRadius, F&& f) const
+  {
+    if (_node.empty() || sqRadius < 0.) return;
+    // depth of a tree split at the median is about log2(size / kLeafSize): 64 is plenty
+    size_t stack[64];
+    size_t nStack = 0;
+    stack[nStack++] = 0;
+    while (nStack > 0) {
+      size_t const iNode = stack[--nStack];
+      Node_t const& node = _node[iNode];
+      if (_BoxSqDist_(pt, node) > sqRadius) continue;
+      if (node.second != 0) {
+        stack[nStack++] = node.second;
+        stack[nStack++] = iNode + 1;
+        continue;
+      }
+      for (size_t p = node.begin; p < node.end; ++p) {
+        double const sqDist = _SqDist_(pt, p);
+        if (sqDist <= sqRadius) f(p, sqDist);
+      }
+    }
+  }
+
+  void PointCloud::WithinRadius(const Point_t& pt,
+                                double radius,
+                                std::vector<Neighbor_t>& result,
+                                bool sorted) const
+  {
+    result.clear();
+    if (radius < 0.) return;
+    _ForEachWithin_(pt, radius * radius, [this, &result](size_t p, double sqDist) {
+      result.push_back({_index[p], sqDist});
+    });
+    if (sorted) std::sort(result.begin(), result.end(), CloserNeighbor);
+  }
+
+  size_t PointCloud::CountWithinRadius(const Point_t& pt, double radius) const
+  {
+    if (_node.empty() || radius < 0.) return 0;
+    double const sqRadius = radius * radius;
+    size_t count = 0;
+    size_t stack[64];
+    size_t nStack = 0;
+    stack[nStack++] = 0;
+    while (nStack > 0) {
+      size_t const iNode = stack[--nStack];
+      Node_t const& node = _node[iNode];
+      if (_BoxSqDist_(pt, node) > sqRadius) continue;
+      // all the points of a box within the radius are counted at once
+      if (_BoxMaxSqDist_(pt, node) <= sqRadius) {
+        count += node.end - node.begin;
+        continue;
+      }
+      if (node.second != 0) {
+        stack[nStack++] = node.second;
+        stack[nStack++] = iNode + 1;
+        continue;
+      }
+      for (size_t p = node.begin; p < node.end; ++p)
+        if (_SqDist_(pt, p) <= sqRadius) ++count;
+    }
+    return count;
+  }
+
+  void PointCloud::Nearest(const Point_t& pt,
+                           size_t k,
+                           std::vector<Neighbor_t>& result,
+                           double maxDist) const
+  {
+    result.clear();
+    if (_node.empty() || k == 0) return;
+    double const maxSq = (maxDist == kINVALID_DOUBLE) ? kMAX_DOUBLE : maxDist * maxDist;
+
+    // `result` is a heap with the farthest of the points found so far on top
+    auto const bound = [&result, k, maxSq]() {
+      return (result.size() < k) ? maxSq : result.front().sqDist;
+    };
+    size_t stack[64];
+    double stackSq[64];
+    size_t nStack = 0;
+    stack[nStack] = 0;
+    stackSq[nStack++] = _BoxSqDist_(pt, _node[0]);
+    while (nStack > 0) {
+      --nStack;
+      // boxes at the bound may hold a tie with a smaller index
+      if (stackSq[nStack] > bound()) continue;
+      size_t const iNode = stack[nStack];
+      Node_t const& node = _node[iNode];
+      if (node.second != 0) {
+        // visit the closer child first (pushed last)
+        size_t const a = iNode + 1, b = node.second;
+        double const aSq = _BoxSqDist_(pt, _node[a]);
+        double const bSq = _BoxSqDist_(pt, _node[b]);
+        bool const aFirst = aSq <= bSq;
+        stack[nStack] = aFirst ? b : a;
+        stackSq[nStack++] = aFirst ? bSq : aSq;
+        stack[nStack] = aFirst ? a : b;
+        stackSq[nStack++] = aFirst ? aSq : bSq;
+        continue;
+      }
+      for (size_t p = node.begin; p < node.end; ++p) {
+        Neighbor_t const neighbor{_index[p], _SqDist_(pt, p)};
+        if (neighbor.sqDist > maxSq) continue;
+        if (result.size() < k) {
+          result.push_back(neighbor);
+          std::push_heap(result.begin(), result.end(), CloserNeighbor);
+        }
+        else if (CloserNeighbor(neighbor, result.front())) {
+          std::pop_heap(result.begin(), result.end(), CloserNeighbor);
+          result.back() = neighbor;
+          std::push_heap(result.begin(), result.end(), CloserNeighbor);
+        }
+      }
+    }
+    std::sort_heap(result.begin(), result.end(), CloserNeighbor);
+  }
+
+  std::vector<PointCloud::Pair_t> PointCloud::PairsWithinRadius(
+    double radius,
+    const lar::util::Executor& executor) const
+  {
+    std::vector<Pair_t> pairs;
+    if (_node.empty() || radius < 0.) return pairs;
+    double const sqRadius = radius * radius;
+
+    // each block of points collects its pairs, then the blocks are joined in order
+    size_t const nBlocks = (size() + kBatchGrainSize - 1) / kBatchGrainSize;
+    std::vector<std::vector<Pair_t>> blockPairs(nBlocks);
+    executor.parallel_for(0, size(), kBatchGrainSize, [&](size_t first, size_t last) {
+      std::vector<Pair_t>& found = blockPairs[first / kBatchGrainSize];
+      std::vector<size_t> partners;
+      for (size_t i = first; i < last; ++i) {
+        partners.clear();
+        _ForEachWithin_(Point(i), sqRadius, [this, i, &partners](size_t p, double) {
+          if (_index[p] > i) partners.push_back(_index[p]);
+        });
+        std::sort(partners.begin(), partners.end());
+        for (size_t j : partners)
+          found.emplace_back(i, j);
+      }
+    });
+
+    size_t nPairs = 0;
+    for (auto const& found : blockPairs)
+      nPairs += found.size();
+    pairs.reserve(nPairs);
+    for (auto const& found : blockPairs)
+      pairs.insert(pairs.end(), found.begin(), found.end());
+    return pairs;
+  }
+
+  std::vector<std::vector<PointCloud::Neighbor_t>> PointCloud::WithinRadius(
+    const std::vector<Point_t>& pts,
+    double radius,
+    bool sorted,
+    const lar::util::Executor& executor) const
+  {
+    std::vector<std::vector<Neighbor_t>> results(pts.size());
+    executor.parallel_for(0, pts.size(), kBatchGrainSize, [&](size_t first, size_t last) {
+      for (size_t i = first; i < last; ++i)
+        WithinRadius(pts[i], radius, results[i], sorted);
+    });
+    return results;
+  }
+
+  std::vector<size_t> PointCloud::CountWithinRadius(const std::vector<Point_t>& pts,
+                                                    double radius,
+                                                    const lar::util::Executor& executor) const
+  {
+    std::vector<size_t> counts(pts.size());
+    executor.parallel_for(0, pts.size(), kBatchGrainSize, [&](size_t first, size_t last) {
+      for (size_t i = first; i < last; ++i)
+        counts[i] = CountWithinRadius(pts[i], radius);
+    });
+    return counts;
+  }
+
+  std::vector<std::vector<PointCloud::Neighbor_t>> PointCloud::Nearest(
+    const std::vector<Point_t>& pts,
+    size_t k,
+    double maxDist,
+    const lar::util::Executor& executor) const
+  {
+    std::vector<std::vector<Neighbor_t>> results(pts.size());
+    executor.parallel_for(0, pts.size(), kBatchGrainSize, [&](size_t first, size_t last) {
+      for (size_t i = first; i < last; ++i)
+        Nearest(pts[i], k, results[i], maxDist);
+    });
+    return results;
+  }
+
+}
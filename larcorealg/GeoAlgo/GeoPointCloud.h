@@ -0,0 +1,199 @@
+/**
+ * \file GeoPointCloud.h
+ *
+ * \ingroup GeoAlgo
+ *
+ * \brief Class def header for a class PointCloud
+ */
+
+/** \addtogroup GeoAlgo
+
+    @{*/
+#ifndef BASICTOOL_GEOPOINTCLOUD_H
+#define BASICTOOL_GEOPOINTCLOUD_H
+
+#include "larcorealg/CoreUtils/Executor.h"
+#include "larcorealg/GeoAlgo/GeoAlgoConstants.h"
+#include "larcorealg/GeoAlgo/GeoVector.h"
+
+#include <stddef.h>
+#include <utility>
+#include <vector>
+
+namespace geoalgo {
+
+  /**
+     \class PointCloud
+     @brief Spatial index of a set of points, for neighbor searches.
+     The points are copied at construction into a k-d tree: the space is split
+     in two at the median point along the direction where the points spread
+     most, down to leaves of a few points, in O(n log n). The coordinates are
+     stored by leaf in three contiguous arrays, and the queries only visit the
+     leaves that may hold a point close enough to the query point.
+
+     The results identify the points by their index in the input, and give
+     their squared distance from the query point; points at exactly the radius
+     are included. WithinRadius() returns the points in no particular order
+     unless asked to sort them, Nearest() returns them by increasing distance;
+     ties in the distance are broken by the index.
+
+     PairsWithinRadius() enumerates all the pairs of indexed points closer
+     than a radius, the neighborhoods of a density based clustering.
+     The batched queries and PairsWithinRadius() take a lar::util::Executor,
+     and spread the query points among its tasks; the results do not depend
+     on the executor. The object can't be modified after construction: the
+     queries are all constant, and can run concurrently.
+   */
+  class PointCloud {
+
+  public:
+    /// A point found by a query
+    struct Neighbor_t {
+      size_t index = 0;                ///< Index of the point in the input
+      double sqDist = kINVALID_DOUBLE; ///< Squared distance from the query point
+    };
+
+    /// A pair of indices of points, the first smaller than the second
+    using Pair_t = std::pair<size_t, size_t>;
+
+    /// Default ctor: no point
+    PointCloud() = default;
+
+    /// Ctor indexing the points `pts`
+    explicit PointCloud(const std::vector<Point_t>& pts);
+
+    /// Ctor indexing the `n` points (`x[i * stride]`, `y[i * stride]`, `z[i * stride]`)
+    PointCloud(size_t n, const double* x, const double* y, const double* z, size_t stride = 1);
+
+    /// Ctor indexing the `n` points from the (x, y, z) triplets of `xyz`
+    PointCloud(size_t n, const double* xyz) : PointCloud(n, xyz, xyz + 1, xyz + 2, 3) {}
+
+    //
+    // Getters
+    //
+    size_t size() const { return _index.size(); } ///< Number of points
+    bool empty() const { return _index.empty(); } ///< Whether there is no point
+
+    /// The point with index `i` in the input (no range check)
+    Point_t Point(size_t i) const;
+
+    //
+    // Queries
+    //
+    /// All points within `radius` from `pt` (sorted by distance if `sorted`)
+    std::vector<Neighbor_t> WithinRadius(const Point_t& pt,
+                                         double radius,
+                                         bool sorted = false) const
+    {
+      std::vector<Neighbor_t> result;
+      WithinRadius(pt, radius, result, sorted);
+      return result;
+    }
+
+    /// WithinRadius() into `result`, replacing its content and reusing its memory
+    void WithinRadius(const Point_t& pt,
+                      double radius,
+                      std::vector<Neighbor_t>& result,
+                      bool sorted = false) const;
+
+    /// Number of points within `radius` from `pt`
+    size_t CountWithinRadius(const Point_t& pt, double radius) const;
+
+    /// The `k` points closest to `pt` (fewer if not as many are within `maxDist`)
+    std::vector<Neighbor_t> Nearest(const Point_t& pt,
+                                    size_t k,
+                                    double maxDist = kINVALID_DOUBLE) const
+    {
+      std::vector<Neighbor_t> result;
+      Nearest(pt, k, result, maxDist);
+      return result;
+    }
+
+    /// Nearest() into `result`, replacing its content and reusing its memory
+    void Nearest(const Point_t& pt,
+                 size_t k,
+                 std::vector<Neighbor_t>& result,
+                 double maxDist = kINVALID_DOUBLE) const;
+
+    /**
+       All the pairs of indexed points within `radius` from each other, with
+       the smaller index first, sorted by the first index, then by the second.
+    */
+    std::vector<Pair_t> PairsWithinRadius(double radius,
+                                          const lar::util::Executor& executor = {}) const;
+
+    //
+    // Batched queries
+    //
+    /// WithinRadius() of each point
+    std::vector<std::vector<Neighbor_t>> WithinRadius(const std::vector<Point_t>& pts,
+                                                      double radius,
+                                                      bool sorted = false,
+                                                      const lar::util::Executor& executor = {})
+      const;
+
+    /// CountWithinRadius() of each point
+    std::vector<size_t> CountWithinRadius(const std::vector<Point_t>& pts,
+                                          double radius,
+                                          const lar::util::Executor& executor = {}) const;
+
+    /// Nearest() of each point
+    std::vector<std::vector<Neighbor_t>> Nearest(const std::vector<Point_t>& pts,
+                                                 size_t k,
+                                                 double maxDist = kINVALID_DOUBLE,
+                                                 const lar::util::Executor& executor = {}) const;
+
+  protected:
+    /// A node of the tree
+    struct Node_t {
+      double lo[3]; ///< Lower corner of the box enclosing all the node points
+      double hi[3]; ///< Upper corner of the box enclosing all the node points
+      size_t begin; ///< Position of the first point of the node in the coordinate arrays
+      size_t end;   ///< Position after the last point of the node in the coordinate arrays
+      /// Index of the second child (the first immediately follows its parent), `0` for leaves
+      size_t second;
+    };
+
+    /// Largest number of points in a leaf
+    static const size_t kLeafSize = 8;
+
+    /// Number of query points in each task of the batched queries
+    static const size_t kBatchGrainSize = 64;
+
+    /// Builds the tree of the points in the coordinate arrays (still in input order)
+    void _Build_();
+
+    /// Adds the node of the points `order[begin]` to `order[end - 1]` and its children
+    void _BuildNode_(std::vector<size_t>& order, size_t begin, size_t end);
+
+    /// Squared distance of `pt` from the box of `node` (null inside)
+    static double _BoxSqDist_(const Point_t& pt, const Node_t& node);
+
+    /// Largest squared distance of `pt` from a point of the box of `node`
+    static double _BoxMaxSqDist_(const Point_t& pt, const Node_t& node);
+
+    /// Squared distance of `pt` from the point at position `i` of the coordinate arrays
+    double _SqDist_(const Point_t& pt, size_t i) const
+    {
+      double const dx = _x[i] - pt[0], dy = _y[i] - pt[1], dz = _z[i] - pt[2];
+      return dx * dx + dy * dy + dz * dz;
+    }
+
+    /// Calls `f(i, sqDist)` for each position `i` of a point within `sqRadius` from `pt`
+    template <typename F>
+    void _ForEachWithin_(const Point_t& pt, double sqRadius, F&& f) const;
+
+    std::vector<double> _x;     ///< x coordinates of the points, by leaf
+    std::vector<double> _y;     ///< y coordinates of the points, by leaf
+    std::vector<double> _z;     ///< z coordinates of the points, by leaf
+    std::vector<size_t> _index;    ///< Input index of each point, by leaf
+    std::vector<size_t> _position; ///< Position in the coordinate arrays of each input point
+    std::vector<Node_t> _node;     ///< Nodes of the tree; the first is the root
+  };
+
+  typedef PointCloud PointCloud_t;
+
+}
+
+#endif
+/** @} */ // end of doxygen group
@@ -2,6 +2,30 @@
 #include "larcorealg/GeoAlgo/GeoAlgoException.h"
 
 #include <iostream>
+#include <memory>
+
+namespace {
+
+  /// Sphere::Contain() of `n` points, computed in `Real` precision
+  template <typename Real>
+  void sphereContain(const geoalgo::Point_t& center,
+                     double radius,
+                     size_t n,
+                     const Real* x,
+                     const Real* y,
+                     const Real* z,
+                     bool* mask,
+                     size_t stride)
+  {
+    Real const cx = center[0], cy = center[1], cz = center[2];
+    Real const r2 = Real(radius) * Real(radius);
+    for (size_t i = 0; i < n; ++i) {
+      Real const dx = x[i * stride] - cx, dy = y[i * stride] - cy, dz = z[i * stride] - cz;
+      mask[i] = (dx * dx + dy * dy + dz * dz) < r2;
+    }
+  }
+
+} // local namespace
 
 namespace geoalgo {
 
@@ -359,6 +383,37 @@ namespace geoalgo {
     return (p._Dist_(_center) < _radius);
   }
 
+  void Sphere::Contain(size_t n,
+                       const double* x,
+                       const double* y,
+                       const double* z,
+                       bool* mask,
+                       size_t stride) const
+  {
+    sphereContain(_center, _radius, n, x, y, z, mask, stride);
+  }
+
+  void Sphere::Contain(size_t n,
+                       const float* x,
+                       const float* y,
+                       const float* z,
+                       bool* mask,
+                       size_t stride) const
+  {
+    sphereContain(_center, _radius, n, x, y, z, mask, stride);
+  }
+
+  std::vector<bool> Sphere::Contain(const std::vector<double>& x,
+                                    const std::vector<double>& y,
+                                    const std::vector<double>& z) const
+  {
+    if (x.size() != y.size() || x.size() != z.size())
+      throw GeoAlgoException("Sphere::Contain: coordinate vectors of different size!");
+    std::unique_ptr<bool[]> mask(new bool[x.size()]);
+    Contain(x.size(), x.data(), y.data(), z.data(), mask.get());
+    return std::vector<bool>(mask.get(), mask.get() + x.size());
+  }
+
   void Sphere::compat(const Point_t& p, const double r) const
   {
     if (p.size() != 3) throw GeoAlgoException("Only 3D points allowed for sphere");
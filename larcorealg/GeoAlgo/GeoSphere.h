@@ -16,6 +16,7 @@
 
 #include "larcorealg/GeoAlgo/GeoVector.h"
 
+#include <stddef.h>
 #include <vector>
 
 namespace geoalgo {
@@ -30,6 +31,11 @@ namespace geoalgo {
     Sphere();            ///< Default ctor
     virtual ~Sphere() {} ///< Default dtor
 
+    Sphere(const Sphere&) = default;            ///< Copy ctor
+    Sphere(Sphere&&) = default;                 ///< Move ctor
+    Sphere& operator=(const Sphere&) = default; ///< Copy assignment
+    Sphere& operator=(Sphere&&) = default;      ///< Move assignment
+
     /// Alternative ctor (0)
     Sphere(const double& x, const double& y, const double& z, const double& r);
 
@@ -66,6 +72,37 @@ namespace geoalgo {
     //
     bool Contain(const Point_t& p) const; ///< Judge if a point is contained within a sphere
 
+    /// Containment of the `n` points (`x[i]`, `y[i]`, `z[i]`): `mask[i]` is set to Contain()
+    /// (up to rounding); `i * stride` is the index of the coordinates of the point `i`
+    void Contain(size_t n,
+                 const double* x,
+                 const double* y,
+                 const double* z,
+                 bool* mask,
+                 size_t stride = 1) const;
+    /// Containment of the `n` points from the (x, y, z) triplets of `xyz`, the layout of a
+    /// C-ordered array of shape (n, 3) like a NumPy one
+    void Contain(size_t n, const double* xyz, bool* mask) const
+    {
+      Contain(n, xyz, xyz + 1, xyz + 2, mask, 3);
+    }
+    /// Containment of `n` points from float coordinate arrays, computed in float precision
+    void Contain(size_t n,
+                 const float* x,
+                 const float* y,
+                 const float* z,
+                 bool* mask,
+                 size_t stride = 1) const;
+    /// Containment of `n` points from the float (x, y, z) triplets of `xyz`
+    void Contain(size_t n, const float* xyz, bool* mask) const
+    {
+      Contain(n, xyz, xyz + 1, xyz + 2, mask, 3);
+    }
+    /// Containment of the points of coordinates `x`, `y` and `z` (e.g. from Python)
+    std::vector<bool> Contain(const std::vector<double>& x,
+                              const std::vector<double>& y,
+                              const std::vector<double>& z) const;
+
   protected:
     void compat(const Point_t& p, const double r = 0) const; ///< 3D point compatibility check
     void compat(const double& r) const; ///< Positive radius compatibility check
@@ -103,8 +140,8 @@ namespace geoalgo {
     template <class T>
     Sphere(const std::vector<T>& pts)
     {
-      std::vector<::geoalgo::Vector> geo_pts;
-      geo_pts.reserve(pts);
+      std::vector<::geoalgo::Point_t> geo_pts;
+      geo_pts.reserve(pts.size());
       for (auto const& p : pts)
         geo_pts.emplace_back(p);
       (*this) = Sphere(geo_pts);
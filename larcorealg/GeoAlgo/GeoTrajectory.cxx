@@ -37,6 +37,8 @@ namespace geoalgo {
     // if length < 2, no length
     if (size() < 2) return 0;
 
+    if (_HasLengths_()) return _length_v[end_step] - _length_v[start_step];
+
     double length = 0;
     for (size_t i = start_step; i < end_step; ++i)
 
@@ -50,6 +52,8 @@ namespace geoalgo {
 
     if (size() < 2) return false;
 
+    if (_HasLengths_()) return _length_v.back() > ref;
+
     double length = 0;
     for (size_t i = 0; i < size() - 1; ++i) {
 
@@ -64,7 +68,17 @@ namespace geoalgo {
   void Trajectory::push_back(const Point_t& obj)
   {
     compat(obj);
-    if (!(size() && obj == (*rbegin()))) std::vector<geoalgo::Point_t>::push_back(obj);
+    Base_t const& pts = *this;
+    if (size() && obj == pts.back()) return;
+
+    // rebuild the length cache if dropped, then extend it to the new point
+    if (!_HasLengths_()) {
+      _length_v.resize(size());
+      for (size_t i = 0; i < size(); ++i)
+        _length_v[i] = i ? _length_v[i - 1] + pts[i - 1]._Dist_(pts[i]) : 0.;
+    }
+    _length_v.push_back(size() ? _length_v.back() + pts.back()._Dist_(obj) : 0.);
+    Base_t::push_back(obj);
   }
 
   void Trajectory::compat(const Point_t& obj) const
@@ -95,7 +109,7 @@ namespace geoalgo {
     }
   }
 
-  Vector Trajectory::Dir(size_t i) const
+  Vector_t Trajectory::Dir(size_t i) const
   {
 
     if (size() < (i + 2)) {
@@ -107,5 +121,5 @@ namespace geoalgo {
     return _Dir_(i);
   }
 
-  Vector Trajectory::_Dir_(size_t i) const { return ((*this)[i + 1] - (*this)[i]); }
+  Vector_t Trajectory::_Dir_(size_t i) const { return ((*this)[i + 1] - (*this)[i]); }
 }
@@ -18,6 +18,7 @@
 
 #include <ostream>
 #include <stddef.h>
+#include <utility>
 #include <vector>
 
 namespace geoalgo {
@@ -27,8 +28,17 @@ namespace geoalgo {
      This class represents a trajectory which is an ordered list of Point.
      It is a friend class w/ geoalgo::Point_t hence it has an access to protected functions that avoids
      dimensionality sanity checks for speed.
+
+     The length of the trajectory up to each point is cached and extended by
+     push_back(), so that Length() and IsLonger() take constant time. Any
+     other change of the points through the Trajectory interface (non-const
+     access included) drops the cache, which the next push_back() rebuilds;
+     until then the lengths are summed at each call as before. Changes made
+     through a reference to the base std::vector are not detected.
    */
-  class Trajectory : public std::vector<geoalgo::Vector> {
+  class Trajectory : public std::vector<geoalgo::Point_t> {
+
+    using Base_t = std::vector<geoalgo::Point_t>;
 
   public:
     /// Default ctor to specify # points and dimension of each point
@@ -37,6 +47,11 @@ namespace geoalgo {
     /// Default dtor
     virtual ~Trajectory() {}
 
+    Trajectory(const Trajectory&) = default;            ///< Copy ctor
+    Trajectory(Trajectory&&) = default;                 ///< Move ctor
+    Trajectory& operator=(const Trajectory&) = default; ///< Copy assignment
+    Trajectory& operator=(Trajectory&&) = default;      ///< Move assignment
+
     /// Alternative ctor (0) using a vector of mere vector point expression
     Trajectory(const std::vector<std::vector<double>>& obj);
 
@@ -49,13 +64,74 @@ namespace geoalgo {
     double Length(size_t start_step = 0,
                   size_t end_step = 0) const; ///< The summed-length along all trajectory points
     bool IsLonger(double) const;    ///< Check if the trajectory is longer than specified value
-    Vector Dir(size_t i = 0) const; ///< The direction at a specified trajectory point
+    Vector_t Dir(size_t i = 0) const; ///< The direction at a specified trajectory point
 
     //
     // Setters
     //
     void push_back(const Point_t& obj); ///< push_back overrie w/ dimensionality check
 
+    //
+    // Access to the points (non-const access drops the length cache)
+    //
+    using Base_t::at;
+    using Base_t::back;
+    using Base_t::begin;
+    using Base_t::data;
+    using Base_t::end;
+    using Base_t::front;
+    using Base_t::rbegin;
+    using Base_t::rend;
+    using Base_t::operator[];
+
+    reference operator[](size_type i) { return _Modify_()[i]; }
+    reference at(size_type i) { return _Modify_().at(i); }
+    reference front() { return _Modify_().front(); }
+    reference back() { return _Modify_().back(); }
+    iterator begin() { return _Modify_().begin(); }
+    iterator end() { return _Modify_().end(); }
+    reverse_iterator rbegin() { return _Modify_().rbegin(); }
+    reverse_iterator rend() { return _Modify_().rend(); }
+    Point_t* data() { return _Modify_().data(); }
+
+    void clear() { _Modify_().clear(); }
+    void pop_back() { _Modify_().pop_back(); }
+    template <class... Args>
+    void resize(Args&&... args)
+    {
+      _Modify_().resize(std::forward<Args>(args)...);
+    }
+    template <class... Args>
+    void assign(Args&&... args)
+    {
+      _Modify_().assign(std::forward<Args>(args)...);
+    }
+    template <class... Args>
+    iterator insert(Args&&... args)
+    {
+      return _Modify_().insert(std::forward<Args>(args)...);
+    }
+    template <class... Args>
+    iterator erase(Args&&... args)
+    {
+      return _Modify_().erase(std::forward<Args>(args)...);
+    }
+    template <class... Args>
+    iterator emplace(Args&&... args)
+    {
+      return _Modify_().emplace(std::forward<Args>(args)...);
+    }
+    template <class... Args>
+    void emplace_back(Args&&... args)
+    {
+      _Modify_().emplace_back(std::forward<Args>(args)...);
+    }
+    void swap(Trajectory& other)
+    {
+      Base_t::swap(other);
+      _length_v.swap(other._length_v);
+    }
+
     inline Trajectory& operator+=(const Point_t& rhs)
     {
       push_back(rhs);
@@ -70,7 +146,20 @@ namespace geoalgo {
 
   protected:
     /// Returns a direction vector at a specified trajectory point w/o size check
-    Vector _Dir_(size_t i) const;
+    Vector_t _Dir_(size_t i) const;
+
+    /// Whether `_length_v` holds the lengths up to all the points
+    bool _HasLengths_() const { return _length_v.size() == size(); }
+
+    /// Drops the length cache and returns the points for a change
+    Base_t& _Modify_()
+    {
+      _length_v.clear();
+      return *this;
+    }
+
+    /// Length of the trajectory up to each point, if `_HasLengths_()`
+    std::vector<double> _length_v; //! transient cache
 
   public:
     //
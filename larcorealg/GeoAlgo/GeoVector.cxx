@@ -197,4 +197,93 @@ namespace geoalgo {
     return;
   }
 
+  //----------------------------------------------------------------------
+  Vector3::Vector3(size_t n) : Vector3()
+  {
+    if (n != 0 && n != 3) {
+      std::ostringstream msg;
+      msg << "<<" << __FUNCTION__ << ">>"
+          << " size mismatch: " << n << " != 3" << std::endl;
+      throw GeoAlgoException(msg.str());
+    }
+  }
+
+  Vector3::Vector3(const std::vector<double>& obj) : Vector3()
+  {
+    if (obj.size() != 3) {
+      std::ostringstream msg;
+      msg << "<<" << __FUNCTION__ << ">>"
+          << " size mismatch: " << obj.size() << " != 3" << std::endl;
+      throw GeoAlgoException(msg.str());
+    }
+    (*this)[0] = obj[0];
+    (*this)[1] = obj[1];
+    (*this)[2] = obj[2];
+  }
+
+  Vector3::Vector3(const TVector3& pt) : Vector3(pt[0], pt[1], pt[2]) {}
+
+  Vector3::Vector3(const TLorentzVector& pt) : Vector3(pt[0], pt[1], pt[2]) {}
+
+  bool Vector3::IsValid() const
+  {
+    // if any point is different from kINVALID_DOUBLE then the point is valid
+    return ((*this)[0] != kINVALID_DOUBLE) || ((*this)[1] != kINVALID_DOUBLE) ||
+           ((*this)[2] != kINVALID_DOUBLE);
+  }
+
+  double Vector3::Phi() const
+  {
+    return (*this)[0] == 0.0 && (*this)[1] == 0.0 ? 0.0 : atan2((*this)[1], (*this)[0]);
+  }
+
+  double Vector3::Theta() const
+  {
+    return (*this).Length() == 0.0 ? 0.0 : acos((*this)[2] / (*this).Length());
+  }
+
+  TLorentzVector Vector3::ToTLorentzVector() const
+  {
+    return TLorentzVector((*this)[0], (*this)[1], (*this)[2], 0.);
+  }
+
+  void Vector3::RotateX(const double& theta)
+  {
+
+    double c = cos(theta);
+    double s = sin(theta);
+
+    double ynew = (*this)[1] * c - (*this)[2] * s;
+    double znew = (*this)[1] * s + (*this)[2] * c;
+
+    (*this)[1] = ynew;
+    (*this)[2] = znew;
+  }
+
+  void Vector3::RotateY(const double& theta)
+  {
+
+    double c = cos(theta);
+    double s = sin(theta);
+
+    double xnew = (*this)[0] * c + (*this)[2] * s;
+    double znew = -(*this)[0] * s + (*this)[2] * c;
+
+    (*this)[0] = xnew;
+    (*this)[2] = znew;
+  }
+
+  void Vector3::RotateZ(const double& theta)
+  {
+
+    double c = cos(theta);
+    double s = sin(theta);
+
+    double xnew = (*this)[0] * c - (*this)[1] * s;
+    double ynew = (*this)[0] * s + (*this)[1] * c;
+
+    (*this)[0] = xnew;
+    (*this)[1] = ynew;
+  }
+
 }
@@ -19,6 +19,8 @@
 #include "TLorentzVector.h"
 #include "TVector3.h"
 
+#include <array>
+#include <cmath>
 #include <functional>
 #include <ostream>
 #include <stddef.h>
@@ -169,8 +171,10 @@ namespace geoalgo {
     inline bool operator<(const Vector& rhs) const
     {
       compat(rhs);
-      for (size_t i = 0; i < size(); ++i)
+      for (size_t i = 0; i < size(); ++i) {
         if ((*this)[i] < rhs[i]) return true;
+        if (rhs[i] < (*this)[i]) return false;
+      }
       return false;
     }
 
@@ -199,9 +203,195 @@ namespace geoalgo {
 #endif
   };
 
-  /// Point has same feature as Vector
-  typedef Vector Vector_t;
-  typedef Vector Point_t;
+  /**
+     \class Vector3
+     This class represents a 3-dimensional vector.
+     It has the interface of `Vector`, but its coordinates are stored in place
+     (`std::array`) rather than on the heap, so that creating, copying and
+     combining vectors never allocates memory. The dimensionality checks
+     always pass. This is the type of `Point_t` and `Vector_t`, used by all
+     the GeoAlgo objects; `Vector` converts to and from it.
+  */
+  class Vector3 : public std::array<double, 3> {
+    friend class Trajectory;
+    friend class HalfLine;
+    friend class LineSegment;
+    friend class Sphere;
+    friend class GeoAlgo;
+
+  public:
+    /// Default ctor: an invalid point
+    Vector3() : std::array<double, 3>{{kINVALID_DOUBLE, kINVALID_DOUBLE, kINVALID_DOUBLE}} {}
+
+    /// Ctor to instantiate with invalid value (`n` must be 3, or 0 for "any")
+    Vector3(size_t n);
+
+    /// Ctor w/ x, y & z
+    Vector3(const double x, const double y, const double z) : std::array<double, 3>{{x, y, z}} {}
+
+    Vector3(const std::vector<double>& obj); ///< ctor w/ a 3-element std::vector<double>
+    Vector3(const TVector3& pt);             ///< ctor w/ TVector3
+    Vector3(const TLorentzVector& pt);       ///< ctor w/ TLorentzVector
+
+    /// Conversion to the N-dimensional vector
+    operator Vector() const { return Vector((*this)[0], (*this)[1], (*this)[2]); }
+
+    void Normalize() { (*this) /= Length(); } ///< Normalize itself
+
+    bool IsValid() const;                                   ///< Check if point is valid
+    double SqLength() const { return _Dot_(*this); }        ///< Compute the squared length
+    double Length() const { return std::sqrt(SqLength()); } ///< Compute the length
+    Vector3 Dir() const { return (*this) / Length(); }      ///< Return a direction unit vector
+    double Phi() const;                                     ///< Compute the angle Phi
+    double Theta() const;                                   ///< Compute the angle theta
+
+    /// Compute the squared distance to another vector
+    double SqDist(const Vector3& obj) const { return _SqDist_(obj); }
+    /// Compute the distance to another vector
+    double Dist(const Vector3& obj) const { return _Dist_(obj); }
+    /// Compute a dot product of two vectors
+    double Dot(const Vector3& obj) const { return _Dot_(obj); }
+    /// Compute a cross product of two vectors
+    Vector3 Cross(const Vector3& obj) const { return _Cross_(obj); }
+    /// Compute an opening angle w.r.t. the given vector
+    double Angle(const Vector3& obj) const { return _Angle_(obj); }
+
+    TLorentzVector ToTLorentzVector()
+      const; ///< Convert geovector to TLorentzVector (with 4th element set equal to 0)
+
+    /// Dimensional check for a compatibility (always compatible)
+    void compat(const Vector3&) const {}
+
+    /// rotation operations
+    void RotateX(const double& theta);
+    void RotateY(const double& theta);
+    void RotateZ(const double& theta);
+
+  protected:
+    /// Compute the squared-distance to another vector w/o dimension check
+    double _SqDist_(const Vector3& obj) const
+    {
+      double const dx = (*this)[0] - obj[0];
+      double const dy = (*this)[1] - obj[1];
+      double const dz = (*this)[2] - obj[2];
+      return dx * dx + dy * dy + dz * dz;
+    }
+    /// Compute the distance to another vector w/o dimension check
+    double _Dist_(const Vector3& obj) const { return std::sqrt(_SqDist_(obj)); }
+    /// Compute a dot product w/o dimention check.
+    double _Dot_(const Vector3& obj) const { return (*this) * obj; }
+    /// Compute a cross product w/o dimension check.
+    Vector3 _Cross_(const Vector3& obj) const
+    {
+      return {(*this)[1] * obj[2] - obj[1] * (*this)[2],
+              (*this)[2] * obj[0] - obj[2] * (*this)[0],
+              (*this)[0] * obj[1] - obj[0] * (*this)[1]};
+    }
+    /// Compute the angle in degrees between 2 vectors w/o dimension check.
+    double _Angle_(const Vector3& obj) const
+    {
+      return std::acos(_Dot_(obj) / Length() / obj.Length());
+    }
+
+  public:
+    //
+    // binary/uniry operators
+    //
+    inline Vector3& operator+=(const Vector3& rhs)
+    {
+      for (size_t i = 0; i < 3; ++i)
+        (*this)[i] += rhs[i];
+      return *this;
+    }
+
+    inline Vector3& operator-=(const Vector3& rhs)
+    {
+      for (size_t i = 0; i < 3; ++i)
+        (*this)[i] -= rhs[i];
+      return *this;
+    }
+
+    inline Vector3& operator*=(const double rhs)
+    {
+      for (auto& v : *this)
+        v *= rhs;
+      return *this;
+    }
+
+    inline Vector3& operator/=(const double rhs)
+    {
+      for (auto& v : *this)
+        v /= rhs;
+      return *this;
+    }
+
+    inline Vector3 operator+(const Vector3& rhs) const
+    {
+      Vector3 res((*this));
+      res += rhs;
+      return res;
+    }
+
+    inline Vector3 operator-(const Vector3& rhs) const
+    {
+      Vector3 res((*this));
+      res -= rhs;
+      return res;
+    }
+
+    inline double operator*(const Vector3& rhs) const
+    {
+      return (*this)[0] * rhs[0] + (*this)[1] * rhs[1] + (*this)[2] * rhs[2];
+    }
+
+    inline Vector3 operator*(const double& rhs) const
+    {
+      Vector3 res((*this));
+      res *= rhs;
+      return res;
+    }
+
+    inline Vector3 operator/(const double& rhs) const
+    {
+      Vector3 res((*this));
+      res /= rhs;
+      return res;
+    }
+
+    inline bool operator<(const Vector3& rhs) const
+    {
+      for (size_t i = 0; i < 3; ++i) {
+        if ((*this)[i] < rhs[i]) return true;
+        if (rhs[i] < (*this)[i]) return false;
+      }
+      return false;
+    }
+
+    inline bool operator<(const double& rhs) const { return Length() < rhs; }
+
+    inline bool operator==(const Vector3& rhs) const
+    {
+      return ((*this)[0] == rhs[0]) && ((*this)[1] == rhs[1]) && ((*this)[2] == rhs[2]);
+    }
+
+    inline bool operator!=(const Vector3& rhs) const { return !(*this == rhs); }
+
+/// Streamer
+#ifndef __CINT__
+    friend std::ostream& operator<<(std::ostream& o, ::geoalgo::Vector3 const& a)
+    {
+      o << "Vector (";
+      for (auto const& v : a)
+        o << v << " ";
+      o << ")";
+      return o;
+    }
+#endif
+  };
+
+  /// Points and vectors of the GeoAlgo objects are 3-dimensional
+  typedef Vector3 Vector_t;
+  typedef Vector3 Point_t;
 }
 
 // Define a pointer comparison
@@ -214,6 +404,14 @@ namespace std {
       return (*lhs) < (*rhs);
     }
   };
+  template <>
+  class less<geoalgo::Vector3*> {
+  public:
+    bool operator()(const geoalgo::Vector3* lhs, const geoalgo::Vector3* rhs)
+    {
+      return (*lhs) < (*rhs);
+    }
+  };
 }
 
 #endif
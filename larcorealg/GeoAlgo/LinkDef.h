@@ -14,8 +14,14 @@
 #pragma link C++ class std::vector < geoalgo::Vector> + ;
 #pragma link C++ class std::vector < std::vector < geoalgo::Vector>> + ;
 #pragma link C++ class std::map < geoalgo::Vector, string> + ;
+#pragma link C++ class geoalgo::Vector3 + ;
+#pragma link C++ class std::vector < geoalgo::Vector3> + ;
+#pragma link C++ class std::vector < std::vector < geoalgo::Vector3>> + ;
+#pragma link C++ class std::map < geoalgo::Vector3, string> + ;
 #pragma link C++ class geoalgo::Trajectory + ;
 #pragma link C++ class std::vector < geoalgo::Trajectory> + ;
+#pragma link C++ class geoalgo::PackedTrajectory + ;
+#pragma link C++ class std::vector < geoalgo::PackedTrajectory> + ;
 #pragma link C++ class geoalgo::HalfLine + ;
 #pragma link C++ class std::vector < geoalgo::HalfLine> + ;
 #pragma link C++ class geoalgo::Line + ;
@@ -34,9 +40,15 @@
 #pragma link C++ class std::vector < geoalgo::Sphere> + ;
 #pragma link C++ class std::pair < geoalgo::Vector, string> + ;
 #pragma link C++ class std::map < geoalgo::Vector, string> + ;
+#pragma link C++ class std::pair < geoalgo::Vector3, string> + ;
+#pragma link C++ class std::map < geoalgo::Vector3, string> + ;
 
 #pragma link C++ class geoalgo::GeoAlgo + ;
 #pragma link C++ class geoalgo::GeoObjCollection + ;
+#pragma link C++ class geoalgo::GeoObjBVH + ;
+#pragma link C++ class geoalgo::PointCloud + ;
+#pragma link C++ class geoalgo::ConvexHull2D + ;
+#pragma link C++ class geoalgo::ConvexHull3D + ;
 //ADD_NEW_CLASS ... do not change this line
 
 #endif
@@ -1,4 +1,7 @@
 #include "larcorealg/GeoAlgo/GeoAlgo.h"
 #include "larcorealg/GeoAlgo/GeoAlgoException.h"
+#include "larcorealg/GeoAlgo/GeoCone.h"
+#include "larcorealg/GeoAlgo/GeoCylinder.h"
 #include "larcorealg/GeoAlgo/GeoObjCollection.h"
+#include "larcorealg/GeoAlgo/GeoSphere.h"
 #include "larcorealg/GeoAlgo/GeoVector.h"
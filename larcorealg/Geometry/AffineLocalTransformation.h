@@ -0,0 +1,141 @@
+/**
+ * @file   larcorealg/Geometry/AffineLocalTransformation.h
+ * @brief  Local-to-world transformations stored in `geo::AffineTransform`.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/AffineTransform.h`
+ * @ingroup Geometry
+ *
+ * This is a header-only library.
+ *
+ * It provides the conversions of ROOT transformation matrices into
+ * `geo::AffineTransform`, and the construction of
+ * `geo::LocalTransformation<geo::AffineTransform<T>>` from a path of ROOT
+ * geometry nodes:
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * geo::LocalTransformation<geo::AffineTransformD> trans{ path, depth };
+ * auto const affine
+ *   = geo::convertTransformationMatrix<geo::AffineTransformF>(*node->GetMatrix());
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ */
+
+#ifndef LARCOREALG_GEOMETRY_AFFINELOCALTRANSFORMATION_H
+#define LARCOREALG_GEOMETRY_AFFINELOCALTRANSFORMATION_H
+
+// LArSoft libraries
+#include "larcorealg/Geometry/AffineTransform.h"
+#include "larcorealg/Geometry/GeoVectorLocalTransformation.h"
+#include "larcorealg/Geometry/LocalTransformation.h"
+
+// ROOT libraries
+#include "Math/GenVector/Transform3D.h"
+#include "TGeoMatrix.h"
+#include "TGeoNode.h"
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <vector>
+
+namespace geo {
+
+  namespace details {
+
+    //--------------------------------------------------------------------------
+    template <typename T>
+    struct TransformationMatrixConverter<AffineTransform<T>, ROOT::Math::Transform3D> {
+      static AffineTransform<T> convert(ROOT::Math::Transform3D const& trans)
+      {
+        double c[12];
+        trans.GetComponents(c);
+        return {T(c[0]),
+                T(c[1]),
+                T(c[2]),
+                T(c[3]),
+                T(c[4]),
+                T(c[5]),
+                T(c[6]),
+                T(c[7]),
+                T(c[8]),
+                T(c[9]),
+                T(c[10]),
+                T(c[11])};
+      }
+    };
+
+    /// The conversion goes through `ROOT::Math::Transform3D`, and rejects the
+    /// same matrices.
+    template <typename T>
+    struct TransformationMatrixConverter<AffineTransform<T>, TGeoMatrix> {
+      static AffineTransform<T> convert(TGeoMatrix const& trans)
+      {
+        return TransformationMatrixConverter<AffineTransform<T>, ROOT::Math::Transform3D>::convert(
+          convertTransformationMatrix<ROOT::Math::Transform3D>(trans));
+      }
+    };
+
+    template <typename T>
+    struct TransformationMatrixConverter<AffineTransform<T>, TGeoHMatrix>
+      : TransformationMatrixConverter<AffineTransform<T>, TGeoMatrix> {};
+
+    template <typename T>
+    struct TransformationMatrixConverter<ROOT::Math::Transform3D, AffineTransform<T>> {
+      static ROOT::Math::Transform3D convert(AffineTransform<T> const& trans)
+      {
+        double c[12];
+        trans.GetComponents(c);
+        return {c[0], c[1], c[2], c[3], c[4], c[5], c[6], c[7], c[8], c[9], c[10], c[11]};
+      }
+    };
+
+    //--------------------------------------------------------------------------
+    /// Chains the transformations of the nodes in [`begin`, `end`[.
+    template <typename Affine>
+    Affine affineTransformationFromPath(GeoNodeIterator_t begin, GeoNodeIterator_t end)
+    {
+      Affine matrix; // identity
+      for (auto iNode = begin; iNode != end; ++iNode)
+        matrix *= convertTransformationMatrix<Affine>(*((*iNode)->GetMatrix()));
+      return matrix;
+    }
+
+    //--------------------------------------------------------------------------
+
+  } // namespace details
+
+  //----------------------------------------------------------------------------
+  template <>
+  inline AffineTransformD transformationFromPath<AffineTransformD>(GeoNodeIterator_t begin,
+                                                                   GeoNodeIterator_t end)
+  {
+    return details::affineTransformationFromPath<AffineTransformD>(begin, end);
+  }
+
+  template <>
+  inline AffineTransformD transformationFromPath<AffineTransformD>(
+    std::vector<TGeoNode const*> const& path,
+    std::size_t depth)
+  {
+    return transformationFromPath<AffineTransformD>(path.begin(), path.begin() + depth + 1);
+  }
+
+  //----------------------------------------------------------------------------
+  /// @note The nodes are chained in double precision, then rounded.
+  template <>
+  inline AffineTransformF transformationFromPath<AffineTransformF>(GeoNodeIterator_t begin,
+                                                                   GeoNodeIterator_t end)
+  {
+    return AffineTransformF{details::affineTransformationFromPath<AffineTransformD>(begin, end)};
+  }
+
+  template <>
+  inline AffineTransformF transformationFromPath<AffineTransformF>(
+    std::vector<TGeoNode const*> const& path,
+    std::size_t depth)
+  {
+    return transformationFromPath<AffineTransformF>(path.begin(), path.begin() + depth + 1);
+  }
+
+  //----------------------------------------------------------------------------
+
+} // namespace geo
+
+#endif // LARCOREALG_GEOMETRY_AFFINELOCALTRANSFORMATION_H
@@ -0,0 +1,261 @@
+/**
+ * @file   larcorealg/Geometry/AffineTransform.h
+ * @brief  Plain 3x4 affine transformation matrix.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/AffineLocalTransformation.h`
+ * @ingroup Geometry
+ *
+ * This is a header only library, with no dependency on ROOT: the matrix can
+ * be used in constant expressions, and its transformations in CUDA or HIP
+ * device code.
+ */
+
+#ifndef LARCOREALG_GEOMETRY_AFFINETRANSFORM_H
+#define LARCOREALG_GEOMETRY_AFFINETRANSFORM_H
+
+// LArSoft libraries
+#include "larcorealg/Geometry/details/HostDevice.h" // LARCOREALG_HOST_DEVICE
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <type_traits>
+
+namespace geo {
+
+  /**
+   * @brief Affine transformation in 3D space, with its inverse.
+   * @tparam T type of the matrix elements (`double` or `float`)
+   * @ingroup Geometry
+   *
+   * The transformation of a point @f$ p @f$ is @f$ R p + t @f$, with
+   * @f$ R @f$ a 3x3 matrix and @f$ t @f$ a translation; vectors are only
+   * transformed by @f$ R @f$. The inverse transformation is computed on
+   * construction and stored, so that transformations in either directions
+   * cost the same. The matrix must be invertible.
+   *
+   * The object is plain data (trivially copyable), and all the operations are
+   * `constexpr` and `noexcept`.
+   *
+   * The interface of the transformations of points and vectors is the one of
+   * ROOT `TGeoMatrix` (`LocalToMaster()`, `MasterToLocal()`...), so that this
+   * class can be used as stored matrix of `geo::LocalTransformation`: the
+   * conversions from ROOT matrices and the construction from a ROOT geometry
+   * path are in `larcorealg/Geometry/AffineLocalTransformation.h`.
+   *
+   * Example:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * // rotation by 90 degrees around z, then translation by 5 cm on x
+   * constexpr geo::AffineTransform<double> trans{
+   *   0.0, -1.0, 0.0, 5.0,
+   *   1.0,  0.0, 0.0, 0.0,
+   *   0.0,  0.0, 1.0, 0.0
+   * };
+   * double const local[3] = { 1.0, 0.0, 0.0 };
+   * double world[3];
+   * trans.LocalToMaster(local, world); // world = { 5.0, 1.0, 0.0 }
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   */
+  template <typename T>
+  class AffineTransform {
+    static_assert(std::is_floating_point_v<T>, "AffineTransform requires a floating point type");
+
+  public:
+    using Scalar_t = T; ///< Type of the matrix elements.
+
+    /// Constructor: identity transformation.
+    constexpr AffineTransform() noexcept = default;
+
+    /**
+     * @brief Constructor: transformation with the specified components.
+     *
+     * The arguments are the three rows of the 3x4 matrix: each row has the
+     * three elements of the matrix @f$ R @f$ followed by the translation, as in
+     * the constructor of `ROOT::Math::Transform3D`.
+     */
+    constexpr AffineTransform(T xx,
+                              T xy,
+                              T xz,
+                              T dx,
+                              T yx,
+                              T yy,
+                              T yz,
+                              T dy,
+                              T zx,
+                              T zy,
+                              T zz,
+                              T dz) noexcept
+      : fDirect{{xx, xy, xz, yx, yy, yz, zx, zy, zz}, {dx, dy, dz}}, fInverse{invert(fDirect)}
+    {}
+
+    /// Constructor: converts a transformation with different precision.
+    template <typename U, typename = std::enable_if_t<!std::is_same_v<T, U>>>
+    constexpr explicit AffineTransform(AffineTransform<U> const& other) noexcept
+      : fDirect{convert(other.fDirect)}, fInverse{convert(other.fInverse)}
+    {}
+
+    /// Returns the element (`row`, `col`) of the 3x3 matrix @f$ R @f$.
+    constexpr T Rotation(std::size_t row, std::size_t col) const noexcept
+    {
+      return fDirect.rot[3 * row + col];
+    }
+
+    /// Returns the component `i` (`0` for _x_) of the translation.
+    constexpr T Translation(std::size_t i) const noexcept { return fDirect.shift[i]; }
+
+    /// Fills `data` with the 12 components, in the order of the constructor.
+    template <typename U>
+    constexpr void GetComponents(U* data) const noexcept
+    {
+      for (std::size_t row = 0; row < 3; ++row) {
+        for (std::size_t col = 0; col < 3; ++col)
+          *(data++) = fDirect.rot[3 * row + col];
+        *(data++) = fDirect.shift[row];
+      }
+    }
+
+    /// Returns the inverse transformation.
+    constexpr AffineTransform Inverse() const noexcept { return {fInverse, fDirect}; }
+
+    /// Returns the transformation applying first `other`, then this one.
+    constexpr AffineTransform operator*(AffineTransform const& other) const noexcept
+    {
+      return {compose(fDirect, other.fDirect), compose(other.fInverse, fInverse)};
+    }
+
+    /// Applies `other` before this transformation.
+    constexpr AffineTransform& operator*=(AffineTransform const& other) noexcept
+    {
+      return (*this = *this * other);
+    }
+
+    /// @name Transformations (`TGeoMatrix` interface)
+    /// @{
+
+    /// Transforms the point `local` into `master` (`[0]` _x_, `[1]` _y_, `[2]` _z_).
+    template <typename U>
+    LARCOREALG_HOST_DEVICE constexpr void LocalToMaster(U const* local, U* master) const noexcept
+    {
+      fDirect.applyPoint(local, master);
+    }
+
+    /// Transforms the vector `local` into `master` (no translation).
+    template <typename U>
+    LARCOREALG_HOST_DEVICE constexpr void LocalToMasterVect(U const* local,
+                                                            U* master) const noexcept
+    {
+      fDirect.applyVector(local, master);
+    }
+
+    /// Transforms the point `master` into `local` with the inverse transformation.
+    template <typename U>
+    LARCOREALG_HOST_DEVICE constexpr void MasterToLocal(U const* master, U* local) const noexcept
+    {
+      fInverse.applyPoint(master, local);
+    }
+
+    /// Transforms the vector `master` into `local` (no translation).
+    template <typename U>
+    LARCOREALG_HOST_DEVICE constexpr void MasterToLocalVect(U const* master,
+                                                            U* local) const noexcept
+    {
+      fInverse.applyVector(master, local);
+    }
+
+    /// @}
+
+  private:
+    template <typename U>
+    friend class AffineTransform;
+
+    /// One direction of the transformation.
+    struct Matrix_t {
+      T rot[9] = {T(1), T(0), T(0), T(0), T(1), T(0), T(0), T(0), T(1)}; ///< By rows.
+      T shift[3] = {T(0), T(0), T(0)};                                  ///< Translation.
+
+      template <typename U>
+      LARCOREALG_HOST_DEVICE constexpr void applyPoint(U const* in, U* out) const noexcept
+      {
+        for (std::size_t i = 0; i < 3; ++i)
+          out[i] = U(rot[3 * i] * in[0] + rot[3 * i + 1] * in[1] + rot[3 * i + 2] * in[2] +
+                     shift[i]);
+      }
+
+      template <typename U>
+      LARCOREALG_HOST_DEVICE constexpr void applyVector(U const* in, U* out) const noexcept
+      {
+        for (std::size_t i = 0; i < 3; ++i)
+          out[i] = U(rot[3 * i] * in[0] + rot[3 * i + 1] * in[1] + rot[3 * i + 2] * in[2]);
+      }
+    }; // Matrix_t
+
+    Matrix_t fDirect;  ///< Local to master transformation.
+    Matrix_t fInverse; ///< Master to local transformation.
+
+    constexpr AffineTransform(Matrix_t const& direct, Matrix_t const& inverse) noexcept
+      : fDirect{direct}, fInverse{inverse}
+    {}
+
+    /// Returns the inverse of `m`, via the adjugate matrix.
+    static constexpr Matrix_t invert(Matrix_t const& m) noexcept
+    {
+      T const* r = m.rot;
+      Matrix_t inv;
+      inv.rot[0] = r[4] * r[8] - r[5] * r[7];
+      inv.rot[1] = r[2] * r[7] - r[1] * r[8];
+      inv.rot[2] = r[1] * r[5] - r[2] * r[4];
+      inv.rot[3] = r[5] * r[6] - r[3] * r[8];
+      inv.rot[4] = r[0] * r[8] - r[2] * r[6];
+      inv.rot[5] = r[2] * r[3] - r[0] * r[5];
+      inv.rot[6] = r[3] * r[7] - r[4] * r[6];
+      inv.rot[7] = r[1] * r[6] - r[0] * r[7];
+      inv.rot[8] = r[0] * r[4] - r[1] * r[3];
+      T const invDet = T(1) / (r[0] * inv.rot[0] + r[1] * inv.rot[3] + r[2] * inv.rot[6]);
+      for (T& e : inv.rot)
+        e *= invDet;
+      // the point transformed to the origin: -R^-1 t
+      for (std::size_t i = 0; i < 3; ++i)
+        inv.shift[i] = -(inv.rot[3 * i] * m.shift[0] + inv.rot[3 * i + 1] * m.shift[1] +
+                         inv.rot[3 * i + 2] * m.shift[2]);
+      return inv;
+    }
+
+    /// Returns the transformation applying `b`, then `a`.
+    static constexpr Matrix_t compose(Matrix_t const& a, Matrix_t const& b) noexcept
+    {
+      Matrix_t c;
+      for (std::size_t i = 0; i < 3; ++i) {
+        for (std::size_t j = 0; j < 3; ++j)
+          c.rot[3 * i + j] = a.rot[3 * i] * b.rot[j] + a.rot[3 * i + 1] * b.rot[3 + j] +
+                             a.rot[3 * i + 2] * b.rot[6 + j];
+        c.shift[i] = a.rot[3 * i] * b.shift[0] + a.rot[3 * i + 1] * b.shift[1] +
+                     a.rot[3 * i + 2] * b.shift[2] + a.shift[i];
+      }
+      return c;
+    }
+
+    /// Converts a matrix with different precision.
+    template <typename M>
+    static constexpr Matrix_t convert(M const& m) noexcept
+    {
+      Matrix_t c;
+      for (std::size_t i = 0; i < 9; ++i)
+        c.rot[i] = T(m.rot[i]);
+      for (std::size_t i = 0; i < 3; ++i)
+        c.shift[i] = T(m.shift[i]);
+      return c;
+    }
+
+  }; // class AffineTransform
+
+  /// Affine transformation in double precision.
+  using AffineTransformD = AffineTransform<double>;
+
+  /// Affine transformation in single precision.
+  using AffineTransformF = AffineTransform<float>;
+
+  static_assert(std::is_trivially_copyable_v<AffineTransformD>);
+  static_assert(std::is_trivially_copyable_v<AffineTransformF>);
+
+} // namespace geo
+
+#endif // LARCOREALG_GEOMETRY_AFFINETRANSFORM_H
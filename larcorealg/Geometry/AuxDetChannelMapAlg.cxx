@@ -16,35 +16,61 @@
 namespace geo {
 
   //----------------------------------------------------------------------------
-  size_t AuxDetChannelMapAlg::NearestAuxDet(const double* point,
-                                            std::vector<geo::AuxDetGeo> const& auxDets,
-                                            double tolerance) const
+  void AuxDetChannelMapAlg::PrepareAuxDetIndex(std::vector<geo::AuxDetGeo> const& auxDets)
   {
-    double HalfCenterWidth = 0.;
-    double localPoint[3] = {0.};
+    fAuxDetIndex.build(auxDets);
+
+    // in index order, so that the first detector with a repeated name is kept
+    fNameToADGeoIndex.clear();
+    fNameToADGeoIndex.reserve(fADGeoToName.size());
+    for (auto const& [index, name] : fADGeoToName)
+      fNameToADGeoIndex.emplace(name, index);
+    fNIndexedNames = fADGeoToName.size();
+  }
 
-    for (size_t a = 0; a < auxDets.size(); ++a) {
+  //----------------------------------------------------------------------------
+  std::size_t AuxDetChannelMapAlg::MemoryUsage() const
+  {
+    return sizeof(AuxDetChannelMapAlg) + lar::util::heapMemory(fAuxDetIndex) +
+           lar::util::heapMemory(fADGeoToName) + lar::util::heapMemory(fNameToADGeo) +
+           lar::util::heapMemory(fADGeoToChannelAndSV) + lar::util::heapMemory(fNameToADGeoIndex);
+  }
 
-      auxDets[a].WorldToLocal(point, localPoint);
-
-      HalfCenterWidth = 0.5 * (auxDets[a].HalfWidth1() + auxDets[a].HalfWidth2());
-
-      if (localPoint[2] >= (-auxDets[a].Length() / 2 - tolerance) &&
-          localPoint[2] <= (auxDets[a].Length() / 2 + tolerance) &&
-          localPoint[1] >= (-auxDets[a].HalfHeight() - tolerance) &&
-          localPoint[1] <= (auxDets[a].HalfHeight() + tolerance) &&
-          // if AuxDet a is a box, then HalfSmallWidth = HalfWidth
-          localPoint[0] >= (-HalfCenterWidth +
-                            localPoint[2] * (HalfCenterWidth - auxDets[a].HalfWidth2()) /
-                              (0.5 * auxDets[a].Length()) -
-                            tolerance) &&
-          localPoint[0] <= (HalfCenterWidth -
-                            localPoint[2] * (HalfCenterWidth - auxDets[a].HalfWidth2()) /
-                              (0.5 * auxDets[a].Length()) +
-                            tolerance))
-        return a;
+  //----------------------------------------------------------------------------
+  size_t AuxDetChannelMapAlg::FindAuxDet(const double* point,
+                                         std::vector<geo::AuxDetGeo> const& auxDets,
+                                         double tolerance) const
+  {
+    if (fAuxDetIndex.indexes(auxDets)) return fAuxDetIndex.findAuxDet(point, tolerance);
 
+    for (size_t a = 0; a < auxDets.size(); ++a) {
+      if (geo::AuxDetSpatialIndex::contains(auxDets[a], point, tolerance)) return a;
     } // for loop over AudDet a
+    return geo::AuxDetSpatialIndex::NoIndex;
+  }
+
+  //----------------------------------------------------------------------------
+  size_t AuxDetChannelMapAlg::FindSensitiveAuxDet(const double* point,
+                                                  std::vector<geo::AuxDetGeo> const& auxDets,
+                                                  size_t ad,
+                                                  double tolerance) const
+  {
+    if (fAuxDetIndex.indexes(auxDets)) return fAuxDetIndex.findSensitive(point, ad, tolerance);
+
+    geo::AuxDetGeo const& adg = auxDets[ad];
+    for (size_t a = 0; a < adg.NSensitiveVolume(); ++a) {
+      if (geo::AuxDetSpatialIndex::contains(adg.SensitiveVolume(a), point, tolerance)) return a;
+    } // for loop over AuxDetSensitive a
+    return geo::AuxDetSpatialIndex::NoIndex;
+  }
+
+  //----------------------------------------------------------------------------
+  size_t AuxDetChannelMapAlg::NearestAuxDet(const double* point,
+                                            std::vector<geo::AuxDetGeo> const& auxDets,
+                                            double tolerance) const
+  {
+    size_t const a = FindAuxDet(point, auxDets, tolerance);
+    if (a != geo::AuxDetSpatialIndex::NoIndex) return a;
 
     // throw an exception because we couldn't find the sensitive volume
     throw cet::exception("AuxDetChannelMapAlg") << "Can't find AuxDet for position (" << point[0]
@@ -59,35 +85,10 @@ namespace geo {
                                                      size_t& ad,
                                                      double tolerance) const
   {
-    double HalfCenterWidth = 0.;
-    double localPoint[3] = {0.};
-
     ad = this->NearestAuxDet(point, auxDets, tolerance);
 
-    geo::AuxDetGeo const& adg = auxDets[ad];
-
-    for (size_t a = 0; a < adg.NSensitiveVolume(); ++a) {
-
-      geo::AuxDetSensitiveGeo const& adsg = adg.SensitiveVolume(a);
-      adsg.WorldToLocal(point, localPoint);
-
-      HalfCenterWidth = 0.5 * (adsg.HalfWidth1() + adsg.HalfWidth2());
-
-      if (localPoint[2] >= -(adsg.Length() / 2 + tolerance) &&
-          localPoint[2] <= adsg.Length() / 2 + tolerance &&
-          localPoint[1] >= -(adsg.HalfHeight() + tolerance) &&
-          localPoint[1] <= adsg.HalfHeight() + tolerance &&
-          // if AuxDet a is a box, then HalfSmallWidth = HalfWidth
-          localPoint[0] >=
-            -HalfCenterWidth +
-              localPoint[2] * (HalfCenterWidth - adsg.HalfWidth2()) / (0.5 * adsg.Length()) -
-              tolerance &&
-          localPoint[0] <=
-            HalfCenterWidth -
-              localPoint[2] * (HalfCenterWidth - adsg.HalfWidth2()) / (0.5 * adsg.Length()) +
-              tolerance)
-        return a;
-    } // for loop over AuxDetSensitive a
+    size_t const a = FindSensitiveAuxDet(point, auxDets, ad, tolerance);
+    if (a != geo::AuxDetSpatialIndex::NoIndex) return a;
 
     // throw an exception because we couldn't find the sensitive volume
     throw cet::exception("Geometry") << "Can't find AuxDetSensitive for position (" << point[0]
@@ -101,16 +102,9 @@ namespace geo {
                                               std::string const& detName,
                                               uint32_t const& /*channel*/) const
   {
-    // loop over the map of AuxDet names to Geo object numbers to determine which auxdet
-    // we have.  If no name in the map matches the provided string, throw an exception;
     // the list of AuxDetGeo passed as argument is ignored!
     // Note that fADGeoToName must have been updated by a derived class.
-    for (auto itr : fADGeoToName)
-      if (itr.second.compare(detName) == 0) return itr.first;
-
-    throw cet::exception("Geometry") << "No AuxDetGeo matching name: " << detName;
-
-    return UINT_MAX;
+    return AuxDetNameToIndex(detName);
   }
 
   //----------------------------------------------------------------------------
@@ -122,26 +116,51 @@ namespace geo {
     uint32_t const& channel) const
   {
     size_t adGeoIdx = this->ChannelToAuxDet(auxDets, detName, channel);
+    return std::make_pair(adGeoIdx, SensitiveAuxDetIndex(adGeoIdx, channel));
+  }
 
-    // look for the index of the sensitive volume for the given channel
-    if (fADGeoToChannelAndSV.count(adGeoIdx) > 0) {
-
-      auto itr = fADGeoToChannelAndSV.find(adGeoIdx);
+  //----------------------------------------------------------------------------
+  std::size_t AuxDetChannelMapAlg::AuxDetNameToIndex(std::string_view detName) const
+  {
+    if (fNIndexedNames == fADGeoToName.size()) {
+      auto const itr = fNameToADGeoIndex.find(detName);
+      if (itr != fNameToADGeoIndex.end()) return itr->second;
+    }
+    else {
+      // loop over the map of AuxDet names to Geo object numbers to determine which auxdet
+      // we have.  If no name in the map matches the provided string, throw an exception
+      for (auto const& itr : fADGeoToName)
+        if (itr.second == detName) return itr.first;
+    }
 
-      // get the vector of channels to AuxDetSensitiveGeo index
-      if (channel < itr->second.size())
-        return std::make_pair(adGeoIdx, itr->second[channel].second);
+    throw cet::exception("Geometry") << "No AuxDetGeo matching name: " << detName;
+  }
 
+  //----------------------------------------------------------------------------
+  std::size_t AuxDetChannelMapAlg::SensitiveAuxDetIndex(std::size_t ad, uint32_t channel) const
+  {
+    // look for the index of the sensitive volume for the given channel
+    auto const itr = fADGeoToChannelAndSV.find(ad);
+    if (itr == fADGeoToChannelAndSV.end()) {
       throw cet::exception("Geometry")
-        << "Given AuxDetSensitive channel, " << channel
-        << ", cannot be found in vector associated to AuxDetGeo index: " << adGeoIdx
-        << ". Vector has size " << itr->second.size();
+        << "Given AuxDetGeo with index " << ad
+        << " does not correspond to any vector of sensitive volumes";
     }
 
-    throw cet::exception("Geometry") << "Given AuxDetGeo with index " << adGeoIdx
-                                     << " does not correspond to any vector of sensitive volumes";
+    // get the vector of channels to AuxDetSensitiveGeo index
+    if (channel < itr->second.size()) return itr->second[channel].second;
+
+    throw cet::exception("Geometry")
+      << "Given AuxDetSensitive channel, " << channel
+      << ", cannot be found in vector associated to AuxDetGeo index: " << ad
+      << ". Vector has size " << itr->second.size();
+  }
 
-    return std::make_pair(adGeoIdx, UINT_MAX);
+  //----------------------------------------------------------------------------
+  std::size_t AuxDetChannelMapAlg::NAuxDetChannels(std::size_t ad) const
+  {
+    auto const itr = fADGeoToChannelAndSV.find(ad);
+    return (itr == fADGeoToChannelAndSV.end()) ? 0U : itr->second.size();
   }
 
 }
@@ -8,6 +8,10 @@
 #ifndef GEO_AUXDETCHANNELMAPALG_H
 #define GEO_AUXDETCHANNELMAPALG_H
 
+// LArSoft libraries
+#include "larcorealg/CoreUtils/MemoryUsage.h"
+#include "larcorealg/Geometry/AuxDetSpatialIndex.h"
+
 // ROOT libraries
 #include "TVector3.h"
 
@@ -16,6 +20,8 @@
 #include <cstdint>
 #include <map>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 
 namespace geo {
@@ -35,6 +41,31 @@ namespace geo {
     virtual void Initialize(AuxDetGeometryData_t& geodata) = 0;
     virtual void Uninitialize() = 0;
 
+    /**
+     * @brief Returns an estimate of the memory used by this object [bytes]
+     *
+     * This implementation includes the tables of this base class only.
+     * Implementations with their own tables should override it, adding them
+     * and their own size to the value from this implementation minus
+     * `sizeof(AuxDetChannelMapAlg)`.
+     */
+    virtual std::size_t MemoryUsage() const;
+
+    /**
+     * @brief Builds the indices used by `NearestAuxDet()` and `ChannelToAuxDet()`
+     * @param auxDets the auxiliary detectors the mapping has been initialized with
+     *
+     * With the spatial index, `NearestAuxDet()` and `NearestSensitiveAuxDet()`
+     * only test the detectors and sensitive volumes close to the point, instead
+     * of all of them; the index is used only when those methods are given the
+     * same list of detectors it was built from.
+     * The name index lets `AuxDetNameToIndex()` (and `ChannelToAuxDet()`) find
+     * a detector by its name in `fADGeoToName` without a scan of all of them;
+     * it must be prepared again if `fADGeoToName` changes.
+     * `geo::AuxDetGeometryCore` calls this method right after `Initialize()`.
+     */
+    void PrepareAuxDetIndex(std::vector<geo::AuxDetGeo> const& auxDets);
+
     // method returns the entry in the sorted AuxDetGeo vector so that the
     // Geometry in turn can return that object
     virtual size_t NearestAuxDet(const double* point,
@@ -44,6 +75,33 @@ namespace geo {
                                           std::vector<geo::AuxDetGeo> const& auxDets,
                                           size_t& ad,
                                           double tolerance = 0) const;
+    /**
+     * @brief Returns the auxiliary detector containing `point`, without throwing
+     * @param point world coordinates of the point (_x_, _y_, _z_)
+     * @param auxDets the sorted auxiliary detectors
+     * @param tolerance volumes are expanded by this amount on each side
+     * @return index of the detector in `auxDets`, `AuxDetLocation::InvalidIndex` if none
+     *
+     * This is the test of the default `NearestAuxDet()`, which throws instead
+     * when no detector contains the point.
+     */
+    size_t FindAuxDet(const double* point,
+                      std::vector<geo::AuxDetGeo> const& auxDets,
+                      double tolerance = 0) const;
+
+    /**
+     * @brief Returns the sensitive volume containing `point`, without throwing
+     * @param point world coordinates of the point (_x_, _y_, _z_)
+     * @param auxDets the sorted auxiliary detectors
+     * @param ad index of the detector in `auxDets` (e.g. from `FindAuxDet()`)
+     * @param tolerance volumes are expanded by this amount on each side
+     * @return index of the volume in the detector, `AuxDetLocation::InvalidIndex` if none
+     */
+    size_t FindSensitiveAuxDet(const double* point,
+                               std::vector<geo::AuxDetGeo> const& auxDets,
+                               size_t ad,
+                               double tolerance = 0) const;
+
     virtual size_t ChannelToAuxDet(std::vector<geo::AuxDetGeo> const& auxDets,
                                    std::string const& detName,
                                    uint32_t const& channel) const;
@@ -52,6 +110,30 @@ namespace geo {
       std::string const& detName,
       uint32_t const& channel) const;
 
+    /**
+     * @brief Returns the index of the auxiliary detector with the specified name
+     * @param detName name of the auxiliary detector
+     * @return the index of the detector in the sorted `AuxDetGeo` vector
+     * @throws cet::exception (category: "Geometry") if no detector has that name
+     *
+     * The index can be reused with `SensitiveAuxDetIndex()` for all the
+     * channels of the same detector.
+     */
+    std::size_t AuxDetNameToIndex(std::string_view detName) const;
+
+    /**
+     * @brief Returns the index of the sensitive volume read by a channel
+     * @param ad index of the auxiliary detector (e.g. from `AuxDetNameToIndex()`)
+     * @param channel number of the channel within that auxiliary detector
+     * @return the index of the sensitive volume within the detector
+     * @throws cet::exception (category: "Geometry") if the channel is unknown
+     */
+    std::size_t SensitiveAuxDetIndex(std::size_t ad, uint32_t channel) const;
+
+    /// Returns the number of channels of the auxiliary detector with index `ad`
+    /// (`0` if unknown).
+    std::size_t NAuxDetChannels(std::size_t ad) const;
+
     // Experiments must implement these method. It accounts for auxiliary detectors like
     // Multiwire proportional chambers where there is only a single sensitive volume, but
     // multiple channels running through that volume.
@@ -66,12 +148,19 @@ namespace geo {
       std::vector<geo::AuxDetGeo> const& auxDets) const = 0;
 
   protected:
+    geo::AuxDetSpatialIndex fAuxDetIndex; ///< Index of the detectors by position.
+
     std::map<size_t, std::string> fADGeoToName; ///< map the AuxDetGeo index to the name
     std::map<std::string, size_t> fNameToADGeo; ///< map the names to the AuxDetGeo index
     std::map<size_t, std::vector<chanAndSV>>
       fADGeoToChannelAndSV; ///< map the AuxDetGeo index to a vector of
                             ///< pairs corresponding to the channel and
                             ///< AuxDetSensitiveGeo index
+
+  private:
+    /// Index of each name in `fADGeoToName`, viewing the names stored there.
+    std::unordered_map<std::string_view, std::size_t> fNameToADGeoIndex;
+    std::size_t fNIndexedNames = 0U; ///< Size of `fADGeoToName` when indexed.
   };
 }
 #endif // GEO_AUXDETCHANNELMAPALG_H
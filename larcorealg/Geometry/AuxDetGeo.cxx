@@ -93,21 +93,7 @@ namespace geo {
   std::size_t AuxDetGeo::FindSensitiveVolume(geo::Point_t const& point) const
   {
     for (std::size_t a = 0; a < fSensitive.size(); ++a) {
-      auto const& sensVol = SensitiveVolume(a);
-
-      auto const local = sensVol.toLocalCoords(point);
-
-      double const HalfCenterWidth = sensVol.HalfCenterWidth();
-
-      double const deltaWidth =
-        local.Z() * (HalfCenterWidth - sensVol.HalfWidth2()) / sensVol.HalfLength();
-
-      if (local.Z() >= -sensVol.HalfLength() && local.Z() <= sensVol.HalfLength() &&
-          local.Y() >= -sensVol.HalfHeight() && local.Y() <= sensVol.HalfHeight() &&
-          // if SensitiveVolume a is a box, then HalfSmallWidth = HalfWidth
-          local.X() >= -HalfCenterWidth + deltaWidth && local.X() <= HalfCenterWidth - deltaWidth)
-        return a;
-
+      if (SensitiveVolume(a).ContainsPosition(point)) return a;
     } // for loop over AuxDetSensitive a
 
     throw cet::exception("AuxDetGeo")
@@ -147,6 +133,18 @@ namespace geo {
     sorter.SortAuxDetSensitive(fSensitive);
   }
 
+  //......................................................................
+  void AuxDetGeo::FillMemoryUsage(lar::util::MemoryUsageReport& report) const
+  {
+    report.add("AuxDetGeo",
+               sizeof(*this) +
+                 (fSensitive.capacity() - fSensitive.size()) * sizeof(AuxDetSensitiveGeo));
+    report.add("AuxDetSensitiveGeo",
+               fSensitive.size() * sizeof(AuxDetSensitiveGeo) +
+                 lar::util::elementHeapMemory(fSensitive.begin(), fSensitive.end()),
+               fSensitive.size());
+  } // AuxDetGeo::FillMemoryUsage()
+
   //......................................................................
   std::string AuxDetGeo::AuxDetInfo(std::string indent /* = "" */,
                                     unsigned int verbosity /* = 1 */) const
@@ -181,6 +179,9 @@ namespace geo {
       fLength = 2.0 * ((TGeoBBox*)fTotalVolume->GetShape())->GetDZ();
       fHalfWidth2 = fHalfWidth1;
     }
+
+    fShape = details::TrapezoidKernel::make(
+      fTrans.WorldToLocalKernel(), fHalfWidth1, fHalfWidth2, fHalfHeight, fLength);
   } // AuxDetGeo::InitShapeSize()
 
   //......................................................................
@@ -10,11 +10,13 @@
 #define LARCOREALG_GEOMETRY_AUXDETGEO_H
 
 // LArSoft libraries
+#include "larcorealg/CoreUtils/MemoryUsage.h"
 #include "larcorealg/CoreUtils/RealComparisons.h"
 #include "larcorealg/Geometry/AuxDetSensitiveGeo.h"
 #include "larcorealg/Geometry/GeoVectorLocalTransformation.h"
 #include "larcorealg/Geometry/LocalTransformationGeo.h"
 #include "larcorealg/Geometry/TransformationMatrix.h"
+#include "larcorealg/Geometry/details/TrapezoidKernel.h"
 #include "larcoreobj/SimpleTypesAndConstants/geo_vectors.h"
 
 // ROOT libraries
@@ -102,6 +104,46 @@ namespace geo {
     const TGeoVolume* TotalVolume() const { return fTotalVolume; }
     /// @}
 
+    /// @{
+    /**
+     * @name Containment
+     *
+     * The tests use the shape parameters and the world-to-local transformation
+     * precomputed at construction (see `ShapeKernel()`). A `tolerance` expands
+     * the volume by that amount on each side, in the local frame.
+     */
+
+    /// Returns whether the point `local` (local frame) is in this detector.
+    bool ContainsLocal(double const* local, double tolerance = 0.0) const
+    {
+      return fShape.containsLocal(local, tolerance);
+    }
+
+    /// Returns whether the point `local` (local frame) is in this detector.
+    bool ContainsLocal(LocalPoint_t const& local, double tolerance = 0.0) const
+    {
+      double const coords[3] = {local.X(), local.Y(), local.Z()};
+      return ContainsLocal(coords, tolerance);
+    }
+
+    /// Returns whether the point `world` (world frame) is in this detector.
+    bool ContainsPosition(double const* world, double tolerance = 0.0) const
+    {
+      return fShape.contains(world, tolerance);
+    }
+
+    /// Returns whether `point` (world frame) is in this detector.
+    bool ContainsPosition(geo::Point_t const& point, double tolerance = 0.0) const
+    {
+      double const world[3] = {point.X(), point.Y(), point.Z()};
+      return ContainsPosition(world, tolerance);
+    }
+
+    /// Returns the shape and world-to-local transformation, ready for use.
+    geo::details::TrapezoidKernel const& ShapeKernel() const { return fShape; }
+
+    /// @}
+
     //@{
     /// Returns the distance of `point` from the center of the detector.
     geo::Length_t DistanceToPoint(geo::Point_t const& point) const
@@ -187,6 +229,15 @@ namespace geo {
 
     void SortSubVolumes(geo::GeoObjectSorter const& sorter);
 
+    /**
+     * @brief Adds the memory used by this auxiliary detector to `report`.
+     * @param report the report to be updated
+     *
+     * The detector is added as `"AuxDetGeo"` and its sensitive volumes as
+     * `"AuxDetSensitiveGeo"`.
+     */
+    void FillMemoryUsage(lar::util::MemoryUsageReport& report) const;
+
     /**
      * @brief Prints information about this auxiliary detector.
      * @tparam Stream type of output stream to use
@@ -233,6 +284,8 @@ namespace geo {
     double fHalfWidth1;             ///< 1st half width of volume, at -z/2 in local coordinates
     double fHalfWidth2;             ///< 2nd half width (width1==width2 for boxes), at +z/2
     double fHalfHeight;             ///< half height of volume
+    /// Shape and world-to-local transformation, precomputed by `InitShapeSize()`.
+    geo::details::TrapezoidKernel fShape;
     std::vector<AuxDetSensitiveGeo> fSensitive; ///< sensitive volumes in the detector
 
     /// Extracts the size of the detector from the geometry information.
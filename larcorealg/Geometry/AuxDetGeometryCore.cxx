@@ -15,19 +15,20 @@
 #include "larcorealg/Geometry/GeoNodePath.h"
 #include "larcorealg/Geometry/GeometryBuilder.h"
 #include "larcorealg/Geometry/GeometryBuilderStandard.h"
+#include "larcorealg/Geometry/GeometryImport.h"
 
 // Framework includes
 #include "cetlib_except/exception.h"
 #include "fhiclcpp/types/Table.h"
 #include "messagefacility/MessageLogger/MessageLogger.h"
 
-// ROOT includes
-#include <TGeoManager.h>
-
 // C/C++ includes
 #include <algorithm> // std::for_each(), std::transform()
+#include <array>
+#include <cassert>
 #include <cctype>    // ::tolower()
 #include <cstddef>   // size_t
+#include <limits>    // std::numeric_limits<>
 #include <memory>    // std::default_deleter<>
 #include <string>
 #include <utility> // std::swap()
@@ -42,15 +43,95 @@ namespace geo {
     , fBuilderParameters(pset.get<fhicl::ParameterSet>("Builder", fhicl::ParameterSet()))
   {
     std::transform(fDetectorName.begin(), fDetectorName.end(), fDetectorName.begin(), ::tolower);
+
+    if (pset.has_key("QueryMetrics")) {
+      auto const metrics = pset.get<fhicl::ParameterSet>("QueryMetrics");
+      lar::util::QueryMetrics::Config_t config;
+      config.timing = metrics.get<bool>("Timing", config.timing);
+      EnableQueryMetrics(config);
+    }
+  }
+
+  //......................................................................
+  AuxDetGeometryCore::~AuxDetGeometryCore()
+  {
+    if (fMetrics) fMetrics->print(mf::LogInfo("AuxDetGeometryCore"));
   }
 
+  //......................................................................
+  void AuxDetGeometryCore::EnableQueryMetrics(lar::util::QueryMetrics::Config_t const& config)
+  {
+    // names in the order of `Query_t`
+    std::vector<std::string> names{"FindAuxDetAtPosition",
+                                   "FindAuxDetSensitiveAtPosition",
+                                   "PositionToAuxDetChannel",
+                                   "PositionsToAuxDetChannels",
+                                   "ChannelToAuxDetSensitive",
+                                   "FindAuxDetByName"};
+    assert(names.size() == static_cast<std::size_t>(Query_t::NQueries));
+    fMetrics = std::make_unique<lar::util::QueryMetrics>(std::move(names), config);
+  }
+
+  //......................................................................
+  lar::util::MemoryUsageReport AuxDetGeometryCore::MemoryUsage() const
+  {
+    lar::util::MemoryUsageReport report;
+
+    AuxDetList_t const& auxDets = AuxDets();
+    report.add("AuxDetGeometryCore",
+               sizeof(*this) + (auxDets.capacity() - auxDets.size()) * sizeof(AuxDetGeo) +
+                 lar::util::heapMemory(fDetectorName) + lar::util::heapMemory(fGDMLfile) +
+                 lar::util::heapMemory(fROOTfile) + lar::util::heapMemory(fMetrics) +
+                 lar::util::heapMemory(fAuxDetChannelOffsets) +
+                 lar::util::heapMemory(fAuxDetChannelPositions) +
+                 lar::util::heapMemory(fAuxDetChannelAxes));
+    for (AuxDetGeo const& auxDet : auxDets)
+      auxDet.FillMemoryUsage(report);
+    if (fChannelMapAlg) report.add("AuxDetChannelMapAlg", fChannelMapAlg->MemoryUsage());
+
+    return report;
+  } // AuxDetGeometryCore::MemoryUsage()
+
   //......................................................................
   void AuxDetGeometryCore::ApplyChannelMap(std::unique_ptr<geo::AuxDetChannelMapAlg> pChannelMap)
   {
     pChannelMap->Initialize(fGeoData);
+    pChannelMap->PrepareAuxDetIndex(AuxDets());
     fChannelMapAlg = move(pChannelMap);
+    BuildAuxDetChannelTables();
   }
 
+  //......................................................................
+  void AuxDetGeometryCore::BuildAuxDetChannelTables()
+  {
+    AuxDetList_t const& auxDets = AuxDets();
+    fAuxDetChannelOffsets.assign(1U, 0U);
+    fAuxDetChannelOffsets.reserve(auxDets.size() + 1U);
+    for (std::size_t ad = 0; ad < auxDets.size(); ++ad) {
+      fAuxDetChannelOffsets.push_back(fAuxDetChannelOffsets.back() +
+                                      fChannelMapAlg->NAuxDetChannels(ad));
+    }
+
+    fAuxDetChannelPositions.clear();
+    fAuxDetChannelAxes.clear();
+    fAuxDetChannelPositions.reserve(fAuxDetChannelOffsets.back());
+    fAuxDetChannelAxes.reserve(fAuxDetChannelOffsets.back());
+    for (std::size_t ad = 0; ad < auxDets.size(); ++ad) {
+      AuxDetGeo const& auxDet = auxDets[ad];
+      std::string const name = auxDet.Name();
+      auto const nChannels = static_cast<uint32_t>(fAuxDetChannelOffsets[ad + 1U] -
+                                                   fAuxDetChannelOffsets[ad]);
+      for (uint32_t channel = 0; channel < nChannels; ++channel) {
+        TVector3 const pos = fChannelMapAlg->AuxDetChannelToPosition(channel, name, auxDets);
+        fAuxDetChannelPositions.emplace_back(pos.X(), pos.Y(), pos.Z());
+        AuxDetSensitiveGeo const& sensitive =
+          auxDet.SensitiveVolume(fChannelMapAlg->SensitiveAuxDetIndex(ad, channel));
+        fAuxDetChannelAxes.push_back(
+          sensitive.toWorldCoords(AuxDetSensitiveGeo::LocalVector_t{0.0, 0.0, 1.0}));
+      } // for channels
+    }   // for detectors
+  } // AuxDetGeometryCore::BuildAuxDetChannelTables()
+
   //......................................................................
   void AuxDetGeometryCore::LoadGeometryFile(std::string gdmlfile, std::string rootfile)
   {
@@ -63,25 +144,36 @@ namespace geo {
       throw cet::exception("AuxDetGeometryCore") << "No ROOT Geometry file specified!\n";
     }
 
-    ClearGeometry();
+    // if the GeometryCore object already imported the file, the same
+    // geometry is used
+    LoadImportedGeometry(gdmlfile, rootfile, geo::ImportROOTGeometry(rootfile));
+
+  } // AuxDetGeometryCore::LoadGeometryFile()
+
+  //......................................................................
+  void AuxDetGeometryCore::LoadImportedGeometry(std::string gdmlfile,
+                                                std::string rootfile,
+                                                TGeoNode const* topNode)
+  {
+
+    if (gdmlfile.empty()) {
+      throw cet::exception("AuxDetGeometryCore") << "No GDML Geometry file specified!\n";
+    }
+
+    if (rootfile.empty()) {
+      throw cet::exception("AuxDetGeometryCore") << "No ROOT Geometry file specified!\n";
+    }
 
-    // Open the GDML file, and convert it into ROOT TGeoManager format.
-    // try to be efficient - if the GeometryCore object already imported
-    // the file, then the gGeoManager will be non-null.  If not, import it.
-    // Then lock the gGeoManager to prevent future imports.
-    if (!gGeoManager) {
-      // [20210701, petrillo@slac.stanford.edu]
-      // same code, same comment as in `geo::GeometryCore::LoadGeometryFile()`.
-      TGeoManager::LockDefaultUnits(false);
-      TGeoManager::SetDefaultUnits(TGeoManager::kRootUnits);
-      TGeoManager::LockDefaultUnits(true);
-      TGeoManager::Import(rootfile.c_str());
-      gGeoManager->LockGeometry();
+    if (!topNode) {
+      throw cet::exception("AuxDetGeometryCore")
+        << "No ROOT geometry imported from '" << rootfile << "'!\n";
     }
 
+    ClearGeometry();
+
     geo::GeometryBuilderStandard builder(
       fhicl::Table<geo::GeometryBuilderStandard::Config>(fBuilderParameters, {"tool_type"})());
-    geo::GeoNodePath path{gGeoManager->GetTopNode()};
+    geo::GeoNodePath path{topNode};
 
     AuxDets() = builder.extractAuxiliaryDetectors(path);
 
@@ -91,10 +183,16 @@ namespace geo {
     mf::LogInfo("AuxDetGeometryCore") << "New detector geometry loaded from "
                                       << "\n\t" << fROOTfile << "\n\t" << fGDMLfile << "\n";
 
-  } // AuxDetGeometryCore::LoadGeometryFile()
+  } // AuxDetGeometryCore::LoadImportedGeometry()
 
   //......................................................................
-  void AuxDetGeometryCore::ClearGeometry() { AuxDets().clear(); }
+  void AuxDetGeometryCore::ClearGeometry()
+  {
+    AuxDets().clear();
+    fAuxDetChannelOffsets.clear();
+    fAuxDetChannelPositions.clear();
+    fAuxDetChannelAxes.clear();
+  }
 
   //......................................................................
   unsigned int AuxDetGeometryCore::NAuxDetSensitive(size_t const& aid) const
@@ -127,6 +225,7 @@ namespace geo {
   unsigned int AuxDetGeometryCore::FindAuxDetAtPosition(double const worldPos[3],
                                                         double tolerance) const
   {
+    auto const query = StartQuery(Query_t::FindAuxDetAtPosition);
     return fChannelMapAlg->NearestAuxDet(worldPos, AuxDets(), tolerance);
   }
 
@@ -147,6 +246,7 @@ namespace geo {
                                                          size_t& sv,
                                                          double tolerance) const
   {
+    auto const query = StartQuery(Query_t::FindAuxDetSensitiveAtPosition);
     adg = this->FindAuxDetAtPosition(worldPos, tolerance);
     sv = fChannelMapAlg->NearestSensitiveAuxDet(worldPos, AuxDets(), adg, tolerance);
   }
@@ -167,9 +267,39 @@ namespace geo {
                                                        size_t& ad,
                                                        size_t& sv) const
   {
+    auto const query = StartQuery(Query_t::PositionToAuxDetChannel);
     return fChannelMapAlg->PositionToAuxDetChannel(worldLoc, AuxDets(), ad, sv);
   }
 
+  //......................................................................
+  void AuxDetGeometryCore::PositionsToAuxDetChannels(
+    util::span<geo::Point_t const*> points,
+    util::span<geo::AuxDetLocation*> locations) const
+  {
+    auto const query = StartQuery(Query_t::PositionsToAuxDetChannels);
+    if (locations.size() < points.size()) {
+      throw cet::exception("AuxDetGeometryCore")
+        << "PositionsToAuxDetChannels(): " << points.size() << " points but room for only "
+        << locations.size() << " locations\n";
+    }
+
+    auto iLocation = locations.begin();
+    for (geo::Point_t const& point : points) {
+      geo::AuxDetLocation& location = *iLocation++;
+      location = {};
+      // BUG the double brace syntax is required to work around clang bug 21629
+      // (https://bugs.llvm.org/show_bug.cgi?id=21629)
+      std::array<double, 3U> const worldPos = {{point.X(), point.Y(), point.Z()}};
+      std::size_t const ad = fChannelMapAlg->FindAuxDet(worldPos.data(), AuxDets());
+      if (ad == geo::AuxDetLocation::InvalidIndex) continue;
+      if (fChannelMapAlg->FindSensitiveAuxDet(worldPos.data(), AuxDets(), ad) ==
+          geo::AuxDetLocation::InvalidIndex)
+        continue;
+      location.channel = fChannelMapAlg->PositionToAuxDetChannel(
+        worldPos.data(), AuxDets(), location.auxDet, location.sensitive);
+    } // for
+  } // AuxDetGeometryCore::PositionsToAuxDetChannels()
+
   //......................................................................
   TVector3 AuxDetGeometryCore::AuxDetChannelToPosition(uint32_t const& channel,
                                                        std::string const& auxDetName) const
@@ -190,10 +320,75 @@ namespace geo {
     std::string const& auxDetName,
     uint32_t const& channel) const
   {
+    auto const query = StartQuery(Query_t::ChannelToAuxDetSensitive);
     auto idx = fChannelMapAlg->ChannelToSensitiveAuxDet(AuxDets(), auxDetName, channel);
     return this->AuxDet(idx.first).SensitiveVolume(idx.second);
   }
 
   //......................................................................
+  std::size_t AuxDetGeometryCore::FindAuxDetByName(std::string_view auxDetName) const
+  {
+    auto const query = StartQuery(Query_t::FindAuxDetByName);
+    return fChannelMapAlg->AuxDetNameToIndex(auxDetName);
+  }
+
+  //......................................................................
+  const AuxDetSensitiveGeo& AuxDetGeometryCore::ChannelToAuxDetSensitive(std::size_t ad,
+                                                                         uint32_t channel) const
+  {
+    auto const query = StartQuery(Query_t::ChannelToAuxDetSensitive);
+    return AuxDet(ad).SensitiveVolume(fChannelMapAlg->SensitiveAuxDetIndex(ad, channel));
+  }
+
+  //......................................................................
+  unsigned int AuxDetGeometryCore::NAuxDetChannels(std::size_t ad) const
+  {
+    if (ad + 1U >= fAuxDetChannelOffsets.size()) return 0U;
+    return fAuxDetChannelOffsets[ad + 1U] - fAuxDetChannelOffsets[ad];
+  }
+
+  //......................................................................
+  geo::Point_t AuxDetGeometryCore::AuxDetChannelPosition(std::size_t ad, uint32_t channel) const
+  {
+    return fAuxDetChannelPositions[AuxDetChannelTableIndex(ad, channel)];
+  }
+
+  //......................................................................
+  geo::Vector_t AuxDetGeometryCore::AuxDetChannelAxis(std::size_t ad, uint32_t channel) const
+  {
+    return fAuxDetChannelAxes[AuxDetChannelTableIndex(ad, channel)];
+  }
+
+  //......................................................................
+  void AuxDetGeometryCore::AuxDetChannelPositions(
+    util::span<geo::AuxDetLocation const*> locations,
+    util::span<geo::Point_t*> positions) const
+  {
+    if (positions.size() < locations.size()) {
+      throw cet::exception("AuxDetGeometryCore")
+        << "AuxDetChannelPositions(): " << locations.size() << " locations but room for only "
+        << positions.size() << " positions\n";
+    }
+
+    double const nan = std::numeric_limits<double>::quiet_NaN();
+    auto iPosition = positions.begin();
+    for (geo::AuxDetLocation const& location : locations) {
+      *iPosition++ = (location.channel == geo::AuxDetLocation::InvalidChannel) ?
+                       geo::Point_t{nan, nan, nan} :
+                       fAuxDetChannelPositions[AuxDetChannelTableIndex(location.auxDet,
+                                                                       location.channel)];
+    }
+  } // AuxDetGeometryCore::AuxDetChannelPositions()
+
+  //......................................................................
+  std::size_t AuxDetGeometryCore::AuxDetChannelTableIndex(std::size_t ad, uint32_t channel) const
+  {
+    if (channel < NAuxDetChannels(ad)) return fAuxDetChannelOffsets[ad] + channel;
+    throw cet::exception("Geometry")
+      << "Channel " << channel << " of AuxDetGeo with index " << ad << " is not known ("
+      << NAuxDetChannels(ad) << " channels)\n";
+  }
+
+  //......................................................................
 
 } // namespace geo
@@ -9,8 +9,13 @@
 #define GEO_AUXDETGEOMETRYCORE_H
 
 // LArSoft libraries
+#include "larcorealg/CoreUtils/MemoryUsage.h"
+#include "larcorealg/CoreUtils/QueryMetrics.h"
+#include "larcorealg/CoreUtils/span.h"
 #include "larcorealg/Geometry/AuxDetChannelMapAlg.h"
 #include "larcorealg/Geometry/AuxDetGeo.h"
+#include "larcorealg/Geometry/AuxDetSpatialIndex.h" // geo::AuxDetLocation
+#include "larcoreobj/SimpleTypesAndConstants/geo_vectors.h"
 
 // Framework and infrastructure libraries
 #include "fhiclcpp/ParameterSet.h"
@@ -23,8 +28,12 @@
 #include <cstdint> // uint32_t
 #include <memory>  // std::shared_ptr<>
 #include <string>
+#include <string_view>
 #include <vector>
 
+// ROOT class prototypes
+class TGeoNode;
+
 /// Namespace collecting geometry-related classes utilities
 namespace geo {
 
@@ -85,6 +94,11 @@ namespace geo {
    * - *MinWireZDist* (real; default: 3)
    * - *PositionEpsilon* (real; default: 0.01%) set the default tolerance
    *   (see DefaultWiggle())
+   * - *QueryMetrics* (table; optional): if present, the calls and exceptions
+   *   of the position and channel queries are counted and printed on
+   *   destruction (see `EnableQueryMetrics()`):
+   *     - *Timing* (boolean; default: `false`): also collect the latency of
+   *       the calls
    *
    */
   class AuxDetGeometryCore {
@@ -101,6 +115,9 @@ namespace geo {
      */
     AuxDetGeometryCore(fhicl::ParameterSet const& pset);
 
+    /// Destructor: prints the query metrics, if enabled.
+    ~AuxDetGeometryCore();
+
     // You shall not copy or move or assign me!
     AuxDetGeometryCore(AuxDetGeometryCore const&) = delete;
     AuxDetGeometryCore(AuxDetGeometryCore&&) = delete;
@@ -224,6 +241,25 @@ namespace geo {
 
     uint32_t PositionToAuxDetChannel(double const worldLoc[3], size_t& ad, size_t& sv) const;
 
+    /**
+     * @brief Finds detector, sensitive volume and channel of each of the points
+     * @param points the locations [cm]
+     * @param locations _(output)_ where each of the `points` is found
+     * @throws cet::exception ("AuxDetGeometryCore" category) if `locations` is
+     *         shorter than `points`
+     * @see `PositionToAuxDetChannel()`
+     *
+     * Unlike `PositionToAuxDetChannel()`, a point outside all the sensitive
+     * volumes does not cause an exception: its location is left invalid
+     * (see `geo::AuxDetLocation::isValid()`).
+     * The volumes are found with the spatial index of the channel mapping
+     * (`geo::AuxDetChannelMapAlg::FindAuxDet()`), and only the points in a
+     * sensitive volume are handed to the channel mapping
+     * `PositionToAuxDetChannel()` for their channel.
+     */
+    void PositionsToAuxDetChannels(util::span<geo::Point_t const*> points,
+                                   util::span<geo::AuxDetLocation*> locations) const;
+
     TVector3 AuxDetChannelToPosition(uint32_t const& channel, std::string const& auxDetName) const;
 
     const AuxDetGeo& ChannelToAuxDet(
@@ -235,6 +271,112 @@ namespace geo {
       std::string const& auxDetName,
       uint32_t const& channel) const; // return the AuxDetSensitiveGeo for the given
 
+    /**
+     * @brief Returns the index of the auxiliary detector with the specified name
+     * @param auxDetName name of the auxiliary detector
+     * @return the index of the detector, as in `AuxDet()`
+     * @throws cet::exception (category: "Geometry") if no detector has that name
+     *
+     * The index can be used with `ChannelToAuxDetSensitive(std::size_t, uint32_t)`
+     * to look up many channels of the same detector without resolving its name
+     * each time.
+     */
+    std::size_t FindAuxDetByName(std::string_view auxDetName) const;
+
+    /**
+     * @brief Returns the sensitive volume of an auxiliary detector read by a channel
+     * @param ad index of the auxiliary detector (e.g. from `FindAuxDetByName()`)
+     * @param channel number of the channel within that auxiliary detector
+     * @return the sensitive volume of the detector `ad` read by `channel`
+     * @throws cet::exception (category: "Geometry") if the channel is unknown
+     */
+    const AuxDetSensitiveGeo& ChannelToAuxDetSensitive(std::size_t ad, uint32_t channel) const;
+
+    /// @{
+    /**
+     * @name Precomputed channel positions
+     *
+     * When the channel mapping is applied, the position of each channel of
+     * each auxiliary detector, as returned by the channel mapping
+     * `AuxDetChannelToPosition()`, is stored in a dense table, together with
+     * the direction of the length of the sensitive volume read by the channel
+     * (for example, the axis of a scintillator strip). These methods read that
+     * table by detector index (see `FindAuxDetByName()`), with no name lookup
+     * nor computation.
+     */
+
+    /// Returns the number of channels of the auxiliary detector with index `ad`.
+    unsigned int NAuxDetChannels(std::size_t ad) const;
+
+    /**
+     * @brief Returns the position of a channel of an auxiliary detector.
+     * @param ad index of the auxiliary detector
+     * @param channel number of the channel within that auxiliary detector
+     * @return the position of the channel, in world coordinates [cm]
+     * @throws cet::exception (category: "Geometry") if the channel is unknown
+     * @see `AuxDetChannelToPosition()`
+     */
+    geo::Point_t AuxDetChannelPosition(std::size_t ad, uint32_t channel) const;
+
+    /**
+     * @brief Returns the axis of the sensitive volume read by a channel.
+     * @param ad index of the auxiliary detector
+     * @param channel number of the channel within that auxiliary detector
+     * @return unit vector along the length of the sensitive volume (world frame)
+     * @throws cet::exception (category: "Geometry") if the channel is unknown
+     */
+    geo::Vector_t AuxDetChannelAxis(std::size_t ad, uint32_t channel) const;
+
+    /**
+     * @brief Fills the position of the channel of each of the locations.
+     * @param locations detector index and channel of each entry
+     * @param[out] positions position of the channel of each location [cm]
+     * @throws cet::exception (category: "AuxDetGeometryCore") if `positions`
+     *         is shorter than `locations`
+     * @throws cet::exception (category: "Geometry") if a channel is unknown
+     * @see `AuxDetChannelPosition()`, `PositionsToAuxDetChannels()`
+     *
+     * Only the `auxDet` and `channel` of each location are used. Locations
+     * with no channel (like the ones out of all the sensitive volumes from
+     * `PositionsToAuxDetChannels()`) are assigned a position with all
+     * coordinates not-a-number.
+     */
+    void AuxDetChannelPositions(util::span<geo::AuxDetLocation const*> locations,
+                                util::span<geo::Point_t*> positions) const;
+
+    /// @}
+
+    /**
+     * @brief Starts collecting metrics of the most used queries.
+     * @param config configuration of the metrics
+     * @see `Metrics()`
+     *
+     * The calls and exceptions of `FindAuxDetAtPosition()`,
+     * `FindAuxDetSensitiveAtPosition()`, `PositionToAuxDetChannel()`,
+     * `PositionsToAuxDetChannels()` (one call per batch),
+     * `ChannelToAuxDetSensitive()` and `FindAuxDetByName()` are counted, and
+     * optionally their latency (`lar::util::QueryMetrics`).
+     * The metrics are printed in the `AuxDetGeometryCore` info stream when this
+     * object is destroyed.
+     * This method must not be called concurrently with any query.
+     */
+    void EnableQueryMetrics(lar::util::QueryMetrics::Config_t const& config);
+
+    /// Returns the query metrics (`nullptr` if not enabled).
+    lar::util::QueryMetrics const* Metrics() const { return fMetrics.get(); }
+
+    /**
+     * @brief Returns an estimate of the memory used by the geometry description.
+     * @return the memory used, by component
+     * @see `geo::GeometryCore::MemoryUsage()`
+     *
+     * The components are this object (`"AuxDetGeometryCore"`), the detectors
+     * (`"AuxDetGeo"`, `"AuxDetSensitiveGeo"`) and the channel mapping
+     * (`"AuxDetChannelMapAlg"`). The description of the geometry in ROOT is
+     * not included.
+     */
+    lar::util::MemoryUsageReport MemoryUsage() const;
+
     /// @name Geometry initialization
     /// @{
 
@@ -262,6 +404,22 @@ namespace geo {
      */
     void LoadGeometryFile(std::string gdmlfile, std::string rootfile);
 
+    /**
+     * @brief Builds the geometry from an already imported ROOT geometry.
+     * @param gdmlfile path to file to be used for Geant4 simulation
+     * @param rootfile path of the file `topNode` was imported from
+     * @param topNode top node of the imported ROOT geometry
+     * @see `LoadGeometryFile()`, `geo::ImportROOTGeometry()`,
+     *      `geo::LoadGeometries()`
+     *
+     * This is `LoadGeometryFile()` without the import: the ROOT geometry is
+     * only read, starting from `topNode`. It may run concurrently with
+     * `geo::GeometryCore::LoadImportedGeometry()` on the same tree.
+     */
+    void LoadImportedGeometry(std::string gdmlfile,
+                              std::string rootfile,
+                              TGeoNode const* topNode);
+
     /// Returns whether we have a channel map
     bool hasAuxDetChannelMap() const { return bool(fChannelMapAlg); }
 
@@ -297,9 +455,34 @@ namespace geo {
     //@}
 
   private:
+    /// Instrumented queries (see `EnableQueryMetrics()`).
+    enum class Query_t : std::size_t {
+      FindAuxDetAtPosition,
+      FindAuxDetSensitiveAtPosition,
+      PositionToAuxDetChannel,
+      PositionsToAuxDetChannels,
+      ChannelToAuxDetSensitive,
+      FindAuxDetByName,
+      NQueries
+    };
+
+    /// Records a call to `query` in the metrics, if enabled.
+    /// The call lasts as long as the returned object.
+    lar::util::QueryMetrics::Scope_t StartQuery(Query_t query) const
+    {
+      return {fMetrics.get(), static_cast<std::size_t>(query)};
+    }
+
     /// Deletes the detector geometry structures
     void ClearGeometry();
 
+    /// Fills the tables of positions and axes of all the channels.
+    void BuildAuxDetChannelTables();
+
+    /// Returns the index of a channel in the channel tables.
+    /// @throws cet::exception (category: "Geometry") if the channel is unknown
+    std::size_t AuxDetChannelTableIndex(std::size_t ad, uint32_t channel) const;
+
     AuxDetGeometryData_t fGeoData; ///< The detector description data
 
     std::string fDetectorName;              ///< Name of the detector.
@@ -308,6 +491,12 @@ namespace geo {
     fhicl::ParameterSet fBuilderParameters; ///< Configuration of geometry builder.
     std::unique_ptr<const geo::AuxDetChannelMapAlg>
       fChannelMapAlg; ///< Object containing the channel to wire mapping
+    std::unique_ptr<lar::util::QueryMetrics> fMetrics; ///< Query metrics (may be null).
+
+    /// Start of the channels of each detector in the channel tables, and the end.
+    std::vector<std::size_t> fAuxDetChannelOffsets;
+    std::vector<geo::Point_t> fAuxDetChannelPositions; ///< Position of each channel [cm]
+    std::vector<geo::Vector_t> fAuxDetChannelAxes;     ///< Sensitive volume axis of each channel.
   };                  // class GeometryCore
 
 } // namespace geo
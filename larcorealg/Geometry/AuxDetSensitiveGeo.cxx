@@ -109,6 +109,9 @@ namespace geo {
       fLength = 2.0 * ((TGeoBBox*)fTotalVolume->GetShape())->GetDZ();
       fHalfWidth2 = fHalfWidth1;
     }
+
+    fShape = details::TrapezoidKernel::make(
+      fTrans.WorldToLocalKernel(), fHalfWidth1, fHalfWidth2, fHalfHeight, fLength);
   } // AuxDetSensitiveGeo::InitShapeSize()
 }
 ////////////////////////////////////////////////////////////////////////
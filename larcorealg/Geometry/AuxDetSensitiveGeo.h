@@ -14,6 +14,7 @@
 #include "larcorealg/Geometry/GeoVectorLocalTransformation.h"
 #include "larcorealg/Geometry/LocalTransformationGeo.h"
 #include "larcorealg/Geometry/TransformationMatrix.h"
+#include "larcorealg/Geometry/details/TrapezoidKernel.h"
 #include "larcoreobj/SimpleTypesAndConstants/geo_vectors.h"
 
 // ROOT libraries
@@ -96,6 +97,46 @@ namespace geo {
     double HalfHeight() const { return fHalfHeight; }
     const TGeoVolume* TotalVolume() const { return fTotalVolume; }
 
+    /// @{
+    /**
+     * @name Containment
+     *
+     * The tests use the shape parameters and the world-to-local transformation
+     * precomputed at construction (see `ShapeKernel()`). A `tolerance` expands
+     * the volume by that amount on each side, in the local frame.
+     */
+
+    /// Returns whether the point `local` (local frame) is in this sensitive volume.
+    bool ContainsLocal(double const* local, double tolerance = 0.0) const
+    {
+      return fShape.containsLocal(local, tolerance);
+    }
+
+    /// Returns whether the point `local` (local frame) is in this sensitive volume.
+    bool ContainsLocal(LocalPoint_t const& local, double tolerance = 0.0) const
+    {
+      double const coords[3] = {local.X(), local.Y(), local.Z()};
+      return ContainsLocal(coords, tolerance);
+    }
+
+    /// Returns whether the point `world` (world frame) is in this sensitive volume.
+    bool ContainsPosition(double const* world, double tolerance = 0.0) const
+    {
+      return fShape.contains(world, tolerance);
+    }
+
+    /// Returns whether `point` (world frame) is in this sensitive volume.
+    bool ContainsPosition(geo::Point_t const& point, double tolerance = 0.0) const
+    {
+      double const world[3] = {point.X(), point.Y(), point.Z()};
+      return ContainsPosition(world, tolerance);
+    }
+
+    /// Returns the shape and world-to-local transformation, ready for use.
+    geo::details::TrapezoidKernel const& ShapeKernel() const { return fShape; }
+
+    /// @}
+
     //@{
     /// Returns the distance of `point` from the center of the detector.
     geo::Length_t DistanceToPoint(geo::Point_t const& point) const
@@ -202,6 +243,8 @@ namespace geo {
     double fHalfWidth1;             ///< 1st half width of volume, at -z/2 in local coordinates
     double fHalfWidth2;             ///< 2nd half width (width1==width2 for boxes), at +z/2
     double fHalfHeight;             ///< half height of volume
+    /// Shape and world-to-local transformation, precomputed by `InitShapeSize()`.
+    geo::details::TrapezoidKernel fShape;
 
     /// Extracts the size of the detector from the geometry information.
     void InitShapeSize();
@@ -0,0 +1,144 @@
+/**
+ * @file   larcorealg/Geometry/AuxDetSpatialIndex.cxx
+ * @brief  Index of auxiliary detectors and their sensitive volumes by position.
+ * @date   October 14, 2026
+ * @see    larcorealg/Geometry/AuxDetSpatialIndex.h
+ */
+
+// library header
+#include "larcorealg/Geometry/AuxDetSpatialIndex.h"
+
+// LArSoft libraries
+#include "larcorealg/Geometry/AuxDetGeo.h"
+#include "larcorealg/Geometry/AuxDetSensitiveGeo.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::min(), std::max()
+#include <cmath>     // std::abs(), std::sqrt()
+
+namespace {
+
+  /// Returns the box in world coordinates enclosing the trapezoid `volume`.
+  template <typename Volume>
+  geo::details::BoxBVH::Box_t worldBox(Volume const& volume)
+  {
+    double const halfLength = volume.Length() / 2;
+    geo::details::BoxBVH::Box_t box;
+    bool first = true;
+    for (double const z : {-halfLength, +halfLength}) {
+      double const halfWidth = (z < 0.0) ? volume.HalfWidth1() : volume.HalfWidth2();
+      for (double const x : {-halfWidth, +halfWidth}) {
+        for (double const y : {-volume.HalfHeight(), +volume.HalfHeight()}) {
+          double const local[3] = {x, y, z};
+          double world[3];
+          volume.LocalToWorld(local, world);
+          for (std::size_t axis = 0; axis < 3U; ++axis) {
+            box.lower[axis] = first ? world[axis] : std::min(box.lower[axis], world[axis]);
+            box.upper[axis] = first ? world[axis] : std::max(box.upper[axis], world[axis]);
+          }
+          first = false;
+        } // for y
+      }   // for x
+    }     // for z
+    return box;
+  }
+
+  /// Returns by how much the half width of `volume` changes per unit of length.
+  template <typename Volume>
+  double widthSlope(Volume const& volume)
+  {
+    return (volume.Length() > 0.0) ?
+             std::abs(volume.HalfWidth1() - volume.HalfWidth2()) / volume.Length() :
+             0.0;
+  }
+
+} // local namespace
+
+//------------------------------------------------------------------------------
+void geo::AuxDetSpatialIndex::build(std::vector<geo::AuxDetGeo> const& auxDets)
+{
+  clear();
+
+  // A tolerance t expands each side of a volume by t in its own frame, and the
+  // tilted sides of a trapezoid by up to t (1 + slope); once rotated, the box
+  // enclosing the volume grows by at most sqrt(3) times that on each side.
+  double maxSlope = 0.0;
+  std::vector<details::BoxBVH::Box_t> boxes;
+  boxes.reserve(auxDets.size());
+  fSensitiveTrees.resize(auxDets.size());
+  for (std::size_t ad = 0; ad < auxDets.size(); ++ad) {
+    geo::AuxDetGeo const& auxDet = auxDets[ad];
+    boxes.push_back(worldBox(auxDet));
+    maxSlope = std::max(maxSlope, widthSlope(auxDet));
+
+    std::vector<details::BoxBVH::Box_t> sensitiveBoxes;
+    sensitiveBoxes.reserve(auxDet.NSensitiveVolume());
+    for (std::size_t sv = 0; sv < auxDet.NSensitiveVolume(); ++sv) {
+      geo::AuxDetSensitiveGeo const& sensitive = auxDet.SensitiveVolume(sv);
+      sensitiveBoxes.push_back(worldBox(sensitive));
+      maxSlope = std::max(maxSlope, widthSlope(sensitive));
+    }
+    fSensitiveTrees[ad].build(sensitiveBoxes);
+  } // for auxiliary detectors
+  fAuxDetTree.build(boxes);
+
+  fMarginScale = std::sqrt(3.0) * (1.0 + maxSlope);
+  fAuxDets = &auxDets;
+  fAuxDetData = auxDets.data();
+  fNAuxDets = auxDets.size();
+} // geo::AuxDetSpatialIndex::build()
+
+//------------------------------------------------------------------------------
+void geo::AuxDetSpatialIndex::clear()
+{
+  fAuxDets = nullptr;
+  fAuxDetData = nullptr;
+  fNAuxDets = 0U;
+  fAuxDetTree.clear();
+  fSensitiveTrees.clear();
+  fMarginScale = 1.0;
+}
+
+//------------------------------------------------------------------------------
+std::size_t geo::AuxDetSpatialIndex::findAuxDet(double const* point, double tolerance) const
+{
+  if (empty()) return NoIndex;
+  std::vector<geo::AuxDetGeo> const& auxDets = *fAuxDets;
+  auto const ad = fAuxDetTree.findFirst(
+    point[0], point[1], point[2], margin(tolerance), [&auxDets, point, tolerance](auto i) {
+      return contains(auxDets[i], point, tolerance);
+    });
+  return (ad == details::BoxBVH::NoBox) ? NoIndex : ad;
+}
+
+//------------------------------------------------------------------------------
+std::size_t geo::AuxDetSpatialIndex::findSensitive(double const* point,
+                                                   std::size_t ad,
+                                                   double tolerance) const
+{
+  if (empty() || (ad >= fSensitiveTrees.size())) return NoIndex;
+  geo::AuxDetGeo const& auxDet = (*fAuxDets)[ad];
+  auto const sv = fSensitiveTrees[ad].findFirst(
+    point[0], point[1], point[2], margin(tolerance), [&auxDet, point, tolerance](auto i) {
+      return contains(auxDet.SensitiveVolume(i), point, tolerance);
+    });
+  return (sv == details::BoxBVH::NoBox) ? NoIndex : sv;
+}
+
+//------------------------------------------------------------------------------
+bool geo::AuxDetSpatialIndex::contains(geo::AuxDetGeo const& auxDet,
+                                       double const* point,
+                                       double tolerance)
+{
+  return auxDet.ContainsPosition(point, tolerance);
+}
+
+//------------------------------------------------------------------------------
+bool geo::AuxDetSpatialIndex::contains(geo::AuxDetSensitiveGeo const& sensitive,
+                                       double const* point,
+                                       double tolerance)
+{
+  return sensitive.ContainsPosition(point, tolerance);
+}
+
+//------------------------------------------------------------------------------
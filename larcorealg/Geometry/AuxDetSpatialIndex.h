@@ -0,0 +1,141 @@
+/**
+ * @file   larcorealg/Geometry/AuxDetSpatialIndex.h
+ * @brief  Index of auxiliary detectors and their sensitive volumes by position.
+ * @date   October 14, 2026
+ * @see    larcorealg/Geometry/AuxDetSpatialIndex.cxx
+ * @ingroup Geometry
+ */
+
+#ifndef LARCOREALG_GEOMETRY_AUXDETSPATIALINDEX_H
+#define LARCOREALG_GEOMETRY_AUXDETSPATIALINDEX_H
+
+// LArSoft libraries
+#include "larcorealg/CoreUtils/MemoryUsage.h"
+#include "larcorealg/Geometry/details/BoxBVH.h"
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint32_t
+#include <limits>
+#include <vector>
+
+namespace geo {
+
+  // forward declarations
+  class AuxDetGeo;
+  class AuxDetSensitiveGeo;
+
+  /**
+   * @brief Auxiliary detector, sensitive volume and channel of a point.
+   * @ingroup Geometry
+   *
+   * This is the result of the batch queries like
+   * `geo::AuxDetGeometryCore::PositionsToAuxDetChannels()`. A point outside
+   * all the detectors gets the invalid values.
+   */
+  struct AuxDetLocation {
+    /// Value of `auxDet` and `sensitive` for a point in no volume.
+    static constexpr std::size_t InvalidIndex = std::numeric_limits<std::size_t>::max();
+
+    /// Value of `channel` when the channel is not known.
+    static constexpr std::uint32_t InvalidChannel = std::numeric_limits<std::uint32_t>::max();
+
+    std::size_t auxDet = InvalidIndex;      ///< Index of the auxiliary detector.
+    std::size_t sensitive = InvalidIndex;   ///< Index of the sensitive volume in it.
+    std::uint32_t channel = InvalidChannel; ///< Channel reading the point.
+
+    /// Returns whether the point was found in a sensitive volume.
+    bool isValid() const { return (auxDet != InvalidIndex) && (sensitive != InvalidIndex); }
+
+  }; // struct AuxDetLocation
+
+  /**
+   * @brief Finds the auxiliary detector and sensitive volume containing a point.
+   * @ingroup Geometry
+   *
+   * The index holds a bounding volume hierarchy (`geo::details::BoxBVH`) of
+   * the boxes, in world coordinates, enclosing each auxiliary detector, and one
+   * for the sensitive volumes of each of the detectors. The volumes whose box
+   * contains the point are then tested exactly with `contains()`, which is
+   * the `ContainsPosition()` test of the volume.
+   * Among the volumes containing the point, the first in the list is returned,
+   * as a loop on all of them would do.
+   *
+   * The index refers to the list of auxiliary detectors it was built from
+   * (`build()`), and must be built again whenever that list changes.
+   */
+  class AuxDetSpatialIndex {
+
+  public:
+    /// Value returned when no volume contains the point.
+    static constexpr std::size_t NoIndex = AuxDetLocation::InvalidIndex;
+
+    /// Builds the index of the auxiliary detectors in `auxDets`.
+    void build(std::vector<geo::AuxDetGeo> const& auxDets);
+
+    /// Removes the index.
+    void clear();
+
+    /// Returns whether the index has not been built.
+    bool empty() const { return fAuxDets == nullptr; }
+
+    /// Returns the memory allocated by the index, besides its own size [bytes]
+    std::size_t heapMemory() const
+    {
+      return lar::util::heapMemory(fAuxDetTree) + lar::util::heapMemory(fSensitiveTrees);
+    }
+
+    /// Returns whether the index was built from `auxDets`, still unchanged.
+    bool indexes(std::vector<geo::AuxDetGeo> const& auxDets) const
+    {
+      return (fAuxDets == &auxDets) && (fAuxDetData == auxDets.data()) &&
+             (fNAuxDets == auxDets.size());
+    }
+
+    /**
+     * @brief Returns the index of the auxiliary detector containing `point`.
+     * @param point world coordinates of the point (_x_, _y_, _z_)
+     * @param tolerance volumes are expanded by this amount on each side
+     * @return the index of the detector in the list, `NoIndex` if none
+     */
+    std::size_t findAuxDet(double const* point, double tolerance = 0.0) const;
+
+    /**
+     * @brief Returns the index of the sensitive volume containing `point`.
+     * @param point world coordinates of the point (_x_, _y_, _z_)
+     * @param ad index of the auxiliary detector the volume belongs to
+     * @param tolerance volumes are expanded by this amount on each side
+     * @return the index of the volume in the detector, `NoIndex` if none
+     */
+    std::size_t findSensitive(double const* point, std::size_t ad, double tolerance = 0.0) const;
+
+    /// @{
+    /// Returns whether `point` (world coordinates) is in the trapezoid volume.
+    static bool contains(geo::AuxDetGeo const& auxDet, double const* point, double tolerance);
+    static bool contains(geo::AuxDetSensitiveGeo const& sensitive,
+                         double const* point,
+                         double tolerance);
+    /// @}
+
+  private:
+    std::vector<geo::AuxDetGeo> const* fAuxDets = nullptr; ///< Indexed detectors.
+    geo::AuxDetGeo const* fAuxDetData = nullptr;           ///< Their storage when indexed.
+    std::size_t fNAuxDets = 0U;                            ///< Their number when indexed.
+
+    geo::details::BoxBVH fAuxDetTree;                  ///< Boxes of the detectors.
+    std::vector<geo::details::BoxBVH> fSensitiveTrees; ///< Sensitive volumes, by detector.
+
+    /// Expansion of the boxes, per unit of tolerance, covering the volumes.
+    double fMarginScale = 1.0;
+
+    /// Returns the margin to apply to the boxes for the specified `tolerance`.
+    double margin(double tolerance) const
+    {
+      return (tolerance > 0.0) ? tolerance * fMarginScale : 0.0;
+    }
+
+  }; // class AuxDetSpatialIndex
+
+} // namespace geo
+
+#endif // LARCOREALG_GEOMETRY_AUXDETSPATIALINDEX_H
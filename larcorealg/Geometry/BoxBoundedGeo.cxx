@@ -37,9 +37,19 @@ namespace geo {
     geo::Point_t const& TrajectoryStart,
     geo::Vector_t const& TrajectoryDirect) const
   {
+    IntersectionPoints_t points;
+    GetIntersections(TrajectoryStart, TrajectoryDirect, points);
+    return {points.begin(), points.end()};
+  } // GetIntersections()
 
-    std::vector<geo::Point_t> IntersectionPoints;
-    std::vector<double> LineParameters;
+  //----------------------------------------------------------------------------
+  void BoxBoundedGeo::GetIntersections(geo::Point_t const& TrajectoryStart,
+                                       geo::Vector_t const& TrajectoryDirect,
+                                       IntersectionPoints_t& IntersectionPoints) const
+  {
+
+    IntersectionPoints.clear();
+    util::small_vector<double, 6U> LineParameters; // at most one per face
 
     // Generate normal vectors and offsets for every plane of the box
     // All normal vectors are headed outwards
@@ -118,8 +128,7 @@ namespace geo {
       std::swap(IntersectionPoints.front(), IntersectionPoints.back());
     }
 
-    return IntersectionPoints;
-  } // GetIntersections()
+  } // GetIntersections(IntersectionPoints_t)
 
   //----------------------------------------------------------------------------
   std::vector<TVector3> BoxBoundedGeo::GetIntersections(TVector3 const& TrajectoryStart,
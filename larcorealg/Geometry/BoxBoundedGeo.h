@@ -11,6 +11,9 @@
 #define LARCOREALG_GEOMETRY_BOXBOUNDEDGEO_H
 
 // LArSoft libraries
+#include "larcorealg/CoreUtils/SmallVector.h"
+#include "larcorealg/CoreUtils/span.h"
+#include "larcorealg/Geometry/details/BoxKernel.h"
 #include "larcoreobj/SimpleTypesAndConstants/geo_vectors.h" // geo::vect
 
 // ROOT library
@@ -18,6 +21,8 @@
 
 // C/C++ standard library
 #include <algorithm>
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint8_t
 #include <vector>
 
 namespace geo {
@@ -35,6 +40,12 @@ namespace geo {
     using Coords_t = geo::Point_t;    ///< Type of the coordinate triplet.
     using Coord_t = Coords_t::Scalar; ///< Type of the coordinate.
 
+    /// Line with precomputed inverse direction, for `IntersectRays()`.
+    using Ray_t = details::BoxRay;
+
+    /// Parameters for the containment and intersection tests of many points.
+    using BoxKernel_t = details::BoxKernel;
+
     /**
      * @brief Default constructor: sets an empty volume
      * @see SetBoundaries
@@ -216,6 +227,42 @@ namespace geo {
     /// @see `ContainsPosition(geo::Point_t const&, double) const`.
     bool ContainsPosition(double const* point, double wiggle = 1.0) const;
 
+    /**
+     * @brief Tests whether this volume contains each of many points.
+     * @param points the points [cm]
+     * @param[out] mask array with room for a flag for each point
+     * @param wiggle expansion factor for the range
+     * @see `ContainsPosition()`
+     *
+     * Each flag is `1` if `ContainsPosition()` would return `true` for its
+     * point, `0` otherwise. The loop is suitable for vectorization; the
+     * versions taking the points as three arrays of coordinates (structure of
+     * arrays) are the fastest.
+     */
+    void ContainsPositions(util::span<geo::Point_t const*> points,
+                           std::uint8_t* mask,
+                           double wiggle = 1.0) const
+    {
+      BoxKernel(wiggle).containsPositions(points.begin(), points.end(), mask);
+    }
+    void ContainsPositions(std::size_t n,
+                           double const* x,
+                           double const* y,
+                           double const* z,
+                           std::uint8_t* mask,
+                           double wiggle = 1.0) const
+    {
+      BoxKernel(wiggle).containsPositions(n, x, y, z, mask);
+    }
+
+    /// Returns the boundaries of this box, expanded by `wiggle`.
+    BoxKernel_t BoxKernel(double wiggle = 1.0) const
+    {
+      double const lower[3] = {MinX(), MinY(), MinZ()};
+      double const upper[3] = {MaxX(), MaxY(), MaxZ()};
+      return BoxKernel_t::wiggled(lower, upper, wiggle);
+    }
+
     /// @}
 
     /// @name Containment in a fiducial volume
@@ -469,6 +516,50 @@ namespace geo {
                                                geo::Vector_t const& TrajectoryDirect) const;
     //@}
 
+    /// Type of the list of intersections, allocating no memory for up to two.
+    using IntersectionPoints_t = util::small_vector<geo::Point_t, 2U>;
+
+    /**
+     * @brief Fills `points` with the entry and exit points of a trajectory.
+     * @param TrajectoryStart position of the trajectory source
+     * @param TrajectoryDirect direction vector of the trajectory
+     * @param[out] points the intersections (previous content is removed)
+     * @see `GetIntersections(geo::Point_t const&, geo::Vector_t const&) const`
+     *
+     * The points are the same as returned by `GetIntersections()`, but no
+     * memory is allocated for them.
+     */
+    void GetIntersections(geo::Point_t const& TrajectoryStart,
+                          geo::Vector_t const& TrajectoryDirect,
+                          IntersectionPoints_t& points) const;
+
+    /// Returns a line for `IntersectRays()` from its `start` and direction `dir`.
+    static Ray_t MakeRay(geo::Point_t const& start, geo::Vector_t const& dir)
+    {
+      double const startCoords[3] = {start.X(), start.Y(), start.Z()};
+      double const dirCoords[3] = {dir.X(), dir.Y(), dir.Z()};
+      return Ray_t::make(startCoords, dirCoords);
+    }
+
+    /**
+     * @brief Finds where each of many lines crosses the box surface.
+     * @param rays the lines, as created by `MakeRay()`
+     * @param[out] tEnter array for the line parameter of each entry point
+     * @param[out] tExit array for the line parameter of each exit point
+     * @return the number of lines crossing the box
+     * @see `GetIntersections()`
+     *
+     * The points of a line are `start + t * dir`, and the entry and exit points
+     * are at the line parameters `tEnter` and `tExit`, which may be negative.
+     * A line misses the box if its `tEnter` is larger than its `tExit`.
+     * The slab method is used, with no branch on the single lines; differently
+     * from `GetIntersections()`, no point is computed.
+     */
+    std::size_t IntersectRays(util::span<Ray_t const*> rays, double* tEnter, double* tExit) const
+    {
+      return BoxKernel().intersectRays(rays.begin(), rays.end(), tEnter, tExit);
+    }
+
     /// Sets var to value if value is smaller than the current var value.
     static void set_min(Coord_t& var, Coord_t value)
     {
@@ -0,0 +1,281 @@
+/**
+ * @file   larcorealg/Geometry/BoxSetSoA.h
+ * @brief  Collection of boxes tested at once against a point or a line.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/BoxBoundedGeo.h`
+ * @ingroup Geometry
+ *
+ * This is a header-only library.
+ */
+
+#ifndef LARCOREALG_GEOMETRY_BOXSETSOA_H
+#define LARCOREALG_GEOMETRY_BOXSETSOA_H
+
+// LArSoft libraries
+#include "larcorealg/Geometry/details/BoxKernel.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::min(), std::max()
+#include <cstddef>   // std::size_t
+#include <cstdint>   // std::uint8_t
+#include <limits>
+#include <vector>
+
+namespace geo {
+
+  /**
+   * @brief Collection of boxes aligned with the axes, stored by coordinate.
+   * @ingroup Geometry
+   *
+   * Each boundary of all the boxes is stored in its own array ("structure of
+   * arrays"), so that a point or a line can be tested against all the boxes in
+   * loops the compiler can vectorize. Boxes are added from any object with
+   * the interface of `geo::BoxBoundedGeo` (`MinX()`, `MaxX()` and so on):
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * std::vector<geo::BoxBoundedGeo> volumes = ...;
+   * geo::BoxSetSoA const boxes{ volumes.begin(), volumes.end() };
+   *
+   * std::size_t const iBox = boxes.findFirst(point);
+   * if (iBox < boxes.size()) { // point is in `volumes[iBox]`
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   * As in `geo::BoxBoundedGeo::ContainsPosition()`, the boundaries are part of
+   * the boxes. No "wiggle" factor is supported here.
+   */
+  class BoxSetSoA {
+  public:
+    using Ray_t = details::BoxRay; ///< Type of line for the intersections.
+
+    /// Constructor: an empty collection.
+    BoxSetSoA() = default;
+
+    /// Constructor: copies the boundaries of the boxes in [`begin`, `end`[.
+    template <typename BoxIter>
+    BoxSetSoA(BoxIter begin, BoxIter end)
+    {
+      for (; begin != end; ++begin)
+        push_back(*begin);
+    }
+
+    /// Returns the number of boxes.
+    std::size_t size() const { return fMinX.size(); }
+
+    /// Returns whether there is no box.
+    bool empty() const { return fMinX.empty(); }
+
+    /// Prepares room for `n` boxes.
+    void reserve(std::size_t n);
+
+    /// Removes all the boxes.
+    void clear();
+
+    /// Adds a box with the specified `lower` and `upper` corner coordinates.
+    void push_back(double const* lower, double const* upper);
+
+    /// Adds the box of `box` (`geo::BoxBoundedGeo` interface).
+    template <typename Box>
+    void push_back(Box const& box)
+    {
+      double const lower[3] = {box.MinX(), box.MinY(), box.MinZ()};
+      double const upper[3] = {box.MaxX(), box.MaxY(), box.MaxZ()};
+      push_back(lower, upper);
+    }
+
+    /// Returns the kernel of the box number `i`.
+    details::BoxKernel box(std::size_t i) const
+    {
+      return {{fMinX[i], fMinY[i], fMinZ[i]}, {fMaxX[i], fMaxY[i], fMaxZ[i]}};
+    }
+
+    /// @{
+    /// @name Queries on all the boxes
+
+    /**
+     * @brief Tests whether the point (`x`, `y`, `z`) is in each box.
+     * @param[out] mask array with room for a result for each box:
+     *                  `1` if the box contains the point, `0` otherwise
+     */
+    void contains(double x, double y, double z, std::uint8_t* mask) const;
+
+    /// Tests whether `point` is in each box.
+    template <typename Point>
+    void contains(Point const& point, std::uint8_t* mask) const
+    {
+      contains(point.X(), point.Y(), point.Z(), mask);
+    }
+
+    /// Returns the number of boxes containing the point (`x`, `y`, `z`).
+    std::size_t count(double x, double y, double z) const;
+
+    /// Returns the number of boxes containing `point`.
+    template <typename Point>
+    std::size_t count(Point const& point) const
+    {
+      return count(point.X(), point.Y(), point.Z());
+    }
+
+    /// Returns the index of the first box containing the point, `size()` if none.
+    std::size_t findFirst(double x, double y, double z) const;
+
+    /// Returns the index of the first box containing `point`, `size()` if none.
+    template <typename Point>
+    std::size_t findFirst(Point const& point) const
+    {
+      return findFirst(point.X(), point.Y(), point.Z());
+    }
+
+    /**
+     * @brief Finds where a line crosses each box.
+     * @param ray the line
+     * @param[out] tEnter array for the line parameter of the entry in each box
+     * @param[out] tExit array for the line parameter of the exit from each box
+     * @return the number of boxes crossed by the line
+     * @see `details::BoxKernel::intersect()`
+     *
+     * A box is missed when its `tEnter` is larger than its `tExit`.
+     */
+    std::size_t intersect(Ray_t const& ray, double* tEnter, double* tExit) const;
+
+    /// @}
+
+  private:
+    /// Number of boxes tested in a block by `findFirst()` and `count()`.
+    static constexpr std::size_t BlockSize = 64U;
+
+    std::vector<double> fMinX; ///< Lower _x_ boundary of all the boxes.
+    std::vector<double> fMinY; ///< Lower _y_ boundary of all the boxes.
+    std::vector<double> fMinZ; ///< Lower _z_ boundary of all the boxes.
+    std::vector<double> fMaxX; ///< Upper _x_ boundary of all the boxes.
+    std::vector<double> fMaxY; ///< Upper _y_ boundary of all the boxes.
+    std::vector<double> fMaxZ; ///< Upper _z_ boundary of all the boxes.
+
+    /// Fills `mask` with containment of the point in boxes [`first`, `last`[.
+    void containsRange(double x,
+                       double y,
+                       double z,
+                       std::size_t first,
+                       std::size_t last,
+                       std::uint8_t* __restrict__ mask) const;
+
+  }; // class BoxSetSoA
+
+} // namespace geo
+
+//------------------------------------------------------------------------------
+//--- inline implementation
+//------------------------------------------------------------------------------
+inline void geo::BoxSetSoA::reserve(std::size_t n)
+{
+  for (auto* column : {&fMinX, &fMinY, &fMinZ, &fMaxX, &fMaxY, &fMaxZ})
+    column->reserve(n);
+}
+
+//------------------------------------------------------------------------------
+inline void geo::BoxSetSoA::clear()
+{
+  for (auto* column : {&fMinX, &fMinY, &fMinZ, &fMaxX, &fMaxY, &fMaxZ})
+    column->clear();
+}
+
+//------------------------------------------------------------------------------
+inline void geo::BoxSetSoA::push_back(double const* lower, double const* upper)
+{
+  fMinX.push_back(std::min(lower[0], upper[0]));
+  fMinY.push_back(std::min(lower[1], upper[1]));
+  fMinZ.push_back(std::min(lower[2], upper[2]));
+  fMaxX.push_back(std::max(lower[0], upper[0]));
+  fMaxY.push_back(std::max(lower[1], upper[1]));
+  fMaxZ.push_back(std::max(lower[2], upper[2]));
+}
+
+//------------------------------------------------------------------------------
+inline void geo::BoxSetSoA::containsRange(double x,
+                                          double y,
+                                          double z,
+                                          std::size_t first,
+                                          std::size_t last,
+                                          std::uint8_t* __restrict__ mask) const
+{
+  double const* __restrict__ minX = fMinX.data();
+  double const* __restrict__ minY = fMinY.data();
+  double const* __restrict__ minZ = fMinZ.data();
+  double const* __restrict__ maxX = fMaxX.data();
+  double const* __restrict__ maxY = fMaxY.data();
+  double const* __restrict__ maxZ = fMaxZ.data();
+  for (std::size_t i = first; i < last; ++i) {
+    mask[i - first] = (x >= minX[i]) & (x <= maxX[i]) & (y >= minY[i]) & (y <= maxY[i]) &
+                      (z >= minZ[i]) & (z <= maxZ[i]);
+  }
+}
+
+//------------------------------------------------------------------------------
+inline void geo::BoxSetSoA::contains(double x, double y, double z, std::uint8_t* mask) const
+{
+  containsRange(x, y, z, 0U, size(), mask);
+}
+
+//------------------------------------------------------------------------------
+inline std::size_t geo::BoxSetSoA::count(double x, double y, double z) const
+{
+  std::uint8_t mask[BlockSize];
+  std::size_t n = 0;
+  for (std::size_t first = 0; first < size(); first += BlockSize) {
+    std::size_t const last = std::min(first + BlockSize, size());
+    containsRange(x, y, z, first, last, mask);
+    for (std::size_t i = 0; i < last - first; ++i)
+      n += mask[i];
+  }
+  return n;
+}
+
+//------------------------------------------------------------------------------
+inline std::size_t geo::BoxSetSoA::findFirst(double x, double y, double z) const
+{
+  std::uint8_t mask[BlockSize];
+  for (std::size_t first = 0; first < size(); first += BlockSize) {
+    std::size_t const last = std::min(first + BlockSize, size());
+    containsRange(x, y, z, first, last, mask);
+    for (std::size_t i = 0; i < last - first; ++i)
+      if (mask[i]) return first + i;
+  }
+  return size();
+}
+
+//------------------------------------------------------------------------------
+inline std::size_t geo::BoxSetSoA::intersect(Ray_t const& ray,
+                                             double* __restrict__ tEnter,
+                                             double* __restrict__ tExit) const
+{
+  Ray_t const r = ray;
+  std::size_t const n = size();
+  double const* const lowers[3] = {fMinX.data(), fMinY.data(), fMinZ.data()};
+  double const* const uppers[3] = {fMaxX.data(), fMaxY.data(), fMaxZ.data()};
+
+  // one axis at a time, each loop over all the boxes vectorizes
+  for (std::size_t i = 0; i < n; ++i) {
+    tEnter[i] = -std::numeric_limits<double>::infinity();
+    tExit[i] = std::numeric_limits<double>::infinity();
+  }
+  for (std::size_t axis = 0; axis < 3; ++axis) {
+    double const* __restrict__ lower = lowers[axis];
+    double const* __restrict__ upper = uppers[axis];
+    double const start = r.start[axis];
+    double const invDir = r.invDir[axis];
+    for (std::size_t i = 0; i < n; ++i) {
+      double const t1 = (lower[i] - start) * invDir;
+      double const t2 = (upper[i] - start) * invDir;
+      double const tNear = (t1 < t2) ? t1 : t2;
+      double const tFar = (t1 < t2) ? t2 : t1;
+      tEnter[i] = (tNear > tEnter[i]) ? tNear : tEnter[i];
+      tExit[i] = (tFar < tExit[i]) ? tFar : tExit[i];
+    }
+  }
+
+  std::size_t nHits = 0;
+  for (std::size_t i = 0; i < n; ++i)
+    nHits += (tEnter[i] <= tExit[i]);
+  return nHits;
+}
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREALG_GEOMETRY_BOXSETSOA_H
@@ -0,0 +1,182 @@
+/**
+ * @file   larcorealg/Geometry/ChannelAdjacency.h
+ * @brief  Tables of the neighbors and of the crossing channels of each channel.
+ * @date   October 14, 2026
+ * @see    `geo::GeometryCore::MakeChannelAdjacency()`
+ *
+ * This is a header only library.
+ */
+
+#ifndef LARCOREALG_GEOMETRY_CHANNELADJACENCY_H
+#define LARCOREALG_GEOMETRY_CHANNELADJACENCY_H
+
+// LArSoft libraries
+#include "larcorealg/CoreUtils/MemoryUsage.h" // lar::util::heapMemory()
+#include "larcorealg/CoreUtils/span.h"
+#include "larcoreobj/SimpleTypesAndConstants/RawTypes.h" // raw::ChannelID_t
+
+// C/C++ standard libraries
+#include <algorithm> // std::sort(), std::unique(), std::remove()
+#include <cstddef>   // std::size_t
+#include <vector>
+
+namespace geo {
+
+  /**
+   * @brief Channels near to each TPC channel, on its plane and on the others.
+   *
+   * For each channel, the tables list:
+   * * its _neighbors_: the channels of the wires of the same plane which are
+   *   at most `neighborDistance()` wires away from a wire of the channel;
+   * * its _crossings_: the channels of the wires of the other planes of the
+   *   same TPC which cross a wire of the channel.
+   *
+   * Channels with more than one wire collect the channels from all of them.
+   * Each list is sorted, has no duplicates and does not include the channel
+   * itself. The lists of all the channels are stored one after the other in a
+   * single array, with the start of each channel in a second one (the
+   * "compressed sparse row" format), and they are returned as spans into it.
+   *
+   * The tables do not depend on the event, and they are meant to be built
+   * once per job (`geo::GeometryCore::MakeChannelAdjacency()`) by coherent
+   * noise filtering, cross-talk correction and similar algorithms, which can
+   * then loop on them in place of testing the intersection of wire pairs.
+   */
+  class ChannelAdjacency {
+
+  public:
+    /// Type of list of channels.
+    using ChannelSpan_t = util::span<raw::ChannelID_t const*>;
+
+    /// Constructor: no channel.
+    ChannelAdjacency() = default;
+
+    /**
+     * @brief Builds the tables for channels from `0` to `nChannels - 1`.
+     * @tparam NeighborsOf type of callable collecting neighboring channels
+     * @tparam CrossingsOf type of callable collecting crossing channels
+     * @param nChannels number of channels
+     * @param neighborDistance the distance the neighbors are collected within
+     * @param neighborsOf adds to a vector the neighbors of a channel
+     * @param crossingsOf adds to a vector the crossings of a channel
+     *
+     * Both the callables are called as `f(channel, channels)`, with `channels`
+     * a `std::vector<raw::ChannelID_t>` to add the channels to. They may add
+     * the same channel more than once, and `channel` itself, which are removed
+     * afterwards.
+     */
+    template <typename NeighborsOf, typename CrossingsOf>
+    ChannelAdjacency(std::size_t nChannels,
+                     unsigned int neighborDistance,
+                     NeighborsOf neighborsOf,
+                     CrossingsOf crossingsOf);
+
+    /// Returns the sorted neighbors of `channel` on its plane (empty if none).
+    ChannelSpan_t neighbors(raw::ChannelID_t channel) const
+    {
+      return rangeAt(fNeighborOffsets, fNeighbors, channel);
+    }
+
+    /// Returns the sorted channels crossing `channel` on the other planes.
+    ChannelSpan_t crossings(raw::ChannelID_t channel) const
+    {
+      return rangeAt(fCrossingOffsets, fCrossings, channel);
+    }
+
+    /// Returns the number of channels in the tables.
+    std::size_t nChannels() const
+    {
+      return fNeighborOffsets.empty() ? 0U : fNeighborOffsets.size() - 1U;
+    }
+
+    /// Returns the number of wires away the neighbors are collected within.
+    unsigned int neighborDistance() const { return fNeighborDistance; }
+
+    /// Returns the total number of neighbors of all the channels.
+    std::size_t nNeighbors() const { return fNeighbors.size(); }
+
+    /// Returns the total number of crossings of all the channels.
+    std::size_t nCrossings() const { return fCrossings.size(); }
+
+    /// Returns whether there is no channel.
+    bool empty() const { return nChannels() == 0U; }
+
+    /// Returns the memory allocated by the tables, besides their own size [bytes]
+    std::size_t heapMemory() const
+    {
+      return lar::util::heapMemory(fNeighborOffsets) + lar::util::heapMemory(fNeighbors) +
+             lar::util::heapMemory(fCrossingOffsets) + lar::util::heapMemory(fCrossings);
+    }
+
+  private:
+    unsigned int fNeighborDistance = 0U; ///< Distance of the neighbors [wires]
+
+    std::vector<std::size_t> fNeighborOffsets; ///< Start of each channel in `fNeighbors`.
+    std::vector<raw::ChannelID_t> fNeighbors;  ///< Neighbors of all the channels.
+
+    std::vector<std::size_t> fCrossingOffsets; ///< Start of each channel in `fCrossings`.
+    std::vector<raw::ChannelID_t> fCrossings;  ///< Crossings of all the channels.
+
+    /// Fills `offsets` and `values` with the channels collected by `collect`.
+    template <typename Collect>
+    static void fillTable(std::size_t nChannels,
+                          Collect& collect,
+                          std::vector<std::size_t>& offsets,
+                          std::vector<raw::ChannelID_t>& values,
+                          std::vector<raw::ChannelID_t>& buffer);
+
+    /// Returns the elements of `values` in the range `index` of `offsets`.
+    static ChannelSpan_t rangeAt(std::vector<std::size_t> const& offsets,
+                                 std::vector<raw::ChannelID_t> const& values,
+                                 raw::ChannelID_t index)
+    {
+      if (!raw::isValidChannelID(index) || (index + 1U >= offsets.size())) return {};
+      raw::ChannelID_t const* const start = values.data();
+      return {start + offsets[index], start + offsets[index + 1U]};
+    }
+
+  }; // class ChannelAdjacency
+
+} // namespace geo
+
+//------------------------------------------------------------------------------
+//--- template implementation
+//------------------------------------------------------------------------------
+template <typename NeighborsOf, typename CrossingsOf>
+geo::ChannelAdjacency::ChannelAdjacency(std::size_t nChannels,
+                                        unsigned int neighborDistance,
+                                        NeighborsOf neighborsOf,
+                                        CrossingsOf crossingsOf)
+  : fNeighborDistance{neighborDistance}
+{
+  std::vector<raw::ChannelID_t> buffer;
+  fillTable(nChannels, neighborsOf, fNeighborOffsets, fNeighbors, buffer);
+  fillTable(nChannels, crossingsOf, fCrossingOffsets, fCrossings, buffer);
+} // geo::ChannelAdjacency::ChannelAdjacency()
+
+//------------------------------------------------------------------------------
+template <typename Collect>
+void geo::ChannelAdjacency::fillTable(std::size_t nChannels,
+                                      Collect& collect,
+                                      std::vector<std::size_t>& offsets,
+                                      std::vector<raw::ChannelID_t>& values,
+                                      std::vector<raw::ChannelID_t>& buffer)
+{
+  offsets.clear();
+  values.clear();
+  offsets.reserve(nChannels + 1U);
+  for (raw::ChannelID_t channel = 0; channel < nChannels; ++channel) {
+    offsets.push_back(values.size());
+    buffer.clear();
+    collect(channel, buffer);
+    std::sort(buffer.begin(), buffer.end());
+    auto const last = std::unique(buffer.begin(), buffer.end());
+    values.insert(values.end(), buffer.begin(), std::remove(buffer.begin(), last, channel));
+  }
+  offsets.push_back(values.size());
+  values.shrink_to_fit();
+} // geo::ChannelAdjacency::fillTable()
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREALG_GEOMETRY_CHANNELADJACENCY_H
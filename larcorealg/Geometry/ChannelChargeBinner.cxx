@@ -0,0 +1,252 @@
+/**
+ * @file   larcorealg/Geometry/ChannelChargeBinner.cxx
+ * @brief  Accumulation of charge deposits into ticks of the readout channels.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/ChannelChargeBinner.h`
+ */
+
+// LArSoft libraries
+#include "larcorealg/Geometry/ChannelChargeBinner.h"
+#include "larcorealg/Geometry/GeometryCore.h"
+#include "larcorealg/Geometry/GeometryDataContainers.h" // geo::details::MaxApplyTasks
+
+// framework libraries
+#include "cetlib_except/exception.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::sort(), std::lower_bound(), std::min()
+#include <cmath>     // std::floor()
+
+namespace {
+
+  /// Number of deposits projected together on the planes of a TPC.
+  constexpr std::size_t BlockSize = 256U;
+
+} // local namespace
+
+//------------------------------------------------------------------------------
+geo::ChannelChargeBinner::ChannelChargeBinner(geo::GeometryCore const& geom,
+                                              Config_t const& config)
+  : fGeom{&geom}, fConfig{config}
+{
+  if (fConfig.nTicks == 0U) {
+    throw cet::exception("ChannelChargeBinner") << "ChannelChargeBinner: no ticks configured\n";
+  }
+  if (!(fConfig.tickPeriod > 0.0)) {
+    throw cet::exception("ChannelChargeBinner")
+      << "ChannelChargeBinner: tick period must be positive (" << fConfig.tickPeriod
+      << " configured)\n";
+  }
+  if (fConfig.nShards == 0U) fConfig.nShards = DefaultShards;
+  fShards.resize(fConfig.nShards);
+} // geo::ChannelChargeBinner::ChannelChargeBinner()
+
+//------------------------------------------------------------------------------
+void geo::ChannelChargeBinner::add(util::span<geo::Point_t const*> positions,
+                                   util::span<double const*> charges,
+                                   util::span<double const*> times,
+                                   geo::TaskRunner_t const& runner /* = {} */)
+{
+  std::size_t const n = positions.size();
+  if ((charges.size() != n) || (times.size() != n)) {
+    throw cet::exception("ChannelChargeBinner")
+      << "ChannelChargeBinner::add(): " << n << " positions, " << charges.size()
+      << " charges and " << times.size() << " times given\n";
+  }
+  if (n == 0U) return;
+
+  // the chunks depend only on the batch size, so that the sums do not
+  // depend on the runner
+  std::size_t const nShards = fShards.size();
+  geo::runTasks(runner, nShards, [&](std::size_t iShard) {
+    std::size_t const begin = n * iShard / nShards;
+    std::size_t const end = n * (iShard + 1U) / nShards;
+    if (begin == end) return;
+    addChunk(fShards[iShard],
+             positions.begin() + begin,
+             charges.begin() + begin,
+             times.begin() + begin,
+             end - begin);
+  });
+} // geo::ChannelChargeBinner::add()
+
+//------------------------------------------------------------------------------
+void geo::ChannelChargeBinner::reduceInto(Result_t& charges,
+                                          geo::TaskRunner_t const& runner /* = {} */)
+{
+  std::size_t const nChannels = fGeom->Nchannels();
+  if (charges.size() < nChannels) {
+    throw cet::exception("ChannelChargeBinner")
+      << "ChannelChargeBinner::reduceInto(): result has " << charges.size()
+      << " channels, geometry has " << nChannels << "\n";
+  }
+
+  auto const byChannel = [](Entry_t const& a, Entry_t const& b) {
+    return (a.channel != b.channel) ? (a.channel < b.channel) : (a.tick < b.tick);
+  };
+  geo::runTasks(runner, fShards.size(), [&](std::size_t iShard) {
+    Shard_t& shard = fShards[iShard];
+    if (shard.sorted) return;
+    std::sort(shard.entries.begin(), shard.entries.end(), byChannel);
+    shard.sorted = true;
+  });
+
+  // each block of channels is filled by a single task, from all the shards
+  std::size_t const nBlocks = std::min<std::size_t>(geo::details::MaxApplyTasks, nChannels);
+  if (nBlocks == 0U) return;
+  std::size_t const nTicks = fConfig.nTicks;
+  geo::runTasks(runner, nBlocks, [&](std::size_t iBlock) {
+    auto const firstChannel = static_cast<raw::ChannelID_t>(nChannels * iBlock / nBlocks);
+    auto const endChannel = static_cast<raw::ChannelID_t>(nChannels * (iBlock + 1U) / nBlocks);
+    for (Shard_t const& shard : fShards) {
+      auto const lessThan = [](Entry_t const& entry, raw::ChannelID_t channel) {
+        return entry.channel < channel;
+      };
+      auto it = std::lower_bound(
+        shard.entries.begin(), shard.entries.end(), firstChannel, lessThan);
+      auto const end = shard.entries.end();
+      while ((it != end) && (it->channel < endChannel)) {
+        TickArray_t& ticks = charges[it->channel];
+        if (ticks.empty()) ticks.resize(nTicks, 0.0f);
+        ticks[it->tick] += it->charge;
+        ++it;
+      }
+    }
+  });
+} // geo::ChannelChargeBinner::reduceInto()
+
+//------------------------------------------------------------------------------
+auto geo::ChannelChargeBinner::result(geo::TaskRunner_t const& runner /* = {} */) -> Result_t
+{
+  Result_t charges{fGeom->Nchannels()};
+  reduceInto(charges, runner);
+  return charges;
+} // geo::ChannelChargeBinner::result()
+
+//------------------------------------------------------------------------------
+void geo::ChannelChargeBinner::reset()
+{
+  for (Shard_t& shard : fShards) {
+    shard.entries.clear();
+    shard.nDeposits = 0U;
+    shard.nNoTPC = 0U;
+    shard.nOutOfTime = 0U;
+    shard.nOffWires = 0U;
+    shard.sorted = true;
+  }
+} // geo::ChannelChargeBinner::reset()
+
+//------------------------------------------------------------------------------
+std::size_t geo::ChannelChargeBinner::nDeposits() const
+{
+  return sumOf(&Shard_t::nDeposits);
+}
+
+std::size_t geo::ChannelChargeBinner::nNoTPC() const
+{
+  return sumOf(&Shard_t::nNoTPC);
+}
+
+std::size_t geo::ChannelChargeBinner::nOutOfTime() const
+{
+  return sumOf(&Shard_t::nOutOfTime);
+}
+
+std::size_t geo::ChannelChargeBinner::nOffWires() const
+{
+  return sumOf(&Shard_t::nOffWires);
+}
+
+std::size_t geo::ChannelChargeBinner::nEntries() const
+{
+  std::size_t n = 0U;
+  for (Shard_t const& shard : fShards)
+    n += shard.entries.size();
+  return n;
+}
+
+//------------------------------------------------------------------------------
+void geo::ChannelChargeBinner::addChunk(Shard_t& shard,
+                                        geo::Point_t const* positions,
+                                        double const* charges,
+                                        double const* times,
+                                        std::size_t n) const
+{
+  shard.nDeposits += n;
+  shard.TPCIDs.resize(n);
+  fGeom->FindTPCsAtPositions({positions, positions + n},
+                             {shard.TPCIDs.data(), shard.TPCIDs.data() + n});
+
+  // selection of the deposits in time and in a TPC, then grouped by TPC
+  shard.ticks.resize(n);
+  shard.selected.clear();
+  double const nTicks = static_cast<double>(fConfig.nTicks);
+  for (std::size_t i = 0; i < n; ++i) {
+    double const tick = std::floor((times[i] - fConfig.startTime) / fConfig.tickPeriod);
+    if (!(tick >= 0.0) || !(tick < nTicks)) {
+      ++shard.nOutOfTime;
+      continue;
+    }
+    if (!shard.TPCIDs[i].isValid) {
+      ++shard.nNoTPC;
+      continue;
+    }
+    shard.ticks[i] = static_cast<std::uint32_t>(tick);
+    shard.selected.push_back(i);
+  }
+  std::vector<geo::TPCID> const& TPCIDs = shard.TPCIDs;
+  std::sort(shard.selected.begin(), shard.selected.end(), [&TPCIDs](std::size_t a, std::size_t b) {
+    return (TPCIDs[a] != TPCIDs[b]) ? (TPCIDs[a] < TPCIDs[b]) : (a < b);
+  });
+
+  // projection of the deposits of each TPC, one block at a time
+  double x[BlockSize], y[BlockSize], z[BlockSize];
+  std::vector<geo::GeometryCore::PlaneProjection_t> projections;
+  auto const nSelected = shard.selected.size();
+  std::size_t iFirst = 0U;
+  while (iFirst < nSelected) {
+    geo::TPCID const& tpcid = TPCIDs[shard.selected[iFirst]];
+    std::size_t iEnd = iFirst + 1U;
+    while ((iEnd < nSelected) && (TPCIDs[shard.selected[iEnd]] == tpcid))
+      ++iEnd;
+    std::size_t const nPlanes = fGeom->TPC(tpcid).Nplanes();
+    projections.resize(BlockSize * nPlanes);
+
+    for (std::size_t iBlock = iFirst; iBlock < iEnd; iBlock += BlockSize) {
+      std::size_t const nBlock = std::min(BlockSize, iEnd - iBlock);
+      for (std::size_t k = 0; k < nBlock; ++k) {
+        geo::Point_t const& position = positions[shard.selected[iBlock + k]];
+        x[k] = position.X();
+        y[k] = position.Y();
+        z[k] = position.Z();
+      }
+      fGeom->ProjectOntoPlanes(tpcid, nBlock, x, y, z, projections.data());
+
+      for (std::size_t k = 0; k < nBlock; ++k) {
+        std::size_t const i = shard.selected[iBlock + k];
+        auto const charge = static_cast<float>(charges[i]);
+        for (std::size_t p = 0; p < nPlanes; ++p) {
+          geo::GeometryCore::PlaneProjection_t const& proj = projections[k * nPlanes + p];
+          if (!proj.inPlane || !raw::isValidChannelID(proj.channel)) {
+            ++shard.nOffWires;
+            continue;
+          }
+          shard.entries.push_back({proj.channel, shard.ticks[i], charge});
+        }
+      }
+    } // for blocks
+    iFirst = iEnd;
+  } // while TPCs
+  if (nSelected > 0U) shard.sorted = false;
+} // geo::ChannelChargeBinner::addChunk()
+
+//------------------------------------------------------------------------------
+std::size_t geo::ChannelChargeBinner::sumOf(std::size_t Shard_t::*member) const
+{
+  std::size_t n = 0U;
+  for (Shard_t const& shard : fShards)
+    n += shard.*member;
+  return n;
+} // geo::ChannelChargeBinner::sumOf()
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,198 @@
+/**
+ * @file   larcorealg/Geometry/ChannelChargeBinner.h
+ * @brief  Accumulation of charge deposits into ticks of the readout channels.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/ChannelChargeBinner.cxx`
+ */
+
+#ifndef LARCOREALG_GEOMETRY_CHANNELCHARGEBINNER_H
+#define LARCOREALG_GEOMETRY_CHANNELCHARGEBINNER_H
+
+// LArSoft libraries
+#include "larcorealg/CoreUtils/span.h"
+#include "larcorealg/Geometry/ReadoutDataContainers.h"
+#include "larcorealg/Geometry/TaskRunner.h"
+#include "larcoreobj/SimpleTypesAndConstants/RawTypes.h" // raw::ChannelID_t
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+#include "larcoreobj/SimpleTypesAndConstants/geo_vectors.h"
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint32_t
+#include <vector>
+
+namespace geo {
+
+  class GeometryCore;
+
+  /**
+   * @brief Bins charge deposits into the ticks of the channels collecting them.
+   * @see `geo::GeometryCore::ProjectOntoPlanes()`
+   *
+   * This is the core of the detector simulation stage turning the charge
+   * drifted to the wire planes into a charge per channel and per tick: each
+   * deposit, with its position, charge and arrival time, is assigned to the
+   * TPC including its position, projected on each of the planes of that TPC,
+   * and its charge is added to the tick of its time on the channel of the
+   * nearest wire of each plane.
+   *
+   * Deposits are given in batches to `add()`, which splits each batch in one
+   * chunk per shard, and processes the chunks concurrently with the task
+   * runner: each chunk looks for the TPCs of its deposits
+   * (`geo::GeometryCore::FindTPCsAtPositions()`), sorts them by TPC and
+   * projects them in blocks on all the planes
+   * (`geo::GeometryCore::ProjectOntoPlanes()` for a TPC), and records the
+   * channel, tick and charge of each projection in its own shard, with no
+   * synchronization. `reduceInto()` or `result()` merge all the shards into a
+   * `readout::ChannelDataContainer` of tick arrays, splitting the channels in
+   * blocks among the tasks.
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * geo::ChannelChargeBinner binner{geom, { 6000U, 0.5, -250.0 }};
+   * geo::TaskRunner_t const runner = geo::makeThreadTaskRunner();
+   * for (auto const& batch: batches)
+   *   binner.add(batch.positions, batch.charges, batch.times, runner);
+   * auto const charges = binner.result(runner); // charges[channel][tick]
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   * Deposits with no TPC or with a time out of the ticks are skipped, and so
+   * are projections beyond the wires of a plane; they are counted
+   * (`nNoTPC()`, `nOutOfTime()`, `nOffWires()`).
+   *
+   * The tick array of a channel which collected no charge is left empty, so
+   * that the result takes memory only for the channels with charge. The sums
+   * depend on the order of the additions, which is the same in every run with
+   * the same batches and number of shards, whatever the runner.
+   * The binner keeps a reference to the geometry, which must stay valid.
+   */
+  class ChannelChargeBinner {
+
+  public:
+    /// Type of the charge of all the ticks of a channel.
+    using TickArray_t = std::vector<float>;
+
+    /// Type of the charge of all the channels.
+    using Result_t = readout::ChannelDataContainer<TickArray_t>;
+
+    /// Default number of shards.
+    static constexpr std::size_t DefaultShards = 16U;
+
+    /// Configuration of the binning.
+    struct Config_t {
+      std::size_t nTicks = 0U;          ///< Number of ticks of each channel.
+      double tickPeriod = 1.0;          ///< Duration of a tick (same unit as the times).
+      double startTime = 0.0;           ///< Start time of the first tick.
+      std::size_t nShards = DefaultShards; ///< Number of shards (and of parallel tasks).
+    };
+
+    /**
+     * @brief Constructor: bins charge on the channels of `geom`.
+     * @param geom the geometry, with its channel mapping
+     * @param config the configuration of the binning
+     * @throw cet::exception (category `"ChannelChargeBinner"`) if there are no
+     *        ticks or their period is not positive
+     *
+     * The number of shards should be at least the number of threads of the
+     * task runners passed to `add()`.
+     */
+    ChannelChargeBinner(geo::GeometryCore const& geom, Config_t const& config);
+
+    /// Returns the configuration of the binning.
+    Config_t const& config() const { return fConfig; }
+
+    /**
+     * @brief Bins a batch of deposits (`charges[i]` at `positions[i]` at `times[i]`).
+     * @param positions position of each deposit [cm]
+     * @param charges charge of each deposit
+     * @param times arrival time of each deposit on the planes
+     * @param runner the executor of the chunks of the batch (none: sequential)
+     * @throw cet::exception (category `"ChannelChargeBinner"`) if the sizes of
+     *        the three lists differ
+     *
+     * This must not run concurrently with other calls on this object.
+     */
+    void add(util::span<geo::Point_t const*> positions,
+             util::span<double const*> charges,
+             util::span<double const*> times,
+             geo::TaskRunner_t const& runner = {});
+
+    /**
+     * @brief Adds all the binned charge to `charges`.
+     * @param charges the charge of each channel, with an entry per channel
+     * @param runner the executor of the blocks of channels (none: sequential)
+     * @throw cet::exception (category `"ChannelChargeBinner"`) if `charges`
+     *        has fewer channels than the geometry
+     *
+     * The empty tick arrays of channels with charge are resized to the number
+     * of ticks; non-empty ones must have at least that size.
+     * This must not run concurrently with other calls on this object.
+     */
+    void reduceInto(Result_t& charges, geo::TaskRunner_t const& runner = {});
+
+    /// Returns the binned charge of all the channels (see `reduceInto()`).
+    Result_t result(geo::TaskRunner_t const& runner = {});
+
+    /// Removes all the charge binned so far, and resets the counts.
+    void reset();
+
+    /// @{
+    /// @name Statistics
+
+    /// Returns the number of deposits added.
+    std::size_t nDeposits() const;
+
+    /// Returns the number of deposits out of all the TPCs.
+    std::size_t nNoTPC() const;
+
+    /// Returns the number of deposits with a time out of the ticks.
+    std::size_t nOutOfTime() const;
+
+    /// Returns the number of projections of deposits out of the wires of a plane.
+    std::size_t nOffWires() const;
+
+    /// Returns the number of charge entries (deposit projections) binned.
+    std::size_t nEntries() const;
+
+    /// @}
+
+  private:
+    /// Charge of a deposit on a channel.
+    struct Entry_t {
+      raw::ChannelID_t channel; ///< Channel the charge is collected by.
+      std::uint32_t tick;       ///< Tick of the charge.
+      float charge;             ///< The charge.
+    };
+
+    /// Data of one shard, filled by one task at a time.
+    struct Shard_t {
+      std::vector<Entry_t> entries; ///< Charge binned so far.
+      std::size_t nDeposits = 0U;   ///< Deposits added.
+      std::size_t nNoTPC = 0U;      ///< Deposits with no TPC.
+      std::size_t nOutOfTime = 0U;  ///< Deposits out of the ticks.
+      std::size_t nOffWires = 0U;   ///< Projections beyond the wires.
+      bool sorted = true;           ///< Whether `entries` are sorted by channel.
+
+      std::vector<geo::TPCID> TPCIDs;     ///< Work area: TPC of each deposit.
+      std::vector<std::uint32_t> ticks;   ///< Work area: tick of each deposit.
+      std::vector<std::size_t> selected;  ///< Work area: deposits to be binned.
+    };
+
+    geo::GeometryCore const* fGeom; ///< The geometry.
+    Config_t fConfig;               ///< Binning configuration.
+    std::vector<Shard_t> fShards;   ///< All the shards.
+
+    /// Bins the `n` deposits starting at `positions`, `charges` and `times` into `shard`.
+    void addChunk(Shard_t& shard,
+                  geo::Point_t const* positions,
+                  double const* charges,
+                  double const* times,
+                  std::size_t n) const;
+
+    /// Returns the sum of `member` of all the shards.
+    std::size_t sumOf(std::size_t Shard_t::*member) const;
+
+  }; // class ChannelChargeBinner
+
+} // namespace geo
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREALG_GEOMETRY_CHANNELCHARGEBINNER_H
@@ -7,14 +7,348 @@
 
 #include "larcorealg/Geometry/ChannelMapAlg.h"
 #include "larcorealg/Geometry/AuxDetGeo.h"
+#include "larcorealg/Geometry/CryostatGeo.h"
+#include "larcorealg/Geometry/Exceptions.h" // geo::InvalidWireError, ...
+#include "larcorealg/Geometry/PlaneGeo.h"
+#include "larcorealg/Geometry/TPCGeo.h"
+
+#include "cetlib_except/exception.h"
+
+#include <algorithm> // std::sort(), std::unique(), std::max()
+#include <cassert>
+#include <memory> // std::make_unique()
+#include <string>
+
+namespace {
+
+  /// Returns the range of `values` of the dense index `index` in `offsets`.
+  template <typename ID>
+  util::span<typename std::vector<ID>::const_iterator> rangeAt(
+    std::vector<std::size_t> const& offsets,
+    std::vector<ID> const& values,
+    std::size_t index)
+  {
+    return {values.cbegin() + offsets[index], values.cbegin() + offsets[index + 1]};
+  }
+
+  /// Appends `ids` to `values` and records the new end into `offsets`.
+  template <typename ID>
+  void appendRange(std::vector<std::size_t>& offsets,
+                   std::vector<ID>& values,
+                   std::size_t index,
+                   std::vector<ID> const& ids)
+  {
+    offsets[index] = values.size();
+    values.insert(values.end(), ids.begin(), ids.end());
+    offsets[index + 1] = values.size();
+  }
+
+} // local namespace
 
 namespace geo {
 
+  //----------------------------------------------------------------------------
+  void ChannelMapAlg::EnableQueryMetrics(lar::util::QueryMetrics::Config_t const& config)
+  {
+    // names in the order of `Query_t`
+    std::vector<std::string> names{"SignalTypeForChannel",
+                                   "SignalTypeForROPID",
+                                   "ChannelToWireIDs",
+                                   "AuxDetNameToIndex",
+                                   "SensitiveAuxDetIndex"};
+    assert(names.size() == static_cast<std::size_t>(Query_t::NQueries));
+    fMetrics = std::make_unique<lar::util::QueryMetrics>(std::move(names), config);
+  }
+
+  //----------------------------------------------------------------------------
+  void ChannelMapAlg::UpdateAlignment(GeometryData_t const& geodata)
+  {
+    Uninitialize();
+    Initialize(geodata);
+    PrepareChannelToWireIDs(geodata);
+  }
+
+  //----------------------------------------------------------------------------
+  std::size_t ChannelMapAlg::MemoryUsage() const
+  {
+    return sizeof(ChannelMapAlg) + lar::util::heapMemory(fFirstChannelInThisPlane) +
+           lar::util::heapMemory(fFirstChannelInNextPlane) +
+           lar::util::heapMemory(fChannelWireOffsets) + lar::util::heapMemory(fChannelWireIDs) +
+           lar::util::heapMemory(fSortedPlaneIDs) + fHasPlaneID.capacity() / 8U +
+           lar::util::heapMemory(fAuxDetIndex) + lar::util::heapMemory(fADNameToGeoIndex) +
+           lar::util::heapMemory(fADNameToGeo) + lar::util::heapMemory(fADChannelToSensitiveGeo) +
+           lar::util::heapMemory(fTPCsetTPCOffsets) + lar::util::heapMemory(fTPCsetTPCs) +
+           lar::util::heapMemory(fROPPlaneOffsets) + lar::util::heapMemory(fROPPlanes) +
+           lar::util::heapMemory(fROPTPCOffsets) + lar::util::heapMemory(fROPTPCs) +
+           lar::util::heapMemory(fMetrics);
+  }
+
+  //----------------------------------------------------------------------------
+  void ChannelMapAlg::PrepareChannelToWireIDs(GeometryData_t const& geodata)
+  {
+    if (!fChannelWireOffsets.empty()) return; // already there
+
+    // collect all the channels connected to at least one wire
+    std::vector<raw::ChannelID_t> channels;
+    for (geo::CryostatGeo const& cryo : geodata.cryostats) {
+      for (geo::TPCGeo const& TPC : cryo.IterateTPCs()) {
+        for (geo::PlaneGeo const& plane : TPC.IteratePlanes()) {
+          for (unsigned int wire = 0; wire < plane.Nwires(); ++wire)
+            channels.push_back(PlaneWireToChannel(geo::WireID(plane.ID(), wire)));
+        } // for planes
+      }   // for TPCs
+    }     // for cryostats
+    std::sort(channels.begin(), channels.end());
+    channels.erase(std::unique(channels.begin(), channels.end()), channels.end());
+    while (!channels.empty() && !raw::isValidChannelID(channels.back()))
+      channels.pop_back();
+
+    // channels not connected to any wire are given an empty range
+    fChannelWireIDs.reserve(channels.size());
+    fChannelWireOffsets.reserve((channels.empty() ? 0U : channels.back()) + 2U);
+    for (raw::ChannelID_t const channel : channels) {
+      fChannelWireOffsets.resize(channel + 1U, fChannelWireIDs.size());
+      std::vector<geo::WireID> const wires = ChannelToWire(channel);
+      fChannelWireIDs.insert(fChannelWireIDs.end(), wires.begin(), wires.end());
+    }
+    fChannelWireOffsets.push_back(fChannelWireIDs.size());
+  }
+
+  //----------------------------------------------------------------------------
+  void ChannelMapAlg::PreparePlaneIDIndex()
+  {
+    std::set<geo::PlaneID> const& planeIDs = PlaneIDs();
+    fSortedPlaneIDs.assign(planeIDs.begin(), planeIDs.end());
+
+    // the dense mapping covers up to the largest number on each level
+    unsigned int nCryostats = 0U, nTPCs = 0U, nPlanes = 0U;
+    for (geo::PlaneID const& planeid : fSortedPlaneIDs) {
+      nCryostats = std::max(nCryostats, planeid.Cryostat + 1U);
+      nTPCs = std::max(nTPCs, planeid.TPC + 1U);
+      nPlanes = std::max(nPlanes, planeid.Plane + 1U);
+    }
+    fPlaneIDmapper.resize(nCryostats, nTPCs, nPlanes);
+    fHasPlaneID.assign(fPlaneIDmapper.size(), false);
+    for (geo::PlaneID const& planeid : fSortedPlaneIDs)
+      fHasPlaneID[fPlaneIDmapper.index(planeid)] = true;
+    fPlaneIDIndexReady = true;
+  }
+
+  //----------------------------------------------------------------------------
+  ChannelMapAlg::PlaneIDspan_t ChannelMapAlg::SortedPlaneIDs() const
+  {
+    if (!fPlaneIDIndexReady) {
+      throw cet::exception("ChannelMapAlg")
+        << "SortedPlaneIDs(): the list of plane IDs has not been prepared"
+           " (PreparePlaneIDIndex())\n";
+    }
+    return {fSortedPlaneIDs.cbegin(), fSortedPlaneIDs.cend()};
+  }
+
+  //----------------------------------------------------------------------------
+  void ChannelMapAlg::PrepareReadoutIndex(GeometryData_t const& geodata)
+  {
+    auto const nCryostats = static_cast<unsigned int>(geodata.cryostats.size());
+    fTPCsetIndex.resize(nCryostats, MaxTPCsets());
+    fROPIndex.resize(nCryostats, MaxTPCsets(), MaxROPs());
+
+    // IDs not in the mapping are left with an empty range
+    fTPCsetTPCOffsets.assign(fTPCsetIndex.size() + 1U, 0U);
+    fTPCsetTPCs.clear();
+    fROPPlaneOffsets.assign(fROPIndex.size() + 1U, 0U);
+    fROPPlanes.clear();
+    fROPTPCOffsets.assign(fROPIndex.size() + 1U, 0U);
+    fROPTPCs.clear();
+    for (unsigned int c = 0; c < nCryostats; ++c) {
+      readout::CryostatID const cryoid{c};
+      unsigned int const nTPCsets = NTPCsets(cryoid);
+      for (unsigned int s = 0; s < nTPCsets; ++s) {
+        readout::TPCsetID const tpcsetid{cryoid, s};
+        std::size_t const tpcsetIndex = fTPCsetIndex.index(tpcsetid);
+        appendRange(fTPCsetTPCOffsets, fTPCsetTPCs, tpcsetIndex, TPCsetToTPCs(tpcsetid));
+
+        unsigned int const nROPs = NROPs(tpcsetid);
+        for (unsigned int r = 0; r < nROPs; ++r) {
+          readout::ROPID const ropid{tpcsetid, r};
+          std::size_t const ropIndex = fROPIndex.index(ropid);
+          appendRange(fROPPlaneOffsets, fROPPlanes, ropIndex, ROPtoWirePlanes(ropid));
+          appendRange(fROPTPCOffsets, fROPTPCs, ropIndex, ROPtoTPCs(ropid));
+        } // for ROPs
+      }   // for TPC sets
+    }     // for cryostats
+
+    // IDs not in the mapping (gaps) start and end where the previous ID ends
+    for (std::size_t i = 1; i < fTPCsetTPCOffsets.size(); ++i)
+      fTPCsetTPCOffsets[i] = std::max(fTPCsetTPCOffsets[i], fTPCsetTPCOffsets[i - 1]);
+    for (std::size_t i = 1; i < fROPPlaneOffsets.size(); ++i) {
+      fROPPlaneOffsets[i] = std::max(fROPPlaneOffsets[i], fROPPlaneOffsets[i - 1]);
+      fROPTPCOffsets[i] = std::max(fROPTPCOffsets[i], fROPTPCOffsets[i - 1]);
+    }
+    fReadoutIndexReady = true;
+  }
+
+  //----------------------------------------------------------------------------
+  ChannelMapAlg::TPCIDspan_t ChannelMapAlg::TPCsetToTPCIDs(
+    readout::TPCsetID const& tpcsetid) const
+  {
+    if (!fReadoutIndexReady) {
+      throw cet::exception("ChannelMapAlg")
+        << "TPCsetToTPCIDs(): the readout tables have not been prepared"
+           " (PrepareReadoutIndex())\n";
+    }
+    if (!tpcsetid.isValid || !fTPCsetIndex.hasElement(tpcsetid)) return {};
+    return rangeAt(fTPCsetTPCOffsets, fTPCsetTPCs, fTPCsetIndex.index(tpcsetid));
+  }
+
+  //----------------------------------------------------------------------------
+  ChannelMapAlg::PlaneIDspan_t ChannelMapAlg::ROPtoWirePlaneIDs(readout::ROPID const& ropid) const
+  {
+    if (!fReadoutIndexReady) {
+      throw cet::exception("ChannelMapAlg")
+        << "ROPtoWirePlaneIDs(): the readout tables have not been prepared"
+           " (PrepareReadoutIndex())\n";
+    }
+    if (!ropid.isValid || !fROPIndex.hasElement(ropid)) return {};
+    return rangeAt(fROPPlaneOffsets, fROPPlanes, fROPIndex.index(ropid));
+  }
+
+  //----------------------------------------------------------------------------
+  ChannelMapAlg::TPCIDspan_t ChannelMapAlg::ROPtoTPCIDs(readout::ROPID const& ropid) const
+  {
+    if (!fReadoutIndexReady) {
+      throw cet::exception("ChannelMapAlg")
+        << "ROPtoTPCIDs(): the readout tables have not been prepared"
+           " (PrepareReadoutIndex())\n";
+    }
+    if (!ropid.isValid || !fROPIndex.hasElement(ropid)) return {};
+    return rangeAt(fROPTPCOffsets, fROPTPCs, fROPIndex.index(ropid));
+  }
+
+  //----------------------------------------------------------------------------
+  void ChannelMapAlg::ClearChannelToWireIDs()
+  {
+    fChannelWireOffsets.clear();
+    fChannelWireIDs.clear();
+  }
+
+  //----------------------------------------------------------------------------
+  ChannelMapAlg::WireIDspan_t ChannelMapAlg::ChannelToWireIDs(raw::ChannelID_t channel) const
+  {
+    auto const query = StartQuery(Query_t::ChannelToWireIDs);
+    if (fChannelWireOffsets.empty()) {
+      throw cet::exception("ChannelMapAlg")
+        << "ChannelToWireIDs(): the table of wires per channel has not been prepared"
+           " (PrepareChannelToWireIDs())\n";
+    }
+    if (channel >= fChannelWireOffsets.size() - 1U)
+      throw cet::exception("Geometry") << "ILLEGAL CHANNEL ID for channel " << channel << "\n";
+
+    auto const wireBegin = fChannelWireIDs.cbegin();
+    if (fChannelWireOffsets[channel] == fChannelWireOffsets[channel + 1]) query.miss();
+    return {wireBegin + fChannelWireOffsets[channel], wireBegin + fChannelWireOffsets[channel + 1]};
+  }
+
+  //----------------------------------------------------------------------------
+  void ChannelMapAlg::ChannelsToWireIDs(util::span<raw::ChannelID_t const*> channels,
+                                        util::span<WireIDspan_t*> wires) const
+  {
+    if (wires.size() < channels.size()) {
+      throw cet::exception("ChannelMapAlg")
+        << "ChannelsToWireIDs(): room for only " << wires.size() << " results, "
+        << channels.size() << " channels requested\n";
+    }
+    WireIDspan_t* iWires = wires.begin();
+    for (raw::ChannelID_t const channel : channels)
+      *(iWires++) = ChannelToWireIDs(channel);
+  }
+
+  //----------------------------------------------------------------------------
+  void ChannelMapAlg::ChannelsToROPs(util::span<raw::ChannelID_t const*> channels,
+                                     util::span<readout::ROPID*> ropids) const
+  {
+    if (ropids.size() < channels.size()) {
+      throw cet::exception("ChannelMapAlg")
+        << "ChannelsToROPs(): room for only " << ropids.size() << " results, " << channels.size()
+        << " channels requested\n";
+    }
+    readout::ROPID* iROP = ropids.begin();
+    for (raw::ChannelID_t const channel : channels)
+      *(iROP++) = ChannelToROP(channel);
+  }
+
+  //----------------------------------------------------------------------------
+  void ChannelMapAlg::PlaneWireToChannels(util::span<geo::WireID const*> wireIDs,
+                                          util::span<raw::ChannelID_t*> channels) const
+  {
+    if (channels.size() < wireIDs.size()) {
+      throw cet::exception("ChannelMapAlg")
+        << "PlaneWireToChannels(): room for only " << channels.size() << " results, "
+        << wireIDs.size() << " wires requested\n";
+    }
+    raw::ChannelID_t* iChannel = channels.begin();
+    for (geo::WireID const& wireID : wireIDs)
+      *(iChannel++) = PlaneWireToChannel(wireID);
+  }
+
+  //----------------------------------------------------------------------------
+  void ChannelMapAlg::WireCoordinates(util::span<double const*> YPos,
+                                      util::span<double const*> ZPos,
+                                      geo::PlaneID const& planeID,
+                                      util::span<double*> wireCoords) const
+  {
+    CheckWireCoordinatesArguments(YPos.size(), ZPos.size(), wireCoords.size());
+    double const* z = ZPos.begin();
+    double* wireCoord = wireCoords.begin();
+    for (double const y : YPos)
+      *(wireCoord++) = WireCoordinate(y, *(z++), planeID);
+  }
+
+  //----------------------------------------------------------------------------
+  void ChannelMapAlg::CheckWireCoordinatesArguments(std::size_t nY,
+                                                    std::size_t nZ,
+                                                    std::size_t nOut)
+  {
+    if (nY != nZ) {
+      throw cet::exception("ChannelMapAlg")
+        << "WireCoordinates(): " << nY << " y coordinates but " << nZ << " z coordinates\n";
+    }
+    if (nOut < nY) {
+      throw cet::exception("ChannelMapAlg") << "WireCoordinates(): room for only " << nOut
+                                            << " results, " << nY << " positions requested\n";
+    }
+  }
+
   //----------------------------------------------------------------------------
   unsigned int ChannelMapAlg::NearestWire(const TVector3& worldPos,
                                           geo::PlaneID const& planeID) const
   {
-    return NearestWireID(worldPos, planeID).Wire;
+    return NearestWireID(geo::Point_t{worldPos.X(), worldPos.Y(), worldPos.Z()}, planeID).Wire;
+  }
+
+  //----------------------------------------------------------------------------
+  geo::WireID ChannelMapAlg::NearestWireID(geo::Point_t const& worldPos,
+                                           geo::PlaneID const& planeID) const
+  {
+    return NearestWireID(TVector3{worldPos.X(), worldPos.Y(), worldPos.Z()}, planeID);
+  }
+
+  //----------------------------------------------------------------------------
+  geo::WireID ChannelMapAlg::NearestWireIDchecked(geo::Point_t const& worldPos,
+                                                  geo::PlaneID const& planeID) const
+  {
+    int cappedWireNo = 0;
+    try {
+      return NearestWireID(worldPos, planeID);
+    }
+    catch (geo::InvalidWireError const& e) {
+      if (e.hasSuggestedWire()) cappedWireNo = e.suggestedWire();
+    }
+    catch (geo::InvalidWireIDError const& e) {
+      if (e.better_wire_number >= 0) cappedWireNo = e.better_wire_number;
+    }
+    geo::WireID wireID{planeID, (geo::WireID::WireID_t)cappedWireNo};
+    wireID.markInvalid();
+    return wireID;
   }
 
   //----------------------------------------------------------------------------
@@ -71,39 +405,55 @@ namespace geo {
   }
 
   //----------------------------------------------------------------------------
-  size_t ChannelMapAlg::NearestAuxDet(const double* point,
-                                      std::vector<geo::AuxDetGeo> const& auxDets,
-                                      double tolerance) const
+  void ChannelMapAlg::PrepareAuxDetIndex(std::vector<geo::AuxDetGeo> const& auxDets)
   {
-    double HalfCenterWidth = 0.;
-    double localPoint[3] = {0.};
+    fAuxDetIndex.build(auxDets);
 
-    for (size_t a = 0; a < auxDets.size(); ++a) {
+    fADNameToGeoIndex.clear();
+    fADNameToGeoIndex.reserve(fADNameToGeo.size());
+    for (auto const& [name, index] : fADNameToGeo)
+      fADNameToGeoIndex.emplace(name, index);
+    fNIndexedADNames = fADNameToGeo.size();
+  }
 
-      auxDets[a].WorldToLocal(point, localPoint);
-
-      HalfCenterWidth = 0.5 * (auxDets[a].HalfWidth1() + auxDets[a].HalfWidth2());
-
-      if (localPoint[2] >= -(auxDets[a].Length() / 2 + tolerance) &&
-          localPoint[2] <= (auxDets[a].Length() / 2 + tolerance) &&
-          localPoint[1] >= -auxDets[a].HalfHeight() - tolerance &&
-          localPoint[1] <= auxDets[a].HalfHeight() + tolerance &&
-          // if AuxDet a is a box, then HalfSmallWidth = HalfWidth
-          localPoint[0] >= -HalfCenterWidth +
-                             localPoint[2] * (HalfCenterWidth - auxDets[a].HalfWidth2()) /
-                               (0.5 * auxDets[a].Length()) -
-                             tolerance &&
-          localPoint[0] <= HalfCenterWidth -
-                             localPoint[2] * (HalfCenterWidth - auxDets[a].HalfWidth2()) /
-                               (0.5 * auxDets[a].Length()) +
-                             tolerance)
-        return a;
+  //----------------------------------------------------------------------------
+  size_t ChannelMapAlg::FindAuxDet(const double* point,
+                                   std::vector<geo::AuxDetGeo> const& auxDets,
+                                   double tolerance) const
+  {
+    if (fAuxDetIndex.indexes(auxDets)) return fAuxDetIndex.findAuxDet(point, tolerance);
 
+    for (size_t a = 0; a < auxDets.size(); ++a) {
+      if (geo::AuxDetSpatialIndex::contains(auxDets[a], point, tolerance)) return a;
     } // for loop over AudDet a
+    return geo::AuxDetSpatialIndex::NoIndex;
+  }
 
-    // throw an exception because we couldn't find the sensitive volume
-    throw cet::exception("ChannelMap") << "Can't find AuxDet for position (" << point[0] << ","
-                                       << point[1] << "," << point[2] << ")\n";
+  //----------------------------------------------------------------------------
+  size_t ChannelMapAlg::FindSensitiveAuxDet(const double* point,
+                                            std::vector<geo::AuxDetGeo> const& auxDets,
+                                            size_t ad,
+                                            double tolerance) const
+  {
+    if (fAuxDetIndex.indexes(auxDets)) return fAuxDetIndex.findSensitive(point, ad, tolerance);
+
+    geo::AuxDetGeo const& adg = auxDets[ad];
+    for (size_t a = 0; a < adg.NSensitiveVolume(); ++a) {
+      if (geo::AuxDetSpatialIndex::contains(adg.SensitiveVolume(a), point, tolerance)) return a;
+    } // for loop over AuxDetSensitive a
+    return geo::AuxDetSpatialIndex::NoIndex;
+  }
+
+  //----------------------------------------------------------------------------
+  size_t ChannelMapAlg::NearestAuxDet(const double* point,
+                                      std::vector<geo::AuxDetGeo> const& auxDets,
+                                      double tolerance) const
+  {
+    size_t const a = FindAuxDet(point, auxDets, tolerance);
+    if (a != geo::AuxDetSpatialIndex::NoIndex) return a;
+
+    // throw an exception because we couldn't find the detector
+    throw geo::PositionLookupError("ChannelMap", "AuxDet", point);
 
     return UINT_MAX;
   }
@@ -113,39 +463,13 @@ namespace geo {
                                                std::vector<geo::AuxDetGeo> const& auxDets,
                                                double tolerance) const
   {
-    double HalfCenterWidth = 0.;
-    double localPoint[3] = {0.};
-
     size_t auxDetIdx = this->NearestAuxDet(point, auxDets, tolerance);
 
-    geo::AuxDetGeo const& adg = auxDets[auxDetIdx];
-
-    for (size_t a = 0; a < adg.NSensitiveVolume(); ++a) {
-
-      geo::AuxDetSensitiveGeo const& adsg = adg.SensitiveVolume(a);
-      adsg.WorldToLocal(point, localPoint);
-
-      HalfCenterWidth = 0.5 * (adsg.HalfWidth1() + adsg.HalfWidth2());
-
-      if (localPoint[2] >= -(adsg.Length() / 2 + tolerance) &&
-          localPoint[2] <= (adsg.Length() / 2 + tolerance) &&
-          localPoint[1] >= -adsg.HalfHeight() - tolerance &&
-          localPoint[1] <= adsg.HalfHeight() + tolerance &&
-          // if AuxDet a is a box, then HalfSmallWidth = HalfWidth
-          localPoint[0] >=
-            -HalfCenterWidth +
-              localPoint[2] * (HalfCenterWidth - adsg.HalfWidth2()) / (0.5 * adsg.Length()) -
-              tolerance &&
-          localPoint[0] <=
-            HalfCenterWidth -
-              localPoint[2] * (HalfCenterWidth - adsg.HalfWidth2()) / (0.5 * adsg.Length()) +
-              tolerance)
-        return a;
-    } // for loop over AuxDetSensitive a
+    size_t const a = FindSensitiveAuxDet(point, auxDets, auxDetIdx, tolerance);
+    if (a != geo::AuxDetSpatialIndex::NoIndex) return a;
 
     // throw an exception because we couldn't find the sensitive volume
-    throw cet::exception("Geometry") << "Can't find AuxDetSensitive for position (" << point[0]
-                                     << "," << point[1] << "," << point[2] << ")\n";
+    throw geo::PositionLookupError("Geometry", "AuxDetSensitive", point);
 
     return UINT_MAX;
   }
@@ -155,14 +479,7 @@ namespace geo {
                                         std::string const& detName,
                                         uint32_t const& /*channel*/) const
   {
-    // loop over the map of AuxDet names to Geo object numbers to determine which auxdet
-    // we have.  If no name in the map matches the provided string, throw an exception
-    for (auto itr : fADNameToGeo)
-      if (itr.first.compare(detName) == 0) return itr.second;
-
-    throw cet::exception("Geometry") << "No AuxDetGeo matching name: " << detName;
-
-    return UINT_MAX;
+    return AuxDetNameToIndex(detName);
   }
 
   //----------------------------------------------------------------------------
@@ -174,35 +491,62 @@ namespace geo {
     uint32_t const& channel) const
   {
     size_t adGeoIdx = this->ChannelToAuxDet(auxDets, detName, channel);
+    return std::make_pair(adGeoIdx, SensitiveAuxDetIndex(adGeoIdx, channel));
+  }
 
-    // look for the index of the sensitive volume for the given channel
-    if (fADChannelToSensitiveGeo.count(adGeoIdx) > 0) {
-
-      auto itr = fADChannelToSensitiveGeo.find(adGeoIdx);
+  //----------------------------------------------------------------------------
+  size_t ChannelMapAlg::AuxDetNameToIndex(std::string_view detName) const
+  {
+    auto const query = StartQuery(Query_t::AuxDetNameToIndex);
+    if (fNIndexedADNames == fADNameToGeo.size()) {
+      auto const itr = fADNameToGeoIndex.find(detName);
+      if (itr != fADNameToGeoIndex.end()) return itr->second;
+    }
+    else {
+      // loop over the map of AuxDet names to Geo object numbers to determine which auxdet
+      // we have.  If no name in the map matches the provided string, throw an exception
+      for (auto const& itr : fADNameToGeo)
+        if (itr.first == detName) return itr.second;
+    }
 
-      // get the vector of channels to AuxDetSensitiveGeo index
-      if (channel < itr->second.size()) return std::make_pair(adGeoIdx, itr->second[channel]);
+    throw cet::exception("Geometry") << "No AuxDetGeo matching name: " << detName;
+  }
 
+  //----------------------------------------------------------------------------
+  size_t ChannelMapAlg::SensitiveAuxDetIndex(size_t ad, uint32_t channel) const
+  {
+    auto const query = StartQuery(Query_t::SensitiveAuxDetIndex);
+    // look for the index of the sensitive volume for the given channel
+    auto const itr = fADChannelToSensitiveGeo.find(ad);
+    if (itr == fADChannelToSensitiveGeo.end()) {
       throw cet::exception("Geometry")
-        << "Given AuxDetSensitive channel, " << channel
-        << ", cannot be found in vector associated to AuxDetGeo index: " << adGeoIdx
-        << ". Vector has size " << itr->second.size();
+        << "Given AuxDetGeo with index " << ad
+        << " does not correspond to any vector of sensitive volumes";
     }
 
-    throw cet::exception("Geometry") << "Given AuxDetGeo with index " << adGeoIdx
-                                     << " does not correspond to any vector of sensitive volumes";
+    // get the vector of channels to AuxDetSensitiveGeo index
+    if (channel < itr->second.size()) return itr->second[channel];
 
-    return std::make_pair(adGeoIdx, UINT_MAX);
+    throw cet::exception("Geometry")
+      << "Given AuxDetSensitive channel, " << channel
+      << ", cannot be found in vector associated to AuxDetGeo index: " << ad
+      << ". Vector has size " << itr->second.size();
   }
 
   geo::SigType_t ChannelMapAlg::SignalTypeForChannel(raw::ChannelID_t const channel) const
   {
-    return SignalTypeForChannelImpl(channel);
+    auto const query = StartQuery(Query_t::SignalTypeForChannel);
+    geo::SigType_t const sigType = SignalTypeForChannelImpl(channel);
+    if (sigType == geo::kMysteryType) query.miss();
+    return sigType;
   }
 
   geo::SigType_t ChannelMapAlg::SignalTypeForROPID(readout::ROPID const& ropid) const
   {
-    return SignalTypeForROPIDImpl(ropid);
+    auto const query = StartQuery(Query_t::SignalTypeForROPID);
+    geo::SigType_t const sigType = SignalTypeForROPIDImpl(ropid);
+    if (sigType == geo::kMysteryType) query.miss();
+    return sigType;
   }
 
   geo::SigType_t ChannelMapAlg::SignalTypeForROPIDImpl(readout::ROPID const& ropid) const
@@ -10,10 +10,18 @@
 ////////////////////////////////////////////////////////////////////////
 
 // LArSoft  libraries
+#include "larcorealg/CoreUtils/MemoryUsage.h"
+#include "larcorealg/CoreUtils/QueryMetrics.h"
+#include "larcorealg/CoreUtils/span.h"
+#include "larcorealg/Geometry/AuxDetSpatialIndex.h"
 #include "larcorealg/Geometry/GeoObjectSorter.h"
 #include "larcorealg/Geometry/GeometryData.h"
+#include "larcorealg/Geometry/GeometryIDmapper.h" // geo::PlaneIDmapper
+#include "larcorealg/Geometry/ReadoutIDmapper.h" // readout::ROPIDmapper
+#include "larcorealg/Geometry/details/SparseChannelTable.h"
 #include "larcoreobj/SimpleTypesAndConstants/RawTypes.h" // raw::ChannelID_t
 #include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+#include "larcoreobj/SimpleTypesAndConstants/geo_vectors.h" // geo::Point_t
 #include "larcoreobj/SimpleTypesAndConstants/readout_types.h"
 
 // ROOT libraries
@@ -22,8 +30,11 @@
 // C/C++ standard libraries
 #include <cstddef>
 #include <map>
+#include <memory> // std::unique_ptr
 #include <set>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -48,6 +59,15 @@ namespace geo {
   class ChannelMapAlg {
 
   public:
+    /// Type of view of the list of wires connected to a channel.
+    using WireIDspan_t = util::span<std::vector<geo::WireID>::const_iterator>;
+
+    /// Type of view of a sorted list of plane IDs.
+    using PlaneIDspan_t = util::span<std::vector<geo::PlaneID>::const_iterator>;
+
+    /// Type of view of a list of TPC IDs.
+    using TPCIDspan_t = util::span<std::vector<geo::TPCID>::const_iterator>;
+
     /// Virtual destructor
     virtual ~ChannelMapAlg() = default;
 
@@ -61,6 +81,95 @@ namespace geo {
     /// Deconfiguration: prepare for a following call of Initialize()
     virtual void Uninitialize() = 0;
 
+    /**
+     * @brief Updates the mapping after the geometry has been aligned
+     * @param geodata the aligned geometry, with the same topology as before
+     * @see `geo::GeometryCore::ApplyAlignment()`
+     *
+     * This implementation starts over with `Uninitialize()`, `Initialize()`
+     * and `PrepareChannelToWireIDs()`. Mappings caching only a few geometric
+     * quantities should override it to update just those.
+     */
+    virtual void UpdateAlignment(GeometryData_t const& geodata);
+
+    /**
+     * @brief Starts collecting metrics of the queries of this object.
+     * @param config configuration of the metrics
+     * @see `Metrics()`, `geo::GeometryCore::EnableQueryMetrics()`
+     *
+     * The calls, misses (unknown signal type) and exceptions of
+     * `SignalTypeForChannel()`, `SignalTypeForROPID()`, `ChannelToWireIDs()`
+     * (if not overridden), `AuxDetNameToIndex()` and `SensitiveAuxDetIndex()`
+     * are counted (`lar::util::QueryMetrics`).
+     * This method must not be called concurrently with any query.
+     */
+    void EnableQueryMetrics(lar::util::QueryMetrics::Config_t const& config);
+
+    /// Returns the query metrics (`nullptr` if not enabled).
+    lar::util::QueryMetrics const* Metrics() const { return fMetrics.get(); }
+
+    /**
+     * @brief Returns an estimate of the memory used by this object [bytes]
+     *
+     * This implementation includes the tables of this base class only.
+     * Implementations with their own tables should override it, adding them
+     * and their own size to the value from this implementation minus
+     * `sizeof(ChannelMapAlg)`.
+     */
+    virtual std::size_t MemoryUsage() const;
+
+    /**
+     * @brief Builds the table of wires per channel used by `ChannelToWireIDs()`
+     * @param geodata the geometry the mapping has been initialized with
+     *
+     * The table is built by querying `PlaneWireToChannel()` for every wire in
+     * the geometry and `ChannelToWire()` for every channel found this way.
+     * If the table is already present, this method does nothing; mapping
+     * implementations may then build it at the end of their `Initialize()`,
+     * and should clear it with `ClearChannelToWireIDs()` in `Uninitialize()`.
+     * `geo::GeometryCore` calls this method right after `Initialize()`.
+     */
+    void PrepareChannelToWireIDs(GeometryData_t const& geodata);
+
+    /**
+     * @brief Builds the list and the index of the plane IDs of `PlaneIDs()`
+     * @see `SortedPlaneIDs()`, `HasPlaneID()`
+     *
+     * The set from `PlaneIDs()` is copied into a contiguous sorted list, and a
+     * flag for each plane ID in a dense `geo::PlaneIDmapper` records whether
+     * the ID is in the set. The previous list, if any, is replaced.
+     * `geo::GeometryCore` calls this method right after `Initialize()`.
+     */
+    void PreparePlaneIDIndex();
+
+    /**
+     * @brief Builds the tables used by `TPCsetToTPCIDs()`, `ROPtoWirePlaneIDs()`
+     *        and `ROPtoTPCIDs()`
+     * @param geodata the geometry the mapping has been initialized with
+     *
+     * The tables are filled by querying `TPCsetToTPCs()`, `ROPtoWirePlanes()`
+     * and `ROPtoTPCs()` for every TPC set and readout plane of the mapping,
+     * and they are stored flat, with an offset array indexed by a dense
+     * mapping of the IDs. The previous tables, if any, are replaced.
+     * `geo::GeometryCore` calls this method right after `Initialize()`.
+     */
+    void PrepareReadoutIndex(GeometryData_t const& geodata);
+
+    /**
+     * @brief Builds the indices used by `NearestAuxDet()` and `ChannelToAuxDet()`
+     * @param auxDets the auxiliary detectors of the geometry
+     *
+     * With the spatial index, `NearestAuxDet()` and `NearestSensitiveAuxDet()`
+     * only test the detectors and sensitive volumes close to the point, instead
+     * of all of them; the index is used only when those methods are given the
+     * same list of detectors it was built from.
+     * The name index lets `AuxDetNameToIndex()` (and `ChannelToAuxDet()`) find
+     * a detector by its name in `fADNameToGeo` by hashing, without a scan of
+     * all of them; it must be prepared again if `fADNameToGeo` changes.
+     * `geo::GeometryCore` calls this method right after `Initialize()`.
+     */
+    void PrepareAuxDetIndex(std::vector<geo::AuxDetGeo> const& auxDets);
+
     /// @}
 
     //--------------------------------------------------------------------------
@@ -85,6 +194,38 @@ namespace geo {
     /// @throws cet::exception (category: "Geometry") if non-existent channel
     virtual std::vector<WireID> ChannelToWire(raw::ChannelID_t channel) const = 0;
 
+    /**
+     * @brief Returns a view of the TPC wires connected to the specified channel
+     * @param channel ID of the readout channel
+     * @return a view of the same wire IDs as `ChannelToWire()` would return
+     * @throws cet::exception (category: "Geometry") if non-existent channel
+     * @throws cet::exception (category: "ChannelMapAlg") if the table was not
+     *         prepared (see `PrepareChannelToWireIDs()`)
+     * @see ChannelToWire()
+     *
+     * Unlike `ChannelToWire()`, this method does not allocate memory: the
+     * returned view points into a table precomputed for all the channels, and
+     * it stays valid until the mapping is uninitialized.
+     * Channels connected to more than one wire are supported.
+     */
+    virtual WireIDspan_t ChannelToWireIDs(raw::ChannelID_t channel) const;
+
+    /**
+     * @brief Fills the views of the wires connected to each of the `channels`
+     * @param channels IDs of the readout channels
+     * @param wires (output) the view for each channel is written here
+     * @throws cet::exception (category: "ChannelMapAlg") if `wires` has fewer
+     *         elements than `channels`
+     * @throws cet::exception (category: "Geometry") if non-existent channel
+     * @see ChannelToWireIDs()
+     *
+     * The view of the wires of `channels[i]` is stored in `wires[i]`, as if by
+     * `ChannelToWireIDs(channels[i])`.
+     * This default implementation calls `ChannelToWireIDs()` on each channel.
+     */
+    virtual void ChannelsToWireIDs(util::span<raw::ChannelID_t const*> channels,
+                                   util::span<WireIDspan_t*> wires) const;
+
     /**
      * @brief Return the signal type of the specified channel
      * @param channel ID of the channel
@@ -140,6 +281,23 @@ namespace geo {
     /// Returns a list of the plane IDs in the whole detector
     virtual std::set<geo::PlaneID> const& PlaneIDs() const = 0;
 
+    /**
+     * @brief Returns the plane IDs of `PlaneIDs()` as a contiguous sorted list
+     * @throws cet::exception (category: "ChannelMapAlg") if the list was not
+     *         prepared (see `PreparePlaneIDIndex()`)
+     *
+     * The IDs are in the same order as in `PlaneIDs()`.
+     */
+    PlaneIDspan_t SortedPlaneIDs() const;
+
+    /// Returns whether `planeid` is in `PlaneIDs()`, with a single lookup.
+    /// @see `PreparePlaneIDIndex()`
+    bool HasPlaneID(geo::PlaneID const& planeid) const
+    {
+      return planeid.isValid && fPlaneIDmapper.hasElement(planeid) &&
+             fHasPlaneID[fPlaneIDmapper.index(planeid)];
+    }
+
     /**
      * @brief Returns the channel ID a wire is connected to
      * @param wireID ID of the wire
@@ -171,6 +329,23 @@ namespace geo {
                                                 unsigned int tpc,
                                                 unsigned int cstat) const = 0;
 
+    /**
+     * @brief Fills the IDs of the channels the specified wires are connected to
+     * @param wireIDs IDs of the wires
+     * @param channels (output) the channel of each wire is written here
+     * @throws cet::exception (category: "ChannelMapAlg") if `channels` has
+     *         fewer elements than `wireIDs`
+     * @see PlaneWireToChannel(geo::WireID const&)
+     *
+     * The channel of `wireIDs[i]` is stored in `channels[i]`, as if by
+     * `PlaneWireToChannel(wireIDs[i])`; the behaviour on invalid or not present
+     * wires is the same as the one of that method.
+     * This default implementation calls `PlaneWireToChannel()` on each wire;
+     * mapping implementations are encouraged to provide a faster one.
+     */
+    virtual void PlaneWireToChannels(util::span<geo::WireID const*> wireIDs,
+                                     util::span<raw::ChannelID_t*> channels) const;
+
     /// @}
 
     //--------------------------------------------------------------------------
@@ -317,6 +492,25 @@ namespace geo {
                                   unsigned int TPCNo,
                                   unsigned int cstat) const = 0;
 
+    /**
+     * @brief Computes the wire coordinate of many positions on the same plane
+     * @param YPos y coordinates of the positions
+     * @param ZPos z coordinates of the positions
+     * @param planeID ID of the plane
+     * @param wireCoords (output) the wire coordinate of each position
+     * @throws cet::exception (category: "ChannelMapAlg") if `ZPos` and `YPos`
+     *         have different sizes, or if `wireCoords` is shorter than them
+     * @see WireCoordinate(double, double, geo::PlaneID const&)
+     *
+     * The coordinates of the positions are passed as two separate arrays, and
+     * `wireCoords[i]` is set to `WireCoordinate(YPos[i], ZPos[i], planeID)`.
+     * This default implementation calls `WireCoordinate()` on each position.
+     */
+    virtual void WireCoordinates(util::span<double const*> YPos,
+                                 util::span<double const*> ZPos,
+                                 geo::PlaneID const& planeID,
+                                 util::span<double*> wireCoords) const;
+
     /**
      * @brief Returns the ID of the wire nearest to the specified position
      * @param worldPos position to be tested
@@ -333,6 +527,24 @@ namespace geo {
      * In other words, the result can be trusted only as long as the position
      * is within the specified wire plane.
      */
+    virtual geo::WireID NearestWireID(geo::Point_t const& worldPos,
+                                      geo::PlaneID const& planeID) const;
+
+    /// Returns the ID of the wire nearest to the position `{ x, y, z }`.
+    /// @see NearestWireID(geo::Point_t const&, geo::PlaneID const&)
+    geo::WireID NearestWireID(double const worldPos[3], geo::PlaneID const& planeID) const
+    {
+      return NearestWireID(geo::Point_t{worldPos[0], worldPos[1], worldPos[2]}, planeID);
+    }
+
+    /**
+     * @brief Returns the ID of the wire nearest to the specified position
+     * @see NearestWireID(geo::Point_t const&, geo::PlaneID const&)
+     * @deprecated Use the version with `geo::Point_t` instead
+     *
+     * The version with `geo::Point_t` calls this one by default, so that
+     * mapping implementations overriding only this method keep working.
+     */
     virtual geo::WireID NearestWireID(const TVector3& worldPos, geo::PlaneID const& planeID) const
     {
       return NearestWireID(worldPos, planeID.Plane, planeID.TPC, planeID.Cryostat);
@@ -354,6 +566,29 @@ namespace geo {
                                       unsigned int TPCNo,
                                       unsigned int cstat) const = 0;
 
+    /**
+     * @brief Returns the ID of the wire nearest to the specified position
+     * @param worldPos position to be tested
+     * @param planeID plane containing the wire
+     * @return the ID of the wire closest to worldPos in the specified plane
+     * @see NearestWireID(geo::Point_t const&, geo::PlaneID const&)
+     *
+     * This is the same as `NearestWireID()`, but it never throws: if the
+     * nearest wire is not present, the returned ID is marked invalid and its
+     * wire number is capped to the closest existing wire.
+     * This default implementation catches the exception from
+     * `NearestWireID()`; mapping implementations should override it with a
+     * direct check.
+     */
+    virtual geo::WireID NearestWireIDchecked(geo::Point_t const& worldPos,
+                                             geo::PlaneID const& planeID) const;
+
+    /// @deprecated Use the version with `geo::Point_t` instead
+    geo::WireID NearestWireIDchecked(const TVector3& worldPos, geo::PlaneID const& planeID) const
+    {
+      return NearestWireIDchecked(geo::Point_t{worldPos.X(), worldPos.Y(), worldPos.Z()}, planeID);
+    }
+
     /**
      * @brief Returns the index of the wire nearest to the specified position
      * @param worldPos position to be tested
@@ -414,6 +649,35 @@ namespace geo {
                                           std::vector<geo::AuxDetGeo> const& auxDets,
                                           double tolerance = 0) const;
 
+    /**
+     * @brief Returns the auxiliary detector containing `point`, without throwing
+     * @param point coordinates of the position to be investigated (x, y, z)
+     * @param auxDets list of the sought auxiliary detectors
+     * @param tolerance tolerance for comparison. Default 0.
+     * @return index of auxiliary detector within auxDets,
+     *         `geo::AuxDetLocation::InvalidIndex` if none
+     *
+     * This is the test of the default `NearestAuxDet()`, which throws instead
+     * when no detector contains the point.
+     */
+    size_t FindAuxDet(const double* point,
+                      std::vector<geo::AuxDetGeo> const& auxDets,
+                      double tolerance = 0) const;
+
+    /**
+     * @brief Returns the sensitive volume containing `point`, without throwing
+     * @param point coordinates of the position to be investigated (x, y, z)
+     * @param auxDets list of the auxiliary detectors
+     * @param ad index of the auxiliary detector within auxDets
+     * @param tolerance tolerance for comparison. Default 0.
+     * @return index of the sensitive volume within the detector,
+     *         `geo::AuxDetLocation::InvalidIndex` if none
+     */
+    size_t FindSensitiveAuxDet(const double* point,
+                               std::vector<geo::AuxDetGeo> const& auxDets,
+                               size_t ad,
+                               double tolerance = 0) const;
+
     /**
      * @brief Returns the index of the detector containing the specified channel
      * @param auxDets list of the auxiliary detectors
@@ -441,6 +705,26 @@ namespace geo {
       std::string const& detName,
       uint32_t const& channel) const;
 
+    /**
+     * @brief Returns the index of the auxiliary detector with the specified name
+     * @param detName name of the auxiliary detector
+     * @return the index of the detector in the sorted `AuxDetGeo` vector
+     * @throws cet::exception (category: "Geometry") if no detector has that name
+     *
+     * The index can be reused with `SensitiveAuxDetIndex()` for all the
+     * channels of the same detector.
+     */
+    size_t AuxDetNameToIndex(std::string_view detName) const;
+
+    /**
+     * @brief Returns the index of the sensitive volume read by a channel
+     * @param ad index of the auxiliary detector (e.g. from `AuxDetNameToIndex()`)
+     * @param channel number of the channel within that auxiliary detector
+     * @return the index of the sensitive volume within the detector
+     * @throws cet::exception (category: "Geometry") if the channel is unknown
+     */
+    size_t SensitiveAuxDetIndex(size_t ad, uint32_t channel) const;
+
     /// @}
 
     //--------------------------------------------------------------------------
@@ -475,6 +759,20 @@ namespace geo {
      */
     virtual std::vector<geo::TPCID> TPCsetToTPCs(readout::TPCsetID const& tpcsetid) const = 0;
 
+    /**
+     * @brief Returns a view of the TPCs belonging to the specified TPC set
+     * @param tpcsetid ID of the TPC set to convert into TPC IDs
+     * @return a view of the same TPC IDs as `TPCsetToTPCs()` would return
+     * @throws cet::exception (category: "ChannelMapAlg") if the tables were
+     *         not prepared (see `PrepareReadoutIndex()`)
+     *
+     * Unlike `TPCsetToTPCs()`, this method does not allocate memory: the
+     * returned view points into a precomputed table, and it stays valid until
+     * the tables are prepared again. The view is empty for invalid and for
+     * non-existent TPC sets.
+     */
+    TPCIDspan_t TPCsetToTPCIDs(readout::TPCsetID const& tpcsetid) const;
+
     /// Returns the ID of the first TPC belonging to the specified TPC set
     virtual geo::TPCID FirstTPCinTPCset(readout::TPCsetID const& tpcsetid) const = 0;
 
@@ -505,6 +803,10 @@ namespace geo {
     /// Returns a list of ID of planes belonging to the specified ROP
     virtual std::vector<geo::PlaneID> ROPtoWirePlanes(readout::ROPID const& ropid) const = 0;
 
+    /// Returns a view of the planes belonging to the specified ROP, like
+    /// `TPCsetToTPCIDs()` does for `TPCsetToTPCs()`.
+    PlaneIDspan_t ROPtoWirePlaneIDs(readout::ROPID const& ropid) const;
+
     /// Returns the ID of the first plane belonging to the specified ROP
     virtual geo::PlaneID FirstWirePlaneInROP(readout::ROPID const& ropid) const = 0;
 
@@ -520,6 +822,10 @@ namespace geo {
      */
     virtual std::vector<geo::TPCID> ROPtoTPCs(readout::ROPID const& ropid) const = 0;
 
+    /// Returns a view of the TPCs the specified ROP spans, like
+    /// `TPCsetToTPCIDs()` does for `TPCsetToTPCs()`.
+    TPCIDspan_t ROPtoTPCIDs(readout::ROPID const& ropid) const;
+
     /**
      * @brief Returns the ID of the ROP the channel belongs to
      * @return the ID of the ROP the channel belongs to (invalid if channel is)
@@ -531,6 +837,21 @@ namespace geo {
      */
     virtual readout::ROPID ChannelToROP(raw::ChannelID_t channel) const = 0;
 
+    /**
+     * @brief Fills the ID of the ROP of each of the `channels`
+     * @param channels IDs of the readout channels
+     * @param ropids (output) the ROP of each channel is written here
+     * @throws cet::exception (category: "ChannelMapAlg") if `ropids` has fewer
+     *         elements than `channels`
+     * @see ChannelToROP()
+     *
+     * The ROP of `channels[i]` is stored in `ropids[i]`, as if by
+     * `ChannelToROP(channels[i])`.
+     * This default implementation calls `ChannelToROP()` on each channel.
+     */
+    virtual void ChannelsToROPs(util::span<raw::ChannelID_t const*> channels,
+                                util::span<readout::ROPID*> ropids) const;
+
     /**
      * @brief Returns the ID of the first channel in the specified readout plane
      * @param ropid ID of the readout plane
@@ -578,11 +899,51 @@ namespace geo {
     template <typename T>
     using PlaneInfoMap_t = TPCInfoMap_t<std::vector<T>>;
 
+    /**
+     * @brief Table with constant time lookup for sparse channel numbers.
+     * @tparam T type of value stored for each channel (e.g. the wire IDs)
+     *
+     * Mappings whose channel numbers are not contiguous can fill one of these
+     * in their `Initialize()` and look the channels up in `ChannelToWire()`
+     * and similar methods, instead of a `std::map`.
+     * See `geo::details::SparseChannelTable` for the details.
+     */
+    template <typename T>
+    using SparseChannelTable_t = geo::details::SparseChannelTable<T>;
+
     // These 3D vectors are used in initializing the Channel map.
     // Only a 1D vector is really needed so far, but these are more general.
     PlaneInfoMap_t<raw::ChannelID_t> fFirstChannelInThisPlane;
     PlaneInfoMap_t<raw::ChannelID_t> fFirstChannelInNextPlane;
 
+    /// Position in `fChannelWireIDs` of the first wire of each channel; an
+    /// additional last entry marks the end of the wires of the last channel.
+    std::vector<std::size_t> fChannelWireOffsets;
+    std::vector<geo::WireID> fChannelWireIDs; ///< Wires of all channels, by channel.
+
+    std::vector<geo::PlaneID> fSortedPlaneIDs; ///< Plane IDs of `PlaneIDs()`, sorted.
+    geo::PlaneIDmapper<> fPlaneIDmapper;       ///< Dense mapping of the plane IDs.
+    std::vector<bool> fHasPlaneID;             ///< Whether each mapped ID is in `PlaneIDs()`.
+    bool fPlaneIDIndexReady = false;           ///< Whether `PreparePlaneIDIndex()` was run.
+
+    // tables of `PrepareReadoutIndex()`: the entries of each ID are in the
+    // position range given by its dense index and the following one
+    readout::TPCsetIDmapper<> fTPCsetIndex;     ///< Dense mapping of the TPC set IDs.
+    std::vector<std::size_t> fTPCsetTPCOffsets; ///< Start of the TPCs of each TPC set.
+    std::vector<geo::TPCID> fTPCsetTPCs;        ///< TPCs of all the TPC sets.
+    readout::ROPIDmapper<> fROPIndex;           ///< Dense mapping of the ROP IDs.
+    std::vector<std::size_t> fROPPlaneOffsets;  ///< Start of the planes of each ROP.
+    std::vector<geo::PlaneID> fROPPlanes;       ///< Planes of all the ROPs.
+    std::vector<std::size_t> fROPTPCOffsets;    ///< Start of the TPCs of each ROP.
+    std::vector<geo::TPCID> fROPTPCs;           ///< TPCs of all the ROPs.
+    bool fReadoutIndexReady = false;            ///< Whether `PrepareReadoutIndex()` was run.
+
+    geo::AuxDetSpatialIndex fAuxDetIndex; ///< Index of the auxiliary detectors by position.
+
+    /// Index of each name in `fADNameToGeo`, viewing the names stored there.
+    std::unordered_map<std::string_view, size_t> fADNameToGeoIndex;
+    size_t fNIndexedADNames = 0U; ///< Size of `fADNameToGeo` when indexed.
+
     std::map<std::string, size_t>
       fADNameToGeo; ///< map the names of the dets to the AuxDetGeo objects
     std::map<size_t, std::vector<size_t>>
@@ -673,6 +1034,34 @@ namespace geo {
     } // GetElementPtr()
 
     ///@} Internal structure data access
+
+    /// Removes the table of wires per channel (see `PrepareChannelToWireIDs()`).
+    void ClearChannelToWireIDs();
+
+    /// Throws an exception if the arguments of `WireCoordinates()` are
+    /// inconsistent, given their sizes.
+    static void CheckWireCoordinatesArguments(std::size_t nY, std::size_t nZ, std::size_t nOut);
+
+  private:
+    /// Instrumented queries (see `EnableQueryMetrics()`).
+    enum class Query_t : std::size_t {
+      SignalTypeForChannel,
+      SignalTypeForROPID,
+      ChannelToWireIDs,
+      AuxDetNameToIndex,
+      SensitiveAuxDetIndex,
+      NQueries
+    };
+
+    /// Query metrics (`nullptr` if disabled).
+    std::unique_ptr<lar::util::QueryMetrics> fMetrics;
+
+    /// Records a call to `query` in the metrics, if enabled.
+    /// The call lasts as long as the returned object.
+    lar::util::QueryMetrics::Scope_t StartQuery(Query_t query) const
+    {
+      return {fMetrics.get(), static_cast<std::size_t>(query)};
+    }
   };
 }
 #endif // GEO_CHANNELMAPALG_H
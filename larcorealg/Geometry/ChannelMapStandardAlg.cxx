@@ -9,22 +9,126 @@
 #include "larcorealg/Geometry/CryostatGeo.h"
 #include "larcorealg/Geometry/Exceptions.h"
 #include "larcorealg/Geometry/GeometryCore.h"
+#include "larcorealg/Geometry/MappedGeoIDdataContainer.h" // geo::details::ReadOnlyFileMapping
 #include "larcorealg/Geometry/PlaneGeo.h"
 #include "larcorealg/Geometry/TPCGeo.h"
 #include "larcorealg/Geometry/WireGeo.h"
+#include "larcorealg/Geometry/details/FingerprintHasher.h"
 
 #include "cetlib_except/exception.h"
+#include "fhiclcpp/ParameterSet.h"
 #include "messagefacility/MessageLogger/MessageLogger.h"
 
-namespace fhicl {
-  class ParameterSet;
-}
+#include <unistd.h> // getpid()
+
+#include <algorithm> // std::max()
+#include <cstddef>   // std::byte, std::size_t
+#include <cstdio>    // std::rename(), std::remove()
+#include <cstring>   // std::memcpy(), std::memcmp()
+#include <fstream>
+#include <type_traits>
+
+namespace {
+
+  /**
+   * @brief Header of the file of the plane tables of `geo::ChannelMapStandardAlg`.
+   *
+   * The header is followed by, in order: the sorted coordinates (`double`) and
+   * then the wire numbers (32-bit) of all the `nWireCenters` entries of the
+   * wire center tables, the number of TPCs in each cryostat and then the
+   * number of planes in each TPC (32-bit), and the `StandardPlaneRecord` of
+   * each plane. All the fields are in the byte order of the writer.
+   */
+  struct StandardTablesHeader {
+
+    static constexpr char Magic[8] = {'L', 'A', 'r', 'C', 'h', 'M', 'a', 'p'};
+    static constexpr std::uint32_t Version = 1U;
+    static constexpr std::uint32_t ByteOrder = 0x01020304U;
+
+    char magic[8];              ///< Identifier of the file format.
+    std::uint32_t version;      ///< Version of the file format.
+    std::uint32_t byteOrder;    ///< Written as `ByteOrder`.
+    std::uint64_t fingerprint;  ///< Hash of the geometry the tables are for.
+    std::uint32_t nCryostats;   ///< Number of cryostats.
+    std::uint32_t nTPCs;        ///< Number of TPCs in the detector.
+    std::uint32_t nPlanes;      ///< Number of planes in the detector.
+    std::uint32_t nWireCenters; ///< Number of wires in all the wire center tables.
+    std::uint64_t size;         ///< Size of the whole file, in bytes.
+
+  }; // StandardTablesHeader
+
+  static_assert(sizeof(StandardTablesHeader) == 48U);
+  static_assert(std::is_trivially_copyable_v<StandardTablesHeader>);
+
+  /// Constants of a plane in the file of `StandardTablesHeader`.
+  struct StandardPlaneRecord {
+    std::uint32_t nWires;       ///< Number of wires in the plane.
+    std::uint32_t nWireCenters; ///< Wires in the wire center table (`0` if uniform).
+    float firstWireProj;        ///< Wire coordinate of the first wire.
+    float orthY;                ///< _y_ component of the wire coordinate direction.
+    float orthZ;                ///< _z_ component of the wire coordinate direction.
+  }; // StandardPlaneRecord
+
+  static_assert(sizeof(geo::details::WireCenterTable::WireNo_t) == sizeof(std::uint32_t));
+
+  /// Position of each section of the file of `StandardTablesHeader` [bytes].
+  struct StandardTablesLayout {
+    std::size_t coords, wires, nTPCs, nPlanes, planes, end;
+
+    explicit StandardTablesLayout(StandardTablesHeader const& header)
+      : coords{sizeof(header)}
+      , wires{coords + header.nWireCenters * sizeof(double)}
+      , nTPCs{wires + header.nWireCenters * sizeof(std::uint32_t)}
+      , nPlanes{nTPCs + header.nCryostats * sizeof(std::uint32_t)}
+      , planes{nPlanes + header.nTPCs * sizeof(std::uint32_t)}
+      , end{planes + header.nPlanes * sizeof(StandardPlaneRecord)}
+    {}
+  }; // StandardTablesLayout
+
+  /// Reads into `header` and checks the tables file in `data` (`size` bytes).
+  /// @return a description of the problem, empty if there is none
+  std::string checkStandardTables(std::byte const* data,
+                                  std::size_t size,
+                                  std::uint64_t fingerprint,
+                                  StandardTablesHeader& header)
+  {
+    if (size < sizeof(header)) return "is too small for a header";
+    std::memcpy(&header, data, sizeof(header));
+    if (std::memcmp(header.magic, StandardTablesHeader::Magic, sizeof(header.magic)) != 0)
+      return "is not a channel map tables file";
+    if (header.version != StandardTablesHeader::Version)
+      return "has format version " + std::to_string(header.version);
+    if (header.byteOrder != StandardTablesHeader::ByteOrder)
+      return "was written with another byte order";
+    if (header.fingerprint != fingerprint) return "is for another geometry";
+
+    StandardTablesLayout const layout{header};
+    if ((header.size != size) || (layout.end != size)) return "is truncated or corrupted";
+
+    // the totals must match the content
+    auto const* nums = reinterpret_cast<std::uint32_t const*>(data + layout.nTPCs);
+    std::size_t nTPCs = 0U, nPlanes = 0U, nWireCenters = 0U;
+    for (std::uint32_t i = 0; i < header.nCryostats; ++i)
+      nTPCs += *(nums++);
+    if (nTPCs != header.nTPCs) return "is corrupted";
+    for (std::uint32_t i = 0; i < header.nTPCs; ++i)
+      nPlanes += *(nums++);
+    if (nPlanes != header.nPlanes) return "is corrupted";
+    auto const* planes = reinterpret_cast<StandardPlaneRecord const*>(data + layout.planes);
+    for (std::uint32_t i = 0; i < header.nPlanes; ++i)
+      nWireCenters += planes[i].nWireCenters;
+    if (nWireCenters != header.nWireCenters) return "is corrupted";
+    return {};
+  } // checkStandardTables()
+
+} // local namespace
 
 namespace geo {
 
   //----------------------------------------------------------------------------
   ChannelMapStandardAlg::ChannelMapStandardAlg(fhicl::ParameterSet const& p)
     : fSorter(geo::GeoObjectSorterStandard(p))
+    , fTablesCacheFile(p.get<std::string>("TablesCacheFile", ""))
   {}
 
   //----------------------------------------------------------------------------
@@ -33,96 +137,114 @@ namespace geo {
     // start over:
     Uninitialize();
 
+    mf::LogInfo("ChannelMapStandardAlg") << "Initializing Standard ChannelMap...";
+
+    // the plane tables are loaded from the cache file if it is for this geometry
+    if (fTablesCacheFile.empty())
+      FillPlaneTables(geodata);
+    else {
+      std::uint64_t const fingerprint = PlaneTablesFingerprint(geodata);
+      if (!LoadPlaneTables(fTablesCacheFile, fingerprint)) {
+        FillPlaneTables(geodata);
+        WritePlaneTables(fTablesCacheFile, fingerprint);
+      }
+    }
+
+    FillChannelTables();
+  }
+
+  //----------------------------------------------------------------------------
+  void ChannelMapStandardAlg::FillPlaneTables(GeometryData_t const& geodata)
+  {
     std::vector<geo::CryostatGeo> const& cgeo = geodata.cryostats;
 
     fNcryostat = cgeo.size();
+    fNTPC.resize(fNcryostat);
+    fNPlanes.resize(fNcryostat);
+    for (unsigned int cs = 0; cs != fNcryostat; ++cs) {
+      geo::CryostatGeo const& cryo = cgeo[cs];
+      fNTPC[cs] = cryo.NTPC();
+      fNPlanes[cs].resize(fNTPC[cs]);
+      for (unsigned int TPCCount = 0; TPCCount != fNTPC[cs]; ++TPCCount)
+        fNPlanes[cs][TPCCount] = cryo.TPC(TPCCount).Nplanes();
+    }
+    ResizePlaneTables();
+    fNonUniformWireCenters.clear();
 
-    mf::LogInfo("ChannelMapStandardAlg") << "Initializing Standard ChannelMap...";
+    for (unsigned int cs = 0; cs != fNcryostat; ++cs) {
+      for (unsigned int TPCCount = 0; TPCCount != fNTPC[cs]; ++TPCCount) {
+        geo::TPCGeo const& TPC = cgeo[cs].TPC(TPCCount);
+        for (unsigned int PlaneCount = 0; PlaneCount != fNPlanes[cs][TPCCount]; ++PlaneCount) {
+          geo::PlaneGeo const& plane = TPC.Plane(PlaneCount);
+          fWireCounts[cs][TPCCount][PlaneCount] = plane.Nwires();
+          UpdateWireProjection(plane);
+        } // end loop over planes
+      }   // end loop over TPCs
+    }     // end loop over cryostats
+  }
 
-    fNTPC.resize(fNcryostat);
+  //----------------------------------------------------------------------------
+  void ChannelMapStandardAlg::ResizePlaneTables()
+  {
     fWireCounts.resize(fNcryostat);
-    fNPlanes.resize(fNcryostat);
     fFirstWireProj.resize(fNcryostat);
     fOrthVectorsY.resize(fNcryostat);
     fOrthVectorsZ.resize(fNcryostat);
-    fPlaneBaselines.resize(fNcryostat);
-    fWiresPerPlane.resize(fNcryostat);
-    fFirstChannelInNextPlane.resize(fNcryostat);
-    fFirstChannelInThisPlane.resize(fNcryostat);
-    fPlaneIDs.clear();
-    fTopChannel = 0;
-
-    int RunningTotal = 0;
-
     for (unsigned int cs = 0; cs != fNcryostat; ++cs) {
-      geo::CryostatGeo const& cryo = cgeo[cs];
-      fNTPC[cs] = cryo.NTPC();
-
-      // Size up all the vectors
       fWireCounts[cs].resize(fNTPC[cs]);
       fFirstWireProj[cs].resize(fNTPC[cs]);
       fOrthVectorsY[cs].resize(fNTPC[cs]);
       fOrthVectorsZ[cs].resize(fNTPC[cs]);
-      fPlaneBaselines[cs].resize(fNTPC[cs]);
-      fWiresPerPlane[cs].resize(fNTPC[cs]);
-      fNPlanes[cs].resize(fNTPC[cs]);
-      fFirstChannelInThisPlane[cs].resize(fNTPC[cs]);
-      fFirstChannelInNextPlane[cs].resize(fNTPC[cs]);
-
       for (unsigned int TPCCount = 0; TPCCount != fNTPC[cs]; ++TPCCount) {
-        geo::TPCGeo const& TPC = cryo.TPC(TPCCount);
-        unsigned int PlanesThisTPC = TPC.Nplanes();
+        unsigned int const PlanesThisTPC = fNPlanes[cs][TPCCount];
         fWireCounts[cs][TPCCount].resize(PlanesThisTPC);
         fFirstWireProj[cs][TPCCount].resize(PlanesThisTPC);
         fOrthVectorsY[cs][TPCCount].resize(PlanesThisTPC);
         fOrthVectorsZ[cs][TPCCount].resize(PlanesThisTPC);
-        fNPlanes[cs][TPCCount] = PlanesThisTPC;
-        for (unsigned int PlaneCount = 0; PlaneCount != PlanesThisTPC; ++PlaneCount) {
-          geo::PlaneGeo const& plane = TPC.Plane(PlaneCount);
-
-          fPlaneIDs.emplace(PlaneID(cs, TPCCount, PlaneCount));
-          double ThisWirePitch = TPC.WirePitch(PlaneCount);
-          fWireCounts[cs][TPCCount][PlaneCount] = plane.Nwires();
-
-          double WireCentre1[3] = {0., 0., 0.};
-          double WireCentre2[3] = {0., 0., 0.};
+      } // for TPCs
+    }   // for cryostats
+  }
 
-          const geo::WireGeo& firstWire = plane.Wire(0);
-          const double sth = firstWire.SinThetaZ(), cth = firstWire.CosThetaZ();
+  //----------------------------------------------------------------------------
+  void ChannelMapStandardAlg::FillChannelTables()
+  {
+    fPlaneBaselines.assign(fNcryostat, {});
+    fWiresPerPlane.assign(fNcryostat, {});
+    fFirstChannelInNextPlane.assign(fNcryostat, {});
+    fFirstChannelInThisPlane.assign(fNcryostat, {});
+    fPlaneIDs.clear();
+    fChannelToWireMap.clear();
+    fChannelSignalTypes.clear();
+    fTopChannel = 0;
 
-          firstWire.GetCenter(WireCentre1, 0);
-          plane.Wire(1).GetCenter(WireCentre2, 0);
+    int RunningTotal = 0;
 
-          // figure out if we need to flip the orthogonal vector
-          // (should point from wire n -> n+1)
-          double OrthY = cth, OrthZ = -sth;
-          if (((WireCentre2[1] - WireCentre1[1]) * OrthY +
-               (WireCentre2[2] - WireCentre1[2]) * OrthZ) < 0) {
-            OrthZ *= -1;
-            OrthY *= -1;
-          }
+    for (unsigned int cs = 0; cs != fNcryostat; ++cs) {
+      fPlaneBaselines[cs].resize(fNTPC[cs]);
+      fWiresPerPlane[cs].resize(fNTPC[cs]);
+      fFirstChannelInThisPlane[cs].resize(fNTPC[cs]);
+      fFirstChannelInNextPlane[cs].resize(fNTPC[cs]);
 
-          // Overall we are trying to build an expression that looks like
-          //  int NearestWireNumber = round((worldPos.OrthVector - FirstWire.OrthVector)/WirePitch);
-          // That runs as fast as humanly possible.
-          // We predivide everything by the wire pitch so we don't do this in the loop.
-          //
-          // Putting this together into the useful constants we will use later per plane and tpc:
-          fOrthVectorsY[cs][TPCCount][PlaneCount] = OrthY / ThisWirePitch;
-          fOrthVectorsZ[cs][TPCCount][PlaneCount] = OrthZ / ThisWirePitch;
+      for (unsigned int TPCCount = 0; TPCCount != fNTPC[cs]; ++TPCCount) {
+        unsigned int const PlanesThisTPC = fNPlanes[cs][TPCCount];
+        for (unsigned int PlaneCount = 0; PlaneCount != PlanesThisTPC; ++PlaneCount) {
 
-          fFirstWireProj[cs][TPCCount][PlaneCount] =
-            WireCentre1[1] * OrthY + WireCentre1[2] * OrthZ;
-          fFirstWireProj[cs][TPCCount][PlaneCount] /= ThisWirePitch;
+          fPlaneIDs.emplace(PlaneID(cs, TPCCount, PlaneCount));
 
           // now to count up wires in each plane and get first channel in each plane
-          int WiresThisPlane = plane.Nwires();
+          int WiresThisPlane = static_cast<int>(fWireCounts[cs][TPCCount][PlaneCount]);
           fWiresPerPlane[cs].at(TPCCount).push_back(WiresThisPlane);
           fPlaneBaselines[cs].at(TPCCount).push_back(RunningTotal);
 
           RunningTotal += WiresThisPlane;
 
           fFirstChannelInThisPlane[cs].at(TPCCount).push_back(fTopChannel);
+          fChannelToWireMap.addPlane(
+            PlaneID(cs, TPCCount, PlaneCount), fTopChannel, WiresThisPlane);
+          // the last plane of each TPC is collection, all the others induction
+          fChannelSignalTypes.resize(fTopChannel + WiresThisPlane,
+                                     (PlaneCount + 1 == PlanesThisTPC) ? geo::kCollection :
+                                                                         geo::kInduction);
           fTopChannel += WiresThisPlane;
           fFirstChannelInNextPlane[cs].at(TPCCount).push_back(fTopChannel);
 
@@ -135,52 +257,296 @@ namespace geo {
 
     MF_LOG_DEBUG("ChannelMapStandard") << "# of channels is " << fNchannels;
 
-    return;
+    // flat copy of the plane baselines for the batch conversions
+    unsigned int maxPlanes = 0;
+    for (std::vector<unsigned int> const& cryoPlanes : fNPlanes) {
+      for (unsigned int const nPlanes : cryoPlanes)
+        maxPlanes = std::max(maxPlanes, nPlanes);
+    }
+    fFlatPlaneIndex.resize({fNcryostat, MaxTPCs(), maxPlanes});
+    fFlatPlaneBaselines.assign(fFlatPlaneIndex.size(), raw::InvalidChannelID);
+    for (geo::PlaneID const& planeID : fPlaneIDs)
+      fFlatPlaneBaselines[fFlatPlaneIndex.index(planeID)] = AccessElement(fPlaneBaselines, planeID);
+
+    // each channel reads exactly one wire, so the table of wires per channel
+    // is filled directly from the channel ranges, without the generic
+    // PrepareChannelToWireIDs() querying the mapping (and allocating) for each
+    fChannelWireIDs.reserve(fTopChannel);
+    fChannelWireOffsets.reserve(fTopChannel + 1);
+    for (auto const& planeChannels : fChannelToWireMap.planes()) {
+      fChannelWireOffsets.resize(planeChannels.firstChannel, fChannelWireIDs.size());
+      for (raw::ChannelID_t channel = planeChannels.firstChannel;
+           channel < planeChannels.endChannel;
+           ++channel) {
+        fChannelWireOffsets.push_back(fChannelWireIDs.size());
+        fChannelWireIDs.push_back(planeChannels.wireOf(channel));
+      } // for channels
+    }   // for planes
+    fChannelWireOffsets.push_back(fChannelWireIDs.size());
   }
 
   //----------------------------------------------------------------------------
-  void ChannelMapStandardAlg::Uninitialize() {}
+  std::uint64_t ChannelMapStandardAlg::PlaneTablesFingerprint(GeometryData_t const& geodata)
+  {
+    // only quantities cached by the planes are used, so that no wire is built
+    geo::details::FingerprintHasher hasher;
+    hasher.add(std::uint64_t{StandardTablesHeader::Version});
+    hasher.add(std::uint64_t{geodata.cryostats.size()});
+    for (geo::CryostatGeo const& cryo : geodata.cryostats) {
+      hasher.add(std::uint64_t{cryo.NTPC()});
+      for (unsigned int t = 0; t != cryo.NTPC(); ++t) {
+        geo::TPCGeo const& TPC = cryo.TPC(t);
+        hasher.add(std::uint64_t{TPC.Nplanes()});
+        for (unsigned int p = 0; p != TPC.Nplanes(); ++p) {
+          geo::PlaneGeo const& plane = TPC.Plane(p);
+          hasher.add(std::uint64_t{plane.Nwires()});
+          hasher.add(plane.WirePitch());
+          hasher.addVector(plane.GetWireDirection<geo::Vector_t>());
+          hasher.addVector(plane.GetIncreasingWireDirection<geo::Vector_t>());
+          hasher.addVector(plane.ProjectionReferencePoint<geo::Point_t>()); // first wire center
+          geo::details::WireCenterTable const& centers = plane.WireCenters();
+          hasher.add(std::uint64_t{centers.size()});
+          hasher.add(centers.sortedCoords(), centers.size() * sizeof(double));
+          hasher.add(centers.sortedWires(),
+                     centers.size() * sizeof(geo::details::WireCenterTable::WireNo_t));
+        } // for planes
+      }   // for TPCs
+    }     // for cryostats
+    return hasher.value();
+  }
 
   //----------------------------------------------------------------------------
-  std::vector<geo::WireID> ChannelMapStandardAlg::ChannelToWire(raw::ChannelID_t channel) const
+  bool ChannelMapStandardAlg::LoadPlaneTables(std::string const& path, std::uint64_t fingerprint)
   {
-    std::vector<geo::WireID> AllSegments;
-    unsigned int cstat = 0;
-    unsigned int tpc = 0;
-    unsigned int plane = 0;
-    unsigned int wire = 0;
+    geo::details::ReadOnlyFileMapping mapping;
+    try {
+      mapping = geo::details::ReadOnlyFileMapping{path};
+    }
+    catch (cet::exception const&) {
+      mf::LogInfo("ChannelMapStandardAlg")
+        << "Channel map tables file '" << path << "' not available: tables will be computed.";
+      return false;
+    }
 
-    // first check if this channel ID is legal
-    if (channel > fTopChannel)
-      throw cet::exception("Geometry") << "ILLEGAL CHANNEL ID for channel " << channel << "\n";
+    StandardTablesHeader header;
+    if (std::string const problem =
+          checkStandardTables(mapping.data(), mapping.size(), fingerprint, header);
+        !problem.empty()) {
+      mf::LogInfo("ChannelMapStandardAlg") << "Channel map tables file '" << path << "' "
+                                           << problem << ": tables will be computed.";
+      return false;
+    }
+
+    StandardTablesLayout const layout{header};
+    std::byte const* const data = mapping.data();
+    auto const* coords = reinterpret_cast<double const*>(data + layout.coords);
+    auto const* wires =
+      reinterpret_cast<geo::details::WireCenterTable::WireNo_t const*>(data + layout.wires);
+    auto const* TPCsInCryostats = reinterpret_cast<std::uint32_t const*>(data + layout.nTPCs);
+    auto const* planesInTPCs = reinterpret_cast<std::uint32_t const*>(data + layout.nPlanes);
+    auto const* planes = reinterpret_cast<StandardPlaneRecord const*>(data + layout.planes);
+
+    fNcryostat = header.nCryostats;
+    fNTPC.assign(TPCsInCryostats, TPCsInCryostats + fNcryostat);
+    fNPlanes.resize(fNcryostat);
+    for (unsigned int cs = 0; cs != fNcryostat; ++cs) {
+      fNPlanes[cs].assign(planesInTPCs, planesInTPCs + fNTPC[cs]);
+      planesInTPCs += fNTPC[cs];
+    }
+    ResizePlaneTables();
+    fNonUniformWireCenters.clear();
+
+    for (unsigned int cs = 0; cs != fNcryostat; ++cs) {
+      for (unsigned int TPCCount = 0; TPCCount != fNTPC[cs]; ++TPCCount) {
+        for (unsigned int PlaneCount = 0; PlaneCount != fNPlanes[cs][TPCCount]; ++PlaneCount) {
+          StandardPlaneRecord const& record = *(planes++);
+          fWireCounts[cs][TPCCount][PlaneCount] = record.nWires;
+          fFirstWireProj[cs][TPCCount][PlaneCount] = record.firstWireProj;
+          fOrthVectorsY[cs][TPCCount][PlaneCount] = record.orthY;
+          fOrthVectorsZ[cs][TPCCount][PlaneCount] = record.orthZ;
+          if (record.nWireCenters == 0U) continue;
+          fNonUniformWireCenters.emplace(
+            geo::PlaneID{cs, TPCCount, PlaneCount},
+            geo::details::WireCenterTable::fromSorted(coords, wires, record.nWireCenters));
+          coords += record.nWireCenters;
+          wires += record.nWireCenters;
+        } // end loop over planes
+      }   // end loop over TPCs
+    }     // end loop over cryostats
 
-    // then go find which plane, tpc and cryostat it is in from the information we stored earlier
-    bool foundWid(false);
-    for (unsigned int csloop = 0; csloop != fNcryostat; ++csloop) {
-      for (unsigned int tpcloop = 0; tpcloop != fNTPC[csloop]; ++tpcloop) {
-        for (unsigned int planeloop = 0;
-             planeloop != fFirstChannelInNextPlane[csloop][tpcloop].size();
-             ++planeloop) {
-          if (channel < fFirstChannelInNextPlane[csloop][tpcloop][planeloop]) {
-            cstat = csloop;
-            tpc = tpcloop;
-            plane = planeloop;
-            wire = channel - fFirstChannelInThisPlane[cstat][tpcloop][planeloop];
-            foundWid = true;
-            break;
+    mf::LogInfo("ChannelMapStandardAlg") << "Channel map tables loaded from '" << path << "'.";
+    return true;
+  }
+
+  //----------------------------------------------------------------------------
+  bool ChannelMapStandardAlg::WritePlaneTables(std::string const& path,
+                                               std::uint64_t fingerprint) const
+  {
+    std::vector<double> coords;
+    std::vector<geo::details::WireCenterTable::WireNo_t> wires;
+    std::vector<std::uint32_t> TPCsInCryostats, planesInTPCs;
+    std::vector<StandardPlaneRecord> planes;
+    for (unsigned int cs = 0; cs != fNcryostat; ++cs) {
+      TPCsInCryostats.push_back(fNTPC[cs]);
+      for (unsigned int TPCCount = 0; TPCCount != fNTPC[cs]; ++TPCCount) {
+        planesInTPCs.push_back(fNPlanes[cs][TPCCount]);
+        for (unsigned int PlaneCount = 0; PlaneCount != fNPlanes[cs][TPCCount]; ++PlaneCount) {
+          StandardPlaneRecord record{};
+          record.nWires = static_cast<std::uint32_t>(fWireCounts[cs][TPCCount][PlaneCount]);
+          record.firstWireProj = fFirstWireProj[cs][TPCCount][PlaneCount];
+          record.orthY = fOrthVectorsY[cs][TPCCount][PlaneCount];
+          record.orthZ = fOrthVectorsZ[cs][TPCCount][PlaneCount];
+          auto const iTable = fNonUniformWireCenters.find({cs, TPCCount, PlaneCount});
+          if (iTable != fNonUniformWireCenters.end()) {
+            geo::details::WireCenterTable const& table = iTable->second;
+            record.nWireCenters = table.size();
+            coords.insert(coords.end(), table.sortedCoords(), table.sortedCoords() + table.size());
+            wires.insert(wires.end(), table.sortedWires(), table.sortedWires() + table.size());
           }
-          if (foundWid) break;
-        } // end plane loop
-        if (foundWid) break;
-      } // end tpc loop
-      if (foundWid) break;
-    } // end cryostat loop
+          planes.push_back(record);
+        } // end loop over planes
+      }   // end loop over TPCs
+    }     // end loop over cryostats
+
+    StandardTablesHeader header{}; // all zeroes, including padding
+    std::memcpy(header.magic, StandardTablesHeader::Magic, sizeof(StandardTablesHeader::Magic));
+    header.version = StandardTablesHeader::Version;
+    header.byteOrder = StandardTablesHeader::ByteOrder;
+    header.fingerprint = fingerprint;
+    header.nCryostats = TPCsInCryostats.size();
+    header.nTPCs = planesInTPCs.size();
+    header.nPlanes = planes.size();
+    header.nWireCenters = coords.size();
+    header.size = StandardTablesLayout{header}.end;
+
+    // written aside and then moved in place, so that no job maps a partial file
+    std::string const tempPath = path + ".tmp" + std::to_string(getpid());
+    std::ofstream out{tempPath, std::ios::binary | std::ios::trunc};
+    auto const write = [&out](auto const& data) {
+      out.write(reinterpret_cast<char const*>(data.data()), data.size() * sizeof(data[0]));
+    };
+    out.write(reinterpret_cast<char const*>(&header), sizeof(header));
+    write(coords);
+    write(wires);
+    write(TPCsInCryostats);
+    write(planesInTPCs);
+    write(planes);
+    out.close();
+    if (!out || (std::rename(tempPath.c_str(), path.c_str()) != 0)) {
+      std::remove(tempPath.c_str());
+      mf::LogWarning("ChannelMapStandardAlg")
+        << "Failed writing the channel map tables into '" << path << "'.";
+      return false;
+    }
+    mf::LogInfo("ChannelMapStandardAlg") << "Channel map tables written into '" << path << "'.";
+    return true;
+  }
+
+  //----------------------------------------------------------------------------
+  void ChannelMapStandardAlg::UpdateAlignment(GeometryData_t const& geodata)
+  {
+    // channels and wires are unchanged: only the wire positions matter
+    for (geo::CryostatGeo const& cryo : geodata.cryostats) {
+      for (unsigned int t = 0; t != cryo.NTPC(); ++t) {
+        geo::TPCGeo const& TPC = cryo.TPC(t);
+        for (unsigned int p = 0; p != TPC.Nplanes(); ++p)
+          UpdateWireProjection(TPC.Plane(p));
+      } // for TPCs
+    }   // for cryostats
+  }
+
+  //----------------------------------------------------------------------------
+  void ChannelMapStandardAlg::UpdateWireProjection(geo::PlaneGeo const& plane)
+  {
+    geo::PlaneID const& planeID = plane.ID();
+    double const ThisWirePitch = plane.WirePitch();
+
+    double WireCentre1[3] = {0., 0., 0.};
+    double WireCentre2[3] = {0., 0., 0.};
+
+    // copies, not to trigger the creation of all the wires on demand
+    const geo::WireGeo firstWire = plane.BuildWire(0);
+    const double sth = firstWire.SinThetaZ(), cth = firstWire.CosThetaZ();
+
+    firstWire.GetCenter(WireCentre1, 0);
+    plane.BuildWire(1).GetCenter(WireCentre2, 0);
+
+    // figure out if we need to flip the orthogonal vector
+    // (should point from wire n -> n+1)
+    double OrthY = cth, OrthZ = -sth;
+    if (((WireCentre2[1] - WireCentre1[1]) * OrthY + (WireCentre2[2] - WireCentre1[2]) * OrthZ) <
+        0) {
+      OrthZ *= -1;
+      OrthY *= -1;
+    }
+
+    // Overall we are trying to build an expression that looks like
+    //  int NearestWireNumber = round((worldPos.OrthVector - FirstWire.OrthVector)/WirePitch);
+    // That runs as fast as humanly possible.
+    // We predivide everything by the wire pitch so we don't do this in the loop.
+    //
+    // Putting this together into the useful constants we will use later per plane and tpc:
+    unsigned int const cs = planeID.Cryostat, TPCCount = planeID.TPC, PlaneCount = planeID.Plane;
+    fOrthVectorsY[cs][TPCCount][PlaneCount] = OrthY / ThisWirePitch;
+    fOrthVectorsZ[cs][TPCCount][PlaneCount] = OrthZ / ThisWirePitch;
+
+    fFirstWireProj[cs][TPCCount][PlaneCount] = WireCentre1[1] * OrthY + WireCentre1[2] * OrthZ;
+    fFirstWireProj[cs][TPCCount][PlaneCount] /= ThisWirePitch;
+
+    // planes with irregular wires need a search through all their wires
+    if (plane.HasUniformWires())
+      fNonUniformWireCenters.erase(planeID);
+    else
+      fNonUniformWireCenters[planeID] = plane.WireCenters();
+  }
+
+  //----------------------------------------------------------------------------
+  int ChannelMapStandardAlg::NearestWireNumber(double wireCoord, geo::PlaneID const& planeID) const
+  {
+    if (!fNonUniformWireCenters.empty()) {
+      auto const iTable = fNonUniformWireCenters.find(planeID);
+      if (iTable != fNonUniformWireCenters.end()) return iTable->second.nearestWire(wireCoord);
+    }
+    // add 0.5 to have the correct rounding
+    return int(0.5 + wireCoord);
+  }
 
-    geo::WireID CodeWire(cstat, tpc, plane, wire);
+  //----------------------------------------------------------------------------
+  void ChannelMapStandardAlg::Uninitialize()
+  {
+    fChannelToWireMap.clear();
+    fChannelSignalTypes.clear();
+    fFlatPlaneIndex.clear();
+    fFlatPlaneBaselines.clear();
+    fNonUniformWireCenters.clear();
+    ClearChannelToWireIDs();
+  }
 
-    AllSegments.push_back(CodeWire);
+  //----------------------------------------------------------------------------
+  std::size_t ChannelMapStandardAlg::MemoryUsage() const
+  {
+    return ChannelMapAlg::MemoryUsage() - sizeof(ChannelMapAlg) + sizeof(*this) +
+           lar::util::heapMemory(fNTPC) + lar::util::heapMemory(fViews) +
+           lar::util::heapMemory(fPlaneIDs) + lar::util::heapMemory(fFirstWireProj) +
+           lar::util::heapMemory(fOrthVectorsY) + lar::util::heapMemory(fOrthVectorsZ) +
+           lar::util::heapMemory(fWireCounts) + lar::util::heapMemory(fNPlanes) +
+           lar::util::heapMemory(fPlaneBaselines) + lar::util::heapMemory(fWiresPerPlane) +
+           lar::util::heapMemory(fChannelToWireMap) + lar::util::heapMemory(fChannelSignalTypes) +
+           lar::util::heapMemory(fFlatPlaneBaselines) +
+           lar::util::heapMemory(fNonUniformWireCenters);
+  }
 
-    return AllSegments;
+  //----------------------------------------------------------------------------
+  std::vector<geo::WireID> ChannelMapStandardAlg::ChannelToWire(raw::ChannelID_t channel) const
+  {
+    // find which plane, tpc and cryostat the channel is in from the information
+    // we stored earlier; this also checks if this channel ID is legal
+    geo::details::ChannelToWireMap::ChannelsInPlane_t const* channelInfo =
+      fChannelToWireMap.find(channel);
+    if (!channelInfo)
+      throw cet::exception("Geometry") << "ILLEGAL CHANNEL ID for channel " << channel << "\n";
+
+    return {channelInfo->wireOf(channel)};
   }
 
   //----------------------------------------------------------------------------
@@ -207,15 +573,36 @@ namespace geo {
   }
 
   //----------------------------------------------------------------------------
-  WireID ChannelMapStandardAlg::NearestWireID(const TVector3& worldPos,
+  void ChannelMapStandardAlg::WireCoordinates(util::span<double const*> YPos,
+                                              util::span<double const*> ZPos,
+                                              geo::PlaneID const& planeID,
+                                              util::span<double*> wireCoords) const
+  {
+    CheckWireCoordinatesArguments(YPos.size(), ZPos.size(), wireCoords.size());
+
+    // the plane constants are looked up once; the loop is then a plain
+    // multiply-add on contiguous arrays that the compiler can vectorize
+    double const orthY = AccessElement(fOrthVectorsY, planeID);
+    double const orthZ = AccessElement(fOrthVectorsZ, planeID);
+    double const firstWireProj = AccessElement(fFirstWireProj, planeID);
+
+    double const* const y = YPos.begin();
+    double const* const z = ZPos.begin();
+    double* const wireCoord = wireCoords.begin();
+    std::size_t const n = YPos.size();
+    for (std::size_t i = 0; i < n; ++i)
+      wireCoord[i] = y[i] * orthY + z[i] * orthZ - firstWireProj;
+  }
+
+  //----------------------------------------------------------------------------
+  WireID ChannelMapStandardAlg::NearestWireID(geo::Point_t const& worldPos,
                                               geo::PlaneID const& planeID) const
   {
 
     // This part is the actual calculation of the nearest wire number, where we assume
-    //  uniform wire pitch and angle within a wireplane
-
-    // add 0.5 to have the correct rounding
-    int NearestWireNumber = int(0.5 + WireCoordinate(worldPos.Y(), worldPos.Z(), planeID));
+    //  uniform wire pitch and angle within a wireplane, unless the plane is known otherwise
+    int NearestWireNumber =
+      this->NearestWireNumber(WireCoordinate(worldPos.Y(), worldPos.Z(), planeID), planeID);
 
     // If we are outside of the wireplane range, throw an exception
     // (this response maintains consistency with the previous
@@ -228,16 +615,28 @@ namespace geo {
       else
         NearestWireNumber = WireCount(planeID) - 1;
 
-      throw InvalidWireIDError("Geometry", wireNumber, NearestWireNumber)
-        << "Can't Find Nearest Wire for position (" << worldPos[0] << "," << worldPos[1] << ","
-        << worldPos[2] << ")"
-        << " in plane " << std::string(planeID) << " approx wire number # " << wireNumber
-        << " (capped from " << NearestWireNumber << ")\n";
+      throw InvalidWireIDError("Geometry", wireNumber, NearestWireNumber).at(worldPos, planeID);
     }
 
     return geo::WireID(planeID, (geo::WireID::WireID_t)NearestWireNumber);
   }
 
+  //----------------------------------------------------------------------------
+  WireID ChannelMapStandardAlg::NearestWireIDchecked(geo::Point_t const& worldPos,
+                                                     geo::PlaneID const& planeID) const
+  {
+    int const NearestWireNumber =
+      this->NearestWireNumber(WireCoordinate(worldPos.Y(), worldPos.Z(), planeID), planeID);
+    unsigned int const nWires = WireCount(planeID);
+
+    if (NearestWireNumber >= 0 && (unsigned int)NearestWireNumber < nWires)
+      return geo::WireID(planeID, (geo::WireID::WireID_t)NearestWireNumber);
+
+    geo::WireID wireID(planeID, (NearestWireNumber < 0) ? 0U : (nWires - 1));
+    wireID.markInvalid();
+    return wireID;
+  }
+
   //----------------------------------------------------------------------------
   // This method returns the channel number, assuming the numbering scheme
   // is heirachical - that is, channel numbers run in order, for example:
@@ -262,8 +661,7 @@ namespace geo {
     }
     else {
       // if the coordinates were bad, throw an exception
-      throw cet::exception("ChannelMapStandardAlg")
-        << "NO CHANNEL FOUND for " << std::string(wireID);
+      throw NoChannelError("ChannelMapStandardAlg", wireID);
     }
 
     // made it here, that shouldn't happen, return raw::InvalidChannelID
@@ -274,30 +672,48 @@ namespace geo {
   }
 
   //----------------------------------------------------------------------------
-  SigType_t ChannelMapStandardAlg::SignalTypeForChannelImpl(raw::ChannelID_t const channel) const
+  void ChannelMapStandardAlg::PlaneWireToChannels(util::span<geo::WireID const*> wireIDs,
+                                                  util::span<raw::ChannelID_t*> channels) const
   {
+    if (channels.size() < wireIDs.size()) {
+      throw cet::exception("ChannelMapAlg")
+        << "PlaneWireToChannels(): room for only " << channels.size() << " results, "
+        << wireIDs.size() << " wires requested\n";
+    }
 
-    // still assume one cryostat for now -- faster
-    unsigned int nChanPerTPC = fNchannels / fNTPC[0];
-    // casting wil trunc towards 0 -- faster than floor
-    unsigned int tpc = channel / nChanPerTPC;
-    //need number of planes to know Collection
-    unsigned int PlanesThisTPC = fNPlanes[0][tpc];
+    // the loop has no branches: planes out of range are redirected to the
+    // first entry, and their result is flagged (and later reported) as bad
+    geo::WireID const* const wireBegin = wireIDs.begin();
+    std::size_t nWires = wireIDs.size();
+    raw::ChannelID_t* const channelBegin = channels.begin();
+    raw::ChannelID_t const* const baselines = fFlatPlaneBaselines.data();
+    bool allGood = !fFlatPlaneBaselines.empty();
+    if (!allGood) nWires = 0; // not initialized: skip straight to the check
+    for (std::size_t i = 0; i < nWires; ++i) {
+      geo::WireID const& wireID = wireBegin[i];
+      bool const inRange = fFlatPlaneIndex.hasPlane(wireID);
+      raw::ChannelID_t const baseline = baselines[inRange ? fFlatPlaneIndex.index(wireID) : 0];
+      allGood &= inRange & (baseline != raw::InvalidChannelID);
+      channelBegin[i] = baseline + wireID.Wire;
+    } // for
+
+    if (allGood || wireIDs.empty()) return;
+
+    // find the culprit
+    for (geo::WireID const& wireID : wireIDs) {
+      if (!GetElementPtr(fPlaneBaselines, wireID))
+        throw NoChannelError("ChannelMapStandardAlg", wireID);
+    } // for
+  }
 
-    SigType_t sigt = geo::kMysteryType;
-    if ((channel >= fFirstChannelInThisPlane[0][tpc][0]) &&
-        (channel < fFirstChannelInNextPlane[0][tpc][PlanesThisTPC - 2])) {
-      sigt = geo::kInduction;
-    }
-    else if ((channel >= fFirstChannelInThisPlane[0][tpc][PlanesThisTPC - 1]) &&
-             (channel < fFirstChannelInNextPlane[0][tpc][PlanesThisTPC - 1])) {
-      sigt = geo::kCollection;
-    }
-    else
-      mf::LogWarning("BadChannelSignalType")
-        << "Channel " << channel << " not given signal type." << std::endl;
+  //----------------------------------------------------------------------------
+  SigType_t ChannelMapStandardAlg::SignalTypeForChannelImpl(raw::ChannelID_t const channel) const
+  {
+    if (channel < fChannelSignalTypes.size()) return fChannelSignalTypes[channel];
 
-    return sigt;
+    mf::LogWarning("BadChannelSignalType")
+      << "Channel " << channel << " not given signal type." << std::endl;
+    return geo::kMysteryType;
   }
 
   //----------------------------------------------------------------------------
@@ -404,15 +820,34 @@ namespace geo {
   {
     if (!raw::isValidChannelID(channel)) return {}; // invalid ROP returned
 
-    // which wires does the channel cover?
-    std::vector<geo::WireID> wires = ChannelToWire(channel);
+    // each plane is a ROP: the plane of the channel maps into its ROP ID
+    geo::details::ChannelToWireMap::ChannelsInPlane_t const* channelInfo =
+      fChannelToWireMap.find(channel);
+    return channelInfo ? ConvertWirePlaneToROP(channelInfo->planeID) : readout::ROPID{};
+  } // ChannelMapStandardAlg::ChannelToROP()
 
-    // - none:
-    if (wires.empty()) return {}; // invalid ROP returned
+  //----------------------------------------------------------------------------
+  void ChannelMapStandardAlg::ChannelsToROPs(util::span<raw::ChannelID_t const*> channels,
+                                             util::span<readout::ROPID*> ropids) const
+  {
+    if (ropids.size() < channels.size()) {
+      throw cet::exception("ChannelMapAlg")
+        << "ChannelsToROPs(): room for only " << ropids.size() << " results, " << channels.size()
+        << " channels requested\n";
+    }
 
-    // - one: maps its plane ID into a ROP ID
-    return WirePlaneToROP(wires[0]);
-  } // ChannelMapStandardAlg::ROPtoTPCs()
+    // the plane of the last channel is checked first, before a new search
+    geo::details::ChannelToWireMap::ChannelsInPlane_t const* channelInfo = nullptr;
+    readout::ROPID ropid;
+    readout::ROPID* iROP = ropids.begin();
+    for (raw::ChannelID_t const channel : channels) {
+      if (!channelInfo || !channelInfo->contains(channel)) {
+        channelInfo = raw::isValidChannelID(channel) ? fChannelToWireMap.find(channel) : nullptr;
+        ropid = channelInfo ? ConvertWirePlaneToROP(channelInfo->planeID) : readout::ROPID{};
+      }
+      *(iROP++) = ropid;
+    } // for
+  } // ChannelMapStandardAlg::ChannelsToROPs()
 
   //----------------------------------------------------------------------------
   raw::ChannelID_t ChannelMapStandardAlg::FirstChannelInROP(readout::ROPID const& ropid) const
@@ -7,11 +7,17 @@
 #ifndef LARCOREALG_GEOMETRY_CHANNELSTANDARDMAPALG_H
 #define LARCOREALG_GEOMETRY_CHANNELSTANDARDMAPALG_H
 
+#include <cstdint> // std::uint64_t
+#include <map>
 #include <set>
+#include <string>
 #include <vector>
 
 #include "larcorealg/Geometry/ChannelMapAlg.h"
 #include "larcorealg/Geometry/GeoObjectSorterStandard.h"
+#include "larcorealg/Geometry/GeometryIDmapper.h"
+#include "larcorealg/Geometry/details/ChannelToWireMap.h"
+#include "larcorealg/Geometry/details/WireCenterTable.h"
 #include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
 #include "larcoreobj/SimpleTypesAndConstants/readout_types.h" // readout::TPCsetID, ...
 
@@ -21,6 +27,24 @@ namespace fhicl {
 
 namespace geo {
 
+  /**
+   * @brief The standard, simplest mapping of wires into channels.
+   *
+   * Each wire is read by its own channel, numbered in order of cryostat, TPC,
+   * plane and wire.
+   *
+   * Configuration parameters
+   * ------------------------
+   *
+   * * `TablesCacheFile` (string, default: empty): path of a file where the
+   *   tables of the mapping are stored; if the file was written for the same
+   *   geometry, the tables are loaded from it (memory-mapped) instead of being
+   *   computed from the geometry, otherwise they are computed and the file is
+   *   written anew. The geometry is recognised by a hash of the plane
+   *   features the tables are computed from. The channel tables are always
+   *   derived from the number of wires of each plane. The file is bound to
+   *   the byte order of the machine that wrote it. If empty, no file is used.
+   */
   class ChannelMapStandardAlg : public ChannelMapAlg {
 
   public:
@@ -28,6 +52,12 @@ namespace geo {
 
     virtual void Initialize(GeometryData_t const& geodata) override;
     virtual void Uninitialize() override;
+
+    /// Updates only the wire coordinate constants of each plane
+    virtual void UpdateAlignment(GeometryData_t const& geodata) override;
+
+    /// Returns an estimate of the memory used by this object [bytes]
+    virtual std::size_t MemoryUsage() const override;
     virtual std::vector<WireID> ChannelToWire(raw::ChannelID_t channel) const override;
     virtual unsigned int Nchannels() const override;
 
@@ -49,9 +79,21 @@ namespace geo {
     }
     //@}
 
+    /// Batch version of `WireCoordinate()`, written to be vectorized.
+    virtual void WireCoordinates(util::span<double const*> YPos,
+                                 util::span<double const*> ZPos,
+                                 geo::PlaneID const& planeID,
+                                 util::span<double*> wireCoords) const override;
+
     //@{
-    virtual WireID NearestWireID(const TVector3& worldPos,
+    using ChannelMapAlg::NearestWireID;
+    virtual WireID NearestWireID(geo::Point_t const& worldPos,
                                  geo::PlaneID const& planeID) const override;
+    virtual WireID NearestWireID(const TVector3& worldPos,
+                                 geo::PlaneID const& planeID) const override
+    {
+      return NearestWireID(geo::Point_t{worldPos.X(), worldPos.Y(), worldPos.Z()}, planeID);
+    }
     virtual WireID NearestWireID(const TVector3& worldPos,
                                  unsigned int PlaneNo,
                                  unsigned int TPCNo,
@@ -59,6 +101,9 @@ namespace geo {
     {
       return NearestWireID(worldPos, geo::PlaneID(cstat, TPCNo, PlaneNo));
     }
+    using ChannelMapAlg::NearestWireIDchecked;
+    virtual WireID NearestWireIDchecked(geo::Point_t const& worldPos,
+                                        geo::PlaneID const& planeID) const override;
     //@}
 
     //@{
@@ -72,6 +117,10 @@ namespace geo {
     }
     //@}
 
+    /// Batch version of `PlaneWireToChannel()`, with a loop free of branches.
+    virtual void PlaneWireToChannels(util::span<geo::WireID const*> wireIDs,
+                                     util::span<raw::ChannelID_t*> channels) const override;
+
     virtual std::set<PlaneID> const& PlaneIDs() const override;
 
     //
@@ -201,6 +250,19 @@ namespace geo {
     /// Returns the ID of the ROP the channel belongs to (invalid if none)
     virtual readout::ROPID ChannelToROP(raw::ChannelID_t channel) const override;
 
+    /**
+     * @brief Fills the ID of the ROP of each of the `channels`
+     * @param channels IDs of the readout channels
+     * @param ropids (output) the ROP of each channel is written here
+     * @throws cet::exception (category: "ChannelMapAlg") if `ropids` has fewer
+     *         elements than `channels`
+     *
+     * Consecutive channels in the same plane (like the ones of a sorted
+     * collection of raw digits) share a single lookup.
+     */
+    virtual void ChannelsToROPs(util::span<raw::ChannelID_t const*> channels,
+                                util::span<readout::ROPID*> ropids) const override;
+
     /**
      * @brief Returns the ID of the first channel in the specified readout plane
      * @param ropid ID of the readout plane
@@ -244,8 +306,27 @@ namespace geo {
     PlaneInfoMap_t<unsigned int> fWiresPerPlane;  ///< The number of wires in this plane
                                                   ///< in the heirachy
 
+    /// Wire centers of the planes without uniform wires (usually none).
+    std::map<geo::PlaneID, geo::details::WireCenterTable> fNonUniformWireCenters;
+
+    /// Reverse lookup of the wire plane of each channel.
+    geo::details::ChannelToWireMap fChannelToWireMap;
+
+    /// Signal type of each channel, indexed by channel ID.
+    std::vector<geo::SigType_t> fChannelSignalTypes;
+
+    /// Index of each plane in `fFlatPlaneBaselines`, sized on the largest
+    /// cryostat, TPC and plane numbers.
+    geo::PlaneIDmapper<> fFlatPlaneIndex;
+
+    /// Copy of `fPlaneBaselines` in a single contiguous array; the entries of
+    /// planes not present in the detector are `raw::InvalidChannelID`.
+    std::vector<raw::ChannelID_t> fFlatPlaneBaselines;
+
     geo::GeoObjectSorterStandard fSorter; ///< class to sort geo objects
 
+    std::string fTablesCacheFile; ///< File with the tables (`TablesCacheFile`).
+
     virtual SigType_t SignalTypeForChannelImpl(raw::ChannelID_t const channel) const override;
 
     /// Retrieved the wire cound for the specified plane ID
@@ -254,6 +335,35 @@ namespace geo {
     /// Returns the largest number of TPCs in a single cryostat
     unsigned int MaxTPCs() const;
 
+    /// Fills the tables of wire counts and wire coordinate constants from the
+    /// geometry (the ones stored in `fTablesCacheFile`)
+    void FillPlaneTables(GeometryData_t const& geodata);
+
+    /// Sizes the tables of `FillPlaneTables()` after `fNTPC` and `fNPlanes`
+    void ResizePlaneTables();
+
+    /// Fills the channel tables from the number of wires of the planes
+    void FillChannelTables();
+
+    /// Returns the hash of the features of `geodata` `FillPlaneTables()` uses
+    static std::uint64_t PlaneTablesFingerprint(GeometryData_t const& geodata);
+
+    /// Loads the tables of `FillPlaneTables()` from the file at `path`
+    /// @return whether the file was loaded (it exists and matches `fingerprint`)
+    bool LoadPlaneTables(std::string const& path, std::uint64_t fingerprint);
+
+    /// Writes the tables of `FillPlaneTables()` into the file at `path`
+    /// @return whether the file was written
+    bool WritePlaneTables(std::string const& path, std::uint64_t fingerprint) const;
+
+    /// Fills the wire coordinate constants (`fOrthVectorsY`, `fOrthVectorsZ`,
+    /// `fFirstWireProj`) of `plane`, whose ID must be already in the tables
+    void UpdateWireProjection(geo::PlaneGeo const& plane);
+
+    /// Returns the number of the wire nearest to `wireCoord` on the plane
+    /// (as `geo::PlaneGeo::NearestWireNumber()`), possibly out of range.
+    int NearestWireNumber(double wireCoord, geo::PlaneID const& planeID) const;
+
     /// Converts a TPC ID into a TPC set ID using the same numerical indices
     static readout::TPCsetID ConvertTPCtoTPCset(geo::TPCID const& tpcid);
 
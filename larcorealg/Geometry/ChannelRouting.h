@@ -0,0 +1,192 @@
+/**
+ * @file   larcorealg/Geometry/ChannelRouting.h
+ * @brief  Channels of a collection grouped by their readout plane.
+ * @date   October 14, 2026
+ * @see    `geo::GeometryCore::RouteChannels()`
+ *
+ * This is a header only library.
+ */
+
+#ifndef LARCOREALG_GEOMETRY_CHANNELROUTING_H
+#define LARCOREALG_GEOMETRY_CHANNELROUTING_H
+
+// LArSoft libraries
+#include "larcorealg/CoreUtils/MemoryUsage.h" // lar::util::heapMemory()
+#include "larcorealg/CoreUtils/span.h"
+#include "larcoreobj/SimpleTypesAndConstants/RawTypes.h"      // raw::ChannelID_t
+#include "larcoreobj/SimpleTypesAndConstants/readout_types.h" // readout::ROPID
+
+// framework libraries
+#include "cetlib_except/exception.h"
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint32_t
+#include <limits>
+#include <vector>
+
+namespace geo {
+
+  /**
+   * @brief The positions of a list of channels, grouped by readout plane.
+   *
+   * Raw data decoders receive the channels of an event in the order of the
+   * readout, and need to distribute them to the readout planes (ROP) and their
+   * TPC sets. This object holds the result of that distribution for a whole
+   * list of channels at once (`route()`): for each ROP, the positions in the
+   * list of the channels of that ROP (`indices()`), in increasing order, and
+   * the positions of the channels with no ROP (`unrouted()`).
+   * The ROPs are numbered from `0` to `nROPs() - 1`, in the order of the
+   * table passed to `route()`, and `ROPID()` returns their identifiers.
+   * The TPC set of a ROP is part of its identifier (`readout::ROPID` derives
+   * from `readout::TPCsetID`).
+   *
+   * The grouping is a counting sort: a pass on the channels to find the ROP
+   * of each one in a table by channel, and count the channels of each ROP,
+   * and a pass to write the position of each channel in its group. The
+   * memory of the object is reused by the next `route()`, so that routing
+   * the channels of each event in the same object does not allocate memory
+   * after the first few events.
+   * ~~~~{.cpp}
+   * geo::ChannelRouting routing;
+   * geom.RouteChannels(channels, routing);
+   * for (std::size_t iROP = 0; iROP < routing.nROPs(); ++iROP) {
+   *   auto& output = outputs[routing.ROPID(iROP)];
+   *   for (geo::ChannelRouting::Index_t const i : routing.indices(iROP))
+   *     output.push_back(digits[i]);
+   * }
+   * ~~~~
+   */
+  class ChannelRouting {
+
+  public:
+    using Index_t = std::uint32_t; ///< Type of ROP number and of channel position.
+
+    using IndexSpan_t = util::span<Index_t const*>; ///< Type of list of positions.
+
+    /// ROP number of channels which are not in any ROP.
+    static constexpr Index_t NoROP = std::numeric_limits<Index_t>::max();
+
+    /// Constructor: no channel.
+    ChannelRouting() = default;
+
+    /**
+     * @brief Groups `channels` by their readout plane.
+     * @param channels the channels to be routed
+     * @param channelROPs ROP number of each channel, by channel ID
+     * @param ropIDs identifier of each ROP, by ROP number
+     * @throws cet::exception (category: `"ChannelRouting"`) if there are too
+     *         many channels to be numbered with `Index_t`
+     *
+     * The ROP of channel `c` is `channelROPs[c]`; channels beyond the end of
+     * `channelROPs`, the invalid channel and channels whose ROP is `NoROP` or
+     * not smaller than the size of `ropIDs` are not routed.
+     * The previous content of this object is replaced.
+     */
+    void route(util::span<raw::ChannelID_t const*> channels,
+               IndexSpan_t channelROPs,
+               util::span<readout::ROPID const*> ropIDs);
+
+    /// Returns the number of routed and unrouted channels.
+    std::size_t nChannels() const { return fIndices.size(); }
+
+    /// Returns whether there is no channel.
+    bool empty() const { return fIndices.empty(); }
+
+    /// Returns the number of ROPs the channels were routed to.
+    std::size_t nROPs() const { return fROPIDs.size(); }
+
+    /// Returns the identifier of the ROP number `iROP`.
+    readout::ROPID const& ROPID(std::size_t iROP) const { return fROPIDs[iROP]; }
+
+    /// Returns the positions of the channels of the ROP number `iROP`.
+    IndexSpan_t indices(std::size_t iROP) const { return group(iROP); }
+
+    /// Returns the number of channels in the ROP number `iROP`.
+    std::size_t nChannelsInROP(std::size_t iROP) const
+    {
+      return fOffsets[iROP + 1U] - fOffsets[iROP];
+    }
+
+    /// Returns the positions of the channels which are not in any ROP.
+    IndexSpan_t unrouted() const { return group(nROPs()); }
+
+    /// Returns the ROP number of the channel at position `i` (`NoROP` if none).
+    Index_t ROPindexOf(std::size_t i) const
+    {
+      return (fGroups[i] < nROPs()) ? fGroups[i] : NoROP;
+    }
+
+    /// Returns the memory allocated by the tables, besides their own size [bytes]
+    std::size_t heapMemory() const
+    {
+      return lar::util::heapMemory(fROPIDs) + lar::util::heapMemory(fOffsets) +
+             lar::util::heapMemory(fIndices) + lar::util::heapMemory(fGroups);
+    }
+
+  private:
+    std::vector<readout::ROPID> fROPIDs; ///< Identifier of each ROP, by number.
+
+    /// Start of each group in `fIndices`: one per ROP, then the unrouted, then the end.
+    std::vector<Index_t> fOffsets;
+
+    std::vector<Index_t> fIndices; ///< Positions of the channels, by group.
+
+    std::vector<Index_t> fGroups; ///< Group of the channel at each position.
+
+    /// Returns the positions in the group number `iGroup`.
+    IndexSpan_t group(std::size_t iGroup) const
+    {
+      Index_t const* const start = fIndices.data();
+      return {start + fOffsets[iGroup], start + fOffsets[iGroup + 1U]};
+    }
+
+  }; // class ChannelRouting
+
+} // namespace geo
+
+//------------------------------------------------------------------------------
+//--- inline implementation
+//------------------------------------------------------------------------------
+inline void geo::ChannelRouting::route(util::span<raw::ChannelID_t const*> channels,
+                                       IndexSpan_t channelROPs,
+                                       util::span<readout::ROPID const*> ropIDs)
+{
+  std::size_t const n = channels.size();
+  if (n >= NoROP) {
+    throw cet::exception("ChannelRouting")
+      << "route(): " << n << " channels requested, at most " << (NoROP - 1U) << " supported\n";
+  }
+  fROPIDs.assign(ropIDs.begin(), ropIDs.end());
+  Index_t const unroutedGroup = static_cast<Index_t>(fROPIDs.size());
+  std::size_t const nTableChannels = channelROPs.size();
+  Index_t const* const table = channelROPs.begin();
+
+  // first pass: the group of each channel, and the size of each group
+  // (counted in the entry after the group, to become its end below)
+  fOffsets.assign(unroutedGroup + 2U, 0U);
+  fGroups.resize(n);
+  raw::ChannelID_t const* channel = channels.begin();
+  for (std::size_t i = 0; i < n; ++i, ++channel) {
+    Index_t const iROP = (*channel < nTableChannels) ? table[*channel] : NoROP;
+    Index_t const iGroup = (iROP < unroutedGroup) ? iROP : unroutedGroup;
+    fGroups[i] = iGroup;
+    ++fOffsets[iGroup + 1U];
+  }
+  for (std::size_t iGroup = 1; iGroup < fOffsets.size(); ++iGroup)
+    fOffsets[iGroup] += fOffsets[iGroup - 1U];
+
+  // second pass: each position after the previous ones of its group;
+  // each offset ends at the start of the next group, and is moved back there
+  fIndices.resize(n);
+  for (std::size_t i = 0; i < n; ++i)
+    fIndices[fOffsets[fGroups[i]]++] = static_cast<Index_t>(i);
+  for (std::size_t iGroup = fOffsets.size() - 1U; iGroup > 0U; --iGroup)
+    fOffsets[iGroup] = fOffsets[iGroup - 1U];
+  fOffsets[0] = 0U;
+
+} // geo::ChannelRouting::route()
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREALG_GEOMETRY_CHANNELROUTING_H
@@ -0,0 +1,109 @@
+/**
+ * @file   larcorealg/Geometry/CompactGeometry.h
+ * @brief  Single precision view of the TPC and wire plane geometry.
+ * @date   October 14, 2026
+ * @see    `geo::GeometryCore::MakeCompactGeometry()`
+ *
+ * This is a header only library.
+ */
+
+#ifndef LARCOREALG_GEOMETRY_COMPACTGEOMETRY_H
+#define LARCOREALG_GEOMETRY_COMPACTGEOMETRY_H
+
+// LArSoft libraries
+#include "larcorealg/Geometry/details/HostDevice.h" // LARCOREALG_HOST_DEVICE
+
+// C/C++ standard libraries
+#include <cstdint> // std::uint32_t
+#include <type_traits>
+#include <vector>
+
+namespace geo {
+
+  /**
+   * @brief Records of the compact geometry.
+   *
+   * The records are plain data in single precision, organized in groups of
+   * four 32-bit words, so that each record can be read with aligned 128-bit
+   * loads and copied as it is to a device. All coordinates are in the world
+   * frame, in centimeters. Single precision gives a resolution better than
+   * 1 um within 10 m from the origin of the world frame.
+   *
+   * The planes provide their decompositions as linear functions of the
+   * position `p`:
+   * * wire coordinate: @f$ c(p) = p \cdot k + k_{0} @f$ (`wireCoordDir` and
+   *   `wireCoordOffset`), in wire pitch units, with the first wire at `0`;
+   * * (signed) distance from the plane: @f$ d(p) = p \cdot n + n_{0} @f$
+   *   (`normal` and `normalOffset`), positive in the TPC.
+   */
+  namespace compact {
+
+    /// A TPC.
+    struct TPC_t {
+      float min[3];                ///< Lower corner of the TPC box.
+      std::uint32_t firstPlane;    ///< Index of the first plane of the TPC.
+      float max[3];                ///< Upper corner of the TPC box.
+      std::uint32_t nPlanes;       ///< Number of planes in the TPC.
+      float activeMin[3];          ///< Lower corner of the active volume.
+      std::uint32_t cryostat;      ///< Number of the cryostat of the TPC.
+      float activeMax[3];          ///< Upper corner of the active volume.
+      std::int32_t driftDirection; ///< As `geo::TPCGeo::DriftDirection()`.
+      float driftDir[3];           ///< Direction of the drift (unit vector).
+      std::uint32_t tpc;           ///< Number of the TPC in its cryostat.
+    }; // TPC_t
+
+    /// A wire plane.
+    struct Plane_t {
+      float wireCoordDir[3]; ///< Direction of increasing wire number, over pitch.
+      float wireCoordOffset; ///< Wire coordinate of the world origin.
+      float normal[3];       ///< Normal to the plane, pointing into the TPC.
+      float normalOffset;    ///< Distance of the world origin from the plane.
+      float wireDir[3];      ///< Direction of the wires (unit vector).
+      float wirePitch;       ///< Distance between wires.
+      float thetaZ;          ///< Angle of the wires, as `geo::PlaneGeo::ThetaZ()`.
+      std::uint32_t nWires;  ///< Number of wires in the plane.
+      std::int32_t view;     ///< View (`geo::View_t`).
+      std::uint32_t tpc;     ///< Index of the TPC of the plane.
+
+      /// Returns the wire coordinate of the point (`x`, `y`, `z`).
+      LARCOREALG_HOST_DEVICE float wireCoordinate(float x, float y, float z) const
+      {
+        return x * wireCoordDir[0] + y * wireCoordDir[1] + z * wireCoordDir[2] + wireCoordOffset;
+      }
+
+      /// Returns the distance of the point (`x`, `y`, `z`) from the plane.
+      LARCOREALG_HOST_DEVICE float distance(float x, float y, float z) const
+      {
+        return x * normal[0] + y * normal[1] + z * normal[2] + normalOffset;
+      }
+    }; // Plane_t
+
+    namespace details {
+      template <typename T>
+      constexpr bool isRecord = std::is_trivially_copyable_v<T> && (sizeof(T) % 16 == 0);
+    }
+    static_assert(details::isRecord<TPC_t>);
+    static_assert(details::isRecord<Plane_t>);
+
+  } // namespace compact
+
+  /**
+   * @brief Single precision description of the TPCs and their wire planes.
+   *
+   * This is a copy of the part of the geometry needed to place charge on the
+   * wires, in a format suitable for vectorized and GPU code: the TPCs and
+   * planes are in flat arrays of plain records (see `geo::compact`) in the
+   * order of `geo::GeometryCore`, and each record holds the few single
+   * precision parameters needed for the common queries, with no conversion.
+   *
+   * It is created by `geo::GeometryCore::MakeCompactGeometry()` and it does
+   * not depend on the geometry object afterwards.
+   */
+  struct CompactGeometry {
+    std::vector<compact::TPC_t> TPCs;     ///< All TPCs, by cryostat.
+    std::vector<compact::Plane_t> planes; ///< All planes, by TPC.
+  }; // CompactGeometry
+
+} // namespace geo
+
+#endif // LARCOREALG_GEOMETRY_COMPACTGEOMETRY_H
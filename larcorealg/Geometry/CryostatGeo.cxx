@@ -21,9 +21,10 @@
 #include "TGeoShape.h" // for TGeoShape
 
 // C++ standard libraries
-#include <limits>  // std::numeric_limits<>
-#include <sstream> // std::ostringstream
-#include <utility> // std::move()
+#include <algorithm> // std::max(), std::partial_sort(), std::find()
+#include <limits>    // std::numeric_limits<>
+#include <sstream>   // std::ostringstream
+#include <utility>   // std::move(), std::pair
 #include <vector>
 
 namespace geo {
@@ -46,25 +47,30 @@ namespace geo {
     // set the bounding box
     InitCryoBoundaries();
 
+    // the number of elements does not change with sorting
+    UpdateMaxElements();
+
     // Set OpDetName;
     fOpDetGeoName = "volOpDetSensitive";
   }
 
   //......................................................................
   // sort the TPCGeo objects, and the PlaneGeo objects inside
-  void CryostatGeo::SortSubVolumes(geo::GeoObjectSorter const& sorter)
+  void CryostatGeo::SortSubVolumes(geo::GeoObjectSorter const& sorter,
+                                   geo::TaskRunner_t const& runner /* = {} */)
   {
     sorter.SortTPCs(fTPCs);
 
-    for (geo::TPCGeo& TPC : fTPCs) {
-      TPC.SortSubVolumes(sorter);
-    }
+    // each TPC sorts only its own content
+    geo::runTasks(
+      runner, fTPCs.size(), [this, &sorter](std::size_t tpc) { fTPCs[tpc].SortSubVolumes(sorter); });
 
     sorter.SortOpDets(fOpDets);
   } // CryostatGeo::SortSubVolumes()
 
   //......................................................................
-  void CryostatGeo::UpdateAfterSorting(geo::CryostatID cryoid)
+  void CryostatGeo::UpdateAfterSorting(geo::CryostatID cryoid,
+                                       geo::TaskRunner_t const& runner /* = {} */)
   {
 
     // update the cryostat ID
@@ -75,11 +81,88 @@ namespace geo {
       fOpDets[opdet].UpdateAfterSorting(geo::OpDetID(fID, opdet));
 
     // trigger all the TPCs to update as well
-    for (unsigned int tpc = 0; tpc < NTPC(); ++tpc)
+    geo::runTasks(runner, NTPC(), [this](std::size_t tpc) {
       fTPCs[tpc].UpdateAfterSorting(geo::TPCID(fID, tpc));
+    });
+
+    // the TPCs are now in their final order: index them by position
+    fTPCindex.build(fTPCs);
+    BuildTPCAdjacency();
+    UpdateMaxElements();
+
+    // same for the optical detectors, by their center
+    std::vector<geo::Point_t> opDetCenters;
+    opDetCenters.reserve(NOpDet());
+    for (geo::OpDetGeo const& opDet : fOpDets)
+      opDetCenters.push_back(opDet.GetCenter());
+    fOpDetIndex.build(opDetCenters);
+
+    // and packed for the batch queries
+    fOpDetArrays.clear();
+    fOpDetArrays.reserve(NOpDet());
+    for (geo::OpDetGeo const& opDet : fOpDets) {
+      OpDetArrays_t::Sizes_t sizes{opDet.HalfW(), opDet.HalfH(), opDet.HalfL()};
+      if (opDet.isTube() || opDet.isSphere()) sizes.rMax = opDet.RMax();
+      fOpDetArrays.push_back(opDet.GetCenter(),
+                             opDet.toWorldCoords(geo::OpDetGeo::LocalVector_t{0.0, 0.0, 1.0}),
+                             sizes);
+    }
 
   } // CryostatGeo::UpdateAfterSorting()
 
+  //......................................................................
+  void CryostatGeo::ReleaseWiresOutside(geo::GeometrySubset const& subset)
+  {
+    for (geo::TPCGeo& tpc : fTPCs)
+      if (!subset.contains(tpc.ID())) tpc.ReleaseWires();
+  } // CryostatGeo::ReleaseWiresOutside()
+
+  //......................................................................
+  void CryostatGeo::ApplyAlignment(geo::GeometryAlignment const& alignment,
+                                   geo::TaskRunner_t const& runner /* = {} */)
+  {
+    std::vector<bool> moved(NTPC(), false);
+
+    // TPCs first, then the planes within them
+    for (auto const& [tpcid, delta] : alignment.TPCs) {
+      if (tpcid.asCryostatID() != fID) continue;
+      fTPCs[tpcid.TPC].ApplyAlignment(delta);
+      moved[tpcid.TPC] = true;
+    }
+    for (auto const& [planeid, delta] : alignment.planes) {
+      if (planeid.asCryostatID() != fID) continue;
+      fTPCs[planeid.TPC].ApplyPlaneAlignment(planeid.Plane, delta);
+      moved[planeid.TPC] = true;
+    }
+    if (std::find(moved.begin(), moved.end(), true) == moved.end()) return;
+
+    geo::runTasks(runner, NTPC(), [this, &moved](std::size_t tpc) {
+      if (moved[tpc]) fTPCs[tpc].UpdateAfterAlignment();
+    });
+
+    // the TPC boxes have moved
+    fTPCindex.build(fTPCs);
+    BuildTPCAdjacency();
+
+  } // CryostatGeo::ApplyAlignment()
+
+  //......................................................................
+  void CryostatGeo::FillMemoryUsage(lar::util::MemoryUsageReport& report) const
+  {
+    report.add("CryostatGeo",
+               sizeof(*this) + (fTPCs.capacity() - fTPCs.size()) * sizeof(geo::TPCGeo) +
+                 (fOpDets.capacity() - fOpDets.size()) * sizeof(geo::OpDetGeo) +
+                 lar::util::heapMemory(fOpDetGeoName) + lar::util::heapMemory(fTPCindex) +
+                 lar::util::heapMemory(fAdjacentTPCs) + lar::util::heapMemory(fOpDetIndex) +
+                 lar::util::heapMemory(fOpDetArrays));
+    for (geo::TPCGeo const& tpc : fTPCs)
+      tpc.FillMemoryUsage(report);
+    report.add("OpDetGeo",
+               fOpDets.size() * sizeof(geo::OpDetGeo) +
+                 lar::util::elementHeapMemory(fOpDets.begin(), fOpDets.end()),
+               fOpDets.size());
+  } // CryostatGeo::FillMemoryUsage()
+
   //......................................................................
   const TPCGeo& CryostatGeo::TPC(unsigned int itpc) const
   {
@@ -138,32 +221,52 @@ namespace geo {
   //......................................................................
   geo::TPCGeo const* CryostatGeo::PositionToTPCptr(geo::Point_t const& point, double wiggle) const
   {
+    if (fTPCindex.covers(wiggle)) {
+      for (unsigned int const iTPC : fTPCindex.candidates(point))
+        if (fTPCs[iTPC].ContainsPosition(point, wiggle)) return &fTPCs[iTPC];
+      return nullptr;
+    }
     for (auto const& tpc : IterateTPCs())
       if (tpc.ContainsPosition(point, wiggle)) return &tpc;
     return nullptr;
   } // CryostatGeo::PositionToTPCptr()
 
   //......................................................................
-  unsigned int CryostatGeo::MaxPlanes() const
+  geo::TPCGeo const* CryostatGeo::PositionToTPCptr(geo::Point_t const& point,
+                                                   double wiggle,
+                                                   geo::TPCID::TPCID_t hintTPC) const
   {
-    unsigned int maxPlanes = 0;
-    for (geo::TPCGeo const& TPC : fTPCs) {
-      unsigned int maxPlanesInTPC = TPC.Nplanes();
-      if (maxPlanesInTPC > maxPlanes) maxPlanes = maxPlanesInTPC;
-    } // for
-    return maxPlanes;
-  } // CryostatGeo::MaxPlanes()
+    if (hintTPC < fAdjacentTPCs.size()) {
+      if (fTPCs[hintTPC].ContainsPosition(point, wiggle)) return &fTPCs[hintTPC];
+      for (geo::TPCID::TPCID_t const iTPC : fAdjacentTPCs[hintTPC])
+        if (fTPCs[iTPC].ContainsPosition(point, wiggle)) return &fTPCs[iTPC];
+    }
+    return PositionToTPCptr(point, wiggle);
+  } // CryostatGeo::PositionToTPCptr(hint)
+
+  //......................................................................
+  std::vector<geo::TPCID::TPCID_t> const& CryostatGeo::AdjacentTPCs(
+    geo::TPCID::TPCID_t itpc) const
+  {
+    if (itpc >= fAdjacentTPCs.size()) {
+      throw cet::exception("TPCOutOfRange")
+        << "Request for adjacent TPCs of non-existant TPC " << itpc << "\n";
+    }
+    return fAdjacentTPCs[itpc];
+  } // CryostatGeo::AdjacentTPCs()
 
   //......................................................................
-  unsigned int CryostatGeo::MaxWires() const
+  void CryostatGeo::UpdateMaxElements()
   {
-    unsigned int maxWires = 0;
+    fMaxPlanes = 0;
+    fMaxWires = 0;
     for (geo::TPCGeo const& TPC : fTPCs) {
+      unsigned int maxPlanesInTPC = TPC.Nplanes();
+      if (maxPlanesInTPC > fMaxPlanes) fMaxPlanes = maxPlanesInTPC;
       unsigned int maxWiresInTPC = TPC.MaxWires();
-      if (maxWiresInTPC > maxWires) maxWires = maxWiresInTPC;
+      if (maxWiresInTPC > fMaxWires) fMaxWires = maxWiresInTPC;
     } // for
-    return maxWires;
-  } // CryostatGeo::MaxWires()
+  } // CryostatGeo::UpdateMaxElements()
 
   //......................................................................
   double CryostatGeo::HalfWidth() const
@@ -209,12 +312,15 @@ namespace geo {
   geo::OpDetGeo const* CryostatGeo::GetClosestOpDetPtr(geo::Point_t const& point) const
   {
     unsigned int iOpDet = GetClosestOpDet(point);
-    return (iOpDet == std::numeric_limits<double>::max()) ? nullptr : &OpDet(iOpDet);
+    return (iOpDet == std::numeric_limits<unsigned int>::max()) ? nullptr : &OpDet(iOpDet);
   }
 
   //......................................................................
   unsigned int CryostatGeo::GetClosestOpDet(geo::Point_t const& point) const
   {
+    // the index is not available until the cryostat is sorted
+    if (fOpDetIndex.size() == NOpDet()) return fOpDetIndex.nearest(point);
+
     unsigned int ClosestDet = std::numeric_limits<unsigned int>::max();
     double ClosestDist = std::numeric_limits<double>::max();
 
@@ -234,6 +340,48 @@ namespace geo {
     return GetClosestOpDet(geo::vect::makePointFromCoords(point));
   }
 
+  //......................................................................
+  std::vector<unsigned int> CryostatGeo::GetClosestOpDets(geo::Point_t const& point,
+                                                          unsigned int k) const
+  {
+    if (fOpDetIndex.size() == NOpDet()) return fOpDetIndex.kNearest(point, k);
+
+    std::vector<std::pair<double, unsigned int>> distances;
+    for (unsigned int o = 0U; o < NOpDet(); ++o)
+      distances.emplace_back(OpDet(o).DistanceToPoint(point), o);
+    std::size_t const n = std::min<std::size_t>(k, distances.size());
+    std::partial_sort(distances.begin(), distances.begin() + n, distances.end());
+    std::vector<unsigned int> closest;
+    for (std::size_t i = 0; i < n; ++i)
+      closest.push_back(distances[i].second);
+    return closest;
+  } // CryostatGeo::GetClosestOpDets()
+
+  //......................................................................
+  void CryostatGeo::BuildTPCAdjacency()
+  {
+    // gap between the ranges [ minA, maxA ] and [ minB, maxB ] (0 if overlapping)
+    auto gap = [](double minA, double maxA, double minB, double maxB) {
+      return std::max({0.0, minA - maxB, minB - maxA});
+    };
+
+    fAdjacentTPCs.assign(NTPC(), {});
+    for (geo::TPCID::TPCID_t iA = 0; iA < NTPC(); ++iA) {
+      geo::TPCGeo const& A = fTPCs[iA];
+      for (geo::TPCID::TPCID_t iB = iA + 1; iB < NTPC(); ++iB) {
+        geo::TPCGeo const& B = fTPCs[iB];
+        double const dx = gap(A.MinX(), A.MaxX(), B.MinX(), B.MaxX());
+        double const dy = gap(A.MinY(), A.MaxY(), B.MinY(), B.MaxY());
+        double const dz = gap(A.MinZ(), A.MaxZ(), B.MinZ(), B.MaxZ());
+        if (dx * dx + dy * dy + dz * dz > TPCAdjacencyMargin * TPCAdjacencyMargin) continue;
+        fAdjacentTPCs[iA].push_back(iB);
+        fAdjacentTPCs[iB].push_back(iA);
+      } // for B
+    }   // for A
+    // lists are sorted by construction
+
+  } // CryostatGeo::BuildTPCAdjacency()
+
   //......................................................................
   void CryostatGeo::InitCryoBoundaries()
   {
@@ -9,13 +9,20 @@
 #define LARCOREALG_GEOMETRY_CRYOSTATGEO_H
 
 // LArSoft libraries
+#include "larcorealg/CoreUtils/MemoryUsage.h"
 #include "larcorealg/Geometry/BoxBoundedGeo.h"
 #include "larcorealg/Geometry/GeoVectorLocalTransformation.h" // for LocalT...
+#include "larcorealg/Geometry/GeometryAlignment.h"
+#include "larcorealg/Geometry/GeometrySubset.h"
 #include "larcorealg/Geometry/LocalTransformationGeo.h"       // for LocalT...
 #include "larcorealg/Geometry/OpDetGeo.h"
 #include "larcorealg/Geometry/TPCGeo.h"
+#include "larcorealg/Geometry/TaskRunner.h"
 #include "larcorealg/Geometry/TransformationMatrix.h"
 #include "larcorealg/Geometry/WireGeo.h"           // for WireGeo
+#include "larcorealg/Geometry/details/BoxGridIndex.h"
+#include "larcorealg/Geometry/details/OpDetArrays.h"
+#include "larcorealg/Geometry/details/PointKDTree.h"
 #include "larcorealg/Geometry/geo_vectors_utils.h" // geo::vect
 #include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
 #include "larcoreobj/SimpleTypesAndConstants/geo_vectors.h" // geo::Point_t
@@ -28,6 +35,7 @@
 
 // C/C++ standard libraries
 #include <string>
+#include <string_view>
 #include <vector>
 
 // forward declarations
@@ -48,6 +56,7 @@ namespace geo {
 
     /// Type used internally to store the optical detectors.
     using OpDetList_t = std::vector<geo::OpDetGeo>;
+    using OpDetArrays_t = details::OpDetArrays; ///< Optical detector arrays.
 
     using GeoNodePath_t = geo::WireGeo::GeoNodePath_t;
 
@@ -328,11 +337,44 @@ namespace geo {
      */
     geo::TPCGeo const* PositionToTPCptr(geo::Point_t const& point, double wiggle) const;
 
+    /**
+     * @brief Returns a pointer to the TPC at specified location.
+     * @param point position in space [cm]
+     * @param wiggle a small factor (like 1+&epsilon;) to avoid rounding errors
+     * @param hintTPC number of the TPC where `point` is expected to be
+     * @return a pointer to the `geo::TPCGeo` at `point` (`nullptr` if none)
+     * @see `AdjacentTPCs()`
+     *
+     * The TPC `hintTPC` and the ones adjacent to it are checked first; only
+     * if none of them includes `point` all the TPCs are searched. The hint
+     * may be an invalid TPC number, in which case it is ignored.
+     * For a point in the overlap of the tolerance margins of two TPCs either
+     * of them may be returned.
+     */
+    geo::TPCGeo const* PositionToTPCptr(geo::Point_t const& point,
+                                        double wiggle,
+                                        geo::TPCID::TPCID_t hintTPC) const;
+
+    /**
+     * @brief Returns the TPCs adjacent to the specified one.
+     * @param itpc number of the TPC within this cryostat
+     * @return the sorted numbers of the TPCs adjacent to `itpc`
+     * @throws cet::exception (category "TPCOutOfRange") if no such TPC
+     *
+     * Two TPCs are adjacent if their boxes are not farther than
+     * `TPCAdjacencyMargin` from each other: this includes TPCs sharing only an
+     * edge or a corner. A TPC is not adjacent to itself.
+     */
+    std::vector<geo::TPCID::TPCID_t> const& AdjacentTPCs(geo::TPCID::TPCID_t itpc) const;
+
+    /// Largest distance between the boxes of two adjacent TPCs [cm].
+    static constexpr double TPCAdjacencyMargin = 1.0;
+
     /// Returns the largest number of planes among the TPCs in this cryostat
-    unsigned int MaxPlanes() const;
+    unsigned int MaxPlanes() const { return fMaxPlanes; }
 
     /// Returns the largest number of wires among the TPCs in this cryostat
-    unsigned int MaxWires() const;
+    unsigned int MaxWires() const { return fMaxWires; }
 
     /// @}
     // END TPC access ----------------------------------------------------------
@@ -353,13 +395,42 @@ namespace geo {
     /// @see `GetClosestOpDet(geo::Point_t const&) const`
     unsigned int GetClosestOpDet(double const* point) const;
 
+    /**
+     * @brief Returns the indices of the `k` optical detectors closest to `point`.
+     * @param point the reference point [cm]
+     * @param k the number of optical detectors to return
+     * @return the indices of the detectors in this cryostat, closest first
+     *
+     * Distances are measured from the center of each detector, as in
+     * `GetClosestOpDet()`. If the cryostat has fewer than `k` detectors, all
+     * of them are returned.
+     */
+    std::vector<unsigned int> GetClosestOpDets(geo::Point_t const& point, unsigned int k) const;
+
     /// Returns the optical detector det in this cryostat nearest to `point`.
     /// If there are no optical detectors, `nullptr` is returned.
     geo::OpDetGeo const* GetClosestOpDetPtr(geo::Point_t const& point) const;
 
+    /**
+     * @brief Returns centers, normals and sizes of all the optical detectors.
+     *
+     * The information is in contiguous arrays (see `geo::details::OpDetArrays`)
+     * in the same order as `OpDet()`, with batch versions of
+     * `geo::OpDetGeo::DistanceToPoint()` and `CosThetaFromNormal()`:
+     * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+     * auto const& opDets = cryo.OpDetArrays();
+     * std::vector<double> distances(opDets.size());
+     * opDets.distancesToPoint(x, y, z, distances.data());
+     * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+     */
+    OpDetArrays_t const& OpDetArrays() const { return fOpDetArrays; }
+
     /// Get name of opdet geometry element
     std::string OpDetGeoName() const { return fOpDetGeoName; }
 
+    /// Get name of opdet geometry element, with no copy
+    std::string_view OpDetGeoNameView() const { return fOpDetGeoName; }
+
     /// @}
     // END Optical detector access ---------------------------------------------
 
@@ -438,11 +509,41 @@ namespace geo {
     /// @}
     // END Coordinate transformation -------------------------------------------
 
-    /// Method to sort TPCGeo objects
-    void SortSubVolumes(geo::GeoObjectSorter const& sorter);
+    /// Method to sort TPCGeo objects (the TPC content with `runner`, if any)
+    void SortSubVolumes(geo::GeoObjectSorter const& sorter,
+                        geo::TaskRunner_t const& runner = {});
 
     /// Performs all needed updates after geometry has sorted the cryostats
-    void UpdateAfterSorting(geo::CryostatID cryoid);
+    /// (the updates of the TPCs are run with `runner`, if any)
+    void UpdateAfterSorting(geo::CryostatID cryoid, geo::TaskRunner_t const& runner = {});
+
+    /**
+     * @brief Moves the TPCs and planes of this cryostat as in `alignment`.
+     * @param alignment the displacements (those of other cryostats are ignored)
+     * @param runner used to update the moved TPCs, if any
+     * @see `geo::GeometryCore::ApplyAlignment()`
+     *
+     * The moved TPCs and their planes are updated, and so is the lookup of
+     * TPCs by position. The volumes in `alignment` must exist.
+     */
+    void ApplyAlignment(geo::GeometryAlignment const& alignment,
+                        geo::TaskRunner_t const& runner = {});
+
+    /**
+     * @brief Frees the wire objects of the TPCs not in `subset`.
+     * @param subset the TPCs to be kept complete
+     * @see `geo::GeometryCore::SetBuildSubset()`, `geo::TPCGeo::ReleaseWires()`
+     */
+    void ReleaseWiresOutside(geo::GeometrySubset const& subset);
+
+    /**
+     * @brief Adds the memory used by this cryostat to `report`.
+     * @param report the report to be updated
+     *
+     * The cryostat is added as `"CryostatGeo"`, its optical detectors as
+     * `"OpDetGeo"` and its TPCs as well (see `geo::TPCGeo::FillMemoryUsage()`).
+     */
+    void FillMemoryUsage(lar::util::MemoryUsageReport& report) const;
 
   private:
     void FindTPC(std::vector<const TGeoNode*>& path, unsigned int depth);
@@ -454,6 +555,12 @@ namespace geo {
     /// Fill the boundary information of the cryostat
     void InitCryoBoundaries();
 
+    /// Fills the list of adjacent TPCs.
+    void BuildTPCAdjacency();
+
+    /// Computes the largest number of planes and wires in the TPCs.
+    void UpdateMaxElements();
+
   private:
     using LocalTransformation_t =
       geo::LocalTransformationGeo<ROOT::Math::Transform3D, LocalPoint_t, LocalVector_t>;
@@ -464,6 +571,20 @@ namespace geo {
     TGeoVolume* fVolume;          ///< Total volume of cryostat, called volCryostat in GDML file
     std::string fOpDetGeoName;    ///< Name of opdet geometry elements in gdml
     geo::CryostatID fID;          ///< ID of this cryostat
+
+    /// Spatial index of the TPCs, used by `PositionToTPCptr()`.
+    geo::details::BoxGridIndex fTPCindex;
+
+    /// For each TPC, the TPCs adjacent to it.
+    std::vector<std::vector<geo::TPCID::TPCID_t>> fAdjacentTPCs;
+
+    /// Spatial index of the optical detector centers, used by `GetClosestOpDet()`.
+    geo::details::PointKDTree fOpDetIndex;
+
+    OpDetArrays_t fOpDetArrays; ///< Optical detector information in arrays.
+
+    unsigned int fMaxPlanes = 0U; ///< Largest number of planes in a TPC.
+    unsigned int fMaxWires = 0U;  ///< Largest number of wires in a plane.
   };
 }
 
@@ -11,10 +11,13 @@
 #define LARCOREALG_GEOMETRY_DECOMPOSER_H
 
 // LArSoft libraries
+#include "larcorealg/CoreUtils/span.h"
+#include "larcorealg/Geometry/details/DecompositionKernel.h"
 #include "larcorealg/Geometry/geo_vectors_utils.h" // geo::vect
 
 // C/C++ standard libraries
 #include <cmath>       // std::abs()
+#include <cstddef>     // std::size_t
 #include <type_traits> // std::declval()
 #include <utility>     // std::move()
 
@@ -370,6 +373,80 @@ namespace geo {
 
     /// @}
 
+    /// @{
+    /**
+     * @name Batch projection and composition
+     *
+     * These methods process many points or vectors at once, given as a span of
+     * objects or as arrays of coordinates, with the same results as the single
+     * point methods. The projections are written as two arrays, one for the
+     * main and one for the secondary component. The input and output arrays
+     * must not overlap.
+     */
+
+    /**
+     * @brief Returns the kernel performing the batch operations.
+     * @param points whether the kernel acts on points (or on vectors)
+     */
+    details::DecompositionKernel BatchKernel(bool points = true) const
+    {
+      details::DecompositionKernel kernel;
+      if (points) geo::vect::fillCoords(kernel.origin, ReferencePoint());
+      geo::vect::fillCoords(kernel.main, MainDir());
+      geo::vect::fillCoords(kernel.secondary, SecondaryDir());
+      geo::vect::fillCoords(kernel.normal, Base().NormalDir());
+      return kernel;
+    }
+
+    /// Fills `main` and `secondary` with the projections of the `points`.
+    template <typename BIter, typename EIter>
+    void PointProjections(util::span<BIter, EIter> points, double* main, double* secondary) const
+    {
+      BatchKernel(true).decompose(points.begin(), points.end(), main, secondary, nullptr);
+    }
+
+    /// Fills `main` and `secondary` with the projections of `n` points.
+    void PointProjections(std::size_t n,
+                          double const* x,
+                          double const* y,
+                          double const* z,
+                          double* main,
+                          double* secondary) const
+    {
+      BatchKernel(true).decompose(n, x, y, z, main, secondary, nullptr);
+    }
+
+    /// Fills `main` and `secondary` with the projections of the vectors `v`.
+    template <typename BIter, typename EIter>
+    void VectorProjections(util::span<BIter, EIter> v, double* main, double* secondary) const
+    {
+      BatchKernel(false).decompose(v.begin(), v.end(), main, secondary, nullptr);
+    }
+
+    /// Fills `x`, `y` and `z` with the `n` points with the specified projections.
+    void ComposePoints(std::size_t n,
+                       double const* main,
+                       double const* secondary,
+                       double* x,
+                       double* y,
+                       double* z) const
+    {
+      BatchKernel(true).compose(n, main, secondary, nullptr, x, y, z);
+    }
+
+    /// Fills `x`, `y` and `z` with the `n` vectors with the specified projections.
+    void ComposeVectors(std::size_t n,
+                        double const* main,
+                        double const* secondary,
+                        double* x,
+                        double* y,
+                        double* z) const
+    {
+      BatchKernel(false).compose(n, main, secondary, nullptr, x, y, z);
+    }
+
+    /// @}
+
   private:
     AffinePlaneBase_t fPlaneBase; ///< Reference base.
 
@@ -678,6 +755,92 @@ namespace geo {
 
     /// @}
 
+    /// @{
+    /**
+     * @name Batch decomposition and composition
+     *
+     * These methods process many points or vectors at once, given as a span of
+     * objects or as arrays of coordinates, with the same results as the single
+     * point methods. The components are written as arrays, one for each of
+     * the main, secondary and normal direction; the array of the normal
+     * components can be `nullptr` to skip them (e.g. in
+     * `ComposePoints()`, to compose points on the plane). The input and output
+     * arrays must not overlap.
+     */
+
+    /// Returns the kernel performing the batch operations on points (or vectors).
+    details::DecompositionKernel BatchKernel(bool points = true) const
+    {
+      return Plane().BatchKernel(points);
+    }
+
+    /// Fills `main`, `secondary` and `normal` with the components of the `points`.
+    template <typename BIter, typename EIter>
+    void DecomposePoints(util::span<BIter, EIter> points,
+                         double* main,
+                         double* secondary,
+                         double* normal) const
+    {
+      BatchKernel(true).decompose(points.begin(), points.end(), main, secondary, normal);
+    }
+
+    /// Fills `main`, `secondary` and `normal` with the components of `n` points.
+    void DecomposePoints(std::size_t n,
+                         double const* x,
+                         double const* y,
+                         double const* z,
+                         double* main,
+                         double* secondary,
+                         double* normal) const
+    {
+      BatchKernel(true).decompose(n, x, y, z, main, secondary, normal);
+    }
+
+    /// Fills `main` and `secondary` with the projections of the `points`.
+    template <typename BIter, typename EIter>
+    void ProjectPointsOnPlane(util::span<BIter, EIter> points,
+                              double* main,
+                              double* secondary) const
+    {
+      Plane().PointProjections(points, main, secondary);
+    }
+
+    /// Fills `main`, `secondary` and `normal` with the components of vectors `v`.
+    template <typename BIter, typename EIter>
+    void DecomposeVectors(util::span<BIter, EIter> v,
+                          double* main,
+                          double* secondary,
+                          double* normal) const
+    {
+      BatchKernel(false).decompose(v.begin(), v.end(), main, secondary, normal);
+    }
+
+    /// Fills `x`, `y` and `z` with the `n` points with the specified components.
+    void ComposePoints(std::size_t n,
+                       double const* main,
+                       double const* secondary,
+                       double const* normal,
+                       double* x,
+                       double* y,
+                       double* z) const
+    {
+      BatchKernel(true).compose(n, main, secondary, normal, x, y, z);
+    }
+
+    /// Fills `x`, `y` and `z` with the `n` vectors with the specified components.
+    void ComposeVectors(std::size_t n,
+                        double const* main,
+                        double const* secondary,
+                        double const* normal,
+                        double* x,
+                        double* y,
+                        double* z) const
+    {
+      BatchKernel(false).compose(n, main, secondary, normal, x, y, z);
+    }
+
+    /// @}
+
   }; // class Decomposer<>
 
   /// @}
@@ -0,0 +1,219 @@
+/**
+ * @file   larcorealg/Geometry/DensityVoxelMap.h
+ * @brief  Map of material density on a regular grid, with a ray integrator.
+ * @date   October 14, 2026
+ * @see    `geo::GeometryCore::BuildDensityVoxelMap()`
+ *
+ * This is a header only library.
+ */
+
+#ifndef LARCOREALG_GEOMETRY_DENSITYVOXELMAP_H
+#define LARCOREALG_GEOMETRY_DENSITYVOXELMAP_H
+
+// LArSoft libraries
+#include "larcorealg/Geometry/VoxelGrid.h"
+
+// C/C++ standard libraries
+#include <array>
+#include <cmath>   // std::sqrt()
+#include <cstddef> // std::size_t
+#include <vector>
+
+namespace geo {
+
+  class DensityVoxelMap;
+
+} // namespace geo
+
+//------------------------------------------------------------------------------
+/**
+ * @brief Density of the materials sampled on a regular grid of voxels.
+ *
+ * The map covers a box with its sides parallel to the coordinate axes, split
+ * into a regular grid of voxels.
+ * Each voxel stores the average density of the samples taken in it, and the
+ * smallest and largest sampled densities.
+ *
+ * The main purpose of the map is a fast approximation of the column density
+ * along a segment (`columnDensity()`), computed by walking the voxels the
+ * segment crosses (`geo::VoxelGrid::traverse()`) instead of following the
+ * boundaries of the geometry volumes.
+ * Together with the approximate value, the integral of the smallest and of the
+ * largest sampled densities is returned: as long as each voxel was sampled
+ * finely enough to catch all the materials in it, the exact column density is
+ * within those two bounds. The smaller the voxels, the tighter the bounds.
+ *
+ * The map can be filled with `setVoxel()`; `geo::GeometryCore` provides
+ * `BuildDensityVoxelMap()` to sample it from the detector geometry.
+ * The densities are in the same unit as they are set (for maps built from the
+ * geometry, g/cm&sup3;) and the column densities in that unit times
+ * centimeters, as `geo::GeometryCore::MassBetweenPoints()` returns.
+ */
+class geo::DensityVoxelMap {
+
+public:
+  /// Content of a voxel.
+  struct Voxel_t {
+    float density = 0.0f;    ///< Average density.
+    float minDensity = 0.0f; ///< Smallest density sampled.
+    float maxDensity = 0.0f; ///< Largest density sampled.
+  };
+
+  /// Result of a column density integration.
+  struct ColumnDensity_t {
+    double value = 0.0;         ///< Column density from the average densities.
+    double min = 0.0;           ///< Column density from the smallest densities.
+    double max = 0.0;           ///< Column density from the largest densities.
+    double outsideLength = 0.0; ///< Length of segment out of the map [cm].
+  };
+
+  /// Type of voxel index on a single direction.
+  using Index_t = std::size_t;
+
+  /// Constructor: an empty map.
+  DensityVoxelMap() = default;
+
+  /**
+   * @brief Constructor: a map on the specified box, with all densities `0`.
+   * @param lower coordinates of the lower corner of the box [cm]
+   * @param upper coordinates of the upper corner of the box [cm]
+   * @param nVoxels number of voxels on each direction
+   */
+  DensityVoxelMap(std::array<double, 3U> const& lower,
+                  std::array<double, 3U> const& upper,
+                  std::array<Index_t, 3U> const& nVoxels);
+
+  /// Returns whether the map has no voxel.
+  bool empty() const { return fVoxels.empty(); }
+
+  /// Returns the number of voxels on the specified direction (0 = _x_...).
+  Index_t nVoxels(unsigned int axis) const { return fGrid.nVoxels(axis); }
+
+  /// Returns the total number of voxels.
+  std::size_t size() const { return fVoxels.size(); }
+
+  /// Returns the size of a voxel on the specified direction [cm].
+  double voxelSize(unsigned int axis) const { return fGrid.voxelSize(axis); }
+
+  /// Returns the coordinate of the lower corner on the specified direction.
+  double lower(unsigned int axis) const { return fGrid.lower(axis); }
+
+  /// Returns the coordinate of the upper corner on the specified direction.
+  double upper(unsigned int axis) const { return fGrid.upper(axis); }
+
+  /// Returns the grid of the voxels.
+  geo::VoxelGrid<> const& grid() const { return fGrid; }
+
+  /// Returns the coordinates of the center of the specified voxel [cm].
+  std::array<double, 3U> voxelCenter(Index_t ix, Index_t iy, Index_t iz) const
+  {
+    return fGrid.voxelCenter({ix, iy, iz});
+  }
+
+  /// Returns the content of the specified voxel (no range check).
+  Voxel_t const& voxel(Index_t ix, Index_t iy, Index_t iz) const
+  {
+    return fVoxels[voxelIndex(ix, iy, iz)];
+  }
+
+  /// Sets the content of the specified voxel (no range check).
+  void setVoxel(Index_t ix, Index_t iy, Index_t iz, Voxel_t const& content)
+  {
+    fVoxels[voxelIndex(ix, iy, iz)] = content;
+  }
+
+  /// Returns whether the point `(x, y, z)` is in the map.
+  bool contains(double x, double y, double z) const;
+
+  /// Returns the average density at `(x, y, z)`, `0` if out of the map.
+  double density(double x, double y, double z) const;
+
+  /// Returns the average density at `point` (with `X()`, `Y()` and `Z()`).
+  template <typename Point>
+  double density(Point const& point) const
+  {
+    return density(point.X(), point.Y(), point.Z());
+  }
+
+  /**
+   * @brief Returns the column density along the segment from `p1` to `p2`.
+   * @param p1 coordinates of the start of the segment [cm]
+   * @param p2 coordinates of the end of the segment [cm]
+   * @return the column density and its bounds (see `ColumnDensity_t`)
+   *
+   * The parts of the segment outside the map are assigned no density; their
+   * total length is reported in the result.
+   */
+  ColumnDensity_t columnDensity(std::array<double, 3U> const& p1,
+                                std::array<double, 3U> const& p2) const;
+
+  /// Returns the column density along the segment from `p1` to `p2`.
+  template <typename Point>
+  ColumnDensity_t columnDensity(Point const& p1, Point const& p2) const
+  {
+    return columnDensity(std::array<double, 3U>{p1.X(), p1.Y(), p1.Z()},
+                         std::array<double, 3U>{p2.X(), p2.Y(), p2.Z()});
+  }
+
+private:
+  geo::VoxelGrid<> fGrid;       ///< The voxel grid covered by the map.
+  std::vector<Voxel_t> fVoxels; ///< Content of the voxels.
+
+  /// Returns the flat index of the voxel `(ix, iy, iz)`.
+  std::size_t voxelIndex(Index_t ix, Index_t iy, Index_t iz) const
+  {
+    return fGrid.index({ix, iy, iz});
+  }
+
+}; // geo::DensityVoxelMap
+
+//------------------------------------------------------------------------------
+//--- inline implementation
+//------------------------------------------------------------------------------
+inline geo::DensityVoxelMap::DensityVoxelMap(std::array<double, 3U> const& lower,
+                                             std::array<double, 3U> const& upper,
+                                             std::array<Index_t, 3U> const& nVoxels)
+  : fGrid(lower, upper, nVoxels), fVoxels(fGrid.indexSize())
+{}
+
+//------------------------------------------------------------------------------
+inline bool geo::DensityVoxelMap::contains(double x, double y, double z) const
+{
+  return !empty() && fGrid.contains(x, y, z);
+}
+
+//------------------------------------------------------------------------------
+inline double geo::DensityVoxelMap::density(double x, double y, double z) const
+{
+  if (!contains(x, y, z)) return 0.0;
+  return fVoxels[fGrid.index(fGrid.voxelAt(x, y, z))].density;
+}
+
+//------------------------------------------------------------------------------
+inline auto geo::DensityVoxelMap::columnDensity(std::array<double, 3U> const& p1,
+                                                std::array<double, 3U> const& p2) const
+  -> ColumnDensity_t
+{
+  double const dx = p2[0] - p1[0], dy = p2[1] - p1[1], dz = p2[2] - p1[2];
+  double const length = std::sqrt(dx * dx + dy * dy + dz * dz);
+
+  ColumnDensity_t result;
+  result.outsideLength = length;
+  if (empty()) return result;
+
+  // the parts of the segment not walked, including rounding slivers at the
+  // border of the map, are attributed outside
+  auto const addVoxel = [this, &result](geo::VoxelID const& voxel, double tEnter, double tLeave) {
+    Voxel_t const& content = fVoxels[fGrid.index(voxel)];
+    double const dt = tLeave - tEnter;
+    result.value += dt * content.density;
+    result.min += dt * content.minDensity;
+    result.max += dt * content.maxDensity;
+  };
+  result.outsideLength -= fGrid.traverse(p1, p2, addVoxel);
+  return result;
+} // geo::DensityVoxelMap::columnDensity()
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREALG_GEOMETRY_DENSITYVOXELMAP_H
@@ -0,0 +1,198 @@
+/**
+ * @file   larcorealg/Geometry/DeviceGeometry.h
+ * @brief  Position to wire and channel queries on a flat geometry buffer.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/DeviceGeometryBuffer.h`,
+ *         `geo::GeometryCore::MakeDeviceGeometryBuffer()`
+ *
+ * This is a header only library, which can be included in CUDA, HIP or SYCL
+ * device code: the queries use no standard library facility, no dynamic
+ * memory, no exceptions and no virtual functions.
+ */
+
+#ifndef LARCOREALG_GEOMETRY_DEVICEGEOMETRY_H
+#define LARCOREALG_GEOMETRY_DEVICEGEOMETRY_H
+
+// LArSoft libraries
+#include "larcorealg/Geometry/CompactGeometry.h"
+
+// C/C++ standard libraries
+#include <cstdint> // std::uint32_t
+
+/**
+ * @brief Geometry description for device (GPU) code.
+ *
+ * The buffer holds, in this order and each starting at the offset recorded in
+ * the header:
+ * 1. a `Header_t`;
+ * 2. the TPCs (`geo::compact::TPC_t`), as in `geo::CompactGeometry`;
+ * 3. the planes (`Plane_t`), as in `geo::CompactGeometry` plus their channels;
+ * 4. a table of channels, for the planes whose channels are not consecutive.
+ *
+ * All offsets are in bytes from the start of the buffer and multiple of 16,
+ * so the buffer can be copied as a whole to device memory and used there.
+ */
+namespace geo::device {
+
+  /// Identifier of the buffer format (`"LGDV"`).
+  constexpr std::uint32_t Magic = 0x5644474CU;
+
+  /// Version of the buffer format.
+  constexpr std::uint32_t FormatVersion = 1U;
+
+  /// Value of an invalid index or channel.
+  constexpr std::uint32_t InvalidIndex = 0xFFFFFFFFU;
+
+  /// Header of the buffer.
+  struct Header_t {
+    std::uint32_t magic;         ///< Always `Magic`.
+    std::uint32_t version;       ///< Format version.
+    std::uint32_t nTPCs;         ///< Number of TPC records.
+    std::uint32_t nPlanes;       ///< Number of plane records.
+    std::uint32_t nChannels;     ///< Number of entries in the channel table.
+    std::uint32_t tpcOffset;     ///< Offset of the first TPC record.
+    std::uint32_t planeOffset;   ///< Offset of the first plane record.
+    std::uint32_t channelOffset; ///< Offset of the channel table.
+    std::uint32_t size;          ///< Total size of the buffer.
+    std::uint32_t reserved[3];   ///< Padding, always `0`.
+  }; // Header_t
+
+  /// A wire plane with its channels.
+  struct Plane_t {
+    geo::compact::Plane_t geom; ///< Geometry of the plane.
+    /// Channel of the first wire; the others follow if `channelTable` is invalid.
+    std::uint32_t firstChannel;
+    std::uint32_t channelTable; ///< Index in the channel table of the first wire.
+    std::uint32_t reserved[2];  ///< Padding, always `0`.
+  }; // Plane_t
+
+  static_assert(geo::compact::details::isRecord<Header_t>);
+  static_assert(geo::compact::details::isRecord<Plane_t>);
+
+  /// Result of `GeometryView::locate()`.
+  struct Location_t {
+    std::uint32_t tpc = InvalidIndex;     ///< Index of the TPC.
+    std::uint32_t plane = InvalidIndex;   ///< Index of the plane.
+    float wireCoordinate = 0.0f;          ///< Wire coordinate on the plane.
+    std::uint32_t wire = InvalidIndex;    ///< Nearest wire, if in the plane.
+    std::uint32_t channel = InvalidIndex; ///< Channel of the nearest wire.
+
+    /// Returns whether a wire was found.
+    LARCOREALG_HOST_DEVICE bool isValid() const { return wire != InvalidIndex; }
+  }; // Location_t
+
+  /**
+   * @brief Queries on a geometry buffer.
+   *
+   * The view does not own nor check the buffer, which must have been created
+   * by `geo::makeDeviceGeometryBuffer()` (and it can be checked on the host
+   * with `geo::checkDeviceGeometryBuffer()`). The indices of TPCs and planes
+   * are the ones of the records in the buffer: the plane number within its
+   * TPC is `plane - TPC(tpc).firstPlane`.
+   *
+   * Example of use in a kernel:
+   * ~~~~{.cpp}
+   * geo::device::GeometryView const geom{ buffer };
+   * auto const loc = geom.locate(x, y, z, 2U); // collection plane
+   * if (loc.isValid()) atomicAdd(&charge[loc.channel], q);
+   * ~~~~
+   */
+  class GeometryView {
+  public:
+    /// Binds to the geometry buffer at `buffer`.
+    LARCOREALG_HOST_DEVICE explicit GeometryView(void const* buffer)
+      : fBase(static_cast<unsigned char const*>(buffer))
+    {}
+
+    /// Returns the header of the buffer.
+    LARCOREALG_HOST_DEVICE Header_t const& header() const
+    {
+      return *reinterpret_cast<Header_t const*>(fBase);
+    }
+
+    /// Number of TPCs.
+    LARCOREALG_HOST_DEVICE std::uint32_t nTPCs() const { return header().nTPCs; }
+
+    /// Number of planes (in all TPCs).
+    LARCOREALG_HOST_DEVICE std::uint32_t nPlanes() const { return header().nPlanes; }
+
+    /// Returns the TPC with index `i` (not checked).
+    LARCOREALG_HOST_DEVICE geo::compact::TPC_t const& TPC(std::uint32_t i) const
+    {
+      return reinterpret_cast<geo::compact::TPC_t const*>(fBase + header().tpcOffset)[i];
+    }
+
+    /// Returns the plane with index `i` (not checked).
+    LARCOREALG_HOST_DEVICE Plane_t const& plane(std::uint32_t i) const
+    {
+      return reinterpret_cast<Plane_t const*>(fBase + header().planeOffset)[i];
+    }
+
+    /// Returns the index of the TPC whose active volume contains the point,
+    /// `InvalidIndex` if none.
+    LARCOREALG_HOST_DEVICE std::uint32_t findTPC(float x, float y, float z) const
+    {
+      std::uint32_t const n = nTPCs();
+      for (std::uint32_t i = 0; i < n; ++i) {
+        geo::compact::TPC_t const& tpc = TPC(i);
+        if ((x >= tpc.activeMin[0]) && (x <= tpc.activeMax[0]) && (y >= tpc.activeMin[1]) &&
+            (y <= tpc.activeMax[1]) && (z >= tpc.activeMin[2]) && (z <= tpc.activeMax[2]))
+          return i;
+      }
+      return InvalidIndex;
+    }
+
+    /// Returns the wire nearest to `wireCoordinate` on the plane, `InvalidIndex`
+    /// if there is no wire within half a pitch.
+    LARCOREALG_HOST_DEVICE std::uint32_t nearestWire(std::uint32_t iPlane,
+                                                     float wireCoordinate) const
+    {
+      // same rounding as geo::PlaneGeo::NearestWireID()
+      int const wireNo = int(0.5f + wireCoordinate);
+      if ((wireNo < 0) || (std::uint32_t(wireNo) >= plane(iPlane).geom.nWires))
+        return InvalidIndex;
+      return std::uint32_t(wireNo);
+    }
+
+    /// Returns the channel of the wire `wire` of the plane (not checked).
+    LARCOREALG_HOST_DEVICE std::uint32_t channel(std::uint32_t iPlane, std::uint32_t wire) const
+    {
+      Plane_t const& p = plane(iPlane);
+      if (p.channelTable == InvalidIndex) return p.firstChannel + wire;
+      return reinterpret_cast<std::uint32_t const*>(fBase +
+                                                    header().channelOffset)[p.channelTable + wire];
+    }
+
+    /**
+     * @brief Finds TPC, wire and channel for a point.
+     * @param x _x_ coordinate of the point [cm]
+     * @param y _y_ coordinate of the point [cm]
+     * @param z _z_ coordinate of the point [cm]
+     * @param planeNo number of the plane within the TPC
+     * @return the location; the wire is invalid if not found
+     */
+    LARCOREALG_HOST_DEVICE Location_t locate(float x,
+                                             float y,
+                                             float z,
+                                             std::uint32_t planeNo) const
+    {
+      Location_t loc;
+      loc.tpc = findTPC(x, y, z);
+      if (loc.tpc == InvalidIndex) return loc;
+      geo::compact::TPC_t const& tpc = TPC(loc.tpc);
+      if (planeNo >= tpc.nPlanes) return loc;
+      loc.plane = tpc.firstPlane + planeNo;
+      loc.wireCoordinate = plane(loc.plane).geom.wireCoordinate(x, y, z);
+      loc.wire = nearestWire(loc.plane, loc.wireCoordinate);
+      if (loc.wire != InvalidIndex) loc.channel = channel(loc.plane, loc.wire);
+      return loc;
+    }
+
+  private:
+    unsigned char const* fBase; ///< Start of the buffer.
+
+  }; // class GeometryView
+
+} // namespace geo::device
+
+#endif // LARCOREALG_GEOMETRY_DEVICEGEOMETRY_H
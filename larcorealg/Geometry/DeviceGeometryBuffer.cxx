@@ -0,0 +1,147 @@
+/**
+ * @file   larcorealg/Geometry/DeviceGeometryBuffer.cxx
+ * @brief  Creation and validation of the flat geometry buffer for devices.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/DeviceGeometryBuffer.h`
+ */
+
+// LArSoft libraries
+#include "larcorealg/Geometry/DeviceGeometryBuffer.h"
+
+// framework libraries
+#include "cetlib_except/exception.h"
+
+// C/C++ standard libraries
+#include <cstring> // std::memcpy()
+
+namespace {
+
+  /// Returns `size` rounded up to a multiple of 16.
+  constexpr std::size_t padded(std::size_t size) { return (size + 15U) & ~std::size_t{15U}; }
+
+  /// Copies `n` bytes from `src` into `buffer` at byte offset `offset`.
+  void copyInto(geo::DeviceGeometryBuffer_t& buffer,
+                std::size_t offset,
+                void const* src,
+                std::size_t n)
+  {
+    if (n > 0) std::memcpy(reinterpret_cast<unsigned char*>(buffer.data()) + offset, src, n);
+  }
+
+} // local namespace
+
+//------------------------------------------------------------------------------
+geo::DeviceGeometryBuffer_t geo::makeDeviceGeometryBuffer(
+  geo::CompactGeometry const& geom,
+  std::vector<std::vector<std::uint32_t>> const& planeChannels)
+{
+  if (planeChannels.size() != geom.planes.size()) {
+    throw cet::exception("DeviceGeometry")
+      << "Channels for " << planeChannels.size() << " planes provided, but there are "
+      << geom.planes.size() << ".\n";
+  }
+
+  // planes and channel table
+  std::vector<device::Plane_t> planes;
+  std::vector<std::uint32_t> channelTable;
+  planes.reserve(geom.planes.size());
+  for (std::size_t i = 0; i < geom.planes.size(); ++i) {
+    compact::Plane_t const& plane = geom.planes[i];
+    std::vector<std::uint32_t> const& channels = planeChannels[i];
+    if (channels.size() != plane.nWires) {
+      throw cet::exception("DeviceGeometry")
+        << "Plane #" << i << " has " << plane.nWires << " wires, but " << channels.size()
+        << " channels are provided.\n";
+    }
+
+    device::Plane_t& info = planes.emplace_back();
+    info.geom = plane;
+    info.firstChannel = channels.empty() ? device::InvalidIndex : channels.front();
+    info.channelTable = device::InvalidIndex;
+    info.reserved[0] = info.reserved[1] = 0U;
+    for (std::size_t w = 1; w < channels.size(); ++w) {
+      if (channels[w] == info.firstChannel + w) continue;
+      info.channelTable = channelTable.size();
+      channelTable.insert(channelTable.end(), channels.begin(), channels.end());
+      break;
+    }
+  } // for planes
+
+  device::Header_t header{};
+  header.magic = device::Magic;
+  header.version = device::FormatVersion;
+  header.nTPCs = geom.TPCs.size();
+  header.nPlanes = planes.size();
+  header.nChannels = channelTable.size();
+  header.tpcOffset = padded(sizeof(header));
+  header.planeOffset = padded(header.tpcOffset + geom.TPCs.size() * sizeof(compact::TPC_t));
+  header.channelOffset = padded(header.planeOffset + planes.size() * sizeof(device::Plane_t));
+  std::size_t const size =
+    padded(header.channelOffset + channelTable.size() * sizeof(std::uint32_t));
+  header.size = size;
+
+  DeviceGeometryBuffer_t buffer(size / sizeof(std::uint32_t), 0U);
+  copyInto(buffer, 0U, &header, sizeof(header));
+  copyInto(buffer, header.tpcOffset, geom.TPCs.data(), geom.TPCs.size() * sizeof(compact::TPC_t));
+  copyInto(buffer, header.planeOffset, planes.data(), planes.size() * sizeof(device::Plane_t));
+  copyInto(
+    buffer, header.channelOffset, channelTable.data(), channelTable.size() * sizeof(std::uint32_t));
+  return buffer;
+} // geo::makeDeviceGeometryBuffer()
+
+//------------------------------------------------------------------------------
+void geo::checkDeviceGeometryBuffer(void const* data, std::size_t size)
+{
+  if (size < sizeof(device::Header_t)) {
+    throw cet::exception("DeviceGeometry")
+      << "Device geometry buffer too short (" << size << " bytes).\n";
+  }
+  device::Header_t header;
+  std::memcpy(&header, data, sizeof(header));
+  if (header.magic != device::Magic) {
+    throw cet::exception("DeviceGeometry") << "Data is not a device geometry buffer.\n";
+  }
+  if (header.version != device::FormatVersion) {
+    throw cet::exception("DeviceGeometry")
+      << "Device geometry buffer format version " << header.version << " not supported (only "
+      << device::FormatVersion << ").\n";
+  }
+  auto const checkBlock = [size](std::size_t offset, std::size_t n, char const* what) {
+    if ((offset % 16U == 0U) && (offset <= size) && (n <= size - offset)) return;
+    throw cet::exception("DeviceGeometry")
+      << "Device geometry buffer of " << size << " bytes can't hold " << what << " at offset "
+      << offset << ".\n";
+  };
+  if (header.size != size) {
+    throw cet::exception("DeviceGeometry")
+      << "Device geometry buffer is " << size << " bytes, " << header.size << " expected.\n";
+  }
+  checkBlock(header.tpcOffset, header.nTPCs * sizeof(compact::TPC_t), "the TPCs");
+  checkBlock(header.planeOffset, header.nPlanes * sizeof(device::Plane_t), "the planes");
+  checkBlock(header.channelOffset, header.nChannels * sizeof(std::uint32_t), "the channels");
+
+  device::GeometryView const view{data};
+  for (std::uint32_t i = 0; i < header.nTPCs; ++i) {
+    compact::TPC_t const& tpc = view.TPC(i);
+    if (std::size_t{tpc.firstPlane} + tpc.nPlanes <= header.nPlanes) continue;
+    throw cet::exception("DeviceGeometry")
+      << "TPC #" << i << " has planes [" << tpc.firstPlane << "; "
+      << (tpc.firstPlane + tpc.nPlanes) << "[ out of " << header.nPlanes << ".\n";
+  }
+  for (std::uint32_t i = 0; i < header.nPlanes; ++i) {
+    device::Plane_t const& plane = view.plane(i);
+    if (plane.geom.tpc >= header.nTPCs) {
+      throw cet::exception("DeviceGeometry")
+        << "Plane #" << i << " belongs to TPC #" << plane.geom.tpc << " out of "
+        << header.nTPCs << ".\n";
+    }
+    if (plane.channelTable == device::InvalidIndex) continue;
+    if (std::size_t{plane.channelTable} + plane.geom.nWires <= header.nChannels) continue;
+    throw cet::exception("DeviceGeometry")
+      << "Plane #" << i << " has channels [" << plane.channelTable << "; "
+      << (plane.channelTable + plane.geom.nWires) << "[ out of the " << header.nChannels
+      << " in the table.\n";
+  } // for planes
+} // geo::checkDeviceGeometryBuffer()
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,56 @@
+/**
+ * @file   larcorealg/Geometry/DeviceGeometryBuffer.h
+ * @brief  Creation and validation of the flat geometry buffer for devices.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/DeviceGeometry.h`,
+ *         `larcorealg/Geometry/DeviceGeometryBuffer.cxx`
+ */
+
+#ifndef LARCOREALG_GEOMETRY_DEVICEGEOMETRYBUFFER_H
+#define LARCOREALG_GEOMETRY_DEVICEGEOMETRYBUFFER_H
+
+// LArSoft libraries
+#include "larcorealg/Geometry/CompactGeometry.h"
+#include "larcorealg/Geometry/DeviceGeometry.h"
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint32_t
+#include <vector>
+
+namespace geo {
+
+  /// Type of the buffer with the geometry for devices.
+  using DeviceGeometryBuffer_t = std::vector<std::uint32_t>;
+
+  /**
+   * @brief Packs TPCs, planes and channels into a buffer for device code.
+   * @param geom the TPCs and planes
+   * @param planeChannels for each plane, the channel of each of its wires
+   * @return the buffer, to be used with `geo::device::GeometryView`
+   * @throw cet::exception (category `"DeviceGeometry"`) on inconsistent input
+   * @see `geo::GeometryCore::MakeDeviceGeometryBuffer()`
+   *
+   * The channels of a plane are stored as its first channel when they are
+   * consecutive; otherwise they are all added to the channel table.
+   * The size of the buffer in bytes is `buffer.size() * sizeof(buffer[0])`.
+   */
+  DeviceGeometryBuffer_t makeDeviceGeometryBuffer(
+    geo::CompactGeometry const& geom,
+    std::vector<std::vector<std::uint32_t>> const& planeChannels);
+
+  /**
+   * @brief Checks the consistency of a device geometry buffer.
+   * @param data start of the buffer
+   * @param size size of the buffer, in bytes
+   * @throw cet::exception (category `"DeviceGeometry"`) if the buffer is invalid
+   *
+   * Format, version, offsets and the indices between records are checked, so
+   * that `geo::device::GeometryView` queries on valid indices stay in the
+   * buffer.
+   */
+  void checkDeviceGeometryBuffer(void const* data, std::size_t size);
+
+} // namespace geo
+
+#endif // LARCOREALG_GEOMETRY_DEVICEGEOMETRYBUFFER_H
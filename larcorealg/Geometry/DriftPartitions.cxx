@@ -88,11 +88,47 @@ geo::TPCGeo const* geo::DriftPartitions::TPCat(Position_t const& pos) const
 {
   auto comp = decomposer.DecomposePoint(pos);
   auto volume = driftVolumeAt(comp.distance);
-  return (volume && volume->partition) ?
-           volume->partition->atPoint(comp.projection.X(), comp.projection.Y()) :
-           nullptr;
+  return volume ? volume->TPCat(comp.projection.X(), comp.projection.Y()) : nullptr;
 } // geo::DriftPartitions::TPCat()
 
+//------------------------------------------------------------------------------
+void geo::DriftPartitions::TPCsAt(util::span<Position_t const*> positions,
+                                  geo::TPCGeo const** TPCs) const
+{
+  // the previous volume is good if driftVolumeAt() would pick it too,
+  // i.e. if it covers the drift and the next volume starts after it
+  DriftVolume_t const* const vend = volumes.data() + volumes.size();
+  auto const stillIn = [vend](DriftVolume_t const* volume, double drift) {
+    return volume && volume->coversDrift(drift) &&
+           ((volume + 1 == vend) || ((volume + 1)->driftCoverage.lower > drift));
+  };
+
+  DriftVolume_t const* volume = nullptr;
+  for (Position_t const& pos : positions) {
+    auto const comp = decomposer.DecomposePoint(pos);
+    if (!stillIn(volume, comp.distance)) volume = driftVolumeAt(comp.distance);
+    *(TPCs++) = volume ? volume->TPCat(comp.projection.X(), comp.projection.Y()) : nullptr;
+  } // for
+} // geo::DriftPartitions::TPCsAt()
+
+//------------------------------------------------------------------------------
+std::vector<geo::TPCGeo const*> geo::DriftPartitions::TPCsAt(
+  util::span<Position_t const*> positions) const
+{
+  std::vector<geo::TPCGeo const*> TPCs(positions.size());
+  TPCsAt(positions, TPCs.data());
+  return TPCs;
+} // geo::DriftPartitions::TPCsAt()
+
+//------------------------------------------------------------------------------
+void geo::DriftPartitions::compile(unsigned int cellsPerInterval /* = DefaultCellsPerInterval */)
+{
+  for (DriftVolume_t& volume : volumes) {
+    volume.grid =
+      volume.partition ? TPCGrid_t{*(volume.partition), cellsPerInterval} : TPCGrid_t{};
+  }
+} // geo::DriftPartitions::compile()
+
 //------------------------------------------------------------------------------
 void geo::DriftPartitions::addPartition(std::unique_ptr<TPCPartition_t>&& part)
 {
@@ -1087,6 +1123,7 @@ geo::DriftPartitions geo::buildDriftVolumes(geo::CryostatGeo const& cryo)
     } // if error
     partitions.addPartition(std::move(part));
   } // for
+  partitions.compile();
 
   return partitions;
 } // geo::buildDriftVolumes()
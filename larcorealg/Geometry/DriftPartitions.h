@@ -12,7 +12,10 @@
 #define LARCOREALG_GEOMETRY_DRIFTPARTITIONS_H
 
 // LArSoft libraries
+#include "larcorealg/CoreUtils/MemoryUsage.h"
+#include "larcorealg/CoreUtils/span.h"
 #include "larcorealg/Geometry/Decomposer.h"
+#include "larcorealg/Geometry/PartitionGrid.h"
 #include "larcorealg/Geometry/Partitions.h"
 #include "larcorealg/Geometry/SimpleGeo.h"
 #include "larcorealg/Geometry/TPCGeo.h"
@@ -90,6 +93,9 @@ namespace geo {
     /// Type of TPC collection for the partition of a single drift volume.
     using TPCPartition_t = geo::part::Partition<geo::TPCGeo const>;
 
+    /// Type of flat lookup table of the TPCs of a single drift volume.
+    using TPCGrid_t = geo::part::PartitionGrid<geo::TPCGeo const>;
+
     /// Type for description of drift range.
     using Range_t = lar::util::simple_geo::Range<double>;
 
@@ -99,15 +105,30 @@ namespace geo {
       std::unique_ptr<TPCPartition_t> partition;
       /// Interval of drift direction covered by this drift volume.
       Range_t driftCoverage;
+      /// Flat lookup of `partition` (empty until `DriftPartitions::compile()`).
+      TPCGrid_t grid;
 
       /// Constructor: imports the specified partition and drift coverage range.
       DriftVolume_t(std::unique_ptr<TPCPartition_t>&& part, Range_t const& cover)
         : partition(std::move(part)), driftCoverage(cover)
       {}
 
+      /// Returns the memory allocated by the drift volume, besides its own size [bytes]
+      std::size_t heapMemory() const
+      {
+        return (partition ? partition->memoryUsage() : 0U) + grid.heapMemory();
+      }
+
       /// Returns whether this drift volume covers specified drift coordinate.
       bool coversDrift(double drift) const { return driftCoverage.contains(drift); }
 
+      /// Returns the TPC at the specified width and depth (`nullptr` if none).
+      geo::TPCGeo const* TPCat(double w, double d) const
+      {
+        if (!grid.empty()) return grid.atPoint(w, d);
+        return partition ? partition->atPoint(w, d) : nullptr;
+      }
+
       /// Returns the drift coordinate of the specified partition.
       static double Position(DriftVolume_t const& part) { return part.driftCoverage.lower; }
 
@@ -157,8 +178,37 @@ namespace geo {
     /// Returns which TPC contains the specified position (`nullptr` if none).
     geo::TPCGeo const* TPCat(Position_t const& pos) const;
 
+    /**
+     * @brief Finds the TPC containing each of the specified positions.
+     * @param positions the positions to be looked up
+     * @param[out] TPCs array with room for a TPC pointer for each position
+     *
+     * Each result is the same as from `TPCat()` (`nullptr` if no TPC).
+     * The drift volume of the previous position is tried first, which saves
+     * the search when positions come in groups from the same volume.
+     */
+    void TPCsAt(util::span<Position_t const*> positions, geo::TPCGeo const** TPCs) const;
+
+    /// Returns the TPC containing each of the positions (see `TPCsAt()`).
+    std::vector<geo::TPCGeo const*> TPCsAt(util::span<Position_t const*> positions) const;
+
     /// @}
 
+    /**
+     * @brief Builds the flat lookup tables of all drift volumes.
+     * @param cellsPerInterval resolution of the tables
+     * @see `geo::part::PartitionGrid`
+     *
+     * After this call, `TPCat()` and `TPCsAt()` find the TPC within the drift
+     * volume with a table lookup instead of the search through the partition;
+     * the results are unchanged. `buildDriftVolumes()` already calls this.
+     * Volumes added later are not compiled until this is called again.
+     */
+    void compile(unsigned int cellsPerInterval = TPCGrid_t::DefaultCellsPerInterval);
+
+    /// Returns the memory allocated by the drift volumes [bytes]
+    std::size_t heapMemory() const { return lar::util::heapMemory(volumes); }
+
     /// Printout of the drift volume information.
     template <typename Stream>
     void print(Stream&& out) const;
@@ -196,6 +246,8 @@ namespace geo {
    * which contains a hierarchical structure of type `geo::part::Partition`
    * (with data `geo::TPCGeo const` coming directly from the geometry). This
    * structure describes the topology of the TPCs within the drift volume.
+   * The partitions are also compiled into flat lookup tables
+   * (`DriftPartitions::compile()`).
    *
    */
   DriftPartitions buildDriftVolumes(geo::CryostatGeo const& cryo);
@@ -7,8 +7,11 @@
  * This is currently a header-only library.
  *
  * It offers:
+ * - LazyMessageException (base of exceptions formatting their message late)
  * - InvalidWireError (for bad wire numbers)
  * - InvalidWireIDError (deprecated in favor of the former)
+ * - PositionLookupError (for positions not in any geometry element)
+ * - NoChannelError (for wires without a readout channel)
  *
  */
 
@@ -22,10 +25,94 @@
 #include "cetlib_except/exception.h"
 
 // C/C++ standard library
+#include <array>
 #include <limits> // std::numeric_limits<>
+#include <ostream>
+#include <sstream>
+#include <string>
 
 namespace geo {
 
+  /** **************************************************************************
+   * @brief Exception describing itself only when its message is requested.
+   *
+   * Derived classes store the parameters of the failure and write their
+   * description in `formatMessage()`, which is called only the first time the
+   * message is requested with `what()` or `explain_self()`: code catching the
+   * exception to recover from it does not pay for the formatting.
+   * The description is appended to the message of the `cet::exception`, after
+   * anything streamed into the exception at the throw site.
+   *
+   * Note that `cet::exception::explain_self()` is not virtual: when the
+   * exception is handled as a generic `cet::exception`, `what()` must be
+   * called before `explain_self()` for the description to be included.
+   */
+  class LazyMessageException : public cet::exception {
+  public:
+    using cet::exception::exception;
+
+    /// Returns the full explanation, with the description of the failure.
+    char const* what() const noexcept override
+    {
+      appendMessage();
+      return cet::exception::what();
+    }
+
+    /// Returns the full explanation, with the description of the failure.
+    std::string explain_self() const
+    {
+      appendMessage();
+      return cet::exception::explain_self();
+    }
+
+  protected:
+    /// Writes the description of the failure into `out`.
+    virtual void formatMessage(std::ostream& out) const = 0;
+
+  private:
+    mutable bool fFormatted = false; ///< Whether the message has been added.
+
+    /// Appends the description to the message, the first time only.
+    void appendMessage() const
+    {
+      if (fFormatted) return;
+      fFormatted = true;
+      std::ostringstream sstr;
+      formatMessage(sstr);
+      // the exception object being handled is never a constant one
+      const_cast<LazyMessageException&>(*this) << sstr.str();
+    }
+
+  }; // class LazyMessageException
+
+  /// Coordinates of a position stored in an exception.
+  struct ExceptionPosition_t {
+    std::array<double, 3U> coords{}; ///< Coordinates of the position [cm].
+    bool valid = false;              ///< Whether the position was recorded.
+
+    /// Records the position of `point` (with `X()`, `Y()` and `Z()`).
+    template <typename Point>
+    void set(Point const& point)
+    {
+      coords = {{point.X(), point.Y(), point.Z()}};
+      valid = true;
+    }
+
+    /// Records the position with coordinates `point` (x, y, z).
+    void set(double const* point)
+    {
+      coords = {{point[0], point[1], point[2]}};
+      valid = true;
+    }
+  }; // ExceptionPosition_t
+
+  /// Prints the `position` as `(x,y,z)`.
+  inline std::ostream& operator<<(std::ostream& out, ExceptionPosition_t const& position)
+  {
+    return out << "(" << position.coords[0] << "," << position.coords[1] << ","
+               << position.coords[2] << ")";
+  }
+
   /** **************************************************************************
    * @brief Exception thrown on invalid wire number
    *
@@ -35,36 +122,50 @@ namespace geo {
    *
    * The wire numbers are signed.
    *
-   *
+   * The message describing the failure is composed from these parameters,
+   * and from the position being queried if recorded with `atPosition()`,
+   * only when requested (see `geo::LazyMessageException`).
    */
-  class InvalidWireError : public cet::exception {
+  class InvalidWireError : public LazyMessageException {
   public:
     /// Value used to represent an invalid wire number
     static constexpr int InvalidWireNo = std::numeric_limits<int>::max();
 
     /// Constructor: we don't have any information
     /// @deprecated Specify at least the wrong wire number!
-    InvalidWireError(std::string cat) : cet::exception(cat) {}
+    InvalidWireError(std::string cat) : LazyMessageException(cat) {}
 
     /// Constructor with the complete information
     InvalidWireError(std::string cat, geo::PlaneID const& planeID, int badWireNo, int betterWireNo)
-      : cet::exception(cat), fPlaneID(planeID), fWireNumber(badWireNo), fBetterWireNo(betterWireNo)
+      : LazyMessageException(cat)
+      , fPlaneID(planeID)
+      , fWireNumber(badWireNo)
+      , fBetterWireNo(betterWireNo)
     {}
 
     /// Constructor: no wire suggestions
     InvalidWireError(std::string cat, geo::PlaneID const& planeID, int badWireNo)
-      : cet::exception(cat), fPlaneID(planeID), fWireNumber(badWireNo)
+      : LazyMessageException(cat), fPlaneID(planeID), fWireNumber(badWireNo)
     {}
 
     /// Constructor: no plane information
     InvalidWireError(std::string cat, int badWireNo, int betterWireNo)
-      : cet::exception(cat), fWireNumber(badWireNo), fBetterWireNo(betterWireNo)
+      : LazyMessageException(cat), fWireNumber(badWireNo), fBetterWireNo(betterWireNo)
     {}
 
     /// Constructor: no plane information and no suggestion
-    InvalidWireError(std::string cat, int badWireNo) : cet::exception(cat), fWireNumber(badWireNo)
+    InvalidWireError(std::string cat, int badWireNo)
+      : LazyMessageException(cat), fWireNumber(badWireNo)
     {}
 
+    /// Records the position (with `X()`, `Y()` and `Z()`) whose wire was sought.
+    template <typename Point>
+    InvalidWireError& atPosition(Point const& point)
+    {
+      fPosition.set(point);
+      return *this;
+    }
+
     /// @{
     /// @name Access to bad wire
 
@@ -104,9 +205,22 @@ namespace geo {
 
     /// @}
 
+  protected:
+    void formatMessage(std::ostream& out) const override
+    {
+      out << "Can't find nearest wire";
+      if (fPosition.valid) out << " for position " << fPosition;
+      if (hasPlane()) out << " in plane " << fPlaneID;
+      if (hasSuggestedWire()) out << " approx wire number # " << fBetterWireNo;
+      if (hasBadWire()) out << " (capped from " << fWireNumber << ")";
+      out << "\n";
+    }
+
   private:
     geo::PlaneID fPlaneID; ///< plane the wire belongs to
 
+    ExceptionPosition_t fPosition; ///< the position the wire was sought for
+
     /// the invalid wire number
     int fWireNumber = InvalidWireNo;
 
@@ -123,17 +237,99 @@ namespace geo {
    *
    * @deprecated Use InvalidWireError instead
    */
-  class InvalidWireIDError : public cet::exception {
+  class InvalidWireIDError : public LazyMessageException {
   public:
-    InvalidWireIDError(std::string cat) : cet::exception(cat) {}
+    InvalidWireIDError(std::string cat) : LazyMessageException(cat) {}
 
     InvalidWireIDError(std::string cat, int bad_wire, int better_wire = -1)
-      : cet::exception(cat), wire_number(bad_wire), better_wire_number(better_wire)
+      : LazyMessageException(cat), wire_number(bad_wire), better_wire_number(better_wire)
     {}
 
+    /// Records the position and plane whose wire was sought.
+    template <typename Point>
+    InvalidWireIDError& at(Point const& point, geo::PlaneID const& planeID)
+    {
+      fPosition.set(point);
+      fPlaneID = planeID;
+      return *this;
+    }
+
     int wire_number = -1;        ///< the invalid wire number
     int better_wire_number = -1; ///< a suggestion for a good wire number
-  };                             // class InvalidWireIDError
+
+  protected:
+    void formatMessage(std::ostream& out) const override
+    {
+      if (!fPosition.valid) return; // no information: the message is the one streamed in
+      out << "Can't Find Nearest Wire for position " << fPosition << " in plane " << fPlaneID
+          << " approx wire number # " << better_wire_number << " (capped from " << wire_number
+          << ")\n";
+    }
+
+  private:
+    ExceptionPosition_t fPosition; ///< the position the wire was sought for
+    geo::PlaneID fPlaneID;         ///< the plane the wire was sought in
+
+  }; // class InvalidWireIDError
+
+  /** **************************************************************************
+   * @brief Exception thrown when a position is not in any element of a kind.
+   *
+   * This is thrown, e.g., by `geo::GeometryCore::PositionToTPC()`. The kind
+   * of element (like `"TPC"`) must be a string with static storage.
+   */
+  class PositionLookupError : public LazyMessageException {
+  public:
+    /// Constructor: no `element` including `point` (with `X()`, `Y()`, `Z()`).
+    template <typename Point>
+    PositionLookupError(std::string cat, char const* element, Point const& point)
+      : LazyMessageException(cat), fElement(element)
+    {
+      fPosition.set(point);
+    }
+
+    /// Returns the kind of element which was sought.
+    char const* element() const { return fElement; }
+
+    /// Returns the coordinates of the position [cm].
+    std::array<double, 3U> const& position() const { return fPosition.coords; }
+
+  protected:
+    void formatMessage(std::ostream& out) const override
+    {
+      out << "Can't find any " << fElement << " at position " << fPosition << "\n";
+    }
+
+  private:
+    char const* fElement;          ///< the kind of element sought
+    ExceptionPosition_t fPosition; ///< the position which was looked up
+
+  }; // class PositionLookupError
+
+  /** **************************************************************************
+   * @brief Exception thrown when a wire is not associated to any channel.
+   *
+   * This is thrown, e.g., by `geo::ChannelMapStandardAlg::PlaneWireToChannel()`.
+   */
+  class NoChannelError : public LazyMessageException {
+  public:
+    NoChannelError(std::string cat, geo::WireID const& wireID)
+      : LazyMessageException(cat), fWireID(wireID)
+    {}
+
+    /// Returns the ID of the wire with no channel.
+    geo::WireID const& wireID() const { return fWireID; }
+
+  protected:
+    void formatMessage(std::ostream& out) const override
+    {
+      out << "NO CHANNEL FOUND for " << fWireID;
+    }
+
+  private:
+    geo::WireID fWireID; ///< the wire without channel
+
+  }; // class NoChannelError
 
 } // namespace geo
 
@@ -0,0 +1,316 @@
+/**
+ * @file   larcorealg/Geometry/FixedChannelMap.h
+ * @brief  Channel mapping of a detector layout known at compile time.
+ * @date   October 14, 2026
+ * @see    `geo::ChannelMapStandardAlg`
+ *
+ * This is a header only library.
+ */
+
+#ifndef LARCOREALG_GEOMETRY_FIXEDCHANNELMAP_H
+#define LARCOREALG_GEOMETRY_FIXEDCHANNELMAP_H
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/RawTypes.h" // raw::ChannelID_t
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::sort()
+#include <array>
+#include <cstddef> // std::size_t
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace geo {
+
+  /**
+   * @brief Channel mapping with the detector layout as compile-time constants.
+   * @tparam Layout class describing the layout of the detector (see below)
+   *
+   * This mapping supports the detectors where the wires of each plane are
+   * read by consecutive channels, the first wire by the first channel, like
+   * with `geo::ChannelMapStandardAlg`. The whole mapping is then described by
+   * the number of wires and the first channel of each plane, which `Layout`
+   * provides as `constexpr` tables. All the conversions are `constexpr`
+   * functions, which the compiler can inline and, for constant arguments,
+   * fold into constants.
+   *
+   * The `Layout` class is usually generated from a geometry by
+   * `geo::writeFixedChannelLayout()`, and it has the static members:
+   * * `NCryostats`, `MaxTPCs` and `MaxPlanes`: the number of cryostats, and
+   *   the largest number of TPCs in a cryostat and of planes in a TPC
+   * * `NChannels`: the number of channels
+   * * `WireCounts`: a `std::array` of the number of wires of each plane, with
+   *   `NCryostats * MaxTPCs * MaxPlanes` entries in the order of the plane
+   *   IDs (`0` for planes not in the detector)
+   * * `FirstChannels`: a `std::array` like `WireCounts` with the channel of
+   *   the first wire of each plane (`raw::InvalidChannelID` for planes not in
+   *   the detector)
+   * * `ChannelOrder`: a `std::array` of the indices of the planes in the
+   *   detector, sorted by their first channel
+   *
+   * A layout is meant for a detector that never changes. Whether it still
+   * describes a geometry can be checked with `matches()`, and
+   * `geo::FixedChannelMapFallback` uses the geometry when it does not.
+   */
+  template <typename Layout>
+  class FixedChannelMap {
+
+  public:
+    using Layout_t = Layout; ///< Type of the detector layout.
+
+    /// Number of entries of the plane tables.
+    static constexpr std::size_t NPlaneSlots =
+      std::size_t{Layout_t::NCryostats} * Layout_t::MaxTPCs * Layout_t::MaxPlanes;
+
+    static_assert(Layout_t::WireCounts.size() == NPlaneSlots);
+    static_assert(Layout_t::FirstChannels.size() == NPlaneSlots);
+    static_assert(Layout_t::ChannelOrder.size() <= NPlaneSlots);
+
+    /// Returns the number of channels in the detector.
+    static constexpr unsigned int Nchannels() { return Layout_t::NChannels; }
+
+    /// Returns the number of wires in `planeID` (`0` if not in the detector).
+    static constexpr unsigned int Nwires(geo::PlaneID const& planeID)
+    {
+      std::size_t const slot = planeSlot(planeID);
+      return (slot < NPlaneSlots) ? Layout_t::WireCounts[slot] : 0U;
+    }
+
+    /**
+     * @brief Returns the channel reading the specified wire.
+     * @return the channel, or `raw::InvalidChannelID` if the wire is not in
+     *         the layout
+     */
+    static constexpr raw::ChannelID_t PlaneWireToChannel(geo::WireID const& wireID)
+    {
+      std::size_t const slot = planeSlot(wireID);
+      if ((slot >= NPlaneSlots) || (wireID.Wire >= Layout_t::WireCounts[slot]))
+        return raw::InvalidChannelID;
+      return Layout_t::FirstChannels[slot] + wireID.Wire;
+    }
+
+    /**
+     * @brief Returns the wire read by the specified channel.
+     * @return the wire, or an invalid wire ID if the channel is not in the
+     *         layout
+     */
+    static constexpr geo::WireID ChannelToWire(raw::ChannelID_t channel)
+    {
+      // binary search of the last plane starting at or before `channel`
+      std::size_t begin = 0U, end = Layout_t::ChannelOrder.size();
+      while (begin < end) {
+        std::size_t const middle = begin + (end - begin) / 2U;
+        if (Layout_t::FirstChannels[Layout_t::ChannelOrder[middle]] <= channel)
+          begin = middle + 1U;
+        else
+          end = middle;
+      }
+      if (begin == 0U) return {};
+      std::size_t const slot = Layout_t::ChannelOrder[begin - 1U];
+      raw::ChannelID_t const wire = channel - Layout_t::FirstChannels[slot];
+      if (wire >= Layout_t::WireCounts[slot]) return {};
+      return {slotPlane(slot), static_cast<geo::WireID::WireID_t>(wire)};
+    }
+
+    /**
+     * @brief Returns whether the layout describes the mapping of `geom`.
+     * @tparam Geom type of geometry (like `geo::GeometryCore`)
+     * @param geom the geometry to be compared
+     *
+     * The number of cryostats, TPCs, planes and wires, the first channel of
+     * each plane and the number of channels must all match.
+     */
+    template <typename Geom>
+    static bool matches(Geom const& geom);
+
+  private:
+    /// Returns the index of `planeID` in the tables, `NPlaneSlots` if none.
+    static constexpr std::size_t planeSlot(geo::PlaneID const& planeID)
+    {
+      if (!planeID.isValid || (planeID.Cryostat >= Layout_t::NCryostats) ||
+          (planeID.TPC >= Layout_t::MaxTPCs) || (planeID.Plane >= Layout_t::MaxPlanes))
+        return NPlaneSlots;
+      return (std::size_t{planeID.Cryostat} * Layout_t::MaxTPCs + planeID.TPC) *
+               Layout_t::MaxPlanes +
+             planeID.Plane;
+    }
+
+    /// Returns the ID of the plane at index `slot` of the tables.
+    static constexpr geo::PlaneID slotPlane(std::size_t slot)
+    {
+      return {static_cast<geo::PlaneID::CryostatID_t>(slot / Layout_t::MaxPlanes /
+                                                      Layout_t::MaxTPCs),
+              static_cast<geo::PlaneID::TPCID_t>(slot / Layout_t::MaxPlanes % Layout_t::MaxTPCs),
+              static_cast<geo::PlaneID::PlaneID_t>(slot % Layout_t::MaxPlanes)};
+    }
+
+  }; // class FixedChannelMap
+
+  /**
+   * @brief Channel mapping from a fixed layout, or from the geometry.
+   * @tparam Layout class describing the layout of the detector
+   * @tparam Geom type of geometry (like `geo::GeometryCore`)
+   *
+   * The mapping uses `geo::FixedChannelMap<Layout>` if the layout matches
+   * the geometry, and the geometry itself otherwise. Either way, invalid
+   * wires and channels are handled by the geometry (which usually throws).
+   */
+  template <typename Layout, typename Geom>
+  class FixedChannelMapFallback {
+  public:
+    using FixedMap_t = geo::FixedChannelMap<Layout>; ///< Type of the fixed map.
+
+    /// Checks the layout against `geom`, which must outlive this object.
+    explicit FixedChannelMapFallback(Geom const& geom)
+      : fGeom{&geom}, fUseFixed{FixedMap_t::matches(geom)}
+    {}
+
+    /// Returns whether the fixed layout is used.
+    bool usesFixedLayout() const { return fUseFixed; }
+
+    /// Returns the channel reading the specified wire.
+    raw::ChannelID_t PlaneWireToChannel(geo::WireID const& wireID) const
+    {
+      if (fUseFixed) {
+        raw::ChannelID_t const channel = FixedMap_t::PlaneWireToChannel(wireID);
+        if (channel != raw::InvalidChannelID) return channel;
+      }
+      return fGeom->PlaneWireToChannel(wireID);
+    }
+
+    /// Returns the (first) wire read by the specified channel.
+    geo::WireID ChannelToWire(raw::ChannelID_t channel) const
+    {
+      if (fUseFixed) {
+        geo::WireID const wireID = FixedMap_t::ChannelToWire(channel);
+        if (wireID.isValid) return wireID;
+      }
+      return fGeom->ChannelToWire(channel).front();
+    }
+
+  private:
+    Geom const* fGeom; ///< The geometry used when the layout does not match.
+    bool fUseFixed;    ///< Whether the fixed layout matches the geometry.
+  }; // class FixedChannelMapFallback
+
+  /**
+   * @brief Writes the C++ definition of the layout of `geom`.
+   * @tparam Geom type of geometry (like `geo::GeometryCore`)
+   * @param out the stream to write the definition into
+   * @param geom the geometry to describe
+   * @param name name of the layout class
+   *
+   * The output is a header defining the class `name`, to be used as
+   * `geo::FixedChannelMap<name>`. It is meant to be generated once from the
+   * geometry of the detector and compiled into the code using it.
+   */
+  template <typename Geom>
+  void writeFixedChannelLayout(std::ostream& out, Geom const& geom, std::string const& name);
+
+} // namespace geo
+
+//------------------------------------------------------------------------------
+//--- template implementation
+//------------------------------------------------------------------------------
+template <typename Layout>
+template <typename Geom>
+bool geo::FixedChannelMap<Layout>::matches(Geom const& geom)
+{
+  if (geom.Ncryostats() != Layout_t::NCryostats) return false;
+  if (geom.Nchannels() != Layout_t::NChannels) return false;
+  std::size_t nPlanes = 0U;
+  for (std::size_t slot = 0; slot < NPlaneSlots; ++slot) {
+    geo::PlaneID const planeID = slotPlane(slot);
+    bool const hasPlane = (planeID.TPC < geom.NTPC(planeID.asCryostatID())) &&
+                          (planeID.Plane < geom.Nplanes(planeID.asTPCID()));
+    if (!hasPlane) {
+      if (Layout_t::WireCounts[slot] != 0U) return false;
+      continue;
+    }
+    ++nPlanes;
+    if (geom.Nwires(planeID) != Layout_t::WireCounts[slot]) return false;
+    if (geom.PlaneWireToChannel(geo::WireID{planeID, 0}) != Layout_t::FirstChannels[slot])
+      return false;
+  } // for
+  if (nPlanes != Layout_t::ChannelOrder.size()) return false;
+
+  // the tables can't hold TPCs or planes beyond their sizes
+  for (unsigned int c = 0; c < Layout_t::NCryostats; ++c) {
+    geo::CryostatID const cryoID{c};
+    unsigned int const nTPCs = geom.NTPC(cryoID);
+    if (nTPCs > Layout_t::MaxTPCs) return false;
+    for (unsigned int t = 0; t < nTPCs; ++t)
+      if (geom.Nplanes(geo::TPCID{cryoID, t}) > Layout_t::MaxPlanes) return false;
+  }
+  return true;
+} // geo::FixedChannelMap<>::matches()
+
+//------------------------------------------------------------------------------
+template <typename Geom>
+void geo::writeFixedChannelLayout(std::ostream& out, Geom const& geom, std::string const& name)
+{
+  unsigned int const nCryostats = geom.Ncryostats();
+  unsigned int maxTPCs = 0U, maxPlanes = 0U;
+  for (unsigned int c = 0; c < nCryostats; ++c) {
+    geo::CryostatID const cryoID{c};
+    unsigned int const nTPCs = geom.NTPC(cryoID);
+    if (nTPCs > maxTPCs) maxTPCs = nTPCs;
+    for (unsigned int t = 0; t < nTPCs; ++t) {
+      unsigned int const nPlanes = geom.Nplanes(geo::TPCID{cryoID, t});
+      if (nPlanes > maxPlanes) maxPlanes = nPlanes;
+    }
+  } // for cryostats
+
+  std::size_t const nSlots = std::size_t{nCryostats} * maxTPCs * maxPlanes;
+  std::vector<unsigned int> wireCounts(nSlots, 0U);
+  std::vector<raw::ChannelID_t> firstChannels(nSlots, raw::InvalidChannelID);
+  std::vector<std::size_t> order;
+  for (unsigned int c = 0; c < nCryostats; ++c) {
+    geo::CryostatID const cryoID{c};
+    unsigned int const nTPCs = geom.NTPC(cryoID);
+    for (unsigned int t = 0; t < nTPCs; ++t) {
+      geo::TPCID const tpcID{cryoID, t};
+      unsigned int const nPlanes = geom.Nplanes(tpcID);
+      for (unsigned int p = 0; p < nPlanes; ++p) {
+        geo::PlaneID const planeID{tpcID, p};
+        std::size_t const slot = (std::size_t{c} * maxTPCs + t) * maxPlanes + p;
+        wireCounts[slot] = geom.Nwires(planeID);
+        firstChannels[slot] = geom.PlaneWireToChannel(geo::WireID{planeID, 0});
+        order.push_back(slot);
+      } // for planes
+    }   // for TPCs
+  }     // for cryostats
+  std::sort(order.begin(), order.end(), [&firstChannels](std::size_t a, std::size_t b) {
+    return firstChannels[a] < firstChannels[b];
+  });
+
+  auto const writeTable = [&out](auto const& table) {
+    for (std::size_t i = 0; i < table.size(); ++i)
+      out << ((i % 8U == 0U) ? "\n    " : " ") << table[i] << "U,";
+    out << "\n  }};\n";
+  };
+
+  out << "// generated by geo::writeFixedChannelLayout() from the detector geometry;"
+         "\n// regenerate it instead of editing it."
+         "\n#include \"larcorealg/Geometry/FixedChannelMap.h\""
+         "\n"
+         "\nstruct "
+      << name << " {"
+      << "\n  static constexpr unsigned int NCryostats = " << nCryostats << "U;"
+      << "\n  static constexpr unsigned int MaxTPCs = " << maxTPCs << "U;"
+      << "\n  static constexpr unsigned int MaxPlanes = " << maxPlanes << "U;"
+      << "\n  static constexpr unsigned int NChannels = " << geom.Nchannels() << "U;"
+      << "\n  static constexpr std::array<unsigned int, " << nSlots << "U> WireCounts{{";
+  writeTable(wireCounts);
+  out << "  static constexpr std::array<raw::ChannelID_t, " << nSlots << "U> FirstChannels{{";
+  writeTable(firstChannels);
+  out << "  static constexpr std::array<std::size_t, " << order.size() << "U> ChannelOrder{{";
+  writeTable(order);
+  out << "}; // struct " << name << "\n";
+} // geo::writeFixedChannelLayout()
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREALG_GEOMETRY_FIXEDCHANNELMAP_H
@@ -0,0 +1,315 @@
+/**
+ * @file   larcorealg/Geometry/GeoIDdataAccumulators.h
+ * @brief  Containers accumulating one datum per geometry element from many threads.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/GeometryDataContainers.h`
+ * @ingroup Geometry
+ *
+ * This is a header-only library.
+ */
+
+#ifndef LARCOREALG_GEOMETRY_GEOIDDATAACCUMULATORS_H
+#define LARCOREALG_GEOMETRY_GEOIDDATAACCUMULATORS_H
+
+// LArSoft libraries
+#include "larcorealg/Geometry/GeometryDataContainers.h"
+#include "larcorealg/Geometry/GeometryIDmapper.h"
+#include "larcorealg/Geometry/TaskRunner.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::copy(), std::max(), std::min()
+#include <atomic>
+#include <cassert>
+#include <cstddef>    // std::size_t
+#include <functional> // std::plus<>
+#include <initializer_list>
+#include <iterator> // std::next()
+#include <memory>   // std::unique_ptr<>
+#include <type_traits>
+#include <utility> // std::move()
+#include <vector>
+
+namespace geo {
+
+  template <typename T, typename Mapper>
+  class AtomicGeoIDdataAccumulator;
+
+  template <typename T, typename Mapper, typename Combine = std::plus<>>
+  class ShardedGeoIDdataAccumulator;
+
+  /// Accumulator of arithmetic data per TPC, with atomic updates.
+  template <typename T>
+  using AtomicTPCDataAccumulator = AtomicGeoIDdataAccumulator<T, geo::TPCIDmapper<>>;
+
+  /// Accumulator of arithmetic data per plane, with atomic updates.
+  template <typename T>
+  using AtomicPlaneDataAccumulator = AtomicGeoIDdataAccumulator<T, geo::PlaneIDmapper<>>;
+
+  /// Accumulator of data per TPC, with one copy of the data per task.
+  template <typename T, typename Combine = std::plus<>>
+  using ShardedTPCDataAccumulator = ShardedGeoIDdataAccumulator<T, geo::TPCIDmapper<>, Combine>;
+
+  /// Accumulator of data per plane, with one copy of the data per task.
+  template <typename T, typename Combine = std::plus<>>
+  using ShardedPlaneDataAccumulator =
+    ShardedGeoIDdataAccumulator<T, geo::PlaneIDmapper<>, Combine>;
+
+} // namespace geo
+
+//------------------------------------------------------------------------------
+/**
+ * @brief Container of one arithmetic datum per geometry element, updated atomically.
+ * @tparam T type of the contained datum (an arithmetic type)
+ * @tparam Mapper type of mapping between IDs and index
+ * @see `geo::ShardedGeoIDdataAccumulator`, `geo::AtomicPlaneDataAccumulator`
+ *
+ * Each element is a `std::atomic<T>`, and `add()` can be called concurrently
+ * from any thread with no lock. The updates use relaxed memory ordering: the
+ * sums are complete only after all the threads adding to them have been
+ * joined (or otherwise synchronized). Then `reduce()` copies them into a
+ * regular `geo::GeoIDdataContainer`:
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * geo::AtomicPlaneDataAccumulator<double> charge{ nCryo, nTPCs, nPlanes };
+ * runner(hits.size(), [&](std::size_t i)
+ *   { charge.add(hits[i].WireID().planeID(), hits[i].Integral()); });
+ * auto const chargePerPlane = charge.reduce();
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Integral types use `fetch_add()`; floating point types a compare-and-swap
+ * loop, which gets slower when many threads add to the same element: in that
+ * case `geo::ShardedGeoIDdataAccumulator` scales better.
+ */
+template <typename T, typename Mapper>
+class geo::AtomicGeoIDdataAccumulator {
+
+  static_assert(std::is_arithmetic_v<T>, "AtomicGeoIDdataAccumulator requires an arithmetic type");
+
+public:
+  using Mapper_t = Mapper;              ///< Type of mapper between IDs and index.
+  using ID_t = typename Mapper_t::ID_t; ///< Type used as ID for this container.
+  using value_type = T;                 ///< Type of the accumulated data.
+  using size_type = std::size_t;        ///< Type of container size.
+
+  /// Type of the regular container the data is reduced into.
+  using Container_t = geo::GeoIDdataContainer<T, Mapper>;
+
+  /// Constructor: accumulators for all elements of `dims` dimensions, at `0`.
+  AtomicGeoIDdataAccumulator(std::initializer_list<unsigned int> dims)
+    : AtomicGeoIDdataAccumulator(Mapper_t(dims))
+  {}
+
+  /// Constructor: accumulators for all elements of `mapper`, at `0`.
+  explicit AtomicGeoIDdataAccumulator(Mapper_t mapper)
+    : fMapper(std::move(mapper)), fData(new std::atomic<T>[fMapper.size()])
+  {
+    reset();
+  }
+
+  /// Returns the number of elements in the container.
+  size_type size() const { return fMapper.size(); }
+
+  /// Returns the mapper object used to convert ID's and container positions.
+  Mapper_t const& mapper() const { return fMapper; }
+
+  /// Returns whether this container hosts data for the specified ID.
+  template <typename GeoID>
+  bool hasElement(GeoID const& id) const
+  {
+    return mapper().template hasElement<GeoID>(id);
+  }
+
+  /// Adds `value` to the element `id` (thread-safe).
+  void add(ID_t const& id, T value) { addAtomic(fData[fMapper.index(id)], value); }
+
+  /// Returns the current value of the element `id`.
+  T load(ID_t const& id) const { return fData[fMapper.index(id)].load(std::memory_order_relaxed); }
+
+  /// Sets all the elements to `0` (not thread-safe).
+  void reset()
+  {
+    for (size_type i = 0; i < size(); ++i)
+      fData[i].store(T{0}, std::memory_order_relaxed);
+  }
+
+  /// Returns a regular container with the current values (not thread-safe).
+  Container_t reduce() const
+  {
+    Container_t result(fMapper);
+    reduceInto(result);
+    return result;
+  }
+
+  /**
+   * @brief Copies the current values into `dest`.
+   * @param dest the container to be filled; it must have the same size
+   *
+   * This must not run concurrently with `add()`.
+   * A `geo::PlaneDataContainer` can be filled from a plane accumulator.
+   */
+  template <typename Alloc>
+  void reduceInto(geo::GeoIDdataContainer<T, Mapper, Alloc>& dest) const
+  {
+    assert(dest.size() == size());
+    std::size_t i = 0;
+    for (T& value : dest)
+      value = fData[i++].load(std::memory_order_relaxed);
+  }
+
+private:
+  Mapper_t fMapper;                        ///< Mapping of IDs to indices.
+  std::unique_ptr<std::atomic<T>[]> fData; ///< Accumulators.
+
+  /// Adds `value` to `target`.
+  static void addAtomic(std::atomic<T>& target, T value)
+  {
+    if constexpr (std::is_integral_v<T>)
+      target.fetch_add(value, std::memory_order_relaxed);
+    else {
+      T old = target.load(std::memory_order_relaxed);
+      while (!target.compare_exchange_weak(old, old + value, std::memory_order_relaxed)) {}
+    }
+  }
+
+}; // class geo::AtomicGeoIDdataAccumulator<>
+
+//------------------------------------------------------------------------------
+/**
+ * @brief Container of one datum per geometry element, with a copy per task.
+ * @tparam T type of the contained datum
+ * @tparam Mapper type of mapping between IDs and index
+ * @tparam Combine type of binary operation merging two data (`std::plus<>`)
+ * @see `geo::AtomicGeoIDdataAccumulator`, `geo::ShardedPlaneDataAccumulator`
+ *
+ * The accumulator holds a number of "shards", each one a full
+ * `geo::GeoIDdataContainer` with its own copy of the data. Each task fills
+ * only its shard, choosing it by an index no other running task uses (e.g. the
+ * task index of `geo::runTasks()`, or the thread index of the task arena), with
+ * no synchronization at all. `reduce()` merges all the shards, element by
+ * element, with `Combine`, which for the sums is just `+`:
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * geo::ShardedPlaneDataAccumulator<unsigned int> hitCount{
+ *   nTasks, { nCryo, nTPCs, nPlanes } };
+ * geo::runTasks(runner, nTasks, [&](std::size_t iTask)
+ *   {
+ *     auto& counts = hitCount.shard(iTask);
+ *     for (recob::Hit const& hit: hitsOfTask(iTask))
+ *       ++counts[hit.WireID().planeID()];
+ *   });
+ * auto const hitsPerPlane = hitCount.reduce(runner);
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * `T` can be any type with a `Combine` operation, not only arithmetic types
+ * (e.g. a structure with a sum and a count, with its own combination).
+ * The memory is the one of a regular container times the number of shards.
+ */
+template <typename T, typename Mapper, typename Combine /* = std::plus<> */>
+class geo::ShardedGeoIDdataAccumulator {
+
+public:
+  using Mapper_t = Mapper;              ///< Type of mapper between IDs and index.
+  using ID_t = typename Mapper_t::ID_t; ///< Type used as ID for this container.
+  using value_type = T;                 ///< Type of the accumulated data.
+  using size_type = std::size_t;        ///< Type of container size.
+
+  /// Type of each shard, and of the reduced container.
+  using Container_t = geo::GeoIDdataContainer<T, Mapper>;
+
+  /**
+   * @brief Constructor: `nShards` copies of the data for elements of `dims`.
+   * @param nShards number of shards
+   * @param dims number of elements on all levels of the container
+   * @param init the initial value of all elements of each shard
+   * @param combine the operation merging the values of two shards
+   *
+   * The initial value `init` should be the neutral element of `combine`
+   * (like `0` for a sum), since it is combined once per shard.
+   */
+  ShardedGeoIDdataAccumulator(size_type nShards,
+                              std::initializer_list<unsigned int> dims,
+                              T const& init = T{},
+                              Combine combine = Combine{})
+    : ShardedGeoIDdataAccumulator(nShards, Mapper_t(dims), init, std::move(combine))
+  {}
+
+  /// Constructor: `nShards` copies of the data for the elements of `mapper`.
+  ShardedGeoIDdataAccumulator(size_type nShards,
+                              Mapper_t const& mapper,
+                              T const& init = T{},
+                              Combine combine = Combine{})
+    : fShards(std::max<size_type>(nShards, 1U), Container_t(mapper, init))
+    , fInit(init)
+    , fCombine(std::move(combine))
+  {}
+
+  /// Returns the number of shards.
+  size_type nShards() const { return fShards.size(); }
+
+  /// Returns the number of elements in each shard.
+  size_type size() const { return fShards.front().size(); }
+
+  /// Returns the mapper object used to convert ID's and container positions.
+  Mapper_t const& mapper() const { return fShards.front().mapper(); }
+
+  /// Returns the shard number `iShard`, to be used by one task at a time.
+  Container_t& shard(size_type iShard) { return fShards[iShard]; }
+
+  /// Returns the shard number `iShard` (read-only).
+  Container_t const& shard(size_type iShard) const { return fShards[iShard]; }
+
+  /// Merges `value` into the element `id` of the shard `iShard`.
+  void add(size_type iShard, ID_t const& id, T const& value)
+  {
+    T& target = fShards[iShard][id];
+    target = fCombine(target, value);
+  }
+
+  /// Sets all the elements of all shards to the initial value.
+  void reset()
+  {
+    for (Container_t& shard : fShards)
+      shard.fill(fInit);
+  }
+
+  /// Returns a container with the shards merged (not thread-safe).
+  Container_t reduce(geo::TaskRunner_t const& runner = {}) const
+  {
+    Container_t result(mapper());
+    reduceInto(result, runner);
+    return result;
+  }
+
+  /**
+   * @brief Merges all the shards into `dest`.
+   * @param dest the container to be filled; it must have the same size
+   * @param runner the executor splitting the work in blocks of elements
+   *
+   * This must not run concurrently with the filling of the shards.
+   */
+  template <typename Alloc>
+  void reduceInto(geo::GeoIDdataContainer<T, Mapper, Alloc>& dest,
+                  geo::TaskRunner_t const& runner = {}) const
+  {
+    assert(dest.size() == size());
+    size_type const n = size();
+    size_type const nTasks = std::min<size_type>(n, geo::details::MaxApplyTasks);
+    geo::runTasks(runner, nTasks, [this, &dest, n, nTasks](std::size_t iTask) {
+      size_type const begin = (n * iTask) / nTasks;
+      size_type const end = (n * (iTask + 1)) / nTasks;
+      auto const out = dest.begin() + begin;
+      std::copy(fShards.front().begin() + begin, fShards.front().begin() + end, out);
+      for (auto iShard = std::next(fShards.begin()); iShard != fShards.end(); ++iShard) {
+        auto in = iShard->begin() + begin;
+        for (auto it = out; it != out + (end - begin); ++it, ++in)
+          *it = fCombine(*it, *in);
+      }
+    });
+  }
+
+private:
+  std::vector<Container_t> fShards; ///< One container per shard.
+  T fInit;                          ///< Initial value of the elements.
+  Combine fCombine;                 ///< Operation merging two values.
+
+}; // class geo::ShardedGeoIDdataAccumulator<>
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREALG_GEOMETRY_GEOIDDATAACCUMULATORS_H
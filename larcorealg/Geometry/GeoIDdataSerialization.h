@@ -0,0 +1,278 @@
+/**
+ * @file   larcorealg/Geometry/GeoIDdataSerialization.h
+ * @brief  Binary input and output of geometry and readout data containers.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/GeometryDataContainers.h`,
+ *         `larcorealg/Geometry/MappedGeoIDdataContainer.h`
+ * @ingroup Geometry
+ *
+ * This is a header-only library.
+ *
+ * The functions `geo::writeGeoIDdata()` and `geo::readGeoIDdata()` transfer
+ * a `geo::GeoIDdataContainer` (or any container deriving from it, like
+ * `geo::PlaneDataContainer` and `readout::ROPDataContainer`) of trivially
+ * copyable data with a single block of a 64-byte header followed by the flat
+ * storage of the container:
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * readout::ROPDataContainer<ROPSummary> summaries = ...;
+ * std::ofstream out{ "summaries.dat", std::ios::binary };
+ * geo::writeGeoIDdata(out, summaries);
+ *
+ * readout::ROPDataContainer<ROPSummary> restored;
+ * std::ifstream in{ "summaries.dat", std::ios::binary };
+ * geo::readGeoIDdata(in, restored); // resized as needed
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * The header stores a format version, the dimensions of the mapper and the
+ * size and alignment of the elements, which are checked on reading.
+ * The data is written in the byte order of the writer, which the header
+ * records: the header is always converted on reading, and so are the
+ * elements if they are of an arithmetic type. Other element types (like
+ * structures) can't be converted, and in that case reading fails.
+ *
+ * The same format is used for the files of `geo::MappedGeoIDdataContainer`.
+ */
+
+#ifndef LARCOREALG_GEOMETRY_GEOIDDATASERIALIZATION_H
+#define LARCOREALG_GEOMETRY_GEOIDDATASERIALIZATION_H
+
+// LArSoft libraries
+#include "larcorealg/Geometry/GeometryDataContainers.h"
+
+// framework libraries
+#include "cetlib_except/exception.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::reverse()
+#include <cstddef>   // std::size_t, std::byte
+#include <cstdint>   // std::uint32_t, std::uint64_t
+#include <cstring>   // std::memcpy(), std::memcmp()
+#include <istream>
+#include <memory> // std::addressof()
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility> // std::index_sequence
+
+namespace geo {
+
+  template <typename T, typename Mapper, typename Allocator>
+  void writeGeoIDdata(std::ostream& out,
+                      geo::GeoIDdataContainer<T, Mapper, Allocator> const& data);
+
+  template <typename T, typename Mapper, typename Allocator>
+  void readGeoIDdata(std::istream& in, geo::GeoIDdataContainer<T, Mapper, Allocator>& data);
+
+  namespace details {
+
+    /**
+     * @brief Header of the binary format of geometry data containers.
+     *
+     * The header is followed by the data elements, starting at `dataOffset`
+     * bytes from the start of the header, in the order of the mapper.
+     * All fields are in the byte order of the writer, which is recognised by the
+     * value of `byteOrder`.
+     */
+    struct GeoIDdataHeader {
+
+      static constexpr char Magic[8] = {'L', 'A', 'r', 'G', 'e', 'o', 'I', 'D'};
+      static constexpr std::uint32_t Version = 1U;
+      static constexpr std::uint32_t ByteOrder = 0x01020304U;
+      static constexpr std::uint32_t SwappedByteOrder = 0x04030201U;
+      static constexpr std::size_t MaxDimensions = 4U;
+
+      char magic[8];                         ///< Identifier of the file format.
+      std::uint32_t version;                 ///< Version of the file format.
+      std::uint32_t byteOrder;               ///< Written as `ByteOrder`.
+      std::uint32_t dimensions;              ///< Number of levels of the mapping.
+      std::uint32_t dimSizes[MaxDimensions]; ///< Size of each level of the mapping.
+      std::uint32_t elementSize;             ///< Size of each element, in bytes.
+      std::uint32_t elementAlignment;        ///< Alignment of the element type.
+      std::uint32_t reserved;                ///< Unused, always `0`.
+      std::uint64_t nElements;               ///< Number of elements.
+      std::uint64_t dataOffset;              ///< Position of the first element.
+
+    }; // GeoIDdataHeader
+
+    static_assert(sizeof(GeoIDdataHeader) == 64U);
+    static_assert(std::is_trivially_copyable_v<GeoIDdataHeader>);
+
+    /// Writes the dimensions of `mapper` into `header`.
+    template <typename Mapper, std::size_t... Levels>
+    void fillGeoIDdataDimensions(GeoIDdataHeader& header,
+                                 Mapper const& mapper,
+                                 std::index_sequence<Levels...>)
+    {
+      header.dimensions = sizeof...(Levels);
+      ((header.dimSizes[Levels] = mapper.template dimSize<Levels>()), ...);
+    }
+
+    /// Returns the header describing a container of `T` with `mapper`.
+    template <typename T, typename Mapper>
+    GeoIDdataHeader makeGeoIDdataHeader(Mapper const& mapper)
+    {
+      constexpr unsigned int NDims = Mapper::dimensions();
+      static_assert(NDims <= GeoIDdataHeader::MaxDimensions);
+
+      GeoIDdataHeader header{}; // all zeroes, including padding
+      std::memcpy(header.magic, GeoIDdataHeader::Magic, sizeof(GeoIDdataHeader::Magic));
+      header.version = GeoIDdataHeader::Version;
+      header.byteOrder = GeoIDdataHeader::ByteOrder;
+      fillGeoIDdataDimensions(header, mapper, std::make_index_sequence<NDims>{});
+      header.elementSize = sizeof(T);
+      header.elementAlignment = alignof(T);
+      header.nElements = mapper.size();
+      header.dataOffset = sizeof(GeoIDdataHeader);
+      return header;
+    } // makeGeoIDdataHeader()
+
+    /// Reverses the byte order of the object `value`.
+    template <typename T>
+    void reverseBytes(T& value)
+    {
+      auto* const bytes = reinterpret_cast<std::byte*>(std::addressof(value));
+      std::reverse(bytes, bytes + sizeof(T));
+    }
+
+    /// Reverses the byte order of all the fields of `header`.
+    inline void reverseBytes(GeoIDdataHeader& header)
+    {
+      reverseBytes(header.version);
+      reverseBytes(header.byteOrder);
+      reverseBytes(header.dimensions);
+      for (std::uint32_t& size : header.dimSizes)
+        reverseBytes(size);
+      reverseBytes(header.elementSize);
+      reverseBytes(header.elementAlignment);
+      reverseBytes(header.nElements);
+      reverseBytes(header.dataOffset);
+    } // reverseBytes(GeoIDdataHeader)
+
+    /**
+     * @brief Checks that `header` describes data of `T` with `NDims` dimensions.
+     * @return a description of the problem, empty if there is none
+     *
+     * The byte order and the number of elements are not checked.
+     */
+    template <typename T, unsigned int NDims>
+    std::string checkGeoIDdataHeader(GeoIDdataHeader const& header)
+    {
+      std::ostringstream problem;
+      if (std::memcmp(header.magic, GeoIDdataHeader::Magic, sizeof(GeoIDdataHeader::Magic)) != 0)
+        problem << "not geometry data";
+      else if (header.version != GeoIDdataHeader::Version)
+        problem << "format version " << header.version << " not supported";
+      else if (header.dimensions != NDims)
+        problem << "data has " << header.dimensions << " dimensions, " << NDims << " expected";
+      else if ((header.elementSize != sizeof(T)) || (header.elementAlignment != alignof(T))) {
+        problem << "elements have size " << header.elementSize << " and alignment "
+                << header.elementAlignment << ", " << sizeof(T) << " and " << alignof(T)
+                << " expected";
+      }
+      return problem.str();
+    } // checkGeoIDdataHeader()
+
+    /// Resizes `data` to the dimensions in `header`.
+    template <typename T, typename Mapper, typename Allocator, std::size_t... Levels>
+    void resizeAsHeader(geo::GeoIDdataContainer<T, Mapper, Allocator>& data,
+                        GeoIDdataHeader const& header,
+                        std::index_sequence<Levels...>)
+    {
+      data.resize({header.dimSizes[Levels]...});
+    }
+
+  } // namespace details
+
+} // namespace geo
+
+//------------------------------------------------------------------------------
+//--- template implementation
+//------------------------------------------------------------------------------
+/**
+ * @brief Writes the content of a container in binary format.
+ * @param out the stream to write into (should be in binary mode)
+ * @param data the container to be written
+ * @throw cet::exception (category: `"GeoIDdataSerialization"`) on failure
+ * @see `geo::readGeoIDdata()`
+ */
+template <typename T, typename Mapper, typename Allocator>
+void geo::writeGeoIDdata(std::ostream& out,
+                         geo::GeoIDdataContainer<T, Mapper, Allocator> const& data)
+{
+  static_assert(std::is_trivially_copyable_v<T>,
+                "writeGeoIDdata() requires a trivially copyable type");
+
+  details::GeoIDdataHeader const header = details::makeGeoIDdataHeader<T>(data.mapper());
+  out.write(reinterpret_cast<char const*>(&header), sizeof(header));
+  if (!data.empty()) {
+    out.write(reinterpret_cast<char const*>(std::addressof(data.first())),
+              data.size() * sizeof(T));
+  }
+  if (!out) {
+    throw cet::exception("GeoIDdataSerialization")
+      << "Failed writing " << data.size() << " elements of geometry data.\n";
+  }
+} // geo::writeGeoIDdata()
+
+//------------------------------------------------------------------------------
+/**
+ * @brief Reads the content of a container written by `geo::writeGeoIDdata()`.
+ * @param in the stream to read from (should be in binary mode)
+ * @param data the container to be filled (resized to the stored dimensions)
+ * @throw cet::exception (category: `"GeoIDdataSerialization"`) if the data
+ *        can't be read or does not match the container
+ *
+ * The content of `data` is unspecified after a failure.
+ */
+template <typename T, typename Mapper, typename Allocator>
+void geo::readGeoIDdata(std::istream& in, geo::GeoIDdataContainer<T, Mapper, Allocator>& data)
+{
+  static_assert(std::is_trivially_copyable_v<T>,
+                "readGeoIDdata() requires a trivially copyable type");
+  using Header_t = details::GeoIDdataHeader;
+  constexpr unsigned int NDims = Mapper::dimensions();
+
+  Header_t header;
+  if (!in.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+    throw cet::exception("GeoIDdataSerialization") << "Can't read the geometry data header.\n";
+  }
+  bool const swapped = (header.byteOrder == Header_t::SwappedByteOrder);
+  if (swapped) {
+    details::reverseBytes(header);
+    if (!std::is_arithmetic_v<T> && (sizeof(T) > 1U)) {
+      throw cet::exception("GeoIDdataSerialization")
+        << "Geometry data was written with another byte order, and can't be converted.\n";
+    }
+  }
+  else if (header.byteOrder != Header_t::ByteOrder)
+    throw cet::exception("GeoIDdataSerialization") << "Corrupted geometry data header.\n";
+
+  if (std::string const problem = details::checkGeoIDdataHeader<T, NDims>(header);
+      !problem.empty()) {
+    throw cet::exception("GeoIDdataSerialization") << "Geometry data: " << problem << ".\n";
+  }
+  if (header.dataOffset < sizeof(Header_t))
+    throw cet::exception("GeoIDdataSerialization") << "Corrupted geometry data header.\n";
+  in.ignore(header.dataOffset - sizeof(Header_t));
+
+  details::resizeAsHeader(data, header, std::make_index_sequence<NDims>{});
+  if (header.nElements != data.size()) {
+    throw cet::exception("GeoIDdataSerialization")
+      << "Geometry data has " << header.nElements << " elements, " << data.size()
+      << " expected from its dimensions.\n";
+  }
+  if (!data.empty() && !in.read(reinterpret_cast<char*>(std::addressof(data.first())),
+                                data.size() * sizeof(T))) {
+    throw cet::exception("GeoIDdataSerialization")
+      << "Geometry data is truncated (" << (in.gcount() / sizeof(T)) << " of " << data.size()
+      << " elements).\n";
+  }
+  if (swapped) {
+    for (T& value : data)
+      details::reverseBytes(value);
+  }
+} // geo::readGeoIDdata()
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREALG_GEOMETRY_GEOIDDATASERIALIZATION_H
@@ -0,0 +1,256 @@
+/**
+ * @file   larcorealg/Geometry/GeoIDpacker.h
+ * @brief  Reversible encoding of geometry IDs into 64-bit integral keys.
+ * @date   October 14, 2026
+ * @see    `geo::GeometryCore::makeGeoIDpacker()`
+ *
+ * This is a header only library.
+ */
+
+#ifndef LARCOREALG_GEOMETRY_GEOIDPACKER_H
+#define LARCOREALG_GEOMETRY_GEOIDPACKER_H
+
+// LArSoft libraries
+#include "larcorealg/CoreUtils/RadixSort.h"
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+
+// C/C++ standard libraries
+#include <array>
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint64_t
+#include <stdexcept> // std::length_error
+#include <type_traits>
+#include <vector>
+
+namespace geo {
+
+  /**
+   * @brief Encodes geometry IDs into integral keys, and back.
+   *
+   * A key packs the indices of all the levels of an ID (e.g. cryostat, TPC,
+   * plane and wire for a `geo::WireID`) in a single `std::uint64_t`, with a
+   * fixed number of bits for each level, the top level in the highest bits.
+   * Keys of IDs of the same type then compare like the IDs, and they are cheap
+   * to hash and can be sorted by radix (`geo::sortByPackedKey()`).
+   *
+   * The number of bits of each level is either the standard one
+   * (`standard()`: 12 bits for cryostats, 16 for TPCs, 8 for planes and 24
+   * for wires), which works on any detector, or the smallest one for the
+   * sizes of a specific geometry (see `geo::GeometryCore::makeGeoIDpacker()`),
+   * which makes for shorter keys and fewer radix sorting passes.
+   * An ID whose indices do not fit (`canPack()`) can't be packed reliably.
+   * Invalid IDs are all packed into `InvalidKey`.
+   *
+   * The packer works with any ID type with up to four levels, including the
+   * readout IDs (`readout::TPCsetID`, `readout::ROPID`).
+   */
+  class GeoIDpacker {
+  public:
+    using Key_t = std::uint64_t; ///< Type of the packed keys.
+
+    /// Maximum number of levels of the IDs supported.
+    static constexpr std::size_t MaxLevels = 4U;
+
+    /// Key of all the invalid IDs.
+    static constexpr Key_t InvalidKey = ~Key_t{0};
+
+    /**
+     * @brief Constructor: room for the specified number of elements per level.
+     * @param sizes number of elements at each level (e.g. cryostats, TPCs...)
+     * @throws std::length_error if the keys would not fit 63 bits
+     */
+    explicit GeoIDpacker(std::array<unsigned int, MaxLevels> const& sizes);
+
+    /// Returns the packer with the standard number of bits per level.
+    static GeoIDpacker standard() { return GeoIDpacker{BitsTag{}, {12U, 16U, 8U, 24U}}; }
+
+    /// Returns the number of bits used for the indices of `level`.
+    unsigned int bits(std::size_t level) const { return fBits[level]; }
+
+    /// Returns the number of bits in the keys of IDs of type `ID`.
+    template <typename ID>
+    unsigned int keyBits() const;
+
+    /// Returns whether all the indices of `id` fit their bits.
+    template <typename ID>
+    bool canPack(ID const& id) const;
+
+    /// Returns the key of `id` (`InvalidKey` if `id` is invalid).
+    template <typename ID>
+    Key_t pack(ID const& id) const;
+
+    /// Returns the ID of type `ID` with the specified `key`.
+    template <typename ID>
+    ID unpack(Key_t key) const;
+
+  private:
+    struct BitsTag {};
+
+    std::array<unsigned int, MaxLevels> fBits; ///< Bits of each level.
+
+    GeoIDpacker(BitsTag, std::array<unsigned int, MaxLevels> const& bits) : fBits{bits} {}
+
+    /// Returns the number of bits needed to store indices from `0` to `n - 1`.
+    static unsigned int bitsFor(unsigned int n);
+
+    template <std::size_t Level, typename ID>
+    Key_t packLevels(ID const& id) const;
+
+    template <std::size_t Level, typename ID>
+    void unpackLevels(ID& id, Key_t key) const;
+
+  }; // class GeoIDpacker
+
+  /**
+   * @brief Hash function of geometry IDs, from their standard packed key.
+   *
+   * This hasher makes geometry IDs (e.g. `geo::WireID`) direct keys of
+   * unordered containers:
+   * ~~~~{.cpp}
+   * std::unordered_map<geo::WireID, std::vector<Hit const*>, geo::GeoIDhash> hitsOnWire;
+   * ~~~~
+   */
+  struct GeoIDhash {
+    template <typename ID>
+    std::size_t operator()(ID const& id) const noexcept
+    {
+      // mix the bits (SplitMix64 finalizer): a key is mostly low bits
+      GeoIDpacker::Key_t key = GeoIDpacker::standard().pack(id);
+      key = (key ^ (key >> 30)) * 0xBF58476D1CE4E5B9ULL;
+      key = (key ^ (key >> 27)) * 0x94D049BB133111EBULL;
+      return static_cast<std::size_t>(key ^ (key >> 31));
+    }
+  }; // GeoIDhash
+
+  /**
+   * @brief Sorts `data` by the packed keys returned by `key`, in linear time.
+   * @tparam T type of the sorted elements
+   * @tparam KeyFn type of function returning the key of an element
+   * @param data the elements to be sorted
+   * @param key function returning the `geo::GeoIDpacker::Key_t` of an element
+   * @param nBits number of significant bits of the keys
+   *
+   * This is a stable radix sort (`util::radixSortByKey()`) on 8 bits per
+   * pass, with `nBits / 8` passes (rounded up): with `nBits` from
+   * `geo::GeoIDpacker::keyBits()`, hits can be sorted (and then bucketed) by
+   * wire without comparisons:
+   * ~~~~{.cpp}
+   * geo::GeoIDpacker const packer = geom.makeGeoIDpacker();
+   * geo::sortByPackedKey(
+   *   hits, [&packer](Hit const& hit) { return packer.pack(hit.WireID()); },
+   *   packer.keyBits<geo::WireID>());
+   * ~~~~
+   * Invalid IDs, and all keys with bits beyond `nBits`, are sorted by their
+   * `nBits` lowest bits only.
+   */
+  template <typename T, typename KeyFn>
+  void sortByPackedKey(std::vector<T>& data, KeyFn key, unsigned int nBits = 64U);
+
+} // namespace geo
+
+//------------------------------------------------------------------------------
+//--- inline implementation
+//------------------------------------------------------------------------------
+inline geo::GeoIDpacker::GeoIDpacker(std::array<unsigned int, MaxLevels> const& sizes)
+{
+  unsigned int total = 0U;
+  for (std::size_t level = 0; level < MaxLevels; ++level)
+    total += (fBits[level] = bitsFor(sizes[level]));
+  if (total > 63U) // one combination must stay free for `InvalidKey`
+    throw std::length_error("GeoIDpacker: the geometry IDs do not fit 63 bits");
+} // geo::GeoIDpacker::GeoIDpacker()
+
+//------------------------------------------------------------------------------
+inline unsigned int geo::GeoIDpacker::bitsFor(unsigned int n)
+{
+  unsigned int bits = 0U;
+  while ((bits < 32U) && ((std::uint64_t{1} << bits) < n))
+    ++bits;
+  return bits;
+} // geo::GeoIDpacker::bitsFor()
+
+//------------------------------------------------------------------------------
+//--- template implementation
+//------------------------------------------------------------------------------
+template <typename ID>
+unsigned int geo::GeoIDpacker::keyBits() const
+{
+  static_assert(ID::Level < MaxLevels, "GeoIDpacker supports only IDs up to 4 levels.");
+  unsigned int bits = 0U;
+  for (std::size_t level = 0; level <= ID::Level; ++level)
+    bits += fBits[level];
+  return bits;
+} // geo::GeoIDpacker::keyBits()
+
+//------------------------------------------------------------------------------
+template <typename ID>
+bool geo::GeoIDpacker::canPack(ID const& id) const
+{
+  bool fits = true;
+  auto const checkLevel = [this, &id, &fits](auto levelTag) {
+    constexpr std::size_t Level = decltype(levelTag)::value;
+    if constexpr (Level <= ID::Level)
+      fits &= (Key_t(id.template getIndex<Level>()) >> fBits[Level]) == 0U;
+  };
+  checkLevel(std::integral_constant<std::size_t, 0U>{});
+  checkLevel(std::integral_constant<std::size_t, 1U>{});
+  checkLevel(std::integral_constant<std::size_t, 2U>{});
+  checkLevel(std::integral_constant<std::size_t, 3U>{});
+  return fits;
+} // geo::GeoIDpacker::canPack()
+
+//------------------------------------------------------------------------------
+template <typename ID>
+auto geo::GeoIDpacker::pack(ID const& id) const -> Key_t
+{
+  static_assert(ID::Level < MaxLevels, "GeoIDpacker supports only IDs up to 4 levels.");
+  return id.isValid ? packLevels<ID::Level>(id) : InvalidKey;
+} // geo::GeoIDpacker::pack()
+
+//------------------------------------------------------------------------------
+template <typename ID>
+ID geo::GeoIDpacker::unpack(Key_t key) const
+{
+  static_assert(ID::Level < MaxLevels, "GeoIDpacker supports only IDs up to 4 levels.");
+  ID id;
+  if (key == InvalidKey) {
+    id.setValidity(false);
+    return id;
+  }
+  unpackLevels<ID::Level>(id, key);
+  id.setValidity(true);
+  return id;
+} // geo::GeoIDpacker::unpack()
+
+//------------------------------------------------------------------------------
+template <std::size_t Level, typename ID>
+auto geo::GeoIDpacker::packLevels(ID const& id) const -> Key_t
+{
+  Key_t const index = Key_t(id.template getIndex<Level>());
+  if constexpr (Level == 0U)
+    return index;
+  else
+    return (packLevels<(Level - 1U)>(id) << fBits[Level]) | index;
+} // geo::GeoIDpacker::packLevels()
+
+//------------------------------------------------------------------------------
+template <std::size_t Level, typename ID>
+void geo::GeoIDpacker::unpackLevels(ID& id, Key_t key) const
+{
+  using Index_t = std::decay_t<decltype(id.template writeIndex<Level>())>;
+  id.template writeIndex<Level>() = Index_t(key & ((Key_t{1} << fBits[Level]) - 1U));
+  if constexpr (Level > 0U) unpackLevels<(Level - 1U)>(id, key >> fBits[Level]);
+} // geo::GeoIDpacker::unpackLevels()
+
+//------------------------------------------------------------------------------
+template <typename T, typename KeyFn>
+void geo::sortByPackedKey(std::vector<T>& data, KeyFn key, unsigned int nBits /* = 64U */)
+{
+  util::radixSortByKey(
+    data.begin(), data.end(), [&key](T const& elem) -> GeoIDpacker::Key_t { return key(elem); },
+    nBits);
+} // geo::sortByPackedKey()
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREALG_GEOMETRY_GEOIDPACKER_H
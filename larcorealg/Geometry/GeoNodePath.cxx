@@ -12,6 +12,17 @@
 // ROOT libraries
 #include "TGeoNode.h"
 
+//------------------------------------------------------------------------------
+void geo::GeoNodePath::append(Node_t const& node)
+{
+  // same order of products as `geo::transformationFromPath()`
+  auto const nodeTrans =
+    geo::convertTransformationMatrix<geo::TransformationMatrix>(*(node.GetMatrix()));
+  fTransformations.push_back(fTransformations.empty() ? nodeTrans :
+                                                        fTransformations.back() * nodeTrans);
+  fNodes.push_back(&node);
+} // geo::GeoNodePath::append()
+
 //------------------------------------------------------------------------------
 geo::GeoNodePath::operator std::string() const
 {
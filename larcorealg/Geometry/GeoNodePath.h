@@ -12,6 +12,7 @@
 
 // LArSoft libraries
 #include "larcorealg/Geometry/LocalTransformation.h"
+#include "larcorealg/Geometry/TransformationMatrix.h"
 
 // ROOT libraries
 #include "TGeoNode.h"
@@ -20,6 +21,7 @@
 #include <cstddef> // std::size_t
 #include <initializer_list>
 #include <string>
+#include <type_traits> // std::is_same_v
 #include <vector>
 
 namespace geo {
@@ -33,6 +35,11 @@ namespace geo {
    * It behaves like a `stack` in that it inserts and removes elements at the
    * "top", which is also what defines the current node.
    *
+   * Next to each node, the path keeps the transformation from that node to the
+   * root frame, updated on `append()` and `pop()` with a single matrix product.
+   * The transformation of the current node is then available without going
+   * through the whole path, which matters when building detectors with
+   * hundreds of thousands of wires.
    */
   class GeoNodePath {
 
@@ -54,12 +61,17 @@ namespace geo {
     GeoNodePath() = default;
 
     /// Sets all the the specified nodes into the current path.
-    GeoNodePath(std::initializer_list<TGeoNode const*> nodes) : fNodes(nodes) {}
+    GeoNodePath(std::initializer_list<TGeoNode const*> nodes)
+      : GeoNodePath(nodes.begin(), nodes.end())
+    {}
 
     /// Sets the nodes from `begin` to `end` as the path content.
     template <typename Iter>
-    GeoNodePath(Iter begin, Iter end) : fNodes(begin, end)
-    {}
+    GeoNodePath(Iter begin, Iter end)
+    {
+      for (auto it = begin; it != end; ++it)
+        append(**it);
+    }
 
     // --- END Constructors and destructor -------------------------------------
 
@@ -77,13 +89,24 @@ namespace geo {
 
     // --- BEGIN Content management --------------------------------------------
     /// Adds a node to the current path.
-    void append(Node_t const& node) { fNodes.push_back(&node); }
+    void append(Node_t const& node);
 
     /// Removes the current node from the path, moving the current one up.
-    void pop() { fNodes.pop_back(); }
+    void pop()
+    {
+      fNodes.pop_back();
+      fTransformations.pop_back();
+    }
     // --- END Content management ----------------------------------------------
 
-    /// Returns the total transformation to the current node, as a `Matrix`.
+    /**
+     * @brief Returns the total transformation to the current node.
+     * @tparam Matrix type of the returned transformation
+     *
+     * For `geo::TransformationMatrix` the cached transformation is returned;
+     * other types are computed by chaining the transformations of all the
+     * nodes in the path.
+     */
     template <typename Matrix = TGeoHMatrix>
     Matrix currentTransformation() const;
 
@@ -93,6 +116,9 @@ namespace geo {
   private:
     Nodes_t fNodes; ///< Local path of pointers to ROOT geometry nodes.
 
+    /// Transformation from each node in the path to the root frame.
+    std::vector<geo::TransformationMatrix> fTransformations;
+
   }; // class GeoNodePath
 
 } // namespace geo
@@ -103,7 +129,10 @@ namespace geo {
 template <typename Matrix /* = TGeoHMatrix */>
 Matrix geo::GeoNodePath::currentTransformation() const
 {
-  return geo::transformationFromPath<Matrix>(fNodes.begin(), fNodes.end());
+  if constexpr (std::is_same_v<Matrix, geo::TransformationMatrix>)
+    return fTransformations.empty() ? Matrix{} : fTransformations.back();
+  else
+    return geo::transformationFromPath<Matrix>(fNodes.begin(), fNodes.end());
 } // geo::GeoNodePath::currentTransformation()
 
 //------------------------------------------------------------------------------
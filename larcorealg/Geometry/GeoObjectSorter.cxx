@@ -8,18 +8,21 @@
 #include "larcorealg/Geometry/GeoObjectSorter.h"
 #include "larcorealg/Geometry/OpDetGeo.h"
 
-#include <algorithm>
+#include <array>
 #include <vector>
 
 namespace geo {
 
-  static bool sortorderOpDets(const OpDetGeo& t1, const OpDetGeo& t2)
+  static std::array<double, 3> opDetKey(const OpDetGeo& opdet)
   {
-    double xyz1[3] = {0.}, xyz2[3] = {0.};
+    std::array<double, 3> xyz = {0.};
     double local[3] = {0.};
-    t1.LocalToWorld(local, xyz1);
-    t2.LocalToWorld(local, xyz2);
+    opdet.LocalToWorld(local, xyz.data());
+    return xyz;
+  }
 
+  static bool sortorderOpDets(std::array<double, 3> const& xyz1, std::array<double, 3> const& xyz2)
+  {
     if (xyz1[2] != xyz2[2])
       return xyz1[2] > xyz2[2];
     else if (xyz1[1] != xyz2[1])
@@ -30,6 +33,6 @@ namespace geo {
 
   void GeoObjectSorter::SortOpDets(std::vector<geo::OpDetGeo>& opdet) const
   {
-    std::sort(opdet.begin(), opdet.end(), sortorderOpDets);
+    geo::sortByKeys(opdet.begin(), opdet.end(), opDetKey, sortorderOpDets);
   }
 }
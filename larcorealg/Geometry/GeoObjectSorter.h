@@ -8,9 +8,16 @@
 #ifndef GEO_GEOOBJECTSORTER_H
 #define GEO_GEOOBJECTSORTER_H
 
+#include <algorithm> // std::min(), std::sort()
+#include <cstddef>   // std::size_t
+#include <iterator>  // std::distance()
+#include <type_traits>
+#include <utility> // std::pair, std::move()
 #include <vector>
 
+#include "larcorealg/CoreUtils/SortByPointers.h" // util::ApplyPermutation()
 #include "larcorealg/Geometry/AuxDetGeo.h"
+#include "larcorealg/Geometry/TaskRunner.h"
 #include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
 
 namespace geo {
@@ -21,6 +28,55 @@ namespace geo {
   class PlaneGeo;
   class WireGeo;
   class OpDetGeo;
+  /**
+   * @brief Sorts the range from `first` to `last` by keys computed only once.
+   * @param first random access iterator to the first object to sort
+   * @param last iterator past the last object to sort
+   * @param key function extracting the sorting key from an object
+   * @param comp comparison of two keys, as `std::sort()` wants
+   * @param runner if not empty, extracts the keys in parallel tasks
+   *
+   * The key of each object is extracted once, and then the keys are sorted
+   * together with their original position; the objects are finally moved in
+   * place to their sorted position (`util::ApplyPermutation()`).
+   * The result is the same as `std::sort(first, last, comp')` with `comp'`
+   * comparing the keys of two objects, at the cost of `N` key extractions
+   * instead of `O(N log N)`.
+   *
+   * Sorters deriving from `geo::GeoObjectSorter` are encouraged to sort this
+   * way when their keys are not trivial to compute.
+   */
+  template <typename Iter, typename KeyFn, typename Comp>
+  void sortByKeys(Iter first,
+                  Iter last,
+                  KeyFn key,
+                  Comp comp,
+                  geo::TaskRunner_t const& runner = {})
+  {
+    using Key_t = std::decay_t<decltype(key(*first))>;
+    using Entry_t = std::pair<Key_t, std::size_t>;
+
+    std::size_t const n = std::distance(first, last);
+    std::vector<Entry_t> entries(n);
+    constexpr std::size_t MaxTasks = 64;
+    std::size_t const nTasks = std::min(n, MaxTasks);
+    geo::runTasks(runner, nTasks, [first, n, nTasks, &key, &entries](std::size_t iTask) {
+      std::size_t const end = (n * (iTask + 1)) / nTasks;
+      for (std::size_t i = (n * iTask) / nTasks; i < end; ++i)
+        entries[i] = {key(first[i]), i};
+    });
+
+    std::sort(entries.begin(), entries.end(), [&comp](Entry_t const& a, Entry_t const& b) {
+      return comp(a.first, b.first);
+    });
+
+    std::vector<std::size_t> order;
+    order.reserve(n);
+    for (Entry_t const& entry : entries)
+      order.push_back(entry.second);
+    util::ApplyPermutation(first, std::move(order));
+  } // sortByKeys()
+
   /// @ingroup Geometry
   class GeoObjectSorter {
   public:
@@ -13,6 +13,12 @@
 #include "larcorealg/Geometry/TPCGeo.h"
 #include "larcorealg/Geometry/WireGeo.h"
 
+#include <array>
+#include <cmath>   // std::abs()
+#include <cstdlib> // atoi()
+#include <functional> // std::less<>
+#include <string>
+
 namespace {
 
   // Tolerance when comparing distances in geometry:
@@ -22,73 +28,54 @@ namespace {
 
 namespace geo {
 
+  // The keys of the objects are extracted only once per object (`geo::sortByKeys()`), and each
+  // comparison works on the keys.
+
   //----------------------------------------------------------------------------
-  // Define sort order for cryostats in standard configuration
-  static bool sortAuxDetStandard(const AuxDetGeo& ad1, const AuxDetGeo& ad2)
+  // Define sort order for auxiliary detectors in standard configuration
+  static int auxDetStandardKey(const AuxDetGeo& ad)
   {
     // sort based off of GDML name, assuming ordering is encoded
-    std::string const& ad1name = ad1.TotalVolume()->GetName();
-    std::string const& ad2name = ad2.TotalVolume()->GetName();
+    std::string const& adname = ad.TotalVolume()->GetName();
 
     // assume volume name is "volAuxDet##"
-    int ad1Num = atoi(ad1name.substr(9, ad1name.size()).c_str());
-    int ad2Num = atoi(ad2name.substr(9, ad2name.size()).c_str());
-
-    return ad1Num < ad2Num;
+    return atoi(adname.substr(9, adname.size()).c_str());
   }
 
   //----------------------------------------------------------------------------
-  // Define sort order for cryostats in standard configuration
-  static bool sortAuxDetSensitiveStandard(const AuxDetSensitiveGeo& ad1,
-                                          const AuxDetSensitiveGeo& ad2)
+  // Define sort order for auxiliary detector sensitive volumes in standard configuration
+  static int auxDetSensitiveStandardKey(const AuxDetSensitiveGeo& ad)
   {
     // sort based off of GDML name, assuming ordering is encoded
-    std::string ad1name = (ad1.TotalVolume())->GetName();
-    std::string ad2name = (ad2.TotalVolume())->GetName();
+    std::string adname = (ad.TotalVolume())->GetName();
 
     // assume volume name is "volAuxDetSensitive##"
-    int ad1Num = atoi(ad1name.substr(9, ad1name.size()).c_str());
-    int ad2Num = atoi(ad2name.substr(9, ad2name.size()).c_str());
-
-    return ad1Num < ad2Num;
+    return atoi(adname.substr(9, adname.size()).c_str());
   }
 
   //----------------------------------------------------------------------------
-  // Define sort order for cryostats in standard configuration
-  static bool sortCryoStandard(const CryostatGeo& c1, const CryostatGeo& c2)
+  // Define sort order for cryostats, TPCs and planes in standard configuration: the world
+  // position of their local origin
+  template <typename Geo>
+  static std::array<double, 3> worldOriginKey(Geo const& geo)
   {
-    double xyz1[3] = {0.}, xyz2[3] = {0.};
+    std::array<double, 3> xyz = {0.};
     double local[3] = {0.};
-    c1.LocalToWorld(local, xyz1);
-    c2.LocalToWorld(local, xyz2);
-
-    return xyz1[0] < xyz2[0];
+    geo.LocalToWorld(local, xyz.data());
+    return xyz;
   }
 
-  //----------------------------------------------------------------------------
-  // Define sort order for tpcs in standard configuration.
-  static bool sortTPCStandard(const TPCGeo& t1, const TPCGeo& t2)
+  template <typename Geo>
+  static double worldOriginXKey(Geo const& geo)
   {
-    double xyz1[3] = {0.};
-    double xyz2[3] = {0.};
-    double local[3] = {0.};
-    t1.LocalToWorld(local, xyz1);
-    t2.LocalToWorld(local, xyz2);
-
-    // sort TPCs according to x
-    return xyz1[0] < xyz2[0];
+    return worldOriginKey(geo)[0];
   }
 
   //----------------------------------------------------------------------------
   // Define sort order for planes in standard configuration
-  static bool sortPlaneStandard(const PlaneGeo& p1, const PlaneGeo& p2)
+  static bool comparePlaneStandard(std::array<double, 3> const& xyz1,
+                                   std::array<double, 3> const& xyz2)
   {
-    double xyz1[3] = {0.};
-    double xyz2[3] = {0.};
-    double local[3] = {0.};
-    p1.LocalToWorld(local, xyz1);
-    p2.LocalToWorld(local, xyz2);
-
     // drift direction is negative, plane number increases in drift direction
     if (std::abs(xyz1[0] - xyz2[0]) > DistanceTol) return xyz1[0] > xyz2[0];
 
@@ -100,14 +87,16 @@ namespace geo {
   }
 
   //----------------------------------------------------------------------------
-  static bool sortWireStandard(WireGeo const& w1, WireGeo const& w2)
+  static std::array<double, 3> wireStandardKey(WireGeo const& w)
   {
-    double xyz1[3] = {0.};
-    double xyz2[3] = {0.};
-
-    w1.GetCenter(xyz1);
-    w2.GetCenter(xyz2);
+    std::array<double, 3> xyz = {0.};
+    w.GetCenter(xyz.data());
+    return xyz;
+  }
 
+  static bool compareWireStandard(std::array<double, 3> const& xyz1,
+                                  std::array<double, 3> const& xyz2)
+  {
     //sort by z first
     if (std::abs(xyz1[2] - xyz2[2]) > DistanceTol) return xyz1[2] < xyz2[2];
 
@@ -124,26 +113,28 @@ namespace geo {
   //----------------------------------------------------------------------------
   void GeoObjectSorterStandard::SortAuxDets(std::vector<geo::AuxDetGeo>& adgeo) const
   {
-    std::sort(adgeo.begin(), adgeo.end(), sortAuxDetStandard);
+    geo::sortByKeys(adgeo.begin(), adgeo.end(), auxDetStandardKey, std::less<int>{});
   }
 
   //----------------------------------------------------------------------------
   void GeoObjectSorterStandard::SortAuxDetSensitive(
     std::vector<geo::AuxDetSensitiveGeo>& adsgeo) const
   {
-    std::sort(adsgeo.begin(), adsgeo.end(), sortAuxDetSensitiveStandard);
+    geo::sortByKeys(
+      adsgeo.begin(), adsgeo.end(), auxDetSensitiveStandardKey, std::less<int>{});
   }
 
   //----------------------------------------------------------------------------
   void GeoObjectSorterStandard::SortCryostats(std::vector<geo::CryostatGeo>& cgeo) const
   {
-    std::sort(cgeo.begin(), cgeo.end(), sortCryoStandard);
+    geo::sortByKeys(cgeo.begin(), cgeo.end(), worldOriginXKey<CryostatGeo>, std::less<double>{});
   }
 
   //----------------------------------------------------------------------------
   void GeoObjectSorterStandard::SortTPCs(std::vector<geo::TPCGeo>& tgeo) const
   {
-    std::sort(tgeo.begin(), tgeo.end(), sortTPCStandard);
+    // sort TPCs according to x
+    geo::sortByKeys(tgeo.begin(), tgeo.end(), worldOriginXKey<TPCGeo>, std::less<double>{});
   }
 
   //----------------------------------------------------------------------------
@@ -154,9 +145,10 @@ namespace geo {
     // The drift direction has to be set before this method is called.  It is set when
     // the CryostatGeo objects are sorted by the CryostatGeo::SortSubVolumes method
     if (driftDir == geo::kPosX)
-      std::sort(pgeo.rbegin(), pgeo.rend(), sortPlaneStandard);
+      geo::sortByKeys(
+        pgeo.rbegin(), pgeo.rend(), worldOriginKey<PlaneGeo>, comparePlaneStandard);
     else if (driftDir == geo::kNegX)
-      std::sort(pgeo.begin(), pgeo.end(), sortPlaneStandard);
+      geo::sortByKeys(pgeo.begin(), pgeo.end(), worldOriginKey<PlaneGeo>, comparePlaneStandard);
     else if (driftDir == geo::kUnknownDrift)
       throw cet::exception("TPCGeo") << "Drift direction is unknown, can't sort the planes\n";
   }
@@ -164,7 +156,7 @@ namespace geo {
   //----------------------------------------------------------------------------
   void GeoObjectSorterStandard::SortWires(std::vector<geo::WireGeo>& wgeo) const
   {
-    std::sort(wgeo.begin(), wgeo.end(), sortWireStandard);
+    geo::sortByKeys(wgeo.begin(), wgeo.end(), wireStandardKey, compareWireStandard);
   }
 
 }
@@ -0,0 +1,80 @@
+/**
+ * @file   larcorealg/Geometry/GeometryAlignment.h
+ * @brief  Corrections to the placement of TPCs and wire planes.
+ * @see    `geo::GeometryCore::ApplyAlignment()`
+ * @ingroup Geometry
+ *
+ * This is a header-only library.
+ */
+
+#ifndef LARCOREALG_GEOMETRY_GEOMETRYALIGNMENT_H
+#define LARCOREALG_GEOMETRY_GEOMETRYALIGNMENT_H
+
+// LArSoft libraries
+#include "larcorealg/Geometry/TransformationMatrix.h"
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+#include "larcoreobj/SimpleTypesAndConstants/geo_vectors.h"
+
+// ROOT libraries
+#include "Math/GenVector/Rotation3D.h"
+
+// C/C++ standard libraries
+#include <map>
+
+namespace geo {
+
+  /**
+   * @brief Rigid displacements of TPCs and wire planes (alignment constants).
+   * @see `geo::GeometryCore::ApplyAlignment()`
+   *
+   * Each displacement is a transformation in world coordinates, applied on
+   * top of the current placement of the volume: a point `p` of the volume is
+   * moved to `delta(p)`.
+   * A TPC displacement moves the whole TPC, including its wire planes; a plane
+   * displacement moves only that plane (and its wires), and it is applied
+   * after the displacement of its TPC, if any.
+   *
+   * Example moving TPC `C:0 T:1` by 2 mm along _x_ and plane `C:0 T:1 P:2` by
+   * further 0.5 mm along _z_:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * geo::GeometryAlignment alignment;
+   * alignment.TPCs[geo::TPCID{0, 1}] = geo::makeAlignmentDelta({0.2, 0.0, 0.0});
+   * alignment.planes[geo::PlaneID{0, 1, 2}] = geo::makeAlignmentDelta({0.0, 0.0, 0.05});
+   * geom.ApplyAlignment(alignment);
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   */
+  struct GeometryAlignment {
+
+    /// Displacements of whole TPCs.
+    std::map<geo::TPCID, geo::TransformationMatrix> TPCs;
+
+    /// Displacements of single wire planes.
+    std::map<geo::PlaneID, geo::TransformationMatrix> planes;
+
+    /// Returns whether there is no displacement at all.
+    bool empty() const { return TPCs.empty() && planes.empty(); }
+
+  }; // struct GeometryAlignment
+
+  /**
+   * @brief Returns a displacement made of a rotation and a translation.
+   * @param shift translation [cm]
+   * @param rotation rotation, applied before the translation
+   * @param pivot the point the rotation is around (world coordinates)
+   * @return the transformation `p -> pivot + rotation(p - pivot) + shift`
+   */
+  inline geo::TransformationMatrix makeAlignmentDelta(
+    geo::Vector_t const& shift,
+    ROOT::Math::Rotation3D const& rotation = {},
+    geo::Point_t const& pivot = geo::origin())
+  {
+    geo::Vector_t const pivotVector = pivot - geo::origin();
+    geo::Vector_t const translation = pivotVector + shift - rotation(pivotVector);
+    return geo::TransformationMatrix{
+      rotation,
+      geo::TransformationMatrix::Vector{translation.X(), translation.Y(), translation.Z()}};
+  } // makeAlignmentDelta()
+
+} // namespace geo
+
+#endif // LARCOREALG_GEOMETRY_GEOMETRYALIGNMENT_H
@@ -0,0 +1,152 @@
+/**
+ * @file   larcorealg/Geometry/GeometryArrayQueries.cxx
+ * @brief  Geometry queries on plain arrays, suitable for Python and NumPy.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/GeometryArrayQueries.h`
+ */
+
+// LArSoft libraries
+#include "larcorealg/Geometry/GeometryArrayQueries.h"
+#include "larcorealg/Geometry/GeometryCore.h"
+#include "larcorealg/Geometry/PlaneGeo.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::min()
+#include <cstdint>   // std::uint8_t
+
+namespace {
+
+  /// Number of points converted and queried together.
+  constexpr std::size_t BlockSize = 256U;
+
+  /// Copies `n` (x, y, z) triplets from `xyz` into three coordinate arrays.
+  void splitCoordinates(std::size_t n, double const* xyz, double* x, double* y, double* z)
+  {
+    for (std::size_t i = 0; i < n; ++i, xyz += 3) {
+      x[i] = xyz[0];
+      y[i] = xyz[1];
+      z[i] = xyz[2];
+    }
+  }
+
+} // local namespace
+
+//------------------------------------------------------------------------------
+void geo::GeometryArrayQueries::FindTPCsAtPositions(std::size_t n,
+                                                    double const* xyz,
+                                                    Index_t* cryostats,
+                                                    Index_t* tpcs) const
+{
+  geo::Point_t points[BlockSize];
+  geo::TPCID tpcids[BlockSize];
+  for (std::size_t first = 0; first < n; first += BlockSize) {
+    std::size_t const nBlock = std::min(BlockSize, n - first);
+    double const* coords = xyz + 3U * first;
+    for (std::size_t i = 0; i < nBlock; ++i, coords += 3)
+      points[i] = geo::Point_t{coords[0], coords[1], coords[2]};
+    fGeom->FindTPCsAtPositions({points, points + nBlock}, {tpcids, tpcids + nBlock});
+    for (std::size_t i = 0; i < nBlock; ++i) {
+      geo::TPCID const& tpcid = tpcids[i];
+      cryostats[first + i] = tpcid.isValid ? static_cast<Index_t>(tpcid.Cryostat) : InvalidIndex;
+      tpcs[first + i] = tpcid.isValid ? static_cast<Index_t>(tpcid.TPC) : InvalidIndex;
+    }
+  } // for blocks
+} // geo::GeometryArrayQueries::FindTPCsAtPositions()
+
+//------------------------------------------------------------------------------
+void geo::GeometryArrayQueries::WireCoordinates(std::size_t n,
+                                                double const* xyz,
+                                                unsigned int cryostat,
+                                                unsigned int tpc,
+                                                unsigned int plane,
+                                                double* coords) const
+{
+  geo::PlaneGeo const& planeGeo = fGeom->Plane(geo::PlaneID{cryostat, tpc, plane});
+  double x[BlockSize], y[BlockSize], z[BlockSize];
+  for (std::size_t first = 0; first < n; first += BlockSize) {
+    std::size_t const nBlock = std::min(BlockSize, n - first);
+    splitCoordinates(nBlock, xyz + 3U * first, x, y, z);
+    planeGeo.WireCoordinates(nBlock, x, y, z, coords + first);
+  }
+} // geo::GeometryArrayQueries::WireCoordinates()
+
+//------------------------------------------------------------------------------
+void geo::GeometryArrayQueries::NearestWireIDs(std::size_t n,
+                                               double const* xyz,
+                                               unsigned int cryostat,
+                                               unsigned int tpc,
+                                               unsigned int plane,
+                                               Index_t* wires) const
+{
+  geo::PlaneGeo const& planeGeo = fGeom->Plane(geo::PlaneID{cryostat, tpc, plane});
+  double x[BlockSize], y[BlockSize], z[BlockSize];
+  geo::WireID::WireID_t wireNos[BlockSize];
+  std::uint8_t valid[BlockSize];
+  for (std::size_t first = 0; first < n; first += BlockSize) {
+    std::size_t const nBlock = std::min(BlockSize, n - first);
+    splitCoordinates(nBlock, xyz + 3U * first, x, y, z);
+    planeGeo.NearestWireNumbers(nBlock, x, y, z, wireNos, valid);
+    for (std::size_t i = 0; i < nBlock; ++i)
+      wires[first + i] = valid[i] ? static_cast<Index_t>(wireNos[i]) : InvalidIndex;
+  }
+} // geo::GeometryArrayQueries::NearestWireIDs()
+
+//------------------------------------------------------------------------------
+void geo::GeometryArrayQueries::NearestChannels(std::size_t n,
+                                                double const* xyz,
+                                                unsigned int cryostat,
+                                                unsigned int tpc,
+                                                unsigned int plane,
+                                                raw::ChannelID_t* channels) const
+{
+  geo::PlaneID const planeID{cryostat, tpc, plane};
+  geo::PlaneGeo const& planeGeo = fGeom->Plane(planeID);
+  double x[BlockSize], y[BlockSize], z[BlockSize];
+  geo::WireID::WireID_t wireNos[BlockSize];
+  std::uint8_t valid[BlockSize];
+  geo::WireID wireIDs[BlockSize];
+  for (std::size_t first = 0; first < n; first += BlockSize) {
+    std::size_t const nBlock = std::min(BlockSize, n - first);
+    splitCoordinates(nBlock, xyz + 3U * first, x, y, z);
+    planeGeo.NearestWireNumbers(nBlock, x, y, z, wireNos, valid);
+    // capped wires exist, so all the block goes to the channel mapping
+    for (std::size_t i = 0; i < nBlock; ++i)
+      wireIDs[i] = geo::WireID{planeID, wireNos[i]};
+    raw::ChannelID_t* const blockChannels = channels + first;
+    fGeom->PlaneWireToChannels({wireIDs, wireIDs + nBlock},
+                               {blockChannels, blockChannels + nBlock});
+    for (std::size_t i = 0; i < nBlock; ++i)
+      if (!valid[i]) blockChannels[i] = raw::InvalidChannelID;
+  } // for blocks
+} // geo::GeometryArrayQueries::NearestChannels()
+
+//------------------------------------------------------------------------------
+void geo::GeometryArrayQueries::PlaneWireToChannels(std::size_t n,
+                                                    Index_t const* wireIDs,
+                                                    raw::ChannelID_t* channels) const
+{
+  geo::WireID blockIDs[BlockSize];
+  raw::ChannelID_t blockChannels[BlockSize];
+  std::size_t positions[BlockSize];
+  for (std::size_t first = 0; first < n; first += BlockSize) {
+    std::size_t const nBlock = std::min(BlockSize, n - first);
+    // only the wires with a complete ID are queried
+    std::size_t nValid = 0U;
+    for (std::size_t i = 0; i < nBlock; ++i) {
+      Index_t const* id = wireIDs + 4U * (first + i);
+      channels[first + i] = raw::InvalidChannelID;
+      if ((id[0] < 0) || (id[1] < 0) || (id[2] < 0) || (id[3] < 0)) continue;
+      blockIDs[nValid] = geo::WireID{static_cast<geo::CryostatID::CryostatID_t>(id[0]),
+                                     static_cast<geo::TPCID::TPCID_t>(id[1]),
+                                     static_cast<geo::PlaneID::PlaneID_t>(id[2]),
+                                     static_cast<geo::WireID::WireID_t>(id[3])};
+      positions[nValid++] = first + i;
+    }
+    fGeom->PlaneWireToChannels({blockIDs, blockIDs + nValid},
+                               {blockChannels, blockChannels + nValid});
+    for (std::size_t k = 0; k < nValid; ++k)
+      channels[positions[k]] = blockChannels[k];
+  } // for blocks
+} // geo::GeometryArrayQueries::PlaneWireToChannels()
+
+//------------------------------------------------------------------------------
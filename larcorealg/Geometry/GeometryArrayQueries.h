@@ -0,0 +1,161 @@
+/**
+ * @file   larcorealg/Geometry/GeometryArrayQueries.h
+ * @brief  Geometry queries on plain arrays, suitable for Python and NumPy.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/GeometryArrayQueries.cxx`
+ */
+
+#ifndef LARCOREALG_GEOMETRY_GEOMETRYARRAYQUERIES_H
+#define LARCOREALG_GEOMETRY_GEOMETRYARRAYQUERIES_H
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/RawTypes.h" // raw::ChannelID_t
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <cstdint> // std::int32_t
+
+namespace geo {
+
+  class GeometryCore;
+
+  /**
+   * @brief Batch geometry queries on buffers given by a pointer and a length.
+   * @see `geo::GeometryCore::FindTPCsAtPositions()`,
+   *      `geo::PlaneGeo::NearestWireNumbers()`,
+   *      `geo::GeometryCore::PlaneWireToChannels()`
+   *
+   * The batch queries of `geo::GeometryCore` take `util::span` of geometry
+   * objects, which are awkward to build from Python. This object offers the
+   * same queries with arguments that a NumPy array converts to directly
+   * through the ROOT dictionary, so that a columnar analysis can make a
+   * single call for a whole array:
+   * - points are `n` consecutive (x, y, z) triplets [cm], the layout of a
+   *   C-ordered array of shape `(n, 3)` and type `float64`;
+   * - wire IDs are `n` consecutive (cryostat, TPC, plane, wire) quadruplets,
+   *   the layout of an array of shape `(n, 4)` and type `int32`;
+   * - the results are written into arrays of `n` elements owned by the caller
+   *   (`int32` for indices, `uint32` for channels, `float64` for coordinates).
+   *
+   * A missing result (no TPC, a point beyond the wires of the plane) is marked
+   * by `InvalidIndex` for indices and by `raw::InvalidChannelID` for channels.
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.py}
+   * queries = ROOT.geo.GeometryArrayQueries(geom)
+   * points = np.ascontiguousarray(hits[["x", "y", "z"]].to_numpy())
+   * cryostats = np.empty(len(points), dtype=np.int32)
+   * tpcs = np.empty(len(points), dtype=np.int32)
+   * queries.FindTPCsAtPositions(len(points), points, cryostats, tpcs)
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   * The object keeps a reference to the geometry, which must stay valid.
+   * Errors (like a plane not in the geometry) are reported by exceptions,
+   * which PyROOT turns into Python exceptions.
+   */
+  class GeometryArrayQueries {
+
+  public:
+    /// Type of the indices in the results.
+    using Index_t = std::int32_t;
+
+    /// Value of a missing index.
+    static constexpr Index_t InvalidIndex = -1;
+
+    /// Constructor: queries `geom`.
+    explicit GeometryArrayQueries(geo::GeometryCore const& geom) : fGeom{&geom} {}
+
+    /// Returns the geometry being queried.
+    geo::GeometryCore const& Geometry() const { return *fGeom; }
+
+    /**
+     * @brief Finds the TPC including each of the points.
+     * @param n number of points
+     * @param xyz the points, as `n` (x, y, z) triplets [cm]
+     * @param[out] cryostats cryostat number of each point (`InvalidIndex` if none)
+     * @param[out] tpcs TPC number of each point (`InvalidIndex` if none)
+     * @see `geo::GeometryCore::FindTPCsAtPositions()`
+     */
+    void FindTPCsAtPositions(std::size_t n,
+                             double const* xyz,
+                             Index_t* cryostats,
+                             Index_t* tpcs) const;
+
+    /**
+     * @brief Computes the wire coordinate of each point on a plane.
+     * @param n number of points
+     * @param xyz the points, as `n` (x, y, z) triplets [cm]
+     * @param cryostat the cryostat of the plane
+     * @param tpc the TPC of the plane
+     * @param plane the number of the plane
+     * @param[out] coords the wire coordinate of each point
+     * @throw cet::exception if there is no such plane
+     * @see `geo::PlaneGeo::WireCoordinates()`
+     */
+    void WireCoordinates(std::size_t n,
+                         double const* xyz,
+                         unsigned int cryostat,
+                         unsigned int tpc,
+                         unsigned int plane,
+                         double* coords) const;
+
+    /**
+     * @brief Finds the wire of a plane nearest to each point.
+     * @param n number of points
+     * @param xyz the points, as `n` (x, y, z) triplets [cm]
+     * @param cryostat the cryostat of the plane
+     * @param tpc the TPC of the plane
+     * @param plane the number of the plane
+     * @param[out] wires the wire number of each point (`InvalidIndex` if beyond the wires)
+     * @throw cet::exception if there is no such plane
+     * @see `geo::PlaneGeo::NearestWireNumbers()`, `geo::GeometryCore::NearestWireID()`
+     */
+    void NearestWireIDs(std::size_t n,
+                        double const* xyz,
+                        unsigned int cryostat,
+                        unsigned int tpc,
+                        unsigned int plane,
+                        Index_t* wires) const;
+
+    /**
+     * @brief Finds the channel of the wire of a plane nearest to each point.
+     * @param n number of points
+     * @param xyz the points, as `n` (x, y, z) triplets [cm]
+     * @param cryostat the cryostat of the plane
+     * @param tpc the TPC of the plane
+     * @param plane the number of the plane
+     * @param[out] channels the channel of each point (`raw::InvalidChannelID`
+     *             if beyond the wires)
+     * @throw cet::exception if there is no such plane
+     * @see `NearestWireIDs()`, `PlaneWireToChannels()`
+     */
+    void NearestChannels(std::size_t n,
+                         double const* xyz,
+                         unsigned int cryostat,
+                         unsigned int tpc,
+                         unsigned int plane,
+                         raw::ChannelID_t* channels) const;
+
+    /**
+     * @brief Returns the channel of each of the wires.
+     * @param n number of wires
+     * @param wireIDs the wires, as `n` (cryostat, TPC, plane, wire) quadruplets
+     * @param[out] channels the channel of each wire
+     * @throw cet::exception if a wire is not in the geometry
+     * @see `geo::GeometryCore::PlaneWireToChannels()`
+     *
+     * Wires with a negative number anywhere in their ID (like the missing
+     * results of `NearestWireIDs()`) get `raw::InvalidChannelID`.
+     */
+    void PlaneWireToChannels(std::size_t n,
+                             Index_t const* wireIDs,
+                             raw::ChannelID_t* channels) const;
+
+  private:
+    geo::GeometryCore const* fGeom; ///< The geometry.
+
+  }; // class GeometryArrayQueries
+
+} // namespace geo
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREALG_GEOMETRY_GEOMETRYARRAYQUERIES_H
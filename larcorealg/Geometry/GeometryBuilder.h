@@ -14,6 +14,7 @@
 #include "larcorealg/Geometry/AuxDetGeo.h"
 #include "larcorealg/Geometry/CryostatGeo.h"
 #include "larcorealg/Geometry/GeoNodePath.h"
+#include "larcorealg/Geometry/TaskRunner.h"
 
 // ROOT libraries
 #include "TGeoNode.h"
@@ -22,6 +23,7 @@
 #include <algorithm> // std::transform()
 #include <iterator>  // std::back_inserter()
 #include <string>
+#include <utility> // std::move()
 #include <vector>
 
 namespace geo {
@@ -48,6 +50,14 @@ namespace geo {
    * Note that as of LArSoft `v08_06_00`, no polymorphism is actually
    * implemented.
    *
+   *
+   * Parallel building
+   * ------------------
+   *
+   * A task runner (`setTaskRunner()`) allows implementations to build
+   * independent subtrees (e.g. TPCs) concurrently. Implementations are not
+   * required to use it.
+   *
    */
   class GeometryBuilder {
 
@@ -118,6 +128,9 @@ namespace geo {
     /// @}
     // --- END Auxiliary detector information ----------------------------------
 
+    /// Sets the runner for independent building tasks (empty: sequential).
+    void setTaskRunner(geo::TaskRunner_t runner) { fTaskRunner = std::move(runner); }
+
     // --- END Static utility methods ------------------------------------------
 
   protected:
@@ -127,6 +140,12 @@ namespace geo {
     /// Custom implementation of `extractAuxiliaryDetectors()`.
     virtual AuxDets_t doExtractAuxiliaryDetectors(Path_t& path) = 0;
 
+    /// Returns the runner for independent tasks (may be empty).
+    geo::TaskRunner_t const& taskRunner() const { return fTaskRunner; }
+
+  private:
+    geo::TaskRunner_t fTaskRunner; ///< Runner for independent tasks.
+
   }; // class GeometryBuilder
 
 } // namespace geo
@@ -0,0 +1,139 @@
+/**
+ * @file   larcorealg/Geometry/GeometryBuilderParametric.cxx
+ * @brief  Geometry extractor generating the wires of regular wire planes
+ *         (implementation file).
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/GeometryBuilderParametric.h`
+ */
+
+// LArSoft libraries
+#include "larcorealg/Geometry/GeometryBuilderParametric.h"
+#include "larcoreobj/SimpleTypesAndConstants/PhysicalConstants.h" // util::DegreesToRadians()
+
+// support libraries
+#include "cetlib_except/exception.h"
+
+// ROOT libraries
+#include "Math/GenVector/Rotation3D.h"
+#include "Math/GenVector/Translation3D.h"
+#include "TGeoBBox.h"
+#include "TGeoVolume.h"
+
+// C++ standard library
+#include <algorithm> // std::max(), std::min()
+#include <cmath>     // std::sin(), std::cos(), std::abs()
+#include <limits>
+#include <utility> // std::swap(), std::move()
+
+//------------------------------------------------------------------------------
+geo::GeometryBuilderParametric::GeometryBuilderParametric(Config const& config)
+  : GeometryBuilderStandard(config)
+{
+  for (WirePlaneConfig const& planeConfig : config.wirePlanes()) {
+    WirePlaneParams_t params{planeConfig.volume(),
+                             planeConfig.firstWire(),
+                             planeConfig.pitch(),
+                             util::DegreesToRadians(planeConfig.angle()),
+                             planeConfig.nWires(),
+                             planeConfig.radius()};
+    if (params.pitch == 0.0) {
+      throw cet::exception("GeometryBuilderParametric")
+        << "Wire plane '" << params.volume << "' is configured with no pitch.\n";
+    }
+    if (params.nWires < 2U) { // planes need at least two wires
+      throw cet::exception("GeometryBuilderParametric")
+        << "Wire plane '" << params.volume << "' is configured with " << params.nWires
+        << " wires (at least 2 are needed).\n";
+    }
+    if (findWirePlane(params.volume)) {
+      throw cet::exception("GeometryBuilderParametric")
+        << "Wire plane '" << params.volume << "' is configured more than once.\n";
+    }
+    fWirePlanes.push_back(std::move(params));
+  } // for
+} // geo::GeometryBuilderParametric::GeometryBuilderParametric()
+
+//------------------------------------------------------------------------------
+geo::PlaneGeo geo::GeometryBuilderParametric::doMakePlane(Path_t& path)
+{
+  WirePlaneParams_t const* params = findWirePlane(path.current().GetVolume()->GetName());
+  if (!params) return GeometryBuilderStandard::doMakePlane(path);
+
+  auto planeTrans = path.currentTransformation<geo::TransformationMatrix>();
+  Wires_t wires = makeParametricWires(path, planeTrans, *params);
+  return geo::PlaneGeo(path.current(), std::move(planeTrans), std::move(wires));
+} // geo::GeometryBuilderParametric::doMakePlane()
+
+//------------------------------------------------------------------------------
+auto geo::GeometryBuilderParametric::findWirePlane(std::string const& name) const
+  -> WirePlaneParams_t const*
+{
+  for (WirePlaneParams_t const& params : fWirePlanes)
+    if (params.volume == name) return &params;
+  return nullptr;
+} // geo::GeometryBuilderParametric::findWirePlane()
+
+//------------------------------------------------------------------------------
+auto geo::GeometryBuilderParametric::makeParametricWires(
+  Path_t const& path,
+  geo::TransformationMatrix const& planeTrans,
+  WirePlaneParams_t const& params) const -> Wires_t
+{
+  TGeoVolume const& volume = *(path.current().GetVolume());
+  auto const* box = dynamic_cast<TGeoBBox const*>(volume.GetShape());
+  if (!box) {
+    throw cet::exception("GeometryBuilderParametric")
+      << "Wire plane volume '" << volume.GetName() << "' is not a box.\n";
+  }
+  double const halfY = box->GetDY();
+  double const halfZ = box->GetDZ();
+
+  // wire direction (dy, dz) and pitch direction (dz, -dy) on the local y-z plane
+  double const dy = std::sin(params.angle);
+  double const dz = std::cos(params.angle);
+
+  // the local z axis of the wire is its direction, the local x the plane one
+  ROOT::Math::Rotation3D const wireRot{1.0, 0.0, 0.0, 0.0, dz, dy, 0.0, -dy, dz};
+
+  // returns the range of t where `c + t d` is within [ -half, +half ]
+  auto const clip = [](double c, double d, double half, double& tMin, double& tMax) {
+    if (std::abs(d) < 1e-12) {
+      if (std::abs(c) > half) tMax = tMin; // no overlap at all
+      return;
+    }
+    double t1 = (-half - c) / d;
+    double t2 = (+half - c) / d;
+    if (t1 > t2) std::swap(t1, t2);
+    tMin = std::max(tMin, t1);
+    tMax = std::min(tMax, t2);
+  };
+
+  Wires_t wires;
+  wires.reserve(params.nWires);
+  for (unsigned int iWire = 0; iWire < params.nWires; ++iWire) {
+    double const offset = iWire * params.pitch;
+    double const cy = params.firstWire[1] + offset * dz;
+    double const cz = params.firstWire[2] - offset * dy;
+
+    double tMin = -std::numeric_limits<double>::max();
+    double tMax = +std::numeric_limits<double>::max();
+    clip(cy, dy, halfY, tMin, tMax);
+    clip(cz, dz, halfZ, tMin, tMax);
+    if (tMax <= tMin) {
+      throw cet::exception("GeometryBuilderParametric")
+        << "Wire #" << iWire << " of plane '" << params.volume << "' is out of the plane ("
+        << params.nWires << " wires, pitch " << params.pitch << " cm).\n";
+    }
+
+    double const tCenter = (tMin + tMax) / 2.0;
+    ROOT::Math::Translation3D const center{
+      params.firstWire[0], cy + tCenter * dy, cz + tCenter * dz};
+    wires.emplace_back(planeTrans * geo::TransformationMatrix{wireRot, center},
+                       (tMax - tMin) / 2.0,
+                       params.radius);
+  } // for wires
+
+  return wires;
+} // geo::GeometryBuilderParametric::makeParametricWires()
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,131 @@
+/**
+ * @file   larcorealg/Geometry/GeometryBuilderParametric.h
+ * @brief  Geometry extractor generating the wires of regular wire planes.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/GeometryBuilder.h`,
+ *         `larcorealg/Geometry/GeometryBuilderParametric.cxx`
+ */
+
+#ifndef LARCOREALG_GEOMETRY_GEOMETRYBUILDERPARAMETRIC_H
+#define LARCOREALG_GEOMETRY_GEOMETRYBUILDERPARAMETRIC_H
+
+// LArSoft libraries
+#include "larcorealg/Geometry/GeometryBuilderStandard.h"
+
+// support libraries
+#include "fhiclcpp/types/Atom.h"
+#include "fhiclcpp/types/Sequence.h"
+#include "fhiclcpp/types/Table.h"
+
+// C++ standard library
+#include <array>
+#include <string>
+#include <vector>
+
+namespace geo {
+
+  /**
+   * @brief Geometry builder generating the wires of regular wire planes.
+   *
+   * This builder works like `geo::GeometryBuilderStandard`, except for the
+   * wire planes listed in its configuration: the wires of those planes are
+   * not read from the ROOT geometry, but generated from the position of the
+   * first wire, the pitch, the angle and the number of wires. The wire nodes
+   * of these planes, if any, are not visited at all, so that the GDML
+   * description may omit them.
+   *
+   * All the parameters are in the local frame of the plane volume, which must
+   * be a box; the wires lie on its local _y_-_z_ plane:
+   * * `firstWire`: a point on the first wire [cm]; only its _y_ and _z_
+   *   coordinates are used
+   * * `angle`: angle of the wires from the local _z_ axis, toward the local
+   *   _y_ axis [degrees]
+   * * `pitch`: distance between consecutive wires [cm]; the wires follow,
+   *   perpendicularly to their direction, the local _z_ axis rotated by
+   *   `angle` and then by -90 degrees; a negative pitch reverses the order
+   * * `nWires`: number of wires
+   * * `radius`: radius of the wires [cm]
+   *
+   * Each wire spans the whole plane box, and an exception is thrown if any of
+   * the wires falls out of it.
+   */
+  class GeometryBuilderParametric : public geo::GeometryBuilderStandard {
+
+  public:
+    /// Configuration of the wires of one plane.
+    struct WirePlaneConfig {
+
+      using Name = fhicl::Name;
+      using Comment = fhicl::Comment;
+
+      fhicl::Atom<std::string> volume{Name("volume"),
+                                      Comment("name of the volume of the wire plane")};
+
+      fhicl::Sequence<double, 3U> firstWire{
+        Name("firstWire"), Comment("a point of the first wire, in the plane frame [cm]")};
+
+      fhicl::Atom<double> pitch{Name("pitch"), Comment("distance between the wires [cm]")};
+
+      fhicl::Atom<double> angle{
+        Name("angle"), Comment("angle of the wires from the local z axis toward y [degrees]")};
+
+      fhicl::Atom<unsigned int> nWires{Name("nWires"), Comment("number of wires")};
+
+      fhicl::Atom<double> radius{Name("radius"),
+                                 Comment("radius of the wires [cm]"),
+                                 0.0075 // default
+      };
+
+    }; // struct WirePlaneConfig
+
+    /// Configuration parameters.
+    struct Config : geo::GeometryBuilderStandard::Config {
+
+      fhicl::Sequence<fhicl::Table<WirePlaneConfig>> wirePlanes{
+        Name("wirePlanes"), Comment("planes whose wires are generated from parameters")};
+
+    }; // struct Config
+
+    GeometryBuilderParametric(Config const& config);
+
+    //
+    // we don't expand the public interface here
+    //
+
+  protected:
+    /// Parameters of the wires of a plane (see `WirePlaneConfig`).
+    struct WirePlaneParams_t {
+      std::string volume;               ///< Name of the plane volume.
+      std::array<double, 3U> firstWire; ///< A point of the first wire [cm].
+      double pitch;                     ///< Distance between wires [cm].
+      double angle;                     ///< Angle of the wires from local _z_ [rad].
+      unsigned int nWires;              ///< Number of wires.
+      double radius;                    ///< Radius of the wires [cm].
+    }; // WirePlaneParams_t
+
+    /// Parameters of the planes with generated wires.
+    std::vector<WirePlaneParams_t> fWirePlanes;
+
+    // --- BEGIN Plane information ---------------------------------------------
+    /// @name Plane information
+    /// @{
+
+    /// Core implementation of `makePlane()`: generates the wires if configured.
+    virtual geo::PlaneGeo doMakePlane(Path_t& path) override;
+
+    /// Returns the parameters of the plane volume `name`, `nullptr` if none.
+    WirePlaneParams_t const* findWirePlane(std::string const& name) const;
+
+    /// Generates the wires of the plane at `path` from `params`.
+    Wires_t makeParametricWires(Path_t const& path,
+                                geo::TransformationMatrix const& planeTrans,
+                                WirePlaneParams_t const& params) const;
+
+    /// @}
+    // --- END Plane information -----------------------------------------------
+
+  }; // class GeometryBuilderParametric
+
+} // namespace geo
+
+#endif // LARCOREALG_GEOMETRY_GEOMETRYBUILDERPARAMETRIC_H
@@ -15,18 +15,26 @@
 // ROOT libraries
 
 // C++ standard library
-#include <algorithm> // std::move()
+#include <mutex> // std::unique_lock
+#include <optional>
 #include <string_view>
+#include <type_traits> // std::invoke_result_t
+#include <utility>     // std::move()
+#include <vector>
 
 namespace {
 
   //------------------------------------------------------------------------------
-  template <typename Dest, typename Src>
-  Dest& extendCollection(Dest& dest, Src&& src)
-  {
-    std::move(src.begin(), src.end(), std::back_inserter(dest));
-    return dest;
-  } // extend()
+  /// Converts into the result of `make()`, so that `emplace_back()` constructs
+  /// the object directly in its container.
+  template <typename Make>
+  struct InPlace {
+    Make make;
+    operator std::invoke_result_t<Make&>() { return make(); }
+  }; // InPlace
+
+  template <typename Make>
+  InPlace(Make) -> InPlace<Make>;
 
   //------------------------------------------------------------------------------
 
@@ -34,13 +42,16 @@ namespace {
 
 //------------------------------------------------------------------------------
 geo::GeometryBuilderStandard::GeometryBuilderStandard(Config const& config)
-  : fMaxDepth(config.maxDepth()), fOpDetGeoName(config.opDetGeoName())
+  : fMaxDepth(config.maxDepth())
+  , fOpDetGeoName(config.opDetGeoName())
+  , fLazyWires(config.lazyWires())
 {}
 
 //------------------------------------------------------------------------------
 geo::GeometryBuilderStandard::AuxDets_t geo::GeometryBuilderStandard::doExtractAuxiliaryDetectors(
   Path_t& path)
 {
+  clearNodeKinds(); // node addresses may be reused by a new geometry
 
   return doExtractGeometryObjects<geo::AuxDetGeo,
                                   &geo::GeometryBuilderStandard::isAuxDetNode,
@@ -78,6 +89,7 @@ geo::AuxDetSensitiveGeo geo::GeometryBuilderStandard::doMakeAuxDetSensitive(Path
 geo::GeometryBuilderStandard::Cryostats_t geo::GeometryBuilderStandard::doExtractCryostats(
   Path_t& path)
 {
+  clearNodeKinds(); // node addresses may be reused by a new geometry
 
   return doExtractGeometryObjects<geo::CryostatGeo,
                                   &geo::GeometryBuilderStandard::isCryostatNode,
@@ -113,9 +125,29 @@ geo::OpDetGeo geo::GeometryBuilderStandard::doMakeOpDet(Path_t& path)
 //------------------------------------------------------------------------------
 geo::GeometryBuilderStandard::TPCs_t geo::GeometryBuilderStandard::doExtractTPCs(Path_t& path)
 {
-  return doExtractGeometryObjects<geo::TPCGeo,
-                                  &geo::GeometryBuilderStandard::isTPCNode,
-                                  &geo::GeometryBuilderStandard::makeTPC>(path);
+  if (!taskRunner()) {
+    return doExtractGeometryObjects<geo::TPCGeo,
+                                    &geo::GeometryBuilderStandard::isTPCNode,
+                                    &geo::GeometryBuilderStandard::makeTPC>(path);
+  }
+
+  //
+  // the TPCs are independent: locate them first, then build them concurrently
+  //
+  std::vector<Path_t> TPCpaths;
+  collectGeometryPaths<&geo::GeometryBuilderStandard::isTPCNode>(path, TPCpaths);
+
+  std::vector<std::optional<geo::TPCGeo>> TPCs(TPCpaths.size());
+  geo::runTasks(taskRunner(), TPCpaths.size(), [this, &TPCpaths, &TPCs](std::size_t iTPC) {
+    Path_t TPCpath = TPCpaths[iTPC];
+    TPCs[iTPC].emplace(makeTPC(TPCpath));
+  });
+
+  TPCs_t result;
+  result.reserve(TPCs.size());
+  for (std::optional<geo::TPCGeo>& TPC : TPCs)
+    result.push_back(std::move(*TPC));
+  return result;
 
 } // geo::GeometryBuilderStandard::doExtractTPCs()
 
@@ -138,10 +170,34 @@ geo::GeometryBuilderStandard::Planes_t geo::GeometryBuilderStandard::doExtractPl
 //------------------------------------------------------------------------------
 geo::PlaneGeo geo::GeometryBuilderStandard::doMakePlane(Path_t& path)
 {
+  if (geo::PlaneGeo::WireNodes_t wireNodes; fLazyWires && collectWireNodes(path, wireNodes)) {
+    return geo::PlaneGeo(path.current(),
+                         path.currentTransformation<geo::TransformationMatrix>(),
+                         std::move(wireNodes));
+  }
   return geo::PlaneGeo(
     path.current(), path.currentTransformation<geo::TransformationMatrix>(), extractWires(path));
 } // geo::GeometryBuilderStandard::doMakePlane()
 
+//------------------------------------------------------------------------------
+bool geo::GeometryBuilderStandard::collectWireNodes(Path_t const& path,
+                                                    geo::PlaneGeo::WireNodes_t& wireNodes) const
+{
+  if (path.depth() >= fMaxDepth) return false;
+
+  TGeoVolume const& volume = *(path.current().GetVolume());
+  int const n = volume.GetNdaughters();
+  wireNodes.reserve(wireNodes.size() + n);
+  for (int i = 0; i < n; ++i) {
+    TGeoNode const& node = *(volume.GetNode(i));
+    if (isWireNode(node))
+      wireNodes.push_back(&node);
+    else if (node.GetVolume()->GetNdaughters() > 0)
+      return false;
+  } // for
+  return wireNodes.size() > 1; // planes need at least two wires anyway
+} // geo::GeometryBuilderStandard::collectWireNodes()
+
 //------------------------------------------------------------------------------
 geo::GeometryBuilderStandard::Wires_t geo::GeometryBuilderStandard::doExtractWires(Path_t& path)
 {
@@ -162,50 +218,85 @@ geo::WireGeo geo::GeometryBuilderStandard::doMakeWire(Path_t& path)
 //------------------------------------------------------------------------------
 bool geo::GeometryBuilderStandard::isAuxDetNode(TGeoNode const& node) const
 {
-  using namespace std::literals;
-  return starts_with(node.GetName(), "volAuxDet"sv);
+  return nodeKinds(node) & AuxDetNode;
 } // geo::GeometryBuilderStandard::isAuxDetNode()
 
 //------------------------------------------------------------------------------
 bool geo::GeometryBuilderStandard::isAuxDetSensitiveNode(TGeoNode const& node) const
 {
-  return std::string_view(node.GetName()).find("Sensitive") != std::string_view::npos;
+  return nodeKinds(node) & AuxDetSensitiveNode;
 } // geo::GeometryBuilderStandard::isAuxDetSensitiveNode()
 
 //------------------------------------------------------------------------------
 bool geo::GeometryBuilderStandard::isCryostatNode(TGeoNode const& node) const
 {
-  using namespace std::literals;
-  return starts_with(node.GetName(), "volCryostat"sv);
+  return nodeKinds(node) & CryostatNode;
 } // geo::GeometryBuilderStandard::isCryostatNode()
 
 //------------------------------------------------------------------------------
 bool geo::GeometryBuilderStandard::isOpDetNode(TGeoNode const& node) const
 {
-  return starts_with(node.GetName(), fOpDetGeoName);
+  return nodeKinds(node) & OpDetNode;
 } // geo::GeometryBuilderStandard::isOpDetNode()
 
 //------------------------------------------------------------------------------
 bool geo::GeometryBuilderStandard::isTPCNode(TGeoNode const& node) const
 {
-  using namespace std::literals;
-  return starts_with(node.GetName(), "volTPC"sv);
+  return nodeKinds(node) & TPCNode;
 } // geo::GeometryBuilderStandard::isTPCNode()
 
 //------------------------------------------------------------------------------
 bool geo::GeometryBuilderStandard::isPlaneNode(TGeoNode const& node) const
 {
-  using namespace std::literals;
-  return starts_with(node.GetName(), "volTPCPlane"sv);
+  return nodeKinds(node) & PlaneNode;
 } // geo::GeometryBuilderStandard::isPlaneNode()
 
 //------------------------------------------------------------------------------
 bool geo::GeometryBuilderStandard::isWireNode(TGeoNode const& node) const
 {
-  using namespace std::literals;
-  return starts_with(node.GetName(), "volTPCWire"sv);
+  return nodeKinds(node) & WireNode;
 } // geo::GeometryBuilderStandard::isWireNode()
 
+//------------------------------------------------------------------------------
+unsigned int geo::GeometryBuilderStandard::nodeKinds(TGeoNode const& node) const
+{
+  { // fast path: the node was already classified
+    std::shared_lock<std::shared_mutex> lock{fNodeKinds.mutex};
+    auto const iKinds = fNodeKinds.kinds.find(&node);
+    if (iKinds != fNodeKinds.kinds.end()) return iKinds->second;
+  }
+
+  unsigned int const kinds = classifyNode(node);
+  std::unique_lock<std::shared_mutex> lock{fNodeKinds.mutex};
+  fNodeKinds.kinds.emplace(&node, kinds);
+  return kinds;
+} // geo::GeometryBuilderStandard::nodeKinds()
+
+//------------------------------------------------------------------------------
+void geo::GeometryBuilderStandard::clearNodeKinds()
+{
+  std::unique_lock<std::shared_mutex> lock{fNodeKinds.mutex};
+  NodeKindCache_t::Kinds_t{&fNodeKinds.memory}.swap(fNodeKinds.kinds);
+  fNodeKinds.memory.reset(); // no entry is left in the pool
+} // geo::GeometryBuilderStandard::clearNodeKinds()
+
+//------------------------------------------------------------------------------
+unsigned int geo::GeometryBuilderStandard::classifyNode(TGeoNode const& node) const
+{
+  using namespace std::literals;
+  std::string_view const name = node.GetName();
+
+  unsigned int kinds = 0U;
+  if (starts_with(name, "volAuxDet"sv)) kinds |= AuxDetNode;
+  if (name.find("Sensitive"sv) != std::string_view::npos) kinds |= AuxDetSensitiveNode;
+  if (starts_with(name, "volCryostat"sv)) kinds |= CryostatNode;
+  if (starts_with(name, fOpDetGeoName)) kinds |= OpDetNode;
+  if (starts_with(name, "volTPC"sv)) kinds |= TPCNode;
+  if (starts_with(name, "volTPCPlane"sv)) kinds |= PlaneNode;
+  if (starts_with(name, "volTPCWire"sv)) kinds |= WireNode;
+  return kinds;
+} // geo::GeometryBuilderStandard::classifyNode()
+
 //------------------------------------------------------------------------------
 template <typename ObjGeo,
           bool (geo::GeometryBuilderStandard::*IsObj)(TGeoNode const&) const,
@@ -215,30 +306,66 @@ geo::GeometryBuilder::GeoColl_t<ObjGeo> geo::GeometryBuilderStandard::doExtractG
 {
 
   geo::GeometryBuilder::GeoColl_t<ObjGeo> objs;
+  objs.reserve(countGeometryNodes<IsObj>(path.current(), path.depth()));
+
+  visitGeometryNodes<IsObj>(path, [this, &objs](Path_t& objPath) {
+    objs.emplace_back(InPlace{[this, &objPath]() { return (this->*MakeObj)(objPath); }});
+  });
+
+  return objs;
+
+} // geo::GeometryBuilderStandard::doExtractGeometryObjects()
+
+//------------------------------------------------------------------------------
+template <bool (geo::GeometryBuilderStandard::*IsObj)(TGeoNode const&) const>
+void geo::GeometryBuilderStandard::collectGeometryPaths(Path_t& path, std::vector<Path_t>& paths)
+{
+  paths.reserve(paths.size() + countGeometryNodes<IsObj>(path.current(), path.depth()));
+  visitGeometryNodes<IsObj>(path, [&paths](Path_t& objPath) { paths.push_back(objPath); });
+} // geo::GeometryBuilderStandard::collectGeometryPaths()
+
+//------------------------------------------------------------------------------
+template <bool (geo::GeometryBuilderStandard::*IsObj)(TGeoNode const&) const, typename Visitor>
+void geo::GeometryBuilderStandard::visitGeometryNodes(Path_t& path, Visitor&& visit)
+{
 
   //
-  // if this is a wire, we are set
+  // if this is a candidate, we are set
   //
   if ((this->*IsObj)(path.current())) {
-    objs.push_back((this->*MakeObj)(path));
-    return objs;
+    visit(path);
+    return;
   }
 
   //
-  // descend into the next layer down, concatenate the results and return them
+  // descend into the next layer down
   //
-  if (path.depth() >= fMaxDepth) return objs; // yep, this is empty
+  if (path.depth() >= fMaxDepth) return;
 
   TGeoVolume const& volume = *(path.current().GetVolume());
   int const n = volume.GetNdaughters();
   for (int i = 0; i < n; ++i) {
     path.append(*(volume.GetNode(i)));
-    extendCollection(objs, doExtractGeometryObjects<ObjGeo, IsObj, MakeObj>(path));
+    visitGeometryNodes<IsObj>(path, visit);
     path.pop();
   } // for
 
-  return objs;
+} // geo::GeometryBuilderStandard::visitGeometryNodes()
 
-} // geo::GeometryBuilderStandard::doExtractGeometryObjects()
+//------------------------------------------------------------------------------
+template <bool (geo::GeometryBuilderStandard::*IsObj)(TGeoNode const&) const>
+std::size_t geo::GeometryBuilderStandard::countGeometryNodes(TGeoNode const& node,
+                                                             Path_t::Depth_t depth) const
+{
+  if ((this->*IsObj)(node)) return 1U;
+  if (depth >= fMaxDepth) return 0U;
+
+  std::size_t count = 0U;
+  TGeoVolume const& volume = *(node.GetVolume());
+  int const n = volume.GetNdaughters();
+  for (int i = 0; i < n; ++i)
+    count += countGeometryNodes<IsObj>(*(volume.GetNode(i)), depth + 1);
+  return count;
+} // geo::GeometryBuilderStandard::countGeometryNodes()
 
 //------------------------------------------------------------------------------
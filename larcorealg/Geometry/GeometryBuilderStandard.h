@@ -11,6 +11,7 @@
 #define LARCOREALG_GEOMETRY_GEOMETRYBUILDERSTANDARD_H
 
 // LArSoft libraries
+#include "larcorealg/CoreUtils/MonotonicArena.h"
 #include "larcorealg/Geometry/AuxDetGeo.h"
 #include "larcorealg/Geometry/AuxDetSensitiveGeo.h"
 #include "larcorealg/Geometry/CryostatGeo.h"
@@ -27,8 +28,13 @@
 #include "TGeoNode.h"
 
 // C++ standard library
-#include <limits> // std::numeric_limits<>
+#include <cstddef> // std::size_t
+#include <limits>  // std::numeric_limits<>
+#include <memory_resource>
+#include <shared_mutex>
 #include <string_view>
+#include <unordered_map>
+#include <vector>
 
 namespace geo {
 
@@ -123,6 +129,12 @@ namespace geo {
         "volOpDetSensitive" // default
       };
 
+      fhicl::Atom<bool> lazyWires{
+        Name("lazyWires"),
+        Comment("create the wire objects only when they are first requested"),
+        false // default
+      };
+
     }; // struct Config
 
     GeometryBuilderStandard(Config const& config);
@@ -138,6 +150,9 @@ namespace geo {
     /// Name of the optical detector nodes.
     std::string fOpDetGeoName = "volOpDetSensitive";
 
+    /// Whether planes are created with wires built on demand.
+    bool fLazyWires = false;
+
     // --- BEGIN Auxiliary detector information --------------------------------
     /// @name Auxiliary detector information
     /// @{
@@ -275,6 +290,8 @@ namespace geo {
     /// Core implementation of `extractTPCs()`.
     ///
     /// The actual algorithm is specialization of `doExtractGeometryObjects()`.
+    /// If a task runner is set, the TPCs are located first and then built
+    /// concurrently, in the same order.
     virtual TPCs_t doExtractTPCs(Path_t& path);
 
     /// Core implementation of `makeTPC()`.
@@ -311,8 +328,23 @@ namespace geo {
     virtual Planes_t doExtractPlanes(Path_t& path);
 
     /// Core implementation of `makePlanes()`.
+    ///
+    /// With `lazyWires` configuration, the plane is given only the nodes of
+    /// its wires (see `collectWireNodes()`), unless they can't be found.
     virtual geo::PlaneGeo doMakePlane(Path_t& path);
 
+    /**
+     * @brief Collects the wire nodes among the daughters of the plane node.
+     * @param path the path of the plane
+     * @param[out] wireNodes list to add the wire nodes to
+     * @return whether all the wires of the plane are daughters of its node
+     *
+     * The wires built on demand by `geo::PlaneGeo` must be daughters of the
+     * plane. If another daughter has its own daughters, wires might be
+     * hidden among them, and `false` is returned.
+     */
+    bool collectWireNodes(Path_t const& path, geo::PlaneGeo::WireNodes_t& wireNodes) const;
+
     /// @}
     // --- END Plane information -----------------------------------------------
 
@@ -378,6 +410,37 @@ namespace geo {
     /// Returns whether the specified node is recognised as a wire.
     bool isWireNode(TGeoNode const& node) const;
 
+    /// Kinds of geometry nodes, as bits of the result of `nodeKinds()`.
+    enum NodeKind : unsigned int {
+      AuxDetNode = 0x01,
+      AuxDetSensitiveNode = 0x02,
+      CryostatNode = 0x04,
+      OpDetNode = 0x08,
+      TPCNode = 0x10,
+      PlaneNode = 0x20,
+      WireNode = 0x40
+    }; // NodeKind
+
+    /**
+     * @brief Returns all the kinds the specified node is recognised as.
+     * @return a bit mask of `NodeKind` values
+     *
+     * The node names are checked only the first time a node is met, and the
+     * result is cached. The same node object is met once for each placement
+     * of its mother volume (e.g. the wires of all the identical planes), so
+     * most of the nodes of a detector are classified from the cache.
+     * The cache entries are allocated from a pool owned by the builder, which
+     * keeps them together and away from the general heap.
+     * This method can be called concurrently.
+     */
+    unsigned int nodeKinds(TGeoNode const& node) const;
+
+    /// Classifies the node from its name (see `nodeKinds()`).
+    unsigned int classifyNode(TGeoNode const& node) const;
+
+    /// Forgets all the classified nodes; the top-level extractions call it.
+    void clearNodeKinds();
+
     /// @}
     // --- END Note type identification ----------------------------------------
 
@@ -389,6 +452,21 @@ namespace geo {
     }
 
   private:
+    /// Cache of the kinds of the nodes (see `nodeKinds()`); never copied.
+    struct NodeKindCache_t {
+      using Kinds_t = std::pmr::unordered_map<TGeoNode const*, unsigned int>;
+
+      mutable std::shared_mutex mutex; ///< Protects `kinds` and `memory`.
+      lar::util::PoolArena memory;     ///< Memory of `kinds`.
+      Kinds_t kinds{&memory};          ///< Kinds of each node.
+
+      NodeKindCache_t() = default;
+      NodeKindCache_t(NodeKindCache_t const&) {}
+      NodeKindCache_t& operator=(NodeKindCache_t const&) { return *this; }
+    }; // NodeKindCache_t
+
+    mutable NodeKindCache_t fNodeKinds; ///< Kinds of the nodes met so far.
+
     /**
      * @brief Boilerplate implementation of `doExtractXxxx()` methods.
      * @tparam ObjGeo the geometry object being extracted (e.g. `geo::WireGeo`)
@@ -403,6 +481,9 @@ namespace geo {
      * For each candidate node, a `ObjGeo` is created. All descendents of the
      * candidates are ignored.
      *
+     * The candidates are counted first, and each object is then constructed
+     * directly in its place in the returned collection.
+     *
      * @note Multithreading note: `path` is allowed to change during processing.
      */
     template <typename ObjGeo,
@@ -410,6 +491,38 @@ namespace geo {
               ObjGeo (geo::GeometryBuilderStandard::*MakeObj)(Path_t&)>
     GeoColl_t<ObjGeo> doExtractGeometryObjects(Path_t& path);
 
+    /**
+     * @brief Collects the paths of the candidate nodes under `path`.
+     * @tparam IsObj function to identify if a node is of the right type
+     * @param path the path to the starting node
+     * @param[out] paths the list where to add the paths of the candidates
+     *
+     * The candidates are the same, and in the same order, as the objects
+     * created by `doExtractGeometryObjects()` with the same `IsObj`.
+     */
+    template <bool (geo::GeometryBuilderStandard::*IsObj)(TGeoNode const&) const>
+    void collectGeometryPaths(Path_t& path, std::vector<Path_t>& paths);
+
+    /**
+     * @brief Calls `visit(path)` on each of the candidate nodes under `path`.
+     * @tparam IsObj function to identify if a node is of the right type
+     * @tparam Visitor type of callable taking a `Path_t&` argument
+     * @param path the path to the starting node
+     * @param visit the callable to call on each candidate
+     *
+     * The candidates are visited in the order of the objects created by
+     * `doExtractGeometryObjects()` with the same `IsObj`; `path` points to the
+     * candidate during its visit.
+     */
+    template <bool (geo::GeometryBuilderStandard::*IsObj)(TGeoNode const&) const,
+              typename Visitor>
+    void visitGeometryNodes(Path_t& path, Visitor&& visit);
+
+    /// Returns the number of candidates under `node` at `depth` (see
+    /// `visitGeometryNodes()`), without computing any transformation.
+    template <bool (geo::GeometryBuilderStandard::*IsObj)(TGeoNode const&) const>
+    std::size_t countGeometryNodes(TGeoNode const& node, Path_t::Depth_t depth) const;
+
   }; // class GeometryBuilderStandard
 
 } // namespace geo
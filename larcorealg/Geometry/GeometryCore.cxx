@@ -14,8 +14,14 @@
 #include "larcorealg/Geometry/AuxDetGeo.h"
 #include "larcorealg/Geometry/AuxDetSensitiveGeo.h"
 #include "larcorealg/Geometry/Decomposer.h" // geo::vect::dot()
+#include "larcorealg/Geometry/Exceptions.h" // geo::PositionLookupError
 #include "larcorealg/Geometry/GeometryBuilderStandard.h"
+#include "larcorealg/Geometry/GeometryImport.h"
 #include "larcorealg/Geometry/OpDetGeo.h"
+#include "larcorealg/Geometry/SharedGeometrySnapshot.h"
+#include "larcorealg/Geometry/details/FingerprintHasher.h"
+#include "larcorealg/Geometry/details/PathCrossings.h"
+#include "larcorealg/Geometry/details/extractMaxGeometryElements.h"
 #include "larcorealg/Geometry/geo_vectors_utils.h"                // geo::vect
 #include "larcorealg/Geometry/geo_vectors_utils_TVector.h"        // geo::vect
 #include "larcoreobj/SimpleTypesAndConstants/PhysicalConstants.h" // util::pi<>
@@ -29,24 +35,77 @@
 // ROOT includes
 #include <TGeoBBox.h>
 #include <TGeoManager.h>
+#include <TGeoMaterial.h>
 #include <TGeoMatrix.h>
+#include <TGeoMedium.h>
+#include <TGeoNavigator.h>
 #include <TGeoNode.h>
 #include <TGeoVolume.h>
+#include <TObjArray.h>
 // #include <Rtypes.h>
 
 // C/C++ includes
 #include <algorithm> // std::for_each(), std::transform()
+#include <array>
+#include <cassert>
 #include <cctype>    // ::tolower()
 #include <cmath>     // std::abs() ...
 #include <cstddef>   // size_t
-#include <iterator>  // std::back_inserter()
+#include <cstdint>   // std::uint64_t
+#include <iterator>  // std::back_inserter(), std::prev()
 #include <limits>    // std::numeric_limits<>
+#include <memory>    // std::make_unique()
 #include <numeric>   // std::accumulate
+#include <optional>
 #include <sstream>   // std::ostringstream
+#include <string>
 #include <tuple>
+#include <typeinfo>
 #include <utility> // std::swap()
 #include <vector>
 
+namespace {
+
+  /// Returns the range of `t` where `start + t delta` is in `box`, within [0, 1].
+  /// The range is empty (first larger than second) if there is no such `t`.
+  std::pair<double, double> clipToBox(geo::BoxBoundedGeo const& box,
+                                      geo::Point_t const& start,
+                                      geo::Vector_t const& delta)
+  {
+    double const origin[3] = {start.X(), start.Y(), start.Z()};
+    double const step[3] = {delta.X(), delta.Y(), delta.Z()};
+    double const lower[3] = {box.MinX(), box.MinY(), box.MinZ()};
+    double const upper[3] = {box.MaxX(), box.MaxY(), box.MaxZ()};
+    double tMin = 0.0, tMax = 1.0;
+    for (std::size_t k = 0; k < 3; ++k) {
+      if (step[k] == 0.0) {
+        if ((origin[k] < lower[k]) || (origin[k] > upper[k])) return {1.0, 0.0};
+        continue;
+      }
+      double t1 = (lower[k] - origin[k]) / step[k];
+      double t2 = (upper[k] - origin[k]) / step[k];
+      if (t1 > t2) std::swap(t1, t2);
+      tMin = std::max(tMin, t1);
+      tMax = std::min(tMax, t2);
+    } // for
+    return {tMin, tMax};
+  } // clipToBox()
+
+  /// Returns the part of `objects` (in `mapper` order) with the elements of `parent`.
+  template <typename Mapper, typename Ptr>
+  util::span<typename std::vector<Ptr>::const_iterator> flatChildren(
+    Mapper const& mapper,
+    std::vector<Ptr> const& objects,
+    typename Mapper::ParentID_t const& parent)
+  {
+    unsigned int const n = mapper.count(parent);
+    if (n == 0U) return {objects.end(), objects.end()};
+    auto const first = objects.begin() + mapper.index(typename Mapper::ID_t{parent, 0});
+    return {first, first + n};
+  } // flatChildren()
+
+} // local namespace
+
 namespace geo {
 
   //......................................................................
@@ -59,23 +118,331 @@ namespace geo {
     , fDetectorName(pset.get<std::string>("Name"))
     , fMinWireZDist(pset.get<double>("MinWireZDist", 3.0))
     , fPositionWiggle(pset.get<double>("PositionEpsilon", 1.e-4))
+    , fUseDriftPartitions(pset.get<bool>("UseDriftPartitions", false))
     , fBuilderParameters(pset.get<fhicl::ParameterSet>("Builder", fhicl::ParameterSet()))
   {
     std::transform(fDetectorName.begin(), fDetectorName.end(), fDetectorName.begin(), ::tolower);
+
+    if (pset.get<bool>("NUMAReplicas", false)) EnableNUMAReplicas();
+
+    if (pset.has_key("CallProfiling")) {
+      auto const profiling = pset.get<fhicl::ParameterSet>("CallProfiling");
+      lar::debug::CallSiteProfiler::Config_t config;
+      config.sampleEvery = profiling.get<unsigned int>("SampleEvery", config.sampleEvery);
+      config.maxSamples = profiling.get<std::size_t>("MaxSamples", config.maxSamples);
+      EnableCallProfiling(config, profiling.get<std::size_t>("TopCallers", 10U));
+    }
+    if (pset.has_key("QueryMetrics")) {
+      auto const metrics = pset.get<fhicl::ParameterSet>("QueryMetrics");
+      lar::util::QueryMetrics::Config_t config;
+      config.timing = metrics.get<bool>("Timing", config.timing);
+      EnableQueryMetrics(config);
+    }
+    if (pset.has_key("QueryRecording")) {
+      auto const recording = pset.get<fhicl::ParameterSet>("QueryRecording");
+      geo::GeometryQueryRecorder::Config_t config;
+      config.sampleEvery = recording.get<unsigned int>("SampleEvery", config.sampleEvery);
+      config.maxQueries = recording.get<std::uint64_t>("MaxQueries", config.maxQueries);
+      EnableQueryRecording(recording.get<std::string>("File"), config);
+    }
+    if (pset.has_key("BuildSubset")) {
+      auto const subset = pset.get<fhicl::ParameterSet>("BuildSubset");
+      for (unsigned int const c : subset.get<std::vector<unsigned int>>("Cryostats", {}))
+        fBuildSubset.addCryostat(geo::CryostatID{c});
+      for (auto const& TPC : subset.get<std::vector<std::vector<unsigned int>>>("TPCs", {})) {
+        if (TPC.size() != 2U) {
+          throw cet::exception("GeometryCore")
+            << "BuildSubset.TPCs: each TPC must be a pair [ cryostat, TPC ], " << TPC.size()
+            << " numbers found\n";
+        }
+        fBuildSubset.addTPC(geo::TPCID{TPC[0], TPC[1]});
+      }
+    }
   } // GeometryCore::GeometryCore()
 
   //......................................................................
-  GeometryCore::~GeometryCore() { ClearGeometry(); } // GeometryCore::~GeometryCore()
+  GeometryCore::~GeometryCore()
+  {
+    if (fCallProfiler) {
+      mf::LogInfo log("GeometryCore");
+      fCallProfiler->report(log, fCallProfilerTopCallers);
+    }
+    if (fQueryMetrics) {
+      mf::LogInfo log("GeometryCore");
+      fQueryMetrics->print(log);
+      if (fChannelMapAlg && fChannelMapAlg->Metrics()) {
+        log << "\nChannel mapping ";
+        fChannelMapAlg->Metrics()->print(log);
+      }
+    }
+    if (fQueryRecorder) {
+      mf::LogInfo("GeometryCore") << fQueryRecorder->recordedQueries() << " of "
+                                  << fQueryRecorder->seenQueries()
+                                  << " geometry queries recorded into '"
+                                  << fQueryRecorder->path() << "'";
+      fQueryRecorder.reset();
+    }
+    ClearGeometry();
+  } // GeometryCore::~GeometryCore()
+
+  //......................................................................
+  std::vector<std::string> GeometryCore::QueryNames()
+  {
+    // names in the order of `Query_t`
+    std::vector<std::string> names{
+      "NearestWireID", "FindTPCAtPosition", "ChannelToWire", "ChannelToWireIDs", "WireIDsIntersect"};
+    assert(names.size() == static_cast<std::size_t>(Query_t::NQueries));
+    return names;
+  } // GeometryCore::QueryNames()
+
+  //......................................................................
+  void GeometryCore::EnableCallProfiling(lar::debug::CallSiteProfiler::Config_t const& config,
+                                         std::size_t topCallers /* = 10U */)
+  {
+    fCallProfiler = std::make_unique<lar::debug::CallSiteProfiler>(QueryNames(), config);
+    fCallProfilerTopCallers = topCallers;
+  } // GeometryCore::EnableCallProfiling()
+
+  //......................................................................
+  void GeometryCore::EnableQueryMetrics(lar::util::QueryMetrics::Config_t const& config)
+  {
+    fQueryMetrics = std::make_unique<lar::util::QueryMetrics>(QueryNames(), config);
+  } // GeometryCore::EnableQueryMetrics()
+
+  //......................................................................
+  void GeometryCore::EnableQueryRecording(std::string const& path,
+                                          geo::GeometryQueryRecorder::Config_t const& config)
+  {
+    fQueryRecorder.reset(); // completes the previous file first
+    fQueryRecorder = std::make_unique<geo::GeometryQueryRecorder>(path, config);
+    fQueryRecorder->setGeometryFingerprint(fFingerprint);
+  } // GeometryCore::EnableQueryRecording()
+
+  //......................................................................
+  void GeometryCore::EnableNUMAReplicas(bool enable /* = true */)
+  {
+    if (enable)
+      fHotTableReplicas.enable();
+    else
+      fHotTableReplicas.disable();
+    if (enable && !fHotTableReplicas.enabled()) {
+      mf::LogInfo("GeometryCore")
+        << "Single NUMA node: the lookup tables are not replicated.";
+    }
+  } // GeometryCore::EnableNUMAReplicas()
+
+  //......................................................................
+  std::size_t GeometryCore::HotTables_t::heapMemory() const
+  {
+    return lar::util::heapMemory(channelViews) +
+           ropChannelRanges.capacity() * sizeof(ChannelIDpair_t) +
+           lar::util::heapMemory(cryostatIndex) + lar::util::heapMemory(planeKernels) +
+           lar::util::heapMemory(channelROPs) + lar::util::heapMemory(ropIDs);
+  } // GeometryCore::HotTables_t::heapMemory()
+
+  //......................................................................
+  lar::util::MemoryUsageReport GeometryCore::MemoryUsage() const
+  {
+    lar::util::MemoryUsageReport report;
+
+    // the lists of cryostats and auxiliary detectors are accounted for here,
+    // except for their elements which are in their own components
+    CryostatList_t const& cryostats = Cryostats();
+    AuxDetList_t const& auxDets = AuxDets();
+    report.add("GeometryCore",
+               sizeof(*this) +
+                 (cryostats.capacity() - cryostats.size()) * sizeof(geo::CryostatGeo) +
+                 (auxDets.capacity() - auxDets.size()) * sizeof(geo::AuxDetGeo) +
+                 lar::util::heapMemory(fDetectorName) + lar::util::heapMemory(fGDMLfile) +
+                 lar::util::heapMemory(fROOTfile) + lar::util::heapMemory(fHotTables) +
+                 lar::util::heapMemory(fHotTableReplicas) +
+                 lar::util::heapMemory(fChannelWires) + lar::util::heapMemory(fChannelWireOffsets) +
+                 lar::util::heapMemory(fChannelsInTPCs) +
+                 (fTPCPtrs.capacity() + fPlanePtrs.capacity()) * sizeof(void const*) +
+                 lar::util::heapMemory(fFlatTPCs) + lar::util::heapMemory(fFlatPlanes) +
+                 lar::util::heapMemory(fFlatWires) +
+                 lar::util::heapMemory(fFirstOpDetInCryo) +
+                 lar::util::heapMemory(fOpChannelInfo) + lar::util::heapMemory(fOpDetChannels) +
+                 lar::util::heapMemory(fOpDetChannelOffsets) +
+                 lar::util::heapMemory(fQueryMetrics));
+
+    for (geo::CryostatGeo const& cryo : cryostats)
+      cryo.FillMemoryUsage(report);
+    for (geo::AuxDetGeo const& auxDet : auxDets)
+      auxDet.FillMemoryUsage(report);
+
+    if (auto const* driftVolumes = fDriftVolumes.getIfDone()) {
+      report.add("DriftPartitions",
+                 driftVolumes->capacity() * sizeof(geo::DriftPartitions) +
+                   lar::util::elementHeapMemory(driftVolumes->begin(), driftVolumes->end()),
+                 driftVolumes->size());
+    }
+
+    if (fTPCActiveTreeBuilt.done()) {
+      report.add("TPCActiveTree",
+                 fTPCActiveTree.heapMemory() + lar::util::heapMemory(fTPCActiveTreeIDs),
+                 fTPCActiveTree.size());
+    }
+
+    if (auto const* assns = fOpDetTPCAssns.getIfDone())
+      report.add("OpDetTPCAssociation", assns->heapMemory(), assns->nAssociations());
+
+    if (auto const* adjacency = fChannelAdjacency.getIfDone()) {
+      report.add("ChannelAdjacency",
+                 adjacency->heapMemory(),
+                 adjacency->nNeighbors() + adjacency->nCrossings());
+    }
+
+    if (auto const* index = fNodeNameIndex.getIfDone())
+      report.add("NodeNameIndex", lar::util::heapMemory(*index), index->size());
+
+    report.add("VolumeNames", fVolumeNames.heapMemory(), fVolumeNames.size());
+
+    if (fChannelMapAlg) report.add("ChannelMapAlg", fChannelMapAlg->MemoryUsage());
+
+    return report;
+  } // GeometryCore::MemoryUsage()
 
   //......................................................................
   void GeometryCore::ApplyChannelMap(std::unique_ptr<geo::ChannelMapAlg> pChannelMap)
   {
+    if (fQueryMetrics && !pChannelMap->Metrics())
+      pChannelMap->EnableQueryMetrics({fQueryMetrics->timing()});
+    auto start = geo::GeometryLoadReport::Clock_t::now();
     SortGeometry(pChannelMap->Sorter());
+    fLoadReport.addPhase("SortGeometry", start);
+
+    start = geo::GeometryLoadReport::Clock_t::now();
     UpdateAfterSorting(); // after channel mapping has sorted objects, set their IDs
+    if (!fBuildSubset.isWholeDetector()) {
+      for (geo::CryostatGeo& cryo : Cryostats())
+        cryo.ReleaseWiresOutside(fBuildSubset);
+    }
+    fLoadReport.addPhase("UpdateAfterSorting", start);
+
+    start = geo::GeometryLoadReport::Clock_t::now();
     pChannelMap->Initialize(fGeoData);
+    pChannelMap->PrepareChannelToWireIDs(fGeoData);
+    pChannelMap->PreparePlaneIDIndex();
+    pChannelMap->PrepareReadoutIndex(fGeoData);
+    pChannelMap->PrepareAuxDetIndex(AuxDets());
     fChannelMapAlg = move(pChannelMap);
+    fLoadReport.addPhase("ChannelMapAlg::Initialize", start);
+
+    start = geo::GeometryLoadReport::Clock_t::now();
+
+    // cache the view of each channel
+    std::vector<geo::View_t>& channelViews = fHotTables.channelViews;
+    channelViews.clear();
+    for (geo::WireID const& wireID : IterateWireIDs()) {
+      raw::ChannelID_t const channel = PlaneWireToChannel(wireID);
+      if (!raw::isValidChannelID(channel)) continue;
+      if (channel >= channelViews.size()) channelViews.resize(channel + 1, geo::kUnknown);
+      channelViews[channel] = View(ChannelToROP(channel));
+    } // for
+
+    fChannelsInTPCs = CollectChannelsInTPCs();
+
+    BuildOpChannelTables();
+
+    // channel range of each readout plane
+    fHotTables.ropChannelRanges = makeROPdata<ChannelIDpair_t>();
+    for (readout::ROPID const& ropid : IterateROPIDs()) {
+      raw::ChannelID_t const first = FirstChannelInROP(ropid);
+      if (!raw::isValidChannelID(first)) continue;
+      fHotTables.ropChannelRanges[ropid] = {first, first + Nchannels(ropid)};
+    } // for
+
+    // number of the ROP of each channel, for RouteChannels()
+    BuildChannelROPTable();
+
+    // the per-node copies of the hot tables are made again on demand
+    fHotTableReplicas.reset();
+
+    // the wire objects of each channel are tabulated on demand (ChannelToWireGeos())
+    fChannelWires.clear();
+    fChannelWireOffsets.clear();
+    fChannelWiresBuilt.reset();
+    fChannelAdjacency.reset();
+
+    // the names of all the volumes, interned once (VolumeHandle())
+    fVolumeNames.clear();
+    if (TObjArray const* volumes = ROOTGeoManager()->GetListOfVolumes()) {
+      for (Int_t i = 0; i < volumes->GetEntriesFast(); ++i) {
+        auto const* volume = static_cast<TGeoVolume const*>(volumes->At(i));
+        if (volume) fVolumeNames.add(volume->GetName(), volume->GetNumber());
+      }
+    }
+
+    fFingerprint = ComputeFingerprint();
+    if (fQueryRecorder) fQueryRecorder->setGeometryFingerprint(fFingerprint);
+    fLoadReport.addPhase("ChannelTables", start);
+    fLoadReport.setCount("Channels", Nchannels());
+    fLoadReport.setCount("OpChannels", NOpChannels());
+
+    mf::LogInfo log("GeometryCore");
+    log << "Time spent loading the geometry:\n";
+    fLoadReport.print(log, "  ");
   } // GeometryCore::ApplyChannelMap()
 
+  //......................................................................
+  void GeometryCore::ApplyAlignment(geo::GeometryAlignment const& alignment)
+  {
+    if (!fChannelMapAlg) {
+      throw cet::exception("GeometryCore")
+        << "ApplyAlignment(): no channel mapping applied to the geometry yet!\n";
+    }
+    for (auto const& [tpcid, delta] : alignment.TPCs) {
+      if (!HasTPC(tpcid)) {
+        throw cet::exception("GeometryCore")
+          << "ApplyAlignment(): no " << std::string(tpcid) << " in the geometry!\n";
+      }
+    }
+    for (auto const& [planeid, delta] : alignment.planes) {
+      if (!HasPlane(planeid)) {
+        throw cet::exception("GeometryCore")
+          << "ApplyAlignment(): no " << std::string(planeid) << " in the geometry!\n";
+      }
+    }
+    if (alignment.empty()) return;
+
+    for (geo::CryostatGeo& cryo : Cryostats())
+      cryo.ApplyAlignment(alignment, fTaskRunner);
+
+    fChannelMapAlg->UpdateAlignment(fGeoData);
+    UpdatePlaneKernels();
+
+    // drift volumes are built on demand (AllDriftVolumes())
+    fDriftVolumes.reset();
+    fOpDetTPCAssns.reset();
+    fTPCActiveTree.clear();
+    fTPCActiveTreeIDs.clear();
+    fTPCActiveTreeBuilt.reset();
+    fChannelAdjacency.reset();
+
+    fFingerprint = ComputeFingerprint();
+    if (fQueryRecorder) fQueryRecorder->setGeometryFingerprint(fFingerprint);
+
+    mf::LogInfo("GeometryCore") << "Alignment applied to " << alignment.TPCs.size()
+                                << " TPCs and " << alignment.planes.size() << " wire planes.";
+
+  } // GeometryCore::ApplyAlignment()
+
+  //......................................................................
+  void GeometryCore::BuildDerivedCaches() const
+  {
+    if (!fChannelMapAlg) {
+      throw cet::exception("GeometryCore")
+        << "BuildDerivedCaches(): no channel mapping applied to the geometry yet!\n";
+    }
+    ChannelToWireGeos(raw::ChannelID_t{0});
+    WorldBox();
+    VolumeNodeIndex();
+    AllDriftVolumes();
+    TPCActiveTree();
+    OpDetTPCAssns();
+  } // GeometryCore::BuildDerivedCaches()
+
   //......................................................................
   void GeometryCore::LoadGeometryFile(std::string gdmlfile,
                                       std::string rootfile,
@@ -92,39 +459,12 @@ namespace geo {
       throw cet::exception("GeometryCore") << "No ROOT Geometry file specified!\n";
     }
 
-    ClearGeometry();
+    fLoadReport.clear();
+    auto const start = geo::GeometryLoadReport::Clock_t::now();
+    TGeoNode const* topNode = geo::ImportROOTGeometry(rootfile, bForceReload);
+    fLoadReport.addPhase("Import", start);
 
-    // Open the GDML file, and convert it into ROOT TGeoManager format.
-    // Then lock the gGeoManager to prevent future imports, for example
-    // in AuxDetGeometry
-    if (!gGeoManager || bForceReload) {
-      if (gGeoManager)
-        TGeoManager::UnlockGeometry();
-      else { // very first time (or so it should)
-        // [20210630, petrillo@slac.stanford.edu]
-        // ROOT 6.22.08 allows us to choose the representation of lengths
-        // in the geometry objects parsed from GDML.
-        // In LArSoft we want them to be centimeters (ROOT standard).
-        // This was tracked as Redmine issue #25990, and I leave this mark
-        // because I feel that we'll be back to it not too far in the future.
-        // Despite the documentation (ROOT 6.22/08),
-        // it seems the units are locked from the beginning,
-        // so we unlock without prejudice.
-        TGeoManager::LockDefaultUnits(false);
-        TGeoManager::SetDefaultUnits(TGeoManager::kRootUnits);
-        TGeoManager::LockDefaultUnits(true);
-      }
-      TGeoManager::Import(rootfile.c_str());
-      gGeoManager->LockGeometry();
-    }
-
-    BuildGeometry(builder);
-
-    fGDMLfile = gdmlfile;
-    fROOTfile = rootfile;
-
-    mf::LogInfo("GeometryCore") << "New detector geometry loaded from "
-                                << "\n\t" << fROOTfile << "\n\t" << fGDMLfile << "\n";
+    BuildImportedGeometry(gdmlfile, rootfile, topNode, builder);
 
   } // GeometryCore::LoadGeometryFile()
 
@@ -134,20 +474,104 @@ namespace geo {
                                       bool bForceReload /* = false*/
   )
   {
-    fhicl::Table<geo::GeometryBuilderStandard::Config> const builderConfig(fBuilderParameters,
-                                                                           {"tool_type"});
+    fhicl::Table<geo::GeometryBuilderStandard::Config> const builderConfig(
+      StandardBuilderParameters(), {"tool_type"});
 
     // this is a wink to the understanding that we might be using a art-based
     // service provider configuration sprinkled with tools.
     geo::GeometryBuilderStandard builder{builderConfig()};
+    builder.setTaskRunner(fTaskRunner);
     LoadGeometryFile(gdmlfile, rootfile, builder, bForceReload);
   } // GeometryCore::LoadGeometryFile()
 
+  //......................................................................
+  void GeometryCore::LoadImportedGeometry(std::string gdmlfile,
+                                          std::string rootfile,
+                                          TGeoNode const* topNode,
+                                          geo::GeometryBuilder& builder)
+  {
+    fLoadReport.clear();
+    BuildImportedGeometry(std::move(gdmlfile), std::move(rootfile), topNode, builder);
+  } // GeometryCore::LoadImportedGeometry()
+
+  //......................................................................
+  void GeometryCore::BuildImportedGeometry(std::string gdmlfile,
+                                           std::string rootfile,
+                                           TGeoNode const* topNode,
+                                           geo::GeometryBuilder& builder)
+  {
+    if (gdmlfile.empty()) {
+      throw cet::exception("GeometryCore") << "No GDML Geometry file specified!\n";
+    }
+
+    if (rootfile.empty()) {
+      throw cet::exception("GeometryCore") << "No ROOT Geometry file specified!\n";
+    }
+
+    if (!topNode) {
+      throw cet::exception("GeometryCore") << "No ROOT geometry imported from '" << rootfile
+                                           << "'!\n";
+    }
+
+    ClearGeometry();
+
+    BuildGeometry(builder, topNode);
+
+    fGDMLfile = gdmlfile;
+    fROOTfile = rootfile;
+
+    mf::LogInfo("GeometryCore") << "New detector geometry loaded from "
+                                << "\n\t" << fROOTfile << "\n\t" << fGDMLfile << "\n";
+
+  } // GeometryCore::BuildImportedGeometry()
+
+  //......................................................................
+  void GeometryCore::LoadImportedGeometry(std::string gdmlfile,
+                                          std::string rootfile,
+                                          TGeoNode const* topNode)
+  {
+    fhicl::Table<geo::GeometryBuilderStandard::Config> const builderConfig(
+      StandardBuilderParameters(), {"tool_type"});
+    geo::GeometryBuilderStandard builder{builderConfig()};
+    builder.setTaskRunner(fTaskRunner);
+    LoadImportedGeometry(gdmlfile, rootfile, topNode, builder);
+  } // GeometryCore::LoadImportedGeometry()
+
   //......................................................................
   void GeometryCore::ClearGeometry()
   {
     Cryostats().clear();
     AuxDets().clear();
+    fHotTableReplicas.reset();
+    fHotTables.cryostatIndex.clear();
+    fTPCPtrs.clear();
+    fPlanePtrs.clear();
+    fTPCIDmapper.clear();
+    fPlaneIDmapper.clear();
+    fWireIDmapper.clear();
+    fFlatTPCs.clear();
+    fFlatPlanes.clear();
+    fFlatWires.clear();
+    fFlatWiresBuilt.reset();
+    fHotTables.planeKernels.clear();
+    UpdateMaxElements();
+    fDriftVolumes.reset();
+    fOpDetTPCAssns.reset();
+    fTPCActiveTree.clear();
+    fTPCActiveTreeIDs.clear();
+    fTPCActiveTreeBuilt.reset();
+    fFirstOpDetInCryo.clear();
+    fNOpChannels = 0U;
+    fOpChannelInfo.clear();
+    fOpDetChannelOffsets.clear();
+    fOpDetChannels.clear();
+    fNavigatorPool.clear();
+    fWorldBox.reset();
+    fDetectorEnclosureBox.reset();
+    fEnclosureBoxes.clear();
+    fNodeNameIndex.reset();
+    fVolumeNames.clear();
+    fFingerprint = 0U;
   }
 
   //......................................................................
@@ -160,8 +584,8 @@ namespace geo {
 
     geo::CryostatID::CryostatID_t c = 0;
     for (geo::CryostatGeo& cryo : Cryostats()) {
-      cryo.SortSubVolumes(sorter);
-      cryo.UpdateAfterSorting(geo::CryostatID(c));
+      cryo.SortSubVolumes(sorter, fTaskRunner);
+      cryo.UpdateAfterSorting(geo::CryostatID(c), fTaskRunner);
       ++c;
     } // for
 
@@ -172,7 +596,9 @@ namespace geo {
   {
 
     for (size_t c = 0; c < Ncryostats(); ++c)
-      Cryostats()[c].UpdateAfterSorting(geo::CryostatID(c));
+      Cryostats()[c].UpdateAfterSorting(geo::CryostatID(c), fTaskRunner);
+
+    UpdateMaxElements();
 
     allViews.clear();
     for (geo::TPCGeo const& tpc : IterateTPCs()) {
@@ -180,11 +606,64 @@ namespace geo {
       allViews.insert(TPCviews.cbegin(), TPCviews.cend());
     }
 
+    // optical detector numbering: cumulative count of detectors per cryostat
+    fFirstOpDetInCryo.assign(1U, 0U);
+    for (geo::CryostatGeo const& cryo : IterateCryostats())
+      fFirstOpDetInCryo.push_back(fFirstOpDetInCryo.back() + cryo.NOpDet());
+
+    fHotTables.cryostatIndex.build(
+      Cryostats(), std::max(geo::details::BoxGridIndex::DefaultWiggle, 1.0 + fPositionWiggle));
+
+    // direct access tables for the unchecked accessors
+    fTPCPtrs = makeTPCData<geo::TPCGeo const*>(nullptr);
+    for (geo::TPCGeo const& tpc : IterateTPCs())
+      fTPCPtrs[tpc.ID()] = &tpc;
+    fPlanePtrs = makePlaneData<geo::PlaneGeo const*>(nullptr);
+    for (geo::PlaneGeo const& plane : IteratePlanes())
+      fPlanePtrs[plane.ID()] = &plane;
+
+    // flat mappings of the existing IDs
+    fTPCIDmapper = geo::CompressedTPCIDmapper<>{
+      {Ncryostats()}, [this](geo::CryostatID const& cid) { return NTPC(cid); }};
+    fPlaneIDmapper = geo::CompressedPlaneIDmapper<>{
+      {Ncryostats(), MaxTPCs()},
+      [this](geo::TPCID const& tpcid) { return HasTPC(tpcid) ? TPC(tpcid).Nplanes() : 0U; }};
+    fWireIDmapper = geo::CompressedWireIDmapper<>{
+      {Ncryostats(), MaxTPCs(), MaxPlanes()},
+      [this](geo::PlaneID const& pid) { return HasPlane(pid) ? Plane(pid).Nwires() : 0U; }};
+    UpdatePlaneKernels();
+
+    // objects by flat index (the iteration order is the flat one);
+    // the wires are tabulated on demand (FlatWires())
+    fFlatTPCs.clear();
+    fFlatTPCs.reserve(fTPCIDmapper.size());
+    for (geo::TPCGeo const& tpc : IterateTPCs())
+      fFlatTPCs.push_back(&tpc);
+    fFlatPlanes.clear();
+    fFlatPlanes.reserve(fPlaneIDmapper.size());
+    for (geo::PlaneGeo const& plane : IteratePlanes())
+      fFlatPlanes.push_back(&plane);
+    fFlatWires.clear();
+    fFlatWiresBuilt.reset();
+
+    // drift volumes are built on demand (AllDriftVolumes())
+    fDriftVolumes.reset();
+    fOpDetTPCAssns.reset();
+    fTPCActiveTree.clear();
+    fTPCActiveTreeIDs.clear();
+    fTPCActiveTreeBuilt.reset();
+
   } // GeometryCore::UpdateAfterSorting()
 
   //......................................................................
   TGeoManager* GeometryCore::ROOTGeoManager() const { return gGeoManager; }
 
+  //......................................................................
+  TGeoNavigator& GeometryCore::ROOTNavigator() const
+  {
+    return fNavigatorPool.navigator(*ROOTGeoManager());
+  }
+
   //......................................................................
   unsigned int GeometryCore::Nchannels() const { return fChannelMapAlg->Nchannels(); }
 
@@ -196,13 +675,22 @@ namespace geo {
 
   //......................................................................
 
-  std::vector<raw::ChannelID_t> GeometryCore::ChannelsInTPCs() const
+  auto GeometryCore::ROPChannels(readout::ROPID const& ropid) const -> ChannelIDrange_t
+  {
+    auto const& ropChannelRanges = HotTables().ropChannelRanges;
+    if (!ropid.isValid || !ropChannelRanges.hasElement(ropid)) return {};
+    auto const [first, last] = ropChannelRanges[ropid];
+    return util::counter(first, last);
+  } // GeometryCore::ROPChannels()
+
+  //......................................................................
+  std::vector<raw::ChannelID_t> GeometryCore::CollectChannelsInTPCs() const
   {
     std::vector<raw::ChannelID_t> channels;
     channels.reserve(fChannelMapAlg->Nchannels());
 
     for (const readout::TPCsetID& ts : IterateTPCsetIDs()) {
-      for (auto const t : fChannelMapAlg->TPCsetToTPCs(ts)) {
+      for (geo::TPCID const& t : fChannelMapAlg->TPCsetToTPCIDs(ts)) {
         for (auto const& wire : IterateWireIDs(t)) {
           channels.push_back(fChannelMapAlg->PlaneWireToChannel(wire));
         }
@@ -212,59 +700,96 @@ namespace geo {
     auto last = std::unique(channels.begin(), channels.end());
     channels.erase(last, channels.end());
     return channels;
-  }
+  } // GeometryCore::CollectChannelsInTPCs()
+
+  //......................................................................
+  std::uint64_t GeometryCore::ComputeFingerprint() const
+  {
+    geo::details::FingerprintHasher hasher;
+    hasher.add(DetectorName());
+
+    hasher.add(std::uint64_t{Ncryostats()});
+    for (geo::CryostatGeo const& cryo : IterateCryostats()) {
+      hasher.add(cryo.BoundingBox());
+      hasher.add(std::uint64_t{cryo.NTPC()});
+      for (geo::TPCGeo const& TPC : cryo.IterateTPCs()) {
+        hasher.add(TPC.BoundingBox());
+        hasher.add(TPC.ActiveBoundingBox());
+        hasher.addVector(TPC.DriftDir<geo::Vector_t>());
+        hasher.add(std::uint64_t{TPC.Nplanes()});
+        for (geo::PlaneGeo const& plane : TPC.IteratePlanes()) {
+          hasher.addVector(plane.GetCenter<geo::Point_t>());
+          hasher.addVector(plane.GetNormalDirection<geo::Vector_t>());
+          hasher.addVector(plane.WidthDir<geo::Vector_t>());
+          hasher.addVector(plane.DepthDir<geo::Vector_t>());
+          hasher.add(plane.WirePitch());
+          hasher.add(std::uint64_t(plane.View()));
+          unsigned int const nWires = plane.Nwires();
+          hasher.add(std::uint64_t{nWires});
+          if (nWires == 0) continue;
+          for (unsigned int const wireNo : {0U, nWires - 1U}) {
+            geo::WireGeo const wire = plane.BuildWire(wireNo);
+            hasher.addVector(wire.GetStart<geo::Point_t>());
+            hasher.addVector(wire.GetEnd<geo::Point_t>());
+            hasher.add(std::uint64_t{PlaneWireToChannel(geo::WireID{plane.ID(), wireNo})});
+          }
+        } // for planes
+      }   // for TPCs
+    }     // for cryostats
+
+    if (fChannelMapAlg) {
+      geo::ChannelMapAlg const& channelMap = *fChannelMapAlg;
+      hasher.add(std::string{typeid(channelMap).name()});
+      hasher.add(std::uint64_t{fChannelMapAlg->Nchannels()});
+    }
+    return hasher.value();
+  } // GeometryCore::ComputeFingerprint()
 
   //......................................................................
   unsigned int GeometryCore::NOpDets() const
   {
-    int N = 0;
-    for (size_t cstat = 0; cstat != Ncryostats(); cstat++)
-      N += this->Cryostat(cstat).NOpDet();
-    return N;
-  }
-
-  //......................................................................
-  unsigned int GeometryCore::NOpChannels() const
-  {
-    return fChannelMapAlg->NOpChannels(this->NOpDets());
+    return fFirstOpDetInCryo.empty() ? 0U : fFirstOpDetInCryo.back();
   }
 
   //......................................................................
-  unsigned int GeometryCore::MaxOpChannel() const
+  void GeometryCore::OpDetsFromOpChannels(util::span<unsigned int const*> opChannels,
+                                          util::span<unsigned int*> opDets) const
   {
-    return fChannelMapAlg->MaxOpChannel(this->NOpDets());
-  }
-
-  //......................................................................
-  unsigned int GeometryCore::NOpHardwareChannels(int opDet) const
-  {
-    return fChannelMapAlg->NOpHardwareChannels(opDet);
-  }
-
-  //......................................................................
-  unsigned int GeometryCore::OpChannel(int detNum, int hardwareChannel) const
-  {
-    return fChannelMapAlg->OpChannel(detNum, hardwareChannel);
-  }
+    if (opDets.size() < opChannels.size()) {
+      throw cet::exception("GeometryCore")
+        << "OpDetsFromOpChannels(): " << opChannels.size() << " channels but room for only "
+        << opDets.size() << " results\n";
+    }
+    unsigned int* iOpDet = opDets.begin();
+    for (unsigned int const opChannel : opChannels)
+      *(iOpDet++) = OpDetFromOpChannel(opChannel);
+  } // GeometryCore::OpDetsFromOpChannels()
 
   //......................................................................
-  unsigned int GeometryCore::OpDetFromOpChannel(int opChannel) const
+  void GeometryCore::BuildOpChannelTables()
   {
-    return fChannelMapAlg->OpDetFromOpChannel(opChannel);
-  }
+    unsigned int const nOpDets = NOpDets();
+    fNOpChannels = fChannelMapAlg->NOpChannels(nOpDets);
 
-  //......................................................................
-  unsigned int GeometryCore::HardwareChannelFromOpChannel(int opChannel) const
-  {
-    return fChannelMapAlg->HardwareChannelFromOpChannel(opChannel);
-  }
+    // all the channel numbers up to the largest one; only the valid ones are
+    // asked to the mapping
+    unsigned int const maxOpChannel = fChannelMapAlg->MaxOpChannel(nOpDets);
+    fOpChannelInfo.assign(maxOpChannel, {NoOpDet, 0U});
+    for (unsigned int opChannel = 0; opChannel < maxOpChannel; ++opChannel) {
+      if (!fChannelMapAlg->IsValidOpChannel(opChannel, nOpDets)) continue;
+      fOpChannelInfo[opChannel] = {fChannelMapAlg->OpDetFromOpChannel(opChannel),
+                                   fChannelMapAlg->HardwareChannelFromOpChannel(opChannel)};
+    }
 
-  //......................................................................
-  // Is this a valid OpChannel number?
-  bool GeometryCore::IsValidOpChannel(int opChannel) const
-  {
-    return fChannelMapAlg->IsValidOpChannel(opChannel, this->NOpDets());
-  }
+    fOpDetChannelOffsets.assign(1U, 0U);
+    fOpDetChannels.clear();
+    for (unsigned int opDet = 0; opDet < nOpDets; ++opDet) {
+      unsigned int const nHardwareChannels = fChannelMapAlg->NOpHardwareChannels(opDet);
+      for (unsigned int hwChannel = 0; hwChannel < nHardwareChannels; ++hwChannel)
+        fOpDetChannels.push_back(fChannelMapAlg->OpChannel(opDet, hwChannel));
+      fOpDetChannelOffsets.push_back(fOpDetChannels.size());
+    }
+  } // GeometryCore::BuildOpChannelTables()
 
   //......................................................................
   unsigned int GeometryCore::NAuxDetSensitive(size_t const& aid) const
@@ -318,6 +843,30 @@ namespace geo {
 
   //......................................................................
   geo::TPCID GeometryCore::FindTPCAtPosition(geo::Point_t const& point) const
+  {
+    auto const query = StartQuery(Query_t::FindTPCAtPosition);
+    RecordQuery(RecordedKind_t::FindTPCAtPosition, point);
+    geo::TPCID const tpcid = LocateTPCAtPosition(point);
+    if (!tpcid.isValid) query.miss();
+    return tpcid;
+  } // GeometryCore::FindTPCAtPosition()
+
+  //......................................................................
+  geo::TPCID GeometryCore::FindTPCAtPosition(geo::Point_t const& point,
+                                             geo::TPCID const& hint) const
+  {
+    auto const query = StartQuery(Query_t::FindTPCAtPosition);
+    RecordQuery(
+      RecordedKind_t::FindTPCAtPositionWithHint, point, geo::PlaneID{hint, geo::PlaneID::InvalidID});
+    geo::TPCGeo const* tpc = PositionToTPCptr(point, hint);
+    if (tpc) return tpc->ID();
+    geo::TPCID const tpcid = LocateTPCAtPosition(point);
+    if (!tpcid.isValid) query.miss();
+    return tpcid;
+  } // GeometryCore::FindTPCAtPosition(hint)
+
+  //......................................................................
+  geo::TPCID GeometryCore::LocateTPCAtPosition(geo::Point_t const& point) const
   {
 
     // first find the cryostat
@@ -325,21 +874,31 @@ namespace geo {
     if (!cryo) return {};
 
     // then ask it about the TPC
-    geo::TPCID tpcid = cryo->PositionToTPCID(point, 1. + fPositionWiggle);
-    if (tpcid) return tpcid;
+    geo::TPCGeo const* tpc = PositionToTPCptrInCryostat(*cryo, point);
+    if (tpc) return tpc->ID();
 
     // return an invalid TPC ID with cryostat information set:
+    geo::TPCID tpcid;
     tpcid.Cryostat = cryo->ID().Cryostat;
     tpcid.markInvalid();
     return tpcid;
 
-  } // GeometryCore::FindTPCAtPosition()
+  } // GeometryCore::LocateTPCAtPosition()
 
   //......................................................................
   geo::CryostatGeo const* GeometryCore::PositionToCryostatPtr(geo::Point_t const& point) const
   {
+    double const wiggle = 1.0 + fPositionWiggle;
+    geo::details::BoxGridIndex const& cryostatIndex = HotTables().cryostatIndex;
+    if (cryostatIndex.covers(wiggle)) {
+      for (unsigned int const iCryo : cryostatIndex.candidates(point)) {
+        geo::CryostatGeo const& cryostat = Cryostats()[iCryo];
+        if (cryostat.ContainsPosition(point, wiggle)) return &cryostat;
+      }
+      return nullptr;
+    }
     for (geo::CryostatGeo const& cryostat : IterateCryostats()) {
-      if (cryostat.ContainsPosition(point, 1.0 + fPositionWiggle)) return &cryostat;
+      if (cryostat.ContainsPosition(point, wiggle)) return &cryostat;
     }
     return nullptr;
   } // GeometryCore::PositionToCryostatPtr()
@@ -351,6 +910,25 @@ namespace geo {
     return cryo ? cryo->ID() : geo::CryostatID{};
   } // GeometryCore::PositionToCryostatID()
 
+  //......................................................................
+  void GeometryCore::PositionsToCryostatIDs(util::span<geo::Point_t const*> points,
+                                            util::span<geo::CryostatID*> cryoids) const
+  {
+    if (cryoids.size() < points.size()) {
+      throw cet::exception("GeometryCore")
+        << "PositionsToCryostatIDs(): " << points.size() << " points but room for only "
+        << cryoids.size() << " cryostat IDs\n";
+    }
+
+    double const wiggle = 1.0 + fPositionWiggle;
+    geo::CryostatGeo const* cryo = nullptr; // last cryostat found
+    auto iCryoID = cryoids.begin();
+    for (geo::Point_t const& point : points) {
+      if (!cryo || !cryo->ContainsPosition(point, wiggle)) cryo = PositionToCryostatPtr(point);
+      *iCryoID++ = cryo ? cryo->ID() : geo::CryostatID{};
+    }
+  } // GeometryCore::PositionsToCryostatIDs()
+
   //......................................................................
   geo::CryostatID::CryostatID_t GeometryCore::FindCryostatAtPosition(
     geo::Point_t const& worldLoc) const
@@ -369,16 +947,66 @@ namespace geo {
   geo::TPCGeo const* GeometryCore::PositionToTPCptr(geo::Point_t const& point) const
   {
     geo::CryostatGeo const* cryo = PositionToCryostatPtr(point);
-    return cryo ? cryo->PositionToTPCptr(point, 1. + fPositionWiggle) : nullptr;
+    return cryo ? PositionToTPCptrInCryostat(*cryo, point) : nullptr;
   } // GeometryCore::PositionToTPCptr()
 
+  //......................................................................
+  geo::TPCGeo const* GeometryCore::PositionToTPCptrInCryostat(geo::CryostatGeo const& cryo,
+                                                              geo::Point_t const& point) const
+  {
+    double const wiggle = 1. + fPositionWiggle;
+    if (fUseDriftPartitions) {
+      // the drift volumes use the full TPC boxes and no tolerance:
+      // their answer is kept only if it agrees with the standard test
+      geo::TPCGeo const* tpc = DriftVolumes(cryo.ID()).TPCat(point);
+      if (tpc && tpc->ContainsPosition(point, wiggle)) return tpc;
+    }
+    return cryo.PositionToTPCptr(point, wiggle);
+  } // GeometryCore::PositionToTPCptrInCryostat()
+
+  //......................................................................
+  geo::DriftPartitions const& GeometryCore::DriftVolumes(geo::CryostatID const& cryoid) const
+  {
+    std::vector<geo::DriftPartitions> const& volumes = AllDriftVolumes();
+    if (!cryoid.isValid || (cryoid.Cryostat >= volumes.size())) {
+      throw cet::exception("GeometryCore")
+        << "DriftVolumes(): no cryostat " << std::string(cryoid) << "\n";
+    }
+    return volumes[cryoid.Cryostat];
+  } // GeometryCore::DriftVolumes()
+
+  //......................................................................
+  std::vector<geo::DriftPartitions> const& GeometryCore::AllDriftVolumes() const
+  {
+    return fDriftVolumes.get([this]() {
+      std::vector<geo::DriftPartitions> volumes;
+      volumes.reserve(Ncryostats());
+      for (geo::CryostatGeo const& cryo : IterateCryostats())
+        volumes.push_back(geo::buildDriftVolumes(cryo));
+      return volumes;
+    });
+  } // GeometryCore::AllDriftVolumes()
+
+  //......................................................................
+  geo::TPCGeo const* GeometryCore::PositionToTPCptr(geo::Point_t const& point,
+                                                    geo::TPCID const& hint) const
+  {
+    double const wiggle = 1. + fPositionWiggle;
+    geo::CryostatGeo const* hintCryo = hint.isValid ? CryostatPtr(hint) : nullptr;
+    if (hintCryo) {
+      geo::TPCGeo const* tpc = hintCryo->PositionToTPCptr(point, wiggle, hint.TPC);
+      if (tpc) return tpc;
+    }
+    // different cryostat, or no TPC at all: the full search it is
+    geo::CryostatGeo const* cryo = PositionToCryostatPtr(point);
+    return (cryo && (cryo != hintCryo)) ? cryo->PositionToTPCptr(point, wiggle) : nullptr;
+  } // GeometryCore::PositionToTPCptr(hint)
+
   //......................................................................
   geo::TPCGeo const& GeometryCore::PositionToTPC(geo::Point_t const& point) const
   {
     geo::TPCGeo const* tpc = PositionToTPCptr(point);
-    if (!tpc) {
-      throw cet::exception("GeometryCore") << "Can't find any TPC at position " << point << "\n";
-    }
+    if (!tpc) throw geo::PositionLookupError("GeometryCore", "TPC", point);
     return *tpc;
   } // GeometryCore::PositionToTPC()
 
@@ -408,6 +1036,81 @@ namespace geo {
     return tpc ? tpc->ID() : geo::TPCID{};
   } // GeometryCore::PositionToTPCID()
 
+  //......................................................................
+  void GeometryCore::FindTPCsAtPositions(util::span<geo::Point_t const*> points,
+                                         util::span<geo::TPCID*> tpcids) const
+  {
+    if (tpcids.size() < points.size()) {
+      throw cet::exception("GeometryCore")
+        << "FindTPCsAtPositions(): " << points.size() << " points but room for only "
+        << tpcids.size() << " TPC IDs\n";
+    }
+
+    geo::TPCID hint; // last TPC found
+    auto iTPCID = tpcids.begin();
+    for (geo::Point_t const& point : points) {
+      *iTPCID = FindTPCAtPosition(point, hint);
+      if (*iTPCID) hint = *iTPCID;
+      ++iTPCID;
+    } // for
+  } // GeometryCore::FindTPCsAtPositions()
+
+  //......................................................................
+  std::vector<GeometryCore::TPCCrossing_t> GeometryCore::TPCCrossings(
+    TrajectorySpan_t trajectory) const
+  {
+    std::vector<TPCCrossing_t> crossings;
+    TPCCrossings(util::span<TrajectorySpan_t const*>{&trajectory, &trajectory + 1},
+                 util::span<std::vector<TPCCrossing_t>*>{&crossings, &crossings + 1});
+    return crossings;
+  } // GeometryCore::TPCCrossings()
+
+  //......................................................................
+  void GeometryCore::TPCCrossings(util::span<TrajectorySpan_t const*> trajectories,
+                                  util::span<std::vector<TPCCrossing_t>*> crossings) const
+  {
+    if (crossings.size() < trajectories.size()) {
+      throw cet::exception("GeometryCore")
+        << "TPCCrossings(): " << trajectories.size() << " trajectories but room for only "
+        << crossings.size() << " results\n";
+    }
+
+    geo::details::BoxBVH const& tree = TPCActiveTree();
+    std::vector<geo::details::PathCrossing_t> pathCrossings;
+    auto iCrossings = crossings.begin();
+    for (TrajectorySpan_t const& trajectory : trajectories) {
+      geo::details::findPathCrossings(tree, trajectory.begin(), trajectory.end(), pathCrossings);
+      std::vector<TPCCrossing_t>& tpcCrossings = *iCrossings++;
+      tpcCrossings.clear();
+      for (geo::details::PathCrossing_t const& crossing : pathCrossings) {
+        tpcCrossings.push_back({fTPCActiveTreeIDs[crossing.box],
+                                geo::vect::makeFromCoords<geo::Point_t>(crossing.entry),
+                                geo::vect::makeFromCoords<geo::Point_t>(crossing.exit),
+                                crossing.length});
+      }
+    } // for trajectories
+  } // GeometryCore::TPCCrossings(span)
+
+  //......................................................................
+  geo::details::BoxBVH const& GeometryCore::TPCActiveTree() const
+  {
+    fTPCActiveTreeBuilt.callOnce([this]() {
+      std::vector<geo::details::BoxBVH::Box_t> boxes;
+      std::vector<geo::TPCID> IDs;
+      boxes.reserve(TotalNTPC());
+      IDs.reserve(TotalNTPC());
+      for (geo::TPCGeo const& tpc : IterateTPCs()) {
+        geo::BoxBoundedGeo const& box = tpc.ActiveBoundingBox();
+        boxes.push_back(
+          {{box.MinX(), box.MinY(), box.MinZ()}, {box.MaxX(), box.MaxY(), box.MaxZ()}});
+        IDs.push_back(tpc.ID());
+      }
+      fTPCActiveTree.build(boxes);
+      fTPCActiveTreeIDs = std::move(IDs);
+    });
+    return fTPCActiveTree;
+  } // GeometryCore::TPCActiveTree()
+
   //......................................................................
   void GeometryCore::GetEndID(geo::TPCID& id) const
   {
@@ -435,10 +1138,7 @@ namespace geo {
   geo::CryostatGeo const& GeometryCore::PositionToCryostat(geo::Point_t const& point) const
   {
     geo::CryostatGeo const* cstat = PositionToCryostatPtr(point);
-    if (!cstat) {
-      throw cet::exception("GeometryCore")
-        << "Can't find any cryostat at position " << point << "\n";
-    }
+    if (!cstat) throw geo::PositionLookupError("GeometryCore", "cryostat", point);
     return *cstat;
   } // GeometryCore::PositionToCryostat()
 
@@ -497,6 +1197,17 @@ namespace geo {
     return PositionToAuxDet(geo::vect::makePointFromCoords(worldLoc), ad, tolerance);
   }
 
+  //......................................................................
+  geo::QueryResult_t<AuxDetGeo const&> GeometryCore::TryPositionToAuxDet(
+    geo::Point_t const& point,
+    double tolerance) const
+  {
+    std::array<double, 3U> const worldPos = {{point.X(), point.Y(), point.Z()}};
+    std::size_t const ad = fChannelMapAlg->FindAuxDet(worldPos.data(), AuxDets(), tolerance);
+    if (ad == geo::AuxDetSpatialIndex::NoIndex) return geo::queryFailure(geo::QueryError::NoAuxDet);
+    return AuxDets()[ad];
+  } // GeometryCore::TryPositionToAuxDet()
+
   //......................................................................
   void GeometryCore::FindAuxDetSensitiveAtPosition(geo::Point_t const& point,
                                                    std::size_t& adg,
@@ -540,6 +1251,34 @@ namespace geo {
     return PositionToAuxDetSensitive(geo::vect::makePointFromCoords(worldLoc), ad, sv, tolerance);
   }
 
+  //......................................................................
+  void GeometryCore::PositionsToAuxDetSensitive(util::span<geo::Point_t const*> points,
+                                                util::span<geo::AuxDetLocation*> locations,
+                                                double tolerance) const
+  {
+    if (locations.size() < points.size()) {
+      throw cet::exception("GeometryCore")
+        << "PositionsToAuxDetSensitive(): " << points.size() << " points but room for only "
+        << locations.size() << " locations\n";
+    }
+
+    auto iLocation = locations.begin();
+    for (geo::Point_t const& point : points) {
+      geo::AuxDetLocation& location = *iLocation++;
+      location = {};
+      // BUG the double brace syntax is required to work around clang bug 21629
+      // (https://bugs.llvm.org/show_bug.cgi?id=21629)
+      std::array<double, 3U> const worldPos = {{point.X(), point.Y(), point.Z()}};
+      std::size_t const ad = fChannelMapAlg->FindAuxDet(worldPos.data(), AuxDets(), tolerance);
+      if (ad == geo::AuxDetLocation::InvalidIndex) continue;
+      std::size_t const sv =
+        fChannelMapAlg->FindSensitiveAuxDet(worldPos.data(), AuxDets(), ad, tolerance);
+      if (sv == geo::AuxDetLocation::InvalidIndex) continue;
+      location.auxDet = ad;
+      location.sensitive = sv;
+    } // for
+  } // GeometryCore::PositionsToAuxDetSensitive()
+
   //......................................................................
   const AuxDetGeo& GeometryCore::ChannelToAuxDet(std::string const& auxDetName,
                                                  uint32_t const& channel) const
@@ -556,6 +1295,19 @@ namespace geo {
     return this->AuxDet(idx.first).SensitiveVolume(idx.second);
   }
 
+  //......................................................................
+  std::size_t GeometryCore::FindAuxDetByName(std::string_view auxDetName) const
+  {
+    return fChannelMapAlg->AuxDetNameToIndex(auxDetName);
+  }
+
+  //......................................................................
+  const AuxDetSensitiveGeo& GeometryCore::ChannelToAuxDetSensitive(std::size_t ad,
+                                                                   uint32_t channel) const
+  {
+    return AuxDet(ad).SensitiveVolume(fChannelMapAlg->SensitiveAuxDetIndex(ad, channel));
+  }
+
   //......................................................................
   SigType_t GeometryCore::SignalType(raw::ChannelID_t const channel) const
   {
@@ -580,6 +1332,8 @@ namespace geo {
   //......................................................................
   View_t GeometryCore::View(raw::ChannelID_t const channel) const
   {
+    std::vector<geo::View_t> const& channelViews = HotTables().channelViews;
+    if (channel < channelViews.size()) return channelViews[channel];
     return (channel == raw::InvalidChannelID) ? geo::kUnknown : View(ChannelToROP(channel));
   } // GeometryCore::View()
 
@@ -603,12 +1357,22 @@ namespace geo {
   {
     // For now, and possibly forever, this is a constant (given the
     // definition of "nodeNames" above).
-    return std::string("volWorld");
+    return std::string(WorldVolumeNameView());
   }
 
   //......................................................................
   geo::BoxBoundedGeo GeometryCore::DetectorEnclosureBox(
-    std::string const& name /* = "volDetEnclosure" */) const
+    std::string const& name /* = DefaultDetectorEnclosureName */) const
+  {
+    if (name == DefaultDetectorEnclosureName) {
+      return fDetectorEnclosureBox.get(
+        [this, &name]() { return ComputeDetectorEnclosureBox(name); });
+    }
+    return fEnclosureBoxes.get(name, [this, &name]() { return ComputeDetectorEnclosureBox(name); });
+  } // geo::GeometryCore::DetectorEnclosureBox()
+
+  //......................................................................
+  geo::BoxBoundedGeo GeometryCore::ComputeDetectorEnclosureBox(std::string const& name) const
   {
     auto const& path = FindDetectorEnclosure(name);
     if (path.empty()) {
@@ -635,96 +1399,40 @@ namespace geo {
 
     return {trans.LocalToWorld(geo::Point_t{-halfwidth, -halfheight, -halflength}),
             trans.LocalToWorld(geo::Point_t{+halfwidth, +halfheight, +halflength})};
-  } // geo::GeometryCore::DetectorEnclosureBox()
+  } // geo::GeometryCore::ComputeDetectorEnclosureBox()
 
   //......................................................................
-  struct NodeNameMatcherClass {
-    std::set<std::string> const* vol_names;
-
-    NodeNameMatcherClass(std::set<std::string> const& names) : vol_names(&names) {}
-
-    /// Returns whether the specified node matches a set of names
-    bool operator()(TGeoNode const& node) const
-    {
-      if (!vol_names) return true;
-      return vol_names->find(node.GetVolume()->GetName()) != vol_names->end();
-    }
-
-  }; // NodeNameMatcherClass
-
-  struct CollectNodesByName {
-    std::vector<TGeoNode const*> nodes;
-
-    CollectNodesByName(std::set<std::string> const& names) : matcher(names) {}
-
-    /// If the name of the node matches, records the end node
-    void operator()(TGeoNode const& node)
-    {
-      if (matcher(node)) nodes.push_back(&node);
-    }
-
-    void operator()(ROOTGeoNodeForwardIterator const& iter) { operator()(**iter); }
-
-  protected:
-    NodeNameMatcherClass matcher;
-  }; // CollectNodesByName
-
-  struct CollectPathsByName {
-    std::vector<std::vector<TGeoNode const*>> paths;
-
-    CollectPathsByName(std::set<std::string> const& names) : matcher(names) {}
-
-    /// If the name of the node matches, records the node full path
-    void operator()(ROOTGeoNodeForwardIterator const& iter)
-    {
-      if (matcher(**iter)) paths.push_back(iter.get_path());
-    }
-
-  protected:
-    NodeNameMatcherClass matcher;
-  }; // CollectPathsByName
+  geo::details::NodeNameIndex<TGeoNode> const& GeometryCore::VolumeNodeIndex() const
+  {
+    return fNodeNameIndex.get([this](geo::details::NodeNameIndex<TGeoNode>& index) {
+      index.build(ROOTGeoManager()->GetTopNode());
+    });
+  } // GeometryCore::VolumeNodeIndex()
 
+  //......................................................................
   std::vector<TGeoNode const*> GeometryCore::FindAllVolumes(
     std::set<std::string> const& vol_names) const
   {
-    CollectNodesByName node_collector(vol_names);
-
-    ROOTGeoNodeForwardIterator iNode(ROOTGeoManager()->GetTopNode());
-    TGeoNode const* pCurrentNode;
-
-    while ((pCurrentNode = *iNode)) {
-      node_collector(*pCurrentNode);
-      ++iNode;
-    } // while
-
-    return node_collector.nodes;
+    return VolumeNodeIndex().nodes(vol_names);
   } // GeometryCore::FindAllVolumes()
 
+  //......................................................................
   std::vector<std::vector<TGeoNode const*>> GeometryCore::FindAllVolumePaths(
     std::set<std::string> const& vol_names) const
   {
-    CollectPathsByName path_collector(vol_names);
-
-    ROOTGeoNodeForwardIterator iNode(ROOTGeoManager()->GetTopNode());
-
-    while (*iNode) {
-      path_collector(iNode);
-      ++iNode;
-    } // while
-
-    return path_collector.paths;
+    return VolumeNodeIndex().paths(vol_names);
   } // GeometryCore::FindAllVolumePaths()
 
   //......................................................................
   std::string GeometryCore::GetLArTPCVolumeName(geo::TPCID const& tpcid) const
   {
-    return std::string(TPC(tpcid).ActiveVolume()->GetName());
+    return std::string(TPCVolumeNameView(tpcid));
   }
 
   //......................................................................
   std::string GeometryCore::GetCryostatVolumeName(geo::CryostatID const& cid) const
   {
-    return std::string(Cryostat(cid).Volume()->GetName());
+    return std::string(CryostatVolumeNameView(cid));
   }
 
   //......................................................................
@@ -836,70 +1544,92 @@ namespace geo {
   {
     // look in cryostat 0, tpc 0 to find the plane with the
     // specified view
-    return TPC({0, 0}).Plane(view).WirePitch();
+    return WirePitch(view, geo::TPCID{0, 0});
   }
 
+  //......................................................................
+  geo::Length_t GeometryCore::WirePitch(geo::View_t view, geo::TPCID const& tpcid) const
+  {
+    geo::TPCGeo::ViewInfo_t const* info = ViewInfoPtr(view, tpcid);
+    if (info) return info->pitch;
+    throw cet::exception("GeometryCore")
+      << "WirePitch(): no view \"" << geo::PlaneGeo::ViewName(view) << "\" (#" << ((int)view)
+      << ") in " << std::string(tpcid) << "\n";
+  } // GeometryCore::WirePitch(View_t, TPCID)
+
   //......................................................................
   // This method returns the distance between wires in the specified view
   // it assumes all planes of a given view have the same pitch
   double GeometryCore::WireAngleToVertical(geo::View_t view, geo::TPCID const& tpcid) const
   {
-    // loop over the planes in cryostat 0, tpc 0 to find the plane with the
-    // specified view
-    geo::TPCGeo const& TPC = this->TPC(tpcid);
-    for (unsigned int p = 0; p < TPC.Nplanes(); ++p) {
-      geo::PlaneGeo const& plane = TPC.Plane(p);
-      if (plane.View() == view) return plane.ThetaZ();
-    } // for
+    // find the plane with the specified view in the TPC
+    geo::TPCGeo::ViewInfo_t const* info = ViewInfoPtr(view, tpcid);
+    if (info) return info->thetaZ;
     throw cet::exception("GeometryCore")
       << "WireAngleToVertical(): no view \"" << geo::PlaneGeo::ViewName(view) << "\" (#"
       << ((int)view) << ") in " << std::string(tpcid);
   } // GeometryCore::WireAngleToVertical()
 
   //......................................................................
-  unsigned int GeometryCore::MaxTPCs() const
+  void GeometryCore::UpdateMaxElements()
   {
-    unsigned int maxTPCs = 0;
-    for (geo::CryostatGeo const& cryo : Cryostats()) {
-      unsigned int maxTPCsInCryo = cryo.NTPC();
-      if (maxTPCsInCryo > maxTPCs) maxTPCs = maxTPCsInCryo;
-    } // for
-    return maxTPCs;
-  } // GeometryCore::MaxTPCs()
+    // all the maxima in a single pass
+    auto const maxElements = geo::details::extractMaxGeometryElements<4U>(Cryostats());
+    fMaxTPCs = maxElements[1];
+    fMaxPlanes = maxElements[2];
+    fMaxWires = maxElements[3];
 
-  //......................................................................
-  unsigned int GeometryCore::TotalNTPC() const
-  {
     // it looks like C++11 lambdas have made STL algorithms easier to use,
     // but only so much:
-    return std::accumulate(
+    fTotalNTPC = std::accumulate(
       Cryostats().begin(),
       Cryostats().end(),
       0U,
       [](unsigned int sum, geo::CryostatGeo const& cryo) { return sum + cryo.NTPC(); });
-  } // GeometryCore::TotalNTPC()
+  } // GeometryCore::UpdateMaxElements()
 
   //......................................................................
-  unsigned int GeometryCore::MaxPlanes() const
+  void GeometryCore::BuildChannelROPTable()
   {
-    unsigned int maxPlanes = 0;
-    for (geo::CryostatGeo const& cryo : Cryostats()) {
-      unsigned int maxPlanesInCryo = cryo.MaxPlanes();
-      if (maxPlanesInCryo > maxPlanes) maxPlanes = maxPlanesInCryo;
+    std::vector<readout::ROPID>& ropIDs = fHotTables.ropIDs;
+    std::vector<geo::ChannelRouting::Index_t>& channelROPs = fHotTables.channelROPs;
+    ropIDs.clear();
+    channelROPs.clear();
+
+    // the channels in the range of each ROP are asked in a single batch
+    std::vector<raw::ChannelID_t> channels;
+    auto ropNumbers = makeROPdata<geo::ChannelRouting::Index_t>(geo::ChannelRouting::NoROP);
+    for (readout::ROPID const& ropid : IterateROPIDs()) {
+      ropNumbers[ropid] = static_cast<geo::ChannelRouting::Index_t>(ropIDs.size());
+      ropIDs.push_back(ropid);
+      auto const [first, last] = fHotTables.ropChannelRanges[ropid];
+      for (raw::ChannelID_t channel = first; channel < last; ++channel)
+        channels.push_back(channel);
+    } // for
+    std::sort(channels.begin(), channels.end());
+    channels.erase(std::unique(channels.begin(), channels.end()), channels.end());
+    if (channels.empty()) return;
+
+    std::vector<readout::ROPID> channelROPIDs(channels.size());
+    ChannelsToROPs({channels.data(), channels.data() + channels.size()},
+                   {channelROPIDs.data(), channelROPIDs.data() + channelROPIDs.size()});
+
+    channelROPs.assign(channels.back() + 1U, geo::ChannelRouting::NoROP);
+    for (std::size_t i = 0; i < channels.size(); ++i) {
+      readout::ROPID const& ropid = channelROPIDs[i];
+      if (ropid.isValid && ropNumbers.hasElement(ropid))
+        channelROPs[channels[i]] = ropNumbers[ropid];
     } // for
-    return maxPlanes;
-  } // GeometryCore::MaxPlanes()
+  } // GeometryCore::BuildChannelROPTable()
 
   //......................................................................
-  unsigned int GeometryCore::MaxWires() const
+  void GeometryCore::UpdatePlaneKernels()
   {
-    unsigned int maxWires = 0;
-    for (geo::CryostatGeo const& cryo : Cryostats()) {
-      unsigned int maxWiresInCryo = cryo.MaxWires();
-      if (maxWiresInCryo > maxWires) maxWires = maxWiresInCryo;
-    } // for
-    return maxWires;
-  } // GeometryCore::MaxWires()
+    fHotTables.planeKernels.resize(fPlaneIDmapper.size());
+    for (geo::PlaneGeo const& plane : IteratePlanes())
+      fHotTables.planeKernels[fPlaneIDmapper.index(plane.ID())] = plane.WireCoordinateKernel();
+    fHotTableReplicas.reset();
+  } // GeometryCore::UpdatePlaneKernels()
 
   //......................................................................
   void GeometryCore::GetEndID(geo::WireID& id) const
@@ -948,11 +1678,17 @@ namespace geo {
   //......................................................................
   TGeoVolume const* GeometryCore::WorldVolume() const
   {
-    return gGeoManager->FindVolumeFast(GetWorldVolumeName().c_str());
+    return gGeoManager->FindVolumeFast(WorldVolumeNameView().data()); // null-terminated literal
   }
 
   //......................................................................
   geo::BoxBoundedGeo GeometryCore::WorldBox() const
+  {
+    return fWorldBox.get([this]() { return ComputeWorldBox(); });
+  } // GeometryCore::WorldBox()
+
+  //......................................................................
+  geo::BoxBoundedGeo GeometryCore::ComputeWorldBox() const
   {
 
     TGeoVolume const* world = WorldVolume();
@@ -972,7 +1708,7 @@ namespace geo {
 
     // geo::BoxBoundedGeo constructor will sort the coordinates as needed
     return geo::BoxBoundedGeo{x1, x2, y1, y2, z1, z2};
-  } // GeometryCore::WorldBox()
+  } // GeometryCore::ComputeWorldBox()
 
   //......................................................................
   void GeometryCore::WorldBox(double* xlo,
@@ -993,30 +1729,39 @@ namespace geo {
 
   //......................................................................
   std::string GeometryCore::VolumeName(geo::Point_t const& point) const
+  {
+    return std::string(VolumeNameView(point));
+  }
+
+  //......................................................................
+  std::string_view GeometryCore::VolumeNameView(geo::Point_t const& point) const
   {
     // check that the given point is in the World volume at least
-    TGeoVolume const* volWorld = WorldVolume();
-    double halflength = ((TGeoBBox*)volWorld->GetShape())->GetDZ();
-    double halfheight = ((TGeoBBox*)volWorld->GetShape())->GetDY();
-    double halfwidth = ((TGeoBBox*)volWorld->GetShape())->GetDX();
-    if (std::abs(point.x()) > halfwidth || std::abs(point.y()) > halfheight ||
-        std::abs(point.z()) > halflength) {
+    if (!WorldBox().ContainsPosition(point)) {
+      TGeoBBox const* worldBox = static_cast<TGeoBBox const*>(WorldVolume()->GetShape());
       mf::LogWarning("GeometryCoreBadInputPoint")
         << "point (" << point.x() << "," << point.y() << "," << point.z() << ") "
         << "is not inside the world volume "
-        << " half width = " << halfwidth << " half height = " << halfheight
-        << " half length = " << halflength << " returning unknown volume name";
-      const std::string unknown("unknownVolume");
-      return unknown;
+        << " half width = " << worldBox->GetDX() << " half height = " << worldBox->GetDY()
+        << " half length = " << worldBox->GetDZ() << " returning unknown volume name";
+      return "unknownVolume";
     }
 
-    return gGeoManager->FindNode(point.X(), point.Y(), point.Z())->GetName();
+    return ROOTNavigator().FindNode(point.X(), point.Y(), point.Z())->GetName();
   }
 
+  //......................................................................
+  auto GeometryCore::VolumeHandleAt(geo::Point_t const& point) const -> VolumeHandle_t
+  {
+    if (!WorldBox().ContainsPosition(point)) return InvalidVolumeHandle;
+    TGeoNode const* node = ROOTNavigator().FindNode(point.X(), point.Y(), point.Z());
+    return node ? fVolumeNames.handleOf(node->GetVolume()->GetNumber()) : InvalidVolumeHandle;
+  } // GeometryCore::VolumeHandleAt()
+
   //......................................................................
   TGeoMaterial const* GeometryCore::Material(geo::Point_t const& point) const
   {
-    auto const pNode = gGeoManager->FindNode(point.X(), point.Y(), point.Z());
+    auto const pNode = ROOTNavigator().FindNode(point.X(), point.Y(), point.Z());
     if (!pNode) return nullptr;
     auto const pMedium = pNode->GetMedium();
     return pMedium ? pMedium->GetMaterial() : nullptr;
@@ -1074,12 +1819,44 @@ namespace geo {
   } // FindFirstVolume()
 
   //......................................................................
-  void GeometryCore::BuildGeometry(geo::GeometryBuilder& builder)
+  void GeometryCore::BuildGeometry(geo::GeometryBuilder& builder, TGeoNode const* topNode)
   {
-    geo::GeoNodePath path{gGeoManager->GetTopNode()};
+    geo::GeoNodePath path{topNode};
+    auto start = geo::GeometryLoadReport::Clock_t::now();
     Cryostats() = builder.extractCryostats(path);
+    fLoadReport.addPhase("BuildCryostats", start);
+
+    start = geo::GeometryLoadReport::Clock_t::now();
     AuxDets() = builder.extractAuxiliaryDetectors(path);
-  }
+    fLoadReport.addPhase("BuildAuxDets", start);
+
+    std::size_t nTPCs = 0U, nPlanes = 0U, nWires = 0U, nOpDets = 0U;
+    for (geo::CryostatGeo const& cryo : Cryostats()) {
+      nTPCs += cryo.NTPC();
+      nOpDets += cryo.NOpDet();
+      for (geo::TPCGeo const& tpc : cryo.IterateTPCs()) {
+        nPlanes += tpc.Nplanes();
+        for (geo::PlaneGeo const& plane : tpc.IteratePlanes())
+          nWires += plane.Nwires();
+      }
+    }
+    fLoadReport.setCount("Cryostats", Ncryostats());
+    fLoadReport.setCount("TPCs", nTPCs);
+    fLoadReport.setCount("Planes", nPlanes);
+    fLoadReport.setCount("Wires", nWires);
+    fLoadReport.setCount("OpDets", nOpDets);
+    fLoadReport.setCount("AuxDets", NAuxDets());
+  } // GeometryCore::BuildGeometry()
+
+  //......................................................................
+  fhicl::ParameterSet GeometryCore::StandardBuilderParameters() const
+  {
+    if (fBuildSubset.isWholeDetector()) return fBuilderParameters;
+    // with a subset, no wire is built unless needed
+    fhicl::ParameterSet pset = fBuilderParameters;
+    pset.put_or_replace("lazyWires", true);
+    return pset;
+  } // GeometryCore::StandardBuilderParameters()
 
   //......................................................................
   //
@@ -1113,31 +1890,236 @@ namespace geo {
 
     double const dxyz[3] = {dir.X(), dir.Y(), dir.Z()};
     double const cp1[3] = {p1.X(), p1.Y(), p1.Z()};
-    gGeoManager->InitTrack(cp1, dxyz);
+    TGeoNavigator& navigator = ROOTNavigator();
+    navigator.InitTrack(cp1, dxyz);
 
     //might be helpful to have a point to a TGeoNode
-    TGeoNode* node = gGeoManager->GetCurrentNode();
+    TGeoNode* node = navigator.GetCurrentNode();
 
     //check that the points are not in the same volume already.
     //if they are in different volumes, keep stepping until you
     //are in the same volume as the second point
-    while (!gGeoManager->IsSameLocation(p2.X(), p2.Y(), p2.Z())) {
-      gGeoManager->FindNextBoundary();
-      columnD += gGeoManager->GetStep() * node->GetMedium()->GetMaterial()->GetDensity();
+    while (!navigator.IsSameLocation(p2.X(), p2.Y(), p2.Z())) {
+      navigator.FindNextBoundary();
+      columnD += navigator.GetStep() * node->GetMedium()->GetMaterial()->GetDensity();
 
       //the act of stepping puts you in the next node and returns that node
-      node = gGeoManager->Step();
+      node = navigator.Step();
     } //end loop to get to volume of second point
 
     //now you are in the same volume as the last point, but not at that point.
     //get the distance between the current point and the last one
-    geo::Point_t const last = geo::vect::makePointFromCoords(gGeoManager->GetCurrentPoint());
+    geo::Point_t const last = geo::vect::makePointFromCoords(navigator.GetCurrentPoint());
     double const lastStep = (p2 - last).R();
     columnD += lastStep * node->GetMedium()->GetMaterial()->GetDensity();
 
     return columnD;
   }
 
+  //......................................................................
+  geo::DensityVoxelMap GeometryCore::BuildDensityVoxelMap(geo::BoxBoundedGeo const& region,
+                                                          double voxelSize,
+                                                          unsigned int samplesPerAxis) const
+  {
+    if (!(voxelSize > 0.0) || (samplesPerAxis == 0U)) {
+      throw cet::exception("GeometryCore")
+        << "BuildDensityVoxelMap(): invalid voxel size (" << voxelSize << " cm) or samples ("
+        << samplesPerAxis << ")\n";
+    }
+
+    std::array<double, 3U> const lower{region.MinX(), region.MinY(), region.MinZ()};
+    std::array<double, 3U> const upper{region.MaxX(), region.MaxY(), region.MaxZ()};
+    std::array<std::size_t, 3U> nVoxels;
+    for (std::size_t axis = 0; axis < 3U; ++axis)
+      nVoxels[axis] = static_cast<std::size_t>(
+        std::max(1.0, std::ceil((upper[axis] - lower[axis]) / voxelSize)));
+
+    geo::DensityVoxelMap map{lower, upper, nVoxels};
+    if (map.empty()) {
+      throw cet::exception("GeometryCore")
+        << "BuildDensityVoxelMap(): region " << region.Min() << " -- " << region.Max()
+        << " has no volume\n";
+    }
+
+    double const sampleStep[3] = {map.voxelSize(0) / samplesPerAxis,
+                                  map.voxelSize(1) / samplesPerAxis,
+                                  map.voxelSize(2) / samplesPerAxis};
+    unsigned int const nSamples = samplesPerAxis * samplesPerAxis * samplesPerAxis;
+    TGeoNavigator& navigator = ROOTNavigator();
+    for (std::size_t ix = 0; ix < map.nVoxels(0); ++ix) {
+      for (std::size_t iy = 0; iy < map.nVoxels(1); ++iy) {
+        for (std::size_t iz = 0; iz < map.nVoxels(2); ++iz) {
+          double const x0 = map.lower(0) + ix * map.voxelSize(0) + 0.5 * sampleStep[0];
+          double const y0 = map.lower(1) + iy * map.voxelSize(1) + 0.5 * sampleStep[1];
+          double const z0 = map.lower(2) + iz * map.voxelSize(2) + 0.5 * sampleStep[2];
+
+          double sum = 0.0;
+          double min = std::numeric_limits<double>::max();
+          double max = 0.0;
+          for (unsigned int sx = 0; sx < samplesPerAxis; ++sx) {
+            for (unsigned int sy = 0; sy < samplesPerAxis; ++sy) {
+              for (unsigned int sz = 0; sz < samplesPerAxis; ++sz) {
+                TGeoNode const* node = navigator.FindNode(
+                  x0 + sx * sampleStep[0], y0 + sy * sampleStep[1], z0 + sz * sampleStep[2]);
+                TGeoMedium const* medium = node ? node->GetMedium() : nullptr;
+                TGeoMaterial const* material = medium ? medium->GetMaterial() : nullptr;
+                double const density = material ? material->GetDensity() : 0.0;
+                sum += density;
+                min = std::min(min, density);
+                max = std::max(max, density);
+              } // for z samples
+            }   // for y samples
+          }     // for x samples
+
+          map.setVoxel(ix,
+                       iy,
+                       iz,
+                       {static_cast<float>(sum / nSamples),
+                        static_cast<float>(min),
+                        static_cast<float>(max)});
+        } // for z
+      }   // for y
+    }     // for x
+
+    return map;
+  } // GeometryCore::BuildDensityVoxelMap()
+
+  //......................................................................
+  geo::GeometrySnapshot GeometryCore::MakeGeometrySnapshot() const
+  {
+    auto const fillBox = [](snapshot::Box_t& dest, geo::BoxBoundedGeo const& box) {
+      geo::vect::fillCoords(dest.min, box.Min());
+      geo::vect::fillCoords(dest.max, box.Max());
+    };
+
+    geo::GeometrySnapshot snapshot;
+    snapshot.detectorName = DetectorName();
+    for (geo::CryostatGeo const& cryo : IterateCryostats()) {
+      snapshot::Cryostat_t& cryoInfo = snapshot.cryostats.emplace_back();
+      fillBox(cryoInfo.box, cryo.BoundingBox());
+      cryoInfo.firstTPC = snapshot.TPCs.size();
+      cryoInfo.nTPCs = cryo.NTPC();
+      cryoInfo.firstOpDet = snapshot.opDets.size();
+      cryoInfo.nOpDets = cryo.NOpDet();
+
+      for (geo::TPCGeo const& TPC : cryo.IterateTPCs()) {
+        snapshot::TPC_t& TPCinfo = snapshot.TPCs.emplace_back();
+        fillBox(TPCinfo.box, TPC.BoundingBox());
+        fillBox(TPCinfo.activeBox, TPC.ActiveBoundingBox());
+        geo::vect::fillCoords(TPCinfo.driftDir, TPC.DriftDir());
+        TPCinfo.firstPlane = snapshot.planes.size();
+        TPCinfo.nPlanes = TPC.Nplanes();
+        TPCinfo.driftDirection = TPC.DriftDirection();
+        TPCinfo.reserved = 0U;
+
+        for (geo::PlaneGeo const& plane : TPC.IteratePlanes()) {
+          snapshot::Plane_t& planeInfo = snapshot.planes.emplace_back();
+          geo::vect::fillCoords(planeInfo.center, plane.GetCenter());
+          geo::vect::fillCoords(planeInfo.normal, plane.GetNormalDirection());
+          geo::vect::fillCoords(planeInfo.widthDir, plane.WidthDir());
+          geo::vect::fillCoords(planeInfo.depthDir, plane.DepthDir());
+          planeInfo.width = plane.Width();
+          planeInfo.depth = plane.Depth();
+          planeInfo.wirePitch = plane.WirePitch();
+          planeInfo.phiZ = plane.PhiZ();
+          planeInfo.firstWire = snapshot.wires.size();
+          planeInfo.nWires = plane.Nwires();
+          planeInfo.view = plane.View();
+          planeInfo.orientation = plane.Orientation();
+
+          for (geo::WireGeo const& wire : plane.IterateWires()) {
+            snapshot::Wire_t& wireInfo = snapshot.wires.emplace_back();
+            geo::vect::fillCoords(wireInfo.center, wire.GetCenter());
+            geo::vect::fillCoords(wireInfo.direction, wire.Direction());
+            wireInfo.halfLength = wire.HalfL();
+            wireInfo.thetaZ = wire.ThetaZ();
+          } // for wires
+        }   // for planes
+      }     // for TPCs
+
+      for (unsigned int iOpDet = 0; iOpDet < cryo.NOpDet(); ++iOpDet) {
+        geo::OpDetGeo const& opDet = cryo.OpDet(iOpDet);
+        snapshot::OpDet_t& opDetInfo = snapshot.opDets.emplace_back();
+        geo::vect::fillCoords(opDetInfo.center, opDet.GetCenter());
+        opDetInfo.rMax = opDet.RMax();
+        opDetInfo.halfW = opDet.HalfW();
+        opDetInfo.halfH = opDet.HalfH();
+        opDetInfo.halfL = opDet.HalfL();
+        opDetInfo.reserved = 0.0;
+      } // for optical detectors
+    }   // for cryostats
+
+    return snapshot;
+  } // GeometryCore::MakeGeometrySnapshot()
+
+  //......................................................................
+  SharedGeometryContent makeSharedGeometryContent(GeometryCore const& geom)
+  {
+    SharedGeometryContent content;
+    content.snapshot = geom.MakeGeometrySnapshot();
+    content.wireChannels.reserve(content.snapshot.wires.size());
+    for (geo::WireID const& wireID : geom.IterateWireIDs())
+      content.wireChannels.push_back(geom.PlaneWireToChannel(wireID));
+    content.fingerprint = geom.Fingerprint();
+    return content;
+  } // makeSharedGeometryContent()
+
+  //......................................................................
+  geo::CompactGeometry GeometryCore::MakeCompactGeometry() const
+  {
+    geo::CompactGeometry compact;
+    compact.TPCs.reserve(TotalNTPC());
+    for (geo::TPCGeo const& TPC : IterateTPCs()) {
+      std::uint32_t const iTPC = compact.TPCs.size();
+      compact::TPC_t& TPCinfo = compact.TPCs.emplace_back();
+      geo::vect::fillCoords(TPCinfo.min, TPC.BoundingBox().Min());
+      geo::vect::fillCoords(TPCinfo.max, TPC.BoundingBox().Max());
+      geo::vect::fillCoords(TPCinfo.activeMin, TPC.ActiveBoundingBox().Min());
+      geo::vect::fillCoords(TPCinfo.activeMax, TPC.ActiveBoundingBox().Max());
+      geo::vect::fillCoords(TPCinfo.driftDir, TPC.DriftDir());
+      TPCinfo.firstPlane = compact.planes.size();
+      TPCinfo.nPlanes = TPC.Nplanes();
+      TPCinfo.cryostat = TPC.ID().Cryostat;
+      TPCinfo.driftDirection = TPC.DriftDirection();
+      TPCinfo.tpc = TPC.ID().TPC;
+
+      for (geo::PlaneGeo const& plane : TPC.IteratePlanes()) {
+        auto const kernel = plane.WireCoordinateKernel();
+        geo::Vector_t const wireCoordDir =
+          geo::vect::makeVectorFromCoords(kernel.dir) / kernel.pitch;
+        geo::Vector_t const normal = plane.GetNormalDirection<geo::Vector_t>();
+
+        compact::Plane_t& planeInfo = compact.planes.emplace_back();
+        geo::vect::fillCoords(planeInfo.wireCoordDir, wireCoordDir);
+        planeInfo.wireCoordOffset =
+          -geo::vect::dot(geo::vect::makeVectorFromCoords(kernel.origin), wireCoordDir);
+        geo::vect::fillCoords(planeInfo.normal, normal);
+        planeInfo.normalOffset =
+          -geo::vect::dot(plane.GetCenter<geo::Point_t>() - geo::origin(), normal);
+        geo::vect::fillCoords(planeInfo.wireDir, plane.GetWireDirection<geo::Vector_t>());
+        planeInfo.wirePitch = plane.WirePitch();
+        planeInfo.thetaZ = plane.ThetaZ();
+        planeInfo.nWires = plane.Nwires();
+        planeInfo.view = plane.View();
+        planeInfo.tpc = iTPC;
+      } // for planes
+    }   // for TPCs
+    return compact;
+  } // GeometryCore::MakeCompactGeometry()
+
+  //......................................................................
+  geo::DeviceGeometryBuffer_t GeometryCore::MakeDeviceGeometryBuffer() const
+  {
+    std::vector<std::vector<std::uint32_t>> planeChannels;
+    for (geo::PlaneGeo const& plane : IteratePlanes()) {
+      std::vector<std::uint32_t>& channels = planeChannels.emplace_back();
+      channels.reserve(plane.Nwires());
+      for (unsigned int wire = 0; wire < plane.Nwires(); ++wire)
+        channels.push_back(PlaneWireToChannel(geo::WireID{plane.ID(), wire}));
+    }
+    return geo::makeDeviceGeometryBuffer(MakeCompactGeometry(), planeChannels);
+  } // GeometryCore::MakeDeviceGeometryBuffer()
+
   //......................................................................
   std::string GeometryCore::Info(std::string indent /* = "" */) const
   {
@@ -1149,15 +2131,196 @@ namespace geo {
   //......................................................................
   std::vector<geo::WireID> GeometryCore::ChannelToWire(raw::ChannelID_t channel) const
   {
-    return fChannelMapAlg->ChannelToWire(channel);
+    auto const query = StartQuery(Query_t::ChannelToWire);
+    RecordQuery(RecordedKind_t::ChannelToWire, channel);
+    std::vector<geo::WireID> wires = fChannelMapAlg->ChannelToWire(channel);
+    if (wires.empty()) query.miss();
+    return wires;
+  }
+
+  //......................................................................
+  void GeometryCore::ChannelToWire(raw::ChannelID_t channel, WireIDlist_t& wires) const
+  {
+    auto const query = StartQuery(Query_t::ChannelToWire);
+    RecordQuery(RecordedKind_t::ChannelToWire, channel);
+    WireIDspan_t const wireIDs = fChannelMapAlg->ChannelToWireIDs(channel);
+    wires.assign(wireIDs.begin(), wireIDs.end());
+    if (wires.empty()) query.miss();
+  } // GeometryCore::ChannelToWire(WireIDlist_t)
+
+  //......................................................................
+  auto GeometryCore::ChannelToWireIDs(raw::ChannelID_t channel) const -> WireIDspan_t
+  {
+    auto const query = StartQuery(Query_t::ChannelToWireIDs);
+    RecordQuery(RecordedKind_t::ChannelToWireIDs, channel);
+    WireIDspan_t const wires = fChannelMapAlg->ChannelToWireIDs(channel);
+    if (wires.empty()) query.miss();
+    return wires;
+  }
+
+  //......................................................................
+  auto GeometryCore::FlatTPCs(geo::CryostatID const& cid) const -> TPCGeoPtrSpan_t
+  {
+    return flatChildren(fTPCIDmapper, fFlatTPCs, cid);
+  } // GeometryCore::FlatTPCs()
+
+  //......................................................................
+  auto GeometryCore::FlatPlanes(geo::TPCID const& tpcid) const -> PlaneGeoPtrSpan_t
+  {
+    return flatChildren(fPlaneIDmapper, fFlatPlanes, tpcid);
+  } // GeometryCore::FlatPlanes()
+
+  //......................................................................
+  auto GeometryCore::FlatWires() const -> WireGeoPtrSpan_t
+  {
+    fFlatWiresBuilt.callOnce([this]() {
+      std::vector<geo::WireGeo const*> wires;
+      wires.reserve(fWireIDmapper.size());
+      for (geo::PlaneGeo const* plane : fFlatPlanes) {
+        // wires outside the build subset are not built for this table
+        if (!IsInBuildSubset(plane->ID())) {
+          wires.insert(wires.end(), plane->Nwires(), nullptr);
+          continue;
+        }
+        for (geo::WireGeo const& wire : plane->IterateWires())
+          wires.push_back(&wire);
+      }
+      fFlatWires = std::move(wires);
+    });
+    return util::make_span(fFlatWires);
+  } // GeometryCore::FlatWires()
+
+  //......................................................................
+  auto GeometryCore::FlatWires(geo::PlaneID const& planeid) const -> WireGeoPtrSpan_t
+  {
+    FlatWires();
+    return flatChildren(fWireIDmapper, fFlatWires, planeid);
+  } // GeometryCore::FlatWires()
+
+  //......................................................................
+  auto GeometryCore::ChannelToWireGeos(raw::ChannelID_t channel) const -> WireGeoPtrSpan_t
+  {
+    fChannelWiresBuilt.callOnce([this]() {
+      // channels beyond the last one with a wire (and a view) have no wire
+      std::size_t const nChannels = fHotTables.channelViews.size();
+      std::vector<std::size_t> offsets;
+      offsets.reserve(nChannels + 1U);
+      std::vector<geo::WireGeo const*> wires;
+      wires.reserve(nChannels);
+      for (raw::ChannelID_t ch = 0; ch < nChannels; ++ch) {
+        offsets.push_back(wires.size());
+        for (geo::WireID const& wireID : fChannelMapAlg->ChannelToWireIDs(ch)) {
+          // wires outside the build subset are not built for this table
+          if (IsInBuildSubset(wireID)) wires.push_back(&Wire(wireID));
+        }
+      }
+      offsets.push_back(wires.size());
+      fChannelWires = std::move(wires);
+      fChannelWireOffsets = std::move(offsets);
+    });
+
+    if (!raw::isValidChannelID(channel) || (channel + 1U >= fChannelWireOffsets.size()))
+      return {fChannelWires.end(), fChannelWires.end()};
+    auto const first = fChannelWires.begin();
+    return {first + fChannelWireOffsets[channel], first + fChannelWireOffsets[channel + 1U]};
+  } // GeometryCore::ChannelToWireGeos()
+
+  //......................................................................
+  void GeometryCore::ChannelsToWireIDs(util::span<raw::ChannelID_t const*> channels,
+                                       util::span<WireIDspan_t*> wires) const
+  {
+    fChannelMapAlg->ChannelsToWireIDs(channels, wires);
   }
 
+  //......................................................................
+  util::span<raw::ChannelID_t const*> GeometryCore::ChannelNeighbors(
+    raw::ChannelID_t channel) const
+  {
+    return ChannelAdjacencyTables().neighbors(channel);
+  } // GeometryCore::ChannelNeighbors()
+
+  //......................................................................
+  util::span<raw::ChannelID_t const*> GeometryCore::CrossingChannels(
+    raw::ChannelID_t channel) const
+  {
+    return ChannelAdjacencyTables().crossings(channel);
+  } // GeometryCore::CrossingChannels()
+
+  //......................................................................
+  geo::ChannelAdjacency const& GeometryCore::ChannelAdjacencyTables() const
+  {
+    return fChannelAdjacency.get([this]() { return MakeChannelAdjacency(); });
+  } // GeometryCore::ChannelAdjacencyTables()
+
+  //......................................................................
+  geo::ChannelAdjacency GeometryCore::MakeChannelAdjacency(unsigned int neighborDistance) const
+  {
+    auto const neighborsOf = [this, neighborDistance](raw::ChannelID_t channel,
+                                                      std::vector<raw::ChannelID_t>& channels) {
+      for (geo::WireID const& wireID : ChannelToWireIDs(channel)) {
+        if (!IsInBuildSubset(wireID)) continue;
+        unsigned int const nWires = Nwires(wireID);
+        unsigned int const first = wireID.Wire - std::min(wireID.Wire, neighborDistance);
+        unsigned int const last = std::min(wireID.Wire + neighborDistance + 1U, nWires);
+        for (geo::WireID neighbor{wireID, first}; neighbor.Wire < last; ++neighbor.Wire)
+          channels.push_back(PlaneWireToChannel(neighbor));
+      }
+    };
+
+    auto const crossingsOf = [this](raw::ChannelID_t channel,
+                                    std::vector<raw::ChannelID_t>& channels) {
+      geo::Point_t intersection;
+      for (geo::WireID const& wireID : ChannelToWireIDs(channel)) {
+        if (!IsInBuildSubset(wireID)) continue;
+        geo::TPCGeo const& tpc = TPC(wireID);
+        geo::details::WireIntersectionTables const& tables = tpc.WireIntersections();
+        for (geo::PlaneGeo const& plane : tpc.IteratePlanes()) {
+          geo::PlaneID const& planeID = plane.ID();
+          if (planeID.Plane == wireID.Plane) continue;
+          if (tables.hasPlanePair(planeID.Plane, wireID.Plane)) {
+            auto const [first, last] =
+              tables.crossingWires(planeID.Plane, wireID.Plane, wireID.Wire);
+            for (geo::WireID other{planeID, first}; other.Wire < last; ++other.Wire)
+              channels.push_back(PlaneWireToChannel(other));
+            continue;
+          }
+          // planes the tables do not cover: wire by wire
+          for (geo::WireID other{planeID, 0U}; other.Wire < plane.Nwires(); ++other.Wire) {
+            if (WireIDsIntersect(wireID, other, intersection))
+              channels.push_back(PlaneWireToChannel(other));
+          }
+        } // for planes
+      }   // for wires of the channel
+    };
+
+    return {Nchannels(), neighborDistance, neighborsOf, crossingsOf};
+  } // GeometryCore::MakeChannelAdjacency()
+
   //--------------------------------------------------------------------
   readout::ROPID GeometryCore::ChannelToROP(raw::ChannelID_t channel) const
   {
     return fChannelMapAlg->ChannelToROP(channel);
   } // GeometryCore::ChannelToROP()
 
+  //--------------------------------------------------------------------
+  void GeometryCore::ChannelsToROPs(util::span<raw::ChannelID_t const*> channels,
+                                    util::span<readout::ROPID*> ropids) const
+  {
+    fChannelMapAlg->ChannelsToROPs(channels, ropids);
+  } // GeometryCore::ChannelsToROPs()
+
+  //----------------------------------------------------------------------------
+  void GeometryCore::RouteChannels(util::span<raw::ChannelID_t const*> channels,
+                                   geo::ChannelRouting& routing) const
+  {
+    HotTables_t const& tables = HotTables();
+    std::vector<geo::ChannelRouting::Index_t> const& channelROPs = tables.channelROPs;
+    std::vector<readout::ROPID> const& ropIDs = tables.ropIDs;
+    routing.route(channels,
+                  {channelROPs.data(), channelROPs.data() + channelROPs.size()},
+                  {ropIDs.data(), ropIDs.data() + ropIDs.size()});
+  } // GeometryCore::RouteChannels()
+
   //----------------------------------------------------------------------------
   geo::Length_t GeometryCore::WireCoordinate(geo::Point_t const& pos,
                                              geo::PlaneID const& planeid) const
@@ -1173,6 +2336,15 @@ namespace geo {
     return fChannelMapAlg->WireCoordinate(YPos, ZPos, planeid);
   }
 
+  //----------------------------------------------------------------------------
+  void GeometryCore::WireCoordinates(util::span<double const*> YPos,
+                                     util::span<double const*> ZPos,
+                                     geo::PlaneID const& planeid,
+                                     util::span<double*> wireCoords) const
+  {
+    fChannelMapAlg->WireCoordinates(YPos, ZPos, planeid, wireCoords);
+  }
+
   //----------------------------------------------------------------------------
   // The NearestWire and PlaneWireToChannel are attempts to speed
   // up the simulation by memorizing the computationally intensive
@@ -1208,9 +2380,275 @@ namespace geo {
   geo::WireID GeometryCore::NearestWireID(geo::Point_t const& worldPos,
                                           geo::PlaneID const& planeid) const
   {
+    auto const query = StartQuery(Query_t::NearestWireID);
+    RecordQuery(RecordedKind_t::NearestWireID, worldPos, planeid);
     return Plane(planeid).NearestWireID(worldPos);
   }
 
+  //----------------------------------------------------------------------------
+  geo::QueryResult_t<geo::WireID> GeometryCore::TryNearestWireID(geo::Point_t const& worldPos,
+                                                                 geo::PlaneID const& planeid) const
+  {
+    auto const query = StartQuery(Query_t::NearestWireID);
+    RecordQuery(RecordedKind_t::TryNearestWireID, worldPos, planeid);
+    geo::PlaneGeo const* plane = PlanePtr(planeid);
+    if (!plane) {
+      query.miss();
+      return geo::queryFailure(geo::QueryError::NoPlane);
+    }
+    // same lookup as `geo::PlaneGeo::NearestWireID()`
+    int const nearestWireNo = plane->NearestWireNumber(plane->WireCoordinate(worldPos));
+    if ((nearestWireNo < 0) || ((unsigned int)nearestWireNo >= plane->Nwires())) {
+      query.miss();
+      return geo::queryFailure(geo::QueryError::WireOutOfRange);
+    }
+    return geo::WireID{planeid, (geo::WireID::WireID_t)nearestWireNo};
+  } // GeometryCore::TryNearestWireID()
+
+  //----------------------------------------------------------------------------
+  geo::WireID GeometryCore::NearestWireID(geo::Point_t const& worldPos,
+                                          geo::PlaneID::PlaneID_t plane,
+                                          geo::TPCID const& hint) const
+  {
+    auto const query = StartQuery(Query_t::NearestWireID);
+    RecordQuery(RecordedKind_t::NearestWireIDinTPC, worldPos, geo::PlaneID{hint, plane});
+    geo::TPCGeo const* tpc = PositionToTPCptr(worldPos, hint);
+    if (tpc) return tpc->Plane(plane).NearestWireID(worldPos);
+    query.miss();
+    return {};
+  }
+
+  //----------------------------------------------------------------------------
+  std::vector<geo::PlaneGeo::WireCrossing_t> GeometryCore::WireCrossings(
+    geo::Point_t const& start,
+    geo::Point_t const& end) const
+  {
+    std::vector<geo::PlaneGeo::WireCrossing_t> crossings;
+    geo::Vector_t const delta = end - start;
+    for (geo::TPCGeo const& TPC : IterateTPCs()) {
+      auto const [tMin, tMax] = clipToBox(TPC.ActiveBoundingBox(), start, delta);
+      if (tMin >= tMax) continue;
+      geo::Point_t const clippedStart = start + tMin * delta;
+      geo::Point_t const clippedEnd = start + tMax * delta;
+      std::size_t const firstNew = crossings.size();
+      for (geo::PlaneGeo const& plane : TPC.IteratePlanes())
+        plane.WireCrossings(clippedStart, clippedEnd, crossings);
+      // fractions are of the clipped segment: make them of the full one
+      for (std::size_t i = firstNew; i < crossings.size(); ++i)
+        crossings[i].fraction *= (tMax - tMin);
+    } // for TPCs
+    return crossings;
+  } // GeometryCore::WireCrossings()
+
+  //----------------------------------------------------------------------------
+  std::vector<geo::PlaneGeo::WireRange_t> GeometryCore::WiresInRange(
+    geo::BoxBoundedGeo const& box) const
+  {
+    return SelectWireRanges(geo::WireSelection{}.inBox(box));
+  } // GeometryCore::WiresInRange()
+
+  //----------------------------------------------------------------------------
+  std::vector<geo::PlaneGeo::WireRange_t> GeometryCore::SelectWireRanges(
+    geo::WireSelection const& selection) const
+  {
+    std::vector<geo::PlaneGeo::WireRange_t> ranges;
+    SelectWireRanges(selection, ranges);
+    return ranges;
+  } // GeometryCore::SelectWireRanges()
+
+  //----------------------------------------------------------------------------
+  void GeometryCore::SelectWireRanges(geo::WireSelection const& selection,
+                                      std::vector<geo::PlaneGeo::WireRange_t>& ranges) const
+  {
+    ranges.clear();
+    if (selection.isEmptyRegion()) return;
+    geo::BoxBoundedGeo const* box = selection.box();
+    geo::WireSelection::ViewMask_t const views = selection.views();
+    geo::SigType_t const sigType = selection.signalType();
+
+    auto const addTPC = [&, this](geo::TPCGeo const& TPC) {
+      std::optional<geo::BoxBoundedGeo> common;
+      if (box) {
+        geo::BoxBoundedGeo const& activeBox = TPC.ActiveBoundingBox();
+        if (!activeBox.Overlaps(*box)) return;
+        common = geo::WireSelection::overlap(*box, activeBox);
+      }
+      auto const addPlane = [&, this](geo::PlaneGeo const& plane) {
+        if ((sigType != geo::kMysteryType) && (SignalType(plane.ID()) != sigType)) return;
+        geo::PlaneGeo::WireRange_t const range =
+          common ? plane.WiresInRange(*common) :
+                   geo::PlaneGeo::WireRange_t{plane.ID(), 0U, plane.Nwires()};
+        if (!range.empty()) ranges.push_back(range);
+      };
+      if (views == 0U) {
+        for (geo::PlaneGeo const& plane : TPC.IteratePlanes())
+          addPlane(plane);
+        return;
+      }
+      // the planes of the selected views, from the view table, in plane order
+      if ((TPC.ViewMask() & views) == 0U) return;
+      util::small_vector<geo::PlaneID::PlaneID_t, 4U> planes;
+      for (std::size_t view = 0; view < geo::TPCGeo::MaxViews; ++view) {
+        if ((views & geo::TPCGeo::ViewBit(geo::View_t(view))) == 0U) continue;
+        if (!TPC.HasView(geo::View_t(view))) continue;
+        planes.push_back(TPC.PlaneNumber(geo::View_t(view)));
+      }
+      std::sort(planes.begin(), planes.end());
+      for (geo::PlaneID::PlaneID_t const p : planes)
+        addPlane(TPC.Plane(p));
+    };
+
+    if (selection.allTPCs()) {
+      for (geo::TPCGeo const& TPC : IterateTPCs())
+        addTPC(TPC);
+      return;
+    }
+
+    std::vector<geo::TPCID> TPCs;
+    for (readout::TPCsetID const& tpcsetid : selection.TPCsets()) {
+      auto const setTPCs = TPCsetToTPCIDs(tpcsetid);
+      TPCs.insert(TPCs.end(), setTPCs.begin(), setTPCs.end());
+    }
+    TPCs.insert(TPCs.end(), selection.TPCs().begin(), selection.TPCs().end());
+    std::sort(TPCs.begin(), TPCs.end());
+    TPCs.erase(std::unique(TPCs.begin(), TPCs.end()), TPCs.end());
+    for (geo::TPCID const& tpcid : TPCs) {
+      if (geo::TPCGeo const* TPC = TPCPtr(tpcid)) addTPC(*TPC);
+    }
+  } // GeometryCore::SelectWireRanges()
+
+  //----------------------------------------------------------------------------
+  geo::TPCID GeometryCore::ProjectOntoPlanes(geo::Point_t const& point,
+                                             std::vector<PlaneProjection_t>& projections,
+                                             geo::TPCID const& hint /* = {} */) const
+  {
+    projections.clear();
+    geo::TPCGeo const* tpc = PositionToTPCptr(point, hint);
+    if (!tpc) return {};
+    projections.resize(tpc->Nplanes());
+    double const x = point.X(), y = point.Y(), z = point.Z();
+    ProjectOntoPlanes(tpc->ID(), 1U, &x, &y, &z, projections.data());
+    return tpc->ID();
+  } // GeometryCore::ProjectOntoPlanes(Point_t)
+
+  //----------------------------------------------------------------------------
+  auto GeometryCore::ProjectOntoPlanes(geo::Point_t const& point) const
+    -> std::vector<PlaneProjection_t>
+  {
+    std::vector<PlaneProjection_t> projections;
+    ProjectOntoPlanes(point, projections);
+    return projections;
+  } // GeometryCore::ProjectOntoPlanes(Point_t)
+
+  //----------------------------------------------------------------------------
+  void GeometryCore::ProjectOntoPlanes(geo::TPCID const& tpcid,
+                                       std::size_t n,
+                                       double const* x,
+                                       double const* y,
+                                       double const* z,
+                                       PlaneProjection_t* projections) const
+  {
+    if (!HasTPC(tpcid)) {
+      throw cet::exception("GeometryCore")
+        << "ProjectOntoPlanes(): no " << std::string(tpcid) << " in the geometry!\n";
+    }
+    unsigned int const nPlanes = TPCUnchecked(tpcid).Nplanes();
+    if (nPlanes == 0U) return;
+    geo::details::WireCoordinateKernel const* kernels =
+      HotTables().planeKernels.data() + fPlaneIDmapper.index(geo::PlaneID{tpcid, 0});
+
+    // blocks of points small enough for their results to stay on the stack
+    constexpr std::size_t BlockSize = 256U;
+    double coords[BlockSize];
+    geo::details::WireCoordinateKernel::WireNo_t wires[BlockSize];
+    std::uint8_t valid[BlockSize];
+    for (std::size_t first = 0; first < n; first += BlockSize) {
+      std::size_t const nBlock = std::min(BlockSize, n - first);
+      for (unsigned int p = 0; p < nPlanes; ++p) {
+        geo::details::WireCoordinateKernel const& kernel = kernels[p];
+        kernel.wireCoordinates(nBlock, x + first, y + first, z + first, coords);
+        kernel.nearestWires(nBlock, x + first, y + first, z + first, wires, valid);
+        geo::PlaneID const planeID{tpcid, p};
+        PlaneProjection_t* proj = projections + first * nPlanes + p;
+        for (std::size_t i = 0; i < nBlock; ++i, proj += nPlanes) {
+          proj->plane = planeID;
+          proj->wireCoordinate = coords[i];
+          proj->nearestWire = geo::WireID{planeID, wires[i]};
+          proj->channel = PlaneWireToChannel(proj->nearestWire);
+          proj->inPlane = valid[i] != 0;
+        }
+      } // for planes
+    }   // for blocks
+  } // GeometryCore::ProjectOntoPlanes(TPCID)
+
+  //----------------------------------------------------------------------------
+  void GeometryCore::ProjectOntoPlanes(std::vector<geo::Point_t> const& points,
+                                       std::vector<PlaneProjection_t>& projections,
+                                       std::vector<std::size_t>& offsets) const
+  {
+    std::size_t const nPoints = points.size();
+    std::size_t const nBuckets = fTPCIDmapper.size();
+    std::size_t const NoBucket = nBuckets;
+
+    // the TPC of each point, looked for in chunks of consecutive points
+    constexpr std::size_t ChunkSize = 4096U;
+    std::vector<std::size_t> buckets(nPoints);
+    geo::runTasks(fTaskRunner, (nPoints + ChunkSize - 1U) / ChunkSize, [&](std::size_t chunk) {
+      geo::TPCID hint;
+      std::size_t const end = std::min(nPoints, (chunk + 1U) * ChunkSize);
+      for (std::size_t i = chunk * ChunkSize; i < end; ++i) {
+        geo::TPCGeo const* tpc = PositionToTPCptr(points[i], hint);
+        if (tpc) hint = tpc->ID();
+        buckets[i] = tpc ? fTPCIDmapper.index(hint) : NoBucket;
+      }
+    });
+
+    // room for the results, in input order; a counting sort of the points
+    std::vector<unsigned int> nPlanes(nBuckets + 1U, 0U);
+    std::vector<std::size_t> bucketStarts(nBuckets + 2U, 0U);
+    for (std::size_t b = 0; b < nBuckets; ++b)
+      nPlanes[b] = TPCUnchecked(fTPCIDmapper.ID(b)).Nplanes();
+    offsets.resize(nPoints + 1U);
+    offsets[0] = 0U;
+    for (std::size_t i = 0; i < nPoints; ++i) {
+      offsets[i + 1U] = offsets[i] + nPlanes[buckets[i]];
+      ++bucketStarts[buckets[i] + 1U];
+    }
+    projections.resize(offsets.back());
+    for (std::size_t b = 0; b <= nBuckets; ++b)
+      bucketStarts[b + 1U] += bucketStarts[b];
+    std::vector<std::size_t> order(nPoints);
+    {
+      std::vector<std::size_t> next(bucketStarts.begin(), bucketStarts.end() - 1);
+      for (std::size_t i = 0; i < nPoints; ++i)
+        order[next[buckets[i]]++] = i;
+    }
+
+    // each TPC projects its points in blocks, and scatters the results
+    geo::runTasks(fTaskRunner, nBuckets, [&](std::size_t b) {
+      std::size_t const first = bucketStarts[b], last = bucketStarts[b + 1U];
+      if ((first == last) || (nPlanes[b] == 0U)) return;
+      geo::TPCID const tpcid = fTPCIDmapper.ID(b);
+      constexpr std::size_t BlockSize = 256U;
+      double x[BlockSize], y[BlockSize], z[BlockSize];
+      std::vector<PlaneProjection_t> blockProjections(BlockSize * nPlanes[b]);
+      for (std::size_t start = first; start < last; start += BlockSize) {
+        std::size_t const nBlock = std::min(BlockSize, last - start);
+        for (std::size_t k = 0; k < nBlock; ++k) {
+          geo::Point_t const& point = points[order[start + k]];
+          x[k] = point.X();
+          y[k] = point.Y();
+          z[k] = point.Z();
+        }
+        ProjectOntoPlanes(tpcid, nBlock, x, y, z, blockProjections.data());
+        for (std::size_t k = 0; k < nBlock; ++k) {
+          auto const src = blockProjections.begin() + k * nPlanes[b];
+          std::copy(src, src + nPlanes[b], projections.begin() + offsets[order[start + k]]);
+        }
+      } // for blocks
+    });
+  } // GeometryCore::ProjectOntoPlanes(points)
+
   //----------------------------------------------------------------------------
   geo::WireID GeometryCore::NearestWireID(std::vector<double> const& worldPos,
                                           geo::PlaneID const& planeid) const
@@ -1254,14 +2692,8 @@ namespace geo {
     //  a wire number.  Perform the conversion here (although, maybe
     //  faster if we deal in wire numbers rather than channel numbers?)
 
-    // NOTE on failure both NearestChannel() and upstream:
-    // * according to documentation, should return invalid channel
-    // * in the actual code throw an exception because of a BUG
-    //
-    // The following implementation automatically becomes in fact compliant to
-    // the documentation if upstreams becomes compliant to.
-    // When that happens, just delete this comment.
-    geo::WireID const wireID = NearestWireID(worldPos, planeid);
+    // the checked query does not throw when the position is off the plane
+    geo::WireID const wireID = Plane(planeid).NearestWireIDchecked(worldPos);
     return wireID ? PlaneWireToChannel(wireID) : raw::InvalidChannelID;
   } // GeometryCore::NearestChannel()
 
@@ -1271,6 +2703,13 @@ namespace geo {
     return fChannelMapAlg->PlaneWireToChannel(wireid);
   }
 
+  //......................................................................
+  void GeometryCore::PlaneWireToChannels(util::span<geo::WireID const*> wireIDs,
+                                         util::span<raw::ChannelID_t*> channels) const
+  {
+    fChannelMapAlg->PlaneWireToChannels(wireIDs, channels);
+  }
+
   // Functions to allow determination if two wires intersect, and if so where.
   // This is useful information during 3D reconstruction.
   //......................................................................
@@ -1320,13 +2759,13 @@ namespace geo {
 
     // [GP] these errors should be exceptions, and this function is deprecated
     // because it violates interoperability
-    std::vector<geo::WireID> chan1wires = ChannelToWire(c1);
+    WireIDspan_t const chan1wires = ChannelToWireIDs(c1);
     if (chan1wires.empty()) {
       mf::LogError("ChannelsIntersect")
         << "1st channel " << c1 << " maps to no wire (is it a real one?)";
       return false;
     }
-    std::vector<geo::WireID> chan2wires = ChannelToWire(c2);
+    WireIDspan_t const chan2wires = ChannelToWireIDs(c2);
     if (chan2wires.empty()) {
       mf::LogError("ChannelsIntersect")
         << "2nd channel " << c2 << " maps to no wire (is it a real one?)";
@@ -1335,7 +2774,7 @@ namespace geo {
 
     if (chan1wires.size() > 1) {
       mf::LogWarning("ChannelsIntersect")
-        << "1st channel " << c1 << " maps to " << chan2wires.size() << " wires; using the first!";
+        << "1st channel " << c1 << " maps to " << chan1wires.size() << " wires; using the first!";
       return false;
     }
     if (chan2wires.size() > 1) {
@@ -1345,7 +2784,7 @@ namespace geo {
     }
 
     geo::WireIDIntersection widIntersect;
-    if (this->WireIDsIntersect(chan1wires[0], chan2wires[0], widIntersect)) {
+    if (this->WireIDsIntersect(*chan1wires.begin(), *chan2wires.begin(), widIntersect)) {
       y = widIntersect.y;
       z = widIntersect.z;
       return true;
@@ -1421,6 +2860,8 @@ namespace geo {
                                       const geo::WireID& wid2,
                                       geo::WireIDIntersection& widIntersect) const
   {
+    auto const query = StartQuery(Query_t::WireIDsIntersect);
+    RecordQuery(RecordedKind_t::WireIDsIntersect, wid1, wid2);
 
     static_assert(std::numeric_limits<decltype(widIntersect.y)>::has_infinity,
                   "the vector coordinate type can't represent infinity!");
@@ -1429,10 +2870,37 @@ namespace geo {
     if (!WireIDIntersectionCheck(wid1, wid2)) {
       widIntersect.y = widIntersect.z = infinity;
       widIntersect.TPC = geo::TPCID::InvalidID;
+      query.miss();
       return false;
     }
 
     // get the endpoints to see if wires intersect
+    geo::details::WireIntersectionTables const& tables = TPC(wid1).WireIntersections();
+    if (tables.hasPlanePair(wid1.Plane, wid2.Plane) &&
+        (std::abs(tables.wireDirection(wid1.Plane)[0]) <= tables.DirectionTolerance) &&
+        (std::abs(tables.wireDirection(wid2.Plane)[0]) <= tables.DirectionTolerance)) {
+      // wires on planes at constant x: the closest point is the (y, z) crossing
+      auto const crossing = tables.crossing(wid1.Plane, wid1.Wire, wid2.Plane, wid2.Wire);
+      widIntersect.y = crossing.point[1];
+      widIntersect.z = crossing.point[2];
+      auto const ends = [&tables](geo::WireID const& wid) {
+        auto const center = tables.wireCenter(wid.Plane, wid.Wire);
+        auto const& dir = tables.wireDirection(wid.Plane);
+        double const halfL = tables.wireHalfLength(wid.Plane, wid.Wire);
+        return std::array<double, 4U>{center[1] - halfL * dir[1],
+                                      center[2] - halfL * dir[2],
+                                      center[1] + halfL * dir[1],
+                                      center[2] + halfL * dir[2]};
+      };
+      auto const e1 = ends(wid1);
+      auto const e2 = ends(wid2);
+      bool const within = PointWithinSegments(
+        e1[0], e1[1], e1[2], e1[3], e2[0], e2[1], e2[2], e2[3], widIntersect.y, widIntersect.z);
+      widIntersect.TPC = (within ? wid1.TPC : geo::TPCID::InvalidID);
+      if (!within) query.miss();
+      return within;
+    }
+
     Segment_t const w1 = WireEndPoints(wid1);
     Segment_t const w2 = WireEndPoints(wid2);
 
@@ -1451,6 +2919,7 @@ namespace geo {
     if (!cross) {
       widIntersect.y = widIntersect.z = infinity;
       widIntersect.TPC = geo::TPCID::InvalidID;
+      query.miss();
       return false;
     }
     bool const within = PointWithinSegments(w1.start()[1],
@@ -1467,6 +2936,7 @@ namespace geo {
     widIntersect.TPC = (within ? wid1.TPC : geo::TPCID::InvalidID);
 
     // return whether the intersection is within the length of both wires
+    if (!within) query.miss();
     return within;
 
   } // GeometryCore::WireIDsIntersect(WireIDIntersection)
@@ -1476,6 +2946,8 @@ namespace geo {
                                       const geo::WireID& wid2,
                                       geo::Point_t& intersection) const
   {
+    auto const query = StartQuery(Query_t::WireIDsIntersect);
+    RecordQuery(RecordedKind_t::WireIDsIntersect, wid1, wid2);
     //
     // This is not a real 3D intersection: the wires do not cross, since they
     // are required to belong to two different planes.
@@ -1490,9 +2962,19 @@ namespace geo {
 
     if (!WireIDIntersectionCheck(wid1, wid2)) {
       intersection = {infinity, infinity, infinity};
+      query.miss();
       return false;
     }
 
+    // evenly spaced wires: the result is an affine function of the wire numbers
+    geo::details::WireIntersectionTables const& tables = TPC(wid1).WireIntersections();
+    if (tables.hasPlanePair(wid1.Plane, wid2.Plane)) {
+      auto const crossing = tables.crossing(wid1.Plane, wid1.Wire, wid2.Plane, wid2.Wire);
+      intersection = {crossing.point[0], crossing.point[1], crossing.point[2]};
+      if (!crossing.within) query.miss();
+      return crossing.within;
+    }
+
     geo::WireGeo const& wire1 = Wire(wid1);
     geo::WireGeo const& wire2 = Wire(wid2);
 
@@ -1505,6 +2987,7 @@ namespace geo {
                          (std::abs(intersectionAndOffset.offset2) <= wire2.HalfL()));
 
     // return whether the intersection is within the length of both wires
+    if (!within) query.miss();
     return within;
 
   } // GeometryCore::WireIDsIntersect(Point3D_t)
@@ -1573,16 +3056,11 @@ namespace geo {
 
     CheckIndependentPlanesOnSameTPC(pid1, pid2, "ThirdPlaneSlope()");
 
-    geo::TPCGeo const& TPC = this->TPC(pid1);
-
-    // We need the "wire coordinate direction" for each plane.
-    // This is perpendicular to the wire orientation.
-    // PlaneGeo::PhiZ() defines the right orientation too.
-    return ComputeThirdPlaneSlope(TPC.Plane(pid1).PhiZ(),
-                                  slope1,
-                                  TPC.Plane(pid2).PhiZ(),
-                                  slope2,
-                                  TPC.Plane(output_plane).PhiZ());
+    // the coefficients from the wire angles (PlaneGeo::PhiZ()) are cached
+    return ComputeThirdPlaneSlope(
+      TPC(pid1).ThirdPlaneSlopeCoefficients(pid1.Plane, pid2.Plane, output_plane.Plane),
+      slope1,
+      slope2);
   } // ThirdPlaneSlope()
 
   double GeometryCore::ThirdPlaneSlope(geo::PlaneID const& pid1,
@@ -1603,22 +3081,11 @@ namespace geo {
 
     CheckIndependentPlanesOnSameTPC(pid1, pid2, "ThirdPlane_dTdW()");
 
-    geo::TPCGeo const& TPC = this->TPC(pid1);
-
-    double angle[3], pitch[3];
-    geo::PlaneGeo const* const planes[3] = {
-      &TPC.Plane(pid1), &TPC.Plane(pid2), &TPC.Plane(output_plane)};
-
-    // We need wire pitch and "wire coordinate direction" for each plane.
-    // The latter is perpendicular to the wire orientation.
-    // PlaneGeo::PhiZ() defines the right orientation too.
-    for (size_t i = 0; i < 3; ++i) {
-      angle[i] = planes[i]->PhiZ();
-      pitch[i] = planes[i]->WirePitch();
-    } // for
-
+    // the coefficients from wire angles (PlaneGeo::PhiZ()) and pitches are cached
     return ComputeThirdPlane_dTdW(
-      angle[0], pitch[0], slope1, angle[1], pitch[1], slope2, angle[2], pitch[2]);
+      TPC(pid1).ThirdPlaneSlopeCoefficients(pid1.Plane, pid2.Plane, output_plane.Plane),
+      slope1,
+      slope2);
 
   } // GeometryCore::ThirdPlane_dTdW()
 
@@ -1683,6 +3150,30 @@ namespace geo {
            ComputeThirdPlaneSlope(angle1, dTdW1 / pitch1, angle2, dTdW2 / pitch2, angle_target);
   } // GeometryCore::ComputeThirdPlane_dTdW()
 
+  double GeometryCore::ComputeThirdPlaneSlope(
+    geo::TPCGeo::ThirdPlaneSlopeCoefficients_t const& coeffs,
+    double slope1,
+    double slope2)
+  {
+    // same as the computation from the angles, with the trigonometry cached
+    if ((std::abs(slope1) < 0.001) && (std::abs(slope2)) < 0.001) return 0.001;
+
+    double slope3 = 0.001;
+    if (std::abs(slope1) > 0.001 && std::abs(slope2) > 0.001)
+      slope3 = coeffs.coeff1 / slope1 + coeffs.coeff2 / slope2;
+
+    return (slope3 != 0.) ? 1. / slope3 : 999.;
+  } // GeometryCore::ComputeThirdPlaneSlope(ThirdPlaneSlopeCoefficients_t)
+
+  double GeometryCore::ComputeThirdPlane_dTdW(
+    geo::TPCGeo::ThirdPlaneSlopeCoefficients_t const& coeffs,
+    double dTdW1,
+    double dTdW2)
+  {
+    return coeffs.pitch3 *
+           ComputeThirdPlaneSlope(coeffs, dTdW1 * coeffs.invPitch1, dTdW2 * coeffs.invPitch2);
+  } // GeometryCore::ComputeThirdPlane_dTdW(ThirdPlaneSlopeCoefficients_t)
+
   //......................................................................
   // This function is called if it is determined that two wires in a single TPC must overlap.
   // To determine the yz coordinate of the wire intersection, we need to know the
@@ -1740,9 +3231,24 @@ namespace geo {
   //--------------------------------------------------------------------
   std::vector<geo::TPCID> GeometryCore::TPCsetToTPCs(readout::TPCsetID const& tpcsetid) const
   {
-    return fChannelMapAlg->TPCsetToTPCs(tpcsetid);
+    auto const tpcids = TPCsetToTPCIDs(tpcsetid);
+    return {tpcids.begin(), tpcids.end()};
   } // GeometryCore::TPCsetToTPCs()
 
+  //......................................................................
+  void GeometryCore::TPCsetToTPCs(readout::TPCsetID const& tpcsetid, TPCIDlist_t& tpcids) const
+  {
+    auto const ids = TPCsetToTPCIDs(tpcsetid);
+    tpcids.assign(ids.begin(), ids.end());
+  } // GeometryCore::TPCsetToTPCs(TPCIDlist_t)
+
+  //......................................................................
+  geo::ChannelMapAlg::TPCIDspan_t GeometryCore::TPCsetToTPCIDs(
+    readout::TPCsetID const& tpcsetid) const
+  {
+    return fChannelMapAlg->TPCsetToTPCIDs(tpcsetid);
+  } // GeometryCore::TPCsetToTPCIDs()
+
   //============================================================================
   //===  Readout plane information
   //===
@@ -1773,15 +3279,44 @@ namespace geo {
   //--------------------------------------------------------------------
   std::vector<geo::PlaneID> GeometryCore::ROPtoWirePlanes(readout::ROPID const& ropid) const
   {
-    return fChannelMapAlg->ROPtoWirePlanes(ropid);
+    auto const planeids = ROPtoWirePlaneIDs(ropid);
+    return {planeids.begin(), planeids.end()};
   } // GeometryCore::ROPtoWirePlanes()
 
+  //......................................................................
+  void GeometryCore::ROPtoWirePlanes(readout::ROPID const& ropid, PlaneIDlist_t& planeids) const
+  {
+    auto const ids = ROPtoWirePlaneIDs(ropid);
+    planeids.assign(ids.begin(), ids.end());
+  } // GeometryCore::ROPtoWirePlanes(PlaneIDlist_t)
+
+  //......................................................................
+  geo::ChannelMapAlg::PlaneIDspan_t GeometryCore::ROPtoWirePlaneIDs(
+    readout::ROPID const& ropid) const
+  {
+    return fChannelMapAlg->ROPtoWirePlaneIDs(ropid);
+  } // GeometryCore::ROPtoWirePlaneIDs()
+
   //--------------------------------------------------------------------
   std::vector<geo::TPCID> GeometryCore::ROPtoTPCs(readout::ROPID const& ropid) const
   {
-    return fChannelMapAlg->ROPtoTPCs(ropid);
+    auto const tpcids = ROPtoTPCIDs(ropid);
+    return {tpcids.begin(), tpcids.end()};
   } // GeometryCore::ROPtoTPCs()
 
+  //......................................................................
+  void GeometryCore::ROPtoTPCs(readout::ROPID const& ropid, TPCIDlist_t& tpcids) const
+  {
+    auto const ids = ROPtoTPCIDs(ropid);
+    tpcids.assign(ids.begin(), ids.end());
+  } // GeometryCore::ROPtoTPCs(TPCIDlist_t)
+
+  //......................................................................
+  geo::ChannelMapAlg::TPCIDspan_t GeometryCore::ROPtoTPCIDs(readout::ROPID const& ropid) const
+  {
+    return fChannelMapAlg->ROPtoTPCIDs(ropid);
+  } // GeometryCore::ROPtoTPCIDs()
+
   //--------------------------------------------------------------------
   raw::ChannelID_t GeometryCore::FirstChannelInROP(readout::ROPID const& ropid) const
   {
@@ -1812,33 +3347,9 @@ namespace geo {
   // Convert OpDet, Cryo into unique OpDet number
   unsigned int GeometryCore::OpDetFromCryo(unsigned int o, unsigned int c) const
   {
-    static bool Loaded = false;
-    static std::vector<unsigned int> LowestID;
-    static unsigned int NCryo;
-    // If not yet loaded static parameters, do it
-    if (Loaded == false) {
-
-      Loaded = true;
-
-      // Store the lowest ID for each cryostat
-      NCryo = Ncryostats();
-      LowestID.resize(NCryo + 1);
-      LowestID.at(0) = 0;
-      for (size_t cryo = 0; cryo != NCryo; ++cryo) {
-        LowestID.at(cryo + 1) = LowestID.at(cryo) + Cryostat(c).NOpDet();
-      }
-    }
-
-    if ((c < NCryo) && (o < Cryostat(c).NOpDet())) { return LowestID.at(c) + o; }
-    else {
-      throw cet::exception("OpDetCryoToOpID Error")
-        << "Coordinates c=" << c << ", o=" << o << " out of range. Abort\n";
-    }
-
-    // if all is well, we never get to this point in the method
-    // but still a good idea to be sure to always return something.
-
-    return INT_MAX;
+    if ((c < Ncryostats()) && (o < Cryostat(c).NOpDet())) { return fFirstOpDetInCryo[c] + o; }
+    throw cet::exception("OpDetCryoToOpID Error")
+      << "Coordinates c=" << c << ", o=" << o << " out of range. Abort\n";
   }
 
   //--------------------------------------------------------------------
@@ -1850,35 +3361,16 @@ namespace geo {
   //--------------------------------------------------------------------
   const OpDetGeo& GeometryCore::OpDetGeoFromOpDet(unsigned int OpDet) const
   {
-    static bool Loaded = false;
-    static std::vector<unsigned int> LowestID;
-    static size_t NCryo;
-    // If not yet loaded static parameters, do it
-    if (Loaded == false) {
-
-      Loaded = true;
-
-      // Store the lowest ID for each cryostat
-      NCryo = Ncryostats();
-      LowestID.resize(NCryo + 1);
-      LowestID[0] = 0;
-      for (size_t cryo = 0; cryo != NCryo; ++cryo) {
-        LowestID[cryo + 1] = LowestID[cryo] + Cryostat(cryo).NOpDet();
-      }
+    // the first cryostat with its first optical detector after OpDet is the
+    // one after the cryostat of OpDet
+    auto const itNext =
+      std::upper_bound(fFirstOpDetInCryo.begin(), fFirstOpDetInCryo.end(), OpDet);
+    if ((itNext == fFirstOpDetInCryo.begin()) || (itNext == fFirstOpDetInCryo.end())) {
+      throw cet::exception("OpID To OpDetCryo error") << "OpID out of range, " << OpDet << "\n";
     }
-
-    for (size_t i = 0; i != NCryo; ++i) {
-      if ((OpDet >= LowestID[i]) && (OpDet < LowestID[i + 1])) {
-        int c = i;
-        int o = OpDet - LowestID[i];
-        return this->Cryostat(c).OpDet(o);
-      }
-    }
-    // If we made it here, we didn't find the right combination. abort
-    throw cet::exception("OpID To OpDetCryo error") << "OpID out of range, " << OpDet << "\n";
-
-    // Will not reach due to exception
-    return this->Cryostat(0).OpDet(0);
+    auto const itCryo = std::prev(itNext);
+    unsigned int const c = std::distance(fFirstOpDetInCryo.begin(), itCryo);
+    return Cryostat(c).OpDet(OpDet - *itCryo);
   }
 
   //--------------------------------------------------------------------
@@ -1887,7 +3379,8 @@ namespace geo {
   {
     geo::CryostatGeo const* cryo = PositionToCryostatPtr(point);
     if (!cryo) return std::numeric_limits<unsigned int>::max();
-    int o = cryo->GetClosestOpDet(point);
+    unsigned int const o = cryo->GetClosestOpDet(point);
+    if (o == std::numeric_limits<unsigned int>::max()) return o; // no detector
     return OpDetFromCryo(o, cryo->ID().Cryostat);
   }
 
@@ -1898,6 +3391,52 @@ namespace geo {
     return GetClosestOpDet(geo::vect::makePointFromCoords(point));
   }
 
+  //......................................................................
+  util::span<unsigned int const*> GeometryCore::OpDetsFacingTPC(geo::TPCID const& tpcid) const
+  {
+    return OpDetTPCAssns().opDets(tpcid);
+  } // GeometryCore::OpDetsFacingTPC()
+
+  //......................................................................
+  util::span<geo::TPCID const*> GeometryCore::TPCsFacingOpDet(unsigned int OpDet) const
+  {
+    return OpDetTPCAssns().TPCs(OpDet);
+  } // GeometryCore::TPCsFacingOpDet()
+
+  //......................................................................
+  geo::OpDetTPCAssociation const& GeometryCore::OpDetTPCAssns() const
+  {
+    return fOpDetTPCAssns.get([this]() { return MakeOpDetTPCAssociation(); });
+  } // GeometryCore::OpDetTPCAssns()
+
+  //......................................................................
+  geo::OpDetTPCAssociation GeometryCore::MakeOpDetTPCAssociation(double maxDistance) const
+  {
+    using Assns_t = geo::OpDetTPCAssociation;
+
+    std::vector<Assns_t::TPCInfo_t> TPCs;
+    TPCs.reserve(TotalNTPC());
+    for (geo::TPCGeo const& tpc : IterateTPCs()) {
+      geo::BoxBoundedGeo const& box = tpc.ActiveBoundingBox();
+      auto const dir = tpc.DriftDir<geo::Vector_t>();
+      TPCs.push_back({tpc.ID(),
+                      {box.MinX(), box.MinY(), box.MinZ()},
+                      {box.MaxX(), box.MaxY(), box.MaxZ()},
+                      {dir.X(), dir.Y(), dir.Z()}});
+    }
+
+    std::vector<Assns_t::OpDetInfo_t> opDets;
+    opDets.reserve(NOpDets());
+    for (geo::CryostatGeo const& cryo : IterateCryostats()) {
+      for (unsigned int o = 0; o < cryo.NOpDet(); ++o) {
+        geo::Point_t const& center = cryo.OpDet(o).GetCenter();
+        opDets.push_back({cryo.ID().Cryostat, {center.X(), center.Y(), center.Z()}});
+      }
+    }
+
+    return {TPCs, opDets, maxDistance};
+  } // GeometryCore::MakeOpDetTPCAssociation()
+
   //--------------------------------------------------------------------
   bool GeometryCore::WireIDIntersectionCheck(const geo::WireID& wid1, const geo::WireID& wid2) const
   {
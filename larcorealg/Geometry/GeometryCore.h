@@ -36,22 +36,55 @@
 #define LARCOREALG_GEOMETRY_GEOMETRYCORE_H
 
 // LArSoft libraries
+#include "larcorealg/CoreUtils/CallSiteProfiler.h"
+#include "larcorealg/CoreUtils/LazyValue.h"
+#include "larcorealg/CoreUtils/MemoryUsage.h"
+#include "larcorealg/CoreUtils/NodeReplicas.h"
+#include "larcorealg/CoreUtils/QueryMetrics.h"
 #include "larcorealg/CoreUtils/RealComparisons.h"
+#include "larcorealg/CoreUtils/SmallVector.h"
+#include "larcorealg/CoreUtils/counter.h"
 #include "larcorealg/CoreUtils/span.h"
 #include "larcorealg/Geometry/AuxDetGeo.h"
 #include "larcorealg/Geometry/AuxDetSensitiveGeo.h"
+#include "larcorealg/Geometry/AuxDetSpatialIndex.h" // geo::AuxDetLocation
 #include "larcorealg/Geometry/BoxBoundedGeo.h"
+#include "larcorealg/Geometry/ChannelAdjacency.h"
 #include "larcorealg/Geometry/ChannelMapAlg.h"
+#include "larcorealg/Geometry/ChannelRouting.h"
+#include "larcorealg/Geometry/CompactGeometry.h"
 #include "larcorealg/Geometry/CryostatGeo.h"
+#include "larcorealg/Geometry/DensityVoxelMap.h"
+#include "larcorealg/Geometry/DeviceGeometryBuffer.h"
+#include "larcorealg/Geometry/DriftPartitions.h"
+#include "larcorealg/Geometry/GeoIDpacker.h"
 #include "larcorealg/Geometry/GeoObjectSorter.h"
 #include "larcorealg/Geometry/GeometryBuilder.h"
 #include "larcorealg/Geometry/GeometryData.h"
 #include "larcorealg/Geometry/GeometryDataContainers.h" // geo::TPCDataContainer
+#include "larcorealg/Geometry/GeometryIDmapper.h"       // geo::FlatGeoIDrange
+#include "larcorealg/Geometry/GeometryLoadReport.h"
+#include "larcorealg/Geometry/GeometryQueryRecorder.h"
+#include "larcorealg/Geometry/GeometrySnapshot.h"
+#include "larcorealg/Geometry/GeometrySubset.h"
 #include "larcorealg/Geometry/OpDetGeo.h"
+#include "larcorealg/Geometry/OpDetTPCAssociation.h"
 #include "larcorealg/Geometry/PlaneGeo.h"
-#include "larcorealg/Geometry/ReadoutDataContainers.h" // readout::ROPDataContainer
+#include "larcorealg/Geometry/QueryResult.h"
+#include "larcorealg/Geometry/ROOTGeometryNavigatorPool.h"
+#include "larcorealg/Geometry/ReadoutDataContainers.h" // readout::ROPDataContainer, ...
 #include "larcorealg/Geometry/TPCGeo.h"
+#include "larcorealg/Geometry/TaskRunner.h"
+#include "larcorealg/Geometry/WireEndpointBuffer.h"
 #include "larcorealg/Geometry/WireGeo.h"
+#include "larcorealg/Geometry/WireSelection.h"
+#include "larcorealg/Geometry/details/BoxBVH.h"
+#include "larcorealg/Geometry/details/BoxGridIndex.h"
+#include "larcorealg/Geometry/details/LRUCache.h"
+#include "larcorealg/Geometry/details/NodeNameIndex.h"
+#include "larcorealg/Geometry/details/OnceFlag.h"
+#include "larcorealg/Geometry/details/VolumeNameTable.h"
+#include "larcorealg/Geometry/details/WireCoordinateKernel.h"
 #include "larcorealg/Geometry/geo_vectors_utils.h"       // geo::vect namespace
 #include "larcoreobj/SimpleTypesAndConstants/RawTypes.h" // raw::ChannelID_t
 #include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
@@ -65,16 +98,22 @@
 #include "TVector3.h"
 
 // C/C++ standard libraries
+#include <cassert>
+#include <cmath>    // std::abs()
 #include <cstddef>  // size_t
+#include <cstdint>  // std::uint64_t
 #include <iterator> // std::forward_iterator_tag
 #include <memory>   // std::shared_ptr<>
 #include <set>
 #include <string>
+#include <string_view>
 #include <type_traits> // std::is_base_of<>
+#include <utility>     // std::move()
 #include <vector>
 
 // ROOT class prototypes
 class TGeoManager;
+class TGeoNavigator;
 class TGeoNode;
 class TGeoVolume;
 class TGeoMaterial;
@@ -1503,6 +1542,39 @@ namespace geo {
    * - *MinWireZDist* (real; default: 3)
    * - *PositionEpsilon* (real; default: 0.01%) set the default tolerance
    *   (see DefaultWiggle())
+   * - *UseDriftPartitions* (boolean; default: `false`): look up the TPC of a
+   *   position in the drift partitions first (see `DriftVolumes()`)
+   * - *CallProfiling* (table; optional): if present, the calls to the most
+   *   used queries are counted and their callers sampled, and a report is
+   *   printed on destruction (see `EnableCallProfiling()`):
+   *     - *SampleEvery* (integer; default: `1000`): record the caller of one
+   *       call every this many
+   *     - *MaxSamples* (integer; default: `1000`): maximum number of callers
+   *       kept per query
+   *     - *TopCallers* (integer; default: `10`): number of callers reported
+   *       per query
+   * - *QueryMetrics* (table; optional): if present, the calls, misses and
+   *   exceptions of the most used queries, here and in the channel mapping,
+   *   are counted and printed on destruction (see `EnableQueryMetrics()`):
+   *     - *Timing* (boolean; default: `false`): also collect the latency of
+   *       the calls
+   * - *QueryRecording* (table; optional): if present, the arguments of the
+   *   most used queries are written into a file, to be replayed later (see
+   *   `EnableQueryRecording()`):
+   *     - *File* (string; mandatory): path of the file to be written
+   *     - *SampleEvery* (integer; default: `1`): record one query every this
+   *       many
+   *     - *MaxQueries* (integer; default: `0`): stop recording after this many
+   *       queries (`0`: no limit)
+   * - *NUMAReplicas* (boolean; default: `false`): keep a copy of the hot
+   *   lookup tables on each NUMA node of the machine (see
+   *   `EnableNUMAReplicas()`)
+   * - *BuildSubset* (table; optional): the part of the detector to be fully
+   *   built (see `SetBuildSubset()`); if omitted, it is the whole detector:
+   *     - *Cryostats* (list of integers; default: none): number of the
+   *       cryostats with all their TPCs in the subset
+   *     - *TPCs* (list of pairs of integers; default: none): cryostat and TPC
+   *       number of each single TPC in the subset, e.g. `[ [ 0, 4 ], [ 0, 5 ] ]`
    *
    */
   class GeometryCore {
@@ -1541,6 +1613,48 @@ namespace geo {
     /// Type of list of auxiliary detectors
     using AuxDetList_t = GeometryData_t::AuxDetList_t;
 
+    /// Type of view of the list of wires connected to a channel.
+    using WireIDspan_t = geo::ChannelMapAlg::WireIDspan_t;
+
+    /// Type of short list of wire IDs, allocating no memory for up to two.
+    using WireIDlist_t = util::small_vector<geo::WireID, 2U>;
+
+    /// Type of short list of plane IDs, allocating no memory for up to two.
+    using PlaneIDlist_t = util::small_vector<geo::PlaneID, 2U>;
+
+    /// Type of short list of TPC IDs, allocating no memory for up to two.
+    using TPCIDlist_t = util::small_vector<geo::TPCID, 2U>;
+
+    /// Type of range of consecutive channel IDs.
+    using ChannelIDrange_t = decltype(util::counter(raw::ChannelID_t{}, raw::ChannelID_t{}));
+
+    /// Type of view of the list of wire objects connected to a channel.
+    using WireGeoPtrSpan_t = util::span<std::vector<geo::WireGeo const*>::const_iterator>;
+
+    /// Type of view of a list of wire plane objects (see `FlatPlanes()`).
+    using PlaneGeoPtrSpan_t = util::span<std::vector<geo::PlaneGeo const*>::const_iterator>;
+
+    /// Type of view of a list of TPC objects (see `FlatTPCs()`).
+    using TPCGeoPtrSpan_t = util::span<std::vector<geo::TPCGeo const*>::const_iterator>;
+
+    /// Numeric handle of a volume name (see `VolumeHandle()`).
+    using VolumeHandle_t = geo::details::VolumeNameTable::Handle_t;
+
+    /// Handle of no volume.
+    static constexpr VolumeHandle_t InvalidVolumeHandle =
+      geo::details::VolumeNameTable::InvalidHandle;
+
+    /// Stretch of a trajectory in the active volume of a TPC (see `TPCCrossings()`).
+    struct TPCCrossing_t {
+      geo::TPCID ID;       ///< ID of the crossed TPC.
+      geo::Point_t entry;  ///< Where the trajectory enters the active volume.
+      geo::Point_t exit;   ///< Where the trajectory leaves the active volume.
+      double length = 0.0; ///< Length of the trajectory in the active volume [cm]
+    };
+
+    /// Type of view of a trajectory, as a sequence of points.
+    using TrajectorySpan_t = util::span<geo::Point_t const*>;
+
     /// Wires must be found in GDML description within this number of nested
     /// volumes.
     static constexpr std::size_t MaxWireDepthInGDML = 20U;
@@ -1790,6 +1904,9 @@ namespace geo {
     /// Returns a string with the name of the detector, as configured
     std::string DetectorName() const { return fDetectorName; }
 
+    /// Returns the name of the detector, as configured, with no copy.
+    std::string_view DetectorNameView() const { return fDetectorName; }
+
     //
     // position
     //
@@ -1819,6 +1936,7 @@ namespace geo {
       const;
 
     /// Returns a box with the extremes of the world volume (from shape axes).
+    /// The box is computed once per geometry.
     /// @see `GetWorldVolumeName()`
     geo::BoxBoundedGeo WorldBox() const;
 
@@ -1845,13 +1963,36 @@ namespace geo {
     /// Access to the ROOT geometry description manager
     TGeoManager* ROOTGeoManager() const;
 
+    /**
+     * @brief Returns a ROOT geometry navigator reserved to the calling thread.
+     * @see `geo::ROOTGeometryNavigatorPool`
+     *
+     * Point and tracking queries (`FindNode()`, `InitTrack()`, `Step()`...)
+     * through this navigator do not disturb, and are not disturbed by, the
+     * ones from other threads or through `ROOTGeoManager()` directly.
+     * `VolumeName()`, `Material()` and `MassBetweenPoints()` use it.
+     */
+    TGeoNavigator& ROOTNavigator() const;
+
     /// Return the name of the world volume (needed by Geant4 simulation)
     const std::string GetWorldVolumeName() const;
 
-    /// Returns the absolute  coordinates of the detector enclosure volume [cm].
-    /// @param name name of the volume to be sought (default: `volDetEnclosure`)
-    /// @throw cet::exception if the specified volume is not found
-    geo::BoxBoundedGeo DetectorEnclosureBox(std::string const& name = "volDetEnclosure") const;
+    /// Returns the name of the world volume, with no copy.
+    std::string_view WorldVolumeNameView() const { return "volWorld"; }
+
+    /// Name of the detector enclosure volume used by default.
+    static constexpr char const* DefaultDetectorEnclosureName = "volDetEnclosure";
+
+    /**
+     * @brief Returns the absolute coordinates of the detector enclosure volume [cm].
+     * @param name name of the volume to be sought (default: `volDetEnclosure`)
+     * @throw cet::exception if the specified volume is not found
+     *
+     * The box is computed once per geometry: the one of the default volume is
+     * always kept, and the ones of the last few other names are cached too.
+     */
+    geo::BoxBoundedGeo DetectorEnclosureBox(
+      std::string const& name = DefaultDetectorEnclosureName) const;
 
     //@{
     /**
@@ -1859,6 +2000,9 @@ namespace geo {
      * @param point the location to query, in world coordinates
      * @return name of the volume containing the point
      *
+     * This method uses the navigator of the calling thread (`ROOTNavigator()`)
+     * and it can be called concurrently.
+     *
      * @todo what happens if none?
      * @todo Unify the coordinates type
      */
@@ -1869,6 +2013,50 @@ namespace geo {
     }
     //@}
 
+    /**
+     * @brief Returns the name of the deepest volume containing specified point
+     * @param point the location to query, in world coordinates
+     * @return name of the node of the volume containing the point
+     * @see `VolumeName()`
+     *
+     * This is `VolumeName()` with no string built: the name is owned by the
+     * ROOT geometry, and it stays valid as long as the geometry is loaded.
+     * Outside the world volume, `"unknownVolume"` is returned.
+     */
+    std::string_view VolumeNameView(geo::Point_t const& point) const;
+
+    /**
+     * @brief Returns the handle of the volume with the specified `name`.
+     * @param name name of the volume (`TGeoVolume`, not of its node)
+     * @return the handle of the volume, `InvalidVolumeHandle` if none
+     *
+     * The names of all the volumes of the geometry are collected when the
+     * geometry is loaded, and each distinct name gets a numeric handle.
+     * Handles are meant to be looked up once, and then compared with the ones
+     * of each point (`VolumeHandleAt()`) instead of names:
+     * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+     * auto const activeVolume = geom.VolumeHandle(geom.TPCVolumeNameView(tpcid));
+     * // ...
+     * if (geom.VolumeHandleAt(point) == activeVolume) { ... }
+     * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+     * Handles change when a geometry is loaded again.
+     */
+    VolumeHandle_t VolumeHandle(std::string_view name) const { return fVolumeNames.handle(name); }
+
+    /**
+     * @brief Returns the handle of the deepest volume containing the `point`.
+     * @param point the location to query, in world coordinates
+     * @return the handle of the volume, `InvalidVolumeHandle` if outside world
+     * @see `VolumeHandle()`
+     *
+     * The volume is found with the navigator of the calling thread, and its
+     * handle by an array lookup: no string is involved.
+     */
+    VolumeHandle_t VolumeHandleAt(geo::Point_t const& point) const;
+
+    /// Returns the name of the volume with the specified `handle` (empty if invalid).
+    std::string_view VolumeName(VolumeHandle_t handle) const { return fVolumeNames.name(handle); }
+
     /**
      * @brief Returns all the nodes with volumes with any of the specified names
      * @param vol_names list of names of volumes
@@ -1876,7 +2064,11 @@ namespace geo {
      *
      * All the nodes in the geometry are checked, and all the ones that contain
      * a volume with a name among the ones specified in vol_names are saved
-     * in the collection and returned.
+     * in the collection and returned, in the order of
+     * `geo::ROOTGeoNodeForwardIterator`.
+     * The nodes are looked up in an index by volume name, which is built on
+     * the first call of this method or of `FindAllVolumePaths()` without
+     * moving any ROOT navigator; this method can be called concurrently.
      */
     std::vector<TGeoNode const*> FindAllVolumes(std::set<std::string> const& vol_names) const;
 
@@ -1892,11 +2084,13 @@ namespace geo {
      * starting from thetop level (root) down. The node at the `back()` of the
      * path is the one with name in vol_names.
      * No empty paths are returned.
+     * The paths are rebuilt from the same index as `FindAllVolumes()`.
      */
     std::vector<std::vector<TGeoNode const*>> FindAllVolumePaths(
       std::set<std::string> const& vol_names) const;
 
     /// Returns the material at the specified position
+    /// (using the navigator of the calling thread, see `ROOTNavigator()`).
     TGeoMaterial const* Material(geo::Point_t const& point) const;
     //@{
     /**
@@ -1929,11 +2123,88 @@ namespace geo {
      * which the integral leads from `p1` to `p2` in a straight line.
      *
      * Both points are specified in world coordinates.
+     * The stepping is performed with the navigator of the calling thread
+     * (`ROOTNavigator()`), and this method can be called concurrently.
+     * For many queries, a faster approximation is offered by
+     * `geo::DensityVoxelMap::columnDensity()` (see `BuildDensityVoxelMap()`).
      */
     double MassBetweenPoints(geo::Point_t const& p1, geo::Point_t const& p2) const;
     double MassBetweenPoints(double* p1, double* p2) const;
     //@}
 
+    /**
+     * @brief Samples the density of the geometry materials on a voxel grid.
+     * @param region the box to be covered by the map [cm]
+     * @param voxelSize the largest size of a voxel on each direction [cm]
+     * @param samplesPerAxis number of samples per voxel on each direction
+     * @return the map of the density, in g/cm&sup3;
+     * @throws cet::exception ("GeometryCore" category) on invalid parameters
+     *
+     * Each voxel is sampled on a regular grid of `samplesPerAxis` points on
+     * each direction, querying `Material()` at each of them (no material means
+     * no density). The voxels are all of the same size, no larger than
+     * `voxelSize`, and they cover `region` exactly.
+     *
+     * The map column densities from `geo::DensityVoxelMap::columnDensity()`
+     * are in the same units as `MassBetweenPoints()` returns. Thin volumes,
+     * smaller than the sampling step, may be missed entirely, and the
+     * resolution and sampling should be chosen accordingly.
+     * The map does not depend on this object after it has been built.
+     */
+    geo::DensityVoxelMap BuildDensityVoxelMap(geo::BoxBoundedGeo const& region,
+                                              double voxelSize,
+                                              unsigned int samplesPerAxis = 2U) const;
+
+    /**
+     * @brief Returns the derived geometry in a flat, ROOT-independent format.
+     * @see `geo::GeometrySnapshot`
+     *
+     * The snapshot contains the cryostats, TPCs, planes, wires and optical
+     * detectors as they are after sorting, and it can be saved to a file with
+     * `geo::GeometrySnapshot::write()`.
+     */
+    geo::GeometrySnapshot MakeGeometrySnapshot() const;
+
+    /**
+     * @brief Returns a fingerprint of the content of the derived geometry.
+     * @return a 64-bit hash of the geometry content, `0` if none is loaded
+     *
+     * The fingerprint is computed when the channel mapping is applied and
+     * after each alignment update (`ApplyAlignment()`), and it covers the
+     * detector name, the boundaries of cryostats and TPCs, the placement,
+     * sorting and wire layout of each plane, and the class and channel count
+     * of the channel mapping. Two geometries with the same fingerprint can be
+     * assumed to describe the same detector, so that the fingerprint can be
+     * used as a key of caches of derived information.
+     * Wires enter the fingerprint through their number, pitch and the
+     * placement of the first and last wire of each plane, so that the wires
+     * built on demand are not built by the computation.
+     * The value is stable across processes of the same build, but it is not
+     * meant to be stored for comparison with different software releases.
+     */
+    std::uint64_t Fingerprint() const { return fFingerprint; }
+
+    /**
+     * @brief Returns TPCs and wire planes in single precision.
+     * @see `geo::CompactGeometry`
+     *
+     * The coefficients of the plane decompositions are computed in double
+     * precision and then rounded, so that the single precision wire
+     * coordinate and distance are as accurate as the position itself.
+     */
+    geo::CompactGeometry MakeCompactGeometry() const;
+
+    /**
+     * @brief Returns a flat buffer to locate wires and channels in device code.
+     * @see `geo::device::GeometryView`, `geo::makeDeviceGeometryBuffer()`
+     *
+     * The buffer holds the content of `MakeCompactGeometry()` and the channel
+     * of each wire. It has no pointers and it can be copied as it is to GPU
+     * memory, where `geo::device::GeometryView` runs the same queries as on
+     * the host.
+     */
+    geo::DeviceGeometryBuffer_t MakeDeviceGeometryBuffer() const;
+
     /// Prints geometry information with maximum verbosity.
     template <typename Stream>
     void Print(Stream&& out, std::string indent = "  ") const;
@@ -2084,6 +2355,23 @@ namespace geo {
     }
     //@}
 
+    /**
+     * @brief Returns the specified cryostat, which must exist (not checked)
+     * @param cryoid cryostat ID
+     * @return a constant reference to the specified cryostat
+     * @see `Cryostat()`
+     *
+     * This and the other "unchecked" accessors (`TPCUnchecked()`,
+     * `PlaneUnchecked()`, `WireUnchecked()`) are for IDs known to be valid,
+     * like the ones from the iterators of this geometry: the ID is checked only
+     * by assertions, which are compiled out in optimized builds.
+     */
+    CryostatGeo const& CryostatUnchecked(geo::CryostatID const& cryoid) const
+    {
+      assert(HasCryostat(cryoid));
+      return Cryostats()[cryoid.Cryostat];
+    }
+
     //@{
     /**
      * @brief Returns the index of the cryostat at specified location
@@ -2114,12 +2402,30 @@ namespace geo {
      */
     geo::CryostatID PositionToCryostatID(geo::Point_t const& point) const;
 
+    /**
+     * @brief Returns the IDs of the cryostats at the specified locations.
+     * @param points the locations [cm]
+     * @param cryoids _(output)_ the ID of the cryostat including each point
+     * @throws cet::exception ("GeometryCore" category) if `cryoids` is shorter
+     *         than `points`
+     * @see `PositionToCryostatID()`, `FindTPCsAtPositions()`
+     *
+     * Each point is assigned the same ID as by `PositionToCryostatID()`, but
+     * the cryostat of the previous point is checked first, which is faster
+     * when the points are in sequence along a trajectory.
+     * For a point in the overlap of the tolerance margins of two cryostats
+     * either of them may be returned.
+     */
+    void PositionsToCryostatIDs(util::span<geo::Point_t const*> points,
+                                util::span<geo::CryostatID*> cryoids) const;
+
     //@{
     /**
      * @brief Returns the cryostat at specified location.
      * @param point the location [cm]
      * @return a constant reference to the `geo::CryostatGeo` containing `point`
-     * @throws cet::exception ("Geometry" category) if no cryostat matches
+     * @throws geo::PositionLookupError ("GeometryCore" category) if no cryostat
+     *         matches
      *
      * The tolerance used here is the one returned by DefaultWiggle().
      */
@@ -2130,6 +2436,22 @@ namespace geo {
     }
     //@}
 
+    /**
+     * @brief Returns the cryostat at specified location, without throwing.
+     * @param point the location [cm]
+     * @return the cryostat including `point`, or `geo::QueryError::NoCryostat`
+     * @see `PositionToCryostat()`, `geo::QueryResult_t`
+     *
+     * The cryostat is found as by `PositionToCryostatPtr()`.
+     */
+    geo::QueryResult_t<geo::CryostatGeo const&> TryPositionToCryostat(
+      geo::Point_t const& point) const
+    {
+      geo::CryostatGeo const* cryo = PositionToCryostatPtr(point);
+      if (!cryo) return geo::queryFailure(geo::QueryError::NoCryostat);
+      return *cryo;
+    }
+
     /**
      * @brief Returns the cryostat at specified location
      * @param worldLoc 3D coordinates of the point (world reference frame)
@@ -2328,6 +2650,12 @@ namespace geo {
     }
     //@}
 
+    /// Returns the name of the volume of the cryostat `cid`, with no copy.
+    std::string_view CryostatVolumeNameView(geo::CryostatID const& cid) const
+    {
+      return Cryostat(cid).Volume()->GetName();
+    }
+
     /// @} Cryostat access and information
 
     /// @name TPC access and information
@@ -2348,10 +2676,10 @@ namespace geo {
     unsigned int NTPC(unsigned int cstat = 0) const { return NTPC(geo::CryostatID(cstat)); }
 
     /// Returns the largest number of TPCs a cryostat in the detector has
-    unsigned int MaxTPCs() const;
+    unsigned int MaxTPCs() const { return fMaxTPCs; }
 
     /// Returns the total number of TPCs in the detector
-    unsigned int TotalNTPC() const;
+    unsigned int TotalNTPC() const { return fTotalNTPC; }
 
     /**
      * @brief Returns a container with one entry per TPC.
@@ -2412,6 +2740,45 @@ namespace geo {
       return {Ncryostats(), MaxTPCs(), defValue};
     }
 
+    /**
+     * @brief Returns the mapping of the IDs of all the existing TPCs.
+     * @see `makeCompressedTPCData()`
+     *
+     * The mapping covers only the TPCs which exist in each cryostat.
+     */
+    geo::CompressedTPCIDmapper<> makeCompressedTPCMapper() const
+    {
+      return {{Ncryostats()}, [this](geo::CryostatID const& cryoid) { return NTPC(cryoid); }};
+    }
+
+    /**
+     * @brief Returns a container with one entry per existing TPC.
+     * @tparam T type of data in the container
+     * @return a container with one default-constructed `T` per TPC
+     * @see `geo::CompressedTPCDataContainer`, `makeTPCData()`
+     *
+     * Unlike `makeTPCData()`, the container has no entry for non-existing
+     * TPCs, which is convenient when cryostats have different numbers of TPCs.
+     */
+    template <typename T>
+    geo::CompressedTPCDataContainer<T> makeCompressedTPCData() const
+    {
+      return geo::CompressedTPCDataContainer<T>{makeCompressedTPCMapper()};
+    }
+
+    /**
+     * @brief Returns a container with one entry per existing TPC.
+     * @tparam T type of data in the container
+     * @param defValue the initial value of all elements in the container
+     * @return a container with a value `defValue` per each TPC
+     * @see `geo::CompressedTPCDataContainer`, `makeTPCData()`
+     */
+    template <typename T>
+    geo::CompressedTPCDataContainer<T> makeCompressedTPCData(T const& defValue) const
+    {
+      return {makeCompressedTPCMapper(), defValue};
+    }
+
     //@{
     /**
      * @brief Returns the total number of TPCs in the specified cryostat
@@ -2483,6 +2850,14 @@ namespace geo {
       return pCryo ? pCryo->TPCPtr(tpcid) : nullptr;
     } // TPCPtr()
     TPCGeo const* GetElementPtr(geo::TPCID const& tpcid) const { return TPCPtr(tpcid); }
+
+    /// Returns the specified TPC, which must exist (not checked).
+    /// @see `CryostatUnchecked()`
+    TPCGeo const& TPCUnchecked(geo::TPCID const& tpcid) const
+    {
+      assert(HasTPC(tpcid));
+      return *fTPCPtrs[tpcid];
+    }
     //@}
 
     /**
@@ -2508,6 +2883,21 @@ namespace geo {
     }
     //@}
 
+    /**
+     * @brief Returns the ID of the TPC at specified location.
+     * @param point 3D point (world reference frame, centimeters)
+     * @param hint ID of the TPC where `point` is expected to be
+     * @return the TPC ID, or an invalid one if no TPC is there
+     * @see `PositionToTPCptr(geo::Point_t const&, geo::TPCID const&) const`
+     *
+     * The result is the same as `FindTPCAtPosition(point)`, but the TPC
+     * `hint` and the ones adjacent to it are checked first. This is meant for
+     * points stepping along a trajectory, where `hint` is the previous result.
+     * For a point in the overlap of the tolerance margins of two TPCs either
+     * of them may be returned.
+     */
+    geo::TPCID FindTPCAtPosition(geo::Point_t const& point, geo::TPCID const& hint) const;
+
     /**
      * @brief Returns the TPC at specified location.
      * @param point the location [cm]
@@ -2515,12 +2905,25 @@ namespace geo {
      */
     geo::TPCGeo const* PositionToTPCptr(geo::Point_t const& point) const;
 
+    /**
+     * @brief Returns the TPC at specified location.
+     * @param point the location [cm]
+     * @param hint ID of the TPC where `point` is expected to be
+     * @return the `geo::TPCGeo` including `point`, or `nullptr` if none
+     * @see `geo::CryostatGeo::AdjacentTPCs()`
+     *
+     * The TPC `hint` and the ones adjacent to it are checked first, and only
+     * if none of them includes `point` the full search is performed. An
+     * invalid or non-existing `hint` is ignored.
+     */
+    geo::TPCGeo const* PositionToTPCptr(geo::Point_t const& point, geo::TPCID const& hint) const;
+
     //@{
     /**
      * @brief Returns the TPC at specified location.
      * @param point the location [cm]
      * @return a constant reference to the `geo::TPCGeo` including `point`
-     * @throws cet::exception ("Geometry" category) if no TPC matches
+     * @throws geo::PositionLookupError ("GeometryCore" category) if no TPC matches
      */
     geo::TPCGeo const& PositionToTPC(geo::Point_t const& point) const;
     TPCGeo const& PositionToTPC(double const point[3]) const
@@ -2529,6 +2932,31 @@ namespace geo {
     }
     //@}
 
+    //@{
+    /**
+     * @brief Returns the TPC at specified location, without throwing.
+     * @param point the location [cm]
+     * @param hint ID of the TPC where `point` is expected to be
+     * @return the TPC including `point`, or `geo::QueryError::NoTPC`
+     * @see `PositionToTPC()`, `geo::QueryResult_t`
+     *
+     * The TPC is found as by `PositionToTPCptr()`, where `hint` is described.
+     */
+    geo::QueryResult_t<geo::TPCGeo const&> TryPositionToTPC(geo::Point_t const& point) const
+    {
+      geo::TPCGeo const* tpc = PositionToTPCptr(point);
+      if (!tpc) return geo::queryFailure(geo::QueryError::NoTPC);
+      return *tpc;
+    }
+    geo::QueryResult_t<geo::TPCGeo const&> TryPositionToTPC(geo::Point_t const& point,
+                                                            geo::TPCID const& hint) const
+    {
+      geo::TPCGeo const* tpc = PositionToTPCptr(point, hint);
+      if (!tpc) return geo::queryFailure(geo::QueryError::NoTPC);
+      return *tpc;
+    }
+    //@}
+
     /**
      * @brief Returns the TPC at specified location.
      * @param point the location [cm]
@@ -2560,6 +2988,85 @@ namespace geo {
      */
     geo::TPCID PositionToTPCID(geo::Point_t const& point) const;
 
+    /**
+     * @brief Returns the IDs of the TPCs at the specified locations.
+     * @param points the locations [cm]
+     * @param tpcids _(output)_ the ID of the TPC including each point
+     * @throws cet::exception ("GeometryCore" category) if `tpcids` is shorter
+     *         than `points`
+     *
+     * Each point is assigned the same ID as by `FindTPCAtPosition()`: when no
+     * TPC includes a point, the ID is invalid but still carries the cryostat
+     * when the point is inside one. The TPC of the previous point and the ones
+     * adjacent to it are checked first (see
+     * `FindTPCAtPosition(geo::Point_t const&, geo::TPCID const&) const`), so
+     * that points in sequence along a trajectory are resolved without a full
+     * search. For a point in the overlap of the tolerance
+     * margins of two TPCs either of them may be returned.
+     *
+     * Example:
+     * @code{.cpp}
+     * std::vector<geo::Point_t> const& points = trajectoryPoints();
+     * std::vector<geo::TPCID> tpcids(points.size());
+     * geom->FindTPCsAtPositions({ points.data(), points.data() + points.size() },
+     *                           { tpcids.data(), tpcids.data() + tpcids.size() });
+     * @endcode
+     */
+    void FindTPCsAtPositions(util::span<geo::Point_t const*> points,
+                             util::span<geo::TPCID*> tpcids) const;
+
+    /**
+     * @brief Returns the drift volumes of the specified cryostat.
+     * @param cryoid ID of the cryostat
+     * @return the partition of the cryostat in drift volumes
+     * @throws cet::exception ("GeometryCore" category) if no such cryostat
+     * @see `geo::buildDriftVolumes()`
+     *
+     * The drift volumes of all cryostats are built on the first call of this
+     * or of `AllDriftVolumes()`, once for all the users, and kept until the
+     * geometry is sorted again. The first call may come from any thread.
+     */
+    geo::DriftPartitions const& DriftVolumes(geo::CryostatID const& cryoid) const;
+
+    /// Returns the drift volumes of all cryostats, by cryostat number.
+    /// @see `DriftVolumes()`
+    std::vector<geo::DriftPartitions> const& AllDriftVolumes() const;
+
+    /// Returns whether the TPC lookups try the drift volumes first.
+    bool UsesDriftPartitions() const { return fUseDriftPartitions; }
+
+    /**
+     * @brief Returns where a trajectory crosses the active volumes of TPCs.
+     * @param trajectory the points of the trajectory, in order [cm]
+     * @return the stretches of the trajectory in each TPC, in trajectory order
+     * @see `geo::details::findPathCrossings()`
+     *
+     * The trajectory is the sequence of straight steps between consecutive
+     * points. Each time the trajectory enters the active volume of a TPC, a
+     * crossing is added with the entry and exit points and the length of the
+     * trajectory until it leaves that volume; a trajectory starting (ending)
+     * in a TPC has its first (last) point as entry (exit) there.
+     *
+     * The steps are intersected only with the TPCs they may cross, found
+     * through a hierarchy of the active volumes, which is built on the first
+     * call of this method and kept until the geometry is sorted again.
+     */
+    std::vector<TPCCrossing_t> TPCCrossings(TrajectorySpan_t trajectory) const;
+
+    /**
+     * @brief Returns where each of the trajectories crosses the TPCs.
+     * @param trajectories the trajectories
+     * @param[out] crossings the crossings of each of the trajectories
+     * @throws cet::exception ("GeometryCore" category) if `crossings` is
+     *         shorter than `trajectories`
+     * @see `TPCCrossings(TrajectorySpan_t)`
+     *
+     * The content of each of the `crossings` is replaced, and its storage is
+     * reused: the same output vectors can be passed event after event.
+     */
+    void TPCCrossings(util::span<TrajectorySpan_t const*> trajectories,
+                      util::span<std::vector<TPCCrossing_t>*> crossings) const;
+
     ///
     /// iterators
     ///
@@ -2890,6 +3397,12 @@ namespace geo {
     }
     //@}
 
+    /// Returns the name of the active volume of the TPC `tpcid`, with no copy.
+    std::string_view TPCVolumeNameView(geo::TPCID const& tpcid) const
+    {
+      return TPC(tpcid).ActiveVolume()->GetName();
+    }
+
     /// @} TPC access and information
 
     /// @name Plane access and information
@@ -2914,7 +3427,7 @@ namespace geo {
     }
 
     /// Returns the largest number of planes among all TPCs in this detector
-    unsigned int MaxPlanes() const;
+    unsigned int MaxPlanes() const { return fMaxPlanes; }
 
     /**
      * @brief Returns a container with one entry per wire plane.
@@ -2973,6 +3486,51 @@ namespace geo {
       return {Ncryostats(), MaxTPCs(), MaxPlanes(), defValue};
     }
 
+    /**
+     * @brief Returns the mapping of the IDs of all the existing planes.
+     * @see `makeCompressedPlaneData()`
+     *
+     * The mapping covers only the planes which exist in each TPC.
+     */
+    geo::CompressedPlaneIDmapper<> makeCompressedPlaneMapper() const
+    {
+      return {{Ncryostats(), MaxTPCs()},
+              [this](geo::TPCID const& tpcid) { return Nplanes(tpcid); }};
+    }
+
+    /**
+     * @brief Returns a container with one entry per existing plane.
+     * @tparam T type of data in the container
+     * @return a container with one default-constructed `T` per plane
+     * @see `geo::CompressedPlaneDataContainer`, `makePlaneData()`
+     *
+     * Unlike `makePlaneData()`, the container has no entry for non-existing
+     * planes, which is convenient when some TPCs have fewer planes than others.
+     * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+     * auto const* geom = lar::providerFrom<geo::GeometryCore>();
+     * auto hitsPerPlane
+     *   = geom->makeCompressedPlaneData<std::vector<recob::Hit const*>>();
+     * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+     */
+    template <typename T>
+    geo::CompressedPlaneDataContainer<T> makeCompressedPlaneData() const
+    {
+      return geo::CompressedPlaneDataContainer<T>{makeCompressedPlaneMapper()};
+    }
+
+    /**
+     * @brief Returns a container with one entry per existing plane.
+     * @tparam T type of data in the container
+     * @param defValue the initial value of all elements in the container
+     * @return a container with a value `defValue` per each plane
+     * @see `geo::CompressedPlaneDataContainer`, `makePlaneData()`
+     */
+    template <typename T>
+    geo::CompressedPlaneDataContainer<T> makeCompressedPlaneData(T const& defValue) const
+    {
+      return {makeCompressedPlaneMapper(), defValue};
+    }
+
     //@{
     /**
      * @brief Returns the total number of planes in the specified TPC
@@ -3017,6 +3575,24 @@ namespace geo {
       "Iterate through geo::GeometryCore::IteratePlaneIDs() instead")]] std::set<PlaneID> const&
     PlaneIDs() const;
 
+    /**
+     * @brief Returns the plane IDs of the channel mapping as a sorted list
+     * @return a view of the contiguous sorted list of plane IDs
+     * @see `HasPlaneID()`, `geo::ChannelMapAlg::SortedPlaneIDs()`
+     *
+     * These are the same IDs as in `PlaneIDs()`, stored contiguously.
+     */
+    geo::ChannelMapAlg::PlaneIDspan_t SortedPlaneIDs() const
+    {
+      return fChannelMapAlg->SortedPlaneIDs();
+    }
+
+    /// Returns whether `planeid` is among the `SortedPlaneIDs()` (single lookup).
+    bool HasPlaneID(geo::PlaneID const& planeid) const
+    {
+      return fChannelMapAlg->HasPlaneID(planeid);
+    }
+
     //
     // access
     //
@@ -3081,6 +3657,21 @@ namespace geo {
     PlaneGeo const* GetElementPtr(geo::PlaneID const& planeid) const { return PlanePtr(planeid); }
     //@}
 
+    /**
+     * @brief Returns the specified plane, which must exist (not checked)
+     * @param planeid plane ID
+     * @return a constant reference to the specified plane
+     * @see `CryostatUnchecked()`
+     *
+     * The planes are looked up in a table of all the planes of the detector,
+     * with a single access.
+     */
+    PlaneGeo const& PlaneUnchecked(geo::PlaneID const& planeid) const
+    {
+      assert(HasPlane(planeid));
+      return *fPlanePtrs[planeid];
+    }
+
     //
     // iterators
     //
@@ -3447,7 +4038,7 @@ namespace geo {
     unsigned int NSiblingElements(geo::WireID const& wireid) const { return Nwires(wireid); }
 
     /// Returns the largest number of wires among all planes in this detector
-    unsigned int MaxWires() const;
+    unsigned int MaxWires() const { return fMaxWires; }
 
     //@}
 
@@ -3502,6 +4093,13 @@ namespace geo {
     WireGeo const& GetElement(geo::WireID const& wireid) const { return Wire(wireid); }
     //@}
 
+    /// Returns the specified wire, which must exist (not checked).
+    /// @see `CryostatUnchecked()`
+    WireGeo const& WireUnchecked(geo::WireID const& wireid) const
+    {
+      return PlaneUnchecked(wireid).WireUnchecked(wireid.Wire);
+    }
+
     //
     // iterators
     //
@@ -3647,6 +4245,91 @@ namespace geo {
       return {this};
     }
 
+    /**
+     * @brief Returns a random access range of all the wire IDs of the detector.
+     * @see `IterateWireIDs()`, `FlatPlaneIDs()`, `FlatTPCIDs()`
+     *
+     * The IDs are in the same order as in `IterateWireIDs()`, but they are
+     * addressed by a flat index (`geo::FlatGeoIDrange`): a loop on them only
+     * increments a counter most of the times, and the range can be split in
+     * parts (`subrange()`) to be processed by different threads.
+     * The range stays valid until the geometry is sorted again.
+     */
+    geo::FlatGeoIDrange<geo::CompressedWireIDmapper<>> FlatWireIDs() const
+    {
+      return geo::FlatGeoIDrange{fWireIDmapper};
+    }
+
+    /// Returns a random access range of all the plane IDs of the detector.
+    /// @see `FlatWireIDs()`
+    geo::FlatGeoIDrange<geo::CompressedPlaneIDmapper<>> FlatPlaneIDs() const
+    {
+      return geo::FlatGeoIDrange{fPlaneIDmapper};
+    }
+
+    /// Returns a random access range of all the TPC IDs of the detector.
+    /// @see `FlatWireIDs()`
+    geo::FlatGeoIDrange<geo::CompressedTPCIDmapper<>> FlatTPCIDs() const
+    {
+      return geo::FlatGeoIDrange{fTPCIDmapper};
+    }
+
+    /**
+     * @brief Returns all the TPCs of the detector, by flat index.
+     * @see `FlatTPCIDs()`, `FlatPlanes()`, `FlatWires()`
+     *
+     * The TPC with index `i` in `FlatTPCIDs()` is `*FlatTPCs()[i]`.
+     * The TPCs of each cryostat are a contiguous part of the list
+     * (`FlatTPCs(cid)`), and the same holds for the planes of each TPC and
+     * the wires of each plane: a loop on the whole detector reads one
+     * contiguous table per level rather than walking the cryostat, TPC and
+     * plane collections.
+     * The objects stay where they are; the tables stay valid until the
+     * geometry is sorted again.
+     */
+    TPCGeoPtrSpan_t FlatTPCs() const { return util::make_span(fFlatTPCs); }
+
+    /// Returns the TPCs of cryostat `cid` (none if not present) by flat index.
+    /// @see `FlatTPCs()`
+    TPCGeoPtrSpan_t FlatTPCs(geo::CryostatID const& cid) const;
+
+    /// Returns all the wire planes of the detector, by flat index.
+    /// @see `FlatTPCs()`, `FlatPlaneIDs()`
+    PlaneGeoPtrSpan_t FlatPlanes() const { return util::make_span(fFlatPlanes); }
+
+    /// Returns the wire planes of TPC `tpcid` (none if not present) by flat index.
+    /// @see `FlatTPCs()`
+    PlaneGeoPtrSpan_t FlatPlanes(geo::TPCID const& tpcid) const;
+
+    /**
+     * @brief Returns all the wires of the detector, by flat index.
+     * @see `FlatTPCs()`, `FlatWireIDs()`
+     *
+     * The table is filled on the first call, building the wires which are
+     * built on demand. The wires of TPCs outside `BuildSubset()` are not
+     * built for this table, and their entries are null.
+     */
+    WireGeoPtrSpan_t FlatWires() const;
+
+    /// Returns the wires of plane `planeid` (none if not present) by flat index.
+    /// @see `FlatWires()`
+    WireGeoPtrSpan_t FlatWires(geo::PlaneID const& planeid) const;
+
+    /**
+     * @brief Returns an encoder of IDs into keys as short as this geometry allows.
+     * @see `geo::GeoIDpacker`, `geo::sortByPackedKey()`
+     *
+     * The keys have room for the largest number of cryostats, TPCs, planes and
+     * wires of this geometry (`MaxTPCs()`, `MaxPlanes()`, `MaxWires()`), so that
+     * all its IDs (and the readout ones with as many elements) can be packed.
+     * Unlike the flat indices of `FlatWireIDs()`, the keys are not contiguous,
+     * but they are computed without any table lookup.
+     */
+    geo::GeoIDpacker makeGeoIDpacker() const
+    {
+      return geo::GeoIDpacker{{Ncryostats(), MaxTPCs(), MaxPlanes(), MaxWires()}};
+    }
+
     /**
      * @brief Enables ranged-for loops on all wire IDs of specified cryostat.
      * @param cid the ID of the cryostat to loop the wires of
@@ -3880,10 +4563,37 @@ namespace geo {
      * @return the distance between the two wires
      *
      * This method assumes that all the wires on all the planes on the specified
-     * view of all TPCs have the same pitch.
+     * view of all TPCs have the same pitch: it returns the one in the first
+     * TPC. For detectors whose TPCs differ, use
+     * `WirePitch(geo::View_t, geo::TPCID const&) const`.
      */
     geo::Length_t WirePitch(geo::View_t view) const;
 
+    /**
+     * @brief Returns the wire pitch of the plane with `view` in the TPC `tpcid`.
+     * @param view the view
+     * @param tpcid ID of the TPC
+     * @return the wire pitch [cm]
+     * @throw cet::exception ("GeometryCore" category) if no such TPC or view
+     * @see `ViewInfoPtr()`
+     */
+    geo::Length_t WirePitch(geo::View_t view, geo::TPCID const& tpcid) const;
+
+    /**
+     * @brief Returns the parameters of the plane with `view` in `tpcid`.
+     * @param view the view
+     * @param tpcid ID of the TPC
+     * @return a pointer to the parameters, `nullptr` if no such TPC or view
+     * @see `geo::TPCGeo::ViewInfoPtr()`
+     *
+     * This is a constant time lookup, which does not throw.
+     */
+    geo::TPCGeo::ViewInfo_t const* ViewInfoPtr(geo::View_t view, geo::TPCID const& tpcid) const
+    {
+      geo::TPCGeo const* tpc = HasTPC(tpcid) ? &TPCUnchecked(tpcid) : nullptr;
+      return tpc ? tpc->ViewInfoPtr(view) : nullptr;
+    }
+
     //@{
     /**
      * @brief Returns the angle of the wires in the specified view from vertical
@@ -3987,6 +4697,36 @@ namespace geo {
 
     //@}
 
+    //@{
+    /**
+     * @brief Returns the end points and channels of many wires at once.
+     * @tparam T type of the coordinates (`float` or `double`)
+     * @param tpcid ID of the TPC whose wires are returned
+     * @param planeid ID of the plane whose wires are returned
+     * @param sortEnds whether to order the ends as in the array version of
+     *                 `WireEndPoints()`
+     * @return the wires in ID order, with their ends and channels
+     * @throws cet::exception if the TPC or plane is not present
+     * @see `geo::WireEndpointBuffer`
+     *
+     * Without a TPC or plane, all the wires in the detector are returned.
+     * The end points are computed from the wire arrays of the planes (see
+     * `geo::PlaneGeo::WireArrays()`), without creating the wire objects.
+     * By default the ends are assigned as by `geo::WireGeo`; with `sortEnds`,
+     * the start of each wire is its end with lower _z_ (lower _y_ for wires
+     * along _y_). The buffer is tagged with `Fingerprint()`, so that it can be
+     * cached and then checked against the current geometry.
+     */
+    template <typename T = float>
+    geo::WireEndpointBuffer<T> MakeWireEndpointBuffer(bool sortEnds = false) const;
+    template <typename T = float>
+    geo::WireEndpointBuffer<T> MakeWireEndpointBuffer(geo::TPCID const& tpcid,
+                                                      bool sortEnds = false) const;
+    template <typename T = float>
+    geo::WireEndpointBuffer<T> MakeWireEndpointBuffer(geo::PlaneID const& planeid,
+                                                      bool sortEnds = false) const;
+    //@}
+
     //
     // closest wire
     //
@@ -4031,13 +4771,50 @@ namespace geo {
      */
     geo::WireID NearestWireID(geo::Point_t const& point, geo::PlaneID const& planeid) const;
 
-    //@{
     /**
-     * @brief Returns the ID of wire closest to position in the specified TPC.
+     * @brief Returns the ID of the wire nearest to `point`, without throwing.
      * @param point the point to be tested [cm]
      * @param planeid ID of the plane
-     * @param PlaneNo plane number within the TPC
-     * @param TPCNo tpc number within the cryostat
+     * @return the ID of the nearest wire, or the reason why there is none
+     * @see `NearestWireID(geo::Point_t const&, geo::PlaneID const&) const`
+     *
+     * The wire is the same as from `NearestWireID()`. The query fails with
+     * `geo::QueryError::NoPlane` if `planeid` does not exist, and with
+     * `geo::QueryError::WireOutOfRange` where `NearestWireID()` would throw
+     * `geo::InvalidWireError` (the closest existing wire is then given by
+     * `geo::PlaneGeo::NearestWireIDchecked()`).
+     */
+    geo::QueryResult_t<geo::WireID> TryNearestWireID(geo::Point_t const& point,
+                                                     geo::PlaneID const& planeid) const;
+
+    /**
+     * @brief Returns the ID of wire closest to position, in the TPC including it.
+     * @param point the point to be tested [cm]
+     * @param plane number of the plane within the TPC
+     * @param hint ID of the TPC where `point` is expected to be
+     * @return the ID of the wire, or an invalid wire ID if no TPC includes
+     *         `point`
+     * @throws cet::exception if the TPC including `point` has no such plane
+     * @see `PositionToTPCptr(geo::Point_t const&, geo::TPCID const&) const`
+     *
+     * The TPC including `point` is found as in `PositionToTPCptr()`, checking
+     * `hint` and its adjacent TPCs first; then the nearest wire on the plane
+     * `plane` of that TPC is returned as in
+     * `NearestWireID(geo::Point_t const&, geo::PlaneID const&) const`.
+     * When stepping along a trajectory, the wire ID returned for the previous
+     * point can be used as `hint`.
+     */
+    geo::WireID NearestWireID(geo::Point_t const& point,
+                              geo::PlaneID::PlaneID_t plane,
+                              geo::TPCID const& hint) const;
+
+    //@{
+    /**
+     * @brief Returns the ID of wire closest to position in the specified TPC.
+     * @param point the point to be tested [cm]
+     * @param planeid ID of the plane
+     * @param PlaneNo plane number within the TPC
+     * @param TPCNo tpc number within the cryostat
      * @param cstat cryostat number
      * @return the ID of the wire, or an invalid wire ID
      * @bug Instead of returning an invalid wire ID, an exception is thrown!
@@ -4083,6 +4860,158 @@ namespace geo {
     }
     //@}
 
+    /**
+     * @brief Returns the wires of all planes under a segment.
+     * @param start start of the segment [cm]
+     * @param end end of the segment [cm]
+     * @return the wires with the part of the segment under each of them
+     * @see `geo::PlaneGeo::WireCrossings()`
+     *
+     * The segment is clipped to the active volume of each TPC it goes through,
+     * and the clipped part is projected on each of the planes of that TPC as in
+     * `geo::PlaneGeo::WireCrossings()`. The result is sorted by plane ID, and
+     * the wires of each plane are ordered from `start` to `end`. The fractions
+     * are of the whole segment.
+     */
+    std::vector<geo::PlaneGeo::WireCrossing_t> WireCrossings(geo::Point_t const& start,
+                                                            geo::Point_t const& end) const;
+
+    /**
+     * @brief Returns the wires of all planes overlapping a box.
+     * @param box the box, in world coordinates [cm]
+     * @return the non-empty ranges of wires, sorted by plane ID
+     * @see `geo::PlaneGeo::WiresInRange()`
+     *
+     * For each TPC whose active volume overlaps the box, the part of the box
+     * within that volume is projected on each of the planes of the TPC, and the
+     * range of wires covering it is computed as in
+     * `geo::PlaneGeo::WiresInRange(geo::BoxBoundedGeo const&)`.
+     */
+    std::vector<geo::PlaneGeo::WireRange_t> WiresInRange(geo::BoxBoundedGeo const& box) const;
+
+    /**
+     * @brief Returns the wires passing a selection, as ranges of wires.
+     * @param selection the criteria the wires must pass
+     * @return the non-empty ranges of selected wires, sorted by plane ID
+     * @see `IterateWireIDs(geo::WireSelection const&)`, `WiresInRange()`
+     *
+     * The criteria are applied to whole TPCs and planes where possible: only
+     * the TPCs of the selected TPC sets (`TPCsetToTPCs()`) and overlapping
+     * the selected box are considered, in them only the planes of the
+     * selected views (from the view table of the TPC) and signal type, and in
+     * each plane the wires are found from the box by `geo::PlaneGeo::WiresInRange()`.
+     * The work is then proportional to the number of ranges returned, not to
+     * the number of wires in the detector.
+     */
+    std::vector<geo::PlaneGeo::WireRange_t> SelectWireRanges(
+      geo::WireSelection const& selection) const;
+
+    /// Fills `ranges` with the result of `SelectWireRanges(selection)`.
+    void SelectWireRanges(geo::WireSelection const& selection,
+                          std::vector<geo::PlaneGeo::WireRange_t>& ranges) const;
+
+    /**
+     * @brief Enables ranged-for loops on the IDs of the wires passing a selection.
+     * @param selection the criteria the wires must pass
+     * @return an object suitable for ranged-for loops on the selected wire IDs
+     * @see `SelectWireRanges()`
+     *
+     * The wires are in the order of `IterateWireIDs()`. Example of usage,
+     * looping on the induction wires in a box:
+     * ~~~~{.cpp}
+     * for (geo::WireID const& wID: geom->IterateWireIDs
+     *   (geo::WireSelection{}.withSignalType(geo::kInduction).inBox(box))
+     * ) {
+     *   // ...
+     * }
+     * ~~~~
+     */
+    geo::WireRangeIDs IterateWireIDs(geo::WireSelection const& selection) const
+    {
+      return geo::WireRangeIDs{SelectWireRanges(selection)};
+    }
+
+    /// Projection of a point on a wire plane (see `ProjectOntoPlanes()`).
+    struct PlaneProjection_t {
+      geo::PlaneID plane;          ///< The wire plane.
+      double wireCoordinate = 0.0; ///< As `geo::PlaneGeo::WireCoordinate()`.
+      geo::WireID nearestWire;     ///< Nearest wire, capped to the existing ones.
+      raw::ChannelID_t channel = raw::InvalidChannelID; ///< Channel of `nearestWire`.
+      bool inPlane = false; ///< Whether `nearestWire` did not need capping.
+    };
+
+    /**
+     * @brief Projects a point on all the wire planes of the TPC including it.
+     * @param point the point to be projected [cm]
+     * @param[out] projections filled with the projection on each plane
+     * @param hint ID of the TPC where `point` is expected to be
+     * @return the ID of the TPC including `point`, invalid if none
+     * @see `PositionToTPCptr(geo::Point_t const&, geo::TPCID const&) const`
+     *
+     * The TPC is found only once, as in `PositionToTPCptr()`; then
+     * `projections` is filled with one entry per plane of that TPC, in plane
+     * order. The wire coordinate follows `geo::PlaneGeo::WireCoordinate()`
+     * and the nearest wire `geo::PlaneGeo::NearestWireID()`, except that a
+     * point beyond the wires is assigned the closest one, with `inPlane`
+     * unset. The computation uses the parameters of the planes (packed per
+     * TPC), not the ones of the channel mapping, so the wire coordinate may
+     * differ from `WireCoordinate()` by its single precision rounding.
+     * If no TPC includes `point`, `projections` is left empty.
+     */
+    geo::TPCID ProjectOntoPlanes(geo::Point_t const& point,
+                                 std::vector<PlaneProjection_t>& projections,
+                                 geo::TPCID const& hint = {}) const;
+
+    /// Returns the projections of a point on all the planes of its TPC
+    /// (see the version filling a vector).
+    std::vector<PlaneProjection_t> ProjectOntoPlanes(geo::Point_t const& point) const;
+
+    /**
+     * @brief Projects points of a TPC on all its wire planes.
+     * @param tpcid ID of the TPC the points belong to
+     * @param n number of points
+     * @param x array of the _x_ coordinates of the points [cm]
+     * @param y array of the _y_ coordinates of the points [cm]
+     * @param z array of the _z_ coordinates of the points [cm]
+     * @param[out] projections array of `n` times the number of planes entries
+     * @throws cet::exception (category `"GeometryCore"`) if there is no `tpcid`
+     *
+     * The projection of point `i` on plane `p` is written at
+     * `projections[i * nPlanes + p]`, computed as in the single point
+     * version of `ProjectOntoPlanes()`. The points are not checked to be in
+     * the TPC. Each plane processes blocks of points in loops which the
+     * compiler can vectorize.
+     */
+    void ProjectOntoPlanes(geo::TPCID const& tpcid,
+                           std::size_t n,
+                           double const* x,
+                           double const* y,
+                           double const* z,
+                           PlaneProjection_t* projections) const;
+
+    /**
+     * @brief Projects many points on all the planes of the TPC of each.
+     * @param points the points to be projected [cm]
+     * @param[out] projections filled with the projections of all the points
+     * @param[out] offsets start of the projections of each point, and the end
+     *
+     * The projections of `points[i]` are in `projections` from
+     * `offsets[i]` to `offsets[i + 1]` (none if no TPC includes the point).
+     * The TPC of each point is looked for first in the one of the previous
+     * point, which makes points along trajectories quick to locate.
+     *
+     * The points are then sorted by TPC, and each TPC projects all its points
+     * together, in blocks, on each of its planes (see the `geo::TPCID`
+     * version of this method), before the results are moved back in the order
+     * of `points`: the parameters of the planes are used once per block rather
+     * than once per point, however scattered the input points are. The search
+     * of the TPCs (in chunks of consecutive points) and the projections (TPC
+     * by TPC) are spread with the task runner set with `SetTaskRunner()`.
+     */
+    void ProjectOntoPlanes(std::vector<geo::Point_t> const& points,
+                           std::vector<PlaneProjection_t>& projections,
+                           std::vector<std::size_t>& offsets) const;
+
     /**
      * @brief Returns the index of wire closest to position in the specified TPC
      * @param point the point to be tested [cm]
@@ -4186,6 +5115,25 @@ namespace geo {
       return WireCoordinate(YPos, ZPos, geo::PlaneID(cstat, TPCNo, PlaneNo));
     }
 
+    /**
+     * @brief Computes the wire coordinate of many positions on the same plane
+     * @param YPos y coordinates of the positions
+     * @param ZPos z coordinates of the positions
+     * @param planeid ID of the plane
+     * @param wireCoords (output) the wire coordinate of each position
+     * @throws cet::exception (category: "ChannelMapAlg") if `ZPos` and `YPos`
+     *         have different sizes, or if `wireCoords` is shorter than them
+     * @see ChannelMapAlg::WireCoordinates()
+     *
+     * This is the batch version of
+     * `WireCoordinate(double, double, geo::PlaneID const&)`:
+     * `wireCoords[i]` is set to the wire coordinate of `(YPos[i], ZPos[i])`.
+     */
+    void WireCoordinates(util::span<double const*> YPos,
+                         util::span<double const*> ZPos,
+                         geo::PlaneID const& planeid,
+                         util::span<double*> wireCoords) const;
+
     //@{
     /**
      * @brief Returns the index of the nearest wire to the specified position
@@ -4578,6 +5526,36 @@ namespace geo {
                                          double angle_target,
                                          double pitch_target);
 
+    /**
+     * @brief Returns the slope on the third plane, given it in the other two
+     * @param coeffs coefficients for the three planes
+     * @param slope1 slope as observed on the first plane
+     * @param slope2 slope as observed on the second plane
+     * @return the slope as measure on the third plane, or 999 if infinity
+     * @see `geo::TPCGeo::ThirdPlaneSlopeCoefficients()`
+     *
+     * This is the same as the version taking the wire angles, with the
+     * trigonometric functions precomputed in `coeffs` by the TPC.
+     */
+    static double ComputeThirdPlaneSlope(geo::TPCGeo::ThirdPlaneSlopeCoefficients_t const& coeffs,
+                                         double slope1,
+                                         double slope2);
+
+    /**
+     * @brief Returns dt/dw on the third plane, given it in the other two
+     * @param coeffs coefficients for the three planes
+     * @param dTdW1 slope in dt/dw units as observed on the first plane
+     * @param dTdW2 slope in dt/dw units as observed on the second plane
+     * @return dt/dw slope as measured on the third plane, or 999 if infinity
+     * @see `geo::TPCGeo::ThirdPlaneSlopeCoefficients()`
+     *
+     * This is the same as the version taking the wire angles and pitches, with
+     * all the plane information precomputed in `coeffs` by the TPC.
+     */
+    static double ComputeThirdPlane_dTdW(geo::TPCGeo::ThirdPlaneSlopeCoefficients_t const& coeffs,
+                                         double dTdW1,
+                                         double dTdW2);
+
     /// @} Wire geometry queries
 
     /**
@@ -4639,6 +5617,37 @@ namespace geo {
     unsigned int GetClosestOpDet(double const* point) const;
     //@}
 
+    /**
+     * @brief Returns the optical detectors facing the specified TPC.
+     * @param tpcid ID of the TPC
+     * @return the sorted numbers of the detectors (empty if none or no TPC)
+     * @see `TPCsFacingOpDet()`, `MakeOpDetTPCAssociation()`
+     *
+     * The association is the one of `MakeOpDetTPCAssociation()` with no
+     * additional distance: it includes the detectors within the active volume
+     * of the TPC or behind its anode. It is built on the first call of this
+     * or of `TPCsFacingOpDet()`, once for all the users, and kept until the
+     * geometry is sorted again. The first call may come from any thread.
+     */
+    util::span<unsigned int const*> OpDetsFacingTPC(geo::TPCID const& tpcid) const;
+
+    /// Returns the sorted IDs of the TPCs faced by the optical detector `OpDet`.
+    /// @see `OpDetsFacingTPC()`
+    util::span<geo::TPCID const*> TPCsFacingOpDet(unsigned int OpDet) const;
+
+    /**
+     * @brief Returns the association between optical detectors and TPCs.
+     * @param maxDistance also include detectors this close to a TPC [cm]
+     * @return a new association
+     * @see `geo::OpDetTPCAssociation`
+     *
+     * The association is built from the active volumes of the TPCs and the
+     * centers of the optical detectors, which are associated only to the TPCs
+     * in their same cryostat. Building it loops on all the pairs of TPCs and
+     * detectors: the result is meant to be kept by the caller.
+     */
+    geo::OpDetTPCAssociation MakeOpDetTPCAssociation(double maxDistance = 0.0) const;
+
     //
     // object description
     //
@@ -4653,6 +5662,13 @@ namespace geo {
      */
     std::string OpDetGeoName(unsigned int c = 0) const;
 
+    /// Returns the name of the sensitive optical detector volumes in the
+    /// cryostat `c`, with no copy.
+    std::string_view OpDetGeoNameView(unsigned int c = 0) const
+    {
+      return Cryostat(c).OpDetGeoNameView();
+    }
+
     /// @} Optical detector access and information
 
     /// @name Auxiliary detectors access and information
@@ -4771,6 +5787,16 @@ namespace geo {
                                       unsigned int& ad,
                                       double tolerance = 0) const;
 
+    /**
+     * @brief Returns the auxiliary detector at specified location, without throwing.
+     * @param point location to be tested
+     * @param tolerance tolerance (cm) for matches
+     * @return the auxiliary detector, or `geo::QueryError::NoAuxDet` if none
+     * @see `PositionToAuxDet()`, `FindAuxDetAtPosition()`
+     */
+    geo::QueryResult_t<AuxDetGeo const&> TryPositionToAuxDet(geo::Point_t const& point,
+                                                             double tolerance = 0) const;
+
     /**
      * @brief Returns the auxiliary detector at specified location
      * @param point location to be tested
@@ -4802,6 +5828,27 @@ namespace geo {
                                                         size_t& sv,
                                                         double tolerance = 0) const;
 
+    /**
+     * @brief Finds the auxiliary detector and sensitive volume of each point
+     * @param points the locations [cm]
+     * @param locations _(output)_ where each of the `points` is found
+     * @param tolerance tolerance (cm) for matches. Default 0.
+     * @throws cet::exception ("GeometryCore" category) if `locations` is
+     *         shorter than `points`
+     * @see `FindAuxDetSensitiveAtPosition()`
+     *
+     * Unlike `FindAuxDetSensitiveAtPosition()`, a point outside all the
+     * sensitive volumes does not cause an exception: its location is left
+     * invalid (see `geo::AuxDetLocation::isValid()`).
+     * The volumes are found with the spatial index of the channel mapping
+     * (`geo::ChannelMapAlg::FindAuxDet()`). The channel mapping of the TPC has
+     * no channel for the auxiliary detectors, and `channel` is always left
+     * invalid.
+     */
+    void PositionsToAuxDetSensitive(util::span<geo::Point_t const*> points,
+                                    util::span<geo::AuxDetLocation*> locations,
+                                    double tolerance = 0) const;
+
     const AuxDetGeo& ChannelToAuxDet(
       std::string const& auxDetName,
       uint32_t const& channel) const; // return the AuxDetGeo for the given detector
@@ -4811,6 +5858,27 @@ namespace geo {
       std::string const& auxDetName,
       uint32_t const& channel) const; // return the AuxDetSensitiveGeo for the given
 
+    /**
+     * @brief Returns the index of the auxiliary detector with the specified name
+     * @param auxDetName name of the auxiliary detector
+     * @return the index of the detector, as in `AuxDet()`
+     * @throws cet::exception (category: "Geometry") if no detector has that name
+     *
+     * The index can be used with `ChannelToAuxDetSensitive(std::size_t, uint32_t)`
+     * to look up many channels of the same detector without resolving its name
+     * each time.
+     */
+    std::size_t FindAuxDetByName(std::string_view auxDetName) const;
+
+    /**
+     * @brief Returns the sensitive volume of an auxiliary detector read by a channel
+     * @param ad index of the auxiliary detector (e.g. from `FindAuxDetByName()`)
+     * @param channel number of the channel within that auxiliary detector
+     * @return the sensitive volume of the detector `ad` read by `channel`
+     * @throws cet::exception (category: "Geometry") if the channel is unknown
+     */
+    const AuxDetSensitiveGeo& ChannelToAuxDetSensitive(std::size_t ad, uint32_t channel) const;
+
     /// @} Auxiliary detectors access and information
 
     /// @name TPC readout channels and views
@@ -4827,8 +5895,67 @@ namespace geo {
     /// @return number of channels in the specified ROP, 0 if non-existent
     unsigned int Nchannels(readout::ROPID const& ropid) const;
 
-    /// @brief Returns an std::vector<ChannelID_t> in all TPCs in a TPCSet
-    std::vector<raw::ChannelID_t> ChannelsInTPCs() const;
+    /**
+     * @brief Returns the sorted list of the channels of all the TPC sets
+     * @return the list of channel IDs, sorted and without duplicates
+     *
+     * The list is computed once when the channel mapping is applied.
+     */
+    std::vector<raw::ChannelID_t> const& ChannelsInTPCs() const { return fChannelsInTPCs; }
+
+    /**
+     * @brief Returns the range of the channels in the specified ROP
+     * @param ropid ID of the readout plane
+     * @return a range of channel IDs, empty if there is no such ROP
+     * @see FirstChannelInROP(), Nchannels(readout::ROPID const&) const
+     *
+     * The channels of a readout plane are the `Nchannels(ropid)` ones starting
+     * with `FirstChannelInROP(ropid)`; the ranges of all the ROPs are
+     * tabulated when the channel mapping is applied. Example:
+     * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+     * for (raw::ChannelID_t const channel: geom.ROPChannels(ropid)) // ...
+     * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+     */
+    ChannelIDrange_t ROPChannels(readout::ROPID const& ropid) const;
+
+    /**
+     * @brief Returns a container with one entry per readout channel.
+     * @tparam T type of data in the container
+     * @return a container with one default-constructed `T` per channel
+     * @see `readout::ChannelDataContainer`
+     *
+     * The container is indexed by channel number, and it is sized for all the
+     * `Nchannels()` channels of the detector. Example of usage:
+     * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+     * auto const* geom = lar::providerFrom<geo::GeometryCore>();
+     * auto badChannels = geom->makeChannelData<bool>(); // packed flags
+     * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+     */
+    template <typename T>
+    readout::ChannelDataContainer<T> makeChannelData() const
+    {
+      return readout::ChannelDataContainer<T>(Nchannels());
+    }
+
+    /**
+     * @brief Returns a container with one entry per readout channel.
+     * @tparam T type of data in the container
+     * @param defValue the initial value of all elements in the container
+     * @return a container with a value `defValue` per each channel
+     * @see `readout::ChannelDataContainer`
+     *
+     * This function operates as `makeChannelData() const`, except that it
+     * copies the specified value into all the entries of the container.
+     * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+     * auto const* geom = lar::providerFrom<geo::GeometryCore>();
+     * auto gains = geom->makeChannelData(1.0f);
+     * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+     */
+    template <typename T>
+    readout::ChannelDataContainer<T> makeChannelData(T const& defValue) const
+    {
+      return readout::ChannelDataContainer<T>(Nchannels(), defValue);
+    }
     //
     /**
      * @brief Returns a list of possible views in the detector.
@@ -4873,6 +6000,25 @@ namespace geo {
     }
     //@}
 
+    /**
+     * @brief Fills the IDs of the TPC channels connected to the specified wires
+     * @param wireIDs IDs of the wires
+     * @param channels (output) the channel of each wire is written here
+     * @throws cet::exception (category: "ChannelMapAlg") if `channels` has
+     *         fewer elements than `wireIDs`
+     * @see PlaneWireToChannel(WireID const&)
+     *
+     * The channel of `wireIDs[i]` is stored in `channels[i]`. Example:
+     * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+     * std::vector<geo::WireID> const wires = ...;
+     * std::vector<raw::ChannelID_t> channels(wires.size());
+     * geom.PlaneWireToChannels({wires.data(), wires.data() + wires.size()},
+     *                          {channels.data(), channels.data() + channels.size()});
+     * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+     */
+    void PlaneWireToChannels(util::span<geo::WireID const*> wireIDs,
+                             util::span<raw::ChannelID_t*> channels) const;
+
     //
     // single object features
     //
@@ -4893,6 +6039,8 @@ namespace geo {
      *
      * The view of the readout plane `channel` belongs to is returned, as in
      * `View(readout::ROPID const&) const`.
+     * The views of all the channels connected to wires are precomputed when
+     * the channel mapping is applied, so this is a single table lookup.
      */
     View_t View(raw::ChannelID_t const channel) const;
 
@@ -4904,10 +6052,160 @@ namespace geo {
      */
     std::vector<geo::WireID> ChannelToWire(raw::ChannelID_t const channel) const;
 
+    /**
+     * @brief Fills `wires` with the wires connected to the specified TPC channel
+     * @param channel TPC channel ID
+     * @param[out] wires the ID of all the connected wires (old content is removed)
+     * @throws cet::exception (category: "Geometry") if non-existent channel
+     * @see ChannelToWire(raw::ChannelID_t const) const, ChannelToWireIDs()
+     *
+     * This is the same list as in `ChannelToWire()`, copied into a container
+     * which allocates no memory for the (usual) channels with up to two wires.
+     */
+    void ChannelToWire(raw::ChannelID_t const channel, WireIDlist_t& wires) const;
+
+    /**
+     * @brief Returns a view of the wires connected to the specified TPC channel
+     * @param channel TPC channel ID
+     * @return a view of the IDs of all the connected wires
+     * @throws cet::exception (category: "Geometry") if non-existent channel
+     * @see ChannelToWire()
+     *
+     * This is the same list as in `ChannelToWire()`, but without the memory
+     * allocation: the view points into a table owned by the channel mapping,
+     * which stays valid as long as the geometry is.
+     */
+    WireIDspan_t ChannelToWireIDs(raw::ChannelID_t const channel) const;
+
+    /**
+     * @brief Returns the wire objects connected to the specified TPC channel
+     * @param channel TPC channel ID
+     * @return a view of the pointers to the wires, empty if `channel` is not valid
+     * @see ChannelToWireGeo(), ChannelToWireIDs()
+     *
+     * The wires are in the same order as in `ChannelToWireIDs()`.
+     * The table of the wires of all the channels is built on the first call of
+     * this or of `ChannelToWireGeo()` (which also creates the wires of planes
+     * built on demand), once for all the users; the first call may come from
+     * any thread. Afterwards, each call is a lookup in that table.
+     * The view stays valid until a new channel mapping is applied.
+     * The wires in TPCs outside the build subset (`SetBuildSubset()`) are
+     * not in the table, and their channels have an empty view.
+     */
+    WireGeoPtrSpan_t ChannelToWireGeos(raw::ChannelID_t const channel) const;
+
+    /**
+     * @brief Returns the first wire connected to the specified TPC channel
+     * @param channel TPC channel ID
+     * @return a pointer to the wire, `nullptr` if `channel` is not valid
+     * @see ChannelToWireGeos()
+     *
+     * This is equivalent to `Wire(ChannelToWire(channel)[0])`, by a lookup in
+     * the table of `ChannelToWireGeos()`.
+     */
+    geo::WireGeo const* ChannelToWireGeo(raw::ChannelID_t const channel) const
+    {
+      WireGeoPtrSpan_t const wires = ChannelToWireGeos(channel);
+      return wires.empty() ? nullptr : wires.front();
+    }
+
+    /**
+     * @brief Fills the views of the wires connected to each of the `channels`
+     * @param channels TPC channel IDs
+     * @param wires (output) the view for each channel is written here
+     * @throws cet::exception (category: "Geometry") if non-existent channel
+     * @throws cet::exception (category: "ChannelMapAlg") if `wires` has fewer
+     *         elements than `channels`
+     * @see ChannelToWireIDs()
+     *
+     * The view of the wires of `channels[i]` is stored in `wires[i]`.
+     */
+    void ChannelsToWireIDs(util::span<raw::ChannelID_t const*> channels,
+                           util::span<WireIDspan_t*> wires) const;
+
+    /**
+     * @brief Returns the channels next to the specified one on its plane.
+     * @param channel TPC channel ID
+     * @return the sorted channels of the adjacent wires (empty if none)
+     * @see `CrossingChannels()`, `MakeChannelAdjacency()`
+     *
+     * The neighbors are the channels of the wires right next to the ones of
+     * `channel`, from the tables of `MakeChannelAdjacency()` with a distance
+     * of one wire. The tables are built on the first call of this or of
+     * `CrossingChannels()`, once for all the users, and kept until a new
+     * channel mapping or alignment is applied. The first call may come from
+     * any thread.
+     */
+    util::span<raw::ChannelID_t const*> ChannelNeighbors(raw::ChannelID_t channel) const;
+
+    /// Returns the sorted channels whose wires cross the ones of `channel`.
+    /// @see `ChannelNeighbors()`
+    util::span<raw::ChannelID_t const*> CrossingChannels(raw::ChannelID_t channel) const;
+
+    /**
+     * @brief Returns the tables of neighboring and crossing channels.
+     * @param neighborDistance largest distance of the neighbors [wires]
+     * @return new tables for all the TPC channels
+     * @see `geo::ChannelAdjacency`
+     *
+     * Neighbors of a channel are the channels of the wires of its same plane
+     * at most `neighborDistance` wires away from one of its wires; the
+     * crossings are the channels of the wires of the other planes of the same
+     * TPC which cross one of its wires, as in `WireIDsIntersect()`.
+     * The crossings are taken from the intersection tables of the TPCs
+     * (`geo::TPCGeo::WireIntersections()`), and pairs of planes which those
+     * do not cover are tested wire by wire. Wires outside the build subset
+     * (`SetBuildSubset()`) are skipped. The result is meant to be kept by the
+     * caller.
+     */
+    geo::ChannelAdjacency MakeChannelAdjacency(unsigned int neighborDistance = 1U) const;
+
     /// Returns the ID of the ROP the channel belongs to
     /// @throws cet::exception (category: "Geometry") if non-existent channel
     readout::ROPID ChannelToROP(raw::ChannelID_t channel) const;
 
+    /**
+     * @brief Fills the ID of the ROP of each of the `channels`
+     * @param channels IDs of the readout channels
+     * @param ropids (output) the ROP of each channel is written here
+     * @throws cet::exception (category: "ChannelMapAlg") if `ropids` has fewer
+     *         elements than `channels`
+     * @see ChannelToROP()
+     *
+     * The ROP of `channels[i]` is stored in `ropids[i]`, as if by
+     * `ChannelToROP(channels[i])`; the channel mapping may share the work
+     * among channels, e.g. of a whole raw digit collection sorted by channel.
+     */
+    void ChannelsToROPs(util::span<raw::ChannelID_t const*> channels,
+                        util::span<readout::ROPID*> ropids) const;
+
+    /**
+     * @brief Groups the `channels` by their readout plane.
+     * @param channels IDs of the readout channels, e.g. of all the raw digits
+     * @param routing (output) the positions of the channels of each ROP
+     * @see `ChannelsToROPs()`, `geo::ChannelRouting`
+     *
+     * The position in `channels` of each channel is stored in `routing` in
+     * the group of its ROP (`ChannelToROP()`), with the ROPs numbered in the
+     * order of `IterateROPIDs()`; the channels which are not in any ROP are
+     * in a group of their own (`geo::ChannelRouting::unrouted()`).
+     * The ROP of each channel is read from a table by channel, filled when the
+     * channel mapping is applied (`ApplyChannelMap()`), rather than asked to
+     * the channel mapping channel by channel. Reusing the same `routing` for
+     * all the events avoids allocating its memory each time.
+     */
+    void RouteChannels(util::span<raw::ChannelID_t const*> channels,
+                       geo::ChannelRouting& routing) const;
+
+    /// Returns the `channels` grouped by their readout plane.
+    /// @see `RouteChannels(util::span<raw::ChannelID_t const*>, geo::ChannelRouting&)`
+    geo::ChannelRouting RouteChannels(util::span<raw::ChannelID_t const*> channels) const
+    {
+      geo::ChannelRouting routing;
+      RouteChannels(channels, routing);
+      return routing;
+    }
+
     //
     // geometry queries
     //
@@ -4917,8 +6215,10 @@ namespace geo {
      * @param worldLoc 3D coordinates of the point (world reference frame)
      * @param planeid ID of the wire plane the channel must belong to
      * @return the ID of the channel, or `raw::InvalidChannelID` if invalid wire
-     * @bug on invalid wire, a `geo::InvalidWireError` exception is thrown
+     * @see `geo::PlaneGeo::NearestWireIDchecked()`
      *
+     * No exception is thrown when the nearest wire does not exist (i.e. the
+     * position is off the plane): `raw::InvalidChannelID` is returned instead.
      */
     raw::ChannelID_t NearestChannel(geo::Point_t const& worldLoc,
                                     geo::PlaneID const& planeid) const;
@@ -4931,7 +6231,6 @@ namespace geo {
      * @param TPCNo the number of TPC
      * @param cstat the number of cryostat
      * @return the ID of the channel, or raw::InvalidChannelID if invalid wire
-     * @bug on invalid wire, a `geo::InvalidWireError` exception is thrown
      *
      * The different versions allow different way to provide the position.
      *
@@ -5098,6 +6397,22 @@ namespace geo {
      */
     std::vector<geo::TPCID> TPCsetToTPCs(readout::TPCsetID const& tpcsetid) const;
 
+    /// Fills `tpcids` with the TPCs of the set, like `TPCsetToTPCs()` returns.
+    /// No memory is allocated on sets of up to two TPCs.
+    void TPCsetToTPCs(readout::TPCsetID const& tpcsetid, TPCIDlist_t& tpcids) const;
+
+    /**
+     * @brief Returns a view of the TPCs belonging to the specified TPC set
+     * @param tpcsetid ID of the TPC set to convert into TPC IDs
+     * @return a view of the TPCs, empty if TPC set is invalid or non-existent
+     * @see `TPCsetToTPCs()`
+     *
+     * This is the same list as `TPCsetToTPCs()` returns, from a table prepared
+     * with the channel mapping: no memory is allocated on each call. The view
+     * is valid until a new channel mapping is applied.
+     */
+    geo::ChannelMapAlg::TPCIDspan_t TPCsetToTPCIDs(readout::TPCsetID const& tpcsetid) const;
+
     ///
     /// iterators
     ///
@@ -5315,6 +6630,14 @@ namespace geo {
      */
     std::vector<geo::PlaneID> ROPtoWirePlanes(readout::ROPID const& ropid) const;
 
+    /// Fills `planeids` with the planes of the ROP, like `ROPtoWirePlanes()` returns.
+    /// No memory is allocated on ROPs of up to two planes.
+    void ROPtoWirePlanes(readout::ROPID const& ropid, PlaneIDlist_t& planeids) const;
+
+    /// Returns a view of the planes of the specified ROP, like `TPCsetToTPCIDs()`.
+    /// @see `ROPtoWirePlanes()`
+    geo::ChannelMapAlg::PlaneIDspan_t ROPtoWirePlaneIDs(readout::ROPID const& ropid) const;
+
     /**
      * @brief Returns a list of ID of TPCs the specified ROP spans
      * @param ropid ID of the readout plane
@@ -5327,6 +6650,14 @@ namespace geo {
      */
     std::vector<geo::TPCID> ROPtoTPCs(readout::ROPID const& ropid) const;
 
+    /// Fills `tpcids` with the TPCs of the ROP, like `ROPtoTPCs()` returns.
+    /// No memory is allocated on ROPs spanning up to two TPCs.
+    void ROPtoTPCs(readout::ROPID const& ropid, TPCIDlist_t& tpcids) const;
+
+    /// Returns a view of the TPCs the specified ROP spans, like `TPCsetToTPCIDs()`.
+    /// @see `ROPtoTPCs()`
+    geo::ChannelMapAlg::TPCIDspan_t ROPtoTPCIDs(readout::ROPID const& ropid) const;
+
     /**
      * @brief Returns the ID of the first channel in the specified readout plane
      * @param ropid ID of the readout plane
@@ -5531,30 +6862,74 @@ namespace geo {
     // group features
     //
 
+    // The optical channel queries are answered from tables filled from the
+    // channel mapping when it is applied; IDs not in the tables are still
+    // passed to the mapping.
+
     /// Number of electronics channels for all the optical detectors
-    unsigned int NOpChannels() const;
+    unsigned int NOpChannels() const { return fNOpChannels; }
 
     /// Largest optical channel number
-    unsigned int MaxOpChannel() const;
+    unsigned int MaxOpChannel() const { return static_cast<unsigned int>(fOpChannelInfo.size()); }
 
     // Number of hardware channels for a given optical detector
-    unsigned int NOpHardwareChannels(int opDet) const;
+    unsigned int NOpHardwareChannels(int opDet) const
+    {
+      auto const d = static_cast<unsigned int>(opDet);
+      return (d + 1U < fOpDetChannelOffsets.size()) ?
+               fOpDetChannelOffsets[d + 1U] - fOpDetChannelOffsets[d] :
+               fChannelMapAlg->NOpHardwareChannels(d);
+    }
 
     //
     // access
     //
 
     /// Is this a valid OpChannel number?
-    bool IsValidOpChannel(int opChannel) const;
+    bool IsValidOpChannel(int opChannel) const
+    {
+      auto const c = static_cast<unsigned int>(opChannel);
+      return (c < fOpChannelInfo.size()) && (fOpChannelInfo[c].opDet != NoOpDet);
+    }
 
     /// Convert detector number and hardware channel to unique channel
-    unsigned int OpChannel(int detNum, int hardwareChannel) const;
+    unsigned int OpChannel(int detNum, int hardwareChannel) const
+    {
+      auto const d = static_cast<unsigned int>(detNum);
+      auto const h = static_cast<unsigned int>(hardwareChannel);
+      return (d + 1U < fOpDetChannelOffsets.size()) &&
+                 (h < fOpDetChannelOffsets[d + 1U] - fOpDetChannelOffsets[d]) ?
+               fOpDetChannels[fOpDetChannelOffsets[d] + h] :
+               fChannelMapAlg->OpChannel(d, h);
+    }
 
     /// Convert unique channel to detector number
-    unsigned int OpDetFromOpChannel(int opChannel) const;
+    unsigned int OpDetFromOpChannel(int opChannel) const
+    {
+      return IsValidOpChannel(opChannel) ? fOpChannelInfo[opChannel].opDet :
+                                           fChannelMapAlg->OpDetFromOpChannel(opChannel);
+    }
 
     /// Convert unique channel to hardware channel
-    unsigned int HardwareChannelFromOpChannel(int opChannel) const;
+    unsigned int HardwareChannelFromOpChannel(int opChannel) const
+    {
+      return IsValidOpChannel(opChannel) ?
+               fOpChannelInfo[opChannel].hardwareChannel :
+               fChannelMapAlg->HardwareChannelFromOpChannel(opChannel);
+    }
+
+    /**
+     * @brief Converts unique channels to detector numbers.
+     * @param opChannels the optical channels to be converted
+     * @param opDets (output) the optical detector of each channel
+     * @throws cet::exception (category: "GeometryCore") if `opDets` has fewer
+     *         elements than `opChannels`
+     *
+     * The detector of `opChannels[i]` is stored in `opDets[i]`, as if by
+     * `OpDetFromOpChannel(opChannels[i])`.
+     */
+    void OpDetsFromOpChannels(util::span<unsigned int const*> opChannels,
+                              util::span<unsigned int*> opDets) const;
 
     /// Get unique opdet number from cryo and internal count
     unsigned int OpDetFromCryo(unsigned int o, unsigned int c) const;
@@ -5606,6 +6981,9 @@ namespace geo {
      * be considered complete, but the geometry service provider is not fully
      * initialized yet, since it's still necessary to provide or update the
      * channel mapping.
+     *
+     * To load the geometry on a background thread, see
+     * `geo::LoadGeometryAsync()`.
      */
     void LoadGeometryFile(std::string gdmlfile,
                           std::string rootfile,
@@ -5625,6 +7003,218 @@ namespace geo {
      */
     void LoadGeometryFile(std::string gdmlfile, std::string rootfile, bool bForceReload = false);
 
+    /**
+     * @brief Builds the geometry from an already imported ROOT geometry.
+     * @param gdmlfile path to file to be used for Geant4 simulation
+     * @param rootfile path of the file `topNode` was imported from
+     * @param topNode top node of the imported ROOT geometry
+     * @param builder algorithm to be used for the interpretation of geometry
+     * @see `LoadGeometryFile()`, `geo::ImportROOTGeometry()`,
+     *      `geo::LoadGeometries()`
+     *
+     * This is `LoadGeometryFile()` without the import: the ROOT geometry is
+     * only read, starting from `topNode`, and it is not imported nor locked.
+     * The tree from `geo::ImportROOTGeometry()` may be shared by this and
+     * `geo::AuxDetGeometryCore::LoadImportedGeometry()` running concurrently.
+     */
+    void LoadImportedGeometry(std::string gdmlfile,
+                              std::string rootfile,
+                              TGeoNode const* topNode,
+                              geo::GeometryBuilder& builder);
+
+    /// Builds the geometry from `topNode` with a standard builder.
+    /// @see the version of `LoadImportedGeometry()` with a builder argument
+    void LoadImportedGeometry(std::string gdmlfile, std::string rootfile, TGeoNode const* topNode);
+
+    /**
+     * @brief Sets the runner for parallel geometry initialization and queries.
+     * @param runner the runner (empty to run sequentially)
+     * @see `lar::util::Executor`
+     *
+     * The runner is used when sorting the geometry (by `ApplyChannelMap()`)
+     * to process the TPCs of each cryostat concurrently, by the legacy
+     * `LoadGeometryFile()` to build them concurrently, and by the batch
+     * queries on many points (`ProjectOntoPlanes()`).
+     * To build in parallel with a custom builder, set the runner to the
+     * builder too (`geo::GeometryBuilder::setTaskRunner()`).
+     * A `lar::util::Executor` can be passed as runner, so that the geometry
+     * shares the scheduler of the application.
+     * The runner must stay valid as long as the geometry is used.
+     */
+    void SetTaskRunner(geo::TaskRunner_t runner) { fTaskRunner = std::move(runner); }
+
+    /**
+     * @brief Restricts the complete construction to a part of the detector.
+     * @param subset the cryostats and TPCs to be fully built
+     * @see `BuildSubset()`, `IsInBuildSubset()`
+     *
+     * A job processing only some TPCs (e.g. one worker per APA) does not need
+     * the wire objects of all the others. With a subset, the TPCs outside it
+     * are kept as placeholders: the geometry is the same as the complete
+     * one, with all the elements, their boxes and frames, the number of wires
+     * of each plane and the same IDs and channels, but their planes keep only
+     * the ROOT nodes of the wires (see `geo::PlaneGeo::ReleaseWires()`), and
+     * no table derived from the wires is built for them.
+     * The wire objects of such a plane are built only if requested, which is
+     * slow and defeats the purpose of the subset.
+     *
+     * The legacy `LoadGeometryFile()` then always creates the wires on demand
+     * (`lazyWires` configuration of `geo::GeometryBuilderStandard`); other
+     * builders may create them all, and they are freed by
+     * `ApplyChannelMap()`, after sorting, if they can be placed again from
+     * their nodes (`geo::PlaneGeo::ReleaseWires()`): the IDs of the subset
+     * refer to the sorted geometry. The wires of the subset are also built on first use.
+     * The optical detectors and the channel mapping are complete, since their
+     * numbering spans the whole detector.
+     *
+     * This must be called before `ApplyChannelMap()`; the subset is also set
+     * by the `BuildSubset` configuration parameter.
+     */
+    void SetBuildSubset(geo::GeometrySubset subset) { fBuildSubset = std::move(subset); }
+
+    /// Returns the part of the detector which is fully built.
+    /// @see `SetBuildSubset()`
+    geo::GeometrySubset const& BuildSubset() const { return fBuildSubset; }
+
+    /// Returns whether the TPC `tpcid` is fully built (see `SetBuildSubset()`).
+    bool IsInBuildSubset(geo::TPCID const& tpcid) const { return fBuildSubset.contains(tpcid); }
+
+    /// Returns the runner set with `SetTaskRunner()`, e.g. for the
+    /// parallel algorithms of the geometry data containers.
+    geo::TaskRunner_t const& TaskRunner() const { return fTaskRunner; }
+
+    /**
+     * @brief Starts counting the calls to the most used queries.
+     * @param config configuration of the call sampling
+     * @param topCallers number of callers per query in the final report
+     * @see `CallProfiler()`
+     *
+     * The calls to `NearestWireID()`, `FindTPCAtPosition()`, `ChannelToWire()`,
+     * `ChannelToWireIDs()` and `WireIDsIntersect()` are counted, and the caller
+     * of some of them is recorded (`lar::debug::CallSiteProfiler`).
+     * The calls from within the geometry library are attributed to the first
+     * caller outside of it. When this object is destroyed, the number of calls
+     * and the top callers are printed in the `GeometryCore` info stream.
+     * This method must not be called concurrently with any query.
+     * Without profiling, the queries pay only a check of a pointer.
+     */
+    void EnableCallProfiling(lar::debug::CallSiteProfiler::Config_t const& config,
+                             std::size_t topCallers = 10U);
+
+    /// Returns the call profiler (`nullptr` if profiling is not enabled).
+    /// @see `EnableCallProfiling()`
+    lar::debug::CallSiteProfiler const* CallProfiler() const { return fCallProfiler.get(); }
+
+    /**
+     * @brief Starts collecting metrics of the most used queries.
+     * @param config configuration of the metrics
+     * @see `Metrics()`, `geo::ChannelMapAlg::EnableQueryMetrics()`
+     *
+     * The queries instrumented for `EnableCallProfiling()` record the number
+     * of calls, of misses (no result found, like a position outside all TPCs)
+     * and of exceptions (like `NearestWireID()` on a position outside the
+     * plane), and optionally their latency (`lar::util::QueryMetrics`).
+     * The channel mapping applied after this call (`ApplyChannelMap()`)
+     * collects metrics of its own queries with the same configuration.
+     * All the metrics are printed in the `GeometryCore` info stream when this
+     * object is destroyed, and they are available on demand via `Metrics()`.
+     * This method must not be called concurrently with any query.
+     */
+    void EnableQueryMetrics(lar::util::QueryMetrics::Config_t const& config);
+
+    /// Returns the query metrics (`nullptr` if not enabled).
+    /// @see `EnableQueryMetrics()`
+    lar::util::QueryMetrics const* Metrics() const { return fQueryMetrics.get(); }
+
+    /**
+     * @brief Starts recording the arguments of the most used queries.
+     * @param path the file to write the queries into (overwritten)
+     * @param config sampling of the recorded queries
+     * @see `QueryRecorder()`, `geo::replayRecordedQueries()`
+     *
+     * The queries instrumented for `EnableCallProfiling()` (and
+     * `TryNearestWireID()`) are written into `path` with their arguments
+     * (`geo::GeometryQueryRecorder`), so that the same stream of queries can
+     * be replayed later, e.g. to benchmark a different implementation on a
+     * real workload. The channel mapping queries are recorded through this
+     * object, which forwards them.
+     * The file is completed when this object is destroyed, or when recording
+     * is enabled again. This method must not be called concurrently with any
+     * query. Without recording, the queries pay only a check of a pointer.
+     */
+    void EnableQueryRecording(std::string const& path,
+                              geo::GeometryQueryRecorder::Config_t const& config = {});
+
+    /// Returns the query recorder (`nullptr` if recording is not enabled).
+    /// @see `EnableQueryRecording()`
+    geo::GeometryQueryRecorder const* QueryRecorder() const { return fQueryRecorder.get(); }
+
+    /**
+     * @brief Keeps a copy of the hot lookup tables on each NUMA node.
+     * @param enable whether to replicate the tables
+     * @see `NUMAReplicas()`, `lar::util::NodeReplicas`
+     *
+     * On machines with more than one NUMA node, the compact tables used by
+     * the most frequent queries (the view of each channel, the channel range
+     * of each readout plane, the spatial index of the cryostats and the wire
+     * coordinate parameters of each plane) are copied once per node, and each
+     * query reads the copy of the node of the calling thread, instead of
+     * crossing to the node where the geometry was built.
+     * Each copy is made by the first query from its node, so that its memory
+     * is allocated there, and it is copied again after the tables change
+     * (e.g. in `ApplyChannelMap()` or `ApplyAlignment()`). The table of the
+     * ROP of each channel used by `RouteChannels()` is also replicated.
+     * On machines with a single node, this call has no effect.
+     * The geometry objects (`geo::TPCGeo`, `geo::PlaneGeo`, ...) are not
+     * replicated. This method must not be called concurrently with any query.
+     */
+    void EnableNUMAReplicas(bool enable = true);
+
+    /// Returns the number of copies of the hot tables (`0` if not replicated).
+    /// @see `EnableNUMAReplicas()`
+    unsigned int NUMAReplicas() const { return fHotTableReplicas.nReplicas(); }
+
+    /**
+     * @brief Returns an estimate of the memory used by the geometry description.
+     * @return the memory used, by component
+     *
+     * The components are this object (`"GeometryCore"`), the geometry objects
+     * (`"CryostatGeo"`, `"TPCGeo"`, `"PlaneGeo"`, `"WireGeo"`, `"OpDetGeo"`,
+     * `"AuxDetGeo"`, `"AuxDetSensitiveGeo"`), the drift volumes
+     * (`"DriftPartitions"`) and the channel mapping (`"ChannelMapAlg"`).
+     * Each object includes the lookup tables and caches it owns; the objects
+     * built on demand (like the drift volumes or the wire intersection tables)
+     * are included only after they have been built.
+     * The description of the geometry in ROOT (`ROOTGeoManager()`) is not
+     * included.
+     *
+     * Example:
+     * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+     * mf::LogInfo log("Geometry");
+     * log << "Memory used by the geometry:\n";
+     * geom.MemoryUsage().print(log, "  ");
+     * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+     */
+    lar::util::MemoryUsageReport MemoryUsage() const;
+
+    /**
+     * @brief Returns the time spent in each phase of the last geometry loading.
+     * @see `geo::GeometryLoadReport`
+     *
+     * The phases are the import of the ROOT geometry (`"Import"`, only by
+     * `LoadGeometryFile()`), the construction of the cryostats with all their
+     * content (`"BuildCryostats"`) and of the auxiliary detectors
+     * (`"BuildAuxDets"`), and then, by `ApplyChannelMap()`, the sorting
+     * (`"SortGeometry"`, `"UpdateAfterSorting"`), the initialization of the
+     * channel mapping (`"ChannelMapAlg::Initialize"`) and the channel tables of
+     * this object (`"ChannelTables"`). The report also counts the cryostats,
+     * TPCs, planes, wires, optical detectors, auxiliary detectors, channels
+     * and optical channels. Loading a new geometry starts a new report, and
+     * the report is printed with `mf::LogInfo` (`"GeometryCore"` category) by
+     * `ApplyChannelMap()`.
+     */
+    geo::GeometryLoadReport const& LoadReport() const { return fLoadReport; }
+
     /**
      * @brief Initializes the geometry to work with this channel map
      * @param pChannelMap a pointer to the channel mapping algorithm to be used
@@ -5637,6 +7227,49 @@ namespace geo {
      * geometry initialization.
      */
     void ApplyChannelMap(std::unique_ptr<geo::ChannelMapAlg> pChannelMap);
+
+    /**
+     * @brief Moves TPCs and wire planes by small rigid displacements
+     * @param alignment the displacements (see `geo::GeometryAlignment`)
+     * @throw cet::exception (category `"GeometryCore"`) if a volume in
+     *        `alignment` is not in the geometry
+     *
+     * This is the fast alternative to loading the geometry again for new
+     * alignment constants: only the transformations of the moved volumes and
+     * the information derived from them are updated, i.e. the wires, the
+     * plane frames and decompositions, the TPC boundaries and caches, the TPC
+     * lookup and the wire coordinate constants of the channel mapping
+     * (`geo::ChannelMapAlg::UpdateAlignment()`). The drift volumes are built
+     * again on demand.
+     * The topology is not changed: the number, order and IDs of all elements,
+     * their channels, the drift directions and the plane views stay the same,
+     * so the displacements must be small enough for these not to change.
+     * Cryostats, optical and auxiliary detectors are not moved, and the ROOT
+     * geometry (`ROOTGeoManager()`, used e.g. by `VolumeName()` and the mass
+     * queries) keeps the nominal placement.
+     *
+     * This method must be called after `ApplyChannelMap()`, and not
+     * concurrently with any query.
+     */
+    void ApplyAlignment(geo::GeometryAlignment const& alignment);
+
+    /**
+     * @brief Builds now all the information otherwise computed on first use
+     * @see `geo::VersionedGeometry`
+     *
+     * The tables and indices which the queries build on demand (the wires of
+     * each channel, the world box, the index of the volume names, the drift
+     * volumes, the search tree of the TPC active volumes and the association
+     * of optical detectors and TPCs) are all built by this call, so that the
+     * first queries do not pay for them, nor wait for another thread building
+     * them. The boxes of the detector enclosures are not included, since the
+     * enclosure volume may be missing, and neither are the tables of adjacent
+     * channels (`ChannelNeighbors()`), which few jobs need.
+     *
+     * This method must be called after `ApplyChannelMap()` (and after
+     * `ApplyAlignment()`, which drops some of them).
+     */
+    void BuildDerivedCaches() const;
     /// @}
 
   protected:
@@ -5668,24 +7301,269 @@ namespace geo {
     double fMinWireZDist;      ///< Minimum distance in Z from a point in which
                                ///< to look for the closest wire
     double fPositionWiggle;    ///< accounting for rounding errors when testing positions
+    bool fUseDriftPartitions;  ///< Whether TPC lookups start from drift volumes.
 
     /// Configuration for the geometry builder
     /// (needed since builder is created after construction).
     fhicl::ParameterSet fBuilderParameters;
-    std::unique_ptr<const geo::ChannelMapAlg> fChannelMapAlg;
+
+    /// Part of the detector to be fully built (see `SetBuildSubset()`).
+    geo::GeometrySubset fBuildSubset;
+    std::unique_ptr<geo::ChannelMapAlg> fChannelMapAlg;
     ///< Object containing the channel to wire mapping
 
     // cached values
     std::set<geo::View_t> allViews; ///< All views in the detector.
 
+    /// Sorted channels of all the TPC sets (see `ChannelsInTPCs()`).
+    std::vector<raw::ChannelID_t> fChannelsInTPCs;
+
+    /// First and past-the-last channel of a ROP.
+    using ChannelIDpair_t = std::pair<raw::ChannelID_t, raw::ChannelID_t>;
+
+    /// Optical detector and hardware channel of an optical channel.
+    struct OpChannelInfo_t {
+      unsigned int opDet;           ///< Optical detector (`NoOpDet` if invalid channel).
+      unsigned int hardwareChannel; ///< Hardware channel in the optical detector.
+    };
+
+    /// Marker of invalid optical channels in `fOpChannelInfo`.
+    static constexpr unsigned int NoOpDet = ~0U;
+
+    unsigned int fNOpChannels = 0U; ///< Cached `ChannelMapAlg::NOpChannels()`.
+
+    /// Detector and hardware channel of each optical channel up to `MaxOpChannel()`.
+    std::vector<OpChannelInfo_t> fOpChannelInfo;
+
+    /// Start in `fOpDetChannels` of the channels of each detector (last: the end).
+    std::vector<unsigned int> fOpDetChannelOffsets;
+
+    /// Optical channels of all the optical detectors, by hardware channel.
+    std::vector<unsigned int> fOpDetChannels;
+
+    std::uint64_t fFingerprint = 0U; ///< Content hash (see `Fingerprint()`).
+
+    geo::GeometryLoadReport fLoadReport; ///< Timing of the loading (see `LoadReport()`).
+
+    /// Wires of all the channels, by channel ID (see `ChannelToWireGeos()`).
+    mutable std::vector<geo::WireGeo const*> fChannelWires;
+
+    /// Start of the wires of each channel in `fChannelWires` (last: the end).
+    mutable std::vector<std::size_t> fChannelWireOffsets;
+
+    /// Whether `fChannelWires` and `fChannelWireOffsets` are filled.
+    mutable geo::details::OnceFlag fChannelWiresBuilt;
+
+    /// All the TPCs, by ID (see `TPCUnchecked()`).
+    geo::TPCDataContainer<geo::TPCGeo const*> fTPCPtrs;
+
+    /// All the wire planes, by ID (see `PlaneUnchecked()`).
+    geo::PlaneDataContainer<geo::PlaneGeo const*> fPlanePtrs;
+
+    // flat mappings of the existing IDs (see `FlatWireIDs()`)
+    geo::CompressedTPCIDmapper<> fTPCIDmapper;     ///< Mapping of all TPC IDs.
+    geo::CompressedPlaneIDmapper<> fPlaneIDmapper; ///< Mapping of all plane IDs.
+    geo::CompressedWireIDmapper<> fWireIDmapper;   ///< Mapping of all wire IDs.
+
+    // objects in the order of the flat mappings (see `FlatTPCs()`)
+    std::vector<geo::TPCGeo const*> fFlatTPCs;     ///< All TPCs, by flat index.
+    std::vector<geo::PlaneGeo const*> fFlatPlanes; ///< All planes, by flat index.
+
+    /// All wires, by flat index (see `FlatWires()`).
+    mutable std::vector<geo::WireGeo const*> fFlatWires;
+
+    /// Whether `fFlatWires` is filled.
+    mutable geo::details::OnceFlag fFlatWiresBuilt;
+
+    /// Compact read-only tables of the most frequent queries.
+    struct HotTables_t {
+      std::vector<geo::View_t> channelViews; ///< View of each TPC channel, by ID.
+
+      /// First and past-the-last channel of each ROP (see `ROPChannels()`).
+      readout::ROPDataContainer<ChannelIDpair_t> ropChannelRanges;
+
+      /// Spatial index of the cryostats, used by `PositionToCryostatPtr()`.
+      geo::details::BoxGridIndex cryostatIndex;
+
+      /// Parameters of all the wire planes, in `fPlaneIDmapper` order.
+      std::vector<geo::details::WireCoordinateKernel> planeKernels;
+
+      /// Number of the ROP of each channel in `ropIDs` (see `RouteChannels()`).
+      std::vector<geo::ChannelRouting::Index_t> channelROPs;
+
+      /// All the ROP IDs, in `IterateROPIDs()` order.
+      std::vector<readout::ROPID> ropIDs;
+
+      /// Returns the memory allocated by the tables.
+      std::size_t heapMemory() const;
+    };
+
+    HotTables_t fHotTables; ///< The hot tables, as built.
+
+    /// Copies of `fHotTables` for each NUMA node (see `EnableNUMAReplicas()`).
+    lar::util::NodeReplicas<HotTables_t> fHotTableReplicas;
+
+    /// Returns the hot tables local to the calling thread.
+    HotTables_t const& HotTables() const { return fHotTableReplicas.local(fHotTables); }
+
+    // number of elements, set by `UpdateAfterSorting()`
+    unsigned int fMaxTPCs = 0U;   ///< Largest number of TPCs in a cryostat.
+    unsigned int fTotalNTPC = 0U; ///< Number of TPCs in the detector.
+    unsigned int fMaxPlanes = 0U; ///< Largest number of planes in a TPC.
+    unsigned int fMaxWires = 0U;  ///< Largest number of wires in a plane.
+
+    /// Box of the world volume (see `WorldBox()`).
+    lar::util::LazyValue<geo::BoxBoundedGeo> fWorldBox;
+
+    /// Box of the default detector enclosure (see `DetectorEnclosureBox()`).
+    lar::util::LazyValue<geo::BoxBoundedGeo> fDetectorEnclosureBox;
+
+    /// Boxes of other detector enclosure volumes, by name.
+    mutable geo::details::LRUCache<std::string, geo::BoxBoundedGeo> fEnclosureBoxes;
+
+    /// Nodes of the ROOT geometry by volume name (see `FindAllVolumes()`).
+    lar::util::LazyValue<geo::details::NodeNameIndex<TGeoNode>> fNodeNameIndex;
+
+    /// Names of all the volumes, with their handles (see `VolumeHandle()`).
+    geo::details::VolumeNameTable fVolumeNames;
+
+    /// Drift volumes of each cryostat (see `DriftVolumes()`).
+    lar::util::LazyValue<std::vector<geo::DriftPartitions>> fDriftVolumes;
+
+    /// Active volumes of all the TPCs, in order of `fTPCActiveTreeIDs`.
+    mutable geo::details::BoxBVH fTPCActiveTree;
+
+    /// ID of the TPC of each box in `fTPCActiveTree`.
+    mutable std::vector<geo::TPCID> fTPCActiveTreeIDs;
+
+    /// Whether `fTPCActiveTree` is filled.
+    mutable geo::details::OnceFlag fTPCActiveTreeBuilt;
+
+    /// Optical detectors facing each TPC (see `OpDetsFacingTPC()`).
+    lar::util::LazyValue<geo::OpDetTPCAssociation> fOpDetTPCAssns;
+
+    /// Neighboring and crossing channels (see `ChannelNeighbors()`).
+    lar::util::LazyValue<geo::ChannelAdjacency> fChannelAdjacency;
+
+    /// Per-thread ROOT navigators, used by `ROOTNavigator()`.
+    geo::ROOTGeometryNavigatorPool fNavigatorPool;
+
+    /// Runner for the parallel parts of the initialization (may be empty).
+    geo::TaskRunner_t fTaskRunner;
+
+    /// Unique number of the first optical detector of each cryostat; an
+    /// additional last entry is the total number of optical detectors.
+    std::vector<unsigned int> fFirstOpDetInCryo;
+
     std::vector<TGeoNode const*> FindDetectorEnclosure(
-      std::string const& name = "volDetEnclosure") const;
+      std::string const& name = DefaultDetectorEnclosureName) const;
+
+    /// Computes the box of the detector enclosure volume `name`.
+    geo::BoxBoundedGeo ComputeDetectorEnclosureBox(std::string const& name) const;
+
+    /// Computes the box of the world volume.
+    geo::BoxBoundedGeo ComputeWorldBox() const;
+
+    /// Returns the index of the ROOT geometry nodes, building it if needed.
+    geo::details::NodeNameIndex<TGeoNode> const& VolumeNodeIndex() const;
 
     bool FindFirstVolume(std::string const& name, std::vector<const TGeoNode*>& path) const;
 
+    /// Computes the number of TPCs, and the largest number of elements.
+    void UpdateMaxElements();
+
+    /// Fills the table of the ROP number of each channel in `fHotTables`.
+    void BuildChannelROPTable();
+
+    /// Fills the plane kernels of `fHotTables` from the current wire planes.
+    void UpdatePlaneKernels();
+
+    /// Instrumented queries (see `EnableCallProfiling()`, `EnableQueryMetrics()`).
+    enum class Query_t : std::size_t {
+      NearestWireID,
+      FindTPCAtPosition,
+      ChannelToWire,
+      ChannelToWireIDs,
+      WireIDsIntersect,
+      NQueries
+    };
+
+    /// Call profiler (`nullptr` if profiling is disabled).
+    std::unique_ptr<lar::debug::CallSiteProfiler> fCallProfiler;
+
+    /// Number of callers per query reported at destruction.
+    std::size_t fCallProfilerTopCallers = 10U;
+
+    /// Query metrics (`nullptr` if disabled).
+    std::unique_ptr<lar::util::QueryMetrics> fQueryMetrics;
+
+    /// Records a call to `query` for profiling and metrics, if enabled.
+    /// The call lasts as long as the returned object.
+    lar::util::QueryMetrics::Scope_t StartQuery(Query_t query) const
+    {
+      auto const index = static_cast<std::size_t>(query);
+      if (fCallProfiler) fCallProfiler->record(index);
+      return {fQueryMetrics.get(), index};
+    }
+
+    /// Returns the names of the instrumented queries, in `Query_t` order.
+    static std::vector<std::string> QueryNames();
+
+    /// Kinds of recorded query (see `EnableQueryRecording()`).
+    using RecordedKind_t = geo::RecordedQuery_t::Kind_t;
+
+    /// Query recorder (`nullptr` if recording is disabled).
+    std::unique_ptr<geo::GeometryQueryRecorder> fQueryRecorder;
+
+    /// Records a query on a position, if recording is enabled.
+    void RecordQuery(RecordedKind_t kind,
+                     geo::Point_t const& point,
+                     geo::PlaneID const& plane = {}) const
+    {
+      if (fQueryRecorder) fQueryRecorder->record({kind, point, plane});
+    }
+
+    /// Records a query on a channel, if recording is enabled.
+    void RecordQuery(RecordedKind_t kind, raw::ChannelID_t channel) const
+    {
+      if (fQueryRecorder) fQueryRecorder->record({kind, {}, {}, {}, {}, channel});
+    }
+
+    /// Records a query on two wires, if recording is enabled.
+    void RecordQuery(RecordedKind_t kind,
+                     geo::WireID const& wire1,
+                     geo::WireID const& wire2) const
+    {
+      if (fQueryRecorder) fQueryRecorder->record({kind, {}, {}, wire1, wire2});
+    }
+
+    /// Implementation of `FindTPCAtPosition()`, not profiled.
+    geo::TPCID LocateTPCAtPosition(geo::Point_t const& point) const;
+
+    /// Returns the TPC of `cryo` including `point` (`nullptr` if none).
+    geo::TPCGeo const* PositionToTPCptrInCryostat(geo::CryostatGeo const& cryo,
+                                                  geo::Point_t const& point) const;
+
     /// Parses ROOT geometry nodes and builds LArSoft geometry representation.
     /// @param builder the algorithm to be used
-    void BuildGeometry(geo::GeometryBuilder& builder);
+    /// @param topNode the top node of the ROOT geometry to be parsed
+    void BuildGeometry(geo::GeometryBuilder& builder, TGeoNode const* topNode);
+
+    /// Builds the geometry from `topNode` (see `LoadImportedGeometry()`),
+    /// adding to the current load report.
+    void BuildImportedGeometry(std::string gdmlfile,
+                               std::string rootfile,
+                               TGeoNode const* topNode,
+                               geo::GeometryBuilder& builder);
+
+    /// Returns the configuration of the standard builder (see `SetBuildSubset()`).
+    fhicl::ParameterSet StandardBuilderParameters() const;
+
+    /// Adds all the wires of `plane` to `buffer` (see `MakeWireEndpointBuffer()`).
+    template <typename T>
+    void AppendWireEndpoints(geo::WireEndpointBuffer<T>& buffer,
+                             geo::PlaneGeo const& plane,
+                             bool sortEnds) const;
 
     /// Wire ID check for WireIDsIntersect methods
     bool WireIDIntersectionCheck(const geo::WireID& wid1, const geo::WireID& wid2) const;
@@ -5708,6 +7586,24 @@ namespace geo {
     /// Performs all the updates needed after sorting
     void UpdateAfterSorting();
 
+    /// Returns the sorted channels of all the TPC sets (see `ChannelsInTPCs()`)
+    std::vector<raw::ChannelID_t> CollectChannelsInTPCs() const;
+
+    /// Fills the optical channel tables from the current channel mapping.
+    void BuildOpChannelTables();
+
+    /// Returns the hierarchy of the TPC active volumes, building it if needed.
+    geo::details::BoxBVH const& TPCActiveTree() const;
+
+    /// Returns the default optical detector/TPC association, building it if needed.
+    geo::OpDetTPCAssociation const& OpDetTPCAssns() const;
+
+    /// Returns the default channel adjacency tables, building them if needed.
+    geo::ChannelAdjacency const& ChannelAdjacencyTables() const;
+
+    /// Returns the hash of the current geometry content (see `Fingerprint()`)
+    std::uint64_t ComputeFingerprint() const;
+
     /// Deletes the detector geometry structures
     void ClearGeometry();
 
@@ -5852,6 +7748,79 @@ geo::GeometryCore::Segment<Point> geo::GeometryCore::WireEndPoints(geo::WireID c
   return {wire.GetStart<Point>(), wire.GetEnd<Point>()};
 } // geo::GeometryCore::WireEndPoints(WireID)
 
+//------------------------------------------------------------------------------
+template <typename T>
+geo::WireEndpointBuffer<T> geo::GeometryCore::MakeWireEndpointBuffer(bool sortEnds) const
+{
+  geo::WireEndpointBuffer<T> buffer;
+  buffer.fingerprint = Fingerprint();
+  buffer.sortedEnds = sortEnds;
+  buffer.reserve(fWireIDmapper.size());
+  for (geo::PlaneGeo const& plane : IteratePlanes())
+    AppendWireEndpoints(buffer, plane, sortEnds);
+  return buffer;
+} // geo::GeometryCore::MakeWireEndpointBuffer()
+
+//------------------------------------------------------------------------------
+template <typename T>
+geo::WireEndpointBuffer<T> geo::GeometryCore::MakeWireEndpointBuffer(geo::TPCID const& tpcid,
+                                                                     bool sortEnds) const
+{
+  geo::TPCGeo const& TPC = this->TPC(tpcid);
+  geo::WireEndpointBuffer<T> buffer;
+  buffer.fingerprint = Fingerprint();
+  buffer.sortedEnds = sortEnds;
+  for (geo::PlaneGeo const& plane : TPC.IteratePlanes())
+    AppendWireEndpoints(buffer, plane, sortEnds);
+  return buffer;
+} // geo::GeometryCore::MakeWireEndpointBuffer(TPCID)
+
+//------------------------------------------------------------------------------
+template <typename T>
+geo::WireEndpointBuffer<T> geo::GeometryCore::MakeWireEndpointBuffer(geo::PlaneID const& planeid,
+                                                                     bool sortEnds) const
+{
+  geo::WireEndpointBuffer<T> buffer;
+  buffer.fingerprint = Fingerprint();
+  buffer.sortedEnds = sortEnds;
+  AppendWireEndpoints(buffer, Plane(planeid), sortEnds);
+  return buffer;
+} // geo::GeometryCore::MakeWireEndpointBuffer(PlaneID)
+
+//------------------------------------------------------------------------------
+template <typename T>
+void geo::GeometryCore::AppendWireEndpoints(geo::WireEndpointBuffer<T>& buffer,
+                                            geo::PlaneGeo const& plane,
+                                            bool sortEnds) const
+{
+  geo::PlaneGeo::WireArrays_t const& wires = plane.WireArrays();
+  std::size_t const n = wires.size();
+  if (n == 0U) return;
+
+  // ends of all the wires of the plane in one vectorizable pass
+  std::vector<double> coords(6U * n);
+  double* const start[3] = {&coords[0], &coords[n], &coords[2U * n]};
+  double* const end[3] = {&coords[3U * n], &coords[4U * n], &coords[5U * n]};
+  wires.fillEndPoints(start, end);
+
+  buffer.reserve(buffer.size() + n);
+  for (std::size_t i = 0; i < n; ++i) {
+    double s[3] = {start[0][i], start[1][i], start[2][i]};
+    double e[3] = {end[0][i], end[1][i], end[2][i]};
+    if (sortEnds) { // same rules as WireEndPoints(WireID, double*, double*)
+      if (e[2] < s[2]) std::swap(s, e);
+      if ((e[1] < s[1]) && (std::abs(e[2] - s[2]) < 0.01)) std::swap(s, e);
+    }
+    for (double const c : s)
+      buffer.vertices.push_back(static_cast<T>(c));
+    for (double const c : e)
+      buffer.vertices.push_back(static_cast<T>(c));
+    geo::WireID const& wireID =
+      buffer.wires.emplace_back(plane.ID(), static_cast<geo::WireID::WireID_t>(i));
+    buffer.channels.push_back(PlaneWireToChannel(wireID));
+  } // for wires
+} // geo::GeometryCore::AppendWireEndpoints()
+
 //------------------------------------------------------------------------------
 template <typename Stream>
 void geo::GeometryCore::Print(Stream&& out, std::string indent /* = "  " */) const
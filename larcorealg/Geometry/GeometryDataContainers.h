@@ -14,6 +14,7 @@
 // LArSoft libraries
 #include "larcorealg/CoreUtils/span.h"
 #include "larcorealg/Geometry/GeometryIDmapper.h"
+#include "larcorealg/Geometry/TaskRunner.h"
 #include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
 
 // Boost libraries
@@ -21,29 +22,74 @@
 #include <boost/iterator/transform_iterator.hpp>
 
 // C/C++ standard libraries
-#include <algorithm> // std::fill(), std::for_each()
+#include <algorithm> // std::fill(), std::for_each(), std::min()
+#include <array>
 #include <cassert>
+#include <cstddef> // std::size_t
+#include <cstring> // std::memset()
 #include <initializer_list>
+#include <iterator> // std::random_access_iterator_tag
+#include <memory>   // std::allocator<>
+#include <memory_resource>
 #include <stdexcept> // std::out_of_range
 #include <string>
+#include <type_traits>
 #include <utility> // std::forward()
 #include <vector>
 
 namespace geo {
 
-  template <typename T, typename Mapper>
+  template <typename T, typename Mapper, typename Allocator = std::allocator<T>>
   class GeoIDdataContainer;
 
-  template <typename T>
+  template <typename T, typename Allocator = std::allocator<T>>
   class TPCDataContainer;
 
-  template <typename T>
+  template <typename T, typename Allocator = std::allocator<T>>
   class PlaneDataContainer;
 
+  template <typename T, typename Allocator = std::allocator<T>>
+  class CompressedTPCDataContainer;
+
+  template <typename T, typename Allocator = std::allocator<T>>
+  class CompressedPlaneDataContainer;
+
+  /// Containers with memory from a `std::pmr::memory_resource`.
+  namespace pmr {
+
+    template <typename T, typename Mapper>
+    using GeoIDdataContainer =
+      geo::GeoIDdataContainer<T, Mapper, std::pmr::polymorphic_allocator<T>>;
+
+    template <typename T>
+    using TPCDataContainer = geo::TPCDataContainer<T, std::pmr::polymorphic_allocator<T>>;
+
+    template <typename T>
+    using PlaneDataContainer = geo::PlaneDataContainer<T, std::pmr::polymorphic_allocator<T>>;
+
+    template <typename T>
+    using CompressedTPCDataContainer =
+      geo::CompressedTPCDataContainer<T, std::pmr::polymorphic_allocator<T>>;
+
+    template <typename T>
+    using CompressedPlaneDataContainer =
+      geo::CompressedPlaneDataContainer<T, std::pmr::polymorphic_allocator<T>>;
+
+  } // namespace pmr
+
+  template <typename T, typename Mapper>
+  class StaticGeoIDdataContainer;
+
+  template <typename T, unsigned int NCryostats, unsigned int NTPCs>
+  class StaticTPCDataContainer;
+
+  template <typename T, unsigned int NCryostats, unsigned int NTPCs, unsigned int NPlanes>
+  class StaticPlaneDataContainer;
+
   // ---------------------------------------------------------------------------
   namespace details {
 
-    template <typename T>
+    template <typename T, typename Allocator = std::allocator<T>>
     class GeoContainerData;
 
     template <typename GeoIDdataContainerClass, typename BaseIterator>
@@ -52,6 +98,22 @@ namespace geo {
     template <typename GeoIDIteratorClass>
     class GeoIDdataContainerItemIterator;
 
+    /// Largest number of tasks the parallel `apply()` splits the data into.
+    constexpr std::size_t MaxApplyTasks = 64;
+
+    /// Calls `op` on `n` elements from `first`, in contiguous blocks.
+    template <typename Iter, typename Op>
+    void applyInBlocks(Iter first, std::size_t n, geo::TaskRunner_t const& runner, Op& op)
+    {
+      std::size_t const nTasks = std::min<std::size_t>(n, MaxApplyTasks);
+      geo::runTasks(runner, nTasks, [first, n, nTasks, &op](std::size_t iTask) {
+        auto const begin = first + (n * iTask) / nTasks;
+        auto const end = first + (n * (iTask + 1)) / nTasks;
+        for (auto it = begin; it != end; ++it)
+          op(*it);
+      });
+    } // applyInBlocks()
+
   } // namespace details
   // ---------------------------------------------------------------------------
 
@@ -66,6 +128,8 @@ namespace geo {
 /** **************************************************************************
  * @brief Container with one element per geometry TPC.
  * @tparam T type of the contained datum
+ * @tparam Mapper type of mapping between IDs and element index
+ * @tparam Allocator type of allocator of the data storage
  * @see `geo::GeometryCore::makeTPCData`
  *
  * The container is of fixed size and can't be neither resized nor freed
@@ -96,14 +160,46 @@ namespace geo {
  *   geometry or not
  * * at least one element is expected to be present
  *
+ *
+ * Parallel processing
+ * ====================
+ *
+ * All the data is stored in a single flat array. The iterators, including the
+ * ones of `items()`, are random access, so that they can be used directly
+ * with the parallel algorithms of the standard library, e.g.
+ * `std::for_each(std::execution::par, data.begin(), data.end(), op)` or
+ * `std::transform_reduce()`. In addition, `apply()` can spread the work on a
+ * `geo::TaskRunner_t` (or a `lar::util::Executor`), like the building of the
+ * geometry does.
+ *
+ *
+ * Memory allocation
+ * ==================
+ *
+ * The data is allocated via `Allocator`. The aliases in the `geo::pmr`
+ * namespace use a `std::pmr::polymorphic_allocator`, so that for example data
+ * used for a single event can come from an arena released at the end of it:
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * std::pmr::monotonic_buffer_resource eventArena;
+ * // ... for each event:
+ * {
+ *   geo::pmr::PlaneDataContainer<unsigned int> hitCount
+ *     (geom->NCryostats(), geom->MaxTPCs(), geom->MaxPlanes(), 0U, &eventArena);
+ *   // ...
+ * }
+ * eventArena.release();
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * As with `std::pmr::vector`, a copy of a container with a polymorphic
+ * allocator uses the default memory resource, not the one of the original.
+ *
  */
-template <typename T, typename Mapper>
+template <typename T, typename Mapper, typename Allocator>
 class geo::GeoIDdataContainer {
 
-  using This_t = geo::GeoIDdataContainer<T, Mapper>; ///< Type of this class.
+  using This_t = geo::GeoIDdataContainer<T, Mapper, Allocator>; ///< Type of this class.
 
   /// Type of data container helper.
-  using Container_t = details::GeoContainerData<T>;
+  using Container_t = details::GeoContainerData<T, Allocator>;
 
   /// Type of iterator to the data.
   using BaseIter_t = typename Container_t::iterator;
@@ -140,6 +236,7 @@ public:
   //     using const_reverse_iterator = typename Container_t::const_reverse_iterator;
   using difference_type = typename Container_t::difference_type;
   using size_type = typename Container_t::size_type;
+  using allocator_type = typename Container_t::allocator_type;
 
   /// Special iterator dereferencing to pairs ( ID, value ) (see `items()`).
   using item_iterator = details::GeoIDdataContainerItemIterator<iterator>;
@@ -157,9 +254,13 @@ public:
    */
   GeoIDdataContainer() = default;
 
+  /// Constructor: container with no room, allocating memory via `alloc`.
+  explicit GeoIDdataContainer(allocator_type const& alloc);
+
   /**
    * @brief Prepares the container with default-constructed data.
    * @param dims number of elements on all levels of the container
+   * @param alloc allocator for the data storage
    * @see `resize()`
    *
    * The size of each dimension is specified by the corresponding number,
@@ -168,12 +269,14 @@ public:
    * The container is sized to host data for all the elements.
    * Each element in the container is default-constructed.
    */
-  GeoIDdataContainer(std::initializer_list<unsigned int> dims);
+  GeoIDdataContainer(std::initializer_list<unsigned int> dims,
+                     allocator_type const& alloc = allocator_type{});
 
   /**
    * @brief Prepares the container initializing all its data.
    * @param dims number of elements on all levels of the container
    * @param defValue the value copied to fill all entries in the container
+   * @param alloc allocator for the data storage
    * @see `resize()`
    *
    * The size of each dimension is specified by the corresponding number,
@@ -182,7 +285,31 @@ public:
    * The container is sized to host data for all the elements.
    * Each element in the container is constructed as copy of `defValue`.
    */
-  GeoIDdataContainer(std::initializer_list<unsigned int> dims, value_type const& defValue);
+  GeoIDdataContainer(std::initializer_list<unsigned int> dims,
+                     value_type const& defValue,
+                     allocator_type const& alloc = allocator_type{});
+
+  /**
+   * @brief Prepares the container with default-constructed data.
+   * @param mapper the mapping between IDs and container positions
+   * @param alloc allocator for the data storage
+   *
+   * The container is sized to host data for all the elements of `mapper`.
+   * This is the way to create containers with mappings which are not
+   * described by the number of elements on each level (like
+   * `geo::CompressedGeoIDmapper`).
+   */
+  explicit GeoIDdataContainer(Mapper_t mapper, allocator_type const& alloc = allocator_type{});
+
+  /**
+   * @brief Prepares the container initializing all its data.
+   * @param mapper the mapping between IDs and container positions
+   * @param defValue the value copied to fill all entries in the container
+   * @param alloc allocator for the data storage
+   */
+  GeoIDdataContainer(Mapper_t mapper,
+                     value_type const& defValue,
+                     allocator_type const& alloc = allocator_type{});
 
   // --- BEGIN Container status query ----------------------------------------
   /// @name Container status query
@@ -219,6 +346,9 @@ public:
   /// Returns the mapper object used to convert ID's and container positions.
   Mapper_t const& mapper() const;
 
+  /// Returns a copy of the allocator of the data storage.
+  allocator_type get_allocator() const;
+
   /// @}
   // --- END Container status query ------------------------------------------
 
@@ -364,9 +494,17 @@ public:
   /// Sets all elements to the specified `value` (copied).
   void fill(value_type value);
 
-  /// Sets all the elements to a default-constructed `value_type`.
+  /**
+   * @brief Sets all the elements to a default-constructed `value_type`.
+   *
+   * The storage is kept. Elements of arithmetic and enumeration types are
+   * cleared with a single `std::memset()`.
+   */
   void reset();
 
+  /// Sets all the elements to `value`, keeping the storage.
+  void reset(value_type const& value);
+
   /**
    * @brief Applies an operation on all elements.
    * @tparam Op type of operation
@@ -397,6 +535,28 @@ public:
   template <typename Op>
   decltype(auto) apply(Op&& op) const;
 
+  /**
+   * @brief Applies an operation on all elements, possibly concurrently.
+   * @tparam Op type of operation
+   * @param runner the runner of the parallel tasks
+   * @param op Operation
+   *
+   * The elements are split in contiguous blocks, each processed by a task of
+   * `runner` (or sequentially if `runner` is empty).
+   * The same `op` object is called from all the tasks, possibly at the same
+   * time, and it is required to support that; each element is passed to it
+   * exactly once, but in no specific order.
+   *
+   * The return values of `op` calls are discarded.
+   */
+  template <typename Op>
+  void apply(TaskRunner_t const& runner, Op&& op);
+
+  /// Applies an operation on all elements (read-only), possibly concurrently.
+  /// @see `apply(TaskRunner_t const&, Op&&)`
+  template <typename Op>
+  void apply(TaskRunner_t const& runner, Op&& op) const;
+
   /// @}
   // --- END Data modification -------------------------------------------------
 
@@ -446,8 +606,8 @@ public:
    * Existing data is not touched, but it may be rearranged in a
    * non-straightforward way.
    */
-  template <typename OT>
-  void resizeAs(geo::GeoIDdataContainer<OT, Mapper_t> const& other);
+  template <typename OT, typename OAlloc>
+  void resizeAs(geo::GeoIDdataContainer<OT, Mapper_t, OAlloc> const& other);
 
   /**
    * @brief Prepares the container initializing all its data.
@@ -461,8 +621,34 @@ public:
    * Existing data is not touched, but it may be rearranged in a
    * non-straightforward way.
    */
-  template <typename OT>
-  void resizeAs(geo::GeoIDdataContainer<OT, Mapper_t> const& other, value_type const& defValue);
+  template <typename OT, typename OAlloc>
+  void resizeAs(geo::GeoIDdataContainer<OT, Mapper_t, OAlloc> const& other,
+                value_type const& defValue);
+
+  /**
+   * @brief Prepares the container for the elements of `mapper`.
+   * @param mapper the mapping between IDs and container positions
+   *
+   * Same as `resizeAs(GeoIDdataContainer const&)`, with the dimensions taken
+   * directly from a mapping. No memory is allocated if the container already
+   * has enough capacity (see `capacity()`).
+   */
+  void resizeAs(Mapper_t const& mapper);
+
+  /// Prepares the container for the elements of `mapper`, new ones as `defValue`.
+  /// @see `resizeAs(Mapper_t const&)`
+  void resizeAs(Mapper_t const& mapper, value_type const& defValue);
+
+  /**
+   * @brief Prepares the container for `mapper` with all elements set to `value`.
+   * @param mapper the mapping between IDs and container positions
+   * @param value the value copied into all the elements
+   *
+   * This is the full reset of a container reused for each event: unlike
+   * `resizeAs()`, existing elements are overwritten too. The storage is reused,
+   * and no memory is allocated if the container already has enough capacity.
+   */
+  void resetAs(Mapper_t const& mapper, value_type const& value);
 
   /**
    * @brief Makes the container empty, with no usable storage space.
@@ -492,7 +678,8 @@ private:
 /**
  * @brief Container with one element per geometry TPC.
  * @tparam T type of the contained datum
- * @see `geo::GeometryCore::makeTPCData`
+ * @tparam Allocator type of allocator of the data storage
+ * @see `geo::GeometryCore::makeTPCData`, `geo::pmr::TPCDataContainer`
  *
  * The container is of fixed size and can't be neither resized nor freed
  * before destruction.
@@ -523,13 +710,14 @@ private:
  * * at least one element is expected to be present
  *
  */
-template <typename T>
-class geo::TPCDataContainer : public geo::GeoIDdataContainer<T, geo::TPCIDmapper<>> {
+template <typename T, typename Allocator>
+class geo::TPCDataContainer : public geo::GeoIDdataContainer<T, geo::TPCIDmapper<>, Allocator> {
 
-  using BaseContainer_t = geo::GeoIDdataContainer<T, geo::TPCIDmapper<>>;
+  using BaseContainer_t = geo::GeoIDdataContainer<T, geo::TPCIDmapper<>, Allocator>;
 
 public:
   using value_type = typename BaseContainer_t::value_type;
+  using allocator_type = typename BaseContainer_t::allocator_type;
 
   /**
    * @brief Default constructor: empty container.
@@ -541,21 +729,30 @@ public:
    */
   TPCDataContainer() = default;
 
+  /// Constructor: empty container, allocating memory via `alloc`.
+  explicit TPCDataContainer(allocator_type const& alloc) : BaseContainer_t(alloc) {}
+
   /**
    * @brief Prepares the container with default-constructed data.
    * @param nCryo number of cryostats
    * @param nTPCs number of TPCs
+   * @param alloc allocator for the data storage
    *
    * The container is sized to host data for `nCryo` cryostats, each with
    * `nTPCs` TPCs. Each element in the container is default-constructed.
    */
-  TPCDataContainer(unsigned int nCryo, unsigned int nTPCs) : BaseContainer_t({nCryo, nTPCs}) {}
+  TPCDataContainer(unsigned int nCryo,
+                   unsigned int nTPCs,
+                   allocator_type const& alloc = allocator_type{})
+    : BaseContainer_t({nCryo, nTPCs}, alloc)
+  {}
 
   /**
    * @brief Prepares the container with copies of the specified default value.
    * @param nCryo number of cryostats
    * @param nTPCs number of TPCs
    * @param defValue the value to be replicated
+   * @param alloc allocator for the data storage
    *
    * The container is sized to host data for `nCryo` cryostats, each with
    * `nTPCs` TPCs. Each element in the container is a copy of defValue.
@@ -567,8 +764,11 @@ public:
    *   assert(PlanesPerTPC[TPC.ID()] == TPC.Nplanes());
    * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
    */
-  TPCDataContainer(unsigned int nCryo, unsigned int nTPCs, value_type const& defValue)
-    : BaseContainer_t({nCryo, nTPCs}, defValue)
+  TPCDataContainer(unsigned int nCryo,
+                   unsigned int nTPCs,
+                   value_type const& defValue,
+                   allocator_type const& alloc = allocator_type{})
+    : BaseContainer_t({nCryo, nTPCs}, defValue, alloc)
   {}
 
   // --- BEGIN Container modification ------------------------------------------
@@ -637,7 +837,8 @@ public:
 /**
  * @brief Container with one element per geometry wire plane.
  * @tparam T type of the contained datum
- * @see `geo::GeometryCore::makePlaneData`
+ * @tparam Allocator type of allocator of the data storage
+ * @see `geo::GeometryCore::makePlaneData`, `geo::pmr::PlaneDataContainer`
  *
  * The container is of fixed size and can't be neither resized nor freed
  * before destruction.
@@ -667,13 +868,15 @@ public:
  * * at least one element is expected to be present
  *
  */
-template <typename T>
-class geo::PlaneDataContainer : public geo::GeoIDdataContainer<T, geo::PlaneIDmapper<>> {
+template <typename T, typename Allocator>
+class geo::PlaneDataContainer : public geo::GeoIDdataContainer<T, geo::PlaneIDmapper<>, Allocator> {
 
   /// Base class.
-  using BaseContainer_t = geo::GeoIDdataContainer<T, geo::PlaneIDmapper<>>;
+  using BaseContainer_t = geo::GeoIDdataContainer<T, geo::PlaneIDmapper<>, Allocator>;
 
 public:
+  using allocator_type = typename BaseContainer_t::allocator_type;
+
   /**
    * @brief Default constructor: empty container.
    * @see `resize()`
@@ -684,18 +887,25 @@ public:
    */
   PlaneDataContainer() = default;
 
+  /// Constructor: empty container, allocating memory via `alloc`.
+  explicit PlaneDataContainer(allocator_type const& alloc) : BaseContainer_t(alloc) {}
+
   /**
    * @brief Prepares the container with default-constructed data.
    * @param nCryo number of cryostats
    * @param nTPCs number of TPCs per cryostat
    * @param nPlanes number of planes per TPC
+   * @param alloc allocator for the data storage
    *
    * The container is sized to host data for `nCryo` cryostats, each with
    * `nTPCs` TPCs, each one with `nPlanes` wire planes. Each element in the
    * container is default-constructed.
    */
-  PlaneDataContainer(unsigned int nCryo, unsigned int nTPCs, unsigned int nPlanes)
-    : BaseContainer_t({nCryo, nTPCs, nPlanes})
+  PlaneDataContainer(unsigned int nCryo,
+                     unsigned int nTPCs,
+                     unsigned int nPlanes,
+                     allocator_type const& alloc = allocator_type{})
+    : BaseContainer_t({nCryo, nTPCs, nPlanes}, alloc)
   {}
 
   /**
@@ -704,6 +914,7 @@ public:
    * @param nTPCs number of TPCs
    * @param nPlanes number of planes per TPC
    * @param defValue the value to be replicated
+   * @param alloc allocator for the data storage
    *
    * The container is sized to host data for `nCryo` cryostats, each with
    * `nTPCs` TPCs, and each of them with `nPlanes` planes. Each element in
@@ -717,8 +928,9 @@ public:
   PlaneDataContainer(unsigned int nCryo,
                      unsigned int nTPCs,
                      unsigned int nPlanes,
-                     T const& defValue)
-    : BaseContainer_t{{nCryo, nTPCs, nPlanes}, defValue}
+                     T const& defValue,
+                     allocator_type const& alloc = allocator_type{})
+    : BaseContainer_t{{nCryo, nTPCs, nPlanes}, defValue, alloc}
   {}
 
   // --- BEGIN Container modification ------------------------------------------
@@ -794,6 +1006,427 @@ public:
 
 }; // class geo::PlaneDataContainer
 
+//------------------------------------------------------------------------------
+/**
+ * @brief Container with one element per geometry element, of fixed size.
+ * @tparam T type of the contained datum
+ * @tparam Mapper type of mapping between IDs and index, with static sizes
+ * @see `geo::StaticGeoIDmapper`, `geo::StaticTPCDataContainer`,
+ *      `geo::StaticPlaneDataContainer`
+ *
+ * This container has the interface of `geo::GeoIDdataContainer` for the access
+ * to the data, but its dimensions are fixed at compile time by `Mapper`
+ * (usually a `geo::StaticGeoIDmapper`), and its data is stored in a
+ * `std::array`: it allocates no memory and it can't be resized nor cleared.
+ */
+template <typename T, typename Mapper>
+class geo::StaticGeoIDdataContainer {
+
+  /// Type of data storage.
+  using Container_t = std::array<T, Mapper::size()>;
+
+public:
+  /// Type of mapper between IDs and index.
+  using Mapper_t = Mapper;
+
+  using ID_t = typename Mapper_t::ID_t; ///< Type used as ID for this container.
+
+  /// @{
+  /// @name STL container types.
+
+  using value_type = typename Container_t::value_type;
+  using reference = typename Container_t::reference;
+  using const_reference = typename Container_t::const_reference;
+  using pointer = typename Container_t::pointer;
+  using const_pointer = typename Container_t::const_pointer;
+  using iterator =
+    details::GeoIDdataContainerIterator<Mapper_t, typename Container_t::iterator>;
+  using const_iterator =
+    details::GeoIDdataContainerIterator<Mapper_t, typename Container_t::const_iterator>;
+  using difference_type = typename Container_t::difference_type;
+  using size_type = typename Container_t::size_type;
+
+  /// Special iterator dereferencing to pairs ( ID, value ) (see `items()`).
+  using item_iterator = details::GeoIDdataContainerItemIterator<iterator>;
+
+  /// Special iterator dereferencing to pairs ( ID, value ) (see `items()`).
+  using item_const_iterator = details::GeoIDdataContainerItemIterator<const_iterator>;
+
+  /// @}
+
+  /// Constructor: all elements value-initialized.
+  StaticGeoIDdataContainer() = default;
+
+  /// Constructor: all elements copies of `defValue`.
+  explicit StaticGeoIDdataContainer(value_type const& defValue) { fill(defValue); }
+
+  // --- BEGIN Container status query ----------------------------------------
+  /// @name Container status query
+  /// @{
+
+  /// Returns the number of elements in the container.
+  static constexpr size_type size() { return Mapper_t::size(); }
+
+  /// Returns the number of elements the container has memory for.
+  static constexpr size_type capacity() { return size(); }
+
+  /// Returns whether the container has no elements (always `false`).
+  static constexpr bool empty() { return false; }
+
+  /// Dimensions of the `Level` dimension of this container.
+  template <std::size_t Level>
+  static constexpr unsigned int dimSize()
+  {
+    return Mapper_t::template dimSize<Level>();
+  }
+
+  /// Dimensions of the ID of this container.
+  static constexpr unsigned int dimensions() { return Mapper_t::dimensions(); }
+
+  /// Returns whether this container hosts data for the specified ID.
+  template <typename GeoID>
+  bool hasElement(GeoID const& id) const
+  {
+    return mapper().template hasElement<GeoID>(id);
+  }
+
+  /// Returns the ID of the first element with GeoID type.
+  template <typename GeoID = ID_t>
+  GeoID firstID() const
+  {
+    return mapper().template firstID<GeoID>();
+  }
+
+  /// Returns the ID of the last covered element with GeoID type.
+  template <typename GeoID = ID_t>
+  GeoID lastID() const
+  {
+    return mapper().template lastID<GeoID>();
+  }
+
+  /// Returns the mapper object used to convert ID's and container positions.
+  Mapper_t const& mapper() const { return fMapper; }
+
+  /// @}
+  // --- END Container status query ------------------------------------------
+
+  // --- BEGIN Element access ------------------------------------------------
+  /// @name Element access
+  /// @{
+
+  /// Returns the element for the specified geometry element.
+  reference operator[](ID_t const& id) { return fData[mapper().index(id)]; }
+
+  /// Returns the element for the specified geometry element (read-only).
+  const_reference operator[](ID_t const& id) const { return fData[mapper().index(id)]; }
+
+  /// Returns the element for the specified geometry element.
+  /// @throw std::out_of_range if element `id` is not within the container range
+  reference at(ID_t const& id)
+  {
+    if (hasElement(id)) return operator[](id);
+    throw std::out_of_range("No data for " + std::string(id));
+  }
+
+  /// Returns the element for the specified geometry element (read-only).
+  /// @throw std::out_of_range if element `id` is not within the container range
+  const_reference at(ID_t const& id) const
+  {
+    if (hasElement(id)) return operator[](id);
+    throw std::out_of_range("No data for " + std::string(id));
+  }
+
+  /// Returns the element for the first ID.
+  reference first() { return fData.front(); }
+
+  /// Returns the element for the first ID (read-only).
+  const_reference first() const { return fData.front(); }
+
+  /// Returns the element for the last ID.
+  reference last() { return fData.back(); }
+
+  /// Returns the element for the last ID (read-only).
+  const_reference last() const { return fData.back(); }
+
+  /// Returns a pointer to the flat data storage.
+  pointer data() { return fData.data(); }
+
+  /// Returns a pointer to the flat data storage (read-only).
+  const_pointer data() const { return fData.data(); }
+
+  /// @}
+  // --- END Element access --------------------------------------------------
+
+  // --- BEGIN Iterators -----------------------------------------------------
+  /// @name Iterators
+  /// @see `geo::GeoIDdataContainer`
+  /// @{
+
+  iterator begin() { return {mapper(), fData.begin(), fData.begin()}; }
+  iterator end() { return {mapper(), fData.begin(), fData.end()}; }
+  const_iterator begin() const { return {mapper(), fData.begin(), fData.begin()}; }
+  const_iterator end() const { return {mapper(), fData.begin(), fData.end()}; }
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
+
+  item_iterator item_begin() { return {begin()}; }
+  item_iterator item_end() { return {end()}; }
+  item_const_iterator item_begin() const { return {begin()}; }
+  item_const_iterator item_end() const { return {end()}; }
+  item_const_iterator item_cbegin() const { return item_begin(); }
+  item_const_iterator item_cend() const { return item_end(); }
+
+  /// Returns an object suitable for a range-for loop with `item_iterator`.
+  auto items() { return util::span{item_begin(), item_end()}; }
+
+  /// Returns an object suitable for a range-for loop with `item_const_iterator`.
+  auto items() const { return util::span{item_begin(), item_end()}; }
+
+  /// @}
+  // --- END Iterators -------------------------------------------------------
+
+  // --- BEGIN Data modification ---------------------------------------------
+  /// @name Data modification
+  /// @see `geo::GeoIDdataContainer`
+  /// @{
+
+  /// Sets all elements to the specified `value` (copied).
+  void fill(value_type value) { fData.fill(value); }
+
+  /// Sets all the elements to a default-constructed `value_type`.
+  void reset() { fill(value_type{}); }
+
+  /// Applies an operation on all elements, and returns it.
+  template <typename Op>
+  Op apply(Op&& op)
+  {
+    for (auto& data : fData)
+      op(data);
+    return op;
+  }
+
+  /// Applies an operation on all elements (read-only), and returns it.
+  template <typename Op>
+  Op apply(Op&& op) const
+  {
+    for (auto const& data : fData)
+      op(data);
+    return op;
+  }
+
+  /// Applies an operation on all elements, possibly concurrently.
+  /// @see `geo::GeoIDdataContainer::apply(TaskRunner_t const&, Op&&)`
+  template <typename Op>
+  void apply(TaskRunner_t const& runner, Op&& op)
+  {
+    details::applyInBlocks(fData.begin(), fData.size(), runner, op);
+  }
+
+  /// Applies an operation on all elements (read-only), possibly concurrently.
+  template <typename Op>
+  void apply(TaskRunner_t const& runner, Op&& op) const
+  {
+    details::applyInBlocks(fData.cbegin(), fData.size(), runner, op);
+  }
+
+  /// @}
+  // --- END Data modification -------------------------------------------------
+
+private:
+  /// Mapping of IDs to indices (stateless, shared by all containers).
+  static constexpr Mapper_t fMapper{};
+
+  Container_t fData{}; ///< Data storage.
+
+}; // class geo::StaticGeoIDdataContainer<>
+
+//------------------------------------------------------------------------------
+/**
+ * @brief Container with one element per TPC, with sizes fixed at compile time.
+ * @tparam T type of the contained datum
+ * @tparam NCryostats number of cryostats
+ * @tparam NTPCs number of TPCs in each cryostat
+ * @see `geo::TPCDataContainer`, `geo::StaticGeoIDdataContainer`
+ */
+template <typename T, unsigned int NCryostats, unsigned int NTPCs>
+class geo::StaticTPCDataContainer
+  : public geo::StaticGeoIDdataContainer<T, geo::StaticTPCIDmapper<NCryostats, NTPCs>> {
+
+  using BaseContainer_t =
+    geo::StaticGeoIDdataContainer<T, geo::StaticTPCIDmapper<NCryostats, NTPCs>>;
+
+public:
+  using BaseContainer_t::BaseContainer_t;
+
+  /// Returns whether this container hosts data for the specified cryostat.
+  bool hasCryostat(geo::CryostatID const& cryoid) const
+  {
+    return BaseContainer_t::hasElement(cryoid);
+  }
+
+  /// Returns whether this container hosts data for the specified TPC.
+  bool hasTPC(geo::TPCID const& tpcid) const { return BaseContainer_t::hasElement(tpcid); }
+
+}; // class geo::StaticTPCDataContainer<>
+
+//------------------------------------------------------------------------------
+/**
+ * @brief Container with one element per plane, with sizes fixed at compile time.
+ * @tparam T type of the contained datum
+ * @tparam NCryostats number of cryostats
+ * @tparam NTPCs number of TPCs in each cryostat
+ * @tparam NPlanes number of planes in each TPC
+ * @see `geo::PlaneDataContainer`, `geo::StaticGeoIDdataContainer`
+ *
+ * Example for a detector with two cryostats with 4 TPCs of three planes each:
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * geo::StaticPlaneDataContainer<unsigned int, 2U, 4U, 3U> hitsPerPlane{0U};
+ * for (recob::Hit const& hit: hits) ++hitsPerPlane[hit.WireID().planeID()];
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ */
+template <typename T, unsigned int NCryostats, unsigned int NTPCs, unsigned int NPlanes>
+class geo::StaticPlaneDataContainer
+  : public geo::StaticGeoIDdataContainer<T,
+                                         geo::StaticPlaneIDmapper<NCryostats, NTPCs, NPlanes>> {
+
+  using BaseContainer_t =
+    geo::StaticGeoIDdataContainer<T, geo::StaticPlaneIDmapper<NCryostats, NTPCs, NPlanes>>;
+
+public:
+  using BaseContainer_t::BaseContainer_t;
+
+  /// Returns whether this container hosts data for the specified cryostat.
+  bool hasCryostat(geo::CryostatID const& cryoid) const
+  {
+    return BaseContainer_t::hasElement(cryoid);
+  }
+
+  /// Returns whether this container hosts data for the specified TPC.
+  bool hasTPC(geo::TPCID const& tpcid) const { return BaseContainer_t::hasElement(tpcid); }
+
+  /// Returns whether this container hosts data for the specified plane.
+  bool hasPlane(geo::PlaneID const& planeid) const { return BaseContainer_t::hasElement(planeid); }
+
+}; // class geo::StaticPlaneDataContainer<>
+
+//------------------------------------------------------------------------------
+/**
+ * @brief Container with one element per existing TPC.
+ * @tparam T type of the contained datum
+ * @tparam Allocator type of allocator of the data storage
+ * @see `geo::GeometryCore::makeCompressedTPCData`, `geo::CompressedTPCIDmapper`
+ *
+ * This container has the interface of `geo::TPCDataContainer`, but it hosts
+ * data only for the TPCs in its mapping, which can have a different number of
+ * TPCs in each cryostat. The mapping is created first, and the container
+ * sized after it:
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * geo::CompressedTPCIDmapper<> mapper{
+ *   { 2U }, [](geo::CryostatID const& cid){ return (cid.Cryostat == 0)? 4U: 2U; }
+ *   };
+ * geo::CompressedTPCDataContainer<double> data{ std::move(mapper), 0.0 };
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * The container can't be resized; to reuse the mapping of another container,
+ * construct from its `mapper()`.
+ */
+template <typename T, typename Allocator>
+class geo::CompressedTPCDataContainer
+  : public geo::GeoIDdataContainer<T, geo::CompressedTPCIDmapper<>, Allocator> {
+
+  using BaseContainer_t = geo::GeoIDdataContainer<T, geo::CompressedTPCIDmapper<>, Allocator>;
+
+public:
+  using Mapper_t = typename BaseContainer_t::Mapper_t;
+  using value_type = typename BaseContainer_t::value_type;
+  using allocator_type = typename BaseContainer_t::allocator_type;
+
+  /// Default constructor: empty container.
+  CompressedTPCDataContainer() = default;
+
+  /// Constructor: empty container, allocating memory via `alloc`.
+  explicit CompressedTPCDataContainer(allocator_type const& alloc) : BaseContainer_t(alloc) {}
+
+  /// Constructor: one default-constructed element for each TPC in `mapper`.
+  explicit CompressedTPCDataContainer(Mapper_t mapper,
+                                      allocator_type const& alloc = allocator_type{})
+    : BaseContainer_t(std::move(mapper), alloc)
+  {}
+
+  /// Constructor: one copy of `defValue` for each TPC in `mapper`.
+  CompressedTPCDataContainer(Mapper_t mapper,
+                             value_type const& defValue,
+                             allocator_type const& alloc = allocator_type{})
+    : BaseContainer_t(std::move(mapper), defValue, alloc)
+  {}
+
+  /// Returns whether this container hosts data for the specified cryostat.
+  bool hasCryostat(geo::CryostatID const& cryoid) const
+  {
+    return BaseContainer_t::hasElement(cryoid);
+  }
+
+  /// Returns whether this container hosts data for the specified TPC.
+  bool hasTPC(geo::TPCID const& tpcid) const { return BaseContainer_t::hasElement(tpcid); }
+
+}; // class geo::CompressedTPCDataContainer<>
+
+//------------------------------------------------------------------------------
+/**
+ * @brief Container with one element per existing plane.
+ * @tparam T type of the contained datum
+ * @tparam Allocator type of allocator of the data storage
+ * @see `geo::GeometryCore::makeCompressedPlaneData`, `geo::CompressedPlaneIDmapper`
+ *
+ * This container has the interface of `geo::PlaneDataContainer`, but it hosts
+ * data only for the planes in its mapping, which can have a different number
+ * of planes in each TPC, and no plane at all in TPCs which are not included.
+ * Access by plane ID costs one lookup in a table with one entry per TPC.
+ * @see `geo::CompressedTPCDataContainer`
+ */
+template <typename T, typename Allocator>
+class geo::CompressedPlaneDataContainer
+  : public geo::GeoIDdataContainer<T, geo::CompressedPlaneIDmapper<>, Allocator> {
+
+  using BaseContainer_t = geo::GeoIDdataContainer<T, geo::CompressedPlaneIDmapper<>, Allocator>;
+
+public:
+  using Mapper_t = typename BaseContainer_t::Mapper_t;
+  using value_type = typename BaseContainer_t::value_type;
+  using allocator_type = typename BaseContainer_t::allocator_type;
+
+  /// Default constructor: empty container.
+  CompressedPlaneDataContainer() = default;
+
+  /// Constructor: empty container, allocating memory via `alloc`.
+  explicit CompressedPlaneDataContainer(allocator_type const& alloc) : BaseContainer_t(alloc) {}
+
+  /// Constructor: one default-constructed element for each plane in `mapper`.
+  explicit CompressedPlaneDataContainer(Mapper_t mapper,
+                                        allocator_type const& alloc = allocator_type{})
+    : BaseContainer_t(std::move(mapper), alloc)
+  {}
+
+  /// Constructor: one copy of `defValue` for each plane in `mapper`.
+  CompressedPlaneDataContainer(Mapper_t mapper,
+                               value_type const& defValue,
+                               allocator_type const& alloc = allocator_type{})
+    : BaseContainer_t(std::move(mapper), defValue, alloc)
+  {}
+
+  /// Returns whether this container hosts data for the specified cryostat.
+  bool hasCryostat(geo::CryostatID const& cryoid) const
+  {
+    return BaseContainer_t::hasElement(cryoid);
+  }
+
+  /// Returns whether this container hosts data for the specified TPC.
+  bool hasTPC(geo::TPCID const& tpcid) const { return BaseContainer_t::hasElement(tpcid); }
+
+  /// Returns whether this container hosts data for the specified plane.
+  bool hasPlane(geo::PlaneID const& planeid) const { return BaseContainer_t::hasElement(planeid); }
+
+}; // class geo::CompressedPlaneDataContainer<>
+
 //------------------------------------------------------------------------------
 /**
  * @brief Iterator for `geo::GeoIDdataContainer` class.
@@ -806,7 +1439,9 @@ template <typename GeoIDmapperClass, typename BaseIterator>
 class geo::details::GeoIDdataContainerIterator
   : public boost::iterator_adaptor<
       geo::details::GeoIDdataContainerIterator<GeoIDmapperClass, BaseIterator>,
-      BaseIterator> {
+      BaseIterator,
+      boost::use_default,
+      std::random_access_iterator_tag> {
 
   ///< Type of mapping of the container this class iterates.
   using Mapper_t = GeoIDmapperClass;
@@ -871,6 +1506,13 @@ public:
   /// Returns the ID corresponding to the current element.
   ID_t ID() const { return mapper().ID(index()); }
 
+  /// Returns the element `n` positions after the current one.
+  typename GeoIDdataContainerIterator::iterator_adaptor_::reference operator[](
+    typename GeoIDdataContainerIterator::iterator_adaptor_::difference_type n) const
+  {
+    return *(*this + n);
+  }
+
 private:
   //   friend class boost::iterator_core_access;
 
@@ -893,7 +1535,7 @@ class geo::details::GeoIDdataContainerItemIterator
                                    std::pair<typename GeoIDIteratorClass::ID_t,
                                              typename GeoIDIteratorClass::reference> // Value
                                    ,
-                                   boost::use_default // Category
+                                   std::random_access_iterator_tag // Category
                                    ,
                                    std::pair<typename GeoIDIteratorClass::ID_t,
                                              typename GeoIDIteratorClass::reference> // Reference
@@ -909,6 +1551,10 @@ class geo::details::GeoIDdataContainerItemIterator
    *      access iterator since it dereferences to a temporary value (rvalue)
    *      like an input iterator can; but for the rest it's a full blown random
    *      access iterator (same stuff as the infamous `std::vector<bool>`)
+   *  * the category is still declared random access, or the standard library
+   *      would treat it as an input iterator and its parallel algorithms
+   *      would process the items sequentially; the proxy pair holds the ID by
+   *      value and the datum by reference, which suits those algorithms
    *
    */
 
@@ -934,6 +1580,13 @@ public:
     : iterator_adaptor_(other.base())
   {}
 
+  /// Returns the item `n` positions after the current one (ID and datum).
+  typename iterator_adaptor_::reference operator[](
+    typename iterator_adaptor_::difference_type n) const
+  {
+    return *(*this + n);
+  }
+
 private:
   friend class boost::iterator_core_access;
 
@@ -954,10 +1607,10 @@ private:
 //------------------------------------------------------------------------------
 //--- geo::details::GeoContainerData
 //------------------------------------------------------------------------------
-template <typename T>
+template <typename T, typename Allocator>
 class geo::details::GeoContainerData {
 
-  using Container_t = std::vector<T>;
+  using Container_t = std::vector<T, Allocator>;
 
 public:
   // --- BEGIN STL container types ---------------------------------------------
@@ -975,6 +1628,7 @@ public:
   using const_reverse_iterator = typename Container_t::const_reverse_iterator;
   using difference_type = typename Container_t::difference_type;
   using size_type = typename Container_t::size_type;
+  using allocator_type = typename Container_t::allocator_type;
 
   /// @}
   // --- END STL container types -----------------------------------------------
@@ -986,11 +1640,23 @@ public:
   /// Default constructor with empty container. Good for nothing.
   GeoContainerData() = default;
 
+  /// Empty container, allocating memory via `alloc`.
+  explicit GeoContainerData(allocator_type const& alloc) : fData(alloc) {}
+
   /// Prepares the container with default-constructed data.
-  GeoContainerData(size_type size) : fData(size) {}
+  GeoContainerData(size_type size, allocator_type const& alloc = allocator_type{})
+    : fData(size, alloc)
+  {}
 
   // Prepares the container with copies of the specified default value.
-  GeoContainerData(size_type size, value_type const& defValue) : fData(size, defValue) {}
+  GeoContainerData(size_type size,
+                   value_type const& defValue,
+                   allocator_type const& alloc = allocator_type{})
+    : fData(size, defValue, alloc)
+  {}
+
+  /// Returns a copy of the allocator of the data storage.
+  allocator_type get_allocator() const { return fData.get_allocator(); }
 
   // --- END Constructors ------------------------------------------------------
 
@@ -1024,7 +1690,18 @@ public:
   void fill(value_type value) { std::fill(fData.begin(), fData.end(), value); }
 
   /// Sets all the elements to a default-constructed `value_type`.
-  void reset() { fill(value_type{}); }
+  void reset()
+  {
+    // zero-initialization of these types is all bits cleared
+    if constexpr (std::is_arithmetic_v<value_type> || std::is_enum_v<value_type>) {
+      if (!fData.empty()) std::memset(fData.data(), 0, fData.size() * sizeof(value_type));
+    }
+    else
+      fill(value_type{});
+  }
+
+  /// Sets all the elements to `value`.
+  void reset(value_type const& value) { std::fill(fData.begin(), fData.end(), value); }
 
   /**
    * @brief Applies an operation on all elements.
@@ -1064,6 +1741,30 @@ public:
     return op;
   }
 
+  /**
+   * @brief Applies an operation on all elements, with tasks from `runner`.
+   * @tparam Op type of operation
+   * @param runner the runner of the parallel tasks
+   * @param op Operation, called concurrently
+   */
+  template <typename Op>
+  void apply(geo::TaskRunner_t const& runner, Op&& op)
+  {
+    details::applyInBlocks(fData.begin(), fData.size(), runner, op);
+  }
+
+  /**
+   * @brief Applies an operation on all elements, with tasks from `runner`.
+   * @tparam Op type of operation
+   * @param runner the runner of the parallel tasks
+   * @param op Operation, called concurrently
+   */
+  template <typename Op>
+  void apply(geo::TaskRunner_t const& runner, Op&& op) const
+  {
+    details::applyInBlocks(fData.cbegin(), fData.size(), runner, op);
+  }
+
   /// @}
   // --- END Element access ----------------------------------------------------
 
@@ -1094,6 +1795,15 @@ public:
    */
   void resize(size_type size, value_type const& defValue) { fData.resize(size, defValue); }
 
+  /**
+   * @brief Replaces all the content with `size` copies of `value`.
+   * @param size number of elements in the container
+   * @param value the value copied into all the elements
+   *
+   * The existing storage is reused if large enough.
+   */
+  void assign(size_type size, value_type const& value) { fData.assign(size, value); }
+
   /**
    * @brief Makes the container empty, with no usable storage space.
    * @see `resize()`
@@ -1154,331 +1864,416 @@ private:
 //------------------------------------------------------------------------------
 //--- geo::GeoIDdataContainer
 //------------------------------------------------------------------------------
-template <typename T, typename Mapper>
-geo::GeoIDdataContainer<T, Mapper>::GeoIDdataContainer(std::initializer_list<unsigned int> dims)
-  : fMapper(dims), fData(fMapper.size())
+template <typename T, typename Mapper, typename Allocator>
+geo::GeoIDdataContainer<T, Mapper, Allocator>::GeoIDdataContainer(allocator_type const& alloc)
+  : fMapper(), fData(alloc)
+{}
+
+//------------------------------------------------------------------------------
+template <typename T, typename Mapper, typename Allocator>
+geo::GeoIDdataContainer<T, Mapper, Allocator>::GeoIDdataContainer(
+  std::initializer_list<unsigned int> dims,
+  allocator_type const& alloc /* = allocator_type{} */)
+  : fMapper(dims), fData(fMapper.size(), alloc)
 {
   assert(!fData.empty());
 }
 
 //------------------------------------------------------------------------------
-template <typename T, typename Mapper>
-geo::GeoIDdataContainer<T, Mapper>::GeoIDdataContainer(std::initializer_list<unsigned int> dims,
-                                                       value_type const& defValue)
-  : fMapper(dims), fData(fMapper.computeSize(), defValue)
+template <typename T, typename Mapper, typename Allocator>
+geo::GeoIDdataContainer<T, Mapper, Allocator>::GeoIDdataContainer(
+  std::initializer_list<unsigned int> dims,
+  value_type const& defValue,
+  allocator_type const& alloc /* = allocator_type{} */)
+  : fMapper(dims), fData(fMapper.size(), defValue, alloc)
 {
   assert(!fData.empty());
 }
 
 //------------------------------------------------------------------------------
-template <typename T, typename Mapper>
-auto geo::GeoIDdataContainer<T, Mapper>::size() const -> size_type
+template <typename T, typename Mapper, typename Allocator>
+geo::GeoIDdataContainer<T, Mapper, Allocator>::GeoIDdataContainer(
+  Mapper_t mapper,
+  allocator_type const& alloc /* = allocator_type{} */)
+  : fMapper(std::move(mapper)), fData(fMapper.size(), alloc)
+{}
+
+//------------------------------------------------------------------------------
+template <typename T, typename Mapper, typename Allocator>
+geo::GeoIDdataContainer<T, Mapper, Allocator>::GeoIDdataContainer(
+  Mapper_t mapper,
+  value_type const& defValue,
+  allocator_type const& alloc /* = allocator_type{} */)
+  : fMapper(std::move(mapper)), fData(fMapper.size(), defValue, alloc)
+{}
+
+//------------------------------------------------------------------------------
+template <typename T, typename Mapper, typename Allocator>
+auto geo::GeoIDdataContainer<T, Mapper, Allocator>::size() const -> size_type
 {
   return fData.size();
 }
 
 //------------------------------------------------------------------------------
-template <typename T, typename Mapper>
-auto geo::GeoIDdataContainer<T, Mapper>::capacity() const -> size_type
+template <typename T, typename Mapper, typename Allocator>
+auto geo::GeoIDdataContainer<T, Mapper, Allocator>::capacity() const -> size_type
 {
   return fData.capacity();
 }
 
 //------------------------------------------------------------------------------
-template <typename T, typename Mapper>
-bool geo::GeoIDdataContainer<T, Mapper>::empty() const
+template <typename T, typename Mapper, typename Allocator>
+bool geo::GeoIDdataContainer<T, Mapper, Allocator>::empty() const
 {
   return fData.empty();
 }
 
 //------------------------------------------------------------------------------
-template <typename T, typename Mapper>
+template <typename T, typename Mapper, typename Allocator>
 template <std::size_t Level>
-unsigned int geo::GeoIDdataContainer<T, Mapper>::dimSize() const
+unsigned int geo::GeoIDdataContainer<T, Mapper, Allocator>::dimSize() const
 {
   return mapper().template dimSize<Level>();
 }
 
 //------------------------------------------------------------------------------
-template <typename T, typename Mapper>
-constexpr unsigned int geo::GeoIDdataContainer<T, Mapper>::dimensions()
+template <typename T, typename Mapper, typename Allocator>
+constexpr unsigned int geo::GeoIDdataContainer<T, Mapper, Allocator>::dimensions()
 {
   return Mapper_t::dimensions();
 }
 
 //------------------------------------------------------------------------------
-template <typename T, typename Mapper>
+template <typename T, typename Mapper, typename Allocator>
 template <typename GeoID>
-bool geo::GeoIDdataContainer<T, Mapper>::hasElement(GeoID const& id) const
+bool geo::GeoIDdataContainer<T, Mapper, Allocator>::hasElement(GeoID const& id) const
 {
   return mapper().template hasElement<GeoID>(id);
 }
 
 //------------------------------------------------------------------------------
-template <typename T, typename Mapper>
+template <typename T, typename Mapper, typename Allocator>
 template <typename GeoID /* = ID_t */>
-GeoID geo::GeoIDdataContainer<T, Mapper>::firstID() const
+GeoID geo::GeoIDdataContainer<T, Mapper, Allocator>::firstID() const
 {
   return mapper().template firstID<GeoID>();
 }
 
 //------------------------------------------------------------------------------
-template <typename T, typename Mapper>
+template <typename T, typename Mapper, typename Allocator>
 template <typename GeoID /* = ID_t */>
-GeoID geo::GeoIDdataContainer<T, Mapper>::lastID() const
+GeoID geo::GeoIDdataContainer<T, Mapper, Allocator>::lastID() const
 {
   return mapper().template lastID<GeoID>();
 }
 
 //------------------------------------------------------------------------------
-template <typename T, typename Mapper>
-auto geo::GeoIDdataContainer<T, Mapper>::mapper() const -> Mapper_t const&
+template <typename T, typename Mapper, typename Allocator>
+auto geo::GeoIDdataContainer<T, Mapper, Allocator>::mapper() const -> Mapper_t const&
 {
   return fMapper;
 }
 
 //------------------------------------------------------------------------------
-template <typename T, typename Mapper>
-auto geo::GeoIDdataContainer<T, Mapper>::operator[](ID_t const& id) -> reference
+template <typename T, typename Mapper, typename Allocator>
+auto geo::GeoIDdataContainer<T, Mapper, Allocator>::get_allocator() const -> allocator_type
+{
+  return fData.get_allocator();
+}
+
+//------------------------------------------------------------------------------
+template <typename T, typename Mapper, typename Allocator>
+auto geo::GeoIDdataContainer<T, Mapper, Allocator>::operator[](ID_t const& id) -> reference
 {
   return fData[mapper().index(id)];
 }
 
 //------------------------------------------------------------------------------
-template <typename T, typename Mapper>
-auto geo::GeoIDdataContainer<T, Mapper>::operator[](ID_t const& id) const -> const_reference
+template <typename T, typename Mapper, typename Allocator>
+auto geo::GeoIDdataContainer<T, Mapper, Allocator>::operator[](ID_t const& id) const
+  -> const_reference
 {
   return fData[mapper().index(id)];
 }
 
 //------------------------------------------------------------------------------
-template <typename T, typename Mapper>
-auto geo::GeoIDdataContainer<T, Mapper>::at(ID_t const& id) -> reference
+template <typename T, typename Mapper, typename Allocator>
+auto geo::GeoIDdataContainer<T, Mapper, Allocator>::at(ID_t const& id) -> reference
 {
   if (hasElement(id)) return operator[](id);
   throw std::out_of_range("No data for " + std::string(id));
 } // geo::GeoIDdataContainer<>::at()
 
 //------------------------------------------------------------------------------
-template <typename T, typename Mapper>
-auto geo::GeoIDdataContainer<T, Mapper>::at(ID_t const& id) const -> const_reference
+template <typename T, typename Mapper, typename Allocator>
+auto geo::GeoIDdataContainer<T, Mapper, Allocator>::at(ID_t const& id) const -> const_reference
 {
   if (hasElement(id)) return operator[](id);
   throw std::out_of_range("No data for " + std::string(id));
 } // geo::GeoIDdataContainer<>::at() const
 
 //------------------------------------------------------------------------------
-template <typename T, typename Mapper>
-auto geo::GeoIDdataContainer<T, Mapper>::first() -> reference
+template <typename T, typename Mapper, typename Allocator>
+auto geo::GeoIDdataContainer<T, Mapper, Allocator>::first() -> reference
 {
   return operator[](firstID());
 }
 
 //------------------------------------------------------------------------------
-template <typename T, typename Mapper>
-auto geo::GeoIDdataContainer<T, Mapper>::first() const -> const_reference
+template <typename T, typename Mapper, typename Allocator>
+auto geo::GeoIDdataContainer<T, Mapper, Allocator>::first() const -> const_reference
 {
   return operator[](firstID());
 }
 
 //------------------------------------------------------------------------------
-template <typename T, typename Mapper>
-auto geo::GeoIDdataContainer<T, Mapper>::last() -> reference
+template <typename T, typename Mapper, typename Allocator>
+auto geo::GeoIDdataContainer<T, Mapper, Allocator>::last() -> reference
 {
   return operator[](lastID());
 }
 
 //------------------------------------------------------------------------------
-template <typename T, typename Mapper>
-auto geo::GeoIDdataContainer<T, Mapper>::last() const -> const_reference
+template <typename T, typename Mapper, typename Allocator>
+auto geo::GeoIDdataContainer<T, Mapper, Allocator>::last() const -> const_reference
 {
   return operator[](lastID());
 }
 
 //------------------------------------------------------------------------------
-template <typename T, typename Mapper>
-auto geo::GeoIDdataContainer<T, Mapper>::begin() -> iterator
+template <typename T, typename Mapper, typename Allocator>
+auto geo::GeoIDdataContainer<T, Mapper, Allocator>::begin() -> iterator
 {
   return {mapper(), fData.begin(), fData.begin()};
 }
 
 //------------------------------------------------------------------------------
-template <typename T, typename Mapper>
-auto geo::GeoIDdataContainer<T, Mapper>::end() -> iterator
+template <typename T, typename Mapper, typename Allocator>
+auto geo::GeoIDdataContainer<T, Mapper, Allocator>::end() -> iterator
 {
   return {mapper(), fData.begin(), fData.end()};
 }
 
 //------------------------------------------------------------------------------
-template <typename T, typename Mapper>
-auto geo::GeoIDdataContainer<T, Mapper>::begin() const -> const_iterator
+template <typename T, typename Mapper, typename Allocator>
+auto geo::GeoIDdataContainer<T, Mapper, Allocator>::begin() const -> const_iterator
 {
   return {mapper(), fData.begin(), fData.begin()};
 }
 
 //------------------------------------------------------------------------------
-template <typename T, typename Mapper>
-auto geo::GeoIDdataContainer<T, Mapper>::end() const -> const_iterator
+template <typename T, typename Mapper, typename Allocator>
+auto geo::GeoIDdataContainer<T, Mapper, Allocator>::end() const -> const_iterator
 {
   return {mapper(), fData.begin(), fData.end()};
 }
 
 //------------------------------------------------------------------------------
-template <typename T, typename Mapper>
-auto geo::GeoIDdataContainer<T, Mapper>::cbegin() const -> const_iterator
+template <typename T, typename Mapper, typename Allocator>
+auto geo::GeoIDdataContainer<T, Mapper, Allocator>::cbegin() const -> const_iterator
 {
   return begin();
 }
 
 //------------------------------------------------------------------------------
-template <typename T, typename Mapper>
-auto geo::GeoIDdataContainer<T, Mapper>::cend() const -> const_iterator
+template <typename T, typename Mapper, typename Allocator>
+auto geo::GeoIDdataContainer<T, Mapper, Allocator>::cend() const -> const_iterator
 {
   return end();
 }
 
 //------------------------------------------------------------------------------
-template <typename T, typename Mapper>
-auto geo::GeoIDdataContainer<T, Mapper>::item_begin() -> item_iterator
+template <typename T, typename Mapper, typename Allocator>
+auto geo::GeoIDdataContainer<T, Mapper, Allocator>::item_begin() -> item_iterator
 {
   return {begin()};
 }
 
 //------------------------------------------------------------------------------
-template <typename T, typename Mapper>
-auto geo::GeoIDdataContainer<T, Mapper>::item_end() -> item_iterator
+template <typename T, typename Mapper, typename Allocator>
+auto geo::GeoIDdataContainer<T, Mapper, Allocator>::item_end() -> item_iterator
 {
   return {end()};
 }
 
 //------------------------------------------------------------------------------
-template <typename T, typename Mapper>
-auto geo::GeoIDdataContainer<T, Mapper>::item_begin() const -> item_const_iterator
+template <typename T, typename Mapper, typename Allocator>
+auto geo::GeoIDdataContainer<T, Mapper, Allocator>::item_begin() const -> item_const_iterator
 {
   return {begin()};
 }
 
 //------------------------------------------------------------------------------
-template <typename T, typename Mapper>
-auto geo::GeoIDdataContainer<T, Mapper>::item_end() const -> item_const_iterator
+template <typename T, typename Mapper, typename Allocator>
+auto geo::GeoIDdataContainer<T, Mapper, Allocator>::item_end() const -> item_const_iterator
 {
   return {end()};
 }
 
 //------------------------------------------------------------------------------
-template <typename T, typename Mapper>
-auto geo::GeoIDdataContainer<T, Mapper>::item_cbegin() const -> item_const_iterator
+template <typename T, typename Mapper, typename Allocator>
+auto geo::GeoIDdataContainer<T, Mapper, Allocator>::item_cbegin() const -> item_const_iterator
 {
   return item_begin();
 }
 
 //------------------------------------------------------------------------------
-template <typename T, typename Mapper>
-auto geo::GeoIDdataContainer<T, Mapper>::item_cend() const -> item_const_iterator
+template <typename T, typename Mapper, typename Allocator>
+auto geo::GeoIDdataContainer<T, Mapper, Allocator>::item_cend() const -> item_const_iterator
 {
   return item_end();
 }
 
 //------------------------------------------------------------------------------
-template <typename T, typename Mapper>
-auto geo::GeoIDdataContainer<T, Mapper>::items()
+template <typename T, typename Mapper, typename Allocator>
+auto geo::GeoIDdataContainer<T, Mapper, Allocator>::items()
 {
   return util::span{item_begin(), item_end()};
 }
 
 //------------------------------------------------------------------------------
-template <typename T, typename Mapper>
-auto geo::GeoIDdataContainer<T, Mapper>::items() const
+template <typename T, typename Mapper, typename Allocator>
+auto geo::GeoIDdataContainer<T, Mapper, Allocator>::items() const
 {
   return util::span{item_begin(), item_end()};
 }
 
 //------------------------------------------------------------------------------
-template <typename T, typename Mapper>
-void geo::GeoIDdataContainer<T, Mapper>::fill(value_type value)
+template <typename T, typename Mapper, typename Allocator>
+void geo::GeoIDdataContainer<T, Mapper, Allocator>::fill(value_type value)
 {
   fData.fill(value);
 }
 
 //------------------------------------------------------------------------------
-template <typename T, typename Mapper>
-void geo::GeoIDdataContainer<T, Mapper>::reset()
+template <typename T, typename Mapper, typename Allocator>
+void geo::GeoIDdataContainer<T, Mapper, Allocator>::reset()
 {
   fData.reset();
 }
 
 //------------------------------------------------------------------------------
-template <typename T, typename Mapper>
+template <typename T, typename Mapper, typename Allocator>
+void geo::GeoIDdataContainer<T, Mapper, Allocator>::reset(value_type const& value)
+{
+  fData.reset(value);
+}
+
+//------------------------------------------------------------------------------
+template <typename T, typename Mapper, typename Allocator>
 template <typename Op>
-Op geo::GeoIDdataContainer<T, Mapper>::apply(Op&& op)
+Op geo::GeoIDdataContainer<T, Mapper, Allocator>::apply(Op&& op)
 {
   return fData.apply(std::forward<Op>(op));
 }
 
 //------------------------------------------------------------------------------
-template <typename T, typename Mapper>
-void geo::GeoIDdataContainer<T, Mapper>::resize(std::initializer_list<unsigned int> dims)
+template <typename T, typename Mapper, typename Allocator>
+void geo::GeoIDdataContainer<T, Mapper, Allocator>::resize(std::initializer_list<unsigned int> dims)
 {
   fMapper.resize(dims);
   fData.resize(mapper().size());
-} // geo::GeoIDdataContainer<T, Mapper>::resize()
+} // geo::GeoIDdataContainer<T, Mapper, Allocator>::resize()
 
 //------------------------------------------------------------------------------
-template <typename T, typename Mapper>
-void geo::GeoIDdataContainer<T, Mapper>::resize(std::initializer_list<unsigned int> dims,
-                                                value_type const& defValue)
+template <typename T, typename Mapper, typename Allocator>
+void geo::GeoIDdataContainer<T, Mapper, Allocator>::resize(
+  std::initializer_list<unsigned int> dims,
+  value_type const& defValue)
 {
   fMapper.resize(dims);
   fData.resize(mapper().size(), defValue);
-} // geo::GeoIDdataContainer<T, Mapper>::resize(value_type)
+} // geo::GeoIDdataContainer<T, Mapper, Allocator>::resize(value_type)
 
 //------------------------------------------------------------------------------
-template <typename T, typename Mapper>
-template <typename OT>
-void geo::GeoIDdataContainer<T, Mapper>::resizeAs(
-  geo::GeoIDdataContainer<OT, Mapper_t> const& other)
+template <typename T, typename Mapper, typename Allocator>
+template <typename OT, typename OAlloc>
+void geo::GeoIDdataContainer<T, Mapper, Allocator>::resizeAs(
+  geo::GeoIDdataContainer<OT, Mapper_t, OAlloc> const& other)
 {
   fMapper.resizeAs(other.mapper());
   fData.resize(mapper().size());
-} // geo::GeoIDdataContainer<T, Mapper>::resizeAs()
+} // geo::GeoIDdataContainer<T, Mapper, Allocator>::resizeAs()
 
 //------------------------------------------------------------------------------
-template <typename T, typename Mapper>
-template <typename OT>
-void geo::GeoIDdataContainer<T, Mapper>::resizeAs(
-  geo::GeoIDdataContainer<OT, Mapper_t> const& other,
+template <typename T, typename Mapper, typename Allocator>
+template <typename OT, typename OAlloc>
+void geo::GeoIDdataContainer<T, Mapper, Allocator>::resizeAs(
+  geo::GeoIDdataContainer<OT, Mapper_t, OAlloc> const& other,
   value_type const& defValue)
 {
   fMapper.resizeAs(other.mapper());
   fData.resize(mapper().size(), defValue);
-} // geo::GeoIDdataContainer<T, Mapper>::resizeAs(value_type)
+} // geo::GeoIDdataContainer<T, Mapper, Allocator>::resizeAs(value_type)
 
 //------------------------------------------------------------------------------
-template <typename T, typename Mapper>
-void geo::GeoIDdataContainer<T, Mapper>::clear()
+template <typename T, typename Mapper, typename Allocator>
+void geo::GeoIDdataContainer<T, Mapper, Allocator>::resizeAs(Mapper_t const& mapper)
+{
+  fMapper = mapper;
+  fData.resize(this->mapper().size());
+} // geo::GeoIDdataContainer<T, Mapper, Allocator>::resizeAs(Mapper_t)
+
+//------------------------------------------------------------------------------
+template <typename T, typename Mapper, typename Allocator>
+void geo::GeoIDdataContainer<T, Mapper, Allocator>::resizeAs(Mapper_t const& mapper,
+                                                             value_type const& defValue)
+{
+  fMapper = mapper;
+  fData.resize(this->mapper().size(), defValue);
+} // geo::GeoIDdataContainer<T, Mapper, Allocator>::resizeAs(Mapper_t, value_type)
+
+//------------------------------------------------------------------------------
+template <typename T, typename Mapper, typename Allocator>
+void geo::GeoIDdataContainer<T, Mapper, Allocator>::resetAs(Mapper_t const& mapper,
+                                                            value_type const& value)
+{
+  fMapper = mapper;
+  fData.assign(this->mapper().size(), value);
+} // geo::GeoIDdataContainer<T, Mapper, Allocator>::resetAs()
+
+//------------------------------------------------------------------------------
+template <typename T, typename Mapper, typename Allocator>
+void geo::GeoIDdataContainer<T, Mapper, Allocator>::clear()
 {
   fMapper.clear();
   fData.clear();
 } // geo::GeoIDdataContainer<>::clear()
 
 //------------------------------------------------------------------------------
-template <typename T, typename Mapper>
+template <typename T, typename Mapper, typename Allocator>
 template <typename Op>
-decltype(auto) geo::GeoIDdataContainer<T, Mapper>::apply(Op&& op) const
+decltype(auto) geo::GeoIDdataContainer<T, Mapper, Allocator>::apply(Op&& op) const
 {
   return fData.apply(std::forward<Op>(op));
 }
 
 //------------------------------------------------------------------------------
-template <typename T, typename Mapper>
-auto geo::GeoIDdataContainer<T, Mapper>::index(ID_t const& id) const -> size_type
+template <typename T, typename Mapper, typename Allocator>
+template <typename Op>
+void geo::GeoIDdataContainer<T, Mapper, Allocator>::apply(TaskRunner_t const& runner, Op&& op)
+{
+  fData.apply(runner, std::forward<Op>(op));
+}
+
+//------------------------------------------------------------------------------
+template <typename T, typename Mapper, typename Allocator>
+template <typename Op>
+void geo::GeoIDdataContainer<T, Mapper, Allocator>::apply(TaskRunner_t const& runner, Op&& op) const
+{
+  fData.apply(runner, std::forward<Op>(op));
+}
+
+//------------------------------------------------------------------------------
+template <typename T, typename Mapper, typename Allocator>
+auto geo::GeoIDdataContainer<T, Mapper, Allocator>::index(ID_t const& id) const -> size_type
 {
   return mapper().index(id);
 }
 
 //------------------------------------------------------------------------------
-template <typename T, typename Mapper>
-auto geo::GeoIDdataContainer<T, Mapper>::ID(size_type const index) const -> ID_t
+template <typename T, typename Mapper, typename Allocator>
+auto geo::GeoIDdataContainer<T, Mapper, Allocator>::ID(size_type const index) const -> ID_t
 {
   return mapper().ID(index);
 }
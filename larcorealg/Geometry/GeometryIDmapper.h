@@ -15,12 +15,16 @@
 #include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
 
 // C/C++ standard libraries
-#include <algorithm> // std::copy()
+#include <algorithm> // std::copy(), std::upper_bound()
 #include <array>
 #include <cassert>
+#include <cstdint> // std::uint32_t, std::uint64_t
 #include <cstdlib> // std::size_t
 #include <initializer_list>
+#include <iterator> // std::random_access_iterator_tag
+#include <limits>
 #include <type_traits> // std::index_sequence
+#include <vector>
 
 namespace geo {
 
@@ -33,6 +37,38 @@ namespace geo {
   template <typename Index = std::size_t>
   class PlaneIDmapper;
 
+  template <typename IDType, unsigned int... Dims>
+  class StaticGeoIDmapper;
+
+  /// Mapping of TPC IDs with dimensions fixed at compile time.
+  template <unsigned int NCryostats, unsigned int NTPCs>
+  using StaticTPCIDmapper = StaticGeoIDmapper<geo::TPCID, NCryostats, NTPCs>;
+
+  /// Mapping of plane IDs with dimensions fixed at compile time.
+  template <unsigned int NCryostats, unsigned int NTPCs, unsigned int NPlanes>
+  using StaticPlaneIDmapper = StaticGeoIDmapper<geo::PlaneID, NCryostats, NTPCs, NPlanes>;
+
+  template <typename IDType, typename Index = std::size_t>
+  class CompressedGeoIDmapper;
+
+  /// Mapping of TPC IDs with a different number of TPCs in each cryostat.
+  template <typename Index = std::size_t>
+  using CompressedTPCIDmapper = CompressedGeoIDmapper<geo::TPCID, Index>;
+
+  /// Mapping of plane IDs with a different number of planes in each TPC.
+  template <typename Index = std::size_t>
+  using CompressedPlaneIDmapper = CompressedGeoIDmapper<geo::PlaneID, Index>;
+
+  /// Mapping of wire IDs with a different number of wires in each plane.
+  template <typename Index = std::size_t>
+  using CompressedWireIDmapper = CompressedGeoIDmapper<geo::WireID, Index>;
+
+  template <typename Mapper>
+  class FlatGeoIDiterator;
+
+  template <typename Mapper>
+  class FlatGeoIDrange;
+
   // ---------------------------------------------------------------------------
   namespace details {
 
@@ -40,6 +76,58 @@ namespace geo {
     template <std::size_t N, typename T>
     auto initializerListToArray(std::initializer_list<T> values);
 
+    /**
+     * @brief Division by a fixed divisor via a precomputed multiplier.
+     *
+     * The quotient of a dividend of up to 32 bits is the upper half of its
+     * product with @f$ \lceil 2^{64} / d \rceil @f$ (D. Lemire, O. Kaser,
+     * N. Kurz, "Faster Remainder by Direct Computation", 2019), which costs a
+     * few multiplications and shifts; larger dividends fall back to the
+     * division operator. The divisor must not be `0`.
+     */
+    class FastDivider {
+    public:
+      /// Constructor: division by `1`.
+      constexpr FastDivider() = default;
+
+      /// Constructor: division by `divisor`.
+      constexpr explicit FastDivider(std::uint32_t divisor) noexcept
+        : fM{(divisor > 1U) ? (std::numeric_limits<std::uint64_t>::max() / divisor + 1U) : 0U}
+        , fD{divisor}
+      {}
+
+      /// Returns the divisor.
+      constexpr std::uint32_t divisor() const noexcept { return fD; }
+
+      /// Returns `n / divisor()`.
+      template <typename T>
+      constexpr T quotient(T n) const noexcept
+      {
+        auto const u = static_cast<std::uint64_t>(n);
+        if (u > std::numeric_limits<std::uint32_t>::max()) return static_cast<T>(u / fD);
+        return static_cast<T>((fM == 0U) ? u : mulHigh(fM, static_cast<std::uint32_t>(u)));
+      }
+
+      /// Returns `n % divisor()`.
+      template <typename T>
+      constexpr T remainder(T n) const noexcept
+      {
+        return n - quotient(n) * static_cast<T>(fD);
+      }
+
+    private:
+      std::uint64_t fM = 0U; ///< Multiplier (`0` when dividing by `1`).
+      std::uint32_t fD = 1U; ///< Divisor.
+
+      /// Returns the upper 64 bits of the 96-bit product of `a` and `b`.
+      static constexpr std::uint64_t mulHigh(std::uint64_t a, std::uint32_t b) noexcept
+      {
+        std::uint64_t const low = (a & 0xFFFFFFFFU) * b;
+        return ((a >> 32U) * b + (low >> 32U)) >> 32U;
+      }
+
+    }; // FastDivider
+
   } // namespace details
   // ---------------------------------------------------------------------------
 
@@ -70,6 +158,10 @@ namespace geo {
  * wires, making some of the indices that are valid from the point of view of
  * this ID mapping invalid in that they match wires that do not exist and should
  * not be assigned a channel number.
+ *
+ * The conversion from an index to an ID (`ID()`) uses, for each level, a
+ * division by the number of its elements precomputed at each resize, which is
+ * evaluated with multiplications (see `geo::details::FastDivider`).
  */
 template <typename IDType, typename Index /* = std::size_t */>
 class geo::GeoIDmapper {
@@ -185,9 +277,18 @@ private:
   ///< Type of dimension sizes.
   using Dimensions_t = std::array<unsigned int, dimensions()>;
 
+  ///< Type of precomputed divisions by the dimension sizes.
+  using Dividers_t = std::array<details::FastDivider, dimensions()>;
+
   /// Number of maximum entries per ID level.
   Dimensions_t fN = zeroDimensions();
 
+  /// Division by the number of entries of each ID level (`0` for level `0`).
+  Dividers_t fDividers;
+
+  /// Updates the precomputed divisions for the current dimensions.
+  void updateDividers();
+
   template <std::size_t Level, typename GeoID>
   index_type indexLevel(GeoID const& id) const;
 
@@ -383,6 +484,514 @@ public:
 
 }; // geo::PlaneIDmapper<>
 
+/** ****************************************************************************
+ * @brief Mapping between ID and flat index with dimensions fixed at compile time.
+ * @tparam IDType the geometry or readout ID to be managed
+ * @tparam Dims number of elements on all levels, from the outer one (cryostat)
+ * @see `geo::GeoIDmapper`
+ *
+ * This mapping is equivalent to a `geo::GeoIDmapper` with sizes `Dims`, but it
+ * holds no data: the sizes are constants, and the conversions between index and
+ * ID are written with them, so that the compiler can fold them (divisions by
+ * constants become multiplications). The index type is `std::size_t`.
+ * There are no resizing methods.
+ *
+ * Example for a detector with 2 cryostats, each with 4 TPCs of 3 planes:
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * constexpr geo::StaticPlaneIDmapper<2U, 4U, 3U> mapper;
+ * static_assert(mapper.size() == 24U);
+ * std::size_t const index = mapper.index({ 1U, 2U, 0U }); // 18
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ */
+template <typename IDType, unsigned int... Dims>
+class geo::StaticGeoIDmapper {
+
+  static_assert(sizeof...(Dims) == IDType::Level + 1,
+                "StaticGeoIDmapper requires one size for each level of the ID");
+  static_assert(((Dims > 0U) && ...), "StaticGeoIDmapper requires no empty levels");
+
+public:
+  using ID_t = IDType;            ///< Type used as ID for this mapping.
+  using index_type = std::size_t; ///< Type of flat index.
+
+  // --- BEGIN Indexer status query --------------------------------------------
+  /// @name Indexer status query
+  /// @{
+
+  /// Returns the number of elements in the mapping.
+  static constexpr index_type size() { return (index_type{1} * ... * Dims); }
+
+  /// Returns whether the mapping has no elements (always `false`).
+  static constexpr bool empty() { return false; }
+
+  /// Dimensions of the `Level` dimension of this mapping.
+  template <std::size_t Level>
+  static constexpr unsigned int dimSize()
+  {
+    if constexpr (Level >= dimensions())
+      return 0U; // technically it would be 1...
+    else
+      return Sizes[Level];
+  }
+
+  /// Dimensions of the ID of this mapping.
+  static constexpr unsigned int dimensions() { return IDType::Level + 1; }
+
+  /// Returns whether this mapping hosts data for the specified ID.
+  template <typename GeoID = ID_t>
+  bool hasElement(GeoID const& id) const
+  {
+    return hasElementLevel<GeoID::Level>(id);
+  }
+
+  /// Returns the ID of the first element with `GeoID` type.
+  template <typename GeoID = ID_t>
+  GeoID firstID() const
+  {
+    if constexpr (GeoID::Level == 0)
+      return GeoID(0U);
+    else
+      return GeoID(firstID<typename GeoID::ParentID_t>(), 0U);
+  }
+
+  /// Returns the ID of the last covered element with `GeoID` type.
+  template <typename GeoID = ID_t>
+  GeoID lastID() const
+  {
+    if constexpr (GeoID::Level == 0)
+      return GeoID(Sizes[GeoID::Level] - 1U);
+    else
+      return GeoID(lastID<typename GeoID::ParentID_t>(), Sizes[GeoID::Level] - 1U);
+  }
+
+  /// @}
+  // --- END Indexer status query ----------------------------------------------
+
+  // --- BEGIN Mapping transformations -----------------------------------------
+  /// @name Mapping transformations
+  /// @{
+
+  /// Returns the linear index corresponding to the specified ID.
+  index_type index(ID_t const& id) const { return indexLevel<ID_t::Level>(id); }
+
+  /// Returns the ID corresponding to the specified linear `index`.
+  ID_t ID(index_type const index) const
+  {
+    ID_t ID;
+    fillID<ID_t::Level>(ID, index);
+    return ID;
+  }
+
+  /// Returns the linear index corresponding to the specified ID.
+  index_type operator()(ID_t const& id) const { return index(id); }
+
+  /// Returns the ID corresponding to the specified linear `index`.
+  ID_t operator()(index_type const index) const { return ID(index); }
+
+  /// @}
+  // --- END Mapping transformations -------------------------------------------
+
+private:
+  /// Number of entries per ID level.
+  static constexpr std::array<unsigned int, sizeof...(Dims)> Sizes{Dims...};
+
+  template <std::size_t Level, typename GeoID>
+  static index_type indexLevel(GeoID const& id)
+  {
+    if constexpr (Level == 0)
+      return id.template getIndex<0U>();
+    else
+      return indexLevel<(Level - 1U)>(id) * Sizes[Level] + id.template getIndex<Level>();
+  }
+
+  template <std::size_t Level, typename GeoID>
+  static void fillID(GeoID& id, index_type index)
+  {
+    if constexpr (Level == 0) {
+      id.template writeIndex<0U>() = index;
+      id.setValidity(index < Sizes[0U]);
+    }
+    else {
+      id.template writeIndex<Level>() = index % Sizes[Level];
+      fillID<(Level - 1U)>(id, index / Sizes[Level]);
+    }
+  }
+
+  template <std::size_t Level, typename GeoID>
+  static bool hasElementLevel(GeoID const& id)
+  {
+    auto const v = id.template getIndex<Level>();
+    if ((v < 0) || (static_cast<index_type>(v) >= Sizes[Level])) return false;
+    if constexpr (Level == 0U)
+      return true;
+    else
+      return hasElementLevel<(Level - 1U)>(id);
+  }
+
+}; // geo::StaticGeoIDmapper<>
+
+/** ****************************************************************************
+ * @brief Mapping of IDs with a different number of elements in each parent.
+ * @tparam IDType type of ID to be mapped (e.g. `geo::PlaneID`)
+ * @tparam Index (default: `std::size_t`) type of flat index
+ * @see `geo::GeoIDmapper`, `geo::CompressedPlaneDataContainer`
+ *
+ * This mapping covers only the elements which exist: the number of elements
+ * in each parent (e.g. the number of planes in each TPC) is given on
+ * construction, and can be `0` for parents with no elements (like TPCs not
+ * included in the data).
+ * The parents are mapped densely by a `geo::GeoIDmapper`, and an offset table
+ * with one entry per parent converts an ID into its index with a single
+ * lookup. The conversion from index to ID is a binary search in the same
+ * table.
+ *
+ * Example for a cryostat with two TPCs of two and three planes respectively:
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * geo::CompressedPlaneIDmapper<> const mapper{
+ *   { 1U, 2U }, [](geo::TPCID const& tpcid){ return 2U + tpcid.TPC; }
+ *   };
+ * std::size_t const index = mapper.index({ 0U, 1U, 0U }); // 2
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ */
+template <typename IDType, typename Index /* = std::size_t */>
+class geo::CompressedGeoIDmapper {
+
+  static_assert(IDType::Level > 0U, "CompressedGeoIDmapper requires IDs with a parent");
+
+public:
+  using ID_t = IDType;                          ///< Type used as ID for this mapping.
+  using ParentID_t = typename ID_t::ParentID_t; ///< Type of ID of the parents.
+  using index_type = Index;                     ///< Type of flat index.
+
+  /// Type of dense mapping of the parents.
+  using ParentMapper_t = geo::GeoIDmapper<ParentID_t, Index>;
+
+  /// Default constructor: no element.
+  CompressedGeoIDmapper() : fOffsets(1U, index_type{0}) {}
+
+  /**
+   * @brief Prepares the mapping.
+   * @tparam Count type of callable returning the number of elements in a parent
+   * @param parentDims number of parent elements on all levels of the parent ID
+   * @param count called with each parent ID, returns its number of elements
+   *
+   * For example, for planes `parentDims` are the number of cryostats and the
+   * maximum number of TPCs in a cryostat, while `count(tpcid)` returns the
+   * number of planes in the TPC `tpcid` (`0` for a missing TPC).
+   */
+  template <typename Count>
+  CompressedGeoIDmapper(std::initializer_list<unsigned int> parentDims, Count&& count)
+    : fParents(parentDims)
+  {
+    fOffsets.reserve(fParents.size() + 1U);
+    fOffsets.push_back(index_type{0});
+    for (index_type iParent = 0; iParent < fParents.size(); ++iParent) {
+      unsigned int const n = count(fParents.ID(iParent));
+      if (n > fMaxElements) fMaxElements = n;
+      fOffsets.push_back(fOffsets.back() + n);
+    }
+  }
+
+  // --- BEGIN Indexer status query --------------------------------------------
+  /// @name Indexer status query
+  /// @{
+
+  /// Returns the number of elements in the mapping.
+  index_type size() const { return fOffsets.back(); }
+
+  /// Returns whether the mapping has no elements.
+  bool empty() const { return size() == 0U; }
+
+  /// Dimensions of the `Level` dimension of this mapping (maximum on last level).
+  template <std::size_t Level>
+  unsigned int dimSize() const
+  {
+    if constexpr (Level == ID_t::Level)
+      return fMaxElements;
+    else
+      return fParents.template dimSize<Level>();
+  }
+
+  /// Dimensions of the ID of this mapping.
+  static constexpr unsigned int dimensions() { return ID_t::Level + 1; }
+
+  /// Returns the number of elements in the specified parent.
+  unsigned int count(ParentID_t const& parentID) const
+  {
+    if (!fParents.hasElement(parentID)) return 0U;
+    index_type const iParent = fParents.index(parentID);
+    return static_cast<unsigned int>(fOffsets[iParent + 1U] - fOffsets[iParent]);
+  }
+
+  /// Returns whether this mapping hosts data for the specified ID.
+  /// A parent ID is hosted only if it has elements.
+  template <typename GeoID = ID_t>
+  bool hasElement(GeoID const& id) const
+  {
+    if constexpr (GeoID::Level == ID_t::Level) {
+      auto const v = id.deepestIndex();
+      return (v >= 0) && (static_cast<unsigned int>(v) < count(id.parentID()));
+    }
+    else if constexpr (GeoID::Level + 1U == ID_t::Level)
+      return count(id) > 0U;
+    else
+      return fParents.template hasElement<GeoID>(id);
+  }
+
+  /// Returns the ID of the first element with `GeoID` type.
+  template <typename GeoID = ID_t>
+  GeoID firstID() const
+  {
+    if constexpr (GeoID::Level == ID_t::Level)
+      return ID(0U);
+    else
+      return fParents.template firstID<GeoID>();
+  }
+
+  /// Returns the ID of the last covered element with `GeoID` type.
+  template <typename GeoID = ID_t>
+  GeoID lastID() const
+  {
+    if constexpr (GeoID::Level == ID_t::Level)
+      return ID(size() - 1U);
+    else
+      return fParents.template lastID<GeoID>();
+  }
+
+  /// Returns the mapping of the parent IDs.
+  ParentMapper_t const& parentMapper() const { return fParents; }
+
+  /// @}
+  // --- END Indexer status query ----------------------------------------------
+
+  // --- BEGIN Mapping transformations -----------------------------------------
+  /// @name Mapping transformations
+  /// @{
+
+  /// Returns the linear index corresponding to the specified ID.
+  index_type index(ID_t const& id) const
+  {
+    return fOffsets[fParents.index(id.parentID())] + id.deepestIndex();
+  }
+
+  /// Returns the ID corresponding to the specified linear `index`.
+  ID_t ID(index_type const index) const
+  {
+    // the last parent starting at or before index (skipping empty ones)
+    auto const next = std::upper_bound(fOffsets.begin(), fOffsets.end(), index);
+    index_type const iParent = static_cast<index_type>(next - fOffsets.begin()) - 1U;
+    ID_t id{fParents.ID(iParent), 0};
+    id.deepestIndex() = index - fOffsets[iParent];
+    return id;
+  }
+
+  /// Returns the linear index corresponding to the specified ID.
+  index_type operator()(ID_t const& id) const { return index(id); }
+
+  /// Returns the ID corresponding to the specified linear `index`.
+  ID_t operator()(index_type const index) const { return ID(index); }
+
+  /// @}
+  // --- END Mapping transformations -------------------------------------------
+
+  /// Removes all the elements.
+  void clear()
+  {
+    fParents.clear();
+    fOffsets.assign(1U, index_type{0});
+    fMaxElements = 0U;
+  }
+
+private:
+  ParentMapper_t fParents;          ///< Dense mapping of the parents.
+  std::vector<index_type> fOffsets; ///< Index of the first element of each parent, and size.
+  unsigned int fMaxElements = 0U;   ///< Largest number of elements in a parent.
+
+}; // geo::CompressedGeoIDmapper<>
+
+/** ****************************************************************************
+ * @brief Random access iterator to the IDs of a `geo::CompressedGeoIDmapper`.
+ * @tparam Mapper type of the compressed mapping
+ * @see `geo::FlatGeoIDrange`
+ *
+ * The iterator is a flat index in the mapping, together with the ID at that
+ * index. Incrementing it within the same parent (e.g. the same plane, for
+ * wire IDs) only increments the index and the last component of the ID;
+ * the ID is looked up in the mapping only when moving to another parent or
+ * when jumping (`operator+=()` and the like).
+ */
+template <typename Mapper>
+class geo::FlatGeoIDiterator {
+
+  using iterator_t = FlatGeoIDiterator<Mapper>; ///< This type.
+
+public:
+  using ID_t = typename Mapper::ID_t;             ///< Type of ID.
+  using index_type = typename Mapper::index_type; ///< Type of flat index.
+
+  using value_type = ID_t;
+  using reference = ID_t const&;
+  using pointer = ID_t const*;
+  using difference_type = std::ptrdiff_t;
+  using iterator_category = std::random_access_iterator_tag;
+
+  /// Default constructor: an iterator not associated to any mapping.
+  FlatGeoIDiterator() = default;
+
+  /// Constructor: points to the element at flat `index` of `mapper`.
+  FlatGeoIDiterator(Mapper const& mapper, index_type index) : fMapper{&mapper} { moveTo(index); }
+
+  /// Returns the current ID (invalid if past the end).
+  reference operator*() const { return fID; }
+  pointer operator->() const { return &fID; }
+
+  /// Returns the ID `n` elements after this one.
+  value_type operator[](difference_type n) const { return *(*this + n); }
+
+  /// Returns the flat index of the current ID.
+  index_type index() const { return fIndex; }
+
+  iterator_t& operator++()
+  {
+    if (++fIndex < fParentEnd)
+      ++fID.deepestIndex();
+    else
+      moveTo(fIndex);
+    return *this;
+  }
+
+  iterator_t operator++(int)
+  {
+    iterator_t const old = *this;
+    ++*this;
+    return old;
+  }
+
+  iterator_t& operator--()
+  {
+    if (fIndex > fParentBegin) {
+      --fIndex;
+      --fID.deepestIndex();
+    }
+    else
+      moveTo(fIndex - 1U);
+    return *this;
+  }
+
+  iterator_t operator--(int)
+  {
+    iterator_t const old = *this;
+    --*this;
+    return old;
+  }
+
+  iterator_t& operator+=(difference_type n)
+  {
+    moveTo(fIndex + n);
+    return *this;
+  }
+
+  iterator_t& operator-=(difference_type n) { return *this += -n; }
+
+  iterator_t operator+(difference_type n) const { return iterator_t{*this} += n; }
+  iterator_t operator-(difference_type n) const { return iterator_t{*this} -= n; }
+
+  difference_type operator-(iterator_t const& other) const
+  {
+    return static_cast<difference_type>(fIndex) - static_cast<difference_type>(other.fIndex);
+  }
+
+  bool operator==(iterator_t const& other) const { return fIndex == other.fIndex; }
+  bool operator!=(iterator_t const& other) const { return fIndex != other.fIndex; }
+  bool operator<(iterator_t const& other) const { return fIndex < other.fIndex; }
+  bool operator>(iterator_t const& other) const { return fIndex > other.fIndex; }
+  bool operator<=(iterator_t const& other) const { return fIndex <= other.fIndex; }
+  bool operator>=(iterator_t const& other) const { return fIndex >= other.fIndex; }
+
+private:
+  Mapper const* fMapper = nullptr; ///< The mapping being iterated.
+  index_type fIndex = 0;           ///< Current flat index.
+  ID_t fID;                        ///< Current ID.
+  index_type fParentBegin = 0;     ///< Index of the first element in the current parent.
+  index_type fParentEnd = 0;       ///< Index past the last element in the current parent.
+
+  /// Points to `index`, looking up its ID and parent in the mapping.
+  void moveTo(index_type index)
+  {
+    fIndex = index;
+    if (index < fMapper->size()) {
+      fID = fMapper->ID(index);
+      fParentBegin = index - fID.deepestIndex();
+      fParentEnd = fParentBegin + fMapper->count(fID.parentID());
+    }
+    else {
+      fID = ID_t{};
+      fParentBegin = fParentEnd = index;
+    }
+  }
+
+}; // geo::FlatGeoIDiterator<>
+
+/** ****************************************************************************
+ * @brief Range of consecutive IDs of a `geo::CompressedGeoIDmapper`.
+ * @tparam Mapper type of the compressed mapping
+ *
+ * The range covers the IDs with flat index from `first` to `last` (excluded)
+ * in the mapping, with random access (`geo::FlatGeoIDiterator`), so that a
+ * loop on it is a counted loop, and it can be split in independent parts,
+ * e.g. one per thread (`subrange()`):
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * auto const wires = geom.FlatWireIDs();
+ * std::size_t const half = wires.size() / 2;
+ * auto const firstHalf = wires.subrange(0, half), secondHalf = wires.subrange(half, wires.size());
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * The mapping must outlive the range.
+ */
+template <typename Mapper>
+class geo::FlatGeoIDrange {
+
+public:
+  using iterator = geo::FlatGeoIDiterator<Mapper>; ///< Type of iterator.
+  using const_iterator = iterator;                 ///< Type of iterator.
+  using ID_t = typename Mapper::ID_t;              ///< Type of ID.
+  using index_type = typename Mapper::index_type;  ///< Type of flat index.
+  using size_type = index_type;                    ///< Type of size.
+
+  /// Range of all the IDs in `mapper`.
+  explicit FlatGeoIDrange(Mapper const& mapper) : FlatGeoIDrange{mapper, 0U, mapper.size()} {}
+
+  /// Range of the IDs with flat index in [ `first`, `last` [ in `mapper`.
+  FlatGeoIDrange(Mapper const& mapper, index_type first, index_type last)
+    : fMapper{&mapper}, fFirst{first}, fLast{std::max(first, last)}
+  {
+    assert(fLast <= mapper.size());
+  }
+
+  iterator begin() const { return {*fMapper, fFirst}; }
+  iterator end() const { return {*fMapper, fLast}; }
+
+  /// Returns the number of IDs in the range.
+  size_type size() const { return fLast - fFirst; }
+
+  /// Returns whether the range has no ID.
+  bool empty() const { return fFirst == fLast; }
+
+  /// Returns the `i`-th ID in the range (not checked).
+  ID_t operator[](index_type i) const { return fMapper->ID(fFirst + i); }
+
+  /// Returns the range of the IDs from the `first`-th to the `last`-th (excluded).
+  FlatGeoIDrange subrange(index_type first, index_type last) const
+  {
+    return {*fMapper, fFirst + std::min(first, size()), fFirst + std::min(last, size())};
+  }
+
+private:
+  Mapper const* fMapper; ///< The mapping.
+  index_type fFirst;     ///< Flat index of the first ID.
+  index_type fLast;      ///< Flat index past the last ID.
+
+}; // geo::FlatGeoIDrange<>
+
 /// @}
 // --- END Geometry ID mappers -------------------------------------------------
 //------------------------------------------------------------------------------
@@ -413,6 +1022,7 @@ geo::GeoIDmapper<IDType, Index>::GeoIDmapper(std::initializer_list<unsigned int>
   : fN(details::initializerListToArray<dimensions()>(dims))
 {
   assert(dims.size() == dimensions()); // can't be static
+  updateDividers();
 }
 
 //------------------------------------------------------------------------------
@@ -512,6 +1122,7 @@ template <typename IDType, typename Index>
 void geo::GeoIDmapper<IDType, Index>::resize(std::initializer_list<unsigned int> dims)
 {
   fN = details::initializerListToArray<dimensions()>(dims);
+  updateDividers();
 } // geo::GeoIDmapper<>::resize()
 
 //------------------------------------------------------------------------------
@@ -527,6 +1138,7 @@ template <typename IDType, typename Index>
 void geo::GeoIDmapper<IDType, Index>::clear()
 {
   fN.fill(0U);
+  fDividers.fill(details::FastDivider{});
 } // geo::GeoIDmapper<>::clear()
 
 //------------------------------------------------------------------------------
@@ -551,8 +1163,9 @@ void geo::GeoIDmapper<IDType, Index>::fillID(GeoID& id, index_type index) const
     id.setValidity(index < fN[0U]);
   }
   else {
-    id.template writeIndex<Level>() = index % fN[Level];
-    fillID<(Level - 1U)>(id, index / fN[Level]);
+    index_type const parentIndex = fDividers[Level].quotient(index);
+    id.template writeIndex<Level>() = index - parentIndex * fN[Level];
+    fillID<(Level - 1U)>(id, parentIndex);
   }
 } // geo::GeoIDmapper<>::fillID()
 
@@ -568,6 +1181,15 @@ bool geo::GeoIDmapper<IDType, Index>::hasElementLevel(GeoID const& id) const
     return hasElementLevel<(Level - 1U)>(id);
 } // geo::GeoIDmapper<>::hasElementLevel()
 
+//------------------------------------------------------------------------------
+template <typename IDType, typename Index>
+void geo::GeoIDmapper<IDType, Index>::updateDividers()
+{
+  // a level with no elements has no valid index: any divisor will do
+  for (std::size_t level = 1U; level < dimensions(); ++level)
+    fDividers[level] = details::FastDivider{(fN[level] > 0U) ? fN[level] : 1U};
+} // geo::GeoIDmapper<>::updateDividers()
+
 //------------------------------------------------------------------------------
 template <typename IDType, typename Index>
 auto geo::GeoIDmapper<IDType, Index>::computeSize() const -> index_type
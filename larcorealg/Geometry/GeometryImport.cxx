@@ -0,0 +1,101 @@
+/**
+ * @file   larcorealg/Geometry/GeometryImport.cxx
+ * @brief  Import of the ROOT geometry shared by the geometry service providers.
+ * @date   October 14, 2026
+ * @see    larcorealg/Geometry/GeometryImport.h
+ */
+
+// library header
+#include "larcorealg/Geometry/GeometryImport.h"
+
+// LArSoft libraries
+#include "larcorealg/Geometry/AuxDetGeometryCore.h"
+#include "larcorealg/Geometry/ChannelMapAlg.h"
+#include "larcorealg/Geometry/GeometryCore.h"
+
+// Framework includes
+#include "cetlib_except/exception.h"
+
+// ROOT includes
+#include <TGeoManager.h>
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <mutex>
+#include <utility> // std::move()
+
+//------------------------------------------------------------------------------
+TGeoNode const* geo::ImportROOTGeometry(std::string const& rootfile, bool bForceReload)
+{
+  // TGeoManager::Import() works on a global and is not thread-safe
+  static std::mutex importMutex;
+  std::lock_guard<std::mutex> const lock{importMutex};
+
+  // Open the GDML file, and convert it into ROOT TGeoManager format.
+  // Then lock the gGeoManager to prevent future imports, for example
+  // in AuxDetGeometry
+  if (!gGeoManager || bForceReload) {
+    if (gGeoManager)
+      TGeoManager::UnlockGeometry();
+    else { // very first time (or so it should)
+      // [20210630, petrillo@slac.stanford.edu]
+      // ROOT 6.22.08 allows us to choose the representation of lengths
+      // in the geometry objects parsed from GDML.
+      // In LArSoft we want them to be centimeters (ROOT standard).
+      // This was tracked as Redmine issue #25990, and I leave this mark
+      // because I feel that we'll be back to it not too far in the future.
+      // Despite the documentation (ROOT 6.22/08),
+      // it seems the units are locked from the beginning,
+      // so we unlock without prejudice.
+      TGeoManager::LockDefaultUnits(false);
+      TGeoManager::SetDefaultUnits(TGeoManager::kRootUnits);
+      TGeoManager::LockDefaultUnits(true);
+    }
+    TGeoManager::Import(rootfile.c_str());
+    if (!gGeoManager) {
+      throw cet::exception("GeometryImport")
+        << "Failed to import the geometry from '" << rootfile << "'\n";
+    }
+    gGeoManager->LockGeometry();
+  }
+
+  return gGeoManager->GetTopNode();
+} // geo::ImportROOTGeometry()
+
+//------------------------------------------------------------------------------
+void geo::LoadGeometries(geo::GeometryCore& geom,
+                         geo::AuxDetGeometryCore& auxDetGeom,
+                         std::string const& gdmlfile,
+                         std::string const& rootfile,
+                         geo::TaskRunner_t const& runner,
+                         bool bForceReload)
+{
+  TGeoNode const* topNode = ImportROOTGeometry(rootfile, bForceReload);
+
+  geo::runTasks(runner, 2U, [&](std::size_t i) {
+    if (i == 0)
+      geom.LoadImportedGeometry(gdmlfile, rootfile, topNode);
+    else
+      auxDetGeom.LoadImportedGeometry(gdmlfile, rootfile, topNode);
+  });
+} // geo::LoadGeometries()
+
+//------------------------------------------------------------------------------
+geo::GeometryLoadHandle geo::LoadGeometryAsync(geo::GeometryCore& geom,
+                                               std::string gdmlfile,
+                                               std::string rootfile,
+                                               std::unique_ptr<geo::ChannelMapAlg> channelMap,
+                                               bool bForceReload)
+{
+  auto load = [&geom,
+               gdmlfile = std::move(gdmlfile),
+               rootfile = std::move(rootfile),
+               channelMap = std::move(channelMap),
+               bForceReload]() mutable {
+    geom.LoadGeometryFile(gdmlfile, rootfile, bForceReload);
+    if (channelMap) geom.ApplyChannelMap(std::move(channelMap));
+  };
+  return {geom, std::async(std::launch::async, std::move(load)).share()};
+} // geo::LoadGeometryAsync()
+
+//------------------------------------------------------------------------------
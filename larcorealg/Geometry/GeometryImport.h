@@ -0,0 +1,160 @@
+/**
+ * @file   larcorealg/Geometry/GeometryImport.h
+ * @brief  Import of the ROOT geometry shared by the geometry service providers.
+ * @date   October 14, 2026
+ * @see    larcorealg/Geometry/GeometryImport.cxx
+ * @ingroup Geometry
+ */
+
+#ifndef LARCOREALG_GEOMETRY_GEOMETRYIMPORT_H
+#define LARCOREALG_GEOMETRY_GEOMETRYIMPORT_H
+
+// LArSoft libraries
+#include "larcorealg/Geometry/TaskRunner.h"
+
+// C/C++ standard libraries
+#include <chrono>
+#include <future>
+#include <memory> // std::unique_ptr<>
+#include <string>
+
+// ROOT class prototypes
+class TGeoNode;
+
+namespace geo {
+
+  class AuxDetGeometryCore;
+  class ChannelMapAlg;
+  class GeometryCore;
+
+  /**
+   * @brief Imports the ROOT geometry from `rootfile`, unless already available.
+   * @param rootfile path of the file to be imported into `gGeoManager`
+   * @param bForceReload import the file even if there is already a geometry
+   * @return the top node of the imported geometry
+   * @throw cet::exception (category `"GeometryImport"`) if import fails
+   *
+   * The geometry is imported into the global `gGeoManager` in ROOT units
+   * (centimeters), which is then locked to prevent further imports.
+   * If a geometry is already present and `bForceReload` is `false`, nothing
+   * is imported and its top node is returned. Calls from different threads
+   * are serialized, so that the tree is imported only once.
+   *
+   * The returned tree is not modified any further and it can be read
+   * concurrently, e.g. by `geo::GeometryCore::LoadImportedGeometry()` and
+   * `geo::AuxDetGeometryCore::LoadImportedGeometry()`.
+   */
+  TGeoNode const* ImportROOTGeometry(std::string const& rootfile, bool bForceReload = false);
+
+  /**
+   * @brief Loads the geometry of both `geom` and `auxDetGeom` from one import.
+   * @param geom the main geometry to be loaded
+   * @param auxDetGeom the auxiliary detector geometry to be loaded
+   * @param gdmlfile path to file to be used for Geant4 simulation
+   * @param rootfile path to file for internal geometry representation
+   * @param runner runs the two builders concurrently (empty: one after the other)
+   * @param bForceReload reload even if there is already a valid geometry
+   * @see `ImportROOTGeometry()`
+   *
+   * The ROOT geometry is imported once with `ImportROOTGeometry()`, and then
+   * the two geometries are built from it as two tasks of `runner`, with the
+   * builders configured in each of them.
+   * The channel mappings still need to be applied to both of them afterwards.
+   */
+  void LoadGeometries(geo::GeometryCore& geom,
+                      geo::AuxDetGeometryCore& auxDetGeom,
+                      std::string const& gdmlfile,
+                      std::string const& rootfile,
+                      geo::TaskRunner_t const& runner,
+                      bool bForceReload = false);
+
+  /**
+   * @brief Handle to a geometry being loaded in the background.
+   * @see `LoadGeometryAsync()`
+   *
+   * The handle gives access to the geometry, waiting for the load to complete
+   * on the first access. If the load failed, every access rethrows its
+   * exception. Copies of the handle refer to the same load.
+   * The last handle of a load waits for it to complete when destroyed.
+   */
+  class GeometryLoadHandle {
+
+  public:
+    /// Creates a handle not associated to any load.
+    GeometryLoadHandle() = default;
+
+    /// Creates a handle to `geom`, loaded when `loaded` is ready.
+    GeometryLoadHandle(geo::GeometryCore& geom, std::shared_future<void> loaded)
+      : fGeom{&geom}, fLoaded{std::move(loaded)}
+    {}
+
+    /// Returns whether this handle is associated to a load.
+    bool valid() const { return fLoaded.valid(); }
+
+    /// Returns whether the load is complete (successfully or not); does not wait.
+    bool ready() const
+    {
+      return valid() &&
+             (fLoaded.wait_for(std::chrono::seconds{0}) == std::future_status::ready);
+    }
+
+    /// Waits for the load to complete; rethrows its exception if it failed.
+    void wait() const { fLoaded.get(); }
+
+    /// Returns the geometry, waiting for the load to complete.
+    geo::GeometryCore& get() const
+    {
+      wait();
+      return *fGeom;
+    }
+
+    /// Access to the geometry, waiting for the load to complete.
+    geo::GeometryCore* operator->() const { return &get(); }
+
+    /// Access to the geometry, waiting for the load to complete.
+    geo::GeometryCore& operator*() const { return get(); }
+
+  private:
+    geo::GeometryCore* fGeom = nullptr; ///< The geometry being loaded.
+    std::shared_future<void> fLoaded;   ///< Completion of the load.
+
+  }; // class GeometryLoadHandle
+
+  /**
+   * @brief Loads the geometry on a background thread.
+   * @param geom the geometry to be loaded
+   * @param gdmlfile path to file to be used for Geant4 simulation
+   * @param rootfile path to file for internal geometry representation
+   * @param channelMap channel mapping to be applied after the load (optional)
+   * @param bForceReload reload even if there is already a valid geometry
+   * @return a handle to access the geometry once loaded
+   * @see `geo::GeometryCore::LoadGeometryFile()`
+   *
+   * `geom.LoadGeometryFile()` and, if `channelMap` is provided,
+   * `geom.ApplyChannelMap()` are executed on a new thread, and this function
+   * returns immediately. The caller can set up other services meanwhile, and
+   * use the returned handle to access the geometry: it waits only on the first
+   * access, if the load is not complete yet.
+   *
+   * The ROOT geometry is imported with `ImportROOTGeometry()`, so that other
+   * imports are serialized with this one; `gGeoManager` and `geom` must not be
+   * used by other means until the load is complete (`GeometryLoadHandle::ready()`).
+   * `geom` must outlive the load.
+   *
+   * Example:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * geo::GeometryLoadHandle const geomHandle = geo::LoadGeometryAsync(
+   *   geom, gdmlPath, rootPath, std::make_unique<geo::ChannelMapStandardAlg>(sortingPars));
+   * // ... set up other services ...
+   * std::cout << "Detector has " << geomHandle->Nchannels() << " channels" << std::endl;
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   */
+  GeometryLoadHandle LoadGeometryAsync(geo::GeometryCore& geom,
+                                       std::string gdmlfile,
+                                       std::string rootfile,
+                                       std::unique_ptr<geo::ChannelMapAlg> channelMap = nullptr,
+                                       bool bForceReload = false);
+
+} // namespace geo
+
+#endif // LARCOREALG_GEOMETRY_GEOMETRYIMPORT_H
@@ -0,0 +1,179 @@
+/**
+ * @file   larcorealg/Geometry/GeometryLoadReport.h
+ * @brief  Time spent in each phase of the geometry loading, and object counts.
+ * @date   October 14, 2026
+ * @see    `geo::GeometryCore::LoadReport()`
+ *
+ * This is a header only library.
+ */
+
+#ifndef LARCOREALG_GEOMETRY_GEOMETRYLOADREPORT_H
+#define LARCOREALG_GEOMETRY_GEOMETRYLOADREPORT_H
+
+// C/C++ standard libraries
+#include <algorithm> // std::max()
+#include <chrono>
+#include <cstddef> // std::size_t
+#include <iomanip> // std::setw(), std::setprecision()
+#include <ios>     // std::fixed
+#include <string>
+#include <vector>
+
+namespace geo {
+
+  /**
+   * @brief Duration of the phases of the geometry loading and objects built.
+   * @see `geo::GeometryCore::LoadReport()`
+   *
+   * The report lists phases (like the import of the ROOT geometry, or the
+   * sorting of the geometry objects) with their wall clock time, in the order
+   * they were first recorded, and the number of objects of each type (like
+   * TPCs or channels). Adding to an existing phase accumulates its time.
+   * Example:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * geo::GeometryLoadReport report;
+   * auto const start = geo::GeometryLoadReport::Clock_t::now();
+   * std::vector<geo::CryostatGeo> cryostats = builder.extractCryostats(path);
+   * report.addPhase("BuildCryostats", start);
+   * report.setCount("Cryostats", cryostats.size());
+   * report.print(std::cout);
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   */
+  class GeometryLoadReport {
+  public:
+    /// Clock used to time the phases.
+    using Clock_t = std::chrono::steady_clock;
+
+    /// A phase of the loading.
+    struct Phase_t {
+      std::string name;     ///< Name of the phase.
+      double seconds = 0.0; ///< Time spent in the phase [s]
+    };
+
+    /// Number of objects of a type.
+    struct Count_t {
+      std::string name;       ///< Name of the type of object.
+      std::size_t count = 0U; ///< Number of objects.
+    };
+
+    /// Adds `seconds` to the time of the phase `name`.
+    void addPhase(std::string const& name, double seconds)
+    {
+      fetch(fPhases, name).seconds += seconds;
+    }
+
+    /// Adds the time elapsed since `start` to the phase `name`.
+    void addPhase(std::string const& name, Clock_t::time_point start)
+    {
+      addPhase(name, std::chrono::duration<double>{Clock_t::now() - start}.count());
+    }
+
+    /// Sets the number of objects of type `name` to `count`.
+    void setCount(std::string const& name, std::size_t count) { fetch(fCounts, name).count = count; }
+
+    /// Returns all the phases, in the order they were first added.
+    std::vector<Phase_t> const& phases() const { return fPhases; }
+
+    /// Returns all the object counts, in the order they were first added.
+    std::vector<Count_t> const& counts() const { return fCounts; }
+
+    /// Returns the time spent in the phase `name` [s] (`0` if not present).
+    double seconds(std::string const& name) const
+    {
+      Phase_t const* phase = find(fPhases, name);
+      return phase ? phase->seconds : 0.0;
+    }
+
+    /// Returns the number of objects of type `name` (`0` if not present).
+    std::size_t count(std::string const& name) const
+    {
+      Count_t const* count = find(fCounts, name);
+      return count ? count->count : 0U;
+    }
+
+    /// Returns the total time of all the phases [s]
+    double totalSeconds() const
+    {
+      double total = 0.0;
+      for (Phase_t const& phase : fPhases)
+        total += phase.seconds;
+      return total;
+    }
+
+    /// Returns whether no phase nor count has been recorded.
+    bool empty() const { return fPhases.empty() && fCounts.empty(); }
+
+    /// Removes all the phases and counts.
+    void clear()
+    {
+      fPhases.clear();
+      fCounts.clear();
+    }
+
+    /// Prints a table of the phases, and one of the counts, into `out`.
+    template <typename Stream>
+    void print(Stream&& out, std::string const& indent = "") const;
+
+  private:
+    std::vector<Phase_t> fPhases; ///< All the phases.
+    std::vector<Count_t> fCounts; ///< All the object counts.
+
+    /// Returns the element `name` of `list` (`nullptr` if not present).
+    template <typename T>
+    static T const* find(std::vector<T> const& list, std::string const& name)
+    {
+      for (T const& item : list)
+        if (item.name == name) return &item;
+      return nullptr;
+    }
+
+    /// Returns the element `name` of `list`, creating it if needed.
+    template <typename T>
+    static T& fetch(std::vector<T>& list, std::string const& name)
+    {
+      for (T& item : list)
+        if (item.name == name) return item;
+      list.push_back(T{name});
+      return list.back();
+    }
+
+  }; // class GeometryLoadReport
+
+} // namespace geo
+
+//------------------------------------------------------------------------------
+//--- template implementation
+//------------------------------------------------------------------------------
+template <typename Stream>
+void geo::GeometryLoadReport::print(Stream&& out, std::string const& indent /* = "" */) const
+{
+  std::size_t nameWidth = 6U;
+  for (Phase_t const& phase : fPhases)
+    nameWidth = std::max(nameWidth, phase.name.length());
+  for (Count_t const& count : fCounts)
+    nameWidth = std::max(nameWidth, count.name.length());
+
+  out << indent << std::left << std::setw(nameWidth) << "phase" << std::right << std::setw(12)
+      << "time [ms]";
+  for (Phase_t const& phase : fPhases) {
+    out << "\n"
+        << indent << std::left << std::setw(nameWidth) << phase.name << std::right
+        << std::setw(12) << std::fixed << std::setprecision(1) << (phase.seconds * 1000.0);
+  }
+  out << "\n"
+      << indent << std::left << std::setw(nameWidth) << "total" << std::right << std::setw(12)
+      << std::fixed << std::setprecision(1) << (totalSeconds() * 1000.0);
+  if (fCounts.empty()) return;
+
+  out << "\n" << indent << std::left << std::setw(nameWidth) << "object" << std::right
+      << std::setw(12) << "count";
+  for (Count_t const& count : fCounts) {
+    out << "\n"
+        << indent << std::left << std::setw(nameWidth) << count.name << std::right
+        << std::setw(12) << count.count;
+  }
+} // geo::GeometryLoadReport::print()
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREALG_GEOMETRY_GEOMETRYLOADREPORT_H
@@ -0,0 +1,414 @@
+/**
+ * @file   larcorealg/Geometry/GeometryQueryRecorder.cxx
+ * @brief  Recording of geometry queries into a binary file, and their replay.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/GeometryQueryRecorder.h`
+ */
+
+// LArSoft libraries
+#include "larcorealg/Geometry/GeometryQueryRecorder.h"
+#include "larcorealg/Geometry/GeometryCore.h"
+
+// framework libraries
+#include "cetlib_except/exception.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::max()
+#include <cmath>     // std::llround()
+#include <cstring>   // std::memcpy(), std::memcmp()
+#include <exception> // std::exception
+#include <iterator>  // std::istreambuf_iterator
+#include <numeric>   // std::accumulate()
+#include <utility>   // std::move()
+
+namespace {
+
+  using Kind_t = geo::RecordedQuery_t::Kind_t;
+
+  /// Which arguments each kind of query has.
+  struct Arguments_t {
+    bool point = false;         ///< Whether there is a position.
+    unsigned int planeIDs = 0U; ///< Numbers of the plane ID stored (`2`: TPC).
+    bool wires = false;         ///< Whether there are two wire IDs.
+    bool channel = false;       ///< Whether there is a channel.
+  };
+
+  /// Returns the arguments of the queries of type `kind`.
+  Arguments_t arguments(Kind_t kind)
+  {
+    switch (kind) {
+    case Kind_t::NearestWireID:
+    case Kind_t::TryNearestWireID:
+    case Kind_t::NearestWireIDinTPC: return {true, 3U, false, false};
+    case Kind_t::FindTPCAtPosition: return {true, 0U, false, false};
+    case Kind_t::FindTPCAtPositionWithHint: return {true, 2U, false, false};
+    case Kind_t::ChannelToWire:
+    case Kind_t::ChannelToWireIDs: return {false, 0U, false, true};
+    case Kind_t::WireIDsIntersect: return {false, 0U, true, false};
+    case Kind_t::NKinds: break;
+    } // switch
+    return {};
+  } // arguments()
+
+  /// Bits of the validity byte of a record.
+  enum : std::uint8_t { PlaneValid = 0x1, Wire1Valid = 0x2, Wire2Valid = 0x4 };
+
+  /// Appends the bytes of `value` to `buffer`.
+  template <typename T>
+  void put(std::vector<char>& buffer, T const& value)
+  {
+    char bytes[sizeof(T)];
+    std::memcpy(bytes, &value, sizeof(T));
+    buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+  }
+
+  /// Appends the numbers of `wire` to `buffer`.
+  void putWire(std::vector<char>& buffer, geo::WireID const& wire)
+  {
+    put<std::uint32_t>(buffer, wire.Cryostat);
+    put<std::uint32_t>(buffer, wire.TPC);
+    put<std::uint32_t>(buffer, wire.Plane);
+    put<std::uint32_t>(buffer, wire.Wire);
+  }
+
+  /// Reads the records from a memory block.
+  class RecordReader {
+  public:
+    RecordReader(char const* begin, char const* end) : fPos{begin}, fEnd{end} {}
+
+    bool atEnd() const { return fPos == fEnd; }
+
+    template <typename T>
+    T get()
+    {
+      if (static_cast<std::size_t>(fEnd - fPos) < sizeof(T)) {
+        throw cet::exception("GeometryQueryRecorder")
+          << "readRecordedQueries(): the last record is truncated.\n";
+      }
+      T value;
+      std::memcpy(&value, fPos, sizeof(T));
+      fPos += sizeof(T);
+      return value;
+    }
+
+    geo::WireID getWire(bool valid)
+    {
+      auto const c = get<std::uint32_t>();
+      auto const t = get<std::uint32_t>();
+      auto const p = get<std::uint32_t>();
+      auto const w = get<std::uint32_t>();
+      geo::WireID wire{c, t, p, w};
+      wire.setValidity(valid);
+      return wire;
+    }
+
+  private:
+    char const* fPos;
+    char const* const fEnd;
+  };
+
+  /// Hash of the results of the replayed queries (FNV-1a on 64-bit words).
+  class Checksum {
+  public:
+    void add(std::uint64_t value) { fHash = (fHash ^ value) * 0x100000001b3ULL; }
+
+    void add(geo::CryostatID const& id)
+    {
+      add(id.isValid);
+      add(id.Cryostat);
+    }
+    void add(geo::TPCID const& id)
+    {
+      add(static_cast<geo::CryostatID const&>(id));
+      add(id.TPC);
+    }
+    void add(geo::PlaneID const& id)
+    {
+      add(static_cast<geo::TPCID const&>(id));
+      add(id.Plane);
+    }
+    void add(geo::WireID const& id)
+    {
+      add(static_cast<geo::PlaneID const&>(id));
+      add(id.Wire);
+    }
+
+    /// Adds the position rounded to 10 micrometers.
+    void add(geo::Point_t const& point)
+    {
+      for (double const coord : {point.X(), point.Y(), point.Z()})
+        add(static_cast<std::uint64_t>(std::llround(coord * 1000.0)));
+    }
+
+    std::uint64_t value() const { return fHash; }
+
+  private:
+    std::uint64_t fHash = 0xcbf29ce484222325ULL;
+  };
+
+} // local namespace
+
+//------------------------------------------------------------------------------
+//--- geo::RecordedQuery_t
+//------------------------------------------------------------------------------
+std::string geo::RecordedQuery_t::kindName(Kind_t kind)
+{
+  switch (kind) {
+  case Kind_t::NearestWireID: return "NearestWireID";
+  case Kind_t::TryNearestWireID: return "TryNearestWireID";
+  case Kind_t::NearestWireIDinTPC: return "NearestWireIDinTPC";
+  case Kind_t::FindTPCAtPosition: return "FindTPCAtPosition";
+  case Kind_t::FindTPCAtPositionWithHint: return "FindTPCAtPositionWithHint";
+  case Kind_t::ChannelToWire: return "ChannelToWire";
+  case Kind_t::ChannelToWireIDs: return "ChannelToWireIDs";
+  case Kind_t::WireIDsIntersect: return "WireIDsIntersect";
+  case Kind_t::NKinds: break;
+  } // switch
+  return "<unknown>";
+} // geo::RecordedQuery_t::kindName()
+
+//------------------------------------------------------------------------------
+//--- geo::GeometryQueryRecorder
+//------------------------------------------------------------------------------
+geo::GeometryQueryRecorder::GeometryQueryRecorder(std::string path, Config_t const& config)
+  : fPath{std::move(path)}, fConfig{config}, fOut{fPath, std::ios::binary | std::ios::trunc}
+{
+  if (!fOut) {
+    throw cet::exception("GeometryQueryRecorder")
+      << "Can't open the file '" << fPath << "' to record the geometry queries.\n";
+  }
+  writeHeader(); // rewritten at the end, with the final fingerprint
+  fBuffer.reserve(BufferSize);
+} // geo::GeometryQueryRecorder::GeometryQueryRecorder()
+
+//------------------------------------------------------------------------------
+geo::GeometryQueryRecorder::GeometryQueryRecorder(std::string path)
+  : GeometryQueryRecorder{std::move(path), Config_t{}}
+{}
+
+//------------------------------------------------------------------------------
+geo::GeometryQueryRecorder::~GeometryQueryRecorder()
+{
+  std::lock_guard const lock{fLock};
+  writeBuffer();
+  fOut.seekp(0);
+  writeHeader();
+} // geo::GeometryQueryRecorder::~GeometryQueryRecorder()
+
+//------------------------------------------------------------------------------
+void geo::GeometryQueryRecorder::flush()
+{
+  std::lock_guard const lock{fLock};
+  writeBuffer();
+  fOut.flush();
+} // geo::GeometryQueryRecorder::flush()
+
+//------------------------------------------------------------------------------
+std::uint64_t geo::GeometryQueryRecorder::recordedQueries() const
+{
+  std::lock_guard const lock{fLock};
+  return fRecorded;
+} // geo::GeometryQueryRecorder::recordedQueries()
+
+//------------------------------------------------------------------------------
+void geo::GeometryQueryRecorder::store(RecordedQuery_t const& query)
+{
+  Arguments_t const args = arguments(query.kind);
+
+  std::lock_guard const lock{fLock};
+  if ((fConfig.maxQueries > 0U) && (fRecorded >= fConfig.maxQueries)) return;
+
+  std::uint8_t valid = 0U;
+  if (query.plane.isValid) valid |= PlaneValid;
+  if (query.wire1.isValid) valid |= Wire1Valid;
+  if (query.wire2.isValid) valid |= Wire2Valid;
+  put(fBuffer, static_cast<std::uint8_t>(query.kind));
+  put(fBuffer, valid);
+  if (args.point) {
+    put(fBuffer, query.point.X());
+    put(fBuffer, query.point.Y());
+    put(fBuffer, query.point.Z());
+  }
+  if (args.planeIDs > 0U) put<std::uint32_t>(fBuffer, query.plane.Cryostat);
+  if (args.planeIDs > 1U) put<std::uint32_t>(fBuffer, query.plane.TPC);
+  if (args.planeIDs > 2U) put<std::uint32_t>(fBuffer, query.plane.Plane);
+  if (args.wires) {
+    putWire(fBuffer, query.wire1);
+    putWire(fBuffer, query.wire2);
+  }
+  if (args.channel) put<std::uint32_t>(fBuffer, query.channel);
+  ++fRecorded;
+
+  if (fBuffer.size() >= BufferSize) writeBuffer();
+} // geo::GeometryQueryRecorder::store()
+
+//------------------------------------------------------------------------------
+void geo::GeometryQueryRecorder::writeBuffer()
+{
+  fOut.write(fBuffer.data(), fBuffer.size());
+  fBuffer.clear();
+} // geo::GeometryQueryRecorder::writeBuffer()
+
+//------------------------------------------------------------------------------
+void geo::GeometryQueryRecorder::writeHeader()
+{
+  details::QueryLogHeader header{}; // all zeroes
+  std::memcpy(header.magic, details::QueryLogHeader::Magic, sizeof(header.magic));
+  header.version = details::QueryLogHeader::Version;
+  header.byteOrder = details::QueryLogHeader::ByteOrder;
+  header.sampleEvery = std::max(fConfig.sampleEvery, 1U);
+  header.fingerprint = fFingerprint;
+  fOut.write(reinterpret_cast<char const*>(&header), sizeof(header));
+} // geo::GeometryQueryRecorder::writeHeader()
+
+//------------------------------------------------------------------------------
+//--- reading and replay
+//------------------------------------------------------------------------------
+geo::RecordedQueryLog_t geo::readRecordedQueries(std::string const& path)
+{
+  std::ifstream in{path, std::ios::binary};
+  if (!in) {
+    throw cet::exception("GeometryQueryRecorder")
+      << "readRecordedQueries(): can't open '" << path << "'.\n";
+  }
+  std::vector<char> const data{std::istreambuf_iterator<char>{in},
+                               std::istreambuf_iterator<char>{}};
+
+  details::QueryLogHeader header;
+  if (data.size() < sizeof(header)) {
+    throw cet::exception("GeometryQueryRecorder")
+      << "readRecordedQueries(): '" << path << "' is too short for a recording.\n";
+  }
+  std::memcpy(&header, data.data(), sizeof(header));
+  if (std::memcmp(header.magic, details::QueryLogHeader::Magic, sizeof(header.magic)) != 0) {
+    throw cet::exception("GeometryQueryRecorder")
+      << "readRecordedQueries(): '" << path << "' is not a geometry query recording.\n";
+  }
+  if (header.byteOrder != details::QueryLogHeader::ByteOrder) {
+    throw cet::exception("GeometryQueryRecorder")
+      << "readRecordedQueries(): '" << path << "' was written with a different byte order.\n";
+  }
+  if (header.version != details::QueryLogHeader::Version) {
+    throw cet::exception("GeometryQueryRecorder")
+      << "readRecordedQueries(): '" << path << "' has format version " << header.version
+      << ", only version " << details::QueryLogHeader::Version << " is supported.\n";
+  }
+
+  RecordedQueryLog_t log;
+  log.fingerprint = header.fingerprint;
+  log.sampleEvery = header.sampleEvery;
+
+  RecordReader reader{data.data() + sizeof(header), data.data() + data.size()};
+  while (!reader.atEnd()) {
+    RecordedQuery_t query;
+    auto const kind = reader.get<std::uint8_t>();
+    if (kind >= static_cast<std::uint8_t>(Kind_t::NKinds)) {
+      throw cet::exception("GeometryQueryRecorder")
+        << "readRecordedQueries(): invalid query type " << static_cast<unsigned int>(kind)
+        << " in record #" << log.queries.size() << " of '" << path << "'.\n";
+    }
+    query.kind = static_cast<Kind_t>(kind);
+    auto const valid = reader.get<std::uint8_t>();
+    Arguments_t const args = arguments(query.kind);
+    if (args.point) {
+      double const x = reader.get<double>();
+      double const y = reader.get<double>();
+      double const z = reader.get<double>();
+      query.point = {x, y, z};
+    }
+    if (args.planeIDs > 0U) query.plane.Cryostat = reader.get<std::uint32_t>();
+    if (args.planeIDs > 1U) query.plane.TPC = reader.get<std::uint32_t>();
+    if (args.planeIDs > 2U) query.plane.Plane = reader.get<std::uint32_t>();
+    query.plane.setValidity(valid & PlaneValid);
+    if (args.wires) {
+      query.wire1 = reader.getWire(valid & Wire1Valid);
+      query.wire2 = reader.getWire(valid & Wire2Valid);
+    }
+    if (args.channel) query.channel = reader.get<std::uint32_t>();
+    log.queries.push_back(query);
+  } // while
+
+  return log;
+} // geo::readRecordedQueries()
+
+//------------------------------------------------------------------------------
+std::uint64_t geo::QueryReplayResult_t::total() const
+{
+  return std::accumulate(calls.begin(), calls.end(), std::uint64_t{0U});
+}
+
+//------------------------------------------------------------------------------
+geo::QueryReplayResult_t geo::replayRecordedQueries(geo::GeometryCore const& geom,
+                                                    std::vector<RecordedQuery_t> const& queries)
+{
+  QueryReplayResult_t result;
+  Checksum checksum;
+
+  for (RecordedQuery_t const& query : queries) {
+    ++result.calls[static_cast<std::size_t>(query.kind)];
+    geo::TPCID const& tpcid = query.plane;
+    bool found = true;
+    try {
+      switch (query.kind) {
+      case Kind_t::NearestWireID: checksum.add(geom.NearestWireID(query.point, query.plane)); break;
+      case Kind_t::TryNearestWireID: {
+        auto const wire = geom.TryNearestWireID(query.point, query.plane);
+        found = wire.has_value();
+        if (found) checksum.add(*wire);
+        break;
+      }
+      case Kind_t::NearestWireIDinTPC: {
+        geo::WireID const wire = geom.NearestWireID(query.point, query.plane.Plane, tpcid);
+        found = wire.isValid;
+        checksum.add(wire);
+        break;
+      }
+      case Kind_t::FindTPCAtPosition: {
+        geo::TPCID const foundTPC = geom.FindTPCAtPosition(query.point);
+        found = foundTPC.isValid;
+        checksum.add(foundTPC);
+        break;
+      }
+      case Kind_t::FindTPCAtPositionWithHint: {
+        geo::TPCID const foundTPC = geom.FindTPCAtPosition(query.point, tpcid);
+        found = foundTPC.isValid;
+        checksum.add(foundTPC);
+        break;
+      }
+      case Kind_t::ChannelToWire: {
+        std::vector<geo::WireID> const wires = geom.ChannelToWire(query.channel);
+        found = !wires.empty();
+        for (geo::WireID const& wire : wires)
+          checksum.add(wire);
+        break;
+      }
+      case Kind_t::ChannelToWireIDs: {
+        auto const wires = geom.ChannelToWireIDs(query.channel);
+        found = !wires.empty();
+        for (geo::WireID const& wire : wires)
+          checksum.add(wire);
+        break;
+      }
+      case Kind_t::WireIDsIntersect: {
+        geo::Point_t intersection;
+        found = geom.WireIDsIntersect(query.wire1, query.wire2, intersection);
+        checksum.add(found);
+        if (found) checksum.add(intersection);
+        break;
+      }
+      case Kind_t::NKinds: break;
+      } // switch
+    }
+    catch (std::exception const&) {
+      ++result.throws;
+      checksum.add(0xdeadU);
+      continue;
+    }
+    if (!found) ++result.misses;
+  } // for
+
+  result.checksum = checksum.value();
+  return result;
+} // geo::replayRecordedQueries()
+
+//------------------------------------------------------------------------------
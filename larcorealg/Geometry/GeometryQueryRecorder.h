@@ -0,0 +1,237 @@
+/**
+ * @file   larcorealg/Geometry/GeometryQueryRecorder.h
+ * @brief  Recording of geometry queries into a binary file, and their replay.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/GeometryQueryRecorder.cxx`
+ * @ingroup Geometry
+ *
+ * A `geo::GeometryQueryRecorder` enabled in `geo::GeometryCore` (see
+ * `geo::GeometryCore::EnableQueryRecording()`) writes the arguments of the
+ * most used queries into a file while a job runs:
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * geo::GeometryQueryRecorder::Config_t config;
+ * config.sampleEvery = 10U; // one query every ten
+ * geom.EnableQueryRecording("queries.geoq", config);
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * The file can then be read (`geo::readRecordedQueries()`) and the same
+ * queries, in the same order, run again on any geometry with
+ * `geo::replayRecordedQueries()`, e.g. by the `geometry_replay_benchmark`
+ * test program, to compare implementations on a production workload.
+ *
+ * The file is a 32-byte header (`geo::details::QueryLogHeader`) followed by
+ * one record per query: a byte with the kind of query (`Kind_t`), a byte
+ * with the validity of its IDs, and then only the arguments of that kind of
+ * query (the position as three `double`, the ID numbers and the channel as
+ * 32-bit integers). Everything is in the byte order of the writer; files
+ * from a machine with the other byte order are rejected.
+ */
+
+#ifndef LARCOREALG_GEOMETRY_GEOMETRYQUERYRECORDER_H
+#define LARCOREALG_GEOMETRY_GEOMETRYQUERYRECORDER_H
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/RawTypes.h" // raw::ChannelID_t
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+#include "larcoreobj/SimpleTypesAndConstants/geo_vectors.h"
+
+// C/C++ standard libraries
+#include <array>
+#include <atomic>
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint8_t, std::uint32_t, std::uint64_t
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace geo {
+
+  class GeometryCore;
+
+  /// A single recorded geometry query, with its arguments.
+  struct RecordedQuery_t {
+
+    /// The queries which can be recorded; overloads are recorded together.
+    enum class Kind_t : std::uint8_t {
+      NearestWireID,             ///< `NearestWireID(point, plane)`
+      TryNearestWireID,          ///< `TryNearestWireID(point, plane)`
+      NearestWireIDinTPC,        ///< `NearestWireID(point, plane.Plane, plane)`
+      FindTPCAtPosition,         ///< `FindTPCAtPosition(point)`
+      FindTPCAtPositionWithHint, ///< `FindTPCAtPosition(point, plane)`
+      ChannelToWire,             ///< `ChannelToWire(channel)`
+      ChannelToWireIDs,          ///< `ChannelToWireIDs(channel)`
+      WireIDsIntersect,          ///< `WireIDsIntersect(wire1, wire2, ...)`
+      NKinds                     ///< Number of kinds of query.
+    }; // Kind_t
+
+    Kind_t kind = Kind_t::NKinds; ///< Which query.
+    geo::Point_t point;           ///< Position argument [cm]
+    geo::PlaneID plane;           ///< Plane, or TPC hint (plane number unused).
+    geo::WireID wire1;            ///< First wire of `WireIDsIntersect`.
+    geo::WireID wire2;            ///< Second wire of `WireIDsIntersect`.
+    raw::ChannelID_t channel = raw::InvalidChannelID; ///< Channel argument.
+
+    /// Returns the name of the query `kind`.
+    static std::string kindName(Kind_t kind);
+
+  }; // RecordedQuery_t
+
+  /**
+   * @brief Writes geometry queries into a binary file.
+   * @see `larcorealg/Geometry/GeometryQueryRecorder.h`
+   *
+   * The recorder samples one query every `Config_t::sampleEvery` (all of them
+   * with the default `1`), up to `Config_t::maxQueries`. Recording is
+   * thread-safe: the sampling decision is a relaxed atomic counter, and the
+   * sampled queries are added to a buffer under a lock, which is written into
+   * the file when full and on destruction.
+   * The order of queries from concurrent threads is the one of their
+   * recording.
+   */
+  class GeometryQueryRecorder {
+  public:
+    /// Configuration of the recorder.
+    struct Config_t {
+      unsigned int sampleEvery = 1U; ///< Record one query every this many.
+      std::uint64_t maxQueries = 0U; ///< Maximum recorded queries (`0`: no limit).
+    }; // Config_t
+
+    /// Size of the buffer of records written at once [bytes]
+    static constexpr std::size_t BufferSize = 64U * 1024U;
+
+    /**
+     * @brief Creates the file `path` and starts recording.
+     * @param path the file to be written (overwritten if existing)
+     * @param config the sampling of the recording
+     * @throw cet::exception (category `GeometryQueryRecorder`) if the file can't
+     *        be written
+     */
+    GeometryQueryRecorder(std::string path, Config_t const& config);
+
+    /// Creates the file `path` and records all the queries.
+    explicit GeometryQueryRecorder(std::string path);
+
+    /// Writes the remaining queries and closes the file.
+    ~GeometryQueryRecorder();
+
+    GeometryQueryRecorder(GeometryQueryRecorder const&) = delete;
+    GeometryQueryRecorder& operator=(GeometryQueryRecorder const&) = delete;
+
+    /// Records `query`, if sampled.
+    void record(RecordedQuery_t const& query)
+    {
+      if (!sampled()) return;
+      store(query);
+    }
+
+    /// Sets the fingerprint of the geometry, written in the file header.
+    void setGeometryFingerprint(std::uint64_t fingerprint) { fFingerprint = fingerprint; }
+
+    /// Writes the buffered queries into the file.
+    void flush();
+
+    /// Returns the path of the file being written.
+    std::string const& path() const { return fPath; }
+
+    /// Returns the number of queries seen (sampled or not).
+    std::uint64_t seenQueries() const { return fSeen.load(std::memory_order_relaxed); }
+
+    /// Returns the number of queries recorded so far.
+    std::uint64_t recordedQueries() const;
+
+  private:
+    std::string const fPath;   ///< Path of the output file.
+    Config_t const fConfig;    ///< Sampling configuration.
+    std::ofstream fOut;        ///< The output file.
+    std::uint64_t fFingerprint = 0U; ///< Fingerprint of the recorded geometry.
+
+    std::atomic<std::uint64_t> fSeen{0U}; ///< Number of queries seen.
+
+    mutable std::mutex fLock;     ///< Protects the buffer and the counts.
+    std::vector<char> fBuffer;    ///< Records not written yet.
+    std::uint64_t fRecorded = 0U; ///< Number of queries recorded.
+
+    /// Returns whether the current query is to be recorded.
+    bool sampled()
+    {
+      std::uint64_t const n = fSeen.fetch_add(1U, std::memory_order_relaxed);
+      return (fConfig.sampleEvery <= 1U) || (n % fConfig.sampleEvery == 0U);
+    }
+
+    /// Adds `query` to the buffer.
+    void store(RecordedQuery_t const& query);
+
+    /// Writes the buffer into the file; the lock must be held.
+    void writeBuffer();
+
+    /// Writes the header at the start of the file.
+    void writeHeader();
+
+  }; // class GeometryQueryRecorder
+
+  /// Content of a recorded query file.
+  struct RecordedQueryLog_t {
+    std::uint64_t fingerprint = 0U; ///< Fingerprint of the recorded geometry.
+    unsigned int sampleEvery = 1U;  ///< One query was recorded every this many.
+    std::vector<RecordedQuery_t> queries; ///< The queries, in recording order.
+  }; // RecordedQueryLog_t
+
+  /**
+   * @brief Reads all the queries recorded in the file `path`.
+   * @throw cet::exception (category `GeometryQueryRecorder`) on read errors or
+   *        if the file is not a valid recording
+   */
+  RecordedQueryLog_t readRecordedQueries(std::string const& path);
+
+  /// Summary of the replay of recorded queries.
+  struct QueryReplayResult_t {
+    /// Number of replayed queries of each kind.
+    std::array<std::uint64_t, static_cast<std::size_t>(RecordedQuery_t::Kind_t::NKinds)> calls{};
+    std::uint64_t misses = 0U; ///< Queries with no result (e.g. no TPC found).
+    std::uint64_t throws = 0U; ///< Queries ending with an exception.
+    std::uint64_t checksum = 0U; ///< Hash of all the results.
+
+    /// Returns the total number of replayed queries.
+    std::uint64_t total() const;
+  }; // QueryReplayResult_t
+
+  /**
+   * @brief Runs the recorded queries on a geometry.
+   * @param geom the geometry to query
+   * @param queries the queries to run, in order
+   * @return the counts and results of the queries
+   *
+   * Exceptions thrown by the queries (like `geo::InvalidWireError` from
+   * `NearestWireID()` beyond the wires) are counted and not rethrown.
+   * The checksum combines the returned IDs and the positions rounded to 10
+   * micrometers, so that two implementations giving the same results over the
+   * same queries have the same checksum.
+   */
+  QueryReplayResult_t replayRecordedQueries(geo::GeometryCore const& geom,
+                                            std::vector<RecordedQuery_t> const& queries);
+
+  namespace details {
+
+    /// Header of the recorded query file format.
+    struct QueryLogHeader {
+
+      static constexpr char Magic[8] = {'L', 'A', 'r', 'G', 'e', 'o', 'Q', 'R'};
+      static constexpr std::uint32_t Version = 1U;
+      static constexpr std::uint32_t ByteOrder = 0x01020304U;
+
+      char magic[8];              ///< Identifier of the file format.
+      std::uint32_t version;      ///< Version of the file format.
+      std::uint32_t byteOrder;    ///< Written as `ByteOrder`.
+      std::uint32_t sampleEvery;  ///< Sampling of the recording.
+      std::uint32_t reserved;     ///< Unused, always `0`.
+      std::uint64_t fingerprint;  ///< `geo::GeometryCore::Fingerprint()`.
+
+    }; // QueryLogHeader
+
+    static_assert(sizeof(QueryLogHeader) == 32U);
+
+  } // namespace details
+
+} // namespace geo
+
+#endif // LARCOREALG_GEOMETRY_GEOMETRYQUERYRECORDER_H
@@ -0,0 +1,211 @@
+/**
+ * @file   larcorealg/Geometry/GeometrySnapshot.cxx
+ * @brief  Flat binary image of the derived detector geometry.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/GeometrySnapshot.h`
+ */
+
+// LArSoft libraries
+#include "larcorealg/Geometry/GeometrySnapshot.h"
+
+// framework libraries
+#include "cetlib_except/exception.h"
+
+// C/C++ standard libraries
+#include <cstring> // std::memcmp(), std::memcpy()
+#include <istream>
+#include <iterator> // std::istreambuf_iterator
+#include <ostream>
+
+namespace {
+
+  /// Header of the snapshot image.
+  struct Header_t {
+    char magic[8];            ///< Format identifier.
+    std::uint32_t version;    ///< Format version.
+    std::uint32_t byteOrder;  ///< `ByteOrderMark` in the writer byte order.
+    std::uint32_t nameLength; ///< Length of the detector name.
+    std::uint32_t nCryostats;
+    std::uint32_t nTPCs;
+    std::uint32_t nPlanes;
+    std::uint32_t nWires;
+    std::uint32_t nOpDets;
+  }; // Header_t
+  static_assert(sizeof(Header_t) % 8 == 0);
+
+  constexpr char Magic[8] = {'L', 'A', 'R', 'G', 'E', 'O', 'S', 'N'};
+  constexpr std::uint32_t ByteOrderMark = 0x01020304U;
+
+  /// Returns `size` rounded up to a multiple of 8.
+  constexpr std::size_t padded(std::size_t size) { return (size + 7U) & ~std::size_t{7U}; }
+
+  /// Writes `n` bytes from `data`, padded to a multiple of 8.
+  void writeBlock(std::ostream& out, void const* data, std::size_t n)
+  {
+    static char const zeros[8] = {};
+    out.write(static_cast<char const*>(data), n);
+    out.write(zeros, padded(n) - n);
+  }
+
+  template <typename T>
+  void writeRecords(std::ostream& out, std::vector<T> const& records)
+  {
+    writeBlock(out, records.data(), records.size() * sizeof(T));
+  }
+
+  /// Checks that the `count` elements from `first` are within `total`.
+  void checkRange(std::uint32_t first,
+                  std::uint32_t count,
+                  std::size_t total,
+                  char const* what,
+                  std::size_t owner)
+  {
+    if (std::size_t{first} + count <= total) return;
+    throw cet::exception("GeometrySnapshot")
+      << "Element #" << owner << " owns " << what << " [" << first << "; " << (first + count)
+      << "[ out of the " << total << " in the snapshot.\n";
+  }
+
+  /// Checks that the elements owned by consecutive owners are contiguous.
+  template <typename Owners, typename First, typename Count>
+  void checkContiguous(Owners const& owners,
+                       std::size_t total,
+                       char const* what,
+                       First first,
+                       Count count)
+  {
+    std::size_t next = 0;
+    std::size_t iOwner = 0;
+    for (auto const& owner : owners) {
+      checkRange(owner.*first, owner.*count, total, what, iOwner);
+      if (owner.*first != next) {
+        throw cet::exception("GeometrySnapshot")
+          << "Element #" << iOwner << " owns " << what << " from #" << (owner.*first)
+          << ", expected from #" << next << ".\n";
+      }
+      next += owner.*count;
+      ++iOwner;
+    }
+    if (next != total) {
+      throw cet::exception("GeometrySnapshot")
+        << "Only " << next << " of the " << total << " " << what << " are owned.\n";
+    }
+  } // checkContiguous()
+
+} // local namespace
+
+//------------------------------------------------------------------------------
+geo::GeometrySnapshotView::GeometrySnapshotView(void const* data, std::size_t size)
+{
+  auto const* const begin = static_cast<char const*>(data);
+  if (reinterpret_cast<std::uintptr_t>(begin) % 8 != 0) {
+    throw cet::exception("GeometrySnapshot") << "Snapshot image is not aligned to 8 bytes.\n";
+  }
+  if (size < sizeof(Header_t)) {
+    throw cet::exception("GeometrySnapshot")
+      << "Snapshot image too short (" << size << " bytes).\n";
+  }
+
+  Header_t header;
+  std::memcpy(&header, begin, sizeof(header));
+  if (std::memcmp(header.magic, Magic, sizeof(Magic)) != 0) {
+    throw cet::exception("GeometrySnapshot") << "Data is not a geometry snapshot.\n";
+  }
+  if (header.byteOrder != ByteOrderMark) {
+    throw cet::exception("GeometrySnapshot")
+      << "Geometry snapshot was written with a different byte order.\n";
+  }
+  if (header.version != GeometrySnapshot::FormatVersion) {
+    throw cet::exception("GeometrySnapshot")
+      << "Geometry snapshot format version " << header.version << " not supported (only "
+      << GeometrySnapshot::FormatVersion << ").\n";
+  }
+
+  std::size_t offset = sizeof(Header_t);
+  auto const takeBlock = [begin, size, &offset](std::size_t n) {
+    if (padded(n) > size - offset) {
+      throw cet::exception("GeometrySnapshot")
+        << "Snapshot image truncated (" << size << " bytes).\n";
+    }
+    char const* const block = begin + offset;
+    offset += padded(n);
+    return block;
+  };
+  auto const takeRecords = [&takeBlock](auto& records, std::size_t n) {
+    using Record_t = std::remove_pointer_t<std::decay_t<decltype(records.begin())>>;
+    auto const* first = reinterpret_cast<Record_t const*>(takeBlock(n * sizeof(Record_t)));
+    records = {first, first + n};
+  };
+
+  char const* const name = takeBlock(header.nameLength);
+  fDetectorName.assign(name, header.nameLength);
+  takeRecords(fCryostats, header.nCryostats);
+  takeRecords(fTPCs, header.nTPCs);
+  takeRecords(fPlanes, header.nPlanes);
+  takeRecords(fWires, header.nWires);
+  takeRecords(fOpDets, header.nOpDets);
+
+  checkContiguous(fCryostats,
+                  fTPCs.size(),
+                  "TPCs",
+                  &snapshot::Cryostat_t::firstTPC,
+                  &snapshot::Cryostat_t::nTPCs);
+  checkContiguous(fCryostats,
+                  fOpDets.size(),
+                  "optical detectors",
+                  &snapshot::Cryostat_t::firstOpDet,
+                  &snapshot::Cryostat_t::nOpDets);
+  checkContiguous(
+    fTPCs, fPlanes.size(), "planes", &snapshot::TPC_t::firstPlane, &snapshot::TPC_t::nPlanes);
+  checkContiguous(
+    fPlanes, fWires.size(), "wires", &snapshot::Plane_t::firstWire, &snapshot::Plane_t::nWires);
+
+} // geo::GeometrySnapshotView::GeometrySnapshotView()
+
+//------------------------------------------------------------------------------
+geo::GeometrySnapshot::GeometrySnapshot(GeometrySnapshotView const& view)
+  : detectorName(view.detectorName())
+  , cryostats(view.cryostats().begin(), view.cryostats().end())
+  , TPCs(view.TPCs().begin(), view.TPCs().end())
+  , planes(view.planes().begin(), view.planes().end())
+  , wires(view.wires().begin(), view.wires().end())
+  , opDets(view.opDets().begin(), view.opDets().end())
+{}
+
+//------------------------------------------------------------------------------
+void geo::GeometrySnapshot::write(std::ostream& out) const
+{
+  Header_t header;
+  std::memcpy(header.magic, Magic, sizeof(Magic));
+  header.version = FormatVersion;
+  header.byteOrder = ByteOrderMark;
+  header.nameLength = detectorName.size();
+  header.nCryostats = cryostats.size();
+  header.nTPCs = TPCs.size();
+  header.nPlanes = planes.size();
+  header.nWires = wires.size();
+  header.nOpDets = opDets.size();
+
+  writeBlock(out, &header, sizeof(header));
+  writeBlock(out, detectorName.data(), detectorName.size());
+  writeRecords(out, cryostats);
+  writeRecords(out, TPCs);
+  writeRecords(out, planes);
+  writeRecords(out, wires);
+  writeRecords(out, opDets);
+  if (!out) {
+    throw cet::exception("GeometrySnapshot") << "Failed to write the geometry snapshot.\n";
+  }
+} // geo::GeometrySnapshot::write()
+
+//------------------------------------------------------------------------------
+geo::GeometrySnapshot geo::GeometrySnapshot::read(std::istream& in)
+{
+  // read all in a buffer aligned for the records, then parse it
+  std::string const content{std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+  std::vector<std::uint64_t> buffer((content.size() + 7U) / 8U);
+  if (!content.empty()) std::memcpy(buffer.data(), content.data(), content.size());
+  return GeometrySnapshot{GeometrySnapshotView{buffer.data(), content.size()}};
+} // geo::GeometrySnapshot::read()
+
+//------------------------------------------------------------------------------
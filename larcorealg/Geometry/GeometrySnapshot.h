@@ -0,0 +1,198 @@
+/**
+ * @file   larcorealg/Geometry/GeometrySnapshot.h
+ * @brief  Flat binary image of the derived detector geometry.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/GeometrySnapshot.cxx`,
+ *         `geo::GeometryCore::MakeGeometrySnapshot()`
+ */
+
+#ifndef LARCOREALG_GEOMETRY_GEOMETRYSNAPSHOT_H
+#define LARCOREALG_GEOMETRY_GEOMETRYSNAPSHOT_H
+
+// LArSoft libraries
+#include "larcorealg/CoreUtils/span.h"
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint32_t
+#include <iosfwd>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace geo {
+
+  /**
+   * @brief Records of the geometry snapshot.
+   *
+   * The records are plain data, with no padding and sizes multiple of 8 bytes,
+   * stored in the snapshot file exactly as they are in memory.
+   * All coordinates are in the world frame, in centimeters, and all the
+   * elements are in the order they have in `geo::GeometryCore` after sorting.
+   */
+  namespace snapshot {
+
+    /// Box with sides parallel to the coordinate axes.
+    struct Box_t {
+      double min[3]; ///< Lower corner.
+      double max[3]; ///< Upper corner.
+    };
+
+    /// A sensitive wire.
+    struct Wire_t {
+      double center[3];    ///< Center of the wire.
+      double direction[3]; ///< Direction of the wire (unit vector).
+      double halfLength;   ///< Half length of the wire.
+      double thetaZ;       ///< As `geo::WireGeo::ThetaZ()`.
+    };
+
+    /// A wire plane.
+    struct Plane_t {
+      double center[3];     ///< Center of the plane.
+      double normal[3];     ///< Normal pointing into the TPC.
+      double widthDir[3];   ///< Direction of the width of the plane.
+      double depthDir[3];   ///< Direction of the depth of the plane.
+      double width;         ///< Width of the plane frame.
+      double depth;         ///< Depth of the plane frame.
+      double wirePitch;     ///< Distance between wires.
+      double phiZ;          ///< As `geo::PlaneGeo::PhiZ()`.
+      std::uint32_t firstWire; ///< Index of the first wire of the plane.
+      std::uint32_t nWires;    ///< Number of wires in the plane.
+      std::int32_t view;       ///< View (`geo::View_t`).
+      std::int32_t orientation; ///< Orientation (`geo::Orient_t`).
+    };
+
+    /// A TPC.
+    struct TPC_t {
+      Box_t box;                   ///< Box of the whole TPC.
+      Box_t activeBox;             ///< Box of the active volume.
+      double driftDir[3];          ///< Direction of the drift (unit vector).
+      std::uint32_t firstPlane;    ///< Index of the first plane of the TPC.
+      std::uint32_t nPlanes;       ///< Number of planes in the TPC.
+      std::int32_t driftDirection; ///< As `geo::TPCGeo::DriftDirection()`.
+      std::uint32_t reserved;      ///< Padding, always `0`.
+    };
+
+    /// An optical detector.
+    struct OpDet_t {
+      double center[3]; ///< Center of the detector.
+      double rMax;      ///< Outer radius (if a disk or sphere).
+      double halfW;     ///< Half width (if a box).
+      double halfH;     ///< Half height (if a box).
+      double halfL;     ///< Half length.
+      double reserved;  ///< Padding, always `0`.
+    };
+
+    /// A cryostat.
+    struct Cryostat_t {
+      Box_t box;                 ///< Box of the cryostat.
+      std::uint32_t firstTPC;    ///< Index of the first TPC of the cryostat.
+      std::uint32_t nTPCs;       ///< Number of TPCs in the cryostat.
+      std::uint32_t firstOpDet;  ///< Index of the first optical detector.
+      std::uint32_t nOpDets;     ///< Number of optical detectors.
+    };
+
+    namespace details {
+      template <typename T>
+      constexpr bool isRecord = std::is_trivially_copyable_v<T> && (sizeof(T) % 8 == 0);
+    }
+    static_assert(details::isRecord<Wire_t>);
+    static_assert(details::isRecord<Plane_t>);
+    static_assert(details::isRecord<TPC_t>);
+    static_assert(details::isRecord<OpDet_t>);
+    static_assert(details::isRecord<Cryostat_t>);
+
+  } // namespace snapshot
+
+  class GeometrySnapshotView;
+  class GeometrySnapshot;
+
+} // namespace geo
+
+//------------------------------------------------------------------------------
+/**
+ * @brief Read-only access to a geometry snapshot image in memory.
+ *
+ * The image is the content of a snapshot file, as written by
+ * `geo::GeometrySnapshot::write()`. The view does not copy the data, so the
+ * image can be e.g. a memory-mapped file, which must stay mapped until the
+ * view is used. The image must be aligned to 8 bytes (memory maps are).
+ *
+ * The constructor validates the image (format, version, byte order and
+ * consistency of the indices between the records) and throws
+ * `cet::exception` (category `"GeometrySnapshot"`) on failure.
+ */
+class geo::GeometrySnapshotView {
+
+public:
+  /// Parses the image of `size` bytes starting at `data`.
+  GeometrySnapshotView(void const* data, std::size_t size);
+
+  /// Name of the detector.
+  std::string const& detectorName() const { return fDetectorName; }
+
+  // @{
+  /// All the records of each type.
+  util::span<snapshot::Cryostat_t const*> cryostats() const { return fCryostats; }
+  util::span<snapshot::TPC_t const*> TPCs() const { return fTPCs; }
+  util::span<snapshot::Plane_t const*> planes() const { return fPlanes; }
+  util::span<snapshot::Wire_t const*> wires() const { return fWires; }
+  util::span<snapshot::OpDet_t const*> opDets() const { return fOpDets; }
+  // @}
+
+private:
+  std::string fDetectorName;
+  util::span<snapshot::Cryostat_t const*> fCryostats{nullptr, nullptr};
+  util::span<snapshot::TPC_t const*> fTPCs{nullptr, nullptr};
+  util::span<snapshot::Plane_t const*> fPlanes{nullptr, nullptr};
+  util::span<snapshot::Wire_t const*> fWires{nullptr, nullptr};
+  util::span<snapshot::OpDet_t const*> fOpDets{nullptr, nullptr};
+
+}; // geo::GeometrySnapshotView
+
+//------------------------------------------------------------------------------
+/**
+ * @brief Derived state of a detector geometry, in a flat binary format.
+ *
+ * The snapshot holds the information computed from the GDML description by
+ * `geo::GeometryCore` and its builder: boxes of cryostats and TPCs, frames of
+ * the wire planes, and position and direction of each wire, all in the final
+ * sorting order. It is created by `geo::GeometryCore::MakeGeometrySnapshot()`
+ * and can be saved into a file (`write()`) to be reloaded (`read()`, or
+ * `geo::GeometrySnapshotView` on a memory map) by jobs needing only the wire
+ * geometry, without importing the ROOT geometry.
+ *
+ * The file is in the native byte order; a file from a machine with a
+ * different byte order is rejected.
+ */
+class geo::GeometrySnapshot {
+
+public:
+  /// Version of the file format written.
+  static constexpr std::uint32_t FormatVersion = 1U;
+
+  std::string detectorName; ///< Name of the detector.
+  std::vector<snapshot::Cryostat_t> cryostats; ///< All cryostats.
+  std::vector<snapshot::TPC_t> TPCs;           ///< All TPCs, by cryostat.
+  std::vector<snapshot::Plane_t> planes;       ///< All planes, by TPC.
+  std::vector<snapshot::Wire_t> wires;         ///< All wires, by plane.
+  std::vector<snapshot::OpDet_t> opDets;       ///< All optical detectors, by cryostat.
+
+  /// Creates an empty snapshot.
+  GeometrySnapshot() = default;
+
+  /// Copies the content of a snapshot image.
+  explicit GeometrySnapshot(GeometrySnapshotView const& view);
+
+  /// Writes the snapshot image into `out`.
+  void write(std::ostream& out) const;
+
+  /// Reads a snapshot image from `in`.
+  /// @throw cet::exception (category `"GeometrySnapshot"`) on invalid input
+  static GeometrySnapshot read(std::istream& in);
+
+}; // geo::GeometrySnapshot
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREALG_GEOMETRY_GEOMETRYSNAPSHOT_H
@@ -0,0 +1,77 @@
+/**
+ * @file   larcorealg/Geometry/GeometrySubset.h
+ * @brief  Selection of the part of the detector to be fully built.
+ * @date   October 14, 2026
+ * @see    `geo::GeometryCore::SetBuildSubset()`
+ *
+ * This is a header only library.
+ */
+
+#ifndef LARCOREALG_GEOMETRY_GEOMETRYSUBSET_H
+#define LARCOREALG_GEOMETRY_GEOMETRYSUBSET_H
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+
+// C/C++ standard libraries
+#include <set>
+
+namespace geo {
+
+  /**
+   * @brief A set of cryostats and TPCs of the detector.
+   * @see `geo::GeometryCore::SetBuildSubset()`
+   *
+   * The subset is made of whole cryostats and of single TPCs, by their ID
+   * (after sorting). A subset with no element is the whole detector, which
+   * is what a default-constructed subset describes.
+   *
+   * Example selecting all of cryostat `C:1` and two TPCs of cryostat `C:0`:
+   * ~~~~{.cpp}
+   * geo::GeometrySubset subset;
+   * subset.addCryostat(geo::CryostatID{1});
+   * subset.addTPC(geo::TPCID{0, 4});
+   * subset.addTPC(geo::TPCID{0, 5});
+   * ~~~~
+   */
+  class GeometrySubset {
+  public:
+    /// Adds the whole cryostat `cid` to the subset.
+    GeometrySubset& addCryostat(geo::CryostatID const& cid)
+    {
+      fCryostats.insert(cid);
+      return *this;
+    }
+
+    /// Adds the TPC `tpcid` to the subset.
+    GeometrySubset& addTPC(geo::TPCID const& tpcid)
+    {
+      fTPCs.insert(tpcid);
+      return *this;
+    }
+
+    /// Returns whether the subset is the whole detector.
+    bool isWholeDetector() const { return fCryostats.empty() && fTPCs.empty(); }
+
+    /// Returns whether the TPC `tpcid` is in the subset.
+    bool contains(geo::TPCID const& tpcid) const
+    {
+      return isWholeDetector() || (fCryostats.count(tpcid.asCryostatID()) > 0) ||
+             (fTPCs.count(tpcid) > 0);
+    }
+
+    /// The cryostats in the subset with all their TPCs.
+    std::set<geo::CryostatID> const& cryostats() const { return fCryostats; }
+
+    /// The single TPCs in the subset.
+    std::set<geo::TPCID> const& TPCs() const { return fTPCs; }
+
+  private:
+    std::set<geo::CryostatID> fCryostats; ///< Whole cryostats.
+    std::set<geo::TPCID> fTPCs;           ///< Single TPCs.
+
+  }; // class GeometrySubset
+
+} // namespace geo
+
+#endif // LARCOREALG_GEOMETRY_GEOMETRYSUBSET_H
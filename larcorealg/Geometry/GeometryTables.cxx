@@ -0,0 +1,307 @@
+/**
+ * @file   larcorealg/Geometry/GeometryTables.cxx
+ * @brief  Export of the derived geometry as ROOT trees of columns.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/GeometryTables.h`
+ */
+
+// LArSoft libraries
+#include "larcorealg/Geometry/GeometryTables.h"
+#include "larcorealg/Geometry/GeometrySnapshot.h"
+#include "larcorealg/Geometry/SharedGeometrySnapshot.h"
+#include "larcoreobj/SimpleTypesAndConstants/RawTypes.h" // raw::ChannelID_t
+
+// framework libraries
+#include "cetlib_except/exception.h"
+
+// ROOT libraries
+#include "TDirectory.h"
+#include "TObject.h"
+#include "TTree.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::max()
+#include <cstdint>   // std::int32_t, std::uint64_t
+#include <string>
+#include <vector>
+
+namespace {
+
+  /// A tree with one branch per column, filled one row at a time.
+  class Table {
+  public:
+    Table(TDirectory& dir, char const* name, char const* title)
+      : fTree{new TTree(name, title)} // owned by `dir` from now on
+    {
+      fTree->SetDirectory(&dir);
+    }
+
+    /// Adds a column reading from `value` at each row.
+    template <typename T>
+    void column(char const* name, T& value)
+    {
+      fTree->Branch(name, &value);
+    }
+
+    /// Adds three columns with the suffixes `X`, `Y` and `Z`, from `values`.
+    void vector(std::string const& name, double* values)
+    {
+      for (char const* axis : {"X", "Y", "Z"})
+        fTree->Branch((name + axis).c_str(), values++);
+    }
+
+    /// Fills a row with the current values of the columns.
+    void fill() { fTree->Fill(); }
+
+    /// Writes the tree into its directory.
+    void write() { fTree->Write(nullptr, TObject::kOverwrite); }
+
+  private:
+    TTree* fTree; ///< The tree being filled, owned by its directory.
+  };
+
+  /// Copies the three coordinates of `from` into `to`.
+  void copy3(double const* from, double* to)
+  {
+    to[0] = from[0];
+    to[1] = from[1];
+    to[2] = from[2];
+  }
+
+  /// Full ID of a wire, with `-1` for the missing values.
+  struct WireRow_t {
+    std::int32_t cryostat = -1;
+    std::int32_t tpc = -1;
+    std::int32_t plane = -1;
+    std::int32_t wire = -1;
+    std::int32_t view = -1;
+  };
+
+} // local namespace
+
+//------------------------------------------------------------------------------
+void geo::writeGeometryTables(TDirectory& dir, geo::SharedGeometryContent const& content)
+{
+  geo::GeometrySnapshot const& snapshot = content.snapshot;
+  if (content.wireChannels.size() != snapshot.wires.size()) {
+    throw cet::exception("GeometryTables")
+      << "writeGeometryTables(): " << content.wireChannels.size() << " channels given for the "
+      << snapshot.wires.size() << " wires of the geometry\n";
+  }
+
+  {
+    std::string name = snapshot.detectorName;
+    std::uint64_t fingerprint = content.fingerprint;
+    std::uint32_t version = geo::tables::FormatVersion;
+    Table table{dir, geo::tables::DetectorTree, "Detector"};
+    table.column("name", name);
+    table.column("fingerprint", fingerprint);
+    table.column("version", version);
+    table.fill();
+    table.write();
+  }
+
+  // the ID of each plane, for the wire and channel tables
+  std::vector<WireRow_t> planeIDs(snapshot.planes.size());
+
+  {
+    std::int32_t cryostat = -1, nTPCs = 0, nOpDets = 0;
+    double min[3], max[3];
+    Table table{dir, geo::tables::CryostatTree, "Cryostats"};
+    table.column("cryostat", cryostat);
+    table.column("nTPCs", nTPCs);
+    table.column("nOpDets", nOpDets);
+    table.vector("min", min);
+    table.vector("max", max);
+
+    std::int32_t tpc = -1, nPlanes = 0, driftDirection = 0;
+    double driftDir[3], tpcMin[3], tpcMax[3], activeMin[3], activeMax[3];
+    Table tpcTable{dir, geo::tables::TPCTree, "TPCs"};
+    tpcTable.column("cryostat", cryostat);
+    tpcTable.column("tpc", tpc);
+    tpcTable.column("nPlanes", nPlanes);
+    tpcTable.column("driftDirection", driftDirection);
+    tpcTable.vector("driftDir", driftDir);
+    tpcTable.vector("min", tpcMin);
+    tpcTable.vector("max", tpcMax);
+    tpcTable.vector("activeMin", activeMin);
+    tpcTable.vector("activeMax", activeMax);
+
+    for (std::size_t c = 0; c < snapshot.cryostats.size(); ++c) {
+      geo::snapshot::Cryostat_t const& cryo = snapshot.cryostats[c];
+      cryostat = static_cast<std::int32_t>(c);
+      nTPCs = cryo.nTPCs;
+      nOpDets = cryo.nOpDets;
+      copy3(cryo.box.min, min);
+      copy3(cryo.box.max, max);
+      table.fill();
+
+      for (std::uint32_t t = 0; t < cryo.nTPCs; ++t) {
+        geo::snapshot::TPC_t const& TPC = snapshot.TPCs[cryo.firstTPC + t];
+        tpc = static_cast<std::int32_t>(t);
+        nPlanes = TPC.nPlanes;
+        driftDirection = TPC.driftDirection;
+        copy3(TPC.driftDir, driftDir);
+        copy3(TPC.box.min, tpcMin);
+        copy3(TPC.box.max, tpcMax);
+        copy3(TPC.activeBox.min, activeMin);
+        copy3(TPC.activeBox.max, activeMax);
+        tpcTable.fill();
+
+        for (std::uint32_t p = 0; p < TPC.nPlanes; ++p) {
+          WireRow_t& planeID = planeIDs[TPC.firstPlane + p];
+          planeID.cryostat = cryostat;
+          planeID.tpc = tpc;
+          planeID.plane = static_cast<std::int32_t>(p);
+          planeID.view = snapshot.planes[TPC.firstPlane + p].view;
+        }
+      } // for TPCs
+    }   // for cryostats
+    table.write();
+    tpcTable.write();
+  }
+
+  {
+    WireRow_t row;
+    std::int32_t orientation = 0, nWires = 0;
+    double wirePitch = 0.0, phiZ = 0.0, width = 0.0, depth = 0.0;
+    double center[3], normal[3], widthDir[3], depthDir[3];
+    Table table{dir, geo::tables::PlaneTree, "Planes"};
+    table.column("cryostat", row.cryostat);
+    table.column("tpc", row.tpc);
+    table.column("plane", row.plane);
+    table.column("view", row.view);
+    table.column("orientation", orientation);
+    table.column("nWires", nWires);
+    table.column("wirePitch", wirePitch);
+    table.column("phiZ", phiZ);
+    table.column("width", width);
+    table.column("depth", depth);
+    table.vector("center", center);
+    table.vector("normal", normal);
+    table.vector("widthDir", widthDir);
+    table.vector("depthDir", depthDir);
+
+    for (std::size_t i = 0; i < snapshot.planes.size(); ++i) {
+      geo::snapshot::Plane_t const& plane = snapshot.planes[i];
+      row = planeIDs[i];
+      orientation = plane.orientation;
+      nWires = plane.nWires;
+      wirePitch = plane.wirePitch;
+      phiZ = plane.phiZ;
+      width = plane.width;
+      depth = plane.depth;
+      copy3(plane.center, center);
+      copy3(plane.normal, normal);
+      copy3(plane.widthDir, widthDir);
+      copy3(plane.depthDir, depthDir);
+      table.fill();
+    }
+    table.write();
+  }
+
+  // the first wire of each channel, for the channel table
+  raw::ChannelID_t nChannels = 0U;
+  for (raw::ChannelID_t const channel : content.wireChannels) {
+    if (raw::isValidChannelID(channel)) nChannels = std::max(nChannels, channel + 1U);
+  }
+  std::vector<WireRow_t> channelWires(nChannels);
+  std::vector<std::int32_t> channelWireCounts(nChannels, 0);
+
+  {
+    WireRow_t row;
+    raw::ChannelID_t channel = raw::InvalidChannelID;
+    double halfLength = 0.0, thetaZ = 0.0;
+    double center[3], direction[3];
+    Table table{dir, geo::tables::WireTree, "Wires"};
+    table.column("cryostat", row.cryostat);
+    table.column("tpc", row.tpc);
+    table.column("plane", row.plane);
+    table.column("wire", row.wire);
+    table.column("channel", channel);
+    table.column("halfLength", halfLength);
+    table.column("thetaZ", thetaZ);
+    table.vector("center", center);
+    table.vector("direction", direction);
+
+    for (std::size_t i = 0; i < snapshot.planes.size(); ++i) {
+      geo::snapshot::Plane_t const& plane = snapshot.planes[i];
+      row = planeIDs[i];
+      for (std::uint32_t w = 0; w < plane.nWires; ++w) {
+        std::size_t const iWire = plane.firstWire + w;
+        geo::snapshot::Wire_t const& wire = snapshot.wires[iWire];
+        row.wire = static_cast<std::int32_t>(w);
+        channel = content.wireChannels[iWire];
+        halfLength = wire.halfLength;
+        thetaZ = wire.thetaZ;
+        copy3(wire.center, center);
+        copy3(wire.direction, direction);
+        table.fill();
+
+        if (!raw::isValidChannelID(channel)) continue;
+        if (channelWireCounts[channel]++ == 0) channelWires[channel] = row;
+      } // for wires
+    }   // for planes
+    table.write();
+  }
+
+  {
+    WireRow_t row;
+    raw::ChannelID_t channel = 0U;
+    std::int32_t nWires = 0;
+    Table table{dir, geo::tables::ChannelTree, "Channels"};
+    table.column("channel", channel);
+    table.column("nWires", nWires);
+    table.column("cryostat", row.cryostat);
+    table.column("tpc", row.tpc);
+    table.column("plane", row.plane);
+    table.column("wire", row.wire);
+    table.column("view", row.view);
+
+    for (channel = 0U; channel < nChannels; ++channel) {
+      row = channelWires[channel];
+      nWires = channelWireCounts[channel];
+      table.fill();
+    }
+    table.write();
+  }
+
+  {
+    std::int32_t opDet = -1, cryostat = -1, opDetInCryostat = -1;
+    double center[3], rMax = 0.0, halfW = 0.0, halfH = 0.0, halfL = 0.0;
+    Table table{dir, geo::tables::OpDetTree, "OpDets"};
+    table.column("opDet", opDet);
+    table.column("cryostat", cryostat);
+    table.column("opDetInCryostat", opDetInCryostat);
+    table.vector("center", center);
+    table.column("rMax", rMax);
+    table.column("halfW", halfW);
+    table.column("halfH", halfH);
+    table.column("halfL", halfL);
+
+    for (std::size_t c = 0; c < snapshot.cryostats.size(); ++c) {
+      geo::snapshot::Cryostat_t const& cryo = snapshot.cryostats[c];
+      cryostat = static_cast<std::int32_t>(c);
+      for (std::uint32_t o = 0; o < cryo.nOpDets; ++o) {
+        geo::snapshot::OpDet_t const& info = snapshot.opDets[cryo.firstOpDet + o];
+        opDet = static_cast<std::int32_t>(cryo.firstOpDet + o);
+        opDetInCryostat = static_cast<std::int32_t>(o);
+        copy3(info.center, center);
+        rMax = info.rMax;
+        halfW = info.halfW;
+        halfH = info.halfH;
+        halfL = info.halfL;
+        table.fill();
+      }
+    } // for cryostats
+    table.write();
+  }
+} // geo::writeGeometryTables()
+
+//------------------------------------------------------------------------------
+void geo::writeGeometryTables(TDirectory& dir, geo::GeometryCore const& geom)
+{
+  writeGeometryTables(dir, geo::makeSharedGeometryContent(geom));
+} // geo::writeGeometryTables(GeometryCore)
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,84 @@
+/**
+ * @file   larcorealg/Geometry/GeometryTables.h
+ * @brief  Export of the derived geometry as ROOT trees of columns.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/GeometryTables.cxx`
+ */
+
+#ifndef LARCOREALG_GEOMETRY_GEOMETRYTABLES_H
+#define LARCOREALG_GEOMETRY_GEOMETRYTABLES_H
+
+// C/C++ standard libraries
+#include <cstdint> // std::uint32_t
+
+// ROOT class prototypes
+class TDirectory;
+
+namespace geo {
+
+  class GeometryCore;
+  struct SharedGeometryContent;
+
+  /**
+   * @brief Names of the trees written by `writeGeometryTables()`.
+   *
+   * Each tree has one entry per element, in the order of the elements in
+   * `geo::GeometryCore` after sorting, and one branch of a simple type per
+   * column; vectors are split in their _x_, _y_ and _z_ components
+   * (e.g. `centerX`, `centerY`, `centerZ`), in centimeters. Every table has
+   * the full ID of its elements (e.g. `cryostat`, `tpc`, `plane`, `wire`),
+   * while missing values are `-1`.
+   *
+   * - `Detector` (a single entry): `name`, `fingerprint` (as
+   *   `geo::GeometryCore::Fingerprint()`), `version` (`FormatVersion`);
+   * - `Cryostats`: `cryostat`, `nTPCs`, `nOpDets`, box `min*`, `max*`;
+   * - `TPCs`: `cryostat`, `tpc`, `nPlanes`, `driftDirection` (`geo::DriftDirection_t`),
+   *   `driftDir*`, box `min*`, `max*`, active box `activeMin*`, `activeMax*`;
+   * - `Planes`: `cryostat`, `tpc`, `plane`, `view` (`geo::View_t`),
+   *   `orientation` (`geo::Orient_t`), `nWires`, `wirePitch`, `phiZ`,
+   *   `width`, `depth`, `center*`, `normal*`, `widthDir*`, `depthDir*`;
+   * - `Wires`: `cryostat`, `tpc`, `plane`, `wire`, `channel`, `halfLength`,
+   *   `thetaZ`, `center*`, `direction*`;
+   * - `Channels` (one entry per channel number, from `0`): `channel`,
+   *   `nWires`, and the ID of the first of its wires (`cryostat`, `tpc`,
+   *   `plane`, `wire`) with its plane `view`, all `-1` if the channel has no
+   *   wire;
+   * - `OpDets`: `opDet`, `cryostat`, `opDetInCryostat`, `center*`, `rMax`,
+   *   `halfW`, `halfH`, `halfL`.
+   */
+  namespace tables {
+
+    /// Version of the layout of the tables.
+    constexpr std::uint32_t FormatVersion = 1U;
+
+    constexpr char const* DetectorTree = "Detector";
+    constexpr char const* CryostatTree = "Cryostats";
+    constexpr char const* TPCTree = "TPCs";
+    constexpr char const* PlaneTree = "Planes";
+    constexpr char const* WireTree = "Wires";
+    constexpr char const* ChannelTree = "Channels";
+    constexpr char const* OpDetTree = "OpDets";
+
+  } // namespace tables
+
+  /**
+   * @brief Writes the tables of the derived geometry into a ROOT directory.
+   * @param dir the directory to write the trees into (e.g. a `TFile`)
+   * @param content the derived geometry, with the channel of each wire
+   * @see `geo::tables`, `geo::makeSharedGeometryContent()`
+   *
+   * The content is the one of a geometry snapshot: analysis jobs can read
+   * only the columns they need (e.g. with `RDataFrame` or uproot) instead of
+   * building the geometry from its GDML description.
+   * Trees already in `dir` with the same names are overwritten.
+   */
+  void writeGeometryTables(TDirectory& dir, geo::SharedGeometryContent const& content);
+
+  /// Writes the tables of `geom` into `dir` (see the version with the content).
+  void writeGeometryTables(TDirectory& dir, geo::GeometryCore const& geom);
+
+} // namespace geo
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREALG_GEOMETRY_GEOMETRYTABLES_H
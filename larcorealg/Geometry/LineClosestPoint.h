@@ -15,7 +15,9 @@
 #define LARCOREALG_GEOMETRY_LINECLOSESTPOINT_H
 
 // C++ standard library
+#include <cstddef> // std::size_t
 #include <utility> // std::pair<>
+#include <vector>
 
 // -----------------------------------------------------------------------------
 namespace geo {
@@ -231,6 +233,92 @@ namespace geo {
                                         Point const& startB,
                                         UnitVector const& dirB);
 
+  // ---------------------------------------------------------------------------
+  /// @name Closest approach of many lines
+  /// @{
+
+  /**
+   * @brief A set of lines as arrays of their coordinates.
+   *
+   * Line `i` passes through the point (`startX[i]`, `startY[i]`, `startZ[i]`)
+   * with direction (`dirX[i]`, `dirY[i]`, `dirZ[i]`). The arrays are not owned
+   * and must hold at least `size` elements each; for example, with the
+   * coordinates in `geo::vect::CoordArraySoA` containers:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * geo::LineArrays const lines{ starts.size(),
+   *   starts.xs(), starts.ys(), starts.zs(), dirs.xs(), dirs.ys(), dirs.zs() };
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   */
+  struct LineArrays {
+    std::size_t size = 0;           ///< Number of lines.
+    double const* startX = nullptr; ///< _x_ coordinates of the reference points.
+    double const* startY = nullptr; ///< _y_ coordinates of the reference points.
+    double const* startZ = nullptr; ///< _z_ coordinates of the reference points.
+    double const* dirX = nullptr;   ///< _x_ components of the directions.
+    double const* dirY = nullptr;   ///< _y_ components of the directions.
+    double const* dirZ = nullptr;   ///< _z_ components of the directions.
+  }; // LineArrays
+
+  /// Closest approach between a reference line and one of a `geo::LineArrays`.
+  struct LineClosestApproach {
+    std::size_t line; ///< Index of the line in the set.
+    double offset1;   ///< Offset on the reference line, in units of its direction.
+    double offset2;   ///< Offset on the line of the set, in units of its direction.
+    double distance;  ///< Distance between the two lines.
+  }; // LineClosestApproach
+
+  /// Closest approach between two lines of the same `geo::LineArrays`.
+  struct LinePairClosestApproach {
+    std::size_t line1; ///< Index of the first line of the pair.
+    std::size_t line2; ///< Index of the second line of the pair (larger than `line1`).
+    double offset1;    ///< Offset on the first line, in units of its direction.
+    double offset2;    ///< Offset on the second line, in units of its direction.
+    double distance;   ///< Distance between the two lines.
+  }; // LinePairClosestApproach
+
+  /**
+   * @brief Returns the closest approaches of a set of lines to a reference line.
+   * @tparam Point a type describing a point
+   * @tparam Vector a type describing a direction (displacement vector)
+   * @param start a reference point on the reference line
+   * @param dir the direction of the reference line
+   * @param lines the set of lines to be compared with the reference line
+   * @param maxDistance only lines closer than this are returned
+   * @return the closest approach of each selected line, sorted by index
+   * @see `LineClosestPointAndOffsets()`, `AllLinesClosestApproaches()`
+   *
+   * The offsets are the same as the ones from `LineClosestPointAndOffsets()`
+   * with the reference line as first line; the closest point on the reference
+   * line is `start + dir * offset1`.
+   * The lines are processed in blocks, where the offsets and the distance of
+   * all lines are computed in loops which the compiler can vectorize, and then
+   * the lines farther than `maxDistance` are rejected.
+   * Lines parallel to the reference line have no defined closest approach and
+   * are never selected.
+   */
+  template <typename Point, typename Vector>
+  std::vector<LineClosestApproach> LinesClosestApproaches(Point const& start,
+                                                          Vector const& dir,
+                                                          LineArrays const& lines,
+                                                          double maxDistance);
+
+  /**
+   * @brief Returns the closest approaches of all the pairs in a set of lines.
+   * @param lines the set of lines
+   * @param maxDistance only pairs of lines closer than this are returned
+   * @return the closest approach of each selected pair
+   * @see `LinesClosestApproaches()`
+   *
+   * Each pair (`line1`, `line2`) is considered once, with `line1 < line2`, and
+   * the pairs are sorted by `line1` and then `line2`.
+   * This is equivalent to calling `LinesClosestApproaches()` with each line of
+   * the set as reference line against the lines following it.
+   */
+  std::vector<LinePairClosestApproach> AllLinesClosestApproaches(LineArrays const& lines,
+                                                                 double maxDistance);
+
+  /// @}
+
 } // namespace geo
 
 // -----------------------------------------------------------------------------
@@ -17,8 +17,9 @@
 #include "larcorealg/Geometry/geo_vectors_utils.h" // geo::vect::dot()
 
 // C++ standard library
+#include <algorithm> // std::min()
 #include <cassert>
-#include <cmath> // std::abs()
+#include <cmath> // std::abs(), std::sqrt()
 #include <tuple> // std::tie()
 
 // -----------------------------------------------------------------------------
@@ -130,6 +131,88 @@ namespace geo::details {
   } // geo::details::LineClosestPointWithUnitVectorsImpl()
 
   // ---------------------------------------------------------------------------
+  /// Number of lines processed together by the batch closest approach.
+  constexpr std::size_t LineClosestApproachBlockSize = 256;
+
+  /**
+   * @brief Closest approach of `n` lines from `lines`, from `first` on.
+   * @param c reference point of the reference line
+   * @param w direction of the reference line
+   * @param[out] t offsets on the reference line
+   * @param[out] u offsets on the other lines
+   * @param[out] d2 squared distances between the lines
+   *
+   * This is the same computation as `LineClosestPointImpl()`, in a loop which
+   * the compiler can vectorize. Parallel lines get a not finite distance.
+   */
+  inline void LineClosestApproachKernel(double const* c,
+                                        double const* w,
+                                        LineArrays const& lines,
+                                        std::size_t first,
+                                        std::size_t n,
+                                        double* __restrict__ t,
+                                        double* __restrict__ u,
+                                        double* __restrict__ d2)
+  {
+    double const c0 = c[0], c1 = c[1], c2 = c[2];
+    double const w0 = w[0], w1 = w[1], w2 = w[2];
+    double const w1w1 = w0 * w0 + w1 * w1 + w2 * w2;
+    double const* __restrict__ sx = lines.startX + first;
+    double const* __restrict__ sy = lines.startY + first;
+    double const* __restrict__ sz = lines.startZ + first;
+    double const* __restrict__ dx = lines.dirX + first;
+    double const* __restrict__ dy = lines.dirY + first;
+    double const* __restrict__ dz = lines.dirZ + first;
+    for (std::size_t i = 0; i < n; ++i) {
+      double const dc0 = sx[i] - c0, dc1 = sy[i] - c1, dc2 = sz[i] - c2;
+      double const dcw1 = dc0 * w0 + dc1 * w1 + dc2 * w2;
+      double const dcw2 = dc0 * dx[i] + dc1 * dy[i] + dc2 * dz[i];
+      double const w1w2 = w0 * dx[i] + w1 * dy[i] + w2 * dz[i];
+      double const w2w2 = dx[i] * dx[i] + dy[i] * dy[i] + dz[i] * dz[i];
+      double const inv_den = 1.0 / (w1w2 * w1w2 - w1w1 * w2w2);
+      double const ti = ((dcw2 * w1w2) - (dcw1 * w2w2)) * inv_den;
+      double const ui = ((dcw2 * w1w1) - (dcw1 * w1w2)) * inv_den;
+      // displacement between the two closest points
+      double const r0 = dc0 + ui * dx[i] - ti * w0;
+      double const r1 = dc1 + ui * dy[i] - ti * w1;
+      double const r2 = dc2 + ui * dz[i] - ti * w2;
+      t[i] = ti;
+      u[i] = ui;
+      d2[i] = r0 * r0 + r1 * r1 + r2 * r2;
+    }
+  } // geo::details::LineClosestApproachKernel()
+
+  /**
+   * @brief Calls `select(i, t, u, d2)` on the lines closer than `maxDistance`.
+   * @param c reference point of the reference line
+   * @param w direction of the reference line
+   * @param lines the set of lines
+   * @param first the index of the first line to be considered
+   * @param maxDistance the largest distance of a selected line
+   * @param select the callable receiving the selected lines
+   */
+  template <typename Select>
+  void selectLinesClosestApproaches(double const* c,
+                                    double const* w,
+                                    LineArrays const& lines,
+                                    std::size_t first,
+                                    double maxDistance,
+                                    Select&& select)
+  {
+    double const maxD2 = maxDistance * maxDistance;
+    double t[LineClosestApproachBlockSize];
+    double u[LineClosestApproachBlockSize];
+    double d2[LineClosestApproachBlockSize];
+    for (std::size_t block = first; block < lines.size; block += LineClosestApproachBlockSize) {
+      std::size_t const n = std::min(LineClosestApproachBlockSize, lines.size - block);
+      LineClosestApproachKernel(c, w, lines, block, n, t, u, d2);
+      for (std::size_t i = 0; i < n; ++i) {
+        if (d2[i] <= maxD2) select(block + i, t[i], u[i], d2[i]); // rejects not finite
+      }
+    }
+  } // geo::details::selectLinesClosestApproaches()
+
+  // ---------------------------------------------------------------------------
 
 } // namespace geo::details
 
@@ -183,3 +266,46 @@ Point geo::LineClosestPointWithUnitVectors(Point const& startA,
 }
 
 // -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+template <typename Point, typename Vector>
+std::vector<geo::LineClosestApproach> geo::LinesClosestApproaches(Point const& start,
+                                                                  Vector const& dir,
+                                                                  LineArrays const& lines,
+                                                                  double maxDistance)
+{
+  double c[3], w[3];
+  geo::vect::fillCoords(c, start);
+  geo::vect::fillCoords(w, dir);
+
+  std::vector<LineClosestApproach> approaches;
+  details::selectLinesClosestApproaches(
+    c, w, lines, 0, maxDistance, [&approaches](std::size_t i, double t, double u, double d2) {
+      approaches.push_back({i, t, u, std::sqrt(d2)});
+    });
+  return approaches;
+} // geo::LinesClosestApproaches()
+
+// -----------------------------------------------------------------------------
+inline std::vector<geo::LinePairClosestApproach> geo::AllLinesClosestApproaches(
+  LineArrays const& lines,
+  double maxDistance)
+{
+  std::vector<LinePairClosestApproach> approaches;
+  for (std::size_t iRef = 0; iRef < lines.size; ++iRef) {
+    double const c[3] = {lines.startX[iRef], lines.startY[iRef], lines.startZ[iRef]};
+    double const w[3] = {lines.dirX[iRef], lines.dirY[iRef], lines.dirZ[iRef]};
+    details::selectLinesClosestApproaches(
+      c,
+      w,
+      lines,
+      iRef + 1,
+      maxDistance,
+      [&approaches, iRef](std::size_t i, double t, double u, double d2) {
+        approaches.push_back({iRef, i, t, u, std::sqrt(d2)});
+      });
+  }
+  return approaches;
+} // geo::AllLinesClosestApproaches()
+
+// -----------------------------------------------------------------------------
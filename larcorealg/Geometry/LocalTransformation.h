@@ -10,6 +10,10 @@
 #ifndef LARCOREALG_GEOMETRY_LOCALTRANSFORMATION_H
 #define LARCOREALG_GEOMETRY_LOCALTRANSFORMATION_H
 
+// LArSoft libraries
+#include "larcorealg/CoreUtils/span.h"
+#include "larcorealg/Geometry/details/AffineTransformKernel.h"
+
 // ROOT libraries
 // (none)
 
@@ -50,6 +54,12 @@ namespace geo {
    * the other way around), for points and for vectors.
    * The vector version of the transformation does not apply translation.
    *
+   * Many points or vectors can be transformed with a single call, given either
+   * as a span of point objects or as three arrays of coordinates. These batch
+   * transformations use two 3x4 affine matrices, one for each direction, which
+   * are extracted from the stored transformation on construction: in
+   * particular, the world-to-local one is inverted only once.
+   *
    * @note In the class method examples, the following definition is assumed:
    * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
    * using LocalTransformation_t = geo::LocalTransformation<TGeoHMatrix>;
@@ -73,8 +83,14 @@ namespace geo {
      * The specified matrix is copied into a local copy unless a R-value
      * reference argument is specified (e.g. with `std::move()`).
      */
-    LocalTransformation(TransformationMatrix_t const& matrix) : fGeoMatrix(matrix) {}
-    LocalTransformation(TransformationMatrix_t&& matrix) : fGeoMatrix(std::move(matrix)) {}
+    LocalTransformation(TransformationMatrix_t const& matrix) : fGeoMatrix(matrix)
+    {
+      UpdateKernels();
+    }
+    LocalTransformation(TransformationMatrix_t&& matrix) : fGeoMatrix(std::move(matrix))
+    {
+      UpdateKernels();
+    }
     //@}
 
     /**
@@ -87,7 +103,9 @@ namespace geo {
      */
     LocalTransformation(std::vector<TGeoNode const*> const& path, size_t depth)
       : fGeoMatrix(transformationFromPath<StoredMatrix>(path.begin(), path.begin() + depth + 1))
-    {}
+    {
+      UpdateKernels();
+    }
 
     /**
      * @brief Constructor: chains the transformations from all specified nodes.
@@ -112,7 +130,9 @@ namespace geo {
     template <typename ITER>
     LocalTransformation(ITER begin, ITER end)
       : fGeoMatrix(transformationFromPath<StoredMatrix>(begin, end))
-    {}
+    {
+      UpdateKernels();
+    }
 
     /**
      * @brief Transforms a point from local frame to world frame
@@ -294,12 +314,135 @@ namespace geo {
     }
     //@}
 
+    /// @name Batch transformations
+    /// @{
+
+    /**
+     * @brief Transforms points from local frame to world frame.
+     * @tparam BIter type of iterator to the input (local) points
+     * @tparam EIter type of end iterator to the input points
+     * @tparam DestPoint type of the output (world) points
+     * @param local the points to be transformed [cm]
+     * @param[out] world array for the transformed points, as many as `local`
+     *
+     * The full transformation is applied. Fox example:
+     * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+     * std::vector<geo::Point_t> local = ..., world(local.size());
+     * trans.LocalToWorld(util::make_const_span(local), world.data());
+     * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+     * The output buffer must not overlap the input one.
+     */
+    template <typename BIter, typename EIter, typename DestPoint>
+    void LocalToWorld(util::span<BIter, EIter> local, DestPoint* world) const
+    {
+      fToWorld.transformPoints(local.begin(), local.end(), world);
+    }
+
+    /// Transforms vectors from local frame to world frame (no translation).
+    /// @see `LocalToWorld(util::span<BIter, EIter>, DestPoint*)`
+    template <typename BIter, typename EIter, typename DestVector>
+    void LocalToWorldVect(util::span<BIter, EIter> local, DestVector* world) const
+    {
+      fToWorld.transformVectors(local.begin(), local.end(), world);
+    }
+
+    /// Transforms points from world frame to local frame.
+    /// @see `LocalToWorld(util::span<BIter, EIter>, DestPoint*)`
+    template <typename BIter, typename EIter, typename DestPoint>
+    void WorldToLocal(util::span<BIter, EIter> world, DestPoint* local) const
+    {
+      fToLocal.transformPoints(world.begin(), world.end(), local);
+    }
+
+    /// Transforms vectors from world frame to local frame (no translation).
+    /// @see `LocalToWorld(util::span<BIter, EIter>, DestPoint*)`
+    template <typename BIter, typename EIter, typename DestVector>
+    void WorldToLocalVect(util::span<BIter, EIter> world, DestVector* local) const
+    {
+      fToLocal.transformVectors(world.begin(), world.end(), local);
+    }
+
+    /**
+     * @brief Transforms `n` points, given as coordinate arrays, to world frame.
+     * @param n number of points
+     * @param x array of the local _x_ coordinates of the points [cm]
+     * @param y array of the local _y_ coordinates of the points [cm]
+     * @param z array of the local _z_ coordinates of the points [cm]
+     * @param[out] worldX array for the world _x_ coordinates [cm]
+     * @param[out] worldY array for the world _y_ coordinates [cm]
+     * @param[out] worldZ array for the world _z_ coordinates [cm]
+     *
+     * None of the arrays may overlap another one.
+     */
+    void LocalToWorld(std::size_t n,
+                      double const* x,
+                      double const* y,
+                      double const* z,
+                      double* worldX,
+                      double* worldY,
+                      double* worldZ) const
+    {
+      fToWorld.transformPoints(n, x, y, z, worldX, worldY, worldZ);
+    }
+
+    /// Transforms `n` vectors, given as coordinate arrays, to world frame
+    /// (no translation).
+    void LocalToWorldVect(std::size_t n,
+                          double const* x,
+                          double const* y,
+                          double const* z,
+                          double* worldX,
+                          double* worldY,
+                          double* worldZ) const
+    {
+      fToWorld.transformVectors(n, x, y, z, worldX, worldY, worldZ);
+    }
+
+    /// Transforms `n` points, given as coordinate arrays, to local frame.
+    void WorldToLocal(std::size_t n,
+                      double const* x,
+                      double const* y,
+                      double const* z,
+                      double* localX,
+                      double* localY,
+                      double* localZ) const
+    {
+      fToLocal.transformPoints(n, x, y, z, localX, localY, localZ);
+    }
+
+    /// Transforms `n` vectors, given as coordinate arrays, to local frame
+    /// (no translation).
+    void WorldToLocalVect(std::size_t n,
+                          double const* x,
+                          double const* y,
+                          double const* z,
+                          double* localX,
+                          double* localY,
+                          double* localZ) const
+    {
+      fToLocal.transformVectors(n, x, y, z, localX, localY, localZ);
+    }
+
+    /// Returns the affine matrix of the local-to-world transformation.
+    details::AffineTransformKernel const& LocalToWorldKernel() const { return fToWorld; }
+
+    /// Returns the affine matrix of the world-to-local transformation.
+    details::AffineTransformKernel const& WorldToLocalKernel() const { return fToLocal; }
+
+    /// @}
+
     /// Direct access to the transformation matrix
     TransformationMatrix_t const& Matrix() const { return fGeoMatrix; }
 
   protected:
     TransformationMatrix_t fGeoMatrix; ///< local to world transform
 
+    details::AffineTransformKernel fToWorld; ///< Local-to-world affine matrix.
+    details::AffineTransformKernel fToLocal; ///< World-to-local affine matrix.
+
+    /// Extracts the affine matrices of both directions from `fGeoMatrix`.
+    void UpdateKernels();
+
     template <typename DestPoint, typename SrcPoint>
     DestPoint LocalToWorldImpl(SrcPoint const& local) const;
 
@@ -96,6 +96,27 @@ void geo::LocalTransformation<Matrix>::WorldToLocalVect(const double* world, dou
   fGeoMatrix.MasterToLocalVect(world, local);
 } // geo::LocalTransformation::WorldToLocalVect()
 
+//------------------------------------------------------------------------------
+template <typename Matrix>
+void geo::LocalTransformation<Matrix>::UpdateKernels()
+{
+  // the images of the origin and of the axes are the columns of the matrices;
+  // this works with any stored matrix, and the inverse is computed only here
+  double const origin[3] = {0.0, 0.0, 0.0};
+  double const axes[3][3] = {{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}};
+  double shift[3], images[3][3];
+
+  LocalToWorld(origin, shift);
+  for (std::size_t i = 0; i < 3; ++i)
+    LocalToWorldVect(axes[i], images[i]);
+  fToWorld = details::AffineTransformKernel::fromImages(shift, images[0], images[1], images[2]);
+
+  WorldToLocal(origin, shift);
+  for (std::size_t i = 0; i < 3; ++i)
+    WorldToLocalVect(axes[i], images[i]);
+  fToLocal = details::AffineTransformKernel::fromImages(shift, images[0], images[1], images[2]);
+} // geo::LocalTransformation::UpdateKernels()
+
 //------------------------------------------------------------------------------
 template <typename Matrix>
 template <typename DestPoint, typename SrcPoint>
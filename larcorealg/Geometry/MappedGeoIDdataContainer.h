@@ -0,0 +1,425 @@
+/**
+ * @file   larcorealg/Geometry/MappedGeoIDdataContainer.h
+ * @brief  Read-only container of geometry data in a memory-mapped file.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/GeometryDataContainers.h`
+ * @ingroup Geometry
+ *
+ * This is a header-only library. The memory mapping uses POSIX `mmap()`.
+ */
+
+#ifndef LARCOREALG_GEOMETRY_MAPPEDGEOIDDATACONTAINER_H
+#define LARCOREALG_GEOMETRY_MAPPEDGEOIDDATACONTAINER_H
+
+// LArSoft libraries
+#include "larcorealg/CoreUtils/span.h"
+#include "larcorealg/Geometry/GeoIDdataSerialization.h"
+#include "larcorealg/Geometry/GeometryDataContainers.h"
+#include "larcorealg/Geometry/GeometryIDmapper.h"
+#include "larcorealg/Geometry/TaskRunner.h"
+
+// framework libraries
+#include "cetlib_except/exception.h"
+
+// POSIX
+#include <fcntl.h>    // open()
+#include <sys/mman.h> // mmap(), munmap()
+#include <sys/stat.h> // fstat()
+#include <unistd.h>   // close()
+
+// C/C++ standard libraries
+#include <cerrno>
+#include <cstddef> // std::size_t
+#include <cstring> // std::memcpy(), std::strerror()
+#include <fstream>
+#include <memory> // std::addressof()
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility> // std::exchange(), std::index_sequence
+
+namespace geo {
+
+  template <typename T, typename Mapper>
+  class MappedGeoIDdataContainer;
+
+  /// Read-only data per TPC from a memory-mapped file.
+  template <typename T>
+  using MappedTPCDataContainer = MappedGeoIDdataContainer<T, geo::TPCIDmapper<>>;
+
+  /// Read-only data per plane from a memory-mapped file.
+  template <typename T>
+  using MappedPlaneDataContainer = MappedGeoIDdataContainer<T, geo::PlaneIDmapper<>>;
+
+  template <typename T, typename Mapper, typename Allocator>
+  void writeMappedGeoIDdata(std::string const& path,
+                            geo::GeoIDdataContainer<T, Mapper, Allocator> const& data);
+
+  namespace details {
+
+    /// Read-only memory mapping of a whole file; it can be moved, not copied.
+    class ReadOnlyFileMapping {
+    public:
+      ReadOnlyFileMapping() = default;
+
+      /// Maps the whole file at `path`.
+      /// @throw cet::exception (category: `"MappedGeoIDdataContainer"`) on failure
+      explicit ReadOnlyFileMapping(std::string const& path);
+
+      ReadOnlyFileMapping(ReadOnlyFileMapping const&) = delete;
+      ReadOnlyFileMapping& operator=(ReadOnlyFileMapping const&) = delete;
+
+      ReadOnlyFileMapping(ReadOnlyFileMapping&& other) noexcept
+        : fData(std::exchange(other.fData, nullptr)), fSize(std::exchange(other.fSize, 0U))
+      {}
+
+      ReadOnlyFileMapping& operator=(ReadOnlyFileMapping&& other) noexcept
+      {
+        if (this != &other) {
+          unmap();
+          fData = std::exchange(other.fData, nullptr);
+          fSize = std::exchange(other.fSize, 0U);
+        }
+        return *this;
+      }
+
+      ~ReadOnlyFileMapping() { unmap(); }
+
+      /// Returns the start of the mapped file.
+      std::byte const* data() const { return static_cast<std::byte const*>(fData); }
+
+      /// Returns the size of the mapped file, in bytes.
+      std::size_t size() const { return fSize; }
+
+    private:
+      void* fData = nullptr;  ///< Start of the mapped memory.
+      std::size_t fSize = 0U; ///< Size of the mapped memory.
+
+      void unmap() noexcept
+      {
+        if (fData) munmap(fData, fSize);
+      }
+
+    }; // class ReadOnlyFileMapping
+
+  } // namespace details
+
+} // namespace geo
+
+//------------------------------------------------------------------------------
+/**
+ * @brief Read-only container of geometry data stored in a memory-mapped file.
+ * @tparam T type of the contained datum (must be trivially copyable)
+ * @tparam Mapper type of mapping between IDs and index
+ * @see `geo::writeMappedGeoIDdata()`, `geo::GeoIDdataContainer`
+ *
+ * This container has the read-only interface of `geo::GeoIDdataContainer`,
+ * but its data is not loaded: it lives in a file which is mapped in memory,
+ * and the pages are read by the operating system on demand. Different
+ * processes mapping the same file share the same memory (the page cache),
+ * and the opening takes constant time.
+ *
+ * The file is written by `geo::writeMappedGeoIDdata()` from a regular
+ * container of the same mapper. It has a header with the dimensions of the
+ * mapper and the size of the elements, which are checked when opening it.
+ * The file is bound to the layout of `T`, and it is not portable between
+ * machines with different byte order or between builds with different
+ * definitions of `T`.
+ *
+ * Example, where the tables are written once and read in each job:
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * geo::PlaneDataContainer<WireCalib> calib
+ *   = geom->makePlaneData<WireCalib>(); // filled from the database...
+ * geo::writeMappedGeoIDdata("calib.dat", calib);
+ *
+ * // later, in many processes:
+ * geo::MappedPlaneDataContainer<WireCalib> const calib{"calib.dat"};
+ * WireCalib const& planeCalib = calib[planeID];
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * Moving the container invalidates its iterators.
+ */
+template <typename T, typename Mapper>
+class geo::MappedGeoIDdataContainer {
+
+  static_assert(std::is_trivially_copyable_v<T>,
+                "MappedGeoIDdataContainer requires a trivially copyable type");
+
+  using Header_t = details::GeoIDdataHeader;
+
+  static_assert(alignof(T) <= sizeof(Header_t),
+                "MappedGeoIDdataContainer does not support this alignment");
+
+public:
+  /// Type of mapper between IDs and index.
+  using Mapper_t = Mapper;
+
+  using ID_t = typename Mapper_t::ID_t; ///< Type used as ID for this container.
+
+  /// @{
+  /// @name STL container types.
+
+  using value_type = T;
+  using reference = T const&;
+  using const_reference = T const&;
+  using pointer = T const*;
+  using const_pointer = T const*;
+  using iterator = details::GeoIDdataContainerIterator<Mapper_t, T const*>;
+  using const_iterator = iterator;
+  using difference_type = std::ptrdiff_t;
+  using size_type = std::size_t;
+
+  /// Special iterator dereferencing to pairs ( ID, value ) (see `items()`).
+  using item_const_iterator = details::GeoIDdataContainerItemIterator<const_iterator>;
+  using item_iterator = item_const_iterator;
+
+  /// @}
+
+  /**
+   * @brief Maps the data in the file at `path`.
+   * @param path the path of the file with the data
+   * @throw cet::exception (category: `"MappedGeoIDdataContainer"`) if the file
+   *        can't be mapped, or it does not match this type of container
+   */
+  explicit MappedGeoIDdataContainer(std::string const& path);
+
+  /**
+   * @brief Maps the data in the file at `path`, checking its dimensions.
+   * @param path the path of the file with the data
+   * @param expected a mapper with the dimensions expected in the file
+   * @throw cet::exception (category: `"MappedGeoIDdataContainer"`) also if the
+   *        dimensions in the file are not the ones of `expected`
+   */
+  MappedGeoIDdataContainer(std::string const& path, Mapper_t const& expected);
+
+  // --- BEGIN Container status query ----------------------------------------
+  /// @name Container status query
+  /// @{
+
+  /// Returns the number of elements in the container.
+  size_type size() const { return mapper().size(); }
+
+  /// Returns whether the container has no elements.
+  bool empty() const { return size() == 0U; }
+
+  /// Dimensions of the `Level` dimension of this container.
+  template <std::size_t Level>
+  unsigned int dimSize() const
+  {
+    return mapper().template dimSize<Level>();
+  }
+
+  /// Dimensions of the ID of this container.
+  static constexpr unsigned int dimensions() { return Mapper_t::dimensions(); }
+
+  /// Returns whether this container hosts data for the specified ID.
+  template <typename GeoID>
+  bool hasElement(GeoID const& id) const
+  {
+    return mapper().template hasElement<GeoID>(id);
+  }
+
+  /// Returns the ID of the first element with GeoID type.
+  template <typename GeoID = ID_t>
+  GeoID firstID() const
+  {
+    return mapper().template firstID<GeoID>();
+  }
+
+  /// Returns the ID of the last covered element with GeoID type.
+  template <typename GeoID = ID_t>
+  GeoID lastID() const
+  {
+    return mapper().template lastID<GeoID>();
+  }
+
+  /// Returns the mapper object used to convert ID's and container positions.
+  Mapper_t const& mapper() const { return fMapper; }
+
+  /// @}
+  // --- END Container status query ------------------------------------------
+
+  // --- BEGIN Element access ------------------------------------------------
+  /// @name Element access
+  /// @{
+
+  /// Returns the element for the specified geometry element.
+  const_reference operator[](ID_t const& id) const { return fData[mapper().index(id)]; }
+
+  /// Returns the element for the specified geometry element.
+  /// @throw std::out_of_range if element `id` is not within the container range
+  const_reference at(ID_t const& id) const
+  {
+    if (hasElement(id)) return operator[](id);
+    throw std::out_of_range("No data for " + std::string(id));
+  }
+
+  /// Returns the element for the first ID.
+  const_reference first() const { return fData[0]; }
+
+  /// Returns the element for the last ID.
+  const_reference last() const { return fData[size() - 1U]; }
+
+  /// Returns a pointer to the mapped data.
+  const_pointer data() const { return fData; }
+
+  /// @}
+  // --- END Element access --------------------------------------------------
+
+  // --- BEGIN Iterators -----------------------------------------------------
+  /// @name Iterators
+  /// @see `geo::GeoIDdataContainer`
+  /// @{
+
+  const_iterator begin() const { return {mapper(), fData, fData}; }
+  const_iterator end() const { return {mapper(), fData, fData + size()}; }
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
+
+  item_const_iterator item_begin() const { return {begin()}; }
+  item_const_iterator item_end() const { return {end()}; }
+  item_const_iterator item_cbegin() const { return item_begin(); }
+  item_const_iterator item_cend() const { return item_end(); }
+
+  /// Returns an object suitable for a range-for loop with `item_const_iterator`.
+  auto items() const { return util::span{item_begin(), item_end()}; }
+
+  /// @}
+  // --- END Iterators -------------------------------------------------------
+
+  /// Applies an operation on all elements, and returns it.
+  template <typename Op>
+  Op apply(Op&& op) const
+  {
+    for (auto const& data : *this)
+      op(data);
+    return op;
+  }
+
+  /// Applies an operation on all elements, possibly concurrently.
+  /// @see `geo::GeoIDdataContainer::apply(TaskRunner_t const&, Op&&)`
+  template <typename Op>
+  void apply(TaskRunner_t const& runner, Op&& op) const
+  {
+    details::applyInBlocks(fData, size(), runner, op);
+  }
+
+private:
+  details::ReadOnlyFileMapping fMapping; ///< The mapped file.
+  Mapper_t fMapper;                      ///< Mapping of IDs to indices.
+  T const* fData = nullptr;              ///< Start of the data in the mapped file.
+
+  /// Returns a mapper with the dimensions in `header`.
+  template <std::size_t... Levels>
+  static Mapper_t makeMapper(Header_t const& header, std::index_sequence<Levels...>)
+  {
+    return Mapper_t{header.dimSizes[Levels]...};
+  }
+
+  /// Returns whether `mapper` has the same dimensions as this container.
+  template <std::size_t... Levels>
+  bool sameDimensions(Mapper_t const& mapper, std::index_sequence<Levels...>) const
+  {
+    return ((mapper.template dimSize<Levels>() == dimSize<Levels>()) && ...);
+  }
+
+}; // class geo::MappedGeoIDdataContainer<>
+
+//------------------------------------------------------------------------------
+//--- inline implementation
+//------------------------------------------------------------------------------
+inline geo::details::ReadOnlyFileMapping::ReadOnlyFileMapping(std::string const& path)
+{
+  int const fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    throw cet::exception("MappedGeoIDdataContainer")
+      << "Can't open '" << path << "': " << std::strerror(errno) << "\n";
+  }
+  struct stat info;
+  if (fstat(fd, &info) != 0) {
+    int const error = errno;
+    close(fd);
+    throw cet::exception("MappedGeoIDdataContainer")
+      << "Can't query '" << path << "': " << std::strerror(error) << "\n";
+  }
+  fSize = static_cast<std::size_t>(info.st_size);
+  void* const data = (fSize > 0U) ? mmap(nullptr, fSize, PROT_READ, MAP_SHARED, fd, 0) : nullptr;
+  int const error = errno;
+  close(fd); // the mapping stays valid after the file is closed
+  if (data == MAP_FAILED) {
+    fSize = 0U;
+    throw cet::exception("MappedGeoIDdataContainer")
+      << "Can't map '" << path << "': " << std::strerror(error) << "\n";
+  }
+  fData = data;
+} // geo::details::ReadOnlyFileMapping::ReadOnlyFileMapping()
+
+//------------------------------------------------------------------------------
+//--- template implementation
+//------------------------------------------------------------------------------
+template <typename T, typename Mapper>
+geo::MappedGeoIDdataContainer<T, Mapper>::MappedGeoIDdataContainer(std::string const& path)
+  : fMapping(path)
+{
+  auto const fail = [&path]() -> cet::exception {
+    return cet::exception("MappedGeoIDdataContainer") << "File '" << path << "': ";
+  };
+
+  if (fMapping.size() < sizeof(Header_t)) throw fail() << "too small for a header.\n";
+  Header_t header;
+  std::memcpy(&header, fMapping.data(), sizeof(Header_t));
+
+  if (header.byteOrder != Header_t::ByteOrder) throw fail() << "written with another byte order.\n";
+  if (std::string const problem = details::checkGeoIDdataHeader<T, dimensions()>(header);
+      !problem.empty())
+    throw fail() << problem << ".\n";
+
+  fMapper = makeMapper(header, std::make_index_sequence<dimensions()>{});
+  if (header.nElements != fMapper.size()) {
+    throw fail() << header.nElements << " elements, " << fMapper.size()
+                 << " expected from the dimensions.\n";
+  }
+  if ((header.dataOffset % alignof(T) != 0U) ||
+      (header.dataOffset + header.nElements * sizeof(T) > fMapping.size()))
+    throw fail() << "data is truncated or misplaced.\n";
+
+  fData = reinterpret_cast<T const*>(fMapping.data() + header.dataOffset);
+} // geo::MappedGeoIDdataContainer<>::MappedGeoIDdataContainer()
+
+//------------------------------------------------------------------------------
+template <typename T, typename Mapper>
+geo::MappedGeoIDdataContainer<T, Mapper>::MappedGeoIDdataContainer(std::string const& path,
+                                                                   Mapper_t const& expected)
+  : MappedGeoIDdataContainer(path)
+{
+  if (!sameDimensions(expected, std::make_index_sequence<dimensions()>{})) {
+    throw cet::exception("MappedGeoIDdataContainer")
+      << "File '" << path << "': dimensions do not match the expected ones.\n";
+  }
+} // geo::MappedGeoIDdataContainer<>::MappedGeoIDdataContainer(Mapper_t)
+
+//------------------------------------------------------------------------------
+/**
+ * @brief Writes the content of a container into a file for memory mapping.
+ * @param path the path of the file to be written (overwritten if existing)
+ * @param data the container to be written
+ * @throw cet::exception (category: `"MappedGeoIDdataContainer"` or
+ *        `"GeoIDdataSerialization"`) on failure
+ * @see `geo::MappedGeoIDdataContainer`, `geo::writeGeoIDdata()`
+ */
+template <typename T, typename Mapper, typename Allocator>
+void geo::writeMappedGeoIDdata(std::string const& path,
+                               geo::GeoIDdataContainer<T, Mapper, Allocator> const& data)
+{
+  std::ofstream out{path, std::ios::binary | std::ios::trunc};
+  geo::writeGeoIDdata(out, data);
+  out.close();
+  if (!out) {
+    throw cet::exception("MappedGeoIDdataContainer")
+      << "Failed writing geometry data into '" << path << "'.\n";
+  }
+} // geo::writeMappedGeoIDdata()
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREALG_GEOMETRY_MAPPEDGEOIDDATACONTAINER_H
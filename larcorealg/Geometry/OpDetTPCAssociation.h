@@ -0,0 +1,289 @@
+/**
+ * @file   larcorealg/Geometry/OpDetTPCAssociation.h
+ * @brief  Table of the optical detectors facing each TPC, and vice versa.
+ * @date   October 14, 2026
+ * @see    `geo::GeometryCore::MakeOpDetTPCAssociation()`
+ *
+ * This is a header only library.
+ */
+
+#ifndef LARCOREALG_GEOMETRY_OPDETTPCASSOCIATION_H
+#define LARCOREALG_GEOMETRY_OPDETTPCASSOCIATION_H
+
+// LArSoft libraries
+#include "larcorealg/CoreUtils/MemoryUsage.h" // lar::util::heapMemory()
+#include "larcorealg/CoreUtils/span.h"
+#include "larcorealg/Geometry/GeometryIDmapper.h" // geo::TPCIDmapper
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::min(), std::max()
+#include <array>
+#include <cmath>   // std::abs(), std::sqrt()
+#include <cstddef> // std::size_t
+#include <utility> // std::pair
+#include <vector>
+
+namespace geo {
+
+  /**
+   * @brief Association between optical detectors and the TPCs they face.
+   *
+   * For each TPC, the table lists the optical detectors (by their number in
+   * the whole detector, as in `geo::GeometryCore::OpDetGeoFromOpDet()`) which
+   * can see the light from that TPC; for each optical detector, it lists the
+   * TPCs it faces. Both lists are sorted, and are returned as spans into
+   * contiguous arrays, so that a loop on the detectors of a flash can skip the
+   * ones which are not relevant.
+   *
+   * An optical detector is associated to a TPC of its same cryostat if:
+   * * its center is within `maxDistance()` from the active volume of the TPC;
+   * * or its center is on the anode side of the TPC (beyond the end of the
+   *   active volume the electrons drift toward), within the transverse
+   *   extension of the active volume, and with no other TPC of the cryostat
+   *   in between.
+   *
+   * The second criterion covers the usual layout with the light detectors
+   * behind the wire planes; the first one covers detectors on the side walls
+   * or on the cathode.
+   *
+   * The drift direction of a TPC is expected to be along one of the axes of
+   * the world frame; the axis with the largest component of the direction is
+   * used.
+   */
+  class OpDetTPCAssociation {
+
+  public:
+    /// Type of coordinates of a point or vector.
+    using Coords_t = std::array<double, 3U>;
+
+    /// Information on a TPC used to build the association.
+    struct TPCInfo_t {
+      geo::TPCID ID;     ///< ID of the TPC.
+      Coords_t min;      ///< Lower corner of the active volume [cm]
+      Coords_t max;      ///< Upper corner of the active volume [cm]
+      Coords_t driftDir; ///< Drift direction (toward the anode).
+    };
+
+    /// Information on an optical detector used to build the association.
+    struct OpDetInfo_t {
+      geo::CryostatID::CryostatID_t cryostat; ///< Cryostat of the detector.
+      Coords_t center;                        ///< Center of the detector [cm]
+    };
+
+    /// Type of list of optical detector numbers.
+    using OpDetSpan_t = util::span<unsigned int const*>;
+
+    /// Type of list of TPC IDs.
+    using TPCIDspan_t = util::span<geo::TPCID const*>;
+
+    /// Constructor: an empty association.
+    OpDetTPCAssociation() = default;
+
+    /**
+     * @brief Builds the association.
+     * @param TPCs information on all the TPCs
+     * @param opDets information on all the optical detectors, by number
+     * @param maxDistance maximum distance of a detector from a TPC [cm]
+     */
+    OpDetTPCAssociation(std::vector<TPCInfo_t> const& TPCs,
+                        std::vector<OpDetInfo_t> const& opDets,
+                        double maxDistance = 0.0);
+
+    /// Returns the optical detectors facing the TPC `tpcid` (empty if none).
+    OpDetSpan_t opDets(geo::TPCID const& tpcid) const
+    {
+      if (!tpcid.isValid || !fTPCIndex.hasElement(tpcid)) return {};
+      return rangeAt(fTPCOpDetOffsets, fTPCOpDets, fTPCIndex.index(tpcid));
+    }
+
+    /// Returns the TPCs faced by the optical detector `opDet` (empty if none).
+    TPCIDspan_t TPCs(unsigned int opDet) const
+    {
+      return rangeAt(fOpDetTPCOffsets, fOpDetTPCs, opDet);
+    }
+
+    /// Returns the number of optical detectors in the association.
+    std::size_t nOpDets() const
+    {
+      return fOpDetTPCOffsets.empty() ? 0U : fOpDetTPCOffsets.size() - 1U;
+    }
+
+    /// Returns the number of (TPC, optical detector) pairs.
+    std::size_t nAssociations() const { return fTPCOpDets.size(); }
+
+    /// Returns whether there is no pair at all.
+    bool empty() const { return fTPCOpDets.empty(); }
+
+    /// Returns the distance the association was built with [cm]
+    double maxDistance() const { return fMaxDistance; }
+
+    /// Returns the memory allocated by the tables, besides its own size [bytes]
+    std::size_t heapMemory() const
+    {
+      return lar::util::heapMemory(fTPCOpDetOffsets) + lar::util::heapMemory(fTPCOpDets) +
+             lar::util::heapMemory(fOpDetTPCOffsets) + lar::util::heapMemory(fOpDetTPCs);
+    }
+
+    /// Returns the distance of `point` from the active volume of `tpc` [cm]
+    static double distanceFromTPC(TPCInfo_t const& tpc, Coords_t const& point);
+
+    /**
+     * @brief Returns whether `point` is on the anode side of `tpc`.
+     * @return the drift axis and the distance from the anode face, or
+     *         `{ -1, 0.0 }` if the point is not in the "shadow" of the TPC
+     */
+    static std::pair<int, double> anodeSide(TPCInfo_t const& tpc, Coords_t const& point);
+
+  private:
+    double fMaxDistance = 0.0; ///< Distance the association was built with.
+
+    geo::TPCIDmapper<> fTPCIndex; ///< Index of each TPC in the offsets.
+
+    std::vector<unsigned int> fTPCOpDetOffsets; ///< Start of each TPC in `fTPCOpDets`.
+    std::vector<unsigned int> fTPCOpDets;       ///< Detectors of all the TPCs.
+
+    std::vector<unsigned int> fOpDetTPCOffsets; ///< Start of each detector in `fOpDetTPCs`.
+    std::vector<geo::TPCID> fOpDetTPCs;         ///< TPCs of all the detectors.
+
+    /// Returns the elements of `values` in the range `index` of `offsets`.
+    template <typename T>
+    static util::span<T const*> rangeAt(std::vector<unsigned int> const& offsets,
+                                        std::vector<T> const& values,
+                                        std::size_t index)
+    {
+      if (index + 1U >= offsets.size()) return {};
+      T const* const start = values.data();
+      return {start + offsets[index], start + offsets[index + 1U]};
+    }
+
+    /// Returns the axis with the largest component of `dir`.
+    static int mainAxis(Coords_t const& dir);
+
+    /// Returns whether another TPC is between `point` and the anode face of
+    /// `tpc`, `depth` away along `axis`.
+    static bool isBlocked(std::vector<TPCInfo_t> const& TPCs,
+                          TPCInfo_t const& tpc,
+                          Coords_t const& point,
+                          int axis,
+                          double depth);
+
+  }; // class OpDetTPCAssociation
+
+} // namespace geo
+
+//------------------------------------------------------------------------------
+//--- inline implementation
+//------------------------------------------------------------------------------
+inline geo::OpDetTPCAssociation::OpDetTPCAssociation(std::vector<TPCInfo_t> const& TPCs,
+                                                     std::vector<OpDetInfo_t> const& opDets,
+                                                     double maxDistance)
+  : fMaxDistance{maxDistance}
+{
+  unsigned int nCryostats = 0U, maxTPCs = 0U;
+  for (TPCInfo_t const& tpc : TPCs) {
+    nCryostats = std::max(nCryostats, tpc.ID.Cryostat + 1U);
+    maxTPCs = std::max(maxTPCs, tpc.ID.TPC + 1U);
+  }
+  fTPCIndex.resize(nCryostats, maxTPCs);
+
+  // pairs are found by TPC, in order of TPC index and detector number
+  std::vector<std::vector<unsigned int>> TPCOpDets(fTPCIndex.size());
+  std::vector<unsigned int> nOpDetTPCs(opDets.size(), 0U);
+  for (TPCInfo_t const& tpc : TPCs) {
+    std::vector<unsigned int>& assns = TPCOpDets[fTPCIndex.index(tpc.ID)];
+    for (unsigned int opDet = 0; opDet < opDets.size(); ++opDet) {
+      OpDetInfo_t const& info = opDets[opDet];
+      if (info.cryostat != tpc.ID.Cryostat) continue;
+
+      bool associated = distanceFromTPC(tpc, info.center) <= maxDistance;
+      if (!associated) {
+        auto const [axis, depth] = anodeSide(tpc, info.center);
+        associated = (axis >= 0) && !isBlocked(TPCs, tpc, info.center, axis, depth);
+      }
+      if (!associated) continue;
+      assns.push_back(opDet);
+      ++nOpDetTPCs[opDet];
+    } // for detectors
+  }   // for TPCs
+
+  fTPCOpDetOffsets.assign(1U, 0U);
+  fTPCOpDetOffsets.reserve(TPCOpDets.size() + 1U);
+  for (std::vector<unsigned int> const& assns : TPCOpDets) {
+    fTPCOpDets.insert(fTPCOpDets.end(), assns.begin(), assns.end());
+    fTPCOpDetOffsets.push_back(fTPCOpDets.size());
+  }
+
+  // the reverse association, filled in order of TPC index (that is, sorted)
+  fOpDetTPCOffsets.assign(opDets.size() + 1U, 0U);
+  for (unsigned int opDet = 0; opDet < opDets.size(); ++opDet)
+    fOpDetTPCOffsets[opDet + 1U] = fOpDetTPCOffsets[opDet] + nOpDetTPCs[opDet];
+  fOpDetTPCs.resize(fOpDetTPCOffsets.back());
+  std::vector<unsigned int> next(fOpDetTPCOffsets.begin(), fOpDetTPCOffsets.end() - 1);
+  for (std::size_t index = 0; index < TPCOpDets.size(); ++index) {
+    geo::TPCID const tpcid = fTPCIndex.ID(index);
+    for (unsigned int opDet : TPCOpDets[index])
+      fOpDetTPCs[next[opDet]++] = tpcid;
+  }
+} // geo::OpDetTPCAssociation::OpDetTPCAssociation()
+
+//------------------------------------------------------------------------------
+inline double geo::OpDetTPCAssociation::distanceFromTPC(TPCInfo_t const& tpc,
+                                                        Coords_t const& point)
+{
+  double d2 = 0.0;
+  for (int k = 0; k < 3; ++k) {
+    double const d = std::max({tpc.min[k] - point[k], 0.0, point[k] - tpc.max[k]});
+    d2 += d * d;
+  }
+  return std::sqrt(d2);
+} // geo::OpDetTPCAssociation::distanceFromTPC()
+
+//------------------------------------------------------------------------------
+inline std::pair<int, double> geo::OpDetTPCAssociation::anodeSide(TPCInfo_t const& tpc,
+                                                                  Coords_t const& point)
+{
+  int const axis = mainAxis(tpc.driftDir);
+  for (int k = 0; k < 3; ++k) {
+    if (k == axis) continue;
+    if ((point[k] < tpc.min[k]) || (point[k] > tpc.max[k])) return {-1, 0.0};
+  }
+  double const depth =
+    (tpc.driftDir[axis] > 0.0) ? point[axis] - tpc.max[axis] : tpc.min[axis] - point[axis];
+  return (depth >= 0.0) ? std::pair{axis, depth} : std::pair{-1, 0.0};
+} // geo::OpDetTPCAssociation::anodeSide()
+
+//------------------------------------------------------------------------------
+inline int geo::OpDetTPCAssociation::mainAxis(Coords_t const& dir)
+{
+  int axis = 0;
+  for (int k = 1; k < 3; ++k)
+    if (std::abs(dir[k]) > std::abs(dir[axis])) axis = k;
+  return axis;
+} // geo::OpDetTPCAssociation::mainAxis()
+
+//------------------------------------------------------------------------------
+inline bool geo::OpDetTPCAssociation::isBlocked(std::vector<TPCInfo_t> const& TPCs,
+                                                TPCInfo_t const& tpc,
+                                                Coords_t const& point,
+                                                int axis,
+                                                double depth)
+{
+  double const face = (tpc.driftDir[axis] > 0.0) ? point[axis] - depth : point[axis] + depth;
+  double const lower = std::min(point[axis], face), upper = std::max(point[axis], face);
+  for (TPCInfo_t const& other : TPCs) {
+    if ((other.ID == tpc.ID) || (other.ID.Cryostat != tpc.ID.Cryostat)) continue;
+    if ((other.max[axis] <= lower) || (other.min[axis] >= upper)) continue;
+    bool inShadow = true;
+    for (int k = 0; k < 3; ++k) {
+      if (k == axis) continue;
+      inShadow = inShadow && (point[k] >= other.min[k]) && (point[k] <= other.max[k]);
+    }
+    if (inShadow) return true;
+  }
+  return false;
+} // geo::OpDetTPCAssociation::isBlocked()
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREALG_GEOMETRY_OPDETTPCASSOCIATION_H
@@ -0,0 +1,321 @@
+/**
+ * @file   larcorealg/Geometry/PartitionGrid.h
+ * @brief  Uniform grid replacing the search in a `geo::part::Partition`.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/Partitions.h`
+ *
+ * This is a header only library.
+ */
+
+#ifndef LARCOREALG_GEOMETRY_PARTITIONGRID_H
+#define LARCOREALG_GEOMETRY_PARTITIONGRID_H
+
+// LArSoft libraries
+#include "larcorealg/CoreUtils/MemoryUsage.h"
+#include "larcorealg/Geometry/Partitions.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::sort(), std::unique(), std::min(), std::max()
+#include <cmath>     // std::floor()
+#include <cstddef>   // std::size_t
+#include <cstdint>   // std::uint8_t
+#include <numeric>   // std::accumulate()
+#include <utility>   // std::pair
+#include <vector>
+
+namespace geo::part {
+
+  /**
+   * @brief Flat lookup table of the data of a partition.
+   * @tparam Data type of data in the partition
+   *
+   * The area of any partition hierarchy is "compiled" into a uniform grid of
+   * cells, and each cell stores the datum `atPoint()` of the partition
+   * returns in that cell. A lookup is then a couple of multiplications,
+   * instead of the descent through the hierarchy of the partition.
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * geo::part::PartitionGrid<Region const> const grid{ *regions };
+   * Region const* region = grid.atPoint(w, d); // same as regions->atPoint(w, d)
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   *
+   * Each partition in the hierarchy assigns a point to one of its
+   * subpartitions according to their borders, which extend (as seen from that
+   * partition) all across its own area. The cells crossed by one of those
+   * borders are marked, and the points in them, as well as the points out of
+   * the grid, are looked up in the partition itself ("boundary fallback"):
+   * the result is always the same as the one of
+   * `geo::part::Partition::atPoint()`. A border only marks the cells in the
+   * area of the partition which uses it, so that the borders of small areas
+   * deep in the hierarchy do not force the fallback elsewhere.
+   *
+   * The resolution of the grid is either chosen directly, as the number of
+   * cells on each direction, or derived from the number of borders.
+   * The grid keeps a pointer to the partition, which must stay valid.
+   */
+  template <typename Data>
+  class PartitionGrid {
+
+  public:
+    using Partition_t = geo::part::Partition<Data>; ///< Type of partition.
+    using Data_t = typename Partition_t::Data_t;    ///< Type of datum.
+    using Area_t = typename Partition_t::Area_t;    ///< Type of area.
+
+    /// Number of cells on each direction.
+    struct CellCount_t {
+      unsigned int width = 0U; ///< Number of cells on the width direction.
+      unsigned int depth = 0U; ///< Number of cells on the depth direction.
+    };
+
+    /// Default number of cells for each interval between borders.
+    static constexpr unsigned int DefaultCellsPerInterval = 16U;
+
+    /// Largest number of cells on each direction.
+    static constexpr unsigned int MaxCellsPerAxis = 512U;
+
+    /// Constructor: an empty grid, which looks up nothing.
+    PartitionGrid() = default;
+
+    /**
+     * @brief Builds the grid for the specified partition.
+     * @param partition the partition to be flattened
+     * @param cellsPerInterval cells for each interval between borders
+     *
+     * On each direction, the number of cells is `cellsPerInterval` times the
+     * number of intervals between the borders of the areas in the partition,
+     * capped at `MaxCellsPerAxis`. About one cell every `cellsPerInterval`
+     * contains a border and may need the fallback.
+     */
+    explicit PartitionGrid(Partition_t const& partition,
+                           unsigned int cellsPerInterval = DefaultCellsPerInterval);
+
+    /**
+     * @brief Builds the grid for the specified partition and resolution.
+     * @param partition the partition to be flattened
+     * @param cells number of cells on each direction
+     *
+     * The numbers are not capped. A direction with no cell has all its points
+     * looked up with the fallback.
+     */
+    PartitionGrid(Partition_t const& partition, CellCount_t cells);
+
+    /// Returns whether the grid was built on a partition.
+    bool empty() const { return fPartition == nullptr; }
+
+    /// Returns the partition this grid was built from (`nullptr` if none).
+    Partition_t const* partition() const { return fPartition; }
+
+    /// Returns the number of cells on the width direction.
+    unsigned int nWidthCells() const { return fWidth.nCells; }
+
+    /// Returns the number of cells on the depth direction.
+    unsigned int nDepthCells() const { return fDepth.nCells; }
+
+    /// Returns the number of cells which need the fallback.
+    std::size_t nBoundaryCells() const
+    {
+      return std::accumulate(fBoundary.cbegin(), fBoundary.cend(), std::size_t{0});
+    }
+
+    /// Returns whether the cell including the point needs the fallback.
+    bool onBoundary(double w, double d) const { return cellIndex(w, d) == NoCell; }
+
+    /**
+     * @brief Returns the datum of the partition including the point.
+     * @param w width coordinate of the point
+     * @param d depth coordinate of the point
+     * @return the datum, as `partition()->atPoint(w, d)` (`nullptr` if none)
+     */
+    Data_t* atPoint(double w, double d) const;
+
+    /// Returns the memory allocated by the grid, besides its own size [bytes]
+    std::size_t heapMemory() const
+    {
+      return lar::util::heapMemory(fCells) + lar::util::heapMemory(fBoundary);
+    }
+
+  private:
+    /// Index of no cell.
+    static constexpr std::size_t NoCell = ~std::size_t{0};
+
+    /// Fraction of a cell a border may be off its position, against rounding.
+    static constexpr double Tolerance = 1e-3;
+
+    /// Cells on one direction.
+    struct Axis_t {
+      double lower = 0.0;       ///< Start of the first cell.
+      double cellSize = 0.0;    ///< Size of each cell.
+      double invCellSize = 0.0; ///< Inverse of the cell size.
+      unsigned int nCells = 0U; ///< Number of cells.
+
+      /// Sets `n` cells covering the `range` (none if the range is empty).
+      template <typename Range>
+      void setup(Range const& range, unsigned int n);
+
+      /// Returns the cell including `c`, or `nCells` if none.
+      unsigned int cellOf(double c) const
+      {
+        double const f = (c - lower) * invCellSize;
+        return ((f >= 0.0) && (f < nCells)) ? static_cast<unsigned int>(f) : nCells;
+      }
+
+      /// Returns the cells [`first`, `last`[ overlapping [`a`, `b`] (with tolerance).
+      std::pair<unsigned int, unsigned int> cellsOverlapping(double a, double b) const;
+
+      /// Returns the center of the cell `i`.
+      double cellCenter(unsigned int i) const { return lower + (i + 0.5) * cellSize; }
+    }; // Axis_t
+
+    Partition_t const* fPartition = nullptr; ///< The flattened partition.
+    Axis_t fWidth;                           ///< Cells on the width direction.
+    Axis_t fDepth;                           ///< Cells on the depth direction.
+    std::vector<Data_t*> fCells;             ///< Data of all cells, by width.
+    std::vector<std::uint8_t> fBoundary;     ///< Whether each cell has a border.
+
+    /// Returns the number of cells for `cellsPerInterval` cells between borders.
+    static CellCount_t cellsFromBorders(Partition_t const& partition,
+                                        unsigned int cellsPerInterval);
+
+    /// Marks the cells on the borders of `area`, spanning all of `span`.
+    void markBorders(Area_t const& area, Area_t const& span);
+
+    /// Returns the index of the cell including the point, `NoCell` if fallback.
+    std::size_t cellIndex(double w, double d) const;
+
+  }; // class PartitionGrid
+
+} // namespace geo::part
+
+//------------------------------------------------------------------------------
+//--- template implementation
+//------------------------------------------------------------------------------
+template <typename Data>
+geo::part::PartitionGrid<Data>::PartitionGrid(Partition_t const& partition,
+                                              unsigned int cellsPerInterval)
+  : PartitionGrid(partition, cellsFromBorders(partition, cellsPerInterval))
+{}
+
+//------------------------------------------------------------------------------
+template <typename Data>
+geo::part::PartitionGrid<Data>::PartitionGrid(Partition_t const& partition, CellCount_t cells)
+  : fPartition(&partition)
+{
+  Area_t const& area = partition.area();
+  fWidth.setup(area.width, cells.width);
+  fDepth.setup(area.depth, cells.depth);
+
+  // each partition chooses among its subpartitions by their borders
+  fBoundary.assign(std::size_t(fWidth.nCells) * fDepth.nCells, 0U);
+  markBorders(area, area);
+  partition.walk([this](Partition_t const& part) {
+    for (auto const& subpart : part.parts())
+      markBorders(subpart->area(), part.area());
+  });
+
+  // cells with a border are never used: they are left empty
+  fCells.assign(fBoundary.size(), nullptr);
+  std::size_t iCell = 0;
+  for (unsigned int iW = 0; iW < fWidth.nCells; ++iW) {
+    double const w = fWidth.cellCenter(iW);
+    for (unsigned int iD = 0; iD < fDepth.nCells; ++iD, ++iCell) {
+      if (!fBoundary[iCell]) fCells[iCell] = partition.atPoint(w, fDepth.cellCenter(iD));
+    }
+  } // for width
+
+} // geo::part::PartitionGrid<>::PartitionGrid(CellCount_t)
+
+//------------------------------------------------------------------------------
+template <typename Data>
+auto geo::part::PartitionGrid<Data>::cellsFromBorders(Partition_t const& partition,
+                                                      unsigned int cellsPerInterval)
+  -> CellCount_t
+{
+  // the partition decisions only change at the borders of the areas
+  std::vector<double> wBorders, dBorders;
+  partition.walk([&wBorders, &dBorders](Partition_t const& part) {
+    auto const& area = part.area();
+    wBorders.insert(wBorders.end(), {area.width.lower, area.width.upper});
+    dBorders.insert(dBorders.end(), {area.depth.lower, area.depth.upper});
+  });
+
+  auto const nCells = [cellsPerInterval](std::vector<double>& borders) {
+    std::sort(borders.begin(), borders.end());
+    borders.erase(std::unique(borders.begin(), borders.end()), borders.end());
+    std::size_t const nIntervals = (borders.size() > 1U) ? (borders.size() - 1U) : 1U;
+    std::size_t const n = nIntervals * std::max(cellsPerInterval, 1U);
+    return static_cast<unsigned int>(std::min<std::size_t>(n, MaxCellsPerAxis));
+  };
+  return {nCells(wBorders), nCells(dBorders)};
+} // geo::part::PartitionGrid<>::cellsFromBorders()
+
+//------------------------------------------------------------------------------
+template <typename Data>
+void geo::part::PartitionGrid<Data>::markBorders(Area_t const& area, Area_t const& span)
+{
+  auto const mark = [this](auto wCells, auto dCells) {
+    for (unsigned int iW = wCells.first; iW < wCells.second; ++iW) {
+      std::uint8_t* const row = fBoundary.data() + std::size_t(iW) * fDepth.nCells;
+      for (unsigned int iD = dCells.first; iD < dCells.second; ++iD)
+        row[iD] = 1U;
+    }
+  };
+
+  auto const spanW = fWidth.cellsOverlapping(span.width.lower, span.width.upper);
+  auto const spanD = fDepth.cellsOverlapping(span.depth.lower, span.depth.upper);
+  for (double const w : {area.width.lower, area.width.upper})
+    mark(fWidth.cellsOverlapping(w, w), spanD);
+  for (double const d : {area.depth.lower, area.depth.upper})
+    mark(spanW, fDepth.cellsOverlapping(d, d));
+} // geo::part::PartitionGrid<>::markBorders()
+
+//------------------------------------------------------------------------------
+template <typename Data>
+std::size_t geo::part::PartitionGrid<Data>::cellIndex(double w, double d) const
+{
+  unsigned int const iW = fWidth.cellOf(w);
+  unsigned int const iD = fDepth.cellOf(d);
+  if ((iW == fWidth.nCells) || (iD == fDepth.nCells)) return NoCell;
+  std::size_t const iCell = std::size_t(iW) * fDepth.nCells + iD;
+  return fBoundary[iCell] ? NoCell : iCell;
+} // geo::part::PartitionGrid<>::cellIndex()
+
+//------------------------------------------------------------------------------
+template <typename Data>
+auto geo::part::PartitionGrid<Data>::atPoint(double w, double d) const -> Data_t*
+{
+  if (!fPartition) return nullptr;
+  std::size_t const iCell = cellIndex(w, d);
+  return (iCell == NoCell) ? fPartition->atPoint(w, d) : fCells[iCell];
+} // geo::part::PartitionGrid<>::atPoint()
+
+//------------------------------------------------------------------------------
+template <typename Data>
+template <typename Range>
+void geo::part::PartitionGrid<Data>::Axis_t::setup(Range const& range, unsigned int n)
+{
+  nCells = 0U;
+  if (!(range.upper > range.lower) || (n == 0U)) return; // every point falls back
+
+  nCells = n;
+  lower = range.lower;
+  cellSize = (range.upper - range.lower) / nCells;
+  invCellSize = 1.0 / cellSize;
+} // geo::part::PartitionGrid<>::Axis_t::setup()
+
+//------------------------------------------------------------------------------
+template <typename Data>
+auto geo::part::PartitionGrid<Data>::Axis_t::cellsOverlapping(double a, double b) const
+  -> std::pair<unsigned int, unsigned int>
+{
+  if (nCells == 0U) return {0U, 0U};
+  // a border close to a cell edge marks both cells
+  double const first = std::floor((a - lower) * invCellSize - Tolerance);
+  double const last = std::floor((b - lower) * invCellSize + Tolerance) + 1.0;
+  auto const clamp = [n = double(nCells)](double i) {
+    return static_cast<unsigned int>(std::min(std::max(i, 0.0), n));
+  };
+  return {clamp(first), clamp(last)};
+} // geo::part::PartitionGrid<>::Axis_t::cellsOverlapping()
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREALG_GEOMETRY_PARTITIONGRID_H
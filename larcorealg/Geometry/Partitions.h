@@ -32,6 +32,9 @@ namespace geo {
   /// Partition-related utilities.
   namespace part {
 
+    template <typename Data>
+    class PartitionGrid;
+
     //-------------------------------------------------------------------------
     /// A basic interface for objects owning an area.
     class AreaOwner {
@@ -178,10 +181,16 @@ namespace geo {
      *
      * The partition classes do not provide algorithms to establish their
      * relations.
+     *
+     * Repeated lookups are faster on a `geo::part::PartitionGrid` compiled
+     * from the partition.
      */
     template <typename Data>
     class Partition : public PartitionBase {
 
+      template <typename>
+      friend class PartitionGrid; // needs the subpartitions
+
     public:
       using Data_t = Data;                  ///< Type of data stored in the partition.
       using Partition_t = Partition<Data>;  ///< This type.
@@ -246,6 +255,9 @@ namespace geo {
       /// Returns the number of subparts in the partition (0 if simple element).
       std::size_t nParts() const { return parts().size(); }
 
+      /// Returns the memory used by the partition and its subpartitions [bytes]
+      virtual std::size_t memoryUsage() const { return sizeof(*this); }
+
     protected:
       static Subpartitions_t const NoSubparts; ///< Subpartitions (if any).
 
@@ -309,6 +321,9 @@ namespace geo {
       // Import constructors
       using Base_t::Base_t;
 
+      /// Returns the memory used by the partition [bytes]
+      virtual std::size_t memoryUsage() const override { return sizeof(*this); }
+
     }; // class PartitionElement
 
     //--------------------------------------------------------------------------
@@ -328,6 +343,9 @@ namespace geo {
       /// Returns stored datum only if point is covered, `nullptr` otherwise.
       virtual Data_t* atPoint(double w, double d) const override;
 
+      /// Returns the memory used by the partition and its subpartitions [bytes]
+      virtual std::size_t memoryUsage() const override;
+
     protected:
       Subpartitions_t myParts; ///< List of subpartitions.
 
@@ -526,6 +544,13 @@ namespace geo {
                     unsigned int nDepthPartitions,
                     Data_t* defData = nullptr);
 
+      /// Returns the memory used by the partition and its subpartitions [bytes]
+      virtual std::size_t memoryUsage() const override
+      {
+        return Base_t::memoryUsage() - sizeof(Base_t) + sizeof(*this) +
+               (widthSeps.capacity() + depthSeps.capacity()) * sizeof(double);
+      }
+
     private:
       std::vector<double> widthSeps; ///< Separators for width dimension.
       std::vector<double> depthSeps; ///< Separators for depth dimension.
@@ -789,6 +814,17 @@ auto geo::part::PartitionContainer<Data>::atPoint(double w, double d) const -> D
   return part ? part->atPoint(w, d) : Base_t::data();
 } // geo::part::PartitionContainer<Data>::atPoint()
 
+//------------------------------------------------------------------------------
+template <typename Data>
+std::size_t geo::part::PartitionContainer<Data>::memoryUsage() const
+{
+  std::size_t bytes =
+    sizeof(*this) + myParts.capacity() * sizeof(typename Subpartitions_t::value_type);
+  for (auto const& part : myParts)
+    if (part) bytes += part->memoryUsage();
+  return bytes;
+} // geo::part::PartitionContainer<Data>::memoryUsage()
+
 //------------------------------------------------------------------------------
 template <typename Data>
 std::string geo::part::PartitionContainer<Data>::doDescribe(std::string indent,
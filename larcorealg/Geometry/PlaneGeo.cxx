@@ -25,14 +25,17 @@
 #include "TGeoManager.h"
 #include "TGeoMatrix.h"
 #include "TGeoNode.h"
+#include "TGeoVolume.h"
 #include "TMath.h"
 #include "TVector3.h"
 
 // C/C++ standard library
+#include <algorithm> // std::transform(), std::clamp(), std::min()
 #include <array>
 #include <cassert>
 #include <functional>  // std::less<>, std::greater<>, std::transform()
 #include <iterator>    // std::back_inserter()
+#include <limits>      // std::numeric_limits<>
 #include <sstream>     // std::ostringstream
 #include <type_traits> // std::is_same<>, std::decay_t<>
 
@@ -120,16 +123,18 @@ namespace geo {
         // than a point, so a conversion is required
         auto makeProjection = [](auto v) { return Projection_t(v.X(), v.Y()); };
 
+        geo::WireGeo const firstWire = plane.BuildWire(0);
+        geo::WireGeo const lastWire = plane.BuildWire(plane.Nwires() - 1);
         wireEnds[kFirstWireStart] =
-          makeProjection(plane.PointWidthDepthProjection(plane.FirstWire().GetStart()));
+          makeProjection(plane.PointWidthDepthProjection(firstWire.GetStart()));
         wireEnds[kFirstWireEnd] =
-          makeProjection(plane.PointWidthDepthProjection(plane.FirstWire().GetEnd()));
+          makeProjection(plane.PointWidthDepthProjection(firstWire.GetEnd()));
         if (wireEnds[kFirstWireStart].X() > wireEnds[kFirstWireEnd].X())
           std::swap(wireEnds[kFirstWireStart], wireEnds[kFirstWireEnd]);
         wireEnds[kLastWireStart] =
-          makeProjection(plane.PointWidthDepthProjection(plane.LastWire().GetStart()));
+          makeProjection(plane.PointWidthDepthProjection(lastWire.GetStart()));
         wireEnds[kLastWireEnd] =
-          makeProjection(plane.PointWidthDepthProjection(plane.LastWire().GetEnd()));
+          makeProjection(plane.PointWidthDepthProjection(lastWire.GetEnd()));
         if (wireEnds[kLastWireStart].X() > wireEnds[kLastWireEnd].X())
           std::swap(wireEnds[kLastWireStart], wireEnds[kLastWireEnd]);
       } // initializeWireEnds()
@@ -400,11 +405,27 @@ namespace geo {
   PlaneGeo::PlaneGeo(TGeoNode const& node,
                      geo::TransformationMatrix&& trans,
                      WireCollection_t&& wires)
+    : PlaneGeo(node, std::move(trans), std::move(wires), WireNodes_t{})
+  {}
+
+  //......................................................................
+  PlaneGeo::PlaneGeo(TGeoNode const& node,
+                     geo::TransformationMatrix&& trans,
+                     WireNodes_t&& wireNodes)
+    : PlaneGeo(node, std::move(trans), WireCollection_t{}, std::move(wireNodes))
+  {}
+
+  //......................................................................
+  PlaneGeo::PlaneGeo(TGeoNode const& node,
+                     geo::TransformationMatrix&& trans,
+                     WireCollection_t&& wires,
+                     WireNodes_t&& wireNodes)
     : fTrans(std::move(trans))
     , fVolume(node.GetVolume())
     , fView(geo::kUnknown)
     , fOrientation(geo::kVertical)
     , fWire(std::move(wires))
+    , fWireNodes(std::move(wireNodes))
     , fWirePitch(0.)
     , fSinPhiZ(0.)
     , fCosPhiZ(0.)
@@ -473,10 +494,91 @@ namespace geo {
     return *pWire;
   } // PlaneGeo::Wire(int)
 
+  //......................................................................
+  geo::WireGeo PlaneGeo::BuildWire(unsigned int iwire) const
+  {
+    if (!HasWire(iwire)) {
+      throw cet::exception("WireOutOfRange") << "Request for non-existant wire " << iwire << "\n";
+    }
+    return (HasLazyWires() && !fWiresBuilt.done()) ? MakeWireFromNode(iwire) : fWire[iwire];
+  } // PlaneGeo::BuildWire()
+
+  //......................................................................
+  PlaneGeo::WireCollection_t const& PlaneGeo::Wires() const
+  {
+    if (HasLazyWires()) {
+      fWiresBuilt.callOnce([this]() {
+        WireCollection_t wires;
+        wires.reserve(fWireNodes.size());
+        for (unsigned int iwire = 0; iwire < fWireNodes.size(); ++iwire)
+          wires.push_back(MakeWireFromNode(iwire));
+        fWire = std::move(wires);
+      });
+    }
+    return fWire;
+  } // PlaneGeo::Wires()
+
+  //......................................................................
+  PlaneGeo::WireArrays_t const& PlaneGeo::WireArrays() const
+  {
+    fWireArraysBuilt.callOnce([this]() {
+      WireArrays_t arrays;
+      arrays.reserve(Nwires());
+      auto const addWire = [&arrays](geo::WireGeo const& wire) {
+        arrays.push_back(
+          wire.GetCenter<geo::Point_t>(), wire.Direction<geo::Vector_t>(), wire.HalfL());
+      };
+      if (HasLazyWires() && !fWiresBuilt.done()) {
+        for (unsigned int iwire = 0; iwire < fWireNodes.size(); ++iwire)
+          addWire(MakeWireFromNode(iwire));
+      }
+      else {
+        for (geo::WireGeo const& wire : fWire)
+          addWire(wire);
+      }
+      fWireArrays = std::move(arrays);
+    });
+    return fWireArrays;
+  } // PlaneGeo::WireArrays()
+
+  //......................................................................
+  geo::WireGeo PlaneGeo::MakeWireFromNode(unsigned int iwire) const
+  {
+    TGeoNode const& node = *(fWireNodes[iwire]);
+    geo::WireGeo wire{node, fTrans.Matrix() * geo::makeTransformationMatrix(*(node.GetMatrix()))};
+    // after sorting, wires are created already with their final orientation
+    if (fWiresOriented) wire.UpdateAfterSorting(geo::WireID(fID, iwire), shouldFlipWire(wire));
+    return wire;
+  } // PlaneGeo::MakeWireFromNode()
+
   //......................................................................
 
   // sort the WireGeo objects
-  void PlaneGeo::SortWires(geo::GeoObjectSorter const& sorter) { sorter.SortWires(fWire); }
+  void PlaneGeo::SortWires(geo::GeoObjectSorter const& sorter)
+  {
+    fWireArraysBuilt.reset();
+    if (!HasLazyWires()) {
+      sorter.SortWires(fWire);
+      return;
+    }
+
+    //
+    // the sorter works on wire objects: if the wires are not built yet,
+    // it sorts temporary ones, and only the resulting order of the nodes is kept
+    //
+    WireCollection_t tempWires;
+    WireCollection_t& wires = fWiresBuilt.done() ? fWire : tempWires;
+    if (!fWiresBuilt.done()) {
+      tempWires.reserve(fWireNodes.size());
+      for (unsigned int iwire = 0; iwire < fWireNodes.size(); ++iwire)
+        tempWires.push_back(MakeWireFromNode(iwire));
+    }
+    sorter.SortWires(wires);
+    std::transform(
+      wires.begin(), wires.end(), fWireNodes.begin(), [](geo::WireGeo const& wire) {
+        return wire.Node();
+      });
+  } // PlaneGeo::SortWires()
 
   //......................................................................
   bool PlaneGeo::WireIDincreasesWithZ() const
@@ -590,6 +692,47 @@ namespace geo {
 
   } // PlaneGeo::MovePointOverPlane()
 
+  //......................................................................
+  PlaneGeo::ProjectionInfo_t PlaneGeo::ProjectAndClassify(geo::Point_t const& point) const
+  {
+    ProjectionInfo_t info;
+    ProjectAndClassify(util::span<geo::Point_t const*>{&point, &point + 1}, &info);
+    return info;
+  } // PlaneGeo::ProjectAndClassify()
+
+  //......................................................................
+  void PlaneGeo::ProjectAndClassify(util::span<geo::Point_t const*> points,
+                                    ProjectionInfo_t* results) const
+  {
+    //
+    // Same operations as PointWidthDepthProjection(), MoveProjectionToPlane()
+    // and MovePointOverPlane(), with the frame parameters read only once;
+    // std::clamp() on the borders gives the same delta as DeltaFromPlane().
+    //
+    geo::Point_t const origin = fDecompFrame.ReferencePoint();
+    geo::Vector_t const& widthDir = fDecompFrame.MainDir();
+    geo::Vector_t const& depthDir = fDecompFrame.SecondaryDir();
+    double const halfWidth = fFrameSize.HalfWidth();
+    double const halfDepth = fFrameSize.HalfDepth();
+    Rect const& active = fActiveArea;
+
+    for (geo::Point_t const& point : points) {
+      ProjectionInfo_t& info = *(results++);
+      geo::Vector_t const v = point - origin;
+      double const w = geo::vect::dot(v, widthDir);
+      double const d = geo::vect::dot(v, depthDir);
+      double const cw = std::clamp(w, -halfWidth, halfWidth);
+      double const cd = std::clamp(d, -halfDepth, halfDepth);
+      info.projection = {w, d};
+      info.clampedProjection = {cw, cd};
+      info.clampedPoint = point + (cw - w) * widthDir + (cd - d) * depthDir;
+      info.onPlane = (cw == w) & (cd == d);
+      info.onActiveArea = (w >= active.width.lower) & (w <= active.width.upper) &
+                          (d >= active.depth.lower) & (d <= active.depth.upper);
+    } // for
+
+  } // PlaneGeo::ProjectAndClassify()
+
   //......................................................................
   geo::WireID PlaneGeo::NearestWireID(geo::Point_t const& pos) const
   {
@@ -601,8 +744,8 @@ namespace geo {
     // 4) build and return the wire ID
     //
 
-    // this line merges parts (1) and (2); add 0.5 to have the correct rounding:
-    int nearestWireNo = int(0.5 + WireCoordinate(pos));
+    // this line merges parts (1) and (2)
+    int nearestWireNo = NearestWireNumber(WireCoordinate(pos));
 
     // if we are outside of the wireplane range, throw an exception
     if ((nearestWireNo < 0) || ((unsigned int)nearestWireNo >= Nwires())) {
@@ -614,15 +757,148 @@ namespace geo {
       else
         wireNo = Nwires() - 1;
 
-      throw InvalidWireError("Geometry", ID(), nearestWireNo, wireNo)
-        << "Can't find nearest wire for position " << pos << " in plane " << std::string(ID())
-        << " approx wire number # " << wireNo << " (capped from " << nearestWireNo << ")\n";
+      throw InvalidWireError("Geometry", ID(), nearestWireNo, wireNo).atPosition(pos);
     } // if invalid
 
     return {ID(), (geo::WireID::WireID_t)nearestWireNo};
 
   } // PlaneGeo::NearestWireID()
 
+  //......................................................................
+  PlaneGeo::WireCoordinateKernel_t PlaneGeo::WireCoordinateKernel() const
+  {
+    WireCoordinateKernel_t kernel;
+    geo::vect::fillCoords(kernel.origin, fDecompWire.ReferencePoint());
+    geo::vect::fillCoords(kernel.dir, fDecompWire.SecondaryDir());
+    geo::vect::fillCoords(kernel.wireDir, fDecompWire.MainDir());
+    kernel.pitch = WirePitch();
+    kernel.nWires = Nwires();
+    return kernel;
+  } // PlaneGeo::WireCoordinateKernel()
+
+  //......................................................................
+  std::vector<PlaneGeo::WireCrossing_t> PlaneGeo::WireCrossings(geo::Point_t const& start,
+                                                               geo::Point_t const& end) const
+  {
+    std::vector<WireCrossing_t> crossings;
+    WireCrossings(start, end, crossings);
+    return crossings;
+  } // PlaneGeo::WireCrossings()
+
+  //......................................................................
+  void PlaneGeo::WireCrossings(geo::Point_t const& start,
+                               geo::Point_t const& end,
+                               std::vector<WireCrossing_t>& crossings) const
+  {
+    double const length = (end - start).R();
+    double startCoords[3], endCoords[3];
+    geo::vect::fillCoords(startCoords, start);
+    geo::vect::fillCoords(endCoords, end);
+    WireCoordinateKernel().walkCells(
+      startCoords, endCoords, [this, length, &crossings](unsigned int wireNo, double fraction) {
+        crossings.push_back({geo::WireID{fID, wireNo}, fraction, fraction * length});
+      });
+  } // PlaneGeo::WireCrossings()
+
+  //......................................................................
+  PlaneGeo::WireRange_t PlaneGeo::WiresInRange(geo::BoxBoundedGeo const& box) const
+  {
+    double lower[3], upper[3];
+    geo::vect::fillCoords(lower, box.Min());
+    geo::vect::fillCoords(upper, box.Max());
+    WireCoordinateKernel_t const kernel = WireCoordinateKernel();
+    auto const [cMin, cMax] = kernel.boxCoordinateRange(lower, upper);
+    auto const [begin, end] = kernel.wiresInCoordinateRange(cMin, cMax);
+    return {fID, begin, end};
+  } // PlaneGeo::WiresInRange(BoxBoundedGeo)
+
+  //......................................................................
+  PlaneGeo::WireRange_t PlaneGeo::WiresInRange(Rect const& area) const
+  {
+    if (area.isNull()) return {fID, 0U, 0U};
+
+    //
+    // wire coordinate is linear in width and depth:
+    //   c(w, d) = c(center) + (w * <width dir, wire coord dir>
+    //                          + d * <depth dir, wire coord dir>) / pitch
+    // so its extremes are in the corners of the area
+    //
+    double const wSlope =
+      geo::vect::dot(WidthDir<geo::Vector_t>(), fDecompWire.SecondaryDir()) / WirePitch();
+    double const dSlope =
+      geo::vect::dot(DepthDir<geo::Vector_t>(), fDecompWire.SecondaryDir()) / WirePitch();
+    double const c = WireCoordinate(GetCenter<geo::Point_t>()) +
+                     wSlope * 0.5 * (area.width.lower + area.width.upper) +
+                     dSlope * 0.5 * (area.depth.lower + area.depth.upper);
+    double const spread = 0.5 * (std::abs(wSlope) * area.width.length() +
+                                 std::abs(dSlope) * area.depth.length());
+    auto const [begin, end] = WireCoordinateKernel().wiresInCoordinateRange(c - spread, c + spread);
+    return {fID, begin, end};
+  } // PlaneGeo::WiresInRange(Rect)
+
+  //......................................................................
+  geo::WireID PlaneGeo::NearestWireSegmentID(geo::Point_t const& pos) const
+  {
+    WireArrays_t const& wires = WireArrays();
+    std::size_t const wireNo = wires.closestSegment(pos.X(), pos.Y(), pos.Z());
+    if (wireNo >= wires.size()) return {};
+    return {ID(), static_cast<geo::WireID::WireID_t>(wireNo)};
+  } // PlaneGeo::NearestWireSegmentID()
+
+  //......................................................................
+  geo::WireID PlaneGeo::NearestWireIDchecked(geo::Point_t const& pos) const
+  {
+    int const nearestWireNo = NearestWireNumber(WireCoordinate(pos));
+
+    if ((nearestWireNo >= 0) && ((unsigned int)nearestWireNo < Nwires()))
+      return {ID(), (geo::WireID::WireID_t)nearestWireNo};
+
+    // out of range: cap the wire number, and flag the ID as invalid
+    geo::WireID wireID{ID(), (nearestWireNo < 0) ? 0U : (Nwires() - 1)};
+    wireID.markInvalid();
+    return wireID;
+
+  } // PlaneGeo::NearestWireIDchecked()
+
+  //......................................................................
+  void PlaneGeo::capWireNumber(int wireNo,
+                               geo::WireID::WireID_t& wire,
+                               std::uint8_t& valid) const
+  {
+    int const last = static_cast<int>(Nwires()) - 1;
+    valid = (wireNo >= 0) && (wireNo <= last);
+    wire = static_cast<geo::WireID::WireID_t>(boundedValue(wireNo, 0, last));
+  } // PlaneGeo::capWireNumber()
+
+  //......................................................................
+  void PlaneGeo::NonUniformNearestWireNumbers(util::span<geo::Point_t const*> points,
+                                              geo::WireID::WireID_t* wires,
+                                              std::uint8_t* valid) const
+  {
+    for (geo::Point_t const& point : points)
+      capWireNumber(NearestWireNumber(WireCoordinate(point)), *(wires++), *(valid++));
+  } // PlaneGeo::NonUniformNearestWireNumbers()
+
+  //......................................................................
+  void PlaneGeo::NonUniformNearestWireNumbers(std::size_t n,
+                                              double const* x,
+                                              double const* y,
+                                              double const* z,
+                                              geo::WireID::WireID_t* wires,
+                                              std::uint8_t* valid) const
+  {
+    // the coordinates are still computed by the vectorized kernel
+    constexpr std::size_t BlockSize = 256U;
+    double coords[BlockSize];
+    WireCoordinateKernel_t const kernel = WireCoordinateKernel();
+    for (std::size_t first = 0; first < n; first += BlockSize) {
+      std::size_t const nBlock = std::min(BlockSize, n - first);
+      kernel.wireCoordinates(nBlock, x + first, y + first, z + first, coords);
+      for (std::size_t i = 0; i < nBlock; ++i)
+        capWireNumber(NearestWireNumber(coords[i]), wires[first + i], valid[first + i]);
+    }
+  } // PlaneGeo::NonUniformNearestWireNumbers()
+
   //......................................................................
   geo::WireGeo const& PlaneGeo::NearestWire(geo::Point_t const& point) const
   {
@@ -639,9 +915,7 @@ namespace geo {
 
     // wire ID is invalid, meaning it's out of range. Throw an exception!
     geo::WireID const closestID = ClosestWireID(wireID);
-    throw InvalidWireError("Geometry", ID(), closestID.Wire, wireID.Wire)
-      << "Can't find nearest wire for position " << point << " in plane " << std::string(ID())
-      << " approx wire number # " << closestID.Wire << " (capped from " << wireID.Wire << ")\n";
+    throw InvalidWireError("Geometry", ID(), closestID.Wire, wireID.Wire).atPosition(point);
 
   } // PlaneGeo::NearestWire()
 
@@ -679,7 +953,7 @@ namespace geo {
     UpdateWidthDepthDir();
     UpdateIncreasingWireDir();
 
-    // update wires
+    // update wires (wires built on demand later will be updated on creation)
     geo::WireID::WireID_t wireNo = 0;
     for (auto& wire : fWire) {
 
@@ -687,18 +961,89 @@ namespace geo {
 
       ++wireNo;
     } // for wires
+    fWiresOriented = true;
+    fWireArraysBuilt.reset(); // directions may have changed
 
     UpdateDecompWireOrigin();
     UpdateWireDir();
     UpdateWirePlaneCenter();
     UpdateOrientation();
     UpdateWirePitch();
+    UpdateWireCenterTable();
     UpdateActiveArea();
     UpdatePhiZ();
     UpdateView();
 
   } // PlaneGeo::UpdateAfterSorting()
 
+  //......................................................................
+  void PlaneGeo::ApplyAlignment(geo::TransformationMatrix const& delta)
+  {
+    fTrans = LocalTransformation_t{delta * fTrans.Matrix()};
+
+    // wires still to be built on demand will be made from the new plane
+    // transformation
+    for (geo::WireGeo& wire : fWire)
+      wire.ApplyAlignment(delta);
+    fWireArraysBuilt.reset();
+
+  } // PlaneGeo::ApplyAlignment()
+
+  //......................................................................
+  void PlaneGeo::UpdateAfterAlignment(geo::BoxBoundedGeo const& TPCbox)
+  {
+    // the same order as in UpdateAfterSorting()
+    DetectGeometryDirections();
+    UpdatePlaneNormal(TPCbox);
+    UpdateWidthDepthDir();
+    UpdateIncreasingWireDir();
+    UpdateDecompWireOrigin();
+    UpdateWireDir();
+    UpdateWirePlaneCenter();
+    UpdateOrientation();
+    UpdateWirePitch();
+    UpdateWireCenterTable();
+    UpdateActiveArea();
+    UpdatePhiZ();
+
+  } // PlaneGeo::UpdateAfterAlignment()
+
+  //......................................................................
+  void PlaneGeo::ReleaseWires()
+  {
+    if (!HasLazyWires()) {
+      // wires are made again from their node placed in the plane volume
+      // (`MakeWireFromNode()`), which works only for its direct daughters
+      if (!fVolume) return;
+      WireNodes_t nodes;
+      nodes.reserve(fWire.size());
+      for (geo::WireGeo const& wire : fWire) {
+        TGeoNode const* node = wire.Node();
+        if (!node || (fVolume->GetIndex(node) < 0)) return; // can't be made again
+        nodes.push_back(node);
+      }
+      fWireNodes = std::move(nodes);
+    }
+    WireCollection_t{}.swap(fWire);
+    fWiresBuilt.reset();
+    fWireArrays = {};
+    fWireArraysBuilt.reset();
+  } // PlaneGeo::ReleaseWires()
+
+  //......................................................................
+  void PlaneGeo::FillMemoryUsage(lar::util::MemoryUsageReport& report) const
+  {
+    // the wire vector is accounted for here, except for the wires themselves
+    report.add("PlaneGeo",
+               sizeof(*this) + (fWire.capacity() - fWire.size()) * sizeof(geo::WireGeo) +
+                 lar::util::heapMemory(fWireNodes) + lar::util::heapMemory(fWireArrays) +
+                 lar::util::heapMemory(fWireCenters));
+    report.add("WireGeo",
+               fWire.size() * sizeof(geo::WireGeo) +
+                 lar::util::elementHeapMemory(fWire.begin(), fWire.end()),
+               fWire.size());
+  } // PlaneGeo::FillMemoryUsage()
+
   //......................................................................
   std::string PlaneGeo::ViewName(geo::View_t view)
   {
@@ -813,11 +1158,12 @@ namespace geo {
     if (NWires < 2) return {}; // why are we even here?
 
     // 1) get the direction of the middle wire
-    auto const WireDir = Wire(NWires / 2).Direction<geo::Vector_t>();
+    geo::WireGeo const middleWire = BuildWire(NWires / 2);
+    auto const WireDir = middleWire.Direction<geo::Vector_t>();
 
     // 2) get the direction between the middle wire and the next one
-    auto const ToNextWire =
-      Wire(NWires / 2 + 1).GetCenter<geo::Point_t>() - Wire(NWires / 2).GetCenter<geo::Point_t>();
+    auto const ToNextWire = BuildWire(NWires / 2 + 1).GetCenter<geo::Point_t>() -
+                            middleWire.GetCenter<geo::Point_t>();
 
     // 3) get the direction perpendicular to the plane
     // 4) round it
@@ -836,10 +1182,10 @@ namespace geo {
     //
 
     // sanity check
-    if (fWire.size() < 2) {
+    if (Nwires() < 2) {
       // this likely means construction is not complete yet
       throw cet::exception("NoWireInPlane")
-        << "PlaneGeo::UpdateOrientation(): only " << fWire.size() << " wires!\n";
+        << "PlaneGeo::UpdateOrientation(): only " << Nwires() << " wires!\n";
     } // if
 
     auto normal = GetNormalDirection<geo::Vector_t>();
@@ -867,7 +1213,7 @@ namespace geo {
 
     auto const iWire = Nwires() / 2;
 
-    fWirePitch = geo::WireGeo::WirePitch(Wire(iWire - 1), Wire(iWire));
+    fWirePitch = geo::WireGeo::WirePitch(BuildWire(iWire - 1), BuildWire(iWire));
 
   } // PlaneGeo::UpdateWirePitch()
 
@@ -1036,7 +1382,7 @@ namespace geo {
     // 1) get the direction of the middle wire
     auto refWireNo = Nwires() / 2;
     if (refWireNo == Nwires() - 1) --refWireNo;
-    auto const& refWire = Wire(refWireNo);
+    geo::WireGeo const refWire = BuildWire(refWireNo);
     auto const& WireDir = geo::vect::toVector(refWire.Direction()); // we only rely on the axis
 
     // 2) get the axis perpendicular to it on the wire plane
@@ -1044,7 +1390,8 @@ namespace geo {
     auto wireCoordDir = GetNormalDirection<geo::Vector_t>().Cross(WireDir).Unit();
 
     // 3) where is the next wire?
-    auto toNextWire = geo::vect::toVector(Wire(refWireNo + 1).GetCenter() - refWire.GetCenter());
+    auto toNextWire =
+      geo::vect::toVector(BuildWire(refWireNo + 1).GetCenter() - refWire.GetCenter());
 
     // 4) if wireCoordDir is pointing away from the next wire, flip it
     if (wireCoordDir.Dot(toNextWire) < 0) { wireCoordDir = -wireCoordDir; }
@@ -1057,7 +1404,7 @@ namespace geo {
   {
 
     fDecompWire.SetMainDir(
-      geo::vect::rounded01(geo::vect::toVector(FirstWire().Direction()), 1e-4));
+      geo::vect::rounded01(geo::vect::toVector(BuildWire(0).Direction()), 1e-4));
 
     //
     // check that the resulting normal matches the plane one
@@ -1078,17 +1425,56 @@ namespace geo {
     // This algorithm assumes wire pitch is constant, but it does not assume
     // wire ordering (which UpdateWirePitch() does).
     //
-    auto firstWire = fWire.cbegin(), wire = firstWire, wend = fWire.cend();
-    fWirePitch = geo::WireGeo::WirePitch(*firstWire, *(++wire));
+    if (HasLazyWires()) {
+      //
+      // Same algorithm, but only from the centers of the wires, assumed
+      // parallel, to avoid creating all of them.
+      //
+      geo::WireGeo const firstWire = BuildWire(0);
+      auto const wireDir = firstWire.Direction<geo::Vector_t>();
+      fWirePitch = std::numeric_limits<double>::max();
+      for (TGeoNode const* node : fWireNodes) {
+        double const* const localCenter = node->GetMatrix()->GetTranslation();
+        auto const toWire =
+          toWorldCoords(LocalPoint_t{localCenter[0], localCenter[1], localCenter[2]}) -
+          firstWire.GetCenter<geo::Point_t>();
+        double const wirePitch = toWire.Cross(wireDir).R();
+        if (wirePitch < 1e-4) continue; // it's 0!
+        if (wirePitch < fWirePitch) fWirePitch = wirePitch;
+      } // for
+      return;
+    }
 
-    while (++wire != wend) {
-      auto wirePitch = geo::WireGeo::WirePitch(*firstWire, *wire);
-      if (wirePitch < 1e-4) continue; // it's 0!
-      if (wirePitch < fWirePitch) fWirePitch = wirePitch;
-    } // while
+    // distances below 1 um are the first wire itself (or a duplicate)
+    fWirePitch = WireArrays().minDistanceFromAxis(0, 1e-4);
 
   } // PlaneGeo::UpdateWirePitchSlow()
 
+  //......................................................................
+  void PlaneGeo::UpdateWireCenterTable()
+  {
+    //
+    // The wire coordinate of the center of each wire is compared with its
+    // number; wires still to be built on demand are not built, and their
+    // centers are taken from their nodes instead.
+    //
+    std::vector<double> coords;
+    coords.reserve(Nwires());
+    if (HasLazyWires() && !fWiresBuilt.done()) {
+      for (TGeoNode const* node : fWireNodes) {
+        double const* const localCenter = node->GetMatrix()->GetTranslation();
+        coords.push_back(WireCoordinate(
+          toWorldCoords(LocalPoint_t{localCenter[0], localCenter[1], localCenter[2]})));
+      }
+    }
+    else {
+      for (geo::WireGeo const& wire : fWire)
+        coords.push_back(WireCoordinate(wire.GetCenter<geo::Point_t>()));
+    }
+    fWireCenters = details::WireCenterTable{coords};
+
+  } // PlaneGeo::UpdateWireCenterTable()
+
   //......................................................................
   void PlaneGeo::UpdateDecompWireOrigin()
   {
@@ -1096,7 +1482,7 @@ namespace geo {
     //
     // update the origin of the reference frame (the middle of the first wire)
     //
-    fDecompWire.SetOrigin(geo::vect::toPoint(FirstWire().GetCenter()));
+    fDecompWire.SetOrigin(geo::vect::toPoint(BuildWire(0).GetCenter()));
 
   } // PlaneGeo::UpdateDecompWireOrigin()
 
@@ -10,6 +10,8 @@
 
 // LArSoft libraries
 #include "larcorealg/CoreUtils/DereferenceIterator.h"
+#include "larcorealg/CoreUtils/MemoryUsage.h"
+#include "larcorealg/CoreUtils/span.h"
 #include "larcorealg/Geometry/BoxBoundedGeo.h"
 #include "larcorealg/Geometry/Decomposer.h"
 #include "larcorealg/Geometry/GeoObjectSorter.h"
@@ -17,6 +19,10 @@
 #include "larcorealg/Geometry/SimpleGeo.h"
 #include "larcorealg/Geometry/TransformationMatrix.h"
 #include "larcorealg/Geometry/WireGeo.h"
+#include "larcorealg/Geometry/details/OnceFlag.h"
+#include "larcorealg/Geometry/details/WireArrays.h"
+#include "larcorealg/Geometry/details/WireCenterTable.h"
+#include "larcorealg/Geometry/details/WireCoordinateKernel.h"
 #include "larcorealg/Geometry/geo_vectors_utils.h" // geo::vect
 #include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
 
@@ -29,7 +35,10 @@
 #include "TGeoMatrix.h" // TGeoHMatrix
 
 // C/C++ standard libraries
+#include <cassert>
 #include <cmath> // std::atan2()
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint8_t
 #include <string>
 #include <vector>
 
@@ -85,6 +94,34 @@ namespace geo {
   public:
     using WireCollection_t = std::vector<geo::WireGeo>;
     using GeoNodePath_t = std::vector<TGeoNode const*>;
+    using WireNodes_t = std::vector<TGeoNode const*>; ///< Nodes of the wires.
+    using WireArrays_t = details::WireArrays; ///< Wire information in arrays.
+
+    /// Parameters for the wire coordinate of many points.
+    using WireCoordinateKernel_t = details::WireCoordinateKernel;
+
+    /// Part of a segment under a wire (see `WireCrossings()`).
+    struct WireCrossing_t {
+      geo::WireID wireID;  ///< ID of the wire.
+      double fraction = 0; ///< Fraction of the segment under the wire.
+      double length = 0;   ///< Length of the segment under the wire [cm].
+    }; // WireCrossing_t
+
+    /// Range of consecutive wires in a plane (see `WiresInRange()`).
+    struct WireRange_t {
+      geo::PlaneID planeID;            ///< ID of the plane of the wires.
+      geo::WireID::WireID_t begin = 0; ///< Number of the first wire.
+      geo::WireID::WireID_t end = 0;   ///< Number of the wire after the last one.
+
+      /// Returns whether there are no wires in the range.
+      bool empty() const { return begin >= end; }
+
+      /// Returns the number of wires in the range.
+      unsigned int size() const { return empty() ? 0U : (end - begin); }
+
+      /// Returns the ID of the wire `i` in the range (not checked).
+      geo::WireID wireID(unsigned int i) const { return {planeID, begin + i}; }
+    }; // WireRange_t
 
     /// Type returned by `IterateElements()`.
     using ElementIteratorBox = WireCollection_t const&;
@@ -161,9 +198,35 @@ namespace geo {
     /// Type for description of rectangles.
     using Rect = lar::util::simple_geo::Rectangle<double>;
 
+    /// Projection of a point on the plane and its position (see
+    /// `ProjectAndClassify()`).
+    struct ProjectionInfo_t {
+      /// Projection of the point, as `PointWidthDepthProjection()`.
+      WidthDepthProjection_t projection;
+      /// Projection moved onto the plane, as `MoveProjectionToPlane()`.
+      WidthDepthProjection_t clampedProjection;
+      /// Point moved over the plane, as `MovePointOverPlane()`.
+      geo::Point_t clampedPoint;
+      bool onPlane = false;      ///< As `isProjectionOnPlane()`.
+      bool onActiveArea = false; ///< Projection is in `ActiveArea()`.
+    }; // ProjectionInfo_t
+
     /// Construct a representation of a single plane of the detector
     PlaneGeo(TGeoNode const& node, geo::TransformationMatrix&& trans, WireCollection_t&& wires);
 
+    /**
+     * @brief Constructs a plane whose wires are built on demand.
+     * @param node the node of the plane
+     * @param trans the transformation from the plane to the world frame
+     * @param wireNodes the nodes of the wires (daughters of the plane node)
+     *
+     * The `geo::WireGeo` objects are not created until a wire is requested
+     * (`Wire()`, `WirePtr()`, `IterateWires()` and the like), and then all
+     * the wires of the plane are created at once. The properties of the plane
+     * are computed from very few wires, created temporarily (`BuildWire()`).
+     */
+    PlaneGeo(TGeoNode const& node, geo::TransformationMatrix&& trans, WireNodes_t&& wireNodes);
+
     /// @{
     /// @name Plane properties
 
@@ -256,7 +319,7 @@ namespace geo {
 
     //@{
     /// Number of wires in this plane
-    unsigned int Nwires() const { return fWire.size(); }
+    unsigned int Nwires() const { return HasLazyWires() ? fWireNodes.size() : fWire.size(); }
     unsigned int NElements() const { return Nwires(); }
     //@}
 
@@ -288,6 +351,13 @@ namespace geo {
     /// @note In the past, no check was performed.
     WireGeo const& Wire(unsigned int iwire) const;
 
+    /// Returns the `iwire`-th wire in the plane, which must exist (not checked).
+    WireGeo const& WireUnchecked(unsigned int iwire) const
+    {
+      assert(iwire < Nwires());
+      return Wires()[iwire];
+    }
+
     //@{
     /**
      * @brief Returns the wire in wireid from this plane.
@@ -309,7 +379,7 @@ namespace geo {
      */
     geo::WirePtr WirePtr(unsigned int iwire) const
     {
-      return HasWire(iwire) ? &(fWire[iwire]) : nullptr;
+      return HasWire(iwire) ? &(Wires()[iwire]) : nullptr;
     }
 
     //@{
@@ -334,6 +404,36 @@ namespace geo {
     /// Return the last wire in the plane.
     const WireGeo& LastWire() const { return Wire(Nwires() - 1); }
 
+    /**
+     * @brief Returns a copy of the wire `iwire`.
+     * @throws cet::exception (category "WireOutOfRange") if no such wire
+     *
+     * If the wires of this plane are built on demand and they are not built
+     * yet, only the requested wire is created, and it is not kept.
+     */
+    geo::WireGeo BuildWire(unsigned int iwire) const;
+
+    /// Returns whether the wires of this plane are built on demand.
+    bool HasLazyWires() const { return !fWireNodes.empty(); }
+
+    /**
+     * @brief Returns centers, directions and half lengths of all the wires.
+     *
+     * The information is in contiguous arrays (see `geo::details::WireArrays`)
+     * which are suitable for vectorized loops over all the wires of the plane,
+     * like the computation of the wire end points for display:
+     * ~~~~{.cpp}
+     * auto const& wires = plane.WireArrays();
+     * std::vector<double> starts(3 * wires.size()), ends(3 * wires.size());
+     * double* start[3] = { &starts[0], &starts[wires.size()], &starts[2 * wires.size()] };
+     * double* end[3] = { &ends[0], &ends[wires.size()], &ends[2 * wires.size()] };
+     * wires.fillEndPoints(start, end);
+     * ~~~~
+     * The arrays are created on the first call, and they are never affected by
+     * the creation of wires on demand.
+     */
+    WireArrays_t const& WireArrays() const;
+
     // @{
     /**
      * @brief Allows range-for iteration on all wires in this plane.
@@ -382,7 +482,7 @@ namespace geo {
      * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
      *
      */
-    ElementIteratorBox IterateElements() const { return fWire; }
+    ElementIteratorBox IterateElements() const { return Wires(); }
     ElementIteratorBox IterateWires() const { return IterateElements(); }
     // @}
 
@@ -394,6 +494,19 @@ namespace geo {
     /// Return the wire pitch (in centimeters). It is assumed constant.
     double WirePitch() const { return fWirePitch; }
 
+    /**
+     * @brief Returns whether the wires are at their uniform positions.
+     * @see `NearestWireNumber()`
+     *
+     * The wires are uniform when the center of each one is at a wire
+     * coordinate equal to its number, within 1% of the pitch
+     * (`geo::details::WireCenterTable::UniformTolerance`). Planes with gaps
+     * between groups of wires, or with wires displaced from a regular grid,
+     * are not uniform, and their nearest wire is found by a search on the
+     * positions of all the wires.
+     */
+    bool HasUniformWires() const { return fWireCenters.empty(); }
+
     /**
      * @brief Returns whether the higher z wires have higher wire ID.
      * @return whether the higher z wires have higher wire ID
@@ -540,6 +653,47 @@ namespace geo {
     }
     //@}
 
+    /**
+     * @brief Returns the ID of wire closest to the specified position.
+     * @param pos world coordinates of the point [cm]
+     * @return the ID of the wire closest to the projection of pos on the plane
+     * @see `NearestWireID()`
+     *
+     * This is the same as `NearestWireID()`, but it never throws: if the
+     * nearest wire does not exist, the returned ID is marked invalid and it
+     * points to the wire that is actually the closest (`ClosestWireID()`),
+     * i.e. the nearest wire number is capped to the range of the plane:
+     * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+     * geo::WireID wireID = plane.NearestWireIDchecked(point);
+     * if (!wireID) wireID.markValid(); // accept the capped wire
+     * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+     * It is faster than catching the exception, and it is meant for loops
+     * where many points are expected to fall close to the edges of the plane.
+     */
+    geo::WireID NearestWireIDchecked(geo::Point_t const& pos) const;
+
+    /**
+     * @brief Returns the number of the wire nearest to a wire coordinate.
+     * @param wireCoord wire coordinate, as from `WireCoordinate()`
+     * @return the number of the nearest wire, out of range if beyond the wires
+     * @see `NearestWireID()`, `HasUniformWires()`
+     *
+     * On planes with uniform wires, this is the wire coordinate rounded to
+     * the closest integer. On the other planes, it is the wire whose center
+     * has the closest coordinate, found by a binary search; coordinates more
+     * than half a pitch beyond the outermost wires give a negative number or
+     * one not smaller than `Nwires()`. All the nearest wire queries of the
+     * plane use this function.
+     */
+    int NearestWireNumber(double wireCoord) const
+    {
+      // add 0.5 to have the correct rounding
+      return HasUniformWires() ? int(0.5 + wireCoord) : fWireCenters.nearestWire(wireCoord);
+    }
+
+    /// Returns the table of the wire centers (empty if `HasUniformWires()`).
+    details::WireCenterTable const& WireCenters() const { return fWireCenters; }
+
     /**
      * @brief Returns the wire closest to the specified position.
      * @param pos world coordinates of the point [cm]
@@ -563,6 +717,17 @@ namespace geo {
      */
     geo::WireGeo const& NearestWire(geo::Point_t const& pos) const;
 
+    /**
+     * @brief Returns the wire whose segment is closest to the specified point.
+     * @param pos world coordinates of the point [cm]
+     * @return the ID of the closest wire, invalid if the plane has no wires
+     *
+     * Unlike `NearestWireID()`, the wires are not extended beyond their ends:
+     * the distance is the one of the point from the closest point of the wire.
+     * All the wires are tested, so this is slower than `NearestWireID()`.
+     */
+    geo::WireID NearestWireSegmentID(geo::Point_t const& pos) const;
+
     /**
      * @brief Returns the closest valid wire ID to the specified wire.
      * @param wireNo number of the wire on this plane
@@ -877,6 +1042,164 @@ namespace geo {
       return PlaneCoordinate(point) / WirePitch();
     }
 
+    /// @{
+    /// @name Batch wire coordinate, nearest wire and distance between wires
+
+    /**
+     * @brief Computes the wire coordinate of many points.
+     * @param points the points
+     * @param[out] coords array with room for a coordinate for each point
+     * @see `WireCoordinate()`
+     *
+     * The result is the same as calling `WireCoordinate()` on each point, but
+     * the loop is suitable for vectorization. The versions taking the points
+     * as three arrays of coordinates (structure of arrays) are the fastest.
+     */
+    void WireCoordinates(util::span<geo::Point_t const*> points, double* coords) const
+    {
+      WireCoordinateKernel().wireCoordinates(points.begin(), points.end(), coords);
+    }
+    void WireCoordinates(std::size_t n,
+                         double const* x,
+                         double const* y,
+                         double const* z,
+                         double* coords) const
+    {
+      WireCoordinateKernel().wireCoordinates(n, x, y, z, coords);
+    }
+
+    /**
+     * @brief Finds the nearest wire to each of many points.
+     * @param points the points
+     * @param[out] wires array with room for a wire number for each point
+     * @param[out] valid array with room for a flag for each point
+     * @see `NearestWireID()`
+     *
+     * Each wire number is the one of the wire `NearestWireID()` would return.
+     * When `NearestWireID()` would throw instead, the number is capped to the
+     * first or last wire (as in `InvalidWireError::suggestedWireID()`) and the
+     * flag is `0`, otherwise it is `1`. No exception is thrown.
+     * On planes without uniform wires (`HasUniformWires()`) the wires are
+     * looked up in the table of their centers, which is not vectorized.
+     */
+    void NearestWireNumbers(util::span<geo::Point_t const*> points,
+                            geo::WireID::WireID_t* wires,
+                            std::uint8_t* valid) const
+    {
+      if (HasUniformWires())
+        WireCoordinateKernel().nearestWires(points.begin(), points.end(), wires, valid);
+      else
+        NonUniformNearestWireNumbers(points, wires, valid);
+    }
+    void NearestWireNumbers(std::size_t n,
+                            double const* x,
+                            double const* y,
+                            double const* z,
+                            geo::WireID::WireID_t* wires,
+                            std::uint8_t* valid) const
+    {
+      if (HasUniformWires())
+        WireCoordinateKernel().nearestWires(n, x, y, z, wires, valid);
+      else
+        NonUniformNearestWireNumbers(n, x, y, z, wires, valid);
+    }
+
+    /**
+     * @brief Computes the distance between wires along many directions.
+     * @param dirs the directions (e.g. of the steps of a trajectory)
+     * @param[out] pitches array with room for a distance for each direction
+     * @see `InterWireDistance()`, `InterWireProjectedDistances()`
+     *
+     * The result is the same as calling `InterWireDistance()` on each
+     * direction, but the parameters of the plane are extracted only once and
+     * the loop is suitable for vectorization. The distance does not depend
+     * on where the direction is applied, so for a trajectory only the
+     * directions are needed, not its points. This is the pitch (@f$ dx @f$)
+     * of calorimetry.
+     */
+    void InterWireDistances(util::span<geo::Vector_t const*> dirs, double* pitches) const
+    {
+      WireCoordinateKernel().interWireDistances(dirs.begin(), dirs.end(), pitches);
+    }
+    void InterWireDistances(std::size_t n,
+                            double const* dx,
+                            double const* dy,
+                            double const* dz,
+                            double* pitches) const
+    {
+      WireCoordinateKernel().interWireDistances(n, dx, dy, dz, pitches);
+    }
+
+    /// Computes `InterWireProjectedDistance()` on many directions (see
+    /// `InterWireDistances()`).
+    void InterWireProjectedDistances(util::span<geo::Vector_t const*> dirs, double* pitches) const
+    {
+      WireCoordinateKernel().interWireProjectedDistances(dirs.begin(), dirs.end(), pitches);
+    }
+    void InterWireProjectedDistances(std::size_t n,
+                                     double const* dx,
+                                     double const* dy,
+                                     double const* dz,
+                                     double* pitches) const
+    {
+      WireCoordinateKernel().interWireProjectedDistances(n, dx, dy, dz, pitches);
+    }
+
+    /// Returns the parameters to compute the wire coordinate on this plane.
+    WireCoordinateKernel_t WireCoordinateKernel() const;
+
+    /// @}
+
+    /// @{
+    /**
+     * @brief Returns the wires the projection of a segment goes across.
+     * @param start start of the segment [cm]
+     * @param end end of the segment [cm]
+     * @return the wires in order from `start` to `end`, with the length under each
+     *
+     * A point is "under" the wire nearest to its projection on the plane
+     * (as in `NearestWireID()`). The result lists all the wires with a part of
+     * the segment under them, from the one of `start` to the one of `end`,
+     * with the fraction and the (3D) length of the segment under each.
+     * The parts of the segment beyond the first and last wires are not included.
+     *
+     * The wires are found by stepping through the boundaries between
+     * wires in wire coordinate space, using the uniform wire pitch, without
+     * looking up each point. The segment is not clipped to the plane, so the
+     * wires are considered infinitely long.
+     */
+    std::vector<WireCrossing_t> WireCrossings(geo::Point_t const& start,
+                                              geo::Point_t const& end) const;
+
+    /// Appends to `crossings` the wires crossed by the segment from `start` to `end`.
+    void WireCrossings(geo::Point_t const& start,
+                       geo::Point_t const& end,
+                       std::vector<WireCrossing_t>& crossings) const;
+
+    /**
+     * @brief Returns the wires whose projection overlaps a box.
+     * @param box the box, in world coordinates [cm]
+     * @return the range of the numbers of the wires overlapping the box
+     *
+     * The wires are considered infinitely long, and the box is projected on
+     * the plane: the result includes all the wires with wire coordinate
+     * between the smallest and the largest one of the points of the box.
+     * The range is computed from the box corners in constant time.
+     */
+    WireRange_t WiresInRange(geo::BoxBoundedGeo const& box) const;
+
+    /**
+     * @brief Returns the wires overlapping an area of the plane.
+     * @param area the area, in width and depth coordinates [cm]
+     * @return the range of the numbers of the wires overlapping the area
+     *
+     * The area is expressed in the frame of `PointWidthDepthProjection()`,
+     * like `ActiveArea()`. The wires are considered infinitely long.
+     */
+    WireRange_t WiresInRange(Rect const& area) const;
+
+    /// @}
+
     //@{
     /**
      * @brief Decomposes a 3D point in two components.
@@ -1310,6 +1633,29 @@ namespace geo {
     TVector3 MovePointOverPlane(TVector3 const& point) const;
     //@}
 
+    /**
+     * @brief Projects a point on the plane and tells where the projection is.
+     * @param point world coordinate of the point [cm]
+     * @return the projection, the point moved over the plane and the flags
+     * @see `PointWidthDepthProjection()`, `isProjectionOnPlane()`,
+     *      `MoveProjectionToPlane()`, `MovePointOverPlane()`
+     *
+     * The result has the same values as the single methods it replaces, but
+     * the projection is computed only once, and the capping and the tests are
+     * done with no branch.
+     * The active area test is the one of `DeltaFromActivePlane()` with no
+     * margin.
+     */
+    ProjectionInfo_t ProjectAndClassify(geo::Point_t const& point) const;
+
+    /**
+     * @brief Projects many points on the plane (see `ProjectAndClassify()`).
+     * @param points the points to be projected
+     * @param[out] results array with room for a result for each point
+     */
+    void ProjectAndClassify(util::span<geo::Point_t const*> points,
+                            ProjectionInfo_t* results) const;
+
     //@{
     /**
      * @brief Returns the 3D vector from composition of projection and distance.
@@ -1464,6 +1810,44 @@ namespace geo {
     /// Performs all needed updates after the TPC has sorted the planes.
     void UpdateAfterSorting(geo::PlaneID planeid, geo::BoxBoundedGeo const& TPCbox);
 
+    /**
+     * @brief Moves the plane and its wires by a rigid transformation.
+     * @param delta the transformation, in world coordinates
+     * @see `geo::GeometryAlignment`, `UpdateAfterAlignment()`
+     *
+     * Only the placement of the plane and of its wires is changed: the derived
+     * information is updated by `UpdateAfterAlignment()`, which must follow.
+     */
+    void ApplyAlignment(geo::TransformationMatrix const& delta);
+
+    /// Updates the derived information after `ApplyAlignment()`; the wires
+    /// keep their order and orientation, and the plane its view.
+    void UpdateAfterAlignment(geo::BoxBoundedGeo const& TPCbox);
+
+    /**
+     * @brief Frees the wire objects, to be built again on demand.
+     * @see `geo::GeometryCore::SetBuildSubset()`
+     *
+     * The plane keeps only the nodes of its wires, in their sorted order, as
+     * planes with lazy wires do (`HasLazyWires()`); the number of wires and
+     * all the plane properties are unchanged. Wires from a builder which does
+     * not set their nodes (`geo::WireGeo::Node()`) are kept, and so are wires
+     * which are not direct daughters of the plane volume (e.g. nested in an
+     * intermediate volume), since they could not be placed again from their
+     * node alone.
+     * This must follow `UpdateAfterSorting()`.
+     */
+    void ReleaseWires();
+
+    /**
+     * @brief Adds the memory used by this plane to `report`.
+     * @param report the report to be updated
+     *
+     * The plane is added as `"PlaneGeo"`, its wires as `"WireGeo"`; wires not
+     * built yet (see `Wires()`) are not included.
+     */
+    void FillMemoryUsage(lar::util::MemoryUsageReport& report) const;
+
     /// Returns the name of the specified view.
     static std::string ViewName(geo::View_t view);
 
@@ -1471,6 +1855,18 @@ namespace geo {
     static std::string OrientationName(geo::Orient_t orientation);
 
   private:
+    /// Common constructor; only one of `wires` and `wireNodes` is not empty.
+    PlaneGeo(TGeoNode const& node,
+             geo::TransformationMatrix&& trans,
+             WireCollection_t&& wires,
+             WireNodes_t&& wireNodes);
+
+    /// Returns all the wires, building them first if needed.
+    WireCollection_t const& Wires() const;
+
+    /// Creates the wire `iwire` from its node (only if wires are on demand).
+    geo::WireGeo MakeWireFromNode(unsigned int iwire) const;
+
     /// Sets the geometry directions.
     void DetectGeometryDirections();
 
@@ -1507,6 +1903,25 @@ namespace geo {
     /// Updates the stored wire pitch with a slower, more robust algorithm.
     void UpdateWirePitchSlow();
 
+    /// Updates the table of the wire centers, empty if the wires are uniform;
+    /// needs the wire pitch and the wire coordinate decomposition.
+    void UpdateWireCenterTable();
+
+    /// Version of `NearestWireNumbers()` using the table of the wire centers.
+    void NonUniformNearestWireNumbers(util::span<geo::Point_t const*> points,
+                                      geo::WireID::WireID_t* wires,
+                                      std::uint8_t* valid) const;
+    void NonUniformNearestWireNumbers(std::size_t n,
+                                      double const* x,
+                                      double const* y,
+                                      double const* z,
+                                      geo::WireID::WireID_t* wires,
+                                      std::uint8_t* valid) const;
+
+    /// Caps `wireNo` to the wires of the plane into `wire`; `valid` is whether
+    /// it was already in range.
+    void capWireNumber(int wireNo, geo::WireID::WireID_t& wire, std::uint8_t& valid) const;
+
     /// Updates the position of the wire coordinate decomposition.
     void UpdateDecompWireOrigin();
 
@@ -1530,14 +1945,20 @@ namespace geo {
       double Depth() const { return 2.0 * HalfDepth(); }
     }; // RectSpecs
 
-    LocalTransformation_t fTrans; ///< Plane to world transform.
-    TGeoVolume const* fVolume;    ///< Plane volume description.
-    View_t fView;                 ///< Does this plane measure U, V, or W?
-    Orient_t fOrientation;        ///< Is the plane vertical or horizontal?
-    WireCollection_t fWire;       ///< List of wires in this plane.
-    double fWirePitch;            ///< Pitch of wires in this plane.
-    double fSinPhiZ;              ///< Sine of @f$ \phi_{z} @f$.
-    double fCosPhiZ;              ///< Cosine of @f$ \phi_{z} @f$.
+    LocalTransformation_t fTrans;          ///< Plane to world transform.
+    TGeoVolume const* fVolume;             ///< Plane volume description.
+    View_t fView;                          ///< Does this plane measure U, V, or W?
+    Orient_t fOrientation;                 ///< Is the plane vertical or horizontal?
+    mutable WireCollection_t fWire;        ///< List of wires in this plane.
+    WireNodes_t fWireNodes;                ///< Nodes of the wires, if built on demand.
+    mutable details::OnceFlag fWiresBuilt; ///< Whether on-demand wires are built.
+    mutable WireArrays_t fWireArrays;      ///< Wire information in arrays.
+    mutable details::OnceFlag fWireArraysBuilt; ///< Whether `fWireArrays` is filled.
+    bool fWiresOriented = false;           ///< Whether wire flipping is established.
+    double fWirePitch;                     ///< Pitch of wires in this plane.
+    details::WireCenterTable fWireCenters; ///< Wire centers, if not uniform.
+    double fSinPhiZ;                       ///< Sine of @f$ \phi_{z} @f$.
+    double fCosPhiZ;                       ///< Cosine of @f$ \phi_{z} @f$.
 
     geo::Vector_t fNormal; ///< Normal to the plane, inward in TPC.
     /// Decomposition on wire coordinates; the main direction is along the wire,
@@ -0,0 +1,59 @@
+/**
+ * @file   larcorealg/Geometry/QueryResult.h
+ * @brief  Result of the geometry queries which do not throw.
+ * @date   October 14, 2026
+ * @see    `larcorealg/CoreUtils/Expected.h`
+ *
+ * This is a header only library.
+ */
+
+#ifndef LARCOREALG_GEOMETRY_QUERYRESULT_H
+#define LARCOREALG_GEOMETRY_QUERYRESULT_H
+
+// LArSoft libraries
+#include "larcorealg/CoreUtils/Expected.h"
+
+namespace geo {
+
+  /// Reasons of failure of a geometry query.
+  enum class QueryError : unsigned char {
+    NoCryostat,    ///< No cryostat includes the point.
+    NoTPC,         ///< No TPC includes the point.
+    NoAuxDet,      ///< No auxiliary detector includes the point.
+    NoPlane,       ///< The requested wire plane does not exist.
+    WireOutOfRange ///< The nearest wire would be beyond the ones of the plane.
+  };
+
+  /// Returns a description of the `error`.
+  inline char const* errorMessage(QueryError error)
+  {
+    switch (error) {
+    case QueryError::NoCryostat: return "no cryostat at the requested position";
+    case QueryError::NoTPC: return "no TPC at the requested position";
+    case QueryError::NoAuxDet: return "no auxiliary detector at the requested position";
+    case QueryError::NoPlane: return "no wire plane matches the request";
+    case QueryError::WireOutOfRange: return "the position is beyond the wires of the plane";
+    } // switch
+    return "unknown geometry query error";
+  } // errorMessage()
+
+  /**
+   * @brief The `T` result of a geometry query, or why it failed.
+   * @tparam T type of the result (e.g. `geo::TPCGeo const&`, `geo::WireID`)
+   *
+   * This is the type returned by the query methods starting with `Try` (like
+   * `geo::GeometryCore::TryPositionToTPC()`), which report a failure without
+   * throwing an exception nor returning an invalid object.
+   */
+  template <typename T>
+  using QueryResult_t = util::expected<T, QueryError>;
+
+  /// Returns a failed query result with the specified `error`.
+  constexpr util::unexpected<QueryError> queryFailure(QueryError error)
+  {
+    return util::unexpected<QueryError>{error};
+  }
+
+} // namespace geo
+
+#endif // LARCOREALG_GEOMETRY_QUERYRESULT_H
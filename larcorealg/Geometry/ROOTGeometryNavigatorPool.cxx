@@ -0,0 +1,65 @@
+/**
+ * @file   larcorealg/Geometry/ROOTGeometryNavigatorPool.cxx
+ * @brief  Pool of ROOT geometry navigators, one per thread.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/ROOTGeometryNavigatorPool.h`
+ */
+
+// LArSoft libraries
+#include "larcorealg/Geometry/ROOTGeometryNavigatorPool.h"
+
+// ROOT libraries
+#include "TGeoManager.h"
+#include "TGeoNavigator.h"
+
+// C++ standard library
+#include <mutex> // std::unique_lock
+
+//------------------------------------------------------------------------------
+geo::ROOTGeometryNavigatorPool::ROOTGeometryNavigatorPool() = default;
+
+geo::ROOTGeometryNavigatorPool::~ROOTGeometryNavigatorPool() = default;
+
+//------------------------------------------------------------------------------
+TGeoNavigator& geo::ROOTGeometryNavigatorPool::navigator(TGeoManager& manager) const
+{
+  std::thread::id const thisThread = std::this_thread::get_id();
+
+  { // fast path: this thread has already its navigator
+    std::shared_lock<std::shared_mutex> lock{fMutex};
+    if (fManager == &manager) {
+      auto const iNavigator = fNavigators.find(thisThread);
+      if (iNavigator != fNavigators.end()) return *(iNavigator->second);
+    }
+  }
+
+  std::unique_lock<std::shared_mutex> lock{fMutex};
+  if (fManager != &manager) {
+    fNavigators.clear();
+    fManager = &manager;
+  }
+  std::unique_ptr<TGeoNavigator>& navigator = fNavigators[thisThread];
+  if (!navigator) {
+    // same initialization as `TGeoManager::AddNavigator()` does
+    navigator = std::make_unique<TGeoNavigator>(&manager);
+    navigator->BuildCache(kTRUE, kFALSE);
+  }
+  return *navigator;
+} // geo::ROOTGeometryNavigatorPool::navigator()
+
+//------------------------------------------------------------------------------
+void geo::ROOTGeometryNavigatorPool::clear()
+{
+  std::unique_lock<std::shared_mutex> lock{fMutex};
+  fNavigators.clear();
+  fManager = nullptr;
+} // geo::ROOTGeometryNavigatorPool::clear()
+
+//------------------------------------------------------------------------------
+std::size_t geo::ROOTGeometryNavigatorPool::size() const
+{
+  std::shared_lock<std::shared_mutex> lock{fMutex};
+  return fNavigators.size();
+} // geo::ROOTGeometryNavigatorPool::size()
+
+//------------------------------------------------------------------------------
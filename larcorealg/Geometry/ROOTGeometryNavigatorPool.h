@@ -0,0 +1,92 @@
+/**
+ * @file   larcorealg/Geometry/ROOTGeometryNavigatorPool.h
+ * @brief  Pool of ROOT geometry navigators, one per thread.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/ROOTGeometryNavigatorPool.cxx`,
+ *         `larcorealg/Geometry/ROOTGeometryNavigator.h`
+ */
+
+#ifndef LARCOREALG_GEOMETRY_ROOTGEOMETRYNAVIGATORPOOL_H
+#define LARCOREALG_GEOMETRY_ROOTGEOMETRYNAVIGATORPOOL_H
+
+// C++ standard library
+#include <cstddef> // std::size_t
+#include <map>
+#include <memory> // std::unique_ptr
+#include <shared_mutex>
+#include <thread> // std::thread::id
+
+// ROOT libraries
+class TGeoManager;
+class TGeoNavigator;
+
+namespace geo {
+
+  class ROOTGeometryNavigatorPool;
+
+} // namespace geo
+
+//------------------------------------------------------------------------------
+/**
+ * @brief Provides each thread with its own ROOT geometry navigator.
+ *
+ * While `geo::ROOTGeometryNavigator` visits the nodes of the geometry without
+ * any state, queries like "which volume is at this point" or "step to the
+ * next boundary" move a cursor. The cursor of `TGeoManager` itself
+ * (`gGeoManager->FindNode()`, `InitTrack()`, `Step()`...) is shared by the
+ * whole job, so those queries cannot run concurrently. This pool creates,
+ * on demand, a separate `TGeoNavigator` for each thread asking for one:
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * TGeoNavigator& navigator = pool.navigator(*gGeoManager);
+ * TGeoNode const* node = navigator.FindNode(x, y, z);
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * The navigators are owned by the pool, and a thread always gets back the
+ * same one. The state of a navigator (current point, direction and node) is
+ * left as the last query of its thread left it.
+ *
+ * Some ROOT shapes also keep per-thread scratch data, which ROOT separates by
+ * thread only after `TGeoManager::SetMaxThreads()` has been called; that is
+ * up to the job configuration.
+ *
+ * The pool must not be cleared, nor used with a different manager, while any
+ * of its navigators is in use.
+ */
+class geo::ROOTGeometryNavigatorPool {
+
+public:
+  ROOTGeometryNavigatorPool();
+  ~ROOTGeometryNavigatorPool();
+
+  ROOTGeometryNavigatorPool(ROOTGeometryNavigatorPool const&) = delete;
+  ROOTGeometryNavigatorPool& operator=(ROOTGeometryNavigatorPool const&) = delete;
+
+  /**
+   * @brief Returns the navigator of the calling thread on `manager` geometry.
+   * @param manager the ROOT geometry to navigate
+   * @return a navigator reserved to the calling thread
+   *
+   * If `manager` is not the geometry the existing navigators are navigating,
+   * all of them are discarded first.
+   */
+  TGeoNavigator& navigator(TGeoManager& manager) const;
+
+  /// Removes all the navigators.
+  void clear();
+
+  /// Returns the number of navigators in the pool.
+  std::size_t size() const;
+
+private:
+  mutable std::shared_mutex fMutex; ///< Protects the access to the pool.
+
+  /// Geometry the navigators are navigating.
+  mutable TGeoManager const* fManager = nullptr;
+
+  /// The navigator of each thread.
+  mutable std::map<std::thread::id, std::unique_ptr<TGeoNavigator>> fNavigators;
+
+}; // geo::ROOTGeometryNavigatorPool
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREALG_GEOMETRY_ROOTGEOMETRYNAVIGATORPOOL_H
@@ -1,6 +1,6 @@
 /**
  * @file   larcorealg/Geometry/ReadoutDataContainers.h
- * @brief  Containers to hold one datum per TPC set or readout plane.
+ * @brief  Containers to hold one datum per TPC set, readout plane or channel.
  * @author Gianluca Petrillo (petrillo@slac.stanford.edu)
  * @date   September 7, 2019
  * @ingroup Geometry
@@ -14,16 +14,49 @@
 // LArSoft libraries
 #include "larcorealg/Geometry/GeometryDataContainers.h"
 #include "larcorealg/Geometry/ReadoutIDmapper.h"
+#include "larcorealg/CoreUtils/span.h"
+#include "larcorealg/Geometry/TaskRunner.h"
+#include "larcoreobj/SimpleTypesAndConstants/RawTypes.h" // raw::ChannelID_t
 #include "larcoreobj/SimpleTypesAndConstants/readout_types.h"
 
+// C/C++ standard libraries
+#include <algorithm> // std::min(), std::fill()
+#include <cstddef>   // std::size_t
+#include <cstdint>   // std::uint64_t
+#include <memory>    // std::allocator<>, std::allocator_traits<>
+#include <memory_resource>
+#include <stdexcept> // std::out_of_range
+#include <string>
+#include <type_traits> // std::enable_if_t, std::is_same_v
+#include <vector>
+
 namespace readout {
 
-  template <typename T>
+  template <typename T, typename Allocator = std::allocator<T>>
   class TPCsetDataContainer;
 
-  template <typename T>
+  template <typename T, typename Allocator = std::allocator<T>>
   class ROPDataContainer;
 
+  template <typename T, typename Allocator = std::allocator<T>>
+  class ChannelDataContainer;
+
+  /// Containers with memory from a `std::pmr::memory_resource`.
+  namespace pmr {
+
+    template <typename T>
+    using TPCsetDataContainer =
+      readout::TPCsetDataContainer<T, std::pmr::polymorphic_allocator<T>>;
+
+    template <typename T>
+    using ROPDataContainer = readout::ROPDataContainer<T, std::pmr::polymorphic_allocator<T>>;
+
+    template <typename T>
+    using ChannelDataContainer =
+      readout::ChannelDataContainer<T, std::pmr::polymorphic_allocator<T>>;
+
+  } // namespace pmr
+
 } // namespace geo
 
 // --- BEGIN Readout data containers -------------------------------------------
@@ -35,7 +68,8 @@ namespace readout {
 /**
  * @brief Container with one element per readout TPC set.
  * @tparam T type of the contained datum
- * @see `geo::GeometryCore::makeTPCsetData`
+ * @tparam Allocator type of allocator of the data storage
+ * @see `geo::GeometryCore::makeTPCsetData`, `readout::pmr::TPCsetDataContainer`
  *
  * The container is of fixed size and can't be neither resized nor freed
  * before destruction.
@@ -53,13 +87,15 @@ namespace readout {
  * * at least one element is expected to be present
  *
  */
-template <typename T>
-class readout::TPCsetDataContainer : public geo::GeoIDdataContainer<T, readout::TPCsetIDmapper<>> {
+template <typename T, typename Allocator>
+class readout::TPCsetDataContainer
+  : public geo::GeoIDdataContainer<T, readout::TPCsetIDmapper<>, Allocator> {
 
-  using BaseContainer_t = geo::GeoIDdataContainer<T, readout::TPCsetIDmapper<>>;
+  using BaseContainer_t = geo::GeoIDdataContainer<T, readout::TPCsetIDmapper<>, Allocator>;
 
 public:
   using value_type = typename BaseContainer_t::value_type;
+  using allocator_type = typename BaseContainer_t::allocator_type;
 
   /**
    * @brief Default constructor: empty container.
@@ -71,16 +107,22 @@ public:
    */
   TPCsetDataContainer() = default;
 
+  /// Constructor: empty container, allocating memory via `alloc`.
+  explicit TPCsetDataContainer(allocator_type const& alloc) : BaseContainer_t(alloc) {}
+
   /**
    * @brief Prepares the container with default-constructed data.
    * @param nCryo number of cryostats
    * @param nTPCsets number of TPC sets
+   * @param alloc allocator for the data storage
    *
    * The container is sized to host data for `nCryo` cryostats, each with
    * `nTPCsets` TPC sets. Each element in the container is default-constructed.
    */
-  TPCsetDataContainer(unsigned int nCryo, unsigned int nTPCsets)
-    : BaseContainer_t({nCryo, nTPCsets})
+  TPCsetDataContainer(unsigned int nCryo,
+                      unsigned int nTPCsets,
+                      allocator_type const& alloc = allocator_type{})
+    : BaseContainer_t({nCryo, nTPCsets}, alloc)
   {}
 
   /**
@@ -88,6 +130,7 @@ public:
    * @param nCryo number of cryostats
    * @param nTPCsets number of TPC sets
    * @param defValue the value to be replicated
+   * @param alloc allocator for the data storage
    *
    * The container is sized to host data for `nCryo` cryostats, each with
    * `nTPCsets` TPC sets. Each element in the container is a copy of defValue.
@@ -97,8 +140,11 @@ public:
    *   (geom->NCryostats(), geom->MaxTPCsets(), 3U);
    * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
    */
-  TPCsetDataContainer(unsigned int nCryo, unsigned int nTPCsets, value_type const& defValue)
-    : BaseContainer_t({nCryo, nTPCsets}, defValue)
+  TPCsetDataContainer(unsigned int nCryo,
+                      unsigned int nTPCsets,
+                      value_type const& defValue,
+                      allocator_type const& alloc = allocator_type{})
+    : BaseContainer_t({nCryo, nTPCsets}, defValue, alloc)
   {}
 
   // --- BEGIN Container modification ------------------------------------------
@@ -172,7 +218,8 @@ public:
 /**
  * @brief Container with one element per readout plane.
  * @tparam T type of the contained datum
- * @see `geo::GeometryCore::makeROPdata`
+ * @tparam Allocator type of allocator of the data storage
+ * @see `geo::GeometryCore::makeROPdata`, `readout::pmr::ROPDataContainer`
  *
  * The container is of fixed size and can't be neither resized nor freed
  * before destruction.
@@ -190,13 +237,16 @@ public:
  * * at least one element is expected to be present
  *
  */
-template <typename T>
-class readout::ROPDataContainer : public geo::GeoIDdataContainer<T, readout::ROPIDmapper<>> {
+template <typename T, typename Allocator>
+class readout::ROPDataContainer
+  : public geo::GeoIDdataContainer<T, readout::ROPIDmapper<>, Allocator> {
 
   /// Base class.
-  using BaseContainer_t = geo::GeoIDdataContainer<T, readout::ROPIDmapper<>>;
+  using BaseContainer_t = geo::GeoIDdataContainer<T, readout::ROPIDmapper<>, Allocator>;
 
 public:
+  using allocator_type = typename BaseContainer_t::allocator_type;
+
   /**
    * @brief Default constructor: empty container.
    * @see `resize()`
@@ -207,18 +257,25 @@ public:
    */
   ROPDataContainer() = default;
 
+  /// Constructor: empty container, allocating memory via `alloc`.
+  explicit ROPDataContainer(allocator_type const& alloc) : BaseContainer_t(alloc) {}
+
   /**
    * @brief Prepares the container with default-constructed data.
    * @param nCryo number of cryostats
    * @param nTPCsets number of TPC sets per cryostat
    * @param nROPs number of readout planes per TPC set
+   * @param alloc allocator for the data storage
    *
    * The container is sized to host data for `nCryo` cryostats, each with
    * `nTPCsets` TPC sets, each one with `nROPs` readout planes. Each element
    * in the container is default-constructed.
    */
-  ROPDataContainer(unsigned int nCryo, unsigned int nTPCsets, unsigned int nROPs)
-    : BaseContainer_t({nCryo, nTPCsets, nROPs})
+  ROPDataContainer(unsigned int nCryo,
+                   unsigned int nTPCsets,
+                   unsigned int nROPs,
+                   allocator_type const& alloc = allocator_type{})
+    : BaseContainer_t({nCryo, nTPCsets, nROPs}, alloc)
   {}
 
   /**
@@ -227,6 +284,7 @@ public:
    * @param nTPCsets number of TPC sets
    * @param nROPs number of readout planes per TPC set
    * @param defValue the value to be replicated
+   * @param alloc allocator for the data storage
    *
    * The container is sized to host data for `nCryo` cryostats, each with
    * `nTPCsets` TPC sets, and each of them with `nROPs` readout planes.
@@ -237,8 +295,12 @@ public:
    *   (geom->NCryostats(), geom->MaxTPCsets(), geom->MaxROPs(), 0U);
    * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
    */
-  ROPDataContainer(unsigned int nCryo, unsigned int nTPCsets, unsigned int nROPs, T const& defValue)
-    : BaseContainer_t{{nCryo, nTPCsets, nROPs}, defValue}
+  ROPDataContainer(unsigned int nCryo,
+                   unsigned int nTPCsets,
+                   unsigned int nROPs,
+                   T const& defValue,
+                   allocator_type const& alloc = allocator_type{})
+    : BaseContainer_t{{nCryo, nTPCsets, nROPs}, defValue, alloc}
   {}
 
   // --- BEGIN Container modification ------------------------------------------
@@ -311,8 +373,518 @@ public:
 
 }; // class readout::ROPDataContainer<>
 
+//------------------------------------------------------------------------------
+/**
+ * @brief Container with one element per readout channel.
+ * @tparam T type of the contained datum
+ * @tparam Allocator type of allocator of the data storage
+ * @see `geo::GeometryCore::makeChannelData`, `readout::pmr::ChannelDataContainer`
+ *
+ * The data is stored contiguously, indexed directly by the channel number
+ * (`raw::ChannelID_t`), and access is constant time. The container hosts
+ * the channels from `0` to `size() - 1`, which is usually sized after the
+ * number of channels in the channel mapping (`geo::GeometryCore::Nchannels()`).
+ *
+ * The channels of a single readout plane are contiguous, and they can be
+ * accessed as a range with `ROPdata()`:
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * auto const* geom = lar::providerFrom<geo::GeometryCore>();
+ * auto pedestals = geom->makeChannelData(0.0f);
+ * for (float& pedestal: pedestals.ROPdata(*geom, ropid)) pedestal = 400.0f;
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * There is a specialization for `bool` (`readout::ChannelDataContainer<bool>`)
+ * which packs the flags in bits, with a different interface.
+ */
+template <typename T, typename Allocator>
+class readout::ChannelDataContainer {
+
+  /// Type of data storage.
+  using Container_t = std::vector<T, Allocator>;
+
+public:
+  /// @{
+  /// @name STL container types.
+
+  using value_type = typename Container_t::value_type;
+  using reference = typename Container_t::reference;
+  using const_reference = typename Container_t::const_reference;
+  using pointer = typename Container_t::pointer;
+  using const_pointer = typename Container_t::const_pointer;
+  using iterator = typename Container_t::iterator;
+  using const_iterator = typename Container_t::const_iterator;
+  using difference_type = typename Container_t::difference_type;
+  using size_type = typename Container_t::size_type;
+  using allocator_type = typename Container_t::allocator_type;
+
+  /// @}
+
+  /// Default constructor: empty container (see `resize()`).
+  ChannelDataContainer() = default;
+
+  /// Constructor: empty container, allocating memory via `alloc`.
+  explicit ChannelDataContainer(allocator_type const& alloc) : fData(alloc) {}
+
+  /// Constructor: `nChannels` default-constructed elements.
+  explicit ChannelDataContainer(size_type nChannels,
+                                allocator_type const& alloc = allocator_type{})
+    : fData(nChannels, alloc)
+  {}
+
+  /// Constructor: `nChannels` elements, copies of `defValue`.
+  ChannelDataContainer(size_type nChannels,
+                       value_type const& defValue,
+                       allocator_type const& alloc = allocator_type{})
+    : fData(nChannels, defValue, alloc)
+  {}
+
+  // --- BEGIN Container status query ------------------------------------------
+  /// @name Container status query
+  /// @{
+
+  /// Returns the number of channels in the container.
+  size_type size() const { return fData.size(); }
+
+  /// Returns whether the container has no channels.
+  bool empty() const { return fData.empty(); }
+
+  /// Returns whether the container has room for the data of `channel`.
+  bool hasChannel(raw::ChannelID_t channel) const
+  {
+    return raw::isValidChannelID(channel) && (channel < size());
+  }
+
+  /// Returns the allocator of the data storage.
+  allocator_type get_allocator() const { return fData.get_allocator(); }
+
+  /// @}
+  // --- END Container status query --------------------------------------------
+
+  // --- BEGIN Element access --------------------------------------------------
+  /// @name Element access
+  /// @{
+
+  /// Returns the element for the specified channel (no range check).
+  reference operator[](raw::ChannelID_t channel) { return fData[channel]; }
+
+  /// Returns the element for the specified channel (read-only, no range check).
+  const_reference operator[](raw::ChannelID_t channel) const { return fData[channel]; }
+
+  /// Returns the element for the specified channel.
+  /// @throw std::out_of_range if `channel` is not in the container
+  reference at(raw::ChannelID_t channel)
+  {
+    if (hasChannel(channel)) return fData[channel];
+    throw std::out_of_range("No data for channel " + std::to_string(channel));
+  }
+
+  /// Returns the element for the specified channel (read-only).
+  /// @throw std::out_of_range if `channel` is not in the container
+  const_reference at(raw::ChannelID_t channel) const
+  {
+    if (hasChannel(channel)) return fData[channel];
+    throw std::out_of_range("No data for channel " + std::to_string(channel));
+  }
+
+  /// Returns a pointer to the data of channel `0`.
+  pointer data() { return fData.data(); }
+
+  /// Returns a pointer to the data of channel `0` (read-only).
+  const_pointer data() const { return fData.data(); }
+
+  /// @}
+  // --- END Element access ----------------------------------------------------
+
+  // --- BEGIN Iterators and ranges --------------------------------------------
+  /// @name Iterators and ranges
+  /// @{
+
+  iterator begin() { return fData.begin(); }
+  iterator end() { return fData.end(); }
+  const_iterator begin() const { return fData.begin(); }
+  const_iterator end() const { return fData.end(); }
+  const_iterator cbegin() const { return fData.cbegin(); }
+  const_iterator cend() const { return fData.cend(); }
+
+  /// Returns a range of the data of `n` channels starting from `first`.
+  auto channels(raw::ChannelID_t first, size_type n)
+  {
+    return util::span{fData.begin() + first, fData.begin() + first + n};
+  }
+
+  /// Returns a range of the data of `n` channels starting from `first`.
+  auto channels(raw::ChannelID_t first, size_type n) const
+  {
+    return util::span{fData.begin() + first, fData.begin() + first + n};
+  }
+
+  /**
+   * @brief Returns a range of the data of all channels in a readout plane.
+   * @tparam ChannelMap type of channel mapping
+   * @param channelMap the channel mapping (e.g. `geo::GeometryCore`)
+   * @param ropid the readout plane
+   *
+   * The channel map must provide `FirstChannelInROP(ropid)` and
+   * `Nchannels(ropid)`, as `geo::GeometryCore` and `geo::ChannelMapAlg` do.
+   */
+  template <typename ChannelMap>
+  auto ROPdata(ChannelMap const& channelMap, readout::ROPID const& ropid)
+  {
+    return channels(channelMap.FirstChannelInROP(ropid), channelMap.Nchannels(ropid));
+  }
+
+  /// Returns a range of the data of all channels in a readout plane.
+  template <typename ChannelMap>
+  auto ROPdata(ChannelMap const& channelMap, readout::ROPID const& ropid) const
+  {
+    return channels(channelMap.FirstChannelInROP(ropid), channelMap.Nchannels(ropid));
+  }
+
+  /// @}
+  // --- END Iterators and ranges ----------------------------------------------
+
+  // --- BEGIN Container modification ------------------------------------------
+  /// @name Container modification
+  /// @{
+
+  /// Resizes the container to `nChannels` channels (new ones default-constructed).
+  void resize(size_type nChannels) { fData.resize(nChannels); }
+
+  /// Resizes the container to `nChannels` channels (new ones copies of `defValue`).
+  void resize(size_type nChannels, value_type const& defValue)
+  {
+    fData.resize(nChannels, defValue);
+  }
+
+  /// Removes all the data (`size()` becomes `0`).
+  void clear() { fData.clear(); }
+
+  /// Sets all elements to the specified `value` (copied).
+  void fill(value_type const& value) { std::fill(fData.begin(), fData.end(), value); }
+
+  /// Sets all the elements to a default-constructed `value_type`.
+  void reset() { fill(value_type{}); }
+
+  /**
+   * @brief Sets each element to the value computed from its channel.
+   * @tparam Gen type of value generator
+   * @param runner the executor of the tasks
+   * @param gen callable computing the value of a channel
+   *
+   * The element of each channel `ch` is set to `gen(ch)`. The channels are
+   * split in contiguous blocks processed by the tasks sent to `runner`, which
+   * may run them concurrently: `gen` must be safe to call concurrently.
+   */
+  template <typename Gen>
+  void generate(geo::TaskRunner_t const& runner, Gen&& gen);
+
+  /// Applies an operation on all elements, and returns it.
+  template <typename Op>
+  Op apply(Op&& op)
+  {
+    for (auto& data : fData)
+      op(data);
+    return op;
+  }
+
+  /// Applies an operation on all elements (read-only), and returns it.
+  template <typename Op>
+  Op apply(Op&& op) const
+  {
+    for (auto const& data : fData)
+      op(data);
+    return op;
+  }
+
+  /// Applies an operation on all elements, possibly concurrently.
+  /// @see `geo::GeoIDdataContainer::apply(TaskRunner_t const&, Op&&)`
+  template <typename Op>
+  void apply(geo::TaskRunner_t const& runner, Op&& op)
+  {
+    geo::details::applyInBlocks(fData.begin(), fData.size(), runner, op);
+  }
+
+  /// Applies an operation on all elements (read-only), possibly concurrently.
+  template <typename Op>
+  void apply(geo::TaskRunner_t const& runner, Op&& op) const
+  {
+    geo::details::applyInBlocks(fData.cbegin(), fData.size(), runner, op);
+  }
+
+  /// @}
+  // --- END Container modification --------------------------------------------
+
+private:
+  Container_t fData; ///< Data storage, indexed by channel.
+
+}; // class readout::ChannelDataContainer<>
+
+//------------------------------------------------------------------------------
+/**
+ * @brief Container with one flag per readout channel, packed in bits.
+ * @tparam Allocator type of allocator (rebound to the storage word type)
+ *
+ * This specialization stores the flags (e.g. the bad or noisy channel
+ * status) in 64-bit words, one bit per channel. Since single bits can't be
+ * referenced, the flags are read with `operator[]` or `test()` and written with
+ * `set()` and `reset()`. `count()` returns the number of flags which are set,
+ * on the whole container or on a channel range; `generate()` and the parallel
+ * `fill()` assign whole words in each task, and are therefore safe to run
+ * concurrently.
+ */
+template <typename Allocator>
+class readout::ChannelDataContainer<bool, Allocator> {
+
+public:
+  using Word_t = std::uint64_t; ///< Type of storage word.
+
+  using value_type = bool;
+  using size_type = std::size_t;
+  using allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<Word_t>;
+
+private:
+  static constexpr size_type WordBits = 64U; ///< Number of flags in a word.
+
+  /// Type of data storage.
+  using Container_t = std::vector<Word_t, allocator_type>;
+
+public:
+  /// Default constructor: empty container (see `resize()`).
+  ChannelDataContainer() = default;
+
+  /// Constructor: empty container, allocating memory via `alloc`.
+  explicit ChannelDataContainer(allocator_type const& alloc) : fData(alloc) {}
+
+  /// Constructor: `nChannels` flags, all unset.
+  explicit ChannelDataContainer(size_type nChannels,
+                                allocator_type const& alloc = allocator_type{})
+    : ChannelDataContainer(nChannels, false, alloc)
+  {}
+
+  /**
+   * @brief Constructor: `nChannels` flags, all set to `defValue`.
+   *
+   * Only a `bool` value is accepted, so that a pointer to a memory resource
+   * (`readout::pmr::ChannelDataContainer<bool> flags(n, &arena)`) turns into
+   * the allocator rather than into a `true` value.
+   */
+  template <typename V, typename = std::enable_if_t<std::is_same_v<V, bool>>>
+  ChannelDataContainer(size_type nChannels,
+                       V defValue,
+                       allocator_type const& alloc = allocator_type{})
+    : fData(alloc)
+  {
+    resize(nChannels, defValue);
+  }
+
+  // --- BEGIN Container status query ------------------------------------------
+  /// @name Container status query
+  /// @{
+
+  /// Returns the number of channels in the container.
+  size_type size() const { return fSize; }
+
+  /// Returns whether the container has no channels.
+  bool empty() const { return fSize == 0U; }
+
+  /// Returns whether the container has room for the flag of `channel`.
+  bool hasChannel(raw::ChannelID_t channel) const
+  {
+    return raw::isValidChannelID(channel) && (channel < size());
+  }
+
+  /// Returns the allocator of the data storage.
+  allocator_type get_allocator() const { return fData.get_allocator(); }
+
+  /// @}
+  // --- END Container status query --------------------------------------------
+
+  // --- BEGIN Flag access -----------------------------------------------------
+  /// @name Flag access
+  /// @{
+
+  /// Returns the flag of the specified channel (no range check).
+  bool operator[](raw::ChannelID_t channel) const { return test(channel); }
+
+  /// Returns the flag of the specified channel (no range check).
+  bool test(raw::ChannelID_t channel) const
+  {
+    return (fData[channel / WordBits] >> (channel % WordBits)) & Word_t{1};
+  }
+
+  /// Returns the flag of the specified channel.
+  /// @throw std::out_of_range if `channel` is not in the container
+  bool at(raw::ChannelID_t channel) const
+  {
+    if (hasChannel(channel)) return test(channel);
+    throw std::out_of_range("No data for channel " + std::to_string(channel));
+  }
+
+  /// Returns the number of flags which are set.
+  size_type count() const { return count(0U, size()); }
+
+  /// Returns the number of flags which are set among `n` channels from `first`.
+  size_type count(raw::ChannelID_t first, size_type n) const;
+
+  /// Returns the number of flags which are set in the channels of a readout plane.
+  /// @see `readout::ChannelDataContainer::ROPdata()`
+  template <typename ChannelMap>
+  size_type ROPcount(ChannelMap const& channelMap, readout::ROPID const& ropid) const
+  {
+    return count(channelMap.FirstChannelInROP(ropid), channelMap.Nchannels(ropid));
+  }
+
+  /// @}
+  // --- END Flag access -------------------------------------------------------
+
+  // --- BEGIN Container modification ------------------------------------------
+  /// @name Container modification
+  /// @{
+
+  /// Sets the flag of `channel` to `value` (no range check).
+  void set(raw::ChannelID_t channel, bool value = true)
+  {
+    Word_t const mask = Word_t{1} << (channel % WordBits);
+    Word_t& word = fData[channel / WordBits];
+    word = value ? (word | mask) : (word & ~mask);
+  }
+
+  /// Clears the flag of `channel` (no range check).
+  void reset(raw::ChannelID_t channel) { set(channel, false); }
+
+  /// Resizes the container to `nChannels` channels, new ones set to `defValue`.
+  void resize(size_type nChannels, bool defValue = false);
+
+  /// Removes all the flags (`size()` becomes `0`).
+  void clear()
+  {
+    fData.clear();
+    fSize = 0U;
+  }
+
+  /// Sets all the flags to `value`.
+  void fill(bool value)
+  {
+    std::fill(fData.begin(), fData.end(), value ? ~Word_t{0} : Word_t{0});
+    clearTail();
+  }
+
+  /// Clears all the flags.
+  void reset() { fill(false); }
+
+  /// Sets all the flags to `value`, splitting the work among tasks of `runner`.
+  void fill(geo::TaskRunner_t const& runner, bool value)
+  {
+    generate(runner, [value](raw::ChannelID_t) { return value; });
+  }
+
+  /**
+   * @brief Sets the flag of each channel to the one computed from the channel.
+   * @tparam Pred type of predicate
+   * @param runner the executor of the tasks
+   * @param pred callable returning the flag of a channel
+   * @see `readout::ChannelDataContainer::generate()`
+   *
+   * Each task sets complete words, so that no storage is shared among tasks.
+   */
+  template <typename Pred>
+  void generate(geo::TaskRunner_t const& runner, Pred&& pred);
+
+  /// @}
+  // --- END Container modification --------------------------------------------
+
+private:
+  Container_t fData;    ///< Flag storage.
+  size_type fSize = 0U; ///< Number of channels.
+
+  /// Returns the number of words needed for `n` flags.
+  static constexpr size_type nWords(size_type n) { return (n + WordBits - 1U) / WordBits; }
+
+  /// Clears the unused bits of the last word.
+  void clearTail()
+  {
+    if (fSize % WordBits) fData.back() &= (Word_t{1} << (fSize % WordBits)) - 1U;
+  }
+
+}; // class readout::ChannelDataContainer<bool>
+
 /// @}
 // --- END Readout data containers ---------------------------------------------
 //------------------------------------------------------------------------------
 
+//------------------------------------------------------------------------------
+//--- template implementation
+//------------------------------------------------------------------------------
+template <typename T, typename Allocator>
+template <typename Gen>
+void readout::ChannelDataContainer<T, Allocator>::generate(geo::TaskRunner_t const& runner,
+                                                           Gen&& gen)
+{
+  size_type const n = size();
+  size_type const nTasks = std::min<size_type>(n, geo::details::MaxApplyTasks);
+  geo::runTasks(runner, nTasks, [this, n, nTasks, &gen](std::size_t iTask) {
+    raw::ChannelID_t const begin = (n * iTask) / nTasks;
+    raw::ChannelID_t const end = (n * (iTask + 1)) / nTasks;
+    for (raw::ChannelID_t channel = begin; channel != end; ++channel)
+      fData[channel] = gen(channel);
+  });
+} // readout::ChannelDataContainer<>::generate()
+
+//------------------------------------------------------------------------------
+template <typename Allocator>
+auto readout::ChannelDataContainer<bool, Allocator>::count(raw::ChannelID_t first,
+                                                           size_type n) const -> size_type
+{
+  size_type total = 0U;
+  size_type channel = first;
+  size_type const end = first + n;
+  while (channel != end) {
+    size_type const shift = channel % WordBits;
+    size_type const nBits = std::min(WordBits - shift, end - channel);
+    Word_t word = fData[channel / WordBits] >> shift;
+    if (nBits < WordBits) word &= (Word_t{1} << nBits) - 1U;
+    total += __builtin_popcountll(word);
+    channel += nBits;
+  }
+  return total;
+} // readout::ChannelDataContainer<bool>::count()
+
+//------------------------------------------------------------------------------
+template <typename Allocator>
+void readout::ChannelDataContainer<bool, Allocator>::resize(size_type nChannels, bool defValue)
+{
+  size_type const oldSize = fSize;
+  fData.resize(nWords(nChannels), defValue ? ~Word_t{0} : Word_t{0});
+  fSize = nChannels;
+  // the new channels in the word which was the last one
+  if (defValue && (nChannels > oldSize) && (oldSize % WordBits)) {
+    fData[oldSize / WordBits] |= ~((Word_t{1} << (oldSize % WordBits)) - 1U);
+  }
+  clearTail();
+} // readout::ChannelDataContainer<bool>::resize()
+
+//------------------------------------------------------------------------------
+template <typename Allocator>
+template <typename Pred>
+void readout::ChannelDataContainer<bool, Allocator>::generate(geo::TaskRunner_t const& runner,
+                                                              Pred&& pred)
+{
+  size_type const words = fData.size();
+  size_type const n = fSize;
+  size_type const nTasks = std::min<size_type>(words, geo::details::MaxApplyTasks);
+  geo::runTasks(runner, nTasks, [this, words, n, nTasks, &pred](std::size_t iTask) {
+    for (size_type iWord = (words * iTask) / nTasks; iWord != (words * (iTask + 1)) / nTasks;
+         ++iWord) {
+      size_type const first = iWord * WordBits;
+      size_type const nBits = std::min(WordBits, n - first);
+      Word_t word = 0U;
+      for (size_type bit = 0; bit < nBits; ++bit)
+        if (pred(static_cast<raw::ChannelID_t>(first + bit))) word |= Word_t{1} << bit;
+      fData[iWord] = word;
+    }
+  });
+} // readout::ChannelDataContainer<bool>::generate()
+
+//------------------------------------------------------------------------------
+
 #endif // LARCOREALG_GEOMETRY_READOUTDATACONTAINERS_H
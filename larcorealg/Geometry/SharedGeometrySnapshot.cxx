@@ -0,0 +1,282 @@
+/**
+ * @file   larcorealg/Geometry/SharedGeometrySnapshot.cxx
+ * @brief  Geometry snapshot shared among processes via POSIX shared memory.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/SharedGeometrySnapshot.h`
+ */
+
+// LArSoft libraries
+#include "larcorealg/Geometry/SharedGeometrySnapshot.h"
+
+// framework libraries
+#include "cetlib_except/exception.h"
+
+// POSIX
+#include <fcntl.h>    // O_CREAT...
+#include <sys/mman.h> // shm_open(), mmap(), munmap()
+#include <sys/stat.h> // fstat()
+#include <unistd.h>   // close(), ftruncate()
+
+// C/C++ standard libraries
+#include <atomic>
+#include <cerrno>
+#include <cstring> // std::memcpy(), std::memcmp(), std::strerror()
+#include <new>     // placement new
+#include <sstream>
+#include <thread> // std::this_thread::sleep_for()
+#include <utility> // std::exchange()
+
+namespace {
+
+  /// Header of the shared segment, followed by the snapshot image and channels.
+  struct SegmentHeader_t {
+    char magic[8];                    ///< Format identifier.
+    std::atomic<std::uint32_t> state; ///< `Ready` once the segment is complete.
+    std::uint32_t version;            ///< Format version.
+    std::uint64_t fingerprint;        ///< Fingerprint of the geometry.
+    std::uint64_t imageSize;          ///< Size of the snapshot image.
+    std::uint64_t nChannels;          ///< Number of wire channels.
+  }; // SegmentHeader_t
+  static_assert(sizeof(SegmentHeader_t) % 8 == 0);
+  static_assert(std::atomic<std::uint32_t>::is_always_lock_free,
+                "Atomic flag is required to work across processes.");
+
+  constexpr char Magic[8] = {'L', 'A', 'R', 'G', 'E', 'O', 'S', 'H'};
+  constexpr std::uint32_t Version = 1U;
+  constexpr std::uint32_t Ready = 1U;
+
+  /// Polling period while waiting for a segment.
+  constexpr std::chrono::milliseconds PollPeriod{5};
+
+  /// Returns `size` rounded up to a multiple of 8.
+  constexpr std::size_t padded(std::size_t size) { return (size + 7U) & ~std::size_t{7U}; }
+
+  /// Returns an exception about the segment `name`, with the current `errno`.
+  cet::exception segmentError(std::string const& name, char const* what, int error)
+  {
+    return cet::exception("SharedGeometrySnapshot")
+           << what << " shared geometry segment '" << name << "': " << std::strerror(error)
+           << "\n";
+  }
+
+} // local namespace
+
+//------------------------------------------------------------------------------
+geo::SharedGeometrySnapshot::SharedGeometrySnapshot(std::string name,
+                                                    void const* data,
+                                                    std::size_t size)
+  : fName(std::move(name)), fData(data), fSize(size)
+{
+  try {
+    auto const* const header = static_cast<SegmentHeader_t const*>(fData);
+    if ((std::memcmp(header->magic, Magic, sizeof(Magic)) != 0) ||
+        (header->version != Version)) {
+      throw cet::exception("SharedGeometrySnapshot")
+        << "Segment '" << fName << "' does not contain a supported shared geometry.\n";
+    }
+    std::size_t const imageSpace = padded(header->imageSize);
+    std::size_t const channelSpace = header->nChannels * sizeof(raw::ChannelID_t);
+    if (sizeof(SegmentHeader_t) + imageSpace + channelSpace > fSize) {
+      throw cet::exception("SharedGeometrySnapshot")
+        << "Segment '" << fName << "' is truncated (" << fSize << " bytes).\n";
+    }
+    auto const* const image = static_cast<char const*>(fData) + sizeof(SegmentHeader_t);
+    fView.emplace(image, header->imageSize);
+    if (header->nChannels != fView->wires().size()) {
+      throw cet::exception("SharedGeometrySnapshot")
+        << "Segment '" << fName << "' has " << header->nChannels << " channels for "
+        << fView->wires().size() << " wires.\n";
+    }
+    auto const* const channels = reinterpret_cast<raw::ChannelID_t const*>(image + imageSpace);
+    fWireChannels = {channels, channels + header->nChannels};
+    fFingerprint = header->fingerprint;
+  }
+  catch (...) {
+    unmap();
+    throw;
+  }
+} // geo::SharedGeometrySnapshot::SharedGeometrySnapshot()
+
+//------------------------------------------------------------------------------
+geo::SharedGeometrySnapshot::SharedGeometrySnapshot(SharedGeometrySnapshot&& other) noexcept
+  : fName(std::move(other.fName))
+  , fData(std::exchange(other.fData, nullptr))
+  , fSize(std::exchange(other.fSize, 0U))
+  , fView(std::exchange(other.fView, std::nullopt))
+  , fWireChannels(std::exchange(other.fWireChannels, {nullptr, nullptr}))
+  , fFingerprint(other.fFingerprint)
+{}
+
+//------------------------------------------------------------------------------
+auto geo::SharedGeometrySnapshot::operator=(SharedGeometrySnapshot&& other) noexcept
+  -> SharedGeometrySnapshot&
+{
+  if (this == &other) return *this;
+  unmap();
+  fName = std::move(other.fName);
+  fData = std::exchange(other.fData, nullptr);
+  fSize = std::exchange(other.fSize, 0U);
+  fView = std::exchange(other.fView, std::nullopt);
+  fWireChannels = std::exchange(other.fWireChannels, {nullptr, nullptr});
+  fFingerprint = other.fFingerprint;
+  return *this;
+} // geo::SharedGeometrySnapshot::operator=()
+
+//------------------------------------------------------------------------------
+geo::SharedGeometrySnapshot::~SharedGeometrySnapshot()
+{
+  unmap();
+}
+
+//------------------------------------------------------------------------------
+auto geo::SharedGeometrySnapshot::publish(std::string const& name,
+                                          geo::SharedGeometryContent const& content)
+  -> SharedGeometrySnapshot
+{
+  int const fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+  if (fd < 0) throw segmentError(name, "Can't create", errno);
+  fill(name, fd, content);
+  return attach(name);
+} // geo::SharedGeometrySnapshot::publish()
+
+//------------------------------------------------------------------------------
+auto geo::SharedGeometrySnapshot::attach(std::string const& name,
+                                         std::chrono::milliseconds timeout)
+  -> SharedGeometrySnapshot
+{
+  Clock_t::time_point const deadline = Clock_t::now() + timeout;
+  auto const waitOrThrow = [&name, deadline](char const* what, int error) {
+    if (Clock_t::now() >= deadline) throw segmentError(name, what, error);
+    std::this_thread::sleep_for(PollPeriod);
+  };
+
+  while (true) {
+    int const fd = shm_open(name.c_str(), O_RDONLY, 0);
+    if (fd < 0) {
+      int const error = errno;
+      if (error != ENOENT) throw segmentError(name, "Can't open", error);
+      waitOrThrow("Can't open", error);
+      continue;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+      int const error = errno;
+      close(fd);
+      throw segmentError(name, "Can't query", error);
+    }
+    auto const size = static_cast<std::size_t>(info.st_size);
+    if (size < sizeof(SegmentHeader_t)) { // still being created
+      close(fd);
+      waitOrThrow("Timeout waiting for", ETIMEDOUT);
+      continue;
+    }
+
+    void* const data = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    int const error = errno;
+    close(fd); // the mapping stays valid after the segment is closed
+    if (data == MAP_FAILED) throw segmentError(name, "Can't map", error);
+
+    if (static_cast<SegmentHeader_t const*>(data)->state.load(std::memory_order_acquire) !=
+        Ready) { // still being filled
+      munmap(data, size);
+      waitOrThrow("Timeout waiting for", ETIMEDOUT);
+      continue;
+    }
+
+    return SharedGeometrySnapshot{name, data, size};
+  } // while
+} // geo::SharedGeometrySnapshot::attach()
+
+//------------------------------------------------------------------------------
+auto geo::SharedGeometrySnapshot::attachOrPublish(std::string const& name,
+                                                  ContentMaker_t const& makeContent,
+                                                  std::chrono::milliseconds timeout)
+  -> SharedGeometrySnapshot
+{
+  int const fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+  if (fd < 0) {
+    int const error = errno;
+    if (error != EEXIST) throw segmentError(name, "Can't create", error);
+    return attach(name, timeout); // another process is publishing it
+  }
+
+  geo::SharedGeometryContent content;
+  try {
+    content = makeContent();
+  }
+  catch (...) {
+    close(fd);
+    shm_unlink(name.c_str());
+    throw;
+  }
+  fill(name, fd, content);
+  return attach(name, timeout);
+} // geo::SharedGeometrySnapshot::attachOrPublish()
+
+//------------------------------------------------------------------------------
+bool geo::SharedGeometrySnapshot::remove(std::string const& name)
+{
+  if (shm_unlink(name.c_str()) == 0) return true;
+  int const error = errno;
+  if (error == ENOENT) return false;
+  throw segmentError(name, "Can't remove", error);
+} // geo::SharedGeometrySnapshot::remove()
+
+//------------------------------------------------------------------------------
+void geo::SharedGeometrySnapshot::fill(std::string const& name,
+                                       int fd,
+                                       geo::SharedGeometryContent const& content)
+{
+  try {
+    if (content.wireChannels.size() != content.snapshot.wires.size()) {
+      throw cet::exception("SharedGeometrySnapshot")
+        << "Shared geometry '" << name << "' has " << content.wireChannels.size()
+        << " channels for " << content.snapshot.wires.size() << " wires.\n";
+    }
+
+    std::ostringstream out;
+    content.snapshot.write(out);
+    std::string const image = out.str();
+
+    std::size_t const channelSpace = content.wireChannels.size() * sizeof(raw::ChannelID_t);
+    std::size_t const size = sizeof(SegmentHeader_t) + padded(image.size()) + channelSpace;
+    if (ftruncate(fd, static_cast<off_t>(size)) != 0)
+      throw segmentError(name, "Can't allocate", errno);
+
+    void* const data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (data == MAP_FAILED) throw segmentError(name, "Can't map", errno);
+
+    // the memory is zeroed by ftruncate(), so the segment is not ready yet
+    auto* const header = new (data) SegmentHeader_t;
+    std::memcpy(header->magic, Magic, sizeof(Magic));
+    header->version = Version;
+    header->fingerprint = content.fingerprint;
+    header->imageSize = image.size();
+    header->nChannels = content.wireChannels.size();
+    char* const imageStart = static_cast<char*>(data) + sizeof(SegmentHeader_t);
+    std::memcpy(imageStart, image.data(), image.size());
+    if (channelSpace > 0U) {
+      std::memcpy(imageStart + padded(image.size()), content.wireChannels.data(), channelSpace);
+    }
+    header->state.store(Ready, std::memory_order_release);
+
+    munmap(data, size);
+    close(fd);
+  }
+  catch (...) {
+    close(fd);
+    shm_unlink(name.c_str());
+    throw;
+  }
+} // geo::SharedGeometrySnapshot::fill()
+
+//------------------------------------------------------------------------------
+void geo::SharedGeometrySnapshot::unmap() noexcept
+{
+  if (fData) munmap(const_cast<void*>(fData), fSize);
+  fData = nullptr;
+  fSize = 0U;
+}
+
+//------------------------------------------------------------------------------
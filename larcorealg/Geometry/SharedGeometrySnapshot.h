@@ -0,0 +1,160 @@
+/**
+ * @file   larcorealg/Geometry/SharedGeometrySnapshot.h
+ * @brief  Geometry snapshot shared among processes via POSIX shared memory.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/SharedGeometrySnapshot.cxx`,
+ *         `larcorealg/Geometry/GeometrySnapshot.h`
+ * @ingroup Geometry
+ */
+
+#ifndef LARCOREALG_GEOMETRY_SHAREDGEOMETRYSNAPSHOT_H
+#define LARCOREALG_GEOMETRY_SHAREDGEOMETRYSNAPSHOT_H
+
+// LArSoft libraries
+#include "larcorealg/CoreUtils/span.h"
+#include "larcorealg/Geometry/GeometrySnapshot.h"
+#include "larcoreobj/SimpleTypesAndConstants/RawTypes.h" // raw::ChannelID_t
+
+// C/C++ standard libraries
+#include <chrono>
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint64_t
+#include <functional>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace geo {
+
+  class GeometryCore;
+
+  /// Content of a shared geometry segment (see `geo::SharedGeometrySnapshot`).
+  struct SharedGeometryContent {
+    geo::GeometrySnapshot snapshot; ///< The derived geometry.
+
+    /// Channel of each wire of `snapshot`, in the same order.
+    std::vector<raw::ChannelID_t> wireChannels;
+
+    std::uint64_t fingerprint = 0U; ///< As `geo::GeometryCore::Fingerprint()`.
+  }; // SharedGeometryContent
+
+  /// Returns the content to be shared for the geometry `geom`.
+  /// @note This function is in the `larcorealg::Geometry` library, while the
+  ///       rest of this header is in the ROOT-free `larcorealg::GeometryQuery`.
+  SharedGeometryContent makeSharedGeometryContent(geo::GeometryCore const& geom);
+
+  class SharedGeometrySnapshot;
+
+} // namespace geo
+
+//------------------------------------------------------------------------------
+/**
+ * @brief Read-only geometry snapshot in a named shared memory segment.
+ * @see `geo::SharedGeometryContent`, `geo::GeometrySnapshotView`
+ *
+ * Jobs running many worker processes on the same node may share a single
+ * copy of the derived geometry: the first process publishes the snapshot of
+ * its geometry (with the channel of each wire) in a POSIX shared memory
+ * segment, and the other processes attach to the segment and map it
+ * read-only, without loading the geometry at all.
+ *
+ * Example of a worker, where only the first process to get to the segment
+ * loads the geometry:
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * auto const shared = geo::SharedGeometrySnapshot::attachOrPublish(
+ *   "/mydetector_geometry",
+ *   []() { return geo::makeSharedGeometryContent(*loadGeometry()); });
+ * for (geo::snapshot::Wire_t const& wire: shared.view().wires()) // ...
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * The segment is marked as ready only after it has been completely written,
+ * and the processes attaching to it wait for that (up to a timeout).
+ * The segment persists until it is removed with `remove()` (the processes
+ * already attached keep their mapping); it is also removed if its
+ * publication fails.
+ *
+ * All the errors are reported by throwing `cet::exception` (category
+ * `"SharedGeometrySnapshot"`, or `"GeometrySnapshot"` for an invalid image).
+ */
+class geo::SharedGeometrySnapshot {
+
+public:
+  using Clock_t = std::chrono::steady_clock;
+
+  /// Default time to wait for a segment being published by another process.
+  static constexpr std::chrono::milliseconds DefaultTimeout{30000};
+
+  /// Function returning the content to be published.
+  using ContentMaker_t = std::function<geo::SharedGeometryContent()>;
+
+  SharedGeometrySnapshot(SharedGeometrySnapshot const&) = delete;
+  SharedGeometrySnapshot& operator=(SharedGeometrySnapshot const&) = delete;
+  SharedGeometrySnapshot(SharedGeometrySnapshot&& other) noexcept;
+  SharedGeometrySnapshot& operator=(SharedGeometrySnapshot&& other) noexcept;
+  ~SharedGeometrySnapshot();
+
+  /// Creates the segment `name` with `content`, then attaches to it.
+  /// @throw cet::exception if the segment already exists
+  static SharedGeometrySnapshot publish(std::string const& name,
+                                        geo::SharedGeometryContent const& content);
+
+  /// Attaches to the segment `name`, waiting up to `timeout` for it to exist and be ready.
+  static SharedGeometrySnapshot attach(std::string const& name,
+                                       std::chrono::milliseconds timeout = DefaultTimeout);
+
+  /**
+   * @brief Attaches to the segment `name`, publishing it first if needed.
+   * @param name name of the shared memory segment (e.g. `"/mydetector"`)
+   * @param makeContent returns the content to publish
+   * @param timeout time to wait for another process to complete the segment
+   *
+   * If there is no segment `name`, it is created and `makeContent()` is called
+   * to fill it; otherwise, `makeContent` is not called and the existing
+   * segment is attached. The creation is atomic, so that among concurrent
+   * processes exactly one publishes the segment.
+   */
+  static SharedGeometrySnapshot attachOrPublish(
+    std::string const& name,
+    ContentMaker_t const& makeContent,
+    std::chrono::milliseconds timeout = DefaultTimeout);
+
+  /// Removes the segment `name`; returns whether there was such a segment.
+  static bool remove(std::string const& name);
+
+  /// Returns the name of the shared memory segment.
+  std::string const& name() const { return fName; }
+
+  /// Returns the geometry snapshot in the segment.
+  geo::GeometrySnapshotView const& view() const { return *fView; }
+
+  /// Returns the channel of each wire of the snapshot, in the same order.
+  util::span<raw::ChannelID_t const*> wireChannels() const { return fWireChannels; }
+
+  /// Returns the fingerprint of the geometry (`geo::GeometryCore::Fingerprint()`).
+  std::uint64_t fingerprint() const { return fFingerprint; }
+
+  /// Returns the size of the mapped segment, in bytes.
+  std::size_t size() const { return fSize; }
+
+private:
+  std::string fName;                              ///< Name of the shared memory segment.
+  void const* fData = nullptr;                    ///< Start of the mapped segment.
+  std::size_t fSize = 0U;                         ///< Size of the mapped segment.
+  std::optional<geo::GeometrySnapshotView> fView; ///< Snapshot in the segment.
+  util::span<raw::ChannelID_t const*> fWireChannels{nullptr, nullptr}; ///< Channel of each wire.
+  std::uint64_t fFingerprint = 0U;                ///< Fingerprint of the geometry.
+
+  /// Takes ownership of the read-only mapping of the ready segment `name`.
+  SharedGeometrySnapshot(std::string name, void const* data, std::size_t size);
+
+  /// Fills the newly created segment open as `fd`; removes it on failure.
+  static void fill(std::string const& name, int fd, geo::SharedGeometryContent const& content);
+
+  /// Unmaps the segment, if mapped.
+  void unmap() noexcept;
+
+}; // geo::SharedGeometrySnapshot
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREALG_GEOMETRY_SHAREDGEOMETRYSNAPSHOT_H
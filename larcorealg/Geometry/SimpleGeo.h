@@ -553,7 +553,7 @@ template <typename Data>
 bool lar::util::simple_geo::Rectangle<Data>::overlaps(Rectangle_t const& r) const
 {
   if (isNull() || r.isNull()) return false;
-  return width.overlap(r.width) && depth.overlap(r.depth);
+  return width.overlaps(r.width) && depth.overlaps(r.depth);
 } // lar::util::simple_geo::Rectangle<Data>::overlaps()
 
 //------------------------------------------------------------------------------
@@ -0,0 +1,422 @@
+/**
+ * @file   larcorealg/Geometry/SimpleGeoArrays.h
+ * @brief  Collections of simple boxes stored by coordinate, and bulk operations.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/SimpleGeo.h`
+ * @ingroup Geometry
+ *
+ * This library is simple and header-only.
+ */
+
+#ifndef LARCOREALG_GEOMETRY_SIMPLEGEOARRAYS_H
+#define LARCOREALG_GEOMETRY_SIMPLEGEOARRAYS_H
+
+// LArSoft libraries
+#include "larcorealg/Geometry/SimpleGeo.h"
+
+// C/C++ standard library
+#include <array>
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint8_t
+#include <limits>
+#include <utility> // std::pair
+#include <vector>
+
+namespace lar::util::simple_geo {
+
+  /**
+   * @brief Collection of boxes aligned with the axes, stored by coordinate.
+   * @tparam Data numerical type for boundary coordinates
+   * @tparam NDim number of dimensions of the boxes
+   *
+   * Each boundary of all the boxes is kept in its own array ("structure of
+   * arrays"), which the bulk operations in `simple_geo::bulk` process in loops
+   * the compiler can vectorize.
+   *
+   * Boxes are added from the objects of `SimpleGeo.h`: `Range` (1D),
+   * `Rectangle` (2D, width being dimension 0 and depth dimension 1), `Area`
+   * (2D) and `Volume` (3D). Boxes with a lower boundary larger than the upper
+   * one (like a default-constructed `Range`) may be added: they contain no
+   * point and overlap nothing.
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * lar::util::simple_geo::VolumeArraySoA<> ROIs;
+   * for (auto const& ROI: ROIlist) ROIs.push_back(ROI);
+   *
+   * std::vector<double> overlaps(ROIs.size() * others.size());
+   * lar::util::simple_geo::bulk::intersectionMeasures(ROIs, others, overlaps.data());
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   */
+  template <typename Data, std::size_t NDim>
+  class BoxArraySoA {
+  public:
+    using Data_t = Data; ///< Numerical type for boundaries.
+
+    /// Returns the number of dimensions of the boxes.
+    static constexpr std::size_t dimensions() { return NDim; }
+
+    /// Constructor: an empty collection.
+    BoxArraySoA() = default;
+
+    /// Constructor: copies the boxes in [`begin`, `end`[.
+    template <typename Iter>
+    BoxArraySoA(Iter begin, Iter end)
+    {
+      for (; begin != end; ++begin)
+        push_back(*begin);
+    }
+
+    /// Returns the number of boxes.
+    std::size_t size() const { return fLower[0].size(); }
+
+    /// Returns whether there is no box.
+    bool empty() const { return fLower[0].empty(); }
+
+    /// Prepares room for `n` boxes.
+    void reserve(std::size_t n);
+
+    /// Removes all the boxes.
+    void clear();
+
+    /// Adds a box with the specified boundaries (not sorted).
+    void push_back(std::array<Data_t, NDim> const& lower, std::array<Data_t, NDim> const& upper);
+
+    /// @{
+    /// @name Addition of `SimpleGeo.h` objects
+
+    /// Adds a range (one-dimensional box).
+    void push_back(Range<Data_t> const& range)
+    {
+      static_assert(NDim == 1U, "A range can only be added to one-dimensional boxes.");
+      push_back({range.lower}, {range.upper});
+    }
+
+    /// Adds a rectangle (width, depth).
+    void push_back(Rectangle<Data_t> const& rect)
+    {
+      static_assert(NDim == 2U, "A rectangle can only be added to two-dimensional boxes.");
+      push_back({rect.width.lower, rect.depth.lower}, {rect.width.upper, rect.depth.upper});
+    }
+
+    /// Adds an area (_x_, _y_).
+    void push_back(Area<Point2D<Data_t>> const& area)
+    {
+      static_assert(NDim == 2U, "An area can only be added to two-dimensional boxes.");
+      push_back({area.Min().x, area.Min().y}, {area.Max().x, area.Max().y});
+    }
+
+    /// Adds a volume (_x_, _y_, _z_).
+    void push_back(Volume<Point3D<Data_t>> const& volume)
+    {
+      static_assert(NDim == 3U, "A volume can only be added to three-dimensional boxes.");
+      push_back({volume.Min().x, volume.Min().y, volume.Min().z},
+                {volume.Max().x, volume.Max().y, volume.Max().z});
+    }
+
+    /// @}
+
+    /// @{
+    /// @name Access to the columns
+    /// Returns the lower boundary on dimension `dim` of all the boxes.
+    Data_t const* lower(unsigned int dim) const { return fLower[dim].data(); }
+    /// Returns the upper boundary on dimension `dim` of all the boxes.
+    Data_t const* upper(unsigned int dim) const { return fUpper[dim].data(); }
+    /// @}
+
+    /// Returns the lower boundary on dimension `dim` of the box `i`.
+    Data_t lower(std::size_t i, unsigned int dim) const { return fLower[dim][i]; }
+
+    /// Returns the upper boundary on dimension `dim` of the box `i`.
+    Data_t upper(std::size_t i, unsigned int dim) const { return fUpper[dim][i]; }
+
+  private:
+    std::array<std::vector<Data_t>, NDim> fLower; ///< Lower boundaries, by dimension.
+    std::array<std::vector<Data_t>, NDim> fUpper; ///< Upper boundaries, by dimension.
+
+  }; // class BoxArraySoA<>
+
+  /// Collection of ranges, stored by coordinate.
+  template <typename Data = double>
+  using RangeArraySoA = BoxArraySoA<Data, 1U>;
+
+  /// Collection of rectangles or areas, stored by coordinate.
+  template <typename Data = double>
+  using AreaArraySoA = BoxArraySoA<Data, 2U>;
+
+  /// Collection of volumes, stored by coordinate.
+  template <typename Data = double>
+  using VolumeArraySoA = BoxArraySoA<Data, 3U>;
+
+  /**
+   * @brief Operations on many simple boxes or points at once.
+   *
+   * Containment follows `Range::contains()`: the boundaries are included.
+   * Overlap follows `Range::overlaps()`: boxes overlap if they share a part
+   * of finite size on every dimension, which is when the measure (length,
+   * area or volume) of their intersection is positive.
+   */
+  namespace bulk {
+
+    /**
+     * @brief Tests whether a point is in each of the boxes.
+     * @param boxes the boxes
+     * @param point coordinates of the point, one for each dimension
+     * @param[out] mask array with room for a result for each box:
+     *                  `1` if the box contains the point, `0` otherwise
+     */
+    template <typename Data, std::size_t NDim>
+    void contains(BoxArraySoA<Data, NDim> const& boxes,
+                  std::array<Data, NDim> const& point,
+                  std::uint8_t* __restrict__ mask);
+
+    /**
+     * @brief Tests whether each of many points is in a box.
+     * @param lower lower boundaries of the box
+     * @param upper upper boundaries of the box
+     * @param n number of points
+     * @param coords array of `NDim` pointers to the coordinates of the points
+     * @param[out] mask array with room for a result for each point
+     */
+    template <typename Data, std::size_t NDim>
+    void containsPoints(std::array<Data, NDim> const& lower,
+                        std::array<Data, NDim> const& upper,
+                        std::size_t n,
+                        std::array<Data const*, NDim> const& coords,
+                        std::uint8_t* __restrict__ mask);
+
+    /// Tests whether each of `n` points (`x`, `y`, `z`) is in `volume`.
+    template <typename Data>
+    void containsPoints(Volume<Point3D<Data>> const& volume,
+                        std::size_t n,
+                        Data const* x,
+                        Data const* y,
+                        Data const* z,
+                        std::uint8_t* mask)
+    {
+      containsPoints<Data, 3U>({volume.Min().x, volume.Min().y, volume.Min().z},
+                               {volume.Max().x, volume.Max().y, volume.Max().z},
+                               n,
+                               {x, y, z},
+                               mask);
+    }
+
+    /// Tests whether each of `n` points (`w`, `d`) is in `rect`.
+    template <typename Data>
+    void containsPoints(Rectangle<Data> const& rect,
+                        std::size_t n,
+                        Data const* w,
+                        Data const* d,
+                        std::uint8_t* mask)
+    {
+      containsPoints<Data, 2U>({rect.width.lower, rect.depth.lower},
+                               {rect.width.upper, rect.depth.upper},
+                               n,
+                               {w, d},
+                               mask);
+    }
+
+    /**
+     * @brief Computes the measure of the intersection of each pair of boxes.
+     * @param a the first set of boxes
+     * @param b the second set of boxes
+     * @param[out] measures array for `a.size()` x `b.size()` results
+     *
+     * The measure (length, area or volume) of the intersection of `a[i]` and
+     * `b[j]` is written into `measures[i * b.size() + j]`; it is `0` if the
+     * boxes do not overlap.
+     */
+    template <typename Data, std::size_t NDim>
+    void intersectionMeasures(BoxArraySoA<Data, NDim> const& a,
+                              BoxArraySoA<Data, NDim> const& b,
+                              Data* __restrict__ measures);
+
+    /**
+     * @brief Tests whether each pair of boxes overlaps.
+     * @param a the first set of boxes
+     * @param b the second set of boxes
+     * @param[out] mask array for `a.size()` x `b.size()` results
+     * @return the number of overlapping pairs
+     *
+     * The result for `a[i]` and `b[j]` is written into `mask[i * b.size() + j]`.
+     */
+    template <typename Data, std::size_t NDim>
+    std::size_t overlaps(BoxArraySoA<Data, NDim> const& a,
+                         BoxArraySoA<Data, NDim> const& b,
+                         std::uint8_t* __restrict__ mask);
+
+    /**
+     * @brief Returns the box including all the boxes.
+     * @return lower and upper boundaries of the bounding box
+     *
+     * Boxes with a lower boundary larger than the upper one are ignored.
+     * If there is no other box, the result is such a box.
+     */
+    template <typename Data, std::size_t NDim>
+    std::pair<std::array<Data, NDim>, std::array<Data, NDim>> boundingBox(
+      BoxArraySoA<Data, NDim> const& boxes);
+
+  } // namespace bulk
+
+} // namespace lar::util::simple_geo
+
+//==============================================================================
+//--- Template implementation
+//---
+//------------------------------------------------------------------------------
+template <typename Data, std::size_t NDim>
+void lar::util::simple_geo::BoxArraySoA<Data, NDim>::reserve(std::size_t n)
+{
+  for (unsigned int dim = 0; dim < NDim; ++dim) {
+    fLower[dim].reserve(n);
+    fUpper[dim].reserve(n);
+  }
+} // lar::util::simple_geo::BoxArraySoA<>::reserve()
+
+//------------------------------------------------------------------------------
+template <typename Data, std::size_t NDim>
+void lar::util::simple_geo::BoxArraySoA<Data, NDim>::clear()
+{
+  for (unsigned int dim = 0; dim < NDim; ++dim) {
+    fLower[dim].clear();
+    fUpper[dim].clear();
+  }
+} // lar::util::simple_geo::BoxArraySoA<>::clear()
+
+//------------------------------------------------------------------------------
+template <typename Data, std::size_t NDim>
+void lar::util::simple_geo::BoxArraySoA<Data, NDim>::push_back(
+  std::array<Data_t, NDim> const& lower,
+  std::array<Data_t, NDim> const& upper)
+{
+  for (unsigned int dim = 0; dim < NDim; ++dim) {
+    fLower[dim].push_back(lower[dim]);
+    fUpper[dim].push_back(upper[dim]);
+  }
+} // lar::util::simple_geo::BoxArraySoA<>::push_back()
+
+//------------------------------------------------------------------------------
+template <typename Data, std::size_t NDim>
+void lar::util::simple_geo::bulk::contains(BoxArraySoA<Data, NDim> const& boxes,
+                                           std::array<Data, NDim> const& point,
+                                           std::uint8_t* __restrict__ mask)
+{
+  std::size_t const n = boxes.size();
+  for (std::size_t i = 0; i < n; ++i)
+    mask[i] = 1U;
+  // one dimension at a time, each loop over all the boxes vectorizes
+  for (unsigned int dim = 0; dim < NDim; ++dim) {
+    Data const* __restrict__ lower = boxes.lower(dim);
+    Data const* __restrict__ upper = boxes.upper(dim);
+    Data const c = point[dim];
+    for (std::size_t i = 0; i < n; ++i)
+      mask[i] &= (c >= lower[i]) & (c <= upper[i]);
+  }
+} // lar::util::simple_geo::bulk::contains()
+
+//------------------------------------------------------------------------------
+template <typename Data, std::size_t NDim>
+void lar::util::simple_geo::bulk::containsPoints(std::array<Data, NDim> const& lower,
+                                                 std::array<Data, NDim> const& upper,
+                                                 std::size_t n,
+                                                 std::array<Data const*, NDim> const& coords,
+                                                 std::uint8_t* __restrict__ mask)
+{
+  for (std::size_t i = 0; i < n; ++i)
+    mask[i] = 1U;
+  for (std::size_t dim = 0; dim < NDim; ++dim) {
+    Data const* __restrict__ c = coords[dim];
+    Data const l = lower[dim];
+    Data const u = upper[dim];
+    for (std::size_t i = 0; i < n; ++i)
+      mask[i] &= (c[i] >= l) & (c[i] <= u);
+  }
+} // lar::util::simple_geo::bulk::containsPoints()
+
+//------------------------------------------------------------------------------
+template <typename Data, std::size_t NDim>
+void lar::util::simple_geo::bulk::intersectionMeasures(BoxArraySoA<Data, NDim> const& a,
+                                                       BoxArraySoA<Data, NDim> const& b,
+                                                       Data* __restrict__ measures)
+{
+  std::size_t const nB = b.size();
+  for (std::size_t i = 0; i < a.size(); ++i) {
+    Data* __restrict__ row = measures + i * nB;
+    for (std::size_t j = 0; j < nB; ++j)
+      row[j] = Data{1};
+    // one dimension at a time; a box of `a` against all boxes of `b`
+    for (unsigned int dim = 0; dim < NDim; ++dim) {
+      Data const* __restrict__ lower = b.lower(dim);
+      Data const* __restrict__ upper = b.upper(dim);
+      Data const aLower = a.lower(i, dim);
+      Data const aUpper = a.upper(i, dim);
+      for (std::size_t j = 0; j < nB; ++j) {
+        Data const l = (lower[j] > aLower) ? lower[j] : aLower;
+        Data const u = (upper[j] < aUpper) ? upper[j] : aUpper;
+        row[j] *= (u > l) ? (u - l) : Data{0};
+      }
+    } // for dimensions
+  }   // for boxes in a
+} // lar::util::simple_geo::bulk::intersectionMeasures()
+
+//------------------------------------------------------------------------------
+template <typename Data, std::size_t NDim>
+std::size_t lar::util::simple_geo::bulk::overlaps(BoxArraySoA<Data, NDim> const& a,
+                                                  BoxArraySoA<Data, NDim> const& b,
+                                                  std::uint8_t* __restrict__ mask)
+{
+  std::size_t const nB = b.size();
+  std::size_t nOverlaps = 0;
+  for (std::size_t i = 0; i < a.size(); ++i) {
+    std::uint8_t* __restrict__ row = mask + i * nB;
+    for (std::size_t j = 0; j < nB; ++j)
+      row[j] = 1U;
+    for (unsigned int dim = 0; dim < NDim; ++dim) {
+      Data const* __restrict__ lower = b.lower(dim);
+      Data const* __restrict__ upper = b.upper(dim);
+      Data const aLower = a.lower(i, dim);
+      Data const aUpper = a.upper(i, dim);
+      // same as `Range::overlaps()`, including the check of null ranges
+      bool const aValid = aLower < aUpper;
+      for (std::size_t j = 0; j < nB; ++j)
+        row[j] &= aValid & (lower[j] < upper[j]) & (lower[j] < aUpper) & (aLower < upper[j]);
+    } // for dimensions
+    for (std::size_t j = 0; j < nB; ++j)
+      nOverlaps += row[j];
+  } // for boxes in a
+  return nOverlaps;
+} // lar::util::simple_geo::bulk::overlaps()
+
+//------------------------------------------------------------------------------
+template <typename Data, std::size_t NDim>
+auto lar::util::simple_geo::bulk::boundingBox(BoxArraySoA<Data, NDim> const& boxes)
+  -> std::pair<std::array<Data, NDim>, std::array<Data, NDim>>
+{
+  std::array<Data, NDim> lowest, highest;
+  lowest.fill(std::numeric_limits<Data>::max());
+  highest.fill(std::numeric_limits<Data>::lowest());
+
+  // inverted boxes are marked first, then skipped on all dimensions
+  std::size_t const n = boxes.size();
+  std::vector<std::uint8_t> valid(n, 1U);
+  for (unsigned int dim = 0; dim < NDim; ++dim) {
+    Data const* __restrict__ lower = boxes.lower(dim);
+    Data const* __restrict__ upper = boxes.upper(dim);
+    for (std::size_t i = 0; i < n; ++i)
+      valid[i] &= (lower[i] <= upper[i]);
+  }
+  for (unsigned int dim = 0; dim < NDim; ++dim) {
+    Data const* __restrict__ lower = boxes.lower(dim);
+    Data const* __restrict__ upper = boxes.upper(dim);
+    Data l = lowest[dim], u = highest[dim];
+    for (std::size_t i = 0; i < n; ++i) {
+      l = (valid[i] && (lower[i] < l)) ? lower[i] : l;
+      u = (valid[i] && (upper[i] > u)) ? upper[i] : u;
+    }
+    lowest[dim] = l;
+    highest[dim] = u;
+  }
+  return {lowest, highest};
+} // lar::util::simple_geo::bulk::boundingBox()
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREALG_GEOMETRY_SIMPLEGEOARRAYS_H
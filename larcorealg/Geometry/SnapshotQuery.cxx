@@ -0,0 +1,213 @@
+/**
+ * @file   larcorealg/Geometry/SnapshotQuery.cxx
+ * @brief  Channel and wire queries on a geometry snapshot, without ROOT.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/SnapshotQuery.h`
+ */
+
+// LArSoft libraries
+#include "larcorealg/Geometry/SnapshotQuery.h"
+#include "larcorealg/CoreUtils/MemoryUsage.h" // lar::util::heapMemory()
+#include "larcorealg/Geometry/SharedGeometrySnapshot.h"
+
+// framework libraries
+#include "cetlib_except/exception.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::max()
+#include <cmath>     // std::sqrt()
+#include <cstdint>   // std::uint8_t
+
+namespace {
+
+  /// Returns the parameters of the wire coordinate of `plane`.
+  geo::details::WireCoordinateKernel makeKernel(geo::snapshot::Plane_t const& plane,
+                                                util::span<geo::snapshot::Wire_t const*> wires)
+  {
+    geo::details::WireCoordinateKernel kernel{};
+    // a plane with a single wire may have no pitch, and all points map to that wire
+    kernel.pitch = (plane.wirePitch > 0.0) ? plane.wirePitch : 1.0;
+    kernel.nWires = plane.nWires;
+    if (plane.nWires == 0U) return kernel;
+
+    geo::snapshot::Wire_t const& first = wires.begin()[plane.firstWire];
+    for (std::size_t k = 0; k < 3U; ++k) {
+      kernel.origin[k] = first.center[k];
+      kernel.wireDir[k] = first.direction[k];
+    }
+
+    // the wire coordinate increases across the wires, on the plane
+    double const* const n = plane.normal;
+    double const* const w = kernel.wireDir;
+    kernel.dir[0] = n[1] * w[2] - n[2] * w[1];
+    kernel.dir[1] = n[2] * w[0] - n[0] * w[2];
+    kernel.dir[2] = n[0] * w[1] - n[1] * w[0];
+    double norm =
+      std::sqrt(kernel.dir[0] * kernel.dir[0] + kernel.dir[1] * kernel.dir[1] +
+                kernel.dir[2] * kernel.dir[2]);
+    if (plane.nWires > 1U) {
+      geo::snapshot::Wire_t const& last = wires.begin()[plane.firstWire + plane.nWires - 1U];
+      double along = 0.0;
+      for (std::size_t k = 0; k < 3U; ++k)
+        along += (last.center[k] - first.center[k]) * kernel.dir[k];
+      if (along < 0.0) norm = -norm;
+    }
+    if (norm != 0.0) {
+      for (double& c : kernel.dir)
+        c /= norm;
+    }
+    return kernel;
+  } // makeKernel()
+
+} // local namespace
+
+//------------------------------------------------------------------------------
+geo::SnapshotQuery::SnapshotQuery(geo::GeometrySnapshotView const& view,
+                                  util::span<raw::ChannelID_t const*> wireChannels)
+  : fView{&view}, fWireChannels{wireChannels}
+{
+  auto const cryostats = view.cryostats();
+  auto const TPCs = view.TPCs();
+  auto const planes = view.planes();
+  auto const wires = view.wires();
+  if (wireChannels.size() != wires.size()) {
+    throw cet::exception("SnapshotQuery")
+      << "SnapshotQuery: " << wireChannels.size() << " channels given for the "
+      << wires.size() << " wires of the snapshot\n";
+  }
+
+  // the snapshot has been validated, so all the indices are within range
+  fTPCIDs.resize(TPCs.size());
+  for (unsigned int c = 0; c < cryostats.size(); ++c) {
+    for (unsigned int t = 0; t < cryostats.begin()[c].nTPCs; ++t)
+      fTPCIDs[cryostats.begin()[c].firstTPC + t] = geo::TPCID{c, t};
+  }
+  fPlaneIDs.resize(planes.size());
+  for (std::size_t i = 0; i < TPCs.size(); ++i) {
+    for (unsigned int p = 0; p < TPCs.begin()[i].nPlanes; ++p)
+      fPlaneIDs[TPCs.begin()[i].firstPlane + p] = geo::PlaneID{fTPCIDs[i], p};
+  }
+  fKernels.reserve(planes.size());
+  for (geo::snapshot::Plane_t const& plane : planes)
+    fKernels.push_back(makeKernel(plane, wires));
+
+  // wires of each channel: counting, then filling in order of wire ID
+  raw::ChannelID_t nChannels = 0U;
+  for (raw::ChannelID_t const channel : wireChannels) {
+    if (raw::isValidChannelID(channel)) nChannels = std::max(nChannels, channel + 1U);
+  }
+  fChannelWireOffsets.assign(nChannels + 1U, 0U);
+  for (raw::ChannelID_t const channel : wireChannels) {
+    if (raw::isValidChannelID(channel)) ++fChannelWireOffsets[channel + 1U];
+  }
+  for (raw::ChannelID_t channel = 0; channel < nChannels; ++channel)
+    fChannelWireOffsets[channel + 1U] += fChannelWireOffsets[channel];
+
+  std::vector<std::size_t> next{fChannelWireOffsets.begin(), fChannelWireOffsets.end() - 1};
+  fChannelWires.resize(fChannelWireOffsets.back());
+  for (std::size_t i = 0; i < planes.size(); ++i) {
+    geo::snapshot::Plane_t const& plane = planes.begin()[i];
+    for (unsigned int w = 0; w < plane.nWires; ++w) {
+      raw::ChannelID_t const channel = wireChannels.begin()[plane.firstWire + w];
+      if (raw::isValidChannelID(channel))
+        fChannelWires[next[channel]++] = geo::WireID{fPlaneIDs[i], w};
+    }
+  }
+} // geo::SnapshotQuery::SnapshotQuery()
+
+//------------------------------------------------------------------------------
+geo::SnapshotQuery::SnapshotQuery(geo::SharedGeometrySnapshot const& shared)
+  : SnapshotQuery{shared.view(), shared.wireChannels()}
+{}
+
+//------------------------------------------------------------------------------
+geo::snapshot::Plane_t const& geo::SnapshotQuery::plane(geo::PlaneID const& planeid) const
+{
+  std::size_t const index = planeIndex(planeid);
+  if (index == NoIndex) {
+    throw cet::exception("SnapshotQuery") << "Plane " << planeid << " is not in the snapshot\n";
+  }
+  return fView->planes().begin()[index];
+} // geo::SnapshotQuery::plane()
+
+//------------------------------------------------------------------------------
+geo::snapshot::Wire_t const& geo::SnapshotQuery::wire(geo::WireID const& wireid) const
+{
+  std::size_t const index = wireIndex(wireid);
+  if (index == NoIndex) {
+    throw cet::exception("SnapshotQuery") << "Wire " << wireid << " is not in the snapshot\n";
+  }
+  return fView->wires().begin()[index];
+} // geo::SnapshotQuery::wire()
+
+//------------------------------------------------------------------------------
+geo::TPCID geo::SnapshotQuery::findTPC(Coords_t const& point) const
+{
+  auto const TPCs = fView->TPCs();
+  for (std::size_t i = 0; i < TPCs.size(); ++i) {
+    geo::snapshot::Box_t const& box = TPCs.begin()[i].box;
+    if ((point[0] >= box.min[0]) && (point[0] <= box.max[0]) && (point[1] >= box.min[1]) &&
+        (point[1] <= box.max[1]) && (point[2] >= box.min[2]) && (point[2] <= box.max[2]))
+      return fTPCIDs[i];
+  }
+  return {};
+} // geo::SnapshotQuery::findTPC()
+
+//------------------------------------------------------------------------------
+geo::WireID geo::SnapshotQuery::nearestWireID(Coords_t const& point,
+                                              geo::PlaneID const& planeid) const
+{
+  geo::details::WireCoordinateKernel const& planeKernel = kernel(planeid);
+  geo::details::WireCoordinateKernel::WireNo_t wire = 0U;
+  std::uint8_t valid = 0U;
+  planeKernel.nearestWires(1U, &point[0], &point[1], &point[2], &wire, &valid);
+  return valid ? geo::WireID{planeid, wire} : geo::WireID{};
+} // geo::SnapshotQuery::nearestWireID()
+
+//------------------------------------------------------------------------------
+std::size_t geo::SnapshotQuery::heapMemory() const
+{
+  return lar::util::heapMemory(fTPCIDs) + lar::util::heapMemory(fPlaneIDs) +
+         lar::util::heapMemory(fKernels) + lar::util::heapMemory(fChannelWireOffsets) +
+         lar::util::heapMemory(fChannelWires);
+} // geo::SnapshotQuery::heapMemory()
+
+//------------------------------------------------------------------------------
+std::size_t geo::SnapshotQuery::TPCIndex(geo::TPCID const& tpcid) const
+{
+  auto const cryostats = fView->cryostats();
+  if (!tpcid.isValid || (tpcid.Cryostat >= cryostats.size())) return NoIndex;
+  geo::snapshot::Cryostat_t const& cryo = cryostats.begin()[tpcid.Cryostat];
+  return (tpcid.TPC < cryo.nTPCs) ? cryo.firstTPC + tpcid.TPC : NoIndex;
+} // geo::SnapshotQuery::TPCIndex()
+
+//------------------------------------------------------------------------------
+std::size_t geo::SnapshotQuery::planeIndex(geo::PlaneID const& planeid) const
+{
+  std::size_t const iTPC = TPCIndex(planeid);
+  if (iTPC == NoIndex) return NoIndex;
+  geo::snapshot::TPC_t const& tpc = fView->TPCs().begin()[iTPC];
+  return (planeid.Plane < tpc.nPlanes) ? tpc.firstPlane + planeid.Plane : NoIndex;
+} // geo::SnapshotQuery::planeIndex()
+
+//------------------------------------------------------------------------------
+std::size_t geo::SnapshotQuery::wireIndex(geo::WireID const& wireid) const
+{
+  std::size_t const iPlane = planeIndex(wireid);
+  if (iPlane == NoIndex) return NoIndex;
+  geo::snapshot::Plane_t const& plane = fView->planes().begin()[iPlane];
+  return (wireid.Wire < plane.nWires) ? plane.firstWire + wireid.Wire : NoIndex;
+} // geo::SnapshotQuery::wireIndex()
+
+//------------------------------------------------------------------------------
+geo::details::WireCoordinateKernel const& geo::SnapshotQuery::kernel(
+  geo::PlaneID const& planeid) const
+{
+  std::size_t const index = planeIndex(planeid);
+  if (index == NoIndex) {
+    throw cet::exception("SnapshotQuery") << "Plane " << planeid << " is not in the snapshot\n";
+  }
+  return fKernels[index];
+} // geo::SnapshotQuery::kernel()
+
+//------------------------------------------------------------------------------
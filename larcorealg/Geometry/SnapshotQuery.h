@@ -0,0 +1,195 @@
+/**
+ * @file   larcorealg/Geometry/SnapshotQuery.h
+ * @brief  Channel and wire queries on a geometry snapshot, without ROOT.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/SnapshotQuery.cxx`
+ */
+
+#ifndef LARCOREALG_GEOMETRY_SNAPSHOTQUERY_H
+#define LARCOREALG_GEOMETRY_SNAPSHOTQUERY_H
+
+// LArSoft libraries
+#include "larcorealg/CoreUtils/span.h"
+#include "larcorealg/Geometry/GeometrySnapshot.h"
+#include "larcorealg/Geometry/details/WireCoordinateKernel.h"
+#include "larcoreobj/SimpleTypesAndConstants/RawTypes.h" // raw::ChannelID_t
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+
+// C/C++ standard libraries
+#include <array>
+#include <cstddef> // std::size_t
+#include <vector>
+
+namespace geo {
+
+  class SharedGeometrySnapshot;
+
+  /**
+   * @brief Lookups of TPCs, wires and channels on a geometry snapshot.
+   * @see `geo::GeometrySnapshotView`, `geo::SharedGeometrySnapshot`
+   *
+   * This object answers the most common queries of `geo::GeometryCore` for
+   * jobs which have a geometry snapshot (from a file or a shared memory
+   * segment) and the channel of each of its wires, and nothing else:
+   * * the TPC containing a point (`findTPC()`, as
+   *   `geo::GeometryCore::FindTPCAtPosition()`);
+   * * the wire coordinate of a point and its nearest wire on a plane
+   *   (`wireCoordinate()`, `nearestWireID()`, `nearestChannel()`);
+   * * the channel of a wire and the wires of a channel (`channel()`,
+   *   `channelToWires()`).
+   *
+   * It is part of the `larcorealg::GeometryQuery` library, which depends on
+   * no ROOT component: points are given by their coordinates in the world
+   * frame [cm], and the results are the usual geometry and channel IDs.
+   * The plane parameters are extracted once by the constructor, after which
+   * each query is a few arithmetic operations, as in `geo::GeometryCore`.
+   *
+   * The snapshot view must stay valid as long as this object is used.
+   * Queries on IDs of elements which are not in the snapshot return invalid
+   * results, unless stated otherwise.
+   */
+  class SnapshotQuery {
+
+  public:
+    /// Type of coordinates of a point in the world frame [cm]
+    using Coords_t = std::array<double, 3U>;
+
+    /// Type of list of wire IDs.
+    using WireIDspan_t = util::span<geo::WireID const*>;
+
+    /**
+     * @brief Constructor: prepares the queries on a snapshot.
+     * @param view the geometry snapshot
+     * @param wireChannels the channel of each wire of the snapshot, in order
+     * @throw cet::exception (category `"SnapshotQuery"`) if the number of
+     *        channels does not match the number of wires
+     */
+    SnapshotQuery(geo::GeometrySnapshotView const& view,
+                  util::span<raw::ChannelID_t const*> wireChannels);
+
+    /// Constructor: queries on the snapshot of a shared memory segment.
+    explicit SnapshotQuery(geo::SharedGeometrySnapshot const& shared);
+
+    // --- BEGIN -- Content ----------------------------------------------------
+    /// Returns the snapshot the queries are on.
+    geo::GeometrySnapshotView const& view() const { return *fView; }
+
+    /// Returns the number of TPCs in the snapshot.
+    std::size_t nTPCs() const { return fTPCIDs.size(); }
+
+    /// Returns the number of wire planes in the snapshot.
+    std::size_t nPlanes() const { return fPlaneIDs.size(); }
+
+    /// Returns the number of channels (one past the largest channel ID).
+    raw::ChannelID_t nChannels() const
+    {
+      return fChannelWireOffsets.empty() ? 0U : fChannelWireOffsets.size() - 1U;
+    }
+
+    /// Returns whether the snapshot has the TPC `tpcid`.
+    bool hasTPC(geo::TPCID const& tpcid) const { return TPCIndex(tpcid) != NoIndex; }
+
+    /// Returns whether the snapshot has the plane `planeid`.
+    bool hasPlane(geo::PlaneID const& planeid) const { return planeIndex(planeid) != NoIndex; }
+
+    /// Returns whether the snapshot has the wire `wireid`.
+    bool hasWire(geo::WireID const& wireid) const { return wireIndex(wireid) != NoIndex; }
+
+    /// Returns the record of the plane `planeid`.
+    /// @throw cet::exception (category `"SnapshotQuery"`) if not in the snapshot
+    geo::snapshot::Plane_t const& plane(geo::PlaneID const& planeid) const;
+
+    /// Returns the record of the wire `wireid`.
+    /// @throw cet::exception (category `"SnapshotQuery"`) if not in the snapshot
+    geo::snapshot::Wire_t const& wire(geo::WireID const& wireid) const;
+    // --- END ---- Content ----------------------------------------------------
+
+    // --- BEGIN -- Position queries -------------------------------------------
+    /// Returns the ID of the TPC containing `point` (invalid if none).
+    geo::TPCID findTPC(Coords_t const& point) const;
+
+    /// Returns the wire coordinate of `point` on the plane `planeid`.
+    /// @throw cet::exception (category `"SnapshotQuery"`) if not in the snapshot
+    double wireCoordinate(Coords_t const& point, geo::PlaneID const& planeid) const
+    {
+      return kernel(planeid).wireCoordinate(point[0], point[1], point[2]);
+    }
+
+    /**
+     * @brief Returns the wire of `planeid` nearest to `point`.
+     * @return the ID of the wire, invalid if `point` is beyond the wires
+     * @throw cet::exception (category `"SnapshotQuery"`) if not in the snapshot
+     *
+     * Unlike `geo::GeometryCore::NearestWireID()`, no exception is thrown
+     * for points out of the plane; an invalid ID is returned instead.
+     */
+    geo::WireID nearestWireID(Coords_t const& point, geo::PlaneID const& planeid) const;
+
+    /// Returns the channel of the wire of `planeid` nearest to `point`
+    /// (invalid if none).
+    raw::ChannelID_t nearestChannel(Coords_t const& point, geo::PlaneID const& planeid) const
+    {
+      geo::WireID const wireid = nearestWireID(point, planeid);
+      return wireid ? channel(wireid) : raw::InvalidChannelID;
+    }
+    // --- END ---- Position queries -------------------------------------------
+
+    // --- BEGIN -- Channel queries --------------------------------------------
+    /// Returns the channel of the wire `wireid` (invalid if not in the snapshot).
+    raw::ChannelID_t channel(geo::WireID const& wireid) const
+    {
+      std::size_t const index = wireIndex(wireid);
+      return (index == NoIndex) ? raw::InvalidChannelID : fWireChannels.begin()[index];
+    }
+
+    /// Returns the sorted IDs of the wires read by `channel` (empty if none).
+    WireIDspan_t channelToWires(raw::ChannelID_t channel) const
+    {
+      if (!raw::isValidChannelID(channel) || (channel >= nChannels())) return {};
+      geo::WireID const* const start = fChannelWires.data();
+      return {start + fChannelWireOffsets[channel], start + fChannelWireOffsets[channel + 1U]};
+    }
+    // --- END ---- Channel queries --------------------------------------------
+
+    /// Returns the memory allocated by the tables, besides their own size [bytes]
+    std::size_t heapMemory() const;
+
+  private:
+    /// Index of an element not in the snapshot.
+    static constexpr std::size_t NoIndex = ~std::size_t{0};
+
+    geo::GeometrySnapshotView const* fView; ///< The snapshot.
+
+    std::vector<geo::TPCID> fTPCIDs;     ///< ID of each TPC of the snapshot.
+    std::vector<geo::PlaneID> fPlaneIDs; ///< ID of each plane of the snapshot.
+
+    /// Parameters of each plane of the snapshot.
+    std::vector<geo::details::WireCoordinateKernel> fKernels;
+
+    util::span<raw::ChannelID_t const*> fWireChannels; ///< Channel of each wire.
+
+    /// Start of the wires of each channel in `fChannelWires` (last: the end).
+    std::vector<std::size_t> fChannelWireOffsets;
+
+    std::vector<geo::WireID> fChannelWires; ///< Wires of all the channels.
+
+    /// Returns the index of the TPC `tpcid` in the snapshot, or `NoIndex`.
+    std::size_t TPCIndex(geo::TPCID const& tpcid) const;
+
+    /// Returns the index of the plane `planeid` in the snapshot, or `NoIndex`.
+    std::size_t planeIndex(geo::PlaneID const& planeid) const;
+
+    /// Returns the index of the wire `wireid` in the snapshot, or `NoIndex`.
+    std::size_t wireIndex(geo::WireID const& wireid) const;
+
+    /// Returns the parameters of the plane `planeid`.
+    /// @throw cet::exception (category `"SnapshotQuery"`) if not in the snapshot
+    geo::details::WireCoordinateKernel const& kernel(geo::PlaneID const& planeid) const;
+
+  }; // class SnapshotQuery
+
+} // namespace geo
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREALG_GEOMETRY_SNAPSHOTQUERY_H
@@ -0,0 +1,420 @@
+/**
+ * @file   larcorealg/Geometry/SyntheticDetectorGDML.cxx
+ * @brief  Writer of GDML descriptions of parametric LArTPC detectors.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/SyntheticDetectorGDML.h`
+ */
+
+// library header
+#include "larcorealg/Geometry/SyntheticDetectorGDML.h"
+
+// framework libraries
+#include "cetlib_except/exception.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::max(), std::min()
+#include <cmath>     // std::sin(), std::cos(), std::ceil(), std::sqrt()
+#include <ostream>
+#include <sstream>
+
+//------------------------------------------------------------------------------
+namespace {
+
+  /// Gap between the sides of the TPC box and of the active volume/planes.
+  constexpr double TPCmargin = 1.0;
+
+  /// Gap between adjacent volumes, to avoid their overlap.
+  constexpr double Gap = 0.1;
+
+  /// Distance between the cryostat walls and the TPCs.
+  constexpr double CryostatPadding = 20.0;
+
+  /// Distance between the cryostats, and to the detector enclosure walls.
+  constexpr double CryostatSpacing = 50.0;
+
+  /// Thickness of the volume of a wire plane.
+  constexpr double PlaneThickness = 0.15;
+
+  /// Distance between the wire planes.
+  constexpr double PlaneSpacing = 0.3;
+
+  /// Radius of the wires.
+  constexpr double WireRadius = 0.0075;
+
+  /// Size of a cell of a grid of `n` elements covering `sizeX` x `sizeZ`.
+  struct Grid_t {
+    unsigned int nX = 1U, nZ = 1U; ///< Number of cells.
+    double cellX = 0.0, cellZ = 0.0; ///< Size of a cell.
+
+    Grid_t(unsigned int n, double sizeX, double sizeZ)
+    {
+      if (n == 0U) return;
+      nZ = std::max(1U, static_cast<unsigned int>(std::ceil(std::sqrt(n * sizeZ / sizeX))));
+      nX = (n + nZ - 1U) / nZ;
+      cellX = sizeX / nX;
+      cellZ = sizeZ / nZ;
+    }
+
+    /// Returns the offset of the center of the cell of element `i`.
+    double x(unsigned int i) const { return (i / nZ + 0.5 - nX / 2.0) * cellX; }
+    double z(unsigned int i) const { return (i % nZ + 0.5 - nZ / 2.0) * cellZ; }
+  }; // Grid_t
+
+  /// Writes the attributes of a box with the specified sizes.
+  void box(std::ostream& out, std::string const& name, double x, double y, double z)
+  {
+    out << "  <box name=\"" << name << "\" lunit=\"cm\" x=\"" << x << "\" y=\"" << y
+        << "\" z=\"" << z << "\"/>\n";
+  }
+
+  /// Writes a volume with a material and a solid, without closing it.
+  void openVolume(std::ostream& out,
+                  std::string const& name,
+                  std::string const& material,
+                  std::string const& solid)
+  {
+    out << "  <volume name=\"" << name << "\">\n"
+        << "    <materialref ref=\"" << material << "\"/>\n"
+        << "    <solidref ref=\"" << solid << "\"/>\n";
+  }
+
+  /// Writes the end of a volume.
+  void closeVolume(std::ostream& out, std::string const& name)
+  {
+    out << "  </volume> <!-- \"" << name << "\" -->\n";
+  }
+
+  /// Writes a placement of `volume` at the specified position.
+  void physvol(std::ostream& out,
+               std::string const& volume,
+               std::string const& posName,
+               double x,
+               double y,
+               double z,
+               std::string const& rotation = "")
+  {
+    out << "    <physvol>\n"
+        << "      <volumeref ref=\"" << volume << "\"/>\n"
+        << "      <position name=\"" << posName << "\" unit=\"cm\" x=\"" << x << "\" y=\"" << y
+        << "\" z=\"" << z << "\"/>\n";
+    if (!rotation.empty()) out << "      <rotationref ref=\"" << rotation << "\"/>\n";
+    out << "    </physvol>\n";
+  }
+
+} // local namespace
+
+//------------------------------------------------------------------------------
+geo::SyntheticDetectorGDML::SyntheticDetectorGDML(Config_t const& config) : fConfig{config}
+{
+  if ((fConfig.nCryostats == 0U) || (fConfig.nTPCsX == 0U) || (fConfig.nTPCsY == 0U) ||
+      (fConfig.nTPCsZ == 0U)) {
+    throw cet::exception("SyntheticDetectorGDML")
+      << "At least one cryostat and one TPC per direction are required.\n";
+  }
+  if (fConfig.nWires == 0U) {
+    throw cet::exception("SyntheticDetectorGDML") << "At least one wire per plane is required.\n";
+  }
+  if ((fConfig.wirePitch <= 0.0) || (fConfig.driftLength <= 0.0) || (fConfig.height <= 0.0)) {
+    throw cet::exception("SyntheticDetectorGDML")
+      << "Wire pitch, drift length and height must be positive.\n";
+  }
+  if ((fConfig.inductionAngle <= 0.0) || (fConfig.inductionAngle >= 90.0)) {
+    throw cet::exception("SyntheticDetectorGDML")
+      << "Induction wire angle (" << fConfig.inductionAngle
+      << " degrees) must be between 0 and 90 degrees.\n";
+  }
+
+  computeInductionWires();
+} // geo::SyntheticDetectorGDML::SyntheticDetectorGDML()
+
+//------------------------------------------------------------------------------
+unsigned int geo::SyntheticDetectorGDML::nTPCs() const
+{
+  return fConfig.nCryostats * fConfig.nTPCsX * fConfig.nTPCsY * fConfig.nTPCsZ;
+}
+
+//------------------------------------------------------------------------------
+std::string geo::SyntheticDetectorGDML::gdml() const
+{
+  std::ostringstream sstr;
+  write(sstr);
+  return sstr.str();
+}
+
+//------------------------------------------------------------------------------
+double geo::SyntheticDetectorGDML::TPChalfX() const
+{
+  return fConfig.driftLength / 2.0 + TPCmargin / 2.0;
+}
+
+//------------------------------------------------------------------------------
+void geo::SyntheticDetectorGDML::computeInductionWires()
+{
+  // in the (y, z) frame of the plane, wires have direction (cos, -sin) and
+  // are spaced by one pitch along their normal (sin, cos)
+  double const angle = fConfig.inductionAngle * M_PI / 180.0;
+  double const s = std::sin(angle), c = std::cos(angle);
+  double const halfH = fConfig.height / 2.0, halfL = activeLength() / 2.0;
+
+  double const tMax = halfH * s + halfL * c; // largest normal offset
+  unsigned int const nWires = static_cast<unsigned int>(2.0 * tMax / fConfig.wirePitch);
+
+  fInductionWires.clear();
+  fInductionWires.reserve(nWires);
+  for (unsigned int i = 0; i < nWires; ++i) {
+    double const t = (i - (nWires - 1U) / 2.0) * fConfig.wirePitch;
+    // range of the position along the wire which is within the plane
+    double const sMin = std::max((-halfH - t * s) / c, (t * c - halfL) / s);
+    double const sMax = std::min((halfH - t * s) / c, (t * c + halfL) / s);
+    double const sMid = (sMin + sMax) / 2.0;
+    fInductionWires.push_back({t * s + sMid * c, t * c - sMid * s, sMax - sMin});
+  } // for
+} // geo::SyntheticDetectorGDML::computeInductionWires()
+
+//------------------------------------------------------------------------------
+void geo::SyntheticDetectorGDML::write(std::ostream& out) const
+{
+  Config_t const& cfg = fConfig;
+
+  // --- dimensions ------------------------------------------------------------
+  double const halfX = TPChalfX();
+  double const activeL = activeLength();
+  double const TPCsizeX = 2.0 * halfX, TPCsizeY = cfg.height + TPCmargin,
+               TPCsizeZ = activeL + TPCmargin;
+
+  double const stepX = TPCsizeX + Gap, stepY = TPCsizeY + Gap, stepZ = TPCsizeZ + Gap;
+  double const arrayX = cfg.nTPCsX * stepX, arrayY = cfg.nTPCsY * stepY,
+               arrayZ = cfg.nTPCsZ * stepZ;
+
+  // TPCs are raised to leave room for the optical detectors below them
+  double const cryoX = arrayX + 2.0 * CryostatPadding,
+               cryoY = arrayY + 4.0 * CryostatPadding,
+               cryoZ = arrayZ + 2.0 * CryostatPadding;
+  double const arrayOffsetY = CryostatPadding;
+  double const opDetY = -arrayY / 2.0 - CryostatPadding;
+
+  double const cryoStepX = cryoX + CryostatSpacing;
+  double const enclosureX = cfg.nCryostats * cryoStepX + CryostatSpacing,
+               enclosureY = cryoY + 2.0 * CryostatSpacing,
+               enclosureZ = cryoZ + 2.0 * CryostatSpacing;
+  double const auxDetY = cryoY / 2.0 + CryostatSpacing / 2.0;
+
+  Grid_t const opDetGrid{cfg.nOpDetsPerCryostat, arrayX, arrayZ};
+  double const opDetSize = std::min(10.0, 0.9 * std::min(opDetGrid.cellX, opDetGrid.cellZ));
+
+  Grid_t const auxDetGrid{cfg.nAuxDets, enclosureX - CryostatSpacing, cryoZ};
+  double const auxDetX = 0.9 * auxDetGrid.cellX, auxDetZ = 0.9 * auxDetGrid.cellZ;
+
+  out.precision(10);
+
+  // --- header ----------------------------------------------------------------
+  out << "<?xml version=\"1.0\" encoding=\"UTF-8\" ?>\n"
+      << "<!-- \"" << cfg.name << "\": synthetic LArTPC detector written by "
+      << "geo::SyntheticDetectorGDML\n"
+      << "     " << cfg.nCryostats << " cryostat(s), each with " << cfg.nTPCsX << " x "
+      << cfg.nTPCsY << " x " << cfg.nTPCsZ << " TPCs and " << cfg.nOpDetsPerCryostat
+      << " optical detectors;\n"
+      << "     " << nWiresPerTPC() << " wires per TPC (" << nInductionWires() << " per induction "
+      << "plane, " << nCollectionWires() << " in the collection plane);\n"
+      << "     " << cfg.nAuxDets << " auxiliary detectors.\n"
+      << "  -->\n"
+      << "<gdml xmlns:gdml=\"http://cern.ch/2001/Schemas/GDML\"\n"
+      << "      xmlns:xsi=\"http://www.w3.org/2001/XMLSchema-instance\"\n"
+      << "      xsi:noNamespaceSchemaLocation=\"GDMLSchema/gdml.xsd\">\n\n";
+
+  // --- definitions -----------------------------------------------------------
+  out << "<define>\n"
+      << "  <rotation name=\"rPlus90AboutX\" unit=\"deg\" x=\"90\" y=\"0\" z=\"0\"/>\n"
+      << "  <rotation name=\"rInductionAngleAboutX\" unit=\"deg\" x=\""
+      << (90.0 + cfg.inductionAngle) << "\" y=\"0\" z=\"0\"/>\n"
+      << "  <rotation name=\"rPlus180AboutY\" unit=\"deg\" x=\"0\" y=\"180\" z=\"0\"/>\n"
+      << "</define>\n\n";
+
+  // --- materials -------------------------------------------------------------
+  out << "<materials>\n"
+      << "  <element name=\"hydrogen\" formula=\"H\" Z=\"1\"> <atom value=\"1.0079\"/> "
+         "</element>\n"
+      << "  <element name=\"nitrogen\" formula=\"N\" Z=\"7\"> <atom value=\"14.0067\"/> "
+         "</element>\n"
+      << "  <element name=\"oxygen\" formula=\"O\" Z=\"8\"> <atom value=\"15.999\"/> "
+         "</element>\n"
+      << "  <element name=\"carbon\" formula=\"C\" Z=\"6\"> <atom value=\"12.0107\"/> "
+         "</element>\n"
+      << "  <element name=\"titanium\" formula=\"Ti\" Z=\"22\"> <atom value=\"47.867\"/> "
+         "</element>\n"
+      << "  <element name=\"argon\" formula=\"Ar\" Z=\"18\"> <atom value=\"39.9480\"/> "
+         "</element>\n"
+      << "  <material name=\"LAr\" formula=\"LAr\">\n"
+      << "    <D value=\"1.40\" unit=\"g/cm3\"/>\n"
+      << "    <fraction n=\"1.0000\" ref=\"argon\"/>\n"
+      << "  </material>\n"
+      << "  <material name=\"Air\" formula=\" \">\n"
+      << "    <D value=\"0.001205\" unit=\"g/cm3\"/>\n"
+      << "    <fraction n=\"0.781154\" ref=\"nitrogen\"/>\n"
+      << "    <fraction n=\"0.209476\" ref=\"oxygen\"/>\n"
+      << "    <fraction n=\"0.00937\" ref=\"argon\"/>\n"
+      << "  </material>\n"
+      << "  <material name=\"Titanium\" formula=\"Ti\">\n"
+      << "    <D value=\"4.506\" unit=\"g/cm3\"/>\n"
+      << "    <fraction n=\"1.\" ref=\"titanium\"/>\n"
+      << "  </material>\n"
+      << "  <material name=\"Polystyrene\">\n"
+      << "    <D value=\"1.06\" unit=\"g/cm3\"/>\n"
+      << "    <fraction n=\"0.077418\" ref=\"hydrogen\"/>\n"
+      << "    <fraction n=\"0.922582\" ref=\"carbon\"/>\n"
+      << "  </material>\n"
+      << "</materials>\n\n";
+
+  // --- solids ----------------------------------------------------------------
+  out << "<solids>\n";
+  for (std::size_t i = 0; i < fInductionWires.size(); ++i) {
+    out << "  <tube name=\"TPCWireU" << i << "\" rmax=\"" << WireRadius << "\" z=\""
+        << fInductionWires[i].length << "\" deltaphi=\"360\" aunit=\"deg\" lunit=\"cm\"/>\n";
+  }
+  out << "  <tube name=\"TPCWireVert\" rmax=\"" << WireRadius << "\" z=\"" << cfg.height
+      << "\" deltaphi=\"360\" aunit=\"deg\" lunit=\"cm\"/>\n";
+  box(out, "TPCPlane", PlaneThickness, cfg.height, activeL);
+  box(out, "TPCActive", cfg.driftLength, cfg.height, activeL);
+  box(out, "TPC", TPCsizeX, TPCsizeY, TPCsizeZ);
+  box(out, "OpDetPaddle", opDetSize, 2.0, opDetSize);
+  box(out, "Cryostat", cryoX, cryoY, cryoZ);
+  if (cfg.nAuxDets > 0U) {
+    box(out, "AuxDetBox", auxDetX, 1.0, auxDetZ);
+    box(out, "AuxDetSensitiveBox", 0.98 * auxDetX, 0.9, 0.98 * auxDetZ);
+  }
+  box(out, "DetEnclosure", enclosureX, enclosureY, enclosureZ);
+  box(out, "World", enclosureX + 400.0, enclosureY + 400.0, enclosureZ + 400.0);
+  out << "</solids>\n\n";
+
+  // --- structure -------------------------------------------------------------
+  out << "<structure>\n";
+
+  // wires
+  for (std::size_t i = 0; i < fInductionWires.size(); ++i) {
+    std::string const name = "volTPCWireU" + std::to_string(i);
+    openVolume(out, name, "Titanium", "TPCWireU" + std::to_string(i));
+    closeVolume(out, name);
+  }
+  openVolume(out, "volTPCWireVert", "Titanium", "TPCWireVert");
+  closeVolume(out, "volTPCWireVert");
+
+  // induction plane (also used flipped, for the second induction plane)
+  openVolume(out, "volTPCPlane", "LAr", "TPCPlane");
+  for (std::size_t i = 0; i < fInductionWires.size(); ++i) {
+    Wire_t const& wire = fInductionWires[i];
+    physvol(out,
+            "volTPCWireU" + std::to_string(i),
+            "posTPCWireU" + std::to_string(i),
+            0.0,
+            wire.y,
+            wire.z,
+            "rInductionAngleAboutX");
+  }
+  closeVolume(out, "volTPCPlane");
+
+  // collection plane
+  openVolume(out, "volTPCPlaneVert", "LAr", "TPCPlane");
+  for (unsigned int i = 0; i < cfg.nWires; ++i) {
+    physvol(out,
+            "volTPCWireVert",
+            "posTPCWireVert" + std::to_string(i),
+            0.0,
+            0.0,
+            (i + 0.5) * cfg.wirePitch - activeL / 2.0,
+            "rPlus90AboutX");
+  }
+  closeVolume(out, "volTPCPlaneVert");
+
+  // TPC, with the planes on its negative x side
+  openVolume(out, "volTPCActive", "LAr", "TPCActive");
+  closeVolume(out, "volTPCActive");
+  openVolume(out, "volTPC", "LAr", "TPC");
+  physvol(out, "volTPCActive", "posTPCActive", TPCmargin / 2.0, 0.0, 0.0);
+  double const planeX = -halfX + PlaneThickness;
+  physvol(out, "volTPCPlaneVert", "posTPCPlaneVert", planeX, 0.0, 0.0);
+  physvol(out, "volTPCPlane", "posTPCPlane", planeX + PlaneSpacing, 0.0, 0.0);
+  physvol(out,
+          "volTPCPlane",
+          "posTPCPlane2",
+          planeX + 2.0 * PlaneSpacing,
+          0.0,
+          0.0,
+          "rPlus180AboutY");
+  closeVolume(out, "volTPC");
+
+  // optical detectors
+  openVolume(out, "volOpDetSensitive", "LAr", "OpDetPaddle");
+  closeVolume(out, "volOpDetSensitive");
+
+  // cryostat
+  openVolume(out, "volCryostat", "LAr", "Cryostat");
+  unsigned int iTPC = 0U;
+  for (unsigned int ix = 0; ix < cfg.nTPCsX; ++ix) {
+    for (unsigned int iy = 0; iy < cfg.nTPCsY; ++iy) {
+      for (unsigned int iz = 0; iz < cfg.nTPCsZ; ++iz) {
+        // odd TPCs are flipped, so that they share the cathode with the even ones
+        physvol(out,
+                "volTPC",
+                "posTPC" + std::to_string(iTPC++),
+                (ix + 0.5 - cfg.nTPCsX / 2.0) * stepX,
+                (iy + 0.5 - cfg.nTPCsY / 2.0) * stepY + arrayOffsetY,
+                (iz + 0.5 - cfg.nTPCsZ / 2.0) * stepZ,
+                (ix % 2U == 1U) ? "rPlus180AboutY" : "");
+      } // for z
+    }   // for y
+  }     // for x
+  for (unsigned int i = 0; i < cfg.nOpDetsPerCryostat; ++i) {
+    physvol(out,
+            "volOpDetSensitive",
+            "posOpDet" + std::to_string(i),
+            opDetGrid.x(i),
+            opDetY,
+            opDetGrid.z(i));
+  }
+  closeVolume(out, "volCryostat");
+
+  // auxiliary detectors
+  for (unsigned int i = 0; i < cfg.nAuxDets; ++i) {
+    std::string const name = "volAuxDet" + std::to_string(i);
+    std::string const sensName = "volAuxDetSensitive" + std::to_string(i);
+    openVolume(out, sensName, "Polystyrene", "AuxDetSensitiveBox");
+    closeVolume(out, sensName);
+    openVolume(out, name, "Air", "AuxDetBox");
+    physvol(out, sensName, "posAuxDetSensitive" + std::to_string(i), 0.0, 0.0, 0.0);
+    closeVolume(out, name);
+  }
+
+  // detector enclosure
+  openVolume(out, "volDetEnclosure", "Air", "DetEnclosure");
+  for (unsigned int i = 0; i < cfg.nCryostats; ++i) {
+    physvol(out,
+            "volCryostat",
+            "posCryostat" + std::to_string(i),
+            (i + 0.5 - cfg.nCryostats / 2.0) * cryoStepX,
+            0.0,
+            0.0);
+  }
+  for (unsigned int i = 0; i < cfg.nAuxDets; ++i) {
+    physvol(out,
+            "volAuxDet" + std::to_string(i),
+            "posAuxDet" + std::to_string(i),
+            auxDetGrid.x(i),
+            auxDetY,
+            auxDetGrid.z(i));
+  }
+  closeVolume(out, "volDetEnclosure");
+
+  // world
+  openVolume(out, "volWorld", "Air", "World");
+  physvol(out, "volDetEnclosure", "posDetEnclosure", 0.0, 0.0, 0.0);
+  closeVolume(out, "volWorld");
+
+  out << "</structure>\n\n"
+      << "<setup name=\"Default\" version=\"1.0\">\n"
+      << "  <world ref=\"volWorld\"/>\n"
+      << "</setup>\n\n"
+      << "</gdml>\n";
+
+} // geo::SyntheticDetectorGDML::write()
+
+//------------------------------------------------------------------------------
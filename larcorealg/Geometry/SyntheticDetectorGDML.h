@@ -0,0 +1,133 @@
+/**
+ * @file   larcorealg/Geometry/SyntheticDetectorGDML.h
+ * @brief  Writer of GDML descriptions of parametric LArTPC detectors.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/SyntheticDetectorGDML.cxx`
+ */
+
+#ifndef LARCOREALG_GEOMETRY_SYNTHETICDETECTORGDML_H
+#define LARCOREALG_GEOMETRY_SYNTHETICDETECTORGDML_H
+
+// C/C++ standard libraries
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace geo {
+
+  /**
+   * @brief Writes the GDML description of a detector of parametric size.
+   *
+   * The detector follows the conventions of the standard geometry builder
+   * (`geo::GeometryBuilderStandard`) and of `LArTPCdetector.gdml`, so that it
+   * can be loaded like any other detector with the standard channel mapping.
+   * It is meant to test how the geometry queries scale with the size of the
+   * detector, up to and beyond the size of a far detector:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * geo::SyntheticDetectorGDML::Config_t config;
+   * config.nCryostats = 2U;
+   * config.nTPCsZ = 25U;
+   * config.nOpDetsPerCryostat = 500U;
+   * std::ofstream out{"synthetic.gdml"};
+   * geo::SyntheticDetectorGDML{config}.write(out);
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   *
+   * The detector is made of:
+   * * `nCryostats` box cryostats, side by side along _x_;
+   * * in each cryostat, a grid of `nTPCsX` x `nTPCsY` x `nTPCsZ` identical
+   *   TPCs; along _x_, TPCs are alternately flipped so that each pair shares
+   *   its cathode;
+   * * in each TPC, three wire planes: two induction planes with wires at
+   *   +/- `inductionAngle` from the vertical direction, and a collection plane
+   *   with `nWires` vertical wires; the length of the TPC along _z_ is
+   *   `nWires` times the wire pitch;
+   * * in each cryostat, `nOpDetsPerCryostat` box optical detectors in a grid
+   *   below the TPCs;
+   * * `nAuxDets` auxiliary detectors in a grid above the cryostats, each with
+   *   one sensitive volume.
+   *
+   * The GDML size is independent of the number of TPCs, since all of them
+   * share the same volume description; it is proportional to the number of
+   * wires in a single plane, and to the number of auxiliary detectors.
+   */
+  class SyntheticDetectorGDML {
+  public:
+    /// Parameters of the detector; all lengths are in centimeters.
+    struct Config_t {
+      std::string name = "SyntheticDetector"; ///< Name of the detector.
+      unsigned int nCryostats = 1U;           ///< Number of cryostats.
+      unsigned int nTPCsX = 2U;               ///< TPCs along _x_ in a cryostat.
+      unsigned int nTPCsY = 1U;               ///< TPCs along _y_ in a cryostat.
+      unsigned int nTPCsZ = 1U;               ///< TPCs along _z_ in a cryostat.
+      unsigned int nWires = 400U;             ///< Wires in the collection plane.
+      double wirePitch = 0.3;                 ///< Distance between wires.
+      double inductionAngle = 60.0; ///< Induction wire angle from vertical [degree]
+      double driftLength = 250.0;   ///< Length of the active volume along _x_.
+      double height = 250.0;        ///< Height of the active volume.
+      unsigned int nOpDetsPerCryostat = 10U; ///< Optical detectors in a cryostat.
+      unsigned int nAuxDets = 0U;            ///< Number of auxiliary detectors.
+    }; // Config_t
+
+    /// Constructor: computes the wire layout of the detector.
+    /// @throw cet::exception (category: "SyntheticDetectorGDML") on invalid
+    ///        configuration
+    SyntheticDetectorGDML(Config_t const& config);
+
+    /// Returns the configuration of the detector.
+    Config_t const& config() const { return fConfig; }
+
+    // --- BEGIN -- Expected content -------------------------------------------
+    /// @name Expected content
+    /// @{
+
+    /// Returns the total number of TPCs.
+    unsigned int nTPCs() const;
+
+    /// Returns the number of wires in each induction plane.
+    unsigned int nInductionWires() const { return fInductionWires.size(); }
+
+    /// Returns the number of wires in each collection plane.
+    unsigned int nCollectionWires() const { return fConfig.nWires; }
+
+    /// Returns the total number of wires in a TPC.
+    unsigned int nWiresPerTPC() const { return 2U * nInductionWires() + nCollectionWires(); }
+
+    /// Returns the total number of optical detectors.
+    unsigned int nOpDets() const { return fConfig.nCryostats * fConfig.nOpDetsPerCryostat; }
+
+    /// Returns the total number of auxiliary detectors.
+    unsigned int nAuxDets() const { return fConfig.nAuxDets; }
+
+    /// @}
+    // --- END -- Expected content ---------------------------------------------
+
+    /// Writes the GDML description of the detector into `out`.
+    void write(std::ostream& out) const;
+
+    /// Returns the GDML description of the detector.
+    std::string gdml() const;
+
+  private:
+    /// An induction wire, in the frame of its plane.
+    struct Wire_t {
+      double y, z;   ///< Center of the wire.
+      double length; ///< Length of the wire.
+    };
+
+    Config_t fConfig;                    ///< Detector parameters.
+    std::vector<Wire_t> fInductionWires; ///< Wires of an induction plane.
+
+    /// Returns half of the size of the TPC box along _x_.
+    double TPChalfX() const;
+
+    /// Returns the length of the active volume along _z_.
+    double activeLength() const { return fConfig.nWires * fConfig.wirePitch; }
+
+    /// Computes the layout of the wires in an induction plane.
+    void computeInductionWires();
+
+  }; // class SyntheticDetectorGDML
+
+} // namespace geo
+
+#endif // LARCOREALG_GEOMETRY_SYNTHETICDETECTORGDML_H
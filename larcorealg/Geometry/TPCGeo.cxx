@@ -27,8 +27,6 @@
 #include <algorithm> // std::max(), std::copy()
 #include <cassert>
 #include <cmath>
-#include <functional> // std::mem_fn()
-#include <iterator>   // std::inserter()
 #include <map>
 #include <sstream> // std::ostringstream
 
@@ -142,6 +140,7 @@ namespace geo {
 
     InitTPCBoundaries();
     ResetDriftDirection();
+    UpdatePlaneViewCache();
 
   } // TPCGeo::TPCGeo()
 
@@ -192,14 +191,7 @@ namespace geo {
   {
     SortPlanes(fPlanes);
 
-    // the PlaneID_t cast convert InvalidID into a rvalue (non-reference);
-    // leaving it a reference would cause C++ to treat it as such,
-    // that can't be because InvalidID is a static member constant without an address
-    // (it is not defined in any translation unit, just declared in header)
-    fViewToPlaneNumber.resize(1U + (size_t)geo::kUnknown,
-                              (geo::PlaneID::PlaneID_t)geo::PlaneID::InvalidID);
-    for (size_t p = 0; p < this->Nplanes(); ++p)
-      fViewToPlaneNumber[(size_t)fPlanes[p].View()] = p;
+    UpdatePlaneViewCache();
 
     for (size_t p = 0; p < fPlanes.size(); ++p)
       fPlanes[p].SortWires(sorter);
@@ -225,9 +217,75 @@ namespace geo {
 
     UpdatePlaneCache();
     UpdatePlaneViewCache();
+    UpdateWireIntersectionCache();
+    UpdateThirdPlaneSlopeCache();
+    UpdateViewInfoCache();
+    UpdateDriftCache();
 
   } // TPCGeo::UpdateAfterSorting()
 
+  //......................................................................
+  void TPCGeo::ApplyAlignment(geo::TransformationMatrix const& delta)
+  {
+    fTrans = LocalTransformation_t{delta * fTrans.Matrix()};
+    fActiveCenter = delta(fActiveCenter);
+    InitTPCBoundaries();
+
+    for (geo::PlaneGeo& plane : fPlanes)
+      plane.ApplyAlignment(delta);
+
+  } // TPCGeo::ApplyAlignment()
+
+  //......................................................................
+  void TPCGeo::ApplyPlaneAlignment(unsigned int plane, geo::TransformationMatrix const& delta)
+  {
+    if (!HasPlane(plane)) {
+      throw cet::exception("PlaneOutOfRange")
+        << "Request for non-existant plane " << plane << "\n";
+    }
+    fPlanes[plane].ApplyAlignment(delta);
+  } // TPCGeo::ApplyPlaneAlignment()
+
+  //......................................................................
+  void TPCGeo::ReleaseWires()
+  {
+    for (geo::PlaneGeo& plane : fPlanes)
+      plane.ReleaseWires();
+    fWireIntersections = {};
+    fWireIntersectionsBuilt.reset();
+  } // TPCGeo::ReleaseWires()
+
+  //......................................................................
+  void TPCGeo::UpdateAfterAlignment()
+  {
+    // drift direction and plane views are topology: they are kept
+    for (geo::PlaneGeo& plane : fPlanes) {
+      plane.UpdateAfterAlignment(*this);
+
+      assert(lar::util::makeVector3DComparison(1e-5).equal(-(plane.GetNormalDirection()),
+                                                           DriftDir()));
+    } // for
+
+    UpdatePlaneCache();
+    UpdateWireIntersectionCache();
+    UpdateThirdPlaneSlopeCache();
+    UpdateViewInfoCache();
+    UpdateDriftCache();
+
+  } // TPCGeo::UpdateAfterAlignment()
+
+  //......................................................................
+  void TPCGeo::FillMemoryUsage(lar::util::MemoryUsageReport& report) const
+  {
+    report.add("TPCGeo",
+               sizeof(*this) + (fPlanes.capacity() - fPlanes.size()) * sizeof(geo::PlaneGeo) +
+                 lar::util::heapMemory(fPlane0Pitch) + lar::util::heapMemory(fPlaneLocation) +
+                 lar::util::heapMemory(fWireIntersections) +
+                 lar::util::heapMemory(fThirdPlaneSlopes));
+    for (geo::PlaneGeo const& plane : fPlanes)
+      plane.FillMemoryUsage(report);
+  } // TPCGeo::FillMemoryUsage()
+
   //......................................................................
   std::string TPCGeo::TPCInfo(std::string indent /* = "" */, unsigned int verbosity /* = 1 */) const
   {
@@ -251,7 +309,7 @@ namespace geo {
   //......................................................................
   const PlaneGeo& TPCGeo::Plane(geo::View_t view) const
   {
-    geo::PlaneID::PlaneID_t const p = fViewToPlaneNumber[size_t(view)];
+    geo::PlaneID::PlaneID_t const p = PlaneNumber(view);
     if (p == geo::PlaneID::InvalidID) {
       throw cet::exception("TPCGeo")
         << "TPCGeo[" << ((void*)this) << "]::Plane(): no plane for view #" << (size_t)view << "\n";
@@ -298,10 +356,8 @@ namespace geo {
   std::set<geo::View_t> TPCGeo::Views() const
   {
     std::set<geo::View_t> views;
-    std::transform(fPlanes.cbegin(),
-                   fPlanes.cend(),
-                   std::inserter(views, views.begin()),
-                   std::mem_fn(&geo::PlaneGeo::View));
+    for (std::size_t v = 0; v < MaxViews; ++v)
+      if (fViewMask & ViewBit(geo::View_t(v))) views.insert(views.end(), geo::View_t(v));
     return views;
   } // TPCGeo::Views()
 
@@ -426,6 +482,18 @@ namespace geo {
 
   } // TPCGeo::ComputeDriftDistance()
 
+  //......................................................................
+  void TPCGeo::UpdateDriftCache()
+  {
+    // ComputeDriftDistance() uses the cathode center: it is updated first
+    fCathodeCenter = GetCathodeCenterImpl();
+    geo::vect::fillCoords(fDriftFrame.driftDir, fDriftDir);
+    geo::Point_t const anodeCenter = fPlanes.back().GetCenter<geo::Point_t>();
+    fDriftFrame.anodeCoord = geo::vect::dot(anodeCenter - geo::origin(), fDriftDir);
+    fDriftFrame.cathodeCoord = geo::vect::dot(fCathodeCenter - geo::origin(), fDriftDir);
+    fDriftFrame.driftDistance = ComputeDriftDistance();
+  } // TPCGeo::UpdateDriftCache()
+
   //......................................................................
   void TPCGeo::InitTPCBoundaries()
   {
@@ -458,14 +526,34 @@ namespace geo {
     // leaving it a reference would cause C++ to treat it as such,
     // that can't be because InvalidID is a static member constant without an address
     // (it is not defined in any translation unit, just declared in header)
-    fViewToPlaneNumber.clear();
-    fViewToPlaneNumber.resize(1U + (size_t)geo::kUnknown,
-                              (geo::PlaneID::PlaneID_t)geo::PlaneID::InvalidID);
-    for (size_t p = 0; p < Nplanes(); ++p)
-      fViewToPlaneNumber[(size_t)fPlanes[p].View()] = p;
+    fViewToPlaneNumber.fill((geo::PlaneID::PlaneID_t)geo::PlaneID::InvalidID);
+    fViewMask = 0U;
+    for (size_t p = 0; p < Nplanes(); ++p) {
+      geo::View_t const view = fPlanes[p].View();
+      if ((size_t)view >= MaxViews) continue;
+      fViewToPlaneNumber[(size_t)view] = p;
+      fViewMask |= ViewBit(view);
+    } // for
 
   } // TPCGeo::UpdatePlaneViewCache()
 
+  //......................................................................
+  void TPCGeo::UpdateViewInfoCache()
+  {
+    fViewInfo.fill({});
+    for (std::size_t v = 0; v < MaxViews; ++v) {
+      geo::PlaneID::PlaneID_t const p = fViewToPlaneNumber[v];
+      if (p == geo::PlaneID::InvalidID) continue;
+      geo::PlaneGeo const& plane = fPlanes[p];
+      ViewInfo_t& info = fViewInfo[v];
+      info.plane = p;
+      info.pitch = plane.WirePitch();
+      info.thetaZ = plane.ThetaZ();
+      info.sinThetaZ = std::sin(info.thetaZ);
+      info.cosThetaZ = std::cos(info.thetaZ);
+    } // for
+  } // TPCGeo::UpdateViewInfoCache()
+
   //......................................................................
 
   void TPCGeo::UpdatePlaneCache()
@@ -488,6 +576,58 @@ namespace geo {
 
   } // TPCGeo::UpdatePlaneViewCache()
 
+  //......................................................................
+  void TPCGeo::UpdateWireIntersectionCache()
+  {
+    fWireIntersections.clear();
+    fWireIntersectionsBuilt.reset();
+
+    // the tables need all the wires: do not force planes to build them
+    for (geo::PlaneGeo const& plane : fPlanes)
+      if (plane.HasLazyWires()) return;
+
+    WireIntersections(); // fills the tables
+  } // TPCGeo::UpdateWireIntersectionCache()
+
+  //......................................................................
+  void TPCGeo::UpdateThirdPlaneSlopeCache()
+  {
+    // slope3 = 1 / [ (1/slope1) sin(a3 - a2) - (1/slope2) sin(a3 - a1) ] / sin(a1 - a2)
+    // (see `geo::GeometryCore::ComputeThirdPlaneSlope()`)
+    fThirdPlaneSlopes.assign(Nplanes() * Nplanes() * Nplanes(), {});
+    for (unsigned int p1 = 0; p1 < Nplanes(); ++p1) {
+      double const angle1 = fPlanes[p1].PhiZ();
+      for (unsigned int p2 = 0; p2 < Nplanes(); ++p2) {
+        double const angle2 = fPlanes[p2].PhiZ();
+        double const sin12 = std::sin(angle1 - angle2);
+        for (unsigned int p3 = 0; p3 < Nplanes(); ++p3) {
+          double const angle3 = fPlanes[p3].PhiZ();
+          ThirdPlaneSlopeCoefficients_t& coeffs = fThirdPlaneSlopes[ThirdPlaneSlopeIndex(p1, p2, p3)];
+          coeffs.coeff1 = std::sin(angle3 - angle2) / sin12;
+          coeffs.coeff2 = -std::sin(angle3 - angle1) / sin12;
+          coeffs.invPitch1 = 1.0 / fPlanes[p1].WirePitch();
+          coeffs.invPitch2 = 1.0 / fPlanes[p2].WirePitch();
+          coeffs.pitch3 = fPlanes[p3].WirePitch();
+        } // for target plane
+      }   // for second plane
+    }     // for first plane
+  } // TPCGeo::UpdateThirdPlaneSlopeCache()
+
+  //......................................................................
+  auto TPCGeo::ThirdPlaneSlopeCoefficients(unsigned int plane1,
+                                           unsigned int plane2,
+                                           unsigned int target) const
+    -> ThirdPlaneSlopeCoefficients_t const&
+  {
+    for (unsigned int plane : {plane1, plane2, target}) {
+      if (!HasPlane(plane)) {
+        throw cet::exception("PlaneOutOfRange")
+          << "Request for non-existant plane " << plane << "\n";
+      }
+    }
+    return fThirdPlaneSlopes[ThirdPlaneSlopeIndex(plane1, plane2, target)];
+  } // TPCGeo::ThirdPlaneSlopeCoefficients()
+
   //......................................................................
   void TPCGeo::SortPlanes(std::vector<geo::PlaneGeo>& planes) const
   {
@@ -9,12 +9,16 @@
 #define LARCOREALG_GEOMETRY_TPCGEO_H
 
 // LArSoft libraries
+#include "larcorealg/CoreUtils/MemoryUsage.h"
 #include "larcorealg/Geometry/BoxBoundedGeo.h"
 #include "larcorealg/Geometry/GeoObjectSorter.h"
 #include "larcorealg/Geometry/LocalTransformationGeo.h"
 #include "larcorealg/Geometry/PlaneGeo.h"
+#include "larcorealg/Geometry/QueryResult.h"
 #include "larcorealg/Geometry/TransformationMatrix.h"
 #include "larcorealg/Geometry/WireGeo.h"
+#include "larcorealg/Geometry/details/OnceFlag.h"
+#include "larcorealg/Geometry/details/WireIntersectionTables.h"
 #include "larcorealg/Geometry/geo_vectors_utils.h" // geo::vect
 #include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
 
@@ -24,6 +28,8 @@
 #include "TVector3.h"
 
 // C/C++ standard library
+#include <array>
+#include <cstddef> // std::size_t
 #include <set>
 #include <vector>
 
@@ -46,6 +52,12 @@ namespace geo {
     /// Type returned by `IterateElements()`.
     using ElementIteratorBox = PlaneCollection_t const&;
 
+    /// Type of a set of views as a bit mask (see `ViewMask()`).
+    using ViewMask_t = unsigned int;
+
+    /// Number of possible views, including `geo::kUnknown`.
+    static constexpr std::size_t MaxViews = 1U + std::size_t(geo::kUnknown);
+
     /// @{
     /**
      * @name Types for geometry-local reference vectors.
@@ -154,7 +166,49 @@ namespace geo {
 
     /// Drift distance is defined as the distance between the last anode plane
     /// and the opposite face of the TPC, in centimeters.
-    double DriftDistance() const { return ComputeDriftDistance(); }
+    double DriftDistance() const { return fDriftFrame.driftDistance; }
+
+    /**
+     * @brief Parameters of the drift in the TPC (see `DriftFrame()`).
+     *
+     * The drift coordinate of a point is its component along the drift
+     * direction; a charge moves from the drift coordinate of its starting
+     * point up to the one of the last (anode) plane, `anodeCoord`. The batch
+     * methods process arrays of points in loops which the compiler can
+     * vectorize.
+     */
+    struct DriftFrame_t {
+      double driftDir[3] = {0.0, 0.0, 0.0}; ///< Drift direction (toward the planes).
+      double anodeCoord = 0.0;              ///< Drift coordinate of the last plane [cm].
+      double cathodeCoord = 0.0;            ///< Drift coordinate of the cathode [cm].
+      double driftDistance = 0.0;           ///< As `geo::TPCGeo::DriftDistance()` [cm].
+
+      /// Returns the drift coordinate of the point (`x`, `y`, `z`) [cm].
+      double driftCoordinate(double x, double y, double z) const
+      {
+        return x * driftDir[0] + y * driftDir[1] + z * driftDir[2];
+      }
+
+      /// Returns the distance the charge at (`x`, `y`, `z`) drifts to the last plane [cm].
+      double distanceToAnode(double x, double y, double z) const
+      {
+        return anodeCoord - driftCoordinate(x, y, z);
+      }
+
+      /// Fills `dist` with the `distanceToAnode()` of `n` points.
+      void distancesToAnode(std::size_t n,
+                            double const* __restrict__ x,
+                            double const* __restrict__ y,
+                            double const* __restrict__ z,
+                            double* __restrict__ dist) const
+      {
+        for (std::size_t i = 0; i < n; ++i)
+          dist[i] = distanceToAnode(x[i], y[i], z[i]);
+      }
+    }; // DriftFrame_t
+
+    /// Returns the drift parameters of this TPC, cached when it is sorted.
+    DriftFrame_t const& DriftFrame() const { return fDriftFrame; }
 
     /// @}
 
@@ -191,8 +245,18 @@ namespace geo {
     //@}
 
     /// Return the plane in the tpc with View_t view.
+    /// @throws cet::exception (category "TPCGeo") if no plane has that view
     PlaneGeo const& Plane(geo::View_t view) const;
 
+    /// Returns the plane in the TPC with the specified `view`, without throwing.
+    /// @return the plane, or `geo::QueryError::NoPlane` if no plane has `view`
+    geo::QueryResult_t<PlaneGeo const&> TryPlane(geo::View_t view) const
+    {
+      geo::PlaneID::PlaneID_t const p = PlaneNumber(view);
+      if (p == geo::PlaneID::InvalidID) return geo::queryFailure(geo::QueryError::NoPlane);
+      return fPlanes[p];
+    }
+
     /// Return the iplane'th plane in the TPC.
     /// @throws cet::exception (category "PlaneOutOfRange")  if no such plane
     PlaneGeo const& Plane(unsigned int iplane) const;
@@ -234,6 +298,46 @@ namespace geo {
     PlaneGeo const* GetElementPtr(PlaneID const& planeid) const { return PlanePtr(planeid); }
     //@}
 
+    /**
+     * @brief Returns the plane with the specified view
+     * @param view the view of the plane
+     * @return a constant pointer to the plane, or nullptr if there is none
+     */
+    PlaneGeo const* PlanePtr(geo::View_t view) const
+    {
+      geo::PlaneID::PlaneID_t const p = PlaneNumber(view);
+      return (p == geo::PlaneID::InvalidID) ? nullptr : &(fPlanes[p]);
+    }
+
+    /// Parameters of the wire plane of a view (see `ViewInfoPtr()`).
+    struct ViewInfo_t {
+      geo::PlaneID::PlaneID_t plane = geo::PlaneID::InvalidID; ///< Number of the plane.
+      double pitch = 0.0;     ///< Wire pitch [cm].
+      double thetaZ = 0.0;    ///< Wire angle, as `geo::PlaneGeo::ThetaZ()` [rad].
+      double sinThetaZ = 0.0; ///< Sine of `thetaZ`.
+      double cosThetaZ = 1.0; ///< Cosine of `thetaZ`.
+    };
+
+    /**
+     * @brief Returns the parameters of the plane with the specified view.
+     * @param view the view of the plane
+     * @return a pointer to the parameters, or `nullptr` if there is no plane
+     *
+     * The parameters are cached when the TPC is sorted or aligned.
+     */
+    ViewInfo_t const* ViewInfoPtr(geo::View_t view) const
+    {
+      return HasView(view) ? &fViewInfo[view] : nullptr;
+    }
+
+    /// Returns the number of the plane with the specified view
+    /// (`geo::PlaneID::InvalidID` if none).
+    geo::PlaneID::PlaneID_t PlaneNumber(geo::View_t view) const
+    {
+      return (std::size_t(view) < fViewToPlaneNumber.size()) ? fViewToPlaneNumber[view] :
+                                                                geo::PlaneID::InvalidID;
+    }
+
     /// Returns the wire plane with the smallest surface
     geo::PlaneGeo const& SmallestPlane() const;
 
@@ -265,8 +369,22 @@ namespace geo {
     // @}
 
     /// Returns a set of all views covered in this TPC.
+    /// @see `ViewMask()`, `HasView()`
     std::set<geo::View_t> Views() const;
 
+    /// Returns the bit of `view` in a mask of views (`ViewMask()`).
+    static constexpr ViewMask_t ViewBit(geo::View_t view) { return ViewMask_t{1U} << view; }
+
+    /// Returns a mask with the bit `ViewBit(v)` set for each view `v` in this
+    /// TPC.
+    ViewMask_t ViewMask() const { return fViewMask; }
+
+    /// Returns whether a plane in this TPC has the specified `view`.
+    bool HasView(geo::View_t view) const
+    {
+      return (std::size_t(view) < MaxViews) && ((fViewMask & ViewBit(view)) != 0U);
+    }
+
     /// @}
 
     /// @{
@@ -294,7 +412,7 @@ namespace geo {
     template <typename Point>
     Point GetCathodeCenter() const
     {
-      return geo::vect::convertTo<Point>(GetCathodeCenterImpl());
+      return geo::vect::convertTo<Point>(fCathodeCenter);
     }
 
     /// Returns the center of the active volume face opposite to the wire planes
@@ -324,6 +442,52 @@ namespace geo {
     double PlanePitch(unsigned int p1 = 0, unsigned int p2 = 1) const;
     double WirePitch(unsigned plane = 0) const;
 
+    /**
+     * @brief Returns precomputed intersections of wires from pairs of planes.
+     * @see `geo::details::WireIntersectionTables`
+     *
+     * The tables are filled by `UpdateAfterSorting()`; only the pairs of planes
+     * with evenly spaced, parallel wires are covered (`hasPlanePair()`).
+     * If any plane has its wires built on demand (`PlaneGeo::HasLazyWires()`),
+     * the tables are filled on the first call instead.
+     */
+    geo::details::WireIntersectionTables const& WireIntersections() const
+    {
+      fWireIntersectionsBuilt.callOnce([this]() { fWireIntersections.build(fPlanes); });
+      return fWireIntersections;
+    }
+
+    /**
+     * @brief Coefficients to compute the slope on a plane from other two.
+     * @see `geo::GeometryCore::ComputeThirdPlaneSlope()`
+     *
+     * The inverse of the slope on the target plane is a linear combination of
+     * the inverse of the slopes on the first and on the second planes, with
+     * coefficients `coeff1` and `coeff2` depending only on the wire angles.
+     */
+    struct ThirdPlaneSlopeCoefficients_t {
+      double coeff1 = 0.0;    ///< Coefficient of the inverse slope on plane 1.
+      double coeff2 = 0.0;    ///< Coefficient of the inverse slope on plane 2.
+      double invPitch1 = 0.0; ///< Inverse of the wire pitch on plane 1.
+      double invPitch2 = 0.0; ///< Inverse of the wire pitch on plane 2.
+      double pitch3 = 0.0;    ///< Wire pitch on the target plane.
+    };
+
+    /**
+     * @brief Returns the cached coefficients to compute a slope on `target`.
+     * @param plane1 index of the plane of the first slope
+     * @param plane2 index of the plane of the second slope
+     * @param target index of the plane to compute the slope on
+     * @return the coefficients for the specified planes
+     * @throw cet::exception (category: `"PlaneOutOfRange"`) if no such planes
+     *
+     * If `plane1` and `plane2` have parallel wires, the coefficients are not
+     * finite.
+     */
+    ThirdPlaneSlopeCoefficients_t const& ThirdPlaneSlopeCoefficients(unsigned int plane1,
+                                                                     unsigned int plane2,
+                                                                     unsigned int target) const;
+
     /// Returns the identifier of this TPC
     geo::TPCID const& ID() const { return fID; }
 
@@ -677,6 +841,36 @@ namespace geo {
     /// Performs all updates after cryostat has sorted TPCs
     void UpdateAfterSorting(geo::TPCID tpcid);
 
+    /**
+     * @brief Moves the TPC and all its planes by a rigid transformation.
+     * @param delta the transformation, in world coordinates
+     * @see `geo::GeometryAlignment`, `UpdateAfterAlignment()`
+     *
+     * Only the placement of the TPC and of its planes is changed: the derived
+     * information is updated by `UpdateAfterAlignment()`, which must follow.
+     */
+    void ApplyAlignment(geo::TransformationMatrix const& delta);
+
+    /// Moves only the plane number `plane` by `delta` (see `ApplyAlignment()`).
+    void ApplyPlaneAlignment(unsigned int plane, geo::TransformationMatrix const& delta);
+
+    /// Updates the derived information of the TPC and of its planes after
+    /// `ApplyAlignment()` or `ApplyPlaneAlignment()`; the topology is kept.
+    void UpdateAfterAlignment();
+
+    /// Frees the wire objects of all the planes and the tables derived from
+    /// them, all built again on demand (see `geo::PlaneGeo::ReleaseWires()`).
+    void ReleaseWires();
+
+    /**
+     * @brief Adds the memory used by this TPC to `report`.
+     * @param report the report to be updated
+     *
+     * The TPC is added as `"TPCGeo"`, and its planes as well (see
+     * `geo::PlaneGeo::FillMemoryUsage()`).
+     */
+    void FillMemoryUsage(lar::util::MemoryUsageReport& report) const;
+
     /**
      * @brief Prints information about this TPC.
      * @tparam Stream type of output stream to use
@@ -752,6 +946,7 @@ namespace geo {
     std::vector<double> fPlane0Pitch; ///< Pitch between planes.
     std::vector<std::vector<double>> fPlaneLocation; ///< xyz locations of planes in the TPC.
     geo::Point_t fActiveCenter; ///< Center of the active volume, in world coordinates [cm].
+    geo::Point_t fCathodeCenter; ///< Center of the cathode (see `GetCathodeCenter()`).
 
     double fActiveHalfWidth;  ///< Half width of active volume.
     double fActiveHalfHeight; ///< Half height of active volume.
@@ -770,7 +965,23 @@ namespace geo {
     geo::TPCID fID; ///< ID of this TPC.
 
     /// Index of the plane for each view (InvalidID if none).
-    std::vector<geo::PlaneID::PlaneID_t> fViewToPlaneNumber;
+    std::array<geo::PlaneID::PlaneID_t, MaxViews> fViewToPlaneNumber;
+
+    ViewMask_t fViewMask = 0U; ///< Bit mask of the views of the planes.
+
+    /// Parameters of the plane of each view (see `ViewInfoPtr()`).
+    std::array<ViewInfo_t, MaxViews> fViewInfo;
+
+    /// Intersections of wires from each pair of planes.
+    mutable geo::details::WireIntersectionTables fWireIntersections;
+
+    /// Whether `fWireIntersections` is filled.
+    mutable geo::details::OnceFlag fWireIntersectionsBuilt;
+
+    /// Slope coefficients for each plane triplet (see `ThirdPlaneSlopeIndex()`).
+    std::vector<ThirdPlaneSlopeCoefficients_t> fThirdPlaneSlopes;
+
+    DriftFrame_t fDriftFrame; ///< Cached drift parameters (see `DriftFrame()`).
 
     /// Recomputes the drift direction; needs planes to have been initialised.
     void ResetDriftDirection();
@@ -779,12 +990,32 @@ namespace geo {
     /// (last respect to the sorting order).
     double ComputeDriftDistance() const;
 
+    /// Recomputes the cathode center and the drift frame; needs updated planes.
+    void UpdateDriftCache();
+
     /// Refills the plane vs. view cache of the TPC.
     void UpdatePlaneViewCache();
 
+    /// Refills the parameters of the plane of each view; needs updated planes.
+    void UpdateViewInfoCache();
+
     /// Updates plane cached information.
     void UpdatePlaneCache();
 
+    /// Recomputes the tables of wire intersections; needs updated planes.
+    void UpdateWireIntersectionCache();
+
+    /// Recomputes the third plane slope coefficients; needs updated planes.
+    void UpdateThirdPlaneSlopeCache();
+
+    /// Index of a plane triplet in `fThirdPlaneSlopes`.
+    std::size_t ThirdPlaneSlopeIndex(unsigned int plane1,
+                                     unsigned int plane2,
+                                     unsigned int target) const
+    {
+      return (plane1 * Nplanes() + plane2) * Nplanes() + target;
+    }
+
     /// Recomputes the TPC boundary.
     void InitTPCBoundaries();
 
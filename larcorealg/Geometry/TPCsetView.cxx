@@ -0,0 +1,331 @@
+/**
+ * @file   larcorealg/Geometry/TPCsetView.cxx
+ * @brief  Packed copy of the geometry of a single TPC set.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/TPCsetView.h`
+ */
+
+// LArSoft libraries
+#include "larcorealg/Geometry/TPCsetView.h"
+#include "larcorealg/CoreUtils/MemoryUsage.h" // lar::util::heapMemory()
+#include "larcorealg/Geometry/Exceptions.h"   // geo::InvalidWireError
+#include "larcorealg/Geometry/GeometryCore.h"
+#include "larcorealg/Geometry/PlaneGeo.h"
+#include "larcorealg/Geometry/details/WireCenterTable.h"
+
+// framework libraries
+#include "cetlib_except/exception.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::find()
+#include <cstring>   // std::memcpy()
+
+//------------------------------------------------------------------------------
+geo::TPCsetView::TPCsetView(geo::GeometryCore const& geom, readout::TPCsetID const& tpcsetid)
+  : fID{tpcsetid}
+{
+  if (!geom.HasTPCset(tpcsetid)) {
+    throw cet::exception("TPCsetView")
+      << "TPCsetView: the geometry has no TPC set " << tpcsetid << "\n";
+  }
+
+  // same tolerance as `geo::GeometryCore::FindTPCAtPosition()`
+  double const wiggle = 1.0 + geom.DefaultWiggle();
+
+  std::vector<tpcset::TPC_t> TPCrecords;
+  std::vector<tpcset::Plane_t> planeRecords;
+  std::vector<tpcset::ROP_t> ROPrecords;
+  std::vector<std::uint32_t> ROPplaneIndices;
+  std::vector<raw::ChannelID_t> wireChannels;
+  std::vector<double> centerCoords;
+  std::vector<details::WireCenterTable::WireNo_t> centerWires;
+  std::vector<geo::PlaneID> planeIDs; // of each plane record
+
+  for (geo::TPCID const& tpcid : geom.TPCsetToTPCIDs(tpcsetid)) {
+    geo::TPCGeo const& TPC = geom.TPC(tpcid);
+    tpcset::TPC_t& TPCinfo = TPCrecords.emplace_back();
+    TPCinfo.box = TPC.BoxKernel(wiggle);
+    TPCinfo.drift = TPC.DriftFrame();
+    TPCinfo.tpc = tpcid.TPC;
+    TPCinfo.firstPlane = planeRecords.size();
+    TPCinfo.nPlanes = TPC.Nplanes();
+    TPCinfo.reserved = 0U;
+
+    for (geo::PlaneGeo const& plane : TPC.IteratePlanes()) {
+      details::WireCenterTable const& centers = plane.WireCenters();
+      tpcset::Plane_t& planeInfo = planeRecords.emplace_back();
+      planeInfo.kernel = plane.WireCoordinateKernel();
+      planeInfo.firstWire = wireChannels.size();
+      planeInfo.firstCenter = centerCoords.size();
+      planeInfo.nCenters = centers.size();
+      planeInfo.rop = geom.WirePlaneToROP(plane.ID()).ROP;
+      planeInfo.view = plane.View();
+
+      for (unsigned int wire = 0; wire < plane.Nwires(); ++wire)
+        wireChannels.push_back(geom.PlaneWireToChannel(geo::WireID{plane.ID(), wire}));
+      centerCoords.insert(
+        centerCoords.end(), centers.sortedCoords(), centers.sortedCoords() + centers.size());
+      centerWires.insert(
+        centerWires.end(), centers.sortedWires(), centers.sortedWires() + centers.size());
+      planeIDs.push_back(plane.ID());
+    } // for planes
+  }   // for TPCs
+
+  for (unsigned int r = 0; r < geom.NROPs(tpcsetid); ++r) {
+    readout::ROPID const ropid{tpcsetid, r};
+    tpcset::ROP_t& ROPinfo = ROPrecords.emplace_back();
+    ROPinfo.firstChannel = geom.FirstChannelInROP(ropid);
+    ROPinfo.nChannels = geom.Nchannels(ropid);
+    ROPinfo.firstPlane = ROPplaneIndices.size();
+    for (geo::PlaneID const& planeid : geom.ROPtoWirePlaneIDs(ropid)) {
+      auto const iPlane = std::find(planeIDs.begin(), planeIDs.end(), planeid);
+      if (iPlane != planeIDs.end()) ROPplaneIndices.push_back(iPlane - planeIDs.begin());
+    }
+    ROPinfo.nPlanes = ROPplaneIndices.size() - ROPinfo.firstPlane;
+  } // for ROPs
+
+  //
+  // packing: each section starts on a new cache line
+  //
+  std::size_t blockBytes = 0U;
+  auto const place = [this, &blockBytes](Section_t sec, auto const& records) {
+    std::size_t const bytes = records.size() * sizeof(records.front());
+    fSections[sec] = {blockBytes, records.size()};
+    blockBytes += (bytes + CacheLineSize - 1U) / CacheLineSize * CacheLineSize;
+  };
+  place(TPCs, TPCrecords);
+  place(Planes, planeRecords);
+  place(ROPs, ROPrecords);
+  place(ROPplanes, ROPplaneIndices);
+  place(WireChannels, wireChannels);
+  place(CenterCoords, centerCoords);
+  place(CenterWires, centerWires);
+
+  fBlock.resize(blockBytes / CacheLineSize);
+  auto const fill = [this](Section_t sec, auto const& records) {
+    if (records.empty()) return;
+    std::memcpy(reinterpret_cast<std::byte*>(fBlock.data()) + fSections[sec].offset,
+                records.data(),
+                records.size() * sizeof(records.front()));
+  };
+  fill(TPCs, TPCrecords);
+  fill(Planes, planeRecords);
+  fill(ROPs, ROPrecords);
+  fill(ROPplanes, ROPplaneIndices);
+  fill(WireChannels, wireChannels);
+  fill(CenterCoords, centerCoords);
+  fill(CenterWires, centerWires);
+
+} // geo::TPCsetView::TPCsetView()
+
+//------------------------------------------------------------------------------
+unsigned int geo::TPCsetView::Nchannels() const
+{
+  unsigned int n = 0U;
+  for (tpcset::ROP_t const& ROP : section<tpcset::ROP_t>(ROPs))
+    n += ROP.nChannels;
+  return n;
+} // geo::TPCsetView::Nchannels()
+
+//------------------------------------------------------------------------------
+std::vector<geo::TPCID> geo::TPCsetView::TPCIDs() const
+{
+  std::vector<geo::TPCID> tpcids;
+  tpcids.reserve(NTPC());
+  for (tpcset::TPC_t const& TPC : section<tpcset::TPC_t>(TPCs))
+    tpcids.emplace_back(fID.asCryostatID(), TPC.tpc);
+  return tpcids;
+} // geo::TPCsetView::TPCIDs()
+
+//------------------------------------------------------------------------------
+geo::TPCGeo::DriftFrame_t const& geo::TPCsetView::DriftFrame(geo::TPCID const& tpcid) const
+{
+  std::size_t const index = TPCIndex(tpcid);
+  if (index == NoIndex) {
+    throw cet::exception("TPCsetView") << tpcid << " is not in " << fID << "\n";
+  }
+  return section<tpcset::TPC_t>(TPCs).begin()[index].drift;
+} // geo::TPCsetView::DriftFrame()
+
+//------------------------------------------------------------------------------
+auto geo::TPCsetView::WireCoordinateKernel(geo::PlaneID const& planeid) const
+  -> WireCoordinateKernel_t const&
+{
+  return plane(planeid).kernel;
+} // geo::TPCsetView::WireCoordinateKernel()
+
+//------------------------------------------------------------------------------
+geo::TPCID geo::TPCsetView::FindTPCAtPosition(geo::Point_t const& point) const
+{
+  auto const TPCrecords = section<tpcset::TPC_t>(TPCs);
+  for (tpcset::TPC_t const& TPC : TPCrecords) {
+    if (TPC.box.contains(point.X(), point.Y(), point.Z()))
+      return geo::TPCID{fID.asCryostatID(), TPC.tpc};
+  }
+  return {};
+} // geo::TPCsetView::FindTPCAtPosition()
+
+//------------------------------------------------------------------------------
+geo::WireID geo::TPCsetView::NearestWireID(geo::Point_t const& point,
+                                           geo::PlaneID const& planeid) const
+{
+  tpcset::Plane_t const& planeInfo = plane(planeid);
+  int const nearestWireNo = nearestWireNumber(
+    planeInfo, planeInfo.kernel.wireCoordinate(point.X(), point.Y(), point.Z()));
+  int const nWires = static_cast<int>(planeInfo.kernel.nWires);
+  if ((nearestWireNo < 0) || (nearestWireNo >= nWires)) {
+    // same exception as `geo::PlaneGeo::NearestWireID()`
+    int const closestWireNo = (nearestWireNo < 0) ? 0 : nWires - 1;
+    throw InvalidWireError("Geometry", planeid, nearestWireNo, closestWireNo).atPosition(point);
+  }
+  return {planeid, static_cast<geo::WireID::WireID_t>(nearestWireNo)};
+} // geo::TPCsetView::NearestWireID()
+
+//------------------------------------------------------------------------------
+geo::QueryResult_t<geo::WireID> geo::TPCsetView::TryNearestWireID(
+  geo::Point_t const& point,
+  geo::PlaneID const& planeid) const
+{
+  std::size_t const index = planeIndex(planeid);
+  if (index == NoIndex) return geo::queryFailure(geo::QueryError::NoPlane);
+  tpcset::Plane_t const& planeInfo = section<tpcset::Plane_t>(Planes).begin()[index];
+  int const nearestWireNo = nearestWireNumber(
+    planeInfo, planeInfo.kernel.wireCoordinate(point.X(), point.Y(), point.Z()));
+  if ((nearestWireNo < 0) || (static_cast<unsigned int>(nearestWireNo) >= planeInfo.kernel.nWires))
+    return geo::queryFailure(geo::QueryError::WireOutOfRange);
+  return geo::WireID{planeid, static_cast<geo::WireID::WireID_t>(nearestWireNo)};
+} // geo::TPCsetView::TryNearestWireID()
+
+//------------------------------------------------------------------------------
+raw::ChannelID_t geo::TPCsetView::PlaneWireToChannel(geo::WireID const& wireid) const
+{
+  std::size_t const index = planeIndex(wireid);
+  if (index == NoIndex) return raw::InvalidChannelID;
+  tpcset::Plane_t const& planeInfo = section<tpcset::Plane_t>(Planes).begin()[index];
+  if (wireid.Wire >= planeInfo.kernel.nWires) return raw::InvalidChannelID;
+  return section<raw::ChannelID_t>(WireChannels).begin()[planeInfo.firstWire + wireid.Wire];
+} // geo::TPCsetView::PlaneWireToChannel()
+
+//------------------------------------------------------------------------------
+readout::ROPID geo::TPCsetView::WirePlaneToROP(geo::PlaneID const& planeid) const
+{
+  std::size_t const index = planeIndex(planeid);
+  if (index == NoIndex) return {};
+  return {fID, section<tpcset::Plane_t>(Planes).begin()[index].rop};
+} // geo::TPCsetView::WirePlaneToROP()
+
+//------------------------------------------------------------------------------
+std::vector<geo::PlaneID> geo::TPCsetView::ROPtoWirePlanes(readout::ROPID const& ropid) const
+{
+  std::vector<geo::PlaneID> planeids;
+  std::size_t const index = ROPindex(ropid);
+  if (index == NoIndex) return planeids;
+
+  tpcset::ROP_t const& ROP = section<tpcset::ROP_t>(ROPs).begin()[index];
+  auto const TPCrecords = section<tpcset::TPC_t>(TPCs);
+  std::uint32_t const* const planeIndices = section<std::uint32_t>(ROPplanes).begin();
+  planeids.reserve(ROP.nPlanes);
+  for (std::uint32_t i = 0; i < ROP.nPlanes; ++i) {
+    std::uint32_t const iPlane = planeIndices[ROP.firstPlane + i];
+    for (tpcset::TPC_t const& TPC : TPCrecords) {
+      if ((iPlane < TPC.firstPlane) || (iPlane >= TPC.firstPlane + TPC.nPlanes)) continue;
+      planeids.emplace_back(geo::TPCID{fID.asCryostatID(), TPC.tpc}, iPlane - TPC.firstPlane);
+      break;
+    }
+  } // for planes
+  return planeids;
+} // geo::TPCsetView::ROPtoWirePlanes()
+
+//------------------------------------------------------------------------------
+readout::ROPID geo::TPCsetView::ChannelToROP(raw::ChannelID_t channel) const
+{
+  if (!raw::isValidChannelID(channel)) return {};
+  auto const ROPrecords = section<tpcset::ROP_t>(ROPs);
+  for (std::size_t r = 0; r < ROPrecords.size(); ++r) {
+    tpcset::ROP_t const& ROP = ROPrecords.begin()[r];
+    if ((channel >= ROP.firstChannel) && (channel - ROP.firstChannel < ROP.nChannels))
+      return {fID, static_cast<readout::ROPID::ROPID_t>(r)};
+  }
+  return {};
+} // geo::TPCsetView::ChannelToROP()
+
+//------------------------------------------------------------------------------
+raw::ChannelID_t geo::TPCsetView::FirstChannelInROP(readout::ROPID const& ropid) const
+{
+  std::size_t const index = ROPindex(ropid);
+  return (index == NoIndex) ? raw::InvalidChannelID :
+                              section<tpcset::ROP_t>(ROPs).begin()[index].firstChannel;
+} // geo::TPCsetView::FirstChannelInROP()
+
+//------------------------------------------------------------------------------
+unsigned int geo::TPCsetView::Nchannels(readout::ROPID const& ropid) const
+{
+  std::size_t const index = ROPindex(ropid);
+  return (index == NoIndex) ? 0U : section<tpcset::ROP_t>(ROPs).begin()[index].nChannels;
+} // geo::TPCsetView::Nchannels(ROPID)
+
+//------------------------------------------------------------------------------
+auto geo::TPCsetView::ROPChannels(readout::ROPID const& ropid) const -> ChannelIDrange_t
+{
+  std::size_t const index = ROPindex(ropid);
+  if (index == NoIndex) return util::counter(raw::ChannelID_t{0}, raw::ChannelID_t{0});
+  tpcset::ROP_t const& ROP = section<tpcset::ROP_t>(ROPs).begin()[index];
+  return util::counter(ROP.firstChannel, ROP.firstChannel + ROP.nChannels);
+} // geo::TPCsetView::ROPChannels()
+
+//------------------------------------------------------------------------------
+std::size_t geo::TPCsetView::heapMemory() const
+{
+  return lar::util::heapMemory(fBlock);
+} // geo::TPCsetView::heapMemory()
+
+//------------------------------------------------------------------------------
+std::size_t geo::TPCsetView::TPCIndex(geo::TPCID const& tpcid) const
+{
+  if (!tpcid.isValid || (tpcid.asCryostatID() != fID.asCryostatID())) return NoIndex;
+  auto const TPCrecords = section<tpcset::TPC_t>(TPCs);
+  for (std::size_t i = 0; i < TPCrecords.size(); ++i) {
+    if (TPCrecords.begin()[i].tpc == tpcid.TPC) return i;
+  }
+  return NoIndex;
+} // geo::TPCsetView::TPCIndex()
+
+//------------------------------------------------------------------------------
+std::size_t geo::TPCsetView::planeIndex(geo::PlaneID const& planeid) const
+{
+  std::size_t const iTPC = TPCIndex(planeid);
+  if (iTPC == NoIndex) return NoIndex;
+  tpcset::TPC_t const& TPC = section<tpcset::TPC_t>(TPCs).begin()[iTPC];
+  return (planeid.Plane < TPC.nPlanes) ? TPC.firstPlane + planeid.Plane : NoIndex;
+} // geo::TPCsetView::planeIndex()
+
+//------------------------------------------------------------------------------
+std::size_t geo::TPCsetView::ROPindex(readout::ROPID const& ropid) const
+{
+  return (ropid.isValid && (ropid.asTPCsetID() == fID) && (ropid.ROP < NROPs())) ? ropid.ROP :
+                                                                                  NoIndex;
+} // geo::TPCsetView::ROPindex()
+
+//------------------------------------------------------------------------------
+geo::tpcset::Plane_t const& geo::TPCsetView::plane(geo::PlaneID const& planeid) const
+{
+  std::size_t const index = planeIndex(planeid);
+  if (index == NoIndex) {
+    throw cet::exception("TPCsetView") << "Plane " << planeid << " is not in " << fID << "\n";
+  }
+  return section<tpcset::Plane_t>(Planes).begin()[index];
+} // geo::TPCsetView::plane()
+
+//------------------------------------------------------------------------------
+int geo::TPCsetView::nearestWireNumber(tpcset::Plane_t const& plane, double wireCoord) const
+{
+  // same as `geo::PlaneGeo::NearestWireNumber()`
+  if (plane.nCenters == 0U) return int(0.5 + wireCoord);
+  return details::WireCenterTable::nearestWire(
+    wireCoord,
+    section<double>(CenterCoords).begin() + plane.firstCenter,
+    section<details::WireCenterTable::WireNo_t>(CenterWires).begin() + plane.firstCenter,
+    plane.nCenters);
+} // geo::TPCsetView::nearestWireNumber()
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,300 @@
+/**
+ * @file   larcorealg/Geometry/TPCsetView.h
+ * @brief  Packed copy of the geometry of a single TPC set.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/TPCsetView.cxx`
+ * @ingroup Geometry
+ */
+
+#ifndef LARCOREALG_GEOMETRY_TPCSETVIEW_H
+#define LARCOREALG_GEOMETRY_TPCSETVIEW_H
+
+// LArSoft libraries
+#include "larcorealg/CoreUtils/counter.h"
+#include "larcorealg/CoreUtils/span.h"
+#include "larcorealg/Geometry/QueryResult.h"
+#include "larcorealg/Geometry/TPCGeo.h" // geo::TPCGeo::DriftFrame_t
+#include "larcorealg/Geometry/details/BoxKernel.h"
+#include "larcorealg/Geometry/details/WireCoordinateKernel.h"
+#include "larcoreobj/SimpleTypesAndConstants/RawTypes.h" // raw::ChannelID_t
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+#include "larcoreobj/SimpleTypesAndConstants/geo_vectors.h"
+#include "larcoreobj/SimpleTypesAndConstants/readout_types.h"
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t, std::byte
+#include <cstdint> // std::uint32_t
+#include <type_traits>
+#include <vector>
+
+namespace geo {
+
+  class GeometryCore;
+
+  /**
+   * @brief Records of the TPC set view.
+   *
+   * The records are plain data, copied as they are into the block of the
+   * view. Indices refer to the elements of the same TPC set only.
+   */
+  namespace tpcset {
+
+    /// A TPC of the set.
+    struct TPC_t {
+      details::BoxKernel box;          ///< Box of the TPC, with the position tolerance.
+      geo::TPCGeo::DriftFrame_t drift; ///< Drift direction and anode position.
+      geo::TPCID::TPCID_t tpc;         ///< Number of the TPC in its cryostat.
+      std::uint32_t firstPlane;        ///< Index of the first plane of the TPC.
+      std::uint32_t nPlanes;           ///< Number of planes in the TPC.
+      std::uint32_t reserved;          ///< Padding, always `0`.
+    }; // TPC_t
+
+    /// A wire plane of the set.
+    struct Plane_t {
+      details::WireCoordinateKernel kernel; ///< Wire coordinate parameters.
+      std::uint32_t firstWire;   ///< Index of the channel of the first wire.
+      std::uint32_t firstCenter; ///< Index of the first wire center (if not uniform).
+      std::uint32_t nCenters;    ///< Number of wire centers (`0` if uniform).
+      std::uint32_t rop;         ///< Number of the readout plane of the plane.
+      std::int32_t view;         ///< View (`geo::View_t`).
+    }; // Plane_t
+
+    /// A readout plane of the set.
+    struct ROP_t {
+      raw::ChannelID_t firstChannel; ///< First channel of the readout plane.
+      std::uint32_t nChannels;       ///< Number of channels.
+      std::uint32_t firstPlane;      ///< Index of its first plane in the plane list.
+      std::uint32_t nPlanes;         ///< Number of planes.
+    }; // ROP_t
+
+    static_assert(std::is_trivially_copyable_v<TPC_t>);
+    static_assert(std::is_trivially_copyable_v<Plane_t>);
+    static_assert(std::is_trivially_copyable_v<ROP_t>);
+
+  } // namespace tpcset
+
+  class TPCsetView;
+
+} // namespace geo
+
+//------------------------------------------------------------------------------
+/**
+ * @brief The geometry of one TPC set, packed into a single block of memory.
+ * @see `geo::GeometryCore`
+ *
+ * A job processing only one TPC set (e.g. a thread pinned to one APA) uses
+ * only its TPCs, planes and channels, which in `geo::GeometryCore` are spread
+ * among the objects of the whole detector. This object copies all that a
+ * query on the TPC set needs into one contiguous block, cache line aligned:
+ * * the box and the drift frame of each TPC (`geo::tpcset::TPC_t`);
+ * * the wire coordinate decomposition of each plane (`geo::tpcset::Plane_t`);
+ * * the channel range and the planes of each readout plane
+ *   (`geo::tpcset::ROP_t`);
+ * * the channel of each wire, and the positions of the wires of the planes
+ *   with non-uniform wires (`geo::PlaneGeo::HasUniformWires()`).
+ * For a typical TPC set the block is a few ten kilobytes (`blockSize()`),
+ * mostly the channels of the wires, and stays in the cache of a core.
+ *
+ * The queries have the names and the results of the ones of
+ * `geo::GeometryCore`, restricted to the TPC set: IDs of elements outside of
+ * it are treated as not existing. The view is a copy, and it does not need
+ * the geometry after its construction.
+ *
+ * Example:
+ * ~~~~{.cpp}
+ * geo::TPCsetView const apa{geom, readout::TPCsetID{0, 3}};
+ * geo::TPCID const tpcid = apa.FindTPCAtPosition(point);
+ * if (tpcid) {
+ *   auto const wire = apa.TryNearestWireID(point, geo::PlaneID{tpcid, 0});
+ *   if (wire) channel = apa.PlaneWireToChannel(*wire);
+ * }
+ * ~~~~
+ */
+class geo::TPCsetView {
+
+public:
+  /// Type of a range of channels.
+  using ChannelIDrange_t = decltype(util::counter(raw::ChannelID_t{}, raw::ChannelID_t{}));
+
+  /// Type of the wire coordinate parameters of a plane.
+  using WireCoordinateKernel_t = details::WireCoordinateKernel;
+
+  /// Size of the cache line the sections of the block are aligned to [bytes]
+  static constexpr std::size_t CacheLineSize = 64U;
+
+  /**
+   * @brief Constructor: copies the geometry of a TPC set.
+   * @param geom the geometry of the detector
+   * @param tpcsetid ID of the TPC set to be copied
+   * @throw cet::exception (category `"TPCsetView"`) if there is no such set
+   */
+  TPCsetView(geo::GeometryCore const& geom, readout::TPCsetID const& tpcsetid);
+
+  // --- BEGIN -- Content ------------------------------------------------------
+  /// Returns the ID of the TPC set.
+  readout::TPCsetID const& ID() const { return fID; }
+
+  /// Returns the number of TPCs in the set.
+  unsigned int NTPC() const { return fSections[TPCs].count; }
+
+  /// Returns the number of readout planes in the set.
+  unsigned int NROPs() const { return fSections[ROPs].count; }
+
+  /// Returns the number of channels of all the readout planes of the set.
+  unsigned int Nchannels() const;
+
+  /// Returns whether `tpcid` is a TPC of the set.
+  bool HasTPC(geo::TPCID const& tpcid) const { return TPCIndex(tpcid) != NoIndex; }
+
+  /// Returns whether `planeid` is a plane of the set.
+  bool HasPlane(geo::PlaneID const& planeid) const { return planeIndex(planeid) != NoIndex; }
+
+  /// Returns whether `ropid` is a readout plane of the set.
+  bool HasROP(readout::ROPID const& ropid) const { return ROPindex(ropid) != NoIndex; }
+
+  /// Returns the IDs of the TPCs of the set, in the order of the set.
+  std::vector<geo::TPCID> TPCIDs() const;
+
+  /// Returns the drift parameters of the TPC `tpcid`.
+  /// @throw cet::exception (category `"TPCsetView"`) if not in the set
+  geo::TPCGeo::DriftFrame_t const& DriftFrame(geo::TPCID const& tpcid) const;
+
+  /// Returns the wire coordinate parameters of the plane `planeid`.
+  /// @throw cet::exception (category `"TPCsetView"`) if not in the set
+  WireCoordinateKernel_t const& WireCoordinateKernel(geo::PlaneID const& planeid) const;
+  // --- END ---- Content ------------------------------------------------------
+
+  // --- BEGIN -- Position queries ---------------------------------------------
+  /**
+   * @brief Returns the ID of the TPC of the set at the specified location.
+   * @param point 3D point (world reference frame, centimeters)
+   * @return the TPC ID, or an invalid one if no TPC of the set is there
+   *
+   * The tolerance on the boundaries is the one of the geometry
+   * (`geo::GeometryCore::DefaultWiggle()`).
+   */
+  geo::TPCID FindTPCAtPosition(geo::Point_t const& point) const;
+
+  /// Returns the wire coordinate of `point` on the plane `planeid`.
+  /// @throw cet::exception (category `"TPCsetView"`) if not in the set
+  double WireCoordinate(geo::Point_t const& point, geo::PlaneID const& planeid) const
+  {
+    return WireCoordinateKernel(planeid).wireCoordinate(point.X(), point.Y(), point.Z());
+  }
+
+  /**
+   * @brief Returns the ID of the wire nearest to `point`.
+   * @param point the point to be tested [cm]
+   * @param planeid ID of the plane
+   * @return the ID of the wire
+   * @throw cet::exception (category `"TPCsetView"`) if the plane is not in
+   *        the set
+   * @throw geo::InvalidWireError if `point` is beyond the wires of the plane
+   * @see `geo::GeometryCore::NearestWireID()`
+   */
+  geo::WireID NearestWireID(geo::Point_t const& point, geo::PlaneID const& planeid) const;
+
+  /**
+   * @brief Returns the ID of the wire nearest to `point`, without throwing.
+   * @see `geo::GeometryCore::TryNearestWireID()`
+   *
+   * The query fails with `geo::QueryError::NoPlane` if `planeid` is not in
+   * the set, and with `geo::QueryError::WireOutOfRange` if `point` is beyond
+   * the wires of the plane.
+   */
+  geo::QueryResult_t<geo::WireID> TryNearestWireID(geo::Point_t const& point,
+                                                   geo::PlaneID const& planeid) const;
+  // --- END ---- Position queries ---------------------------------------------
+
+  // --- BEGIN -- Channel queries ----------------------------------------------
+  /// Returns the channel of the wire `wireid` (invalid if not in the set).
+  raw::ChannelID_t PlaneWireToChannel(geo::WireID const& wireid) const;
+
+  /// Returns the ID of the readout plane of `planeid` (invalid if not in the set).
+  readout::ROPID WirePlaneToROP(geo::PlaneID const& planeid) const;
+
+  /// Returns the IDs of the planes of the readout plane `ropid` (empty if none).
+  std::vector<geo::PlaneID> ROPtoWirePlanes(readout::ROPID const& ropid) const;
+
+  /// Returns the readout plane of `channel` (invalid if not in the set).
+  readout::ROPID ChannelToROP(raw::ChannelID_t channel) const;
+
+  /// Returns the ID of the first channel of `ropid` (invalid if not in the set).
+  raw::ChannelID_t FirstChannelInROP(readout::ROPID const& ropid) const;
+
+  /// Returns the number of channels of `ropid` (`0` if not in the set).
+  unsigned int Nchannels(readout::ROPID const& ropid) const;
+
+  /// Returns the range of the channels of `ropid` (empty if not in the set).
+  ChannelIDrange_t ROPChannels(readout::ROPID const& ropid) const;
+  // --- END ---- Channel queries ----------------------------------------------
+
+  /// Returns the size of the block with all the records [bytes]
+  std::size_t blockSize() const { return fBlock.size() * sizeof(CacheLine_t); }
+
+  /// Returns the memory allocated by the view, besides its own size [bytes]
+  std::size_t heapMemory() const;
+
+private:
+  /// Index of an element not in the set.
+  static constexpr std::size_t NoIndex = ~std::size_t{0};
+
+  /// A cache line of the block.
+  struct alignas(CacheLineSize) CacheLine_t {
+    std::byte data[CacheLineSize];
+  };
+
+  /// The sections of the block.
+  enum Section_t : std::size_t {
+    TPCs,         ///< `tpcset::TPC_t` records.
+    Planes,       ///< `tpcset::Plane_t` records.
+    ROPs,         ///< `tpcset::ROP_t` records.
+    ROPplanes,    ///< Index of the planes of each readout plane.
+    WireChannels, ///< Channel of each wire.
+    CenterCoords, ///< Sorted wire coordinates of the wire centers.
+    CenterWires,  ///< Wire number of each of the center coordinates.
+    NSections     ///< Number of sections.
+  };
+
+  /// Position and number of records of a section in the block.
+  struct SectionInfo_t {
+    std::size_t offset = 0U; ///< Offset of the first record from the block start [bytes]
+    std::size_t count = 0U;  ///< Number of records.
+  };
+
+  readout::TPCsetID fID; ///< ID of the TPC set.
+
+  SectionInfo_t fSections[NSections]; ///< Where each section is in the block.
+
+  std::vector<CacheLine_t> fBlock; ///< The records of all the sections.
+
+  /// Returns the records of the section `sec`, of type `T`.
+  template <typename T>
+  util::span<T const*> section(Section_t sec) const
+  {
+    auto const start = reinterpret_cast<T const*>(
+      reinterpret_cast<std::byte const*>(fBlock.data()) + fSections[sec].offset);
+    return {start, start + fSections[sec].count};
+  }
+
+  /// Returns the index of the TPC `tpcid` in the set, or `NoIndex`.
+  std::size_t TPCIndex(geo::TPCID const& tpcid) const;
+
+  /// Returns the index of the plane `planeid` in the set, or `NoIndex`.
+  std::size_t planeIndex(geo::PlaneID const& planeid) const;
+
+  /// Returns the index of the readout plane `ropid` in the set, or `NoIndex`.
+  std::size_t ROPindex(readout::ROPID const& ropid) const;
+
+  /// Returns the record of the plane `planeid`.
+  /// @throw cet::exception (category `"TPCsetView"`) if not in the set
+  tpcset::Plane_t const& plane(geo::PlaneID const& planeid) const;
+
+  /// Returns the number of the wire of `plane` nearest to the wire coordinate.
+  int nearestWireNumber(tpcset::Plane_t const& plane, double wireCoord) const;
+
+}; // geo::TPCsetView
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREALG_GEOMETRY_TPCSETVIEW_H
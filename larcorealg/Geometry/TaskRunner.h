@@ -0,0 +1,58 @@
+/**
+ * @file   larcorealg/Geometry/TaskRunner.h
+ * @brief  Hook to run independent geometry building tasks in parallel.
+ * @date   October 14, 2026
+ *
+ * This is a header only library.
+ */
+
+#ifndef LARCOREALG_GEOMETRY_TASKRUNNER_H
+#define LARCOREALG_GEOMETRY_TASKRUNNER_H
+
+// LArSoft libraries
+#include "larcorealg/CoreUtils/Executor.h"
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <functional>
+
+namespace geo {
+
+  /**
+   * @brief Function running `task(i)` for each `i` from `0` to `n - 1`.
+   *
+   * The runner may execute the tasks in any order and concurrently, but it
+   * must return only after all of them are complete, and it should propagate
+   * their exceptions. The geometry uses it for work on independent elements,
+   * like building or sorting different TPCs. A runner based on a TBB task
+   * arena could be:
+   * ~~~~{.cpp}
+   * geo::TaskRunner_t runner = [](std::size_t n, auto const& task)
+   *   { tbb::parallel_for(std::size_t{0}, n, task); };
+   * ~~~~
+   * `makeThreadTaskRunner()` provides a simple runner on standard threads.
+   * An empty runner means that the work is done sequentially.
+   *
+   * This is the function wrapped by `lar::util::Executor`, and an executor
+   * can be used wherever a runner is expected.
+   */
+  using TaskRunner_t = lar::util::Executor::ParallelFor_t;
+
+  /// Runs `n` tasks with `runner`, or sequentially if there is no runner.
+  inline void runTasks(TaskRunner_t const& runner,
+                       std::size_t n,
+                       std::function<void(std::size_t)> const& task)
+  {
+    lar::util::Executor::runParallelFor(runner, n, task);
+  }
+
+  /// Returns a runner spreading the tasks on `nThreads` standard threads
+  /// (`0`: hardware concurrency); see `lar::util::Executor::threads()`.
+  inline TaskRunner_t makeThreadTaskRunner(unsigned int nThreads = 0U)
+  {
+    return lar::util::Executor::threads(nThreads).parallelFor();
+  }
+
+} // namespace geo
+
+#endif // LARCOREALG_GEOMETRY_TASKRUNNER_H
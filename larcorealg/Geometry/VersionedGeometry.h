@@ -0,0 +1,93 @@
+/**
+ * @file   larcorealg/Geometry/VersionedGeometry.h
+ * @brief  Geometry replaceable while it is being used by other threads.
+ * @date   October 14, 2026
+ * @see    `larcorealg/CoreUtils/SnapshotPublisher.h`
+ *
+ * This is a header only library.
+ */
+
+#ifndef LARCOREALG_GEOMETRY_VERSIONEDGEOMETRY_H
+#define LARCOREALG_GEOMETRY_VERSIONEDGEOMETRY_H
+
+// LArSoft libraries
+#include "larcorealg/CoreUtils/SnapshotPublisher.h"
+#include "larcorealg/Geometry/GeometryCore.h"
+
+// C/C++ standard libraries
+#include <memory> // std::unique_ptr<>
+#include <utility> // std::move()
+
+namespace geo {
+
+  /**
+   * @brief Holds the current version of the geometry for concurrent readers.
+   *
+   * A multithreaded job crossing runs with different alignment constants or
+   * channel mapping does not need to stop all its threads to replace the
+   * geometry. A new, complete `geo::GeometryCore` (with its channel mapping
+   * and alignment) is built on the side, then `publish()`ed: the threads which
+   * `acquire()` a handle from then on get the new geometry, while the ones
+   * still holding a handle to the old geometry keep using it, unchanged, until
+   * they release it. The last handle to a geometry destroys it.
+   * Acquiring a handle never waits for a new geometry to be published.
+   *
+   * Example, at a run boundary:
+   * ~~~~{.cpp}
+   * auto geom = std::make_unique<geo::GeometryCore>(pset);
+   * geom->LoadGeometryFile(gdmlPath, rootPath);
+   * geom->ApplyChannelMap(std::make_unique<geo::ChannelMapStandardAlg>(sortingPars));
+   * geom->ApplyAlignment(alignmentForRun(run));
+   * versionedGeom.publish(std::move(geom));
+   *
+   * // in each event (any thread):
+   * geo::VersionedGeometry::Handle_t const geom = versionedGeom.acquire();
+   * geo::TPCGeo const& tpc = geom->PositionToTPC(point);
+   * ~~~~
+   * A published geometry is used only through its constant interface, and
+   * all its caches are built before publication (`BuildDerivedCaches()`), so
+   * no reader ever waits for their construction either.
+   *
+   * All the versions share the ROOT geometry (`gGeoManager`), which must then
+   * stay the same: loading the new geometry from the same ROOT file does not
+   * import it again (`geo::ImportROOTGeometry()`). Versions from different
+   * ROOT geometries can't be used at the same time.
+   */
+  class VersionedGeometry {
+    using Publisher_t = lar::util::SnapshotPublisher<geo::GeometryCore>;
+
+  public:
+    /// Access to one version of the geometry; keeps it alive.
+    using Handle_t = Publisher_t::Snapshot;
+
+    /// Type of number of a geometry version.
+    using Version_t = Publisher_t::Version_t;
+
+    /// Returns a handle to the current geometry (invalid if none yet).
+    Handle_t acquire() const noexcept { return fPublisher.acquire(); }
+
+    /// Returns the number of the current version (`0` if none yet).
+    Version_t version() const noexcept { return fPublisher.version(); }
+
+    /**
+     * @brief Makes `geom` the current geometry, and returns its version.
+     * @param geom the new geometry, already with its channel mapping
+     * @return the number of the new version (the first one is `1`)
+     *
+     * The caches of `geom` are built first (`BuildDerivedCaches()`).
+     * The handles to the previous version stay valid.
+     */
+    Version_t publish(std::unique_ptr<geo::GeometryCore> geom)
+    {
+      geom->BuildDerivedCaches();
+      return fPublisher.publish(std::move(geom));
+    }
+
+  private:
+    Publisher_t fPublisher; ///< Holder of the current version.
+
+  }; // class VersionedGeometry
+
+} // namespace geo
+
+#endif // LARCOREALG_GEOMETRY_VERSIONEDGEOMETRY_H
@@ -0,0 +1,356 @@
+/**
+ * @file   larcorealg/Geometry/WireCoincidenceFinder.h
+ * @brief  Enumeration of crossings of active wires from two and three planes.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/details/WireIntersectionTables.h`
+ *
+ * This is a header only library.
+ */
+
+#ifndef LARCOREALG_GEOMETRY_WIRECOINCIDENCEFINDER_H
+#define LARCOREALG_GEOMETRY_WIRECOINCIDENCEFINDER_H
+
+// LArSoft libraries
+#include "larcorealg/Geometry/details/WireIntersectionTables.h"
+
+// framework libraries
+#include "cetlib_except/exception.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::lower_bound(), std::max(), std::min()
+#include <array>
+#include <atomic>
+#include <cmath> // std::abs(), std::ceil(), std::floor()
+#include <cstddef>
+#include <exception> // std::exception_ptr
+#include <limits>
+#include <thread>
+#include <vector>
+
+namespace geo {
+
+  /**
+   * @brief Finds the crossings of active wires of a TPC.
+   * @see `geo::details::WireIntersectionTables`, `geo::TPCGeo::WireIntersections()`
+   *
+   * The input is, for each plane of a TPC, the list of its active wires
+   * (`ActiveWire_t`), sorted by wire number, each optionally with a time
+   * window. The finder enumerates:
+   *
+   * * `findPairs()`: all the pairs of wires from two planes which cross within
+   *   their length (as `geo::GeometryCore::WireIDsIntersect()` reports) and
+   *   whose time windows overlap;
+   * * `findTriplets()`: all the pairs as above which are also matched by a
+   *   wire on a third plane passing within `Config_t::wireTolerance` wire
+   *   pitches from their crossing point, with time window overlapping both.
+   *
+   * Instead of testing all the pairs of wires, for each active wire of the
+   * second plane only the active wires of the first one in the range of
+   * crossing wires precomputed in the tables are visited. Since those ranges
+   * move along with the wire number, the search in the (sorted) list of the
+   * first plane resumes from the position of the previous wire.
+   * The matching wires on the third plane are found from the wire coordinate
+   * of the crossing point, again with a binary search.
+   *
+   * All the planes involved must be covered by the tables of the TPC
+   * (`supports()`), otherwise an exception is thrown.
+   *
+   * `findTripletsInTPCs()` processes many TPCs at once, each one on one of the
+   * worker threads.
+   */
+  class WireCoincidenceFinder {
+
+  public:
+    using Tables_t = geo::details::WireIntersectionTables;
+    using WireNo_t = Tables_t::WireNo_t;
+    using Coords_t = Tables_t::Coords_t;
+
+    /// Value of an index which is not set.
+    static constexpr std::size_t NoIndex = std::numeric_limits<std::size_t>::max();
+
+    /// An active wire, with the time window it is active in.
+    struct ActiveWire_t {
+      WireNo_t wire = 0;                                            ///< Wire number.
+      double startTime = -std::numeric_limits<double>::infinity(); ///< Start of window.
+      double endTime = std::numeric_limits<double>::infinity();    ///< End of window.
+    };
+
+    /// Active wires of each plane of a TPC, sorted by wire number.
+    using PlaneWires_t = std::vector<std::vector<ActiveWire_t>>;
+
+    /// A coincidence of active wires.
+    struct Coincidence_t {
+      /// Index in the input list of the wire of each plane (`NoIndex` if none).
+      std::array<std::size_t, 3U> wires{NoIndex, NoIndex, NoIndex};
+
+      /// Point on the wire of the first plane closest to the one of the second.
+      Coords_t point{};
+    };
+
+    /// Configuration of the finder.
+    struct Config_t {
+      /// Largest distance of the third wire from a crossing [wire pitches].
+      double wireTolerance = 0.5;
+    };
+
+    /// All the information needed to find the triplets in one TPC.
+    struct TPCJob_t {
+      Tables_t const* tables = nullptr;             ///< Tables of the TPC.
+      PlaneWires_t const* wires = nullptr;          ///< Active wires of the TPC.
+      std::array<std::size_t, 3U> planes{0, 1, 2}; ///< Planes to match.
+    };
+
+    /// Creates a finder using the intersection `tables` of a TPC.
+    WireCoincidenceFinder(Tables_t const& tables, Config_t config)
+      : fTables(&tables), fConfig(config)
+    {}
+
+    /// Creates a finder with the default configuration.
+    explicit WireCoincidenceFinder(Tables_t const& tables)
+      : WireCoincidenceFinder(tables, Config_t{})
+    {}
+
+    /// Returns whether the planes `a` and `b` can be matched.
+    bool supports(std::size_t a, std::size_t b) const { return fTables->hasPlanePair(a, b); }
+
+    /// Returns whether the planes `a`, `b` and `c` can be matched.
+    bool supports(std::size_t a, std::size_t b, std::size_t c) const
+    {
+      return supports(a, b) && supports(c, a);
+    }
+
+    /**
+     * @brief Returns all the crossings of active wires of planes `a` and `b`.
+     * @param wires the active wires of each plane of the TPC
+     * @param a the first plane
+     * @param b the second plane
+     * @return the crossings, with the wire indices of planes `a` and `b`
+     * @throw cet::exception (category: `"WireCoincidenceFinder"`) if the
+     *        planes are not supported
+     *
+     * The crossings are sorted by wire in `b`, then by wire in `a`.
+     */
+    std::vector<Coincidence_t> findPairs(PlaneWires_t const& wires,
+                                         std::size_t a,
+                                         std::size_t b) const;
+
+    /**
+     * @brief Returns all the crossings of active wires of three planes.
+     * @param wires the active wires of each plane of the TPC
+     * @param a the first plane
+     * @param b the second plane
+     * @param c the third plane
+     * @return the coincidences, with the wire indices of planes `a`, `b`, `c`
+     * @throw cet::exception (category: `"WireCoincidenceFinder"`) if the
+     *        planes are not supported
+     *
+     * The point of the coincidence is the crossing of the wires of planes `a`
+     * and `b`. The same crossing may be matched by more than one wire of `c`.
+     */
+    std::vector<Coincidence_t> findTriplets(PlaneWires_t const& wires,
+                                            std::size_t a,
+                                            std::size_t b,
+                                            std::size_t c) const;
+
+    /**
+     * @brief Runs `findTriplets()` on each of the `jobs`, in parallel.
+     * @param jobs the TPCs to process
+     * @param config configuration of the finder
+     * @param nThreads number of threads to use (`0`: hardware concurrency)
+     * @return the result of each job, in the same order as `jobs`
+     *
+     * If any job throws an exception, the first one caught is rethrown after
+     * all the threads are done.
+     */
+    static std::vector<std::vector<Coincidence_t>> findTripletsInTPCs(
+      std::vector<TPCJob_t> const& jobs,
+      Config_t config,
+      unsigned int nThreads = 0U);
+
+    /// Runs `findTriplets()` on each of the `jobs` with the default configuration.
+    static std::vector<std::vector<Coincidence_t>> findTripletsInTPCs(
+      std::vector<TPCJob_t> const& jobs)
+    {
+      return findTripletsInTPCs(jobs, Config_t{});
+    }
+
+  private:
+    Tables_t const* fTables; ///< Intersection tables of the TPC.
+    Config_t fConfig;        ///< Configuration.
+
+    /// Throws an exception if the planes can't be matched.
+    void checkPlanes(PlaneWires_t const& wires, std::size_t a, std::size_t b) const;
+
+    /// Calls `callback(iA, iB, point)` for each crossing of planes `a` and `b`.
+    template <typename Callback>
+    void forEachPair(PlaneWires_t const& wires,
+                     std::size_t a,
+                     std::size_t b,
+                     Callback&& callback) const;
+
+    /// Returns whether the windows of the wires overlap.
+    static bool overlap(ActiveWire_t const& w1, ActiveWire_t const& w2)
+    {
+      return std::max(w1.startTime, w2.startTime) <= std::min(w1.endTime, w2.endTime);
+    }
+
+    /// Returns the first wire in `wires` from `start` with number not lower than `wire`.
+    static std::vector<ActiveWire_t>::const_iterator findWire(
+      std::vector<ActiveWire_t> const& wires,
+      std::vector<ActiveWire_t>::const_iterator start,
+      WireNo_t wire)
+    {
+      return std::lower_bound(start, wires.end(), wire, [](ActiveWire_t const& w, WireNo_t n) {
+        return w.wire < n;
+      });
+    }
+
+  }; // class WireCoincidenceFinder
+
+} // namespace geo
+
+//------------------------------------------------------------------------------
+//---  template implementation
+//------------------------------------------------------------------------------
+template <typename Callback>
+void geo::WireCoincidenceFinder::forEachPair(PlaneWires_t const& wires,
+                                             std::size_t a,
+                                             std::size_t b,
+                                             Callback&& callback) const
+{
+  std::vector<ActiveWire_t> const& wiresA = wires[a];
+  std::vector<ActiveWire_t> const& wiresB = wires[b];
+
+  auto iStart = wiresA.begin();
+  WireNo_t prevFirst = 0U;
+  for (std::size_t iB = 0; iB < wiresB.size(); ++iB) {
+    ActiveWire_t const& wireB = wiresB[iB];
+    auto const [first, last] = fTables->crossingWires(a, b, wireB.wire);
+    if (first >= last) continue;
+
+    // resume from the previous position if the range moved forward
+    iStart = findWire(wiresA, ((first >= prevFirst) ? iStart : wiresA.begin()), first);
+    prevFirst = first;
+
+    for (auto iA = iStart; (iA != wiresA.end()) && (iA->wire < last); ++iA) {
+      if (!overlap(*iA, wireB)) continue;
+      auto const crossing = fTables->crossing(a, iA->wire, b, wireB.wire);
+      callback(static_cast<std::size_t>(iA - wiresA.begin()), iB, crossing.point);
+    }
+  } // for wires in B
+} // geo::WireCoincidenceFinder::forEachPair()
+
+//------------------------------------------------------------------------------
+inline void geo::WireCoincidenceFinder::checkPlanes(PlaneWires_t const& wires,
+                                                    std::size_t a,
+                                                    std::size_t b) const
+{
+  if ((a >= wires.size()) || (b >= wires.size())) {
+    throw cet::exception("WireCoincidenceFinder")
+      << "Planes " << a << " and " << b << " requested, but only " << wires.size()
+      << " lists of wires provided.\n";
+  }
+  if (!supports(a, b)) {
+    throw cet::exception("WireCoincidenceFinder")
+      << "Planes " << a << " and " << b << " have no intersection tables.\n";
+  }
+} // geo::WireCoincidenceFinder::checkPlanes()
+
+//------------------------------------------------------------------------------
+inline auto geo::WireCoincidenceFinder::findPairs(PlaneWires_t const& wires,
+                                                  std::size_t a,
+                                                  std::size_t b) const
+  -> std::vector<Coincidence_t>
+{
+  checkPlanes(wires, a, b);
+  std::vector<Coincidence_t> pairs;
+  forEachPair(wires, a, b, [&pairs](std::size_t iA, std::size_t iB, Coords_t const& point) {
+    pairs.push_back({{iA, iB, NoIndex}, point});
+  });
+  return pairs;
+} // geo::WireCoincidenceFinder::findPairs()
+
+//------------------------------------------------------------------------------
+inline auto geo::WireCoincidenceFinder::findTriplets(PlaneWires_t const& wires,
+                                                     std::size_t a,
+                                                     std::size_t b,
+                                                     std::size_t c) const
+  -> std::vector<Coincidence_t>
+{
+  checkPlanes(wires, a, b);
+  checkPlanes(wires, c, a);
+
+  std::vector<ActiveWire_t> const& wiresA = wires[a];
+  std::vector<ActiveWire_t> const& wiresB = wires[b];
+  std::vector<ActiveWire_t> const& wiresC = wires[c];
+  if (wiresC.empty()) return {};
+  double const lastWireC = wiresC.back().wire;
+  Coords_t const& dirC = fTables->wireDirection(c);
+
+  std::vector<Coincidence_t> triplets;
+  auto const matchThird = [&](std::size_t iA, std::size_t iB, Coords_t const& point) {
+    double const w = fTables->wireCoordinate(c, point);
+    double const wMin = std::max(std::ceil(w - fConfig.wireTolerance), 0.0);
+    double const wMax = std::min(std::floor(w + fConfig.wireTolerance), lastWireC);
+    if (wMin > wMax) return;
+
+    auto const wMaxNo = static_cast<WireNo_t>(wMax);
+    for (auto iC = findWire(wiresC, wiresC.begin(), static_cast<WireNo_t>(wMin));
+         (iC != wiresC.end()) && (iC->wire <= wMaxNo);
+         ++iC) {
+      if (!overlap(*iC, wiresA[iA]) || !overlap(*iC, wiresB[iB])) continue;
+
+      // the crossing must also be within the length of the third wire
+      Coords_t const center = fTables->wireCenter(c, iC->wire);
+      double const offset = (point[0] - center[0]) * dirC[0] + (point[1] - center[1]) * dirC[1] +
+                            (point[2] - center[2]) * dirC[2];
+      if (std::abs(offset) > fTables->wireHalfLength(c, iC->wire)) continue;
+
+      triplets.push_back({{iA, iB, static_cast<std::size_t>(iC - wiresC.begin())}, point});
+    } // for
+  };
+  forEachPair(wires, a, b, matchThird);
+  return triplets;
+} // geo::WireCoincidenceFinder::findTriplets()
+
+//------------------------------------------------------------------------------
+inline auto geo::WireCoincidenceFinder::findTripletsInTPCs(std::vector<TPCJob_t> const& jobs,
+                                                           Config_t config,
+                                                           unsigned int nThreads)
+  -> std::vector<std::vector<Coincidence_t>>
+{
+  std::vector<std::vector<Coincidence_t>> results(jobs.size());
+  if (nThreads == 0U) nThreads = std::max(std::thread::hardware_concurrency(), 1U);
+  nThreads = std::min<std::size_t>(nThreads, jobs.size());
+
+  std::atomic<std::size_t> nextJob{0U};
+  std::vector<std::exception_ptr> errors(jobs.size());
+  auto const worker = [&]() {
+    for (std::size_t iJob = nextJob++; iJob < jobs.size(); iJob = nextJob++) {
+      TPCJob_t const& job = jobs[iJob];
+      try {
+        auto const [a, b, c] = job.planes;
+        results[iJob] =
+          WireCoincidenceFinder{*job.tables, config}.findTriplets(*job.wires, a, b, c);
+      }
+      catch (...) {
+        errors[iJob] = std::current_exception();
+      }
+    } // for
+  };
+
+  std::vector<std::thread> threads;
+  for (unsigned int iThread = 1; iThread < nThreads; ++iThread)
+    threads.emplace_back(worker);
+  worker(); // this thread works too
+  for (std::thread& thread : threads)
+    thread.join();
+
+  for (std::exception_ptr const& error : errors)
+    if (error) std::rethrow_exception(error);
+  return results;
+} // geo::WireCoincidenceFinder::findTripletsInTPCs()
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREALG_GEOMETRY_WIRECOINCIDENCEFINDER_H
@@ -0,0 +1,93 @@
+/**
+ * @file   larcorealg/Geometry/WireEndpointBuffer.h
+ * @brief  End points and channels of many wires in contiguous arrays.
+ * @date   October 14, 2026
+ * @see    `geo::GeometryCore::MakeWireEndpointBuffer()`
+ *
+ * This is a header only library.
+ */
+
+#ifndef LARCOREALG_GEOMETRY_WIREENDPOINTBUFFER_H
+#define LARCOREALG_GEOMETRY_WIREENDPOINTBUFFER_H
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/RawTypes.h" // raw::ChannelID_t
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint64_t
+#include <vector>
+
+namespace geo {
+
+  /**
+   * @brief End points, IDs and channels of a list of wires.
+   * @tparam T type of the coordinates (`float` or `double`)
+   *
+   * The coordinates of the wires are in `vertices`, six per wire: _x_, _y_
+   * and _z_ of the start, then of the end of the wire, in world coordinates
+   * [cm]. This is the layout of a vertex buffer of line segments, and it can
+   * be uploaded as it is for rendering.
+   *
+   * The buffer records the fingerprint of the geometry it was made from (see
+   * `geo::GeometryCore::Fingerprint()`), so that a cached buffer can be
+   * checked to be still valid with `isValidFor()`.
+   */
+  template <typename T>
+  struct WireEndpointBuffer {
+
+    using Coord_t = T; ///< Type of the coordinates.
+
+    /// Number of coordinates of each wire in `vertices`.
+    static constexpr std::size_t CoordsPerWire = 6U;
+
+    std::vector<Coord_t> vertices;          ///< Start and end of each wire.
+    std::vector<geo::WireID> wires;         ///< ID of each wire.
+    std::vector<raw::ChannelID_t> channels; ///< Channel of each wire.
+
+    std::uint64_t fingerprint = 0U; ///< Fingerprint of the source geometry.
+    bool sortedEnds = false; ///< Whether the ends are sorted as in `WireEndPoints()`.
+
+    /// Returns the number of wires.
+    std::size_t size() const { return wires.size(); }
+
+    /// Returns whether there are no wires.
+    bool empty() const { return wires.empty(); }
+
+    /// Returns the coordinates of the start of wire `i` (three values).
+    Coord_t const* start(std::size_t i) const { return vertices.data() + CoordsPerWire * i; }
+
+    /// Returns the coordinates of the end of wire `i` (three values).
+    Coord_t const* end(std::size_t i) const { return start(i) + 3U; }
+
+    /// Returns the size of the vertex data, in bytes.
+    std::size_t vertexBytes() const { return vertices.size() * sizeof(Coord_t); }
+
+    /// Returns whether this buffer was made from a geometry with `geomFingerprint`.
+    bool isValidFor(std::uint64_t geomFingerprint) const
+    {
+      return (fingerprint != 0U) && (fingerprint == geomFingerprint);
+    }
+
+    /// Removes all the wires.
+    void clear()
+    {
+      vertices.clear();
+      wires.clear();
+      channels.clear();
+    }
+
+    /// Prepares room for `n` wires.
+    void reserve(std::size_t n)
+    {
+      vertices.reserve(CoordsPerWire * n);
+      wires.reserve(n);
+      channels.reserve(n);
+    }
+
+  }; // WireEndpointBuffer
+
+} // namespace geo
+
+#endif // LARCOREALG_GEOMETRY_WIREENDPOINTBUFFER_H
@@ -28,10 +28,30 @@
 namespace geo {
 
   //-----------------------------------------
-  WireGeo::WireGeo(TGeoNode const& node, geo::TransformationMatrix&& trans)
-    : fWireNode(&node), fTrans(std::move(trans)), flipped(false)
+  WireGeo::WireGeo(TGeoNode const& node, geo::TransformationMatrix&& matrix)
+    : fWireNode(&node), fRadius(0.0), flipped(false)
   {
     fHalfL = ((TGeoTube*)fWireNode->GetVolume()->GetShape())->GetDZ();
+    SetLocalFrame(std::move(matrix));
+  } // geo::WireGeo::WireGeo()
+
+  //......................................................................
+  WireGeo::WireGeo(geo::TransformationMatrix&& matrix, double halfLength, double radius)
+    : fWireNode(nullptr), fHalfL(halfLength), fRadius(radius), flipped(false)
+  {
+    SetLocalFrame(std::move(matrix));
+  } // geo::WireGeo::WireGeo()
+
+  //......................................................................
+  void WireGeo::SetLocalFrame(geo::TransformationMatrix&& matrix)
+  {
+    // keep only the origin and the axes of the local frame
+    LocalTransformation_t const trans{std::move(matrix)};
+    fCenter = trans.toWorldCoords(geo::origin<LocalPoint_t>());
+    fLocalX = trans.toWorldCoords(LocalVector_t{1.0, 0.0, 0.0}).Unit();
+    fLocalZ = trans.toWorldCoords(LocalVector_t{0.0, 0.0, 1.0}).Unit();
+    fReflected =
+      fLocalZ.Cross(fLocalX).Dot(trans.toWorldCoords(LocalVector_t{0.0, 1.0, 0.0})) < 0.0;
 
     // uncomment the following to check the paths to the wires
     //   std::string p(base);
@@ -41,9 +61,15 @@ namespace geo {
     //   }
     //   std::cout << p.c_str() << std::endl;
 
+    UpdateThetaZ();
+
+  } // geo::WireGeo::SetLocalFrame()
+
+  //......................................................................
+  void WireGeo::UpdateThetaZ()
+  {
     // determine the orientation of the wire
     auto lp = geo::origin<LocalPoint_t>();
-    fCenter = toWorldCoords(lp);
 
     lp.SetZ(fHalfL);
     auto end = toWorldCoords(lp);
@@ -63,7 +89,7 @@ namespace geo {
 
     assert(std::isfinite(fThetaZ));
 
-  } // geo::WireGeo::WireGeo()
+  } // WireGeo::UpdateThetaZ()
 
   //......................................................................
   void WireGeo::GetCenter(double* xyz, double localz) const
@@ -86,12 +112,14 @@ namespace geo {
   //......................................................................
   double geo::WireGeo::RMax() const
   {
+    if (!fWireNode) return fRadius;
     return ((TGeoTube*)fWireNode->GetVolume()->GetShape())->GetRmax();
   }
 
   //......................................................................
   double geo::WireGeo::RMin() const
   {
+    if (!fWireNode) return 0.0;
     return ((TGeoTube*)fWireNode->GetVolume()->GetShape())->GetRmin();
   }
 
@@ -142,6 +170,17 @@ namespace geo {
 
   } // WireGeo::UpdateAfterSorting()
 
+  //......................................................................
+  void WireGeo::ApplyAlignment(geo::TransformationMatrix const& delta)
+  {
+    // a rigid transformation preserves the length and the handedness of the
+    // local frame, and the orientation of the wire (flipping) is kept
+    fCenter = delta(fCenter);
+    fLocalX = delta(fLocalX).Unit();
+    fLocalZ = delta(fLocalZ).Unit();
+    UpdateThetaZ();
+  } // WireGeo::ApplyAlignment()
+
   //......................................................................
   void WireGeo::Flip()
   {
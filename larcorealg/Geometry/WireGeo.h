@@ -108,11 +108,24 @@ namespace geo {
      * is in fact the length), while the transformation described its
      * positioning in the world (both position and orientation).
      *
-     * A pointer to the node and a copy of the transformation matrix are kept
-     * in the `WireGeo` object.
+     * A pointer to the node is kept in the `WireGeo` object, while the
+     * transformation is reduced to the center of the wire and the world
+     * directions of its local axes.
      */
     WireGeo(TGeoNode const& node, geo::TransformationMatrix&& trans);
 
+    /**
+     * @brief Constructor of a wire without a ROOT geometry node.
+     * @param trans transformation matrix (local to world)
+     * @param halfLength half the length of the wire [cm]
+     * @param radius the radius of the wire [cm]
+     *
+     * The wire is a segment along the local _z_ axis, centered on the local
+     * origin. These wires have no node (`Node()` returns `nullptr`) and no
+     * inner radius.
+     */
+    WireGeo(geo::TransformationMatrix&& trans, double halfLength, double radius);
+
 
     // -- BEGIN -- Size and coordinates ----------------------------------------
     /// @name Size and coordinates
@@ -353,40 +366,41 @@ namespace geo {
 
     /// Transform point from local wire frame to world frame.
     void LocalToWorld(const double* wire, double* world) const
-      { fTrans.LocalToWorld(wire, world); }
+      { geo::vect::fillCoords(world, toWorldCoords(geo::vect::makeFromCoords<LocalPoint_t>(wire))); }
 
     /// Transform point from local wire frame to world frame.
     geo::Point_t toWorldCoords(LocalPoint_t const& local) const
-      { return fTrans.toWorldCoords(local); }
+      { return fCenter + toWorldCoords(local - geo::origin<LocalPoint_t>()); }
 
     /// Transform direction vector from local to world.
     void LocalToWorldVect(const double* wire, double* world) const
-      { fTrans.LocalToWorldVect(wire, world); }
+      { geo::vect::fillCoords(world, toWorldCoords(geo::vect::makeFromCoords<LocalVector_t>(wire))); }
 
     /// Transform direction vector from local to world.
     geo::Vector_t toWorldCoords(LocalVector_t const& local) const
-      { return fTrans.toWorldCoords(local); }
+      { return local.X() * fLocalX + local.Y() * localY() + local.Z() * fLocalZ; }
 
     /// Transform point from world frame to local wire frame.
     void WorldToLocal(const double* world, double* wire) const
-      { fTrans.WorldToLocal(world, wire); }
+      { geo::vect::fillCoords(wire, toLocalCoords(geo::vect::makePointFromCoords(world))); }
 
     /// Transform point from world frame to local wire frame.
     LocalPoint_t toLocalCoords(geo::Point_t const& world) const
-      { return fTrans.toLocalCoords(world); }
+      { return geo::origin<LocalPoint_t>() + toLocalCoords(world - fCenter); }
 
     /// Transform direction vector from world to local.
     void WorldToLocalVect(const double* world, double* wire) const
-      { fTrans.WorldToLocalVect(world, wire); }
+      { geo::vect::fillCoords(wire, toLocalCoords(geo::vect::makeVectorFromCoords(world))); }
 
     /// Transform direction vector from world to local.
     LocalVector_t toLocalCoords(geo::Vector_t const& world) const
-      { return fTrans.toLocalCoords(world); }
+      { return { world.Dot(fLocalX), world.Dot(localY()), world.Dot(fLocalZ) }; }
 
     /// @}
     // -- END ---- Coordinate transformation -----------------------------------
 
 
+    /// Returns the ROOT node of the wire (`nullptr` if built without one).
     const TGeoNode*     Node() const { return fWireNode; }
 
     
@@ -471,6 +485,15 @@ namespace geo {
     /// Internal updates after the relative position of the wire is known
     /// (currently no-op)
     void UpdateAfterSorting(geo::WireID const&, bool flip);
+
+    /**
+     * @brief Moves the wire by a rigid transformation.
+     * @param delta the transformation, in world coordinates
+     * @see `geo::GeometryAlignment`
+     *
+     * The wire keeps its length and orientation (start and end).
+     */
+    void ApplyAlignment(geo::TransformationMatrix const& delta);
     
     /// Returns the pitch (distance on y/z plane) between two wires, in cm
     static double WirePitch(geo::WireGeo const& w1, geo::WireGeo const& w2)
@@ -480,13 +503,23 @@ namespace geo {
     using LocalTransformation_t = geo::LocalTransformationGeo
       <ROOT::Math::Transform3D, LocalPoint_t, LocalVector_t>;
 
+    // the local frame is stored as its origin and the world direction of two
+    // of its axes, the third one being computed when needed (`localY()`);
+    // that is enough for the rigid transformations of the geometry
     const TGeoNode*    fWireNode;  ///< Pointer to the wire node
     double             fThetaZ;    ///< angle of the wire with respect to the z direction
     double             fHalfL;     ///< half length of the wire
+    double             fRadius;    ///< Radius of the wire, if without node.
     geo::Point_t       fCenter;    ///< Center of the wire in world coordinates.
-    LocalTransformation_t fTrans;  ///< Wire to world transform.
+    geo::Vector_t      fLocalX;    ///< World direction of the local _x_ axis.
+    geo::Vector_t      fLocalZ;    ///< World direction of the local _z_ axis (wire axis).
+    bool               fReflected; ///< Whether the local frame is left-handed.
     bool               flipped;    ///< whether start and end are reversed
 
+    /// Returns the world direction of the local _y_ axis.
+    geo::Vector_t localY() const
+      { return fReflected? fLocalX.Cross(fLocalZ): fLocalZ.Cross(fLocalX); }
+
     /// Returns whether ( 0, 0, fHalfL ) identifies end (false) or start (true)
     /// of the wire.
     bool isFlipped() const { return flipped; }
@@ -505,6 +538,12 @@ namespace geo {
     /// Set to swap the start and end wire
     void Flip();
 
+    /// Recomputes `fThetaZ` from the local frame.
+    void UpdateThetaZ();
+
+    /// Sets the center and the axes of the local frame from `matrix`.
+    void SetLocalFrame(geo::TransformationMatrix&& matrix);
+
 
     static double gausSum(double a, double b) { return std::sqrt(a*a + b*b); }
 
@@ -577,17 +616,14 @@ namespace geo {
 //------------------------------------------------------------------------------
 template <typename Point>
 Point geo::WireGeo::GetPositionFromCenterUnbounded(double localz) const {
-  return geo::vect::convertTo<Point>
-    (toWorldCoords(LocalPoint_t{ 0.0, 0.0, relLength(localz) }));
+  return geo::vect::convertTo<Point>(fCenter + relLength(localz) * fLocalZ);
 } // geo::WireGeo::GetPositionFromCenterImpl()
 
 
 //------------------------------------------------------------------------------
 template <typename Vector>
 Vector geo::WireGeo::Direction() const {
-  // maybe (GetCenter() - GetStart()) / HalfL() would be faster;
-  // strangely, TVector3 does not implement operator/ (double).
-  return geo::vect::convertTo<Vector>(GetEnd<geo::Point_t>() - GetStart<geo::Point_t>()) * (1.0 / Length());
+  return geo::vect::convertTo<Vector>(isFlipped()? -fLocalZ: fLocalZ);
 } // geo::WireGeo::Direction()
 
 
@@ -0,0 +1,243 @@
+/**
+ * @file   larcorealg/Geometry/WireSelection.h
+ * @brief  Selection of wires by view, signal type, region and TPC set.
+ * @date   October 14, 2026
+ * @see    `geo::GeometryCore::SelectWireRanges()`
+ *
+ * This is a header only library.
+ */
+
+#ifndef LARCOREALG_GEOMETRY_WIRESELECTION_H
+#define LARCOREALG_GEOMETRY_WIRESELECTION_H
+
+// LArSoft libraries
+#include "larcorealg/Geometry/BoxBoundedGeo.h"
+#include "larcorealg/Geometry/PlaneGeo.h" // geo::PlaneGeo::WireRange_t
+#include "larcorealg/Geometry/TPCGeo.h"   // geo::TPCGeo::ViewMask_t
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+#include "larcoreobj/SimpleTypesAndConstants/readout_types.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::max(), std::min()
+#include <cstddef>   // std::size_t, std::ptrdiff_t
+#include <iterator>  // std::forward_iterator_tag
+#include <optional>
+#include <utility> // std::move()
+#include <vector>
+
+namespace geo {
+
+  /**
+   * @brief Criteria selecting wires of the detector.
+   * @see `geo::GeometryCore::SelectWireRanges()`,
+   *      `geo::GeometryCore::IterateWireIDs(geo::WireSelection const&)`
+   *
+   * A wire is selected if it passes all the criteria which are set:
+   * * its plane has one of the views added with `inView()`;
+   * * its plane has the signal type set with `withSignalType()`;
+   * * its projection on the plane overlaps the box set with `inBox()`, as in
+   *   `geo::GeometryCore::WiresInRange()` (calling `inBox()` again selects
+   *   the overlap of the two boxes);
+   * * its TPC is one of the ones added with `inTPC()`, or belongs to one of
+   *   the TPC sets added with `inTPCset()`.
+   *
+   * A default-constructed selection selects all the wires. The geometry does
+   * not test the criteria wire by wire: TPCs are picked from the TPC sets and
+   * the box, planes from the view table of each TPC, and wires of each plane
+   * from the box, so that the work is proportional to the number of ranges
+   * of wires returned. For example, the collection wires under a box:
+   * ~~~~{.cpp}
+   * for (geo::WireID const& wireID: geom.IterateWireIDs
+   *   (geo::WireSelection{}.withSignalType(geo::kCollection).inBox(box))
+   * ) {
+   *   // ...
+   * }
+   * ~~~~
+   */
+  class WireSelection {
+  public:
+    using ViewMask_t = geo::TPCGeo::ViewMask_t;
+
+    /// Adds `view` to the views selected (all views if none is added).
+    WireSelection& inView(geo::View_t view)
+    {
+      fViews |= geo::TPCGeo::ViewBit(view);
+      return *this;
+    }
+
+    /// Selects only the wires of planes with signal type `sigType`.
+    WireSelection& withSignalType(geo::SigType_t sigType)
+    {
+      fSigType = sigType;
+      return *this;
+    }
+
+    /// Selects only the wires whose projection overlaps `box` [cm].
+    WireSelection& inBox(geo::BoxBoundedGeo const& box)
+    {
+      if (!fBox)
+        fBox = box;
+      else if (fBox->Overlaps(box))
+        fBox = overlap(*fBox, box);
+      else
+        fNoRegion = true;
+      return *this;
+    }
+
+    /// Adds the TPC `tpcid` to the TPCs selected (all TPCs if none is added).
+    WireSelection& inTPC(geo::TPCID const& tpcid)
+    {
+      fTPCs.push_back(tpcid);
+      return *this;
+    }
+
+    /// Adds the TPCs of `tpcsetid` to the TPCs selected.
+    WireSelection& inTPCset(readout::TPCsetID const& tpcsetid)
+    {
+      fTPCsets.push_back(tpcsetid);
+      return *this;
+    }
+
+    /// Returns the mask of the views selected (`0` if all).
+    ViewMask_t views() const { return fViews; }
+
+    /// Returns the signal type selected (`geo::kMysteryType` if any).
+    geo::SigType_t signalType() const { return fSigType; }
+
+    /// Returns the box selected, `nullptr` if none.
+    geo::BoxBoundedGeo const* box() const { return fBox ? &*fBox : nullptr; }
+
+    /// Returns whether the boxes selected do not overlap, selecting no wire.
+    bool isEmptyRegion() const { return fNoRegion; }
+
+    /// Returns the TPCs explicitly selected.
+    std::vector<geo::TPCID> const& TPCs() const { return fTPCs; }
+
+    /// Returns the TPC sets selected.
+    std::vector<readout::TPCsetID> const& TPCsets() const { return fTPCsets; }
+
+    /// Returns whether the selection includes all the TPCs.
+    bool allTPCs() const { return fTPCs.empty() && fTPCsets.empty(); }
+
+    /// Returns the part of `a` which is also in `b` (if they overlap).
+    static geo::BoxBoundedGeo overlap(geo::BoxBoundedGeo const& a, geo::BoxBoundedGeo const& b)
+    {
+      return {{std::max(a.MinX(), b.MinX()),
+               std::max(a.MinY(), b.MinY()),
+               std::max(a.MinZ(), b.MinZ())},
+              {std::min(a.MaxX(), b.MaxX()),
+               std::min(a.MaxY(), b.MaxY()),
+               std::min(a.MaxZ(), b.MaxZ())}};
+    }
+
+  private:
+    ViewMask_t fViews = 0U;                      ///< Views selected (`0`: all).
+    geo::SigType_t fSigType = geo::kMysteryType; ///< Signal type selected.
+    std::optional<geo::BoxBoundedGeo> fBox;      ///< Region selected.
+    bool fNoRegion = false;                      ///< Whether the boxes don't overlap.
+    std::vector<geo::TPCID> fTPCs;               ///< TPCs selected.
+    std::vector<readout::TPCsetID> fTPCsets;     ///< TPC sets selected.
+
+  }; // class WireSelection
+
+  /**
+   * @brief Range of the IDs of the wires in a list of ranges of wires.
+   * @see `geo::GeometryCore::IterateWireIDs(geo::WireSelection const&)`
+   *
+   * The range owns the list of `geo::PlaneGeo::WireRange_t`, and its forward
+   * iterators produce the ID of each of the wires of each range in order.
+   */
+  class WireRangeIDs {
+  public:
+    using WireRange_t = geo::PlaneGeo::WireRange_t;
+
+    /// Forward iterator on the wire IDs.
+    class iterator {
+    public:
+      using iterator_category = std::forward_iterator_tag;
+      using value_type = geo::WireID;
+      using difference_type = std::ptrdiff_t;
+      using pointer = geo::WireID const*;
+      using reference = geo::WireID const&;
+
+      iterator() = default;
+
+      reference operator*() const { return fID; }
+      pointer operator->() const { return &fID; }
+
+      iterator& operator++()
+      {
+        if (++fID.Wire >= fRange->end) {
+          ++fRange;
+          setID();
+        }
+        return *this;
+      }
+
+      iterator operator++(int)
+      {
+        iterator old{*this};
+        ++*this;
+        return old;
+      }
+
+      bool operator==(iterator const& other) const
+      {
+        return (fRange == other.fRange) && ((fRange == fEnd) || (fID.Wire == other.fID.Wire));
+      }
+      bool operator!=(iterator const& other) const { return !(*this == other); }
+
+    private:
+      friend class WireRangeIDs;
+
+      WireRange_t const* fRange = nullptr; ///< Current range.
+      WireRange_t const* fEnd = nullptr;   ///< End of the ranges.
+      geo::WireID fID;                     ///< Current wire ID.
+
+      iterator(WireRange_t const* range, WireRange_t const* end) : fRange{range}, fEnd{end}
+      {
+        setID();
+      }
+
+      /// Moves to the first wire of the current range, skipping empty ranges.
+      void setID()
+      {
+        while ((fRange != fEnd) && fRange->empty())
+          ++fRange;
+        if (fRange != fEnd) fID = fRange->wireID(0U);
+      }
+    }; // class iterator
+
+    /// Constructor: takes the list of `ranges`.
+    explicit WireRangeIDs(std::vector<WireRange_t> ranges) : fRanges{std::move(ranges)} {}
+
+    iterator begin() const { return {fRanges.data(), fRanges.data() + fRanges.size()}; }
+    iterator end() const
+    {
+      WireRange_t const* const end = fRanges.data() + fRanges.size();
+      return {end, end};
+    }
+
+    /// Returns whether there is no wire.
+    bool empty() const { return begin() == end(); }
+
+    /// Returns the number of wires.
+    std::size_t size() const
+    {
+      std::size_t n = 0U;
+      for (WireRange_t const& range : fRanges)
+        n += range.size();
+      return n;
+    }
+
+    /// Returns the ranges of wires.
+    std::vector<WireRange_t> const& ranges() const { return fRanges; }
+
+  private:
+    std::vector<WireRange_t> fRanges; ///< The ranges of wires.
+
+  }; // class WireRangeIDs
+
+} // namespace geo
+
+#endif // LARCOREALG_GEOMETRY_WIRESELECTION_H
@@ -0,0 +1 @@
+#include "larcorealg/Geometry/GeometryArrayQueries.h"
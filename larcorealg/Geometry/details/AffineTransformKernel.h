@@ -0,0 +1,199 @@
+/**
+ * @file   larcorealg/Geometry/details/AffineTransformKernel.h
+ * @brief  Affine transformation of many points and vectors at once.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/LocalTransformation.h`
+ *
+ * This is a header only library.
+ */
+
+#ifndef LARCOREALG_GEOMETRY_DETAILS_AFFINETRANSFORMKERNEL_H
+#define LARCOREALG_GEOMETRY_DETAILS_AFFINETRANSFORMKERNEL_H
+
+// LArSoft libraries
+#include "larcorealg/CoreUtils/SimdDispatch.h" // LARCOREALG_SIMD_CLONES
+
+// C/C++ standard libraries
+#include <cstddef>     // std::size_t
+#include <type_traits> // std::remove_reference_t
+
+namespace geo::details {
+
+  /**
+   * @brief A 3x4 affine transformation, applied to arrays of points.
+   *
+   * The transformation of a point @f$ p @f$ is @f$ R p + t @f$, where the
+   * 3x3 matrix @f$ R @f$ is stored by rows in `rot` and the translation
+   * @f$ t @f$ in `shift`; vectors are transformed by @f$ R @f$ only.
+   *
+   * The batch methods process points given as three coordinate arrays
+   * ("structure of arrays"), in loops with no dependency among the points that
+   * the compiler can vectorize, or as a sequence of point objects ("array of
+   * structures"), which must offer `X()`, `Y()` and `Z()` accessors. The
+   * array loops are compiled for each vector instruction set
+   * (`LARCOREALG_SIMD_CLONES`).
+   * Input and output arrays must not overlap.
+   */
+  struct AffineTransformKernel {
+
+    double rot[9] = {1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0}; ///< Matrix, by rows.
+    double shift[3] = {0.0, 0.0, 0.0};                             ///< Translation.
+
+    /**
+     * @brief Returns the transformation mapping the origin and the axes as specified.
+     * @param origin image of the origin (`[0]` _x_, `[1]` _y_, `[2]` _z_)
+     * @param axisX image of the unit vector along _x_ (with no translation)
+     * @param axisY image of the unit vector along _y_ (with no translation)
+     * @param axisZ image of the unit vector along _z_ (with no translation)
+     */
+    static AffineTransformKernel fromImages(double const* origin,
+                                            double const* axisX,
+                                            double const* axisY,
+                                            double const* axisZ)
+    {
+      AffineTransformKernel kernel;
+      for (std::size_t i = 0; i < 3; ++i) {
+        kernel.rot[3 * i + 0] = axisX[i];
+        kernel.rot[3 * i + 1] = axisY[i];
+        kernel.rot[3 * i + 2] = axisZ[i];
+        kernel.shift[i] = origin[i];
+      }
+      return kernel;
+    }
+
+    /// Transforms the point `in` into `out` (which must not overlap).
+    void transformPoint(double const* in, double* out) const
+    {
+      applyPoint(in[0], in[1], in[2], out[0], out[1], out[2]);
+    }
+
+    /// Transforms the vector `in` into `out` (which must not overlap).
+    void transformVector(double const* in, double* out) const
+    {
+      applyVector(in[0], in[1], in[2], out[0], out[1], out[2]);
+    }
+
+    /// Transforms `n` points given by their coordinate arrays.
+    LARCOREALG_SIMD_CLONES
+    void transformPoints(std::size_t n,
+                         double const* __restrict__ x,
+                         double const* __restrict__ y,
+                         double const* __restrict__ z,
+                         double* __restrict__ outX,
+                         double* __restrict__ outY,
+                         double* __restrict__ outZ) const;
+
+    /// Transforms `n` vectors given by their coordinate arrays.
+    LARCOREALG_SIMD_CLONES
+    void transformVectors(std::size_t n,
+                          double const* __restrict__ x,
+                          double const* __restrict__ y,
+                          double const* __restrict__ z,
+                          double* __restrict__ outX,
+                          double* __restrict__ outY,
+                          double* __restrict__ outZ) const;
+
+    /// Transforms the points in [`begin`, `end`[ into the sequence from `out`.
+    template <typename PointIter, typename OutIter>
+    void transformPoints(PointIter begin, PointIter end, OutIter out) const;
+
+    /// Transforms the vectors in [`begin`, `end`[ into the sequence from `out`.
+    template <typename VectorIter, typename OutIter>
+    void transformVectors(VectorIter begin, VectorIter end, OutIter out) const;
+
+  private:
+    void applyPoint(double x, double y, double z, double& outX, double& outY, double& outZ) const
+    {
+      outX = rot[0] * x + rot[1] * y + rot[2] * z + shift[0];
+      outY = rot[3] * x + rot[4] * y + rot[5] * z + shift[1];
+      outZ = rot[6] * x + rot[7] * y + rot[8] * z + shift[2];
+    }
+
+    void applyVector(double x, double y, double z, double& outX, double& outY, double& outZ) const
+    {
+      outX = rot[0] * x + rot[1] * y + rot[2] * z;
+      outY = rot[3] * x + rot[4] * y + rot[5] * z;
+      outZ = rot[6] * x + rot[7] * y + rot[8] * z;
+    }
+
+    /// Transforms the sequence with `apply`, assigning the results to `out`.
+    template <typename Iter, typename OutIter, typename Apply>
+    static void transformSequence(Iter begin, Iter end, OutIter out, Apply apply)
+    {
+      using Dest_t = std::remove_reference_t<decltype(*out)>;
+      for (; begin != end; ++begin, ++out) {
+        double x, y, z;
+        apply(begin->X(), begin->Y(), begin->Z(), x, y, z);
+        *out = Dest_t{x, y, z};
+      }
+    }
+
+  }; // struct AffineTransformKernel
+
+} // namespace geo::details
+
+//------------------------------------------------------------------------------
+//--- inline implementation
+//------------------------------------------------------------------------------
+inline void geo::details::AffineTransformKernel::transformPoints(
+  std::size_t n,
+  double const* __restrict__ x,
+  double const* __restrict__ y,
+  double const* __restrict__ z,
+  double* __restrict__ outX,
+  double* __restrict__ outY,
+  double* __restrict__ outZ) const
+{
+  // local copies, so that the compiler knows they do not alias the output
+  double const r0 = rot[0], r1 = rot[1], r2 = rot[2];
+  double const r3 = rot[3], r4 = rot[4], r5 = rot[5];
+  double const r6 = rot[6], r7 = rot[7], r8 = rot[8];
+  double const t0 = shift[0], t1 = shift[1], t2 = shift[2];
+  for (std::size_t i = 0; i < n; ++i) {
+    outX[i] = r0 * x[i] + r1 * y[i] + r2 * z[i] + t0;
+    outY[i] = r3 * x[i] + r4 * y[i] + r5 * z[i] + t1;
+    outZ[i] = r6 * x[i] + r7 * y[i] + r8 * z[i] + t2;
+  }
+} // geo::details::AffineTransformKernel::transformPoints()
+
+//------------------------------------------------------------------------------
+inline void geo::details::AffineTransformKernel::transformVectors(
+  std::size_t n,
+  double const* __restrict__ x,
+  double const* __restrict__ y,
+  double const* __restrict__ z,
+  double* __restrict__ outX,
+  double* __restrict__ outY,
+  double* __restrict__ outZ) const
+{
+  double const r0 = rot[0], r1 = rot[1], r2 = rot[2];
+  double const r3 = rot[3], r4 = rot[4], r5 = rot[5];
+  double const r6 = rot[6], r7 = rot[7], r8 = rot[8];
+  for (std::size_t i = 0; i < n; ++i) {
+    outX[i] = r0 * x[i] + r1 * y[i] + r2 * z[i];
+    outY[i] = r3 * x[i] + r4 * y[i] + r5 * z[i];
+    outZ[i] = r6 * x[i] + r7 * y[i] + r8 * z[i];
+  }
+} // geo::details::AffineTransformKernel::transformVectors()
+
+//------------------------------------------------------------------------------
+template <typename PointIter, typename OutIter>
+void geo::details::AffineTransformKernel::transformPoints(PointIter begin,
+                                                          PointIter end,
+                                                          OutIter out) const
+{
+  transformSequence(begin, end, out, [this](auto&&... args) { applyPoint(args...); });
+}
+
+//------------------------------------------------------------------------------
+template <typename VectorIter, typename OutIter>
+void geo::details::AffineTransformKernel::transformVectors(VectorIter begin,
+                                                           VectorIter end,
+                                                           OutIter out) const
+{
+  transformSequence(begin, end, out, [this](auto&&... args) { applyVector(args...); });
+}
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREALG_GEOMETRY_DETAILS_AFFINETRANSFORMKERNEL_H
@@ -0,0 +1,301 @@
+/**
+ * @file   larcorealg/Geometry/details/BoxBVH.h
+ * @brief  Bounding volume hierarchy over boxes aligned with the axes.
+ * @date   October 14, 2026
+ *
+ * This is a header only library.
+ */
+
+#ifndef LARCOREALG_GEOMETRY_DETAILS_BOXBVH_H
+#define LARCOREALG_GEOMETRY_DETAILS_BOXBVH_H
+
+// LArSoft libraries
+#include "larcorealg/CoreUtils/MemoryUsage.h"
+#include "larcorealg/Geometry/details/BoxKernel.h" // geo::details::BoxRay
+
+// C/C++ standard libraries
+#include <algorithm> // std::min(), std::max(), std::nth_element()
+#include <array>
+#include <cstddef> // std::size_t
+#include <limits>
+#include <numeric> // std::iota()
+#include <vector>
+
+namespace geo::details {
+
+  /**
+   * @brief Binary tree of bounding boxes, to find the boxes containing a point.
+   *
+   * The hierarchy is built from a list of boxes (`build()`), each given as its
+   * lower and upper corner. Each node of the tree holds the box enclosing all
+   * the boxes below it, and each leaf a few of the original boxes.
+   * The query `findFirst()` returns the first box, in the order of the list
+   * used to build, which contains the point and satisfies an additional test;
+   * the result is the same as checking all the boxes in turn, but only the
+   * branches of the tree enclosing the point are visited. Each node also
+   * records the lowest box index below it, so that branches which can't
+   * improve on a box already found are skipped.
+   *
+   * A `margin` may be specified on query, by which all the boxes are expanded
+   * on all sides.
+   *
+   * The query `forEachCrossed()` visits instead all the boxes crossed by a
+   * segment of a line, in no particular order.
+   */
+  class BoxBVH {
+
+  public:
+    /// Type of index of a box (its position in the list used to build).
+    using BoxIndex_t = unsigned int;
+
+    /// Type of coordinates of a box corner.
+    using Coords_t = std::array<double, 3U>;
+
+    /// Lower and upper corner of a box.
+    struct Box_t {
+      Coords_t lower; ///< Lower corner of the box.
+      Coords_t upper; ///< Upper corner of the box.
+    };
+
+    /// Value returned when no box is found.
+    static constexpr BoxIndex_t NoBox = std::numeric_limits<BoxIndex_t>::max();
+
+    /// Largest number of boxes in a leaf of the tree.
+    static constexpr std::size_t LeafSize = 4U;
+
+    /// Builds the hierarchy from the `boxes`; any previous one is replaced.
+    void build(std::vector<Box_t> const& boxes);
+
+    /// Removes the hierarchy.
+    void clear();
+
+    /// Returns whether the hierarchy is empty (not built, or built with no box).
+    bool empty() const { return fNodes.empty(); }
+
+    /// Returns the number of boxes in the hierarchy.
+    std::size_t size() const { return fBoxes.size(); }
+
+    /// Returns the number of nodes of the tree.
+    std::size_t nNodes() const { return fNodes.size(); }
+
+    /**
+     * @brief Returns the first box containing the point and accepted by `pred`.
+     * @tparam Pred type of callable taking a `BoxIndex_t` and returning `bool`
+     * @param x coordinate _x_ of the point
+     * @param y coordinate _y_ of the point
+     * @param z coordinate _z_ of the point
+     * @param margin the boxes are expanded by this amount on each side
+     * @param pred additional test of a box that contains the point
+     * @return the index of the first box passing all tests, `NoBox` if none
+     */
+    template <typename Pred>
+    BoxIndex_t findFirst(double x, double y, double z, double margin, Pred pred) const;
+
+    /// Returns the first box containing the point (`x`, `y`, `z`).
+    BoxIndex_t findFirst(double x, double y, double z, double margin = 0.0) const
+    {
+      return findFirst(x, y, z, margin, [](BoxIndex_t) { return true; });
+    }
+
+    /**
+     * @brief Calls `fn` for each box crossed by a segment of `ray`.
+     * @tparam Fn type of callable taking a `BoxIndex_t` and two `double`
+     * @param ray the line
+     * @param tMin line parameter of the start of the segment
+     * @param tMax line parameter of the end of the segment
+     * @param fn called as `fn(iBox, tEnter, tExit)` for each crossed box
+     * @see `geo::details::BoxKernel::intersect()`
+     *
+     * The line parameters `tEnter` and `tExit` of the crossing are restricted
+     * to the segment: a segment starting inside a box has `tEnter` equal to
+     * `tMin`, and one ending inside a box has `tExit` equal to `tMax`.
+     */
+    template <typename Fn>
+    void forEachCrossed(BoxRay const& ray, double tMin, double tMax, Fn fn) const;
+
+    /// Returns the memory allocated by the tree, besides its own size [bytes]
+    std::size_t heapMemory() const
+    {
+      return lar::util::heapMemory(fBoxes) + lar::util::heapMemory(fOrder) +
+             lar::util::heapMemory(fNodes);
+    }
+
+  private:
+    /// A node of the tree.
+    struct Node_t {
+      Box_t box;           ///< Box enclosing all the boxes of the node.
+      BoxIndex_t minIndex; ///< Lowest box index in the node.
+      /// Leaves: first box in `fOrder`; others: index of the second child
+      /// (the first child immediately follows its parent).
+      BoxIndex_t first;
+      BoxIndex_t count; ///< Number of boxes in a leaf, `0` for other nodes.
+    };
+
+    std::vector<Box_t> fBoxes;      ///< The boxes, in their original order.
+    std::vector<BoxIndex_t> fOrder; ///< Box indices, sorted by leaf.
+    std::vector<Node_t> fNodes;     ///< Nodes of the tree; the first is the root.
+
+    /// Adds the node for the boxes in `fOrder` [`begin`, `end`[ and its children.
+    void buildNode(std::size_t begin, std::size_t end);
+
+    /// Returns whether the point is in `box` expanded by `margin`.
+    static bool contains(Box_t const& box, double x, double y, double z, double margin)
+    {
+      // written so that NaN coordinates are also rejected
+      return (x >= box.lower[0] - margin) && (x <= box.upper[0] + margin) &&
+             (y >= box.lower[1] - margin) && (y <= box.upper[1] + margin) &&
+             (z >= box.lower[2] - margin) && (z <= box.upper[2] + margin);
+    }
+
+    /// Returns the part of [`tMin`, `tMax`] of `ray` in `box` (may be empty).
+    static std::array<double, 2U> crossing(Box_t const& box,
+                                           BoxRay const& ray,
+                                           double tMin,
+                                           double tMax)
+    {
+      BoxKernel const kernel{{box.lower[0], box.lower[1], box.lower[2]},
+                             {box.upper[0], box.upper[1], box.upper[2]}};
+      double tEnter, tExit;
+      kernel.intersect(ray, tEnter, tExit);
+      return {std::max(tEnter, tMin), std::min(tExit, tMax)};
+    }
+
+  }; // class BoxBVH
+
+} // namespace geo::details
+
+//------------------------------------------------------------------------------
+//---  inline and template implementation
+//------------------------------------------------------------------------------
+inline void geo::details::BoxBVH::build(std::vector<Box_t> const& boxes)
+{
+  clear();
+  if (boxes.empty()) return;
+  fBoxes = boxes;
+  fOrder.resize(fBoxes.size());
+  std::iota(fOrder.begin(), fOrder.end(), BoxIndex_t{0});
+  fNodes.reserve(2U * (fBoxes.size() / LeafSize + 1U));
+  buildNode(0U, fOrder.size());
+}
+
+//------------------------------------------------------------------------------
+inline void geo::details::BoxBVH::clear()
+{
+  fBoxes.clear();
+  fOrder.clear();
+  fNodes.clear();
+}
+
+//------------------------------------------------------------------------------
+inline void geo::details::BoxBVH::buildNode(std::size_t begin, std::size_t end)
+{
+  // enclosing box, and range of the box centers
+  Node_t node{fBoxes[fOrder[begin]], fOrder[begin], 0U, 0U};
+  Coords_t centerMin, centerMax;
+  for (std::size_t axis = 0; axis < 3U; ++axis)
+    centerMin[axis] = centerMax[axis] = 0.5 * (node.box.lower[axis] + node.box.upper[axis]);
+  for (std::size_t i = begin; i < end; ++i) {
+    Box_t const& box = fBoxes[fOrder[i]];
+    node.minIndex = std::min(node.minIndex, fOrder[i]);
+    for (std::size_t axis = 0; axis < 3U; ++axis) {
+      node.box.lower[axis] = std::min(node.box.lower[axis], box.lower[axis]);
+      node.box.upper[axis] = std::max(node.box.upper[axis], box.upper[axis]);
+      double const center = 0.5 * (box.lower[axis] + box.upper[axis]);
+      centerMin[axis] = std::min(centerMin[axis], center);
+      centerMax[axis] = std::max(centerMax[axis], center);
+    }
+  } // for boxes
+
+  std::size_t const iNode = fNodes.size();
+  if (end - begin <= LeafSize) {
+    node.first = static_cast<BoxIndex_t>(begin);
+    node.count = static_cast<BoxIndex_t>(end - begin);
+    fNodes.push_back(node);
+    return;
+  }
+  fNodes.push_back(node);
+
+  // split at the median center along the direction where centers spread most
+  std::size_t axis = 0;
+  for (std::size_t a = 1; a < 3U; ++a) {
+    if (centerMax[a] - centerMin[a] > centerMax[axis] - centerMin[axis]) axis = a;
+  }
+  std::size_t const middle = begin + (end - begin) / 2U;
+  std::nth_element(fOrder.begin() + begin,
+                   fOrder.begin() + middle,
+                   fOrder.begin() + end,
+                   [this, axis](BoxIndex_t a, BoxIndex_t b) {
+                     return (fBoxes[a].lower[axis] + fBoxes[a].upper[axis]) <
+                            (fBoxes[b].lower[axis] + fBoxes[b].upper[axis]);
+                   });
+
+  buildNode(begin, middle);
+  fNodes[iNode].first = static_cast<BoxIndex_t>(fNodes.size());
+  buildNode(middle, end);
+} // geo::details::BoxBVH::buildNode()
+
+//------------------------------------------------------------------------------
+template <typename Pred>
+auto geo::details::BoxBVH::findFirst(double x, double y, double z, double margin, Pred pred)
+  const -> BoxIndex_t
+{
+  if (empty()) return NoBox;
+
+  BoxIndex_t best = NoBox;
+  // depth of a balanced tree is about log2(size / LeafSize): 64 is plenty
+  BoxIndex_t stack[64];
+  std::size_t nStack = 0;
+  stack[nStack++] = 0U;
+  while (nStack > 0U) {
+    Node_t const& node = fNodes[stack[--nStack]];
+    if (node.minIndex >= best) continue;
+    if (!contains(node.box, x, y, z, margin)) continue;
+    if (node.count == 0U) {
+      BoxIndex_t const iNode = static_cast<BoxIndex_t>(&node - fNodes.data());
+      stack[nStack++] = node.first;
+      stack[nStack++] = iNode + 1U;
+      continue;
+    }
+    for (BoxIndex_t i = node.first; i < node.first + node.count; ++i) {
+      BoxIndex_t const iBox = fOrder[i];
+      if (iBox >= best) continue;
+      if (!contains(fBoxes[iBox], x, y, z, margin)) continue;
+      if (pred(iBox)) best = iBox;
+    }
+  } // while
+  return best;
+} // geo::details::BoxBVH::findFirst()
+
+//------------------------------------------------------------------------------
+template <typename Fn>
+void geo::details::BoxBVH::forEachCrossed(BoxRay const& ray,
+                                          double tMin,
+                                          double tMax,
+                                          Fn fn) const
+{
+  if (empty()) return;
+
+  BoxIndex_t stack[64];
+  std::size_t nStack = 0;
+  stack[nStack++] = 0U;
+  while (nStack > 0U) {
+    Node_t const& node = fNodes[stack[--nStack]];
+    auto const [nodeEnter, nodeExit] = crossing(node.box, ray, tMin, tMax);
+    if (!(nodeEnter <= nodeExit)) continue;
+    if (node.count == 0U) {
+      BoxIndex_t const iNode = static_cast<BoxIndex_t>(&node - fNodes.data());
+      stack[nStack++] = node.first;
+      stack[nStack++] = iNode + 1U;
+      continue;
+    }
+    for (BoxIndex_t i = node.first; i < node.first + node.count; ++i) {
+      BoxIndex_t const iBox = fOrder[i];
+      auto const [tEnter, tExit] = crossing(fBoxes[iBox], ray, tMin, tMax);
+      if (tEnter <= tExit) fn(iBox, tEnter, tExit);
+    }
+  } // while
+} // geo::details::BoxBVH::forEachCrossed()
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREALG_GEOMETRY_DETAILS_BOXBVH_H
@@ -0,0 +1,234 @@
+/**
+ * @file   larcorealg/Geometry/details/BoxGridIndex.h
+ * @brief  Uniform grid accelerating the search of boxes containing a point.
+ * @date   October 14, 2026
+ *
+ * This is a header only library.
+ */
+
+#ifndef LARCOREALG_GEOMETRY_DETAILS_BOXGRIDINDEX_H
+#define LARCOREALG_GEOMETRY_DETAILS_BOXGRIDINDEX_H
+
+// LArSoft libraries
+#include "larcorealg/CoreUtils/MemoryUsage.h"
+#include "larcorealg/CoreUtils/span.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::max_element(), std::sort(), std::unique()
+#include <array>
+#include <cassert>
+#include <cmath>   // std::floor()
+#include <cstddef> // std::size_t
+#include <vector>
+
+namespace geo::details {
+
+  /**
+   * @brief Uniform grid of cells listing the boxes overlapping each of them.
+   *
+   * The index is built from a list of boxes (`build()`), and it can later be
+   * queried for the boxes that may contain a point (`candidates()`).
+   * The candidates are a superset of the boxes which contain the point, also
+   * when their boundaries are expanded by a "wiggle" factor in the same way as
+   * `geo::BoxBoundedGeo::ContainsPosition()` does, as long as that factor is
+   * not larger than the one the index was built with (see `covers()`).
+   * The candidates are listed in the same order as the boxes were, so that
+   * checking them in turn gives the same answer as checking all the boxes.
+   *
+   * The boxes are required to provide the methods `MinX()`, `MaxX()`, `MinY()`,
+   * `MaxY()`, `MinZ()` and `MaxZ()`, as `geo::BoxBoundedGeo` does.
+   * The number of cells on each direction is the number of distinct lower
+   * boundaries of the boxes on that direction, which matches the layout of
+   * the usual arrays of TPCs; the total number of cells is capped to a small
+   * multiple of the number of boxes.
+   */
+  class BoxGridIndex {
+
+  public:
+    /// Type of index of a box (its position in the list used to build).
+    using BoxIndex_t = unsigned int;
+
+    /// Type of the list of candidate boxes.
+    using Candidates_t = util::span<BoxIndex_t const*>;
+
+    /// Wiggle factor the indices are built with by default.
+    static constexpr double DefaultWiggle = 1.001;
+
+    /**
+     * @brief Builds the index for the specified boxes.
+     * @tparam Boxes type of collection of boxes
+     * @param boxes the collection of boxes
+     * @param wiggle the largest wiggle factor the index will support
+     *
+     * Any index previously built is replaced.
+     */
+    template <typename Boxes>
+    void build(Boxes const& boxes, double wiggle = DefaultWiggle);
+
+    /// Removes the index.
+    void clear();
+
+    /// Returns whether the index is empty (not built, or built with no box).
+    bool empty() const { return fCellOffsets.empty(); }
+
+    /// Returns whether the index can be used with the specified wiggle factor.
+    bool covers(double wiggle) const { return !empty() && (wiggle <= fWiggle); }
+
+    /// Returns the number of cells in the grid.
+    std::size_t nCells() const { return empty() ? 0U : (fCellOffsets.size() - 1U); }
+
+    /// Returns the boxes which may contain the point `(x, y, z)`.
+    Candidates_t candidates(double x, double y, double z) const;
+
+    /// Returns the boxes which may contain `point` (with `X()`, `Y()`, `Z()`).
+    template <typename Point>
+    Candidates_t candidates(Point const& point) const
+    {
+      return candidates(point.X(), point.Y(), point.Z());
+    }
+
+    /// Returns the memory allocated by the index, besides its own size [bytes]
+    std::size_t heapMemory() const
+    {
+      return lar::util::heapMemory(fCellOffsets) + lar::util::heapMemory(fCellBoxes);
+    }
+
+  private:
+    using Coords_t = std::array<double, 3U>;
+
+    Coords_t fMin{};      ///< Lower corner of the grid.
+    Coords_t fMax{};      ///< Upper corner of the grid.
+    Coords_t fInvSize{};  ///< Inverse of the size of a cell on each direction.
+    std::array<std::size_t, 3U> fN{}; ///< Number of cells on each direction.
+
+    double fWiggle = 1.0; ///< Largest supported wiggle factor.
+
+    /// For each cell, position in `fCellBoxes` of its first box; an
+    /// additional last entry marks the end of the boxes of the last cell.
+    std::vector<std::size_t> fCellOffsets;
+    std::vector<BoxIndex_t> fCellBoxes; ///< Boxes of all the cells, by cell.
+
+    /// Returns the cell number of coordinate `c` on the `axis` direction.
+    std::size_t cellOf(std::size_t axis, double c) const
+    {
+      double const f = std::floor((c - fMin[axis]) * fInvSize[axis]);
+      if (f <= 0.0) return 0U;
+      std::size_t const cell = static_cast<std::size_t>(f);
+      return (cell < fN[axis]) ? cell : (fN[axis] - 1U);
+    }
+
+    /// Returns the flat index of the cell `(ix, iy, iz)`.
+    std::size_t cellIndex(std::size_t ix, std::size_t iy, std::size_t iz) const
+    {
+      return (ix * fN[1] + iy) * fN[2] + iz;
+    }
+
+    /// Expands the range `[min, max]` like `geo::BoxBoundedGeo` does.
+    static std::array<double, 2U> expandRange(double min, double max, double wiggle)
+    {
+      return {(min > 0 ? min / wiggle : min * wiggle), (max < 0 ? max / wiggle : max * wiggle)};
+    }
+
+  }; // class BoxGridIndex
+
+} // namespace geo::details
+
+//------------------------------------------------------------------------------
+//---  template implementation
+//------------------------------------------------------------------------------
+template <typename Boxes>
+void geo::details::BoxGridIndex::build(Boxes const& boxes, double wiggle)
+{
+  assert(wiggle >= 1.0);
+  clear();
+
+  // expanded boundaries of all the boxes
+  std::vector<std::array<Coords_t, 2U>> bounds; // { min, max } per box
+  for (auto const& box : boxes) {
+    auto const x = expandRange(box.MinX(), box.MaxX(), wiggle);
+    auto const y = expandRange(box.MinY(), box.MaxY(), wiggle);
+    auto const z = expandRange(box.MinZ(), box.MaxZ(), wiggle);
+    bounds.push_back({Coords_t{x[0], y[0], z[0]}, Coords_t{x[1], y[1], z[1]}});
+  }
+  if (bounds.empty()) return;
+
+  fWiggle = wiggle;
+
+  // grid size: as many cells as distinct lower boundaries, on each direction
+  std::vector<double> lowerEdges;
+  for (std::size_t axis = 0; axis < 3U; ++axis) {
+    lowerEdges.clear();
+    fMin[axis] = bounds.front()[0][axis];
+    fMax[axis] = bounds.front()[1][axis];
+    for (auto const& [boxMin, boxMax] : bounds) {
+      lowerEdges.push_back(boxMin[axis]);
+      fMin[axis] = std::min(fMin[axis], boxMin[axis]);
+      fMax[axis] = std::max(fMax[axis], boxMax[axis]);
+    }
+    std::sort(lowerEdges.begin(), lowerEdges.end());
+    fN[axis] = std::unique(lowerEdges.begin(), lowerEdges.end()) - lowerEdges.begin();
+  } // for axis
+
+  // irregular layouts would give too many cells: coarsen the grid
+  std::size_t const maxCells = 64U * (bounds.size() + 1U);
+  while (fN[0] * fN[1] * fN[2] > maxCells) {
+    std::size_t& n = *std::max_element(fN.begin(), fN.end());
+    n = (n + 1U) / 2U;
+  }
+
+  for (std::size_t axis = 0; axis < 3U; ++axis) {
+    double const extent = fMax[axis] - fMin[axis];
+    fInvSize[axis] = (extent > 0.0) ? (fN[axis] / extent) : 0.0;
+  }
+
+  // assign each box to all the cells it overlaps with, in box order
+  std::vector<std::vector<BoxIndex_t>> cellBoxes(fN[0] * fN[1] * fN[2]);
+  for (std::size_t iBox = 0; iBox < bounds.size(); ++iBox) {
+    auto const& [boxMin, boxMax] = bounds[iBox];
+    if ((boxMin[0] > boxMax[0]) || (boxMin[1] > boxMax[1]) || (boxMin[2] > boxMax[2])) continue;
+    std::size_t const ixEnd = cellOf(0, boxMax[0]) + 1U;
+    std::size_t const iyEnd = cellOf(1, boxMax[1]) + 1U;
+    std::size_t const izEnd = cellOf(2, boxMax[2]) + 1U;
+    for (std::size_t ix = cellOf(0, boxMin[0]); ix < ixEnd; ++ix) {
+      for (std::size_t iy = cellOf(1, boxMin[1]); iy < iyEnd; ++iy) {
+        for (std::size_t iz = cellOf(2, boxMin[2]); iz < izEnd; ++iz)
+          cellBoxes[cellIndex(ix, iy, iz)].push_back(static_cast<BoxIndex_t>(iBox));
+      } // for y
+    }   // for x
+  }     // for boxes
+
+  fCellOffsets.reserve(cellBoxes.size() + 1U);
+  for (std::vector<BoxIndex_t> const& cell : cellBoxes) {
+    fCellOffsets.push_back(fCellBoxes.size());
+    fCellBoxes.insert(fCellBoxes.end(), cell.begin(), cell.end());
+  }
+  fCellOffsets.push_back(fCellBoxes.size());
+
+} // geo::details::BoxGridIndex::build()
+
+//------------------------------------------------------------------------------
+inline void geo::details::BoxGridIndex::clear()
+{
+  fCellOffsets.clear();
+  fCellBoxes.clear();
+  fN = {};
+  fWiggle = 1.0;
+}
+
+//------------------------------------------------------------------------------
+inline auto geo::details::BoxGridIndex::candidates(double x, double y, double z) const
+  -> Candidates_t
+{
+  if (empty()) return {};
+  // written so that NaN coordinates are also rejected
+  if (!((x >= fMin[0]) && (x <= fMax[0]) && (y >= fMin[1]) && (y <= fMax[1]) &&
+        (z >= fMin[2]) && (z <= fMax[2])))
+    return {};
+  std::size_t const cell = cellIndex(cellOf(0, x), cellOf(1, y), cellOf(2, z));
+  BoxIndex_t const* const cellBoxes = fCellBoxes.data();
+  return {cellBoxes + fCellOffsets[cell], cellBoxes + fCellOffsets[cell + 1U]};
+}
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREALG_GEOMETRY_DETAILS_BOXGRIDINDEX_H
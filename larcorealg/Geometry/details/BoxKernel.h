@@ -0,0 +1,174 @@
+/**
+ * @file   larcorealg/Geometry/details/BoxKernel.h
+ * @brief  Containment and ray intersection tests of many points with a box.
+ * @date   October 14, 2026
+ *
+ * This is a header only library.
+ */
+
+#ifndef LARCOREALG_GEOMETRY_DETAILS_BOXKERNEL_H
+#define LARCOREALG_GEOMETRY_DETAILS_BOXKERNEL_H
+
+// LArSoft libraries
+#include "larcorealg/CoreUtils/SimdDispatch.h" // LARCOREALG_SIMD_CLONES
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint8_t
+#include <limits>
+
+namespace geo::details {
+
+  /**
+   * @brief A straight line with the inverse of its direction precomputed.
+   *
+   * The points of the line are `start + t * dir` for any real `t`.
+   * The inverse of each direction component is stored for the slab method of
+   * `BoxKernel::intersect()`; a zero component has an infinite inverse.
+   */
+  struct BoxRay {
+
+    double start[3];  ///< Starting point of the line.
+    double dir[3];    ///< Direction of the line (not necessarily unit).
+    double invDir[3]; ///< Inverse of each direction component.
+
+    /// Returns a line from the `start` point and `dir` direction coordinates.
+    static BoxRay make(double const* start, double const* dir)
+    {
+      BoxRay ray;
+      for (std::size_t i = 0; i < 3; ++i) {
+        ray.start[i] = start[i];
+        ray.dir[i] = dir[i];
+        ray.invDir[i] = 1.0 / dir[i];
+      }
+      return ray;
+    }
+
+  }; // BoxRay
+
+  /**
+   * @brief Tests of points and lines against a box aligned with the axes.
+   *
+   * This object holds the boundaries of the box, possibly already expanded by
+   * the "wiggle" factor of `geo::BoxBoundedGeo::ContainsPosition()`, and
+   * processes arrays of points in loops the compiler can vectorize: the
+   * result for each point is computed without branches. The loop on arrays is
+   * compiled for each vector instruction set (`LARCOREALG_SIMD_CLONES`).
+   * All boundaries are included in the box.
+   */
+  struct BoxKernel {
+
+    double lower[3]; ///< Lower corner of the box.
+    double upper[3]; ///< Upper corner of the box.
+
+    /**
+     * @brief Returns the kernel of a box expanded by a factor.
+     * @param lower lower corner of the box
+     * @param upper upper corner of the box
+     * @param wiggle expansion factor
+     *
+     * The boundaries are expanded as in
+     * `geo::BoxBoundedGeo::CoordinateContained()`.
+     */
+    static BoxKernel wiggled(double const* lower, double const* upper, double wiggle = 1.0)
+    {
+      BoxKernel kernel;
+      for (std::size_t i = 0; i < 3; ++i) {
+        kernel.lower[i] = (lower[i] > 0) ? lower[i] / wiggle : lower[i] * wiggle;
+        kernel.upper[i] = (upper[i] < 0) ? upper[i] / wiggle : upper[i] * wiggle;
+      }
+      return kernel;
+    }
+
+    /// Returns whether the point (`x`, `y`, `z`) is in the box.
+    bool contains(double x, double y, double z) const
+    {
+      return (x >= lower[0]) & (x <= upper[0]) & (y >= lower[1]) & (y <= upper[1]) &
+             (z >= lower[2]) & (z <= upper[2]);
+    }
+
+    /**
+     * @brief Tests whether each of `n` points is in the box.
+     * @param n number of points
+     * @param x array of the _x_ coordinates of the points
+     * @param y array of the _y_ coordinates of the points
+     * @param z array of the _z_ coordinates of the points
+     * @param[out] mask array for the results: `1` if contained, `0` otherwise
+     */
+    LARCOREALG_SIMD_CLONES
+    void containsPositions(std::size_t n,
+                           double const* __restrict__ x,
+                           double const* __restrict__ y,
+                           double const* __restrict__ z,
+                           std::uint8_t* __restrict__ mask) const
+    {
+      BoxKernel const box = *this; // local copy, no aliasing with the output
+      for (std::size_t i = 0; i < n; ++i)
+        mask[i] = box.contains(x[i], y[i], z[i]);
+    }
+
+    /// Tests whether each of the points in [`begin`, `end`[ is in the box.
+    template <typename PointIter>
+    void containsPositions(PointIter begin, PointIter end, std::uint8_t* __restrict__ mask) const
+    {
+      BoxKernel const box = *this;
+      for (; begin != end; ++begin)
+        *mask++ = box.contains(begin->X(), begin->Y(), begin->Z());
+    }
+
+    /**
+     * @brief Finds where a line crosses the box (slab method).
+     * @param ray the line
+     * @param[out] tEnter line parameter of the entry point
+     * @param[out] tExit line parameter of the exit point
+     * @return whether the line crosses the box
+     *
+     * The line parameters refer to `ray.start + t * ray.dir`, and they may be
+     * negative. The line misses the box when `tEnter` is larger than `tExit`.
+     * A line parallel to a face and lying exactly on its plane may be reported
+     * either way.
+     */
+    bool intersect(BoxRay const& ray, double& tEnter, double& tExit) const
+    {
+      double enter = -std::numeric_limits<double>::infinity();
+      double exit = std::numeric_limits<double>::infinity();
+      for (std::size_t i = 0; i < 3; ++i) {
+        double const t1 = (lower[i] - ray.start[i]) * ray.invDir[i];
+        double const t2 = (upper[i] - ray.start[i]) * ray.invDir[i];
+        double const tNear = (t1 < t2) ? t1 : t2;
+        double const tFar = (t1 < t2) ? t2 : t1;
+        enter = (tNear > enter) ? tNear : enter;
+        exit = (tFar < exit) ? tFar : exit;
+      }
+      tEnter = enter;
+      tExit = exit;
+      return enter <= exit;
+    }
+
+    /**
+     * @brief Finds where each of the lines in [`begin`, `end`[ crosses the box.
+     * @param begin iterator to the first `BoxRay`
+     * @param end iterator past the last `BoxRay`
+     * @param[out] tEnter array for the line parameters of the entry points
+     * @param[out] tExit array for the line parameters of the exit points
+     * @return the number of lines crossing the box
+     * @see `intersect()`
+     */
+    template <typename RayIter>
+    std::size_t intersectRays(RayIter begin,
+                              RayIter end,
+                              double* __restrict__ tEnter,
+                              double* __restrict__ tExit) const
+    {
+      BoxKernel const box = *this;
+      std::size_t nHits = 0;
+      for (; begin != end; ++begin)
+        nHits += box.intersect(*begin, *tEnter++, *tExit++);
+      return nHits;
+    }
+
+  }; // struct BoxKernel
+
+} // namespace geo::details
+
+#endif // LARCOREALG_GEOMETRY_DETAILS_BOXKERNEL_H
@@ -0,0 +1,151 @@
+/**
+ * @file   larcorealg/Geometry/details/ChannelToWireMap.h
+ * @brief  Reverse lookup table from TPC readout channel to wire plane.
+ * @date   October 14, 2026
+ *
+ * This is a header only library.
+ */
+
+#ifndef LARCOREALG_GEOMETRY_DETAILS_CHANNELTOWIREMAP_H
+#define LARCOREALG_GEOMETRY_DETAILS_CHANNELTOWIREMAP_H
+
+// LArSoft libraries
+#include "larcorealg/CoreUtils/MemoryUsage.h"
+#include "larcoreobj/SimpleTypesAndConstants/RawTypes.h" // raw::ChannelID_t
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::upper_bound()
+#include <cassert>
+#include <cstddef>  // std::size_t
+#include <iterator> // std::prev()
+#include <vector>
+
+namespace geo::details {
+
+  /**
+   * @brief Mapping of contiguous ranges of channels into wire planes.
+   *
+   * This object stores, for each wire plane, the range of channels assigned
+   * to its wires, under the assumption that the wires of a plane are read out
+   * by consecutive channels, the first wire by the first channel.
+   * The ranges must be registered (`addPlane()`) in order of increasing
+   * channel number, and they must not overlap; gaps between them are allowed.
+   *
+   * The lookup of a channel is a binary search in a compact array with one
+   * entry per plane, which is small enough to stay in cache even in detectors
+   * with hundreds of TPCs.
+   *
+   * Example of usage:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   * geo::details::ChannelToWireMap map;
+   * map.addPlane(geo::PlaneID{ 0, 0, 0 },   0U, 100U); // channels [   0, 100 [
+   * map.addPlane(geo::PlaneID{ 0, 0, 1 }, 100U, 120U); // channels [ 100, 220 [
+   *
+   * geo::WireID const wireID = map.wireOf(150U); // C:0 T:0 P:1 W:50
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   */
+  class ChannelToWireMap {
+
+  public:
+    /// Information about the channels of a single wire plane.
+    struct ChannelsInPlane_t {
+      geo::PlaneID planeID;          ///< ID of the wire plane.
+      raw::ChannelID_t firstChannel; ///< ID of the channel of the first wire.
+      raw::ChannelID_t endChannel;   ///< ID of the channel after the last one.
+
+      /// Returns the number of channels in the plane.
+      unsigned int nChannels() const { return endChannel - firstChannel; }
+
+      /// Returns whether `channel` belongs to this plane.
+      bool contains(raw::ChannelID_t channel) const
+      {
+        return (channel >= firstChannel) && (channel < endChannel);
+      }
+
+      /// Returns the ID of the wire read by the specified `channel`.
+      /// @note The channel is assumed to belong to this plane.
+      geo::WireID wireOf(raw::ChannelID_t channel) const
+      {
+        return {planeID, static_cast<geo::WireID::WireID_t>(channel - firstChannel)};
+      }
+    }; // ChannelsInPlane_t
+
+    /**
+     * @brief Registers a new plane.
+     * @param planeID ID of the plane being registered
+     * @param firstChannel ID of the channel reading the first wire of the plane
+     * @param nChannels number of channels (and wires) in the plane
+     *
+     * The `firstChannel` must not be smaller than the end of the range of the
+     * previously registered plane.
+     */
+    void addPlane(geo::PlaneID const& planeID,
+                  raw::ChannelID_t firstChannel,
+                  unsigned int nChannels)
+    {
+      assert(fPlanes.empty() || (firstChannel >= fPlanes.back().endChannel));
+      fFirstChannels.push_back(firstChannel);
+      fPlanes.push_back({planeID, firstChannel, firstChannel + nChannels});
+    }
+
+    /// Removes all the registered planes.
+    void clear()
+    {
+      fFirstChannels.clear();
+      fPlanes.clear();
+    }
+
+    /// Returns whether no plane is registered.
+    bool empty() const { return fPlanes.empty(); }
+
+    /// Returns the number of registered planes.
+    std::size_t size() const { return fPlanes.size(); }
+
+    /// Returns the information of all the planes, sorted by channel.
+    std::vector<ChannelsInPlane_t> const& planes() const { return fPlanes; }
+
+    /// Returns the ID of the first channel after the last registered plane.
+    raw::ChannelID_t endChannel() const
+    {
+      return fPlanes.empty() ? raw::ChannelID_t{0} : fPlanes.back().endChannel;
+    }
+
+    /**
+     * @brief Returns the information of the plane `channel` belongs to.
+     * @param channel ID of the channel to be looked up
+     * @return a pointer to the plane information, `nullptr` if not found
+     */
+    ChannelsInPlane_t const* find(raw::ChannelID_t channel) const
+    {
+      auto const itNext = std::upper_bound(fFirstChannels.begin(), fFirstChannels.end(), channel);
+      if (itNext == fFirstChannels.begin()) return nullptr;
+      ChannelsInPlane_t const& plane =
+        fPlanes[std::distance(fFirstChannels.begin(), std::prev(itNext))];
+      return plane.contains(channel) ? &plane : nullptr;
+    }
+
+    /// Returns the ID of the wire read by `channel` (invalid if none).
+    geo::WireID wireOf(raw::ChannelID_t channel) const
+    {
+      ChannelsInPlane_t const* plane = find(channel);
+      return plane ? plane->wireOf(channel) : geo::WireID{};
+    }
+
+    /// Returns the memory allocated by the map, besides its own size [bytes]
+    std::size_t heapMemory() const
+    {
+      return lar::util::heapMemory(fFirstChannels) + lar::util::heapMemory(fPlanes);
+    }
+
+  private:
+    /// First channel of each plane, sorted; it parallels `fPlanes`.
+    std::vector<raw::ChannelID_t> fFirstChannels;
+
+    std::vector<ChannelsInPlane_t> fPlanes; ///< Information of each plane.
+
+  }; // class ChannelToWireMap
+
+} // namespace geo::details
+
+#endif // LARCOREALG_GEOMETRY_DETAILS_CHANNELTOWIREMAP_H
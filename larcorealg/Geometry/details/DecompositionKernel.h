@@ -0,0 +1,146 @@
+/**
+ * @file   larcorealg/Geometry/details/DecompositionKernel.h
+ * @brief  Decomposition and composition of many points at once.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/Decomposer.h`
+ *
+ * This is a header only library.
+ */
+
+#ifndef LARCOREALG_GEOMETRY_DETAILS_DECOMPOSITIONKERNEL_H
+#define LARCOREALG_GEOMETRY_DETAILS_DECOMPOSITIONKERNEL_H
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+
+namespace geo::details {
+
+  /**
+   * @brief Components of a point on the axes of a decomposition base.
+   *
+   * This object has the origin and the three axes (main, secondary and normal)
+   * of a `geo::Decomposer` as plain numbers, and processes arrays of points in
+   * loops which the compiler can vectorize. The results are the same as the
+   * ones of the single point methods of `geo::Decomposer`.
+   *
+   * The components are always written as arrays, one per axis ("structure of
+   * arrays"); the points can be given as arrays of coordinates or as a
+   * sequence of point objects with `X()`, `Y()` and `Z()` accessors.
+   * The array of normal components can be `nullptr`, in which case only the
+   * projection on the plane is computed (or composed back).
+   * Input and output arrays must not overlap.
+   *
+   * To transform vectors rather than points, the origin must be null.
+   */
+  struct DecompositionKernel {
+
+    double origin[3] = {0.0, 0.0, 0.0};    ///< Reference point.
+    double main[3] = {1.0, 0.0, 0.0};      ///< Main direction.
+    double secondary[3] = {0.0, 1.0, 0.0}; ///< Secondary direction.
+    double normal[3] = {0.0, 0.0, 1.0};    ///< Normal direction.
+
+    /// Computes the components of `n` points given by their coordinate arrays.
+    void decompose(std::size_t n,
+                   double const* __restrict__ x,
+                   double const* __restrict__ y,
+                   double const* __restrict__ z,
+                   double* __restrict__ m,
+                   double* __restrict__ s,
+                   double* __restrict__ d) const;
+
+    /// Computes the components of the points in [`begin`, `end`[.
+    template <typename PointIter>
+    void decompose(PointIter begin,
+                   PointIter end,
+                   double* __restrict__ m,
+                   double* __restrict__ s,
+                   double* __restrict__ d) const;
+
+    /// Fills the coordinate arrays with the `n` points with the components.
+    void compose(std::size_t n,
+                 double const* __restrict__ m,
+                 double const* __restrict__ s,
+                 double const* __restrict__ d,
+                 double* __restrict__ x,
+                 double* __restrict__ y,
+                 double* __restrict__ z) const;
+
+  }; // struct DecompositionKernel
+
+} // namespace geo::details
+
+//------------------------------------------------------------------------------
+//--- inline implementation
+//------------------------------------------------------------------------------
+inline void geo::details::DecompositionKernel::decompose(std::size_t n,
+                                                         double const* __restrict__ x,
+                                                         double const* __restrict__ y,
+                                                         double const* __restrict__ z,
+                                                         double* __restrict__ m,
+                                                         double* __restrict__ s,
+                                                         double* __restrict__ d) const
+{
+  double const o0 = origin[0], o1 = origin[1], o2 = origin[2];
+  double const m0 = main[0], m1 = main[1], m2 = main[2];
+  double const s0 = secondary[0], s1 = secondary[1], s2 = secondary[2];
+  for (std::size_t i = 0; i < n; ++i) {
+    double const dx = x[i] - o0, dy = y[i] - o1, dz = z[i] - o2;
+    m[i] = dx * m0 + dy * m1 + dz * m2;
+    s[i] = dx * s0 + dy * s1 + dz * s2;
+  }
+  if (!d) return;
+  double const n0 = normal[0], n1 = normal[1], n2 = normal[2];
+  for (std::size_t i = 0; i < n; ++i)
+    d[i] = (x[i] - o0) * n0 + (y[i] - o1) * n1 + (z[i] - o2) * n2;
+} // geo::details::DecompositionKernel::decompose()
+
+//------------------------------------------------------------------------------
+template <typename PointIter>
+void geo::details::DecompositionKernel::decompose(PointIter begin,
+                                                  PointIter end,
+                                                  double* __restrict__ m,
+                                                  double* __restrict__ s,
+                                                  double* __restrict__ d) const
+{
+  for (std::size_t i = 0; begin != end; ++begin, ++i) {
+    double const dx = begin->X() - origin[0];
+    double const dy = begin->Y() - origin[1];
+    double const dz = begin->Z() - origin[2];
+    m[i] = dx * main[0] + dy * main[1] + dz * main[2];
+    s[i] = dx * secondary[0] + dy * secondary[1] + dz * secondary[2];
+    if (d) d[i] = dx * normal[0] + dy * normal[1] + dz * normal[2];
+  }
+} // geo::details::DecompositionKernel::decompose(PointIter)
+
+//------------------------------------------------------------------------------
+inline void geo::details::DecompositionKernel::compose(std::size_t n,
+                                                       double const* __restrict__ m,
+                                                       double const* __restrict__ s,
+                                                       double const* __restrict__ d,
+                                                       double* __restrict__ x,
+                                                       double* __restrict__ y,
+                                                       double* __restrict__ z) const
+{
+  double const o0 = origin[0], o1 = origin[1], o2 = origin[2];
+  double const m0 = main[0], m1 = main[1], m2 = main[2];
+  double const s0 = secondary[0], s1 = secondary[1], s2 = secondary[2];
+  if (d) {
+    double const n0 = normal[0], n1 = normal[1], n2 = normal[2];
+    for (std::size_t i = 0; i < n; ++i) {
+      x[i] = o0 + (m[i] * m0 + s[i] * s0 + d[i] * n0);
+      y[i] = o1 + (m[i] * m1 + s[i] * s1 + d[i] * n1);
+      z[i] = o2 + (m[i] * m2 + s[i] * s2 + d[i] * n2);
+    }
+  }
+  else {
+    for (std::size_t i = 0; i < n; ++i) {
+      x[i] = o0 + (m[i] * m0 + s[i] * s0);
+      y[i] = o1 + (m[i] * m1 + s[i] * s1);
+      z[i] = o2 + (m[i] * m2 + s[i] * s2);
+    }
+  }
+} // geo::details::DecompositionKernel::compose()
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREALG_GEOMETRY_DETAILS_DECOMPOSITIONKERNEL_H
@@ -0,0 +1,76 @@
+/**
+ * @file   larcorealg/Geometry/details/FingerprintHasher.h
+ * @brief  Hash of the content of a geometry description.
+ * @date   October 14, 2026
+ * @see    `geo::GeometryCore::Fingerprint()`
+ *
+ * This is a header only library.
+ */
+
+#ifndef LARCOREALG_GEOMETRY_DETAILS_FINGERPRINTHASHER_H
+#define LARCOREALG_GEOMETRY_DETAILS_FINGERPRINTHASHER_H
+
+// LArSoft libraries
+#include "larcorealg/Geometry/BoxBoundedGeo.h"
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint64_t
+#include <cstring> // std::memcpy()
+#include <string>
+
+namespace geo::details {
+
+  /// Accumulates a 64-bit FNV-1a hash of values (see `GeometryCore::Fingerprint()`).
+  class FingerprintHasher {
+  public:
+    std::uint64_t value() const { return fHash; }
+
+    void add(void const* data, std::size_t size)
+    {
+      auto const* bytes = static_cast<unsigned char const*>(data);
+      for (std::size_t i = 0; i < size; ++i) {
+        fHash ^= bytes[i];
+        fHash *= 0x100000001b3ULL; // FNV prime
+      }
+    }
+
+    void add(std::uint64_t value) { add(&value, sizeof(value)); }
+
+    /// Adds a floating point number; all zeroes hash the same
+    void add(double value)
+    {
+      if (value == 0.0) value = 0.0;
+      std::uint64_t bits;
+      static_assert(sizeof(bits) == sizeof(value));
+      std::memcpy(&bits, &value, sizeof(bits));
+      add(bits);
+    }
+
+    void add(std::string const& s)
+    {
+      add(std::uint64_t{s.size()});
+      add(s.data(), s.size());
+    }
+
+    template <typename Vect>
+    void addVector(Vect const& v)
+    {
+      add(double(v.X()));
+      add(double(v.Y()));
+      add(double(v.Z()));
+    }
+
+    void add(geo::BoxBoundedGeo const& box)
+    {
+      addVector(box.Min());
+      addVector(box.Max());
+    }
+
+  private:
+    std::uint64_t fHash = 0xcbf29ce484222325ULL; // FNV offset basis
+  }; // FingerprintHasher
+
+} // namespace geo::details
+
+#endif // LARCOREALG_GEOMETRY_DETAILS_FINGERPRINTHASHER_H
@@ -0,0 +1,21 @@
+/**
+ * @file   larcorealg/Geometry/details/HostDevice.h
+ * @brief  Marker of the functions usable also in device code.
+ * @date   October 14, 2026
+ *
+ * This is a header only library.
+ */
+
+#ifndef LARCOREALG_GEOMETRY_DETAILS_HOSTDEVICE_H
+#define LARCOREALG_GEOMETRY_DETAILS_HOSTDEVICE_H
+
+// marks the functions usable also in CUDA and HIP device code
+#ifndef LARCOREALG_HOST_DEVICE
+#if defined(__CUDACC__) || defined(__HIPCC__)
+#define LARCOREALG_HOST_DEVICE __host__ __device__
+#else
+#define LARCOREALG_HOST_DEVICE
+#endif
+#endif // LARCOREALG_HOST_DEVICE
+
+#endif // LARCOREALG_GEOMETRY_DETAILS_HOSTDEVICE_H
@@ -0,0 +1,112 @@
+/**
+ * @file   larcorealg/Geometry/details/LRUCache.h
+ * @brief  Small thread-safe cache keeping the most recently used values.
+ * @date   October 14, 2026
+ *
+ * This is a header only library.
+ */
+
+#ifndef LARCOREALG_GEOMETRY_DETAILS_LRUCACHE_H
+#define LARCOREALG_GEOMETRY_DETAILS_LRUCACHE_H
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <list>
+#include <mutex>
+#include <utility> // std::pair
+
+namespace geo::details {
+
+  /**
+   * @brief Cache of the values of the most recently used keys.
+   * @tparam Key type of the key (comparable with `==`)
+   * @tparam Value type of the cached value (copyable)
+   *
+   * The cache is meant for a handful of entries, which are searched linearly.
+   * When a value not in the cache is requested, it is computed and added;
+   * if the cache is full, the least recently used entry is dropped.
+   * All the methods can be called concurrently.
+   */
+  template <typename Key, typename Value>
+  class LRUCache {
+  public:
+    /// Default number of entries kept.
+    static constexpr std::size_t DefaultCapacity = 8U;
+
+    /// Constructor: keeps up to `capacity` entries (at least one).
+    explicit LRUCache(std::size_t capacity = DefaultCapacity)
+      : fCapacity{(capacity > 0U) ? capacity : 1U}
+    {}
+
+    // the mutex is not copied: only the content is
+    LRUCache(LRUCache const& other) : fCapacity{other.fCapacity}, fEntries{other.entries()} {}
+    LRUCache& operator=(LRUCache const& other)
+    {
+      if (this == &other) return *this;
+      auto entries = other.entries();
+      std::lock_guard<std::mutex> const lock{fMutex};
+      fCapacity = other.fCapacity;
+      fEntries = std::move(entries);
+      return *this;
+    }
+
+    /**
+     * @brief Returns the value of `key`, computing it if not cached.
+     * @param key the key of the value
+     * @param compute callable returning the value of `key`
+     * @return a copy of the value of `key`
+     *
+     * `compute()` is called with the cache locked; if it throws, the exception
+     * is propagated and nothing is cached.
+     */
+    template <typename Compute>
+    Value get(Key const& key, Compute&& compute)
+    {
+      std::lock_guard<std::mutex> const lock{fMutex};
+      for (auto it = fEntries.begin(); it != fEntries.end(); ++it) {
+        if (!(it->first == key)) continue;
+        fEntries.splice(fEntries.begin(), fEntries, it); // now most recent
+        return fEntries.front().second;
+      }
+      Value value = compute();
+      if (fEntries.size() >= fCapacity) fEntries.pop_back();
+      fEntries.emplace_front(key, value);
+      return value;
+    }
+
+    /// Returns the number of cached entries.
+    std::size_t size() const
+    {
+      std::lock_guard<std::mutex> const lock{fMutex};
+      return fEntries.size();
+    }
+
+    /// Returns the largest number of entries kept.
+    std::size_t capacity() const { return fCapacity; }
+
+    /// Removes all the entries.
+    void clear()
+    {
+      std::lock_guard<std::mutex> const lock{fMutex};
+      fEntries.clear();
+    }
+
+  private:
+    using Entries_t = std::list<std::pair<Key, Value>>; ///< Most recent first.
+
+    mutable std::mutex fMutex; ///< Protects the entries.
+    std::size_t fCapacity;     ///< Largest number of entries.
+    Entries_t fEntries;        ///< The cached entries.
+
+    /// Returns a copy of the entries.
+    Entries_t entries() const
+    {
+      std::lock_guard<std::mutex> const lock{fMutex};
+      return fEntries;
+    }
+
+  }; // class LRUCache
+
+} // namespace geo::details
+
+#endif // LARCOREALG_GEOMETRY_DETAILS_LRUCACHE_H
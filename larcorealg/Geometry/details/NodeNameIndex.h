@@ -0,0 +1,193 @@
+/**
+ * @file   larcorealg/Geometry/details/NodeNameIndex.h
+ * @brief  Index of the nodes of a geometry tree by the name of their volume.
+ * @date   October 14, 2026
+ *
+ * This is a header only library.
+ */
+
+#ifndef LARCOREALG_GEOMETRY_DETAILS_NODENAMEINDEX_H
+#define LARCOREALG_GEOMETRY_DETAILS_NODENAMEINDEX_H
+
+// LArSoft libraries
+#include "larcorealg/CoreUtils/MemoryUsage.h"    // lar::util::heapMemory()
+#include "larcorealg/CoreUtils/MonotonicArena.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::sort(), std::reverse()
+#include <cstddef>   // std::size_t
+#include <cstdint>   // std::uint32_t
+#include <memory_resource>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace geo::details {
+
+  /**
+   * @brief Index of all the nodes of a tree by the name of their volume.
+   * @tparam Node type of the node (like `TGeoNode`)
+   *
+   * The index is built with a single walk through the tree from its top node,
+   * after which the nodes of a volume name (and their paths from the top
+   * node) are found with a hash lookup. Each volume name is stored once.
+   * The names and the lists of nodes of each name live in an arena owned by
+   * the index, which is released all together when the index is rebuilt.
+   *
+   * `Node` must provide `GetNdaughters()`, `GetDaughter(i)` returning a
+   * pointer to the `i`-th daughter node and `GetVolume()->GetName()`.
+   *
+   * The nodes are returned in the order they are visited by
+   * `geo::ROOTGeoNodeForwardIterator`, i.e. each node after all its
+   * descendants, and the daughters in their order.
+   */
+  template <typename Node>
+  class NodeNameIndex {
+  public:
+    using Node_t = Node;
+    using Path_t = std::vector<Node_t const*>; ///< Path from the top node.
+
+    /// Replaces the content of the index with the tree under `top`.
+    void build(Node_t const* top);
+
+    NodeNameIndex() = default;
+    NodeNameIndex(NodeNameIndex const&) = delete;
+    NodeNameIndex& operator=(NodeNameIndex const&) = delete;
+
+    /// Removes all the nodes.
+    void clear()
+    {
+      fRecords.clear();
+      NameMap_t{&fArena}.swap(fByName); // all the memory of the arena is now free
+      fArena.reset();
+    }
+
+    /// Returns the number of indexed nodes.
+    std::size_t size() const { return fRecords.size(); }
+
+    /// Returns the number of distinct volume names.
+    std::size_t nNames() const { return fByName.size(); }
+
+    /// Returns all the nodes whose volume has one of the `names`.
+    template <typename Names>
+    std::vector<Node_t const*> nodes(Names const& names) const;
+
+    /// Returns the paths to all the nodes whose volume has one of the `names`.
+    template <typename Names>
+    std::vector<Path_t> paths(Names const& names) const;
+
+    /// Returns the memory allocated by the index, besides its own size [bytes].
+    std::size_t heapMemory() const;
+
+  private:
+    static constexpr std::uint32_t NoParent = ~std::uint32_t{0};
+
+    /// A node of the tree; records are in the order of entrance in the node.
+    struct Record_t {
+      Node_t const* node;   ///< The node.
+      std::uint32_t parent; ///< Index of the record of the mother node.
+      std::uint32_t order;  ///< Position in the forward iteration order.
+    };
+
+    /// Indices of the records of each volume name (all in `fArena`).
+    using NameMap_t = std::pmr::unordered_map<std::string_view, std::pmr::vector<std::uint32_t>>;
+
+    std::vector<Record_t> fRecords; ///< All the nodes.
+
+    lar::util::MonotonicArena fArena; ///< Memory of the names and of `fByName`.
+
+    NameMap_t fByName{&fArena}; ///< Index of the records of each volume name.
+
+    /// Adds `node` and all its descendants; returns the next `order`.
+    std::uint32_t addNode(Node_t const* node, std::uint32_t parent, std::uint32_t order);
+
+    /// Returns the indices of the records with one of `names`, in iteration order.
+    template <typename Names>
+    std::vector<std::uint32_t> matches(Names const& names) const;
+
+  }; // class NodeNameIndex
+
+} // namespace geo::details
+
+//------------------------------------------------------------------------------
+//--- template implementation
+//------------------------------------------------------------------------------
+template <typename Node>
+void geo::details::NodeNameIndex<Node>::build(Node_t const* top)
+{
+  clear();
+  if (top) addNode(top, NoParent, 0U);
+} // geo::details::NodeNameIndex<>::build()
+
+//------------------------------------------------------------------------------
+template <typename Node>
+std::uint32_t geo::details::NodeNameIndex<Node>::addNode(Node_t const* node,
+                                                         std::uint32_t parent,
+                                                         std::uint32_t order)
+{
+  auto const self = static_cast<std::uint32_t>(fRecords.size());
+  fRecords.push_back({node, parent, 0U});
+  std::string_view const name = node->GetVolume()->GetName();
+  auto iName = fByName.find(name);
+  if (iName == fByName.end()) iName = fByName.try_emplace(fArena.storeString(name)).first;
+  iName->second.push_back(self);
+  auto const nDaughters = node->GetNdaughters();
+  for (decltype(node->GetNdaughters()) i = 0; i < nDaughters; ++i)
+    order = addNode(node->GetDaughter(i), self, order);
+  fRecords[self].order = order; // after all the descendants
+  return order + 1U;
+} // geo::details::NodeNameIndex<>::addNode()
+
+//------------------------------------------------------------------------------
+template <typename Node>
+template <typename Names>
+std::vector<std::uint32_t> geo::details::NodeNameIndex<Node>::matches(Names const& names) const
+{
+  std::vector<std::uint32_t> indices;
+  for (auto const& name : names) {
+    auto const it = fByName.find(name);
+    if (it != fByName.end()) indices.insert(indices.end(), it->second.begin(), it->second.end());
+  }
+  std::sort(indices.begin(), indices.end(), [this](std::uint32_t a, std::uint32_t b) {
+    return fRecords[a].order < fRecords[b].order;
+  });
+  return indices;
+} // geo::details::NodeNameIndex<>::matches()
+
+//------------------------------------------------------------------------------
+template <typename Node>
+template <typename Names>
+auto geo::details::NodeNameIndex<Node>::nodes(Names const& names) const
+  -> std::vector<Node_t const*>
+{
+  std::vector<Node_t const*> result;
+  for (std::uint32_t const index : matches(names))
+    result.push_back(fRecords[index].node);
+  return result;
+} // geo::details::NodeNameIndex<>::nodes()
+
+//------------------------------------------------------------------------------
+template <typename Node>
+template <typename Names>
+auto geo::details::NodeNameIndex<Node>::paths(Names const& names) const -> std::vector<Path_t>
+{
+  std::vector<Path_t> result;
+  for (std::uint32_t index : matches(names)) {
+    Path_t& path = result.emplace_back();
+    for (; index != NoParent; index = fRecords[index].parent)
+      path.push_back(fRecords[index].node);
+    std::reverse(path.begin(), path.end());
+  }
+  return result;
+} // geo::details::NodeNameIndex<>::paths()
+
+//------------------------------------------------------------------------------
+template <typename Node>
+std::size_t geo::details::NodeNameIndex<Node>::heapMemory() const
+{
+  return lar::util::heapMemory(fRecords) + lar::util::heapMemory(fArena);
+} // geo::details::NodeNameIndex<>::heapMemory()
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREALG_GEOMETRY_DETAILS_NODENAMEINDEX_H
@@ -0,0 +1,65 @@
+/**
+ * @file   larcorealg/Geometry/details/OnceFlag.h
+ * @brief  Copyable guard for data computed on first use.
+ * @date   October 14, 2026
+ *
+ * This is a header only library.
+ */
+
+#ifndef LARCOREALG_GEOMETRY_DETAILS_ONCEFLAG_H
+#define LARCOREALG_GEOMETRY_DETAILS_ONCEFLAG_H
+
+// C/C++ standard libraries
+#include <atomic>
+#include <mutex>
+
+namespace geo::details {
+
+  /**
+   * @brief Flag guarding the one-time initialization of cached data.
+   *
+   * Similar to `std::once_flag`, but it can be copied (and moved) together
+   * with the data it guards, so that it can be a member of the geometry
+   * objects: the copy carries over whether the data was initialized.
+   *
+   * `callOnce()` can be called concurrently: only the first call runs the
+   * initialization, the others wait for it to complete. If the initialization
+   * throws, the flag stays unset and the next call tries again.
+   */
+  class OnceFlag {
+
+  public:
+    OnceFlag() = default;
+    OnceFlag(OnceFlag const& other) : fDone{other.done()} {}
+    OnceFlag& operator=(OnceFlag const& other)
+    {
+      fDone.store(other.done(), std::memory_order_release);
+      return *this;
+    }
+
+    /// Returns whether the initialization has been completed.
+    bool done() const { return fDone.load(std::memory_order_acquire); }
+
+    /// Runs `init()` unless the flag is already set, then sets the flag.
+    template <typename Init>
+    void callOnce(Init&& init)
+    {
+      if (done()) return;
+      std::lock_guard<std::mutex> const lock{fMutex};
+      if (done()) return;
+      init();
+      fDone.store(true, std::memory_order_release);
+    }
+
+    /// Unsets the flag (not thread-safe).
+    void reset() { fDone.store(false, std::memory_order_release); }
+
+  private:
+    std::mutex fMutex;
+    std::atomic<bool> fDone{false};
+
+  }; // class OnceFlag
+
+} // namespace geo::details
+
+#endif // LARCOREALG_GEOMETRY_DETAILS_ONCEFLAG_H
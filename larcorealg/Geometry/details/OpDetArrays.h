@@ -0,0 +1,286 @@
+/**
+ * @file   larcorealg/Geometry/details/OpDetArrays.h
+ * @brief  Optical detector positions and shapes as contiguous arrays.
+ * @date   October 14, 2026
+ * @see    `geo::CryostatGeo::OpDetArrays()`
+ *
+ * This is a header only library.
+ */
+
+#ifndef LARCOREALG_GEOMETRY_DETAILS_OPDETARRAYS_H
+#define LARCOREALG_GEOMETRY_DETAILS_OPDETARRAYS_H
+
+// LArSoft libraries
+#include "larcorealg/CoreUtils/MemoryUsage.h"
+#include "larcorealg/Geometry/details/WireArrays.h" // geo::details::AlignedAllocator
+
+// C/C++ standard libraries
+#include <cmath>   // std::sqrt()
+#include <cstddef> // std::size_t
+#include <vector>
+
+namespace geo::details {
+
+  /**
+   * @brief Centers, normals and sizes of all the optical detectors of a cryostat.
+   *
+   * Each quantity is stored in its own array (a "structure of arrays"), with
+   * the detectors in the same order as in the cryostat, so that the batch
+   * versions of `geo::OpDetGeo::DistanceToPoint()` and
+   * `geo::OpDetGeo::CosThetaFromNormal()` provided here can be vectorized by
+   * the compiler. The batches run either over all the detectors for a single
+   * point, or over many points for a single detector.
+   *
+   * The normal of a detector is the _z_ axis of its local frame, expressed in
+   * world coordinates; it is expected to be a unit vector. The distance of a
+   * point from a detector is measured from its center.
+   *
+   * The sizes are the ones of `geo::OpDetGeo::HalfW()`, `HalfH()`, `HalfL()`
+   * and `RMax()`, the last one being `0` for shapes with no radius.
+   */
+  class OpDetArrays {
+
+  public:
+    /// Alignment of the start of each array, in bytes.
+    static constexpr std::size_t Alignment = 64U;
+
+    /// Type of the array of each quantity.
+    using Array_t = std::vector<double, AlignedAllocator<double, Alignment>>;
+
+    /// Sizes of a detector.
+    struct Sizes_t {
+      double halfW = 0.0; ///< Half width (_x_ of the local frame).
+      double halfH = 0.0; ///< Half height (_y_ of the local frame).
+      double halfL = 0.0; ///< Half length (_z_ of the local frame).
+      double rMax = 0.0;  ///< Outer radius.
+    };
+
+    /// Number of optical detectors.
+    std::size_t size() const { return fCenterX.size(); }
+
+    /// Returns whether there are no optical detectors.
+    bool empty() const { return fCenterX.empty(); }
+
+    /// Removes all the optical detectors.
+    void clear();
+
+    /// Prepares room for `n` optical detectors.
+    void reserve(std::size_t n);
+
+    /// Adds an optical detector at the end of the list.
+    template <typename Point, typename Vector>
+    void push_back(Point const& center, Vector const& normal, Sizes_t const& sizes);
+
+    // @{
+    /// Arrays of coordinates of the centers of the detectors.
+    double const* centerX() const { return fCenterX.data(); }
+    double const* centerY() const { return fCenterY.data(); }
+    double const* centerZ() const { return fCenterZ.data(); }
+    // @}
+
+    // @{
+    /// Arrays of components of the normals of the detectors.
+    double const* normalX() const { return fNormalX.data(); }
+    double const* normalY() const { return fNormalY.data(); }
+    double const* normalZ() const { return fNormalZ.data(); }
+    // @}
+
+    // @{
+    /// Arrays of the sizes of the detectors (see `Sizes_t`).
+    double const* halfWidth() const { return fHalfW.data(); }
+    double const* halfHeight() const { return fHalfH.data(); }
+    double const* halfLength() const { return fHalfL.data(); }
+    double const* rMax() const { return fRMax.data(); }
+    // @}
+
+    /**
+     * @brief Distance of a point from each of the detectors.
+     * @param x _x_ coordinate of the point
+     * @param y _y_ coordinate of the point
+     * @param z _z_ coordinate of the point
+     * @param d (output) array with room for `size()` distances
+     */
+    void distancesToPoint(double x, double y, double z, double* d) const;
+
+    /**
+     * @brief Cosine of the angle of a point from the normal of each detector.
+     * @param x _x_ coordinate of the point
+     * @param y _y_ coordinate of the point
+     * @param z _z_ coordinate of the point
+     * @param cosTheta (output) array with room for `size()` results
+     */
+    void cosThetaFromNormal(double x, double y, double z, double* cosTheta) const;
+
+    /**
+     * @brief Distance of each of the points from the detector `i`.
+     * @param i index of the detector
+     * @param n number of points
+     * @param x array of the _x_ coordinates of the points
+     * @param y array of the _y_ coordinates of the points
+     * @param z array of the _z_ coordinates of the points
+     * @param d (output) array with room for `n` distances
+     */
+    void distancesToPoints(std::size_t i,
+                           std::size_t n,
+                           double const* x,
+                           double const* y,
+                           double const* z,
+                           double* d) const;
+
+    /// Cosine of the angle of each of the points from the normal of detector
+    /// `i`; arguments are as in `distancesToPoints()`.
+    void cosThetaFromNormal(std::size_t i,
+                            std::size_t n,
+                            double const* x,
+                            double const* y,
+                            double const* z,
+                            double* cosTheta) const;
+
+    /// Returns the memory allocated by the arrays, besides its own size [bytes]
+    std::size_t heapMemory() const
+    {
+      std::size_t mem = 0U;
+      for (Array_t const* array : {&fCenterX,
+                                   &fCenterY,
+                                   &fCenterZ,
+                                   &fNormalX,
+                                   &fNormalY,
+                                   &fNormalZ,
+                                   &fHalfW,
+                                   &fHalfH,
+                                   &fHalfL,
+                                   &fRMax})
+        mem += lar::util::heapMemory(*array);
+      return mem;
+    }
+
+  private:
+    Array_t fCenterX, fCenterY, fCenterZ;
+    Array_t fNormalX, fNormalY, fNormalZ;
+    Array_t fHalfW, fHalfH, fHalfL, fRMax;
+
+  }; // class OpDetArrays
+
+} // namespace geo::details
+
+//------------------------------------------------------------------------------
+//--- inline implementation
+//------------------------------------------------------------------------------
+inline void geo::details::OpDetArrays::clear()
+{
+  for (Array_t* array : {&fCenterX,
+                         &fCenterY,
+                         &fCenterZ,
+                         &fNormalX,
+                         &fNormalY,
+                         &fNormalZ,
+                         &fHalfW,
+                         &fHalfH,
+                         &fHalfL,
+                         &fRMax})
+    array->clear();
+}
+
+//------------------------------------------------------------------------------
+inline void geo::details::OpDetArrays::reserve(std::size_t n)
+{
+  for (Array_t* array : {&fCenterX,
+                         &fCenterY,
+                         &fCenterZ,
+                         &fNormalX,
+                         &fNormalY,
+                         &fNormalZ,
+                         &fHalfW,
+                         &fHalfH,
+                         &fHalfL,
+                         &fRMax})
+    array->reserve(n);
+}
+
+//------------------------------------------------------------------------------
+template <typename Point, typename Vector>
+void geo::details::OpDetArrays::push_back(Point const& center,
+                                          Vector const& normal,
+                                          Sizes_t const& sizes)
+{
+  fCenterX.push_back(center.X());
+  fCenterY.push_back(center.Y());
+  fCenterZ.push_back(center.Z());
+  fNormalX.push_back(normal.X());
+  fNormalY.push_back(normal.Y());
+  fNormalZ.push_back(normal.Z());
+  fHalfW.push_back(sizes.halfW);
+  fHalfH.push_back(sizes.halfH);
+  fHalfL.push_back(sizes.halfL);
+  fRMax.push_back(sizes.rMax);
+}
+
+//------------------------------------------------------------------------------
+inline void geo::details::OpDetArrays::distancesToPoint(double x,
+                                                        double y,
+                                                        double z,
+                                                        double* __restrict__ d) const
+{
+  double const* __restrict__ const cx = centerX();
+  double const* __restrict__ const cy = centerY();
+  double const* __restrict__ const cz = centerZ();
+  std::size_t const n = size();
+  for (std::size_t i = 0; i < n; ++i) {
+    double const px = x - cx[i], py = y - cy[i], pz = z - cz[i];
+    d[i] = std::sqrt(px * px + py * py + pz * pz);
+  }
+} // geo::details::OpDetArrays::distancesToPoint()
+
+//------------------------------------------------------------------------------
+inline void geo::details::OpDetArrays::cosThetaFromNormal(double x,
+                                                          double y,
+                                                          double z,
+                                                          double* __restrict__ cosTheta) const
+{
+  double const* __restrict__ const cx = centerX();
+  double const* __restrict__ const cy = centerY();
+  double const* __restrict__ const cz = centerZ();
+  double const* __restrict__ const nx = normalX();
+  double const* __restrict__ const ny = normalY();
+  double const* __restrict__ const nz = normalZ();
+  std::size_t const n = size();
+  for (std::size_t i = 0; i < n; ++i) {
+    double const px = x - cx[i], py = y - cy[i], pz = z - cz[i];
+    cosTheta[i] = (px * nx[i] + py * ny[i] + pz * nz[i]) / std::sqrt(px * px + py * py + pz * pz);
+  }
+} // geo::details::OpDetArrays::cosThetaFromNormal()
+
+//------------------------------------------------------------------------------
+inline void geo::details::OpDetArrays::distancesToPoints(std::size_t i,
+                                                         std::size_t n,
+                                                         double const* __restrict__ x,
+                                                         double const* __restrict__ y,
+                                                         double const* __restrict__ z,
+                                                         double* __restrict__ d) const
+{
+  double const cx = fCenterX[i], cy = fCenterY[i], cz = fCenterZ[i];
+  for (std::size_t k = 0; k < n; ++k) {
+    double const px = x[k] - cx, py = y[k] - cy, pz = z[k] - cz;
+    d[k] = std::sqrt(px * px + py * py + pz * pz);
+  }
+} // geo::details::OpDetArrays::distancesToPoints()
+
+//------------------------------------------------------------------------------
+inline void geo::details::OpDetArrays::cosThetaFromNormal(std::size_t i,
+                                                          std::size_t n,
+                                                          double const* __restrict__ x,
+                                                          double const* __restrict__ y,
+                                                          double const* __restrict__ z,
+                                                          double* __restrict__ cosTheta) const
+{
+  double const cx = fCenterX[i], cy = fCenterY[i], cz = fCenterZ[i];
+  double const nx = fNormalX[i], ny = fNormalY[i], nz = fNormalZ[i];
+  for (std::size_t k = 0; k < n; ++k) {
+    double const px = x[k] - cx, py = y[k] - cy, pz = z[k] - cz;
+    cosTheta[k] = (px * nx + py * ny + pz * nz) / std::sqrt(px * px + py * py + pz * pz);
+  }
+} // geo::details::OpDetArrays::cosThetaFromNormal(std::size_t)
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREALG_GEOMETRY_DETAILS_OPDETARRAYS_H
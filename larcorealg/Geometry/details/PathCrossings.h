@@ -0,0 +1,134 @@
+/**
+ * @file   larcorealg/Geometry/details/PathCrossings.h
+ * @brief  Ordered crossings of a trajectory through a set of boxes.
+ * @date   October 14, 2026
+ * @see    `geo::GeometryCore::TPCCrossings()`
+ *
+ * This is a header only library.
+ */
+
+#ifndef LARCOREALG_GEOMETRY_DETAILS_PATHCROSSINGS_H
+#define LARCOREALG_GEOMETRY_DETAILS_PATHCROSSINGS_H
+
+// LArSoft libraries
+#include "larcorealg/Geometry/details/BoxBVH.h"
+#include "larcorealg/Geometry/details/BoxKernel.h" // geo::details::BoxRay
+
+// C/C++ standard libraries
+#include <algorithm> // std::sort(), std::find_if()
+#include <array>
+#include <cmath>   // std::sqrt()
+#include <cstddef> // std::size_t
+#include <iterator> // std::next()
+#include <utility> // std::swap()
+#include <vector>
+
+namespace geo::details {
+
+  /// A stretch of a trajectory inside one box.
+  struct PathCrossing_t {
+    BoxBVH::BoxIndex_t box;       ///< The crossed box.
+    std::array<double, 3U> entry; ///< Where the trajectory enters the box.
+    std::array<double, 3U> exit;  ///< Where the trajectory leaves the box.
+    double length = 0.0;          ///< Length of the trajectory in the box.
+    std::size_t entryStep = 0U;   ///< Step of the trajectory with the entry.
+    std::size_t exitStep = 0U;    ///< Step of the trajectory with the exit.
+  };
+
+  /**
+   * @brief Finds where a trajectory enters and leaves each box of `tree`.
+   * @tparam PointIter type of iterator to points with `X()`, `Y()` and `Z()`
+   * @param tree the boxes
+   * @param begin iterator to the first point of the trajectory
+   * @param end iterator past the last point of the trajectory
+   * @param[out] crossings the crossings found (previous content is removed)
+   *
+   * The trajectory is the sequence of straight steps between consecutive
+   * points. Each time the trajectory enters a box a new crossing is added,
+   * which extends until the trajectory leaves the box; a trajectory entering
+   * the same box twice has two crossings. The crossings are sorted by the
+   * position of their entry along the trajectory. A trajectory starting in a
+   * box has the first point as entry, and one ending in a box has the last
+   * point as exit. Boxes may overlap, in which case the crossings overlap too.
+   *
+   * Only the boxes crossed by a step are visited, via
+   * `geo::details::BoxBVH::forEachCrossed()`.
+   */
+  template <typename PointIter>
+  void findPathCrossings(BoxBVH const& tree,
+                         PointIter begin,
+                         PointIter end,
+                         std::vector<PathCrossing_t>& crossings);
+
+} // namespace geo::details
+
+//------------------------------------------------------------------------------
+//---  template implementation
+//------------------------------------------------------------------------------
+template <typename PointIter>
+void geo::details::findPathCrossings(BoxBVH const& tree,
+                                     PointIter begin,
+                                     PointIter end,
+                                     std::vector<PathCrossing_t>& crossings)
+{
+  struct Hit_t {
+    BoxBVH::BoxIndex_t box;
+    double tEnter, tExit;
+  };
+
+  crossings.clear();
+  if (begin == end) return;
+
+  std::vector<Hit_t> hits;
+  std::vector<std::size_t> open, stillOpen; // crossings not left yet
+  std::size_t step = 0U;
+  for (PointIter next = std::next(begin); next != end; ++begin, ++next, ++step) {
+    double const start[3] = {begin->X(), begin->Y(), begin->Z()};
+    double const dir[3] = {next->X() - start[0], next->Y() - start[1], next->Z() - start[2]};
+    double const stepLength = std::sqrt(dir[0] * dir[0] + dir[1] * dir[1] + dir[2] * dir[2]);
+    if (stepLength == 0.0) continue; // a repeated point does not leave any box
+
+    BoxRay const ray = BoxRay::make(start, dir);
+    hits.clear();
+    tree.forEachCrossed(ray, 0.0, 1.0, [&hits](BoxBVH::BoxIndex_t box, double t0, double t1) {
+      hits.push_back({box, t0, t1});
+    });
+    std::sort(hits.begin(), hits.end(), [](Hit_t const& a, Hit_t const& b) {
+      return (a.tEnter != b.tEnter) ? (a.tEnter < b.tEnter) : (a.box < b.box);
+    });
+
+    stillOpen.clear();
+    for (Hit_t const& hit : hits) {
+      // a box the previous step ended in, and this one starts in, is continued
+      auto itOpen = open.end();
+      if (hit.tEnter <= 0.0) {
+        itOpen = std::find_if(open.begin(), open.end(), [&](std::size_t i) {
+          return crossings[i].box == hit.box;
+        });
+      }
+      std::size_t iCrossing = crossings.size();
+      if (itOpen == open.end()) {
+        PathCrossing_t crossing;
+        crossing.box = hit.box;
+        for (std::size_t k = 0; k < 3U; ++k)
+          crossing.entry[k] = start[k] + hit.tEnter * dir[k];
+        crossing.entryStep = step;
+        crossings.push_back(crossing);
+      }
+      else
+        iCrossing = *itOpen;
+
+      PathCrossing_t& crossing = crossings[iCrossing];
+      for (std::size_t k = 0; k < 3U; ++k)
+        crossing.exit[k] = start[k] + hit.tExit * dir[k];
+      crossing.length += (hit.tExit - hit.tEnter) * stepLength;
+      crossing.exitStep = step;
+      if (hit.tExit >= 1.0) stillOpen.push_back(iCrossing);
+    } // for hits
+    std::swap(open, stillOpen);
+  } // for steps
+} // geo::details::findPathCrossings()
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREALG_GEOMETRY_DETAILS_PATHCROSSINGS_H
@@ -0,0 +1,279 @@
+/**
+ * @file   larcorealg/Geometry/details/PointKDTree.h
+ * @brief  k-d tree for nearest neighbour searches among a set of points.
+ * @date   October 14, 2026
+ *
+ * This is a header only library.
+ */
+
+#ifndef LARCOREALG_GEOMETRY_DETAILS_POINTKDTREE_H
+#define LARCOREALG_GEOMETRY_DETAILS_POINTKDTREE_H
+
+// LArSoft libraries
+#include "larcorealg/CoreUtils/MemoryUsage.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::nth_element(), std::push_heap(), std::sort_heap()...
+#include <array>
+#include <cmath>   // std::sqrt()
+#include <cstddef> // std::size_t
+#include <limits>
+#include <utility> // std::pair
+#include <vector>
+
+namespace geo::details {
+
+  /**
+   * @brief Balanced k-d tree over a fixed set of points in space.
+   *
+   * The tree is built from a list of points (`build()`), and it can later be
+   * queried for the point closest to a given position (`nearest()`) or for the
+   * `k` closest ones (`kNearest()`). Points are identified by their position in
+   * the list used to build the tree.
+   *
+   * The results are exact, and they are the same as a linear search would
+   * give: the distance is computed as `(query - point).R()` does, and among
+   * points at the same distance the one with the lowest index is preferred.
+   *
+   * The points are required to provide the methods `X()`, `Y()` and `Z()`, as
+   * `geo::Point_t` does.
+   */
+  class PointKDTree {
+
+  public:
+    /// Type of index of a point (its position in the list used to build).
+    using Index_t = unsigned int;
+
+    /// Value returned when no point is found.
+    static constexpr Index_t NoIndex = std::numeric_limits<Index_t>::max();
+
+    /// Builds the tree on the specified points, replacing any previous one.
+    template <typename Points>
+    void build(Points const& points);
+
+    /// Removes all the points.
+    void clear() { fNodes.clear(); }
+
+    /// Returns whether the tree has no point.
+    bool empty() const { return fNodes.empty(); }
+
+    /// Returns the number of points in the tree.
+    std::size_t size() const { return fNodes.size(); }
+
+    /// Returns the index of the point closest to `(x, y, z)`, or `NoIndex`.
+    Index_t nearest(double x, double y, double z) const;
+
+    /// Returns the index of the point closest to `point`, or `NoIndex`.
+    template <typename Point>
+    Index_t nearest(Point const& point) const
+    {
+      return nearest(point.X(), point.Y(), point.Z());
+    }
+
+    /**
+     * @brief Returns the indices of the `k` points closest to `(x, y, z)`.
+     * @return the indices, sorted by increasing distance
+     *
+     * If there are fewer than `k` points, all of them are returned.
+     */
+    std::vector<Index_t> kNearest(double x, double y, double z, std::size_t k) const;
+
+    /// Returns the indices of the `k` points closest to `point`.
+    template <typename Point>
+    std::vector<Index_t> kNearest(Point const& point, std::size_t k) const
+    {
+      return kNearest(point.X(), point.Y(), point.Z(), k);
+    }
+
+    /// Returns the memory allocated by the tree, besides its own size [bytes]
+    std::size_t heapMemory() const
+    {
+      return lar::util::heapMemory(fNodes);
+    }
+
+  private:
+    using Coords_t = std::array<double, 3U>;
+
+    /// Candidate result: distance and index of the point.
+    using Match_t = std::pair<double, Index_t>;
+
+    /// Returns whether `a` is a better match than `b` (never if `a` is NaN).
+    static bool closer(Match_t const& a, Match_t const& b)
+    {
+      return (a.first < b.first) || ((a.first == b.first) && (a.second < b.second));
+    }
+
+    struct Node_t {
+      Coords_t pos;           ///< Position of the point.
+      Index_t index;          ///< Index of the point.
+      unsigned char axis = 0; ///< Direction this node splits its subtree on.
+    };
+
+    /// Nodes; each subtree `[ b, e [` has its root in the middle.
+    std::vector<Node_t> fNodes;
+
+    /// Organises the nodes in `[ b, e [` into a subtree.
+    void buildSubtree(std::size_t b, std::size_t e);
+
+    /// Updates `best` with the closest point in the subtree `[ b, e [`.
+    void searchNearest(std::size_t b, std::size_t e, Coords_t const& q, Match_t& best) const;
+
+    /// Updates the max-heap `best` of up to `k` matches in the subtree.
+    void searchKNearest(std::size_t b,
+                        std::size_t e,
+                        Coords_t const& q,
+                        std::size_t k,
+                        std::vector<Match_t>& best) const;
+
+    /// Distance between `q` and `p`, computed as `geo::Vector_t::R()` does.
+    static double distance(Coords_t const& q, Coords_t const& p)
+    {
+      double const dx = q[0] - p[0], dy = q[1] - p[1], dz = q[2] - p[2];
+      return std::sqrt(dx * dx + dy * dy + dz * dz);
+    }
+
+    /// Lower bound to the distance of points beyond a splitting plane.
+    // Written as the distance above is, so that it is never larger than that.
+    static double planeDistance(double diff) { return std::sqrt(diff * diff); }
+
+  }; // class PointKDTree
+
+} // namespace geo::details
+
+//------------------------------------------------------------------------------
+//---  template implementation
+//------------------------------------------------------------------------------
+template <typename Points>
+void geo::details::PointKDTree::build(Points const& points)
+{
+  clear();
+  for (auto const& point : points) {
+    Index_t const index = static_cast<Index_t>(fNodes.size());
+    fNodes.push_back({Coords_t{point.X(), point.Y(), point.Z()}, index});
+  }
+  buildSubtree(0U, fNodes.size());
+} // geo::details::PointKDTree::build()
+
+//------------------------------------------------------------------------------
+inline void geo::details::PointKDTree::buildSubtree(std::size_t b, std::size_t e)
+{
+  while (e - b > 1U) {
+
+    // split on the direction where the points are most spread
+    Coords_t min = fNodes[b].pos, max = fNodes[b].pos;
+    for (std::size_t i = b + 1U; i < e; ++i) {
+      for (std::size_t axis = 0; axis < 3U; ++axis) {
+        min[axis] = std::min(min[axis], fNodes[i].pos[axis]);
+        max[axis] = std::max(max[axis], fNodes[i].pos[axis]);
+      }
+    }
+    unsigned char axis = 0;
+    for (unsigned char a = 1; a < 3U; ++a)
+      if (max[a] - min[a] > max[axis] - min[axis]) axis = a;
+
+    std::size_t const mid = b + (e - b) / 2U;
+    std::nth_element(fNodes.begin() + b,
+                     fNodes.begin() + mid,
+                     fNodes.begin() + e,
+                     [axis](Node_t const& lhs, Node_t const& rhs) {
+                       return lhs.pos[axis] < rhs.pos[axis];
+                     });
+    fNodes[mid].axis = axis;
+
+    buildSubtree(b, mid);
+    b = mid + 1U;
+  } // while
+} // geo::details::PointKDTree::buildSubtree()
+
+//------------------------------------------------------------------------------
+inline auto geo::details::PointKDTree::nearest(double x, double y, double z) const -> Index_t
+{
+  Match_t best{std::numeric_limits<double>::infinity(), NoIndex};
+  searchNearest(0U, fNodes.size(), Coords_t{x, y, z}, best);
+  return best.second;
+}
+
+//------------------------------------------------------------------------------
+inline void geo::details::PointKDTree::searchNearest(std::size_t b,
+                                                     std::size_t e,
+                                                     Coords_t const& q,
+                                                     Match_t& best) const
+{
+  while (b < e) {
+    std::size_t const mid = b + (e - b) / 2U;
+    Node_t const& node = fNodes[mid];
+
+    Match_t const match{distance(q, node.pos), node.index};
+    if (closer(match, best)) best = match;
+
+    // descend on the side of the query first, then on the other if needed
+    double const diff = q[node.axis] - node.pos[node.axis];
+    if (diff < 0.0) {
+      searchNearest(b, mid, q, best);
+      b = mid + 1U;
+    }
+    else {
+      searchNearest(mid + 1U, e, q, best);
+      e = mid;
+    }
+    if (planeDistance(diff) > best.first) return;
+  } // while
+} // geo::details::PointKDTree::searchNearest()
+
+//------------------------------------------------------------------------------
+inline auto geo::details::PointKDTree::kNearest(double x, double y, double z, std::size_t k) const
+  -> std::vector<Index_t>
+{
+  std::vector<Match_t> best;
+  if (k == 0U) return {};
+  best.reserve(std::min(k, fNodes.size()));
+  searchKNearest(0U, fNodes.size(), Coords_t{x, y, z}, k, best);
+
+  std::sort_heap(best.begin(), best.end(), closer);
+  std::vector<Index_t> indices;
+  indices.reserve(best.size());
+  for (Match_t const& match : best)
+    indices.push_back(match.second);
+  return indices;
+} // geo::details::PointKDTree::kNearest()
+
+//------------------------------------------------------------------------------
+inline void geo::details::PointKDTree::searchKNearest(std::size_t b,
+                                                      std::size_t e,
+                                                      Coords_t const& q,
+                                                      std::size_t k,
+                                                      std::vector<Match_t>& best) const
+{
+  while (b < e) {
+    std::size_t const mid = b + (e - b) / 2U;
+    Node_t const& node = fNodes[mid];
+
+    Match_t const match{distance(q, node.pos), node.index};
+    if (best.size() < k) {
+      if (match.first == match.first) { // not NaN
+        best.push_back(match);
+        std::push_heap(best.begin(), best.end(), closer);
+      }
+    }
+    else if (closer(match, best.front())) {
+      std::pop_heap(best.begin(), best.end(), closer);
+      best.back() = match;
+      std::push_heap(best.begin(), best.end(), closer);
+    }
+
+    double const diff = q[node.axis] - node.pos[node.axis];
+    if (diff < 0.0) {
+      searchKNearest(b, mid, q, k, best);
+      b = mid + 1U;
+    }
+    else {
+      searchKNearest(mid + 1U, e, q, k, best);
+      e = mid;
+    }
+    if ((best.size() == k) && (planeDistance(diff) > best.front().first)) return;
+  } // while
+} // geo::details::PointKDTree::searchKNearest()
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREALG_GEOMETRY_DETAILS_POINTKDTREE_H
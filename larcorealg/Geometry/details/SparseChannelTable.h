@@ -0,0 +1,176 @@
+/**
+ * @file   larcorealg/Geometry/details/SparseChannelTable.h
+ * @brief  Constant time lookup table for sparse channel numbers.
+ * @date   October 14, 2026
+ * @see    `geo::ChannelMapAlg::SparseChannelTable_t`
+ *
+ * This is a header only library.
+ */
+
+#ifndef LARCOREALG_GEOMETRY_DETAILS_SPARSECHANNELTABLE_H
+#define LARCOREALG_GEOMETRY_DETAILS_SPARSECHANNELTABLE_H
+
+// LArSoft libraries
+#include "larcorealg/CoreUtils/MemoryUsage.h" // lar::util::heapMemory()
+#include "larcoreobj/SimpleTypesAndConstants/RawTypes.h" // raw::ChannelID_t
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint32_t
+#include <utility> // std::move()
+#include <vector>
+
+namespace geo::details {
+
+  /**
+   * @brief Table of values for channels with non-contiguous numbers.
+   * @tparam T type of the value stored for each channel
+   * @tparam PageBits the channels are grouped in pages of `2^PageBits`
+   *
+   * This is a two-level dense table: the channel number is split into a page
+   * number (the high bits) and a position in the page (the low bits). Only the
+   * pages with at least one channel are allocated, so that a numbering with
+   * large gaps (like the ones encoding crate, board and channel of the
+   * electronics) costs one word per page in the first level, plus the pages
+   * actually used. The lookup of a channel is two array accesses, with no
+   * hashing and no search.
+   *
+   * The table is meant to be filled once (e.g. in the `Initialize()` of a
+   * channel mapping) and then only queried.
+   *
+   * Example of usage, storing the wires read by each channel:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   * geo::details::SparseChannelTable<std::vector<geo::WireID>> wiresOf;
+   * wiresOf.insert(0x10203, { geo::WireID{ 0, 0, 0, 5 } });
+   *
+   * std::vector<geo::WireID> const* wires = wiresOf.find(0x10203);
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   */
+  template <typename T, unsigned int PageBits = 8U>
+  class SparseChannelTable {
+    static_assert(PageBits < 32U, "Pages can't be larger than the channel range.");
+
+  public:
+    using Value_t = T; ///< Type of the value stored for each channel.
+
+    /// Number of channels in each page.
+    static constexpr std::size_t PageSize = std::size_t{1} << PageBits;
+
+    /**
+     * @brief Sets the value of a channel.
+     * @param channel the channel number
+     * @param value the value to be stored for `channel`
+     * @return whether `channel` was not in the table yet
+     *
+     * If the channel is already present, its value is replaced.
+     * The invalid channel (`raw::InvalidChannelID`) is not stored.
+     */
+    bool insert(raw::ChannelID_t channel, Value_t value);
+
+    /// Returns a pointer to the value of `channel`, `nullptr` if not present.
+    Value_t const* find(raw::ChannelID_t channel) const
+    {
+      std::uint32_t const index = indexOf(channel);
+      return (index == NoEntry) ? nullptr : &fValues[index];
+    }
+
+    /// Returns whether `channel` is in the table.
+    bool contains(raw::ChannelID_t channel) const { return indexOf(channel) != NoEntry; }
+
+    /// Returns the number of channels in the table.
+    std::size_t size() const { return fValues.size(); }
+
+    /// Returns whether the table has no channel.
+    bool empty() const { return fValues.empty(); }
+
+    /// Returns the number of allocated pages.
+    std::size_t nPages() const { return fSlots.size() / PageSize; }
+
+    /// Returns the channels in the table, in order of insertion.
+    std::vector<raw::ChannelID_t> const& channels() const { return fChannels; }
+
+    /// Returns the values in the table, in the same order as `channels()`.
+    std::vector<Value_t> const& values() const { return fValues; }
+
+    /// Removes all the channels.
+    void clear()
+    {
+      fPages.clear();
+      fSlots.clear();
+      fValues.clear();
+      fChannels.clear();
+    }
+
+    /// Returns the memory allocated by the table, besides its own size [bytes].
+    std::size_t heapMemory() const
+    {
+      return lar::util::heapMemory(fPages) + lar::util::heapMemory(fSlots) +
+             lar::util::heapMemory(fValues) + lar::util::heapMemory(fChannels);
+    }
+
+  private:
+    /// Marker of a missing page or channel.
+    static constexpr std::uint32_t NoEntry = ~std::uint32_t{0};
+
+    /// Mask of the position of a channel in its page.
+    static constexpr raw::ChannelID_t PageMask = static_cast<raw::ChannelID_t>(PageSize - 1U);
+
+    /// Start in `fSlots` of each page, `NoEntry` if the page is not allocated.
+    std::vector<std::uint32_t> fPages;
+
+    /// Index in `fValues` of each channel of the allocated pages (or `NoEntry`).
+    std::vector<std::uint32_t> fSlots;
+
+    std::vector<Value_t> fValues;            ///< Value of each channel.
+    std::vector<raw::ChannelID_t> fChannels; ///< Channel of each value.
+
+    /// Returns the index of the page of `channel`.
+    static std::size_t pageOf(raw::ChannelID_t channel)
+    {
+      return static_cast<std::size_t>(channel) >> PageBits;
+    }
+
+    /// Returns the index in `fValues` of `channel`, `NoEntry` if not present.
+    std::uint32_t indexOf(raw::ChannelID_t channel) const
+    {
+      if (!raw::isValidChannelID(channel)) return NoEntry;
+      std::size_t const page = pageOf(channel);
+      if (page >= fPages.size()) return NoEntry;
+      std::uint32_t const pageStart = fPages[page];
+      return (pageStart == NoEntry) ? NoEntry : fSlots[pageStart + (channel & PageMask)];
+    }
+
+  }; // class SparseChannelTable
+
+} // namespace geo::details
+
+//------------------------------------------------------------------------------
+//--- template implementation
+//------------------------------------------------------------------------------
+template <typename T, unsigned int PageBits>
+bool geo::details::SparseChannelTable<T, PageBits>::insert(raw::ChannelID_t channel,
+                                                           Value_t value)
+{
+  if (!raw::isValidChannelID(channel)) return false;
+
+  std::size_t const page = pageOf(channel);
+  if (page >= fPages.size()) fPages.resize(page + 1U, NoEntry);
+  if (fPages[page] == NoEntry) {
+    fPages[page] = static_cast<std::uint32_t>(fSlots.size());
+    fSlots.resize(fSlots.size() + PageSize, NoEntry);
+  }
+
+  std::uint32_t& slot = fSlots[fPages[page] + (channel & PageMask)];
+  if (slot != NoEntry) {
+    fValues[slot] = std::move(value);
+    return false;
+  }
+  slot = static_cast<std::uint32_t>(fValues.size());
+  fValues.push_back(std::move(value));
+  fChannels.push_back(channel);
+  return true;
+} // geo::details::SparseChannelTable<>::insert()
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREALG_GEOMETRY_DETAILS_SPARSECHANNELTABLE_H
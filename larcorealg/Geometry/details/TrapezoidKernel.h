@@ -0,0 +1,87 @@
+/**
+ * @file   larcorealg/Geometry/details/TrapezoidKernel.h
+ * @brief  Containment test in the trapezoid volumes of auxiliary detectors.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/AuxDetGeo.h`,
+ *         `larcorealg/Geometry/AuxDetSensitiveGeo.h`
+ *
+ * This is a header only library.
+ */
+
+#ifndef LARCOREALG_GEOMETRY_DETAILS_TRAPEZOIDKERNEL_H
+#define LARCOREALG_GEOMETRY_DETAILS_TRAPEZOIDKERNEL_H
+
+// LArSoft libraries
+#include "larcorealg/Geometry/details/AffineTransformKernel.h"
+
+namespace geo::details {
+
+  /**
+   * @brief Shape of a trapezoid volume and its world-to-local transformation.
+   *
+   * The volume is centered in its local frame, with its length along _z_
+   * and its height along _y_; its half width along _x_ changes linearly from
+   * `HalfWidth1` at _z = -L/2_ to `HalfWidth2` at _z = +L/2_ (they are equal
+   * for a box), as in `geo::AuxDetGeo` and `geo::AuxDetSensitiveGeo`.
+   * All the derived parameters are computed once in `make()`, and the
+   * containment tests are a matrix product followed by six comparisons.
+   * A tolerance expands the volume by that amount on each side, in the local
+   * frame.
+   */
+  struct TrapezoidKernel {
+
+    AffineTransformKernel toLocal; ///< World-to-local transformation.
+    double halfLength = 0.0;       ///< Half length of the volume (_z_).
+    double halfHeight = 0.0;       ///< Half height of the volume (_y_).
+    double halfCenterWidth = 0.0;  ///< Half width at _z = 0_ (_x_).
+    double widthSlope = 0.0;       ///< Decrease of the half width per unit of _z_.
+
+    /**
+     * @brief Returns the kernel of the specified volume.
+     * @param toLocal the world-to-local transformation of the volume
+     * @param halfWidth1 half width at _z = -L/2_
+     * @param halfWidth2 half width at _z = +L/2_
+     * @param halfHeight half height of the volume
+     * @param length length _L_ of the volume
+     */
+    static TrapezoidKernel make(AffineTransformKernel const& toLocal,
+                                double halfWidth1,
+                                double halfWidth2,
+                                double halfHeight,
+                                double length)
+    {
+      TrapezoidKernel kernel;
+      kernel.toLocal = toLocal;
+      kernel.halfLength = length / 2.0;
+      kernel.halfHeight = halfHeight;
+      kernel.halfCenterWidth = (halfWidth1 + halfWidth2) / 2.0;
+      kernel.widthSlope =
+        (length > 0.0) ? (kernel.halfCenterWidth - halfWidth2) / kernel.halfLength : 0.0;
+      return kernel;
+    }
+
+    /// Returns the half width of the volume at the local coordinate `z`.
+    double halfWidthAt(double z) const { return halfCenterWidth - z * widthSlope; }
+
+    /// Returns whether the point `local` (local frame) is in the volume.
+    bool containsLocal(double const* local, double tolerance = 0.0) const
+    {
+      double const halfWidth = halfWidthAt(local[2]);
+      return (local[2] >= -(halfLength + tolerance)) && (local[2] <= (halfLength + tolerance)) &&
+             (local[1] >= -(halfHeight + tolerance)) && (local[1] <= (halfHeight + tolerance)) &&
+             (local[0] >= -(halfWidth + tolerance)) && (local[0] <= (halfWidth + tolerance));
+    }
+
+    /// Returns whether the point `world` (world frame) is in the volume.
+    bool contains(double const* world, double tolerance = 0.0) const
+    {
+      double local[3];
+      toLocal.transformPoint(world, local);
+      return containsLocal(local, tolerance);
+    }
+
+  }; // struct TrapezoidKernel
+
+} // namespace geo::details
+
+#endif // LARCOREALG_GEOMETRY_DETAILS_TRAPEZOIDKERNEL_H
@@ -0,0 +1,140 @@
+/**
+ * @file   larcorealg/Geometry/details/VolumeNameTable.h
+ * @brief  Interned names of the volumes of a geometry, with numeric handles.
+ * @date   October 14, 2026
+ * @see    `geo::GeometryCore::VolumeHandle()`
+ *
+ * This is a header only library.
+ */
+
+#ifndef LARCOREALG_GEOMETRY_DETAILS_VOLUMENAMETABLE_H
+#define LARCOREALG_GEOMETRY_DETAILS_VOLUMENAMETABLE_H
+
+// LArSoft libraries
+#include "larcorealg/CoreUtils/MemoryUsage.h" // lar::util::heapMemory()
+#include "larcorealg/CoreUtils/MonotonicArena.h"
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint32_t
+#include <memory_resource>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace geo::details {
+
+  /**
+   * @brief Table of distinct volume names, each with a numeric handle.
+   *
+   * Each name is stored once, in an arena owned by the table, and it is
+   * assigned a handle, which is its position in the order of addition.
+   * Two volumes have the same handle if and only if they have the same name,
+   * so that checking the name of a volume is the comparison of two integers.
+   *
+   * Each name may also be associated to the number of its volume (as in
+   * `TGeoVolume::GetNumber()`), so that the handle of a volume is found by an
+   * array lookup from that number, with no string involved.
+   *
+   * The names returned by `name()` stay valid until the table is cleared.
+   */
+  class VolumeNameTable {
+  public:
+    using Handle_t = std::uint32_t; ///< Type of the handle of a name.
+
+    /// Handle of no name.
+    static constexpr Handle_t InvalidHandle = ~Handle_t{0};
+
+    VolumeNameTable() = default;
+    VolumeNameTable(VolumeNameTable const&) = delete;
+    VolumeNameTable& operator=(VolumeNameTable const&) = delete;
+
+    /**
+     * @brief Adds the `name` of the volume with the specified `number`.
+     * @param name name of the volume
+     * @param number number of the volume (negative if none)
+     * @return the handle of `name`
+     *
+     * If `name` is already in the table, its existing handle is returned.
+     */
+    Handle_t add(std::string_view name, int number = -1);
+
+    /// Removes all the names.
+    void clear()
+    {
+      fNames.clear();
+      fByNumber.clear();
+      NameMap_t{&fArena}.swap(fByName); // all the memory of the arena is now free
+      fArena.reset();
+    }
+
+    /// Returns the number of distinct names.
+    std::size_t size() const { return fNames.size(); }
+
+    /// Returns the handle of `name`, `InvalidHandle` if not in the table.
+    Handle_t handle(std::string_view name) const
+    {
+      auto const it = fByName.find(name);
+      return (it == fByName.end()) ? InvalidHandle : it->second;
+    }
+
+    /// Returns the handle of the volume `number`, `InvalidHandle` if unknown.
+    Handle_t handleOf(int number) const
+    {
+      return ((number < 0) || (static_cast<std::size_t>(number) >= fByNumber.size())) ?
+               InvalidHandle :
+               fByNumber[number];
+    }
+
+    /// Returns the name with the specified `handle` (empty if invalid).
+    std::string_view name(Handle_t handle) const
+    {
+      return (handle < fNames.size()) ? fNames[handle] : std::string_view{};
+    }
+
+    /// Returns the memory allocated by the table, besides its own size [bytes].
+    std::size_t heapMemory() const
+    {
+      return lar::util::heapMemory(fNames) + lar::util::heapMemory(fByNumber) +
+             lar::util::heapMemory(fArena);
+    }
+
+  private:
+    /// Handle of each name (names and nodes all in `fArena`).
+    using NameMap_t = std::pmr::unordered_map<std::string_view, Handle_t>;
+
+    std::vector<std::string_view> fNames; ///< Name of each handle.
+
+    std::vector<Handle_t> fByNumber; ///< Handle of each volume number.
+
+    lar::util::MonotonicArena fArena; ///< Memory of the names and of `fByName`.
+
+    NameMap_t fByName{&fArena}; ///< Handle of each name.
+
+  }; // class VolumeNameTable
+
+} // namespace geo::details
+
+//------------------------------------------------------------------------------
+//--- inline implementation
+//---
+inline auto geo::details::VolumeNameTable::add(std::string_view name, int number) -> Handle_t
+{
+  auto iName = fByName.find(name);
+  if (iName == fByName.end()) {
+    auto const handle = static_cast<Handle_t>(fNames.size());
+    std::string_view const stored = fArena.storeString(name);
+    fNames.push_back(stored);
+    iName = fByName.try_emplace(stored, handle).first;
+  }
+  if (number >= 0) {
+    auto const index = static_cast<std::size_t>(number);
+    if (index >= fByNumber.size()) fByNumber.resize(index + 1U, InvalidHandle);
+    fByNumber[index] = iName->second;
+  }
+  return iName->second;
+} // geo::details::VolumeNameTable::add()
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREALG_GEOMETRY_DETAILS_VOLUMENAMETABLE_H
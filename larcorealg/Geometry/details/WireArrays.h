@@ -0,0 +1,272 @@
+/**
+ * @file   larcorealg/Geometry/details/WireArrays.h
+ * @brief  Wire positions of a plane as contiguous arrays of coordinates.
+ * @date   October 14, 2026
+ *
+ * This is a header only library.
+ */
+
+#ifndef LARCOREALG_GEOMETRY_DETAILS_WIREARRAYS_H
+#define LARCOREALG_GEOMETRY_DETAILS_WIREARRAYS_H
+
+// LArSoft libraries
+#include "larcorealg/CoreUtils/MemoryUsage.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::clamp()
+#include <cmath>     // std::sqrt()
+#include <cstddef>   // std::size_t
+#include <limits>
+#include <new> // std::align_val_t
+#include <vector>
+
+namespace geo::details {
+
+  /// Allocator of memory aligned to `Alignment` bytes.
+  template <typename T, std::size_t Alignment>
+  struct AlignedAllocator {
+    using value_type = T;
+
+    template <typename U>
+    struct rebind {
+      using other = AlignedAllocator<U, Alignment>;
+    };
+
+    AlignedAllocator() = default;
+    template <typename U>
+    AlignedAllocator(AlignedAllocator<U, Alignment> const&)
+    {}
+
+    T* allocate(std::size_t n)
+    {
+      return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t{Alignment}));
+    }
+    void deallocate(T* p, std::size_t) { ::operator delete(p, std::align_val_t{Alignment}); }
+
+    template <typename U>
+    bool operator==(AlignedAllocator<U, Alignment> const&) const
+    {
+      return true;
+    }
+    template <typename U>
+    bool operator!=(AlignedAllocator<U, Alignment> const&) const
+    {
+      return false;
+    }
+  }; // AlignedAllocator
+
+  /**
+   * @brief Centers, directions and half lengths of all the wires of a plane.
+   *
+   * Each quantity is stored in its own array (a "structure of arrays"), with
+   * the wires in the same order as in the plane. The arrays start on a
+   * `Alignment` byte boundary, so that the loops over the wires of the plane
+   * can be vectorized by the compiler. The scans provided here are written
+   * that way.
+   *
+   * Directions are expected to be unit vectors.
+   */
+  class WireArrays {
+
+  public:
+    /// Alignment of the start of each array, in bytes.
+    static constexpr std::size_t Alignment = 64U;
+
+    /// Type of the array of each coordinate.
+    using Array_t = std::vector<double, AlignedAllocator<double, Alignment>>;
+
+    /// Number of wires.
+    std::size_t size() const { return fHalfL.size(); }
+
+    /// Returns whether there are no wires.
+    bool empty() const { return fHalfL.empty(); }
+
+    /// Removes all the wires.
+    void clear();
+
+    /// Prepares room for `n` wires.
+    void reserve(std::size_t n);
+
+    /// Adds a wire at the end of the list.
+    template <typename Point, typename Vector>
+    void push_back(Point const& center, Vector const& dir, double halfL);
+
+    // @{
+    /// Arrays of coordinates of the centers of the wires.
+    double const* centerX() const { return fCenterX.data(); }
+    double const* centerY() const { return fCenterY.data(); }
+    double const* centerZ() const { return fCenterZ.data(); }
+    // @}
+
+    // @{
+    /// Arrays of components of the directions of the wires.
+    double const* dirX() const { return fDirX.data(); }
+    double const* dirY() const { return fDirY.data(); }
+    double const* dirZ() const { return fDirZ.data(); }
+    // @}
+
+    /// Array of half lengths of the wires.
+    double const* halfLength() const { return fHalfL.data(); }
+
+    /**
+     * @brief Fills the coordinates of the end points of all wires.
+     * @param start (output) arrays of _x_, _y_ and _z_ of the start points
+     * @param end (output) arrays of _x_, _y_ and _z_ of the end points
+     *
+     * Each of the six output arrays must have room for `size()` elements.
+     * Start is the center minus half length times direction.
+     */
+    void fillEndPoints(double* const start[3], double* const end[3]) const;
+
+    /**
+     * @brief Squared distance of a point from the segment of each wire.
+     * @param x _x_ coordinate of the point
+     * @param y _y_ coordinate of the point
+     * @param z _z_ coordinate of the point
+     * @param d2 (output) array with room for `size()` distances
+     */
+    void segmentDistances2(double x, double y, double z, double* d2) const;
+
+    /// Returns the index of the wire whose segment is closest to the point.
+    /// @return the index of the wire, or `size()` if there are no wires
+    std::size_t closestSegment(double x, double y, double z) const;
+
+    /**
+     * @brief Smallest distance of a wire center from the axis of a wire.
+     * @param ref index of the reference wire
+     * @param zero distances below this are ignored
+     * @return the distance, `std::numeric_limits<double>::max()` if none
+     *
+     * When the wires are parallel and evenly spaced, this is the wire pitch.
+     */
+    double minDistanceFromAxis(std::size_t ref, double zero) const;
+
+    /// Returns the memory allocated by the arrays, besides its own size [bytes]
+    std::size_t heapMemory() const
+    {
+      return lar::util::heapMemory(fCenterX) + lar::util::heapMemory(fCenterY) +
+             lar::util::heapMemory(fCenterZ) + lar::util::heapMemory(fDirX) +
+             lar::util::heapMemory(fDirY) + lar::util::heapMemory(fDirZ) +
+             lar::util::heapMemory(fHalfL);
+    }
+
+  private:
+    Array_t fCenterX, fCenterY, fCenterZ;
+    Array_t fDirX, fDirY, fDirZ;
+    Array_t fHalfL;
+
+  }; // class WireArrays
+
+} // namespace geo::details
+
+//------------------------------------------------------------------------------
+//--- inline implementation
+//------------------------------------------------------------------------------
+inline void geo::details::WireArrays::clear()
+{
+  for (Array_t* array : {&fCenterX, &fCenterY, &fCenterZ, &fDirX, &fDirY, &fDirZ, &fHalfL})
+    array->clear();
+}
+
+//------------------------------------------------------------------------------
+inline void geo::details::WireArrays::reserve(std::size_t n)
+{
+  for (Array_t* array : {&fCenterX, &fCenterY, &fCenterZ, &fDirX, &fDirY, &fDirZ, &fHalfL})
+    array->reserve(n);
+}
+
+//------------------------------------------------------------------------------
+template <typename Point, typename Vector>
+void geo::details::WireArrays::push_back(Point const& center, Vector const& dir, double halfL)
+{
+  fCenterX.push_back(center.X());
+  fCenterY.push_back(center.Y());
+  fCenterZ.push_back(center.Z());
+  fDirX.push_back(dir.X());
+  fDirY.push_back(dir.Y());
+  fDirZ.push_back(dir.Z());
+  fHalfL.push_back(halfL);
+}
+
+//------------------------------------------------------------------------------
+inline void geo::details::WireArrays::fillEndPoints(double* const start[3],
+                                                    double* const end[3]) const
+{
+  double const* const center[3] = {centerX(), centerY(), centerZ()};
+  double const* const dir[3] = {dirX(), dirY(), dirZ()};
+  double const* const halfL = halfLength();
+  std::size_t const n = size();
+  for (std::size_t k = 0; k < 3U; ++k) {
+    double const* __restrict__ const c = center[k];
+    double const* __restrict__ const d = dir[k];
+    double* __restrict__ const s = start[k];
+    double* __restrict__ const e = end[k];
+    for (std::size_t i = 0; i < n; ++i) {
+      s[i] = c[i] - halfL[i] * d[i];
+      e[i] = c[i] + halfL[i] * d[i];
+    }
+  } // for coordinates
+} // geo::details::WireArrays::fillEndPoints()
+
+//------------------------------------------------------------------------------
+inline void geo::details::WireArrays::segmentDistances2(double x,
+                                                        double y,
+                                                        double z,
+                                                        double* __restrict__ d2) const
+{
+  double const* __restrict__ const cx = centerX();
+  double const* __restrict__ const cy = centerY();
+  double const* __restrict__ const cz = centerZ();
+  double const* __restrict__ const dx = dirX();
+  double const* __restrict__ const dy = dirY();
+  double const* __restrict__ const dz = dirZ();
+  double const* __restrict__ const halfL = halfLength();
+  std::size_t const n = size();
+  for (std::size_t i = 0; i < n; ++i) {
+    double const px = x - cx[i], py = y - cy[i], pz = z - cz[i];
+    double const along = std::clamp(px * dx[i] + py * dy[i] + pz * dz[i], -halfL[i], halfL[i]);
+    double const tx = px - along * dx[i], ty = py - along * dy[i], tz = pz - along * dz[i];
+    d2[i] = tx * tx + ty * ty + tz * tz;
+  }
+} // geo::details::WireArrays::segmentDistances2()
+
+//------------------------------------------------------------------------------
+inline std::size_t geo::details::WireArrays::closestSegment(double x, double y, double z) const
+{
+  std::size_t const n = size();
+  Array_t d2(n);
+  segmentDistances2(x, y, z, d2.data());
+  std::size_t closest = n;
+  double minD2 = std::numeric_limits<double>::max();
+  for (std::size_t i = 0; i < n; ++i) {
+    if (d2[i] >= minD2) continue;
+    minD2 = d2[i];
+    closest = i;
+  }
+  return closest;
+} // geo::details::WireArrays::closestSegment()
+
+//------------------------------------------------------------------------------
+inline double geo::details::WireArrays::minDistanceFromAxis(std::size_t ref, double zero) const
+{
+  double const x0 = fCenterX[ref], y0 = fCenterY[ref], z0 = fCenterZ[ref];
+  double const ux = fDirX[ref], uy = fDirY[ref], uz = fDirZ[ref];
+  double const* __restrict__ const cx = centerX();
+  double const* __restrict__ const cy = centerY();
+  double const* __restrict__ const cz = centerZ();
+  double const zero2 = zero * zero;
+  double minD2 = std::numeric_limits<double>::max();
+  std::size_t const n = size();
+  for (std::size_t i = 0; i < n; ++i) {
+    double const px = cx[i] - x0, py = cy[i] - y0, pz = cz[i] - z0;
+    // squared norm of the cross product with the (unit) direction
+    double const qx = py * uz - pz * uy, qy = pz * ux - px * uz, qz = px * uy - py * ux;
+    double const d2 = qx * qx + qy * qy + qz * qz;
+    minD2 = (d2 < zero2 || d2 >= minD2) ? minD2 : d2;
+  }
+  return (minD2 == std::numeric_limits<double>::max()) ? minD2 : std::sqrt(minD2);
+} // geo::details::WireArrays::minDistanceFromAxis()
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREALG_GEOMETRY_DETAILS_WIREARRAYS_H
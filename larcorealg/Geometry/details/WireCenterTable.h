@@ -0,0 +1,189 @@
+/**
+ * @file   larcorealg/Geometry/details/WireCenterTable.h
+ * @brief  Nearest wire lookup on planes with non-uniform wire positions.
+ * @date   October 14, 2026
+ * @see    `geo::PlaneGeo::NearestWireNumber()`
+ *
+ * This is a header only library.
+ */
+
+#ifndef LARCOREALG_GEOMETRY_DETAILS_WIRECENTERTABLE_H
+#define LARCOREALG_GEOMETRY_DETAILS_WIRECENTERTABLE_H
+
+// LArSoft libraries
+#include "larcorealg/CoreUtils/MemoryUsage.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::sort(), std::lower_bound()
+#include <cmath>     // std::abs(), std::floor()
+#include <cstddef>   // std::size_t
+#include <numeric>   // std::iota()
+#include <utility>   // std::move()
+#include <vector>
+
+namespace geo::details {
+
+  /**
+   * @brief Wire coordinates of the centers of the wires of a plane, sorted.
+   *
+   * The nearest wire to a point is usually the wire coordinate of the point
+   * rounded to an integer, which holds as long as the wires are parallel and
+   * at a uniform pitch. On planes where they are not (gaps between groups of
+   * wires, wires shifted from their nominal position) this table gives the
+   * wire whose center is nearest, by a binary search on the coordinates of
+   * all the wires.
+   *
+   * The coordinates are in wire pitch units, as from
+   * `geo::PlaneGeo::WireCoordinate()`.
+   * A table built from a plane with uniform wires is empty (`empty()`), and it
+   * should not be used: the rounding is exact there, and faster.
+   */
+  class WireCenterTable {
+
+  public:
+    /// Type of wire number.
+    using WireNo_t = unsigned int;
+
+    /// Largest distance of a wire from its uniform position, in pitch units,
+    /// for the plane to be considered uniform.
+    static constexpr double UniformTolerance = 0.01;
+
+    /// Constructor: an empty table.
+    WireCenterTable() = default;
+
+    /**
+     * @brief Constructor: table from the coordinate of each wire.
+     * @param coords the wire coordinate of the center of wire `i` at index `i`
+     *
+     * If all the coordinates are within `UniformTolerance` from their wire
+     * number, the plane is uniform and the table is empty.
+     */
+    explicit WireCenterTable(std::vector<double> const& coords);
+
+    /**
+     * @brief Returns a table with the content of another one.
+     * @param coords the `n` sorted coordinates, as `sortedCoords()`
+     * @param wires the `n` wire numbers of the coordinates, as `sortedWires()`
+     * @param n the number of wires
+     *
+     * This restores a table which was saved elsewhere (e.g. in a file), and
+     * the content is not checked.
+     */
+    static WireCenterTable fromSorted(double const* coords, WireNo_t const* wires, std::size_t n);
+
+    /// Returns whether the table is empty (the plane has uniform wires).
+    bool empty() const { return fCoords.empty(); }
+
+    /// Returns the number of wires in the table.
+    std::size_t size() const { return fCoords.size(); }
+
+    /**
+     * @brief Returns the number of the wire with the nearest center.
+     * @param wireCoord the wire coordinate of the point
+     * @return the number of the wire, out of range if beyond the wires
+     *
+     * If the point is farther than half a pitch beyond the first or the last
+     * wire, the result is a negative number or a number not smaller than
+     * `size()`, extrapolated with a unit pitch from the outermost wire.
+     * Among two wires at the same distance, the one with larger coordinate is
+     * chosen, as the rounding of a uniform plane does.
+     * The table must not be empty.
+     */
+    int nearestWire(double wireCoord) const
+    {
+      return nearestWire(wireCoord, fCoords.data(), fWires.data(), size());
+    }
+
+    /**
+     * @brief Returns the number of the wire with the nearest center.
+     * @param wireCoord the wire coordinate of the point
+     * @param coords the `n` sorted coordinates, as `sortedCoords()`
+     * @param wires the `n` wire numbers of the coordinates, as `sortedWires()`
+     * @param n the number of wires (not `0`)
+     * @return the number of the wire, as `nearestWire(double) const`
+     *
+     * This is the lookup on a copy of the table (e.g. in a packed buffer).
+     */
+    static int nearestWire(double wireCoord,
+                           double const* coords,
+                           WireNo_t const* wires,
+                           std::size_t n);
+
+    /// Returns the wire coordinates of the centers, sorted (`size()` of them).
+    double const* sortedCoords() const { return fCoords.data(); }
+
+    /// Returns the number of the wire of each of the `sortedCoords()`.
+    WireNo_t const* sortedWires() const { return fWires.data(); }
+
+    /// Returns the memory allocated by the table.
+    std::size_t heapMemory() const
+    {
+      return lar::util::heapMemory(fCoords) + lar::util::heapMemory(fWires);
+    }
+
+  private:
+    std::vector<double> fCoords;  ///< Wire coordinates of the centers, sorted.
+    std::vector<WireNo_t> fWires; ///< Number of the wire of each coordinate.
+
+  }; // class WireCenterTable
+
+} // namespace geo::details
+
+//------------------------------------------------------------------------------
+//--- inline implementation
+//---
+inline geo::details::WireCenterTable::WireCenterTable(std::vector<double> const& coords)
+{
+  bool uniform = true;
+  for (std::size_t i = 0; i < coords.size(); ++i) {
+    if (std::abs(coords[i] - static_cast<double>(i)) <= UniformTolerance) continue;
+    uniform = false;
+    break;
+  }
+  if (uniform) return;
+
+  std::vector<WireNo_t> order(coords.size());
+  std::iota(order.begin(), order.end(), WireNo_t{0});
+  std::sort(order.begin(), order.end(), [&coords](WireNo_t a, WireNo_t b) {
+    return (coords[a] < coords[b]) || ((coords[a] == coords[b]) && (a < b));
+  });
+  fCoords.reserve(coords.size());
+  for (WireNo_t const wire : order)
+    fCoords.push_back(coords[wire]);
+  fWires = std::move(order);
+} // geo::details::WireCenterTable::WireCenterTable()
+
+//------------------------------------------------------------------------------
+inline geo::details::WireCenterTable geo::details::WireCenterTable::fromSorted(
+  double const* coords,
+  WireNo_t const* wires,
+  std::size_t n)
+{
+  WireCenterTable table;
+  table.fCoords.assign(coords, coords + n);
+  table.fWires.assign(wires, wires + n);
+  return table;
+} // geo::details::WireCenterTable::fromSorted()
+
+//------------------------------------------------------------------------------
+inline int geo::details::WireCenterTable::nearestWire(double wireCoord,
+                                                      double const* coords,
+                                                      WireNo_t const* wires,
+                                                      std::size_t n)
+{
+  double const first = coords[0], last = coords[n - 1];
+  if (wireCoord < first - 0.5) return static_cast<int>(std::floor(wireCoord - first + 0.5));
+  if (wireCoord >= last + 0.5)
+    return static_cast<int>(n) - 1 + static_cast<int>(std::floor(wireCoord - last + 0.5));
+
+  std::size_t i = std::lower_bound(coords, coords + n, wireCoord) - coords;
+  if (i == n)
+    --i;
+  else if ((i > 0) && (wireCoord - coords[i - 1] < coords[i] - wireCoord))
+    --i;
+  return static_cast<int>(wires[i]);
+} // geo::details::WireCenterTable::nearestWire()
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREALG_GEOMETRY_DETAILS_WIRECENTERTABLE_H
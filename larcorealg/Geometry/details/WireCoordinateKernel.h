@@ -0,0 +1,354 @@
+/**
+ * @file   larcorealg/Geometry/details/WireCoordinateKernel.h
+ * @brief  Wire coordinate and nearest wire of many points at once.
+ * @date   October 14, 2026
+ *
+ * This is a header only library.
+ */
+
+#ifndef LARCOREALG_GEOMETRY_DETAILS_WIRECOORDINATEKERNEL_H
+#define LARCOREALG_GEOMETRY_DETAILS_WIRECOORDINATEKERNEL_H
+
+// LArSoft libraries
+#include "larcorealg/CoreUtils/SimdDispatch.h" // LARCOREALG_SIMD_CLONES
+
+// C/C++ standard libraries
+#include <algorithm> // std::min(), std::max()
+#include <cmath>   // std::floor(), std::ceil(), std::abs()
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint8_t
+#include <utility> // std::pair
+
+namespace geo::details {
+
+  /**
+   * @brief Computes the wire coordinate of points on a wire plane.
+   *
+   * The wire coordinate of a point is the component of its displacement from
+   * the center of the first wire along the direction of increasing wire
+   * number, in units of wire pitch, as in `geo::PlaneGeo::WireCoordinate()`.
+   * This object has the parameters of the plane needed for it, and processes
+   * arrays of points in loops which the compiler can vectorize, compiled for
+   * each vector instruction set (`LARCOREALG_SIMD_CLONES`).
+   * The results are the same as the ones of the single point methods of
+   * `geo::PlaneGeo`.
+   *
+   * The nearest wire follows `geo::PlaneGeo::NearestWireID()`: instead of
+   * throwing when the point is out of the plane, the wire number is capped to
+   * the closest existing wire, and a flag tells whether that was required.
+   *
+   * The distance between wires along a direction (the "pitch" of a track
+   * step, for calorimetry) is also computed for arrays of directions, in 3D
+   * as `geo::PlaneGeo::InterWireDistance()` and projected on the plane as
+   * `geo::PlaneGeo::InterWireProjectedDistance()`.
+   */
+  struct WireCoordinateKernel {
+
+    using WireNo_t = unsigned int; ///< Type of wire number.
+
+    double origin[3];    ///< Center of the first wire.
+    double dir[3];       ///< Direction of increasing wire number (unit vector).
+    double wireDir[3];   ///< Direction of the wires (unit vector).
+    double pitch = 1.0;  ///< Wire pitch.
+    WireNo_t nWires = 0; ///< Number of wires in the plane.
+
+    /// Returns the wire coordinate of the point (`x`, `y`, `z`).
+    double wireCoordinate(double x, double y, double z) const
+    {
+      return ((x - origin[0]) * dir[0] + (y - origin[1]) * dir[1] + (z - origin[2]) * dir[2]) /
+             pitch;
+    }
+
+    /// Fills `coords` with the wire coordinates of `n` points given by their
+    /// coordinate arrays.
+    LARCOREALG_SIMD_CLONES
+    void wireCoordinates(std::size_t n,
+                         double const* __restrict__ x,
+                         double const* __restrict__ y,
+                         double const* __restrict__ z,
+                         double* __restrict__ coords) const;
+
+    /// Fills `coords` with the wire coordinates of the points in [`begin`, `end`[.
+    template <typename PointIter>
+    void wireCoordinates(PointIter begin, PointIter end, double* coords) const;
+
+    /**
+     * @brief Finds the wire nearest to each of `n` points.
+     * @param n number of points
+     * @param x array of the _x_ coordinates of the points
+     * @param y array of the _y_ coordinates of the points
+     * @param z array of the _z_ coordinates of the points
+     * @param[out] wires array for the nearest wire numbers, capped
+     * @param[out] valid array for the flags: `1` if the wire was not capped
+     */
+    LARCOREALG_SIMD_CLONES
+    void nearestWires(std::size_t n,
+                      double const* __restrict__ x,
+                      double const* __restrict__ y,
+                      double const* __restrict__ z,
+                      WireNo_t* __restrict__ wires,
+                      std::uint8_t* __restrict__ valid) const;
+
+    /// Finds the wire nearest to each of the points in [`begin`, `end`[.
+    template <typename PointIter>
+    void nearestWires(PointIter begin,
+                      PointIter end,
+                      WireNo_t* __restrict__ wires,
+                      std::uint8_t* __restrict__ valid) const;
+
+    /// Returns the 3D distance between wires along the direction (`dx`, `dy`, `dz`).
+    double interWireDistance(double dx, double dy, double dz) const
+    {
+      double const r = std::sqrt(dx * dx + dy * dy + dz * dz);
+      return r / std::abs(dx * dir[0] + dy * dir[1] + dz * dir[2]) * pitch;
+    }
+
+    /// Returns the distance between wires along the projection of (`dx`, `dy`,
+    /// `dz`) on the plane.
+    double interWireProjectedDistance(double dx, double dy, double dz) const
+    {
+      double const w = dx * wireDir[0] + dy * wireDir[1] + dz * wireDir[2];
+      double const s = dx * dir[0] + dy * dir[1] + dz * dir[2];
+      return std::sqrt(w * w + s * s) / std::abs(s) * pitch;
+    }
+
+    /**
+     * @brief Computes the distance between wires along each of `n` directions.
+     * @param n number of directions
+     * @param dx array of the _x_ components of the directions
+     * @param dy array of the _y_ components of the directions
+     * @param dz array of the _z_ components of the directions
+     * @param[out] pitches array for the distances (as `interWireDistance()`)
+     *
+     * The directions need not be normalized. Directions along the wires give
+     * infinite distances.
+     */
+    LARCOREALG_SIMD_CLONES
+    void interWireDistances(std::size_t n,
+                            double const* __restrict__ dx,
+                            double const* __restrict__ dy,
+                            double const* __restrict__ dz,
+                            double* __restrict__ pitches) const;
+
+    /// Fills `pitches` with the distances along the directions in [`begin`, `end`[.
+    template <typename VectorIter>
+    void interWireDistances(VectorIter begin, VectorIter end, double* pitches) const;
+
+    /// Computes the distance between wires along the projection on the plane of
+    /// each of `n` directions (as `interWireProjectedDistance()`).
+    LARCOREALG_SIMD_CLONES
+    void interWireProjectedDistances(std::size_t n,
+                                     double const* __restrict__ dx,
+                                     double const* __restrict__ dy,
+                                     double const* __restrict__ dz,
+                                     double* __restrict__ pitches) const;
+
+    /// Fills `pitches` with the projected distances along the directions in
+    /// [`begin`, `end`[.
+    template <typename VectorIter>
+    void interWireProjectedDistances(VectorIter begin, VectorIter end, double* pitches) const;
+
+    /**
+     * @brief Walks through the wire cells crossed by a segment.
+     * @param start coordinates of the start of the segment
+     * @param end coordinates of the end of the segment
+     * @param step callable as `step(wireNo, fraction)`
+     *
+     * The cell of a wire is the part of the plane closer to that wire than to
+     * the others, that is where the wire coordinate is within half a pitch of
+     * the wire number. `step()` is called for each cell crossed by the
+     * projection of the segment, in order from `start` to `end`, with the
+     * number of the wire and the fraction of the segment inside its cell.
+     * Cells of wires beyond the first and the last one are skipped.
+     * The boundaries of the cells are computed from the wire coordinates of
+     * the two ends only, with no search.
+     */
+    template <typename Step>
+    void walkCells(double const* start, double const* end, Step&& step) const;
+
+    /**
+     * @brief Returns the range of wire coordinates of the points of a box.
+     * @param lower coordinates of the lower corner of the box
+     * @param upper coordinates of the upper corner of the box
+     * @return the smallest and largest wire coordinate in the box
+     */
+    std::pair<double, double> boxCoordinateRange(double const* lower, double const* upper) const
+    {
+      double const center[3] = {
+        0.5 * (lower[0] + upper[0]), 0.5 * (lower[1] + upper[1]), 0.5 * (lower[2] + upper[2])};
+      double const spread = (std::abs(dir[0]) * (upper[0] - lower[0]) +
+                             std::abs(dir[1]) * (upper[1] - lower[1]) +
+                             std::abs(dir[2]) * (upper[2] - lower[2])) /
+                            (2.0 * pitch);
+      double const c = wireCoordinate(center[0], center[1], center[2]);
+      return {c - spread, c + spread};
+    }
+
+    /**
+     * @brief Returns the wires with wire coordinate within a range.
+     * @param cMin lower bound of the wire coordinate range
+     * @param cMax upper bound of the wire coordinate range
+     * @return the first wire in the range and the one after the last
+     *
+     * The range is empty (the two numbers are the same) if no wire number is
+     * within [`cMin`, `cMax`], or if `cMin` is larger than `cMax`.
+     */
+    std::pair<WireNo_t, WireNo_t> wiresInCoordinateRange(double cMin, double cMax) const
+    {
+      double const first = std::max(std::ceil(cMin), 0.0);
+      double const last = std::min(std::floor(cMax), double(nWires) - 1.0);
+      if (first > last) return {0U, 0U};
+      return {WireNo_t(first), WireNo_t(last) + 1U};
+    }
+
+  private:
+    /// Caps the wire number from the coordinate.
+    void capWire(double coord, WireNo_t& wire, std::uint8_t& valid) const
+    {
+      // same rounding as geo::PlaneGeo::NearestWireID()
+      int const wireNo = int(0.5 + coord);
+      int const lastWire = int(nWires) - 1;
+      valid = (wireNo >= 0) & (wireNo <= lastWire);
+      wire = WireNo_t((wireNo < 0) ? 0 : ((wireNo > lastWire) ? lastWire : wireNo));
+    }
+
+  }; // struct WireCoordinateKernel
+
+} // namespace geo::details
+
+//------------------------------------------------------------------------------
+//--- inline implementation
+//------------------------------------------------------------------------------
+inline void geo::details::WireCoordinateKernel::wireCoordinates(std::size_t n,
+                                                                double const* __restrict__ x,
+                                                                double const* __restrict__ y,
+                                                                double const* __restrict__ z,
+                                                                double* __restrict__ coords) const
+{
+  for (std::size_t i = 0; i < n; ++i)
+    coords[i] = wireCoordinate(x[i], y[i], z[i]);
+}
+
+//------------------------------------------------------------------------------
+template <typename PointIter>
+void geo::details::WireCoordinateKernel::wireCoordinates(PointIter begin,
+                                                         PointIter end,
+                                                         double* coords) const
+{
+  for (; begin != end; ++begin, ++coords)
+    *coords = wireCoordinate(begin->X(), begin->Y(), begin->Z());
+}
+
+//------------------------------------------------------------------------------
+inline void geo::details::WireCoordinateKernel::interWireDistances(
+  std::size_t n,
+  double const* __restrict__ dx,
+  double const* __restrict__ dy,
+  double const* __restrict__ dz,
+  double* __restrict__ pitches) const
+{
+  for (std::size_t i = 0; i < n; ++i)
+    pitches[i] = interWireDistance(dx[i], dy[i], dz[i]);
+}
+
+//------------------------------------------------------------------------------
+template <typename VectorIter>
+void geo::details::WireCoordinateKernel::interWireDistances(VectorIter begin,
+                                                            VectorIter end,
+                                                            double* pitches) const
+{
+  for (; begin != end; ++begin, ++pitches)
+    *pitches = interWireDistance(begin->X(), begin->Y(), begin->Z());
+}
+
+//------------------------------------------------------------------------------
+inline void geo::details::WireCoordinateKernel::interWireProjectedDistances(
+  std::size_t n,
+  double const* __restrict__ dx,
+  double const* __restrict__ dy,
+  double const* __restrict__ dz,
+  double* __restrict__ pitches) const
+{
+  for (std::size_t i = 0; i < n; ++i)
+    pitches[i] = interWireProjectedDistance(dx[i], dy[i], dz[i]);
+}
+
+//------------------------------------------------------------------------------
+template <typename VectorIter>
+void geo::details::WireCoordinateKernel::interWireProjectedDistances(VectorIter begin,
+                                                                     VectorIter end,
+                                                                     double* pitches) const
+{
+  for (; begin != end; ++begin, ++pitches)
+    *pitches = interWireProjectedDistance(begin->X(), begin->Y(), begin->Z());
+}
+
+//------------------------------------------------------------------------------
+inline void geo::details::WireCoordinateKernel::nearestWires(std::size_t n,
+                                                             double const* __restrict__ x,
+                                                             double const* __restrict__ y,
+                                                             double const* __restrict__ z,
+                                                             WireNo_t* __restrict__ wires,
+                                                             std::uint8_t* __restrict__ valid) const
+{
+  for (std::size_t i = 0; i < n; ++i)
+    capWire(wireCoordinate(x[i], y[i], z[i]), wires[i], valid[i]);
+}
+
+//------------------------------------------------------------------------------
+template <typename PointIter>
+void geo::details::WireCoordinateKernel::nearestWires(PointIter begin,
+                                                      PointIter end,
+                                                      WireNo_t* __restrict__ wires,
+                                                      std::uint8_t* __restrict__ valid) const
+{
+  for (; begin != end; ++begin, ++wires, ++valid)
+    capWire(wireCoordinate(begin->X(), begin->Y(), begin->Z()), *wires, *valid);
+}
+
+//------------------------------------------------------------------------------
+template <typename Step>
+void geo::details::WireCoordinateKernel::walkCells(double const* start,
+                                                   double const* end,
+                                                   Step&& step) const
+{
+  if (nWires == 0) return;
+  double const c0 = wireCoordinate(start[0], start[1], start[2]);
+  double const c1 = wireCoordinate(end[0], end[1], end[2]);
+  long long const w0 = static_cast<long long>(std::floor(c0 + 0.5));
+  long long const w1 = static_cast<long long>(std::floor(c1 + 0.5));
+  long long const lastWire = static_cast<long long>(nWires) - 1;
+
+  if (w0 == w1) { // includes the segments parallel to the wires
+    if ((w0 >= 0) && (w0 <= lastWire)) step(WireNo_t(w0), 1.0);
+    return;
+  }
+
+  // cell boundaries along the segment: t = (c - c0) / (c1 - c0)
+  long long const dir = (w1 > w0) ? +1 : -1;
+  double const halfStep = 0.5 * dir;
+  double const invDelta = 1.0 / (c1 - c0);
+  long long first = w0, last = w1;
+  if (dir > 0) {
+    if (first < 0) first = 0;
+    if (last > lastWire) last = lastWire;
+    if (first > last) return;
+  }
+  else {
+    if (first > lastWire) first = lastWire;
+    if (last < 0) last = 0;
+    if (first < last) return;
+  }
+
+  double tIn = (first == w0) ? 0.0 : (first - halfStep - c0) * invDelta;
+  for (long long w = first;; w += dir) {
+    double const tOut = (w == w1) ? 1.0 : (w + halfStep - c0) * invDelta;
+    step(WireNo_t(w), tOut - tIn);
+    if (w == last) break;
+    tIn = tOut;
+  } // for
+} // geo::details::WireCoordinateKernel::walkCells()
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREALG_GEOMETRY_DETAILS_WIRECOORDINATEKERNEL_H
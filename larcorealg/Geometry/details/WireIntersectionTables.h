@@ -0,0 +1,387 @@
+/**
+ * @file   larcorealg/Geometry/details/WireIntersectionTables.h
+ * @brief  Precomputed coefficients for the intersection of wires of a TPC.
+ * @date   October 14, 2026
+ *
+ * This is a header only library.
+ */
+
+#ifndef LARCOREALG_GEOMETRY_DETAILS_WIREINTERSECTIONTABLES_H
+#define LARCOREALG_GEOMETRY_DETAILS_WIREINTERSECTIONTABLES_H
+
+// LArSoft libraries
+#include "larcorealg/CoreUtils/MemoryUsage.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::swap(), std::min(), std::max()
+#include <array>
+#include <cassert>
+#include <cmath>   // std::abs(), std::floor(), std::ceil()
+#include <cstddef> // std::size_t
+#include <utility> // std::pair
+#include <vector>
+
+namespace geo::details {
+
+  /**
+   * @brief Intersections of wires of different planes as functions of their number.
+   *
+   * In a plane where all the wires are parallel and evenly spaced, the line of
+   * wire number `i` is the line of wire `0` shifted by `i` times a fixed step.
+   * Then the point of wire `i` of plane A closest to wire `j` of plane B, and
+   * its distance from the centers of the two wires, are affine functions of
+   * `i` and `j`, whose coefficients depend only on the two planes.
+   *
+   * This object computes those coefficients for each ordered pair of planes of
+   * a TPC (`build()`), and gives the same result as
+   * `geo::WiresIntersectionAndOffsets()` with a few multiplications
+   * (`crossing()`). It also stores, for each wire `j` of plane B, the range of
+   * wires of plane A which cross it within the length of both (`crossingWires()`).
+   *
+   * A plane qualifies only if all its wires point in the same direction, and
+   * their centers are displaced (in the direction orthogonal to the wires) by
+   * multiples of the same step, both within tolerances (`PositionTolerance`,
+   * `DirectionTolerance`) that guarantee that the results match the ones
+   * computed from the actual wires to about the same precision.
+   * Pairs of planes with a non-qualifying plane or with parallel wires are not
+   * available (`hasPlanePair()`), and the generic algorithms should be used.
+   *
+   * The planes are required to provide `Nwires()` and `Wire(i)`, and their
+   * wires `GetCenter()`, `Direction()` (a unit vector) and `HalfL()`, as
+   * `geo::PlaneGeo` and `geo::WireGeo` do. The crossing wire ranges assume
+   * that the wires of a plane cover a convex region, as is the case for
+   * rectangular planes.
+   */
+  class WireIntersectionTables {
+
+  public:
+    /// Type of wire number.
+    using WireNo_t = unsigned int;
+
+    /// Type of coordinates of a point or a vector.
+    using Coords_t = std::array<double, 3U>;
+
+    /// Range `[ first, second [` of wire numbers.
+    using WireRange_t = std::pair<WireNo_t, WireNo_t>;
+
+    /// Result of the intersection of two wires.
+    struct Crossing_t {
+      Coords_t point;   ///< Point on the first wire closest to the second one.
+      double offsetA;   ///< Distance of `point` from the center of the first wire.
+      double offsetB;   ///< Distance from the center of the second wire.
+      bool within;      ///< Whether `point` is within both the wires.
+    };
+
+    /// Largest allowed displacement of a wire from its expected position [cm].
+    static constexpr double PositionTolerance = 1e-4;
+
+    /// Largest allowed difference between the directions of two wires.
+    static constexpr double DirectionTolerance = 1e-6;
+
+    /// Computes the tables for all the pairs of `planes`.
+    template <typename Planes>
+    void build(Planes const& planes);
+
+    /// Removes all the tables.
+    void clear();
+
+    /// Returns the number of planes the tables were built for.
+    std::size_t nPlanes() const { return fPlanes.size(); }
+
+    /// Returns whether the pair of planes `a` and `b` has tables.
+    bool hasPlanePair(std::size_t a, std::size_t b) const
+    {
+      return (a < nPlanes()) && (b < nPlanes()) && fPairs[pairIndex(a, b)].valid;
+    }
+
+    /**
+     * @brief Returns the intersection of wire `i` of plane `a` with wire `j` of plane `b`.
+     * @see `geo::WiresIntersectionAndOffsets()`
+     *
+     * The result is undefined if `hasPlanePair(a, b)` is `false` or the wires
+     * do not exist.
+     */
+    Crossing_t crossing(std::size_t a, WireNo_t i, std::size_t b, WireNo_t j) const;
+
+    /**
+     * @brief Returns the wires of plane `a` crossing wire `j` of plane `b`.
+     * @return the range of wire numbers on plane `a` (empty if none)
+     *
+     * The wires in the range are the ones for which `crossing(a, i, b, j)`
+     * reports the intersection `within` the two wires.
+     * The result is undefined if `hasPlanePair(a, b)` is `false` or the wire
+     * `j` does not exist.
+     */
+    WireRange_t crossingWires(std::size_t a, std::size_t b, WireNo_t j) const
+    {
+      return fPairs[pairIndex(a, b)].ranges[j];
+    }
+
+    /// Returns the direction of the wires of plane `a` (which must qualify).
+    Coords_t const& wireDirection(std::size_t a) const { return fPlanes[a].dir; }
+
+    /// Returns the center of wire `i` of plane `a` (which must qualify).
+    Coords_t wireCenter(std::size_t a, WireNo_t i) const;
+
+    /// Returns the half length of wire `i` of plane `a` (which must qualify).
+    double wireHalfLength(std::size_t a, WireNo_t i) const { return fPlanes[a].halfLengths[i]; }
+
+    /**
+     * @brief Returns the wire coordinate of `point` on plane `a`.
+     * @return the (fractional) number of the wire closest to the point
+     *
+     * The point is projected on the plane along the wire direction, and the
+     * result is not bound to the existing wires. Plane `a` must qualify.
+     */
+    double wireCoordinate(std::size_t a, Coords_t const& point) const;
+
+    /// Returns the memory allocated by the tables, besides their own size [bytes]
+    std::size_t heapMemory() const
+    {
+      return lar::util::heapMemory(fPlanes) + lar::util::heapMemory(fPairs);
+    }
+
+  private:
+    /// Description of the wires of a plane.
+    struct PlaneLayout_t {
+      bool uniform = false;             ///< Whether the wires are as required.
+      Coords_t dir{};                   ///< Common direction of the wires.
+      Coords_t origin{};                ///< Center of the first wire.
+      Coords_t step{};                  ///< Shift between consecutive wires.
+      std::vector<double> centerShifts; ///< Shift of each center along `dir`.
+      std::vector<double> halfLengths;  ///< Half length of each wire.
+
+      std::size_t heapMemory() const
+      {
+        return lar::util::heapMemory(centerShifts) + lar::util::heapMemory(halfLengths);
+      }
+    };
+
+    /// Function `c0 + ci * i + cj * j`.
+    struct Linear_t {
+      double c0 = 0.0, ci = 0.0, cj = 0.0;
+      double operator()(WireNo_t i, WireNo_t j) const { return c0 + ci * i + cj * j; }
+    };
+
+    /// Coefficients for a ordered pair of planes.
+    struct PlanePair_t {
+      bool valid = false;
+      Linear_t offsetA; ///< Position of the crossing on the wire of plane A.
+      Linear_t offsetB; ///< Position of the crossing on the wire of plane B.
+      std::vector<WireRange_t> ranges; ///< Crossing wires on A for each B wire.
+
+      std::size_t heapMemory() const { return lar::util::heapMemory(ranges); }
+    };
+
+    std::vector<PlaneLayout_t> fPlanes; ///< Layout of each plane.
+    std::vector<PlanePair_t> fPairs;    ///< Coefficients, by pair of planes.
+
+    std::size_t pairIndex(std::size_t a, std::size_t b) const { return a * nPlanes() + b; }
+
+    /// Extracts the layout of the wires of a plane.
+    template <typename Plane>
+    static PlaneLayout_t makeLayout(Plane const& plane);
+
+    /// Computes the coefficients for planes `a` and `b`.
+    void buildPair(std::size_t a, std::size_t b);
+
+    /// Returns the wires of `a` crossing wire `j` of `b`.
+    WireRange_t computeCrossingWires(std::size_t a, std::size_t b, WireNo_t j) const;
+
+    static double dot(Coords_t const& u, Coords_t const& v)
+    {
+      return u[0] * v[0] + u[1] * v[1] + u[2] * v[2];
+    }
+
+    template <typename Vector>
+    static Coords_t coords(Vector const& v)
+    {
+      return {v.X(), v.Y(), v.Z()};
+    }
+
+  }; // class WireIntersectionTables
+
+} // namespace geo::details
+
+//------------------------------------------------------------------------------
+//---  template implementation
+//------------------------------------------------------------------------------
+template <typename Planes>
+void geo::details::WireIntersectionTables::build(Planes const& planes)
+{
+  clear();
+  for (auto const& plane : planes)
+    fPlanes.push_back(makeLayout(plane));
+  fPairs.resize(nPlanes() * nPlanes());
+  for (std::size_t a = 0; a < nPlanes(); ++a) {
+    for (std::size_t b = 0; b < nPlanes(); ++b)
+      if (a != b) buildPair(a, b);
+  }
+} // geo::details::WireIntersectionTables::build()
+
+//------------------------------------------------------------------------------
+template <typename Plane>
+auto geo::details::WireIntersectionTables::makeLayout(Plane const& plane) -> PlaneLayout_t
+{
+  PlaneLayout_t layout;
+  WireNo_t const nWires = plane.Nwires();
+  if (nWires == 0) return layout;
+
+  layout.dir = coords(plane.Wire(0).Direction());
+  layout.origin = coords(plane.Wire(0).GetCenter());
+
+  // component of the displacement from the first wire, orthogonal to the wires
+  auto const displacement = [&layout](Coords_t const& center) {
+    Coords_t d{center[0] - layout.origin[0],
+               center[1] - layout.origin[1],
+               center[2] - layout.origin[2]};
+    double const along = dot(d, layout.dir);
+    for (std::size_t k = 0; k < 3U; ++k)
+      d[k] -= along * layout.dir[k];
+    return std::pair{d, along};
+  };
+
+  if (nWires > 1) {
+    auto const [last, along] = displacement(coords(plane.Wire(nWires - 1).GetCenter()));
+    for (std::size_t k = 0; k < 3U; ++k)
+      layout.step[k] = last[k] / (nWires - 1);
+  }
+
+  layout.centerShifts.reserve(nWires);
+  layout.halfLengths.reserve(nWires);
+  for (WireNo_t i = 0; i < nWires; ++i) {
+    auto const& wire = plane.Wire(i);
+    Coords_t const dir = coords(wire.Direction());
+    auto const [shift, along] = displacement(coords(wire.GetCenter()));
+    for (std::size_t k = 0; k < 3U; ++k) {
+      if (std::abs(dir[k] - layout.dir[k]) > DirectionTolerance) return layout;
+      if (std::abs(shift[k] - i * layout.step[k]) > PositionTolerance) return layout;
+    }
+    layout.centerShifts.push_back(along);
+    layout.halfLengths.push_back(wire.HalfL());
+  } // for wires
+
+  layout.uniform = true;
+  return layout;
+} // geo::details::WireIntersectionTables::makeLayout()
+
+//------------------------------------------------------------------------------
+inline void geo::details::WireIntersectionTables::clear()
+{
+  fPlanes.clear();
+  fPairs.clear();
+}
+
+//------------------------------------------------------------------------------
+inline void geo::details::WireIntersectionTables::buildPair(std::size_t a, std::size_t b)
+{
+  PlaneLayout_t const& A = fPlanes[a];
+  PlaneLayout_t const& B = fPlanes[b];
+  PlanePair_t& pair = fPairs[pairIndex(a, b)];
+  if (!A.uniform || !B.uniform) return;
+
+  // closest points between the lines `qA + tA dA` and `qB + tB dB`,
+  // with `qA = originA + i stepA` and `qB = originB + j stepB`:
+  // tA = r.uA and tB = -r.uB with `r = qB - qA`
+  double const c = dot(A.dir, B.dir);
+  double const den = 1.0 - c * c;
+  if (den < 1e-12) return; // parallel wires
+  Coords_t uA, uB, r0;
+  for (std::size_t k = 0; k < 3U; ++k) {
+    uA[k] = (A.dir[k] - c * B.dir[k]) / den;
+    uB[k] = (B.dir[k] - c * A.dir[k]) / den;
+    r0[k] = B.origin[k] - A.origin[k];
+  }
+  pair.offsetA = {dot(r0, uA), -dot(A.step, uA), dot(B.step, uA)};
+  pair.offsetB = {-dot(r0, uB), dot(A.step, uB), -dot(B.step, uB)};
+  pair.valid = true;
+
+  WireNo_t const nWiresB = B.halfLengths.size();
+  pair.ranges.reserve(nWiresB);
+  for (WireNo_t j = 0; j < nWiresB; ++j)
+    pair.ranges.push_back(computeCrossingWires(a, b, j));
+} // geo::details::WireIntersectionTables::buildPair()
+
+//------------------------------------------------------------------------------
+inline auto geo::details::WireIntersectionTables::crossing(std::size_t a,
+                                                           WireNo_t i,
+                                                           std::size_t b,
+                                                           WireNo_t j) const -> Crossing_t
+{
+  PlaneLayout_t const& A = fPlanes[a];
+  PlaneLayout_t const& B = fPlanes[b];
+  PlanePair_t const& pair = fPairs[pairIndex(a, b)];
+  assert(pair.valid);
+
+  double const tA = pair.offsetA(i, j);
+  double const tB = pair.offsetB(i, j);
+  Crossing_t result;
+  for (std::size_t k = 0; k < 3U; ++k)
+    result.point[k] = A.origin[k] + i * A.step[k] + tA * A.dir[k];
+  result.offsetA = tA - A.centerShifts[i];
+  result.offsetB = tB - B.centerShifts[j];
+  result.within =
+    (std::abs(result.offsetA) <= A.halfLengths[i]) && (std::abs(result.offsetB) <= B.halfLengths[j]);
+  return result;
+} // geo::details::WireIntersectionTables::crossing()
+
+//------------------------------------------------------------------------------
+inline auto geo::details::WireIntersectionTables::wireCenter(std::size_t a, WireNo_t i) const
+  -> Coords_t
+{
+  PlaneLayout_t const& A = fPlanes[a];
+  double const shift = A.centerShifts[i];
+  return {A.origin[0] + i * A.step[0] + shift * A.dir[0],
+          A.origin[1] + i * A.step[1] + shift * A.dir[1],
+          A.origin[2] + i * A.step[2] + shift * A.dir[2]};
+} // geo::details::WireIntersectionTables::wireCenter()
+
+//------------------------------------------------------------------------------
+inline double geo::details::WireIntersectionTables::wireCoordinate(std::size_t a,
+                                                                   Coords_t const& point) const
+{
+  PlaneLayout_t const& A = fPlanes[a];
+  double const step2 = dot(A.step, A.step);
+  if (step2 == 0.0) return 0.0; // single wire plane
+  Coords_t const d{point[0] - A.origin[0], point[1] - A.origin[1], point[2] - A.origin[2]};
+  return dot(d, A.step) / step2;
+} // geo::details::WireIntersectionTables::wireCoordinate()
+
+//------------------------------------------------------------------------------
+inline auto geo::details::WireIntersectionTables::computeCrossingWires(std::size_t a,
+                                                                       std::size_t b,
+                                                                       WireNo_t j) const
+  -> WireRange_t
+{
+  PlaneLayout_t const& A = fPlanes[a];
+  PlaneLayout_t const& B = fPlanes[b];
+  PlanePair_t const& pair = fPairs[pairIndex(a, b)];
+  WireNo_t const nWiresA = A.halfLengths.size();
+  if (nWiresA == 0) return {0U, 0U};
+
+  // the crossing is within wire `j` for an interval of `i`
+  // (which we extend by one on each side to be safe from rounding)...
+  double iMin = 0.0, iMax = nWiresA - 1.0;
+  if (pair.offsetB.ci != 0.0) {
+    double const base = pair.offsetB.cj * j + pair.offsetB.c0 - B.centerShifts[j];
+    double lower = (-B.halfLengths[j] - base) / pair.offsetB.ci;
+    double upper = (B.halfLengths[j] - base) / pair.offsetB.ci;
+    if (lower > upper) std::swap(lower, upper);
+    iMin = std::max(iMin, std::floor(lower) - 1.0);
+    iMax = std::min(iMax, std::ceil(upper) + 1.0);
+  }
+  if (iMin > iMax) return {0U, 0U};
+
+  // ... and then we drop the wires at the edges not passing the full check
+  WireNo_t first = static_cast<WireNo_t>(iMin);
+  WireNo_t last = static_cast<WireNo_t>(iMax) + 1U; // past the end
+  while ((first < last) && !crossing(a, first, b, j).within)
+    ++first;
+  while ((last > first) && !crossing(a, last - 1U, b, j).within)
+    --last;
+  return (first < last) ? WireRange_t{first, last} : WireRange_t{0U, 0U};
+} // geo::details::WireIntersectionTables::computeCrossingWires()
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREALG_GEOMETRY_DETAILS_WIREINTERSECTIONTABLES_H
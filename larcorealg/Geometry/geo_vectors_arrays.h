@@ -0,0 +1,724 @@
+/**
+ * @file   larcorealg/Geometry/geo_vectors_arrays.h
+ * @brief  Collections of geometry vectors with coordinates in columns.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/geo_vectors_utils.h`
+ * @ingroup Geometry
+ *
+ * This library provides containers of points and vectors storing each of the
+ * coordinates in its own aligned array ("structure of arrays"), views with the
+ * same interface on existing `std::vector` of geometry vectors, and bulk
+ * operations on both, written in loops that the compiler can vectorize,
+ * including the principal axes of point sets.
+ *
+ * This is a header-only library, which depends on ROOT GenVector.
+ */
+
+#ifndef LARCOREALG_GEOMETRY_GEO_VECTORS_ARRAYS_H
+#define LARCOREALG_GEOMETRY_GEO_VECTORS_ARRAYS_H
+
+// LArSoft libraries
+#include "larcorealg/Geometry/geo_vectors_utils.h"
+#include "larcoreobj/SimpleTypesAndConstants/geo_vectors.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::min(), std::max(), std::clamp()
+#include <array>
+#include <cmath> // std::sqrt(), std::cos(), std::acos()
+#include <cstddef>   // std::size_t
+#include <limits>
+#include <new> // std::align_val_t
+#include <type_traits>
+#include <utility> // std::pair, std::swap()
+#include <vector>
+
+namespace geo::vect {
+
+  /// Alignment of the coordinate columns of `geo::vect::CoordArraySoA` [bytes].
+  inline constexpr std::size_t CoordArrayAlignment = 64;
+
+  namespace details {
+
+    /// Allocator of memory aligned to `Align` bytes.
+    template <typename T, std::size_t Align>
+    struct AlignedAllocator {
+      using value_type = T;
+
+      template <typename U>
+      struct rebind {
+        using other = AlignedAllocator<U, Align>;
+      };
+
+      AlignedAllocator() = default;
+      template <typename U>
+      AlignedAllocator(AlignedAllocator<U, Align> const&) noexcept
+      {}
+
+      T* allocate(std::size_t n)
+      {
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t{Align}));
+      }
+      void deallocate(T* p, std::size_t) noexcept { ::operator delete(p, std::align_val_t{Align}); }
+
+      template <typename U>
+      bool operator==(AlignedAllocator<U, Align> const&) const noexcept
+      {
+        return true;
+      }
+      template <typename U>
+      bool operator!=(AlignedAllocator<U, Align> const&) const noexcept
+      {
+        return false;
+      }
+    }; // AlignedAllocator
+
+    /// Whether the three `double` coordinates of `Vector` are all its content.
+    template <typename Vector>
+    constexpr bool hasPackedCoords = std::is_standard_layout_v<Vector> &&
+                                     std::is_same_v<coordinate_t<Vector>, double> &&
+                                     (sizeof(Vector) == 3 * sizeof(double));
+
+  } // namespace details
+
+  //----------------------------------------------------------------------------
+  /**
+   * @brief Collection of 3D vectors with the coordinates in separate columns.
+   * @tparam Vector type of the vectors in the collection
+   *
+   * The three coordinates of the elements are stored in three arrays, aligned
+   * to `CoordArrayAlignment` bytes. The elements can't be accessed by
+   * reference: `operator[]` returns a copy, and `set()` changes an element.
+   * The columns are directly available via `xs()`, `ys()` and `zs()`.
+   *
+   * This object can be used in the bulk operations in `geo::vect::bulk`.
+   *
+   * Example:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * geo::vect::PointArraySoA points{ hits.begin(), hits.end() };
+   * geo::vect::bulk::translate(points, -vertex);
+   * std::vector<double> along(points.size());
+   * geo::vect::bulk::dot(points, direction, along.data());
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   */
+  template <typename Vector>
+  class CoordArraySoA {
+  public:
+    using Vector_t = Vector; ///< Type of the elements.
+
+    /// Type of a column of coordinates.
+    using Column_t = std::vector<double, details::AlignedAllocator<double, CoordArrayAlignment>>;
+
+    /// Distance between the coordinates of consecutive elements in a column.
+    static constexpr std::size_t Stride = 1;
+
+    /// Constructor: an empty collection.
+    CoordArraySoA() = default;
+
+    /// Constructor: `n` null elements.
+    explicit CoordArraySoA(std::size_t n) : fX(n, 0.0), fY(n, 0.0), fZ(n, 0.0) {}
+
+    /// Constructor: copies the vectors in [`begin`, `end`[.
+    template <typename Iter>
+    CoordArraySoA(Iter begin, Iter end)
+    {
+      for (; begin != end; ++begin)
+        push_back(*begin);
+    }
+
+    /// Constructor: copies all the vectors in `v`.
+    explicit CoordArraySoA(std::vector<Vector_t> const& v) : CoordArraySoA(v.begin(), v.end()) {}
+
+    /// Returns the number of elements.
+    std::size_t size() const { return fX.size(); }
+
+    /// Returns whether there is no element.
+    bool empty() const { return fX.empty(); }
+
+    /// Prepares room for `n` elements.
+    void reserve(std::size_t n)
+    {
+      fX.reserve(n);
+      fY.reserve(n);
+      fZ.reserve(n);
+    }
+
+    /// Changes the number of elements to `n`; new elements are null.
+    void resize(std::size_t n)
+    {
+      fX.resize(n, 0.0);
+      fY.resize(n, 0.0);
+      fZ.resize(n, 0.0);
+    }
+
+    /// Removes all the elements.
+    void clear()
+    {
+      fX.clear();
+      fY.clear();
+      fZ.clear();
+    }
+
+    /// Adds a copy of `v` at the end of the collection.
+    template <typename V>
+    void push_back(V const& v)
+    {
+      fX.push_back(v.X());
+      fY.push_back(v.Y());
+      fZ.push_back(v.Z());
+    }
+
+    /// Returns a copy of the element `i`.
+    Vector_t operator[](std::size_t i) const { return {fX[i], fY[i], fZ[i]}; }
+
+    /// Sets the element `i` to `v`.
+    template <typename V>
+    void set(std::size_t i, V const& v)
+    {
+      fX[i] = v.X();
+      fY[i] = v.Y();
+      fZ[i] = v.Z();
+    }
+
+    /// Returns a vector with copies of all the elements.
+    std::vector<Vector_t> toVector() const
+    {
+      std::vector<Vector_t> v;
+      v.reserve(size());
+      for (std::size_t i = 0; i < size(); ++i)
+        v.push_back((*this)[i]);
+      return v;
+    }
+
+    /// @{
+    /// @name Access to the columns
+    double const* xs() const { return fX.data(); }
+    double const* ys() const { return fY.data(); }
+    double const* zs() const { return fZ.data(); }
+    double* xs() { return fX.data(); }
+    double* ys() { return fY.data(); }
+    double* zs() { return fZ.data(); }
+    /// @}
+
+  private:
+    Column_t fX; ///< _x_ coordinates of all elements.
+    Column_t fY; ///< _y_ coordinates of all elements.
+    Column_t fZ; ///< _z_ coordinates of all elements.
+
+  }; // class CoordArraySoA
+
+  /// Collection of points with the coordinates in separate columns.
+  using PointArraySoA = CoordArraySoA<geo::Point_t>;
+
+  /// Collection of displacement vectors with the coordinates in separate columns.
+  using VectorArraySoA = CoordArraySoA<geo::Vector_t>;
+
+  //----------------------------------------------------------------------------
+  /**
+   * @brief View of a sequence of 3D vectors as coordinate columns.
+   * @tparam Vector type of the vectors in the sequence
+   * @tparam Coord type of the coordinates (`double const` for a constant view)
+   *
+   * The view presents the same column interface as `CoordArraySoA`, with no
+   * copy, on a contiguous sequence of vectors whose only content is their
+   * three `double` coordinates (as it is for `geo::Point_t` and
+   * `geo::Vector_t`): the columns are interleaved, with a `Stride` of three.
+   * The sequence must not change size while the view is in use.
+   *
+   * Views are created with `geo::vect::makeCoordView()`.
+   */
+  template <typename Vector, typename Coord = double const>
+  class CoordArrayView {
+    static_assert(details::hasPackedCoords<Vector>,
+                  "CoordArrayView requires a vector made only of three double coordinates");
+
+  public:
+    using Vector_t = Vector; ///< Type of the elements.
+
+    /// Distance between the coordinates of consecutive elements in a column.
+    static constexpr std::size_t Stride = 3;
+
+    /// Constructor: view of the `n` vectors starting at `first`.
+    CoordArrayView(Coord* first, std::size_t n) : fFirst(first), fSize(n) {}
+
+    /// Returns the number of elements.
+    std::size_t size() const { return fSize; }
+
+    /// Returns whether there is no element.
+    bool empty() const { return fSize == 0; }
+
+    /// Returns a copy of the element `i`.
+    Vector_t operator[](std::size_t i) const
+    {
+      return {fFirst[Stride * i], fFirst[Stride * i + 1], fFirst[Stride * i + 2]};
+    }
+
+    /// @{
+    /// @name Access to the (interleaved) columns
+    Coord* xs() const { return fFirst; }
+    Coord* ys() const { return fFirst + 1; }
+    Coord* zs() const { return fFirst + 2; }
+    /// @}
+
+  private:
+    Coord* fFirst;     ///< _x_ coordinate of the first vector.
+    std::size_t fSize; ///< Number of vectors.
+
+  }; // class CoordArrayView
+
+  /// Returns a constant view of the coordinates of the vectors in `v`.
+  template <typename Vector>
+  CoordArrayView<Vector> makeCoordView(std::vector<Vector> const& v)
+  {
+    static_assert(details::hasPackedCoords<Vector>);
+    return {reinterpret_cast<double const*>(v.data()), v.size()};
+  }
+
+  /// Returns a view of the coordinates of the vectors in `v`, allowing changes.
+  template <typename Vector>
+  CoordArrayView<Vector, double> makeCoordView(std::vector<Vector>& v)
+  {
+    static_assert(details::hasPackedCoords<Vector>);
+    return {reinterpret_cast<double*>(v.data()), v.size()};
+  }
+
+  //----------------------------------------------------------------------------
+  /**
+   * @brief Principal axes of a set of points.
+   * @see `geo::vect::bulk::principalAxes()`
+   *
+   * The axes are the eigenvectors of the covariance matrix of the points,
+   * sorted by decreasing eigenvalue, that is by decreasing variance of the
+   * points along them: for a track-like cluster, `axes[0]` is its direction.
+   * The axes have unit length and form a right-handed frame; the sign of the
+   * first two is arbitrary.
+   */
+  struct PrincipalAxes_t {
+    geo::Point_t center;               ///< Weighted mean of the points.
+    std::array<double, 3> variances{}; ///< Eigenvalues of the covariance, decreasing.
+    std::array<geo::Vector_t, 3> axes; ///< Unit principal axes, matching `variances`.
+    double weight = 0.0;               ///< Total weight (number of points if unweighted).
+
+    /// Returns whether there were no points (or their total weight is not positive).
+    bool empty() const { return !(weight > 0.0); }
+  }; // PrincipalAxes_t
+
+  namespace details {
+
+    using Vec3_t = std::array<double, 3>;
+
+    inline Vec3_t cross3(Vec3_t const& a, Vec3_t const& b)
+    {
+      return {a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2], a[0] * b[1] - a[1] * b[0]};
+    }
+
+    inline double dot3(Vec3_t const& a, Vec3_t const& b)
+    {
+      return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+    }
+
+    /// Product of the symmetric matrix `a` (xx, xy, xz, yy, yz, zz) and `v`.
+    inline Vec3_t symmetricTimes(double const* a, Vec3_t const& v)
+    {
+      return {a[0] * v[0] + a[1] * v[1] + a[2] * v[2],
+              a[1] * v[0] + a[3] * v[1] + a[4] * v[2],
+              a[2] * v[0] + a[4] * v[1] + a[5] * v[2]};
+    }
+
+    /// Unit eigenvector of the symmetric `a` for its simple eigenvalue `lambda`.
+    inline Vec3_t symmetricEigenvector0(double const* a, double lambda)
+    {
+      // the rows of `a - lambda` span a plane: their largest cross product is normal to it
+      Vec3_t const row0{a[0] - lambda, a[1], a[2]};
+      Vec3_t const row1{a[1], a[3] - lambda, a[4]};
+      Vec3_t const row2{a[2], a[4], a[5] - lambda};
+      std::array<Vec3_t, 3> const c{cross3(row0, row1), cross3(row0, row2), cross3(row1, row2)};
+      std::size_t best = 0;
+      double bestSq = dot3(c[0], c[0]);
+      for (std::size_t i = 1; i < 3; ++i) {
+        double const sq = dot3(c[i], c[i]);
+        if (sq > bestSq) {
+          bestSq = sq;
+          best = i;
+        }
+      }
+      double const inv = 1.0 / std::sqrt(bestSq);
+      return {c[best][0] * inv, c[best][1] * inv, c[best][2] * inv};
+    }
+
+    /// Unit eigenvector of the symmetric `a` for `lambda`, orthogonal to the eigenvector `w`.
+    inline Vec3_t symmetricEigenvector1(double const* a, Vec3_t const& w, double lambda)
+    {
+      // orthonormal basis (u, v) of the plane orthogonal to `w`, and the 2x2 problem in it
+      Vec3_t u;
+      if (std::abs(w[0]) > std::abs(w[1])) {
+        double const inv = 1.0 / std::sqrt(w[0] * w[0] + w[2] * w[2]);
+        u = {-w[2] * inv, 0.0, w[0] * inv};
+      }
+      else {
+        double const inv = 1.0 / std::sqrt(w[1] * w[1] + w[2] * w[2]);
+        u = {0.0, w[2] * inv, -w[1] * inv};
+      }
+      Vec3_t const v = cross3(w, u);
+      Vec3_t const au = symmetricTimes(a, u);
+      Vec3_t const av = symmetricTimes(a, v);
+      double m00 = dot3(u, au) - lambda, m01 = dot3(u, av), m11 = dot3(v, av) - lambda;
+
+      // the solution is the null vector of the (singular) 2x2 matrix, from its larger row
+      double cu = 1.0, cv = 0.0;
+      if (std::abs(m00) >= std::abs(m11)) {
+        if (std::max(std::abs(m00), std::abs(m01)) > 0.0) {
+          if (std::abs(m00) >= std::abs(m01)) {
+            m01 /= m00;
+            m00 = 1.0 / std::sqrt(1.0 + m01 * m01);
+            m01 *= m00;
+          }
+          else {
+            m00 /= m01;
+            m01 = 1.0 / std::sqrt(1.0 + m00 * m00);
+            m00 *= m01;
+          }
+          cu = m01;
+          cv = -m00;
+        }
+      }
+      else {
+        if (std::max(std::abs(m11), std::abs(m01)) > 0.0) {
+          if (std::abs(m11) >= std::abs(m01)) {
+            m01 /= m11;
+            m11 = 1.0 / std::sqrt(1.0 + m01 * m01);
+            m01 *= m11;
+          }
+          else {
+            m11 /= m01;
+            m01 = 1.0 / std::sqrt(1.0 + m11 * m11);
+            m11 *= m01;
+          }
+          cu = m11;
+          cv = -m01;
+        }
+      }
+      return {cu * u[0] + cv * v[0], cu * u[1] + cv * v[1], cu * u[2] + cv * v[2]};
+    }
+
+    /**
+     * @brief Eigen-decomposition of a symmetric 3x3 matrix, in closed form.
+     * @param m the matrix elements (xx, xy, xz, yy, yz, zz)
+     * @param[out] values the eigenvalues, decreasing
+     * @param[out] vectors the unit eigenvectors matching `values`, right-handed
+     *
+     * The eigenvalues are the trigonometric solution of the characteristic
+     * equation, the eigenvectors come from cross products, with no iteration
+     * (D. Eberly, "A robust eigensolver for 3x3 symmetric matrices").
+     */
+    inline void symmetricEigen3(double const* m, Vec3_t& values, std::array<Vec3_t, 3>& vectors)
+    {
+      // scaled to the largest element, against overflows and underflows
+      double scale = 0.0;
+      for (std::size_t i = 0; i < 6; ++i)
+        scale = std::max(scale, std::abs(m[i]));
+      double a[6];
+      for (std::size_t i = 0; i < 6; ++i)
+        a[i] = (scale > 0.0) ? m[i] / scale : 0.0;
+
+      double const q = (a[0] + a[3] + a[5]) / 3.0;
+      double const b00 = a[0] - q, b11 = a[3] - q, b22 = a[5] - q;
+      double const p = std::sqrt(
+        (b00 * b00 + b11 * b11 + b22 * b22 + 2.0 * (a[1] * a[1] + a[2] * a[2] + a[4] * a[4])) /
+        6.0);
+      if (!(p > 0.0)) { // a multiple of the identity
+        values = {m[0], m[0], m[0]};
+        vectors = {Vec3_t{1.0, 0.0, 0.0}, Vec3_t{0.0, 1.0, 0.0}, Vec3_t{0.0, 0.0, 1.0}};
+        return;
+      }
+
+      // eigenvalues of `(a - q) / p` are `2 cos(angle + 2 k pi / 3)`
+      double const det = (b00 * (b11 * b22 - a[4] * a[4]) - a[1] * (a[1] * b22 - a[4] * a[2]) +
+                          a[2] * (a[1] * a[4] - b11 * a[2])) /
+                         (p * p * p);
+      double const halfDet = std::clamp(0.5 * det, -1.0, 1.0);
+      double const angle = std::acos(halfDet) / 3.0;
+      constexpr double TwoThirdsPi = 2.09439510239319549;
+      double const beta2 = 2.0 * std::cos(angle);
+      double const beta0 = 2.0 * std::cos(angle + TwoThirdsPi);
+      double const beta1 = -(beta0 + beta2);
+      Vec3_t const eval{q + p * beta0, q + p * beta1, q + p * beta2}; // increasing
+
+      // the eigenvalue farthest from the other two is simple: its eigenvector goes first
+      std::array<Vec3_t, 3> evec;
+      if (halfDet >= 0.0) {
+        evec[2] = symmetricEigenvector0(a, eval[2]);
+        evec[1] = symmetricEigenvector1(a, evec[2], eval[1]);
+      }
+      else {
+        evec[0] = symmetricEigenvector0(a, eval[0]);
+        evec[1] = symmetricEigenvector1(a, evec[0], eval[1]);
+        evec[2] = cross3(evec[0], evec[1]);
+      }
+
+      // the eigenvalues as Rayleigh quotients are more precise when two are close
+      vectors = {evec[2], evec[1], cross3(evec[2], evec[1])};
+      for (std::size_t k = 0; k < 3; ++k)
+        values[k] = dot3(vectors[k], symmetricTimes(a, vectors[k]));
+      for (std::size_t k : {0U, 1U, 0U}) {
+        if (values[k] >= values[k + 1]) continue;
+        std::swap(values[k], values[k + 1]);
+        std::swap(vectors[k], vectors[k + 1]);
+      }
+      vectors[2] = cross3(vectors[0], vectors[1]);
+      for (double& value : values)
+        value *= scale;
+    }
+
+  } // namespace details
+
+  //----------------------------------------------------------------------------
+  /**
+   * @brief Operations on all the elements of coordinate columns.
+   *
+   * The functions accept both `geo::vect::CoordArraySoA` and
+   * `geo::vect::CoordArrayView` (`Coords` types), and loop on the columns
+   * with a stride known at compile time. The output arrays must not overlap
+   * the input.
+   */
+  namespace bulk {
+
+    /// Fills `out` with the scalar product of each element with `axis`.
+    template <typename Coords, typename Axis>
+    void dot(Coords const& coords, Axis const& axis, double* __restrict__ out)
+    {
+      constexpr std::size_t S = Coords::Stride;
+      double const* __restrict__ x = coords.xs();
+      double const* __restrict__ y = coords.ys();
+      double const* __restrict__ z = coords.zs();
+      double const ax = axis.X(), ay = axis.Y(), az = axis.Z();
+      std::size_t const n = coords.size();
+      for (std::size_t i = 0; i < n; ++i)
+        out[i] = x[S * i] * ax + y[S * i] * ay + z[S * i] * az;
+    }
+
+    /// Fills `out` with the square of the magnitude of each element.
+    template <typename Coords>
+    void mag2(Coords const& coords, double* __restrict__ out)
+    {
+      constexpr std::size_t S = Coords::Stride;
+      double const* __restrict__ x = coords.xs();
+      double const* __restrict__ y = coords.ys();
+      double const* __restrict__ z = coords.zs();
+      std::size_t const n = coords.size();
+      for (std::size_t i = 0; i < n; ++i)
+        out[i] = x[S * i] * x[S * i] + y[S * i] * y[S * i] + z[S * i] * z[S * i];
+    }
+
+    /// Fills `out` with the magnitude of each element.
+    template <typename Coords>
+    void norm(Coords const& coords, double* __restrict__ out)
+    {
+      mag2(coords, out);
+      std::size_t const n = coords.size();
+      for (std::size_t i = 0; i < n; ++i)
+        out[i] = std::sqrt(out[i]);
+    }
+
+    /// Adds `shift` to all the elements.
+    template <typename Coords, typename Shift>
+    void translate(Coords&& coords, Shift const& shift)
+    {
+      constexpr std::size_t S = std::decay_t<Coords>::Stride;
+      double* x = coords.xs();
+      double* y = coords.ys();
+      double* z = coords.zs();
+      double const dx = shift.X(), dy = shift.Y(), dz = shift.Z();
+      std::size_t const n = coords.size();
+      for (std::size_t i = 0; i < n; ++i) {
+        x[S * i] += dx;
+        y[S * i] += dy;
+        z[S * i] += dz;
+      }
+    }
+
+    /**
+     * @brief Applies an affine transformation to all points.
+     * @tparam Trans type of transformation
+     * @param coords the points to be transformed
+     * @param trans the transformation
+     * @param[out] dest collection of the transformed points (resized)
+     *
+     * The transformation must expose its 3x4 matrix with
+     * `GetComponents(double*)`, as `ROOT::Math::Transform3D` (that is
+     * `geo::TransformationMatrix`) and `geo::AffineTransform` do.
+     * The translation is applied: for displacement vectors, transform them as
+     * points with a transformation with no translation.
+     */
+    template <typename Coords, typename Trans, typename Vector>
+    void transform(Coords const& coords, Trans const& trans, CoordArraySoA<Vector>& dest)
+    {
+      constexpr std::size_t S = Coords::Stride;
+      double c[12];
+      trans.GetComponents(c);
+      std::size_t const n = coords.size();
+      dest.resize(n);
+      double const* __restrict__ x = coords.xs();
+      double const* __restrict__ y = coords.ys();
+      double const* __restrict__ z = coords.zs();
+      double* __restrict__ outX = dest.xs();
+      double* __restrict__ outY = dest.ys();
+      double* __restrict__ outZ = dest.zs();
+      for (std::size_t i = 0; i < n; ++i) {
+        double const px = x[S * i], py = y[S * i], pz = z[S * i];
+        outX[i] = c[0] * px + c[1] * py + c[2] * pz + c[3];
+        outY[i] = c[4] * px + c[5] * py + c[6] * pz + c[7];
+        outZ[i] = c[8] * px + c[9] * py + c[10] * pz + c[11];
+      }
+    }
+
+    /**
+     * @brief Returns the smallest box containing all the elements.
+     * @return the lower and the upper corner of the box
+     *
+     * If there are no elements, the lower corner is at +infinity and the upper
+     * one at -infinity.
+     */
+    template <typename Coords>
+    std::pair<geo::Point_t, geo::Point_t> boundingBox(Coords const& coords)
+    {
+      constexpr std::size_t S = Coords::Stride;
+      constexpr double inf = std::numeric_limits<double>::infinity();
+      double const* x = coords.xs();
+      double const* y = coords.ys();
+      double const* z = coords.zs();
+      double minX = inf, minY = inf, minZ = inf;
+      double maxX = -inf, maxY = -inf, maxZ = -inf;
+      std::size_t const n = coords.size();
+      for (std::size_t i = 0; i < n; ++i) {
+        minX = std::min(minX, x[S * i]);
+        maxX = std::max(maxX, x[S * i]);
+        minY = std::min(minY, y[S * i]);
+        maxY = std::max(maxY, y[S * i]);
+        minZ = std::min(minZ, z[S * i]);
+        maxZ = std::max(maxZ, z[S * i]);
+      }
+      return {{minX, minY, minZ}, {maxX, maxY, maxZ}};
+    }
+
+    /**
+     * @brief Returns the principal axes of the elements from `first` to `last - 1`.
+     * @param coords the points
+     * @param first index of the first point
+     * @param last index after the last point
+     * @param weights weight of each point in `coords` (`nullptr`: all `1`)
+     * @return the mean, the covariance eigenvalues and the axes of the points
+     *
+     * The covariance is normalized to the total weight, and it is accumulated
+     * in a single pass on the coordinates shifted by the first point, which
+     * avoids the loss of precision from the distance of the points from the
+     * origin. It is then decomposed with `details::symmetricEigen3()`.
+     * If there are no points or their total weight is not positive, the
+     * result is `empty()`. Weights are indexed as the points in `coords`.
+     */
+    template <typename Coords>
+    PrincipalAxes_t principalAxes(Coords const& coords,
+                                  std::size_t first,
+                                  std::size_t last,
+                                  double const* weights = nullptr)
+    {
+      constexpr std::size_t S = Coords::Stride;
+      PrincipalAxes_t result;
+      if (last <= first) return result;
+      std::size_t const n = last - first;
+      double const* __restrict__ x = coords.xs() + S * first;
+      double const* __restrict__ y = coords.ys() + S * first;
+      double const* __restrict__ z = coords.zs() + S * first;
+      double const x0 = x[0], y0 = y[0], z0 = z[0];
+
+      double sw = 0.0, sx = 0.0, sy = 0.0, sz = 0.0;
+      double sxx = 0.0, sxy = 0.0, sxz = 0.0, syy = 0.0, syz = 0.0, szz = 0.0;
+      if (weights) {
+        double const* __restrict__ w = weights + first;
+        for (std::size_t i = 0; i < n; ++i) {
+          double const dx = x[S * i] - x0, dy = y[S * i] - y0, dz = z[S * i] - z0;
+          double const wx = w[i] * dx, wy = w[i] * dy, wz = w[i] * dz;
+          sw += w[i];
+          sx += wx;
+          sy += wy;
+          sz += wz;
+          sxx += wx * dx;
+          sxy += wx * dy;
+          sxz += wx * dz;
+          syy += wy * dy;
+          syz += wy * dz;
+          szz += wz * dz;
+        }
+      }
+      else {
+        for (std::size_t i = 0; i < n; ++i) {
+          double const dx = x[S * i] - x0, dy = y[S * i] - y0, dz = z[S * i] - z0;
+          sx += dx;
+          sy += dy;
+          sz += dz;
+          sxx += dx * dx;
+          sxy += dx * dy;
+          sxz += dx * dz;
+          syy += dy * dy;
+          syz += dy * dz;
+          szz += dz * dz;
+        }
+        sw = static_cast<double>(n);
+      }
+      if (!(sw > 0.0)) return result;
+
+      double const mx = sx / sw, my = sy / sw, mz = sz / sw;
+      double const cov[6] = {sxx / sw - mx * mx,
+                             sxy / sw - mx * my,
+                             sxz / sw - mx * mz,
+                             syy / sw - my * my,
+                             syz / sw - my * mz,
+                             szz / sw - mz * mz};
+      details::Vec3_t values;
+      std::array<details::Vec3_t, 3> vectors;
+      details::symmetricEigen3(cov, values, vectors);
+
+      result.center = {x0 + mx, y0 + my, z0 + mz};
+      result.weight = sw;
+      for (std::size_t k = 0; k < 3; ++k) {
+        result.variances[k] = std::max(values[k], 0.0); // rounding may make them negative
+        result.axes[k] = {vectors[k][0], vectors[k][1], vectors[k][2]};
+      }
+      return result;
+    }
+
+    /// Returns the principal axes of all the elements (see `principalAxes(coords, first, last)`).
+    template <typename Coords>
+    PrincipalAxes_t principalAxes(Coords const& coords, double const* weights = nullptr)
+    {
+      return principalAxes(coords, 0, coords.size(), weights);
+    }
+
+    /**
+     * @brief Returns the principal axes of many clusters of points.
+     * @param coords the points of all the clusters
+     * @param offsets cluster `i` is made of the points `offsets[i]` to `offsets[i + 1] - 1`
+     * @param weights weight of each point in `coords` (`nullptr`: all `1`)
+     * @return the principal axes of each cluster (`offsets.size() - 1` of them)
+     *
+     * The points of each cluster are contiguous in `coords`, and the first
+     * offset is usually `0`. Each cluster is treated as in
+     * `principalAxes(coords, first, last, weights)`.
+     */
+    template <typename Coords>
+    std::vector<PrincipalAxes_t> principalAxes(Coords const& coords,
+                                               std::vector<std::size_t> const& offsets,
+                                               double const* weights = nullptr)
+    {
+      std::vector<PrincipalAxes_t> result;
+      if (offsets.size() < 2) return result;
+      result.reserve(offsets.size() - 1);
+      for (std::size_t i = 1; i < offsets.size(); ++i)
+        result.push_back(principalAxes(coords, offsets[i - 1], offsets[i], weights));
+      return result;
+    }
+
+  } // namespace bulk
+
+} // namespace geo::vect
+
+#endif // LARCOREALG_GEOMETRY_GEO_VECTORS_ARRAYS_H
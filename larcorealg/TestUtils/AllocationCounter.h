@@ -0,0 +1,87 @@
+/**
+ * @file   larcorealg/TestUtils/AllocationCounter.h
+ * @brief  Count of the heap allocations of a program.
+ * @see    `larcorealg/TestUtils/CountAllocations.h`,
+ *         `larcorealg/TestUtils/Benchmark.h`
+ *
+ * This is a pure header library.
+ *
+ * The allocations are counted only in programs which include
+ * `larcorealg/TestUtils/CountAllocations.h` in one of their source files;
+ * in the others, `testing::allocationsCounted()` is `false`.
+ * A test asserts that a query allocates no memory with
+ * `testing::AllocationScope`:
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * testing::AllocationScope const scope;
+ * auto const wires = geom.ChannelToWireIDs(channel);
+ * BOOST_TEST(scope.count() == 0U);
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ */
+
+#ifndef LARCORE_TESTUTILS_ALLOCATIONCOUNTER_H
+#define LARCORE_TESTUTILS_ALLOCATIONCOUNTER_H
+
+// C/C++ standard libraries
+#include <atomic>
+#include <cstddef> // std::size_t
+
+namespace testing {
+
+  namespace details {
+
+    /// Number of calls of the global allocation functions.
+    inline std::atomic<std::size_t> nAllocations{0U};
+
+    /// Whether the replaced allocation functions count `nAllocations`.
+    inline std::atomic<bool> allocationsCounted{false};
+
+  } // namespace details
+
+  /// Returns whether the heap allocations of this program are counted.
+  inline bool allocationsCounted()
+  {
+    return details::allocationsCounted.load(std::memory_order_relaxed);
+  }
+
+  /// Returns the number of heap allocations so far (`0` if not counted).
+  inline std::size_t allocationCount()
+  {
+    return details::nAllocations.load(std::memory_order_relaxed);
+  }
+
+  /// Records one allocation (called by the replaced allocation functions).
+  inline void countAllocation()
+  {
+    details::nAllocations.fetch_add(1U, std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Counts the heap allocations since its construction.
+   *
+   * The count includes the allocations of all the threads of the program,
+   * so the code under test should be the only one running while it is
+   * measured. If the allocations are not counted (`allocationsCounted()` is
+   * `false`), the count is always `0`: tests asserting no allocation should
+   * then check `counting()` too, or they pass trivially.
+   */
+  class AllocationScope {
+  public:
+    /// Starts counting from now.
+    AllocationScope() : fStart{allocationCount()} {}
+
+    /// Returns whether the allocations are counted at all.
+    bool counting() const { return allocationsCounted(); }
+
+    /// Returns the number of allocations since the construction or `reset()`.
+    std::size_t count() const { return allocationCount() - fStart; }
+
+    /// Restarts the count from now.
+    void reset() { fStart = allocationCount(); }
+
+  private:
+    std::size_t fStart; ///< Allocations before the scope.
+  }; // class AllocationScope
+
+} // namespace testing
+
+#endif // LARCORE_TESTUTILS_ALLOCATIONCOUNTER_H
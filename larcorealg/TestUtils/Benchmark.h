@@ -0,0 +1,731 @@
+/**
+ * @file   larcorealg/TestUtils/Benchmark.h
+ * @brief  Repeated timing of code snippets, with robust statistics.
+ * @see    `larcorealg/TestUtils/StopWatch.h`,
+ *         `larcorealg/TestUtils/HardwareCounters.h`,
+ *         `larcorealg/TestUtils/CountAllocations.h`
+ *
+ * This is a pure header library.
+ *
+ * It provides `testing::Benchmark`, the optimization barriers
+ * `testing::doNotOptimize()` and `testing::clobberMemory()`, the
+ * statistics helper `testing::computeBenchmarkStats()` and the comparison
+ * with stored baselines (`testing::BenchmarkOptions_t`).
+ * Where the hardware performance counters are available, the benchmarks also
+ * report processor cycles, instructions, cache and branch misses per item.
+ * In programs counting their allocations (`CountAllocations.h`), the heap
+ * allocations per item are reported as well.
+ */
+
+#ifndef LARCORE_TESTUTILS_BENCHMARK_H
+#define LARCORE_TESTUTILS_BENCHMARK_H
+
+// LArSoft libraries
+#include "larcorealg/TestUtils/AllocationCounter.h"
+#include "larcorealg/TestUtils/HardwareCounters.h"
+#include "larcorealg/TestUtils/StopWatch.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::sort(), std::max()
+#include <chrono>
+#include <cmath>   // std::sqrt(), std::floor()
+#include <cstddef> // std::size_t
+#include <fstream>
+#include <iomanip> // std::setw()
+#include <istream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <utility> // std::move()
+#include <vector>
+
+namespace testing {
+
+  // --- BEGIN -- Optimization barriers ----------------------------------------
+  /// @name Optimization barriers
+  /// @{
+
+  /**
+   * @brief Forces the compiler to compute `value`, as if it were used.
+   *
+   * The result of a benchmarked computation which is not used may be
+   * optimized away together with the computation itself:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * bench.run("NearestWireID", [&]{ testing::doNotOptimize(geom.NearestWireID(p, plane)); });
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   */
+  template <typename T>
+  inline void doNotOptimize(T const& value)
+  {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile T const* sink;
+    sink = &value;
+#endif
+  }
+
+  /// Forces the compiler to assume that all memory may have been written.
+  inline void clobberMemory()
+  {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : : "memory");
+#endif
+  }
+
+  /// @}
+  // --- END -- Optimization barriers ------------------------------------------
+
+  /// Statistics of the time of a benchmark, per call [ns]
+  struct BenchmarkStats_t {
+    std::size_t nSamples = 0U;  ///< Number of samples, including outliers.
+    std::size_t nOutliers = 0U; ///< Number of samples rejected as outliers.
+    double mean = 0.0;          ///< Average of the accepted samples.
+    double stddev = 0.0;        ///< Standard deviation of the accepted samples.
+    double min = 0.0;           ///< Smallest sample.
+    double max = 0.0;           ///< Largest sample.
+    double median = 0.0;        ///< Median of all samples.
+    double p10 = 0.0;           ///< 10% quantile of all samples.
+    double p90 = 0.0;           ///< 90% quantile of all samples.
+    double p99 = 0.0;           ///< 99% quantile of all samples.
+  }; // BenchmarkStats_t
+
+  /**
+   * @brief Returns the `fraction` quantile of the sorted `samples`.
+   * @param samples the values, sorted in increasing order
+   * @param fraction the quantile (`0.5` for the median)
+   * @return the quantile, linearly interpolated between samples
+   */
+  inline double sortedQuantile(std::vector<double> const& samples, double fraction)
+  {
+    if (samples.empty()) return 0.0;
+    double const pos = fraction * (samples.size() - 1U);
+    std::size_t const i = static_cast<std::size_t>(std::floor(pos));
+    if (i + 1U >= samples.size()) return samples.back();
+    return samples[i] + (pos - i) * (samples[i + 1U] - samples[i]);
+  }
+
+  /**
+   * @brief Computes the statistics of timing samples.
+   * @param samples the values (any order)
+   * @param outlierFence width of the acceptance beyond the quartiles, in
+   *                     units of interquartile range (`0` disables rejection)
+   * @return the statistics
+   *
+   * Quantiles are computed on all the samples; mean and standard deviation
+   * only on the ones within the Tukey fences: the samples farther than
+   * `outlierFence` times the interquartile range below the first quartile or
+   * above the third are rejected as outliers (typically, the samples which
+   * were interrupted by the operating system).
+   */
+  inline BenchmarkStats_t computeBenchmarkStats(std::vector<double> samples,
+                                                double outlierFence = 1.5)
+  {
+    BenchmarkStats_t stats;
+    stats.nSamples = samples.size();
+    if (samples.empty()) return stats;
+
+    std::sort(samples.begin(), samples.end());
+    stats.min = samples.front();
+    stats.max = samples.back();
+    stats.median = sortedQuantile(samples, 0.50);
+    stats.p10 = sortedQuantile(samples, 0.10);
+    stats.p90 = sortedQuantile(samples, 0.90);
+    stats.p99 = sortedQuantile(samples, 0.99);
+
+    double const q1 = sortedQuantile(samples, 0.25);
+    double const q3 = sortedQuantile(samples, 0.75);
+    double const low = q1 - outlierFence * (q3 - q1);
+    double const high = q3 + outlierFence * (q3 - q1);
+
+    double sum = 0.0, sum2 = 0.0;
+    std::size_t n = 0U;
+    for (double const sample : samples) {
+      if ((outlierFence > 0.0) && ((sample < low) || (sample > high))) continue;
+      sum += sample;
+      sum2 += sample * sample;
+      ++n;
+    }
+    stats.nOutliers = samples.size() - n;
+    stats.mean = sum / n;
+    stats.stddev = (n > 1U) ? std::sqrt(std::max(0.0, (sum2 - sum * stats.mean) / (n - 1U))) : 0.0;
+    return stats;
+  } // computeBenchmarkStats()
+
+  /// Result of a benchmark run by `testing::Benchmark`.
+  struct BenchmarkResult_t {
+    std::string name;                  ///< Name of the benchmark.
+    std::size_t itemsPerCall = 1U;     ///< Items processed by each call.
+    std::size_t callsPerSample = 1U;   ///< Calls timed together in a sample.
+    std::vector<double> samples;       ///< Time per call of each sample [ns]
+    BenchmarkStats_t stats;            ///< Statistics of the samples [ns/call]
+    HardwareCounterValues_t counters;  ///< Average hardware event counts per item.
+    double allocationsPerItem = -1.0;  ///< Average heap allocations per item (`< 0`: none).
+
+    /// Returns whether any hardware counter was recorded.
+    bool hasCounters() const { return counters.any(); }
+
+    /// Returns whether the heap allocations were counted.
+    bool hasAllocations() const { return allocationsPerItem >= 0.0; }
+
+    /// Returns the median time per processed item [ns]
+    double nsPerItem() const { return stats.median / itemsPerCall; }
+
+    /// Returns the number of items processed per second (from the median).
+    double itemsPerSecond() const
+    {
+      return (stats.median > 0.0) ? 1e9 * itemsPerCall / stats.median : 0.0;
+    }
+  }; // BenchmarkResult_t
+
+  /// Comparison of the result of a benchmark with its baseline.
+  struct BaselineComparison_t {
+    std::string name;      ///< Name of the benchmark.
+    double baseline = 0.0; ///< Baseline time per item [ns] (`0` if none).
+    double measured = 0.0; ///< Measured time per item [ns]
+
+    /// Returns whether a baseline was available for this benchmark.
+    bool hasBaseline() const { return baseline > 0.0; }
+
+    /// Returns the ratio of measured time to baseline (`0` if no baseline).
+    double ratio() const { return hasBaseline() ? measured / baseline : 0.0; }
+
+    /// Returns whether the measured time exceeds the baseline by more than
+    /// the relative `tolerance`.
+    bool isRegression(double tolerance) const
+    {
+      return hasBaseline() && (measured > baseline * (1.0 + tolerance));
+    }
+  }; // BaselineComparison_t
+
+  /**
+   * @brief Splits a line of CSV into its fields.
+   *
+   * Fields may be enclosed in double quotes, in which case they may contain
+   * commas, and double quotes represented by two of them.
+   */
+  inline std::vector<std::string> splitCSVline(std::string const& line)
+  {
+    std::vector<std::string> fields(1U);
+    bool quoted = false;
+    for (std::size_t i = 0; i < line.length(); ++i) {
+      char const c = line[i];
+      if (quoted) {
+        if (c != '"')
+          fields.back() += c;
+        else if ((i + 1U < line.length()) && (line[i + 1U] == '"'))
+          fields.back() += line[++i];
+        else
+          quoted = false;
+      }
+      else if (c == '"')
+        quoted = true;
+      else if (c == ',')
+        fields.emplace_back();
+      else if (c != '\r')
+        fields.back() += c;
+    } // for
+    return fields;
+  } // splitCSVline()
+
+  /**
+   * @brief Reads the baseline times per item from a CSV file.
+   * @param in stream with the baseline, as written by `Benchmark::writeCSV()`
+   * @return the time per item [ns] of each benchmark, by name
+   *
+   * The first line is the header, which must include the columns `name` and
+   * `ns_per_item`; the other columns are ignored. Empty lines and lines
+   * starting with `#` are skipped.
+   */
+  inline std::map<std::string, double> readBenchmarkBaseline(std::istream& in)
+  {
+    std::map<std::string, double> baseline;
+    std::size_t nameColumn = 0U, timeColumn = 0U;
+    bool header = true;
+    std::string line;
+    while (std::getline(in, line)) {
+      if (line.empty() || (line.front() == '#')) continue;
+      std::vector<std::string> const fields = splitCSVline(line);
+      if (header) {
+        auto const column = [&fields](std::string const& key) {
+          return static_cast<std::size_t>(std::find(fields.begin(), fields.end(), key) -
+                                          fields.begin());
+        };
+        nameColumn = column("name");
+        timeColumn = column("ns_per_item");
+        if ((nameColumn == fields.size()) || (timeColumn == fields.size())) return {};
+        header = false;
+        continue;
+      }
+      if (std::max(nameColumn, timeColumn) >= fields.size()) continue;
+      baseline[fields[nameColumn]] = std::stod(fields[timeColumn]);
+    } // while
+    return baseline;
+  } // readBenchmarkBaseline()
+
+  /**
+   * @brief Output and regression check options of a benchmark program.
+   *
+   * The options are meant to be parsed from the command line, where they are
+   * written as:
+   * * `--json=FILE`: writes the results in JSON format into `FILE`
+   * * `--csv=FILE`: writes the results in CSV format into `FILE`; this file
+   *   can be used as baseline
+   * * `--baseline=FILE`: compares the results with the CSV baseline in `FILE`
+   * * `--tolerance=FRACTION`: a benchmark slower than its baseline by more
+   *   than this fraction is a regression (default: `0.25`)
+   * * `--warn-only`: regressions are reported but are not failures
+   *
+   * @see `testing::Benchmark::report()`
+   */
+  struct BenchmarkOptions_t {
+    std::string JSONpath;     ///< Path of the JSON output (empty: none).
+    std::string CSVpath;      ///< Path of the CSV output (empty: none).
+    std::string baselinePath; ///< Path of the CSV baseline (empty: none).
+    double tolerance = 0.25;  ///< Allowed slow-down with respect to the baseline.
+    bool warnOnly = false;    ///< Whether regressions are not failures.
+
+    /// Parses `arg`; returns whether it was a benchmark option.
+    /// @throw std::invalid_argument if the tolerance value is not a number
+    bool parse(std::string const& arg)
+    {
+      auto const value = [&arg](std::string const& key, std::string& dest) {
+        if (arg.compare(0, key.length(), key) != 0) return false;
+        dest = arg.substr(key.length());
+        return true;
+      };
+      std::string tolValue;
+      if (value("--json=", JSONpath) || value("--csv=", CSVpath) ||
+          value("--baseline=", baselinePath))
+        return true;
+      if (value("--tolerance=", tolValue)) {
+        tolerance = std::stod(tolValue);
+        return true;
+      }
+      if (arg == "--warn-only") {
+        warnOnly = true;
+        return true;
+      }
+      return false;
+    } // parse()
+
+  }; // BenchmarkOptions_t
+
+  /**
+   * @brief Times code snippets repeatedly and collects robust statistics.
+   * @tparam Clock type of clock used for the measurements
+   *
+   * Each benchmark is a callable object run many times. It is first run for
+   * `Config_t::warmupTime` to fill caches and make the branch predictors
+   * settle; from the warm-up the number of calls which take about
+   * `Config_t::minSampleTime` is computed, and `Config_t::samples` samples of
+   * that many calls each are timed with a `testing::StopWatch`.
+   * The statistics of the time per call of the samples are computed by
+   * `computeBenchmarkStats()`.
+   *
+   * If `Config_t::hardwareCounters` is set and the processor counters are
+   * accessible (see `testing::HardwareCounters`), the events during the
+   * samples are counted too, and their average per item is reported next to
+   * the time; this tells, for example, whether a query is limited by cache
+   * misses rather than by computation. When the counters are not accessible,
+   * as in many containers, only the time is reported.
+   * If the program counts its heap allocations (it includes
+   * `larcorealg/TestUtils/CountAllocations.h`), their average per item in the
+   * samples is reported too.
+   *
+   * Example:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * testing::Benchmark<> bench;
+   * std::size_t i = 0;
+   * bench.run("NearestWireID", [&]{
+   *     testing::doNotOptimize(geom.NearestWireID(points[i++ % points.size()], planeID));
+   *   });
+   * bench.run("WireCoordinates", [&]{ plane.WireCoordinates(points, coords); }, points.size());
+   * bench.printTable(std::cout);
+   * bench.writeJSON(jsonFile);
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   * The second benchmark processes `points.size()` items in each call, and its
+   * report includes the time per item.
+   */
+  template <typename Clock = std::chrono::steady_clock>
+  class Benchmark {
+  public:
+    using Clock_t = Clock; ///< Type of clock used for the measurements.
+
+    /// Configuration of the benchmarks.
+    struct Config_t {
+      std::chrono::duration<double> warmupTime{0.05};      ///< Warm-up duration [s]
+      std::chrono::duration<double> minSampleTime{0.002}; ///< Duration of a sample [s]
+      std::size_t samples = 50U;                          ///< Number of samples.
+      double outlierFence = 1.5; ///< Outlier rejection (see `computeBenchmarkStats()`).
+      bool hardwareCounters = true; ///< Whether to count hardware events, if possible.
+    }; // Config_t
+
+    /// Constructor: uses the default configuration.
+    Benchmark() : Benchmark(Config_t{}) {}
+
+    /// Constructor: uses the specified configuration.
+    Benchmark(Config_t const& config)
+      : fConfig{config}, fCounters{config.hardwareCounters}
+    {}
+
+    /// Returns the configuration of the benchmarks.
+    Config_t const& config() const { return fConfig; }
+
+    /// Returns the hardware counters used by the benchmarks.
+    HardwareCounters const& hardwareCounters() const { return fCounters; }
+
+    /**
+     * @brief Times `f` and records the result.
+     * @tparam F type of callable object, called without arguments
+     * @param name name of the benchmark, for the reports
+     * @param f the code to be timed
+     * @param itemsPerCall items processed in each call of `f`
+     * @return a copy of the result of the benchmark
+     *
+     * The result is also stored in `results()`, which grows at each call:
+     * references to its elements are not stable across calls.
+     */
+    template <typename F>
+    BenchmarkResult_t run(std::string name, F&& f, std::size_t itemsPerCall = 1U);
+
+    /// Returns all the results, in the order the benchmarks were run.
+    std::vector<BenchmarkResult_t> const& results() const { return fResults; }
+
+    /// Prints a human-readable table of the results.
+    template <typename Stream>
+    void printTable(Stream&& out) const;
+
+    /// Writes all the results in JSON format.
+    template <typename Stream>
+    void writeJSON(Stream&& out) const;
+
+    /// Writes all the results in CSV format, one line per benchmark.
+    template <typename Stream>
+    void writeCSV(Stream&& out) const;
+
+    /// Compares each result with its `baseline` time per item [ns]
+    std::vector<BaselineComparison_t> compareToBaseline(
+      std::map<std::string, double> const& baseline) const;
+
+    /**
+     * @brief Prints the results, writes them and checks them with a baseline.
+     * @param options where to write the results and which baseline to use
+     * @param out the stream to print the table and the comparison into
+     * @return the number of regressions (`0` if `options.warnOnly`)
+     *
+     * A baseline which can't be read is reported, and no comparison is made:
+     * a new (or different) machine starts without baseline, which can be
+     * created with the `--csv` option.
+     */
+    template <typename Stream>
+    unsigned int report(BenchmarkOptions_t const& options, Stream&& out) const;
+
+  private:
+    using StopWatch_t = testing::StopWatch<std::chrono::duration<double, std::nano>, Clock_t>;
+
+    Config_t fConfig;                       ///< Benchmark configuration.
+    HardwareCounters fCounters;             ///< Processor event counters.
+    std::vector<BenchmarkResult_t> fResults; ///< Results of all the benchmarks.
+
+    /// Returns whether any of the results has hardware counts.
+    bool hasCounters() const;
+
+    /// Returns whether any of the results has allocation counts.
+    bool hasAllocations() const;
+
+    /// Returns `s` with the characters special in JSON escaped.
+    static std::string escapeJSON(std::string const& s);
+
+  }; // class Benchmark
+
+} // namespace testing
+
+//------------------------------------------------------------------------------
+//--- template implementation
+//------------------------------------------------------------------------------
+template <typename Clock>
+template <typename F>
+testing::BenchmarkResult_t testing::Benchmark<Clock>::run(std::string name,
+                                                          F&& f,
+                                                          std::size_t itemsPerCall /* = 1U */)
+{
+  BenchmarkResult_t result;
+  result.name = std::move(name);
+  result.itemsPerCall = std::max(itemsPerCall, std::size_t{1});
+
+  // warm-up, also estimating the time per call
+  double const warmupNs = std::chrono::duration<double, std::nano>(fConfig.warmupTime).count();
+  std::size_t nWarmupCalls = 0U;
+  StopWatch_t timer;
+  do {
+    f();
+    clobberMemory();
+    ++nWarmupCalls;
+  } while (timer.elapsed() < warmupNs);
+  double const nsPerCall = timer.elapsed() / nWarmupCalls;
+
+  double const sampleNs = std::chrono::duration<double, std::nano>(fConfig.minSampleTime).count();
+  result.callsPerSample =
+    (nsPerCall > 0.0) ? std::max(std::size_t{1}, static_cast<std::size_t>(sampleNs / nsPerCall)) :
+                        std::size_t{1};
+
+  // the counters are read out of the timed region, and only once per sample
+  bool const countEvents = fCounters.available() && (fConfig.samples > 0U);
+  HardwareCounterValues_t counts;
+  counts.valid.fill(countEvents);
+  std::size_t nAllocations = 0U; // only in the timed calls
+
+  result.samples.reserve(fConfig.samples);
+  for (std::size_t iSample = 0; iSample < fConfig.samples; ++iSample) {
+    if (countEvents) fCounters.start();
+    std::size_t const startAllocations = allocationCount();
+    timer.restart();
+    for (std::size_t iCall = 0; iCall < result.callsPerSample; ++iCall) {
+      f();
+      clobberMemory();
+    }
+    timer.stop();
+    nAllocations += allocationCount() - startAllocations;
+    if (countEvents) {
+      fCounters.stop();
+      counts += fCounters.read();
+    }
+    result.samples.push_back(timer.elapsed() / result.callsPerSample);
+  } // for samples
+
+  result.stats = computeBenchmarkStats(result.samples, fConfig.outlierFence);
+  if (countEvents) {
+    counts /= static_cast<double>(fConfig.samples * result.callsPerSample * result.itemsPerCall);
+    result.counters = counts;
+  }
+  if (allocationsCounted() && (fConfig.samples > 0U)) {
+    result.allocationsPerItem = static_cast<double>(nAllocations) /
+                                (fConfig.samples * result.callsPerSample * result.itemsPerCall);
+  }
+  fResults.push_back(std::move(result));
+  return fResults.back();
+} // testing::Benchmark<>::run()
+
+//------------------------------------------------------------------------------
+template <typename Clock>
+template <typename Stream>
+void testing::Benchmark<Clock>::printTable(Stream&& out) const
+{
+  std::size_t nameWidth = 9U;
+  for (BenchmarkResult_t const& result : fResults)
+    nameWidth = std::max(nameWidth, result.name.length());
+
+  // hardware counter columns (per item), only if any was recorded
+  bool const withCounters = hasCounters();
+  bool const withAllocations = hasAllocations();
+  char const* counterHeaders[NHardwareCounters] = {
+    "cycles", "instr", "L1D miss", "LLC miss", "br. miss"};
+
+  out << std::left << std::setw(nameWidth) << "benchmark" << std::right << std::setw(12)
+      << "median[ns]" << std::setw(12) << "mean[ns]" << std::setw(12) << "stddev" << std::setw(12)
+      << "p10[ns]" << std::setw(12) << "p90[ns]" << std::setw(12) << "ns/item" << std::setw(10)
+      << "outliers";
+  if (withAllocations) out << std::setw(12) << "alloc/item";
+  if (withCounters) {
+    for (char const* header : counterHeaders)
+      out << std::setw(12) << header;
+    out << std::setw(8) << "IPC";
+  }
+  out << "\n";
+  for (BenchmarkResult_t const& result : fResults) {
+    BenchmarkStats_t const& s = result.stats;
+    out << std::left << std::setw(nameWidth) << result.name << std::right << std::setw(12)
+        << s.median << std::setw(12) << s.mean << std::setw(12) << s.stddev << std::setw(12)
+        << s.p10 << std::setw(12) << s.p90 << std::setw(12) << result.nsPerItem()
+        << std::setw(10) << s.nOutliers;
+    if (withAllocations) {
+      if (result.hasAllocations())
+        out << std::setw(12) << result.allocationsPerItem;
+      else
+        out << std::setw(12) << "-";
+    }
+    if (withCounters) {
+      HardwareCounterValues_t const& c = result.counters;
+      for (std::size_t i = 0; i < NHardwareCounters; ++i) {
+        if (c.valid[i])
+          out << std::setw(12) << c.values[i];
+        else
+          out << std::setw(12) << "-";
+      }
+      if (c.isValid(HardwareCounter_t::Cycles) && c.isValid(HardwareCounter_t::Instructions) &&
+          (c[HardwareCounter_t::Cycles] > 0.0))
+        out << std::setw(8)
+            << (c[HardwareCounter_t::Instructions] / c[HardwareCounter_t::Cycles]);
+      else
+        out << std::setw(8) << "-";
+    }
+    out << "\n";
+  }
+} // testing::Benchmark<>::printTable()
+
+//------------------------------------------------------------------------------
+template <typename Clock>
+template <typename Stream>
+void testing::Benchmark<Clock>::writeJSON(Stream&& out) const
+{
+  out << "{\n  \"benchmarks\": [";
+  for (std::size_t i = 0; i < fResults.size(); ++i) {
+    BenchmarkResult_t const& result = fResults[i];
+    BenchmarkStats_t const& s = result.stats;
+    out << (i ? ",\n" : "\n") << "    {\"name\": \"" << escapeJSON(result.name) << "\""
+        << ", \"items_per_call\": " << result.itemsPerCall
+        << ", \"calls_per_sample\": " << result.callsPerSample << ", \"samples\": " << s.nSamples
+        << ", \"outliers\": " << s.nOutliers << ", \"median_ns\": " << s.median
+        << ", \"mean_ns\": " << s.mean << ", \"stddev_ns\": " << s.stddev
+        << ", \"min_ns\": " << s.min << ", \"max_ns\": " << s.max << ", \"p10_ns\": " << s.p10
+        << ", \"p90_ns\": " << s.p90 << ", \"p99_ns\": " << s.p99
+        << ", \"ns_per_item\": " << result.nsPerItem()
+        << ", \"items_per_second\": " << result.itemsPerSecond();
+    if (result.hasAllocations())
+      out << ", \"allocations_per_item\": " << result.allocationsPerItem;
+    if (result.hasCounters()) {
+      out << ", \"counters_per_item\": {";
+      char const* sep = "";
+      for (std::size_t iCounter = 0; iCounter < NHardwareCounters; ++iCounter) {
+        if (!result.counters.valid[iCounter]) continue;
+        out << sep << '"' << hardwareCounterName(static_cast<HardwareCounter_t>(iCounter))
+            << "\": " << result.counters.values[iCounter];
+        sep = ", ";
+      }
+      out << "}";
+    }
+    out << "}";
+  }
+  out << "\n  ]\n}\n";
+} // testing::Benchmark<>::writeJSON()
+
+//------------------------------------------------------------------------------
+template <typename Clock>
+template <typename Stream>
+void testing::Benchmark<Clock>::writeCSV(Stream&& out) const
+{
+  // allocation and counter columns are always present, and empty when not recorded
+  out << "name,items_per_call,calls_per_sample,samples,outliers,median_ns,mean_ns,stddev_ns,"
+         "min_ns,max_ns,p10_ns,p90_ns,p99_ns,ns_per_item,items_per_second,allocations_per_item";
+  for (std::size_t iCounter = 0; iCounter < NHardwareCounters; ++iCounter)
+    out << ',' << hardwareCounterName(static_cast<HardwareCounter_t>(iCounter)) << "_per_item";
+  out << "\n";
+  for (BenchmarkResult_t const& result : fResults) {
+    BenchmarkStats_t const& s = result.stats;
+    // names are quoted, with their quotes doubled
+    std::string name;
+    for (char const c : result.name)
+      name += (c == '"') ? std::string(2U, '"') : std::string(1U, c);
+    out << '"' << name << "\"," << result.itemsPerCall << ',' << result.callsPerSample << ','
+        << s.nSamples << ',' << s.nOutliers << ',' << s.median << ',' << s.mean << ','
+        << s.stddev << ',' << s.min << ',' << s.max << ',' << s.p10 << ',' << s.p90 << ','
+        << s.p99 << ',' << result.nsPerItem() << ',' << result.itemsPerSecond() << ',';
+    if (result.hasAllocations()) out << result.allocationsPerItem;
+    for (std::size_t iCounter = 0; iCounter < NHardwareCounters; ++iCounter) {
+      out << ',';
+      if (result.counters.valid[iCounter]) out << result.counters.values[iCounter];
+    }
+    out << "\n";
+  }
+} // testing::Benchmark<>::writeCSV()
+
+//------------------------------------------------------------------------------
+template <typename Clock>
+std::vector<testing::BaselineComparison_t> testing::Benchmark<Clock>::compareToBaseline(
+  std::map<std::string, double> const& baseline) const
+{
+  std::vector<BaselineComparison_t> comparisons;
+  for (BenchmarkResult_t const& result : fResults) {
+    BaselineComparison_t comparison;
+    comparison.name = result.name;
+    comparison.measured = result.nsPerItem();
+    if (auto const it = baseline.find(result.name); it != baseline.end())
+      comparison.baseline = it->second;
+    comparisons.push_back(std::move(comparison));
+  }
+  return comparisons;
+} // testing::Benchmark<>::compareToBaseline()
+
+//------------------------------------------------------------------------------
+template <typename Clock>
+template <typename Stream>
+unsigned int testing::Benchmark<Clock>::report(BenchmarkOptions_t const& options,
+                                               Stream&& out) const
+{
+  printTable(out);
+  if (fConfig.hardwareCounters && !fCounters.available()) {
+    out << "Hardware counters not available (" << fCounters.unavailableReason() << ").\n";
+  }
+
+  if (!options.JSONpath.empty()) writeJSON(std::ofstream{options.JSONpath});
+  if (!options.CSVpath.empty()) writeCSV(std::ofstream{options.CSVpath});
+
+  if (options.baselinePath.empty()) return 0U;
+
+  std::ifstream baselineFile{options.baselinePath};
+  std::map<std::string, double> const baseline = readBenchmarkBaseline(baselineFile);
+  if (baseline.empty()) {
+    out << "No baseline could be read from '" << options.baselinePath
+        << "': comparison skipped.\n";
+    return 0U;
+  }
+
+  unsigned int nRegressions = 0U;
+  out << "Comparison with baseline '" << options.baselinePath << "' (tolerance "
+      << (options.tolerance * 100.0) << "%):\n";
+  for (BaselineComparison_t const& comparison : compareToBaseline(baseline)) {
+    out << "  " << comparison.name << ": ";
+    if (!comparison.hasBaseline()) {
+      out << "no baseline\n";
+      continue;
+    }
+    out << comparison.measured << " ns/item vs. " << comparison.baseline << " ("
+        << ((comparison.ratio() - 1.0) * 100.0) << "%)";
+    if (comparison.isRegression(options.tolerance)) {
+      out << (options.warnOnly ? " [REGRESSION, warning only]" : " [REGRESSION]");
+      ++nRegressions;
+    }
+    out << "\n";
+  } // for
+  return options.warnOnly ? 0U : nRegressions;
+} // testing::Benchmark<>::report()
+
+//------------------------------------------------------------------------------
+template <typename Clock>
+bool testing::Benchmark<Clock>::hasCounters() const
+{
+  for (BenchmarkResult_t const& result : fResults)
+    if (result.hasCounters()) return true;
+  return false;
+} // testing::Benchmark<>::hasCounters()
+
+//------------------------------------------------------------------------------
+template <typename Clock>
+bool testing::Benchmark<Clock>::hasAllocations() const
+{
+  for (BenchmarkResult_t const& result : fResults)
+    if (result.hasAllocations()) return true;
+  return false;
+} // testing::Benchmark<>::hasAllocations()
+
+//------------------------------------------------------------------------------
+template <typename Clock>
+std::string testing::Benchmark<Clock>::escapeJSON(std::string const& s)
+{
+  std::string escaped;
+  for (char const c : s) {
+    switch (c) {
+    case '"': escaped += "\\\""; break;
+    case '\\': escaped += "\\\\"; break;
+    case '\n': escaped += "\\n"; break;
+    case '\t': escaped += "\\t"; break;
+    default: escaped += c;
+    }
+  }
+  return escaped;
+} // testing::Benchmark<>::escapeJSON()
+
+//------------------------------------------------------------------------------
+
+#endif // LARCORE_TESTUTILS_BENCHMARK_H
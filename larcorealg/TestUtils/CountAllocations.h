@@ -0,0 +1,102 @@
+/**
+ * @file   larcorealg/TestUtils/CountAllocations.h
+ * @brief  Replacement of the global allocation functions, counting the calls.
+ * @see    `larcorealg/TestUtils/AllocationCounter.h`
+ *
+ * This header defines the global `operator new` and `operator delete`, which
+ * may be defined only once in a program: it must be included in exactly one
+ * source file, usually the one with `main()`. Then `testing::allocationCount()`
+ * returns the number of allocations, and the benchmarks of
+ * `testing::Benchmark` report the allocations per item.
+ * The allocations with extended alignment are not counted.
+ */
+
+#ifndef LARCORE_TESTUTILS_COUNTALLOCATIONS_H
+#define LARCORE_TESTUTILS_COUNTALLOCATIONS_H
+
+// LArSoft libraries
+#include "larcorealg/TestUtils/AllocationCounter.h"
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <cstdlib> // std::malloc(), std::free()
+#include <new>     // std::bad_alloc, std::nothrow_t
+
+namespace testing::details {
+
+  /// Switches the counting on when the program starts.
+  static bool const allocationCountingEnabled = (allocationsCounted.store(true), true);
+
+  /// Allocates `size` bytes, counting the allocation; null on failure.
+  inline void* countedAllocation(std::size_t size) noexcept
+  {
+    countAllocation();
+    return std::malloc(size ? size : 1U);
+  }
+
+} // namespace testing::details
+
+void* operator new(std::size_t size)
+{
+  if (void* p = testing::details::countedAllocation(size)) return p;
+  throw std::bad_alloc{};
+}
+
+void* operator new[](std::size_t size)
+{
+  if (void* p = testing::details::countedAllocation(size)) return p;
+  throw std::bad_alloc{};
+}
+
+void* operator new(std::size_t size, std::nothrow_t const&) noexcept
+{
+  return testing::details::countedAllocation(size);
+}
+
+void* operator new[](std::size_t size, std::nothrow_t const&) noexcept
+{
+  return testing::details::countedAllocation(size);
+}
+
+// the memory from the replaced `operator new` is from `std::malloc()`,
+// which GCC can't tell when it inlines the two functions
+#if defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 11)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void operator delete(void* p) noexcept
+{
+  std::free(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+  std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+  std::free(p);
+}
+
+void operator delete[](void* p, std::size_t) noexcept
+{
+  std::free(p);
+}
+
+void operator delete(void* p, std::nothrow_t const&) noexcept
+{
+  std::free(p);
+}
+
+void operator delete[](void* p, std::nothrow_t const&) noexcept
+{
+  std::free(p);
+}
+
+#if defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 11)
+#pragma GCC diagnostic pop
+#endif
+
+#endif // LARCORE_TESTUTILS_COUNTALLOCATIONS_H
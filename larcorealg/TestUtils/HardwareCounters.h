@@ -0,0 +1,292 @@
+/**
+ * @file   larcorealg/TestUtils/HardwareCounters.h
+ * @brief  Access to the hardware performance counters of the processor.
+ * @see    `larcorealg/TestUtils/Benchmark.h`
+ *
+ * This is a pure header library.
+ *
+ * It provides `testing::HardwareCounters`, which uses the Linux
+ * `perf_event_open()` interface. On other systems, and where the interface is
+ * not permitted (e.g. in many containers, or with a restrictive
+ * `/proc/sys/kernel/perf_event_paranoid`), the counters are just unavailable.
+ */
+
+#ifndef LARCORE_TESTUTILS_HARDWARECOUNTERS_H
+#define LARCORE_TESTUTILS_HARDWARECOUNTERS_H
+
+// C/C++ standard libraries
+#include <array>
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint64_t
+#include <cstring> // std::strerror()
+#include <string>
+#include <utility> // std::exchange(), std::move()
+
+#if defined(__linux__)
+#include <cerrno>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#define LARCORE_TESTUTILS_HAS_PERF_EVENT 1
+#endif
+
+namespace testing {
+
+  /// Hardware events counted by `testing::HardwareCounters`.
+  enum class HardwareCounter_t : std::size_t {
+    Cycles,       ///< Processor cycles.
+    Instructions, ///< Retired instructions.
+    L1DMisses,    ///< Read misses of the level 1 data cache.
+    LLCMisses,    ///< Misses of the last level cache.
+    BranchMisses, ///< Mispredicted branches.
+    NCounters     ///< Number of supported counters.
+  }; // HardwareCounter_t
+
+  /// Number of supported hardware counters.
+  constexpr std::size_t NHardwareCounters = static_cast<std::size_t>(HardwareCounter_t::NCounters);
+
+  /// Returns the name of the `counter`, as used in the reports.
+  inline char const* hardwareCounterName(HardwareCounter_t counter)
+  {
+    switch (counter) {
+    case HardwareCounter_t::Cycles: return "cycles";
+    case HardwareCounter_t::Instructions: return "instructions";
+    case HardwareCounter_t::L1DMisses: return "L1D_misses";
+    case HardwareCounter_t::LLCMisses: return "LLC_misses";
+    case HardwareCounter_t::BranchMisses: return "branch_misses";
+    default: return "unknown";
+    }
+  }
+
+  /// Values of all the hardware counters; unavailable counters are not valid.
+  struct HardwareCounterValues_t {
+    std::array<double, NHardwareCounters> values{};
+    std::array<bool, NHardwareCounters> valid{};
+
+    /// Returns whether the value of `counter` is available.
+    bool isValid(HardwareCounter_t counter) const
+    {
+      return valid[static_cast<std::size_t>(counter)];
+    }
+
+    /// Returns the value of `counter` (`0` if not available).
+    double operator[](HardwareCounter_t counter) const
+    {
+      return values[static_cast<std::size_t>(counter)];
+    }
+
+    /// Returns whether any of the counters is available.
+    bool any() const
+    {
+      for (bool const v : valid)
+        if (v) return true;
+      return false;
+    }
+
+    /// Adds the values of `other`; counters invalid in either become invalid.
+    HardwareCounterValues_t& operator+=(HardwareCounterValues_t const& other)
+    {
+      for (std::size_t i = 0; i < NHardwareCounters; ++i) {
+        values[i] += other.values[i];
+        valid[i] = valid[i] && other.valid[i];
+      }
+      return *this;
+    }
+
+    /// Divides all the values by `n`.
+    HardwareCounterValues_t& operator/=(double n)
+    {
+      for (double& value : values)
+        value /= n;
+      return *this;
+    }
+  }; // HardwareCounterValues_t
+
+  /**
+   * @brief Counts hardware events in the current thread.
+   *
+   * The counters are opened at construction, each one independently: the ones
+   * the processor or the operating system do not support are unavailable, and
+   * the others work anyway. If the kernel multiplexes the counters, the
+   * values are scaled to the full counting time.
+   * Only the events in user space are counted.
+   *
+   * Example:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * testing::HardwareCounters counters;
+   * counters.start();
+   * // ... code to be measured
+   * counters.stop();
+   * auto const values = counters.read();
+   * if (values.isValid(testing::HardwareCounter_t::LLCMisses))
+   *   std::cout << values[testing::HardwareCounter_t::LLCMisses] << " cache misses\n";
+   * else
+   *   std::cout << "No cache miss counter: " << counters.unavailableReason() << "\n";
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   */
+  class HardwareCounters {
+  public:
+    /// Constructor: opens all the available counters (stopped).
+    HardwareCounters();
+
+    /// Constructor: does not open any counter if `enable` is `false`.
+    explicit HardwareCounters(bool enable);
+
+    HardwareCounters(HardwareCounters const&) = delete;
+    HardwareCounters& operator=(HardwareCounters const&) = delete;
+    HardwareCounters(HardwareCounters&& other) noexcept
+      : fFD{other.fFD}, fReason{std::move(other.fReason)}
+    {
+      other.fFD.fill(-1);
+    }
+    HardwareCounters& operator=(HardwareCounters&& other) noexcept
+    {
+      close();
+      fFD = other.fFD;
+      other.fFD.fill(-1);
+      fReason = std::move(other.fReason);
+      return *this;
+    }
+
+    /// Destructor: closes the counters.
+    ~HardwareCounters() { close(); }
+
+    /// Returns whether at least one counter is available.
+    bool available() const;
+
+    /// Returns whether `counter` is available.
+    bool available(HardwareCounter_t counter) const
+    {
+      return fFD[static_cast<std::size_t>(counter)] >= 0;
+    }
+
+    /// Returns the reason why the first unavailable counter could not be
+    /// opened (empty if all are available).
+    std::string const& unavailableReason() const { return fReason; }
+
+    /// Resets and starts all the counters.
+    void start();
+
+    /// Stops all the counters.
+    void stop();
+
+    /// Returns the current values of the counters.
+    HardwareCounterValues_t read() const;
+
+  private:
+    std::array<int, NHardwareCounters> fFD; ///< File descriptors (`-1`: not open).
+    std::string fReason; ///< Reason why a counter is not available.
+
+    /// Closes all the counters.
+    void close();
+
+  }; // class HardwareCounters
+
+} // namespace testing
+
+//------------------------------------------------------------------------------
+//--- inline implementation
+//------------------------------------------------------------------------------
+inline testing::HardwareCounters::HardwareCounters() : HardwareCounters(true) {}
+
+//------------------------------------------------------------------------------
+inline testing::HardwareCounters::HardwareCounters(bool enable)
+{
+  fFD.fill(-1);
+  if (!enable) {
+    fReason = "hardware counters disabled";
+    return;
+  }
+
+#if defined(LARCORE_TESTUTILS_HAS_PERF_EVENT)
+  auto const open = [this](HardwareCounter_t counter, std::uint32_t type, std::uint64_t config) {
+    perf_event_attr attr{};
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    long const fd = syscall(__NR_perf_event_open, &attr, 0, -1, -1, PERF_FLAG_FD_CLOEXEC);
+    if (fd >= 0)
+      fFD[static_cast<std::size_t>(counter)] = static_cast<int>(fd);
+    else if (fReason.empty())
+      fReason = std::string{hardwareCounterName(counter)} + ": " + std::strerror(errno);
+  };
+
+  open(HardwareCounter_t::Cycles, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+  open(HardwareCounter_t::Instructions, PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+  open(HardwareCounter_t::L1DMisses,
+       PERF_TYPE_HW_CACHE,
+       PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+         (PERF_COUNT_HW_CACHE_RESULT_MISS << 16));
+  open(HardwareCounter_t::LLCMisses, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+  open(HardwareCounter_t::BranchMisses, PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+#else
+  fReason = "hardware counters not supported on this platform";
+#endif
+} // testing::HardwareCounters::HardwareCounters()
+
+//------------------------------------------------------------------------------
+inline bool testing::HardwareCounters::available() const
+{
+  for (int const fd : fFD)
+    if (fd >= 0) return true;
+  return false;
+}
+
+//------------------------------------------------------------------------------
+inline void testing::HardwareCounters::start()
+{
+#if defined(LARCORE_TESTUTILS_HAS_PERF_EVENT)
+  for (int const fd : fFD) {
+    if (fd < 0) continue;
+    ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+    ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+  }
+#endif
+} // testing::HardwareCounters::start()
+
+//------------------------------------------------------------------------------
+inline void testing::HardwareCounters::stop()
+{
+#if defined(LARCORE_TESTUTILS_HAS_PERF_EVENT)
+  for (int const fd : fFD)
+    if (fd >= 0) ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+#endif
+} // testing::HardwareCounters::stop()
+
+//------------------------------------------------------------------------------
+inline testing::HardwareCounterValues_t testing::HardwareCounters::read() const
+{
+  HardwareCounterValues_t values;
+#if defined(LARCORE_TESTUTILS_HAS_PERF_EVENT)
+  for (std::size_t i = 0; i < NHardwareCounters; ++i) {
+    if (fFD[i] < 0) continue;
+    std::uint64_t data[3]; // value, time enabled, time running
+    if (::read(fFD[i], data, sizeof(data)) != static_cast<ssize_t>(sizeof(data))) continue;
+    if (data[2] == 0U) { // never scheduled: the counter value is meaningless
+      values.valid[i] = (data[1] == 0U); // ... unless it was never enabled
+      continue;
+    }
+    values.values[i] = static_cast<double>(data[0]) * data[1] / data[2];
+    values.valid[i] = true;
+  } // for
+#endif
+  return values;
+} // testing::HardwareCounters::read()
+
+//------------------------------------------------------------------------------
+inline void testing::HardwareCounters::close()
+{
+#if defined(LARCORE_TESTUTILS_HAS_PERF_EVENT)
+  for (int& fd : fFD)
+    if (fd >= 0) ::close(std::exchange(fd, -1));
+#endif
+} // testing::HardwareCounters::close()
+
+//------------------------------------------------------------------------------
+
+#endif // LARCORE_TESTUTILS_HARDWARECOUNTERS_H
@@ -22,7 +22,9 @@
 #include "larcorealg/TestUtils/ProviderTestHelpers.h"
 
 // C/C++ standard libraries
-#include <memory> // std::unique_ptr()
+#include <memory>    // std::unique_ptr(), std::shared_ptr()
+#include <stdexcept> // std::runtime_error
+#include <string>
 #include <typeinfo>
 #include <unordered_map>
 #include <utility> // std::forward()
@@ -272,6 +274,28 @@ namespace testing {
       return true;
     } // acquire()
 
+    /**
+       * @brief Registers and shares the ownership of the specified object
+       * @tparam T type of object being shared
+       * @param obj_ptr pointer to the object to be shared
+       * @param label name of the object instance
+       * @return whether the object was registered or not
+       *
+       * Like `acquire()`, but the object stays alive also while other owners
+       * hold it, e.g. when a provider is shared by different lists.
+       */
+    template <typename T>
+    bool share(std::shared_ptr<T> obj_ptr, std::string label = "")
+    {
+      auto k = key<T>(label); // key
+      auto it = data.find(k);
+      if (it != data.end()) return false;
+
+      pointer_t ptr = std::make_unique<concrete_type_t<T>>(std::move(obj_ptr));
+      data.emplace_hint(it, std::move(k), std::move(ptr));
+      return true;
+    } // share()
+
     /**
        * @brief Drops the object with the specified type and label
        * @tparam T type of object being acquired
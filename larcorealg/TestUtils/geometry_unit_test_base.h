@@ -25,6 +25,16 @@
  * - BasicGeometryEnvironmentConfiguration: a test environment configuration
  * - GeometryTesterEnvironment: a prepacked geometry-aware test environment
  *
+ * Loading the geometry is the slowest part of the set up. Test suites with
+ * many environments can share it:
+ * - within one process, with `SetSharedGeometry()`: all the environments
+ *   with the same geometry configuration use the same (constant) geometry;
+ * - among processes, with a cache of geometry snapshots
+ *   (`SetGeometrySnapshotCache()`): `GeometryTesterEnvironment::Snapshot()`
+ *   reads the `geo::GeometrySnapshot` from the cache, which is written by the
+ *   first process needing it; with `SetSnapshotOnlyGeometry()`, the geometry
+ *   is not loaded at all when the snapshot is in the cache.
+ *
  */
 
 #ifndef TEST_GEOMETRY_UNIT_TEST_BASE_H
@@ -43,12 +53,22 @@
 #include "cetlib/filepath_maker.h"
 #include "cetlib/filesystem.h" // cet::is_absolute_filepath()
 #include "cetlib/search_path.h"
+#include "cetlib_except/exception.h"
 
 // C/C++ standard libraries
+#include <cstdint>    // std::uintptr_t
+#include <cstdlib>    // std::getenv()
+#include <filesystem> // std::filesystem::last_write_time()
+#include <fstream>
 #include <iostream> // for output before message facility is set up
 #include <map>
 #include <memory> // std::unique_ptr<>
+#include <mutex>
 #include <string>
+#include <system_error> // std::error_code
+#include <thread>       // std::this_thread::get_id()
+#include <typeinfo>
+#include <utility> // std::pair
 
 namespace testing {
 
@@ -103,6 +123,15 @@ namespace testing {
       return DefaultServiceConfiguration(GeometryServiceName());
     }
 
+    /// Whether the geometry is shared with the other environments of the process
+    bool SharedGeometry() const { return fSharedGeometry; }
+
+    /// Directory of the cached geometry snapshots (empty if no cache)
+    std::string const& GeometrySnapshotCache() const { return fSnapshotCache; }
+
+    /// Whether the geometry is not loaded when its snapshot is in the cache
+    bool SnapshotOnlyGeometry() const { return fSnapshotOnly; }
+
     ///@}
 
     /// @{
@@ -120,6 +149,23 @@ namespace testing {
       AddDefaultServiceConfiguration(GeometryServiceName(), cfg);
     }
 
+    /// Sets whether to share the geometry with the other environments of the
+    /// process with the same geometry configuration
+    void SetSharedGeometry(bool share = true) { fSharedGeometry = share; }
+
+    /**
+     * @brief Sets the directory of the cached geometry snapshots
+     * @param dir the directory (must exist); empty disables the cache
+     *
+     * The default is from the `LARCOREALG_GEOMETRY_SNAPSHOT_CACHE` environment
+     * variable, if set. Each geometry configuration has its own file there.
+     */
+    void SetGeometrySnapshotCache(std::string dir) { fSnapshotCache = std::move(dir); }
+
+    /// Sets whether to skip the loading of the geometry when its snapshot is
+    /// in the cache (see `SetGeometrySnapshotCache()`)
+    void SetSnapshotOnlyGeometry(bool snapshotOnly = true) { fSnapshotOnly = snapshotOnly; }
+
     ///@}
 
     /// Returns the name of the service
@@ -136,10 +182,35 @@ namespace testing {
           ROOT:            "LArTPCdetector.gdml"
           SortingParameters: {}  # empty parameter set for default
           )");
+      if (char const* cache = std::getenv("LARCOREALG_GEOMETRY_SNAPSHOT_CACHE"))
+        fSnapshotCache = cache;
     } // LocalInit()
 
+  private:
+    bool fSharedGeometry = false; ///< Whether to share the geometry in the process.
+    std::string fSnapshotCache;   ///< Directory of the geometry snapshot cache.
+    bool fSnapshotOnly = false;   ///< Whether to use only the cached snapshot.
+
   }; // class BasicGeometryEnvironmentConfiguration<>
 
+  namespace details {
+
+    /// Geometries and snapshots shared by the environments of the process.
+    struct SharedGeometryCache {
+      std::mutex lock; ///< Protects the content.
+      std::map<std::string, std::shared_ptr<geo::GeometryCore>> geometries;
+      std::map<std::string, std::shared_ptr<geo::GeometrySnapshot const>> snapshots;
+
+      /// Returns the cache of the process.
+      static SharedGeometryCache& instance()
+      {
+        static SharedGeometryCache cache;
+        return cache;
+      }
+    }; // SharedGeometryCache
+
+  } // namespace details
+
   /** **************************************************************************
    * @brief Environment for a geometry test
    * @tparam ConfigurationClass a class providing compile-time configuration
@@ -250,6 +321,18 @@ namespace testing {
     /// Returns the current global geometry instance (may be nullptr if none)
     static SharedGeoPtr_t SharedGlobalGeometry() { return GeoResources_t::ShareResource(); }
 
+    /**
+     * @brief Returns the snapshot of the geometry
+     * @see `geo::GeometrySnapshot`, `SetGeometrySnapshotCache()`
+     *
+     * The snapshot is read from the snapshot cache if it is there and not
+     * older than the ROOT geometry file; otherwise it is made from the
+     * geometry, and written into the cache if there is one.
+     * With a shared geometry, the snapshot is also shared in the process.
+     * This method must not be called concurrently on the same environment.
+     */
+    geo::GeometrySnapshot const& Snapshot() const;
+
   protected:
     using ChannelMapClass = typename ConfigurationClass::ChannelMapClass;
 
@@ -259,6 +342,30 @@ namespace testing {
     /// Creates a new geometry
     virtual std::unique_ptr<geo::GeometryCore> CreateNewGeometry() const;
 
+    /// Returns the configuration of the geometry
+    fhicl::ParameterSet GeometryConfiguration() const
+    {
+      return this->Parameters().template get<fhicl::ParameterSet>(
+        this->Config().GeometryParameterSetPath());
+    }
+
+    /// Returns the paths of the GDML and ROOT files of the geometry in `config`
+    static std::pair<std::string, std::string> FindGeometryFiles(
+      fhicl::ParameterSet const& config);
+
+    /// Returns a key identifying the geometry, from its configuration and the
+    /// channel mapping
+    std::string GeometryKey() const;
+
+    /// Returns the path of the cached snapshot (empty if no cache)
+    std::string SnapshotCachePath() const;
+
+    /// Reads the snapshot from the cache (`nullptr` if not available or stale)
+    std::shared_ptr<geo::GeometrySnapshot const> ReadCachedSnapshot() const;
+
+    /// Writes `snapshot` into the cache, if any
+    void WriteCachedSnapshot(geo::GeometrySnapshot const& snapshot) const;
+
     //@{
     /// Get ownership of the specified geometry and registers it as global
     virtual void RegisterGeometry(SharedGeoPtr_t new_geom);
@@ -276,6 +383,9 @@ namespace testing {
 
     SharedGeoPtr_t geom; ///< pointer to the geometry
 
+    /// Snapshot of the geometry (created on demand).
+    mutable std::shared_ptr<geo::GeometrySnapshot const> snapshot;
+
   }; // class GeometryTesterEnvironment<>
 
   //****************************************************************************
@@ -302,19 +412,37 @@ namespace testing {
   GeometryTesterEnvironment<ConfigurationClass>::CreateNewGeometry() const
   {
 
-    std::string ProviderParameterSetPath = this->Config().GeometryParameterSetPath();
-
     //
     // create the new geometry service provider
     //
-    fhicl::ParameterSet ProviderConfig =
-      this->Parameters().template get<fhicl::ParameterSet>(ProviderParameterSetPath);
+    fhicl::ParameterSet const ProviderConfig = GeometryConfiguration();
     auto new_geom = std::make_unique<geo::GeometryCore>(ProviderConfig);
 
-    std::string RelativePath = ProviderConfig.get<std::string>("RelativePath", "");
+    // initialize the geometry with the files we have found
+    auto const [GDMLfile, ROOTfile] = FindGeometryFiles(ProviderConfig);
+    new_geom->LoadGeometryFile(GDMLfile, ROOTfile);
+
+    //
+    // create the new channel map
+    //
+    auto const SortingParameters = ProviderConfig.get<fhicl::ParameterSet>("SortingParameters", {});
+
+    // connect the channel map with the geometry, that shares ownsership
+    // (we give up ours at the end of this method)
+    new_geom->ApplyChannelMap(std::make_unique<ChannelMapClass>(SortingParameters));
+
+    return new_geom;
+  } // GeometryTesterEnvironment<>::CreateNewGeometry()
+
+  template <typename ConfigurationClass>
+  std::pair<std::string, std::string>
+  GeometryTesterEnvironment<ConfigurationClass>::FindGeometryFiles(
+    fhicl::ParameterSet const& config)
+  {
+    std::string RelativePath = config.get<std::string>("RelativePath", "");
 
-    std::string GDMLFileName = RelativePath + ProviderConfig.get<std::string>("GDML"),
-                ROOTFileName = RelativePath + ProviderConfig.get<std::string>("ROOT");
+    std::string GDMLFileName = RelativePath + config.get<std::string>("GDML"),
+                ROOTFileName = RelativePath + config.get<std::string>("ROOT");
 
     // Search all reasonable locations for the geometry file;
     // we see if by any chance art's FW_SEARCH_PATH directory is set and try
@@ -331,20 +459,115 @@ namespace testing {
       mf::LogWarning("CreateNewGeometry") << "GDML file '" << GDMLfile << "' not found.";
     }
 
-    // initialize the geometry with the files we have found
-    new_geom->LoadGeometryFile(GDMLfile, ROOTfile);
+    return {GDMLfile, ROOTfile};
+  } // GeometryTesterEnvironment<>::FindGeometryFiles()
 
-    //
-    // create the new channel map
-    //
-    auto const SortingParameters = ProviderConfig.get<fhicl::ParameterSet>("SortingParameters", {});
+  template <typename ConfigurationClass>
+  std::string GeometryTesterEnvironment<ConfigurationClass>::GeometryKey() const
+  {
+    fhicl::ParameterSet keyConfig = GeometryConfiguration();
+    keyConfig.put("TestChannelMapClass", std::string{typeid(ChannelMapClass).name()});
+    return keyConfig.id().to_string();
+  } // GeometryTesterEnvironment<>::GeometryKey()
 
-    // connect the channel map with the geometry, that shares ownsership
-    // (we give up ours at the end of this method)
-    new_geom->ApplyChannelMap(std::make_unique<ChannelMapClass>(SortingParameters));
+  template <typename ConfigurationClass>
+  std::string GeometryTesterEnvironment<ConfigurationClass>::SnapshotCachePath() const
+  {
+    std::string const& dir = this->Config().GeometrySnapshotCache();
+    if (dir.empty()) return {};
+    return dir + "/geometry-" + GeometryKey() + ".snapshot";
+  } // GeometryTesterEnvironment<>::SnapshotCachePath()
 
-    return new_geom;
-  } // GeometryTesterEnvironment<>::CreateNewGeometry()
+  template <typename ConfigurationClass>
+  std::shared_ptr<geo::GeometrySnapshot const>
+  GeometryTesterEnvironment<ConfigurationClass>::ReadCachedSnapshot() const
+  {
+    std::string const path = SnapshotCachePath();
+    if (path.empty()) return {};
+
+    std::error_code error;
+    auto const cacheTime = std::filesystem::last_write_time(path, error);
+    if (error) return {}; // not in the cache yet
+
+    std::string const ROOTfile = FindGeometryFiles(GeometryConfiguration()).second;
+    auto const geometryTime = std::filesystem::last_write_time(ROOTfile, error);
+    if (!error && (geometryTime > cacheTime)) {
+      mf::LogInfo("Test") << "Geometry snapshot '" << path << "' is older than '" << ROOTfile
+                          << "': not used.";
+      return {};
+    }
+
+    std::ifstream in{path, std::ios::binary};
+    try {
+      return std::make_shared<geo::GeometrySnapshot const>(geo::GeometrySnapshot::read(in));
+    }
+    catch (cet::exception const& e) {
+      mf::LogWarning("Test") << "Geometry snapshot '" << path << "' not used:\n" << e.what();
+      return {};
+    }
+  } // GeometryTesterEnvironment<>::ReadCachedSnapshot()
+
+  template <typename ConfigurationClass>
+  void GeometryTesterEnvironment<ConfigurationClass>::WriteCachedSnapshot(
+    geo::GeometrySnapshot const& snapshot) const
+  {
+    std::string const path = SnapshotCachePath();
+    if (path.empty()) return;
+
+    // written under a temporary name and renamed at once, so that the other
+    // processes never read an incomplete file
+    std::string const tmpPath =
+      path + ".tmp" + std::to_string(reinterpret_cast<std::uintptr_t>(this)) + "_" +
+      std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id()));
+    {
+      std::ofstream out{tmpPath, std::ios::binary};
+      snapshot.write(out);
+      if (!out) {
+        mf::LogWarning("Test") << "Geometry snapshot could not be written into '" << tmpPath
+                               << "'.";
+      }
+    }
+    std::error_code error;
+    std::filesystem::rename(tmpPath, path, error);
+    if (error) {
+      mf::LogWarning("Test") << "Geometry snapshot could not be saved as '" << path
+                             << "': " << error.message();
+      std::filesystem::remove(tmpPath, error);
+    }
+  } // GeometryTesterEnvironment<>::WriteCachedSnapshot()
+
+  template <typename ConfigurationClass>
+  geo::GeometrySnapshot const& GeometryTesterEnvironment<ConfigurationClass>::Snapshot() const
+  {
+    if (snapshot) return *snapshot;
+
+    bool const shared = this->Config().SharedGeometry();
+    auto& cache = details::SharedGeometryCache::instance();
+    std::string const key = GeometryKey();
+    if (shared) {
+      std::lock_guard<std::mutex> const guard{cache.lock};
+      auto const it = cache.snapshots.find(key);
+      if (it != cache.snapshots.end()) {
+        snapshot = it->second;
+        return *snapshot;
+      }
+    }
+
+    snapshot = ReadCachedSnapshot();
+    if (!snapshot) {
+      // geometry is always present when the snapshot is not in the cache
+      auto newSnapshot =
+        std::make_shared<geo::GeometrySnapshot const>(geom->MakeGeometrySnapshot());
+      WriteCachedSnapshot(*newSnapshot);
+      snapshot = std::move(newSnapshot);
+    }
+
+    if (shared) {
+      std::lock_guard<std::mutex> const guard{cache.lock};
+      cache.snapshots.emplace(key, snapshot);
+    }
+    return *snapshot;
+  } // GeometryTesterEnvironment<>::Snapshot()
 
   template <typename ConfigurationClass>
   void GeometryTesterEnvironment<ConfigurationClass>::RegisterGeometry(SharedGeoPtr_t new_geom)
@@ -362,6 +585,31 @@ namespace testing {
   template <typename ConfigurationClass>
   void GeometryTesterEnvironment<ConfigurationClass>::SetupGeometry()
   {
+    if (this->Config().SnapshotOnlyGeometry()) {
+      snapshot = ReadCachedSnapshot();
+      if (snapshot) {
+        mf::LogInfo("Test") << "Geometry snapshot read from '" << SnapshotCachePath()
+                            << "': geometry not loaded.";
+        return;
+      }
+    }
+
+    if (this->Config().SharedGeometry()) {
+      // one geometry for all the environments with the same configuration;
+      // it is both the "old" and the "new" one (see below)
+      auto& cache = details::SharedGeometryCache::instance();
+      std::shared_ptr<geo::GeometryCore> shared;
+      {
+        std::lock_guard<std::mutex> const guard{cache.lock};
+        std::shared_ptr<geo::GeometryCore>& cached = cache.geometries[GeometryKey()];
+        if (!cached) cached = CreateNewGeometry();
+        shared = cached;
+      }
+      RegisterGeometry(shared);
+      this->template ShareProvider<geo::GeometryCore>(std::move(shared));
+      return;
+    }
+
     //
     // horrible, shameful hack to support the "new" testing environment
     // while the old one, informally deprecated, is still around;
@@ -818,6 +818,23 @@ namespace testing {
       return providers.getPointer<Prov>();
     }
 
+    /**
+     * @brief Registers a provider whose ownership is shared
+     * @param prov the provider to be shared
+     * @return a pointer to the provider
+     * @see AcquireProvider()
+     * @throw runtime_error if the provider already exists
+     *
+     * Like `AcquireProvider()`, but the provider may be also owned elsewhere,
+     * e.g. by another test environment.
+     */
+    template <typename Prov>
+    Prov* ShareProvider(std::shared_ptr<Prov> prov)
+    {
+      if (!providers.share(std::move(prov))) throw std::runtime_error("Provider already exists!");
+      return providers.getPointer<Prov>();
+    }
+
     /**
      * @brief Sets a provider up, recording it as implementation of Interface
      * @tparam Interface type of provider interface being implemented
@@ -0,0 +1,169 @@
+/**
+ * @file   CallSiteProfiler_test.cc
+ * @brief  Test of `lar::debug::CallSiteProfiler`.
+ * @see    `larcorealg/CoreUtils/CallSiteProfiler.h`
+ */
+
+// LArSoft libraries
+#include "larcorealg/CoreUtils/CallSiteProfiler.h"
+
+// Boost libraries
+#define BOOST_TEST_MODULE (CallSiteProfiler_test)
+#include <boost/test/unit_test.hpp>
+
+// C/C++ standard libraries
+#include <algorithm> // std::count()
+#include <cstdint>   // std::uint64_t
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+namespace {
+
+  lar::debug::CallSiteProfiler* profiler = nullptr;
+
+  // the instrumented function, and two different callers; each caller has a
+  // single call site, which loop unrolling or tail calls can't duplicate or
+  // remove, because the callers are identified by their return address
+  [[gnu::noinline]] int instrumented(int i)
+  {
+    profiler->record(0U);
+    return i + 1;
+  }
+
+  [[gnu::noinline]] int frequentCallOnce(int i)
+  {
+    int const result = instrumented(i);
+    asm volatile("" ::: "memory"); // keeps this frame: no tail call
+    return result;
+  }
+
+  [[gnu::noinline]] int rareCallOnce(int i)
+  {
+    int const result = instrumented(-i);
+    asm volatile("" ::: "memory"); // keeps this frame: no tail call
+    return result;
+  }
+
+  int frequentCaller(int n)
+  {
+    int sum = 0;
+    for (int i = 0; i < n; ++i)
+      sum += frequentCallOnce(i);
+    return sum;
+  }
+
+  int rareCaller(int n)
+  {
+    int sum = 0;
+    for (int i = 0; i < n; ++i)
+      sum += rareCallOnce(i);
+    return sum;
+  }
+
+} // local namespace
+
+// -----------------------------------------------------------------------------
+void test_CallSiteProfiler_counts()
+{
+  // this test binary is a single object: callers are picked by depth
+  lar::debug::CallSiteProfiler::Config_t config;
+  config.sampleEvery = 10U;
+  config.skipOwnLibrary = false;
+  lar::debug::CallSiteProfiler prof{{"instrumented", "never"}, config};
+  profiler = &prof;
+
+  frequentCaller(300);
+  rareCaller(100);
+
+  BOOST_TEST(prof.nMethods() == 2U);
+  BOOST_TEST(prof.methodName(0U) == "instrumented");
+  BOOST_TEST(prof.calls(0U) == 400U);
+  BOOST_TEST(prof.calls(1U) == 0U);
+  BOOST_TEST(prof.sampledCalls(0U) == 40U);
+  BOOST_TEST(prof.nSamples(0U) == 40U);
+
+  auto const callers = prof.topCallers(0U);
+  BOOST_TEST_REQUIRE(callers.size() == 2U);
+  BOOST_TEST(callers[0].samples == 30U);
+  BOOST_TEST(callers[0].fraction == 0.75);
+  BOOST_TEST(callers[0].estimatedCalls == 300U);
+  BOOST_TEST(callers[1].samples == 10U);
+  BOOST_TEST(callers[1].estimatedCalls == 100U);
+  BOOST_TEST(callers[0].caller != callers[1].caller);
+
+  BOOST_TEST(prof.topCallers(0U, 1U).size() == 1U);
+  BOOST_TEST(prof.topCallers(1U).empty());
+
+  // the report has a header, a line for the called method, one per caller
+  std::ostringstream sstr;
+  prof.report(sstr);
+  std::string const report = sstr.str();
+  BOOST_TEST_MESSAGE(report);
+  BOOST_TEST(std::count(report.begin(), report.end(), '\n') == 3);
+  BOOST_TEST(report.find("instrumented: 400 calls, 40 samples") != std::string::npos);
+  BOOST_TEST(report.find("never") == std::string::npos);
+
+  profiler = nullptr;
+} // test_CallSiteProfiler_counts()
+
+// -----------------------------------------------------------------------------
+void test_CallSiteProfiler_reservoir()
+{
+  lar::debug::CallSiteProfiler::Config_t config;
+  config.sampleEvery = 1U;
+  config.maxSamples = 50U;
+  config.skipOwnLibrary = false;
+  lar::debug::CallSiteProfiler prof{{"instrumented"}, config};
+  profiler = &prof;
+
+  frequentCaller(3000);
+  rareCaller(1000);
+
+  BOOST_TEST(prof.sampledCalls(0U) == 4000U);
+  BOOST_TEST(prof.nSamples(0U) == 50U);
+
+  // the kept samples are a random subset: both callers should show up
+  auto const callers = prof.topCallers(0U);
+  BOOST_TEST(callers.size() == 2U);
+  std::uint64_t total = 0U;
+  for (auto const& caller : callers)
+    total += caller.estimatedCalls;
+  BOOST_TEST(total == 4000U);
+
+  profiler = nullptr;
+} // test_CallSiteProfiler_reservoir()
+
+// -----------------------------------------------------------------------------
+void test_CallSiteProfiler_threads()
+{
+  lar::debug::CallSiteProfiler::Config_t config;
+  config.sampleEvery = 7U;
+  config.maxSamples = 100000U;
+  config.skipOwnLibrary = false;
+  lar::debug::CallSiteProfiler prof{{"instrumented"}, config};
+  profiler = &prof;
+
+  constexpr unsigned int NThreads = 4U;
+  constexpr int NCalls = 7000;
+  std::vector<std::thread> threads;
+  for (unsigned int i = 0; i < NThreads; ++i)
+    threads.emplace_back([] { frequentCaller(NCalls); });
+  for (auto& thread : threads)
+    thread.join();
+
+  BOOST_TEST(prof.calls(0U) == NThreads * NCalls);
+  BOOST_TEST(prof.nSamples(0U) == NThreads * NCalls / 7U);
+
+  profiler = nullptr;
+} // test_CallSiteProfiler_threads()
+
+// -----------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(CallSiteProfilerTestCase)
+{
+  test_CallSiteProfiler_counts();
+  test_CallSiteProfiler_reservoir();
+  test_CallSiteProfiler_threads();
+} // BOOST_AUTO_TEST_CASE(CallSiteProfilerTestCase)
@@ -16,8 +16,12 @@
 #include "larcorealg/CoreUtils/DebugUtils.h"
 
 // C/C++ standard libraries
+#include <algorithm> // std::count()
 #include <array>
+#include <sstream>
+#include <string>
 #include <type_traits>
+#include <vector>
 
 //------------------------------------------------------------------------------
 //--- static tests (would fail at compile time)
@@ -59,6 +63,65 @@ void static_assert_on_test()
 
 } // static_assert_on_test()
 
+//------------------------------------------------------------------------------
+[[gnu::noinline]] void captureHere(lar::debug::RawBacktrace_t& bt, unsigned int skip = 0U)
+{
+  lar::debug::captureBacktrace(bt, skip);
+  asm volatile("" ::: "memory"); // keeps this frame: no tail call
+}
+
+/// Captures into each of `samples` from the same call site, skipping `i` frames for the `i`-th.
+[[gnu::noinline]] void captureFromLoop(std::vector<lar::debug::RawBacktrace_t>& samples,
+                                       bool skipFrames)
+{
+  for (std::size_t i = 0; i < samples.size(); ++i)
+    captureHere(samples[i], skipFrames ? static_cast<unsigned int>(i) : 0U);
+}
+
+void rawBacktrace_test()
+{
+
+  lar::debug::prepareBacktraceCapture();
+
+  // capture the same call site twice, plus a different one
+  std::vector<lar::debug::RawBacktrace_t> samples(2U);
+  captureFromLoop(samples, false);
+  lar::debug::captureBacktrace(samples.emplace_back());
+
+  BOOST_TEST(!samples[0].empty());
+  BOOST_TEST(!samples[2].empty());
+  BOOST_CHECK_EQUAL_COLLECTIONS(
+    samples[0].begin(), samples[0].end(), samples[1].begin(), samples[1].end());
+
+  // skipping drops the innermost frames, the same call site leaves the others
+  std::vector<lar::debug::RawBacktrace_t> bySkip(2U);
+  captureFromLoop(bySkip, true);
+  BOOST_TEST_REQUIRE(bySkip[0].size() > 1U);
+  BOOST_CHECK_EQUAL_COLLECTIONS(
+    bySkip[0].begin() + 1, bySkip[0].end(), bySkip[1].begin(), bySkip[1].end());
+
+  lar::debug::BacktraceSymbolizer symbolizer;
+  symbolizer.symbolizeAll(samples.begin(), samples.end());
+  std::size_t const nAddresses = symbolizer.cacheSize();
+  BOOST_TEST(nAddresses > 0U);
+  BOOST_TEST(nAddresses < samples[0].size() + samples[1].size() + samples[2].size());
+
+  // a second translation uses the cache
+  symbolizer.symbolize(samples[1]);
+  BOOST_TEST(symbolizer.cacheSize() == nAddresses);
+  BOOST_TEST(&symbolizer.callInfo(samples[0].frames[0]) ==
+             &symbolizer.callInfo(samples[1].frames[0]));
+
+  lar::debug::BacktracePrintOptions options;
+  options.maxLines = 2U;
+  std::ostringstream sstr;
+  symbolizer.print(sstr, samples[0], options);
+  std::string const output = sstr.str();
+  BOOST_TEST(std::count(output.begin(), output.end(), '\n') == 3);
+  BOOST_TEST(output.find(" ... and other ") != std::string::npos);
+
+} // rawBacktrace_test()
+
 //------------------------------------------------------------------------------
 
 BOOST_AUTO_TEST_CASE(ReferencesTestCase)
@@ -68,4 +131,11 @@ BOOST_AUTO_TEST_CASE(ReferencesTestCase)
 
 } // BOOST_AUTO_TEST_CASE(ReferencesTestCase)
 
+BOOST_AUTO_TEST_CASE(RawBacktraceTestCase)
+{
+
+  rawBacktrace_test();
+
+} // BOOST_AUTO_TEST_CASE(RawBacktraceTestCase)
+
 //------------------------------------------------------------------------------
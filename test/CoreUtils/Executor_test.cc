@@ -0,0 +1,105 @@
+/**
+ * @file   Executor_test.cc
+ * @brief  Unit test for `lar::util::Executor`.
+ * @date   October 14, 2026
+ * @see    `larcorealg/CoreUtils/Executor.h`
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE (executor test)
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "larcorealg/CoreUtils/Executor.h"
+
+// C/C++ standard libraries
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+//------------------------------------------------------------------------------
+void checkExecutor(lar::util::Executor const& executor)
+{
+  // loop on indices
+  for (std::size_t const n : {0U, 1U, 3U, 1000U}) {
+    std::vector<std::atomic<int>> runs(n);
+    executor.parallel_for(n, [&runs](std::size_t i) { ++runs[i]; });
+    for (std::size_t i = 0; i < n; ++i)
+      BOOST_TEST(runs[i].load() == 1);
+  }
+
+  // loop on blocks of a range
+  std::vector<std::atomic<int>> runs(1000U);
+  std::atomic<int> nBlocks{0}, nLargeBlocks{0};
+  executor.parallel_for(10U, 1000U, 64U, [&](std::size_t first, std::size_t last) {
+    if (last - first > 64U) ++nLargeBlocks; // Boost.Test is not thread-safe
+    ++nBlocks;
+    for (std::size_t i = first; i < last; ++i)
+      ++runs[i];
+  });
+  BOOST_TEST(nBlocks.load() == 16);
+  BOOST_TEST(nLargeBlocks.load() == 0);
+  for (std::size_t i = 0; i < runs.size(); ++i)
+    BOOST_TEST(runs[i].load() == ((i < 10U) ? 0 : 1));
+  executor.parallel_for(5U, 5U, 64U, [&nBlocks](std::size_t, std::size_t) { ++nBlocks; });
+  BOOST_TEST(nBlocks.load() == 16); // no block in an empty range
+
+  // a group of different tasks
+  std::atomic<int> a{0}, b{0};
+  executor.submit({[&a]() { a += 1; }, [&b]() { b += 2; }, [&a]() { a += 4; }});
+  BOOST_TEST(a.load() == 5);
+  BOOST_TEST(b.load() == 2);
+} // checkExecutor()
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(SerialTestCase)
+{
+  lar::util::Executor const executor;
+  BOOST_TEST(executor.isSerial());
+  checkExecutor(executor);
+
+  // sequential tasks run in order
+  std::vector<std::size_t> order;
+  executor.parallel_for(5U, [&order](std::size_t i) { order.push_back(i); });
+  BOOST_TEST(order == (std::vector<std::size_t>{0U, 1U, 2U, 3U, 4U}),
+             boost::test_tools::per_element());
+} // BOOST_AUTO_TEST_CASE(SerialTestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(ThreadTestCase)
+{
+  for (unsigned int const nThreads : {0U, 1U, 4U}) {
+    lar::util::Executor const executor = lar::util::Executor::threads(nThreads);
+    BOOST_TEST(!executor.isSerial());
+    checkExecutor(executor);
+  }
+
+  // exceptions are propagated, after all the other tasks are run
+  std::atomic<int> done{0};
+  auto const failing = [&done](std::size_t i) {
+    if (i == 42U) throw std::runtime_error("task 42");
+    ++done;
+  };
+  BOOST_CHECK_THROW(lar::util::Executor::threads(4U).parallel_for(100U, failing),
+                    std::runtime_error);
+  BOOST_TEST(done.load() == 99);
+} // BOOST_AUTO_TEST_CASE(ThreadTestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(CustomSchedulerTestCase)
+{
+  // a scheduler counting the loops it is given, as a TBB adapter would
+  std::atomic<int> nLoops{0};
+  lar::util::Executor const executor{
+    [&nLoops](std::size_t n, lar::util::Executor::IndexTask_t const& task) {
+      ++nLoops;
+      for (std::size_t i = n; i > 0; --i)
+        task(i - 1U);
+    }};
+  checkExecutor(executor);
+  BOOST_TEST(nLoops.load() > 0);
+
+  // the executor converts into the function it wraps
+  lar::util::Executor::ParallelFor_t const& parallelFor = executor;
+  BOOST_TEST(static_cast<bool>(parallelFor));
+} // BOOST_AUTO_TEST_CASE(CustomSchedulerTestCase)
@@ -0,0 +1,92 @@
+/**
+ * @file   Expected_test.cc
+ * @brief  Unit test for `util::expected`.
+ * @date   October 14, 2026
+ * @see    `larcorealg/CoreUtils/Expected.h`
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE (expected test)
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "larcorealg/CoreUtils/Expected.h"
+
+// C/C++ standard libraries
+#include <string>
+#include <type_traits>
+
+//------------------------------------------------------------------------------
+namespace test {
+
+  enum class Error { NotFound, Broken };
+
+  std::string errorMessage(Error error)
+  {
+    return (error == Error::NotFound) ? "not found" : "broken";
+  }
+
+  enum class Silent { Failure }; // no errorMessage() for this one
+
+  struct Data {
+    int n = 0;
+  };
+
+} // namespace test
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(ValueTestCase)
+{
+  util::expected<int, test::Error> const good{5};
+  BOOST_TEST(good.has_value());
+  BOOST_TEST(bool(good));
+  BOOST_TEST(*good == 5);
+  BOOST_TEST(good.value() == 5);
+  BOOST_TEST(good.value_or(7) == 5);
+  BOOST_TEST(good.message().empty());
+
+  util::expected<int, test::Error> const bad = util::make_unexpected(test::Error::Broken);
+  BOOST_TEST(!bad.has_value());
+  BOOST_TEST(!bad);
+  BOOST_TEST((bad.error() == test::Error::Broken));
+  BOOST_TEST(bad.value_or(7) == 7);
+  BOOST_TEST(bad.message() == "broken");
+  BOOST_CHECK_THROW(bad.value(), util::bad_expected_access<test::Error>);
+  try {
+    bad.value();
+  }
+  catch (util::bad_expected_access<test::Error> const& e) {
+    BOOST_TEST((e.error() == test::Error::Broken));
+    BOOST_TEST(std::string{e.what()} == "broken");
+  }
+
+  util::expected<test::Data, test::Silent> data{test::Data{3}};
+  data->n += 1;
+  BOOST_TEST(data.value().n == 4);
+  util::expected<test::Data, test::Silent> const silent =
+    util::make_unexpected(test::Silent::Failure);
+  BOOST_TEST(silent.message() == "unexpected error");
+} // BOOST_AUTO_TEST_CASE(ValueTestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(ReferenceTestCase)
+{
+  using Result_t = util::expected<test::Data const&, test::Error>;
+
+  // references are not copied
+  test::Data const data{6};
+  Result_t const good{data};
+  BOOST_TEST(&*good == &data);
+  BOOST_TEST(&good.value() == &data);
+  BOOST_TEST(good->n == 6);
+  BOOST_TEST(good.value_or(test::Data{1}).n == 6);
+
+  Result_t const bad = util::make_unexpected(test::Error::NotFound);
+  BOOST_TEST(!bad);
+  BOOST_TEST(bad.message() == "not found");
+  BOOST_TEST(bad.value_or(test::Data{1}).n == 1);
+
+  // a reference to a temporary would dangle
+  static_assert(std::is_constructible_v<Result_t, test::Data const&>);
+  static_assert(!std::is_constructible_v<Result_t, test::Data&&>);
+} // BOOST_AUTO_TEST_CASE(ReferenceTestCase)
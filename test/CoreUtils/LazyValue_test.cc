@@ -0,0 +1,120 @@
+/**
+ * @file   LazyValue_test.cc
+ * @brief  Unit test for `lar::util::LazyValue`.
+ * @date   October 14, 2026
+ * @see    `larcorealg/CoreUtils/LazyValue.h`
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE (lazy value test)
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "larcorealg/CoreUtils/LazyValue.h"
+
+// C/C++ standard libraries
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+//------------------------------------------------------------------------------
+/// A type which can be neither copied nor moved.
+struct Unmovable {
+  int value = 0;
+  Unmovable() = default;
+  Unmovable(Unmovable const&) = delete;
+  Unmovable& operator=(Unmovable const&) = delete;
+};
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(Initialization_test)
+{
+  unsigned int nCalls = 0U;
+  auto const init = [&nCalls]() {
+    ++nCalls;
+    return std::vector<int>{1, 2, 3};
+  };
+
+  lar::util::LazyValue<std::vector<int>> lazy;
+  BOOST_TEST(!lazy.done());
+  BOOST_TEST(lazy.getIfDone() == nullptr);
+
+  std::vector<int> const& value = lazy.get(init);
+  BOOST_TEST(lazy.done());
+  BOOST_TEST(value.size() == 3U);
+  BOOST_TEST(&lazy.get(init) == &value);
+  BOOST_TEST(lazy.getIfDone() == &value);
+  BOOST_TEST(&lazy.value() == &value);
+  BOOST_TEST(nCalls == 1U);
+
+  // copies carry the value
+  lar::util::LazyValue<std::vector<int>> copy{lazy};
+  BOOST_TEST(copy.done());
+  BOOST_TEST(copy.value() == value);
+  BOOST_TEST(&copy.value() != &value);
+
+  lazy.reset();
+  BOOST_TEST(!lazy.done());
+  BOOST_TEST(lazy.get(init).size() == 3U);
+  BOOST_TEST(nCalls == 2U);
+
+  copy = lar::util::LazyValue<std::vector<int>>{};
+  BOOST_TEST(!copy.done());
+} // BOOST_AUTO_TEST_CASE(Initialization_test)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(InPlaceInitialization_test)
+{
+  lar::util::LazyValue<Unmovable> lazy;
+  BOOST_TEST(lazy.get([](Unmovable& value) { value.value = 5; }).value == 5);
+  BOOST_TEST(lazy.get([](Unmovable& value) { value.value = 6; }).value == 5);
+  lazy.reset();
+  BOOST_TEST(lazy.get([](Unmovable& value) { value.value = 7; }).value == 7);
+} // BOOST_AUTO_TEST_CASE(InPlaceInitialization_test)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(FailedInitialization_test)
+{
+  lar::util::LazyValue<int> lazy;
+  BOOST_CHECK_THROW(lazy.get([]() -> int { throw std::runtime_error{"failed"}; }),
+                    std::runtime_error);
+  BOOST_TEST(!lazy.done());
+  BOOST_CHECK_THROW(lazy.get([](int&) { throw std::runtime_error{"failed"}; }),
+                    std::runtime_error);
+  BOOST_TEST(!lazy.done());
+  BOOST_TEST(lazy.get([]() { return 42; }) == 42);
+} // BOOST_AUTO_TEST_CASE(FailedInitialization_test)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(ConcurrentInitialization_test)
+{
+  constexpr unsigned int NThreads = 8U;
+
+  lar::util::LazyValue<std::vector<int>> lazy;
+  std::atomic<unsigned int> nCalls{0U};
+  std::atomic<bool> start{false};
+  std::vector<std::vector<int> const*> results(NThreads, nullptr);
+
+  std::vector<std::thread> threads;
+  for (unsigned int t = 0; t < NThreads; ++t) {
+    threads.emplace_back([&, t]() {
+      while (!start.load()) {}
+      results[t] = &lazy.get([&nCalls]() {
+        ++nCalls;
+        return std::vector<int>(1000, 7);
+      });
+    });
+  }
+  start.store(true);
+  for (std::thread& thread : threads)
+    thread.join();
+
+  BOOST_TEST(nCalls.load() == 1U);
+  for (std::vector<int> const* result : results) {
+    BOOST_TEST(result == &lazy.value());
+    BOOST_TEST(result->size() == 1000U);
+  }
+} // BOOST_AUTO_TEST_CASE(ConcurrentInitialization_test)
+
+//------------------------------------------------------------------------------
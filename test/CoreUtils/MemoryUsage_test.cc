@@ -0,0 +1,112 @@
+/**
+ * @file   MemoryUsage_test.cc
+ * @brief  Test of the memory estimates in `MemoryUsage.h`.
+ * @see    `larcorealg/CoreUtils/MemoryUsage.h`
+ */
+
+// LArSoft libraries
+#include "larcorealg/CoreUtils/MemoryUsage.h"
+
+// Boost libraries
+#define BOOST_TEST_MODULE (MemoryUsage_test)
+#include <boost/test/unit_test.hpp>
+
+// C/C++ standard libraries
+#include <map>
+#include <memory> // std::make_unique()
+#include <sstream>
+#include <string>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+namespace {
+
+  /// A class declaring its allocated memory.
+  struct Buffer {
+    std::vector<float> data;
+    std::size_t heapMemory() const { return data.capacity() * sizeof(float) + 1000U; }
+  };
+
+  /// A class with no declaration.
+  struct Plain {
+    double x = 0.0;
+  };
+
+} // local namespace
+
+// -----------------------------------------------------------------------------
+void test_heapMemory()
+{
+  BOOST_TEST(lar::util::heapMemory(5) == 0U);
+  BOOST_TEST(lar::util::heapMemory(Plain{}) == 0U);
+
+  std::vector<double> v;
+  v.reserve(10U);
+  v.push_back(1.0);
+  BOOST_TEST(lar::util::heapMemory(v) == 10U * sizeof(double));
+
+  std::vector<std::vector<int>> vv(3U, std::vector<int>(4U));
+  BOOST_TEST(lar::util::heapMemory(vv) ==
+             vv.capacity() * sizeof(std::vector<int>) + 3U * vv[0].capacity() * sizeof(int));
+
+  // short string stored in the object itself: no allocation
+  std::string const shortStr = "a";
+  std::string const longStr(1000U, 'x');
+  BOOST_TEST(lar::util::heapMemory(shortStr) == 0U);
+  BOOST_TEST(lar::util::heapMemory(longStr) >= 1001U);
+
+  BOOST_TEST(lar::util::heapMemory(std::unique_ptr<double>{}) == 0U);
+  BOOST_TEST(lar::util::heapMemory(std::make_unique<double>(1.0)) == sizeof(double));
+
+  // the member function is used, also within containers
+  Buffer buffer;
+  buffer.data.resize(5U);
+  BOOST_TEST(lar::util::heapMemory(buffer) == buffer.data.capacity() * sizeof(float) + 1000U);
+  std::vector<Buffer> buffers(2U, buffer);
+  BOOST_TEST(lar::util::heapMemory(buffers) ==
+             buffers.capacity() * sizeof(Buffer) + 2U * lar::util::heapMemory(buffer));
+
+  std::map<int, std::string> m{{1, "a"}, {2, longStr}};
+  BOOST_TEST(lar::util::heapMemory(m) >= 2U * sizeof(std::pair<int const, std::string>) + 1001U);
+
+} // test_heapMemory()
+
+// -----------------------------------------------------------------------------
+void test_MemoryUsageReport()
+{
+  lar::util::MemoryUsageReport report;
+  BOOST_TEST(report.totalBytes() == 0U);
+  BOOST_TEST(report.find("WireGeo") == nullptr);
+
+  report.add("WireGeo", 100U);
+  report.add("PlaneGeo", 1000U, 2U);
+  report.add("WireGeo", 150U);
+  BOOST_TEST_REQUIRE(report.components().size() == 2U);
+  BOOST_TEST(report.components()[0].name == "WireGeo");
+  BOOST_TEST(report.components()[0].count == 2U);
+  BOOST_TEST(report.bytes("WireGeo") == 250U);
+  BOOST_TEST(report.bytes("TPCGeo") == 0U);
+  BOOST_TEST(report.totalBytes() == 1250U);
+
+  lar::util::MemoryUsageReport other;
+  other.add("WireGeo", 50U);
+  other.add("OpDetGeo", 10U);
+  report.merge(other);
+  BOOST_TEST(report.components().size() == 3U);
+  BOOST_TEST(report.find("WireGeo")->count == 3U);
+  BOOST_TEST(report.totalBytes() == 1310U);
+
+  std::ostringstream sstr;
+  report.print(sstr, "  ");
+  BOOST_TEST_MESSAGE(sstr.str());
+  BOOST_TEST(sstr.str().find("  PlaneGeo") != std::string::npos);
+  BOOST_TEST(sstr.str().find("1310") != std::string::npos);
+
+} // test_MemoryUsageReport()
+
+// -----------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(MemoryUsageTestCase)
+{
+  test_heapMemory();
+  test_MemoryUsageReport();
+} // BOOST_AUTO_TEST_CASE(MemoryUsageTestCase)
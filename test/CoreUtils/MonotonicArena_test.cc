@@ -0,0 +1,190 @@
+/**
+ * @file   MonotonicArena_test.cc
+ * @brief  Unit test for `lar::util::MonotonicArena` and `lar::util::PoolArena`.
+ * @date   October 14, 2026
+ * @see    `larcorealg/CoreUtils/MonotonicArena.h`
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE (monotonic arena test)
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "larcorealg/CoreUtils/MonotonicArena.h"
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uintptr_t
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+//------------------------------------------------------------------------------
+/// Upstream resource counting the memory it hands out.
+class CountingResource : public std::pmr::memory_resource {
+public:
+  std::size_t nAllocations = 0U;
+  std::size_t bytes = 0U; ///< Bytes currently allocated.
+
+private:
+  void* do_allocate(std::size_t n, std::size_t alignment) override
+  {
+    ++nAllocations;
+    bytes += n;
+    return std::pmr::new_delete_resource()->allocate(n, alignment);
+  }
+
+  void do_deallocate(void* p, std::size_t n, std::size_t alignment) override
+  {
+    bytes -= n;
+    std::pmr::new_delete_resource()->deallocate(p, n, alignment);
+  }
+
+  bool do_is_equal(std::pmr::memory_resource const& other) const noexcept override
+  {
+    return this == &other;
+  }
+}; // CountingResource
+
+std::uintptr_t address(void const* p)
+{
+  return reinterpret_cast<std::uintptr_t>(p);
+}
+
+bool isAligned(void const* p, std::size_t alignment)
+{
+  return address(p) % alignment == 0U;
+}
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(AllocationTestCase)
+{
+  CountingResource upstream;
+  {
+    lar::util::MonotonicArena arena{256U, &upstream};
+    BOOST_TEST(arena.nBlocks() == 0U);
+    BOOST_TEST(upstream.nAllocations == 0U);
+
+    void* const a = arena.allocate(10U, 1U);
+    void* const b = arena.allocate(8U, 8U);
+    BOOST_TEST(isAligned(b, 8U));
+    BOOST_TEST(address(b) >= address(a) + 10U);
+    BOOST_TEST(address(b) < address(a) + 32U);
+    BOOST_TEST(arena.nBlocks() == 1U);
+    BOOST_TEST(arena.bytesUsed() == 18U);
+
+    // over-aligned, and larger than a block
+    void* const c = arena.allocate(64U, 128U);
+    BOOST_TEST(isAligned(c, 128U));
+    void* const d = arena.allocate(1000U, 8U);
+    BOOST_TEST(isAligned(d, 8U));
+    BOOST_TEST(arena.nBlocks() >= 2U);
+    BOOST_TEST(arena.bytesReserved() == upstream.bytes);
+
+    // zero-sized allocations are still distinct
+    BOOST_TEST(arena.allocate(0U, 1U) != arena.allocate(0U, 1U));
+
+    arena.deallocate(d, 1000U, 8U); // does nothing
+    BOOST_TEST(arena.bytesReserved() == upstream.bytes);
+
+    arena.release();
+    BOOST_TEST(arena.nBlocks() == 0U);
+    BOOST_TEST(upstream.bytes == 0U);
+
+    BOOST_TEST(arena.allocate(10U, 1U) != nullptr);
+    BOOST_TEST(upstream.bytes > 0U);
+  }
+  BOOST_TEST(upstream.bytes == 0U); // the destructor releases everything
+} // BOOST_AUTO_TEST_CASE(AllocationTestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(ResetTestCase)
+{
+  // a scratch arena used once per "event", with varying needs
+  CountingResource upstream;
+  lar::util::MonotonicArena arena{128U, &upstream};
+  std::size_t const sizes[] = {100U, 3000U, 50U, 2000U, 3000U, 10U};
+  std::size_t nAllocationsAfterLargest = 0U;
+  for (std::size_t const n : sizes) {
+    arena.reset();
+    BOOST_TEST(arena.bytesUsed() == 0U);
+    std::pmr::vector<int> values{&arena};
+    for (std::size_t i = 0; i < n; ++i)
+      values.push_back(static_cast<int>(i));
+    BOOST_TEST(values.size() == n);
+    BOOST_TEST(values.back() == static_cast<int>(n - 1U));
+    if (n == 3000U && nAllocationsAfterLargest == 0U)
+      nAllocationsAfterLargest = upstream.nAllocations;
+  }
+  // after the largest event, the kept blocks are enough
+  BOOST_TEST(upstream.nAllocations == nAllocationsAfterLargest);
+} // BOOST_AUTO_TEST_CASE(ResetTestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(ObjectsTestCase)
+{
+  lar::util::MonotonicArena arena;
+
+  std::string const source{"volTPCWireVertical"};
+  std::string_view const stored = arena.storeString(source);
+  BOOST_TEST(stored == source);
+  BOOST_TEST(address(stored.data()) != address(source.data()));
+  BOOST_TEST(arena.storeString("").empty());
+
+  struct Pair_t {
+    int a;
+    double b;
+  };
+  Pair_t const* const pair = arena.create<Pair_t>(Pair_t{3, 1.5});
+  BOOST_TEST(isAligned(pair, alignof(Pair_t)));
+  BOOST_TEST(pair->a == 3);
+  BOOST_TEST(pair->b == 1.5);
+
+  // a map of strings, all in the arena
+  std::pmr::unordered_map<std::string_view, std::pmr::vector<int>> byName{&arena};
+  for (int i = 0; i < 100; ++i) {
+    std::string const name = "vol" + std::to_string(i % 7);
+    auto it = byName.find(name);
+    if (it == byName.end()) it = byName.try_emplace(arena.storeString(name)).first;
+    it->second.push_back(i);
+    BOOST_TEST((it->second.get_allocator().resource() == &arena));
+  }
+  BOOST_TEST(byName.size() == 7U);
+  BOOST_TEST(byName.at("vol3").size() == 14U);
+  BOOST_TEST(byName.at("vol3").front() == 3);
+
+  auto alloc = arena.allocator<double>();
+  BOOST_TEST((alloc.resource() == &arena));
+} // BOOST_AUTO_TEST_CASE(ObjectsTestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(PoolTestCase)
+{
+  CountingResource upstream;
+  lar::util::PoolArena pool{1024U, &upstream};
+
+  // a map filled and emptied many times recycles its nodes
+  std::pmr::unordered_map<int, int> kinds{&pool};
+  std::size_t nAllocationsAfterFirst = 0U;
+  for (int round = 0; round < 10; ++round) {
+    for (int i = 0; i < 500; ++i)
+      kinds.emplace(i, round);
+    BOOST_TEST(kinds.size() == 500U);
+    BOOST_TEST(kinds.at(250) == round);
+    kinds.clear();
+    if (round == 0) nAllocationsAfterFirst = upstream.nAllocations;
+  }
+  BOOST_TEST(upstream.nAllocations == nAllocationsAfterFirst);
+
+  std::pmr::unordered_map<int, int>{&pool}.swap(kinds);
+  pool.reset();
+  BOOST_TEST(pool.arena().bytesUsed() == 0U);
+  BOOST_TEST(pool.arena().bytesReserved() == upstream.bytes);
+
+  kinds.emplace(1, 2);
+  BOOST_TEST(kinds.at(1) == 2);
+} // BOOST_AUTO_TEST_CASE(PoolTestCase)
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,118 @@
+/**
+ * @file   NodeReplicas_test.cc
+ * @brief  Unit test for `lar::util::NodeReplicas`.
+ * @date   October 14, 2026
+ * @see    `larcorealg/CoreUtils/NodeReplicas.h`
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE (node replicas test)
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "larcorealg/CoreUtils/NodeReplicas.h"
+
+// C/C++ standard libraries
+#include <thread>
+#include <vector>
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(Topology_test)
+{
+  unsigned int const nNodes = lar::util::numaNodeCount();
+  BOOST_TEST(nNodes >= 1U);
+
+  // the node is stable between refreshes, and always one of the machine
+  unsigned int const node = lar::util::currentNUMAnode();
+  BOOST_TEST(node < nNodes);
+  for (unsigned int i = 0; i < 2U * lar::util::NUMAnodeRefreshPeriod; ++i)
+    BOOST_TEST(lar::util::currentNUMAnode() < nNodes);
+} // Topology_test
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(Disabled_test)
+{
+  std::vector<int> const master{1, 2, 3};
+
+  lar::util::NodeReplicas<std::vector<int>> replicas;
+  BOOST_TEST(!replicas.enabled());
+  BOOST_TEST(&replicas.local(master) == &master);
+  BOOST_TEST(replicas.heapMemory() == 0U);
+
+  // a single node does not need replicas
+  replicas.enable(1U);
+  BOOST_TEST(!replicas.enabled());
+  BOOST_TEST(&replicas.local(master) == &master);
+} // Disabled_test
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(Replicas_test)
+{
+  std::vector<int> master{1, 2, 3};
+
+  lar::util::NodeReplicas<std::vector<int>> replicas;
+  replicas.enable(2U);
+  BOOST_TEST(replicas.enabled());
+  BOOST_TEST(replicas.nReplicas() == 2U);
+  BOOST_TEST(!replicas.hasReplica(0U));
+  BOOST_TEST(!replicas.hasReplica(1U));
+
+  std::vector<int> const& first = replicas.replica(0U, master);
+  BOOST_TEST(&first != &master);
+  BOOST_TEST(first == master);
+  BOOST_TEST(replicas.hasReplica(0U));
+  BOOST_TEST(!replicas.hasReplica(1U));
+  BOOST_TEST(&replicas.replica(0U, master) == &first);
+  BOOST_TEST(&replicas.replica(2U, master) == &first); // nodes beyond wrap around
+
+  std::vector<int> const& second = replicas.replica(1U, master);
+  BOOST_TEST(&second != &first);
+  BOOST_TEST(second == master);
+  BOOST_TEST(replicas.heapMemory() >= 2U * 3U * sizeof(int));
+
+  // the local replica is one of the two
+  std::vector<int> const& local = replicas.local(master);
+  BOOST_TEST(((&local == &first) || (&local == &second)));
+
+  // replicas are copied again after a reset
+  master.push_back(4);
+  BOOST_TEST(replicas.replica(0U, master).size() == 3U);
+  replicas.reset();
+  BOOST_TEST(!replicas.hasReplica(0U));
+  BOOST_TEST(replicas.replica(0U, master) == master);
+  BOOST_TEST(replicas.replica(1U, master) == master);
+
+  replicas.disable();
+  BOOST_TEST(!replicas.enabled());
+  BOOST_TEST(&replicas.local(master) == &master);
+} // Replicas_test
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(Concurrency_test)
+{
+  std::vector<int> master(1000);
+  for (int i = 0; i < 1000; ++i)
+    master[i] = i;
+
+  lar::util::NodeReplicas<std::vector<int>> replicas;
+  replicas.enable(4U);
+
+  constexpr unsigned int NThreads = 8U;
+  std::vector<std::vector<int> const*> seen(NThreads, nullptr);
+  std::vector<std::thread> threads;
+  for (unsigned int t = 0; t < NThreads; ++t) {
+    threads.emplace_back([&replicas, &master, &seen, t]() {
+      seen[t] = &replicas.replica(t, master);
+    });
+  }
+  for (std::thread& thread : threads)
+    thread.join();
+
+  // threads asking for the same node share the same copy
+  for (unsigned int t = 0; t < NThreads; ++t) {
+    BOOST_TEST(*seen[t] == master);
+    BOOST_TEST(seen[t] == seen[t % 4U]);
+  }
+  for (unsigned int node = 1; node < 4U; ++node)
+    BOOST_TEST(seen[node] != seen[0]);
+} // Concurrency_test
@@ -0,0 +1,148 @@
+/**
+ * @file   QueryMetrics_test.cc
+ * @brief  Test of `lar::util::QueryMetrics`.
+ * @see    `larcorealg/CoreUtils/QueryMetrics.h`
+ */
+
+// LArSoft libraries
+#include "larcorealg/CoreUtils/QueryMetrics.h"
+
+// Boost libraries
+#define BOOST_TEST_MODULE (QueryMetrics_test)
+#include <boost/test/unit_test.hpp>
+
+// C/C++ standard libraries
+#include <chrono>
+#include <cstdint> // std::uint64_t
+#include <numeric> // std::accumulate()
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+namespace {
+
+  /// A service with a query finding only even numbers, and throwing on negatives.
+  class Finder {
+  public:
+    lar::util::QueryMetrics* metrics = nullptr;
+
+    bool find(int i) const
+    {
+      lar::util::QueryMetrics::Scope_t const query{metrics, 0U};
+      if (i < 0) throw std::domain_error("negative");
+      bool const found = (i % 2 == 0);
+      if (!found) query.miss();
+      return found;
+    }
+
+    void wait(std::chrono::microseconds t) const
+    {
+      lar::util::QueryMetrics::Scope_t const query{metrics, 1U};
+      std::this_thread::sleep_for(t);
+    }
+  }; // Finder
+
+} // local namespace
+
+// -----------------------------------------------------------------------------
+void test_QueryMetrics_counts()
+{
+  Finder finder;
+
+  // disabled: nothing to check but that it works
+  BOOST_TEST(finder.find(2));
+  BOOST_TEST(!finder.find(3));
+
+  lar::util::QueryMetrics metrics{{"find", "wait"}};
+  BOOST_TEST(metrics.nQueries() == 2U);
+  BOOST_TEST(metrics.queryName(1U) == "wait");
+  BOOST_TEST(!metrics.timing());
+
+  finder.metrics = &metrics;
+  for (int i = 0; i < 10; ++i)
+    finder.find(i);
+  BOOST_CHECK_THROW(finder.find(-1), std::domain_error);
+
+  auto const stats = metrics.stats(0U);
+  BOOST_TEST(stats.calls == 11U);
+  BOOST_TEST(stats.misses == 5U);
+  BOOST_TEST(stats.throws == 1U);
+  BOOST_TEST(stats.timedCalls == 0U);
+  BOOST_TEST(stats.meanLatency() == 0.0);
+  BOOST_TEST(metrics.stats(1U).calls == 0U);
+
+  metrics.count(1U, 4U);
+  BOOST_TEST(metrics.stats(1U).calls == 4U);
+
+  std::ostringstream sstr;
+  metrics.print(sstr);
+  BOOST_TEST_MESSAGE(sstr.str());
+  BOOST_TEST(sstr.str().find("find: 11 calls, 5 misses, 1 exceptions") != std::string::npos);
+
+  metrics.reset();
+  BOOST_TEST(metrics.stats(0U).calls == 0U);
+  BOOST_TEST(metrics.stats(1U).calls == 0U);
+
+} // test_QueryMetrics_counts()
+
+// -----------------------------------------------------------------------------
+void test_QueryMetrics_timing()
+{
+  lar::util::QueryMetrics::Config_t config;
+  config.timing = true;
+  lar::util::QueryMetrics metrics{{"find", "wait"}, config};
+  BOOST_TEST(metrics.timing());
+
+  Finder finder;
+  finder.metrics = &metrics;
+  for (int i = 0; i < 4; ++i)
+    finder.wait(std::chrono::microseconds{2000});
+
+  auto const stats = metrics.stats(1U);
+  BOOST_TEST(stats.calls == 4U);
+  BOOST_TEST(stats.timedCalls == 4U);
+  BOOST_TEST(std::accumulate(stats.latency.begin(), stats.latency.end(), std::uint64_t{0}) ==
+             4U);
+  BOOST_TEST(stats.meanLatency() >= 2.0e6);
+  BOOST_TEST(stats.meanLatency() == stats.totalTimeNs / 4.0);
+  // the bin upper bound is at most twice the value
+  BOOST_TEST(stats.latencyQuantile(0.5) > 2.0e6);
+  BOOST_TEST(stats.latencyQuantile(0.5) <= 2.0 * stats.totalTimeNs);
+
+} // test_QueryMetrics_timing()
+
+// -----------------------------------------------------------------------------
+void test_QueryMetrics_threads()
+{
+  lar::util::QueryMetrics metrics{{"find"}};
+  Finder finder;
+  finder.metrics = &metrics;
+
+  // more threads than shards, so that some of them share one
+  unsigned int const NThreads = lar::util::QueryMetrics::NShards + 4U;
+  constexpr int NCalls = 5000;
+  std::vector<std::thread> threads;
+  for (unsigned int i = 0; i < NThreads; ++i)
+    threads.emplace_back([&finder] {
+      for (int i = 0; i < NCalls; ++i)
+        finder.find(i);
+    });
+  for (auto& thread : threads)
+    thread.join();
+
+  auto const stats = metrics.stats(0U);
+  BOOST_TEST(stats.calls == NThreads * NCalls);
+  BOOST_TEST(stats.misses == NThreads * NCalls / 2);
+
+} // test_QueryMetrics_threads()
+
+// -----------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(QueryMetricsTestCase)
+{
+  test_QueryMetrics_counts();
+  test_QueryMetrics_timing();
+  test_QueryMetrics_threads();
+} // BOOST_AUTO_TEST_CASE(QueryMetricsTestCase)
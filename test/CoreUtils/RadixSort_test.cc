@@ -0,0 +1,129 @@
+/**
+ * @file   RadixSort_test.cc
+ * @brief  Unit test for `util::radixSortByKey()` and `util::RadixSorter`.
+ * @date   October 14, 2026
+ * @see    `larcorealg/CoreUtils/RadixSort.h`
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE (radix sort test)
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "larcorealg/CoreUtils/RadixSort.h"
+#include "larcorealg/CoreUtils/SortByPointers.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::stable_sort()
+#include <cstdint>
+#include <cstddef> // std::size_t
+#include <memory>  // std::unique_ptr<>
+#include <random>
+#include <thread>
+#include <utility> // std::pair<>
+#include <vector>
+
+//------------------------------------------------------------------------------
+namespace {
+
+  using Data_t = std::pair<std::uint32_t, std::size_t>; // key, original position
+
+  std::vector<Data_t> makeData(std::size_t n, std::uint32_t maxKey)
+  {
+    std::mt19937 rng{12345};
+    std::vector<Data_t> data;
+    for (std::size_t i = 0; i < n; ++i)
+      data.emplace_back(static_cast<std::uint32_t>(rng() % maxKey), i);
+    return data;
+  }
+
+  /// Returns the original positions of the `data` elements.
+  std::vector<std::size_t> positions(std::vector<Data_t> const& data)
+  {
+    std::vector<std::size_t> pos;
+    for (Data_t const& d : data)
+      pos.push_back(d.second);
+    return pos;
+  }
+
+  /// Returns the positions of the elements after a stable sort by key.
+  std::vector<std::size_t> reference(std::vector<Data_t> data)
+  {
+    std::stable_sort(data.begin(), data.end(), [](Data_t const& a, Data_t const& b) {
+      return a.first < b.first;
+    });
+    return positions(data);
+  }
+
+  auto const keyOf = [](Data_t const& d) { return d.first; };
+
+  /// Runs each task on its own thread.
+  lar::util::Executor threadExecutor()
+  {
+    return lar::util::Executor{[](std::size_t n, auto const& task) {
+      std::vector<std::thread> threads;
+      for (std::size_t i = 0; i < n; ++i)
+        threads.emplace_back(task, i);
+      for (std::thread& thread : threads)
+        thread.join();
+    }};
+  }
+
+} // local namespace
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(SequentialTestCase)
+{
+  for (std::uint32_t const maxKey : {1U, 7U, 300U, 100000U, 4000000000U}) {
+    auto data = makeData(1000U, maxKey);
+    auto const expected = reference(data);
+    util::radixSortByKey(data.begin(), data.end(), keyOf);
+    BOOST_TEST(positions(data) == expected, boost::test_tools::per_element());
+  }
+
+  // sorting on fewer bits
+  auto data = makeData(1000U, 1000U);
+  auto const expected = reference(data);
+  util::radixSortByKey(data.begin(), data.end(), keyOf, 10U);
+  BOOST_TEST(positions(data) == expected, boost::test_tools::per_element());
+
+  std::vector<Data_t> empty;
+  util::radixSortByKey(empty.begin(), empty.end(), keyOf);
+  BOOST_TEST(empty.empty());
+} // BOOST_AUTO_TEST_CASE(SequentialTestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(SignedKeyTestCase)
+{
+  std::vector<int> data{5, -3, 0, -2147483647 - 1, 12, -3, 2147483647, 1};
+  auto expected = data;
+  std::sort(expected.begin(), expected.end());
+  util::radixSortByKey(data.begin(), data.end(), [](int v) { return v; });
+  BOOST_TEST(data == expected, boost::test_tools::per_element());
+} // BOOST_AUTO_TEST_CASE(SignedKeyTestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(ParallelTestCase)
+{
+  auto data = makeData(300000U, 50000U);
+  auto const expected = reference(data);
+  util::radixSortByKey(data.begin(), data.end(), keyOf, 0U, threadExecutor());
+  BOOST_TEST(positions(data) == expected, boost::test_tools::per_element());
+} // BOOST_AUTO_TEST_CASE(ParallelTestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(SortByPointersTestCase)
+{
+  auto data = makeData(500U, 64U);
+  auto const expected = reference(data);
+  util::SortByPointers(data, util::makeRadixSorter(keyOf, 6U));
+  BOOST_TEST(positions(data) == expected, boost::test_tools::per_element());
+
+  std::vector<std::unique_ptr<Data_t>> ptrs;
+  for (Data_t const& d : makeData(500U, 64U))
+    ptrs.push_back(std::make_unique<Data_t>(d));
+  util::SortUniquePointers(ptrs, util::makeRadixSorter(keyOf));
+  BOOST_TEST_REQUIRE(ptrs.size() == expected.size());
+  for (std::size_t i = 0; i < ptrs.size(); ++i)
+    BOOST_TEST(ptrs[i]->second == expected[i]);
+} // BOOST_AUTO_TEST_CASE(SortByPointersTestCase)
@@ -0,0 +1,77 @@
+/**
+ * @file   SimdDispatch_test.cc
+ * @brief  Unit test for `LARCOREALG_SIMD_CLONES` and `util::simd`.
+ * @date   October 14, 2026
+ * @see    `larcorealg/CoreUtils/SimdDispatch.h`
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE (SIMD dispatch test)
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "larcorealg/CoreUtils/SimdDispatch.h"
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <string>
+#include <vector>
+
+//------------------------------------------------------------------------------
+namespace {
+
+  /// Computes `a * x + b` with the vectorized clones.
+  LARCOREALG_SIMD_CLONES
+  void affine(std::size_t n,
+              double a,
+              double b,
+              double const* __restrict__ x,
+              double* __restrict__ out)
+  {
+    for (std::size_t i = 0; i < n; ++i)
+      out[i] = a * x[i] + b;
+  }
+
+  /// Computes `a * x + b` one element at a time.
+  double affineOne(double a, double b, double x) { return a * x + b; }
+
+} // local namespace
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(InstructionSetTestCase)
+{
+  using util::simd::InstructionSet;
+
+  BOOST_TEST(std::string{util::simd::name(InstructionSet::AVX512)} == "AVX-512");
+  BOOST_TEST(std::string{util::simd::name(InstructionSet::AVX2)} == "AVX2");
+  BOOST_TEST(std::string{util::simd::name(InstructionSet::SSE2)} == "SSE2");
+  BOOST_TEST(std::string{util::simd::name(InstructionSet::NEON)} == "NEON");
+  BOOST_TEST(std::string{util::simd::name(InstructionSet::Generic)} == "generic");
+
+  InstructionSet const set = util::simd::dispatchedInstructionSet();
+  BOOST_TEST_MESSAGE("Kernels run with " << util::simd::name(set));
+  BOOST_TEST((set == util::simd::dispatchedInstructionSet()));
+#if defined(__x86_64__)
+  BOOST_TEST(((set == InstructionSet::SSE2) || (set == InstructionSet::AVX2) ||
+              (set == InstructionSet::AVX512)));
+#endif // __x86_64__
+} // BOOST_AUTO_TEST_CASE(InstructionSetTestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(ClonesTestCase)
+{
+  // the size is not a multiple of the vector width, to exercise the remainder
+  std::size_t const n = 1001U;
+  std::vector<double> x(n), out(n);
+  for (std::size_t i = 0; i < n; ++i)
+    x[i] = 0.1 * i - 37.3;
+
+  double const a = 1.0 / 3.0, b = 0.7;
+  affine(n, a, b, x.data(), out.data());
+
+  // same results as the scalar computation, with no fused multiply-add
+  for (std::size_t i = 0; i < n; ++i)
+    BOOST_TEST(out[i] == affineOne(a, b, x[i]));
+} // BOOST_AUTO_TEST_CASE(ClonesTestCase)
+
+//------------------------------------------------------------------------------
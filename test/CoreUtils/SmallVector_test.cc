@@ -0,0 +1,96 @@
+/**
+ * @file   SmallVector_test.cc
+ * @brief  Unit test for `util::small_vector`.
+ * @date   October 14, 2026
+ * @see    `larcorealg/CoreUtils/SmallVector.h`
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE (small vector test)
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "larcorealg/CoreUtils/SmallVector.h"
+
+// C/C++ standard libraries
+#include <memory> // std::unique_ptr<>
+#include <string>
+#include <utility> // std::move()
+#include <vector>
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(InlineTestCase)
+{
+  util::small_vector<int, 2U> v;
+  BOOST_TEST(v.empty());
+  BOOST_TEST(v.is_inline());
+  BOOST_TEST(v.capacity() == 2U);
+
+  v.push_back(3);
+  v.emplace_back(5);
+  BOOST_TEST(v.size() == 2U);
+  BOOST_TEST(v.is_inline());
+  BOOST_TEST(v.front() == 3);
+  BOOST_TEST(v.back() == 5);
+
+  util::small_vector<int, 2U> const copy{v};
+  BOOST_TEST((copy == v));
+  util::small_vector<int, 2U> const moved{std::move(v)};
+  BOOST_TEST(moved.is_inline());
+  BOOST_TEST((moved == copy));
+  BOOST_TEST(v.empty());
+
+  v.assign(copy.begin(), copy.end());
+  v.pop_back();
+  BOOST_TEST((v == util::small_vector<int, 2U>{3}));
+  v.clear();
+  BOOST_TEST(v.empty());
+
+  util::small_vector<int, 4U> const filled(3U, 7);
+  BOOST_TEST((filled == util::small_vector<int, 2U>{7, 7, 7}));
+} // BOOST_AUTO_TEST_CASE(InlineTestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(HeapTestCase)
+{
+  util::small_vector<std::string, 2U> v{"a", "b"};
+  v.push_back(v.front()); // the argument is an element being relocated
+  BOOST_TEST(!v.is_inline());
+  BOOST_TEST(v.size() == 3U);
+  BOOST_TEST(v[2] == "a");
+
+  for (int i = 0; i < 100; ++i)
+    v.push_back(std::to_string(i));
+  BOOST_TEST(v.size() == 103U);
+  BOOST_TEST(v.back() == "99");
+
+  std::vector<std::string> const expected(v.begin(), v.end());
+  util::small_vector<std::string, 2U> moved;
+  moved = std::move(v);
+  BOOST_TEST(v.empty());
+  BOOST_TEST(v.is_inline());
+  BOOST_TEST(std::vector<std::string>(moved.begin(), moved.end()) == expected,
+             boost::test_tools::per_element());
+
+  moved.resize(1U);
+  BOOST_TEST(moved.size() == 1U);
+  moved.resize(4U, "z");
+  BOOST_TEST(moved[3] == "z");
+
+  util::small_vector<int, 2U> r;
+  r.reserve(10U);
+  BOOST_TEST(r.capacity() >= 10U);
+  BOOST_TEST(!r.is_inline());
+} // BOOST_AUTO_TEST_CASE(HeapTestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(MoveOnlyTestCase)
+{
+  util::small_vector<std::unique_ptr<int>, 1U> v;
+  v.push_back(std::make_unique<int>(1));
+  v.push_back(std::make_unique<int>(2));
+  BOOST_TEST(*v[0] == 1);
+  BOOST_TEST(*v[1] == 2);
+  util::small_vector<std::unique_ptr<int>, 1U> moved{std::move(v)};
+  BOOST_TEST(*moved[1] == 2);
+} // BOOST_AUTO_TEST_CASE(MoveOnlyTestCase)
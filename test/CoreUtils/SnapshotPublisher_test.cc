@@ -0,0 +1,124 @@
+/**
+ * @file   SnapshotPublisher_test.cc
+ * @brief  Unit test for `lar::util::SnapshotPublisher`.
+ * @date   October 14, 2026
+ * @see    `larcorealg/CoreUtils/SnapshotPublisher.h`
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE (snapshot publisher test)
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "larcorealg/CoreUtils/SnapshotPublisher.h"
+
+// C/C++ standard libraries
+#include <atomic>
+#include <memory> // std::make_unique()
+#include <thread>
+#include <vector>
+
+//------------------------------------------------------------------------------
+namespace {
+
+  std::atomic<int> nAlive{0};
+
+  /// An object counting its living instances, and checking its own state.
+  struct Payload {
+    unsigned int const value;
+    unsigned int const check;
+
+    explicit Payload(unsigned int value) : value{value}, check{~value} { ++nAlive; }
+    ~Payload() { --nAlive; }
+
+    bool intact() const { return check == ~value; }
+  };
+
+} // local namespace
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(LifetimeTestCase)
+{
+  {
+    lar::util::SnapshotPublisher<Payload> publisher;
+    BOOST_TEST(!publisher.acquire().valid());
+    BOOST_TEST(publisher.version() == publisher.NoVersion);
+
+    BOOST_TEST(publisher.publish(std::make_unique<Payload>(10U)) == 1U);
+    auto first = publisher.acquire();
+    BOOST_TEST_REQUIRE(first.valid());
+    BOOST_TEST(first.version() == 1U);
+    BOOST_TEST(first->value == 10U);
+
+    // the old snapshot survives the publication of a new version
+    BOOST_TEST(publisher.publish(std::make_unique<Payload>(20U)) == 2U);
+    BOOST_TEST(publisher.version() == 2U);
+    BOOST_TEST(nAlive == 2);
+    BOOST_TEST(first->value == 10U);
+    BOOST_TEST(publisher.acquire()->value == 20U);
+
+    auto const copy = first;
+    first.release();
+    BOOST_TEST(!first.valid());
+    BOOST_TEST(nAlive == 2);
+    BOOST_TEST((*copy).value == 10U);
+
+    publisher.publish(std::make_unique<Payload>(30U));
+    BOOST_TEST(nAlive == 2); // version 2 is dropped, version 1 is still held
+    first = publisher.acquire();
+    BOOST_TEST(first.version() == 3U);
+  }
+  BOOST_TEST(nAlive == 0);
+} // BOOST_AUTO_TEST_CASE(LifetimeTestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(OutlivedPublisherTestCase)
+{
+  lar::util::SnapshotPublisher<Payload>::Snapshot snapshot;
+  {
+    lar::util::SnapshotPublisher<Payload> publisher;
+    publisher.publish(std::make_unique<Payload>(5U));
+    snapshot = publisher.acquire();
+  }
+  BOOST_TEST(nAlive == 1);
+  BOOST_TEST(snapshot->value == 5U);
+  snapshot.release();
+  BOOST_TEST(nAlive == 0);
+} // BOOST_AUTO_TEST_CASE(OutlivedPublisherTestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(ConcurrencyTestCase)
+{
+  constexpr unsigned int NVersions = 2000U;
+  constexpr unsigned int NReaders = 4U;
+
+  lar::util::SnapshotPublisher<Payload> publisher;
+  publisher.publish(std::make_unique<Payload>(1U));
+
+  std::atomic<bool> done{false};
+  std::atomic<unsigned int> nErrors{0U};
+  std::vector<std::thread> readers;
+  for (unsigned int iReader = 0; iReader < NReaders; ++iReader) {
+    readers.emplace_back([&publisher, &done, &nErrors]() {
+      lar::util::SnapshotPublisher<Payload>::Version_t lastVersion = 0U;
+      while (!done) {
+        auto const snapshot = publisher.acquire();
+        // versions never go back, and the value is the version number
+        if (!snapshot || (snapshot.version() < lastVersion) ||
+            (snapshot->value != snapshot.version()) || !snapshot->intact())
+          ++nErrors;
+        lastVersion = snapshot.version();
+      }
+    });
+  }
+
+  for (unsigned int version = 2U; version <= NVersions; ++version)
+    publisher.publish(std::make_unique<Payload>(version));
+  done = true;
+  for (std::thread& reader : readers)
+    reader.join();
+
+  BOOST_TEST(nErrors == 0U);
+  BOOST_TEST(publisher.version() == NVersions);
+  BOOST_TEST(nAlive == 1);
+} // BOOST_AUTO_TEST_CASE(ConcurrencyTestCase)
@@ -16,6 +16,9 @@
 // C/C++ standard libraries
 #include <algorithm>   // std::sort()
 #include <cstdlib>     // std::abs()
+#include <deque>
+#include <execution>   // std::execution::seq
+#include <memory>      // std::unique_ptr
 #include <type_traits> // std::decay_t, std::is_same
 #include <vector>
 
@@ -80,11 +83,107 @@ void test_MoveFromPointers()
 
 } // test_MoveFromPointers()
 
+//------------------------------------------------------------------------------
+void test_SortByPointers_deque()
+{
+
+  AbsSorter<int> absSorter;
+
+  std::vector<int> const values = {8, -7, 5, 9, -2, 0, 3, -11};
+  auto sortedData = values;
+  std::sort(sortedData.begin(), sortedData.end(), absSorter);
+
+  // non-contiguous collection
+  std::deque<int> data(values.begin(), values.end());
+  util::SortByPointers(data,
+                       [absSorter](auto& coll) { std::sort(coll.begin(), coll.end(), absSorter); });
+  BOOST_CHECK_EQUAL_COLLECTIONS(data.cbegin(), data.cend(), sortedData.cbegin(), sortedData.cend());
+
+} // test_SortByPointers_deque()
+
+//------------------------------------------------------------------------------
+void test_SortByPointers_policy()
+{
+
+  AbsSorter<int> absSorter;
+  auto const ptrSorter = [absSorter](int const* a, int const* b) { return absSorter(a, b); };
+
+  std::vector<int> data = {8, -7, 5, 9, -2, 0, 3, -11};
+  auto sortedData = data;
+  std::sort(sortedData.begin(), sortedData.end(), absSorter);
+
+  util::SortByPointers(std::execution::seq, data, ptrSorter);
+  BOOST_CHECK_EQUAL_COLLECTIONS(data.cbegin(), data.cend(), sortedData.cbegin(), sortedData.cend());
+
+  // non-contiguous collection
+  std::deque<int> dataDeque = {8, -7, 5, 9, -2, 0, 3, -11};
+  util::SortByPointers(std::execution::seq, dataDeque, ptrSorter);
+  BOOST_CHECK_EQUAL_COLLECTIONS(
+    dataDeque.cbegin(), dataDeque.cend(), sortedData.cbegin(), sortedData.cend());
+
+} // test_SortByPointers_policy()
+
+//------------------------------------------------------------------------------
+void test_SortUniquePointers()
+{
+
+  AbsSorter<int> absSorter;
+
+  std::vector<int> const values = {8, -7, 5, 9, -2};
+  auto sortedValues = values;
+  std::sort(sortedValues.begin(), sortedValues.end(), absSorter);
+
+  std::vector<std::unique_ptr<int>> data;
+  for (int v : values)
+    data.push_back(std::make_unique<int>(v));
+  std::vector<int*> sortedPtrs = util::makePointerVector(data);
+  std::sort(sortedPtrs.begin(), sortedPtrs.end(), absSorter);
+
+  util::SortUniquePointers(
+    data, [absSorter](auto& coll) { std::sort(coll.begin(), coll.end(), absSorter); });
+  BOOST_TEST(data.size() == values.size());
+  for (std::size_t i = 0; i < data.size(); ++i) {
+    BOOST_TEST(data[i].get() == sortedPtrs[i]); // objects are not moved
+    BOOST_TEST(*data[i] == sortedValues[i]);
+  }
+
+  // same result with an execution policy
+  std::reverse(data.begin(), data.end());
+  util::SortUniquePointers(
+    std::execution::seq, data, [absSorter](int const* a, int const* b) { return absSorter(a, b); });
+  for (std::size_t i = 0; i < data.size(); ++i)
+    BOOST_TEST(data[i].get() == sortedPtrs[i]);
+
+} // test_SortUniquePointers()
+
+//------------------------------------------------------------------------------
+void test_ApplyPermutation()
+{
+
+  std::vector<std::unique_ptr<int>> data;
+  for (int i = 0; i < 8; ++i)
+    data.push_back(std::make_unique<int>(i));
+
+  // two cycles (0 3 5) and (1 7), and fixed points
+  std::vector<std::size_t> const order = {3, 7, 2, 5, 4, 0, 6, 1};
+  util::ApplyPermutation(data, order);
+
+  for (std::size_t i = 0; i < data.size(); ++i) {
+    BOOST_TEST_REQUIRE(data[i].get() != nullptr);
+    BOOST_TEST(*data[i] == static_cast<int>(order[i]));
+  }
+
+} // test_ApplyPermutation()
+
 //------------------------------------------------------------------------------
 BOOST_AUTO_TEST_CASE(SortByPointers_testcase)
 {
 
   test_SortByPointers();
+  test_SortByPointers_deque();
+  test_SortByPointers_policy();
+  test_SortUniquePointers();
+  test_ApplyPermutation();
 
 } // BOOST_AUTO_TEST_CASE(SortByPointers_testcase)
 
@@ -14,7 +14,10 @@
 #include <boost/test/unit_test.hpp>
 
 // C/C++ libraries
-#include <cstddef> // std::size_t
+#include <algorithm> // std::lower_bound()
+#include <cstddef>   // std::size_t
+#include <iterator>  // std::iterator_traits
+#include <type_traits>
 #include <vector>
 
 //------------------------------------------------------------------------------
@@ -124,6 +127,42 @@ void test_infinite_counter_documentation()
 
 } // test_infinite_counter_documentation()
 
+// -----------------------------------------------------------------------------
+void test_counter_random_access()
+{
+
+  auto const r = util::counter(4, 12);
+  using iterator_t = decltype(r.begin());
+  static_assert(std::is_same_v<std::iterator_traits<iterator_t>::iterator_category,
+                               std::random_access_iterator_tag>);
+
+  BOOST_TEST(r.size() == 8U);
+  BOOST_TEST((r.end() - r.begin()) == 8);
+  BOOST_TEST((r.begin() - r.end()) == -8);
+  BOOST_TEST(*(r.begin() + 3) == 7);
+  BOOST_TEST(*(3 + r.begin()) == 7);
+  BOOST_TEST(*(r.end() - 1) == 11);
+  BOOST_TEST(r.begin()[5] == 9);
+  BOOST_TEST((r.begin() < r.end()));
+  BOOST_TEST((r.end() > r.begin()));
+  BOOST_TEST((r.begin() <= r.begin()));
+  BOOST_TEST((r.end() >= r.end()));
+
+  auto it = r.begin();
+  it += 6;
+  BOOST_TEST(*it == 10);
+  it -= 4;
+  BOOST_TEST(*it == 6);
+  BOOST_TEST(*(it++) == 6);
+  BOOST_TEST(*(it--) == 7);
+  BOOST_TEST(*it == 6);
+
+  // an algorithm requiring random access iterators
+  auto const found = std::lower_bound(r.begin(), r.end(), 9);
+  BOOST_TEST((found - r.begin()) == 5);
+
+} // test_counter_random_access()
+
 // -----------------------------------------------------------------------------
 // BEGIN Test cases  -----------------------------------------------------------
 // -----------------------------------------------------------------------------
@@ -133,6 +172,7 @@ BOOST_AUTO_TEST_CASE(counter_testcase)
   test_count_iterator_documentation();
   test_counter_documentation();
   test_infinite_counter_documentation();
+  test_counter_random_access();
 
 } // BOOST_AUTO_TEST_CASE(counter_testcase)
 
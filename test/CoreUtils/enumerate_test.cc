@@ -16,7 +16,10 @@
 // C/C++ libraries
 #include <array>
 #include <cassert>
-#include <cstddef> // std::size_t
+#include <cstddef>  // std::size_t
+#include <iterator> // std::iterator_traits
+#include <list>
+#include <type_traits>
 #include <vector>
 
 // -----------------------------------------------------------------------------
@@ -83,6 +86,47 @@ void test_enumerate()
 
 } // test_enumerate()
 
+// -----------------------------------------------------------------------------
+void test_enumerate_random_access()
+{
+
+  constexpr std::size_t N = 7U;
+
+  std::vector<double> thrice(N);
+  for (std::size_t i = 0; i < N; ++i)
+    thrice[i] = 3.0 * i;
+
+  auto const r = util::enumerate(thrice);
+  using iterator_t = decltype(r.begin());
+  static_assert(std::is_same_v<iterator_t, decltype(r.end())>);
+  static_assert(std::is_same_v<std::iterator_traits<iterator_t>::iterator_category,
+                               std::random_access_iterator_tag>);
+
+  BOOST_TEST(r.size() == N);
+
+  // the index is right also for iterators not reached by increments
+  for (std::size_t i = 0; i < N; ++i) {
+    auto&& [index, value] = r.begin()[i];
+    BOOST_TEST(index == i);
+    BOOST_TEST(&value == &thrice[i]);
+  }
+  auto&& [lastIndex, lastValue] = *(r.end() - 1);
+  BOOST_TEST(lastIndex == N - 1);
+  BOOST_TEST(&lastValue == &thrice.back());
+
+  // with a lead without random access, the count is unbounded
+  std::list<int> list(N);
+  unsigned int iLoop = 0;
+  for (auto&& [i, a, b] : util::enumerate(list, thrice)) {
+    BOOST_TEST(i == iLoop);
+    BOOST_TEST(&b == &thrice[iLoop]);
+    a = i;
+    ++iLoop;
+  }
+  BOOST_TEST(iLoop == N);
+
+} // test_enumerate_random_access()
+
 // -----------------------------------------------------------------------------
 // BEGIN Test cases  -----------------------------------------------------------
 // -----------------------------------------------------------------------------
@@ -90,6 +134,7 @@ BOOST_AUTO_TEST_CASE(enumerate_testcase)
 {
 
   test_enumerate();
+  test_enumerate_random_access();
 
 } // BOOST_AUTO_TEST_CASE(enumerate_testcase)
 
@@ -0,0 +1,110 @@
+/**
+ * @file   makeValueIndex_test.cc
+ * @brief  Unit test for `util::makeValueIndex()`.
+ * @see    `larcorealg/CoreUtils/makeValueIndex.h`
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE (makeValueIndex_test)
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "larcorealg/CoreUtils/makeValueIndex.h"
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <list>
+#include <map>
+#include <memory> // std::unique_ptr
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+//------------------------------------------------------------------------------
+template <typename Policy>
+void test_makeValueIndex(Policy policy)
+{
+
+  std::vector<int> const data = {8, -7, 5, 9, -2};
+
+  auto const index = util::makeValueIndex(data, policy);
+  BOOST_TEST(index.size() == data.size());
+  for (std::size_t i = 0; i < data.size(); ++i) {
+    BOOST_TEST(index.at(data[i]) == i);
+    BOOST_TEST(index.count(data[i]) == 1U);
+    auto const it = index.find(data[i]);
+    BOOST_TEST_REQUIRE((it != index.end()));
+    BOOST_TEST(it->first == data[i]);
+    BOOST_TEST(it->second == i);
+  }
+  BOOST_TEST(index.count(6) == 0U);
+  BOOST_TEST((index.find(6) == index.end()));
+  BOOST_CHECK_THROW(index.at(6), std::out_of_range);
+
+  // with an extractor, and on a non-random access collection
+  std::list<std::string> const names = {"one", "three", "eleven"};
+  auto const lengthIndex =
+    util::makeValueIndex(names, [](std::string const& s) { return s.length(); }, policy);
+  BOOST_TEST(lengthIndex.size() == names.size());
+  BOOST_TEST(lengthIndex.at(3U) == 0U);
+  BOOST_TEST(lengthIndex.at(5U) == 1U);
+  BOOST_TEST(lengthIndex.at(6U) == 2U);
+
+  // duplicate detection
+  std::vector<int> const dupData = {8, -7, 5, -7, 9};
+  BOOST_CHECK_THROW(util::makeValueIndex(dupData, policy), std::runtime_error);
+  try {
+    util::makeValueIndex(dupData, policy);
+  }
+  catch (std::runtime_error const& e) {
+    BOOST_TEST(std::string(e.what()) == "makeValueIndex: element #3 has the same key as #1");
+  }
+
+  // empty collection
+  auto const emptyIndex = util::makeValueIndex(std::vector<int>{}, policy);
+  BOOST_TEST(emptyIndex.empty());
+  BOOST_TEST(emptyIndex.count(0) == 0U);
+
+} // test_makeValueIndex()
+
+//------------------------------------------------------------------------------
+void test_makeValueIndex_pointers()
+{
+
+  // large collection of pointer keys (the use case of `SortUniquePointers()`)
+  std::vector<std::unique_ptr<int>> data;
+  for (int i = 0; i < 10000; ++i)
+    data.push_back(std::make_unique<int>(i));
+  std::vector<int const*> ptrs;
+  for (auto const& ptr : data)
+    ptrs.push_back(ptr.get());
+
+  auto const hashIndex = util::makeValueIndex(ptrs, util::HashIndex{});
+  auto const sortedIndex = util::makeValueIndex(ptrs, util::SortedVectorIndex{});
+  for (std::size_t i = 0; i < ptrs.size(); ++i) {
+    BOOST_TEST(hashIndex.at(ptrs[i]) == i);
+    BOOST_TEST(sortedIndex.at(ptrs[i]) == i);
+  }
+
+} // test_makeValueIndex_pointers()
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(makeValueIndex_testcase)
+{
+
+  static_assert(std::is_same_v<decltype(util::makeValueIndex(std::vector<int>{})),
+                               std::map<int, std::size_t>>);
+  static_assert(
+    std::is_same_v<decltype(util::makeValueIndex(std::vector<int>{}, util::HashIndex{})),
+                   util::HashValueIndex<int>>);
+  static_assert(
+    std::is_same_v<decltype(util::makeValueIndex(std::vector<int>{}, util::SortedVectorIndex{})),
+                   util::SortedValueIndex<int>>);
+
+  test_makeValueIndex(util::OrderedMapIndex{});
+  test_makeValueIndex(util::HashIndex{});
+  test_makeValueIndex(util::SortedVectorIndex{});
+  test_makeValueIndex_pointers();
+
+} // BOOST_AUTO_TEST_CASE(makeValueIndex_testcase)
@@ -370,6 +370,33 @@ BOOST_AUTO_TEST_CASE(span_testcase)
 
 } // BOOST_AUTO_TEST_CASE(span_testcase)
 
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(pointer_span_testcase)
+{
+
+  std::vector<int> v{1, 2, 3, 4};
+
+  auto r = util::span(v.data(), v.data() + v.size());
+  static_assert(std::is_same<decltype(r), util::span<int*>>());
+  static_assert(std::is_same<typename decltype(r)::value_type, int>());
+  static_assert(std::is_same<typename decltype(r)::reference, int&>());
+
+  BOOST_TEST(!r.empty());
+  BOOST_TEST(r.size() == v.size());
+  for (int& i : r)
+    i *= 2;
+  BOOST_TEST(v == (std::vector<int>{2, 4, 6, 8}));
+
+  util::span<int const*> const cr{r};
+  BOOST_TEST(cr.size() == v.size());
+  BOOST_TEST(*cr.begin() == 2);
+
+  util::span<int const*> const empty;
+  BOOST_TEST(empty.empty());
+  BOOST_TEST(empty.size() == 0U);
+
+} // BOOST_AUTO_TEST_CASE(pointer_span_testcase)
+
 //------------------------------------------------------------------------------
 BOOST_AUTO_TEST_CASE(adapted_span_testcase)
 {
@@ -0,0 +1,147 @@
+/**
+ * @file   strided_span_test.cc
+ * @brief  Unit test for `util::strided_span` and `util::mdspan`.
+ * @see    `larcorealg/CoreUtils/strided_span.h`
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE (strided_span_test)
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "larcorealg/CoreUtils/strided_span.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::sort()
+#include <array>
+#include <cstddef> // std::size_t
+#include <numeric> // std::iota(), std::accumulate()
+#include <type_traits>
+#include <vector>
+
+//------------------------------------------------------------------------------
+void test_strided_span()
+{
+
+  constexpr std::size_t N = 5U;
+
+  // interleaved coordinates (x, y, z) with y = 10 + 3i + 1
+  std::vector<double> xyz(3U * N);
+  std::iota(xyz.begin(), xyz.end(), 10.0);
+
+  auto ys = util::make_strided_span(xyz, 3U, 1U);
+  static_assert(std::is_same_v<decltype(ys), util::strided_span<double>>);
+  static_assert(std::is_same_v<std::iterator_traits<decltype(ys.begin())>::iterator_category,
+                               std::random_access_iterator_tag>);
+
+  BOOST_TEST(ys.size() == N);
+  std::size_t i = 0U;
+  for (double& y : ys) {
+    BOOST_TEST(&y == &xyz[3U * i + 1U]);
+    ++i;
+  }
+  BOOST_TEST(i == N);
+
+  BOOST_TEST(ys.begin()[2] == xyz[7]);
+  BOOST_TEST(*(ys.end() - 1) == xyz[13]);
+  BOOST_TEST((ys.end() - ys.begin()) == static_cast<std::ptrdiff_t>(N));
+  BOOST_TEST((ys.begin() < ys.end()));
+
+  // writing through the span, with a standard algorithm
+  for (double& y : ys)
+    y = -y;
+  std::sort(ys.begin(), ys.end());
+  BOOST_TEST(xyz[1] == -23.0);
+  BOOST_TEST(xyz[13] == -11.0);
+  BOOST_TEST(xyz[0] == 10.0);
+  BOOST_TEST(xyz[2] == 12.0);
+
+  // constant access and a stride which does not divide the size
+  std::vector<int> const data{0, 1, 2, 3, 4, 5, 6};
+  auto evens = util::make_strided_span(data, 2U);
+  static_assert(std::is_same_v<decltype(evens), util::strided_span<int const>>);
+  BOOST_TEST(evens.size() == 4U);
+  BOOST_TEST(std::accumulate(evens.begin(), evens.end(), 0) == 12);
+  BOOST_TEST(util::make_strided_span(data, 2U, 7U).empty());
+
+} // test_strided_span()
+
+//------------------------------------------------------------------------------
+void test_column_span()
+{
+
+  struct Point {
+    double x, y, z;
+  };
+  std::vector<Point> points{{1.0, 2.0, 3.0}, {4.0, 5.0, 6.0}, {7.0, 8.0, 9.0}};
+
+  auto ys = util::make_column_span<double>(points, 1U);
+  BOOST_TEST(ys.size() == points.size());
+  std::size_t i = 0U;
+  for (double& y : ys) {
+    BOOST_TEST(&y == &points[i].y);
+    ++i;
+  }
+
+  auto const& cpoints = points;
+  auto zs = util::make_column_span<double>(cpoints, 2U);
+  static_assert(std::is_same_v<decltype(zs), util::strided_span<double const>>);
+  BOOST_TEST(std::accumulate(zs.begin(), zs.end(), 0.0) == 18.0);
+
+} // test_column_span()
+
+//------------------------------------------------------------------------------
+void test_mdspan()
+{
+
+  constexpr std::size_t N = 4U;
+  std::array<double, 3U * N> buffer;
+  std::iota(buffer.begin(), buffer.end(), 0.0);
+
+  // array of structures: (N, 3)
+  auto aos = util::make_mdspan(buffer, N, 3U);
+  static_assert(std::is_same_v<decltype(aos), util::mdspan<double, 2U>>);
+  BOOST_TEST(aos.rank() == 2U);
+  BOOST_TEST(aos.extent(0) == N);
+  BOOST_TEST(aos.extent(1) == 3U);
+  BOOST_TEST(aos.stride(0) == 3);
+  BOOST_TEST(aos.stride(1) == 1);
+  BOOST_TEST(aos.size() == buffer.size());
+  BOOST_TEST(&aos(2, 1) == &buffer[7]);
+
+  auto ys = aos.line(0U, {0U, 1U});
+  BOOST_TEST(ys.size() == N);
+  BOOST_TEST(&*ys.begin() == &buffer[1]);
+  BOOST_TEST(&ys.begin()[3] == &buffer[10]);
+
+  auto point2 = aos.slice(2U);
+  static_assert(std::is_same_v<decltype(point2), util::mdspan<double, 1U>>);
+  BOOST_TEST(point2.extent(0) == 3U);
+  BOOST_TEST(&point2(2) == &buffer[8]);
+
+  // structure of arrays: (3, N)
+  util::mdspan<double const, 2U> const soa = util::make_mdspan(buffer.data(), 3U, N);
+  BOOST_TEST(&soa(1, 0) == &buffer[N]);
+  auto zs = soa.line(1U, {2U, 1U});
+  BOOST_TEST(zs.size() == N - 1U);
+  BOOST_TEST(*zs.begin() == buffer[2U * N + 1U]);
+
+  // explicit strides: a transposed view of the (N, 3) array
+  util::mdspan<double, 2U> transposed{buffer.data(), {3U, N}, {1, 3}};
+  BOOST_TEST(&transposed(1, 2) == &aos(2, 1));
+
+  // three dimensions
+  std::vector<int> cube(2U * 3U * 4U);
+  auto m3 = util::make_mdspan(cube, 2U, 3U, 4U);
+  BOOST_TEST(&m3(1, 2, 3) == &cube.back());
+  BOOST_TEST(&m3.slice(1U)(0, 1) == &cube[13]);
+
+} // test_mdspan()
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(strided_span_testcase)
+{
+  test_strided_span();
+  test_column_span();
+  test_mdspan();
+} // BOOST_AUTO_TEST_CASE(strided_span_testcase)
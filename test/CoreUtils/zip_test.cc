@@ -14,9 +14,13 @@
 #include <boost/test/unit_test.hpp>
 
 // C/C++ libraries
+#include <algorithm> // std::for_each()
 #include <array>
 #include <cassert>
-#include <cstddef> // std::size_t
+#include <cstddef>  // std::size_t
+#include <iterator> // std::iterator_traits
+#include <list>
+#include <type_traits>
 #include <vector>
 
 // -----------------------------------------------------------------------------
@@ -90,6 +94,62 @@ void test_no_zip()
 
 } // test_no_zip()
 
+// -----------------------------------------------------------------------------
+void test_zip_random_access()
+{
+
+  constexpr std::size_t N = 7U;
+
+  std::array<int, N> twice;
+  std::vector<double> thrice(N);
+
+  auto r = util::zip(twice, thrice);
+  using iterator_t = decltype(r.begin());
+  static_assert(std::is_same_v<std::iterator_traits<iterator_t>::iterator_category,
+                               std::random_access_iterator_tag>);
+
+  BOOST_TEST(r.size() == N);
+  BOOST_TEST((r.end() - r.begin()) == static_cast<std::ptrdiff_t>(N));
+
+  // fill by position, in no particular order
+  for (std::size_t i = 0; i < N; ++i) {
+    auto&& [a, b] = r.begin()[N - 1 - i];
+    a = 2 * (N - 1 - i);
+    b = 3.0 * (N - 1 - i);
+  }
+  for (std::size_t i = 0; i < N; ++i) {
+    BOOST_TEST(twice[i] == static_cast<int>(2 * i));
+    BOOST_TEST(thrice[i] == 3.0 * i);
+  }
+
+  auto it = r.end();
+  --it;
+  BOOST_TEST(&std::get<0>(*it) == &twice.back());
+  BOOST_TEST(&std::get<1>(*it) == &thrice.back());
+  it -= 3;
+  BOOST_TEST(&std::get<0>(*it) == &twice[N - 4]);
+  BOOST_TEST(&std::get<1>(*(it + 2)) == &thrice[N - 2]);
+  BOOST_TEST(&std::get<1>(*(2 + it)) == &thrice[N - 2]);
+  BOOST_TEST((r.begin() < it));
+  BOOST_TEST((it < r.end()));
+
+  // a loop over halves of the range, as a parallel algorithm would do
+  double sum = 0.0;
+  auto const middle = r.begin() + N / 2;
+  auto add = [&sum](auto&& values) { sum += std::get<0>(values) + std::get<1>(values); };
+  std::for_each(r.begin(), middle, add);
+  std::for_each(middle, r.end(), add);
+  BOOST_TEST(sum == 5.0 * (N * (N - 1) / 2));
+
+  // a bidirectional iterator makes the whole zip bidirectional
+  std::list<int> list(N);
+  auto rl = util::zip(twice, list);
+  static_assert(std::is_same_v<std::iterator_traits<decltype(rl.begin())>::iterator_category,
+                               std::bidirectional_iterator_tag>);
+  BOOST_TEST(rl.size() == N);
+
+} // test_zip_random_access()
+
 // -----------------------------------------------------------------------------
 // BEGIN Test cases  -----------------------------------------------------------
 // -----------------------------------------------------------------------------
@@ -98,6 +158,7 @@ BOOST_AUTO_TEST_CASE(zip_testcase)
 
   test_zip();
   test_no_zip();
+  test_zip_random_access();
 
 } // BOOST_AUTO_TEST_CASE(zip_testcase)
 
@@ -0,0 +1,127 @@
+/**
+ * @file   GeoAlgoAllocations_test.cc
+ * @brief  Test that the batch and "into result" queries of `geoalgo::GeoAlgo`
+ *         allocate no memory.
+ * @date   October 14, 2026
+ * @see    `larcorealg/GeoAlgo/GeoAlgo.h`,
+ *         `larcorealg/TestUtils/AllocationCounter.h`
+ *
+ * The queries returning a new result (like `Intersection(box, line)`) do
+ * allocate; the ones tested here write into memory owned by the caller, and
+ * should not. The batch distances from a trajectory allocate their working
+ * space once per call, and never per point.
+ */
+
+// LArSoft libraries
+#include "larcorealg/GeoAlgo/GeoAABox.h"
+#include "larcorealg/GeoAlgo/GeoAlgo.h"
+#include "larcorealg/GeoAlgo/GeoHalfLine.h"
+#include "larcorealg/GeoAlgo/GeoLineSegment.h"
+#include "larcorealg/GeoAlgo/GeoTrajectory.h"
+#include "larcorealg/TestUtils/AllocationCounter.h"
+#include "larcorealg/TestUtils/CountAllocations.h"
+
+// Boost libraries
+#define BOOST_TEST_MODULE (GeoAlgoAllocations_test)
+#include <boost/test/unit_test.hpp>
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <vector>
+
+//------------------------------------------------------------------------------
+namespace {
+
+  /// Objects of the queries, built before counting.
+  struct Inputs {
+    geoalgo::AABox box{0.0, -5.0, 0.0, 10.0, 5.0, 30.0};
+    std::vector<geoalgo::HalfLine> halfLines;
+    std::vector<geoalgo::LineSegment> segments;
+    geoalgo::Trajectory trajectory;
+    std::vector<double> xyz;    ///< Points, as (x, y, z) triplets.
+    std::vector<double> dirXYZ; ///< Directions, as (x, y, z) triplets.
+
+    Inputs()
+    {
+      for (std::size_t i = 0; i < 16U; ++i) {
+        double const z = 1.0 + 1.5 * i;
+        halfLines.emplace_back(-1.0, 0.0, z, 1.0, 0.0, 0.0);
+        segments.emplace_back(-1.0, 0.0, z, 11.0, 0.0, z + 1.0);
+        trajectory.push_back(geoalgo::Point_t{5.0, 0.0, z});
+        xyz.insert(xyz.end(), {-1.0, 0.0, z});
+        dirXYZ.insert(dirXYZ.end(), {1.0, 0.0, 0.0});
+      }
+    }
+
+    std::size_t size() const { return halfLines.size(); }
+  }; // Inputs
+
+} // local namespace
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(BatchIntersectionAllocationTestCase)
+{
+  BOOST_TEST_REQUIRE(testing::allocationsCounted());
+
+  Inputs const inputs;
+  geoalgo::GeoAlgo const algo;
+  std::vector<double> tEnter(inputs.size()), tExit(inputs.size());
+
+  testing::AllocationScope const scope;
+  algo.Intersection(inputs.box, inputs.halfLines, tEnter.data(), tExit.data());
+  algo.Intersection(inputs.box, inputs.segments, tEnter.data(), tExit.data());
+  algo.Intersection(inputs.box,
+                    inputs.size(),
+                    inputs.xyz.data(),
+                    inputs.dirXYZ.data(),
+                    tEnter.data(),
+                    tExit.data());
+  BOOST_TEST(scope.count() == 0U);
+
+  BOOST_TEST(tEnter[0] == 1.0);
+  BOOST_TEST(tExit[0] == 11.0);
+} // BOOST_AUTO_TEST_CASE(BatchIntersectionAllocationTestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(TrajectoryDistanceAllocationTestCase)
+{
+  Inputs const inputs;
+  geoalgo::GeoAlgo const algo;
+  std::vector<double> sqDist(inputs.size()), closest(3U * inputs.size());
+  std::vector<std::size_t> segments(inputs.size());
+
+  // allocations of the queries on the first `n` points
+  auto countAllocations = [&](std::size_t n) {
+    testing::AllocationScope const scope;
+    algo.SqDist(n, inputs.xyz.data(), inputs.trajectory, sqDist.data(), segments.data());
+    algo.ClosestPt(n, inputs.xyz.data(), inputs.trajectory, closest.data());
+    return scope.count();
+  };
+  BOOST_TEST(countAllocations(inputs.size()) == countAllocations(2U));
+
+  BOOST_TEST(sqDist[0] == 36.0);
+} // BOOST_AUTO_TEST_CASE(TrajectoryDistanceAllocationTestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(IntoResultAllocationTestCase)
+{
+  Inputs const inputs;
+  geoalgo::GeoAlgo const algo;
+  std::vector<geoalgo::Point_t> points;
+  geoalgo::LineSegment overlap;
+
+  // the first call grows `points` to its final size
+  algo.Intersection(inputs.box, inputs.segments.front(), points);
+
+  testing::AllocationScope const scope;
+  for (std::size_t i = 0; i < inputs.size(); ++i) {
+    algo.Intersection(inputs.box, inputs.segments[i], points);
+    algo.Intersection(inputs.box, inputs.halfLines[i], points);
+    algo.BoxOverlap(inputs.box, inputs.halfLines[i], overlap);
+  }
+  BOOST_TEST(scope.count() == 0U);
+
+  BOOST_TEST(points.size() == 2U); // the half line enters and exits the box
+} // BOOST_AUTO_TEST_CASE(IntoResultAllocationTestCase)
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,676 @@
+/**
+ * @file   GeoAlgo_test.cc
+ * @brief  Test of the algorithms of `geoalgo::GeoAlgo`.
+ * @date   October 14, 2026
+ * @see    `larcorealg/GeoAlgo/GeoAlgo.h`
+ *
+ * The results of the algorithms are compared with the ones of simpler and
+ * slower computations.
+ */
+
+// LArSoft libraries
+#include "larcorealg/GeoAlgo/GeoAABox.h"
+#include "larcorealg/GeoAlgo/GeoAlgo.h"
+#include "larcorealg/GeoAlgo/GeoAlgoException.h"
+#include "larcorealg/GeoAlgo/GeoCone.h"
+#include "larcorealg/GeoAlgo/GeoCylinder.h"
+#include "larcorealg/GeoAlgo/GeoHalfLine.h"
+#include "larcorealg/GeoAlgo/GeoLine.h"
+#include "larcorealg/GeoAlgo/GeoLineSegment.h"
+#include "larcorealg/GeoAlgo/GeoSphere.h"
+#include "larcorealg/GeoAlgo/GeoTrajectory.h"
+#include "larcorealg/GeoAlgo/GeoVector.h"
+
+// Boost libraries
+#define BOOST_TEST_MODULE (GeoAlgo_test)
+#include <boost/test/unit_test.hpp>
+
+// C/C++ standard libraries
+#include <algorithm> // std::max(), std::min()
+#include <cmath>     // std::sqrt(), std::abs(), std::cos(), std::sin()
+#include <cstddef>   // std::size_t
+#include <memory>    // std::unique_ptr
+#include <random>
+#include <vector>
+
+//------------------------------------------------------------------------------
+namespace {
+
+  /// Candidate bounding sphere: center and radius.
+  struct Ball {
+    geoalgo::Point_t center;
+    double radius = -1.0; ///< Negative if not defined.
+  };
+
+  /// The largest distance of the `pts` from `center`.
+  double farthest(std::vector<geoalgo::Point_t> const& pts, geoalgo::Point_t const& center)
+  {
+    double dist = 0.0;
+    for (geoalgo::Point_t const& pt : pts)
+      dist = std::max(dist, pt.Dist(center));
+    return dist;
+  }
+
+  /// The smallest sphere through `a` and `b`.
+  Ball ballThrough(geoalgo::Point_t const& a, geoalgo::Point_t const& b)
+  {
+    return {(a + b) / 2.0, a.Dist(b) / 2.0};
+  }
+
+  /// The smallest sphere through `a`, `b` and `c` (not defined if they are aligned).
+  Ball ballThrough(geoalgo::Point_t const& a, geoalgo::Point_t const& b, geoalgo::Point_t const& c)
+  {
+    geoalgo::Vector_t const u = b - a, v = c - a, w = u.Cross(v);
+    if (w.SqLength() < 1e-12 * u.SqLength() * v.SqLength()) return {};
+    geoalgo::Point_t const center =
+      a + (w.Cross(u) * v.SqLength() + v.Cross(w) * u.SqLength()) / (2.0 * w.SqLength());
+    return {center, center.Dist(a)};
+  }
+
+  /// The sphere through `a`, `b`, `c` and `d` (not defined if they are coplanar).
+  Ball ballThrough(geoalgo::Point_t const& a,
+                   geoalgo::Point_t const& b,
+                   geoalgo::Point_t const& c,
+                   geoalgo::Point_t const& d)
+  {
+    geoalgo::Vector_t const u = b - a, v = c - a, w = d - a;
+    double const det = u * v.Cross(w);
+    if (std::abs(det) < 1e-9 * u.Length() * v.Length() * w.Length()) return {};
+    geoalgo::Point_t const center =
+      a + (v.Cross(w) * u.SqLength() + w.Cross(u) * v.SqLength() + u.Cross(v) * w.SqLength()) /
+            (2.0 * det);
+    return {center, center.Dist(a)};
+  }
+
+  /// The minimal bounding sphere, from all the spheres through up to four of the `pts`.
+  Ball bruteBoundingSphere(std::vector<geoalgo::Point_t> const& pts)
+  {
+    double const slack = 1e-9;
+    Ball best{pts.front(), farthest(pts, pts.front()) > 0.0 ? geoalgo::kINVALID_DOUBLE : 0.0};
+    auto consider = [&](Ball const& ball) {
+      if ((ball.radius < 0.0) || (ball.radius >= best.radius)) return;
+      if (farthest(pts, ball.center) <= ball.radius * (1.0 + slack)) best = ball;
+    };
+    std::size_t const n = pts.size();
+    for (std::size_t i = 0; i < n; ++i)
+      for (std::size_t j = i + 1; j < n; ++j) {
+        consider(ballThrough(pts[i], pts[j]));
+        for (std::size_t k = j + 1; k < n; ++k) {
+          consider(ballThrough(pts[i], pts[j], pts[k]));
+          for (std::size_t l = k + 1; l < n; ++l)
+            consider(ballThrough(pts[i], pts[j], pts[k], pts[l]));
+        }
+      }
+    return best;
+  } // bruteBoundingSphere()
+
+  /// Checks that `sphere` contains all the `pts` and has the expected center and radius.
+  void checkBoundingSphere(std::vector<geoalgo::Point_t> const& pts,
+                           geoalgo::Sphere_t const& sphere,
+                           geoalgo::Point_t const& center,
+                           double radius)
+  {
+    double const tol = 1e-7 * std::max(radius, 1.0);
+    BOOST_TEST(farthest(pts, sphere.Center()) <= sphere.Radius() + tol);
+    BOOST_TEST(std::abs(sphere.Radius() - radius) <= tol);
+    BOOST_TEST(sphere.Center().Dist(center) <= std::sqrt(tol));
+  } // checkBoundingSphere()
+
+  /// Closest segments of two trajectories, from the loop on all the segment pairs.
+  struct ClosestSegments {
+    double sqDist = geoalgo::kMAX_DOUBLE;
+    geoalgo::Point_t c1, c2;
+    std::size_t seg1 = 0, seg2 = 0;
+  };
+
+  /// The closest pair of segments of `trj1` and `trj2`, the first one in case of ties.
+  ClosestSegments bruteSqDist(geoalgo::GeoAlgo const& algo,
+                              geoalgo::Trajectory_t const& trj1,
+                              geoalgo::Trajectory_t const& trj2)
+  {
+    ClosestSegments closest;
+    for (std::size_t i = 0; i + 1 < trj1.size(); ++i)
+      for (std::size_t j = 0; j + 1 < trj2.size(); ++j) {
+        geoalgo::LineSegment_t const seg1{trj1[i], trj1[i + 1]}, seg2{trj2[j], trj2[j + 1]};
+        geoalgo::Point_t c1, c2;
+        double const sqDist = algo.SqDist(seg1, seg2, c1, c2);
+        if (sqDist < closest.sqDist) closest = {sqDist, c1, c2, i, j};
+      }
+    return closest;
+  } // bruteSqDist()
+
+  /// Checks the trajectory distance and `WithinDist()` against `bruteSqDist()`.
+  void checkTrajectoryDist(geoalgo::GeoAlgo const& algo,
+                           geoalgo::Trajectory_t const& trj1,
+                           geoalgo::Trajectory_t const& trj2)
+  {
+    ClosestSegments const expected = bruteSqDist(algo, trj1, trj2);
+
+    geoalgo::Point_t c1, c2;
+    std::size_t seg1 = 0, seg2 = 0;
+    BOOST_TEST(algo.SqDist(trj1, trj2, c1, c2, seg1, seg2) == expected.sqDist);
+    BOOST_TEST(seg1 == expected.seg1);
+    BOOST_TEST(seg2 == expected.seg2);
+    BOOST_TEST((c1 == expected.c1));
+    BOOST_TEST((c2 == expected.c2));
+    BOOST_TEST(algo.SqDist(trj1, trj2) == expected.sqDist);
+
+    // within a distance: any pair within it, or none
+    double const dist = std::sqrt(expected.sqDist);
+    for (double const d : {dist * 0.5, dist * 1.01 + 1e-6, dist * 2.0 + 1.0}) {
+      bool const within = algo.WithinDist(trj1, trj2, d, c1, c2, seg1, seg2);
+      BOOST_TEST(within == (expected.sqDist <= d * d));
+      if (within) BOOST_TEST(c1.SqDist(c2) <= d * d * (1.0 + 1e-12));
+      BOOST_TEST(algo.WithinDist(trj1, trj2, d) == within);
+    }
+  } // checkTrajectoryDist()
+
+  /// Checks the float `Contain()` batch of `shape` against the double one and the single calls.
+  template <typename Shape>
+  void checkFloatContain(Shape const& shape, std::vector<geoalgo::Point_t> const& pts)
+  {
+    // the points rounded to float, in double and float arrays
+    std::vector<double> xyz;
+    std::vector<float> xyzf;
+    for (geoalgo::Point_t const& pt : pts)
+      for (std::size_t i = 0; i < 3; ++i) {
+        xyzf.push_back(static_cast<float>(pt[i]));
+        xyz.push_back(xyzf.back());
+      }
+    std::size_t const n = pts.size();
+    std::unique_ptr<bool[]> mask{new bool[n]}, maskf{new bool[n]};
+    shape.Contain(n, xyz.data(), mask.get());
+    shape.Contain(n, xyzf.data(), maskf.get());
+
+    std::size_t nInside = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+      geoalgo::Point_t const pt{xyz[3 * i], xyz[3 * i + 1], xyz[3 * i + 2]};
+      BOOST_TEST(mask[i] == shape.Contain(pt));
+      if (mask[i]) ++nInside;
+      if (maskf[i] == mask[i]) continue;
+      // a disagreement is allowed only next to the surface
+      bool nearSurface = false;
+      for (std::size_t axis = 0; axis < 3; ++axis)
+        for (double const shift : {-1e-4, 1e-4}) {
+          geoalgo::Point_t moved{pt};
+          moved[axis] += shift * (1.0 + std::abs(pt[axis]));
+          if (shape.Contain(moved) != mask[i]) nearSurface = true;
+        }
+      BOOST_TEST(nearSurface);
+    } // for points
+    BOOST_TEST(nInside > 0U);
+    BOOST_TEST(nInside < n);
+  } // checkFloatContain()
+
+} // local namespace
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(BoundingSphereTestCase)
+{
+  geoalgo::GeoAlgo const algo;
+
+  // no point
+  BOOST_CHECK_THROW(algo.boundingSphere({}), geoalgo::GeoAlgoException);
+
+  // one point, also repeated
+  geoalgo::Point_t const a{1.0, 2.0, 3.0}, b{3.0, 2.0, 1.0};
+  checkBoundingSphere({a}, algo.boundingSphere({a}), a, 0.0);
+  checkBoundingSphere({a, a, a}, algo.boundingSphere({a, a, a}), a, 0.0);
+
+  // two points, also repeated
+  double const halfAB = a.Dist(b) / 2.0;
+  checkBoundingSphere({a, b}, algo.boundingSphere({a, b}), (a + b) / 2.0, halfAB);
+  checkBoundingSphere({b, a, b, a}, algo.boundingSphere({b, a, b, a}), (a + b) / 2.0, halfAB);
+
+  // collinear points: the sphere on the two ends
+  std::vector<geoalgo::Point_t> line;
+  for (double const t : {0.3, 0.0, 0.9, 0.5, 1.0, 0.5, 0.1})
+    line.push_back(a + (b - a) * t);
+  checkBoundingSphere(line, algo.boundingSphere(line), (a + b) / 2.0, halfAB);
+
+  // the corners of a cube
+  std::vector<geoalgo::Point_t> cube;
+  for (double const x : {-1.0, 1.0})
+    for (double const y : {-1.0, 1.0})
+      for (double const z : {-1.0, 1.0})
+        cube.push_back(a + geoalgo::Vector_t{x, y, z});
+  checkBoundingSphere(cube, algo.boundingSphere(cube), a, std::sqrt(3.0));
+
+  // cospherical points, not all in one hemisphere, and a point inside
+  std::mt19937 engine{20261014U};
+  std::normal_distribution<double> gauss;
+  auto randomDir = [&]() -> geoalgo::Vector_t {
+    geoalgo::Vector_t const dir{gauss(engine), gauss(engine), gauss(engine)};
+    return dir / dir.Length();
+  };
+  std::vector<geoalgo::Point_t> onSphere{b, b + geoalgo::Vector_t{5.0, 0.0, 0.0}};
+  for (std::size_t i = 0; i < 200U; ++i)
+    onSphere.push_back(b + randomDir() * 5.0);
+  onSphere.push_back(b - geoalgo::Vector_t{5.0, 0.0, 0.0});
+  checkBoundingSphere(onSphere, algo.boundingSphere(onSphere), b, 5.0);
+
+  // cocircular points, in a plane
+  std::vector<geoalgo::Point_t> onCircle;
+  for (std::size_t i = 0; i < 12U; ++i) {
+    double const angle = 2.0 * geoalgo::kPI * i / 12.0;
+    onCircle.push_back(a + geoalgo::Vector_t{std::cos(angle), std::sin(angle), 1.0} * 2.0);
+  }
+  checkBoundingSphere(onCircle, algo.boundingSphere(onCircle), a + geoalgo::Vector_t{0, 0, 2}, 2.0);
+
+  // random sets, against all the spheres through up to four of their points
+  std::uniform_real_distribution<double> coord{-10.0, 10.0};
+  for (std::size_t const n : {3U, 4U, 5U, 8U, 12U}) {
+    for (std::size_t trial = 0; trial < 20U; ++trial) {
+      std::vector<geoalgo::Point_t> pts;
+      for (std::size_t i = 0; i < n; ++i)
+        pts.push_back(geoalgo::Point_t{coord(engine), coord(engine), coord(engine)});
+      Ball const expected = bruteBoundingSphere(pts);
+      checkBoundingSphere(pts, algo.boundingSphere(pts), expected.center, expected.radius);
+    }
+  }
+
+  // a large cluster with duplicates: all the points in the sphere
+  std::vector<geoalgo::Point_t> cluster;
+  for (std::size_t i = 0; i < 20000U; ++i)
+    cluster.push_back(geoalgo::Point_t{gauss(engine), gauss(engine), gauss(engine)});
+  for (std::size_t i = 0; i < 1000U; ++i)
+    cluster.push_back(cluster[i]);
+  geoalgo::Sphere_t const sphere = algo.boundingSphere(cluster);
+  BOOST_TEST(farthest(cluster, sphere.Center()) <= sphere.Radius() * (1.0 + 1e-9));
+
+} // BOOST_AUTO_TEST_CASE(BoundingSphereTestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(TrajectorySqDistTestCase)
+{
+  geoalgo::GeoAlgo const algo;
+  std::mt19937 engine{20261014U};
+  std::uniform_real_distribution<double> coord{-10.0, 10.0};
+  std::normal_distribution<double> step{0.0, 1.0};
+  auto randomPoint = [&]() -> geoalgo::Point_t {
+    return {coord(engine), coord(engine), coord(engine)};
+  };
+  // a random walk of `n` points
+  auto randomWalk = [&](std::size_t n) {
+    geoalgo::Trajectory_t trj;
+    trj.push_back(randomPoint());
+    while (trj.size() < n)
+      trj.push_back(trj.back() + geoalgo::Vector_t{step(engine), step(engine), step(engine)});
+    return trj;
+  };
+
+  // single segments
+  for (std::size_t i = 0; i < 200U; ++i) {
+    geoalgo::Trajectory_t seg1, seg2;
+    seg1.push_back(randomPoint());
+    seg1.push_back(randomPoint());
+    seg2.push_back(randomPoint());
+    seg2.push_back(randomPoint());
+    checkTrajectoryDist(algo, seg1, seg2);
+  }
+
+  // trajectories, shorter and longer than a chunk of pruned segments
+  for (std::size_t const n1 : {2U, 5U, 17U, 60U}) {
+    for (std::size_t const n2 : {3U, 16U, 40U, 150U}) {
+      for (std::size_t trial = 0; trial < 10U; ++trial) {
+        geoalgo::Trajectory_t const trj1 = randomWalk(n1), trj2 = randomWalk(n2);
+        checkTrajectoryDist(algo, trj1, trj2);
+        checkTrajectoryDist(algo, trj2, trj1);
+      }
+    }
+  }
+
+  // ties: a trajectory and itself, a crossing, and repeated parallel segments
+  geoalgo::Trajectory_t const walk = randomWalk(50U);
+  checkTrajectoryDist(algo, walk, walk);
+  geoalgo::Trajectory_t comb1, comb2;
+  for (std::size_t i = 0; i < 40U; ++i) {
+    double const x = static_cast<double>(i / 2);
+    comb1.push_back(geoalgo::Point_t{x, 0.0, (i % 4 < 2) ? 0.0 : 1.0});
+    comb2.push_back(geoalgo::Point_t{x, 2.0, (i % 4 < 2) ? 0.0 : 1.0});
+  }
+  checkTrajectoryDist(algo, comb1, comb2);
+  geoalgo::Trajectory_t cross;
+  cross.push_back(geoalgo::Point_t{5.5, -1.0, 0.5});
+  cross.push_back(geoalgo::Point_t{5.5, 3.0, 0.5});
+  checkTrajectoryDist(algo, comb1, cross);
+
+  // a single point has no segment
+  geoalgo::Trajectory_t point;
+  point.push_back(randomPoint());
+  BOOST_TEST(algo.SqDist(point, walk) == geoalgo::kMAX_DOUBLE);
+  BOOST_TEST(!algo.WithinDist(point, walk, 100.0));
+  BOOST_CHECK_THROW(algo.SqDist(geoalgo::Trajectory_t{}, walk), geoalgo::GeoAlgoException);
+
+} // BOOST_AUTO_TEST_CASE(TrajectorySqDistTestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(BatchPointTrajectoryTestCase)
+{
+  geoalgo::GeoAlgo const algo;
+  std::mt19937 engine{20261014U};
+  std::uniform_real_distribution<double> coord{-10.0, 10.0};
+  std::normal_distribution<double> step{0.0, 1.0};
+
+  for (std::size_t const nPoints : {2U, 17U, 60U}) {
+    geoalgo::Trajectory_t trj;
+    trj.push_back(geoalgo::Point_t{coord(engine), coord(engine), coord(engine)});
+    while (trj.size() < nPoints)
+      trj.push_back(trj.back() + geoalgo::Vector_t{step(engine), step(engine), step(engine)});
+
+    // random points, not a whole number of blocks, and the trajectory points (ties)
+    std::vector<geoalgo::Point_t> pts;
+    for (std::size_t i = 0; i < 333U; ++i)
+      pts.push_back(geoalgo::Point_t{coord(engine), coord(engine), coord(engine)});
+    pts.insert(pts.end(), trj.begin(), trj.end());
+    std::vector<double> xyz;
+    for (geoalgo::Point_t const& pt : pts)
+      xyz.insert(xyz.end(), {pt[0], pt[1], pt[2]});
+
+    std::vector<double> sqDist(pts.size()), arraySqDist(pts.size()), noIdxSqDist(pts.size());
+    std::vector<std::size_t> segIdx(pts.size()), arraySegIdx(pts.size()), closestIdx(pts.size());
+    std::vector<geoalgo::Point_t> closest(pts.size());
+    std::vector<double> closestXYZ(xyz.size());
+    algo.SqDist(pts, trj, sqDist.data(), segIdx.data());
+    algo.SqDist(pts, trj, noIdxSqDist.data());
+    algo.SqDist(pts.size(), xyz.data(), trj, arraySqDist.data(), arraySegIdx.data());
+    algo.ClosestPt(pts, trj, closest.data(), closestIdx.data());
+    algo.ClosestPt(pts.size(), xyz.data(), trj, closestXYZ.data());
+
+    // each result is the one of the call for a single point, to the bit
+    for (std::size_t i = 0; i < pts.size(); ++i) {
+      int idx = -1;
+      geoalgo::Point_t const expected = algo.ClosestPt(pts[i], trj, idx);
+      double const expectedSqDist = algo.SqDist(pts[i], trj);
+      BOOST_TEST(sqDist[i] == expectedSqDist);
+      BOOST_TEST(noIdxSqDist[i] == expectedSqDist);
+      BOOST_TEST(arraySqDist[i] == expectedSqDist);
+      BOOST_TEST(segIdx[i] == static_cast<std::size_t>(idx));
+      BOOST_TEST(arraySegIdx[i] == static_cast<std::size_t>(idx));
+      BOOST_TEST(closestIdx[i] == static_cast<std::size_t>(idx));
+      BOOST_TEST((closest[i] == expected));
+      BOOST_TEST(closestXYZ[3 * i] == expected[0]);
+      BOOST_TEST(closestXYZ[3 * i + 1] == expected[1]);
+      BOOST_TEST(closestXYZ[3 * i + 2] == expected[2]);
+    }
+  }
+
+  // a single point trajectory: the distance from that point
+  geoalgo::Trajectory_t single;
+  single.push_back(geoalgo::Point_t{1.0, 1.0, 1.0});
+  std::vector<geoalgo::Point_t> const pts{{1.0, 1.0, 1.0}, {1.0, 3.0, 1.0}, {0.0, 0.0, 0.0}};
+  std::vector<double> sqDist(pts.size());
+  std::vector<geoalgo::Point_t> closest(pts.size());
+  algo.SqDist(pts, single, sqDist.data());
+  algo.ClosestPt(pts, single, closest.data());
+  for (std::size_t i = 0; i < pts.size(); ++i) {
+    BOOST_TEST(sqDist[i] == pts[i].SqDist(single[0]));
+    BOOST_TEST((closest[i] == single[0]));
+  }
+
+  // no point, and no trajectory
+  algo.SqDist(std::vector<geoalgo::Point_t>{}, single, sqDist.data());
+  BOOST_CHECK_THROW(algo.SqDist(pts, geoalgo::Trajectory_t{}, sqDist.data()),
+                    geoalgo::GeoAlgoException);
+  BOOST_CHECK_THROW(algo.ClosestPt(pts, geoalgo::Trajectory_t{}, closest.data()),
+                    geoalgo::GeoAlgoException);
+
+} // BOOST_AUTO_TEST_CASE(BatchPointTrajectoryTestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(BatchSlabIntersectionTestCase)
+{
+  geoalgo::GeoAlgo const algo;
+  std::mt19937 engine{20261014U};
+  std::uniform_real_distribution<double> coord{-10.0, 10.0};
+  std::normal_distribution<double> gauss;
+  auto randomPoint = [&]() -> geoalgo::Point_t {
+    return {coord(engine), coord(engine), coord(engine)};
+  };
+  auto randomDir = [&]() -> geoalgo::Vector_t {
+    return {gauss(engine), gauss(engine), gauss(engine)};
+  };
+
+  std::vector<geoalgo::AABox_t> boxes;
+  for (std::size_t i = 0; i < 5U; ++i) {
+    geoalgo::Point_t const a = randomPoint() / 2.0, b = randomPoint() / 2.0;
+    boxes.emplace_back(std::min(a[0], b[0]), std::min(a[1], b[1]), std::min(a[2], b[2]),
+                       std::max(a[0], b[0]), std::max(a[1], b[1]), std::max(a[2], b[2]));
+  }
+
+  // a batch point at parameter `t` matches `expected` within rounding
+  auto checkPoint = [](geoalgo::Point_t const& start,
+                       geoalgo::Vector_t const& dir,
+                       double t,
+                       geoalgo::Point_t const& expected) {
+    BOOST_TEST((start + dir * t).Dist(expected) <= 1e-9 * (1.0 + start.Dist(expected)));
+  };
+
+  // half lines, against the intersection points of each of them
+  std::vector<geoalgo::HalfLine_t> halfLines;
+  for (std::size_t i = 0; i < 301U; ++i)
+    halfLines.emplace_back(randomPoint(), randomDir());
+  std::vector<double> tEnter(halfLines.size() * boxes.size()), tExit(tEnter.size());
+  algo.Intersection(boxes, halfLines, tEnter.data(), tExit.data());
+  std::size_t nHits = 0;
+  for (std::size_t i = 0; i < halfLines.size(); ++i) {
+    geoalgo::HalfLine_t const& line = halfLines[i];
+    for (std::size_t j = 0; j < boxes.size(); ++j) {
+      std::size_t const k = i * boxes.size() + j;
+      auto const xs = algo.Intersection(boxes[j], line);
+      if (boxes[j].Contain(line.Start())) {
+        BOOST_TEST_REQUIRE(xs.size() == 1U);
+        BOOST_TEST(tEnter[k] == 0.0);
+        checkPoint(line.Start(), line.Dir(), tExit[k], xs[0]);
+      }
+      else if (xs.empty()) {
+        BOOST_TEST(tEnter[k] == geoalgo::kINVALID_DOUBLE);
+        BOOST_TEST(tExit[k] == geoalgo::kINVALID_DOUBLE);
+      }
+      else {
+        BOOST_TEST_REQUIRE(xs.size() == 2U);
+        checkPoint(line.Start(), line.Dir(), tEnter[k], xs[0]);
+        checkPoint(line.Start(), line.Dir(), tExit[k], xs[1]);
+        ++nHits;
+      }
+    }
+  }
+  BOOST_TEST(nHits > 0U);
+
+  // the single box batch and the coordinate arrays give the same results
+  std::vector<double> start, dir;
+  for (geoalgo::HalfLine_t const& line : halfLines) {
+    start.insert(start.end(), {line.Start()[0], line.Start()[1], line.Start()[2]});
+    dir.insert(dir.end(), {line.Dir()[0], line.Dir()[1], line.Dir()[2]});
+  }
+  std::vector<double> arrayEnter(tEnter.size()), arrayExit(tEnter.size());
+  algo.Intersection(boxes, halfLines.size(), start.data(), dir.data(), arrayEnter.data(),
+                    arrayExit.data());
+  BOOST_TEST(arrayEnter == tEnter, boost::test_tools::per_element());
+  BOOST_TEST(arrayExit == tExit, boost::test_tools::per_element());
+  for (std::size_t j = 0; j < boxes.size(); ++j) {
+    std::vector<double> boxEnter(halfLines.size()), boxExit(halfLines.size());
+    algo.Intersection(boxes[j], halfLines, boxEnter.data(), boxExit.data());
+    for (std::size_t i = 0; i < halfLines.size(); ++i) {
+      BOOST_TEST(boxEnter[i] == tEnter[i * boxes.size() + j]);
+      BOOST_TEST(boxExit[i] == tExit[i * boxes.size() + j]);
+    }
+  }
+
+  // line segments: the crossing points within the segment are the entry and exit ones
+  std::vector<geoalgo::LineSegment_t> segments;
+  for (std::size_t i = 0; i < 300U; ++i)
+    segments.emplace_back(randomPoint(), randomPoint());
+  std::vector<double> segEnter(segments.size()), segExit(segments.size());
+  geoalgo::AABox_t const& box = boxes.front();
+  algo.Intersection(box, segments, segEnter.data(), segExit.data());
+  for (std::size_t i = 0; i < segments.size(); ++i) {
+    geoalgo::LineSegment_t const& seg = segments[i];
+    auto const xs = algo.Intersection(box, seg);
+    bool const inside = box.Contain(seg.Start()) && box.Contain(seg.End());
+    if (xs.empty() && !inside) {
+      BOOST_TEST(segEnter[i] == geoalgo::kINVALID_DOUBLE);
+      BOOST_TEST(segExit[i] == geoalgo::kINVALID_DOUBLE);
+      continue;
+    }
+    BOOST_TEST_REQUIRE(segEnter[i] >= 0.0);
+    BOOST_TEST_REQUIRE(segExit[i] <= 1.0);
+    BOOST_TEST(segEnter[i] <= segExit[i]);
+    std::vector<double> crossings;
+    if (segEnter[i] > 0.0) crossings.push_back(segEnter[i]);
+    if (segExit[i] < 1.0) crossings.push_back(segExit[i]);
+    BOOST_TEST_REQUIRE(crossings.size() == xs.size());
+    for (std::size_t j = 0; j < xs.size(); ++j)
+      checkPoint(seg.Start(), seg.Dir(), crossings[j], xs[j]);
+  }
+
+  // lines: the crossings of a segment long enough to go through the box
+  std::vector<geoalgo::Line_t> lines;
+  for (std::size_t i = 0; i < 300U; ++i) {
+    geoalgo::Point_t const pt = randomPoint();
+    lines.emplace_back(pt, pt + randomDir());
+  }
+  std::vector<double> lineEnter(lines.size()), lineExit(lines.size());
+  algo.Intersection(box, lines, lineEnter.data(), lineExit.data());
+  for (std::size_t i = 0; i < lines.size(); ++i) {
+    geoalgo::Line_t const& line = lines[i];
+    double const reach = 1000.0 / line.Dir().Length();
+    geoalgo::LineSegment_t const seg{line.Pt1() - line.Dir() * reach,
+                                     line.Pt1() + line.Dir() * reach};
+    auto const xs = algo.Intersection(box, seg);
+    if (xs.empty()) {
+      BOOST_TEST(lineEnter[i] == geoalgo::kINVALID_DOUBLE);
+      BOOST_TEST(lineExit[i] == geoalgo::kINVALID_DOUBLE);
+      continue;
+    }
+    BOOST_TEST_REQUIRE(xs.size() == 2U);
+    BOOST_TEST(lineEnter[i] <= lineExit[i]);
+    checkPoint(line.Pt1(), line.Dir(), lineEnter[i], xs[0]);
+    checkPoint(line.Pt1(), line.Dir(), lineExit[i], xs[1]);
+  }
+
+  // lines parallel to the faces, also lying on them: faces are part of the box
+  geoalgo::AABox_t const unit{0.0, 0.0, 0.0, 1.0, 1.0, 1.0};
+  std::vector<geoalgo::HalfLine_t> const parallel{
+    {geoalgo::Point_t{-1.0, 0.5, 0.5}, geoalgo::Vector_t{1.0, 0.0, 0.0}},
+    {geoalgo::Point_t{-1.0, 1.0, 0.5}, geoalgo::Vector_t{1.0, 0.0, 0.0}},
+    {geoalgo::Point_t{-1.0, 1.0, 1.0}, geoalgo::Vector_t{1.0, 0.0, 0.0}},
+    {geoalgo::Point_t{-1.0, 1.5, 0.5}, geoalgo::Vector_t{1.0, 0.0, 0.0}},
+    {geoalgo::Point_t{2.0, 0.5, 0.5}, geoalgo::Vector_t{1.0, 0.0, 0.0}},
+  };
+  std::vector<double> const expectedEnter{1.0, 1.0, 1.0, geoalgo::kINVALID_DOUBLE,
+                                          geoalgo::kINVALID_DOUBLE};
+  std::vector<double> const expectedExit{2.0, 2.0, 2.0, geoalgo::kINVALID_DOUBLE,
+                                         geoalgo::kINVALID_DOUBLE};
+  std::vector<double> parEnter(parallel.size()), parExit(parallel.size());
+  algo.Intersection(unit, parallel, parEnter.data(), parExit.data());
+  BOOST_TEST(parEnter == expectedEnter, boost::test_tools::per_element());
+  BOOST_TEST(parExit == expectedExit, boost::test_tools::per_element());
+
+} // BOOST_AUTO_TEST_CASE(BatchSlabIntersectionTestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(FloatBatchTestCase)
+{
+  // the float batches agree with the double ones, which are the single calls, on the
+  // same (float) points within float rounding
+  geoalgo::GeoAlgo const algo;
+  std::mt19937 engine{20261014U};
+  std::uniform_real_distribution<double> coord{-10.0, 10.0};
+  std::normal_distribution<double> gauss;
+  auto randomPoint = [&]() -> geoalgo::Point_t {
+    return {coord(engine), coord(engine), coord(engine)};
+  };
+  // coordinates of `pts` rounded to float, in a float and in a double array
+  auto toArrays = [](std::vector<geoalgo::Point_t> const& pts,
+                     std::vector<float>& xyzf,
+                     std::vector<double>& xyz) {
+    xyzf.clear();
+    xyz.clear();
+    for (geoalgo::Point_t const& pt : pts)
+      for (std::size_t i = 0; i < 3; ++i) {
+        xyzf.push_back(static_cast<float>(pt[i]));
+        xyz.push_back(xyzf.back());
+      }
+  };
+
+  // point to trajectory distances
+  geoalgo::Trajectory_t trj;
+  trj.push_back(randomPoint());
+  while (trj.size() < 40U)
+    trj.push_back(trj.back() + geoalgo::Vector_t{gauss(engine), gauss(engine), gauss(engine)});
+  std::vector<geoalgo::Point_t> pts;
+  for (std::size_t i = 0; i < 1001U; ++i)
+    pts.push_back(randomPoint());
+  pts.insert(pts.end(), trj.begin(), trj.end());
+  std::vector<float> xyzf;
+  std::vector<double> xyz;
+  toArrays(pts, xyzf, xyz);
+
+  std::size_t const n = pts.size();
+  std::vector<float> sqDistf(n);
+  std::vector<double> sqDist(n);
+  std::vector<std::size_t> segIdxf(n), segIdx(n);
+  algo.SqDist(n, xyzf.data(), trj, sqDistf.data(), segIdxf.data());
+  algo.SqDist(n, xyz.data(), trj, sqDist.data(), segIdx.data());
+  for (std::size_t i = 0; i < n; ++i) {
+    geoalgo::Point_t const pt{xyz[3 * i], xyz[3 * i + 1], xyz[3 * i + 2]};
+    BOOST_TEST(sqDist[i] == algo.SqDist(pt, trj));
+    // as the single calls, `ac2 - e * e / f` may round below 0 for points on a segment
+    double const dist = std::sqrt(std::max(sqDist[i], 0.0));
+    // float coordinates of the trajectory are rounded by up to ~1e-6
+    double const tol = 1e-5 * (1.0 + dist);
+    BOOST_TEST(std::abs(std::sqrt(double(sqDistf[i])) - dist) <= tol);
+    // the float segment may be another one, but only if it is as close
+    geoalgo::LineSegment_t const seg{trj[segIdxf[i]], trj[segIdxf[i] + 1]};
+    BOOST_TEST(std::sqrt(std::max(algo.SqDist(pt, seg), 0.0)) - dist <= 2.0 * tol);
+  }
+
+  // slab intersections of half lines with boxes
+  std::vector<geoalgo::AABox_t> const boxes{{-3.0, -2.0, -1.0, 4.0, 5.0, 3.0},
+                                            {1.0, 1.0, 1.0, 1.5, 8.0, 2.0}};
+  std::vector<geoalgo::Point_t> dirs;
+  for (std::size_t i = 0; i < n; ++i) {
+    geoalgo::Vector_t const dir{gauss(engine), gauss(engine), gauss(engine)};
+    dirs.push_back(dir / dir.Length());
+  }
+  std::vector<float> dirf;
+  std::vector<double> dird;
+  toArrays(dirs, dirf, dird);
+  std::vector<float> enterf(n * boxes.size()), exitf(n * boxes.size());
+  std::vector<double> enter(n * boxes.size()), exit(n * boxes.size());
+  algo.Intersection(boxes, n, xyzf.data(), dirf.data(), enterf.data(), exitf.data());
+  algo.Intersection(boxes, n, xyz.data(), dird.data(), enter.data(), exit.data());
+  std::size_t nHits = 0;
+  for (std::size_t k = 0; k < enter.size(); ++k) {
+    bool const hit = enter[k] != geoalgo::kINVALID_DOUBLE;
+    bool const hitf = enterf[k] != geoalgo::kINVALID_FLOAT;
+    BOOST_TEST(hit == (exit[k] != geoalgo::kINVALID_DOUBLE));
+    BOOST_TEST(hitf == (exitf[k] != geoalgo::kINVALID_FLOAT));
+    if (hit && hitf) {
+      ++nHits;
+      BOOST_TEST(std::abs(enterf[k] - enter[k]) <= 1e-5 * (1.0 + enter[k]));
+      BOOST_TEST(std::abs(exitf[k] - exit[k]) <= 1e-5 * (1.0 + exit[k]));
+    }
+    else if (hit) { // a line grazing the box
+      BOOST_TEST(exit[k] - enter[k] <= 1e-4 * (1.0 + exit[k]));
+    }
+    else if (hitf) {
+      BOOST_TEST(exitf[k] - enterf[k] <= 1e-4 * (1.0 + exitf[k]));
+    }
+  }
+  BOOST_TEST(nHits > 0U);
+
+  // containment, with many points close to the surfaces
+  std::vector<geoalgo::Point_t> cloud;
+  for (std::size_t i = 0; i < 2000U; ++i)
+    cloud.push_back(randomPoint() / 2.0);
+  checkFloatContain(geoalgo::Sphere_t{geoalgo::Point_t{0.5, 0.0, -0.5}, 3.0}, cloud);
+  checkFloatContain(
+    geoalgo::Cylinder_t{geoalgo::Point_t{-4.0, 0.0, 0.0}, geoalgo::Vector_t{4.0, 1.0, 1.0}, 2.0},
+    cloud);
+  checkFloatContain(
+    geoalgo::Cone_t{geoalgo::Point_t{-4.0, 0.0, 0.0}, geoalgo::Vector_t{1.0, 0.5, 0.0}, 8.0, 3.0},
+    cloud);
+
+} // BOOST_AUTO_TEST_CASE(FloatBatchTestCase)
@@ -0,0 +1,257 @@
+/**
+ * @file   GeoConvexHull_test.cc
+ * @brief  Test of `geoalgo::ConvexHull2D` and `geoalgo::ConvexHull3D`.
+ * @date   October 14, 2026
+ * @see    `larcorealg/GeoAlgo/GeoConvexHull.h`
+ *
+ * The hulls of known shapes are checked, including the degenerate ones
+ * (collinear, coplanar and repeated points), and the hulls of random points
+ * are checked to contain all of them.
+ */
+
+// LArSoft libraries
+#include "larcorealg/GeoAlgo/GeoConvexHull.h"
+#include "larcorealg/GeoAlgo/GeoVector.h"
+
+// Boost libraries
+#define BOOST_TEST_MODULE (GeoConvexHull_test)
+#include <boost/test/unit_test.hpp>
+
+// C/C++ standard libraries
+#include <cmath>   // std::sqrt()
+#include <cstddef> // std::size_t
+#include <random>
+#include <vector>
+
+//------------------------------------------------------------------------------
+namespace {
+
+  /// Twice the signed area of the triangle (`o`, `a`, `b`).
+  double cross(double os, double ot, double as, double at, double bs, double bt)
+  {
+    return (as - os) * (bt - ot) - (at - ot) * (bs - os);
+  }
+
+} // local namespace
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(ConvexHull2DTestCase)
+{
+  // a square, with points inside, on the edges, and repeated corners
+  std::vector<double> const s{0.0, 2.0, 2.0, 0.0, 1.0, 1.0, 0.0, 2.0, 0.5, 2.0};
+  std::vector<double> const t{0.0, 0.0, 2.0, 2.0, 1.0, 0.0, 1.0, 2.0, 1.5, 0.0};
+  geoalgo::ConvexHull2D hull;
+  hull.Build(s.size(), s.data(), t.data());
+  BOOST_TEST_REQUIRE(hull.size() == 4U);
+  // counterclockwise from the smallest first coordinate
+  BOOST_TEST(hull.S(0) == 0.0);
+  BOOST_TEST(hull.T(0) == 0.0);
+  BOOST_TEST(hull.S(1) == 2.0);
+  BOOST_TEST(hull.T(1) == 0.0);
+  BOOST_TEST(hull.S(2) == 2.0);
+  BOOST_TEST(hull.T(2) == 2.0);
+  BOOST_TEST(hull.Area() == 4.0);
+  BOOST_TEST(hull.Perimeter() == 8.0);
+  for (std::size_t i = 0; i < s.size(); ++i)
+    BOOST_TEST(hull.Contain(s[i], t[i]));
+  BOOST_TEST(hull.Contain(1.0, 2.0));
+  BOOST_TEST(!hull.Contain(2.5, 1.0));
+  BOOST_TEST(!hull.Contain(-0.1, 1.0));
+  BOOST_TEST(!hull.Contain(1.0, 2.1));
+
+  // collinear points: a hull of two vertices and no area
+  std::vector<double> const ls{1.0, 3.0, 2.0, 0.0, 3.0};
+  std::vector<double> const lt{2.0, 6.0, 4.0, 0.0, 6.0};
+  hull.Build(ls.size(), ls.data(), lt.data());
+  BOOST_TEST_REQUIRE(hull.size() == 2U);
+  BOOST_TEST(hull.Indices()[0] == 3U);
+  BOOST_TEST(hull.Area() == 0.0);
+  BOOST_TEST(hull.Perimeter() == 2.0 * std::sqrt(45.0), boost::test_tools::tolerance(1e-12));
+  BOOST_TEST(hull.Contain(1.5, 3.0));
+  BOOST_TEST(!hull.Contain(1.5, 3.1));
+  BOOST_TEST(!hull.Contain(4.0, 8.0));
+
+  // the same point repeated, then no point
+  std::vector<double> const same(5U, 1.5);
+  hull.Build(same.size(), same.data(), same.data());
+  BOOST_TEST(hull.size() == 1U);
+  BOOST_TEST(hull.Contain(1.5, 1.5));
+  BOOST_TEST(!hull.Contain(1.5, 1.6));
+  hull.Build(0U, nullptr, nullptr);
+  BOOST_TEST(hull.empty());
+  BOOST_TEST(!hull.Contain(0.0, 0.0));
+
+  // random points, with a scratch reused: all are in the hull, on the left of all edges
+  std::mt19937 engine{20261014U};
+  std::normal_distribution<double> gaus{0.0, 10.0};
+  geoalgo::ConvexHullScratch scratch;
+  for (std::size_t n : {3U, 20U, 500U}) {
+    std::vector<double> rs, rt;
+    for (std::size_t i = 0; i < n; ++i) {
+      rs.push_back(gaus(engine));
+      rt.push_back(gaus(engine));
+    }
+    hull.Build(n, rs.data(), rt.data(), 1U, &scratch);
+    BOOST_TEST_REQUIRE(hull.size() >= 3U);
+    BOOST_TEST(hull.Area() > 0.0);
+    for (std::size_t i = 0; i < n; ++i) {
+      BOOST_TEST(hull.Contain(rs[i], rt[i]));
+      for (std::size_t a = 0, b = hull.size() - 1; a < hull.size(); b = a++)
+        BOOST_TEST(cross(hull.S(b), hull.T(b), hull.S(a), hull.T(a), rs[i], rt[i]) >= -1e-9);
+    }
+  }
+
+  // projection of 3D points on two axes
+  std::vector<geoalgo::Point_t> const pts{
+    {0.0, 5.0, 0.0}, {1.0, -5.0, 0.0}, {1.0, 3.0, 1.0}, {0.0, 0.0, 1.0}, {0.5, 9.0, 0.5}};
+  hull.Build(pts, geoalgo::Vector_t{1.0, 0.0, 0.0}, geoalgo::Vector_t{0.0, 0.0, 1.0});
+  BOOST_TEST(hull.size() == 4U);
+  BOOST_TEST(hull.Area() == 1.0);
+  BOOST_TEST(hull.Contain(geoalgo::Point_t{0.5, 100.0, 0.5}));
+  BOOST_TEST(!hull.Contain(geoalgo::Point_t{1.5, 0.0, 0.5}));
+
+} // BOOST_AUTO_TEST_CASE(ConvexHull2DTestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(ConvexHull3DTestCase)
+{
+  // a unit cube, with points inside, on faces and edges, and repeated corners
+  std::vector<geoalgo::Point_t> pts;
+  for (int i = 0; i < 8; ++i)
+    pts.push_back({double(i & 1), double((i >> 1) & 1), double((i >> 2) & 1)});
+  pts.push_back({0.5, 0.5, 0.5});
+  pts.push_back({0.5, 0.5, 1.0});
+  pts.push_back({1.0, 0.5, 1.0});
+  pts.push_back({0.0, 0.0, 0.0});
+  pts.push_back({1.0, 1.0, 1.0});
+
+  geoalgo::ConvexHull3D hull;
+  hull.Build(pts);
+  BOOST_TEST(!hull.IsFlat());
+  BOOST_TEST(hull.Vertices().size() == 8U);
+  BOOST_TEST(hull.Faces().size() == 12U);
+  BOOST_TEST(hull.Normals().size() == hull.Faces().size());
+  BOOST_TEST(hull.Volume() == 1.0, boost::test_tools::tolerance(1e-12));
+  BOOST_TEST(hull.Area() == 6.0, boost::test_tools::tolerance(1e-12));
+  for (auto const& pt : pts)
+    BOOST_TEST(hull.Contain(pt));
+  BOOST_TEST(!hull.Contain(geoalgo::Point_t{0.5, 0.5, 1.01}));
+  BOOST_TEST(!hull.Contain(geoalgo::Point_t{-0.01, 0.5, 0.5}));
+  for (std::size_t i = 1; i < hull.Indices().size(); ++i)
+    BOOST_TEST(hull.Indices()[i - 1] < hull.Indices()[i]);
+
+  // random points: all in the hull, and all the vertices are input points (up to
+  // the rounding of the shift to the center, which the construction works with)
+  std::mt19937 engine{20261014U};
+  std::normal_distribution<double> gaus{0.0, 10.0};
+  geoalgo::ConvexHullScratch scratch;
+  for (std::size_t n : {4U, 50U, 2000U}) {
+    std::vector<geoalgo::Point_t> rpts;
+    for (std::size_t i = 0; i < n; ++i)
+      rpts.push_back({gaus(engine), gaus(engine), gaus(engine)});
+    hull.Build(rpts, &scratch);
+    BOOST_TEST_REQUIRE(!hull.IsFlat());
+    BOOST_TEST(hull.Volume() > 0.0);
+    for (auto const& pt : rpts)
+      BOOST_TEST(hull.Contain(pt));
+    for (std::size_t i = 0; i < hull.Indices().size(); ++i)
+      BOOST_TEST(hull.Vertices()[i].Dist(rpts[hull.Indices()[i]]) <= hull.Tolerance());
+    // each face has all the points on its inner side
+    for (std::size_t f = 0; f < hull.Faces().size(); ++f) {
+      auto const& a = hull.Vertices()[hull.Faces()[f][0]];
+      for (auto const& pt : rpts)
+        BOOST_TEST((pt - a) * hull.Normals()[f] <= hull.Tolerance());
+    }
+    // a point a bit out of the farthest vertex is out
+    geoalgo::Point_t far = hull.Vertices()[0];
+    for (auto const& v : hull.Vertices())
+      if (v.SqLength() > far.SqLength()) far = v;
+    BOOST_TEST(!hull.Contain(far * 1.01));
+  }
+
+} // BOOST_AUTO_TEST_CASE(ConvexHull3DTestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(FlatConvexHull3DTestCase)
+{
+  // coplanar points on a tilted plane: a square with points inside, on its
+  // edges and repeated
+  geoalgo::Point_t const origin{1.0, 2.0, 3.0};
+  geoalgo::Vector_t const u = geoalgo::Vector_t{1.0, 1.0, 0.0}.Dir();
+  geoalgo::Vector_t const v = geoalgo::Vector_t{-1.0, 1.0, 1.0}.Dir();
+  auto const onPlane = [&](double a, double b) -> geoalgo::Point_t {
+    return origin + u * a + v * b;
+  };
+  std::vector<geoalgo::Point_t> const pts{onPlane(0.0, 0.0),
+                                          onPlane(2.0, 0.0),
+                                          onPlane(2.0, 2.0),
+                                          onPlane(0.0, 2.0),
+                                          onPlane(1.0, 1.0),
+                                          onPlane(1.0, 0.0),
+                                          onPlane(0.5, 1.5),
+                                          onPlane(2.0, 2.0),
+                                          onPlane(0.0, 0.0)};
+
+  geoalgo::ConvexHull3D hull;
+  hull.Build(pts);
+  BOOST_TEST(hull.IsFlat());
+  BOOST_TEST(hull.Volume() == 0.0);
+  BOOST_TEST_REQUIRE(hull.Vertices().size() == 4U);
+  BOOST_TEST_REQUIRE(hull.Polygon().size() == 4U);
+  BOOST_TEST_REQUIRE(hull.Normals().size() == 1U);
+  geoalgo::Vector_t const normal = u.Cross(v).Dir();
+  BOOST_TEST(std::abs(hull.Normals()[0] * normal) == 1.0, boost::test_tools::tolerance(1e-12));
+  // the polygon goes around the normal counterclockwise
+  auto const& poly = hull.Polygon();
+  for (std::size_t i = 0; i < poly.size(); ++i) {
+    auto const& a = hull.Vertices()[poly[i]];
+    auto const& b = hull.Vertices()[poly[(i + 1) % poly.size()]];
+    auto const& c = hull.Vertices()[poly[(i + 2) % poly.size()]];
+    BOOST_TEST((b - a).Cross(c - b) * hull.Normals()[0] > 0.0);
+  }
+  // the input points and the vertices are contained, points off the plane or
+  // off the polygon are not
+  for (auto const& pt : pts)
+    BOOST_TEST(hull.Contain(pt));
+  for (auto const& pt : hull.Vertices())
+    BOOST_TEST(hull.Contain(pt));
+  BOOST_TEST(hull.Contain(onPlane(1.9, 0.1)));
+  BOOST_TEST(!hull.Contain(onPlane(1.0, 1.0) + normal * 0.01));
+  BOOST_TEST(!hull.Contain(onPlane(2.1, 1.0)));
+  BOOST_TEST(!hull.Contain(onPlane(1.0, -0.1)));
+
+  // three points are always flat
+  hull.Build(std::vector<geoalgo::Point_t>{pts[0], pts[1], pts[3]});
+  BOOST_TEST(hull.IsFlat());
+  BOOST_TEST(hull.Vertices().size() == 3U);
+  BOOST_TEST(hull.Contain(onPlane(0.5, 0.5)));
+  BOOST_TEST(!hull.Contain(onPlane(1.5, 1.5)));
+
+  // collinear points: the two ends
+  std::vector<geoalgo::Point_t> const line{
+    onPlane(1.0, 0.0), onPlane(3.0, 0.0), onPlane(0.0, 0.0), onPlane(2.0, 0.0), onPlane(3.0, 0.0)};
+  hull.Build(line);
+  BOOST_TEST(hull.IsFlat());
+  BOOST_TEST_REQUIRE(hull.Indices().size() == 2U);
+  BOOST_TEST(hull.Indices()[0] == 1U);
+  BOOST_TEST(hull.Indices()[1] == 2U);
+  BOOST_TEST(hull.Normals().empty());
+  for (auto const& pt : line)
+    BOOST_TEST(hull.Contain(pt));
+  BOOST_TEST(hull.Contain(onPlane(2.5, 0.0)));
+  BOOST_TEST(!hull.Contain(onPlane(2.5, 0.01)));
+  BOOST_TEST(!hull.Contain(onPlane(3.1, 0.0)));
+
+  // the same point repeated
+  hull.Build(std::vector<geoalgo::Point_t>(4U, origin));
+  BOOST_TEST(hull.IsFlat());
+  BOOST_TEST(hull.Vertices().size() == 1U);
+  BOOST_TEST(hull.Contain(origin));
+  BOOST_TEST(!hull.Contain(origin + u * 0.01));
+
+  // no point
+  hull.Build(std::vector<geoalgo::Point_t>{});
+  BOOST_TEST(hull.Vertices().empty());
+  BOOST_TEST(!hull.Contain(origin));
+
+} // BOOST_AUTO_TEST_CASE(FlatConvexHull3DTestCase)
@@ -0,0 +1,317 @@
+/**
+ * @file   GeoObjBVH_test.cc
+ * @brief  Test of the queries of `geoalgo::GeoObjBVH`.
+ * @date   October 14, 2026
+ * @see    `larcorealg/GeoAlgo/GeoObjBVH.h`
+ *
+ * The results of the queries on random objects are compared with the ones of
+ * a loop on all the objects with `geoalgo::GeoAlgo`.
+ */
+
+// LArSoft libraries
+#include "larcorealg/GeoAlgo/GeoAABox.h"
+#include "larcorealg/GeoAlgo/GeoAlgo.h"
+#include "larcorealg/GeoAlgo/GeoAlgoException.h"
+#include "larcorealg/GeoAlgo/GeoHalfLine.h"
+#include "larcorealg/GeoAlgo/GeoLineSegment.h"
+#include "larcorealg/GeoAlgo/GeoObjBVH.h"
+#include "larcorealg/GeoAlgo/GeoObjCollection.h"
+#include "larcorealg/GeoAlgo/GeoSphere.h"
+#include "larcorealg/GeoAlgo/GeoTrajectory.h"
+
+// Boost libraries
+#define BOOST_TEST_MODULE (GeoObjBVH_test)
+#include <boost/test/unit_test.hpp>
+
+// C/C++ standard libraries
+#include <algorithm> // std::min(), std::sort()
+#include <cmath>     // std::sqrt()
+#include <cstddef>   // std::size_t
+#include <random>
+#include <utility> // std::pair
+#include <vector>
+
+//------------------------------------------------------------------------------
+namespace {
+
+  using ObjKey_t = std::size_t; ///< Type and index of an object (see `key()`).
+
+  ObjKey_t key(int type, std::size_t index)
+  {
+    return type * 1000U + index;
+  }
+
+  /// Random objects, and the brute force versions of the queries.
+  struct Scene {
+    std::mt19937 engine{20261014U};
+    std::uniform_real_distribution<double> coord{0.0, 100.0};
+    std::uniform_real_distribution<double> step{-5.0, 5.0};
+
+    std::vector<geoalgo::Point_t> points;
+    std::vector<geoalgo::LineSegment> segments;
+    std::vector<geoalgo::Trajectory> trajectories;
+    std::vector<geoalgo::AABox> boxes;
+    std::vector<geoalgo::Sphere> spheres;
+
+    geoalgo::GeoAlgo algo;
+
+    geoalgo::Point_t randomPoint() { return {coord(engine), coord(engine), coord(engine)}; }
+    geoalgo::Point_t randomStep() { return {step(engine), step(engine), step(engine)}; }
+
+    Scene()
+    {
+      for (std::size_t i = 0; i < 50U; ++i)
+        points.push_back(randomPoint());
+      for (std::size_t i = 0; i < 30U; ++i) {
+        geoalgo::Point_t const start = randomPoint();
+        segments.emplace_back(start, start + randomStep() * 2.0);
+      }
+      for (std::size_t i = 0; i < 6U; ++i) {
+        geoalgo::Trajectory trj;
+        trj.push_back(randomPoint());
+        for (std::size_t j = 1; j < 12U; ++j)
+          trj.push_back(trj.back() + randomStep());
+        trajectories.push_back(trj);
+      }
+      for (std::size_t i = 0; i < 10U; ++i) {
+        geoalgo::Point_t const corner = randomPoint();
+        geoalgo::Point_t const size{1.0 + 0.5 * i, 2.0, 8.0 - 0.5 * i};
+        boxes.emplace_back(corner, corner + size);
+      }
+      for (std::size_t i = 0; i < 10U; ++i)
+        spheres.emplace_back(randomPoint(), 1.0 + 0.3 * i);
+    } // Scene()
+
+    void fill(geoalgo::GeoObjBVH& bvh) const
+    {
+      for (auto const& pt : points)
+        bvh.Add(pt);
+      for (auto const& seg : segments)
+        bvh.Add(seg);
+      for (auto const& trj : trajectories)
+        bvh.Add(trj);
+      for (auto const& box : boxes)
+        bvh.Add(box);
+      for (auto const& sphere : spheres)
+        bvh.Add(sphere);
+      bvh.Build();
+    } // fill()
+
+    /// Squared distances of `pt` from all the objects, with their keys.
+    std::vector<std::pair<double, ObjKey_t>> sqDistances(geoalgo::Point_t const& pt) const
+    {
+      std::vector<std::pair<double, ObjKey_t>> dists;
+      for (std::size_t i = 0; i < points.size(); ++i)
+        dists.push_back({pt.SqDist(points[i]), key(geoalgo::GeoObjBVH::kPoint, i)});
+      for (std::size_t i = 0; i < segments.size(); ++i)
+        dists.push_back(
+          {algo.SqDist(pt, segments[i]), key(geoalgo::GeoObjBVH::kLineSegment, i)});
+      for (std::size_t i = 0; i < trajectories.size(); ++i)
+        dists.push_back(
+          {algo.SqDist(pt, trajectories[i]), key(geoalgo::GeoObjBVH::kTrajectory, i)});
+      for (std::size_t i = 0; i < boxes.size(); ++i)
+        dists.push_back({algo.SqDist(pt, boxes[i]), key(geoalgo::GeoObjBVH::kAABox, i)});
+      for (std::size_t i = 0; i < spheres.size(); ++i) {
+        double const d = pt.Dist(spheres[i].Center()) - spheres[i].Radius();
+        dists.push_back({d * d, key(geoalgo::GeoObjBVH::kSphere, i)});
+      }
+      return dists;
+    } // sqDistances()
+
+    /// Smallest distance along `ray` of a hit (`kINVALID_DOUBLE` if none).
+    double firstHit(geoalgo::HalfLine const& ray, double radius, double maxLength) const
+    {
+      double best = geoalgo::kINVALID_DOUBLE;
+      auto const update = [&best, maxLength](double t) {
+        if ((t <= maxLength) && (t < best)) best = t;
+      };
+      auto const along = [&ray](geoalgo::Point_t const& pt) {
+        return (pt - ray.Start()) * ray.Dir();
+      };
+      double const sqRadius = radius * radius;
+      for (auto const& pt : points)
+        if (algo.SqDist(pt, ray) <= sqRadius) update(along(algo.ClosestPt(pt, ray)));
+      geoalgo::Point_t c1(3), c2(3);
+      auto const segmentHit = [&](geoalgo::LineSegment const& seg) {
+        if (algo.SqDist(ray, seg, c1, c2) <= sqRadius) update(along(c1));
+      };
+      for (auto const& seg : segments)
+        segmentHit(seg);
+      for (auto const& trj : trajectories)
+        for (std::size_t j = 0; j + 1 < trj.size(); ++j)
+          segmentHit(geoalgo::LineSegment{trj[j], trj[j + 1]});
+      for (auto const& box : boxes)
+        for (auto const& pt : algo.Intersection(box, ray))
+          update(along(pt));
+      for (auto const& sphere : spheres) {
+        // closest approach of the center to the line, then the crossings
+        double const tc = along(sphere.Center());
+        double const sqH = ray.Start().SqDist(sphere.Center()) - tc * tc;
+        double const sqR = sphere.Radius() * sphere.Radius();
+        if (sqH > sqR) continue;
+        double const half = std::sqrt(sqR - sqH);
+        if (tc - half >= 0.0)
+          update(tc - half);
+        else if (tc + half >= 0.0)
+          update(tc + half);
+      }
+      return best;
+    } // firstHit()
+
+  }; // Scene
+
+  ObjKey_t keyOf(geoalgo::GeoObjBVH::ObjID_t const& obj)
+  {
+    return key(obj.type, obj.index);
+  }
+
+} // local namespace
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(NearestTestCase)
+{
+  Scene scene;
+  geoalgo::GeoObjBVH bvh;
+  scene.fill(bvh);
+  BOOST_TEST(bvh.IsBuilt());
+  BOOST_TEST(bvh.size() == 50U + 30U + 6U * 11U + 10U + 10U);
+
+  std::vector<geoalgo::Point_t> queries;
+  for (std::size_t i = 0; i < 200U; ++i)
+    queries.push_back(scene.randomPoint());
+
+  for (auto const& pt : queries) {
+    auto const dists = scene.sqDistances(pt);
+    auto const best = *std::min_element(dists.begin(), dists.end());
+
+    auto const hit = bvh.Nearest(pt);
+    BOOST_TEST_REQUIRE(hit.obj.IsValid());
+    BOOST_TEST(hit.sqDist == best.first, boost::test_tools::tolerance(1e-9));
+    BOOST_TEST(pt.SqDist(hit.pt) == hit.sqDist, boost::test_tools::tolerance(1e-6));
+
+    // a distance limit smaller than the nearest object leaves no hit
+    double const dist = std::sqrt(best.first);
+    BOOST_TEST(!bvh.Nearest(pt, 0.99 * dist).obj.IsValid());
+    BOOST_TEST(bvh.Nearest(pt, 1.01 * dist).obj.IsValid());
+  }
+
+  // the batch starting from the previous result gives the same distances
+  std::vector<geoalgo::Point_t> track{scene.randomPoint()};
+  for (std::size_t i = 1; i < 100U; ++i)
+    track.push_back(track.back() + scene.randomStep() * 0.2);
+  for (auto const& points : {queries, track}) {
+    auto const hits = bvh.Nearest(points);
+    BOOST_TEST_REQUIRE(hits.size() == points.size());
+    for (std::size_t i = 0; i < points.size(); ++i) {
+      auto const hit = bvh.Nearest(points[i]);
+      BOOST_TEST(hits[i].sqDist == hit.sqDist, boost::test_tools::tolerance(1e-9));
+    }
+  }
+
+} // BOOST_AUTO_TEST_CASE(NearestTestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(WithinRadiusTestCase)
+{
+  Scene scene;
+  geoalgo::GeoObjBVH bvh;
+  scene.fill(bvh);
+
+  double const radius = 12.0;
+  std::vector<geoalgo::Point_t> queries;
+  for (std::size_t i = 0; i < 100U; ++i)
+    queries.push_back(scene.randomPoint());
+
+  auto const allHits = bvh.WithinRadius(queries, radius);
+  BOOST_TEST_REQUIRE(allHits.size() == queries.size());
+  std::size_t nFound = 0U;
+  for (std::size_t i = 0; i < queries.size(); ++i) {
+    std::vector<ObjKey_t> expected;
+    for (auto const& [sqDist, key] : scene.sqDistances(queries[i]))
+      if (sqDist <= radius * radius) expected.push_back(key);
+    std::sort(expected.begin(), expected.end());
+
+    auto const hits = bvh.WithinRadius(queries[i], radius);
+    std::vector<ObjKey_t> found;
+    for (std::size_t j = 0; j < hits.size(); ++j) {
+      found.push_back(keyOf(hits[j].obj));
+      if (j > 0) BOOST_TEST(hits[j - 1].sqDist <= hits[j].sqDist); // sorted
+    }
+    std::sort(found.begin(), found.end());
+    BOOST_CHECK_EQUAL_COLLECTIONS(found.begin(), found.end(), expected.begin(), expected.end());
+    nFound += found.size();
+
+    BOOST_TEST(allHits[i].size() == hits.size());
+  }
+  BOOST_TEST(nFound > 0U);
+
+  BOOST_TEST(bvh.WithinRadius(queries.front(), -1.0).empty());
+
+} // BOOST_AUTO_TEST_CASE(WithinRadiusTestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(RayCastTestCase)
+{
+  Scene scene;
+  geoalgo::GeoObjBVH bvh;
+  scene.fill(bvh);
+
+  std::vector<geoalgo::HalfLine> rays;
+  for (std::size_t i = 0; i < 200U; ++i) {
+    geoalgo::Point_t const start = scene.randomPoint();
+    rays.emplace_back(start, scene.randomPoint() - start);
+  }
+
+  for (double const radius : {0.0, 1.5}) {
+    for (double const maxLength : {geoalgo::kINVALID_DOUBLE, 30.0}) {
+      auto const hits = bvh.RayCast(rays, radius, maxLength);
+      BOOST_TEST_REQUIRE(hits.size() == rays.size());
+      std::size_t nHits = 0U;
+      for (std::size_t i = 0; i < rays.size(); ++i) {
+        double const expected = scene.firstHit(rays[i], radius, maxLength);
+        auto const hit = bvh.RayCast(rays[i], radius, maxLength);
+        BOOST_TEST(hit.obj.IsValid() == (expected != geoalgo::kINVALID_DOUBLE));
+        if (!hit.obj.IsValid()) continue;
+        ++nHits;
+        BOOST_TEST(hit.t == expected, boost::test_tools::tolerance(1e-9));
+        BOOST_TEST(hit.pt.SqDist(rays[i].Start() + rays[i].Dir() * hit.t) < 1e-12);
+        BOOST_TEST(hits[i].t == hit.t);
+      }
+      BOOST_TEST(nHits > 0U);
+    }
+  }
+
+} // BOOST_AUTO_TEST_CASE(RayCastTestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(CollectionTestCase)
+{
+  Scene scene;
+  geoalgo::GeoObjCollection coll;
+  for (auto const& pt : scene.points)
+    coll.Add(pt);
+  for (auto const& trj : scene.trajectories)
+    coll.Add(trj);
+  for (auto const& sphere : scene.spheres)
+    coll.Add(sphere);
+
+  geoalgo::GeoObjBVH const bvh{coll};
+  BOOST_TEST(bvh.IsBuilt());
+  BOOST_TEST(bvh.Point().size() == scene.points.size());
+  BOOST_TEST(bvh.Trajectory().size() == scene.trajectories.size());
+  BOOST_TEST(bvh.Sphere().size() == scene.spheres.size());
+
+  geoalgo::Point_t const pt = scene.points[7];
+  auto const hit = bvh.Nearest(pt);
+  BOOST_TEST(hit.obj.type == geoalgo::GeoObjBVH::kPoint);
+  BOOST_TEST(hit.obj.index == 7U);
+  BOOST_TEST(hit.sqDist == 0.0);
+
+  // objects added after the construction require a new Build()
+  geoalgo::GeoObjBVH empty;
+  BOOST_TEST(!empty.Nearest(pt).obj.IsValid());
+  empty.Add(pt);
+  BOOST_TEST(!empty.IsBuilt());
+  BOOST_CHECK_THROW(empty.Nearest(pt), geoalgo::GeoAlgoException);
+
+} // BOOST_AUTO_TEST_CASE(CollectionTestCase)
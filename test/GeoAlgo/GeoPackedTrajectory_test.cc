@@ -0,0 +1,149 @@
+/**
+ * @file   GeoPackedTrajectory_test.cc
+ * @brief  Test of `geoalgo::PackedTrajectory` against the `geoalgo::Trajectory` it packs.
+ * @date   October 14, 2026
+ * @see    `larcorealg/GeoAlgo/GeoPackedTrajectory.h`
+ *
+ * The points, lengths and directions cached by the packed trajectory, and the
+ * distances computed on it, are compared with the ones of the trajectory.
+ */
+
+// LArSoft libraries
+#include "larcorealg/GeoAlgo/GeoAlgo.h"
+#include "larcorealg/GeoAlgo/GeoAlgoException.h"
+#include "larcorealg/GeoAlgo/GeoPackedTrajectory.h"
+#include "larcorealg/GeoAlgo/GeoTrajectory.h"
+
+// Boost libraries
+#define BOOST_TEST_MODULE (GeoPackedTrajectory_test)
+#include <boost/test/unit_test.hpp>
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <random>
+#include <vector>
+
+//------------------------------------------------------------------------------
+namespace {
+
+  /// Checks that `packed` has the points, lengths and directions of `trj`.
+  void checkPacked(geoalgo::Trajectory_t const& trj, geoalgo::PackedTrajectory_t const& packed)
+  {
+    BOOST_TEST_REQUIRE(packed.size() == trj.size());
+    BOOST_TEST(packed.empty() == trj.empty());
+    BOOST_TEST_REQUIRE(packed.Points().size() == trj.size());
+    for (std::size_t i = 0; i < trj.size(); ++i) {
+      BOOST_TEST(packed[i] == trj[i]);
+      BOOST_TEST(packed.Points()[i] == trj[i]);
+    }
+    if (trj.size() < 2) return;
+
+    BOOST_TEST(packed.Length() == trj.Length(), boost::test_tools::tolerance(1e-12));
+    BOOST_TEST(packed.PathLength(0) == 0.0);
+    for (std::size_t i = 0; i + 1 < trj.size(); ++i) {
+      BOOST_TEST((packed.Dir(i) == trj.Dir(i)));
+      double const length = trj[i].Dist(trj[i + 1]);
+      BOOST_TEST(packed.SegmentLength(i) == length);
+      BOOST_TEST(packed.PathLength(i + 1) == trj.Length(0, i + 1),
+                 boost::test_tools::tolerance(1e-12));
+      BOOST_TEST(packed.Length(i, i + 1) == length, boost::test_tools::tolerance(1e-12));
+      if (length > 0.0) {
+        BOOST_TEST((packed.UnitDir(i) * length - trj.Dir(i)).Length() <= 1e-12 * length);
+      }
+      else {
+        BOOST_TEST(packed.UnitDir(i).Length() == 0.0);
+      }
+    }
+    if (trj.size() > 2)
+      BOOST_TEST(packed.Length(1) == trj.Length(1), boost::test_tools::tolerance(1e-12));
+  } // checkPacked()
+
+} // local namespace
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(RoundTripTestCase)
+{
+  std::mt19937 engine{20261014U};
+  std::uniform_real_distribution<double> coord{-10.0, 10.0};
+
+  geoalgo::Trajectory_t trj;
+  for (std::size_t i = 0; i < 50U; ++i)
+    trj.push_back(geoalgo::Point_t{coord(engine), coord(engine), coord(engine)});
+  trj.push_back(trj.back()); // a segment with no length
+  trj.push_back(geoalgo::Point_t{0.0, 0.0, 0.0});
+
+  geoalgo::PackedTrajectory_t const packed{trj};
+  checkPacked(trj, packed);
+
+  // the same query errors as the trajectory
+  BOOST_CHECK_THROW(packed.Length(5, 5), geoalgo::GeoAlgoException);
+  BOOST_CHECK_THROW(packed.Length(0, trj.size()), geoalgo::GeoAlgoException);
+  BOOST_CHECK_THROW(packed.Dir(trj.size() - 1), geoalgo::GeoAlgoException);
+  BOOST_CHECK_THROW(trj.Dir(trj.size() - 1), geoalgo::GeoAlgoException);
+
+  // queries by path length
+  BOOST_TEST(packed.SegmentAt(-1.0) == 0U);
+  BOOST_TEST(packed.SegmentAt(packed.Length() + 1.0) == trj.size() - 2);
+  BOOST_TEST((packed.PointAt(-1.0) == trj.front()));
+  BOOST_TEST((packed.PointAt(packed.Length() + 1.0) == trj.back()));
+  for (std::size_t i = 0; i + 1 < trj.size(); ++i) {
+    if (packed.SegmentLength(i) == 0.0) continue;
+    double const middle = packed.PathLength(i) + 0.5 * packed.SegmentLength(i);
+    BOOST_TEST(packed.SegmentAt(middle) == i);
+    geoalgo::Point_t const expected = (trj[i] + trj[i + 1]) / 2.0;
+    BOOST_TEST(packed.PointAt(middle).Dist(expected) <= 1e-9);
+  }
+
+  // distances and closest points as the unpacked trajectory
+  geoalgo::GeoAlgo const algo;
+  std::uniform_real_distribution<double> far{-20.0, 20.0};
+  for (std::size_t i = 0; i < 200U; ++i) {
+    geoalgo::Point_t const pt{far(engine), far(engine), far(engine)};
+    double const expected = algo.SqDist(pt, trj);
+    BOOST_TEST(algo.SqDist(pt, packed) == expected, boost::test_tools::tolerance(1e-9));
+    BOOST_TEST(algo.SqDist(packed, pt) == expected, boost::test_tools::tolerance(1e-9));
+
+    int idx = -1, packedIdx = -1;
+    geoalgo::Point_t const closest = algo.ClosestPt(pt, trj, idx);
+    geoalgo::Point_t const packedClosest = algo.ClosestPt(pt, packed, packedIdx);
+    BOOST_TEST(packedIdx == idx);
+    BOOST_TEST(packedClosest.Dist(closest) <= 1e-9);
+    BOOST_TEST(algo.ClosestPt(packed, pt).Dist(closest) <= 1e-9);
+  }
+
+} // BOOST_AUTO_TEST_CASE(RoundTripTestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(ShortTrajectoryTestCase)
+{
+  geoalgo::GeoAlgo const algo;
+  geoalgo::Point_t const pt{1.0, 2.0, 2.0};
+
+  // no point
+  geoalgo::PackedTrajectory_t const empty;
+  BOOST_TEST(empty.empty());
+  checkPacked(geoalgo::Trajectory_t{}, geoalgo::PackedTrajectory_t{geoalgo::Trajectory_t{}});
+  BOOST_CHECK_THROW(empty.PointAt(0.0), geoalgo::GeoAlgoException);
+  BOOST_CHECK_THROW(empty.SegmentAt(0.0), geoalgo::GeoAlgoException);
+
+  // one point: distances to it (the trajectory has no segment to measure from)
+  geoalgo::Trajectory_t single;
+  single.push_back(geoalgo::Point_t{0.0, 0.0, 0.0});
+  geoalgo::PackedTrajectory_t const packedSingle{single};
+  checkPacked(single, packedSingle);
+  BOOST_CHECK_THROW(packedSingle.Dir(), geoalgo::GeoAlgoException);
+  BOOST_CHECK_THROW(packedSingle.SegmentAt(0.0), geoalgo::GeoAlgoException);
+  BOOST_TEST((packedSingle.PointAt(3.0) == single[0]));
+  BOOST_TEST(algo.SqDist(pt, packedSingle) == 9.0);
+
+  // one segment
+  geoalgo::Trajectory_t segment{single};
+  segment.push_back(geoalgo::Point_t{4.0, 0.0, 0.0});
+  geoalgo::PackedTrajectory_t const packedSegment{segment};
+  checkPacked(segment, packedSegment);
+  BOOST_TEST(packedSegment.Length() == 4.0);
+  BOOST_TEST(algo.SqDist(pt, packedSegment) == algo.SqDist(pt, segment));
+  BOOST_TEST(algo.SqDist(pt, packedSegment) == 8.0);
+  BOOST_TEST(algo.ClosestPt(pt, packedSegment).Dist(geoalgo::Point_t{1.0, 0.0, 0.0}) <= 1e-12);
+
+} // BOOST_AUTO_TEST_CASE(ShortTrajectoryTestCase)
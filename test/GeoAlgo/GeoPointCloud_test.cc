@@ -0,0 +1,231 @@
+/**
+ * @file   GeoPointCloud_test.cc
+ * @brief  Test of the neighbor searches of `geoalgo::PointCloud`.
+ * @date   October 14, 2026
+ * @see    `larcorealg/GeoAlgo/GeoPointCloud.h`
+ *
+ * The results of the k-d tree queries are compared with the ones of a loop on
+ * all the points.
+ */
+
+// LArSoft libraries
+#include "larcorealg/CoreUtils/Executor.h"
+#include "larcorealg/GeoAlgo/GeoPointCloud.h"
+#include "larcorealg/GeoAlgo/GeoVector.h"
+
+// Boost libraries
+#define BOOST_TEST_MODULE (GeoPointCloud_test)
+#include <boost/test/unit_test.hpp>
+
+// C/C++ standard libraries
+#include <algorithm> // std::sort(), std::min()
+#include <cstddef>   // std::size_t
+#include <random>
+#include <utility> // std::pair
+#include <vector>
+
+//------------------------------------------------------------------------------
+namespace {
+
+  using Neighbor_t = geoalgo::PointCloud::Neighbor_t;
+
+  /// All the points within `radius` from `pt`, by distance then by index.
+  std::vector<std::pair<double, std::size_t>> bruteNeighbors(
+    std::vector<geoalgo::Point_t> const& points,
+    geoalgo::Point_t const& pt,
+    double radius = geoalgo::kMAX_DOUBLE)
+  {
+    std::vector<std::pair<double, std::size_t>> found;
+    for (std::size_t i = 0; i < points.size(); ++i) {
+      double const sqDist = pt.SqDist(points[i]);
+      if (sqDist <= radius * radius) found.emplace_back(sqDist, i);
+    }
+    std::sort(found.begin(), found.end());
+    return found;
+  } // bruteNeighbors()
+
+  /// Indices of the `neighbors`, sorted.
+  std::vector<std::size_t> sortedIndices(std::vector<Neighbor_t> const& neighbors)
+  {
+    std::vector<std::size_t> indices;
+    for (Neighbor_t const& n : neighbors)
+      indices.push_back(n.index);
+    std::sort(indices.begin(), indices.end());
+    return indices;
+  }
+
+  /// Checks all the queries of a cloud of `points` from the `queries` points.
+  void checkQueries(std::vector<geoalgo::Point_t> const& points,
+                    std::vector<geoalgo::Point_t> const& queries,
+                    double radius)
+  {
+    geoalgo::PointCloud const cloud{points};
+    BOOST_TEST(cloud.size() == points.size());
+    BOOST_TEST(cloud.empty() == points.empty());
+    for (std::size_t i = 0; i < points.size(); ++i)
+      BOOST_TEST(cloud.Point(i) == points[i]);
+
+    for (geoalgo::Point_t const& pt : queries) {
+      auto const all = bruteNeighbors(points, pt);
+      auto const within = bruteNeighbors(points, pt, radius);
+
+      // within radius: the same points, sorted by distance and index if asked
+      std::vector<std::size_t> expectedSorted;
+      for (auto const& [sqDist, index] : within)
+        expectedSorted.push_back(index);
+      std::sort(expectedSorted.begin(), expectedSorted.end());
+
+      auto const found = cloud.WithinRadius(pt, radius);
+      auto const foundIndices = sortedIndices(found);
+      BOOST_CHECK_EQUAL_COLLECTIONS(
+        foundIndices.begin(), foundIndices.end(), expectedSorted.begin(), expectedSorted.end());
+      for (Neighbor_t const& n : found)
+        BOOST_TEST(n.sqDist == pt.SqDist(points[n.index]));
+      auto const sorted = cloud.WithinRadius(pt, radius, true);
+      BOOST_TEST_REQUIRE(sorted.size() == within.size());
+      for (std::size_t j = 0; j < sorted.size(); ++j) {
+        BOOST_TEST(sorted[j].index == within[j].second);
+        BOOST_TEST(sorted[j].sqDist == within[j].first);
+      }
+      BOOST_TEST(cloud.CountWithinRadius(pt, radius) == within.size());
+
+      // nearest: the first `k` by distance, with ties broken by the index
+      for (std::size_t const k : {std::size_t{1}, std::size_t{5}, points.size() + 3U}) {
+        auto const nearest = cloud.Nearest(pt, k);
+        BOOST_TEST_REQUIRE(nearest.size() == std::min(k, points.size()));
+        for (std::size_t j = 0; j < nearest.size(); ++j) {
+          BOOST_TEST(nearest[j].index == all[j].second);
+          BOOST_TEST(nearest[j].sqDist == all[j].first);
+        }
+        auto const limited = cloud.Nearest(pt, k, radius);
+        BOOST_TEST_REQUIRE(limited.size() == std::min(k, within.size()));
+        for (std::size_t j = 0; j < limited.size(); ++j)
+          BOOST_TEST(limited[j].index == within[j].second);
+      }
+    } // for queries
+
+    // pairs within the radius
+    std::vector<geoalgo::PointCloud::Pair_t> expectedPairs;
+    for (std::size_t i = 0; i < points.size(); ++i)
+      for (std::size_t j = i + 1; j < points.size(); ++j)
+        if (points[i].SqDist(points[j]) <= radius * radius) expectedPairs.emplace_back(i, j);
+    auto const pairs = cloud.PairsWithinRadius(radius);
+    BOOST_TEST_REQUIRE(pairs.size() == expectedPairs.size());
+    for (std::size_t i = 0; i < pairs.size(); ++i) {
+      BOOST_TEST(pairs[i].first == expectedPairs[i].first);
+      BOOST_TEST(pairs[i].second == expectedPairs[i].second);
+    }
+
+  } // checkQueries()
+
+} // local namespace
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(RandomCloudTestCase)
+{
+  std::mt19937 engine{20261014U};
+  std::uniform_real_distribution<double> coord{-50.0, 50.0};
+  auto randomPoint = [&]() -> geoalgo::Point_t {
+    return {coord(engine), coord(engine), coord(engine)};
+  };
+
+  std::vector<geoalgo::Point_t> points;
+  for (std::size_t i = 0; i < 500U; ++i)
+    points.push_back(randomPoint());
+  std::vector<geoalgo::Point_t> queries{points[3], points[250]};
+  for (std::size_t i = 0; i < 100U; ++i)
+    queries.push_back(randomPoint());
+
+  checkQueries(points, queries, 10.0);
+
+  // the batched queries, also with threads, match the single ones
+  geoalgo::PointCloud const cloud{points};
+  for (auto const& executor : {lar::util::Executor{}, lar::util::Executor::threads(3U)}) {
+    auto const within = cloud.WithinRadius(queries, 10.0, true, executor);
+    auto const counts = cloud.CountWithinRadius(queries, 10.0, executor);
+    auto const nearest = cloud.Nearest(queries, 4U, geoalgo::kINVALID_DOUBLE, executor);
+    BOOST_TEST_REQUIRE(within.size() == queries.size());
+    BOOST_TEST_REQUIRE(counts.size() == queries.size());
+    BOOST_TEST_REQUIRE(nearest.size() == queries.size());
+    for (std::size_t i = 0; i < queries.size(); ++i) {
+      auto const single = cloud.WithinRadius(queries[i], 10.0, true);
+      BOOST_TEST_REQUIRE(within[i].size() == single.size());
+      for (std::size_t j = 0; j < single.size(); ++j)
+        BOOST_TEST(within[i][j].index == single[j].index);
+      BOOST_TEST(counts[i] == single.size());
+      auto const singleNearest = cloud.Nearest(queries[i], 4U);
+      BOOST_TEST_REQUIRE(nearest[i].size() == singleNearest.size());
+      for (std::size_t j = 0; j < singleNearest.size(); ++j)
+        BOOST_TEST(nearest[i][j].index == singleNearest[j].index);
+    }
+    auto const pairs = cloud.PairsWithinRadius(10.0, executor);
+    BOOST_TEST((pairs == cloud.PairsWithinRadius(10.0)));
+  }
+
+  // the constructor from coordinate arrays indexes the same points
+  std::vector<double> xyz;
+  for (geoalgo::Point_t const& pt : points)
+    xyz.insert(xyz.end(), {pt[0], pt[1], pt[2]});
+  geoalgo::PointCloud const fromArray{points.size(), xyz.data()};
+  BOOST_TEST_REQUIRE(fromArray.size() == points.size());
+  BOOST_TEST(fromArray.Point(42U) == points[42U]);
+  BOOST_TEST(fromArray.CountWithinRadius(queries[5], 10.0) ==
+             cloud.CountWithinRadius(queries[5], 10.0));
+
+} // BOOST_AUTO_TEST_CASE(RandomCloudTestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(EmptyCloudTestCase)
+{
+  geoalgo::PointCloud const cloud;
+  BOOST_TEST(cloud.empty());
+  BOOST_TEST(cloud.size() == 0U);
+
+  geoalgo::Point_t const pt{1.0, 2.0, 3.0};
+  BOOST_TEST(cloud.WithinRadius(pt, 10.0).empty());
+  BOOST_TEST(cloud.CountWithinRadius(pt, 10.0) == 0U);
+  BOOST_TEST(cloud.Nearest(pt, 3U).empty());
+  BOOST_TEST(cloud.PairsWithinRadius(10.0).empty());
+
+  std::vector<geoalgo::Point_t> const queries{pt, pt};
+  auto const within = cloud.WithinRadius(queries, 10.0);
+  BOOST_TEST_REQUIRE(within.size() == 2U);
+  BOOST_TEST(within[0].empty());
+  auto const nearest = cloud.Nearest(queries, 3U);
+  BOOST_TEST_REQUIRE(nearest.size() == 2U);
+  BOOST_TEST(nearest[1].empty());
+
+  checkQueries({}, queries, 10.0);
+
+} // BOOST_AUTO_TEST_CASE(EmptyCloudTestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(DuplicatePointsTestCase)
+{
+  // many copies of a few points, more than fit in a leaf and all in one plane
+  std::vector<geoalgo::Point_t> points;
+  for (std::size_t i = 0; i < 40U; ++i) {
+    points.push_back({0.0, 0.0, 0.0});
+    points.push_back({1.0, 0.0, 0.0});
+    points.push_back({0.0, 2.0, 0.0});
+  }
+  std::vector<geoalgo::Point_t> const queries{
+    {0.0, 0.0, 0.0}, {0.4, 0.1, 0.0}, {0.5, 0.0, 0.0}, {3.0, 3.0, 3.0}};
+
+  checkQueries(points, queries, 1.0);
+
+  // all the copies of the same point are at distance 0, and found by index
+  geoalgo::PointCloud const cloud{points};
+  auto const nearest = cloud.Nearest(points[1], 5U);
+  BOOST_TEST_REQUIRE(nearest.size() == 5U);
+  for (std::size_t j = 0; j < nearest.size(); ++j) {
+    BOOST_TEST(nearest[j].index == 1U + 3U * j);
+    BOOST_TEST(nearest[j].sqDist == 0.0);
+  }
+  BOOST_TEST(cloud.CountWithinRadius(points[0], 0.0) == 40U);
+
+  // all the points in the same place
+  std::vector<geoalgo::Point_t> const same(20U, geoalgo::Point_t{5.0, 5.0, 5.0});
+  checkQueries(same, {{5.0, 5.0, 5.0}, {6.0, 5.0, 5.0}}, 0.5);
+
+} // BOOST_AUTO_TEST_CASE(DuplicatePointsTestCase)
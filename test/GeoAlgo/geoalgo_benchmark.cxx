@@ -0,0 +1,350 @@
+/**
+ * @file   geoalgo_benchmark.cxx
+ * @brief  Timing of the most used `geoalgo::GeoAlgo` queries.
+ * @see    `larcorealg/TestUtils/Benchmark.h`
+ *
+ * Usage:
+ *
+ *     geoalgo_benchmark [options]
+ *
+ * Each query is timed on random objects (with a fixed seed) in a box of the
+ * size of a large TPC, and the time and the number of heap allocations per
+ * query are printed. Queries on many elements (trajectories, point sets and
+ * batches) are reported per element.
+ * The options (`--json=FILE`, `--csv=FILE`, `--baseline=FILE`,
+ * `--tolerance=FRACTION`, `--warn-only`) are described in
+ * `testing::BenchmarkOptions_t`: the results can be written into files and
+ * compared with a baseline, in which case regressions make the program fail.
+ */
+
+// LArSoft libraries
+#include "larcorealg/GeoAlgo/GeoAABox.h"
+#include "larcorealg/GeoAlgo/GeoAlgo.h"
+#include "larcorealg/GeoAlgo/GeoConvexHull.h"
+#include "larcorealg/GeoAlgo/GeoHalfLine.h"
+#include "larcorealg/GeoAlgo/GeoLine.h"
+#include "larcorealg/GeoAlgo/GeoLineSegment.h"
+#include "larcorealg/GeoAlgo/GeoPointCloud.h"
+#include "larcorealg/GeoAlgo/GeoSphere.h"
+#include "larcorealg/GeoAlgo/GeoTrajectory.h"
+#include "larcorealg/GeoAlgo/GeoVector.h"
+#include "larcorealg/TestUtils/Benchmark.h"
+#include "larcorealg/TestUtils/CountAllocations.h"
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <iostream>
+#include <random>
+#include <vector>
+
+//------------------------------------------------------------------------------
+namespace {
+
+  /// Number of random inputs of each type; queries cycle through them.
+  constexpr std::size_t NInputs = 4096U;
+
+  /// Points in a trajectory.
+  constexpr std::size_t NTrajectoryPoints = 100U;
+
+  /// Points in the sets for bounding spheres.
+  constexpr std::size_t NSpherePoints = 20U;
+
+  /// Lines in the batched queries.
+  constexpr std::size_t NBatch = 256U;
+
+  /// Returns a cycling accessor to the elements of `inputs`.
+  template <typename T>
+  auto cycle(std::vector<T> const& inputs)
+  {
+    return [&inputs, i = std::size_t{0}]() mutable -> T const& {
+      if (i == inputs.size()) i = 0U;
+      return inputs[i++];
+    };
+  }
+
+} // local namespace
+
+//------------------------------------------------------------------------------
+int main(int argc, char const** argv)
+{
+  testing::BenchmarkOptions_t options;
+  for (int iArg = 1; iArg < argc; ++iArg) {
+    if (!options.parse(argv[iArg])) {
+      std::cerr << "Unsupported argument: '" << argv[iArg] << "'" << std::endl;
+      return 1;
+    }
+  }
+
+  //
+  // input generation
+  //
+  std::mt19937 engine{12345U};
+  std::uniform_real_distribution<double> coordX{-200.0, 200.0}, coordY{-200.0, 200.0},
+    coordZ{0.0, 1000.0}, direction{-1.0, 1.0};
+  auto const randomPoint = [&] {
+    return geoalgo::Point_t{coordX(engine), coordY(engine), coordZ(engine)};
+  };
+
+  geoalgo::AABox_t const box{-100.0, -100.0, 100.0, 100.0, 100.0, 900.0};
+
+  geoalgo::Sphere_t const sphere{geoalgo::Point_t{0.0, 0.0, 500.0}, 250.0};
+
+  std::vector<geoalgo::Point_t> points;
+  std::vector<geoalgo::Line_t> lines;
+  std::vector<geoalgo::HalfLine_t> halfLines;
+  std::vector<geoalgo::LineSegment_t> segments;
+  for (std::size_t i = 0; i < NInputs; ++i) {
+    points.push_back(randomPoint());
+    lines.emplace_back(randomPoint(), randomPoint());
+    halfLines.emplace_back(randomPoint(),
+                           geoalgo::Vector_t{direction(engine), direction(engine), direction(engine)});
+    segments.emplace_back(randomPoint(), randomPoint());
+  }
+
+  // random walks
+  auto const randomWalk = [&] {
+    geoalgo::Trajectory_t trajectory;
+    geoalgo::Point_t step = randomPoint();
+    for (std::size_t i = 0; i < NTrajectoryPoints; ++i) {
+      trajectory.push_back(step);
+      step += geoalgo::Vector_t{direction(engine), direction(engine), direction(engine)} * 5.0;
+    }
+    return trajectory;
+  };
+  geoalgo::Trajectory_t const trajectory = randomWalk();
+  geoalgo::Trajectory_t const otherTrajectory = randomWalk();
+
+  // sets of points for the bounding spheres
+  std::vector<std::vector<geoalgo::Point_t>> pointSets;
+  for (std::size_t i = 0; i < 64U; ++i) {
+    std::vector<geoalgo::Point_t> pointSet;
+    for (std::size_t j = 0; j < NSpherePoints; ++j)
+      pointSet.push_back(randomPoint());
+    pointSets.push_back(std::move(pointSet));
+  }
+
+  std::vector<geoalgo::HalfLine_t> const halfLineBatch(halfLines.begin(),
+                                                       halfLines.begin() + NBatch);
+  std::vector<geoalgo::LineSegment_t> const segmentBatch(segments.begin(),
+                                                         segments.begin() + NBatch);
+  std::vector<double> tEnter(NBatch), tExit(NBatch);
+
+  //
+  // benchmarks
+  //
+  geoalgo::GeoAlgo const algo;
+  testing::Benchmark<> bench;
+
+  bench.run("Intersection(AABox, HalfLine)", [&algo, &box, next = cycle(halfLines)]() mutable {
+    testing::doNotOptimize(algo.Intersection(box, next()));
+  });
+
+  bench.run("Intersection(AABox, LineSegment)",
+            [&algo, &box, next = cycle(segments)]() mutable {
+              testing::doNotOptimize(algo.Intersection(box, next()));
+            });
+
+  // the result is reused, so allocations happen only in the first calls
+  std::vector<geoalgo::Point_t> intersections;
+  bench.run("Intersection(AABox, LineSegment, result)",
+            [&algo, &box, &intersections, next = cycle(segments)]() mutable {
+              algo.Intersection(box, next(), intersections);
+              testing::doNotOptimize(intersections.data());
+            });
+
+  bench.run(
+    "Intersection(AABox, Trajectory)",
+    [&algo, &box, &trajectory]() { testing::doNotOptimize(algo.Intersection(box, trajectory)); },
+    NTrajectoryPoints);
+
+  bench.run(
+    "Intersection(AABox, HalfLine batch)",
+    [&algo, &box, &halfLineBatch, &tEnter, &tExit]() {
+      algo.Intersection(box, halfLineBatch, tEnter.data(), tExit.data());
+      testing::doNotOptimize(tEnter.data());
+    },
+    NBatch);
+
+  bench.run(
+    "Intersection(AABox, LineSegment batch)",
+    [&algo, &box, &segmentBatch, &tEnter, &tExit]() {
+      algo.Intersection(box, segmentBatch, tEnter.data(), tExit.data());
+      testing::doNotOptimize(tEnter.data());
+    },
+    NBatch);
+
+  bench.run("BoxOverlap(AABox, HalfLine)", [&algo, &box, next = cycle(halfLines)]() mutable {
+    testing::doNotOptimize(algo.BoxOverlap(box, next()));
+  });
+
+  bench.run("SqDist(Point, Line)",
+            [&algo, nextPoint = cycle(points), nextLine = cycle(lines)]() mutable {
+              testing::doNotOptimize(algo.SqDist(nextLine(), nextPoint()));
+            });
+
+  bench.run("ClosestPt(Point, Line)",
+            [&algo, nextPoint = cycle(points), nextLine = cycle(lines)]() mutable {
+              testing::doNotOptimize(algo.ClosestPt(nextLine(), nextPoint()));
+            });
+
+  bench.run("SqDist(Line, Line)", [&algo, next = cycle(lines), other = cycle(lines)]() mutable {
+    other(); // offsets the two sequences
+    testing::doNotOptimize(algo.SqDist(next(), other()));
+  });
+
+  bench.run("SqDist(Point, HalfLine)",
+            [&algo, nextPoint = cycle(points), nextLine = cycle(halfLines)]() mutable {
+              testing::doNotOptimize(algo.SqDist(nextPoint(), nextLine()));
+            });
+
+  bench.run("ClosestPt(Point, HalfLine)",
+            [&algo, nextPoint = cycle(points), nextLine = cycle(halfLines)]() mutable {
+              testing::doNotOptimize(algo.ClosestPt(nextPoint(), nextLine()));
+            });
+
+  bench.run("SqDist(HalfLine, HalfLine)",
+            [&algo, next = cycle(halfLines), other = cycle(halfLines)]() mutable {
+              other(); // offsets the two sequences
+              testing::doNotOptimize(algo.SqDist(next(), other()));
+            });
+
+  bench.run("SqDist(HalfLine, LineSegment)",
+            [&algo, nextLine = cycle(halfLines), nextSegment = cycle(segments)]() mutable {
+              testing::doNotOptimize(algo.SqDist(nextLine(), nextSegment()));
+            });
+
+  bench.run("SqDist(Point, LineSegment)",
+            [&algo, nextPoint = cycle(points), nextSegment = cycle(segments)]() mutable {
+              testing::doNotOptimize(algo.SqDist(nextPoint(), nextSegment()));
+            });
+
+  bench.run("ClosestPt(Point, LineSegment)",
+            [&algo, nextPoint = cycle(points), nextSegment = cycle(segments)]() mutable {
+              testing::doNotOptimize(algo.ClosestPt(nextPoint(), nextSegment()));
+            });
+
+  bench.run("SqDist(LineSegment, LineSegment)",
+            [&algo, next = cycle(segments), other = cycle(segments)]() mutable {
+              other(); // offsets the two sequences
+              testing::doNotOptimize(algo.SqDist(next(), other()));
+            });
+
+  bench.run(
+    "SqDist(Point, Trajectory)",
+    [&algo, &trajectory, next = cycle(points)]() mutable {
+      testing::doNotOptimize(algo.SqDist(next(), trajectory));
+    },
+    NTrajectoryPoints);
+
+  bench.run(
+    "ClosestPt(Point, Trajectory)",
+    [&algo, &trajectory, next = cycle(points)]() mutable {
+      testing::doNotOptimize(algo.ClosestPt(next(), trajectory));
+    },
+    NTrajectoryPoints);
+
+  bench.run(
+    "SqDist(HalfLine, Trajectory)",
+    [&algo, &trajectory, next = cycle(halfLines)]() mutable {
+      testing::doNotOptimize(algo.SqDist(next(), trajectory));
+    },
+    NTrajectoryPoints);
+
+  bench.run(
+    "SqDist(LineSegment, Trajectory)",
+    [&algo, &trajectory, next = cycle(segments)]() mutable {
+      testing::doNotOptimize(algo.SqDist(next(), trajectory));
+    },
+    NTrajectoryPoints);
+
+  bench.run(
+    "SqDist(Trajectory, Trajectory)",
+    [&algo, &trajectory, &otherTrajectory]() {
+      testing::doNotOptimize(algo.SqDist(trajectory, otherTrajectory));
+    },
+    NTrajectoryPoints * NTrajectoryPoints);
+
+  bench.run("SqDist(Point, AABox)", [&algo, &box, next = cycle(points)]() mutable {
+    testing::doNotOptimize(algo.SqDist(next(), box));
+  });
+
+  bench.run("ClosestPt(Point, AABox)", [&algo, &box, next = cycle(points)]() mutable {
+    testing::doNotOptimize(algo.ClosestPt(next(), box));
+  });
+
+  bench.run(
+    "boundingSphere(points)",
+    [&algo, next = cycle(pointSets)]() mutable {
+      testing::doNotOptimize(algo.boundingSphere(next()));
+    },
+    NSpherePoints);
+
+  bench.run("AABox::Contain(Point)", [&box, next = cycle(points)]() mutable {
+    testing::doNotOptimize(box.Contain(next()));
+  });
+
+  bench.run("Sphere::Contain(Point)", [&sphere, next = cycle(points)]() mutable {
+    testing::doNotOptimize(sphere.Contain(next()));
+  });
+
+  // neighbors among the random points, about ten within the radius of each
+  geoalgo::PointCloud_t const cloud{points};
+  constexpr double NeighborRadius = 50.0;
+  std::vector<geoalgo::PointCloud_t::Neighbor_t> neighbors;
+
+  bench.run("PointCloud::WithinRadius(Point)",
+            [&cloud, &neighbors, next = cycle(points)]() mutable {
+              cloud.WithinRadius(next(), NeighborRadius, neighbors);
+              testing::doNotOptimize(neighbors.data());
+            });
+
+  bench.run("PointCloud::Nearest(Point, 10)",
+            [&cloud, &neighbors, next = cycle(points)]() mutable {
+              cloud.Nearest(next(), 10U, neighbors);
+              testing::doNotOptimize(neighbors.data());
+            });
+
+  bench.run(
+    "PointCloud::PairsWithinRadius()",
+    [&cloud]() { testing::doNotOptimize(cloud.PairsWithinRadius(NeighborRadius)); },
+    NInputs);
+
+  // hulls of all the random points, with the working memory reused
+  geoalgo::ConvexHullScratch hullScratch;
+  geoalgo::ConvexHull3D_t hull3D;
+  geoalgo::ConvexHull2D_t hull2D;
+
+  bench.run(
+    "ConvexHull3D::Build(points)",
+    [&points, &hull3D, &hullScratch]() {
+      hull3D.Build(points, &hullScratch);
+      testing::doNotOptimize(hull3D.Faces().data());
+    },
+    NInputs);
+
+  bench.run(
+    "ConvexHull2D::Build(points)",
+    [&points, &hull2D, &hullScratch]() {
+      hull2D.Build(points, {1., 0., 0.}, {0., 1., 0.}, &hullScratch);
+      testing::doNotOptimize(hull2D.Indices().data());
+    },
+    NInputs);
+
+  bench.run("ConvexHull3D::Contain(Point)", [&hull3D, next = cycle(points)]() mutable {
+    testing::doNotOptimize(hull3D.Contain(next()));
+  });
+
+  bench.run("ConvexHull2D::Contain(Point)", [&hull2D, next = cycle(points)]() mutable {
+    testing::doNotOptimize(hull2D.Contain(next()));
+  });
+
+  //
+  // report
+  //
+  std::cout << "Time per query [ns]:\n";
+  unsigned int const nRegressions = bench.report(options, std::cout);
+  if (nRegressions > 0)
+    std::cerr << nRegressions << " performance regressions detected!" << std::endl;
+
+  return nRegressions;
+} // main()
@@ -0,0 +1,65 @@
+from test_msg import debug, info, error, warning
+import traceback,sys
+import numpy as np
+from time import *
+from test_import import test_import
+test_import()
+from ROOT import geoalgo, std
+
+# colors
+OK = '\033[92m'
+NO = '\033[91m'
+BLUE = '\033[94m'
+ENDC = '\033[0m'
+
+def test_contain():
+
+    debug()
+    debug(BLUE + "Batch containment against the single point tests" + ENDC)
+    debug()
+
+    # number of points to test in each volume
+    tests = 10000
+
+    try:
+
+        # random points, as coordinate vectors
+        pts = np.random.uniform(-2., 2., (3, tests))
+        x = std.vector('double')(pts[0])
+        y = std.vector('double')(pts[1])
+        z = std.vector('double')(pts[2])
+
+        volumes = [
+            ('Sphere', geoalgo.Sphere(geoalgo.Vector3(0.1, 0.2, 0.3), 1.5)),
+            ('Cylinder', geoalgo.Cylinder(-1., -0.5, 0., 1., 0.5, 0.5, 0.7)),
+            ('Cone', geoalgo.Cone(-1., 0., 0., 1., 0.2, 0.1, 3., 1.)),
+            ]
+        for name, volume in volumes:
+            info('Testing batch containment in a %s' % name)
+            tim = time()
+            mask = volume.Contain(x, y, z)
+            batchT = time() - tim
+            tim = time()
+            success = 0
+            for i in xrange(tests):
+                if mask[i] == volume.Contain(geoalgo.Vector3(x[i], y[i], z[i])): success += 1
+            singleT = time() - tim
+            if success < tests:
+                info(NO + "Success: {0}%".format(100*float(success)/tests) + ENDC)
+            else:
+                info(OK + "Success: {0}%".format(100*float(success)/tests) + ENDC)
+            info("Time for batch Contain                   : {0:.3f} us".format(1E6*batchT/tests))
+            info("Time for single Contain                  : {0:.3f} us".format(1E6*singleT/tests))
+
+    except Exception:
+        error('geoalgo containment unit test failed.')
+        print traceback.format_exception(*sys.exc_info())[2]
+        return 1
+
+    info('geoalgo containment unit test complete.')
+    return 0
+
+if __name__ == '__main__':
+    import test_msg
+    test_msg.test_msg.level = 0
+    test_contain()
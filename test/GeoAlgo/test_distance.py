@@ -289,8 +289,8 @@ def test_dAlgo():
             tim = time() - tim
             sqdistT += tim
             # expect the closest points on both lines to be p1 & l2.Pt1()
-            ptL1 = geoalgo.Vector()
-            ptL2 = geoalgo.Vector()
+            ptL1 = geoalgo.Vector3()
+            ptL2 = geoalgo.Vector3()
             a2 = dAlgo.SqDist(l1,l2,ptL1,ptL2)
             if not (abs(answer-a1) < _epsilon): success = 0
             if not (abs(answer-a2) < _epsilon) : success = 0
@@ -341,8 +341,8 @@ def test_dAlgo():
                 tim = time()
                 a1 = dAlgo.SqDist(l1,l2)
                 tim = time() - tim
-                L1 = geoalgo.Vector()
-                L2 = geoalgo.Vector()
+                L1 = geoalgo.Vector3()
+                L2 = geoalgo.Vector3()
                 a2 = dAlgo.SqDist(l1,l2,L1,L2)
                 sqdistT_in += tim
                 if not (abs(answer-a1) < _epsilon): success = 0
@@ -355,8 +355,8 @@ def test_dAlgo():
                 tim = time()
                 a1 = dAlgo.SqDist(l1,l2)
                 tim = time() - tim
-                L1 = geoalgo.Vector()
-                L2 = geoalgo.Vector()
+                L1 = geoalgo.Vector3()
+                L2 = geoalgo.Vector3()
                 a2 = dAlgo.SqDist(l1,l2,L1,L2)
                 sqdistT_out += tim
                 if not (abs(answer-a1) < _epsilon): success = 0
@@ -419,8 +419,8 @@ def test_dAlgo():
             a1 = dAlgo.SqDist(l1,seg)
             tim = time() - tim
             sqdistT1 += tim
-            L1 = geoalgo.Vector()
-            L2 = geoalgo.Vector()
+            L1 = geoalgo.Vector3()
+            L2 = geoalgo.Vector3()
             a2 = dAlgo.SqDist(l1,seg,L1,L2)
             if not (abs(answer-a1) < _epsilon): success1 = 0
             if not (abs(answer-a2) < _epsilon): success1 = 0
@@ -550,8 +550,8 @@ def test_dAlgo():
             a1 = dAlgo.SqDist(seg1,seg)
             tim = time() - tim
             sqdistT1 += tim
-            L1 = geoalgo.Vector()
-            L2 = geoalgo.Vector()
+            L1 = geoalgo.Vector3()
+            L2 = geoalgo.Vector3()
             a2 = dAlgo.SqDist(seg1,seg,L1,L2)
             if not (abs(answer-a1) < _epsilon): success1 = 0
             if not (abs(answer-a2) < _epsilon): success1 = 0
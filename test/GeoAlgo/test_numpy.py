@@ -0,0 +1,102 @@
+from test_msg import debug, info, error, warning
+import traceback,sys
+import numpy as np
+from time import *
+from test_import import test_import
+test_import()
+from ROOT import geoalgo
+
+# colors
+OK = '\033[92m'
+NO = '\033[91m'
+BLUE = '\033[94m'
+ENDC = '\033[0m'
+
+def report(name, success, tests, batchT, singleT):
+    if success < tests:
+        info(NO + "Success: {0}%".format(100*float(success)/tests) + ENDC)
+    else:
+        info(OK + "Success: {0}%".format(100*float(success)/tests) + ENDC)
+    info("Time for batch {0:26}: {1:.3f} us".format(name, 1E6*batchT/tests))
+    info("Time for single {0:25}: {1:.3f} us".format(name, 1E6*singleT/tests))
+
+def test_numpy():
+
+    debug()
+    debug(BLUE + "Batches on NumPy arrays against the single point calls" + ENDC)
+    debug()
+
+    # number of points (and lines) to test
+    tests = 10000
+
+    try:
+
+        algo = geoalgo.GeoAlgo()
+
+        # random points, as a (tests, 3) array passed without copies
+        pts = np.ascontiguousarray(np.random.uniform(-2., 2., (tests, 3)))
+        vecs = [geoalgo.Vector3(p[0], p[1], p[2]) for p in pts]
+
+        info('Testing Point & Trajectory distances on a NumPy array')
+        trj = geoalgo.Trajectory()
+        for p in np.random.uniform(-1., 1., (30, 3)):
+            trj.push_back(geoalgo.Vector3(p[0], p[1], p[2]))
+        sqDist = np.zeros(tests)
+        tim = time()
+        algo.SqDist(tests, pts, trj, sqDist)
+        batchT = time() - tim
+        tim = time()
+        success = 0
+        for i in xrange(tests):
+            if np.isclose(sqDist[i], algo.SqDist(vecs[i], trj)): success += 1
+        singleT = time() - tim
+        report('SqDist', success, tests, batchT, singleT)
+
+        info('Testing HalfLine & AABox intersections on NumPy arrays')
+        box = geoalgo.AABox(-1., -1., -1., 1., 1., 1.)
+        dirs = np.ascontiguousarray(np.random.uniform(-1., 1., (tests, 3)))
+        dirs /= np.linalg.norm(dirs, axis=1)[:, np.newaxis]
+        tEnter = np.zeros(tests)
+        tExit = np.zeros(tests)
+        tim = time()
+        algo.Intersection(box, tests, pts, dirs, tEnter, tExit)
+        batchT = time() - tim
+        tim = time()
+        success = 0
+        for i in xrange(tests):
+            hl = geoalgo.HalfLine(vecs[i], geoalgo.Vector3(dirs[i][0], dirs[i][1], dirs[i][2]))
+            hit = algo.Intersection(box, hl).size() > 0
+            if hit == (tExit[i] < geoalgo.kINVALID_DOUBLE): success += 1
+        singleT = time() - tim
+        report('Intersection', success, tests, batchT, singleT)
+
+        volumes = [
+            ('Sphere', geoalgo.Sphere(geoalgo.Vector3(0.1, 0.2, 0.3), 1.5)),
+            ('Cylinder', geoalgo.Cylinder(-1., -0.5, 0., 1., 0.5, 0.5, 0.7)),
+            ('Cone', geoalgo.Cone(-1., 0., 0., 1., 0.2, 0.1, 3., 1.)),
+            ]
+        for name, volume in volumes:
+            info('Testing containment in a %s on a NumPy array' % name)
+            mask = np.zeros(tests, dtype=bool)
+            tim = time()
+            volume.Contain(tests, pts, mask)
+            batchT = time() - tim
+            tim = time()
+            success = 0
+            for i in xrange(tests):
+                if mask[i] == volume.Contain(vecs[i]): success += 1
+            singleT = time() - tim
+            report('Contain', success, tests, batchT, singleT)
+
+    except Exception:
+        error('geoalgo NumPy unit test failed.')
+        print traceback.format_exception(*sys.exc_info())[2]
+        return 1
+
+    info('geoalgo NumPy unit test complete.')
+    return 0
+
+if __name__ == '__main__':
+    import test_msg
+    test_msg.test_msg.level = 0
+    test_numpy()
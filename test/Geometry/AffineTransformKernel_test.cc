@@ -0,0 +1,141 @@
+/**
+ * @file   AffineTransformKernel_test.cc
+ * @brief  Unit test for `geo::details::AffineTransformKernel`.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/details/AffineTransformKernel.h`
+ *
+ * A rotation with translation is built from the images of the origin and of
+ * the axes, and the batch results on points given as structures and as arrays
+ * are compared with the single point ones and with the inverse transformation.
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE (affine transform kernel test)
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "larcorealg/Geometry/details/AffineTransformKernel.h"
+
+// C/C++ standard libraries
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+//------------------------------------------------------------------------------
+struct TestPoint {
+  double x, y, z;
+
+  double X() const { return x; }
+  double Y() const { return y; }
+  double Z() const { return z; }
+};
+
+/// Rotation by 90 degrees around _z_, then translation by (1, 2, 3); and back.
+struct TestTransformations {
+  geo::details::AffineTransformKernel direct, inverse;
+
+  TestTransformations()
+  {
+    double const origin[3] = {1.0, 2.0, 3.0};
+    double const axisX[3] = {0.0, 1.0, 0.0};
+    double const axisY[3] = {-1.0, 0.0, 0.0};
+    double const axisZ[3] = {0.0, 0.0, 1.0};
+    direct = geo::details::AffineTransformKernel::fromImages(origin, axisX, axisY, axisZ);
+
+    double const invOrigin[3] = {-2.0, 1.0, -3.0};
+    double const invAxisX[3] = {0.0, -1.0, 0.0};
+    double const invAxisY[3] = {1.0, 0.0, 0.0};
+    inverse = geo::details::AffineTransformKernel::fromImages(invOrigin, invAxisX, invAxisY, axisZ);
+  }
+};
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(SinglePointTestCase)
+{
+  TestTransformations const trans;
+
+  double const p[3] = {1.0, 0.0, 0.0};
+  double q[3];
+  trans.direct.transformPoint(p, q);
+  BOOST_TEST(q[0] == 1.0);
+  BOOST_TEST(q[1] == 3.0);
+  BOOST_TEST(q[2] == 3.0);
+
+  trans.direct.transformVector(p, q);
+  BOOST_TEST(q[0] == 0.0);
+  BOOST_TEST(q[1] == 1.0);
+  BOOST_TEST(q[2] == 0.0);
+
+  double const world[3] = {1.0, 3.0, 3.0};
+  trans.inverse.transformPoint(world, q);
+  BOOST_TEST(q[0] == 1.0);
+  BOOST_TEST(q[1] == 0.0);
+  BOOST_TEST(q[2] == 0.0);
+
+  // the default kernel is the identity
+  geo::details::AffineTransformKernel const identity;
+  identity.transformPoint(world, q);
+  BOOST_TEST(q[0] == world[0]);
+  BOOST_TEST(q[1] == world[1]);
+  BOOST_TEST(q[2] == world[2]);
+} // BOOST_AUTO_TEST_CASE(SinglePointTestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(BatchTestCase)
+{
+  TestTransformations const trans;
+
+  std::size_t const N = 37U; // not a multiple of any vector width
+  std::vector<TestPoint> points;
+  std::vector<double> x, y, z;
+  for (std::size_t i = 0; i < N; ++i) {
+    TestPoint const p{0.5 * i - 3.0, std::sin(0.1 * i), -0.25 * i};
+    points.push_back(p);
+    x.push_back(p.x);
+    y.push_back(p.y);
+    z.push_back(p.z);
+  }
+
+  std::vector<double> outX(N), outY(N), outZ(N);
+  trans.direct.transformPoints(N, x.data(), y.data(), z.data(), outX.data(), outY.data(),
+                               outZ.data());
+  std::vector<TestPoint> outPoints(N);
+  trans.direct.transformPoints(points.cbegin(), points.cend(), outPoints.begin());
+
+  std::vector<double> vectX(N), vectY(N), vectZ(N);
+  trans.direct.transformVectors(N, x.data(), y.data(), z.data(), vectX.data(), vectY.data(),
+                                vectZ.data());
+  std::vector<TestPoint> outVectors(N);
+  trans.direct.transformVectors(points.cbegin(), points.cend(), outVectors.data());
+
+  std::vector<TestPoint> backPoints(N);
+  trans.inverse.transformPoints(outPoints.cbegin(), outPoints.cend(), backPoints.begin());
+
+  for (std::size_t i = 0; i < N; ++i) {
+    BOOST_TEST_CONTEXT("point #" << i)
+    {
+      double const p[3] = {x[i], y[i], z[i]};
+      double q[3], v[3];
+      trans.direct.transformPoint(p, q);
+      trans.direct.transformVector(p, v);
+
+      BOOST_TEST(outX[i] == q[0]);
+      BOOST_TEST(outY[i] == q[1]);
+      BOOST_TEST(outZ[i] == q[2]);
+      BOOST_TEST(outPoints[i].x == q[0]);
+      BOOST_TEST(outPoints[i].y == q[1]);
+      BOOST_TEST(outPoints[i].z == q[2]);
+
+      BOOST_TEST(vectX[i] == v[0]);
+      BOOST_TEST(vectY[i] == v[1]);
+      BOOST_TEST(vectZ[i] == v[2]);
+      BOOST_TEST(outVectors[i].x == v[0]);
+      BOOST_TEST(outVectors[i].y == v[1]);
+      BOOST_TEST(outVectors[i].z == v[2]);
+
+      BOOST_TEST(backPoints[i].x == x[i], boost::test_tools::tolerance(1e-12));
+      BOOST_TEST(backPoints[i].y == y[i], boost::test_tools::tolerance(1e-12));
+      BOOST_TEST(backPoints[i].z == z[i], boost::test_tools::tolerance(1e-12));
+    }
+  } // for
+} // BOOST_AUTO_TEST_CASE(BatchTestCase)
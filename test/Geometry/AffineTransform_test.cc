@@ -0,0 +1,140 @@
+/**
+ * @file   AffineTransform_test.cc
+ * @brief  Unit test for `geo::AffineTransform`.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/AffineTransform.h`
+ *
+ * The transformations of points and vectors, the inverse, the composition and
+ * the conversion between precisions are checked on rotations with translation,
+ * also in constant expressions.
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE (affine transform test)
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "larcorealg/Geometry/AffineTransform.h"
+
+// C/C++ standard libraries
+#include <cmath>
+#include <cstring> // std::memcpy()
+
+//------------------------------------------------------------------------------
+// rotation by 90 degrees around z, then translation by 5 cm on x
+constexpr geo::AffineTransformD RotZ{
+  0.0, -1.0, 0.0, 5.0, 1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 1.0, 0.0};
+
+// rotation by 90 degrees around x, then translation by -2 cm on z
+constexpr geo::AffineTransformD RotX{
+  1.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0, 0.0, 0.0, 1.0, 0.0, -2.0};
+
+constexpr double worldXOf(geo::AffineTransformD const& trans, double x, double y, double z)
+{
+  double const local[3] = {x, y, z};
+  double world[3] = {0.0, 0.0, 0.0};
+  trans.LocalToMaster(local, world);
+  return world[0];
+}
+
+static_assert(worldXOf(RotZ, 0.0, 1.0, 0.0) == 4.0);
+static_assert(worldXOf(RotZ.Inverse(), 5.0, 1.0, 0.0) == 1.0);
+static_assert(worldXOf(geo::AffineTransformD{}, 3.0, 1.0, 0.0) == 3.0);
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(PointAndVectorTestCase)
+{
+  double const local[3] = {1.0, 2.0, 3.0};
+  double world[3], back[3];
+
+  RotZ.LocalToMaster(local, world);
+  BOOST_TEST(world[0] == 3.0);
+  BOOST_TEST(world[1] == 1.0);
+  BOOST_TEST(world[2] == 3.0);
+  RotZ.MasterToLocal(world, back);
+  BOOST_TEST(back[0] == local[0]);
+  BOOST_TEST(back[1] == local[1]);
+  BOOST_TEST(back[2] == local[2]);
+
+  RotZ.LocalToMasterVect(local, world);
+  BOOST_TEST(world[0] == -2.0);
+  BOOST_TEST(world[1] == 1.0);
+  BOOST_TEST(world[2] == 3.0);
+  RotZ.MasterToLocalVect(world, back);
+  BOOST_TEST(back[0] == local[0]);
+  BOOST_TEST(back[1] == local[1]);
+  BOOST_TEST(back[2] == local[2]);
+
+  double components[12];
+  RotZ.GetComponents(components);
+  double const expected[12] = {0.0, -1.0, 0.0, 5.0, 1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 1.0, 0.0};
+  for (int i = 0; i < 12; ++i)
+    BOOST_TEST(components[i] == expected[i]);
+  BOOST_TEST(RotZ.Rotation(0, 1) == -1.0);
+  BOOST_TEST(RotZ.Translation(0) == 5.0);
+} // BOOST_AUTO_TEST_CASE(PointAndVectorTestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(CompositionTestCase)
+{
+  geo::AffineTransformD const both = RotZ * RotX; // RotX first
+  double const p[3] = {1.0, -2.0, 0.5};
+  double step[3], expected[3], world[3], back[3];
+  RotX.LocalToMaster(p, step);
+  RotZ.LocalToMaster(step, expected);
+  both.LocalToMaster(p, world);
+  for (int i = 0; i < 3; ++i)
+    BOOST_TEST(world[i] == expected[i]);
+
+  both.MasterToLocal(world, back);
+  for (int i = 0; i < 3; ++i)
+    BOOST_TEST(back[i] == p[i]);
+
+  geo::AffineTransformD acc = RotZ;
+  acc *= RotX;
+  acc.LocalToMaster(p, world);
+  for (int i = 0; i < 3; ++i)
+    BOOST_TEST(world[i] == expected[i]);
+} // BOOST_AUTO_TEST_CASE(CompositionTestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(ScalingTestCase)
+{
+  // not a rotation: the inverse is computed in general
+  geo::AffineTransformD const trans{2.0, 1.0, 0.0, 1.0, 0.0, 4.0, 0.0, -1.0, 0.0, 0.0, 0.5, 3.0};
+  double const p[3] = {1.5, -2.0, 4.0};
+  double world[3], back[3];
+  trans.LocalToMaster(p, world);
+  trans.MasterToLocal(world, back);
+  for (int i = 0; i < 3; ++i)
+    BOOST_TEST(back[i] == p[i], boost::test_tools::tolerance(1e-12));
+} // BOOST_AUTO_TEST_CASE(ScalingTestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(PrecisionTestCase)
+{
+  geo::AffineTransformF const transF{RotZ};
+  float const local[3] = {1.0f, 2.0f, 3.0f};
+  float world[3];
+  transF.LocalToMaster(local, world);
+  BOOST_TEST(world[0] == 3.0f);
+  BOOST_TEST(world[1] == 1.0f);
+  BOOST_TEST(world[2] == 3.0f);
+
+  // the single precision matrix transforms also double precision points
+  double const localD[3] = {1.0, 2.0, 3.0};
+  double worldD[3];
+  transF.MasterToLocal(localD, worldD);
+  BOOST_TEST(worldD[0] == 2.0);
+  BOOST_TEST(worldD[1] == 4.0);
+  BOOST_TEST(worldD[2] == 3.0);
+
+  // plain data: a byte copy is a valid copy
+  geo::AffineTransformD copy;
+  std::memcpy(static_cast<void*>(&copy), &RotZ, sizeof(RotZ));
+  double copyWorld[3];
+  double const p[3] = {1.0, 2.0, 3.0};
+  copy.LocalToMaster(p, copyWorld);
+  BOOST_TEST(copyWorld[0] == 3.0);
+  BOOST_TEST(copyWorld[1] == 1.0);
+} // BOOST_AUTO_TEST_CASE(PrecisionTestCase)
@@ -0,0 +1,140 @@
+/**
+ * @file   BoxBVH_test.cc
+ * @brief  Unit test for `geo::details::BoxBVH`.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/details/BoxBVH.h`
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE (box bounding volume hierarchy test)
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "larcorealg/Geometry/details/BoxBVH.h"
+
+// C/C++ standard libraries
+#include <cstddef>
+#include <vector>
+
+using BoxBVH = geo::details::BoxBVH;
+
+//------------------------------------------------------------------------------
+/// Returns the first of the `boxes` containing the point, the slow way.
+BoxBVH::BoxIndex_t findFirstByLoop(std::vector<BoxBVH::Box_t> const& boxes,
+                                   double x,
+                                   double y,
+                                   double z,
+                                   double margin,
+                                   BoxBVH::BoxIndex_t skip = BoxBVH::NoBox)
+{
+  for (std::size_t i = 0; i < boxes.size(); ++i) {
+    if (i == skip) continue;
+    BoxBVH::Box_t const& box = boxes[i];
+    if ((x >= box.lower[0] - margin) && (x <= box.upper[0] + margin) &&
+        (y >= box.lower[1] - margin) && (y <= box.upper[1] + margin) &&
+        (z >= box.lower[2] - margin) && (z <= box.upper[2] + margin))
+      return static_cast<BoxBVH::BoxIndex_t>(i);
+  }
+  return BoxBVH::NoBox;
+}
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(EmptyTestCase)
+{
+  BoxBVH tree;
+  BOOST_TEST(tree.empty());
+  BOOST_TEST(tree.findFirst(0.0, 0.0, 0.0) == BoxBVH::NoBox);
+
+  tree.build({});
+  BOOST_TEST(tree.empty());
+  BOOST_TEST(tree.size() == 0U);
+} // BOOST_AUTO_TEST_CASE(EmptyTestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(StripsTestCase)
+{
+  // two overlapping layers of strips, like a CRT module
+  std::vector<BoxBVH::Box_t> boxes;
+  for (int layer = 0; layer < 2; ++layer) {
+    for (int i = 0; i < 200; ++i) {
+      double const y = 2.0 * layer;
+      if (layer == 0)
+        boxes.push_back({{5.0 * i, y, 0.0}, {5.0 * i + 5.0, y + 2.0, 1000.0}});
+      else
+        boxes.push_back({{0.0, y, 5.0 * i}, {1000.0, y + 2.0, 5.0 * i + 5.0}});
+    }
+  }
+  boxes.push_back({{0.0, 0.0, 0.0}, {1000.0, 4.0, 1000.0}}); // the whole module
+
+  BoxBVH tree;
+  tree.build(boxes);
+  BOOST_TEST(!tree.empty());
+  BOOST_TEST(tree.size() == boxes.size());
+  BOOST_TEST(tree.nNodes() < boxes.size());
+
+  for (double const margin : {0.0, 0.5}) {
+    for (int i = -5; i <= 1005; i += 7) {
+      for (double const y : {-0.7, 1.0, 2.0, 3.0, 4.2}) {
+        double const x = 0.99 * i, z = 1000.0 - 1.01 * i;
+        BOOST_TEST_CONTEXT("point (" << x << ", " << y << ", " << z << "), margin " << margin)
+        {
+          BOOST_TEST(tree.findFirst(x, y, z, margin) == findFirstByLoop(boxes, x, y, z, margin));
+
+          // reject the first box found, which must find the next one
+          BoxBVH::BoxIndex_t const first = findFirstByLoop(boxes, x, y, z, margin);
+          BoxBVH::BoxIndex_t const second = tree.findFirst(
+            x, y, z, margin, [first](BoxBVH::BoxIndex_t iBox) { return iBox != first; });
+          BOOST_TEST(second == findFirstByLoop(boxes, x, y, z, margin, first));
+        }
+      } // for y
+    }   // for i
+  }     // for margin
+
+  // the first layer is found before the whole module
+  BOOST_TEST(tree.findFirst(7.5, 1.0, 500.0) == 1U);
+  // the second layer
+  BOOST_TEST(tree.findFirst(7.5, 3.0, 502.5) == 300U);
+
+  tree.clear();
+  BOOST_TEST(tree.empty());
+} // BOOST_AUTO_TEST_CASE(StripsTestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(CrossedTestCase)
+{
+  // a 10 x 10 wall of cells, crossed by lines at different angles
+  std::vector<BoxBVH::Box_t> boxes;
+  for (int i = 0; i < 10; ++i) {
+    for (int j = 0; j < 10; ++j)
+      boxes.push_back({{10.0 * i, 10.0 * j, 0.0}, {10.0 * i + 10.0, 10.0 * j + 10.0, 5.0}});
+  }
+  BoxBVH tree;
+  tree.build(boxes);
+
+  for (int k = 0; k < 20; ++k) {
+    double const start[3] = {-5.0, 3.0 * k - 5.0, 2.5};
+    double const dir[3] = {110.0, 13.0 + 2.0 * k, 0.5};
+    auto const ray = geo::details::BoxRay::make(start, dir);
+    for (double const tMax : {0.5, 1.0}) {
+      BOOST_TEST_CONTEXT("line #" << k << " up to " << tMax)
+      {
+        std::vector<int> crossed(boxes.size(), 0);
+        tree.forEachCrossed(ray, 0.0, tMax, [&](BoxBVH::BoxIndex_t iBox, double t0, double t1) {
+          ++crossed[iBox];
+          BOOST_TEST(t0 >= 0.0);
+          BOOST_TEST(t1 <= tMax);
+          BOOST_TEST(t0 <= t1);
+        });
+        for (std::size_t i = 0; i < boxes.size(); ++i) {
+          geo::details::BoxKernel const box{
+            {boxes[i].lower[0], boxes[i].lower[1], boxes[i].lower[2]},
+            {boxes[i].upper[0], boxes[i].upper[1], boxes[i].upper[2]}};
+          double tEnter, tExit;
+          bool const hit = box.intersect(ray, tEnter, tExit) && (tExit >= 0.0) &&
+                           (tEnter <= tMax);
+          BOOST_TEST(crossed[i] == (hit ? 1 : 0), "box #" << i);
+        }
+      }
+    } // for tMax
+  }   // for k
+} // BOOST_AUTO_TEST_CASE(CrossedTestCase)
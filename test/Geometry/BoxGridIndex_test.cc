@@ -0,0 +1,184 @@
+/**
+ * @file   BoxGridIndex_test.cc
+ * @brief  Unit test for `geo::details::BoxGridIndex`.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/details/BoxGridIndex.h`
+ *
+ * The index is checked against a linear search on a regular array of boxes
+ * (like the TPCs of a modular detector) and on an irregular set of boxes.
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE (box grid index test)
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "larcorealg/Geometry/details/BoxGridIndex.h"
+
+// C/C++ standard libraries
+#include <cstddef>
+#include <limits>
+#include <random>
+#include <vector>
+
+//------------------------------------------------------------------------------
+/// Minimal box with the same containment rule as `geo::BoxBoundedGeo`.
+struct TestBox {
+  double minX, maxX, minY, maxY, minZ, maxZ;
+
+  double MinX() const { return minX; }
+  double MaxX() const { return maxX; }
+  double MinY() const { return minY; }
+  double MaxY() const { return maxY; }
+  double MinZ() const { return minZ; }
+  double MaxZ() const { return maxZ; }
+
+  static bool contained(double c, double min, double max, double wiggle)
+  {
+    return (c >= (min > 0 ? min / wiggle : min * wiggle)) &&
+           (c <= (max < 0 ? max / wiggle : max * wiggle));
+  }
+
+  bool contains(double x, double y, double z, double wiggle) const
+  {
+    return contained(x, minX, maxX, wiggle) && contained(y, minY, maxY, wiggle) &&
+           contained(z, minZ, maxZ, wiggle);
+  }
+}; // struct TestBox
+
+//------------------------------------------------------------------------------
+/// Returns the first box containing the point, by linear search (or -1).
+int linearSearch(std::vector<TestBox> const& boxes, double x, double y, double z, double wiggle)
+{
+  for (std::size_t i = 0; i < boxes.size(); ++i)
+    if (boxes[i].contains(x, y, z, wiggle)) return static_cast<int>(i);
+  return -1;
+}
+
+/// Returns the first box containing the point, using the index (or -1).
+int indexedSearch(geo::details::BoxGridIndex const& index,
+                  std::vector<TestBox> const& boxes,
+                  double x,
+                  double y,
+                  double z,
+                  double wiggle)
+{
+  for (auto const i : index.candidates(x, y, z))
+    if (boxes[i].contains(x, y, z, wiggle)) return static_cast<int>(i);
+  return -1;
+}
+
+//------------------------------------------------------------------------------
+void checkAgainstLinearSearch(std::vector<TestBox> const& boxes, unsigned int nPoints)
+{
+  geo::details::BoxGridIndex index;
+  index.build(boxes);
+  BOOST_TEST(!index.empty());
+  BOOST_TEST(index.covers(1.0));
+  BOOST_TEST(index.covers(1.0001));
+  BOOST_TEST(!index.covers(1.01));
+  BOOST_TEST(index.nCells() <= 64U * (boxes.size() + 1U));
+
+  // query range is 20% larger than the boxes in every direction
+  double lower[3] = {boxes.front().minX, boxes.front().minY, boxes.front().minZ};
+  double upper[3] = {boxes.front().maxX, boxes.front().maxY, boxes.front().maxZ};
+  for (TestBox const& box : boxes) {
+    lower[0] = std::min(lower[0], box.minX);
+    upper[0] = std::max(upper[0], box.maxX);
+    lower[1] = std::min(lower[1], box.minY);
+    upper[1] = std::max(upper[1], box.maxY);
+    lower[2] = std::min(lower[2], box.minZ);
+    upper[2] = std::max(upper[2], box.maxZ);
+  }
+  std::mt19937 engine{12345};
+  std::uniform_real_distribution<double> coord[3];
+  for (int i = 0; i < 3; ++i) {
+    double const margin = 0.2 * (upper[i] - lower[i]);
+    coord[i] = std::uniform_real_distribution<double>{lower[i] - margin, upper[i] + margin};
+  }
+
+  unsigned int nFound = 0;
+  for (unsigned int iPoint = 0; iPoint < nPoints; ++iPoint) {
+    double const x = coord[0](engine), y = coord[1](engine), z = coord[2](engine);
+    for (double const wiggle : {1.0, 1.0001, geo::details::BoxGridIndex::DefaultWiggle}) {
+      int const expected = linearSearch(boxes, x, y, z, wiggle);
+      BOOST_TEST(indexedSearch(index, boxes, x, y, z, wiggle) == expected);
+      if (expected >= 0) ++nFound;
+    }
+  } // for points
+  BOOST_TEST(nFound > 0U);
+
+  // points exactly on the box boundaries
+  for (TestBox const& box : boxes) {
+    for (double const x : {box.minX, box.maxX}) {
+      for (double const z : {box.minZ, box.maxZ}) {
+        BOOST_TEST(indexedSearch(index, boxes, x, box.minY, z, 1.0) ==
+                   linearSearch(boxes, x, box.minY, z, 1.0));
+        BOOST_TEST(indexedSearch(index, boxes, x, box.maxY, z, 1.0) ==
+                   linearSearch(boxes, x, box.maxY, z, 1.0));
+      } // for z
+    }   // for x
+  }     // for boxes
+
+} // checkAgainstLinearSearch()
+
+//------------------------------------------------------------------------------
+void emptyIndexTest()
+{
+  geo::details::BoxGridIndex index;
+  BOOST_TEST(index.empty());
+  BOOST_TEST(!index.covers(1.0));
+  BOOST_TEST(index.candidates(0.0, 0.0, 0.0).empty());
+
+  index.build(std::vector<TestBox>{{-1.0, 1.0, -1.0, 1.0, -1.0, 1.0}});
+  BOOST_TEST(!index.empty());
+  BOOST_TEST(index.candidates(0.0, 0.0, 0.0).size() == 1U);
+  BOOST_TEST(index.candidates(5.0, 0.0, 0.0).empty());
+  double const nan = std::numeric_limits<double>::quiet_NaN();
+  BOOST_TEST(index.candidates(nan, 0.0, 0.0).empty());
+
+  index.clear();
+  BOOST_TEST(index.empty());
+  BOOST_TEST(index.candidates(0.0, 0.0, 0.0).empty());
+} // emptyIndexTest()
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(EmptyIndexTestCase)
+{
+  emptyIndexTest();
+}
+
+BOOST_AUTO_TEST_CASE(RegularLayoutTestCase)
+{
+  // 2 x 3 x 25 touching boxes, across the origin on x
+  std::vector<TestBox> boxes;
+  for (int ix = 0; ix < 2; ++ix) {
+    for (int iy = 0; iy < 3; ++iy) {
+      for (int iz = 0; iz < 25; ++iz) {
+        boxes.push_back({-360.0 + 360.0 * ix,
+                         360.0 * ix,
+                         -600.0 + 400.0 * iy,
+                         -200.0 + 400.0 * iy,
+                         230.0 * iz,
+                         230.0 * (iz + 1)});
+      } // for z
+    }   // for y
+  }     // for x
+  checkAgainstLinearSearch(boxes, 20000U);
+}
+
+BOOST_AUTO_TEST_CASE(IrregularLayoutTestCase)
+{
+  // overlapping random boxes
+  std::mt19937 engine{54321};
+  std::uniform_real_distribution<double> corner{-500.0, 500.0};
+  std::uniform_real_distribution<double> size{1.0, 200.0};
+  std::vector<TestBox> boxes;
+  for (int i = 0; i < 200; ++i) {
+    double const x = corner(engine), y = corner(engine), z = corner(engine);
+    boxes.push_back({x, x + size(engine), y, y + size(engine), z, z + size(engine)});
+  }
+  checkAgainstLinearSearch(boxes, 20000U);
+}
+
+//------------------------------------------------------------------------------
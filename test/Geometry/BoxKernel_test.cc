@@ -0,0 +1,176 @@
+/**
+ * @file   BoxKernel_test.cc
+ * @brief  Unit test for `geo::details::BoxKernel` and `geo::BoxSetSoA`.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/details/BoxKernel.h`,
+ *         `larcorealg/Geometry/BoxSetSoA.h`
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE (box kernel test)
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "larcorealg/Geometry/BoxSetSoA.h"
+#include "larcorealg/Geometry/details/BoxKernel.h"
+
+// C/C++ standard libraries
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+//------------------------------------------------------------------------------
+struct Point {
+  double x, y, z;
+  double X() const { return x; }
+  double Y() const { return y; }
+  double Z() const { return z; }
+};
+
+struct Box {
+  double lower[3], upper[3];
+  double MinX() const { return lower[0]; }
+  double MinY() const { return lower[1]; }
+  double MinZ() const { return lower[2]; }
+  double MaxX() const { return upper[0]; }
+  double MaxY() const { return upper[1]; }
+  double MaxZ() const { return upper[2]; }
+};
+
+/// Same as `geo::BoxBoundedGeo::CoordinateContained()`.
+bool coordinateContained(double c, double min, double max, double wiggle)
+{
+  return (c >= (min > 0 ? min / wiggle : min * wiggle)) &&
+         (c <= (max < 0 ? max / wiggle : max * wiggle));
+}
+
+std::vector<Point> makePoints()
+{
+  std::vector<Point> points;
+  for (int i = 0; i < 11; ++i)
+    for (int j = 0; j < 7; ++j)
+      points.push_back({-6.0 + 1.5 * i, -3.0 + 1.0 * j, 0.5 * (i + j) - 1.0});
+  return points;
+}
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(ContainmentTestCase)
+{
+  double const lower[3] = {-2.0, -1.0, 1.0};
+  double const upper[3] = {3.0, 2.0, 4.0};
+  auto const points = makePoints();
+  std::size_t const N = points.size();
+
+  std::vector<double> xs, ys, zs;
+  for (Point const& p : points) {
+    xs.push_back(p.x);
+    ys.push_back(p.y);
+    zs.push_back(p.z);
+  }
+
+  for (double wiggle : {1.0, 1.2, 0.8}) {
+    auto const kernel = geo::details::BoxKernel::wiggled(lower, upper, wiggle);
+    std::vector<std::uint8_t> mask(N, 2), maskSoA(N, 2);
+    kernel.containsPositions(points.begin(), points.end(), mask.data());
+    kernel.containsPositions(N, xs.data(), ys.data(), zs.data(), maskSoA.data());
+
+    std::size_t nIn = 0;
+    for (std::size_t i = 0; i < N; ++i) {
+      Point const& p = points[i];
+      bool const expected = coordinateContained(p.x, lower[0], upper[0], wiggle) &&
+                            coordinateContained(p.y, lower[1], upper[1], wiggle) &&
+                            coordinateContained(p.z, lower[2], upper[2], wiggle);
+      BOOST_TEST_CONTEXT("wiggle " << wiggle << ", point #" << i)
+      {
+        BOOST_TEST(mask[i] == std::uint8_t(expected));
+        BOOST_TEST(maskSoA[i] == std::uint8_t(expected));
+      }
+      nIn += expected;
+    }
+    BOOST_TEST(nIn > 0U);
+    BOOST_TEST(nIn < N);
+  }
+} // BOOST_AUTO_TEST_CASE(ContainmentTestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(IntersectionTestCase)
+{
+  double const lower[3] = {0.0, 0.0, 0.0};
+  double const upper[3] = {2.0, 4.0, 6.0};
+  auto const box = geo::details::BoxKernel::wiggled(lower, upper);
+
+  double const s1[3] = {-1.0, 1.0, 1.0}, d1[3] = {1.0, 0.0, 0.0}; // along x
+  double const s2[3] = {1.0, 2.0, 3.0}, d2[3] = {0.0, -2.0, 0.0}; // from inside
+  double const s3[3] = {-1.0, 5.0, 1.0}, d3[3] = {1.0, 0.0, 0.0}; // misses
+  double const s4[3] = {-1.0, -1.0, -1.0}, d4[3] = {1.0, 1.0, 1.0}; // diagonal
+  std::vector<geo::details::BoxRay> const rays{geo::details::BoxRay::make(s1, d1),
+                                               geo::details::BoxRay::make(s2, d2),
+                                               geo::details::BoxRay::make(s3, d3),
+                                               geo::details::BoxRay::make(s4, d4)};
+
+  std::vector<double> tEnter(rays.size()), tExit(rays.size());
+  BOOST_TEST(box.intersectRays(rays.begin(), rays.end(), tEnter.data(), tExit.data()) == 3U);
+
+  BOOST_TEST(tEnter[0] == 1.0);
+  BOOST_TEST(tExit[0] == 3.0);
+  BOOST_TEST(tEnter[1] == -1.0); // lines extend in both directions
+  BOOST_TEST(tExit[1] == 1.0);
+  BOOST_TEST(tEnter[2] > tExit[2]);
+  BOOST_TEST(tEnter[3] == 1.0);
+  BOOST_TEST(tExit[3] == 3.0); // leaves through the x = 2 face
+
+  // a line parallel to a face and outside of the box
+  double const s5[3] = {1.0, -1.0, 1.0}, d5[3] = {0.0, 0.0, 1.0};
+  double enter, exit;
+  BOOST_TEST(!box.intersect(geo::details::BoxRay::make(s5, d5), enter, exit));
+} // BOOST_AUTO_TEST_CASE(IntersectionTestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(BoxSetTestCase)
+{
+  // a row of 100 unit boxes along x, with a large one covering the first ten
+  std::vector<Box> boxes;
+  for (int i = 0; i < 100; ++i)
+    boxes.push_back({{double(i), 0.0, 0.0}, {i + 1.0, 1.0, 1.0}});
+  boxes.push_back({{10.0, 1.0, 1.0}, {0.0, -1.0, -1.0}}); // unsorted corners
+
+  geo::BoxSetSoA const set{boxes.begin(), boxes.end()};
+  BOOST_TEST(set.size() == boxes.size());
+  BOOST_TEST(set.box(100U).lower[0] == 0.0);
+  BOOST_TEST(set.box(100U).upper[0] == 10.0);
+
+  Point const p{70.5, 0.5, 0.5};
+  BOOST_TEST(set.findFirst(p) == 70U);
+  BOOST_TEST(set.count(p) == 1U);
+  BOOST_TEST(set.count(Point{5.5, 0.5, 0.5}) == 2U);
+  BOOST_TEST(set.count(Point{5.0, 0.5, 0.5}) == 3U); // shared face
+  BOOST_TEST(set.findFirst(Point{5.5, -0.5, 0.5}) == 100U);
+  BOOST_TEST(set.findFirst(Point{50.0, 2.0, 0.5}) == set.size());
+
+  std::vector<std::uint8_t> mask(set.size());
+  set.contains(p, mask.data());
+  for (std::size_t i = 0; i < set.size(); ++i)
+    BOOST_TEST(mask[i] == (i == 70U), "box #" << i);
+
+  double const start[3] = {-1.0, 0.5, 0.5}, dir[3] = {2.0, 0.0, 0.0};
+  auto const ray = geo::BoxSetSoA::Ray_t::make(start, dir);
+  std::vector<double> tEnter(set.size()), tExit(set.size());
+  BOOST_TEST(set.intersect(ray, tEnter.data(), tExit.data()) == set.size());
+  for (std::size_t i = 0; i < set.size(); ++i) {
+    geo::details::BoxKernel const kernel = set.box(i);
+    double enter, exit;
+    kernel.intersect(ray, enter, exit);
+    BOOST_TEST(tEnter[i] == enter, "box #" << i);
+    BOOST_TEST(tExit[i] == exit, "box #" << i);
+  }
+  BOOST_TEST(tEnter[3] == 2.0);
+  BOOST_TEST(tExit[3] == 2.5);
+
+  // a line above all the boxes
+  double const above[3] = {0.0, 3.0, 0.5};
+  BOOST_TEST(set.intersect(geo::BoxSetSoA::Ray_t::make(above, dir), tEnter.data(), tExit.data())
+             == 0U);
+} // BOOST_AUTO_TEST_CASE(BoxSetTestCase)
+
+//------------------------------------------------------------------------------
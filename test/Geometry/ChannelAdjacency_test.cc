@@ -0,0 +1,149 @@
+/**
+ * @file   ChannelAdjacency_test.cc
+ * @brief  Unit test for `geo::ChannelAdjacency`.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/ChannelAdjacency.h`
+ *
+ * The tables are built for a mock detector with two planes of ten wires:
+ * the wires of the first plane have a channel each (`0` to `9`), while the
+ * channels of the second plane (`10` to `14`) have two wires each, five
+ * wires apart. Wire `i` of the first plane crosses wire `j` of the second one
+ * if they are at most two wires apart.
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE (channel adjacency test)
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "larcorealg/Geometry/ChannelAdjacency.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::find()
+#include <vector>
+
+//------------------------------------------------------------------------------
+namespace {
+
+  struct MockWire {
+    unsigned int plane;
+    unsigned int wire;
+  };
+
+  constexpr unsigned int NWires = 10U;
+  constexpr unsigned int NChannels = 15U;
+
+  std::vector<MockWire> channelToWires(raw::ChannelID_t channel)
+  {
+    if (channel < NWires) return {{0U, channel}};
+    unsigned int const j = channel - NWires;
+    return {{1U, j}, {1U, j + 5U}};
+  }
+
+  raw::ChannelID_t wireToChannel(MockWire const& wire)
+  {
+    return (wire.plane == 0U) ? wire.wire : NWires + wire.wire % 5U;
+  }
+
+  std::vector<raw::ChannelID_t> toVector(geo::ChannelAdjacency::ChannelSpan_t channels)
+  {
+    return {channels.begin(), channels.end()};
+  }
+
+  geo::ChannelAdjacency makeAdjacency(unsigned int k)
+  {
+    auto const neighborsOf = [k](raw::ChannelID_t channel, std::vector<raw::ChannelID_t>& out) {
+      for (MockWire const& wire : channelToWires(channel)) {
+        for (unsigned int w = 0; w < NWires; ++w) {
+          if ((w + k >= wire.wire) && (w <= wire.wire + k))
+            out.push_back(wireToChannel({wire.plane, w}));
+        }
+      }
+    };
+    auto const crossingsOf = [](raw::ChannelID_t channel, std::vector<raw::ChannelID_t>& out) {
+      for (MockWire const& wire : channelToWires(channel)) {
+        for (unsigned int w = 0; w < NWires; ++w) {
+          if ((w + 2U >= wire.wire) && (w <= wire.wire + 2U))
+            out.push_back(wireToChannel({1U - wire.plane, w}));
+        }
+      }
+    };
+    return {NChannels, k, neighborsOf, crossingsOf};
+  }
+
+} // local namespace
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(EmptyTestCase)
+{
+  geo::ChannelAdjacency const adjacency;
+  BOOST_TEST(adjacency.empty());
+  BOOST_TEST(adjacency.nChannels() == 0U);
+  BOOST_TEST(adjacency.neighbors(0U).empty());
+  BOOST_TEST(adjacency.crossings(0U).empty());
+  BOOST_TEST(adjacency.heapMemory() == 0U);
+} // BOOST_AUTO_TEST_CASE(EmptyTestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(NeighborsTestCase)
+{
+  geo::ChannelAdjacency const adjacency = makeAdjacency(1U);
+  BOOST_TEST(!adjacency.empty());
+  BOOST_TEST(adjacency.nChannels() == NChannels);
+  BOOST_TEST(adjacency.neighborDistance() == 1U);
+
+  // single wire channels, at the edge and in the middle of the plane
+  BOOST_TEST(toVector(adjacency.neighbors(0U)) == (std::vector<raw::ChannelID_t>{1U}),
+             boost::test_tools::per_element());
+  BOOST_TEST(toVector(adjacency.neighbors(5U)) == (std::vector<raw::ChannelID_t>{4U, 6U}),
+             boost::test_tools::per_element());
+  BOOST_TEST(toVector(adjacency.neighbors(9U)) == (std::vector<raw::ChannelID_t>{8U}),
+             boost::test_tools::per_element());
+
+  // channel 10 has wires 0 and 5: neighbors are wires 1, 4 and 6
+  BOOST_TEST(toVector(adjacency.neighbors(10U)) == (std::vector<raw::ChannelID_t>{11U, 14U}),
+             boost::test_tools::per_element());
+
+  // out of the tables
+  BOOST_TEST(adjacency.neighbors(NChannels).empty());
+  BOOST_TEST(adjacency.neighbors(raw::InvalidChannelID).empty());
+
+  // wider neighborhood
+  geo::ChannelAdjacency const wide = makeAdjacency(3U);
+  BOOST_TEST(toVector(wide.neighbors(0U)) == (std::vector<raw::ChannelID_t>{1U, 2U, 3U}),
+             boost::test_tools::per_element());
+  BOOST_TEST(wide.nNeighbors() > adjacency.nNeighbors());
+} // BOOST_AUTO_TEST_CASE(NeighborsTestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(CrossingsTestCase)
+{
+  geo::ChannelAdjacency const adjacency = makeAdjacency(1U);
+
+  // wire 0 crosses wires 0 to 2 of the other plane
+  BOOST_TEST(toVector(adjacency.crossings(0U)) ==
+               (std::vector<raw::ChannelID_t>{10U, 11U, 12U}),
+             boost::test_tools::per_element());
+  // wire 4 crosses wires 2 to 6, that is all the channels, some twice
+  BOOST_TEST(toVector(adjacency.crossings(4U)) ==
+               (std::vector<raw::ChannelID_t>{10U, 11U, 12U, 13U, 14U}),
+             boost::test_tools::per_element());
+  // channel 14 has wires 4 and 9, crossing wires 2 to 6 and 7 to 9
+  BOOST_TEST(toVector(adjacency.crossings(14U)) ==
+               (std::vector<raw::ChannelID_t>{2U, 3U, 4U, 5U, 6U, 7U, 8U, 9U}),
+             boost::test_tools::per_element());
+
+  // crossing is symmetric
+  std::size_t nCrossings = 0U;
+  for (raw::ChannelID_t channel = 0; channel < NChannels; ++channel) {
+    for (raw::ChannelID_t const other : adjacency.crossings(channel)) {
+      auto const back = adjacency.crossings(other);
+      BOOST_TEST((std::find(back.begin(), back.end(), channel) != back.end()));
+      ++nCrossings;
+    }
+  }
+  BOOST_TEST(nCrossings == adjacency.nCrossings());
+  BOOST_TEST(adjacency.heapMemory() > 0U);
+} // BOOST_AUTO_TEST_CASE(CrossingsTestCase)
+
+//------------------------------------------------------------------------------
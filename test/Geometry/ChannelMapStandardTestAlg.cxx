@@ -20,6 +20,7 @@
 #include <boost/test/unit_test.hpp>
 
 // C/C++ standard libraries
+#include <set>
 #include <string>
 #include <vector>
 
@@ -145,6 +146,16 @@ void geo::ChannelMapStandardTestAlg::TPCsetMappingTest() const
     BOOST_TEST(TPCs.size() == 1U);
     BOOST_TEST(TPCs.front() == tpcID);
 
+    // the view from the prepared table matches the list from the mapping
+    std::vector<geo::TPCID> const mappedTPCs = geom->ChannelMap()->TPCsetToTPCs(tpcsetID);
+    auto const TPCview = geom->TPCsetToTPCIDs(tpcsetID);
+    BOOST_CHECK_EQUAL_COLLECTIONS(
+      TPCview.begin(), TPCview.end(), mappedTPCs.begin(), mappedTPCs.end());
+    geo::GeometryCore::TPCIDlist_t TPClist;
+    geom->TPCsetToTPCs(tpcsetID, TPClist);
+    BOOST_CHECK_EQUAL_COLLECTIONS(
+      TPClist.begin(), TPClist.end(), mappedTPCs.begin(), mappedTPCs.end());
+
     // check that the number of ROP in the TPC set matches the planes in the TPC
     unsigned int const NROPs = geom->NROPs(tpcsetID);
     BOOST_TEST(NROPs == geom->Nplanes(tpcID));
@@ -163,6 +174,24 @@ void geo::ChannelMapStandardTestAlg::TPCsetMappingTest() const
       BOOST_TEST(TPCs.size() == 1U);
       BOOST_TEST(TPCs.front() == tpcID);
 
+      std::vector<geo::TPCID> const mappedTPCs = geom->ChannelMap()->ROPtoTPCs(ropID);
+      auto const TPCview = geom->ROPtoTPCIDs(ropID);
+      BOOST_CHECK_EQUAL_COLLECTIONS(
+        TPCview.begin(), TPCview.end(), mappedTPCs.begin(), mappedTPCs.end());
+      geo::GeometryCore::TPCIDlist_t TPClist;
+      geom->ROPtoTPCs(ropID, TPClist);
+      BOOST_CHECK_EQUAL_COLLECTIONS(
+        TPClist.begin(), TPClist.end(), mappedTPCs.begin(), mappedTPCs.end());
+
+      std::vector<geo::PlaneID> const planes = geom->ChannelMap()->ROPtoWirePlanes(ropID);
+      auto const planeView = geom->ROPtoWirePlaneIDs(ropID);
+      BOOST_CHECK_EQUAL_COLLECTIONS(
+        planeView.begin(), planeView.end(), planes.begin(), planes.end());
+      geo::GeometryCore::PlaneIDlist_t planeList;
+      geom->ROPtoWirePlanes(ropID, planeList);
+      BOOST_CHECK_EQUAL_COLLECTIONS(
+        planeList.begin(), planeList.end(), planes.begin(), planes.end());
+
     } // for channels
 
   } // for TPCs
@@ -199,6 +228,7 @@ void geo::ChannelMapStandardTestAlg::ROPMappingTest() const
   BOOST_TEST(!geom->WirePlaneToROP({}).isValid);
   BOOST_TEST(geom->ROPtoWirePlanes({}).empty());
   BOOST_TEST(geom->ROPtoTPCs({}).empty());
+  BOOST_TEST(geom->ROPtoTPCIDs({}).empty());
   BOOST_TEST(!geom->ChannelToROP(raw::InvalidChannelID).isValid);
   BOOST_TEST(!raw::isValidChannelID(geom->FirstChannelInROP({})));
 
@@ -215,6 +245,9 @@ void geo::ChannelMapStandardTestAlg::ROPMappingTest() const
 
     // check that we don't have ROPs beyond the last one
     BOOST_TEST(!geom->HasROP(NonexistingROPID));
+    // the views from the prepared tables are empty for non-existent ROPs
+    BOOST_TEST(geom->ROPtoTPCIDs(NonexistingROPID).empty());
+    BOOST_TEST(geom->ROPtoWirePlaneIDs(NonexistingROPID).empty());
     // the behaviour of the other methods is undefined for non-existent ROPs
     //  BOOST_TEST(geom->ROPtoTPCs(NonexistingROPID).empty());
     //  BOOST_TEST(geom->ROPtoWirePlanes(NonexistingROPID).empty());
@@ -224,12 +257,21 @@ void geo::ChannelMapStandardTestAlg::ROPMappingTest() const
 
   } // for TPCs
 
+  // the sorted list of plane IDs is the same as the set
+  std::set<geo::PlaneID> const& planeIDset = geom->ChannelMap()->PlaneIDs();
+  auto const sortedPlaneIDs = geom->SortedPlaneIDs();
+  BOOST_CHECK_EQUAL_COLLECTIONS(
+    sortedPlaneIDs.begin(), sortedPlaneIDs.end(), planeIDset.begin(), planeIDset.end());
+  BOOST_TEST(!geom->HasPlaneID({}));
+
   //
   // plane-wide checks
   //
   for (geo::PlaneID const& planeID : geom->IteratePlaneIDs()) {
     BOOST_TEST_MESSAGE("plane: " << std::string(planeID));
 
+    BOOST_TEST(geom->HasPlaneID(planeID));
+
     // check that the ROP of this plane matches the plane itself
     readout::ROPID const ropID = geom->WirePlaneToROP(planeID);
     CheckMatchingPlaneLevelIDs(ropID, planeID);
@@ -259,6 +301,11 @@ void geo::ChannelMapStandardTestAlg::ROPMappingTest() const
     raw::ChannelID_t const FirstChannelID = geom->FirstChannelInROP(ropID);
     BOOST_TEST(raw::isValidChannelID(FirstChannelID) == ropID.isValid);
 
+    // the tabulated range covers the same channels
+    auto const ROPChannels = geom->ROPChannels(ropID);
+    BOOST_TEST(ROPChannels.size() == NChannels);
+    if (!ROPChannels.empty()) BOOST_TEST(*ROPChannels.begin() == FirstChannelID);
+
     // check all the channels:
     for (unsigned int iChannelInROP = 0; iChannelInROP < NChannels; ++iChannelInROP) {
       raw::ChannelID_t const channelID = FirstChannelID + iChannelInROP;
@@ -278,6 +325,36 @@ void geo::ChannelMapStandardTestAlg::ROPMappingTest() const
 
   } // for planes
 
+  // the batch conversion matches the single one, also out of order
+  std::vector<raw::ChannelID_t> channels;
+  for (raw::ChannelID_t channel = 0; channel < geom->Nchannels(); ++channel)
+    channels.push_back(channel);
+  channels.push_back(raw::InvalidChannelID);
+  std::vector<raw::ChannelID_t> const sorted = channels;
+  channels.insert(channels.end(), sorted.rbegin() + 1, sorted.rend());
+  std::vector<readout::ROPID> ROPIDs(channels.size());
+  geom->ChannelsToROPs({channels.data(), channels.data() + channels.size()},
+                       {ROPIDs.data(), ROPIDs.data() + ROPIDs.size()});
+  for (std::size_t i = 0; i < channels.size(); ++i)
+    BOOST_TEST(ROPIDs[i] == geom->ChannelToROP(channels[i]));
+
+  // the routing puts each channel in the group of its ROP, in input order
+  geo::ChannelRouting const routing =
+    geom->RouteChannels({channels.data(), channels.data() + channels.size()});
+  BOOST_TEST(routing.nChannels() == channels.size());
+  std::size_t iROP = 0U, nRouted = 0U;
+  for (readout::ROPID const& ropID : geom->IterateROPIDs()) {
+    BOOST_TEST_REQUIRE(iROP < routing.nROPs());
+    BOOST_TEST(routing.ROPID(iROP) == ropID);
+    for (geo::ChannelRouting::Index_t const i : routing.indices(iROP))
+      BOOST_TEST(ROPIDs[i] == ropID);
+    nRouted += routing.nChannelsInROP(iROP++);
+  } // for
+  BOOST_TEST(routing.nROPs() == iROP);
+  for (geo::ChannelRouting::Index_t const i : routing.unrouted())
+    BOOST_TEST(!ROPIDs[i].isValid);
+  BOOST_TEST(nRouted + routing.unrouted().size() == channels.size());
+
 } // ChannelMapStandardTestAlg::ROPMappingTest()
 
 //-----------------------------------------------------------------------------
@@ -292,6 +369,8 @@ void geo::ChannelMapStandardTestAlg::ChannelMappingTest() const
    *
    *     unsigned int HasChannel(raw::ChannelID_t) const
    *
+   *     the optical channel mapping (default implementation)
+   *
    * The rest is not tested here.
    */
 
@@ -312,6 +391,35 @@ void geo::ChannelMapStandardTestAlg::ChannelMappingTest() const
   } // for channels
   BOOST_TEST(!geom->HasChannel((raw::ChannelID_t)NChannels));
 
+  //
+  // optical channels: the tables of GeometryCore match the mapping
+  //
+  geo::ChannelMapAlg const& channelMap = *(geom->ChannelMap());
+  unsigned int const NOpDets = geom->NOpDets();
+  BOOST_TEST(geom->NOpChannels() == channelMap.NOpChannels(NOpDets));
+  BOOST_TEST(geom->MaxOpChannel() == channelMap.MaxOpChannel(NOpDets));
+  std::vector<unsigned int> opChannels;
+  for (unsigned int opChannel = 0; opChannel <= geom->MaxOpChannel(); ++opChannel) {
+    bool const isValid = channelMap.IsValidOpChannel(opChannel, NOpDets);
+    BOOST_TEST(geom->IsValidOpChannel(opChannel) == isValid);
+    if (!isValid) continue;
+    opChannels.push_back(opChannel);
+    BOOST_TEST(geom->OpDetFromOpChannel(opChannel) == channelMap.OpDetFromOpChannel(opChannel));
+    BOOST_TEST(geom->HardwareChannelFromOpChannel(opChannel) ==
+               channelMap.HardwareChannelFromOpChannel(opChannel));
+  } // for optical channels
+  for (unsigned int opDet = 0; opDet < NOpDets; ++opDet) {
+    unsigned int const NHardwareChannels = channelMap.NOpHardwareChannels(opDet);
+    BOOST_TEST(geom->NOpHardwareChannels(opDet) == NHardwareChannels);
+    for (unsigned int hwChannel = 0; hwChannel < NHardwareChannels; ++hwChannel)
+      BOOST_TEST(geom->OpChannel(opDet, hwChannel) == channelMap.OpChannel(opDet, hwChannel));
+  } // for optical detectors
+  std::vector<unsigned int> opDets(opChannels.size());
+  geom->OpDetsFromOpChannels({opChannels.data(), opChannels.data() + opChannels.size()},
+                             {opDets.data(), opDets.data() + opDets.size()});
+  for (std::size_t i = 0; i < opChannels.size(); ++i)
+    BOOST_TEST(opDets[i] == channelMap.OpDetFromOpChannel(opChannels[i]));
+
 } // ChannelMapStandardTestAlg::ChannelMappingTest()
 
 //-----------------------------------------------------------------------------
@@ -0,0 +1,126 @@
+/**
+ * @file   ChannelRouting_test.cc
+ * @brief  Unit test for `geo::ChannelRouting`.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/ChannelRouting.h`
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE (channel routing test)
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "larcorealg/Geometry/ChannelRouting.h"
+
+// C/C++ standard libraries
+#include <random>
+#include <vector>
+
+//------------------------------------------------------------------------------
+namespace {
+
+  using Index_t = geo::ChannelRouting::Index_t;
+
+  // three ROPs: channels 0-3 in the first, 4-5 in the third, 8-9 in the second;
+  // channels 6 and 7 have no ROP
+  std::vector<Index_t> const ChannelROPs{
+    0U, 0U, 0U, 0U, 2U, 2U, geo::ChannelRouting::NoROP, geo::ChannelRouting::NoROP, 1U, 1U};
+  std::vector<readout::ROPID> const ROPIDs{{0, 0, 0}, {0, 0, 1}, {0, 1, 0}};
+
+  void route(geo::ChannelRouting& routing, std::vector<raw::ChannelID_t> const& channels)
+  {
+    routing.route({channels.data(), channels.data() + channels.size()},
+                  {ChannelROPs.data(), ChannelROPs.data() + ChannelROPs.size()},
+                  {ROPIDs.data(), ROPIDs.data() + ROPIDs.size()});
+  }
+
+  std::vector<Index_t> toVector(geo::ChannelRouting::IndexSpan_t indices)
+  {
+    return {indices.begin(), indices.end()};
+  }
+
+} // local namespace
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(Empty_test)
+{
+  geo::ChannelRouting routing;
+  BOOST_TEST(routing.empty());
+  BOOST_TEST(routing.nROPs() == 0U);
+
+  route(routing, {});
+  BOOST_TEST(routing.empty());
+  BOOST_TEST(routing.nROPs() == 3U);
+  for (std::size_t iROP = 0; iROP < routing.nROPs(); ++iROP)
+    BOOST_TEST(routing.indices(iROP).empty());
+  BOOST_TEST(routing.unrouted().empty());
+} // Empty_test
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(Grouping_test)
+{
+  std::vector<raw::ChannelID_t> const channels{
+    9U, 0U, 4U, 7U, 1U, raw::InvalidChannelID, 8U, 5U, 42U, 3U, 0U};
+
+  geo::ChannelRouting routing;
+  route(routing, channels);
+  BOOST_TEST(routing.nChannels() == channels.size());
+  BOOST_TEST(routing.nROPs() == 3U);
+  for (std::size_t iROP = 0; iROP < routing.nROPs(); ++iROP)
+    BOOST_TEST(routing.ROPID(iROP) == ROPIDs[iROP]);
+
+  // positions are in input order within each group
+  BOOST_TEST(toVector(routing.indices(0U)) == (std::vector<Index_t>{1U, 4U, 9U, 10U}));
+  BOOST_TEST(toVector(routing.indices(1U)) == (std::vector<Index_t>{0U, 6U}));
+  BOOST_TEST(toVector(routing.indices(2U)) == (std::vector<Index_t>{2U, 7U}));
+  BOOST_TEST(toVector(routing.unrouted()) == (std::vector<Index_t>{3U, 5U, 8U}));
+  BOOST_TEST(routing.nChannelsInROP(0U) == 4U);
+
+  BOOST_TEST(routing.ROPindexOf(0U) == 1U);
+  BOOST_TEST(routing.ROPindexOf(2U) == 2U);
+  BOOST_TEST(routing.ROPindexOf(3U) == geo::ChannelRouting::NoROP);
+  BOOST_TEST(routing.ROPindexOf(5U) == geo::ChannelRouting::NoROP);
+
+  // a new routing replaces the previous one
+  route(routing, {5U, 6U});
+  BOOST_TEST(routing.nChannels() == 2U);
+  BOOST_TEST(routing.indices(0U).empty());
+  BOOST_TEST(routing.indices(1U).empty());
+  BOOST_TEST(toVector(routing.indices(2U)) == (std::vector<Index_t>{0U}));
+  BOOST_TEST(toVector(routing.unrouted()) == (std::vector<Index_t>{1U}));
+} // Grouping_test
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(Random_test)
+{
+  std::mt19937 engine{12345U};
+  std::uniform_int_distribution<raw::ChannelID_t> channelDist{0U, 11U};
+  std::vector<raw::ChannelID_t> channels(10000U);
+  for (raw::ChannelID_t& channel : channels)
+    channel = channelDist(engine);
+
+  geo::ChannelRouting routing;
+  route(routing, channels);
+
+  // every position appears exactly once, in the group of its channel
+  std::vector<unsigned int> seen(channels.size(), 0U);
+  for (std::size_t iROP = 0; iROP < routing.nROPs(); ++iROP) {
+    Index_t previous = 0U;
+    bool first = true;
+    for (Index_t const i : routing.indices(iROP)) {
+      ++seen[i];
+      BOOST_TEST(ChannelROPs[channels[i]] == iROP);
+      BOOST_TEST(routing.ROPindexOf(i) == iROP);
+      BOOST_TEST((first || (i > previous)));
+      previous = i;
+      first = false;
+    }
+  }
+  for (Index_t const i : routing.unrouted()) {
+    ++seen[i];
+    BOOST_TEST(((channels[i] >= ChannelROPs.size()) ||
+                (ChannelROPs[channels[i]] == geo::ChannelRouting::NoROP)));
+  }
+  for (unsigned int const count : seen)
+    BOOST_TEST(count == 1U);
+} // Random_test
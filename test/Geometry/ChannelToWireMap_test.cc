@@ -0,0 +1,172 @@
+/**
+ * @file   ChannelToWireMap_test.cc
+ * @brief  Unit test and benchmark for `geo::details::ChannelToWireMap`.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/details/ChannelToWireMap.h`
+ *
+ * The benchmark compares the lookup with the nested loop over cryostats, TPCs
+ * and planes previously used by `geo::ChannelMapStandardAlg::ChannelToWire()`,
+ * on a synthetic layout with 150 TPCs. The timing is only printed, not checked.
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE (channel to wire map test)
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "larcorealg/Geometry/details/ChannelToWireMap.h"
+#include "larcorealg/TestUtils/StopWatch.h"
+#include "larcoreobj/SimpleTypesAndConstants/RawTypes.h"
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+
+// C/C++ standard libraries
+#include <array>
+#include <iostream>
+#include <vector>
+
+//------------------------------------------------------------------------------
+/// Channel layout with the same information the standard channel mapping had.
+struct ReferenceChannelLayout {
+
+  template <typename T>
+  using PlaneInfoMap_t = std::vector<std::vector<std::vector<T>>>;
+
+  PlaneInfoMap_t<raw::ChannelID_t> firstChannelInThisPlane;
+  PlaneInfoMap_t<raw::ChannelID_t> firstChannelInNextPlane;
+
+  raw::ChannelID_t topChannel = 0;
+
+  ReferenceChannelLayout(unsigned int nCryostats,
+                         unsigned int nTPCs,
+                         std::vector<unsigned int> const& wiresPerPlane,
+                         geo::details::ChannelToWireMap& map)
+  {
+    firstChannelInThisPlane.resize(nCryostats);
+    firstChannelInNextPlane.resize(nCryostats);
+    for (unsigned int c = 0; c < nCryostats; ++c) {
+      firstChannelInThisPlane[c].resize(nTPCs);
+      firstChannelInNextPlane[c].resize(nTPCs);
+      for (unsigned int t = 0; t < nTPCs; ++t) {
+        for (unsigned int p = 0; p < wiresPerPlane.size(); ++p) {
+          firstChannelInThisPlane[c][t].push_back(topChannel);
+          map.addPlane(geo::PlaneID{c, t, p}, topChannel, wiresPerPlane[p]);
+          topChannel += wiresPerPlane[p];
+          firstChannelInNextPlane[c][t].push_back(topChannel);
+        } // for planes
+      }   // for TPCs
+    }     // for cryostats
+  }       // ReferenceChannelLayout()
+
+  /// The algorithm formerly in `geo::ChannelMapStandardAlg::ChannelToWire()`.
+  geo::WireID ChannelToWire(raw::ChannelID_t channel) const
+  {
+    for (unsigned int c = 0; c != firstChannelInNextPlane.size(); ++c) {
+      for (unsigned int t = 0; t != firstChannelInNextPlane[c].size(); ++t) {
+        for (unsigned int p = 0; p != firstChannelInNextPlane[c][t].size(); ++p) {
+          if (channel < firstChannelInNextPlane[c][t][p])
+            return {c, t, p, channel - firstChannelInThisPlane[c][t][p]};
+        } // for planes
+      }   // for TPCs
+    }     // for cryostats
+    return {};
+  } // ChannelToWire()
+
+}; // struct ReferenceChannelLayout
+
+//------------------------------------------------------------------------------
+void ChannelToWireMapBasicTest()
+{
+  geo::details::ChannelToWireMap map;
+  BOOST_TEST(map.empty());
+  BOOST_TEST(map.size() == 0U);
+  BOOST_TEST(map.endChannel() == 0U);
+  BOOST_TEST(!map.find(0U));
+
+  map.addPlane(geo::PlaneID{0, 0, 0}, 0U, 100U);
+  map.addPlane(geo::PlaneID{0, 0, 1}, 100U, 120U);
+  map.addPlane(geo::PlaneID{0, 1, 0}, 300U, 50U); // gap in [ 220, 300 [
+
+  BOOST_TEST(!map.empty());
+  BOOST_TEST(map.size() == 3U);
+  BOOST_TEST(map.endChannel() == 350U);
+
+  BOOST_TEST(map.wireOf(0U) == (geo::WireID{0, 0, 0, 0}));
+  BOOST_TEST(map.wireOf(99U) == (geo::WireID{0, 0, 0, 99}));
+  BOOST_TEST(map.wireOf(100U) == (geo::WireID{0, 0, 1, 0}));
+  BOOST_TEST(map.wireOf(219U) == (geo::WireID{0, 0, 1, 119}));
+  BOOST_TEST(!map.wireOf(220U).isValid);
+  BOOST_TEST(!map.wireOf(299U).isValid);
+  BOOST_TEST(map.wireOf(300U) == (geo::WireID{0, 1, 0, 0}));
+  BOOST_TEST(map.wireOf(349U) == (geo::WireID{0, 1, 0, 49}));
+  BOOST_TEST(!map.wireOf(350U).isValid);
+  BOOST_TEST(!map.wireOf(raw::InvalidChannelID).isValid);
+
+  auto const* plane = map.find(150U);
+  BOOST_TEST_REQUIRE(plane);
+  BOOST_TEST(plane->planeID == (geo::PlaneID{0, 0, 1}));
+  BOOST_TEST(plane->firstChannel == 100U);
+  BOOST_TEST(plane->endChannel == 220U);
+  BOOST_TEST(plane->nChannels() == 120U);
+
+  map.clear();
+  BOOST_TEST(map.empty());
+  BOOST_TEST(!map.find(0U));
+
+} // ChannelToWireMapBasicTest()
+
+//------------------------------------------------------------------------------
+void ChannelToWireMapBenchmark(unsigned int nCryostats,
+                               unsigned int nTPCs,
+                               unsigned int nRepetitions)
+{
+  geo::details::ChannelToWireMap map;
+  ReferenceChannelLayout const reference{nCryostats, nTPCs, {800U, 800U, 960U}, map};
+  raw::ChannelID_t const nChannels = reference.topChannel;
+
+  BOOST_TEST(map.size() == nCryostats * nTPCs * 3U);
+  BOOST_TEST(map.endChannel() == nChannels);
+
+  // correctness check against the reference
+  for (raw::ChannelID_t channel = 0; channel < nChannels; ++channel)
+    BOOST_TEST(map.wireOf(channel) == reference.ChannelToWire(channel));
+  BOOST_TEST(!map.wireOf(nChannels).isValid);
+
+  // timing; the sum is there to keep the compiler from optimizing the loop out
+  testing::StopWatch<> timer;
+  unsigned long long referenceSum = 0;
+  for (unsigned int i = 0; i < nRepetitions; ++i) {
+    for (raw::ChannelID_t channel = 0; channel < nChannels; ++channel)
+      referenceSum += reference.ChannelToWire(channel).Wire;
+  }
+  double const referenceTime = timer.elapsed();
+
+  timer.restart();
+  unsigned long long mapSum = 0;
+  for (unsigned int i = 0; i < nRepetitions; ++i) {
+    for (raw::ChannelID_t channel = 0; channel < nChannels; ++channel)
+      mapSum += map.wireOf(channel).Wire;
+  }
+  double const mapTime = timer.elapsed();
+
+  BOOST_TEST(mapSum == referenceSum);
+
+  double const nQueries = double(nChannels) * nRepetitions;
+  std::cout << "ChannelToWire on " << nCryostats << " x " << nTPCs << " TPCs (" << nChannels
+            << " channels, " << nRepetitions << " passes):"
+            << "\n  nested loop: " << (referenceTime / nQueries * 1e9) << " ns/channel"
+            << "\n  lookup map:  " << (mapTime / nQueries * 1e9) << " ns/channel" << std::endl;
+
+} // ChannelToWireMapBenchmark()
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(ChannelToWireMapTestCase)
+{
+  ChannelToWireMapBasicTest();
+}
+
+BOOST_AUTO_TEST_CASE(ChannelToWireMapBenchmarkCase)
+{
+  ChannelToWireMapBenchmark(2U, 75U, 2U);
+}
+
+//------------------------------------------------------------------------------
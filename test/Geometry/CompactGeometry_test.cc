@@ -0,0 +1,62 @@
+/**
+ * @file   CompactGeometry_test.cc
+ * @brief  Unit test for the records of `geo::CompactGeometry`.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/CompactGeometry.h`
+ *
+ * The layout of the records and the single precision decompositions of a
+ * plane are checked against double precision computations.
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE (compact geometry test)
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "larcorealg/Geometry/CompactGeometry.h"
+
+// C/C++ standard libraries
+#include <cmath>
+#include <cstddef> // offsetof
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(LayoutTestCase)
+{
+  // members are grouped in four words
+  BOOST_TEST(sizeof(geo::compact::TPC_t) == 80U);
+  BOOST_TEST(sizeof(geo::compact::Plane_t) == 64U);
+  BOOST_TEST(offsetof(geo::compact::TPC_t, max) == 16U);
+  BOOST_TEST(offsetof(geo::compact::TPC_t, driftDir) == 64U);
+  BOOST_TEST(offsetof(geo::compact::Plane_t, normal) == 16U);
+  BOOST_TEST(offsetof(geo::compact::Plane_t, thetaZ) == 48U);
+}
+
+BOOST_AUTO_TEST_CASE(DecompositionTestCase)
+{
+  // plane at x = 250 cm, wires at 60 degrees, 0.3 cm pitch, first wire at z = 5 m
+  double const pitch = 0.3;
+  double const dir[3] = {0.0, -std::sqrt(3.0) / 2.0, 0.5};
+  double const origin[3] = {250.0, 0.0, 500.0};
+
+  geo::compact::Plane_t plane{};
+  for (std::size_t k = 0; k < 3U; ++k)
+    plane.wireCoordDir[k] = dir[k] / pitch;
+  plane.wireCoordOffset =
+    -(origin[0] * dir[0] + origin[1] * dir[1] + origin[2] * dir[2]) / pitch;
+  plane.normal[0] = -1.0f;
+  plane.normalOffset = 250.0f;
+  plane.wirePitch = pitch;
+
+  for (double const x : {0.0, 100.0, 249.0})
+    BOOST_TEST(plane.distance(x, 30.0f, 700.0f) == 250.0 - x, boost::test_tools::tolerance(1e-5));
+
+  // a point on wire #1000 (plus a displacement along the wire)
+  double const point[3] = {10.0,
+                           1000.0 * pitch * dir[1] + 40.0 * 0.5,
+                           500.0 + 1000.0 * pitch * dir[2] + 40.0 * std::sqrt(3.0) / 2.0};
+  float const c = plane.wireCoordinate(point[0], point[1], point[2]);
+  // better than one micron
+  BOOST_TEST(std::abs(c - 1000.0) * pitch < 1e-4);
+}
+
+//------------------------------------------------------------------------------
@@ -30,8 +30,11 @@
 #include "TVector3.h"
 
 // C/C++ standard libraries
+#include <cmath>   // std::abs()
+#include <cstddef> // std::size_t
 #include <ostream>
 #include <utility> // std::move()
+#include <vector>
 
 using boost::test_tools::tolerance;
 
@@ -359,11 +362,110 @@ void StandardDecomposerTest()
 
 } // StandardDecomposerTest<>()
 
+//------------------------------------------------------------------------------
+template <typename Vector, typename Point, typename Proj>
+void BatchDecomposerTest()
+{
+
+  //
+  // Test of the batch methods of geo::Decomposer<>, against the single ones
+  //
+  using Decomposer_t = geo::Decomposer<Vector, Point, Proj>;
+
+  using Vector3D_t = typename Decomposer_t::Vector_t;
+  using Point3D_t = typename Decomposer_t::Point_t;
+  using AffinePlaneBase_t = typename Decomposer_t::AffinePlaneBase_t;
+
+  // absolute tolerance, since some of the components are null
+  auto const close = [](double a, double b) { return std::abs(a - b) < 1e-12; };
+
+  // a slanted base
+  AffinePlaneBase_t const base(
+    Point3D_t{-5.0, 10.0, 15.0}, Vector3D_t{0.0, 0.6, 0.8}, Vector3D_t{1.0, 0.0, 0.0});
+  Decomposer_t const decomp(base);
+
+  std::size_t const N = 13U;
+  std::vector<Point3D_t> points;
+  std::vector<Vector3D_t> vectors;
+  std::vector<double> x, y, z;
+  for (std::size_t i = 0; i < N; ++i) {
+    double const c[3] = {0.5 * i - 2.0, 3.0 - 0.25 * i, 0.125 * i * i};
+    points.emplace_back(c[0], c[1], c[2]);
+    vectors.emplace_back(c[2], c[0], c[1]);
+    x.push_back(c[0]);
+    y.push_back(c[1]);
+    z.push_back(c[2]);
+  } // for
+
+  std::vector<double> main(N), secondary(N), normal(N);
+  std::vector<double> projMain(N), projSecondary(N);
+  std::vector<double> arrMain(N), arrSecondary(N), arrNormal(N);
+  std::vector<double> vMain(N), vSecondary(N), vNormal(N);
+  decomp.DecomposePoints(
+    util::make_const_span(points), main.data(), secondary.data(), normal.data());
+  decomp.ProjectPointsOnPlane(
+    util::make_const_span(points), projMain.data(), projSecondary.data());
+  decomp.DecomposePoints(
+    N, x.data(), y.data(), z.data(), arrMain.data(), arrSecondary.data(), arrNormal.data());
+  decomp.DecomposeVectors(
+    util::make_const_span(vectors), vMain.data(), vSecondary.data(), vNormal.data());
+
+  std::vector<double> backX(N), backY(N), backZ(N);
+  decomp.ComposePoints(
+    N, main.data(), secondary.data(), normal.data(), backX.data(), backY.data(), backZ.data());
+  std::vector<double> planeX(N), planeY(N), planeZ(N);
+  decomp.ComposePoints(
+    N, main.data(), secondary.data(), nullptr, planeX.data(), planeY.data(), planeZ.data());
+  std::vector<double> vBackX(N), vBackY(N), vBackZ(N);
+  decomp.ComposeVectors(N,
+                        vMain.data(),
+                        vSecondary.data(),
+                        vNormal.data(),
+                        vBackX.data(),
+                        vBackY.data(),
+                        vBackZ.data());
+
+  for (std::size_t i = 0; i < N; ++i) {
+    BOOST_TEST_CONTEXT("point #" << i)
+    {
+      auto const decomposed = decomp.DecomposePoint(points[i]);
+      BOOST_TEST(close(main[i], decomposed.projection.X()));
+      BOOST_TEST(close(secondary[i], decomposed.projection.Y()));
+      BOOST_TEST(close(normal[i], decomposed.distance));
+      BOOST_TEST(projMain[i] == main[i]);
+      BOOST_TEST(projSecondary[i] == secondary[i]);
+      BOOST_TEST(arrMain[i] == main[i]);
+      BOOST_TEST(arrSecondary[i] == secondary[i]);
+      BOOST_TEST(arrNormal[i] == normal[i]);
+
+      auto const vDecomposed = decomp.DecomposeVector(vectors[i]);
+      BOOST_TEST(close(vMain[i], vDecomposed.projection.X()));
+      BOOST_TEST(close(vSecondary[i], vDecomposed.projection.Y()));
+      BOOST_TEST(close(vNormal[i], vDecomposed.distance));
+
+      BOOST_TEST(close(backX[i], x[i]));
+      BOOST_TEST(close(backY[i], y[i]));
+      BOOST_TEST(close(backZ[i], z[i]));
+
+      auto const onPlane = decomp.ComposePoint(0.0, decomposed.projection);
+      BOOST_TEST(close(planeX[i], onPlane.X()));
+      BOOST_TEST(close(planeY[i], onPlane.Y()));
+      BOOST_TEST(close(planeZ[i], onPlane.Z()));
+
+      BOOST_TEST(close(vBackX[i], vectors[i].X()));
+      BOOST_TEST(close(vBackY[i], vectors[i].Y()));
+      BOOST_TEST(close(vBackZ[i], vectors[i].Z()));
+    }
+  } // for
+
+} // BatchDecomposerTest<>()
+
 //------------------------------------------------------------------------------
 BOOST_AUTO_TEST_CASE(TVectorDecomposerTestCase)
 {
 
   StandardDecomposerTest<TVector3, TVector3, TVector2>();
+  BatchDecomposerTest<TVector3, TVector3, TVector2>();
 
 } // BOOST_AUTO_TEST_CASE(TVectorDecomposerTestCase)
 
@@ -375,5 +477,6 @@ BOOST_AUTO_TEST_CASE(GenVectorDecomposerTestCase)
   using Projection_t = ROOT::Math::DisplacementVector2D<ROOT::Math::Cartesian2D<double>>;
 
   StandardDecomposerTest<Vector_t, Point_t, Projection_t>();
+  BatchDecomposerTest<Vector_t, Point_t, Projection_t>();
 
 } // BOOST_AUTO_TEST_CASE(GenVectorDecomposerTestCase)
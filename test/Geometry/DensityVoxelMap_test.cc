@@ -0,0 +1,150 @@
+/**
+ * @file   DensityVoxelMap_test.cc
+ * @brief  Unit test for `geo::DensityVoxelMap`.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/DensityVoxelMap.h`
+ *
+ * The column density from the voxel walk is compared with the analytic value
+ * on simple layouts, and with a fine numerical integration on random segments.
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE (density voxel map test)
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "larcorealg/Geometry/DensityVoxelMap.h"
+
+// C/C++ standard libraries
+#include <array>
+#include <cmath>
+#include <limits>
+#include <random>
+
+using Coords_t = std::array<double, 3U>;
+
+//------------------------------------------------------------------------------
+/// Map on [ -100, 100 ] x [ -50, 50 ] x [ 0, 300 ], density 1 at negative x,
+/// 2 at positive x; the voxels at `x` around zero are "mixed".
+geo::DensityVoxelMap makeTwoHalvesMap()
+{
+  geo::DensityVoxelMap map{{-100.0, -50.0, 0.0}, {100.0, 50.0, 300.0}, {20U, 10U, 30U}};
+  for (std::size_t ix = 0; ix < map.nVoxels(0); ++ix) {
+    for (std::size_t iy = 0; iy < map.nVoxels(1); ++iy) {
+      for (std::size_t iz = 0; iz < map.nVoxels(2); ++iz) {
+        float const density = (map.voxelCenter(ix, iy, iz)[0] < 0.0) ? 1.0f : 2.0f;
+        map.setVoxel(ix, iy, iz, {density, density, density});
+      }
+    }
+  }
+  return map;
+} // makeTwoHalvesMap()
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(EmptyMapTestCase)
+{
+  geo::DensityVoxelMap const map;
+  BOOST_TEST(map.empty());
+  BOOST_TEST(!map.contains(0.0, 0.0, 0.0));
+  BOOST_TEST(map.density(0.0, 0.0, 0.0) == 0.0);
+  auto const column = map.columnDensity(Coords_t{0.0, 0.0, 0.0}, Coords_t{3.0, 4.0, 0.0});
+  BOOST_TEST(column.value == 0.0);
+  BOOST_TEST(column.outsideLength == 5.0);
+
+  geo::DensityVoxelMap const flat{{0.0, 0.0, 0.0}, {1.0, 0.0, 1.0}, {2U, 2U, 2U}};
+  BOOST_TEST(flat.empty());
+}
+
+BOOST_AUTO_TEST_CASE(TwoHalvesTestCase)
+{
+  geo::DensityVoxelMap const map = makeTwoHalvesMap();
+  BOOST_TEST(map.size() == 20U * 10U * 30U);
+  BOOST_TEST(map.voxelSize(0) == 10.0);
+  BOOST_TEST(map.density(-50.0, 0.0, 100.0) == 1.0);
+  BOOST_TEST(map.density(50.0, 0.0, 100.0) == 2.0);
+  BOOST_TEST(map.density(150.0, 0.0, 100.0) == 0.0);
+  double const nan = std::numeric_limits<double>::quiet_NaN();
+  BOOST_TEST(!map.contains(nan, 0.0, 0.0));
+
+  // along z, in each half
+  auto column = map.columnDensity(Coords_t{-55.0, 3.0, 10.0}, Coords_t{-55.0, 3.0, 110.0});
+  BOOST_TEST(column.value == 100.0, boost::test_tools::tolerance(1e-9));
+  BOOST_TEST(column.outsideLength == 0.0, boost::test_tools::tolerance(1e-9));
+  column = map.columnDensity(Coords_t{55.0, 3.0, 110.0}, Coords_t{55.0, 3.0, 10.0});
+  BOOST_TEST(column.value == 200.0, boost::test_tools::tolerance(1e-9));
+
+  // across the halves, and out of the map on both sides
+  column = map.columnDensity(Coords_t{-150.0, 0.0, 50.0}, Coords_t{150.0, 0.0, 50.0});
+  BOOST_TEST(column.value == 300.0, boost::test_tools::tolerance(1e-9));
+  BOOST_TEST(column.min == 300.0, boost::test_tools::tolerance(1e-9));
+  BOOST_TEST(column.max == 300.0, boost::test_tools::tolerance(1e-9));
+  BOOST_TEST(column.outsideLength == 100.0, boost::test_tools::tolerance(1e-9));
+
+  // along a voxel boundary, and starting on one
+  column = map.columnDensity(Coords_t{-20.0, 10.0, 0.0}, Coords_t{-20.0, 10.0, 300.0});
+  BOOST_TEST(column.value == 300.0, boost::test_tools::tolerance(1e-9));
+  column = map.columnDensity(Coords_t{0.0, 0.0, 40.0}, Coords_t{-30.0, 0.0, 40.0});
+  BOOST_TEST(column.value == 30.0, boost::test_tools::tolerance(1e-9));
+
+  // diagonal through the corner of the map
+  column = map.columnDensity(Coords_t{-100.0, -50.0, 0.0}, Coords_t{100.0, 50.0, 300.0});
+  double const diagonal = std::sqrt(200.0 * 200.0 + 100.0 * 100.0 + 300.0 * 300.0);
+  BOOST_TEST(column.value == 1.5 * diagonal, boost::test_tools::tolerance(1e-9));
+
+  // completely outside
+  column = map.columnDensity(Coords_t{-150.0, 60.0, 50.0}, Coords_t{150.0, 60.0, 50.0});
+  BOOST_TEST(column.value == 0.0);
+  BOOST_TEST(column.outsideLength == 300.0);
+}
+
+BOOST_AUTO_TEST_CASE(RandomSegmentsTestCase)
+{
+  // a map with a different density in each voxel, and wide bounds
+  geo::DensityVoxelMap map{{-100.0, -50.0, 0.0}, {100.0, 50.0, 300.0}, {7U, 5U, 11U}};
+  std::mt19937 engine{13579};
+  std::uniform_real_distribution<float> densityDist{0.5f, 3.0f};
+  for (std::size_t ix = 0; ix < map.nVoxels(0); ++ix) {
+    for (std::size_t iy = 0; iy < map.nVoxels(1); ++iy) {
+      for (std::size_t iz = 0; iz < map.nVoxels(2); ++iz) {
+        float const density = densityDist(engine);
+        map.setVoxel(ix, iy, iz, {density, 0.5f * density, 2.0f * density});
+      }
+    }
+  }
+
+  std::uniform_real_distribution<double> coord[3] = {
+    std::uniform_real_distribution<double>{-150.0, 150.0},
+    std::uniform_real_distribution<double>{-80.0, 80.0},
+    std::uniform_real_distribution<double>{-50.0, 350.0}};
+  for (int i = 0; i < 200; ++i) {
+    Coords_t const p1{coord[0](engine), coord[1](engine), coord[2](engine)};
+    Coords_t const p2{coord[0](engine), coord[1](engine), coord[2](engine)};
+    auto const column = map.columnDensity(p1, p2);
+
+    // midpoint rule with many steps
+    unsigned int const nSteps = 100000U;
+    double const length = std::hypot(p2[0] - p1[0], p2[1] - p1[1], p2[2] - p1[2]);
+    double expected = 0.0, expectedOutside = 0.0;
+    for (unsigned int iStep = 0; iStep < nSteps; ++iStep) {
+      double const f = (iStep + 0.5) / nSteps;
+      double const x = p1[0] + f * (p2[0] - p1[0]);
+      double const y = p1[1] + f * (p2[1] - p1[1]);
+      double const z = p1[2] + f * (p2[2] - p1[2]);
+      if (map.contains(x, y, z))
+        expected += map.density(x, y, z);
+      else
+        expectedOutside += 1.0;
+    }
+    expected *= length / nSteps;
+    expectedOutside *= length / nSteps;
+
+    // each step crossing a boundary may be misattributed
+    double const tolerance = 30.0 * 3.0 * length / nSteps + 1e-9;
+    BOOST_TEST(std::abs(column.value - expected) <= tolerance);
+    BOOST_TEST(std::abs(column.outsideLength - expectedOutside) <= 30.0 * length / nSteps + 1e-9);
+    BOOST_TEST(column.min <= column.value);
+    BOOST_TEST(column.max >= column.value);
+  } // for segments
+}
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,173 @@
+/**
+ * @file   DeviceGeometry_test.cc
+ * @brief  Unit test for the device geometry buffer and its queries.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/DeviceGeometry.h`,
+ *         `larcorealg/Geometry/DeviceGeometryBuffer.h`
+ *
+ * A buffer is made out of two TPCs with two planes each, and the position
+ * queries are checked on the host; corrupted buffers are checked to be
+ * rejected.
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE (device geometry test)
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "larcorealg/Geometry/DeviceGeometry.h"
+#include "larcorealg/Geometry/DeviceGeometryBuffer.h"
+
+// framework libraries
+#include "cetlib_except/exception.h"
+
+// C/C++ standard libraries
+#include <cstdint>
+#include <vector>
+
+//------------------------------------------------------------------------------
+/// Two TPCs side by side in x, with planes at their outer faces; wires along
+/// y with 0.5 cm pitch (first plane) or along z with 1 cm pitch (second).
+geo::CompactGeometry makeGeometry()
+{
+  geo::CompactGeometry geom;
+  for (std::uint32_t t = 0; t < 2U; ++t) {
+    float const x0 = (t == 0) ? -100.0f : 0.0f;
+    geo::compact::TPC_t& tpc = geom.TPCs.emplace_back();
+    tpc = geo::compact::TPC_t{{x0, -50.0f, 0.0f},
+                              2U * t,
+                              {x0 + 100.0f, 50.0f, 100.0f},
+                              2U,
+                              {x0, -50.0f, 0.0f},
+                              0U,
+                              {x0 + 100.0f, 50.0f, 100.0f},
+                              (t == 0) ? -1 : 1,
+                              {(t == 0) ? -1.0f : 1.0f, 0.0f, 0.0f},
+                              t};
+    // wire coordinate along z: 200 wires from z = 0.25 cm
+    geo::compact::Plane_t& zPlane = geom.planes.emplace_back();
+    zPlane = geo::compact::Plane_t{{0.0f, 0.0f, 2.0f},
+                                   -0.5f,
+                                   {1.0f, 0.0f, 0.0f},
+                                   0.0f,
+                                   {0.0f, 1.0f, 0.0f},
+                                   0.5f,
+                                   0.0f,
+                                   200U,
+                                   0,
+                                   t};
+    // wire coordinate along y: 100 wires from y = -49.5 cm
+    geo::compact::Plane_t& yPlane = geom.planes.emplace_back();
+    yPlane = geo::compact::Plane_t{{0.0f, 1.0f, 0.0f},
+                                   49.5f,
+                                   {1.0f, 0.0f, 0.0f},
+                                   0.0f,
+                                   {0.0f, 0.0f, 1.0f},
+                                   1.0f,
+                                   1.5707964f,
+                                   100U,
+                                   1,
+                                   t};
+  } // for TPCs
+  return geom;
+} // makeGeometry()
+
+/// Consecutive channels, except the second plane of the second TPC (reversed).
+std::vector<std::vector<std::uint32_t>> makeChannels()
+{
+  std::vector<std::vector<std::uint32_t>> channels;
+  std::uint32_t next = 0;
+  for (std::uint32_t nWires : {200U, 100U, 200U, 100U}) {
+    std::vector<std::uint32_t>& planeChannels = channels.emplace_back();
+    for (std::uint32_t w = 0; w < nWires; ++w)
+      planeChannels.push_back(next + w);
+    next += nWires;
+  }
+  std::vector<std::uint32_t>& last = channels.back();
+  for (std::uint32_t w = 0; w < last.size(); ++w)
+    last[w] = next - 1U - w;
+  return channels;
+} // makeChannels()
+
+std::size_t bytes(geo::DeviceGeometryBuffer_t const& buffer)
+{
+  return buffer.size() * sizeof(buffer[0]);
+}
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(QueryTestCase)
+{
+  geo::DeviceGeometryBuffer_t const buffer =
+    geo::makeDeviceGeometryBuffer(makeGeometry(), makeChannels());
+  BOOST_TEST(bytes(buffer) % 16U == 0U);
+  BOOST_CHECK_NO_THROW(geo::checkDeviceGeometryBuffer(buffer.data(), bytes(buffer)));
+
+  geo::device::GeometryView const geom{buffer.data()};
+  BOOST_TEST(geom.nTPCs() == 2U);
+  BOOST_TEST(geom.nPlanes() == 4U);
+  BOOST_TEST(geom.header().nChannels == 100U); // only the reversed plane
+  BOOST_TEST(geom.plane(0).channelTable == geo::device::InvalidIndex);
+  BOOST_TEST(geom.plane(3).channelTable == 0U);
+
+  BOOST_TEST(geom.findTPC(-50.0f, 0.0f, 50.0f) == 0U);
+  BOOST_TEST(geom.findTPC(50.0f, 0.0f, 50.0f) == 1U);
+  BOOST_TEST(geom.findTPC(50.0f, 0.0f, 150.0f) == geo::device::InvalidIndex);
+
+  // z = 10.3 cm is wire (10.3 - 0.25) / 0.5 = 20.1 -> 20
+  geo::device::Location_t loc = geom.locate(-50.0f, 0.0f, 10.3f, 0U);
+  BOOST_TEST(loc.isValid());
+  BOOST_TEST(loc.tpc == 0U);
+  BOOST_TEST(loc.plane == 0U);
+  BOOST_TEST(loc.wireCoordinate == 20.1f, boost::test_tools::tolerance(1e-5f));
+  BOOST_TEST(loc.wire == 20U);
+  BOOST_TEST(loc.channel == 20U);
+
+  loc = geom.locate(50.0f, 0.0f, 10.3f, 0U);
+  BOOST_TEST(loc.plane == 2U);
+  BOOST_TEST(loc.channel == 300U + 20U);
+
+  // y = 10.4 cm is wire 59.9 -> 60, with reversed channels in the second TPC
+  loc = geom.locate(-50.0f, 10.4f, 10.0f, 1U);
+  BOOST_TEST(loc.wire == 60U);
+  BOOST_TEST(loc.channel == 200U + 60U);
+  loc = geom.locate(50.0f, 10.4f, 10.0f, 1U);
+  BOOST_TEST(loc.wire == 60U);
+  BOOST_TEST(loc.channel == 599U - 60U);
+
+  // no such plane, out of the TPCs
+  BOOST_TEST(!geom.locate(50.0f, 0.0f, 10.0f, 2U).isValid());
+  BOOST_TEST(!geom.locate(250.0f, 0.0f, 10.0f, 0U).isValid());
+}
+
+BOOST_AUTO_TEST_CASE(InvalidBufferTestCase)
+{
+  // inconsistent input
+  std::vector<std::vector<std::uint32_t>> channels = makeChannels();
+  channels[1].pop_back();
+  BOOST_CHECK_THROW(geo::makeDeviceGeometryBuffer(makeGeometry(), channels), cet::exception);
+  channels.pop_back();
+  BOOST_CHECK_THROW(geo::makeDeviceGeometryBuffer(makeGeometry(), channels), cet::exception);
+
+  geo::DeviceGeometryBuffer_t const buffer =
+    geo::makeDeviceGeometryBuffer(makeGeometry(), makeChannels());
+
+  // truncated
+  BOOST_CHECK_THROW(geo::checkDeviceGeometryBuffer(buffer.data(), bytes(buffer) - 16U),
+                    cet::exception);
+  BOOST_CHECK_THROW(geo::checkDeviceGeometryBuffer(buffer.data(), 8U), cet::exception);
+
+  // wrong format and version
+  geo::DeviceGeometryBuffer_t wrong = buffer;
+  wrong[0] = 0U;
+  BOOST_CHECK_THROW(geo::checkDeviceGeometryBuffer(wrong.data(), bytes(wrong)), cet::exception);
+  wrong = buffer;
+  ++wrong[1];
+  BOOST_CHECK_THROW(geo::checkDeviceGeometryBuffer(wrong.data(), bytes(wrong)), cet::exception);
+
+  // too many planes claimed
+  wrong = buffer;
+  wrong[3] = 50U;
+  BOOST_CHECK_THROW(geo::checkDeviceGeometryBuffer(wrong.data(), bytes(wrong)), cet::exception);
+}
+
+//------------------------------------------------------------------------------
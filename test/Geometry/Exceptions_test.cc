@@ -0,0 +1,85 @@
+/**
+ * @file   Exceptions_test.cc
+ * @brief  Unit test for the geometry exceptions.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/Exceptions.h`
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE (geometry exceptions test)
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "larcorealg/Geometry/Exceptions.h"
+
+// C/C++ standard libraries
+#include <string>
+
+//------------------------------------------------------------------------------
+namespace {
+
+  struct TestPoint {
+    double x, y, z;
+
+    double X() const { return x; }
+    double Y() const { return y; }
+    double Z() const { return z; }
+  };
+
+  /// Returns how many times `pattern` occurs in `s`.
+  unsigned int count(std::string const& s, std::string const& pattern)
+  {
+    unsigned int n = 0;
+    for (auto pos = s.find(pattern); pos != std::string::npos; pos = s.find(pattern, pos + 1))
+      ++n;
+    return n;
+  }
+
+} // local namespace
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(InvalidWireErrorTestCase)
+{
+  geo::PlaneID const planeID{0, 1, 2};
+  try {
+    throw geo::InvalidWireError("Geometry", planeID, -3, 0).atPosition(TestPoint{1.0, 2.0, 3.0});
+  }
+  catch (geo::InvalidWireError const& e) {
+    BOOST_TEST(e.hasPlane());
+    BOOST_TEST(e.planeID() == planeID);
+    BOOST_TEST(e.badWire() == -3);
+    BOOST_TEST(e.suggestedWire() == 0);
+    std::string const msg = e.what();
+    BOOST_TEST(count(msg, "Can't find nearest wire for position (1,2,3)") == 1U);
+    BOOST_TEST(count(msg, "approx wire number # 0 (capped from -3)") == 1U);
+    BOOST_TEST(count(msg, planeID.toString()) == 1U);
+    // the message is composed only once
+    BOOST_TEST(count(e.what(), "Can't find nearest wire") == 1U);
+    BOOST_TEST(count(e.explain_self(), "Can't find nearest wire") == 1U);
+  }
+} // BOOST_AUTO_TEST_CASE(InvalidWireErrorTestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(PositionLookupErrorTestCase)
+{
+  double const coords[3] = {4.0, 5.0, 6.0};
+  try {
+    throw geo::PositionLookupError("GeometryCore", "TPC", coords);
+  }
+  catch (cet::exception const& e) {
+    BOOST_TEST(count(e.what(), "Can't find any TPC at position (4,5,6)") == 1U);
+  }
+
+  geo::PositionLookupError const e{"GeometryCore", "cryostat", TestPoint{7.0, 8.0, 9.0}};
+  BOOST_TEST(std::string{e.element()} == "cryostat");
+  BOOST_TEST(e.position()[2] == 9.0);
+} // BOOST_AUTO_TEST_CASE(PositionLookupErrorTestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(NoChannelErrorTestCase)
+{
+  geo::WireID const wireID{0, 1, 2, 3};
+  geo::NoChannelError const e{"ChannelMapStandardAlg", wireID};
+  BOOST_TEST(e.wireID() == wireID);
+  BOOST_TEST(count(e.what(), "NO CHANNEL FOUND for " + wireID.toString()) == 1U);
+} // BOOST_AUTO_TEST_CASE(NoChannelErrorTestCase)
@@ -0,0 +1,155 @@
+/**
+ * @file   FixedChannelMap_test.cc
+ * @brief  Unit test for `geo::FixedChannelMap`.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/FixedChannelMap.h`
+ *
+ * A layout written by hand is checked at compile time, and against a mock
+ * geometry with the numbering of `geo::ChannelMapStandardAlg`; the layout
+ * written by `geo::writeFixedChannelLayout()` for the same geometry is
+ * compared with the one written by hand.
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE (fixed channel map test)
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "larcorealg/Geometry/FixedChannelMap.h"
+
+// C/C++ standard libraries
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+//------------------------------------------------------------------------------
+// two cryostats: the first with two TPCs of three planes, the second with one
+// TPC of two planes
+struct TestLayout {
+  static constexpr unsigned int NCryostats = 2U;
+  static constexpr unsigned int MaxTPCs = 2U;
+  static constexpr unsigned int MaxPlanes = 3U;
+  static constexpr unsigned int NChannels = 118U;
+  static constexpr std::array<unsigned int, 12U> WireCounts{{
+    10U, 20U, 30U, 11U, 21U, 6U, 12U, 8U, 0U, 0U, 0U, 0U,
+  }};
+  static constexpr std::array<raw::ChannelID_t, 12U> FirstChannels{{
+    0U, 10U, 30U, 60U, 71U, 92U, 98U, 110U,
+    raw::InvalidChannelID, raw::InvalidChannelID, raw::InvalidChannelID, raw::InvalidChannelID,
+  }};
+  static constexpr std::array<std::size_t, 8U> ChannelOrder{{0U, 1U, 2U, 3U, 4U, 5U, 6U, 7U}};
+};
+
+using TestMap = geo::FixedChannelMap<TestLayout>;
+
+static_assert(TestMap::Nchannels() == 118U);
+static_assert(TestMap::PlaneWireToChannel(geo::WireID{0, 1, 2, 5}) == 97U);
+static_assert(TestMap::PlaneWireToChannel(geo::WireID{0, 1, 2, 6}) == raw::InvalidChannelID);
+static_assert(TestMap::PlaneWireToChannel(geo::WireID{1, 0, 2, 0}) == raw::InvalidChannelID);
+static_assert(TestMap::ChannelToWire(97U).Wire == 5U);
+static_assert(TestMap::ChannelToWire(97U).Plane == 2U);
+static_assert(!TestMap::ChannelToWire(118U).isValid);
+static_assert(TestMap::Nwires(geo::PlaneID{1, 0, 1}) == 8U);
+
+//------------------------------------------------------------------------------
+/// Geometry with the layout of `TestLayout` and the standard channel mapping.
+struct MockGeometry {
+  std::vector<std::vector<std::vector<unsigned int>>> wires{{{10U, 20U, 30U}, {11U, 21U, 6U}},
+                                                            {{12U, 8U}}};
+
+  unsigned int Ncryostats() const { return wires.size(); }
+  unsigned int NTPC(geo::CryostatID const& id) const { return wires[id.Cryostat].size(); }
+  unsigned int Nplanes(geo::TPCID const& id) const { return wires[id.Cryostat][id.TPC].size(); }
+  unsigned int Nwires(geo::PlaneID const& id) const
+  {
+    return wires[id.Cryostat][id.TPC][id.Plane];
+  }
+
+  unsigned int Nchannels() const
+  {
+    unsigned int n = 0U;
+    for (auto const& cryo : wires)
+      for (auto const& tpc : cryo)
+        for (unsigned int nWires : tpc)
+          n += nWires;
+    return n;
+  }
+
+  raw::ChannelID_t PlaneWireToChannel(geo::WireID const& id) const
+  {
+    raw::ChannelID_t channel = 0U;
+    for (unsigned int c = 0; c < wires.size(); ++c)
+      for (unsigned int t = 0; t < wires[c].size(); ++t)
+        for (unsigned int p = 0; p < wires[c][t].size(); ++p) {
+          if (geo::PlaneID{c, t, p} == id.asPlaneID()) {
+            if (id.Wire >= wires[c][t][p]) throw std::out_of_range("wire");
+            return channel + id.Wire;
+          }
+          channel += wires[c][t][p];
+        }
+    throw std::out_of_range("plane");
+  }
+
+  std::vector<geo::WireID> ChannelToWire(raw::ChannelID_t channel) const
+  {
+    for (unsigned int c = 0; c < wires.size(); ++c)
+      for (unsigned int t = 0; t < wires[c].size(); ++t)
+        for (unsigned int p = 0; p < wires[c][t].size(); ++p) {
+          if (channel < wires[c][t][p]) return {geo::WireID{c, t, p, channel}};
+          channel -= wires[c][t][p];
+        }
+    throw std::out_of_range("channel");
+  }
+}; // MockGeometry
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(FixedChannelMapTestCase)
+{
+  MockGeometry const geom;
+  BOOST_TEST(TestMap::matches(geom));
+
+  for (raw::ChannelID_t channel = 0; channel < geom.Nchannels(); ++channel) {
+    geo::WireID const wireID = geom.ChannelToWire(channel).front();
+    BOOST_TEST((TestMap::ChannelToWire(channel) == wireID));
+    BOOST_TEST(TestMap::PlaneWireToChannel(wireID) == channel);
+  }
+
+  geo::FixedChannelMapFallback<TestLayout, MockGeometry> const map{geom};
+  BOOST_TEST(map.usesFixedLayout());
+  BOOST_TEST(map.PlaneWireToChannel(geo::WireID{1, 0, 1, 7}) == 117U);
+  BOOST_CHECK_THROW(map.PlaneWireToChannel(geo::WireID{1, 0, 1, 8}), std::out_of_range);
+  BOOST_CHECK_THROW(map.ChannelToWire(118U), std::out_of_range);
+
+  // a geometry with a different layout uses its own mapping
+  MockGeometry changed;
+  changed.wires[0][1][2] = 7U;
+  BOOST_TEST(!TestMap::matches(changed));
+  geo::FixedChannelMapFallback<TestLayout, MockGeometry> const fallback{changed};
+  BOOST_TEST(!fallback.usesFixedLayout());
+  BOOST_TEST(fallback.PlaneWireToChannel(geo::WireID{1, 0, 1, 7}) == 118U);
+
+  MockGeometry extraTPC;
+  extraTPC.wires[1].push_back({5U});
+  BOOST_TEST(!TestMap::matches(extraTPC));
+
+} // BOOST_AUTO_TEST_CASE(FixedChannelMapTestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(WriteLayoutTestCase)
+{
+  std::ostringstream out;
+  geo::writeFixedChannelLayout(out, MockGeometry{}, "TestLayout");
+  std::string const code = out.str();
+
+  BOOST_TEST(code.find("struct TestLayout {") != std::string::npos);
+  BOOST_TEST(code.find("NCryostats = 2U;") != std::string::npos);
+  BOOST_TEST(code.find("MaxTPCs = 2U;") != std::string::npos);
+  BOOST_TEST(code.find("MaxPlanes = 3U;") != std::string::npos);
+  BOOST_TEST(code.find("NChannels = 118U;") != std::string::npos);
+  BOOST_TEST(code.find("std::array<unsigned int, 12U> WireCounts{{\n"
+                       "    10U, 20U, 30U, 11U, 21U, 6U, 12U, 8U,\n"
+                       "    0U, 0U, 0U, 0U,\n  }};") != std::string::npos);
+  BOOST_TEST(code.find("std::array<std::size_t, 8U> ChannelOrder{{\n"
+                       "    0U, 1U, 2U, 3U, 4U, 5U, 6U, 7U,\n  }};") != std::string::npos);
+
+} // BOOST_AUTO_TEST_CASE(WriteLayoutTestCase)
@@ -0,0 +1,99 @@
+/**
+ * @file   GeoIDdataAccumulators_test.cc
+ * @brief  Unit test for `larcorealg/Geometry/GeoIDdataAccumulators.h`.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/GeoIDdataAccumulators.h`
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE (geometry data accumulators test)
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "larcorealg/Geometry/GeoIDdataAccumulators.h"
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::max()
+#include <cstddef>   // std::size_t
+
+//------------------------------------------------------------------------------
+constexpr std::size_t NTasks = 16U;
+constexpr std::size_t NAddsPerTask = 1200U; // multiple of the 24 planes
+
+/// Plane filled at step `i` (every plane the same number of times).
+geo::PlaneID planeOf(std::size_t i)
+{
+  unsigned int const index = i % 24U;
+  return {index / 12U, (index / 4U) % 3U, index % 4U};
+}
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(AtomicAccumulatorTestCase)
+{
+
+  geo::AtomicPlaneDataAccumulator<unsigned int> counts{2U, 3U, 4U};
+  geo::AtomicPlaneDataAccumulator<double> charge{2U, 3U, 4U};
+  BOOST_TEST(counts.size() == 24U);
+  BOOST_TEST(counts.hasElement(geo::PlaneID{1U, 2U, 3U}));
+
+  geo::runTasks(geo::makeThreadTaskRunner(4U), NTasks, [&](std::size_t) {
+    for (std::size_t i = 0; i < NAddsPerTask; ++i) {
+      counts.add(planeOf(i), 1U);
+      charge.add(planeOf(i), 0.5);
+    }
+  });
+
+  constexpr unsigned int Expected = NTasks * NAddsPerTask / 24U;
+  BOOST_TEST(counts.load({0U, 1U, 2U}) == Expected);
+  auto const countsPerPlane = counts.reduce();
+  for (unsigned int const n : countsPerPlane)
+    BOOST_TEST(n == Expected);
+
+  geo::PlaneDataContainer<double> chargePerPlane(2U, 3U, 4U);
+  charge.reduceInto(chargePerPlane);
+  BOOST_TEST((chargePerPlane[{1U, 2U, 3U}]) == 0.5 * Expected);
+
+  counts.reset();
+  BOOST_TEST(counts.load({1U, 0U, 0U}) == 0U);
+
+} // AtomicAccumulatorTestCase
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(ShardedAccumulatorTestCase)
+{
+
+  geo::ShardedPlaneDataAccumulator<unsigned int> counts{NTasks, {2U, 3U, 4U}};
+  BOOST_TEST(counts.nShards() == NTasks);
+  BOOST_TEST(counts.size() == 24U);
+
+  auto const runner = geo::makeThreadTaskRunner(4U);
+  geo::runTasks(runner, NTasks, [&](std::size_t iTask) {
+    auto& shard = counts.shard(iTask);
+    for (std::size_t i = 0; i < NAddsPerTask; ++i)
+      ++shard[planeOf(i)];
+  });
+
+  constexpr unsigned int Expected = NTasks * NAddsPerTask / 24U;
+  auto const countsPerPlane = counts.reduce(runner);
+  BOOST_TEST(countsPerPlane.size() == 24U);
+  for (unsigned int const n : countsPerPlane)
+    BOOST_TEST(n == Expected);
+  BOOST_TEST((counts.reduce()[{1U, 1U, 1U}]) == Expected);
+
+  // a different combination: the maximum over the shards
+  auto const maxOf = [](unsigned int a, unsigned int b) { return std::max(a, b); };
+  geo::ShardedTPCDataAccumulator<unsigned int, decltype(maxOf)> maxima{3U, {1U, 2U}, 0U, maxOf};
+  maxima.add(0U, {0U, 1U}, 5U);
+  maxima.add(1U, {0U, 1U}, 9U);
+  maxima.add(2U, {0U, 1U}, 7U);
+  maxima.add(2U, {0U, 1U}, 2U);
+  geo::TPCDataContainer<unsigned int> maxPerTPC(1U, 2U);
+  maxima.reduceInto(maxPerTPC);
+  BOOST_TEST((maxPerTPC[{0U, 0U}]) == 0U);
+  BOOST_TEST((maxPerTPC[{0U, 1U}]) == 9U);
+
+  maxima.reset();
+  BOOST_TEST((maxima.reduce()[{0U, 1U}]) == 0U);
+
+} // ShardedAccumulatorTestCase
@@ -0,0 +1,169 @@
+/**
+ * @file   GeoIDdataSerialization_test.cc
+ * @brief  Unit test for `larcorealg/Geometry/GeoIDdataSerialization.h`.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/GeoIDdataSerialization.h`
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE (geometry data serialization test)
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "larcorealg/Geometry/GeoIDdataSerialization.h"
+#include "larcorealg/Geometry/ReadoutDataContainers.h"
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+#include "larcoreobj/SimpleTypesAndConstants/readout_types.h"
+
+// framework libraries
+#include "cetlib_except/exception.h"
+
+// C/C++ standard libraries
+#include <cstdint> // std::uint32_t
+#include <cstring> // std::memcpy()
+#include <sstream>
+#include <string>
+
+//------------------------------------------------------------------------------
+struct WireCalib {
+  float gain;
+  float pedestal;
+  int status;
+};
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(PlaneDataRoundTripTestCase)
+{
+
+  geo::PlaneDataContainer<WireCalib> calib(2U, 3U, 4U);
+  for (auto&& [id, value] : calib.items())
+    value = {1.0f + id.Plane, 400.0f + id.TPC, int(id.Cryostat)};
+
+  std::stringstream buffer;
+  geo::writeGeoIDdata(buffer, calib);
+  BOOST_TEST(buffer.str().size() == 64U + calib.size() * sizeof(WireCalib));
+
+  geo::PlaneDataContainer<WireCalib> restored(1U, 1U, 1U);
+  geo::readGeoIDdata(buffer, restored);
+  BOOST_TEST(restored.dimSize<0U>() == 2U);
+  BOOST_TEST(restored.dimSize<1U>() == 3U);
+  BOOST_TEST(restored.dimSize<2U>() == 4U);
+  for (auto&& [id, value] : restored.items()) {
+    BOOST_TEST_CONTEXT(id)
+    {
+      BOOST_TEST(value.gain == calib[id].gain);
+      BOOST_TEST(value.pedestal == calib[id].pedestal);
+      BOOST_TEST(value.status == calib[id].status);
+    }
+  }
+
+  // an empty container is still described by its header
+  std::stringstream emptyBuffer;
+  geo::writeGeoIDdata(emptyBuffer, geo::PlaneDataContainer<WireCalib>{});
+  geo::readGeoIDdata(emptyBuffer, restored);
+  BOOST_TEST(restored.empty());
+
+} // BOOST_AUTO_TEST_CASE(PlaneDataRoundTripTestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(ROPDataRoundTripTestCase)
+{
+
+  readout::ROPDataContainer<int> counts(2U, 3U, 2U);
+  int n = 0;
+  for (int& count : counts)
+    count = n++ * 7;
+
+  std::stringstream buffer;
+  geo::writeGeoIDdata(buffer, counts);
+
+  readout::ROPDataContainer<int> restored;
+  geo::readGeoIDdata(buffer, restored);
+  BOOST_TEST(restored.size() == counts.size());
+  BOOST_TEST(restored.hasROP(readout::ROPID{1U, 2U, 1U}));
+  BOOST_TEST((restored[{1U, 2U, 1U}]) == (counts[{1U, 2U, 1U}]));
+  BOOST_TEST(restored.last() == counts.last());
+
+} // BOOST_AUTO_TEST_CASE(ROPDataRoundTripTestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(ByteOrderTestCase)
+{
+
+  geo::TPCDataContainer<std::uint32_t> values(2U, 3U);
+  std::uint32_t n = 0x00010203U;
+  for (std::uint32_t& value : values)
+    value = n++;
+
+  std::stringstream buffer;
+  geo::writeGeoIDdata(buffer, values);
+
+  // emulate a writer with the opposite byte order
+  std::string bytes = buffer.str();
+  geo::details::GeoIDdataHeader header;
+  std::memcpy(&header, bytes.data(), sizeof(header));
+  geo::details::reverseBytes(header);
+  std::memcpy(bytes.data(), &header, sizeof(header));
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    std::uint32_t value;
+    char* const data = bytes.data() + sizeof(header) + i * sizeof(value);
+    std::memcpy(&value, data, sizeof(value));
+    geo::details::reverseBytes(value);
+    std::memcpy(data, &value, sizeof(value));
+  }
+
+  std::istringstream swapped{bytes};
+  geo::TPCDataContainer<std::uint32_t> restored;
+  geo::readGeoIDdata(swapped, restored);
+  BOOST_TEST(restored.size() == values.size());
+  BOOST_TEST((restored[{0U, 0U}]) == 0x00010203U);
+  BOOST_TEST((restored[{1U, 2U}]) == (values[{1U, 2U}]));
+
+  // structures can't be converted
+  geo::TPCDataContainer<WireCalib> calib(2U, 3U);
+  std::stringstream calibBuffer;
+  geo::writeGeoIDdata(calibBuffer, calib);
+  std::string calibBytes = calibBuffer.str();
+  std::memcpy(&header, calibBytes.data(), sizeof(header));
+  geo::details::reverseBytes(header);
+  std::memcpy(calibBytes.data(), &header, sizeof(header));
+  std::istringstream swappedCalib{calibBytes};
+  BOOST_CHECK_THROW(geo::readGeoIDdata(swappedCalib, calib), cet::exception);
+
+} // BOOST_AUTO_TEST_CASE(ByteOrderTestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(MismatchTestCase)
+{
+
+  geo::PlaneDataContainer<float> values(2U, 3U, 4U, 1.5f);
+  std::stringstream buffer;
+  geo::writeGeoIDdata(buffer, values);
+  std::string const bytes = buffer.str();
+
+  // wrong element type
+  std::istringstream asInt{bytes};
+  geo::PlaneDataContainer<double> doubles;
+  BOOST_CHECK_THROW(geo::readGeoIDdata(asInt, doubles), cet::exception);
+
+  // wrong number of dimensions
+  std::istringstream asTPC{bytes};
+  geo::TPCDataContainer<float> perTPC;
+  BOOST_CHECK_THROW(geo::readGeoIDdata(asTPC, perTPC), cet::exception);
+
+  // truncated data
+  std::istringstream truncated{bytes.substr(0U, bytes.size() - 1U)};
+  geo::PlaneDataContainer<float> restored;
+  BOOST_CHECK_THROW(geo::readGeoIDdata(truncated, restored), cet::exception);
+
+  // truncated header
+  std::istringstream noHeader{bytes.substr(0U, 20U)};
+  BOOST_CHECK_THROW(geo::readGeoIDdata(noHeader, restored), cet::exception);
+
+  // not geometry data at all
+  std::istringstream garbage{std::string(bytes.size(), 'x')};
+  BOOST_CHECK_THROW(geo::readGeoIDdata(garbage, restored), cet::exception);
+
+} // BOOST_AUTO_TEST_CASE(MismatchTestCase)
+
+//------------------------------------------------------------------------------
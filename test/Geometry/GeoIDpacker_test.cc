@@ -0,0 +1,94 @@
+/**
+ * @file   GeoIDpacker_test.cc
+ * @brief  Unit test for `geo::GeoIDpacker` and its utilities.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/GeoIDpacker.h`
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE (geometry ID packer test)
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "larcorealg/Geometry/GeoIDpacker.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::is_sorted()
+#include <random>
+#include <unordered_set>
+#include <vector>
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(PackingTestCase)
+{
+  // 2 cryostats, 4 TPCs, 3 planes, 1000 wires: 1 + 2 + 2 + 10 bits
+  geo::GeoIDpacker const packer{{2U, 4U, 3U, 1000U}};
+  BOOST_TEST(packer.bits(0) == 1U);
+  BOOST_TEST(packer.bits(3) == 10U);
+  BOOST_TEST(packer.keyBits<geo::TPCID>() == 3U);
+  BOOST_TEST(packer.keyBits<geo::WireID>() == 15U);
+
+  geo::WireID const wireID{1, 3, 2, 999};
+  BOOST_TEST(packer.canPack(wireID));
+  BOOST_TEST(!packer.canPack(geo::WireID{1, 3, 2, 1024}));
+  auto const key = packer.pack(wireID);
+  BOOST_TEST(key < (1U << 15U));
+  BOOST_TEST(packer.unpack<geo::WireID>(key) == wireID);
+  BOOST_TEST(packer.unpack<geo::WireID>(key).isValid);
+
+  geo::PlaneID const planeID{1, 2, 0};
+  BOOST_TEST(packer.unpack<geo::PlaneID>(packer.pack(planeID)) == planeID);
+
+  geo::WireID invalid;
+  BOOST_TEST(packer.pack(invalid) == geo::GeoIDpacker::InvalidKey);
+  BOOST_TEST(!packer.unpack<geo::WireID>(geo::GeoIDpacker::InvalidKey).isValid);
+
+  // keys sort like IDs
+  BOOST_TEST(packer.pack(geo::WireID{0, 3, 2, 999}) < packer.pack(geo::WireID{1, 0, 0, 0}));
+  BOOST_TEST(packer.pack(geo::WireID{1, 0, 0, 5}) < packer.pack(geo::WireID{1, 0, 1, 0}));
+
+  geo::GeoIDpacker const standard = geo::GeoIDpacker::standard();
+  BOOST_TEST(standard.keyBits<geo::WireID>() == 60U);
+  geo::WireID const large{7, 150, 2, 12000};
+  BOOST_TEST(standard.unpack<geo::WireID>(standard.pack(large)) == large);
+
+  BOOST_CHECK_THROW((geo::GeoIDpacker{{~0U, ~0U, 1U, 1U}}), std::length_error);
+} // BOOST_AUTO_TEST_CASE(PackingTestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(HashTestCase)
+{
+  std::unordered_set<geo::WireID, geo::GeoIDhash> wires;
+  for (unsigned int w = 0; w < 100; ++w)
+    wires.insert(geo::WireID{0, 1, 2, w});
+  wires.insert(geo::WireID{0, 1, 2, 5});
+  BOOST_TEST(wires.size() == 100U);
+  BOOST_TEST(wires.count(geo::WireID{0, 1, 2, 42}) == 1U);
+  BOOST_TEST(wires.count(geo::WireID{0, 1, 1, 42}) == 0U);
+} // BOOST_AUTO_TEST_CASE(HashTestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(SortTestCase)
+{
+  struct Hit {
+    geo::WireID wire;
+    int index;
+  };
+
+  geo::GeoIDpacker const packer{{2U, 4U, 3U, 1000U}};
+  std::mt19937 rng{42};
+  auto const random = [&rng](unsigned int n) { return static_cast<unsigned int>(rng() % n); };
+  std::vector<Hit> hits;
+  for (int i = 0; i < 5000; ++i)
+    hits.push_back({geo::WireID{random(2U), random(4U), random(3U), random(1000U)}, i});
+  geo::sortByPackedKey(hits,
+                       [&packer](Hit const& hit) { return packer.pack(hit.wire); },
+                       packer.keyBits<geo::WireID>());
+
+  BOOST_TEST(hits.size() == 5000U);
+  bool const sorted =
+    std::is_sorted(hits.begin(), hits.end(), [](Hit const& a, Hit const& b) {
+      return (a.wire != b.wire) ? (a.wire < b.wire) : (a.index < b.index); // stable
+    });
+  BOOST_TEST(sorted);
+} // BOOST_AUTO_TEST_CASE(SortTestCase)
@@ -20,6 +20,10 @@
 #include "cetlib_except/exception.h"
 #include "messagefacility/MessageLogger/MessageLogger.h"
 
+// C/C++ standard libraries
+#include <algorithm> // std::equal()
+#include <iterator>  // std::prev()
+
 namespace geo {
 
 #pragma GCC diagnostic push
@@ -162,6 +166,12 @@ namespace geo {
         ++nErrors;
       }
 
+      if (&geom->CryostatUnchecked(expCID) != &cryo) {
+        MF_LOG_ERROR("GeometryIteratorLoopTest")
+          << "CryostatUnchecked(" << expCID << ") retrieves the wrong CryostatGeo";
+        ++nErrors;
+      }
+
       geo::TPC_id_iterator iTPCIDinCryo = geom->begin_TPC_id(expCID);
       geo::TPC_iterator iTPCinCryo = geom->begin_TPC(expCID);
       geo::plane_id_iterator iPlaneIDinCryo = geom->begin_plane_id(expCID);
@@ -215,6 +225,12 @@ namespace geo {
           ++nErrors;
         }
 
+        if (&geom->TPCUnchecked(expTID) != &TPC) {
+          MF_LOG_ERROR("GeometryIteratorLoopTest")
+            << "TPCUnchecked(" << expTID << ") retrieves the wrong TPCGeo";
+          ++nErrors;
+        }
+
         if (*iTPCIDinCryo != expTID) {
           MF_LOG_ERROR("GeometryIteratorLoopTest")
             << "TPC ID local iterator in " << expCID << " points to " << *iTPCIDinCryo
@@ -283,6 +299,12 @@ namespace geo {
             ++nErrors;
           }
 
+          if (&geom->PlaneUnchecked(expPID) != &Plane) {
+            MF_LOG_ERROR("GeometryIteratorLoopTest")
+              << "PlaneUnchecked(" << expPID << ") retrieves the wrong PlaneGeo";
+            ++nErrors;
+          }
+
           if (*iPlaneIDinCryo != expPID) {
             MF_LOG_ERROR("GeometryIteratorLoopTest")
               << "Plane ID local iterator in " << expCID << " points to " << *iPlaneIDinCryo
@@ -364,6 +386,12 @@ namespace geo {
               ++nErrors;
             }
 
+            if (&geom->WireUnchecked(expWID) != &Wire) {
+              MF_LOG_ERROR("GeometryIteratorLoopTest")
+                << "WireUnchecked(" << expWID << ") retrieves the wrong WireGeo";
+              ++nErrors;
+            }
+
             if (*iWireIDinCryo != expWID) {
               MF_LOG_ERROR("GeometryIteratorLoopTest")
                 << "Wire ID local iterator in " << expCID << " points to " << *iWireIDinCryo
@@ -1237,6 +1265,96 @@ namespace geo {
       ++nErrors;
     } // if
 
+    // the flat ranges must cover the same IDs in the same order
+    auto const flatWireIDs = geom->FlatWireIDs();
+    if (flatWireIDs.size() != nWires) {
+      MF_LOG_ERROR("GeometryIteratorLoopTest")
+        << "Flat range has " << flatWireIDs.size() << " wire IDs, while we expected " << nWires;
+      ++nErrors;
+    }
+    else {
+      auto iFlatWireID = flatWireIDs.begin();
+      for (geo::WireID const& wID : geom->IterateWireIDs()) {
+        if (*iFlatWireID != wID) {
+          MF_LOG_ERROR("GeometryIteratorLoopTest")
+            << "Flat range has " << *iFlatWireID << " where iterator has " << wID;
+          ++nErrors;
+          break;
+        }
+        if (flatWireIDs[iFlatWireID.index()] != wID) {
+          MF_LOG_ERROR("GeometryIteratorLoopTest")
+            << "Random access to flat range at " << iFlatWireID.index() << " yields "
+            << flatWireIDs[iFlatWireID.index()] << " instead of " << wID;
+          ++nErrors;
+          break;
+        }
+        ++iFlatWireID;
+      } // for
+    }
+    if (!std::equal(geom->IteratePlaneIDs().begin(),
+                    geom->IteratePlaneIDs().end(),
+                    geom->FlatPlaneIDs().begin(),
+                    geom->FlatPlaneIDs().end())) {
+      MF_LOG_ERROR("GeometryIteratorLoopTest") << "Flat range of plane IDs differs from iterator";
+      ++nErrors;
+    }
+    if (!std::equal(geom->IterateTPCIDs().begin(),
+                    geom->IterateTPCIDs().end(),
+                    geom->FlatTPCIDs().begin(),
+                    geom->FlatTPCIDs().end())) {
+      MF_LOG_ERROR("GeometryIteratorLoopTest") << "Flat range of TPC IDs differs from iterator";
+      ++nErrors;
+    }
+
+    // the flat object tables follow the flat ID ranges, with contiguous children
+    auto const flatWires = geom->FlatWires();
+    auto const flatPlanes = geom->FlatPlanes();
+    if ((flatWires.size() != nWires) || (flatPlanes.size() != geom->FlatPlaneIDs().size()) ||
+        (geom->FlatTPCs().size() != geom->FlatTPCIDs().size())) {
+      MF_LOG_ERROR("GeometryIteratorLoopTest") << "Flat object tables have the wrong size";
+      ++nErrors;
+    }
+    else {
+      for (std::size_t iPlane = 0; iPlane < flatPlanes.size(); ++iPlane) {
+        geo::PlaneGeo const& plane = *flatPlanes.begin()[iPlane];
+        auto const planeWires = geom->FlatWires(plane.ID());
+        if ((plane.ID() != geom->FlatPlaneIDs()[iPlane]) || (planeWires.size() != plane.Nwires()) ||
+            (*planeWires.begin() != &plane.FirstWire()) ||
+            (*std::prev(planeWires.end()) != &plane.LastWire())) {
+          MF_LOG_ERROR("GeometryIteratorLoopTest")
+            << "Flat object tables are wrong for " << plane.ID();
+          ++nErrors;
+          break;
+        }
+      } // for
+      for (geo::TPCGeo const& TPC : geom->IterateTPCs()) {
+        auto const TPCplanes = geom->FlatPlanes(TPC.ID());
+        if ((TPCplanes.size() != TPC.Nplanes()) || (*TPCplanes.begin() != &TPC.Plane(0))) {
+          MF_LOG_ERROR("GeometryIteratorLoopTest")
+            << "Flat table of planes is wrong for " << TPC.ID();
+          ++nErrors;
+          break;
+        }
+      } // for
+    }
+
+    // packed keys of all the wires are reversible, and sorted like their IDs
+    geo::GeoIDpacker const packer = geom->makeGeoIDpacker();
+    geo::GeoIDpacker::Key_t prevKey = 0U;
+    bool first = true;
+    for (geo::WireID const& wID : geom->IterateWireIDs()) {
+      geo::GeoIDpacker::Key_t const key = packer.pack(wID);
+      if (!packer.canPack(wID) || (packer.unpack<geo::WireID>(key) != wID) ||
+          (!first && (key <= prevKey))) {
+        MF_LOG_ERROR("GeometryIteratorLoopTest")
+          << "Wire " << wID << " has packed key " << key << ", after " << prevKey;
+        ++nErrors;
+        break;
+      }
+      prevKey = key;
+      first = false;
+    } // for
+
     if (runningSID) {
       MF_LOG_ERROR("GeometryIteratorLoopTest")
         << "TPC set ID still valid (" << runningSID << ") after incrementing from the last one.";
@@ -0,0 +1,69 @@
+/**
+ * @file   GeometryLoadReport_test.cc
+ * @brief  Unit test for `geo::GeometryLoadReport`.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/GeometryLoadReport.h`
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE (geometry load report test)
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "larcorealg/Geometry/GeometryLoadReport.h"
+
+// C/C++ standard libraries
+#include <sstream>
+#include <string>
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(PhasesTestCase)
+{
+  geo::GeometryLoadReport report;
+  BOOST_TEST(report.empty());
+  BOOST_TEST(report.totalSeconds() == 0.0);
+
+  report.addPhase("Import", 0.5);
+  report.addPhase("SortGeometry", 0.25);
+  report.addPhase("Import", 0.125); // accumulates
+  auto const start = geo::GeometryLoadReport::Clock_t::now();
+  report.addPhase("ChannelTables", start);
+
+  BOOST_TEST(!report.empty());
+  BOOST_TEST_REQUIRE(report.phases().size() == 3U);
+  BOOST_TEST(report.phases()[0].name == "Import");
+  BOOST_TEST(report.phases()[1].name == "SortGeometry");
+  BOOST_TEST(report.phases()[2].name == "ChannelTables");
+  BOOST_TEST(report.seconds("Import") == 0.625);
+  BOOST_TEST(report.seconds("ChannelTables") >= 0.0);
+  BOOST_TEST(report.seconds("BuildCryostats") == 0.0);
+  BOOST_TEST(report.totalSeconds() >= 0.875);
+} // BOOST_AUTO_TEST_CASE(PhasesTestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(CountsTestCase)
+{
+  geo::GeometryLoadReport report;
+  report.setCount("TPCs", 12U);
+  report.setCount("Wires", 4000U);
+  report.setCount("TPCs", 8U); // replaces
+
+  BOOST_TEST_REQUIRE(report.counts().size() == 2U);
+  BOOST_TEST(report.count("TPCs") == 8U);
+  BOOST_TEST(report.count("Wires") == 4000U);
+  BOOST_TEST(report.count("Channels") == 0U);
+  BOOST_TEST(report.phases().empty());
+
+  report.addPhase("BuildCryostats", 0.002);
+  std::ostringstream out;
+  report.print(out, "  ");
+  std::string const table = out.str();
+  BOOST_TEST(table.find("BuildCryostats") != std::string::npos);
+  BOOST_TEST(table.find("2.0") != std::string::npos);
+  BOOST_TEST(table.find("4000") != std::string::npos);
+
+  report.clear();
+  BOOST_TEST(report.empty());
+} // BOOST_AUTO_TEST_CASE(CountsTestCase)
+
+//------------------------------------------------------------------------------
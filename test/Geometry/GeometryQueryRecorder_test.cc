@@ -0,0 +1,212 @@
+/**
+ * @file   GeometryQueryRecorder_test.cc
+ * @brief  Unit test for the recording of geometry queries.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/GeometryQueryRecorder.h`
+ *
+ * The queries are written with `geo::GeometryQueryRecorder` and read back
+ * with `geo::readRecordedQueries()`; the replay needs a geometry, and it is
+ * exercised by `geometry_replay_benchmark`.
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE (geometry query recorder test)
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "larcorealg/Geometry/GeometryQueryRecorder.h"
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+
+// framework libraries
+#include "cetlib_except/exception.h"
+
+// C/C++ standard libraries
+#include <cstdio> // std::remove()
+#include <fstream>
+#include <string>
+#include <thread>
+#include <unistd.h> // getpid(), truncate()
+#include <vector>
+
+//------------------------------------------------------------------------------
+using Kind_t = geo::RecordedQuery_t::Kind_t;
+
+/// Returns a name for a temporary file, unique to this process.
+std::string tempFileName(std::string const& tag)
+{
+  return "GeometryQueryRecorder_test_" + std::to_string(getpid()) + "_" + tag + ".geoq";
+}
+
+/// Returns a query on a position and a plane.
+geo::RecordedQuery_t pointQuery(Kind_t kind, double x, geo::PlaneID const& plane = {})
+{
+  geo::RecordedQuery_t query;
+  query.kind = kind;
+  query.point = {x, -2.0 * x, 0.5 + x};
+  query.plane = plane;
+  return query;
+}
+
+/// Returns a query on a channel.
+geo::RecordedQuery_t channelQuery(Kind_t kind, raw::ChannelID_t channel)
+{
+  geo::RecordedQuery_t query;
+  query.kind = kind;
+  query.channel = channel;
+  return query;
+}
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(RoundTrip_test)
+{
+  std::vector<geo::RecordedQuery_t> queries{
+    pointQuery(Kind_t::NearestWireID, 1.5, geo::PlaneID{0U, 1U, 2U}),
+    pointQuery(Kind_t::TryNearestWireID, -3.25, geo::PlaneID{}),
+    pointQuery(Kind_t::NearestWireIDinTPC, 7.0, geo::PlaneID{1U, 3U, 0U}),
+    pointQuery(Kind_t::FindTPCAtPosition, 250.0),
+    pointQuery(Kind_t::FindTPCAtPositionWithHint,
+               -0.125,
+               geo::PlaneID{geo::TPCID{0U, 4U}, geo::PlaneID::InvalidID}),
+    channelQuery(Kind_t::ChannelToWire, 4095U),
+    channelQuery(Kind_t::ChannelToWireIDs, raw::InvalidChannelID),
+  };
+  geo::RecordedQuery_t intersect;
+  intersect.kind = Kind_t::WireIDsIntersect;
+  intersect.wire1 = geo::WireID{0U, 1U, 0U, 350U};
+  intersect.wire2 = geo::WireID{0U, 1U, 1U, 410U};
+  queries.push_back(intersect);
+
+  std::string const path = tempFileName("roundtrip");
+  {
+    geo::GeometryQueryRecorder recorder{path};
+    recorder.setGeometryFingerprint(0x0123456789abcdefULL);
+    for (geo::RecordedQuery_t const& query : queries)
+      recorder.record(query);
+    BOOST_TEST(recorder.seenQueries() == queries.size());
+    BOOST_TEST(recorder.recordedQueries() == queries.size());
+    BOOST_TEST(recorder.path() == path);
+  }
+
+  geo::RecordedQueryLog_t const log = geo::readRecordedQueries(path);
+  BOOST_TEST(log.fingerprint == 0x0123456789abcdefULL);
+  BOOST_TEST(log.sampleEvery == 1U);
+  BOOST_TEST_REQUIRE(log.queries.size() == queries.size());
+  for (std::size_t i = 0; i < queries.size(); ++i) {
+    BOOST_TEST_CONTEXT("query #" << i)
+    {
+      geo::RecordedQuery_t const& expected = queries[i];
+      geo::RecordedQuery_t const& query = log.queries[i];
+      BOOST_TEST((query.kind == expected.kind));
+      BOOST_TEST(query.point.X() == expected.point.X());
+      BOOST_TEST(query.point.Y() == expected.point.Y());
+      BOOST_TEST(query.point.Z() == expected.point.Z());
+      BOOST_TEST(query.plane == expected.plane);
+      BOOST_TEST(query.wire1 == expected.wire1);
+      BOOST_TEST(query.wire2 == expected.wire2);
+      BOOST_TEST(query.channel == expected.channel);
+    }
+  } // for
+
+  // the record of a point query is a few tens of bytes
+  std::ifstream in{path, std::ios::binary | std::ios::ate};
+  BOOST_TEST(static_cast<std::size_t>(in.tellg()) < sizeof(geo::details::QueryLogHeader) + 256U);
+
+  std::remove(path.c_str());
+} // BOOST_AUTO_TEST_CASE(RoundTrip_test)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(Sampling_test)
+{
+  std::string const path = tempFileName("sampling");
+  {
+    geo::GeometryQueryRecorder::Config_t config;
+    config.sampleEvery = 3U;
+    geo::GeometryQueryRecorder recorder{path, config};
+    for (unsigned int i = 0; i < 10U; ++i)
+      recorder.record(channelQuery(Kind_t::ChannelToWireIDs, i));
+    BOOST_TEST(recorder.seenQueries() == 10U);
+    BOOST_TEST(recorder.recordedQueries() == 4U);
+  }
+  geo::RecordedQueryLog_t log = geo::readRecordedQueries(path);
+  BOOST_TEST(log.sampleEvery == 3U);
+  BOOST_TEST_REQUIRE(log.queries.size() == 4U);
+  for (unsigned int i = 0; i < 4U; ++i)
+    BOOST_TEST(log.queries[i].channel == 3U * i);
+
+  {
+    geo::GeometryQueryRecorder::Config_t config;
+    config.maxQueries = 5U;
+    geo::GeometryQueryRecorder recorder{path, config};
+    for (unsigned int i = 0; i < 10U; ++i)
+      recorder.record(channelQuery(Kind_t::ChannelToWire, i));
+    BOOST_TEST(recorder.recordedQueries() == 5U);
+  }
+  log = geo::readRecordedQueries(path);
+  BOOST_TEST_REQUIRE(log.queries.size() == 5U);
+  BOOST_TEST(log.queries.back().channel == 4U);
+
+  std::remove(path.c_str());
+} // BOOST_AUTO_TEST_CASE(Sampling_test)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(ConcurrentRecording_test)
+{
+  constexpr unsigned int NThreads = 4U;
+  constexpr unsigned int NQueries = 20000U; // per thread, beyond a buffer
+
+  std::string const path = tempFileName("concurrent");
+  {
+    geo::GeometryQueryRecorder recorder{path};
+    std::vector<std::thread> threads;
+    for (unsigned int t = 0; t < NThreads; ++t) {
+      threads.emplace_back([&recorder, t]() {
+        for (unsigned int i = 0; i < NQueries; ++i)
+          recorder.record(pointQuery(Kind_t::NearestWireID, i, geo::PlaneID{0U, t, 0U}));
+      });
+    }
+    for (std::thread& thread : threads)
+      thread.join();
+    BOOST_TEST(recorder.recordedQueries() == NThreads * NQueries);
+  }
+
+  geo::RecordedQueryLog_t const log = geo::readRecordedQueries(path);
+  BOOST_TEST_REQUIRE(log.queries.size() == NThreads * NQueries);
+
+  // the queries of each thread are in their order
+  std::vector<double> next(NThreads, 0.0);
+  for (geo::RecordedQuery_t const& query : log.queries) {
+    BOOST_TEST_REQUIRE(query.plane.TPC < NThreads);
+    BOOST_TEST(query.point.X() == next[query.plane.TPC]);
+    next[query.plane.TPC] += 1.0;
+  }
+
+  std::remove(path.c_str());
+} // BOOST_AUTO_TEST_CASE(ConcurrentRecording_test)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(FileErrors_test)
+{
+  BOOST_CHECK_THROW(geo::readRecordedQueries(tempFileName("missing")), cet::exception);
+  BOOST_CHECK_THROW(geo::GeometryQueryRecorder{"/nonexistent/directory/queries.geoq"},
+                    cet::exception);
+
+  std::string const path = tempFileName("bad");
+  {
+    std::ofstream out{path};
+    out << "this is not a query file, even if it is long enough to contain a header";
+  }
+  BOOST_CHECK_THROW(geo::readRecordedQueries(path), cet::exception);
+
+  // truncated record
+  {
+    geo::GeometryQueryRecorder recorder{path};
+    recorder.record(pointQuery(Kind_t::FindTPCAtPosition, 1.0));
+  }
+  BOOST_TEST(geo::readRecordedQueries(path).queries.size() == 1U);
+  BOOST_TEST(truncate(path.c_str(), sizeof(geo::details::QueryLogHeader) + 10U) == 0);
+  BOOST_CHECK_THROW(geo::readRecordedQueries(path), cet::exception);
+
+  std::remove(path.c_str());
+} // BOOST_AUTO_TEST_CASE(FileErrors_test)
+
+//------------------------------------------------------------------------------
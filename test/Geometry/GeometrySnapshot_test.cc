@@ -0,0 +1,163 @@
+/**
+ * @file   GeometrySnapshot_test.cc
+ * @brief  Unit test for `geo::GeometrySnapshot`.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/GeometrySnapshot.h`
+ *
+ * A small snapshot is written and read back, both from a stream and in place
+ * from a memory buffer, and corrupted images are checked to be rejected.
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE (geometry snapshot test)
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "larcorealg/Geometry/GeometrySnapshot.h"
+
+// framework libraries
+#include "cetlib_except/exception.h"
+
+// C/C++ standard libraries
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <utility> // std::swap()
+#include <vector>
+
+//------------------------------------------------------------------------------
+/// One cryostat, two TPCs with two planes of three wires each, two detectors.
+geo::GeometrySnapshot makeSnapshot()
+{
+  geo::GeometrySnapshot snapshot;
+  snapshot.detectorName = "testdet";
+  snapshot.cryostats.push_back({{{-10.0, -5.0, 0.0}, {10.0, 5.0, 30.0}}, 0U, 2U, 0U, 2U});
+  for (unsigned int t = 0; t < 2U; ++t) {
+    double const x0 = -10.0 + 10.0 * t;
+    snapshot.TPCs.push_back({{{x0, -5.0, 0.0}, {x0 + 10.0, 5.0, 30.0}},
+                             {{x0 + 1.0, -4.0, 1.0}, {x0 + 9.0, 4.0, 29.0}},
+                             {(t == 0) ? -1.0 : 1.0, 0.0, 0.0},
+                             2U * t,
+                             2U,
+                             (t == 0) ? 2 : 1,
+                             0U});
+    for (unsigned int p = 0; p < 2U; ++p) {
+      snapshot.planes.push_back({{x0 + p, 0.0, 15.0},
+                                 {1.0, 0.0, 0.0},
+                                 {0.0, 1.0, 0.0},
+                                 {0.0, 0.0, 1.0},
+                                 10.0,
+                                 30.0,
+                                 0.3,
+                                 0.5 * p,
+                                 static_cast<std::uint32_t>(snapshot.wires.size()),
+                                 3U,
+                                 static_cast<std::int32_t>(p),
+                                 1});
+      for (unsigned int w = 0; w < 3U; ++w)
+        snapshot.wires.push_back({{x0 + p, 0.0, 0.3 * w}, {0.0, 1.0, 0.0}, 5.0, 1.5});
+    }
+  }
+  snapshot.opDets.push_back({{-11.0, 0.0, 10.0}, 4.0, 0.0, 0.0, 1.0, 0.0});
+  snapshot.opDets.push_back({{-11.0, 0.0, 20.0}, 4.0, 0.0, 0.0, 1.0, 0.0});
+  return snapshot;
+} // makeSnapshot()
+
+std::string image(geo::GeometrySnapshot const& snapshot)
+{
+  std::ostringstream out;
+  snapshot.write(out);
+  return out.str();
+}
+
+/// Copies an image into an 8-byte aligned buffer.
+std::vector<std::uint64_t> alignedCopy(std::string const& data)
+{
+  std::vector<std::uint64_t> buffer((data.size() + 7U) / 8U + 1U);
+  std::memcpy(buffer.data(), data.data(), data.size());
+  return buffer;
+}
+
+void checkSame(geo::GeometrySnapshot const& a, geo::GeometrySnapshot const& b)
+{
+  BOOST_TEST(a.detectorName == b.detectorName);
+  BOOST_TEST_REQUIRE(a.cryostats.size() == b.cryostats.size());
+  BOOST_TEST_REQUIRE(a.TPCs.size() == b.TPCs.size());
+  BOOST_TEST_REQUIRE(a.planes.size() == b.planes.size());
+  BOOST_TEST_REQUIRE(a.wires.size() == b.wires.size());
+  BOOST_TEST_REQUIRE(a.opDets.size() == b.opDets.size());
+  auto const sameBytes = [](auto const& v1, auto const& v2) {
+    return std::memcmp(v1.data(), v2.data(), v1.size() * sizeof(v1.front())) == 0;
+  };
+  BOOST_TEST(sameBytes(a.cryostats, b.cryostats));
+  BOOST_TEST(sameBytes(a.TPCs, b.TPCs));
+  BOOST_TEST(sameBytes(a.planes, b.planes));
+  BOOST_TEST(sameBytes(a.wires, b.wires));
+  BOOST_TEST(sameBytes(a.opDets, b.opDets));
+}
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(RoundTripTestCase)
+{
+  geo::GeometrySnapshot const snapshot = makeSnapshot();
+  std::string const data = image(snapshot);
+  BOOST_TEST(data.size() % 8U == 0U);
+
+  std::istringstream in{data};
+  checkSame(geo::GeometrySnapshot::read(in), snapshot);
+
+  // in place, as from a memory map
+  std::vector<std::uint64_t> const buffer = alignedCopy(data);
+  geo::GeometrySnapshotView const view{buffer.data(), data.size()};
+  BOOST_TEST(view.detectorName() == "testdet");
+  BOOST_TEST(view.wires().size() == 12U);
+  BOOST_TEST(view.planes().begin()[3].firstWire == 9U);
+  BOOST_TEST(view.wires().begin()[4].center[2] == 0.3);
+  checkSame(geo::GeometrySnapshot{view}, snapshot);
+
+  // empty snapshot
+  std::istringstream emptyIn{image(geo::GeometrySnapshot{})};
+  BOOST_TEST(geo::GeometrySnapshot::read(emptyIn).wires.empty());
+}
+
+BOOST_AUTO_TEST_CASE(InvalidImageTestCase)
+{
+  std::string const data = image(makeSnapshot());
+
+  auto const parse = [](std::string const& bytes) {
+    std::vector<std::uint64_t> const buffer = alignedCopy(bytes);
+    geo::GeometrySnapshotView{buffer.data(), bytes.size()};
+  };
+  BOOST_CHECK_NO_THROW(parse(data));
+
+  // truncated
+  BOOST_CHECK_THROW(parse(data.substr(0, data.size() - 8U)), cet::exception);
+  BOOST_CHECK_THROW(parse(data.substr(0, 10U)), cet::exception);
+
+  // wrong format, version and byte order
+  std::string wrong = data;
+  wrong[0] = 'X';
+  BOOST_CHECK_THROW(parse(wrong), cet::exception);
+  wrong = data;
+  wrong[8] = static_cast<char>(wrong[8] + 1);
+  BOOST_CHECK_THROW(parse(wrong), cet::exception);
+  wrong = data;
+  std::swap(wrong[12], wrong[15]);
+  BOOST_CHECK_THROW(parse(wrong), cet::exception);
+
+  // inconsistent indices
+  geo::GeometrySnapshot snapshot = makeSnapshot();
+  snapshot.planes[1].nWires = 4U;
+  BOOST_CHECK_THROW(parse(image(snapshot)), cet::exception);
+  snapshot = makeSnapshot();
+  snapshot.cryostats[0].nTPCs = 1U;
+  BOOST_CHECK_THROW(parse(image(snapshot)), cet::exception);
+
+  // misaligned
+  std::vector<std::uint64_t> const buffer = alignedCopy(data + "        ");
+  char const* const misaligned = reinterpret_cast<char const*>(buffer.data()) + 4;
+  BOOST_CHECK_THROW((geo::GeometrySnapshotView{misaligned, data.size()}), cet::exception);
+}
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,154 @@
+/**
+ * @file   GeometryTables_test.cc
+ * @brief  Unit test for `geo::writeGeometryTables()`.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/GeometryTables.h`
+ *
+ * The geometry has one cryostat with one TPC and two planes of three wires;
+ * the wires of the first plane are on channels `0` to `2`, the ones of the
+ * second plane on channels `3`, `4` and `3` again.
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE (geometry tables test)
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "larcorealg/Geometry/GeometrySnapshot.h"
+#include "larcorealg/Geometry/GeometryTables.h"
+#include "larcorealg/Geometry/SharedGeometrySnapshot.h"
+
+// framework libraries
+#include "cetlib_except/exception.h"
+
+// ROOT libraries
+#include "TMemFile.h"
+#include "TTree.h"
+
+// C/C++ standard libraries
+#include <cstdint>
+#include <string>
+
+//------------------------------------------------------------------------------
+namespace {
+
+  geo::SharedGeometryContent makeContent()
+  {
+    geo::SharedGeometryContent content;
+    geo::GeometrySnapshot& snapshot = content.snapshot;
+    snapshot.detectorName = "tabledet";
+    snapshot.cryostats.push_back({{{0.0, -5.0, 0.0}, {10.0, 5.0, 30.0}}, 0U, 1U, 0U, 1U});
+    snapshot.TPCs.push_back({{{0.0, -5.0, 0.0}, {10.0, 5.0, 30.0}},
+                             {{1.0, -4.0, 1.0}, {9.0, 4.0, 29.0}},
+                             {-1.0, 0.0, 0.0},
+                             0U,
+                             2U,
+                             2,
+                             0U});
+    for (unsigned int p = 0; p < 2U; ++p) {
+      snapshot.planes.push_back({{0.5 * p, 0.0, 3.0},
+                                 {1.0, 0.0, 0.0},
+                                 {0.0, 1.0, 0.0},
+                                 {0.0, 0.0, 1.0},
+                                 10.0,
+                                 30.0,
+                                 1.0,
+                                 0.0,
+                                 static_cast<std::uint32_t>(snapshot.wires.size()),
+                                 3U,
+                                 static_cast<std::int32_t>(p),
+                                 1});
+      for (unsigned int w = 0; w < 3U; ++w)
+        snapshot.wires.push_back({{0.5 * p, 0.0, 1.0 + w}, {0.0, 1.0, 0.0}, 5.0, 0.0});
+    }
+    snapshot.opDets.push_back({{-1.0, 0.0, 15.0}, 10.0, 0.0, 0.0, 1.0, 0.0});
+    content.wireChannels = {0U, 1U, 2U, 3U, 4U, 3U};
+    content.fingerprint = 0x1234U;
+    return content;
+  } // makeContent()
+
+  TTree* getTree(TMemFile& file, char const* name)
+  {
+    TTree* tree = nullptr;
+    file.GetObject(name, tree);
+    BOOST_TEST_REQUIRE(tree);
+    return tree;
+  }
+
+} // local namespace
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(tables_test)
+{
+  geo::SharedGeometryContent content = makeContent();
+  TMemFile file{"tables.root", "RECREATE"};
+  geo::writeGeometryTables(file, content);
+
+  {
+    TTree* tree = getTree(file, geo::tables::DetectorTree);
+    BOOST_TEST(tree->GetEntries() == 1);
+    std::string* name = nullptr;
+    std::uint64_t fingerprint = 0U;
+    std::uint32_t version = 0U;
+    tree->SetBranchAddress("name", &name);
+    tree->SetBranchAddress("fingerprint", &fingerprint);
+    tree->SetBranchAddress("version", &version);
+    tree->GetEntry(0);
+    BOOST_TEST(*name == "tabledet");
+    BOOST_TEST(fingerprint == 0x1234U);
+    BOOST_TEST(version == geo::tables::FormatVersion);
+    tree->ResetBranchAddresses();
+    delete name;
+  }
+
+  BOOST_TEST(getTree(file, geo::tables::CryostatTree)->GetEntries() == 1);
+  BOOST_TEST(getTree(file, geo::tables::TPCTree)->GetEntries() == 1);
+  BOOST_TEST(getTree(file, geo::tables::PlaneTree)->GetEntries() == 2);
+  BOOST_TEST(getTree(file, geo::tables::OpDetTree)->GetEntries() == 1);
+
+  {
+    TTree* tree = getTree(file, geo::tables::WireTree);
+    BOOST_TEST(tree->GetEntries() == 6);
+    std::int32_t plane = -1, wire = -1;
+    std::uint32_t channel = 0U;
+    double centerZ = 0.0;
+    tree->SetBranchAddress("plane", &plane);
+    tree->SetBranchAddress("wire", &wire);
+    tree->SetBranchAddress("channel", &channel);
+    tree->SetBranchAddress("centerZ", &centerZ);
+    tree->GetEntry(4);
+    BOOST_TEST(plane == 1);
+    BOOST_TEST(wire == 1);
+    BOOST_TEST(channel == 4U);
+    BOOST_TEST(centerZ == 2.0);
+  }
+
+  {
+    TTree* tree = getTree(file, geo::tables::ChannelTree);
+    BOOST_TEST(tree->GetEntries() == 5);
+    std::uint32_t channel = 0U;
+    std::int32_t nWires = 0, plane = -1, wire = -1, view = -1;
+    tree->SetBranchAddress("channel", &channel);
+    tree->SetBranchAddress("nWires", &nWires);
+    tree->SetBranchAddress("plane", &plane);
+    tree->SetBranchAddress("wire", &wire);
+    tree->SetBranchAddress("view", &view);
+    tree->GetEntry(3);
+    BOOST_TEST(channel == 3U);
+    BOOST_TEST(nWires == 2);
+    BOOST_TEST(plane == 1);
+    BOOST_TEST(wire == 0);
+    BOOST_TEST(view == 1);
+  }
+} // BOOST_AUTO_TEST_CASE(tables_test)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(mismatch_test)
+{
+  geo::SharedGeometryContent content = makeContent();
+  content.wireChannels.pop_back();
+  TMemFile file{"tables.root", "RECREATE"};
+  BOOST_CHECK_THROW(geo::writeGeometryTables(file, content), cet::exception);
+} // BOOST_AUTO_TEST_CASE(mismatch_test)
+
+//------------------------------------------------------------------------------
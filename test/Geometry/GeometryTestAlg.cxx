@@ -14,9 +14,11 @@
 #include "larcorealg/CoreUtils/RealComparisons.h"
 #include "larcorealg/Geometry/AuxDetGeo.h"
 #include "larcorealg/Geometry/AuxDetSensitiveGeo.h"
+#include "larcorealg/Geometry/ChannelChargeBinner.h"
 #include "larcorealg/Geometry/CryostatGeo.h"
 #include "larcorealg/Geometry/Decomposer.h"
 #include "larcorealg/Geometry/Exceptions.h"
+#include "larcorealg/Geometry/GeometryArrayQueries.h"
 #include "larcorealg/Geometry/GeometryCore.h"
 #include "larcorealg/Geometry/PlaneGeo.h"
 #include "larcorealg/Geometry/SimpleGeo.h"
@@ -24,6 +26,7 @@
 #include "larcorealg/Geometry/WireGeo.h"
 #include "larcorealg/Geometry/geo.h"
 #include "larcorealg/Geometry/geo_vectors_utils.h"
+#include "larcorealg/TestUtils/AllocationCounter.h"
 #include "larcoreobj/SimpleTypesAndConstants/PhysicalConstants.h" // util::pi<>
 #include "larcoreobj/SimpleTypesAndConstants/RawTypes.h"          // raw::ChannelID_t
 #include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
@@ -53,13 +56,14 @@
 #include "TVector2.h"
 
 // C/C++ standard libraries
-#include <algorithm> // std::copy()
+#include <algorithm> // std::copy(), std::binary_search()
 #include <array>
 #include <cmath>
 #include <initializer_list>
 #include <iostream>
 #include <iterator> // std::inserter()
 #include <limits>   // std::numeric_limits<>
+#include <map>
 #include <memory>
 #include <set>
 #include <sstream>
@@ -234,6 +238,12 @@ namespace geo {
         MF_LOG_INFO("GeometryTest") << "complete.";
       }
 
+      if (shouldRunTests("WireEndpointBuffer")) {
+        MF_LOG_INFO("GeometryTest") << "test bulk wire end point export...";
+        testWireEndpointBuffer();
+        MF_LOG_INFO("GeometryTest") << "complete.";
+      }
+
       if (shouldRunTests("FindPlaneCenters")) {
         MF_LOG_INFO("GeometryTest") << "test find plane centers...";
         testFindPlaneCenters();
@@ -289,12 +299,54 @@ namespace geo {
         MF_LOG_INFO("GeometryTest") << "complete.";
       }
 
+      if (shouldRunTests("ProjectOntoPlanes")) {
+        MF_LOG_INFO("GeometryTest") << "testProjectOntoPlanes...";
+        testProjectOntoPlanes();
+        MF_LOG_INFO("GeometryTest") << "complete.";
+      }
+
+      if (shouldRunTests("WireSelection")) {
+        MF_LOG_INFO("GeometryTest") << "testWireSelection...";
+        testWireSelection();
+        MF_LOG_INFO("GeometryTest") << "complete.";
+      }
+
       if (shouldRunTests("WireIntersection")) {
         MF_LOG_INFO("GeometryTest") << "testWireIntersection...";
         testWireIntersection();
         MF_LOG_INFO("GeometryTest") << "testWireIntersection complete";
       }
 
+      if (shouldRunTests("ChannelAdjacency")) {
+        MF_LOG_INFO("GeometryTest") << "testChannelAdjacency...";
+        testChannelAdjacency();
+        MF_LOG_INFO("GeometryTest") << "complete.";
+      }
+
+      if (shouldRunTests("LoadReport")) {
+        MF_LOG_INFO("GeometryTest") << "testLoadReport...";
+        testLoadReport();
+        MF_LOG_INFO("GeometryTest") << "complete.";
+      }
+
+      if (shouldRunTests("ChargeBinning")) {
+        MF_LOG_INFO("GeometryTest") << "testChargeBinning...";
+        testChargeBinning();
+        MF_LOG_INFO("GeometryTest") << "complete.";
+      }
+
+      if (shouldRunTests("ArrayQueries")) {
+        MF_LOG_INFO("GeometryTest") << "testArrayQueries...";
+        testArrayQueries();
+        MF_LOG_INFO("GeometryTest") << "complete.";
+      }
+
+      if (shouldRunTests("Allocations")) {
+        MF_LOG_INFO("GeometryTest") << "testAllocations...";
+        testAllocations();
+        MF_LOG_INFO("GeometryTest") << "complete.";
+      }
+
       if (shouldRunTests("ThirdPlane")) {
         MF_LOG_INFO("GeometryTest") << "testThirdPlane...";
         testThirdPlane();
@@ -851,6 +903,35 @@ namespace geo {
         throw cet::exception("UnknownDriftDirection") << "\t\tdrift direction is unknown\n";
       }
 
+      // the cached drift frame is consistent with the drift queries
+      geo::TPCGeo::DriftFrame_t const& frame = tpc.DriftFrame();
+      auto const cathode = tpc.GetCathodeCenter<geo::Point_t>();
+      double const cathodeDistance = frame.distanceToAnode(cathode.X(), cathode.Y(), cathode.Z());
+      if ((std::abs(frame.driftDistance - tpc.DriftDistance()) > 1e-9) ||
+          (std::abs(cathodeDistance - tpc.DriftDistance()) > 1e-4) ||
+          (std::abs(frame.anodeCoord - frame.cathodeCoord - tpc.DriftDistance()) > 1e-4)) {
+        throw cet::exception("BadDriftFrame")
+          << "Drift frame of " << tpcid << " has drift distance " << frame.driftDistance
+          << " (cathode at " << cathodeDistance << " from anode, coordinates " << frame.cathodeCoord
+          << " to " << frame.anodeCoord << "), " << tpc.DriftDistance() << " expected\n";
+      }
+
+      // the view tables match the planes
+      for (geo::PlaneGeo const& plane : tpc.IteratePlanes()) {
+        geo::TPCGeo::ViewInfo_t const* info = geom->ViewInfoPtr(plane.View(), tpcid);
+        if (!info || (info->plane != plane.ID().Plane) || (info->pitch != plane.WirePitch()) ||
+            (info->thetaZ != plane.ThetaZ()) ||
+            (geom->WirePitch(plane.View(), tpcid) != plane.WirePitch()) ||
+            (geom->WireAngleToVertical(plane.View(), tpcid) != plane.ThetaZ())) {
+          throw cet::exception("BadViewInfo")
+            << "View " << geo::PlaneGeo::ViewName(plane.View()) << " of " << tpcid
+            << " does not match " << plane.ID() << "\n";
+        }
+      } // for planes
+      if (geom->ViewInfoPtr(tpc.Plane(0).View(), geo::TPCID{})) {
+        throw cet::exception("BadViewInfo") << "View information found for an invalid TPC\n";
+      }
+
       MF_LOG_DEBUG("GeometryTest") << "\t testing PositionToTPC...";
       // pick a position in the middle of the TPC in the world coordinates
       double worldLoc[3] = {0.};
@@ -863,9 +944,97 @@ namespace geo {
         throw cet::exception("BadTPCLookupFromPosition")
           << "TPC look up returned tpc = " << tpcNo << " should be " << t << "\n";
 
+      // the same, with each of the TPCs as hint
+      geo::Point_t const center = geo::vect::makePointFromCoords(worldLoc);
+      for (geo::TPCGeo const& hintTPC : cryo.IterateTPCs()) {
+        geo::TPCID const hintedID = geom->FindTPCAtPosition(center, hintTPC.ID());
+        if (hintedID != tpcid) {
+          throw cet::exception("BadTPCLookupFromPosition")
+            << "TPC look up with hint " << hintTPC.ID() << " returned " << hintedID
+            << ", should be " << tpcid << "\n";
+        }
+      } // for hint TPC
+
+      // adjacency is symmetric
+      for (geo::TPCID::TPCID_t const other : cryo.AdjacentTPCs(t)) {
+        auto const& otherAdjacent = cryo.AdjacentTPCs(other);
+        if ((other == t) ||
+            !std::binary_search(otherAdjacent.begin(), otherAdjacent.end(), tpcid.TPC)) {
+          throw cet::exception("BadTPCAdjacency")
+            << "TPC " << tpcid << " lists TPC " << other << " as adjacent, but not vice versa\n";
+        }
+      } // for adjacent TPCs
+
       MF_LOG_DEBUG("GeometryTest") << "done.";
     } // for TPC
 
+    MF_LOG_DEBUG("GeometryTest") << "\t testing FindTPCsAtPositions...";
+    // a "trajectory" visiting each TPC center twice, then a point out of it
+    std::vector<geo::Point_t> points;
+    for (geo::TPCGeo const& tpc : cryo.IterateTPCs()) {
+      points.push_back(tpc.GetCenter());
+      points.push_back(tpc.GetCenter());
+    }
+    points.push_back(cryo.GetCenter() + 2.0 * (cryo.Max() - cryo.GetCenter()));
+    std::vector<geo::TPCID> tpcids(points.size());
+    geom->FindTPCsAtPositions({points.data(), points.data() + points.size()},
+                              {tpcids.data(), tpcids.data() + tpcids.size()});
+    std::vector<geo::CryostatID> cryoids(points.size());
+    geom->PositionsToCryostatIDs({points.data(), points.data() + points.size()},
+                                 {cryoids.data(), cryoids.data() + cryoids.size()});
+    for (std::size_t i = 0; i < points.size(); ++i) {
+      geo::TPCID const expected = geom->FindTPCAtPosition(points[i]);
+      if ((tpcids[i] != expected) || (tpcids[i].isValid != expected.isValid)) {
+        throw cet::exception("BadTPCLookupFromPosition")
+          << "FindTPCsAtPositions() returned " << tpcids[i] << " for point " << points[i]
+          << ", FindTPCAtPosition() " << expected << "\n";
+      }
+      if (cryoids[i] != geom->PositionToCryostatID(points[i])) {
+        throw cet::exception("BadCryostatLookupFromPosition")
+          << "PositionsToCryostatIDs() returned " << cryoids[i] << " for point " << points[i]
+          << ", PositionToCryostatID() " << geom->PositionToCryostatID(points[i]) << "\n";
+      }
+      // the non-throwing queries agree with the ones returning IDs
+      auto const tpc = geom->TryPositionToTPC(points[i]);
+      if (tpc ? (tpc->ID() != expected) : expected.isValid) {
+        throw cet::exception("BadTPCLookupFromPosition")
+          << "TryPositionToTPC() for point " << points[i] << " disagrees with FindTPCAtPosition() "
+          << expected << " (" << tpc.message() << ")\n";
+      }
+      auto const cryostat = geom->TryPositionToCryostat(points[i]);
+      if (bool(cryostat) != cryoids[i].isValid ||
+          (cryostat && (cryostat->ID() != cryoids[i]))) {
+        throw cet::exception("BadCryostatLookupFromPosition")
+          << "TryPositionToCryostat() for point " << points[i]
+          << " disagrees with PositionToCryostatID() " << cryoids[i] << "\n";
+      }
+    } // for points
+    MF_LOG_DEBUG("GeometryTest") << "done.";
+
+    MF_LOG_DEBUG("GeometryTest") << "\t testing TPCCrossings...";
+    // a short step inside the active volume of each TPC
+    for (geo::TPCGeo const& tpc : cryo.IterateTPCs()) {
+      geo::BoxBoundedGeo const& active = tpc.ActiveBoundingBox();
+      geo::Point_t const center = active.Center();
+      std::array<geo::Point_t, 2U> const step{center, center + 0.1 * (active.Max() - center)};
+      auto const crossings = geom->TPCCrossings({step.data(), step.data() + step.size()});
+      auto const itCrossing =
+        std::find_if(crossings.begin(), crossings.end(), [&tpc](auto const& crossing) {
+          return crossing.ID == tpc.ID();
+        });
+      if (itCrossing == crossings.end()) {
+        throw cet::exception("BadTPCCrossing")
+          << "TPCCrossings() does not find a step inside " << tpc.ID() << "\n";
+      }
+      double const length = (step[1] - step[0]).R();
+      if (std::abs(itCrossing->length - length) > 1e-6 * length) {
+        throw cet::exception("BadTPCCrossing")
+          << "TPCCrossings() finds a step of " << length << " cm in " << tpc.ID() << " to be "
+          << itCrossing->length << " cm long\n";
+      }
+    } // for TPCs
+    MF_LOG_DEBUG("GeometryTest") << "done.";
+
     return;
   }
 
@@ -1394,6 +1563,13 @@ namespace geo {
 
     } // for channel
 
+    // the channels of the TPC sets are tabulated once and for all
+    std::vector<raw::ChannelID_t> const& channels = geom->ChannelsInTPCs();
+    if (!std::is_sorted(channels.begin(), channels.end()) ||
+        (&channels != &geom->ChannelsInTPCs())) {
+      throw cet::exception("testChannelToROP") << "ChannelsInTPCs() list is not sorted or cached\n";
+    }
+
   } // GeometryTestAlg::testChannelToROP()
 
   //......................................................................
@@ -1433,6 +1609,39 @@ namespace geo {
           << " but ChannelToWire() does not map the channel to that wire\n";
       }
 
+      // the non-allocating view must describe exactly the same list
+      auto const wireIDspan = geom->ChannelToWireIDs(channel);
+      if (!std::equal(begin(wireIDs), end(wireIDs), wireIDspan.begin(), wireIDspan.end())) {
+        throw cet::exception("BadChannelLookup")
+          << "ChannelToWireIDs() returned " << wireIDspan.size() << " wire IDs for channel #"
+          << channel << ", which differ from the " << wireIDs.size()
+          << " from ChannelToWire()\n";
+      }
+      geo::GeometryCore::WireIDlist_t wireIDlist;
+      geom->ChannelToWire(channel, wireIDlist);
+      if (!std::equal(begin(wireIDs), end(wireIDs), wireIDlist.begin(), wireIDlist.end())) {
+        throw cet::exception("BadChannelLookup")
+          << "ChannelToWire() filled a list of " << wireIDlist.size() << " wire IDs for channel #"
+          << channel << ", which differ from the " << wireIDs.size() << " it returns\n";
+      }
+
+      // the table of wire objects must point to the same wires
+      auto const wireGeos = geom->ChannelToWireGeos(channel);
+      if ((wireGeos.size() != wireIDs.size()) ||
+          !std::equal(
+            begin(wireIDs), end(wireIDs), wireGeos.begin(), [this](auto const& wid, auto wire) {
+              return wire == &geom->Wire(wid);
+            })) {
+        throw cet::exception("BadChannelLookup")
+          << "ChannelToWireGeos() returned " << wireGeos.size() << " wires for channel #"
+          << channel << ", which differ from the " << wireIDs.size()
+          << " from ChannelToWire()\n";
+      }
+      if (geom->ChannelToWireGeo(channel) != &geom->Wire(wireIDs.front())) {
+        throw cet::exception("BadChannelLookup")
+          << "ChannelToWireGeo() does not return the first wire of channel #" << channel << "\n";
+      }
+
       // currently (LArSoft 6.12) signal type from channel and from plane use
       // the same underlying code, so the following test is not very valuable
       auto const channelSigType = geom->SignalType(channel);
@@ -1475,8 +1684,98 @@ namespace geo {
 
     } // for wires in detector
 
+    // the batch conversions must agree with the single-element ones
+    std::vector<geo::WireID> allWireIDs;
+    for (geo::WireID const& wireID : geom->IterateWireIDs())
+      allWireIDs.push_back(wireID);
+    std::vector<raw::ChannelID_t> allChannels(allWireIDs.size(), raw::InvalidChannelID);
+    geom->PlaneWireToChannels({allWireIDs.data(), allWireIDs.data() + allWireIDs.size()},
+                              {allChannels.data(), allChannels.data() + allChannels.size()});
+    std::vector<geo::GeometryCore::WireIDspan_t> allWireSpans(allChannels.size());
+    geom->ChannelsToWireIDs({allChannels.data(), allChannels.data() + allChannels.size()},
+                            {allWireSpans.data(), allWireSpans.data() + allWireSpans.size()});
+    for (std::size_t i = 0; i < allWireIDs.size(); ++i) {
+      if (allChannels[i] != geom->PlaneWireToChannel(allWireIDs[i])) {
+        throw cet::exception("BadChannelLookup")
+          << "PlaneWireToChannels() maps " << std::string(allWireIDs[i]) << " to channel #"
+          << allChannels[i] << " instead of #" << geom->PlaneWireToChannel(allWireIDs[i]) << "\n";
+      }
+      auto const wireIDspan = geom->ChannelToWireIDs(allChannels[i]);
+      if ((allWireSpans[i].begin() != wireIDspan.begin()) ||
+          (allWireSpans[i].end() != wireIDspan.end())) {
+        throw cet::exception("BadChannelLookup")
+          << "ChannelsToWireIDs() returned a different list of wires for channel #"
+          << allChannels[i] << " than ChannelToWireIDs()\n";
+      }
+    } // for
+
+    if (geom->ChannelToWireGeo(raw::InvalidChannelID) ||
+        !geom->ChannelToWireGeos(raw::InvalidChannelID).empty()) {
+      throw cet::exception("BadChannelLookup")
+        << "ChannelToWireGeo() returned a wire for an invalid channel\n";
+    }
+
   } // GeometryTestAlg::testChannelToWire()
 
+  //......................................................................
+  void GeometryTestAlg::testWireEndpointBuffer() const
+  {
+    // the whole detector, with the ends sorted as in WireEndPoints()
+    auto const all = geom->MakeWireEndpointBuffer<double>(true);
+    std::size_t nWires = 0;
+    for (geo::PlaneGeo const& plane : geom->IteratePlanes())
+      nWires += plane.Nwires();
+    if (all.size() != nWires ||
+        all.vertices.size() != all.size() * all.CoordsPerWire ||
+        all.channels.size() != all.size() || !all.isValidFor(geom->Fingerprint())) {
+      throw cet::exception("WireEndpointBuffer")
+        << "Buffer of " << all.size() << " wires (" << all.vertices.size() << " coordinates, "
+        << all.channels.size() << " channels) for " << nWires << " wires\n";
+    }
+    std::size_t i = 0;
+    for (geo::WireID const& wireID : geom->IterateWireIDs()) {
+      double start[3], end[3];
+      geom->WireEndPoints(wireID, start, end);
+      bool same = (all.wires[i] == wireID) &&
+                  (all.channels[i] == geom->PlaneWireToChannel(wireID));
+      for (std::size_t c = 0; c < 3U; ++c) {
+        same = same && (std::abs(all.start(i)[c] - start[c]) < 1e-6) &&
+               (std::abs(all.end(i)[c] - end[c]) < 1e-6);
+      }
+      if (!same) {
+        throw cet::exception("WireEndpointBuffer")
+          << "Wire #" << i << " in the buffer (" << all.wires[i] << ", channel "
+          << all.channels[i] << ") does not match " << wireID << "\n";
+      }
+      ++i;
+    } // for wires
+
+    // single precision, by TPC and by plane, in the same order
+    std::size_t first = 0;
+    for (geo::TPCGeo const& TPC : geom->IterateTPCs()) {
+      auto const TPCwires = geom->MakeWireEndpointBuffer(TPC.ID());
+      for (geo::PlaneGeo const& plane : TPC.IteratePlanes()) {
+        auto const planeWires = geom->MakeWireEndpointBuffer(plane.ID());
+        if (planeWires.size() != plane.Nwires()) {
+          throw cet::exception("WireEndpointBuffer")
+            << "Buffer of " << planeWires.size() << " wires for " << plane.ID() << "\n";
+        }
+      } // for planes
+      for (std::size_t j = 0; j < TPCwires.size(); ++j) {
+        geo::WireGeo const& wire = geom->Wire(TPCwires.wires[j]);
+        auto const wireStart = wire.GetStart<geo::Point_t>();
+        if ((TPCwires.wires[j] != all.wires[first + j]) ||
+            (std::abs(TPCwires.start(j)[1] - wireStart.Y()) > 1e-3)) {
+          throw cet::exception("WireEndpointBuffer")
+            << "Wire #" << j << " of " << TPC.ID() << " (" << TPCwires.wires[j]
+            << ") does not match the detector buffer\n";
+        }
+      } // for wires of the TPC
+      first += TPCwires.size();
+    } // for TPCs
+
+  } // GeometryTestAlg::testWireEndpointBuffer()
+
   //......................................................................
   void GeometryTestAlg::testFindPlaneCenters()
   {
@@ -2123,15 +2422,38 @@ namespace geo {
         }
 
       } // for all wires in the plane
-    }   // end loop over planes
+
+      // the batch wire coordinate must match the single-position one
+      if (bTestWireCoordinate) {
+        std::vector<double> wireY, wireZ;
+        for (geo::WireGeo const& wire : plane.IterateWires()) {
+          wireY.push_back(wire.GetCenter().Y());
+          wireZ.push_back(wire.GetCenter().Z());
+        }
+        std::vector<double> wireCoords(wireY.size());
+        geom->WireCoordinates({wireY.data(), wireY.data() + wireY.size()},
+                              {wireZ.data(), wireZ.data() + wireZ.size()},
+                              planeID,
+                              {wireCoords.data(), wireCoords.data() + wireCoords.size()});
+        for (std::size_t i = 0; i < wireCoords.size(); ++i) {
+          double const expected = geom->WireCoordinate(wireY[i], wireZ[i], planeID);
+          if (std::abs(wireCoords[i] - expected) > 1e-9) {
+            throw cet::exception("GeoTestErrorWireCoordinate")
+              << "WireCoordinates() on wire #" << i << " of " << std::string(planeID)
+              << " returned " << wireCoords[i] << ", " << expected << " expected\n";
+          }
+        } // for
+      }   // if testing WireCoordinate
+
+    } // end loop over planes
 
     stopWatch.Stop();
     MF_LOG_DEBUG("GeoTestWireCoordinate") << "\tdone testing closest channel";
     stopWatch.Print();
 
-    // trigger an exception with NearestChannel
-    mf::LogVerbatim("GeoTestWireCoordinate") << "\tattempt to cause an exception to be caught "
-                                             << "when looking for a nearest channel";
+    // NearestChannel must report an out-of-the-world position as invalid channel
+    mf::LogVerbatim("GeoTestWireCoordinate") << "\tattempt to look for a nearest channel "
+                                             << "of a position out of the world";
 
     // pick a position out of the world
     double posWorld[3];
@@ -2139,27 +2461,14 @@ namespace geo {
     for (int i = 0; i < 3; ++i)
       posWorld[i] *= 2.;
 
-    bool hasThrown = false;
-    unsigned int nearest_to_what = 0;
-    try {
-      nearest_to_what = geom->NearestChannel(posWorld, 0, 0, 0);
-    }
-    catch (const geo::InvalidWireIDError& e) {
-      mf::LogWarning("GeoTestCaughtException") << e << "\nReturned wire would be: " << e.wire_number
-                                               << ", suggested: " << e.better_wire_number;
-      hasThrown = true;
-    }
-    catch (cet::exception& e) {
-      mf::LogWarning("GeoTestCaughtException") << e;
-      hasThrown = true;
-    }
-    if (!hasThrown) {
+    raw::ChannelID_t const nearest_to_what = geom->NearestChannel(posWorld, 0, 0, 0);
+    if (raw::isValidChannelID(nearest_to_what)) {
       if (fDisableValidWireIDcheck) {
         // ok, then why do we disable it?
         // an implementation might prefer to cap the wire number and go on
-        // instead of throwing.
+        // instead of reporting the failure.
         MF_LOG_WARNING("GeoTestWireCoordinate")
-          << "GeometryCore::NearestChannel() did not raise an exception"
+          << "GeometryCore::NearestChannel() did not return an invalid channel"
              " on out-of-world position ("
           << posWorld[0] << "; " << posWorld[1] << "; " << posWorld[2] << "), and returned "
           << nearest_to_what
@@ -2168,14 +2477,271 @@ namespace geo {
       }
       else {
         throw cet::exception("GeoTestErrorNearestChannel")
-          << "GeometryCore::NearestChannel() did not raise an exception"
+          << "GeometryCore::NearestChannel() did not return an invalid channel"
              " on out-of-world position ("
           << posWorld[0] << "; " << posWorld[1] << "; " << posWorld[2] << "), and returned "
           << nearest_to_what << " instead\n";
       }
     }
+
+    // the checked wire query must agree with the throwing one
+    geo::PlaneGeo const& firstPlane = geom->Plane(geo::PlaneID{0, 0, 0});
+    geo::Point_t const outPoint = geo::vect::makePointFromCoords(posWorld);
+    geo::WireID const checkedID = firstPlane.NearestWireIDchecked(outPoint);
+    auto const triedID = geom->TryNearestWireID(outPoint, firstPlane.ID());
+    try {
+      geo::WireID const wireID = firstPlane.NearestWireID(outPoint);
+      if (!checkedID || (checkedID != wireID)) {
+        throw cet::exception("GeoTestErrorNearestChannel")
+          << "PlaneGeo::NearestWireIDchecked() returned " << checkedID << " instead of "
+          << wireID << "\n";
+      }
+      if (!triedID || (*triedID != wireID)) {
+        throw cet::exception("GeoTestErrorNearestChannel")
+          << "GeometryCore::TryNearestWireID() failed (" << triedID.message() << ") instead of "
+          << "returning " << wireID << "\n";
+      }
+    }
+    catch (geo::InvalidWireError const& e) {
+      if (checkedID || (checkedID.Wire != (geo::WireID::WireID_t)e.suggestedWire())) {
+        throw cet::exception("GeoTestErrorNearestChannel")
+          << "PlaneGeo::NearestWireIDchecked() returned " << checkedID << " (valid: "
+          << checkedID.isValid << ") instead of an invalid ID with wire " << e.suggestedWire()
+          << "\n";
+      }
+      if (triedID || (triedID.error() != geo::QueryError::WireOutOfRange)) {
+        throw cet::exception("GeoTestErrorNearestChannel")
+          << "GeometryCore::TryNearestWireID() did not fail with WireOutOfRange where"
+             " PlaneGeo::NearestWireID() throws\n";
+      }
+    }
   }
 
+  //......................................................................
+  void GeometryTestAlg::testWireSelection() const
+  {
+    /*
+     * Compares the wires of selections by view, signal type, TPC set and box
+     * with the ones found filtering all the wires of the detector (or, for
+     * the box, the ranges of `WiresInRange()`).
+     */
+    using WireRange_t = geo::PlaneGeo::WireRange_t;
+
+    // all the criteria but the box, element by element
+    auto const passes = [this](geo::WireSelection const& sel, geo::PlaneID const& pid) {
+      if (sel.views() && !(sel.views() & geo::TPCGeo::ViewBit(geom->View(pid)))) return false;
+      if ((sel.signalType() != geo::kMysteryType) && (geom->SignalType(pid) != sel.signalType()))
+        return false;
+      if (sel.allTPCs()) return true;
+      auto const& TPCs = sel.TPCs();
+      if (std::find(TPCs.begin(), TPCs.end(), pid.asTPCID()) != TPCs.end()) return true;
+      for (readout::TPCsetID const& tpcsetid : sel.TPCsets()) {
+        if (geom->TPCtoTPCset(pid.asTPCID()) == tpcsetid) return true;
+      }
+      return false;
+    };
+    auto const expected = [this, &passes](geo::WireSelection const& sel) {
+      std::vector<geo::WireID> wires;
+      if (sel.box()) {
+        for (WireRange_t const& range : geom->WiresInRange(*sel.box())) {
+          if (!passes(sel, range.planeID)) continue;
+          for (unsigned int i = 0; i < range.size(); ++i)
+            wires.push_back(range.wireID(i));
+        }
+      }
+      else {
+        for (geo::WireID const& wireID : geom->IterateWireIDs())
+          if (passes(sel, wireID.asPlaneID())) wires.push_back(wireID);
+      }
+      return wires;
+    };
+
+    std::vector<geo::WireSelection> selections(1U); // all the wires
+    for (geo::View_t const view : geom->Views())
+      selections.push_back(geo::WireSelection{}.inView(view));
+    selections.push_back(geo::WireSelection{}.withSignalType(geo::kCollection));
+    selections.push_back(geo::WireSelection{}.withSignalType(geo::kInduction));
+    for (readout::TPCsetID const& tpcsetid : geom->IterateTPCsetIDs()) {
+      selections.push_back(geo::WireSelection{}.inTPCset(tpcsetid));
+      selections.push_back(
+        geo::WireSelection{}.inTPCset(tpcsetid).withSignalType(geo::kCollection));
+    }
+    for (geo::TPCGeo const& tpc : geom->IterateTPCs()) {
+      geo::BoxBoundedGeo const& box = tpc.ActiveBoundingBox();
+      geo::BoxBoundedGeo const part{
+        {box.MinX(), box.MinY() + 0.3 * box.SizeY(), box.MinZ() + 0.2 * box.SizeZ()},
+        {box.MaxX(), box.MinY() + 0.6 * box.SizeY(), box.MinZ() + 0.4 * box.SizeZ()}};
+      selections.push_back(geo::WireSelection{}.inBox(part));
+      selections.push_back(geo::WireSelection{}.inBox(part).withSignalType(geo::kCollection));
+      selections.push_back(geo::WireSelection{}.inBox(box).inBox(part).inTPC(tpc.ID()));
+    } // for TPCs
+
+    unsigned int nErrors = 0U;
+    for (std::size_t iSel = 0; iSel < selections.size(); ++iSel) {
+      geo::WireSelection const& sel = selections[iSel];
+      std::vector<geo::WireID> const expectedWires = expected(sel);
+      std::vector<geo::WireID> wires;
+      for (geo::WireID const& wireID : geom->IterateWireIDs(sel))
+        wires.push_back(wireID);
+      if (wires != expectedWires) {
+        mf::LogProblem("GeometryTestAlg")
+          << "IterateWireIDs() on selection #" << iSel << " returned " << wires.size()
+          << " wires, " << expectedWires.size() << " expected";
+        ++nErrors;
+      }
+      for (WireRange_t const& range : geom->SelectWireRanges(sel)) {
+        if (range.empty()) {
+          mf::LogProblem("GeometryTestAlg")
+            << "SelectWireRanges() on selection #" << iSel << " returned an empty range on "
+            << range.planeID;
+          ++nErrors;
+        }
+      }
+    } // for selections
+
+    // boxes not overlapping select nothing
+    geo::BoxBoundedGeo const& first = geom->TPC().ActiveBoundingBox();
+    geo::BoxBoundedGeo const away{{first.MaxX() + 1.0, first.MinY(), first.MinZ()},
+                                  {first.MaxX() + 2.0, first.MaxY(), first.MaxZ()}};
+    if (!geom->IterateWireIDs(geo::WireSelection{}.inBox(first).inBox(away)).empty()) {
+      mf::LogProblem("GeometryTestAlg") << "Selection of two separate boxes is not empty";
+      ++nErrors;
+    }
+
+    if (nErrors > 0U) {
+      throw cet::exception("GeometryTestAlg")
+        << "testWireSelection() found " << nErrors << " errors\n";
+    }
+  } // GeometryTestAlg::testWireSelection()
+
+  //......................................................................
+  void GeometryTestAlg::testProjectOntoPlanes() const
+  {
+    /*
+     * For points spread in the active volume of each TPC, and a bit beyond,
+     * checks that the projections on all the planes in one go match the ones
+     * from the single plane queries, and that the three forms agree.
+     */
+    unsigned int nErrors = 0U;
+    std::vector<geo::Point_t> points;
+    for (geo::TPCGeo const& tpc : geom->IterateTPCs()) {
+      geo::BoxBoundedGeo const& box = tpc.ActiveBoundingBox();
+      for (double const fx : {0.05, 0.5, 0.95}) {
+        for (double const fy : {-0.05, 0.3, 0.7, 1.05}) {
+          for (double const fz : {-0.05, 0.2, 0.5, 0.8, 1.05}) {
+            points.emplace_back(box.MinX() + fx * box.SizeX(),
+                                box.MinY() + fy * box.SizeY(),
+                                box.MinZ() + fz * box.SizeZ());
+          }
+        }
+      }
+    } // for TPCs
+
+    std::vector<geo::GeometryCore::PlaneProjection_t> projections;
+    for (geo::Point_t const& point : points) {
+      geo::TPCID const tpcid = geom->ProjectOntoPlanes(point, projections);
+      geo::TPCID const expectedTPC = geom->FindTPCAtPosition(point);
+      if ((tpcid.isValid != expectedTPC.isValid) || (tpcid.isValid && (tpcid != expectedTPC))) {
+        mf::LogProblem("GeometryTestAlg") << "ProjectOntoPlanes() found " << tpcid << " for "
+                                          << point << ", " << expectedTPC << " expected";
+        ++nErrors;
+        continue;
+      }
+      if (!tpcid) {
+        if (!projections.empty()) {
+          mf::LogProblem("GeometryTestAlg")
+            << "ProjectOntoPlanes() projected " << point << " out of any TPC";
+          ++nErrors;
+        }
+        continue;
+      }
+      geo::TPCGeo const& tpc = geom->TPC(tpcid);
+      if (projections.size() != tpc.Nplanes()) {
+        mf::LogProblem("GeometryTestAlg") << "ProjectOntoPlanes() returned " << projections.size()
+                                          << " projections for " << point << " in " << tpcid;
+        ++nErrors;
+        continue;
+      }
+      for (geo::PlaneGeo const& plane : tpc.IteratePlanes()) {
+        auto const& proj = projections[plane.ID().Plane];
+        geo::WireID const expectedWire = plane.NearestWireIDchecked(point);
+        double const expectedCoord = plane.WireCoordinate(point);
+        if ((proj.plane != plane.ID()) || (std::abs(proj.wireCoordinate - expectedCoord) > 1e-9) ||
+            (proj.nearestWire.asPlaneID() != plane.ID()) ||
+            (proj.nearestWire.Wire != expectedWire.Wire) ||
+            (proj.inPlane != expectedWire.isValid) ||
+            (proj.channel != geom->PlaneWireToChannel(proj.nearestWire))) {
+          mf::LogProblem("GeometryTestAlg")
+            << "ProjectOntoPlanes() on " << point << " returned for " << proj.plane
+            << " wire coordinate " << proj.wireCoordinate << " (" << expectedCoord
+            << " expected), nearest wire " << proj.nearestWire << " (" << expectedWire.Wire
+            << " expected, in plane: " << proj.inPlane << ", expected: " << expectedWire.isValid
+            << "), channel " << proj.channel;
+          ++nErrors;
+        }
+      } // for planes
+
+      // the batch form on the same TPC returns the same results
+      double const x = point.X(), y = point.Y(), z = point.Z();
+      std::vector<geo::GeometryCore::PlaneProjection_t> batch(tpc.Nplanes());
+      geom->ProjectOntoPlanes(tpcid, 1U, &x, &y, &z, batch.data());
+      for (std::size_t p = 0; p < batch.size(); ++p) {
+        if ((batch[p].wireCoordinate != projections[p].wireCoordinate) ||
+            (batch[p].nearestWire != projections[p].nearestWire)) {
+          mf::LogProblem("GeometryTestAlg")
+            << "ProjectOntoPlanes() on " << point << " in " << tpcid
+            << " differs from the single point projection on plane #" << p;
+          ++nErrors;
+        }
+      }
+    } // for points
+
+    // the form on many points returns the same as the single point one
+    std::vector<geo::GeometryCore::PlaneProjection_t> all;
+    std::vector<std::size_t> offsets;
+    geom->ProjectOntoPlanes(points, all, offsets);
+    if (offsets.size() != points.size() + 1U) {
+      throw cet::exception("GeometryTestAlg")
+        << "ProjectOntoPlanes() returned " << offsets.size() << " offsets for " << points.size()
+        << " points\n";
+    }
+    for (std::size_t i = 0; i < points.size(); ++i) {
+      geom->ProjectOntoPlanes(points[i], projections);
+      bool same = (offsets[i + 1] - offsets[i] == projections.size());
+      for (std::size_t p = 0; same && (p < projections.size()); ++p)
+        same = (all[offsets[i] + p].nearestWire == projections[p].nearestWire);
+      if (!same) {
+        mf::LogProblem("GeometryTestAlg")
+          << "ProjectOntoPlanes() on many points differs for " << points[i];
+        ++nErrors;
+      }
+    } // for points
+
+    // points alternating between the TPCs are sorted and put back in order
+    std::vector<geo::Point_t> mixed;
+    for (std::size_t i = 0; i < points.size(); ++i)
+      mixed.push_back(points[(i % 2U == 0U) ? i / 2U : points.size() - 1U - i / 2U]);
+    std::vector<geo::GeometryCore::PlaneProjection_t> allMixed;
+    std::vector<std::size_t> mixedOffsets;
+    geom->ProjectOntoPlanes(mixed, allMixed, mixedOffsets);
+    for (std::size_t i = 0; i < mixed.size(); ++i) {
+      geom->ProjectOntoPlanes(mixed[i], projections);
+      bool same = (mixedOffsets[i + 1] - mixedOffsets[i] == projections.size());
+      for (std::size_t p = 0; same && (p < projections.size()); ++p)
+        same = (allMixed[mixedOffsets[i] + p].nearestWire == projections[p].nearestWire);
+      if (!same) {
+        mf::LogProblem("GeometryTestAlg")
+          << "ProjectOntoPlanes() on many mixed points differs for " << mixed[i];
+        ++nErrors;
+      }
+    } // for mixed points
+
+    if (nErrors > 0) {
+      throw cet::exception("GeometryTestAlg")
+        << "testProjectOntoPlanes() accumulated " << nErrors << " errors (see messages above)\n";
+    }
+  } // GeometryTestAlg::testProjectOntoPlanes()
+
   //......................................................................
   bool GeometryTestAlg::isWireAlignedToPlaneDirections(geo::PlaneGeo const& plane,
                                                        geo::Vector_t const& wireDir) const
@@ -2356,6 +2922,441 @@ namespace geo {
 
   } // GeometryTestAlg::testWireIntersection()
 
+  //......................................................................
+  void GeometryTestAlg::testChannelAdjacency() const
+  {
+    /*
+     * Compares the tables of neighboring and crossing channels with the
+     * channels found wire by wire, on a sample of the channels.
+     */
+    auto const sorted = [](std::vector<raw::ChannelID_t> channels, raw::ChannelID_t channel) {
+      std::sort(channels.begin(), channels.end());
+      channels.erase(std::unique(channels.begin(), channels.end()), channels.end());
+      channels.erase(std::remove(channels.begin(), channels.end(), channel), channels.end());
+      return channels;
+    };
+
+    unsigned int const nChannels = geom->Nchannels();
+    unsigned int const step = std::max(nChannels / 500U, 1U);
+    unsigned int nErrors = 0U, nCrossings = 0U;
+    geo::Point_t intersection;
+    for (raw::ChannelID_t channel = 0; channel < nChannels; channel += step) {
+      std::vector<raw::ChannelID_t> neighbors, crossings;
+      for (geo::WireID const& wireID : geom->ChannelToWire(channel)) {
+        for (geo::WireID const& other : geom->IterateWireIDs(wireID.asPlaneID())) {
+          if ((other.Wire + 1U >= wireID.Wire) && (other.Wire <= wireID.Wire + 1U))
+            neighbors.push_back(geom->PlaneWireToChannel(other));
+        }
+        for (geo::PlaneID const& planeID : geom->IteratePlaneIDs(wireID.asTPCID())) {
+          if (planeID == wireID.asPlaneID()) continue;
+          for (geo::WireID const& other : geom->IterateWireIDs(planeID)) {
+            if (geom->WireIDsIntersect(wireID, other, intersection))
+              crossings.push_back(geom->PlaneWireToChannel(other));
+          }
+        }
+      } // for wires of the channel
+      neighbors = sorted(std::move(neighbors), channel);
+      crossings = sorted(std::move(crossings), channel);
+      nCrossings += crossings.size();
+
+      auto const tableNeighbors = geom->ChannelNeighbors(channel);
+      if (!std::equal(
+            tableNeighbors.begin(), tableNeighbors.end(), neighbors.begin(), neighbors.end())) {
+        mf::LogProblem("GeometryTestAlg")
+          << "ChannelNeighbors(" << channel << ") returned " << tableNeighbors.size()
+          << " channels, " << neighbors.size() << " expected";
+        ++nErrors;
+      }
+      auto const tableCrossings = geom->CrossingChannels(channel);
+      if (!std::equal(
+            tableCrossings.begin(), tableCrossings.end(), crossings.begin(), crossings.end())) {
+        mf::LogProblem("GeometryTestAlg")
+          << "CrossingChannels(" << channel << ") returned " << tableCrossings.size()
+          << " channels, " << crossings.size() << " expected";
+        ++nErrors;
+      }
+    } // for channels
+
+    // a wider neighborhood includes the narrower one
+    geo::ChannelAdjacency const wide = geom->MakeChannelAdjacency(3U);
+    for (raw::ChannelID_t channel = 0; channel < nChannels; channel += step) {
+      auto const narrow = geom->ChannelNeighbors(channel);
+      auto const neighbors = wide.neighbors(channel);
+      if (!std::includes(neighbors.begin(), neighbors.end(), narrow.begin(), narrow.end())) {
+        mf::LogProblem("GeometryTestAlg")
+          << "Neighbors of channel " << channel << " within 3 wires miss some within 1";
+        ++nErrors;
+      }
+    }
+
+    MF_LOG_DEBUG("GeometryTest") << "Checked " << nCrossings << " crossings of "
+                                 << ((nChannels + step - 1U) / step) << " channels";
+
+    if (nErrors > 0U) {
+      throw cet::exception("GeometryTestAlg")
+        << "testChannelAdjacency() found " << nErrors << " errors\n";
+    }
+  } // GeometryTestAlg::testChannelAdjacency()
+
+  void GeometryTestAlg::testLoadReport() const
+  {
+    /*
+     * Checks that all the phases of the loading are timed, and that the
+     * object counts match the geometry.
+     */
+    geo::GeometryLoadReport const& report = geom->LoadReport();
+    unsigned int nErrors = 0U;
+
+    for (std::string const name : {"BuildCryostats",
+                                    "BuildAuxDets",
+                                    "SortGeometry",
+                                    "UpdateAfterSorting",
+                                    "ChannelMapAlg::Initialize",
+                                    "ChannelTables"}) {
+      auto const& phases = report.phases();
+      auto const iPhase = std::find_if(phases.begin(), phases.end(), [&name](auto const& phase) {
+        return phase.name == name;
+      });
+      if ((iPhase == phases.end()) || (iPhase->seconds < 0.0)) {
+        mf::LogProblem("GeometryTestAlg") << "Load report has no valid phase '" << name << "'";
+        ++nErrors;
+      }
+    }
+
+    std::size_t nPlanes = 0U;
+    for (geo::PlaneID const& planeid [[maybe_unused]] : geom->IteratePlaneIDs())
+      ++nPlanes;
+    std::pair<char const*, std::size_t> const expectedCounts[] = {
+      {"Cryostats", geom->Ncryostats()},
+      {"TPCs", geom->TotalNTPC()},
+      {"Planes", nPlanes},
+      {"AuxDets", geom->NAuxDets()},
+      {"Channels", geom->Nchannels()},
+      {"OpChannels", geom->NOpChannels()}};
+    for (auto const& [name, count] : expectedCounts) {
+      if (report.count(name) != count) {
+        mf::LogProblem("GeometryTestAlg") << "Load report counts " << report.count(name) << " "
+                                          << name << ", " << count << " expected";
+        ++nErrors;
+      }
+    }
+    if (report.count("Wires") == 0U) {
+      mf::LogProblem("GeometryTestAlg") << "Load report counts no wire";
+      ++nErrors;
+    }
+
+    mf::LogVerbatim log("GeometryTest");
+    report.print(log, "  ");
+
+    if (nErrors > 0U) {
+      throw cet::exception("GeometryTestAlg")
+        << "testLoadReport() found " << nErrors << " errors\n";
+    }
+  } // GeometryTestAlg::testLoadReport()
+
+  void GeometryTestAlg::testChargeBinning() const
+  {
+    /*
+     * Bins deposits spread in and around each TPC, with times in and out of
+     * the ticks, and compares the result with the one of the projection of
+     * each deposit on its own; then checks that binning in parallel gives
+     * exactly the same result.
+     */
+    geo::ChannelChargeBinner::Config_t config;
+    config.nTicks = 100U;
+    config.tickPeriod = 0.5;
+    config.startTime = -10.0;
+
+    std::vector<geo::Point_t> positions;
+    std::vector<double> charges, times;
+    for (geo::TPCGeo const& tpc : geom->IterateTPCs()) {
+      geo::BoxBoundedGeo const& box = tpc.ActiveBoundingBox();
+      for (double const fx : {0.1, 0.6}) {
+        for (double const fy : {-0.05, 0.25, 0.5, 0.75, 1.05}) {
+          for (double const fz : {-0.05, 0.1, 0.3, 0.5, 0.7, 0.9, 1.05}) {
+            std::size_t const i = positions.size();
+            positions.emplace_back(box.MinX() + fx * box.SizeX(),
+                                   box.MinY() + fy * box.SizeY(),
+                                   box.MinZ() + fz * box.SizeZ());
+            charges.push_back(1.0 + (i % 7));
+            times.push_back(-12.0 + 0.37 * (i % 150)); // some out of the ticks
+          }
+        }
+      }
+    } // for TPCs
+    util::span<geo::Point_t const*> const positionSpan{positions.data(),
+                                                       positions.data() + positions.size()};
+    util::span<double const*> const chargeSpan{charges.data(), charges.data() + charges.size()};
+    util::span<double const*> const timeSpan{times.data(), times.data() + times.size()};
+
+    // reference: charge of each (channel, tick), from one deposit at a time
+    std::map<std::pair<raw::ChannelID_t, std::size_t>, double> expected;
+    std::size_t nNoTPC = 0U, nOutOfTime = 0U;
+    std::vector<geo::GeometryCore::PlaneProjection_t> projections;
+    for (std::size_t i = 0; i < positions.size(); ++i) {
+      double const tick = std::floor((times[i] - config.startTime) / config.tickPeriod);
+      if ((tick < 0.0) || (tick >= config.nTicks)) {
+        ++nOutOfTime;
+        continue;
+      }
+      if (!geom->ProjectOntoPlanes(positions[i], projections)) {
+        ++nNoTPC;
+        continue;
+      }
+      for (geo::GeometryCore::PlaneProjection_t const& proj : projections) {
+        if (proj.inPlane && raw::isValidChannelID(proj.channel))
+          expected[{proj.channel, static_cast<std::size_t>(tick)}] += charges[i];
+      }
+    } // for deposits
+
+    unsigned int nErrors = 0U;
+    geo::ChannelChargeBinner binner{*geom, config};
+    // two batches, to exercise the accumulation across calls
+    std::size_t const half = positions.size() / 2U;
+    binner.add({positionSpan.begin(), positionSpan.begin() + half},
+               {chargeSpan.begin(), chargeSpan.begin() + half},
+               {timeSpan.begin(), timeSpan.begin() + half});
+    binner.add({positionSpan.begin() + half, positionSpan.end()},
+               {chargeSpan.begin() + half, chargeSpan.end()},
+               {timeSpan.begin() + half, timeSpan.end()});
+    geo::ChannelChargeBinner::Result_t const result = binner.result();
+
+    if ((binner.nDeposits() != positions.size()) || (binner.nNoTPC() != nNoTPC) ||
+        (binner.nOutOfTime() != nOutOfTime)) {
+      mf::LogProblem("GeometryTestAlg")
+        << "ChannelChargeBinner counted " << binner.nDeposits() << " deposits, "
+        << binner.nNoTPC() << " out of TPCs and " << binner.nOutOfTime()
+        << " out of time; expected " << positions.size() << ", " << nNoTPC << " and "
+        << nOutOfTime;
+      ++nErrors;
+    }
+
+    std::size_t nFilled = 0U;
+    for (raw::ChannelID_t channel = 0; channel < geom->Nchannels(); ++channel) {
+      geo::ChannelChargeBinner::TickArray_t const& ticks = result[channel];
+      if (ticks.empty()) continue;
+      if (ticks.size() != config.nTicks) {
+        mf::LogProblem("GeometryTestAlg")
+          << "ChannelChargeBinner has " << ticks.size() << " ticks on channel " << channel;
+        ++nErrors;
+        continue;
+      }
+      for (std::size_t tick = 0; tick < ticks.size(); ++tick) {
+        if (ticks[tick] == 0.0f) continue;
+        ++nFilled;
+        auto const iExpected = expected.find({channel, tick});
+        double const expectedCharge = (iExpected == expected.end()) ? 0.0 : iExpected->second;
+        if (std::abs(ticks[tick] - expectedCharge) > 1e-4 * expectedCharge) {
+          mf::LogProblem("GeometryTestAlg")
+            << "ChannelChargeBinner has charge " << ticks[tick] << " on channel " << channel
+            << " tick " << tick << ", " << expectedCharge << " expected";
+          ++nErrors;
+        }
+      } // for ticks
+    }   // for channels
+    if (nFilled != expected.size()) {
+      mf::LogProblem("GeometryTestAlg") << "ChannelChargeBinner filled " << nFilled
+                                        << " channel ticks, " << expected.size() << " expected";
+      ++nErrors;
+    }
+
+    // the sums must not depend on the runner
+    geo::ChannelChargeBinner parallelBinner{*geom, config};
+    geo::TaskRunner_t const runner = geo::makeThreadTaskRunner(4U);
+    parallelBinner.add({positionSpan.begin(), positionSpan.begin() + half},
+                       {chargeSpan.begin(), chargeSpan.begin() + half},
+                       {timeSpan.begin(), timeSpan.begin() + half},
+                       runner);
+    parallelBinner.add({positionSpan.begin() + half, positionSpan.end()},
+                       {chargeSpan.begin() + half, chargeSpan.end()},
+                       {timeSpan.begin() + half, timeSpan.end()},
+                       runner);
+    geo::ChannelChargeBinner::Result_t const parallelResult = parallelBinner.result(runner);
+    for (raw::ChannelID_t channel = 0; channel < geom->Nchannels(); ++channel) {
+      if (parallelResult[channel] != result[channel]) {
+        mf::LogProblem("GeometryTestAlg")
+          << "ChannelChargeBinner with a runner differs on channel " << channel;
+        ++nErrors;
+      }
+    }
+
+    mf::LogVerbatim("GeometryTest")
+      << "  " << binner.nDeposits() << " deposits binned in " << binner.nEntries()
+      << " entries on " << nFilled << " channel ticks (" << binner.nNoTPC() << " out of TPCs, "
+      << binner.nOutOfTime() << " out of time, " << binner.nOffWires()
+      << " projections off the wires)";
+
+    if (nErrors > 0U) {
+      throw cet::exception("GeometryTestAlg")
+        << "testChargeBinning() found " << nErrors << " errors\n";
+    }
+  } // GeometryTestAlg::testChargeBinning()
+
+  void GeometryTestAlg::testArrayQueries() const
+  {
+    /*
+     * For points spread in and around each TPC, checks that the array queries
+     * match the single point queries, TPC by TPC and plane by plane.
+     */
+    using Index_t = geo::GeometryArrayQueries::Index_t;
+    geo::GeometryArrayQueries const queries{*geom};
+
+    std::vector<double> xyz; // (x, y, z) triplets
+    for (geo::TPCGeo const& tpc : geom->IterateTPCs()) {
+      geo::BoxBoundedGeo const& box = tpc.ActiveBoundingBox();
+      for (double const fx : {0.2, 0.8}) {
+        for (double const fy : {-0.05, 0.3, 0.7, 1.05}) {
+          for (double const fz : {-0.05, 0.2, 0.5, 0.8, 1.05}) {
+            xyz.push_back(box.MinX() + fx * box.SizeX());
+            xyz.push_back(box.MinY() + fy * box.SizeY());
+            xyz.push_back(box.MinZ() + fz * box.SizeZ());
+          }
+        }
+      }
+    } // for TPCs
+    std::size_t const n = xyz.size() / 3U;
+    auto const point = [&xyz](std::size_t i) {
+      return geo::Point_t{xyz[3U * i], xyz[3U * i + 1U], xyz[3U * i + 2U]};
+    };
+
+    unsigned int nErrors = 0U;
+    std::vector<Index_t> cryostats(n), tpcs(n);
+    queries.FindTPCsAtPositions(n, xyz.data(), cryostats.data(), tpcs.data());
+    for (std::size_t i = 0; i < n; ++i) {
+      geo::TPCID const expected = geom->FindTPCAtPosition(point(i));
+      bool const match = expected.isValid ?
+                           ((cryostats[i] == Index_t(expected.Cryostat)) &&
+                            (tpcs[i] == Index_t(expected.TPC))) :
+                           ((cryostats[i] == geo::GeometryArrayQueries::InvalidIndex) &&
+                            (tpcs[i] == geo::GeometryArrayQueries::InvalidIndex));
+      if (!match) {
+        mf::LogProblem("GeometryTestAlg")
+          << "FindTPCsAtPositions() found C:" << cryostats[i] << " T:" << tpcs[i] << " for "
+          << point(i) << ", " << expected << " expected";
+        ++nErrors;
+      }
+    } // for points
+
+    std::vector<double> coords(n);
+    std::vector<Index_t> wires(n), wireIDs(4U * n);
+    std::vector<raw::ChannelID_t> channels(n), wireChannels(n);
+    for (geo::PlaneGeo const& plane : geom->IteratePlanes()) {
+      geo::PlaneID const& planeID = plane.ID();
+      queries.WireCoordinates(
+        n, xyz.data(), planeID.Cryostat, planeID.TPC, planeID.Plane, coords.data());
+      queries.NearestWireIDs(
+        n, xyz.data(), planeID.Cryostat, planeID.TPC, planeID.Plane, wires.data());
+      queries.NearestChannels(
+        n, xyz.data(), planeID.Cryostat, planeID.TPC, planeID.Plane, channels.data());
+      for (std::size_t i = 0; i < n; ++i) {
+        wireIDs[4U * i] = planeID.Cryostat;
+        wireIDs[4U * i + 1U] = planeID.TPC;
+        wireIDs[4U * i + 2U] = planeID.Plane;
+        wireIDs[4U * i + 3U] = wires[i];
+      }
+      queries.PlaneWireToChannels(n, wireIDs.data(), wireChannels.data());
+
+      for (std::size_t i = 0; i < n; ++i) {
+        geo::Point_t const p = point(i);
+        if (coords[i] != plane.WireCoordinate(p)) {
+          mf::LogProblem("GeometryTestAlg")
+            << "WireCoordinates() on " << planeID << " gives " << coords[i] << " for " << p
+            << ", " << plane.WireCoordinate(p) << " expected";
+          ++nErrors;
+        }
+
+        Index_t expectedWire = geo::GeometryArrayQueries::InvalidIndex;
+        raw::ChannelID_t expectedChannel = raw::InvalidChannelID;
+        try {
+          geo::WireID const wireID = plane.NearestWireID(p);
+          expectedWire = wireID.Wire;
+          expectedChannel = geom->PlaneWireToChannel(wireID);
+        }
+        catch (geo::InvalidWireError const&) {
+        }
+        if ((wires[i] != expectedWire) || (channels[i] != expectedChannel) ||
+            (wireChannels[i] != expectedChannel)) {
+          mf::LogProblem("GeometryTestAlg")
+            << "Array queries on " << planeID << " give wire " << wires[i] << ", channel "
+            << channels[i] << " and " << wireChannels[i] << " for " << p << ", wire "
+            << expectedWire << " and channel " << expectedChannel << " expected";
+          ++nErrors;
+        }
+      } // for points
+    }   // for planes
+
+    if (nErrors > 0U) {
+      throw cet::exception("GeometryTestAlg")
+        << "testArrayQueries() found " << nErrors << " errors\n";
+    }
+  } // GeometryTestAlg::testArrayQueries()
+
+  void GeometryTestAlg::testAllocations() const
+  {
+    /*
+     * Checks that the queries documented as not allocating memory really
+     * don't, once warmed up: the view of the wires of each channel, the short
+     * lists of wires, TPCs and planes, and the tables of TPC sets and ROPs.
+     * The allocations are counted only if the test program replaces the
+     * allocation functions (`larcorealg/TestUtils/CountAllocations.h`).
+     */
+    if (!testing::allocationsCounted()) {
+      mf::LogVerbatim("GeometryTest") << "Allocations are not counted: test skipped.";
+      return;
+    }
+
+    // lists built before counting; iterating or filling them would allocate
+    std::vector<readout::TPCsetID> tpcsets;
+    for (readout::TPCsetID const& tpcsetid : geom->IterateTPCsetIDs())
+      tpcsets.push_back(tpcsetid);
+    std::vector<readout::ROPID> rops;
+    for (readout::ROPID const& ropid : geom->IterateROPIDs())
+      rops.push_back(ropid);
+    raw::ChannelID_t const nChannels = geom->Nchannels();
+
+    geo::GeometryCore::WireIDlist_t wires;
+    geo::GeometryCore::TPCIDlist_t tpcs;
+    geo::GeometryCore::PlaneIDlist_t planes;
+    std::size_t nItems = 0U; // keeps the results from being optimized away
+    auto runQueries = [&]() {
+      for (raw::ChannelID_t channel = 0; channel < nChannels; ++channel) {
+        nItems += geom->ChannelToWireIDs(channel).size();
+        geom->ChannelToWire(channel, wires);
+        nItems += wires.size();
+        nItems += geom->ChannelToWireGeos(channel).size();
+      }
+      for (readout::TPCsetID const& tpcsetid : tpcsets) {
+        nItems += geom->TPCsetToTPCIDs(tpcsetid).size();
+        geom->TPCsetToTPCs(tpcsetid, tpcs);
+        nItems += tpcs.size();
+      }
+      for (readout::ROPID const& ropid : rops) {
+        nItems += geom->ROPtoWirePlaneIDs(ropid).size();
+        nItems += geom->ROPtoTPCIDs(ropid).size();
+        geom->ROPtoWirePlanes(ropid, planes);
+        nItems += planes.size();
+        geom->ROPtoTPCs(ropid, tpcs);
+        nItems += tpcs.size();
+      }
+      nItems += geom->Views().size();
+    };
+
+    runQueries(); // builds the tables made on demand, and grows the lists
+    testing::AllocationScope const scope;
+    runQueries();
+    std::size_t const nAllocations = scope.count();
+
+    mf::LogVerbatim("GeometryTest")
+      << "Fast path queries on " << nChannels << " channels, " << tpcsets.size()
+      << " TPC sets and " << rops.size() << " ROPs (" << nItems << " items): " << nAllocations
+      << " allocations";
+    if (nAllocations > 0U) {
+      throw cet::exception("GeometryTestAlg")
+        << "testAllocations() found " << nAllocations << " allocations in queries which should"
+        << " not allocate memory\n";
+    }
+  } // GeometryTestAlg::testAllocations()
+
   unsigned int GeometryTestAlg::testWireIntersectionAt(const geo::TPCGeo& TPC,
                                                        TVector3 const& point) const
   {
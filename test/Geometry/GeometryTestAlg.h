@@ -76,6 +76,7 @@ namespace geo {
    *     matching the prescription
    *   + `WireCoordFromPlane`: checks `PlaneGeo::WireCoordinateFrom()`
    *   + `ChannelToWire`:
+   *   + `WireEndpointBuffer`: tests `MakeWireEndpointBuffer()`
    *   + `FindPlaneCenters`:
    *   + `Projection`:
    *   + `WirePos`: currently disabled
@@ -85,7 +86,15 @@ namespace geo {
    *     reference system of the frame of the plane
    *   + `WireCoordAngle`: tests geo::PlaneGeo::PhiZ()
    *   + `NearestWire`: tests `WireCoordinate()` and `NearestWire()`
+   *   + `ProjectOntoPlanes`: tests `ProjectOntoPlanes()`
+   *   + `WireSelection`: tests `SelectWireRanges()` and the selected `IterateWireIDs()`
    *   + `WireIntersection`: tests `WireIDsIntersect()`
+   *   + `ChannelAdjacency`: tests `ChannelNeighbors()` and `CrossingChannels()`
+   *   + `LoadReport`: tests the phases and counts of `LoadReport()`
+   *   + `ChargeBinning`: tests `geo::ChannelChargeBinner` against point by point projections
+   *   + `ArrayQueries`: tests `geo::GeometryArrayQueries` against the single queries
+   *   + `Allocations`: tests that the fast path queries (e.g. `ChannelToWireIDs()`)
+   *     allocate no memory, if the test program counts the allocations
    *   + `ThirdPlane`: tests `ThirdPlane()`
    *   + `ThirdPlaneSlope`: tests `ThirdPlaneSlope()`
    *   + `WirePitch`:
@@ -148,6 +157,7 @@ namespace geo {
     void testWireOrientations() const;
     void testChannelToROP() const;
     void testChannelToWire() const;
+    void testWireEndpointBuffer() const;
     void testFindPlaneCenters();
     void testProject();
     void testPlaneProjectionReference() const;
@@ -164,7 +174,14 @@ namespace geo {
     void testStandardWirePos();
     void testAPAWirePos();
     void testNearestWire();
+    void testProjectOntoPlanes() const;
+    void testWireSelection() const;
     void testWireIntersection() const;
+    void testChannelAdjacency() const;
+    void testLoadReport() const;
+    void testChargeBinning() const;
+    void testArrayQueries() const;
+    void testAllocations() const;
     void testThirdPlane() const;
     void testThirdPlane_dTdW() const;
     void testStepping();
@@ -0,0 +1,92 @@
+/**
+ * @file   LRUCache_test.cc
+ * @brief  Unit test for `geo::details::LRUCache`.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/details/LRUCache.h`
+ *
+ * Values are computed only when missing, the least recently used entry is
+ * dropped when the cache is full, and failed computations are not cached.
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE (LRU cache test)
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "larcorealg/Geometry/details/LRUCache.h"
+
+// C/C++ standard libraries
+#include <atomic>
+#include <stdexcept> // std::runtime_error
+#include <string>
+#include <thread>
+#include <vector>
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(EvictionTestCase)
+{
+  geo::details::LRUCache<std::string, int> cache{2U};
+  BOOST_TEST(cache.capacity() == 2U);
+
+  unsigned int nComputed = 0U;
+  auto const lengthOf = [&nComputed](std::string const& key) {
+    return [&nComputed, key]() {
+      ++nComputed;
+      return static_cast<int>(key.length());
+    };
+  };
+
+  BOOST_TEST(cache.get("a", lengthOf("a")) == 1);
+  BOOST_TEST(cache.get("bb", lengthOf("bb")) == 2);
+  BOOST_TEST(cache.get("a", lengthOf("a")) == 1); // cached, now most recent
+  BOOST_TEST(nComputed == 2U);
+  BOOST_TEST(cache.size() == 2U);
+
+  BOOST_TEST(cache.get("ccc", lengthOf("ccc")) == 3); // drops "bb"
+  BOOST_TEST(nComputed == 3U);
+  BOOST_TEST(cache.size() == 2U);
+  BOOST_TEST(cache.get("a", lengthOf("a")) == 1);
+  BOOST_TEST(nComputed == 3U);
+  BOOST_TEST(cache.get("bb", lengthOf("bb")) == 2);
+  BOOST_TEST(nComputed == 4U);
+
+  // a failed computation leaves the cache unchanged
+  BOOST_CHECK_THROW(cache.get("x", []() -> int { throw std::runtime_error("!"); }),
+                    std::runtime_error);
+  BOOST_TEST(cache.size() == 2U);
+
+  geo::details::LRUCache<std::string, int> const copy{cache};
+  BOOST_TEST(copy.size() == 2U);
+
+  cache.clear();
+  BOOST_TEST(cache.size() == 0U);
+  BOOST_TEST(copy.size() == 2U);
+
+} // BOOST_AUTO_TEST_CASE(EvictionTestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(ConcurrencyTestCase)
+{
+  geo::details::LRUCache<int, int> cache{4U};
+  std::atomic<unsigned int> nComputed{0U};
+
+  std::vector<std::thread> threads;
+  for (unsigned int iThread = 0; iThread < 8U; ++iThread) {
+    threads.emplace_back([&cache, &nComputed]() {
+      for (int i = 0; i < 1000; ++i) {
+        int const key = i % 4;
+        int const value = cache.get(key, [&nComputed, key]() {
+          ++nComputed;
+          return key * key;
+        });
+        if (value != key * key) throw std::runtime_error("wrong value");
+      }
+    });
+  }
+  for (std::thread& thread : threads)
+    thread.join();
+
+  // all the keys fit: each is computed only once
+  BOOST_TEST(nComputed.load() == 4U);
+
+} // BOOST_AUTO_TEST_CASE(ConcurrencyTestCase)
@@ -16,8 +16,11 @@
 
 // C++ standard library
 #include <cmath>       // std::sqrt()
+#include <cstddef>     // std::size_t
+#include <tuple>
 #include <type_traits> // std::is_same_v<>
 #include <utility>     // std::pair<>
+#include <vector>
 
 // =============================================================================
 void LineClosestPointSimple_test()
@@ -320,6 +323,106 @@ void LineClosestPointAndOffsetsWithUnitVectorsDocumentation_test()
 
 } // LineClosestPointAndOffsetsWithUnitVectorsDocumentation_test()
 
+// -----------------------------------------------------------------------------
+void LinesClosestApproaches_test()
+{
+
+  auto const tol = boost::test_tools::tolerance(1e-6);
+
+  // more lines than a processing block; line #7 is parallel to the reference
+  constexpr std::size_t N = 300;
+  std::vector<double> sx(N), sy(N), sz(N), dx(N), dy(N), dz(N);
+  for (std::size_t i = 0; i < N; ++i) {
+    sx[i] = 0.1 * i - 15.0;
+    sy[i] = std::sin(0.7 * i) * 20.0;
+    sz[i] = std::cos(1.3 * i) * 20.0;
+    dx[i] = std::cos(0.9 * i);
+    dy[i] = std::sin(0.9 * i);
+    dz[i] = 0.5 + 0.01 * i;
+  }
+  geo::Point_t const refStart{1.0, -2.0, 3.0};
+  geo::Vector_t const refDir{0.0, 0.6, 0.8};
+  sx[7] = 5.0;
+  sy[7] = 0.0;
+  sz[7] = 0.0;
+  dx[7] = 0.0;
+  dy[7] = 1.2;
+  dz[7] = 1.6;
+
+  geo::LineArrays const lines{N, sx.data(), sy.data(), sz.data(), dx.data(), dy.data(), dz.data()};
+  double const maxDistance = 10.0;
+
+  // distance and offsets of the closest approach of lines `i` and `j`
+  auto const distance = [&](std::size_t i, std::size_t j) -> std::tuple<double, double, double> {
+    geo::Point_t const startI{sx[i], sy[i], sz[i]}, startJ{sx[j], sy[j], sz[j]};
+    geo::Vector_t const dirI{dx[i], dy[i], dz[i]}, dirJ{dx[j], dy[j], dz[j]};
+    auto const [pI, ofsI, ofsJ] = geo::LineClosestPointAndOffsets(startI, dirI, startJ, dirJ);
+    return {(startJ + dirJ * ofsJ - pI).R(), ofsI, ofsJ};
+  };
+
+  //
+  // one reference line against the set
+  //
+  auto const approaches = geo::LinesClosestApproaches(refStart, refDir, lines, maxDistance);
+
+  std::size_t nExpected = 0;
+  auto iApproach = approaches.begin();
+  for (std::size_t i = 0; i < N; ++i) {
+    if (i == 7) continue; // parallel lines are skipped
+    geo::Vector_t const dir{dx[i], dy[i], dz[i]};
+    geo::Point_t const start{sx[i], sy[i], sz[i]};
+    auto const [p, ofsA, ofsB] = geo::LineClosestPointAndOffsets(refStart, refDir, start, dir);
+    double const d = (start + dir * ofsB - p).R();
+    if (d > maxDistance) continue;
+    ++nExpected;
+    BOOST_TEST_CONTEXT("line #" << i)
+    {
+      BOOST_TEST_REQUIRE((iApproach != approaches.end()));
+      BOOST_TEST(iApproach->line == i);
+      BOOST_TEST(iApproach->offset1 == ofsA, tol);
+      BOOST_TEST(iApproach->offset2 == ofsB, tol);
+      BOOST_TEST(iApproach->distance == d, tol);
+    }
+    ++iApproach;
+  } // for
+  BOOST_TEST(approaches.size() == nExpected);
+  BOOST_TEST(nExpected > 0U);
+  BOOST_TEST(nExpected < N - 1);
+
+  //
+  // all pairs
+  //
+  geo::LineArrays const few{20, sx.data(), sy.data(), sz.data(), dx.data(), dy.data(), dz.data()};
+  auto const pairs = geo::AllLinesClosestApproaches(few, maxDistance);
+
+  std::size_t nExpectedPairs = 0;
+  auto iPair = pairs.begin();
+  for (std::size_t i = 0; i < few.size; ++i) {
+    for (std::size_t j = i + 1; j < few.size; ++j) {
+      auto const [d, ofsI, ofsJ] = distance(i, j);
+      if (d > maxDistance) continue;
+      ++nExpectedPairs;
+      BOOST_TEST_CONTEXT("pair (" << i << ", " << j << ")")
+      {
+        BOOST_TEST_REQUIRE((iPair != pairs.end()));
+        BOOST_TEST(iPair->line1 == i);
+        BOOST_TEST(iPair->line2 == j);
+        BOOST_TEST(iPair->offset1 == ofsI, tol);
+        BOOST_TEST(iPair->offset2 == ofsJ, tol);
+        BOOST_TEST(iPair->distance == d, tol);
+      }
+      ++iPair;
+    } // for j
+  }   // for i
+  BOOST_TEST(pairs.size() == nExpectedPairs);
+  BOOST_TEST(nExpectedPairs > 0U);
+
+  // an empty set
+  BOOST_TEST(geo::LinesClosestApproaches(refStart, refDir, geo::LineArrays{}, 1.0).empty());
+  BOOST_TEST(geo::AllLinesClosestApproaches(geo::LineArrays{}, 1.0).empty());
+
+} // LinesClosestApproaches_test()
+
 // =============================================================================
 BOOST_AUTO_TEST_CASE(LineClosestPointTestCase)
 {
@@ -345,3 +448,11 @@ BOOST_AUTO_TEST_CASE(LineClosestPointWithUnitVectorsTestCase)
 } // BOOST_AUTO_TEST_CASE(LineClosestPointWithUnitVectorsTestCase)
 
 // -----------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(LinesClosestApproachesTestCase)
+{
+
+  LinesClosestApproaches_test();
+
+} // BOOST_AUTO_TEST_CASE(LinesClosestApproachesTestCase)
+
+// -----------------------------------------------------------------------------
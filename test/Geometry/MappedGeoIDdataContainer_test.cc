@@ -0,0 +1,119 @@
+/**
+ * @file   MappedGeoIDdataContainer_test.cc
+ * @brief  Unit test for `larcorealg/Geometry/MappedGeoIDdataContainer.h`.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/MappedGeoIDdataContainer.h`
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE (mapped geometry data container test)
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "larcorealg/Geometry/MappedGeoIDdataContainer.h"
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+
+// framework libraries
+#include "cetlib_except/exception.h"
+
+// C/C++ standard libraries
+#include <cstdio> // std::remove()
+#include <fstream>
+#include <stdexcept> // std::out_of_range
+#include <string>
+#include <unistd.h> // getpid()
+
+//------------------------------------------------------------------------------
+struct WireCalib {
+  float gain;
+  float pedestal;
+  int status;
+};
+
+/// Returns a name for a temporary file, unique to this process.
+std::string tempFileName(std::string const& tag)
+{
+  return "MappedGeoIDdataContainer_test_" + std::to_string(getpid()) + "_" + tag + ".dat";
+}
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(MappedPlaneDataTestCase)
+{
+
+  geo::PlaneDataContainer<WireCalib> calib(2U, 3U, 4U);
+  for (auto&& [id, value] : calib.items())
+    value = {1.0f + id.Plane, 400.0f + id.TPC, int(id.Cryostat)};
+
+  std::string const path = tempFileName("plane");
+  geo::writeMappedGeoIDdata(path, calib);
+
+  {
+    geo::MappedPlaneDataContainer<WireCalib> const mapped{path};
+    BOOST_TEST(mapped.size() == calib.size());
+    BOOST_TEST(mapped.dimSize<0U>() == 2U);
+    BOOST_TEST(mapped.dimSize<1U>() == 3U);
+    BOOST_TEST(mapped.dimSize<2U>() == 4U);
+    BOOST_TEST(mapped.hasElement(geo::PlaneID{1U, 2U, 3U}));
+    BOOST_TEST(!mapped.hasElement(geo::PlaneID{1U, 3U, 0U}));
+
+    WireCalib const& planeCalib = mapped[{1U, 2U, 3U}];
+    BOOST_TEST(planeCalib.gain == 4.0f);
+    BOOST_TEST(planeCalib.pedestal == 402.0f);
+    BOOST_TEST(planeCalib.status == 1);
+    BOOST_CHECK_THROW(mapped.at({2U, 0U, 0U}), std::out_of_range);
+
+    std::size_t n = 0U;
+    for (auto&& [id, value] : mapped.items()) {
+      BOOST_TEST(value.gain == calib[id].gain);
+      BOOST_TEST(value.pedestal == calib[id].pedestal);
+      ++n;
+    }
+    BOOST_TEST(n == calib.size());
+    BOOST_TEST(mapped.last().status == 1);
+
+    float sum = 0.0f;
+    mapped.apply([&sum](WireCalib const& c) { sum += c.gain; });
+    BOOST_TEST(sum == 6.0f * (1.0f + 2.0f + 3.0f + 4.0f));
+
+    // moving keeps the mapping alive
+    geo::MappedPlaneDataContainer<WireCalib> const moved{
+      geo::MappedPlaneDataContainer<WireCalib>{path, calib.mapper()}};
+    BOOST_TEST((moved[{0U, 1U, 2U}].gain) == 3.0f);
+
+    // dimensions not the expected ones
+    BOOST_CHECK_THROW(
+      (geo::MappedPlaneDataContainer<WireCalib>{path, geo::PlaneIDmapper<>{2U, 3U, 3U}}),
+      cet::exception);
+  }
+
+  // mismatching types
+  BOOST_CHECK_THROW(geo::MappedPlaneDataContainer<double>{path}, cet::exception);
+  BOOST_CHECK_THROW(geo::MappedTPCDataContainer<WireCalib>{path}, cet::exception);
+
+  std::remove(path.c_str());
+
+} // MappedPlaneDataTestCase
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(MappedFileErrorsTestCase)
+{
+
+  BOOST_CHECK_THROW(geo::MappedTPCDataContainer<int>{tempFileName("missing")}, cet::exception);
+
+  std::string const path = tempFileName("bad");
+  {
+    std::ofstream out{path};
+    out << "this is not a data file, even if it is long enough to contain a header";
+  }
+  BOOST_CHECK_THROW(geo::MappedTPCDataContainer<int>{path}, cet::exception);
+
+  // truncated data
+  geo::TPCDataContainer<int> data(2U, 5U, 7);
+  geo::writeMappedGeoIDdata(path, data);
+  BOOST_TEST((geo::MappedTPCDataContainer<int>{path}[{1U, 4U}]) == 7);
+  BOOST_TEST(truncate(path.c_str(), 64 + 9 * sizeof(int)) == 0);
+  BOOST_CHECK_THROW(geo::MappedTPCDataContainer<int>{path}, cet::exception);
+
+  std::remove(path.c_str());
+
+} // MappedFileErrorsTestCase
@@ -0,0 +1,105 @@
+/**
+ * @file   NodeNameIndex_test.cc
+ * @brief  Unit test for `geo::details::NodeNameIndex`.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/details/NodeNameIndex.h`
+ *
+ * The nodes and paths found in the index are compared with a walk through a
+ * small tree in the order of `geo::ROOTGeoNodeForwardIterator`.
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE (node name index test)
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "larcorealg/Geometry/details/NodeNameIndex.h"
+
+// C/C++ standard libraries
+#include <deque>
+#include <set>
+#include <string>
+#include <vector>
+
+//------------------------------------------------------------------------------
+/// Minimal stand-in for `TGeoNode` and `TGeoVolume`.
+struct MockNode {
+  std::string name;
+  std::vector<MockNode const*> daughters;
+
+  MockNode const* GetVolume() const { return this; }
+  char const* GetName() const { return name.c_str(); }
+  int GetNdaughters() const { return static_cast<int>(daughters.size()); }
+  MockNode const* GetDaughter(int i) const { return daughters[i]; }
+};
+
+using Index_t = geo::details::NodeNameIndex<MockNode>;
+
+/// Records the paths of the nodes under `path.back()` in forward iteration order.
+void walk(Index_t::Path_t& path,
+          std::set<std::string> const& names,
+          std::vector<Index_t::Path_t>& found)
+{
+  MockNode const* node = path.back();
+  for (MockNode const* daughter : node->daughters) {
+    path.push_back(daughter);
+    walk(path, names, found);
+    path.pop_back();
+  }
+  if (names.count(node->name)) found.push_back(path);
+} // walk()
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(NodeNameIndexTestCase)
+{
+  // world -> 2 cryostats -> 3 TPCs each -> 2 planes each, plus a lonely plane
+  std::deque<MockNode> nodes;
+  auto const make = [&nodes](std::string name) -> MockNode& {
+    return nodes.emplace_back(MockNode{std::move(name), {}});
+  };
+  MockNode& world = make("volWorld");
+  for (int c = 0; c < 2; ++c) {
+    MockNode& cryo = make("volCryostat");
+    world.daughters.push_back(&cryo);
+    for (int t = 0; t < 3; ++t) {
+      MockNode& tpc = make("volTPC");
+      cryo.daughters.push_back(&tpc);
+      tpc.daughters.push_back(&make("volTPCPlaneU"));
+      tpc.daughters.push_back(&make("volTPCPlaneV"));
+    }
+  }
+  world.daughters.push_back(&make("volTPCPlaneU"));
+
+  Index_t index;
+  BOOST_TEST(index.size() == 0U);
+  BOOST_TEST(index.nodes(std::set<std::string>{"volWorld"}).empty());
+
+  index.build(&world);
+  BOOST_TEST(index.size() == nodes.size());
+  BOOST_TEST(index.nNames() == 5U);
+  BOOST_TEST(index.heapMemory() > 0U);
+
+  for (std::set<std::string> const& names : {std::set<std::string>{"volTPC"},
+                                            std::set<std::string>{"volTPCPlaneU", "volCryostat"},
+                                            std::set<std::string>{"volWorld", "volTPCPlaneV"},
+                                            std::set<std::string>{"volNone"},
+                                            std::set<std::string>{}}) {
+    std::vector<Index_t::Path_t> expected;
+    Index_t::Path_t path{&world};
+    walk(path, names, expected);
+
+    std::vector<Index_t::Path_t> const paths = index.paths(names);
+    BOOST_TEST_REQUIRE(paths.size() == expected.size());
+    std::vector<MockNode const*> const found = index.nodes(names);
+    BOOST_TEST_REQUIRE(found.size() == expected.size());
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+      BOOST_TEST((paths[i] == expected[i]));
+      BOOST_TEST(found[i] == expected[i].back());
+    }
+  } // for names
+
+  index.clear();
+  BOOST_TEST(index.size() == 0U);
+  BOOST_TEST(index.nNames() == 0U);
+
+} // BOOST_AUTO_TEST_CASE(NodeNameIndexTestCase)
@@ -0,0 +1,105 @@
+/**
+ * @file   OpDetArrays_test.cc
+ * @brief  Unit test for `geo::details::OpDetArrays`.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/details/OpDetArrays.h`
+ *
+ * The batch distances and angles, both over the detectors and over the
+ * points, are compared with the ones computed one pair at a time.
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE (optical detector arrays test)
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "larcorealg/Geometry/details/OpDetArrays.h"
+
+// C/C++ standard libraries
+#include <cmath>
+#include <random>
+#include <vector>
+
+//------------------------------------------------------------------------------
+struct TestVector {
+  double x, y, z;
+
+  double X() const { return x; }
+  double Y() const { return y; }
+  double Z() const { return z; }
+};
+
+/// Returns the distance and the cosine from the normal of `p`, one at a time.
+std::pair<double, double> reference(TestVector const& p, TestVector const& c, TestVector const& n)
+{
+  double const dx = p.x - c.x, dy = p.y - c.y, dz = p.z - c.z;
+  double const d = std::sqrt(dx * dx + dy * dy + dz * dz);
+  return {d, (dx * n.x + dy * n.y + dz * n.z) / d};
+}
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(OpDetArraysTestCase)
+{
+  // three walls of detectors, facing +x, -x and +z
+  std::vector<TestVector> centers, normals;
+  for (unsigned int i = 0; i < 10U; ++i) {
+    centers.push_back({-200.0, 10.0 * i, 50.0});
+    normals.push_back({1.0, 0.0, 0.0});
+    centers.push_back({200.0, 10.0 * i, 50.0});
+    normals.push_back({-1.0, 0.0, 0.0});
+    centers.push_back({0.0, 10.0 * i, -100.0});
+    normals.push_back({0.0, 0.0, 1.0});
+  }
+
+  geo::details::OpDetArrays opDets;
+  BOOST_TEST(opDets.empty());
+  opDets.reserve(centers.size());
+  for (std::size_t i = 0; i < centers.size(); ++i)
+    opDets.push_back(centers[i], normals[i], {1.0, 2.0, 3.0, 0.0});
+  BOOST_TEST(opDets.size() == centers.size());
+  BOOST_TEST(opDets.halfHeight()[5] == 2.0);
+  BOOST_TEST(opDets.normalZ()[2] == 1.0);
+
+  std::mt19937 engine{2468U};
+  std::uniform_real_distribution<double> flat{-150.0, 150.0};
+  std::size_t const nPoints = 100U;
+  std::vector<double> xs(nPoints), ys(nPoints), zs(nPoints);
+  for (std::size_t k = 0; k < nPoints; ++k) {
+    xs[k] = flat(engine);
+    ys[k] = flat(engine);
+    zs[k] = flat(engine);
+  }
+
+  // all the detectors for one point
+  std::vector<double> d(opDets.size()), cosTheta(opDets.size());
+  for (std::size_t k = 0; k < nPoints; ++k) {
+    opDets.distancesToPoint(xs[k], ys[k], zs[k], d.data());
+    opDets.cosThetaFromNormal(xs[k], ys[k], zs[k], cosTheta.data());
+    for (std::size_t i = 0; i < opDets.size(); ++i) {
+      auto const [expD, expCos] = reference({xs[k], ys[k], zs[k]}, centers[i], normals[i]);
+      BOOST_TEST(d[i] == expD, boost::test_tools::tolerance(1e-12));
+      BOOST_TEST(cosTheta[i] == expCos, boost::test_tools::tolerance(1e-12));
+    }
+  }
+
+  // all the points for one detector
+  std::vector<double> dp(nPoints), cosThetaP(nPoints);
+  for (std::size_t i = 0; i < opDets.size(); ++i) {
+    opDets.distancesToPoints(i, nPoints, xs.data(), ys.data(), zs.data(), dp.data());
+    opDets.cosThetaFromNormal(i, nPoints, xs.data(), ys.data(), zs.data(), cosThetaP.data());
+    for (std::size_t k = 0; k < nPoints; ++k) {
+      auto const [expD, expCos] = reference({xs[k], ys[k], zs[k]}, centers[i], normals[i]);
+      BOOST_TEST(dp[k] == expD, boost::test_tools::tolerance(1e-12));
+      BOOST_TEST(cosThetaP[k] == expCos, boost::test_tools::tolerance(1e-12));
+    }
+  }
+
+  // a point in front of the first two detectors
+  opDets.cosThetaFromNormal(-100.0, 0.0, 50.0, cosTheta.data());
+  BOOST_TEST(cosTheta[0] == 1.0, boost::test_tools::tolerance(1e-12));
+  BOOST_TEST(cosTheta[1] == 1.0, boost::test_tools::tolerance(1e-12)); // facing -x
+
+  BOOST_TEST(opDets.heapMemory() >= 10U * centers.size() * sizeof(double));
+  opDets.clear();
+  BOOST_TEST(opDets.empty());
+} // BOOST_AUTO_TEST_CASE(OpDetArraysTestCase)
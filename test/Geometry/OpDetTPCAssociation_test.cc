@@ -0,0 +1,92 @@
+/**
+ * @file   OpDetTPCAssociation_test.cc
+ * @brief  Unit test for `geo::OpDetTPCAssociation`.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/OpDetTPCAssociation.h`
+ *
+ * The layout is a cryostat with two pairs of TPCs sharing a cathode, with
+ * light detectors behind the three anode planes and on the cathode, and a
+ * second cryostat with a single TPC.
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE (optical detector and TPC association test)
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "larcorealg/Geometry/OpDetTPCAssociation.h"
+
+// C/C++ standard libraries
+#include <vector>
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(EmptyAssociationTestCase)
+{
+  geo::OpDetTPCAssociation const assns;
+  BOOST_TEST(assns.empty());
+  BOOST_TEST(assns.nOpDets() == 0U);
+  BOOST_TEST(assns.opDets(geo::TPCID{0, 0}).empty());
+  BOOST_TEST(assns.TPCs(0U).empty());
+} // BOOST_AUTO_TEST_CASE(EmptyAssociationTestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(AnodeLayoutTestCase)
+{
+  using TPCInfo_t = geo::OpDetTPCAssociation::TPCInfo_t;
+  using OpDetInfo_t = geo::OpDetTPCAssociation::OpDetInfo_t;
+
+  // cryostat 0: anode at x = -200, cathode at -100, anode at 0, cathode at
+  // 100 and anode at 200; TPCs are 5 cm short of the anodes
+  std::vector<TPCInfo_t> const TPCs{
+    {geo::TPCID{0, 0}, {-195.0, -50.0, 0.0}, {-100.0, 50.0, 300.0}, {-1.0, 0.0, 0.0}},
+    {geo::TPCID{0, 1}, {-100.0, -50.0, 0.0}, {-5.0, 50.0, 300.0}, {1.0, 0.0, 0.0}},
+    {geo::TPCID{0, 2}, {5.0, -50.0, 0.0}, {100.0, 50.0, 300.0}, {-1.0, 0.0, 0.0}},
+    {geo::TPCID{0, 3}, {100.0, -50.0, 0.0}, {195.0, 50.0, 300.0}, {1.0, 0.0, 0.0}},
+    {geo::TPCID{1, 0}, {-100.0, -50.0, 0.0}, {-5.0, 50.0, 300.0}, {1.0, 0.0, 0.0}},
+  };
+  std::vector<OpDetInfo_t> const opDets{
+    {0U, {-200.0, 0.0, 50.0}}, // 0: behind the anode of TPC 0
+    {0U, {0.0, 0.0, 50.0}},    // 1: between TPC 1 and TPC 2
+    {0U, {0.0, 0.0, 250.0}},   // 2: between TPC 1 and TPC 2
+    {0U, {200.0, 0.0, 50.0}},  // 3: behind the anode of TPC 3
+    {0U, {200.0, 80.0, 50.0}}, // 4: above the TPCs
+    {0U, {-100.0, 0.0, 150.0}}, // 5: on the cathode of TPC 0 and 1
+    {1U, {0.0, 0.0, 50.0}},    // 6: behind the only TPC of cryostat 1
+  };
+
+  geo::OpDetTPCAssociation const assns{TPCs, opDets};
+  BOOST_TEST(!assns.empty());
+  BOOST_TEST(assns.nOpDets() == opDets.size());
+  BOOST_TEST(assns.maxDistance() == 0.0);
+
+  std::vector<unsigned int> const expTPCOpDets[] = {{0, 5}, {1, 2, 5}, {1, 2}, {3}};
+  for (unsigned int t = 0; t < 4; ++t) {
+    auto const opDetsInTPC = assns.opDets(geo::TPCID{0, t});
+    std::vector<unsigned int> const found(opDetsInTPC.begin(), opDetsInTPC.end());
+    BOOST_TEST(found == expTPCOpDets[t], boost::test_tools::per_element());
+  }
+  auto const opDetsInC1 = assns.opDets(geo::TPCID{1, 0});
+  BOOST_TEST_REQUIRE(opDetsInC1.size() == 1U);
+  BOOST_TEST(*opDetsInC1.begin() == 6U);
+  BOOST_TEST(assns.opDets(geo::TPCID{1, 1}).empty());
+  BOOST_TEST(assns.opDets(geo::TPCID{5, 0}).empty());
+
+  // detector 3 does not see TPC 0, hidden behind three TPCs
+  auto const TPCsOf3 = assns.TPCs(3U);
+  BOOST_TEST_REQUIRE(TPCsOf3.size() == 1U);
+  BOOST_TEST(*TPCsOf3.begin() == (geo::TPCID{0, 3}));
+  auto const TPCsOf1 = assns.TPCs(1U);
+  BOOST_TEST_REQUIRE(TPCsOf1.size() == 2U);
+  BOOST_TEST(TPCsOf1.begin()[0] == (geo::TPCID{0, 1}));
+  BOOST_TEST(TPCsOf1.begin()[1] == (geo::TPCID{0, 2}));
+  BOOST_TEST(assns.TPCs(4U).empty());
+  BOOST_TEST(assns.TPCs(opDets.size()).empty());
+
+  // with a larger distance, the detector above the TPCs is included
+  geo::OpDetTPCAssociation const wideAssns{TPCs, opDets, 40.0};
+  auto const TPCsOf4 = wideAssns.TPCs(4U);
+  BOOST_TEST_REQUIRE(TPCsOf4.size() == 1U);
+  BOOST_TEST(*TPCsOf4.begin() == (geo::TPCID{0, 3}));
+  BOOST_TEST(wideAssns.nAssociations() > assns.nAssociations());
+  BOOST_TEST(wideAssns.heapMemory() > 0U);
+} // BOOST_AUTO_TEST_CASE(AnodeLayoutTestCase)
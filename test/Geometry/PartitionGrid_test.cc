@@ -0,0 +1,144 @@
+/**
+ * @file   PartitionGrid_test.cc
+ * @brief  Unit test for `geo::part::PartitionGrid`.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/PartitionGrid.h`
+ *
+ * The grid is checked against the partition it is built from, on a regular
+ * grid of areas and on a nested, irregular partition with an uncovered hole.
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE (partition grid test)
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "larcorealg/Geometry/Partitions.h"
+#include "larcorealg/Geometry/PartitionGrid.h"
+
+// C/C++ standard libraries
+#include <memory>
+#include <random>
+#include <vector>
+
+//------------------------------------------------------------------------------
+using Data_t = int const;
+using Partition_t = geo::part::Partition<Data_t>;
+using Area_t = Partition_t::Area_t;
+using Element_t = geo::part::PartitionElement<Data_t>;
+
+int const Data[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+/// Checks that `grid` and `partition` agree on a fine mesh of points.
+void checkGridPoints(geo::part::PartitionGrid<Data_t> const& grid, Partition_t const& partition)
+{
+  auto const& area = partition.area();
+  for (double w = area.width.lower - 1.0; w <= area.width.upper + 1.0; w += 0.25) {
+    for (double d = area.depth.lower - 1.0; d <= area.depth.upper + 1.0; d += 0.25)
+      BOOST_TEST(grid.atPoint(w, d) == partition.atPoint(w, d), "(" << w << ", " << d << ")");
+  }
+} // checkGridPoints()
+
+/// Checks the grid on random points, on the borders and out of the area.
+void checkGrid(Partition_t const& partition,
+               std::vector<double> const& wBorders,
+               std::vector<double> const& dBorders)
+{
+  geo::part::PartitionGrid<Data_t> const grid{partition};
+  BOOST_TEST(!grid.empty());
+  BOOST_TEST(grid.partition() == &partition);
+
+  auto const& area = partition.area();
+  std::mt19937 engine{12345};
+  std::uniform_real_distribution<double> wDist{area.width.lower - 5.0, area.width.upper + 5.0};
+  std::uniform_real_distribution<double> dDist{area.depth.lower - 5.0, area.depth.upper + 5.0};
+  unsigned int nInside = 0U, nBoundary = 0U;
+  for (unsigned int i = 0; i < 10000U; ++i) {
+    double const w = wDist(engine), d = dDist(engine);
+    BOOST_TEST(grid.atPoint(w, d) == partition.atPoint(w, d));
+    if (!area.contains(w, d)) continue;
+    ++nInside;
+    if (grid.onBoundary(w, d)) ++nBoundary;
+  } // for
+  BOOST_TEST(nBoundary < nInside / 2); // most points do not need the fallback
+
+  for (double const w : wBorders) {
+    for (double const d : dBorders) {
+      BOOST_TEST(grid.atPoint(w, d) == partition.atPoint(w, d));
+      BOOST_TEST(grid.onBoundary(w, d));
+    }
+  } // for
+} // checkGrid()
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(RegularGrid_test)
+{
+  // 3 x 3 areas of 10 x 10, covering [0, 30] x [0, 30]
+  Partition_t::Subpartitions_t parts;
+  for (int iD = 0; iD < 3; ++iD) {
+    for (int iW = 0; iW < 3; ++iW) {
+      Area_t const area{{10.0 * iW, 10.0 * (iW + 1)}, {10.0 * iD, 10.0 * (iD + 1)}};
+      parts.push_back(std::make_unique<Element_t>(area, &Data[3 * iD + iW]));
+    }
+  } // for
+  geo::part::GridPartition<Data_t> const partition{
+    Area_t{{0.0, 30.0}, {0.0, 30.0}}, std::move(parts), 3U};
+
+  checkGrid(partition, {0.0, 10.0, 20.0, 30.0}, {0.0, 10.0, 20.0, 30.0});
+
+  geo::part::PartitionGrid<Data_t> const grid{partition, 4U};
+  BOOST_TEST(grid.nWidthCells() == 12U);
+  BOOST_TEST(grid.nDepthCells() == 12U);
+  BOOST_TEST(grid.atPoint(15.0, 25.0) == &Data[7]);
+  BOOST_TEST(!grid.onBoundary(15.0, 25.0));
+  BOOST_TEST(grid.atPoint(-1.0, 5.0) == nullptr);
+} // BOOST_AUTO_TEST_CASE(RegularGrid_test)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(NestedPartition_test)
+{
+  // two columns, the first split in depth with a hole in [12, 17]
+  Partition_t::Subpartitions_t left;
+  left.push_back(std::make_unique<Element_t>(Area_t{{0.0, 7.5}, {0.0, 12.0}}, &Data[1]));
+  left.push_back(std::make_unique<Element_t>(Area_t{{0.0, 7.5}, {17.0, 40.0}}, &Data[2]));
+  Partition_t::Subpartitions_t columns;
+  columns.push_back(std::make_unique<geo::part::DepthPartition<Data_t>>(
+    Area_t{{0.0, 7.5}, {0.0, 40.0}}, std::move(left)));
+  columns.push_back(std::make_unique<Element_t>(Area_t{{7.5, 31.0}, {0.0, 40.0}}, &Data[3]));
+  geo::part::WidthPartition<Data_t> const partition{
+    Area_t{{0.0, 31.0}, {0.0, 40.0}}, std::move(columns)};
+
+  checkGrid(partition, {0.0, 7.5, 31.0}, {0.0, 12.0, 17.0, 40.0});
+
+  geo::part::PartitionGrid<Data_t> const grid{partition};
+  BOOST_TEST(grid.atPoint(3.0, 14.5) == nullptr); // the hole
+  BOOST_TEST(grid.atPoint(31.0, 14.5) == &Data[3]);
+  BOOST_TEST(grid.atPoint(32.0, 14.5) == nullptr);
+  BOOST_TEST(grid.atPoint(3.0, 20.0) == &Data[2]);
+  BOOST_TEST(grid.atPoint(20.0, 14.5) == &Data[3]);
+
+  // the borders of the hole do not extend to the second column
+  BOOST_TEST(grid.onBoundary(3.0, 12.0));
+  BOOST_TEST(!grid.onBoundary(20.0, 12.0));
+  BOOST_TEST(!grid.onBoundary(20.0, 17.0));
+  BOOST_TEST(grid.nBoundaryCells() < grid.nWidthCells() * grid.nDepthCells() / 4U);
+
+  // explicit resolution
+  geo::part::PartitionGrid<Data_t> const coarse{partition, {10U, 5U}};
+  BOOST_TEST(coarse.nWidthCells() == 10U);
+  BOOST_TEST(coarse.nDepthCells() == 5U);
+  checkGridPoints(coarse, partition);
+
+  // no cell on one direction: everything falls back
+  geo::part::PartitionGrid<Data_t> const flat{partition, {0U, 5U}};
+  BOOST_TEST(flat.onBoundary(20.0, 20.0));
+  BOOST_TEST(flat.atPoint(20.0, 20.0) == &Data[3]);
+} // BOOST_AUTO_TEST_CASE(NestedPartition_test)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(EmptyGrid_test)
+{
+  geo::part::PartitionGrid<Data_t> const grid;
+  BOOST_TEST(grid.empty());
+  BOOST_TEST(grid.atPoint(0.0, 0.0) == nullptr);
+} // BOOST_AUTO_TEST_CASE(EmptyGrid_test)
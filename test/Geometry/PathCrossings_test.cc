@@ -0,0 +1,117 @@
+/**
+ * @file   PathCrossings_test.cc
+ * @brief  Unit test for `geo::details::findPathCrossings()`.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/details/PathCrossings.h`
+ *
+ * Trajectories cross two adjacent boxes (like two TPCs sharing a cathode)
+ * and a third one apart.
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE (path crossings test)
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "larcorealg/Geometry/details/PathCrossings.h"
+
+// C/C++ standard libraries
+#include <cmath>
+#include <vector>
+
+using geo::details::BoxBVH;
+using geo::details::PathCrossing_t;
+
+//------------------------------------------------------------------------------
+struct TestPoint {
+  double x, y, z;
+
+  double X() const { return x; }
+  double Y() const { return y; }
+  double Z() const { return z; }
+};
+
+/// Returns the boxes used in the tests.
+BoxBVH makeBoxes()
+{
+  BoxBVH tree;
+  tree.build({
+    {{0.0, 0.0, 0.0}, {100.0, 100.0, 100.0}},
+    {{100.0, 0.0, 0.0}, {200.0, 100.0, 100.0}},
+    {{300.0, 0.0, 0.0}, {400.0, 100.0, 100.0}},
+  });
+  return tree;
+}
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(StraightTrackTestCase)
+{
+  BoxBVH const tree = makeBoxes();
+
+  // a straight track from outside, through all the boxes, ending in the last
+  std::vector<TestPoint> track;
+  for (int i = 0; i <= 35; ++i)
+    track.push_back({-25.0 + 10.0 * i, 50.0, 50.0});
+
+  std::vector<PathCrossing_t> crossings;
+  geo::details::findPathCrossings(tree, track.begin(), track.end(), crossings);
+  BOOST_TEST_REQUIRE(crossings.size() == 3U);
+
+  double const expEntry[] = {0.0, 100.0, 300.0};
+  double const expExit[] = {100.0, 200.0, 325.0};
+  for (std::size_t i = 0; i < 3U; ++i) {
+    BOOST_TEST_CONTEXT("crossing #" << i)
+    {
+      BOOST_TEST(crossings[i].box == i);
+      BOOST_TEST(crossings[i].entry[0] == expEntry[i], boost::test_tools::tolerance(1e-9));
+      BOOST_TEST(crossings[i].exit[0] == expExit[i], boost::test_tools::tolerance(1e-9));
+      BOOST_TEST(crossings[i].entry[1] == 50.0);
+      BOOST_TEST(crossings[i].length == expExit[i] - expEntry[i],
+                 boost::test_tools::tolerance(1e-9));
+    }
+  }
+  BOOST_TEST(crossings[0].entryStep == 2U);
+  BOOST_TEST(crossings[2].exitStep == 34U);
+
+  // a single point is not a trajectory
+  geo::details::findPathCrossings(tree, track.begin(), track.begin() + 1, crossings);
+  BOOST_TEST(crossings.empty());
+} // BOOST_AUTO_TEST_CASE(StraightTrackTestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(ZigZagTrackTestCase)
+{
+  BoxBVH const tree = makeBoxes();
+
+  // starts in the first box, leaves it from the top, comes back in, then
+  // moves to the second; a repeated point in between
+  std::vector<TestPoint> const track{
+    {50.0, 50.0, 50.0},
+    {50.0, 150.0, 50.0},
+    {50.0, 150.0, 50.0},
+    {70.0, 50.0, 50.0},
+    {150.0, 50.0, 50.0},
+  };
+
+  std::vector<PathCrossing_t> crossings;
+  geo::details::findPathCrossings(tree, track.begin(), track.end(), crossings);
+  BOOST_TEST_REQUIRE(crossings.size() == 3U);
+
+  BOOST_TEST(crossings[0].box == 0U);
+  BOOST_TEST(crossings[0].entry[1] == 50.0);
+  BOOST_TEST(crossings[0].exit[1] == 100.0);
+  BOOST_TEST(crossings[0].length == 50.0, boost::test_tools::tolerance(1e-9));
+
+  // back in the first box at (60, 100, 50)
+  double const diagonal = std::sqrt(10.0 * 10.0 + 50.0 * 50.0);
+  BOOST_TEST(crossings[1].box == 0U);
+  BOOST_TEST(crossings[1].entry[0] == 60.0, boost::test_tools::tolerance(1e-9));
+  BOOST_TEST(crossings[1].exit[0] == 100.0, boost::test_tools::tolerance(1e-9));
+  BOOST_TEST(crossings[1].length == diagonal + 30.0, boost::test_tools::tolerance(1e-9));
+  BOOST_TEST(crossings[1].entryStep == 2U);
+  BOOST_TEST(crossings[1].exitStep == 3U);
+
+  BOOST_TEST(crossings[2].box == 1U);
+  BOOST_TEST(crossings[2].exit[0] == 150.0, boost::test_tools::tolerance(1e-9));
+  BOOST_TEST(crossings[2].length == 50.0, boost::test_tools::tolerance(1e-9));
+} // BOOST_AUTO_TEST_CASE(ZigZagTrackTestCase)
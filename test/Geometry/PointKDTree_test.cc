@@ -0,0 +1,135 @@
+/**
+ * @file   PointKDTree_test.cc
+ * @brief  Unit test for `geo::details::PointKDTree`.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/details/PointKDTree.h`
+ *
+ * The tree is checked against a linear search on a regular array of points
+ * (like the photodetectors on a cryostat wall), which has many ties, and on a
+ * random set of points.
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE (point k-d tree test)
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "larcorealg/Geometry/details/PointKDTree.h"
+
+// C/C++ standard libraries
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <utility>
+#include <vector>
+
+//------------------------------------------------------------------------------
+struct TestPoint {
+  double x, y, z;
+
+  double X() const { return x; }
+  double Y() const { return y; }
+  double Z() const { return z; }
+};
+
+/// Distance computed the same way as `(p - q).R()` on `geo::Point_t`.
+double distance(TestPoint const& p, TestPoint const& q)
+{
+  double const dx = p.x - q.x, dy = p.y - q.y, dz = p.z - q.z;
+  return std::sqrt(dx * dx + dy * dy + dz * dz);
+}
+
+/// Returns the indices of all the points, sorted by distance and then index.
+std::vector<unsigned int> linearSort(std::vector<TestPoint> const& points, TestPoint const& query)
+{
+  std::vector<std::pair<double, unsigned int>> matches;
+  for (unsigned int i = 0; i < points.size(); ++i)
+    matches.emplace_back(distance(query, points[i]), i);
+  std::sort(matches.begin(), matches.end());
+  std::vector<unsigned int> indices;
+  for (auto const& match : matches)
+    indices.push_back(match.second);
+  return indices;
+}
+
+//------------------------------------------------------------------------------
+void checkAgainstLinearSearch(std::vector<TestPoint> const& points,
+                              std::vector<TestPoint> const& queries)
+{
+  geo::details::PointKDTree tree;
+  tree.build(points);
+  BOOST_TEST(tree.size() == points.size());
+
+  for (TestPoint const& query : queries) {
+    std::vector<unsigned int> const expected = linearSort(points, query);
+    BOOST_TEST(tree.nearest(query) == expected.front());
+    for (std::size_t const k : {1U, 2U, 5U, 17U}) {
+      std::vector<unsigned int> const found = tree.kNearest(query, k);
+      BOOST_TEST_REQUIRE(found.size() == std::min(k, points.size()));
+      for (std::size_t i = 0; i < found.size(); ++i)
+        BOOST_TEST(found[i] == expected[i]);
+    } // for k
+  }   // for queries
+
+} // checkAgainstLinearSearch()
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(EmptyTreeTestCase)
+{
+  geo::details::PointKDTree tree;
+  BOOST_TEST(tree.empty());
+  BOOST_TEST(tree.nearest(0.0, 0.0, 0.0) == geo::details::PointKDTree::NoIndex);
+  BOOST_TEST(tree.kNearest(0.0, 0.0, 0.0, 3U).empty());
+
+  tree.build(std::vector<TestPoint>{{1.0, 2.0, 3.0}});
+  BOOST_TEST(!tree.empty());
+  BOOST_TEST(tree.nearest(0.0, 0.0, 0.0) == 0U);
+  BOOST_TEST(tree.kNearest(0.0, 0.0, 0.0, 3U).size() == 1U);
+  BOOST_TEST(tree.kNearest(0.0, 0.0, 0.0, 0U).empty());
+  double const nan = std::numeric_limits<double>::quiet_NaN();
+  BOOST_TEST(tree.nearest(nan, 0.0, 0.0) == geo::details::PointKDTree::NoIndex);
+  BOOST_TEST(tree.kNearest(nan, 0.0, 0.0, 3U).empty());
+
+  tree.clear();
+  BOOST_TEST(tree.empty());
+  BOOST_TEST(tree.nearest(0.0, 0.0, 0.0) == geo::details::PointKDTree::NoIndex);
+}
+
+BOOST_AUTO_TEST_CASE(RegularLayoutTestCase)
+{
+  // 10 x 30 photodetectors on each of the two walls at x = +/- 200;
+  // the grid queries include many points equidistant from several detectors
+  std::vector<TestPoint> points;
+  for (double const x : {-200.0, 200.0}) {
+    for (int iy = 0; iy < 10; ++iy) {
+      for (int iz = 0; iz < 30; ++iz)
+        points.push_back({x, -450.0 + 100.0 * iy, 50.0 + 100.0 * iz});
+    }
+  }
+  std::vector<TestPoint> queries;
+  for (int ix = -5; ix <= 5; ++ix) {
+    for (int iy = -11; iy <= 11; ++iy) {
+      for (int iz = -1; iz <= 61; iz += 3)
+        queries.push_back({50.0 * ix, 50.0 * iy, 50.0 * iz});
+    }
+  }
+  checkAgainstLinearSearch(points, queries);
+}
+
+BOOST_AUTO_TEST_CASE(RandomLayoutTestCase)
+{
+  std::mt19937 engine{24680};
+  std::uniform_real_distribution<double> coord{-500.0, 500.0};
+  std::vector<TestPoint> points;
+  for (int i = 0; i < 1000; ++i)
+    points.push_back({coord(engine), coord(engine), coord(engine)});
+  points.push_back(points[10]); // a duplicate
+  std::vector<TestPoint> queries{points[10]};
+  std::uniform_real_distribution<double> wideCoord{-800.0, 800.0};
+  for (int i = 0; i < 2000; ++i)
+    queries.push_back({wideCoord(engine), wideCoord(engine), wideCoord(engine)});
+  checkAgainstLinearSearch(points, queries);
+}
+
+//------------------------------------------------------------------------------
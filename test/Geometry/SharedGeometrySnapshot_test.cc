@@ -0,0 +1,184 @@
+/**
+ * @file   SharedGeometrySnapshot_test.cc
+ * @brief  Unit test for `geo::SharedGeometrySnapshot`.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/SharedGeometrySnapshot.h`
+ *
+ * A small snapshot is published in a shared memory segment and attached to,
+ * both from this process and from a child process.
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE (shared geometry snapshot test)
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "larcorealg/Geometry/SharedGeometrySnapshot.h"
+
+// framework libraries
+#include "cetlib_except/exception.h"
+
+// POSIX
+#include <sys/wait.h> // waitpid()
+#include <unistd.h>   // fork(), getpid(), _exit()
+
+// C/C++ standard libraries
+#include <chrono>
+#include <cstdint>
+#include <stdexcept> // std::runtime_error
+#include <string>
+
+//------------------------------------------------------------------------------
+/// One cryostat and TPC with one plane of four wires.
+geo::SharedGeometryContent makeContent()
+{
+  geo::SharedGeometryContent content;
+  geo::GeometrySnapshot& snapshot = content.snapshot;
+  snapshot.detectorName = "shareddet";
+  snapshot.cryostats.push_back({{{-10.0, -5.0, 0.0}, {10.0, 5.0, 30.0}}, 0U, 1U, 0U, 0U});
+  snapshot.TPCs.push_back({{{-10.0, -5.0, 0.0}, {10.0, 5.0, 30.0}},
+                           {{-9.0, -4.0, 1.0}, {9.0, 4.0, 29.0}},
+                           {-1.0, 0.0, 0.0},
+                           0U,
+                           1U,
+                           2,
+                           0U});
+  snapshot.planes.push_back({{-10.0, 0.0, 15.0},
+                             {1.0, 0.0, 0.0},
+                             {0.0, 1.0, 0.0},
+                             {0.0, 0.0, 1.0},
+                             10.0,
+                             30.0,
+                             0.3,
+                             0.0,
+                             0U,
+                             4U,
+                             2,
+                             1});
+  for (unsigned int w = 0; w < 4U; ++w) {
+    snapshot.wires.push_back({{-10.0, 0.0, 0.3 * w}, {0.0, 1.0, 0.0}, 5.0, 1.5});
+    content.wireChannels.push_back(100U + w);
+  }
+  content.fingerprint = 0x0123456789abcdefULL;
+  return content;
+} // makeContent()
+
+/// Returns a segment name unique to this process.
+std::string segmentName(std::string const& tag)
+{
+  return "/SharedGeometrySnapshot_test_" + std::to_string(getpid()) + "_" + tag;
+}
+
+/// Checks that `shared` holds the content from `makeContent()`.
+void checkContent(geo::SharedGeometrySnapshot const& shared)
+{
+  geo::SharedGeometryContent const expected = makeContent();
+  BOOST_TEST(shared.view().detectorName() == expected.snapshot.detectorName);
+  BOOST_TEST(shared.view().cryostats().size() == 1U);
+  BOOST_TEST(shared.view().planes().size() == 1U);
+  BOOST_TEST_REQUIRE(shared.view().wires().size() == expected.snapshot.wires.size());
+  BOOST_TEST(shared.view().wires().begin()[3].center[2] == expected.snapshot.wires[3].center[2]);
+  BOOST_TEST(shared.wireChannels().size() == expected.wireChannels.size());
+  for (std::size_t i = 0; i < expected.wireChannels.size(); ++i)
+    BOOST_TEST(shared.wireChannels().begin()[i] == expected.wireChannels[i]);
+  BOOST_TEST(shared.fingerprint() == expected.fingerprint);
+} // checkContent()
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(PublishAndAttach_test)
+{
+  std::string const name = segmentName("publish");
+  geo::SharedGeometrySnapshot::remove(name);
+
+  geo::SharedGeometrySnapshot const published =
+    geo::SharedGeometrySnapshot::publish(name, makeContent());
+  BOOST_TEST(published.name() == name);
+  checkContent(published);
+
+  // the segment can't be published twice
+  BOOST_CHECK_THROW(geo::SharedGeometrySnapshot::publish(name, makeContent()), cet::exception);
+
+  // an independent mapping of the same segment
+  geo::SharedGeometrySnapshot attached = geo::SharedGeometrySnapshot::attach(name);
+  checkContent(attached);
+  BOOST_TEST(attached.view().wires().begin() != published.view().wires().begin());
+
+  // moving keeps the mapping
+  geo::SharedGeometrySnapshot const moved = std::move(attached);
+  checkContent(moved);
+
+  BOOST_TEST(geo::SharedGeometrySnapshot::remove(name));
+  BOOST_TEST(!geo::SharedGeometrySnapshot::remove(name));
+
+  // the mappings survive the removal of the segment
+  checkContent(moved);
+
+} // BOOST_AUTO_TEST_CASE(PublishAndAttach_test)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(AttachOrPublish_test)
+{
+  std::string const name = segmentName("attachOrPublish");
+  geo::SharedGeometrySnapshot::remove(name);
+
+  unsigned int nCalls = 0U;
+  auto const maker = [&nCalls]() {
+    ++nCalls;
+    return makeContent();
+  };
+
+  auto const first = geo::SharedGeometrySnapshot::attachOrPublish(name, maker);
+  auto const second = geo::SharedGeometrySnapshot::attachOrPublish(name, maker);
+  BOOST_TEST(nCalls == 1U);
+  checkContent(first);
+  checkContent(second);
+
+  // a child process attaches to the segment published by this one
+  pid_t const child = fork();
+  BOOST_TEST_REQUIRE(child >= 0);
+  if (child == 0) {
+    int status = 0;
+    try {
+      auto const shared = geo::SharedGeometrySnapshot::attach(name);
+      auto const channels = shared.wireChannels();
+      if ((channels.size() != 4U) || (channels.begin()[2] != 102U)) status = 1;
+    }
+    catch (...) {
+      status = 2;
+    }
+    _exit(status);
+  }
+  int status = -1;
+  BOOST_TEST_REQUIRE(waitpid(child, &status, 0) == child);
+  BOOST_TEST(WIFEXITED(status));
+  BOOST_TEST(WEXITSTATUS(status) == 0);
+
+  geo::SharedGeometrySnapshot::remove(name);
+
+  // a failed publication leaves no segment behind
+  BOOST_CHECK_THROW(geo::SharedGeometrySnapshot::attachOrPublish(
+                      name, []() -> geo::SharedGeometryContent { throw std::runtime_error("!"); }),
+                    std::runtime_error);
+  BOOST_TEST(!geo::SharedGeometrySnapshot::remove(name));
+
+  // inconsistent content is rejected
+  geo::SharedGeometryContent bad = makeContent();
+  bad.wireChannels.pop_back();
+  BOOST_CHECK_THROW(geo::SharedGeometrySnapshot::publish(name, bad), cet::exception);
+  BOOST_TEST(!geo::SharedGeometrySnapshot::remove(name));
+
+} // BOOST_AUTO_TEST_CASE(AttachOrPublish_test)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(MissingSegment_test)
+{
+  std::string const name = segmentName("missing");
+  geo::SharedGeometrySnapshot::remove(name);
+
+  auto const start = std::chrono::steady_clock::now();
+  BOOST_CHECK_THROW(geo::SharedGeometrySnapshot::attach(name, std::chrono::milliseconds{50}),
+                    cet::exception);
+  bool const waited = (std::chrono::steady_clock::now() - start) >= std::chrono::milliseconds{50};
+  BOOST_TEST(waited);
+
+} // BOOST_AUTO_TEST_CASE(MissingSegment_test)
@@ -0,0 +1,175 @@
+/**
+ * @file   SimpleGeoArrays_test.cc
+ * @brief  Unit test for `larcorealg/Geometry/SimpleGeoArrays.h`.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/SimpleGeoArrays.h`
+ *
+ * The bulk operations are checked against the methods of the single objects
+ * of `larcorealg/Geometry/SimpleGeo.h`.
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE (simple geometry arrays test)
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "larcorealg/Geometry/SimpleGeoArrays.h"
+
+// C/C++ standard libraries
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace sg = lar::util::simple_geo;
+
+//------------------------------------------------------------------------------
+std::vector<sg::Rectangle<double>> makeRectangles(double shift)
+{
+  std::vector<sg::Rectangle<double>> rects;
+  for (int i = 0; i < 6; ++i) {
+    for (int j = 0; j < 5; ++j) {
+      double const w = 2.0 * i + shift, d = 3.0 * j - shift;
+      rects.push_back({{w, w + 1.0 + 0.5 * j}, {d, d + 2.0 + 0.25 * i}});
+    }
+  }
+  rects.emplace_back(); // null rectangle
+  return rects;
+}
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(RectangleTestCase)
+{
+  auto const rectsA = makeRectangles(0.0);
+  auto const rectsB = makeRectangles(0.7);
+  sg::AreaArraySoA<> const a{rectsA.begin(), rectsA.end()};
+  sg::AreaArraySoA<> const b{rectsB.begin(), rectsB.end()};
+  BOOST_TEST(a.size() == rectsA.size());
+  BOOST_TEST(a.lower(3U, 1U) == rectsA[3].depth.lower);
+
+  // pairwise overlaps
+  std::vector<std::uint8_t> mask(a.size() * b.size(), 2U);
+  std::vector<double> areas(a.size() * b.size(), -1.0);
+  std::size_t const nOverlaps = sg::bulk::overlaps(a, b, mask.data());
+  sg::bulk::intersectionMeasures(a, b, areas.data());
+  std::size_t nExpected = 0;
+  for (std::size_t i = 0; i < a.size(); ++i) {
+    for (std::size_t j = 0; j < b.size(); ++j) {
+      bool const expected = rectsA[i].overlaps(rectsB[j]);
+      nExpected += expected;
+      BOOST_TEST_CONTEXT("A#" << i << " B#" << j)
+      {
+        std::size_t const k = i * b.size() + j;
+        BOOST_TEST(mask[k] == std::uint8_t(expected));
+        BOOST_TEST((areas[k] > 0.0) == expected);
+        if (expected) {
+          auto w = rectsA[i].width, d = rectsA[i].depth;
+          w.intersect(rectsB[j].width);
+          d.intersect(rectsB[j].depth);
+          BOOST_TEST(areas[k] == w.length() * d.length(), boost::test_tools::tolerance(1e-12));
+        }
+      }
+    }
+  }
+  BOOST_TEST(nOverlaps == nExpected);
+  BOOST_TEST(nOverlaps > 0U);
+
+  // one point in all rectangles
+  std::vector<std::uint8_t> inside(a.size(), 2U);
+  sg::bulk::contains(a, {4.5, 6.5}, inside.data());
+  for (std::size_t i = 0; i < a.size(); ++i)
+    BOOST_TEST(inside[i] == std::uint8_t(rectsA[i].contains(4.5, 6.5)), "rectangle #" << i);
+
+  // many points in one rectangle
+  std::vector<double> ws, ds;
+  for (int i = 0; i < 40; ++i) {
+    ws.push_back(0.25 * i);
+    ds.push_back(10.0 - 0.3 * i);
+  }
+  std::vector<std::uint8_t> pointsIn(ws.size(), 2U);
+  sg::bulk::containsPoints(rectsA[12], ws.size(), ws.data(), ds.data(), pointsIn.data());
+  for (std::size_t i = 0; i < ws.size(); ++i)
+    BOOST_TEST(pointsIn[i] == std::uint8_t(rectsA[12].contains(ws[i], ds[i])), "point #" << i);
+
+  // bounding box
+  sg::Rectangle<double> expectedBox;
+  for (auto const& rect : rectsA)
+    expectedBox.extendToInclude(rect);
+  auto const [lower, upper] = sg::bulk::boundingBox(a);
+  BOOST_TEST(lower[0] == expectedBox.width.lower);
+  BOOST_TEST(upper[0] == expectedBox.width.upper);
+  BOOST_TEST(lower[1] == expectedBox.depth.lower);
+  BOOST_TEST(upper[1] == expectedBox.depth.upper);
+} // BOOST_AUTO_TEST_CASE(RectangleTestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(VolumeTestCase)
+{
+  using Point_t = sg::Point3D<double>;
+  using Volume_t = sg::Volume<Point_t>;
+
+  sg::VolumeArraySoA<> volumes;
+  volumes.push_back(Volume_t{Point_t{0.0, 0.0, 0.0}, Point_t{1.0, 2.0, 3.0}});
+  volumes.push_back(Volume_t{Point_t{2.0, 2.0, 2.0}, Point_t{0.5, 1.0, 1.5}}); // unsorted
+  volumes.push_back(Volume_t{Point_t{5.0, 5.0, 5.0}, Point_t{6.0, 6.0, 6.0}});
+  BOOST_TEST(volumes.size() == 3U);
+  BOOST_TEST(volumes.lower(1U, 0U) == 0.5);
+
+  std::uint8_t inside[3];
+  sg::bulk::contains(volumes, {0.75, 1.5, 2.0}, inside);
+  BOOST_TEST(inside[0] == 1U);
+  BOOST_TEST(inside[1] == 1U);
+  BOOST_TEST(inside[2] == 0U);
+  sg::bulk::contains(volumes, {6.0, 5.0, 5.5}, inside); // on the boundary
+  BOOST_TEST(inside[0] == 0U);
+  BOOST_TEST(inside[2] == 1U);
+
+  double const xs[] = {0.5, 1.5, 0.5, 0.0};
+  double const ys[] = {0.5, 0.5, 2.5, 2.0};
+  double const zs[] = {0.5, 0.5, 0.5, 3.0};
+  std::uint8_t pointsIn[4];
+  Volume_t const volume{Point_t{0.0, 0.0, 0.0}, Point_t{1.0, 2.0, 3.0}};
+  sg::bulk::containsPoints(volume, 4U, xs, ys, zs, pointsIn);
+  BOOST_TEST(pointsIn[0] == 1U);
+  BOOST_TEST(pointsIn[1] == 0U);
+  BOOST_TEST(pointsIn[2] == 0U);
+  BOOST_TEST(pointsIn[3] == 1U);
+
+  double measures[9];
+  std::uint8_t mask[9];
+  BOOST_TEST(sg::bulk::overlaps(volumes, volumes, mask) == 5U);
+  sg::bulk::intersectionMeasures(volumes, volumes, measures);
+  BOOST_TEST(measures[0] == 6.0);
+  BOOST_TEST(measures[1] == 0.5 * 1.0 * 0.5); // [0.5, 1] x [1, 2] x [1.5, 2]
+  BOOST_TEST(measures[3] == measures[1]);
+  BOOST_TEST(measures[2] == 0.0);
+  BOOST_TEST(mask[2] == 0U);
+  BOOST_TEST(mask[8] == 1U);
+
+  auto const [lower, upper] = sg::bulk::boundingBox(volumes);
+  BOOST_TEST(lower[0] == 0.0);
+  BOOST_TEST(lower[2] == 0.0);
+  BOOST_TEST(upper[1] == 6.0);
+
+  auto const [emptyLower, emptyUpper] = sg::bulk::boundingBox(sg::VolumeArraySoA<>{});
+  BOOST_TEST(emptyLower[0] > emptyUpper[0]);
+} // BOOST_AUTO_TEST_CASE(VolumeTestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(RangeTestCase)
+{
+  std::vector<sg::Range<float>> const ranges{{0.0f, 1.0f}, {0.5f, 3.0f}, {}, {4.0f, 4.0f}};
+  sg::RangeArraySoA<float> const set{ranges.begin(), ranges.end()};
+
+  std::uint8_t mask[16];
+  BOOST_TEST(sg::bulk::overlaps(set, set, mask) == 4U); // two ranges with themselves and each other
+  for (std::size_t i = 0; i < ranges.size(); ++i) {
+    for (std::size_t j = 0; j < ranges.size(); ++j)
+      BOOST_TEST(mask[i * 4U + j] == std::uint8_t(ranges[i].overlaps(ranges[j])));
+  }
+
+  auto const [lower, upper] = sg::bulk::boundingBox(set);
+  BOOST_TEST(lower[0] == 0.0f);
+  BOOST_TEST(upper[0] == 4.0f); // the point-like range is included
+} // BOOST_AUTO_TEST_CASE(RangeTestCase)
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,198 @@
+/**
+ * @file   SnapshotQuery_test.cc
+ * @brief  Unit test for `geo::SnapshotQuery`.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/SnapshotQuery.h`
+ *
+ * The snapshot has one cryostat with one TPC and two planes of five wires
+ * with a pitch of 1 cm: the first plane has vertical wires at _z_ from 1 to
+ * 5 cm, each on its own channel (`0` to `4`); the second one has wires along
+ * _z_ at _y_ from -2 to 2 cm, read by three channels (`5`, `6`, `7`, `5`, `6`).
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE (snapshot query test)
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "larcorealg/Geometry/GeometrySnapshot.h"
+#include "larcorealg/Geometry/SnapshotQuery.h"
+
+// framework libraries
+#include "cetlib_except/exception.h"
+
+// C/C++ standard libraries
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+
+//------------------------------------------------------------------------------
+namespace {
+
+  geo::GeometrySnapshot makeSnapshot()
+  {
+    geo::GeometrySnapshot snapshot;
+    snapshot.detectorName = "querydet";
+    snapshot.cryostats.push_back({{{0.0, -5.0, 0.0}, {10.0, 5.0, 30.0}}, 0U, 1U, 0U, 0U});
+    snapshot.TPCs.push_back({{{0.0, -5.0, 0.0}, {10.0, 5.0, 30.0}},
+                             {{1.0, -4.0, 1.0}, {9.0, 4.0, 29.0}},
+                             {-1.0, 0.0, 0.0},
+                             0U,
+                             2U,
+                             2,
+                             0U});
+    for (unsigned int p = 0; p < 2U; ++p) {
+      snapshot.planes.push_back({{0.5 * p, 0.0, 3.0},
+                                 {1.0, 0.0, 0.0},
+                                 {0.0, 1.0, 0.0},
+                                 {0.0, 0.0, 1.0},
+                                 10.0,
+                                 30.0,
+                                 1.0,
+                                 0.0,
+                                 static_cast<std::uint32_t>(snapshot.wires.size()),
+                                 5U,
+                                 static_cast<std::int32_t>(p),
+                                 1});
+      for (unsigned int w = 0; w < 5U; ++w) {
+        if (p == 0U)
+          snapshot.wires.push_back({{0.0, 0.0, 1.0 + w}, {0.0, 1.0, 0.0}, 5.0, 0.0});
+        else
+          snapshot.wires.push_back({{0.5, -2.0 + w, 15.0}, {0.0, 0.0, 1.0}, 15.0, 0.0});
+      }
+    }
+    return snapshot;
+  } // makeSnapshot()
+
+  std::vector<raw::ChannelID_t> const WireChannels{0U, 1U, 2U, 3U, 4U, 5U, 6U, 7U, 5U, 6U};
+
+  /// Copies an image into an 8-byte aligned buffer.
+  std::vector<std::uint64_t> alignedCopy(std::string const& data)
+  {
+    std::vector<std::uint64_t> buffer((data.size() + 7U) / 8U + 1U);
+    std::memcpy(buffer.data(), data.data(), data.size());
+    return buffer;
+  }
+
+  /// Holds a snapshot image in an 8-byte aligned buffer, and its view.
+  struct SnapshotImage {
+    std::vector<std::uint64_t> buffer;
+    geo::GeometrySnapshotView view;
+
+    explicit SnapshotImage(std::string const& data)
+      : buffer{alignedCopy(data)}, view{buffer.data(), data.size()}
+    {}
+  };
+
+  std::string image(geo::GeometrySnapshot const& snapshot)
+  {
+    std::ostringstream out;
+    snapshot.write(out);
+    return out.str();
+  }
+
+  util::span<raw::ChannelID_t const*> channelSpan(std::vector<raw::ChannelID_t> const& channels)
+  {
+    return {channels.data(), channels.data() + channels.size()};
+  }
+
+} // local namespace
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(ContentTestCase)
+{
+  SnapshotImage const image{::image(makeSnapshot())};
+  geo::SnapshotQuery const query{image.view, channelSpan(WireChannels)};
+
+  BOOST_TEST(query.nTPCs() == 1U);
+  BOOST_TEST(query.nPlanes() == 2U);
+  BOOST_TEST(query.nChannels() == 8U);
+
+  geo::PlaneID const plane1{0U, 0U, 1U};
+  BOOST_TEST(query.hasTPC(geo::TPCID{0U, 0U}));
+  BOOST_TEST(!query.hasTPC(geo::TPCID{0U, 1U}));
+  BOOST_TEST(query.hasPlane(plane1));
+  BOOST_TEST(!query.hasPlane(geo::PlaneID{0U, 0U, 2U}));
+  BOOST_TEST(!query.hasPlane(geo::PlaneID{1U, 0U, 0U}));
+  BOOST_TEST(query.hasWire(geo::WireID{plane1, 4U}));
+  BOOST_TEST(!query.hasWire(geo::WireID{plane1, 5U}));
+  BOOST_TEST(!query.hasWire(geo::WireID{}));
+
+  BOOST_TEST(query.plane(plane1).firstWire == 5U);
+  BOOST_TEST(query.wire(geo::WireID{plane1, 3U}).center[1] == 1.0);
+  BOOST_CHECK_THROW(query.plane(geo::PlaneID{0U, 0U, 2U}), cet::exception);
+  BOOST_CHECK_THROW(query.wire(geo::WireID{plane1, 5U}), cet::exception);
+  BOOST_TEST(query.heapMemory() > 0U);
+
+  // one channel per wire is needed
+  std::vector<raw::ChannelID_t> const tooFew{0U, 1U, 2U};
+  BOOST_CHECK_THROW((geo::SnapshotQuery{image.view, channelSpan(tooFew)}), cet::exception);
+} // BOOST_AUTO_TEST_CASE(ContentTestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(PositionTestCase)
+{
+  SnapshotImage const image{::image(makeSnapshot())};
+  geo::SnapshotQuery const query{image.view, channelSpan(WireChannels)};
+
+  BOOST_TEST(query.findTPC({5.0, 0.0, 10.0}) == (geo::TPCID{0U, 0U}));
+  BOOST_TEST(!query.findTPC({-1.0, 0.0, 10.0}).isValid);
+  BOOST_TEST(!query.findTPC({5.0, 0.0, 31.0}).isValid);
+
+  geo::PlaneID const plane0{0U, 0U, 0U};
+  geo::PlaneID const plane1{0U, 0U, 1U};
+  BOOST_TEST(query.wireCoordinate({5.0, 3.0, 3.5}, plane0) == 2.5);
+  // the wire coordinate of the second plane increases with _y_, as the wires
+  BOOST_TEST(query.wireCoordinate({5.0, 1.25, 3.5}, plane1) == 3.25);
+
+  BOOST_TEST(query.nearestWireID({5.0, 0.0, 2.4}, plane0) == (geo::WireID{plane0, 1U}));
+  BOOST_TEST(query.nearestWireID({5.0, -1.6, 9.0}, plane1) == (geo::WireID{plane1, 0U}));
+  BOOST_TEST(!query.nearestWireID({5.0, 0.0, 10.0}, plane0).isValid);
+  BOOST_TEST(!query.nearestWireID({5.0, -6.0, 9.0}, plane1).isValid);
+  BOOST_CHECK_THROW(query.nearestWireID({5.0, 0.0, 2.0}, geo::PlaneID{0U, 0U, 2U}),
+                    cet::exception);
+
+  BOOST_TEST(query.nearestChannel({5.0, 0.0, 4.9}, plane0) == 4U);
+  BOOST_TEST(query.nearestChannel({5.0, 1.1, 9.0}, plane1) == 5U);
+  BOOST_TEST(query.nearestChannel({5.0, 0.0, 10.0}, plane0) == raw::InvalidChannelID);
+} // BOOST_AUTO_TEST_CASE(PositionTestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(ChannelTestCase)
+{
+  SnapshotImage const image{::image(makeSnapshot())};
+  geo::SnapshotQuery const query{image.view, channelSpan(WireChannels)};
+
+  geo::PlaneID const plane0{0U, 0U, 0U};
+  geo::PlaneID const plane1{0U, 0U, 1U};
+  BOOST_TEST(query.channel(geo::WireID{plane0, 2U}) == 2U);
+  BOOST_TEST(query.channel(geo::WireID{plane1, 4U}) == 6U);
+  BOOST_TEST(query.channel(geo::WireID{plane1, 5U}) == raw::InvalidChannelID);
+
+  auto const wires2 = query.channelToWires(2U);
+  BOOST_TEST_REQUIRE(wires2.size() == 1U);
+  BOOST_TEST(wires2.begin()[0] == (geo::WireID{plane0, 2U}));
+
+  auto const wires5 = query.channelToWires(5U);
+  BOOST_TEST_REQUIRE(wires5.size() == 2U);
+  BOOST_TEST(wires5.begin()[0] == (geo::WireID{plane1, 0U}));
+  BOOST_TEST(wires5.begin()[1] == (geo::WireID{plane1, 3U}));
+
+  BOOST_TEST(query.channelToWires(7U).size() == 1U);
+  BOOST_TEST(query.channelToWires(8U).empty());
+  BOOST_TEST(query.channelToWires(raw::InvalidChannelID).empty());
+
+  // every wire is listed by its own channel
+  for (geo::WireID const wireid :
+       {geo::WireID{plane0, 0U}, geo::WireID{plane1, 1U}, geo::WireID{plane1, 4U}}) {
+    auto const wires = query.channelToWires(query.channel(wireid));
+    unsigned int nFound = 0U;
+    for (geo::WireID const& other : wires)
+      nFound += (other == wireid);
+    BOOST_TEST(nFound == 1U);
+  }
+} // BOOST_AUTO_TEST_CASE(ChannelTestCase)
+
+//------------------------------------------------------------------------------
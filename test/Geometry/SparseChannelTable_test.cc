@@ -0,0 +1,79 @@
+/**
+ * @file   SparseChannelTable_test.cc
+ * @brief  Unit test for `geo::details::SparseChannelTable`.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/details/SparseChannelTable.h`
+ *
+ * The table is filled with a channel numbering encoding crate, board and
+ * channel in different bits, and checked against a `std::map`.
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE (sparse channel table test)
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "larcorealg/Geometry/details/SparseChannelTable.h"
+#include "larcoreobj/SimpleTypesAndConstants/RawTypes.h"
+
+// C/C++ standard libraries
+#include <map>
+#include <vector>
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(EmptyTableTestCase)
+{
+  geo::details::SparseChannelTable<int> const table;
+  BOOST_TEST(table.empty());
+  BOOST_TEST(table.nPages() == 0U);
+  BOOST_TEST(table.find(0U) == nullptr);
+  BOOST_TEST(!table.contains(raw::InvalidChannelID));
+} // BOOST_AUTO_TEST_CASE(EmptyTableTestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(SparseNumberingTestCase)
+{
+  // crate in bits 16-19, board in bits 8-11, 64 channels per board
+  std::map<raw::ChannelID_t, std::vector<int>> reference;
+  geo::details::SparseChannelTable<std::vector<int>> table;
+  int wire = 0;
+  for (raw::ChannelID_t crate = 1; crate <= 4; ++crate) {
+    for (raw::ChannelID_t board = 0; board < 12; ++board) {
+      for (raw::ChannelID_t ch = 0; ch < 64; ++ch) {
+        raw::ChannelID_t const channel = (crate << 16) | (board << 8) | ch;
+        std::vector<int> wires{wire, wire + 1};
+        ++wire;
+        BOOST_TEST(table.insert(channel, wires));
+        reference.emplace(channel, std::move(wires));
+      }
+    }
+  }
+  BOOST_TEST(table.size() == reference.size());
+  BOOST_TEST(table.nPages() == 4U * 12U); // one page per board
+  BOOST_TEST(!table.insert(raw::InvalidChannelID, {}));
+
+  for (raw::ChannelID_t channel = 0; channel < (5U << 16); ++channel) {
+    auto const it = reference.find(channel);
+    std::vector<int> const* wires = table.find(channel);
+    if (it == reference.end()) {
+      if (wires) BOOST_ERROR("Channel " << channel << " found but not inserted");
+      continue;
+    }
+    BOOST_TEST_REQUIRE(wires);
+    BOOST_TEST(*wires == it->second);
+  }
+  BOOST_TEST(!table.contains(raw::InvalidChannelID));
+  BOOST_TEST(!table.contains(0xFFFFFFF0U));
+
+  // replacing a value keeps the number of channels
+  BOOST_TEST(!table.insert((2U << 16) | 5U, {-1}));
+  BOOST_TEST(table.size() == reference.size());
+  BOOST_TEST((*table.find((2U << 16) | 5U) == std::vector<int>{-1}));
+
+  BOOST_TEST(table.channels().size() == table.values().size());
+  BOOST_TEST(table.heapMemory() > 0U);
+
+  table.clear();
+  BOOST_TEST(table.empty());
+  BOOST_TEST(table.find((1U << 16) | 1U) == nullptr);
+} // BOOST_AUTO_TEST_CASE(SparseNumberingTestCase)
@@ -0,0 +1,126 @@
+/**
+ * @file   SyntheticDetectorGDML_test.cc
+ * @brief  Test of `geo::SyntheticDetectorGDML`.
+ * @see    `larcorealg/Geometry/SyntheticDetectorGDML.h`
+ *
+ * The GDML text is checked for the expected number of volumes and placements;
+ * loading it into a geometry is left to `geometry_scaling_benchmark`.
+ */
+
+// LArSoft libraries
+#include "larcorealg/Geometry/SyntheticDetectorGDML.h"
+
+// framework libraries
+#include "cetlib_except/exception.h"
+
+// Boost libraries
+#define BOOST_TEST_MODULE (SyntheticDetectorGDML_test)
+#include <boost/test/unit_test.hpp>
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <sstream>
+#include <string>
+
+// -----------------------------------------------------------------------------
+namespace {
+
+  /// Returns the number of occurrences of `key` in `text`.
+  std::size_t count(std::string const& text, std::string const& key)
+  {
+    std::size_t n = 0U;
+    for (auto pos = text.find(key); pos != std::string::npos; pos = text.find(key, pos + 1U))
+      ++n;
+    return n;
+  }
+
+} // local namespace
+
+// -----------------------------------------------------------------------------
+void test_defaultDetector()
+{
+  geo::SyntheticDetectorGDML const detector{{}};
+
+  BOOST_TEST(detector.nTPCs() == 2U);
+  BOOST_TEST(detector.nCollectionWires() == 400U);
+  BOOST_TEST(detector.nInductionWires() > detector.nCollectionWires());
+  BOOST_TEST(detector.nWiresPerTPC() ==
+             2U * detector.nInductionWires() + detector.nCollectionWires());
+  BOOST_TEST(detector.nOpDets() == 10U);
+  BOOST_TEST(detector.nAuxDets() == 0U);
+
+  std::string const gdml = detector.gdml();
+  BOOST_TEST(count(gdml, "<volume ") == count(gdml, "</volume>"));
+  BOOST_TEST(count(gdml, "<physvol>") == count(gdml, "</physvol>"));
+
+  // one volume per induction wire, plus the vertical wire
+  BOOST_TEST(count(gdml, "<volume name=\"volTPCWire") == detector.nInductionWires() + 1U);
+  BOOST_TEST(count(gdml, "<volumeref ref=\"volTPCWireU") == detector.nInductionWires());
+  BOOST_TEST(count(gdml, "<volumeref ref=\"volTPCWireVert\"") == detector.nCollectionWires());
+  BOOST_TEST(count(gdml, "<volumeref ref=\"volTPCPlane\"") == 2U);
+  BOOST_TEST(count(gdml, "<volumeref ref=\"volTPC\"") == 2U);
+  BOOST_TEST(count(gdml, "<volumeref ref=\"volOpDetSensitive\"") == 10U);
+  BOOST_TEST(count(gdml, "<volumeref ref=\"volCryostat\"") == 1U);
+  BOOST_TEST(count(gdml, "volAuxDet") == 0U);
+  BOOST_TEST(count(gdml, "<world ref=\"volWorld\"/>") == 1U);
+
+  // the output of write() and gdml() are the same
+  std::ostringstream sstr;
+  detector.write(sstr);
+  BOOST_TEST(sstr.str() == gdml);
+
+} // test_defaultDetector()
+
+// -----------------------------------------------------------------------------
+void test_largeDetector()
+{
+  geo::SyntheticDetectorGDML::Config_t config;
+  config.nCryostats = 2U;
+  config.nTPCsX = 4U;
+  config.nTPCsY = 2U;
+  config.nTPCsZ = 25U;
+  config.nWires = 100U;
+  config.nOpDetsPerCryostat = 500U;
+  config.nAuxDets = 30U;
+  geo::SyntheticDetectorGDML const detector{config};
+
+  BOOST_TEST(detector.nTPCs() == 400U);
+  BOOST_TEST(detector.nOpDets() == 1000U);
+  BOOST_TEST(detector.nAuxDets() == 30U);
+
+  // the TPC description is shared: the size of the text does not scale
+  std::string const gdml = detector.gdml();
+  BOOST_TEST(count(gdml, "<volume name=\"volTPC\"") == 1U);
+  BOOST_TEST(count(gdml, "<volumeref ref=\"volTPC\"") == 200U);
+  BOOST_TEST(count(gdml, "<volumeref ref=\"volTPCWireVert\"") == 100U);
+  BOOST_TEST(count(gdml, "<volumeref ref=\"volOpDetSensitive\"") == 500U);
+  BOOST_TEST(count(gdml, "<volumeref ref=\"volCryostat\"") == 2U);
+  BOOST_TEST(count(gdml, "<volume name=\"volAuxDetSensitive") == 30U);
+  BOOST_TEST(count(gdml, "<volumeref ref=\"volAuxDet") == 60U);
+
+} // test_largeDetector()
+
+// -----------------------------------------------------------------------------
+void test_invalidConfiguration()
+{
+  geo::SyntheticDetectorGDML::Config_t config;
+  config.nTPCsZ = 0U;
+  BOOST_CHECK_THROW(geo::SyntheticDetectorGDML{config}, cet::exception);
+
+  config = {};
+  config.inductionAngle = 90.0;
+  BOOST_CHECK_THROW(geo::SyntheticDetectorGDML{config}, cet::exception);
+
+  config = {};
+  config.wirePitch = 0.0;
+  BOOST_CHECK_THROW(geo::SyntheticDetectorGDML{config}, cet::exception);
+
+} // test_invalidConfiguration()
+
+// -----------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(SyntheticDetectorGDMLTestCase)
+{
+  test_defaultDetector();
+  test_largeDetector();
+  test_invalidConfiguration();
+} // BOOST_AUTO_TEST_CASE(SyntheticDetectorGDMLTestCase)
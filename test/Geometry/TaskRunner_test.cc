@@ -0,0 +1,59 @@
+/**
+ * @file   TaskRunner_test.cc
+ * @brief  Unit test for `geo::runTasks()` and `geo::makeThreadTaskRunner()`.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/TaskRunner.h`
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE (task runner test)
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "larcorealg/Geometry/TaskRunner.h"
+
+// C/C++ standard libraries
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+//------------------------------------------------------------------------------
+void checkAllRun(geo::TaskRunner_t const& runner, std::size_t n)
+{
+  std::vector<std::atomic<int>> runs(n);
+  geo::runTasks(runner, n, [&runs](std::size_t i) { ++runs[i]; });
+  for (std::size_t i = 0; i < n; ++i)
+    BOOST_TEST(runs[i].load() == 1);
+}
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(SequentialTestCase)
+{
+  checkAllRun({}, 0U);
+  checkAllRun({}, 1U);
+  checkAllRun({}, 50U);
+}
+
+BOOST_AUTO_TEST_CASE(ThreadTestCase)
+{
+  for (unsigned int const nThreads : {0U, 1U, 4U, 200U}) {
+    geo::TaskRunner_t const runner = geo::makeThreadTaskRunner(nThreads);
+    checkAllRun(runner, 0U);
+    checkAllRun(runner, 1U);
+    checkAllRun(runner, 3U);
+    checkAllRun(runner, 1000U);
+  }
+
+  // exceptions are propagated, after all the other tasks are run
+  std::atomic<int> done{0};
+  BOOST_CHECK_THROW(geo::runTasks(geo::makeThreadTaskRunner(4U),
+                                  100U,
+                                  [&done](std::size_t i) {
+                                    if (i == 42U) throw std::runtime_error("task 42");
+                                    ++done;
+                                  }),
+                    std::runtime_error);
+  BOOST_TEST(done.load() == 99);
+}
+
+//------------------------------------------------------------------------------
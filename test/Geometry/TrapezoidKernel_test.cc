@@ -0,0 +1,95 @@
+/**
+ * @file   TrapezoidKernel_test.cc
+ * @brief  Unit test for `geo::details::TrapezoidKernel`.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/details/TrapezoidKernel.h`
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE (trapezoid kernel test)
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "larcorealg/Geometry/details/TrapezoidKernel.h"
+
+//------------------------------------------------------------------------------
+/// Trapezoid 10 long, 2 high, 4 wide at _z = -5_ and 2 wide at _z = +5_,
+/// rotated by 90 degrees around _z_ and centered at (1, 2, 3).
+geo::details::TrapezoidKernel makeTestKernel()
+{
+  // world-to-local: local = R^-1 (world - center)
+  double const origin[3] = {-2.0, 1.0, -3.0};
+  double const axisX[3] = {0.0, -1.0, 0.0};
+  double const axisY[3] = {1.0, 0.0, 0.0};
+  double const axisZ[3] = {0.0, 0.0, 1.0};
+  auto const toLocal =
+    geo::details::AffineTransformKernel::fromImages(origin, axisX, axisY, axisZ);
+  return geo::details::TrapezoidKernel::make(toLocal, 2.0, 1.0, 1.0, 10.0);
+}
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(LocalTestCase)
+{
+  auto const kernel = makeTestKernel();
+  BOOST_TEST(kernel.halfLength == 5.0);
+  BOOST_TEST(kernel.halfCenterWidth == 1.5);
+  BOOST_TEST(kernel.halfWidthAt(-5.0) == 2.0);
+  BOOST_TEST(kernel.halfWidthAt(+5.0) == 1.0);
+
+  double const center[3] = {0.0, 0.0, 0.0};
+  BOOST_TEST(kernel.containsLocal(center));
+
+  double const wideEnd[3] = {1.9, 0.9, -4.9};
+  double const narrowEnd[3] = {1.9, 0.9, +4.9};
+  BOOST_TEST(kernel.containsLocal(wideEnd));
+  BOOST_TEST(!kernel.containsLocal(narrowEnd));
+  BOOST_TEST(kernel.containsLocal(narrowEnd, 1.0));
+
+  double const above[3] = {0.0, 1.2, 0.0};
+  double const beyond[3] = {0.0, 0.0, 5.2};
+  BOOST_TEST(!kernel.containsLocal(above));
+  BOOST_TEST(kernel.containsLocal(above, 0.3));
+  BOOST_TEST(!kernel.containsLocal(beyond));
+  BOOST_TEST(kernel.containsLocal(beyond, 0.3));
+} // BOOST_AUTO_TEST_CASE(LocalTestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(WorldTestCase)
+{
+  auto const kernel = makeTestKernel();
+
+  // local (x, y, z) is at world (1 - y, 2 + x, 3 + z)
+  double const center[3] = {1.0, 2.0, 3.0};
+  BOOST_TEST(kernel.contains(center));
+
+  double const wideEnd[3] = {1.0 - 0.9, 2.0 + 1.9, 3.0 - 4.9};
+  double const narrowEnd[3] = {1.0 - 0.9, 2.0 + 1.9, 3.0 + 4.9};
+  BOOST_TEST(kernel.contains(wideEnd));
+  BOOST_TEST(!kernel.contains(narrowEnd));
+  BOOST_TEST(kernel.contains(narrowEnd, 1.0));
+
+  // along world x is the local height
+  double const side[3] = {1.0 + 1.5, 2.0, 3.0};
+  BOOST_TEST(!kernel.contains(side));
+  BOOST_TEST(kernel.contains(side, 0.6));
+} // BOOST_AUTO_TEST_CASE(WorldTestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(BoxTestCase)
+{
+  double const origin[3] = {0.0, 0.0, 0.0};
+  double const axisX[3] = {1.0, 0.0, 0.0};
+  double const axisY[3] = {0.0, 1.0, 0.0};
+  double const axisZ[3] = {0.0, 0.0, 1.0};
+  auto const identity =
+    geo::details::AffineTransformKernel::fromImages(origin, axisX, axisY, axisZ);
+  auto const box = geo::details::TrapezoidKernel::make(identity, 1.0, 1.0, 1.0, 2.0);
+  BOOST_TEST(box.widthSlope == 0.0);
+
+  double const corner[3] = {1.0, 1.0, 1.0};
+  double const outside[3] = {1.0, 1.0, 1.01};
+  BOOST_TEST(box.contains(corner));
+  BOOST_TEST(!box.contains(outside));
+} // BOOST_AUTO_TEST_CASE(BoxTestCase)
+
+//------------------------------------------------------------------------------
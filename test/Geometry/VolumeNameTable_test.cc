@@ -0,0 +1,77 @@
+/**
+ * @file   VolumeNameTable_test.cc
+ * @brief  Unit test for `geo::details::VolumeNameTable`.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/details/VolumeNameTable.h`
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE (volume name table test)
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "larcorealg/Geometry/details/VolumeNameTable.h"
+
+// C/C++ standard libraries
+#include <string>
+#include <string_view>
+
+//------------------------------------------------------------------------------
+using Table_t = geo::details::VolumeNameTable;
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(Handles_test)
+{
+  Table_t table;
+  BOOST_TEST(table.size() == 0U);
+  BOOST_TEST(table.handle("volWorld") == Table_t::InvalidHandle);
+  BOOST_TEST(table.handleOf(0) == Table_t::InvalidHandle);
+
+  // volumes sharing a name share the handle
+  Table_t::Handle_t const world = table.add("volWorld", 0);
+  Table_t::Handle_t const tpc = table.add("volTPCActive", 3);
+  BOOST_TEST(table.add("volTPCActive", 5) == tpc);
+  Table_t::Handle_t const opdet = table.add("volOpDetSensitive");
+  BOOST_TEST(world != tpc);
+  BOOST_TEST(tpc != opdet);
+  BOOST_TEST(table.size() == 3U);
+
+  BOOST_TEST(table.handle("volWorld") == world);
+  BOOST_TEST(table.handle(std::string{"volTPCActive"}) == tpc);
+  BOOST_TEST(table.handle("volTPC") == Table_t::InvalidHandle);
+
+  BOOST_TEST(table.handleOf(0) == world);
+  BOOST_TEST(table.handleOf(3) == tpc);
+  BOOST_TEST(table.handleOf(5) == tpc);
+  BOOST_TEST(table.handleOf(4) == Table_t::InvalidHandle);
+  BOOST_TEST(table.handleOf(6) == Table_t::InvalidHandle);
+  BOOST_TEST(table.handleOf(-1) == Table_t::InvalidHandle);
+
+  BOOST_TEST(table.name(world) == "volWorld");
+  BOOST_TEST(table.name(opdet) == "volOpDetSensitive");
+  BOOST_TEST(table.name(Table_t::InvalidHandle).empty());
+} // BOOST_AUTO_TEST_CASE(Handles_test)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(Interning_test)
+{
+  Table_t table;
+  std::string_view name;
+  {
+    std::string source{"volCryostat"};
+    name = table.name(table.add(source, 1));
+    source = "overwritten";
+  }
+  // the table keeps its own copy of the name
+  BOOST_TEST(name == "volCryostat");
+  BOOST_TEST(table.name(table.add("volCryostat")).data() == name.data());
+  BOOST_TEST(table.heapMemory() > 0U);
+
+  table.clear();
+  BOOST_TEST(table.size() == 0U);
+  BOOST_TEST(table.handle("volCryostat") == Table_t::InvalidHandle);
+  BOOST_TEST(table.handleOf(1) == Table_t::InvalidHandle);
+  BOOST_TEST(table.add("volWorld") == 0U);
+} // BOOST_AUTO_TEST_CASE(Interning_test)
+
+//------------------------------------------------------------------------------
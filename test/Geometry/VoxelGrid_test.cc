@@ -0,0 +1,214 @@
+/**
+ * @file   VoxelGrid_test.cc
+ * @brief  Unit test for `geo::VoxelGrid` and `geo::VoxelDataContainer`.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/VoxelGrid.h`
+ *
+ * The indexing with both the linear and the Morton layouts is checked for
+ * consistency, the batch point conversion against the single point one, and
+ * the traversal against a fine sampling of random segments.
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE (voxel grid test)
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "larcorealg/Geometry/VoxelGrid.h"
+
+// C/C++ standard libraries
+#include <array>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <set>
+#include <stdexcept> // std::out_of_range
+#include <vector>
+
+using Coords_t = std::array<double, 3U>;
+
+// the grid can be used in constant expressions
+constexpr geo::VoxelGrid<> ConstGrid{{0.0, 0.0, 0.0}, {4.0, 2.0, 1.0}, {4U, 2U, 1U}};
+static_assert(ConstGrid.size() == 8U);
+static_assert(ConstGrid.indexAt(2.5, 0.5, 0.5) == 4U);
+static_assert(ConstGrid.indexAt(4.5, 0.5, 0.5) == geo::VoxelGrid<>::InvalidIndex);
+static_assert(ConstGrid.voxel(5U) == geo::VoxelID{2U, 1U, 0U});
+
+//------------------------------------------------------------------------------
+/// Checks that indices and voxels of `grid` are a one-to-one mapping.
+template <typename Layout>
+void checkIndexing(geo::VoxelGrid<Layout> const& grid)
+{
+  std::set<std::size_t> indices;
+  for (std::size_t ix = 0; ix < grid.nVoxels(0); ++ix) {
+    for (std::size_t iy = 0; iy < grid.nVoxels(1); ++iy) {
+      for (std::size_t iz = 0; iz < grid.nVoxels(2); ++iz) {
+        geo::VoxelID const voxel{ix, iy, iz};
+        std::size_t const index = grid.index(voxel);
+        BOOST_TEST(index < grid.indexSize());
+        BOOST_TEST(indices.insert(index).second);
+        BOOST_TEST((grid.voxel(index) == voxel));
+
+        Coords_t const center = grid.voxelCenter(voxel);
+        BOOST_TEST((grid.voxelAt(center[0], center[1], center[2]) == voxel));
+        BOOST_TEST(grid.indexAt(center[0], center[1], center[2]) == index);
+      }
+    }
+  }
+  BOOST_TEST(indices.size() == grid.size());
+} // checkIndexing()
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(GridTestCase)
+{
+  geo::VoxelGrid<> const empty;
+  BOOST_TEST(empty.empty());
+  BOOST_TEST(empty.indexSize() == 0U);
+  BOOST_TEST(!empty.contains(0.0, 0.0, 0.0));
+  BOOST_TEST(empty.indexAt(0.0, 0.0, 0.0) == geo::VoxelGrid<>::InvalidIndex);
+
+  geo::VoxelGrid<> const flat{{0.0, 0.0, 0.0}, {1.0, 0.0, 1.0}, {2U, 2U, 2U}};
+  BOOST_TEST(flat.empty());
+
+  // corners are swapped where needed
+  geo::VoxelGrid<> const grid{{100.0, -50.0, 0.0}, {-100.0, 50.0, 300.0}, {20U, 10U, 30U}};
+  BOOST_TEST(!grid.empty());
+  BOOST_TEST(grid.lower(0) == -100.0);
+  BOOST_TEST(grid.upper(0) == 100.0);
+  BOOST_TEST(grid.voxelSize(0) == 10.0);
+  BOOST_TEST(grid.size() == 20U * 10U * 30U);
+  BOOST_TEST(grid.indexSize() == grid.size());
+  checkIndexing(grid);
+
+  // borders are included, with the upper border in the last voxel
+  BOOST_TEST(grid.contains(100.0, 50.0, 300.0));
+  BOOST_TEST((grid.voxelAt(100.0, 50.0, 300.0) == geo::VoxelID{19U, 9U, 29U}));
+  BOOST_TEST((grid.voxelAt(-100.0, -50.0, 0.0) == geo::VoxelID{0U, 0U, 0U}));
+  double const nan = std::numeric_limits<double>::quiet_NaN();
+  BOOST_TEST(!grid.contains(nan, 0.0, 0.0));
+  BOOST_TEST(grid.indexAt(0.0, nan, 0.0) == geo::VoxelGrid<>::InvalidIndex);
+
+  geo::VoxelGrid<geo::MortonVoxelLayout> const morton{
+    {-100.0, -50.0, 0.0}, {100.0, 50.0, 300.0}, {20U, 10U, 30U}};
+  BOOST_TEST(morton.indexSize() >= morton.size());
+  checkIndexing(morton);
+  BOOST_TEST(morton.index({1U, 0U, 0U}) == 1U);
+  BOOST_TEST(morton.index({0U, 1U, 0U}) == 2U);
+  BOOST_TEST(morton.index({0U, 0U, 1U}) == 4U);
+  BOOST_TEST(morton.index({1U, 1U, 1U}) == 7U);
+
+} // BOOST_AUTO_TEST_CASE(GridTestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(BatchTestCase)
+{
+  geo::VoxelGrid<geo::MortonVoxelLayout> const grid{
+    {-100.0, -50.0, 0.0}, {100.0, 50.0, 300.0}, {20U, 10U, 30U}};
+
+  std::mt19937 engine{4321U};
+  std::uniform_real_distribution<double> flat{-1.2, 1.2};
+  std::size_t const n = 1000U;
+  std::vector<double> xs(n), ys(n), zs(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    xs[i] = 100.0 * flat(engine);
+    ys[i] = 50.0 * flat(engine);
+    zs[i] = 150.0 + 150.0 * flat(engine);
+  }
+  xs[0] = std::numeric_limits<double>::quiet_NaN();
+
+  std::vector<std::size_t> indices(n);
+  grid.indicesAt(n, xs.data(), ys.data(), zs.data(), indices.data());
+  std::size_t nInside = 0U;
+  for (std::size_t i = 0; i < n; ++i) {
+    BOOST_TEST(indices[i] == grid.indexAt(xs[i], ys[i], zs[i]));
+    if (indices[i] != grid.InvalidIndex) ++nInside;
+  }
+  BOOST_TEST(indices[0] == grid.InvalidIndex);
+  BOOST_TEST(nInside > 0U);
+  BOOST_TEST(nInside < n);
+
+} // BOOST_AUTO_TEST_CASE(BatchTestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(TraversalTestCase)
+{
+  geo::VoxelGrid<> const grid{{-100.0, -50.0, 0.0}, {100.0, 50.0, 300.0}, {20U, 10U, 30U}};
+
+  // along x, through the whole grid and beyond
+  std::vector<geo::VoxelID> crossed;
+  auto const collect = [&crossed](geo::VoxelID const& v, double, double) { crossed.push_back(v); };
+  double length = grid.traverse(Coords_t{-150.0, 5.0, 15.0}, Coords_t{150.0, 5.0, 15.0}, collect);
+  BOOST_TEST(length == 200.0, boost::test_tools::tolerance(1e-9));
+  BOOST_TEST_REQUIRE(crossed.size() == 20U);
+  for (std::size_t i = 0; i < crossed.size(); ++i)
+    BOOST_TEST((crossed[i] == geo::VoxelID{i, 5U, 1U}));
+
+  // missing the grid
+  length = grid.traverse(
+    Coords_t{-150.0, 60.0, 15.0}, Coords_t{150.0, 60.0, 15.0}, [](auto const&, double, double) {
+      BOOST_ERROR("Voxel crossed by a segment out of the grid");
+    });
+  BOOST_TEST(length == 0.0);
+
+  // random segments: the lengths in each voxel match a fine sampling
+  std::mt19937 engine{1234U};
+  std::uniform_real_distribution<double> flat{-1.5, 1.5};
+  for (unsigned int iSegment = 0; iSegment < 50U; ++iSegment) {
+    Coords_t const p1{100.0 * flat(engine), 50.0 * flat(engine), 150.0 + 150.0 * flat(engine)};
+    Coords_t const p2{100.0 * flat(engine), 50.0 * flat(engine), 150.0 + 150.0 * flat(engine)};
+    Coords_t const delta{p2[0] - p1[0], p2[1] - p1[1], p2[2] - p1[2]};
+    double const segLength =
+      std::sqrt(delta[0] * delta[0] + delta[1] * delta[1] + delta[2] * delta[2]);
+
+    std::vector<double> walked(grid.indexSize(), 0.0);
+    double lastLeave = -1.0;
+    double const inside =
+      grid.traverse(p1, p2, [&](geo::VoxelID const& voxel, double tEnter, double tLeave) {
+        BOOST_TEST(tEnter >= lastLeave - 1e-9);
+        lastLeave = tLeave;
+        walked[grid.index(voxel)] += tLeave - tEnter;
+      });
+
+    unsigned int const nSamples = 100000U;
+    double const step = segLength / nSamples;
+    std::vector<double> sampled(grid.indexSize(), 0.0);
+    double sampledInside = 0.0;
+    for (unsigned int i = 0; i < nSamples; ++i) {
+      double const f = (i + 0.5) / nSamples;
+      std::size_t const index =
+        grid.indexAt(p1[0] + f * delta[0], p1[1] + f * delta[1], p1[2] + f * delta[2]);
+      if (index == grid.InvalidIndex) continue;
+      sampled[index] += step;
+      sampledInside += step;
+    }
+    BOOST_TEST(inside == sampledInside, boost::test_tools::tolerance(1e-3));
+    double maxDiff = 0.0;
+    for (std::size_t i = 0; i < walked.size(); ++i)
+      maxDiff = std::max(maxDiff, std::abs(walked[i] - sampled[i]));
+    BOOST_TEST(maxDiff <= 2.0 * step);
+  } // for segments
+
+} // BOOST_AUTO_TEST_CASE(TraversalTestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(DataContainerTestCase)
+{
+  geo::VoxelGrid<geo::MortonVoxelLayout> const grid{
+    {0.0, 0.0, 0.0}, {3.0, 2.0, 5.0}, {3U, 2U, 5U}};
+  geo::VoxelDataContainer<int, geo::MortonVoxelLayout> data{grid, -1};
+  BOOST_TEST(data.size() == grid.indexSize());
+  BOOST_TEST(data.hasVoxel({2U, 1U, 4U}));
+  BOOST_TEST(!data.hasVoxel({3U, 1U, 4U}));
+
+  data[{2U, 1U, 4U}] = 5;
+  BOOST_TEST(data.at({2U, 1U, 4U}) == 5);
+  BOOST_CHECK_THROW(data.at({3U, 0U, 0U}), std::out_of_range);
+  BOOST_TEST_REQUIRE(data.dataAt(2.5, 1.5, 4.5) != nullptr);
+  BOOST_TEST(*data.dataAt(2.5, 1.5, 4.5) == 5);
+  BOOST_TEST(data.dataAt(3.5, 1.5, 4.5) == nullptr);
+
+  data.fill(0);
+  for (int const value : data)
+    BOOST_TEST(value == 0);
+
+} // BOOST_AUTO_TEST_CASE(DataContainerTestCase)
@@ -0,0 +1,113 @@
+/**
+ * @file   WireArrays_test.cc
+ * @brief  Unit test for `geo::details::WireArrays`.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/details/WireArrays.h`
+ *
+ * The scans on a small plane of parallel wires are compared with the expected
+ * end points, distances and pitch.
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE (wire arrays test)
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "larcorealg/Geometry/details/WireArrays.h"
+
+// C/C++ standard libraries
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+//------------------------------------------------------------------------------
+struct TestVector {
+  double x, y, z;
+
+  double X() const { return x; }
+  double Y() const { return y; }
+  double Z() const { return z; }
+};
+
+/// Five wires along _y_, half a meter long, at 0.3 cm from each other in _z_.
+geo::details::WireArrays makeWires()
+{
+  geo::details::WireArrays wires;
+  wires.reserve(5U);
+  for (unsigned int i = 0; i < 5U; ++i)
+    wires.push_back(TestVector{0.0, 0.0, 0.3 * i}, TestVector{0.0, 1.0, 0.0}, 25.0);
+  return wires;
+}
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(LayoutTestCase)
+{
+  geo::details::WireArrays const wires = makeWires();
+  BOOST_TEST(wires.size() == 5U);
+  BOOST_TEST(!wires.empty());
+  for (double const* array : {wires.centerX(),
+                              wires.centerY(),
+                              wires.centerZ(),
+                              wires.dirX(),
+                              wires.dirY(),
+                              wires.dirZ(),
+                              wires.halfLength()}) {
+    BOOST_TEST(reinterpret_cast<std::uintptr_t>(array) % geo::details::WireArrays::Alignment ==
+               0U);
+  }
+  BOOST_TEST(wires.centerZ()[3] == 0.3 * 3);
+  BOOST_TEST(wires.halfLength()[4] == 25.0);
+
+  geo::details::WireArrays copy = wires;
+  BOOST_TEST(copy.dirY()[2] == 1.0);
+  copy.clear();
+  BOOST_TEST(copy.empty());
+}
+
+BOOST_AUTO_TEST_CASE(EndPointsTestCase)
+{
+  geo::details::WireArrays const wires = makeWires();
+  std::vector<double> starts(3U * wires.size()), ends(3U * wires.size());
+  double* const start[3] = {&starts[0], &starts[5], &starts[10]};
+  double* const end[3] = {&ends[0], &ends[5], &ends[10]};
+  wires.fillEndPoints(start, end);
+  for (unsigned int i = 0; i < 5U; ++i) {
+    BOOST_TEST(start[0][i] == 0.0);
+    BOOST_TEST(start[1][i] == -25.0);
+    BOOST_TEST(start[2][i] == 0.3 * i);
+    BOOST_TEST(end[1][i] == +25.0);
+    BOOST_TEST(end[2][i] == 0.3 * i);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(DistanceTestCase)
+{
+  geo::details::WireArrays const wires = makeWires();
+
+  std::vector<double> d2(wires.size());
+  wires.segmentDistances2(1.0, 10.0, 0.3, d2.data());
+  BOOST_TEST(d2[1] == 1.0, boost::test_tools::tolerance(1e-9));
+  BOOST_TEST(d2[0] == 1.09, boost::test_tools::tolerance(1e-9));
+
+  // beyond the end of the wires, the distance is from the end point
+  wires.segmentDistances2(0.0, 29.0, 0.6, d2.data());
+  BOOST_TEST(d2[2] == 16.0, boost::test_tools::tolerance(1e-9));
+
+  BOOST_TEST(wires.closestSegment(0.5, 0.0, 0.8) == 3U);
+  BOOST_TEST(wires.closestSegment(0.0, -40.0, 5.0) == 4U);
+  BOOST_TEST(geo::details::WireArrays{}.closestSegment(0.0, 0.0, 0.0) == 0U);
+}
+
+BOOST_AUTO_TEST_CASE(PitchTestCase)
+{
+  geo::details::WireArrays const wires = makeWires();
+  BOOST_TEST(wires.minDistanceFromAxis(0U, 1e-4) == 0.3, boost::test_tools::tolerance(1e-9));
+  BOOST_TEST(wires.minDistanceFromAxis(4U, 1e-4) == 0.3, boost::test_tools::tolerance(1e-9));
+
+  geo::details::WireArrays single;
+  single.push_back(TestVector{0.0, 0.0, 0.0}, TestVector{0.0, 1.0, 0.0}, 25.0);
+  BOOST_TEST(single.minDistanceFromAxis(0U, 1e-4) == std::numeric_limits<double>::max());
+}
+
+//------------------------------------------------------------------------------
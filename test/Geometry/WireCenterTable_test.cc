@@ -0,0 +1,116 @@
+/**
+ * @file   WireCenterTable_test.cc
+ * @brief  Unit test for `geo::details::WireCenterTable`.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/details/WireCenterTable.h`
+ *
+ * The nearest wire on a plane with a gap between two groups of wires is
+ * compared with a linear search on all the wires.
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE (wire center table test)
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "larcorealg/Geometry/details/WireCenterTable.h"
+
+// C/C++ standard libraries
+#include <cmath>
+#include <vector>
+
+//------------------------------------------------------------------------------
+/// Ten wires at unit pitch, with a gap of 2.5 pitches after the fifth.
+std::vector<double> gapCoordinates()
+{
+  std::vector<double> coords;
+  for (unsigned int i = 0; i < 10U; ++i)
+    coords.push_back(i + ((i < 5U) ? 0.0 : 2.5));
+  return coords;
+}
+
+/// Returns the wire nearest to `c` by a linear search (later wire on ties).
+int linearNearest(std::vector<double> const& coords, double c)
+{
+  int best = 0;
+  for (unsigned int i = 1; i < coords.size(); ++i)
+    if (std::abs(coords[i] - c) <= std::abs(coords[best] - c)) best = i;
+  return best;
+}
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(UniformPlane_test)
+{
+  std::vector<double> coords;
+  for (unsigned int i = 0; i < 10U; ++i)
+    coords.push_back(i + ((i % 2U) ? 0.005 : -0.005));
+
+  geo::details::WireCenterTable const table{coords};
+  BOOST_TEST(table.empty());
+  BOOST_TEST(table.size() == 0U);
+  BOOST_TEST(table.heapMemory() == 0U);
+
+  BOOST_TEST(geo::details::WireCenterTable{}.empty());
+} // BOOST_AUTO_TEST_CASE(UniformPlane_test)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(GapPlane_test)
+{
+  std::vector<double> const coords = gapCoordinates();
+  geo::details::WireCenterTable const table{coords};
+  BOOST_TEST(!table.empty());
+  BOOST_TEST(table.size() == coords.size());
+  BOOST_TEST(table.heapMemory() > 0U);
+
+  for (double c = -0.45; c < 11.95; c += 0.1)
+    BOOST_TEST(table.nearestWire(c) == linearNearest(coords, c), "at " << c);
+
+  // the rounding would give wire 6 to a point by the wire 5
+  BOOST_TEST(table.nearestWire(7.4) == 5);
+  BOOST_TEST(table.nearestWire(5.5) == 4);
+  BOOST_TEST(table.nearestWire(6.0) == 5); // tie between 4 and 5
+} // BOOST_AUTO_TEST_CASE(GapPlane_test)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(OutOfRange_test)
+{
+  geo::details::WireCenterTable const table{gapCoordinates()};
+
+  BOOST_TEST(table.nearestWire(-0.5) == 0);
+  BOOST_TEST(table.nearestWire(-0.6) == -1);
+  BOOST_TEST(table.nearestWire(-3.0) == -3);
+  BOOST_TEST(table.nearestWire(11.9) == 9);
+  BOOST_TEST(table.nearestWire(12.0) == 10);
+  BOOST_TEST(table.nearestWire(15.2) == 13);
+} // BOOST_AUTO_TEST_CASE(OutOfRange_test)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(UnsortedWires_test)
+{
+  // wire numbers increasing against the wire coordinate, with a shifted wire
+  std::vector<double> const coords{4.0, 3.0, 2.0, 0.6, 0.0};
+  geo::details::WireCenterTable const table{coords};
+  BOOST_TEST(!table.empty());
+
+  for (double c = -0.45; c < 4.45; c += 0.1)
+    BOOST_TEST(table.nearestWire(c) == linearNearest(coords, c), "at " << c);
+  BOOST_TEST(table.nearestWire(1.0) == 3);
+  BOOST_TEST(table.nearestWire(0.2) == 4);
+} // BOOST_AUTO_TEST_CASE(UnsortedWires_test)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(FromSorted_test)
+{
+  std::vector<double> const coords{4.0, 3.0, 2.0, 0.6, 0.0};
+  geo::details::WireCenterTable const table{coords};
+
+  geo::details::WireCenterTable const restored = geo::details::WireCenterTable::fromSorted(
+    table.sortedCoords(), table.sortedWires(), table.size());
+  BOOST_TEST(restored.size() == table.size());
+  for (double c = -0.45; c < 4.45; c += 0.1)
+    BOOST_TEST(restored.nearestWire(c) == table.nearestWire(c), "at " << c);
+
+  BOOST_TEST(geo::details::WireCenterTable::fromSorted(nullptr, nullptr, 0U).empty());
+} // BOOST_AUTO_TEST_CASE(FromSorted_test)
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,261 @@
+/**
+ * @file   WireCoincidenceFinder_test.cc
+ * @brief  Unit test for `geo::WireCoincidenceFinder`.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/WireCoincidenceFinder.h`
+ *
+ * The coincidences are compared with the ones from a loop on all the
+ * combinations of active wires, on three planes of wires clipped by a
+ * rectangle.
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE (wire coincidence finder test)
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "larcorealg/Geometry/WireCoincidenceFinder.h"
+
+// C/C++ standard libraries
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <tuple>
+#include <vector>
+
+using geo::WireCoincidenceFinder;
+
+//------------------------------------------------------------------------------
+struct TestVector {
+  double x, y, z;
+
+  double X() const { return x; }
+  double Y() const { return y; }
+  double Z() const { return z; }
+};
+
+struct TestWire {
+  TestVector center, dir;
+  double halfL;
+
+  TestVector GetCenter() const { return center; }
+  TestVector Direction() const { return dir; }
+  double HalfL() const { return halfL; }
+};
+
+struct TestPlane {
+  std::vector<TestWire> wires;
+  double pitch;
+
+  unsigned int Nwires() const { return wires.size(); }
+  TestWire const& Wire(unsigned int i) const { return wires[i]; }
+};
+
+/// Plane at `x` with wires at `angle` from _y_, covering y in [ -50, 50 ] and
+/// z in [ 0, 300 ].
+TestPlane makePlane(double x, double angle, double pitch, double firstOffset)
+{
+  double const dy = std::cos(angle), dz = std::sin(angle);
+  double const ny = -dz, nz = dy;
+  double const corners[4] = {-50.0 * ny, -50.0 * ny + 300.0 * nz, 50.0 * ny, 50.0 * ny + 300.0 * nz};
+  double const dMin = *std::min_element(corners, corners + 4);
+  double const dMax = *std::max_element(corners, corners + 4);
+
+  TestPlane plane{{}, pitch};
+  for (double d = dMin + firstOffset; d < dMax; d += pitch) {
+    double tMin = -1e9, tMax = 1e9;
+    auto const clip = [&tMin, &tMax](double p, double v, double lower, double upper) {
+      if (v == 0.0) return;
+      double t1 = (lower - p) / v, t2 = (upper - p) / v;
+      if (t1 > t2) std::swap(t1, t2);
+      tMin = std::max(tMin, t1);
+      tMax = std::min(tMax, t2);
+    };
+    clip(d * ny, dy, -50.0, 50.0);
+    clip(d * nz, dz, 0.0, 300.0);
+    if (tMin >= tMax) continue;
+    double const t = (tMin + tMax) / 2.0;
+    plane.wires.push_back(
+      {{x, d * ny + t * dy, d * nz + t * dz}, {0.0, dy, dz}, (tMax - tMin) / 2.0});
+  }
+  return plane;
+} // makePlane()
+
+std::vector<TestPlane> makePlanes()
+{
+  double const pi = std::acos(-1.0);
+  return {makePlane(0.6, pi / 3.0, 0.479, 0.123),
+          makePlane(0.3, -pi / 3.0, 0.479, 0.211),
+          makePlane(0.0, pi / 2.0, 0.3, 0.137)};
+}
+
+/// Picks about a `fraction` of the wires of each plane, with random windows.
+WireCoincidenceFinder::PlaneWires_t pickWires(std::vector<TestPlane> const& planes,
+                                              double fraction,
+                                              std::mt19937& engine)
+{
+  std::bernoulli_distribution pick{fraction};
+  std::uniform_real_distribution<double> time{0.0, 1000.0};
+  WireCoincidenceFinder::PlaneWires_t wires(planes.size());
+  for (std::size_t p = 0; p < planes.size(); ++p) {
+    for (unsigned int w = 0; w < planes[p].Nwires(); ++w) {
+      if (!pick(engine)) continue;
+      double const start = time(engine);
+      wires[p].push_back({w, start, start + 50.0});
+    }
+  }
+  return wires;
+} // pickWires()
+
+/// Closest point on wire `a` to wire `b`, and whether it is within both.
+std::pair<std::array<double, 3U>, bool> referenceCrossing(TestWire const& a, TestWire const& b)
+{
+  double const r[3] = {
+    b.center.x - a.center.x, b.center.y - a.center.y, b.center.z - a.center.z};
+  double const c = a.dir.y * b.dir.y + a.dir.z * b.dir.z;
+  double const rA = r[1] * a.dir.y + r[2] * a.dir.z;
+  double const rB = r[1] * b.dir.y + r[2] * b.dir.z;
+  double const den = 1.0 - c * c;
+  double const offsetA = (rA - c * rB) / den;
+  double const offsetB = (c * rA - rB) / den;
+  return {{a.center.x, a.center.y + offsetA * a.dir.y, a.center.z + offsetA * a.dir.z},
+          (std::abs(offsetA) <= a.halfL) && (std::abs(offsetB) <= b.halfL)};
+}
+
+bool overlap(WireCoincidenceFinder::ActiveWire_t const& w1,
+             WireCoincidenceFinder::ActiveWire_t const& w2)
+{
+  return (w1.startTime <= w2.endTime) && (w2.startTime <= w1.endTime);
+}
+
+using Key_t = std::tuple<std::size_t, std::size_t, std::size_t>;
+
+std::vector<Key_t> keys(std::vector<WireCoincidenceFinder::Coincidence_t> const& coincidences)
+{
+  std::vector<Key_t> result;
+  for (auto const& coincidence : coincidences)
+    result.emplace_back(coincidence.wires[0], coincidence.wires[1], coincidence.wires[2]);
+  std::sort(result.begin(), result.end());
+  return result;
+}
+
+/// Triplets from the loop on all the combinations.
+std::vector<Key_t> referenceTriplets(std::vector<TestPlane> const& planes,
+                                     WireCoincidenceFinder::PlaneWires_t const& wires,
+                                     double tolerance)
+{
+  std::vector<Key_t> result;
+  for (std::size_t iA = 0; iA < wires[0].size(); ++iA) {
+    for (std::size_t iB = 0; iB < wires[1].size(); ++iB) {
+      if (!overlap(wires[0][iA], wires[1][iB])) continue;
+      auto const [point, within] =
+        referenceCrossing(planes[0].Wire(wires[0][iA].wire), planes[1].Wire(wires[1][iB].wire));
+      if (!within) continue;
+      for (std::size_t iC = 0; iC < wires[2].size(); ++iC) {
+        if (!overlap(wires[2][iC], wires[0][iA]) || !overlap(wires[2][iC], wires[1][iB]))
+          continue;
+        TestWire const& wire = planes[2].Wire(wires[2][iC].wire);
+        double const dy = point[1] - wire.center.y, dz = point[2] - wire.center.z;
+        double const along = dy * wire.dir.y + dz * wire.dir.z;
+        double const across = std::hypot(dy - along * wire.dir.y, dz - along * wire.dir.z);
+        if ((across <= tolerance * planes[2].pitch) && (std::abs(along) <= wire.halfL))
+          result.emplace_back(iA, iB, iC);
+      }
+    }
+  }
+  std::sort(result.begin(), result.end());
+  return result;
+} // referenceTriplets()
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(PairsTestCase)
+{
+  std::vector<TestPlane> const planes = makePlanes();
+  geo::details::WireIntersectionTables tables;
+  tables.build(planes);
+  WireCoincidenceFinder const finder{tables};
+
+  std::mt19937 engine{24680};
+  for (double const fraction : {0.05, 0.5, 1.0}) {
+    auto const wires = pickWires(planes, fraction, engine);
+    for (std::size_t a = 0; a < 3U; ++a) {
+      for (std::size_t b = 0; b < 3U; ++b) {
+        if (a == b) continue;
+        auto const pairs = finder.findPairs(wires, a, b);
+
+        std::vector<Key_t> expected;
+        for (std::size_t iA = 0; iA < wires[a].size(); ++iA) {
+          for (std::size_t iB = 0; iB < wires[b].size(); ++iB) {
+            if (!overlap(wires[a][iA], wires[b][iB])) continue;
+            auto const [point, within] = referenceCrossing(planes[a].Wire(wires[a][iA].wire),
+                                                           planes[b].Wire(wires[b][iB].wire));
+            if (within) expected.emplace_back(iA, iB, WireCoincidenceFinder::NoIndex);
+          }
+        }
+        std::sort(expected.begin(), expected.end());
+        BOOST_TEST(keys(pairs) == expected);
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(TripletsTestCase)
+{
+  std::vector<TestPlane> const planes = makePlanes();
+  geo::details::WireIntersectionTables tables;
+  tables.build(planes);
+
+  std::mt19937 engine{13579};
+  for (double const tolerance : {0.5, 1.2}) {
+    WireCoincidenceFinder const finder{tables, {tolerance}};
+    for (double const fraction : {0.1, 0.6}) {
+      auto const wires = pickWires(planes, fraction, engine);
+      auto const triplets = finder.findTriplets(wires, 0, 1, 2);
+      BOOST_TEST(!triplets.empty());
+      BOOST_TEST(keys(triplets) == referenceTriplets(planes, wires, tolerance));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(ParallelTestCase)
+{
+  std::vector<TestPlane> const planes = makePlanes();
+  geo::details::WireIntersectionTables tables;
+  tables.build(planes);
+
+  std::mt19937 engine{97531};
+  std::vector<WireCoincidenceFinder::PlaneWires_t> tpcWires;
+  for (int i = 0; i < 12; ++i)
+    tpcWires.push_back(pickWires(planes, 0.3, engine));
+
+  std::vector<WireCoincidenceFinder::TPCJob_t> jobs;
+  for (auto const& wires : tpcWires)
+    jobs.push_back({&tables, &wires, {0, 1, 2}});
+
+  auto const results = WireCoincidenceFinder::findTripletsInTPCs(jobs, WireCoincidenceFinder::Config_t{}, 4U);
+  BOOST_TEST_REQUIRE(results.size() == jobs.size());
+  WireCoincidenceFinder const finder{tables};
+  for (std::size_t i = 0; i < jobs.size(); ++i)
+    BOOST_TEST(keys(results[i]) == keys(finder.findTriplets(tpcWires[i], 0, 1, 2)));
+
+  // errors are reported
+  jobs.push_back({&tables, &tpcWires[0], {0, 0, 2}});
+  BOOST_CHECK_THROW(WireCoincidenceFinder::findTripletsInTPCs(jobs, WireCoincidenceFinder::Config_t{}, 3U), cet::exception);
+}
+
+BOOST_AUTO_TEST_CASE(UnsupportedTestCase)
+{
+  std::vector<TestPlane> const planes = makePlanes();
+  geo::details::WireIntersectionTables tables;
+  tables.build(planes);
+  WireCoincidenceFinder const finder{tables};
+  WireCoincidenceFinder::PlaneWires_t const wires(3U);
+
+  BOOST_TEST(finder.supports(0, 1, 2));
+  BOOST_TEST(!finder.supports(0, 0));
+  BOOST_CHECK_THROW(finder.findPairs(wires, 1, 1), cet::exception);
+  BOOST_CHECK_THROW(finder.findPairs(wires, 0, 3), cet::exception);
+  BOOST_TEST(finder.findTriplets(wires, 0, 1, 2).empty());
+}
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,230 @@
+/**
+ * @file   WireCoordinateKernel_test.cc
+ * @brief  Unit test for `geo::details::WireCoordinateKernel`.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/details/WireCoordinateKernel.h`
+ *
+ * The batch results on points given as structures and as arrays are compared
+ * with the single point ones, on a plane with slanted wires, and the cells
+ * crossed by segments and the wires overlapping a box are checked on a plane
+ * with unit pitch.
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE (wire coordinate kernel test)
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "larcorealg/Geometry/details/WireCoordinateKernel.h"
+
+// C/C++ standard libraries
+#include <cmath>
+#include <cstdint>
+#include <utility> // std::pair
+#include <vector>
+
+//------------------------------------------------------------------------------
+struct TestPoint {
+  double x, y, z;
+
+  double X() const { return x; }
+  double Y() const { return y; }
+  double Z() const { return z; }
+};
+
+/// Ten wires at 60 degrees, with 0.5 cm pitch, the first one centered at z = 1.
+geo::details::WireCoordinateKernel makeKernel()
+{
+  geo::details::WireCoordinateKernel kernel;
+  kernel.origin[0] = 0.0;
+  kernel.origin[1] = 0.0;
+  kernel.origin[2] = 1.0;
+  kernel.dir[0] = 0.0;
+  kernel.dir[1] = -std::sqrt(3.0) / 2.0;
+  kernel.dir[2] = 0.5;
+  kernel.wireDir[0] = 0.0;
+  kernel.wireDir[1] = 0.5;
+  kernel.wireDir[2] = std::sqrt(3.0) / 2.0;
+  kernel.pitch = 0.5;
+  kernel.nWires = 10U;
+  return kernel;
+}
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(SinglePointTestCase)
+{
+  auto const kernel = makeKernel();
+  BOOST_TEST(kernel.wireCoordinate(0.0, 0.0, 1.0) == 0.0);
+  BOOST_TEST(kernel.wireCoordinate(5.0, 0.0, 2.0) == 1.0, boost::test_tools::tolerance(1e-12));
+  // along the wire direction the coordinate does not change
+  BOOST_TEST(kernel.wireCoordinate(0.0, 0.5, 1.0 + std::sqrt(3.0) / 2.0) == 0.0,
+             boost::test_tools::tolerance(1e-12));
+}
+
+BOOST_AUTO_TEST_CASE(BatchTestCase)
+{
+  auto const kernel = makeKernel();
+
+  std::vector<TestPoint> points;
+  for (int i = -30; i < 130; ++i)
+    points.push_back({0.1 * i, -0.03 * i, 1.0 + 0.037 * i});
+  std::size_t const n = points.size();
+  std::vector<double> x, y, z;
+  for (TestPoint const& p : points) {
+    x.push_back(p.x);
+    y.push_back(p.y);
+    z.push_back(p.z);
+  }
+
+  std::vector<double> coordsAoS(n), coordsSoA(n);
+  kernel.wireCoordinates(points.begin(), points.end(), coordsAoS.data());
+  kernel.wireCoordinates(n, x.data(), y.data(), z.data(), coordsSoA.data());
+
+  std::vector<unsigned int> wiresAoS(n), wiresSoA(n);
+  std::vector<std::uint8_t> validAoS(n), validSoA(n);
+  kernel.nearestWires(points.begin(), points.end(), wiresAoS.data(), validAoS.data());
+  kernel.nearestWires(n, x.data(), y.data(), z.data(), wiresSoA.data(), validSoA.data());
+
+  unsigned int nValid = 0;
+  for (std::size_t i = 0; i < n; ++i) {
+    double const expected = kernel.wireCoordinate(points[i].x, points[i].y, points[i].z);
+    BOOST_TEST(coordsAoS[i] == expected);
+    BOOST_TEST(coordsSoA[i] == expected);
+
+    int const wireNo = int(0.5 + expected);
+    bool const isValid = (wireNo >= 0) && (wireNo < 10);
+    unsigned int const capped = (wireNo < 0) ? 0U : (isValid ? wireNo : 9U);
+    BOOST_TEST(wiresAoS[i] == capped);
+    BOOST_TEST(wiresSoA[i] == capped);
+    BOOST_TEST(bool(validAoS[i]) == isValid);
+    BOOST_TEST(bool(validSoA[i]) == isValid);
+    if (isValid) ++nValid;
+  } // for
+  BOOST_TEST(nValid > 0U);
+  BOOST_TEST(nValid < n);
+}
+
+BOOST_AUTO_TEST_CASE(InterWireDistanceTestCase)
+{
+  auto const kernel = makeKernel();
+  double const sqrt2 = std::sqrt(2.0);
+  auto const& w = kernel.wireDir;
+  auto const& d = kernel.dir;
+
+  // across the wires; a drift (x) component adds only to the 3D distance
+  BOOST_TEST(kernel.interWireDistance(d[0], d[1], d[2]) == 0.5,
+             boost::test_tools::tolerance(1e-12));
+  BOOST_TEST(kernel.interWireDistance(-2.0 * d[0], -2.0 * d[1], -2.0 * d[2]) == 0.5,
+             boost::test_tools::tolerance(1e-12));
+  BOOST_TEST(kernel.interWireDistance(1.0, d[1], d[2]) == 0.5 * sqrt2,
+             boost::test_tools::tolerance(1e-12));
+  BOOST_TEST(kernel.interWireProjectedDistance(1.0, d[1], d[2]) == 0.5,
+             boost::test_tools::tolerance(1e-12));
+  // at 45 degrees from the wires
+  BOOST_TEST(kernel.interWireDistance(w[0] + d[0], w[1] + d[1], w[2] + d[2]) == 0.5 * sqrt2,
+             boost::test_tools::tolerance(1e-12));
+  BOOST_TEST(kernel.interWireProjectedDistance(w[0] + d[0], w[1] + d[1], w[2] + d[2]) ==
+               0.5 * sqrt2,
+             boost::test_tools::tolerance(1e-12));
+
+  // the steps of a curling trajectory
+  std::vector<TestPoint> dirs;
+  for (int i = 1; i < 100; ++i)
+    dirs.push_back({std::cos(0.1 * i), std::sin(0.1 * i), 0.2 + 0.01 * i});
+  std::size_t const n = dirs.size();
+  std::vector<double> dx, dy, dz;
+  for (TestPoint const& dir : dirs) {
+    dx.push_back(dir.x);
+    dy.push_back(dir.y);
+    dz.push_back(dir.z);
+  }
+
+  std::vector<double> pitchAoS(n), pitchSoA(n), projAoS(n), projSoA(n);
+  kernel.interWireDistances(dirs.begin(), dirs.end(), pitchAoS.data());
+  kernel.interWireDistances(n, dx.data(), dy.data(), dz.data(), pitchSoA.data());
+  kernel.interWireProjectedDistances(dirs.begin(), dirs.end(), projAoS.data());
+  kernel.interWireProjectedDistances(n, dx.data(), dy.data(), dz.data(), projSoA.data());
+
+  for (std::size_t i = 0; i < n; ++i) {
+    TestPoint const& dir = dirs[i];
+    double const r = std::sqrt(dir.x * dir.x + dir.y * dir.y + dir.z * dir.z);
+    double const s = dir.x * d[0] + dir.y * d[1] + dir.z * d[2];
+    double const t = dir.x * w[0] + dir.y * w[1] + dir.z * w[2];
+    BOOST_TEST(pitchAoS[i] == r / std::abs(s) * 0.5, boost::test_tools::tolerance(1e-9));
+    BOOST_TEST(pitchSoA[i] == pitchAoS[i]);
+    // as geo::PlaneGeo::InterWireProjectedDistance()
+    BOOST_TEST(projAoS[i] == std::sqrt(t * t / (s * s) + 1.0) * 0.5,
+               boost::test_tools::tolerance(1e-9));
+    BOOST_TEST(projSoA[i] == projAoS[i]);
+    BOOST_TEST(projAoS[i] <= pitchAoS[i] * (1.0 + 1e-12));
+  } // for
+}
+
+BOOST_AUTO_TEST_CASE(WalkCellsTestCase)
+{
+  // ten wires along y, one centimeter apart along z
+  geo::details::WireCoordinateKernel kernel;
+  kernel.origin[0] = kernel.origin[1] = kernel.origin[2] = 0.0;
+  kernel.dir[0] = kernel.dir[1] = 0.0;
+  kernel.dir[2] = 1.0;
+  kernel.pitch = 1.0;
+  kernel.nWires = 10U;
+
+  using Cells_t = std::vector<std::pair<unsigned int, double>>;
+  auto const walk = [&kernel](double z0, double z1, double y1 = 0.0) {
+    Cells_t cells;
+    double const start[3] = {0.0, 0.0, z0};
+    double const end[3] = {0.0, y1, z1};
+    kernel.walkCells(
+      start, end, [&cells](unsigned int w, double f) { cells.emplace_back(w, f); });
+    return cells;
+  };
+  auto const checkCells = [](Cells_t const& cells, Cells_t const& expected) {
+    BOOST_TEST_REQUIRE(cells.size() == expected.size());
+    for (std::size_t i = 0; i < cells.size(); ++i) {
+      BOOST_TEST(cells[i].first == expected[i].first);
+      BOOST_TEST(cells[i].second == expected[i].second, boost::test_tools::tolerance(1e-12));
+    }
+  };
+
+  // starting before the first wire
+  checkCells(walk(-2.2, 3.3),
+             {{0U, 1.0 / 5.5}, {1U, 1.0 / 5.5}, {2U, 1.0 / 5.5}, {3U, 0.8 / 5.5}});
+  // backward, ending after the last wire
+  checkCells(walk(8.0, 12.0), {{8U, 0.5 / 4.0}, {9U, 1.0 / 4.0}});
+  checkCells(walk(3.3, -2.2),
+             {{3U, 0.8 / 5.5}, {2U, 1.0 / 5.5}, {1U, 1.0 / 5.5}, {0U, 1.0 / 5.5}});
+  // within a single cell, and parallel to the wires
+  checkCells(walk(4.6, 5.4), {{5U, 1.0}});
+  checkCells(walk(2.2, 2.2, 10.0), {{2U, 1.0}});
+  // out of the plane
+  checkCells(walk(-5.0, -3.0), {});
+  checkCells(walk(12.0, 10.0), {});
+}
+
+BOOST_AUTO_TEST_CASE(RangeTestCase)
+{
+  // ten wires along y at 45 degrees in the y/z plane, 0.5 cm apart
+  geo::details::WireCoordinateKernel kernel;
+  kernel.origin[0] = kernel.origin[1] = kernel.origin[2] = 0.0;
+  kernel.dir[0] = 0.0;
+  kernel.dir[1] = kernel.dir[2] = std::sqrt(0.5);
+  kernel.pitch = 0.5;
+  kernel.nWires = 10U;
+
+  double const lower[3] = {-1.0, 0.0, 0.0};
+  double const upper[3] = {+1.0, 1.0, 2.0};
+  auto const [cMin, cMax] = kernel.boxCoordinateRange(lower, upper);
+  BOOST_TEST(cMin == 0.0, boost::test_tools::tolerance(1e-12));
+  BOOST_TEST(cMax == 6.0 * std::sqrt(0.5), boost::test_tools::tolerance(1e-12));
+
+  using Range_t = std::pair<unsigned int, unsigned int>;
+  BOOST_TEST((kernel.wiresInCoordinateRange(cMin, cMax) == Range_t{0U, 5U}));
+  BOOST_TEST((kernel.wiresInCoordinateRange(2.5, 3.0) == Range_t{3U, 4U}));
+  BOOST_TEST((kernel.wiresInCoordinateRange(2.2, 2.8) == Range_t{0U, 0U}));
+  BOOST_TEST((kernel.wiresInCoordinateRange(-5.0, 20.0) == Range_t{0U, 10U}));
+  BOOST_TEST((kernel.wiresInCoordinateRange(9.5, 20.0) == Range_t{0U, 0U}));
+  BOOST_TEST((kernel.wiresInCoordinateRange(3.0, 2.0) == Range_t{0U, 0U}));
+}
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,206 @@
+/**
+ * @file   WireIntersectionTables_test.cc
+ * @brief  Unit test for `geo::details::WireIntersectionTables`.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/details/WireIntersectionTables.h`
+ *
+ * The intersections from the tables are compared with the ones computed from
+ * the wires, on three planes of wires clipped by a rectangle.
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE (wire intersection tables test)
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "larcorealg/Geometry/details/WireIntersectionTables.h"
+
+// C/C++ standard libraries
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+//------------------------------------------------------------------------------
+struct TestVector {
+  double x, y, z;
+
+  double X() const { return x; }
+  double Y() const { return y; }
+  double Z() const { return z; }
+};
+
+struct TestWire {
+  TestVector center, dir;
+  double halfL;
+
+  TestVector GetCenter() const { return center; }
+  TestVector Direction() const { return dir; }
+  double HalfL() const { return halfL; }
+};
+
+struct TestPlane {
+  std::vector<TestWire> wires;
+
+  unsigned int Nwires() const { return wires.size(); }
+  TestWire const& Wire(unsigned int i) const { return wires[i]; }
+};
+
+/// Rectangle the wires are clipped to: y in [ -50, 50 ], z in [ 0, 300 ].
+constexpr double YMin = -50.0, YMax = 50.0, ZMin = 0.0, ZMax = 300.0;
+
+/// Plane at `x` with wires at `angle` from _y_, covering the rectangle.
+TestPlane makePlane(double x, double angle, double pitch, double firstOffset)
+{
+  double const dy = std::cos(angle), dz = std::sin(angle);
+  double const ny = -dz, nz = dy; // orthogonal to the wires
+
+  // range of the distance along the normal covered by the rectangle corners
+  double const corners[4] = {
+    ny * YMin + nz * ZMin, ny * YMin + nz * ZMax, ny * YMax + nz * ZMin, ny * YMax + nz * ZMax};
+  double const dMin = *std::min_element(corners, corners + 4);
+  double const dMax = *std::max_element(corners, corners + 4);
+
+  TestPlane plane;
+  for (double d = dMin + firstOffset; d < dMax; d += pitch) {
+    // clip the line `d n + t dir` to the rectangle
+    double tMin = -1e9, tMax = 1e9;
+    auto const clip = [&tMin, &tMax](double p, double v, double lower, double upper) {
+      if (v == 0.0) return;
+      double t1 = (lower - p) / v, t2 = (upper - p) / v;
+      if (t1 > t2) std::swap(t1, t2);
+      tMin = std::max(tMin, t1);
+      tMax = std::min(tMax, t2);
+    };
+    clip(d * ny, dy, YMin, YMax);
+    clip(d * nz, dz, ZMin, ZMax);
+    if (tMin >= tMax) continue;
+    double const t = (tMin + tMax) / 2.0;
+    plane.wires.push_back(
+      {{x, d * ny + t * dy, d * nz + t * dz}, {0.0, dy, dz}, (tMax - tMin) / 2.0});
+  }
+  return plane;
+} // makePlane()
+
+/// Three planes with wires at +60, -60 and 90 degrees from _y_.
+std::vector<TestPlane> makePlanes()
+{
+  double const pi = std::acos(-1.0);
+  return {makePlane(0.6, pi / 3.0, 0.479, 0.123),
+          makePlane(0.3, -pi / 3.0, 0.479, 0.211),
+          makePlane(0.0, pi / 2.0, 0.3, 0.137)};
+}
+
+struct Reference_t {
+  double point[3];
+  double offsetA, offsetB;
+};
+
+/// Closest point on wire `a` to wire `b`, computed from the wires.
+Reference_t referenceCrossing(TestWire const& a, TestWire const& b)
+{
+  double const r[3] = {
+    b.center.x - a.center.x, b.center.y - a.center.y, b.center.z - a.center.z};
+  double const da[3] = {a.dir.x, a.dir.y, a.dir.z};
+  double const db[3] = {b.dir.x, b.dir.y, b.dir.z};
+  double const c = da[0] * db[0] + da[1] * db[1] + da[2] * db[2];
+  double const rA = r[0] * da[0] + r[1] * da[1] + r[2] * da[2];
+  double const rB = r[0] * db[0] + r[1] * db[1] + r[2] * db[2];
+  double const den = 1.0 - c * c;
+  Reference_t ref;
+  ref.offsetA = (rA - c * rB) / den;
+  ref.offsetB = (c * rA - rB) / den;
+  ref.point[0] = a.center.x + ref.offsetA * da[0];
+  ref.point[1] = a.center.y + ref.offsetA * da[1];
+  ref.point[2] = a.center.z + ref.offsetA * da[2];
+  return ref;
+}
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(EmptyTestCase)
+{
+  geo::details::WireIntersectionTables tables;
+  BOOST_TEST(tables.nPlanes() == 0U);
+  BOOST_TEST(!tables.hasPlanePair(0, 1));
+
+  tables.build(makePlanes());
+  BOOST_TEST(tables.nPlanes() == 3U);
+  tables.clear();
+  BOOST_TEST(tables.nPlanes() == 0U);
+  BOOST_TEST(!tables.hasPlanePair(0, 1));
+}
+
+BOOST_AUTO_TEST_CASE(CrossingTestCase)
+{
+  std::vector<TestPlane> const planes = makePlanes();
+  geo::details::WireIntersectionTables tables;
+  tables.build(planes);
+
+  for (std::size_t a = 0; a < planes.size(); ++a) {
+    BOOST_TEST(!tables.hasPlanePair(a, a));
+    for (std::size_t b = 0; b < planes.size(); ++b) {
+      if (a == b) continue;
+      BOOST_TEST_REQUIRE(tables.hasPlanePair(a, b));
+      unsigned int const nA = planes[a].Nwires(), nB = planes[b].Nwires();
+
+      for (unsigned int j = 0; j < nB; ++j) {
+        TestWire const& wireB = planes[b].Wire(j);
+        unsigned int nWithin = 0U;
+        auto const [first, last] = tables.crossingWires(a, b, j);
+        for (unsigned int i = 0; i < nA; ++i) {
+          TestWire const& wireA = planes[a].Wire(i);
+          Reference_t const ref = referenceCrossing(wireA, wireB);
+          auto const crossing = tables.crossing(a, i, b, j);
+          for (std::size_t k = 0; k < 3U; ++k)
+            BOOST_TEST(std::abs(crossing.point[k] - ref.point[k]) < 1e-9);
+          BOOST_TEST(std::abs(crossing.offsetA - ref.offsetA) < 1e-9);
+          BOOST_TEST(std::abs(crossing.offsetB - ref.offsetB) < 1e-9);
+          bool const expectedWithin =
+            (std::abs(ref.offsetA) <= wireA.halfL) && (std::abs(ref.offsetB) <= wireB.halfL);
+          BOOST_TEST(crossing.within == expectedWithin);
+
+          // the crossing wires are all and only the ones in the range
+          BOOST_TEST(crossing.within == ((i >= first) && (i < last)));
+          if (crossing.within) ++nWithin;
+        } // for i
+        BOOST_TEST(nWithin == last - first);
+      } // for j
+    }   // for b
+  }     // for a
+
+  // the wire geometry is also reconstructed
+  for (std::size_t a = 0; a < planes.size(); ++a) {
+    for (unsigned int i = 0; i < planes[a].Nwires(); i += 17) {
+      TestWire const& wire = planes[a].Wire(i);
+      auto const center = tables.wireCenter(a, i);
+      BOOST_TEST(std::abs(center[1] - wire.center.y) < 1e-9);
+      BOOST_TEST(std::abs(center[2] - wire.center.z) < 1e-9);
+      BOOST_TEST(tables.wireHalfLength(a, i) == wire.halfL);
+      BOOST_TEST(tables.wireDirection(a)[2] == wire.dir.z);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(NonUniformTestCase)
+{
+  std::vector<TestPlane> planes = makePlanes();
+
+  // a plane parallel to the first one
+  planes.push_back(planes[0]);
+  for (TestWire& wire : planes.back().wires)
+    wire.center.x = 0.9;
+
+  // a misplaced wire in the second plane
+  planes[1].wires[10].center.z += 0.01;
+
+  geo::details::WireIntersectionTables tables;
+  tables.build(planes);
+  BOOST_TEST(tables.hasPlanePair(0, 2));
+  BOOST_TEST(tables.hasPlanePair(2, 3));
+  BOOST_TEST(!tables.hasPlanePair(0, 3));
+  BOOST_TEST(!tables.hasPlanePair(3, 0));
+  BOOST_TEST(!tables.hasPlanePair(0, 1));
+  BOOST_TEST(!tables.hasPlanePair(2, 1));
+  BOOST_TEST(!tables.hasPlanePair(1, 4));
+}
+
+//------------------------------------------------------------------------------
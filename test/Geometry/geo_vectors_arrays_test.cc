@@ -0,0 +1,196 @@
+/**
+ * @file   geo_vectors_arrays_test.cc
+ * @brief  Unit test for `larcorealg/Geometry/geo_vectors_arrays.h`.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/geo_vectors_arrays.h`
+ *
+ * The bulk operations are checked on a collection of points stored in columns
+ * and on a view of a vector of points, against the single point results.
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE (geo vectors arrays test)
+#include <boost/test/unit_test.hpp>
+
+// LArSoft libraries
+#include "larcorealg/Geometry/geo_vectors_arrays.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::min(), std::max()
+#include <cmath>
+#include <cstddef>
+#include <cstdint> // std::uintptr_t
+#include <utility> // std::as_const()
+#include <vector>
+
+//------------------------------------------------------------------------------
+std::vector<geo::Point_t> makePoints()
+{
+  std::vector<geo::Point_t> points;
+  for (int i = 0; i < 21; ++i)
+    points.emplace_back(0.5 * i - 4.0, 2.0 - 0.25 * i, std::sin(0.3 * i));
+  return points;
+}
+
+/// Checks all bulk operations on `coords`, which holds the same as `points`.
+template <typename Coords>
+void checkBulk(Coords const& coords, std::vector<geo::Point_t> const& points)
+{
+  std::size_t const N = points.size();
+  BOOST_TEST(coords.size() == N);
+
+  // absolute tolerance, against a different contraction of the expressions
+  auto const close = [](double a, double b) { return std::abs(a - b) < 1e-12; };
+
+  geo::Vector_t const axis{0.0, 0.6, 0.8};
+  std::vector<double> dots(N), mag2s(N), norms(N);
+  geo::vect::bulk::dot(coords, axis, dots.data());
+  geo::vect::bulk::mag2(coords, mag2s.data());
+  geo::vect::bulk::norm(coords, norms.data());
+
+  // rotation by 90 degrees around z, then translation by (1, 2, 3)
+  struct {
+    void GetComponents(double* c) const
+    {
+      double const m[12] = {0.0, -1.0, 0.0, 1.0, 1.0, 0.0, 0.0, 2.0, 0.0, 0.0, 1.0, 3.0};
+      for (int i = 0; i < 12; ++i)
+        c[i] = m[i];
+    }
+  } const trans;
+  geo::vect::PointArraySoA transformed;
+  geo::vect::bulk::transform(coords, trans, transformed);
+  BOOST_TEST(transformed.size() == N);
+
+  geo::Point_t lower{1e9, 1e9, 1e9}, upper{-1e9, -1e9, -1e9};
+  for (std::size_t i = 0; i < N; ++i) {
+    BOOST_TEST_CONTEXT("point #" << i)
+    {
+      geo::Point_t const& p = points[i];
+      BOOST_TEST(coords[i].X() == p.X());
+      BOOST_TEST(coords[i].Y() == p.Y());
+      BOOST_TEST(coords[i].Z() == p.Z());
+      BOOST_TEST(close(dots[i], p.X() * axis.X() + p.Y() * axis.Y() + p.Z() * axis.Z()));
+      double const m2 = p.X() * p.X() + p.Y() * p.Y() + p.Z() * p.Z();
+      BOOST_TEST(close(mag2s[i], m2));
+      BOOST_TEST(close(norms[i], std::sqrt(m2)));
+      BOOST_TEST(transformed[i].X() == 1.0 - p.Y());
+      BOOST_TEST(transformed[i].Y() == 2.0 + p.X());
+      BOOST_TEST(transformed[i].Z() == 3.0 + p.Z());
+    }
+    geo::Point_t const& p = points[i];
+    lower = {std::min(lower.X(), p.X()), std::min(lower.Y(), p.Y()), std::min(lower.Z(), p.Z())};
+    upper = {std::max(upper.X(), p.X()), std::max(upper.Y(), p.Y()), std::max(upper.Z(), p.Z())};
+  } // for
+
+  auto const [boxLower, boxUpper] = geo::vect::bulk::boundingBox(coords);
+  BOOST_TEST(boxLower.X() == lower.X());
+  BOOST_TEST(boxLower.Y() == lower.Y());
+  BOOST_TEST(boxLower.Z() == lower.Z());
+  BOOST_TEST(boxUpper.X() == upper.X());
+  BOOST_TEST(boxUpper.Y() == upper.Y());
+  BOOST_TEST(boxUpper.Z() == upper.Z());
+} // checkBulk()
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(SoATestCase)
+{
+  auto const points = makePoints();
+  geo::vect::PointArraySoA coords{points};
+  auto const alignment = [](double const* p) {
+    return reinterpret_cast<std::uintptr_t>(p) % geo::vect::CoordArrayAlignment;
+  };
+  BOOST_TEST(alignment(coords.xs()) == 0U);
+  BOOST_TEST(alignment(coords.ys()) == 0U);
+  BOOST_TEST(alignment(coords.zs()) == 0U);
+  checkBulk(coords, points);
+
+  auto const back = coords.toVector();
+  BOOST_TEST(back.size() == points.size());
+  BOOST_TEST(back.back().Z() == points.back().Z());
+
+  geo::vect::bulk::translate(coords, geo::Vector_t{1.0, -1.0, 0.5});
+  BOOST_TEST(coords[3].X() == points[3].X() + 1.0);
+  BOOST_TEST(coords[3].Y() == points[3].Y() - 1.0);
+  BOOST_TEST(coords[3].Z() == points[3].Z() + 0.5);
+
+  coords.set(2, geo::Point_t{7.0, 8.0, 9.0});
+  BOOST_TEST(coords[2].Y() == 8.0);
+  coords.clear();
+  BOOST_TEST(coords.empty());
+
+  auto const [lower, upper] = geo::vect::bulk::boundingBox(coords);
+  BOOST_TEST(lower.X() > upper.X()); // empty box
+} // BOOST_AUTO_TEST_CASE(SoATestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(ViewTestCase)
+{
+  auto points = makePoints();
+  checkBulk(geo::vect::makeCoordView(std::as_const(points)), points);
+
+  auto const original = points;
+  geo::vect::bulk::translate(geo::vect::makeCoordView(points), geo::Vector_t{1.0, -1.0, 0.5});
+  BOOST_TEST(points[5].X() == original[5].X() + 1.0);
+  BOOST_TEST(points[5].Y() == original[5].Y() - 1.0);
+  BOOST_TEST(points[5].Z() == original[5].Z() + 0.5);
+} // BOOST_AUTO_TEST_CASE(ViewTestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(PrincipalAxesTestCase)
+{
+  // points along (0.6, 0.8, 0) far from the origin, on the corners of a
+  // rectangle with a smaller side along z and a tiny one along the third axis
+  geo::Point_t const start{1000.0, -2000.0, 5000.0};
+  geo::Vector_t const dir{0.6, 0.8, 0.0}, side{-0.8, 0.6, 0.0};
+  std::vector<geo::Point_t> points;
+  std::vector<double> weights;
+  for (int i = 0; i < 101; ++i) {
+    for (double const dz : {-0.1, 0.1}) {
+      for (double const ds : {-0.01, 0.01}) {
+        points.push_back(start + (0.1 * i) * dir + geo::Vector_t{0.0, 0.0, dz} + ds * side);
+        weights.push_back((i < 50) ? 1.0 : 3.0);
+      }
+    }
+  }
+
+  auto const pa = geo::vect::bulk::principalAxes(geo::vect::makeCoordView(points));
+  BOOST_TEST(!pa.empty());
+  BOOST_TEST(pa.weight == 404.0);
+  BOOST_TEST(pa.center.X() == (start + 5.0 * dir).X(), boost::test_tools::tolerance(1e-9));
+  BOOST_TEST(pa.center.Y() == (start + 5.0 * dir).Y(), boost::test_tools::tolerance(1e-9));
+  BOOST_TEST(std::abs(pa.axes[0].Dot(dir)) == 1.0, boost::test_tools::tolerance(1e-9));
+  BOOST_TEST(std::abs(pa.axes[1].Z()) == 1.0, boost::test_tools::tolerance(1e-9));
+  BOOST_TEST(std::abs(pa.axes[2].Dot(side)) == 1.0, boost::test_tools::tolerance(1e-9));
+  BOOST_TEST(pa.axes[0].Cross(pa.axes[1]).Dot(pa.axes[2]) == 1.0,
+             boost::test_tools::tolerance(1e-12)); // right-handed
+  BOOST_TEST(pa.variances[0] == 10.0 * 10.2 / 12.0, boost::test_tools::tolerance(1e-9));
+  BOOST_TEST(pa.variances[1] == 0.01, boost::test_tools::tolerance(1e-9));
+  BOOST_TEST(pa.variances[2] == 1e-4, boost::test_tools::tolerance(1e-6));
+
+  // the same from columns, and weighted
+  geo::vect::PointArraySoA const coords{points};
+  auto const paSoA = geo::vect::bulk::principalAxes(coords);
+  BOOST_TEST(paSoA.variances[0] == pa.variances[0], boost::test_tools::tolerance(1e-12));
+  auto const weighted = geo::vect::bulk::principalAxes(coords, weights.data());
+  BOOST_TEST(weighted.weight == 4.0 * (50.0 + 3.0 * 51.0));
+  BOOST_TEST(weighted.center.X() > pa.center.X()); // pulled toward the heavier end
+  BOOST_TEST(std::abs(weighted.axes[0].Dot(dir)) == 1.0, boost::test_tools::tolerance(1e-9));
+
+  // batch on three clusters, one empty
+  std::vector<std::size_t> const offsets{0U, 200U, 200U, points.size()};
+  auto const clusters = geo::vect::bulk::principalAxes(coords, offsets, weights.data());
+  BOOST_TEST_REQUIRE(clusters.size() == 3U);
+  BOOST_TEST(clusters[0].weight == 200.0);
+  BOOST_TEST(clusters[1].empty());
+  auto const last = geo::vect::bulk::principalAxes(coords, 200U, points.size(), weights.data());
+  BOOST_TEST(clusters[2].center.X() == last.center.X());
+  BOOST_TEST(clusters[2].variances[0] == last.variances[0]);
+
+  // degenerate sets
+  BOOST_TEST(geo::vect::bulk::principalAxes(geo::vect::PointArraySoA{}).empty());
+  std::vector<geo::Point_t> const single{start};
+  auto const one = geo::vect::bulk::principalAxes(geo::vect::makeCoordView(single));
+  BOOST_TEST(one.weight == 1.0);
+  BOOST_TEST(one.variances[0] == 0.0);
+  BOOST_TEST(one.center.Z() == start.Z());
+} // BOOST_AUTO_TEST_CASE(PrincipalAxesTestCase)
@@ -0,0 +1,333 @@
+/**
+ * @file   geoiddatacontainers_benchmark.cxx
+ * @brief  Timing of the geometry and readout ID data containers and mappers.
+ * @see    `larcorealg/TestUtils/Benchmark.h`,
+ *         `larcorealg/Geometry/GeometryDataContainers.h`,
+ *         `larcorealg/Geometry/ReadoutDataContainers.h`,
+ *         `larcorealg/Geometry/GeometryIDmapper.h`
+ *
+ * Usage:
+ *
+ *     geoiddatacontainers_benchmark [options]
+ *
+ * The containers are sized as a large far detector (four cryostats of 150
+ * TPCs with three planes each, and 400 thousand channels), and the time of
+ * element access by ID, flat iteration, ID/index conversion and whole
+ * container fill and reset is printed. Each operation is also timed on a
+ * plain `std::vector` with precomputed indices (the entries with `std::vector`
+ * in their name), so that the overhead of the ID abstraction is the ratio
+ * between the two. Accesses are on random IDs (with a fixed seed); iterations
+ * and fills are reported per element.
+ * The options (`--json=FILE`, `--csv=FILE`, `--baseline=FILE`,
+ * `--tolerance=FRACTION`, `--warn-only`) are described in
+ * `testing::BenchmarkOptions_t`: the results can be written into files and
+ * compared with a baseline, in which case regressions make the program fail.
+ */
+
+// LArSoft libraries
+#include "larcorealg/Geometry/GeometryDataContainers.h"
+#include "larcorealg/Geometry/GeometryIDmapper.h"
+#include "larcorealg/Geometry/ReadoutDataContainers.h"
+#include "larcorealg/Geometry/ReadoutIDmapper.h"
+#include "larcorealg/TestUtils/Benchmark.h"
+#include "larcoreobj/SimpleTypesAndConstants/RawTypes.h" // raw::ChannelID_t
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+#include "larcoreobj/SimpleTypesAndConstants/readout_types.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::fill()
+#include <cstddef>   // std::size_t
+#include <iostream>
+#include <random>
+#include <vector>
+
+//------------------------------------------------------------------------------
+namespace {
+
+  /// Number of random IDs of each type; queries cycle through them.
+  constexpr std::size_t NInputs = 4096U;
+
+  constexpr unsigned int NCryostats = 4U;
+  constexpr unsigned int NTPCs = 150U;
+  constexpr unsigned int NPlanes = 3U;
+  constexpr unsigned int NTPCsets = 75U;
+  constexpr unsigned int NROPs = 4U;
+  constexpr std::size_t NChannels = 400'000U;
+
+  /// Returns a cycling accessor to the elements of `inputs`.
+  template <typename T>
+  auto cycle(std::vector<T> const& inputs)
+  {
+    return [&inputs, i = std::size_t{0}]() mutable -> T const& {
+      if (i == inputs.size()) i = 0U;
+      return inputs[i++];
+    };
+  }
+
+} // local namespace
+
+//------------------------------------------------------------------------------
+int main(int argc, char const** argv)
+{
+  testing::BenchmarkOptions_t options;
+  for (int iArg = 1; iArg < argc; ++iArg) {
+    if (!options.parse(argv[iArg])) {
+      std::cerr << "Unsupported argument: '" << argv[iArg] << "'" << std::endl;
+      return 1;
+    }
+  }
+
+  //
+  // input generation
+  //
+  geo::PlaneIDmapper<> const planeMapper{NCryostats, NTPCs, NPlanes};
+  geo::StaticPlaneIDmapper<NCryostats, NTPCs, NPlanes> const staticPlaneMapper;
+  // every other TPC has no planes, as in a detector with dummy TPCs
+  geo::CompressedPlaneIDmapper<> const compressedPlaneMapper{
+    {NCryostats, NTPCs}, [](geo::TPCID const& tpcid) { return (tpcid.TPC % 2U) ? 0U : NPlanes; }};
+  readout::ROPIDmapper<> const ROPmapper{NCryostats, NTPCsets, NROPs};
+
+  std::mt19937 engine{12345U};
+  std::uniform_int_distribution<std::size_t> planeIndex{0U, planeMapper.size() - 1U};
+  std::uniform_int_distribution<std::size_t> compressedIndex{0U,
+                                                             compressedPlaneMapper.size() - 1U};
+  std::uniform_int_distribution<std::size_t> ROPindex{0U, ROPmapper.size() - 1U};
+  std::uniform_int_distribution<raw::ChannelID_t> channelNo{0U, NChannels - 1U};
+
+  std::vector<std::size_t> planeIndices, compressedIndices, ROPindices;
+  std::vector<geo::PlaneID> planeIDs, compressedIDs;
+  std::vector<readout::ROPID> ROPIDs;
+  std::vector<raw::ChannelID_t> channels;
+  for (std::size_t i = 0; i < NInputs; ++i) {
+    planeIndices.push_back(planeIndex(engine));
+    planeIDs.push_back(planeMapper.ID(planeIndices.back()));
+    compressedIndices.push_back(compressedIndex(engine));
+    compressedIDs.push_back(compressedPlaneMapper.ID(compressedIndices.back()));
+    ROPindices.push_back(ROPindex(engine));
+    ROPIDs.push_back(ROPmapper.ID(ROPindices.back()));
+    channels.push_back(channelNo(engine));
+  }
+
+  std::vector<double> planeVector(planeMapper.size(), 1.0);
+  geo::PlaneDataContainer<double> planeData{NCryostats, NTPCs, NPlanes, 1.0};
+  geo::StaticPlaneDataContainer<double, NCryostats, NTPCs, NPlanes> staticPlaneData;
+  staticPlaneData.fill(1.0);
+  geo::CompressedPlaneDataContainer<double> compressedPlaneData{compressedPlaneMapper, 1.0};
+  std::vector<double> ROPvector(ROPmapper.size(), 1.0);
+  readout::ROPDataContainer<double> ROPdata{NCryostats, NTPCsets, NROPs, 1.0};
+  std::vector<float> channelVector(NChannels, 1.0f);
+  readout::ChannelDataContainer<float> channelData{NChannels, 1.0f};
+
+  testing::Benchmark<> bench;
+
+  //
+  // element access by ID
+  //
+  bench.run("std::vector[index] (planes)",
+            [&planeVector, next = cycle(planeIndices)]() mutable {
+              testing::doNotOptimize(planeVector[next()]);
+            });
+
+  bench.run("PlaneDataContainer[PlaneID]", [&planeData, next = cycle(planeIDs)]() mutable {
+    testing::doNotOptimize(planeData[next()]);
+  });
+
+  bench.run("PlaneDataContainer::at(PlaneID)", [&planeData, next = cycle(planeIDs)]() mutable {
+    testing::doNotOptimize(planeData.at(next()));
+  });
+
+  bench.run("StaticPlaneDataContainer[PlaneID]",
+            [&staticPlaneData, next = cycle(planeIDs)]() mutable {
+              testing::doNotOptimize(staticPlaneData[next()]);
+            });
+
+  bench.run("CompressedPlaneDataContainer[PlaneID]",
+            [&compressedPlaneData, next = cycle(compressedIDs)]() mutable {
+              testing::doNotOptimize(compressedPlaneData[next()]);
+            });
+
+  bench.run("std::vector[index] (ROPs)", [&ROPvector, next = cycle(ROPindices)]() mutable {
+    testing::doNotOptimize(ROPvector[next()]);
+  });
+
+  bench.run("ROPDataContainer[ROPID]", [&ROPdata, next = cycle(ROPIDs)]() mutable {
+    testing::doNotOptimize(ROPdata[next()]);
+  });
+
+  bench.run("std::vector[index] (channels)",
+            [&channelVector, next = cycle(channels)]() mutable {
+              testing::doNotOptimize(channelVector[next()]);
+            });
+
+  bench.run("ChannelDataContainer[channel]", [&channelData, next = cycle(channels)]() mutable {
+    testing::doNotOptimize(channelData[next()]);
+  });
+
+  //
+  // flat iteration
+  //
+  bench.run(
+    "std::vector iteration (planes)",
+    [&planeVector]() {
+      double sum = 0.0;
+      for (double const value : planeVector)
+        sum += value;
+      testing::doNotOptimize(sum);
+    },
+    planeVector.size());
+
+  bench.run(
+    "PlaneDataContainer iteration",
+    [&planeData]() {
+      double sum = 0.0;
+      for (double const value : planeData)
+        sum += value;
+      testing::doNotOptimize(sum);
+    },
+    planeData.size());
+
+  bench.run(
+    "PlaneDataContainer::items() iteration",
+    [&planeData]() {
+      double sum = 0.0;
+      for (auto&& [planeID, value] : planeData.items())
+        sum += value * planeID.Plane;
+      testing::doNotOptimize(sum);
+    },
+    planeData.size());
+
+  bench.run(
+    "CompressedPlaneDataContainer iteration",
+    [&compressedPlaneData]() {
+      double sum = 0.0;
+      for (double const value : compressedPlaneData)
+        sum += value;
+      testing::doNotOptimize(sum);
+    },
+    compressedPlaneData.size());
+
+  bench.run(
+    "std::vector iteration (channels)",
+    [&channelVector]() {
+      float sum = 0.0f;
+      for (float const value : channelVector)
+        sum += value;
+      testing::doNotOptimize(sum);
+    },
+    channelVector.size());
+
+  bench.run(
+    "ChannelDataContainer iteration",
+    [&channelData]() {
+      float sum = 0.0f;
+      for (float const value : channelData)
+        sum += value;
+      testing::doNotOptimize(sum);
+    },
+    channelData.size());
+
+  //
+  // ID and index conversion
+  //
+  bench.run("index arithmetic (PlaneID)", [next = cycle(planeIDs)]() mutable {
+    geo::PlaneID const& id = next();
+    testing::doNotOptimize((std::size_t{id.Cryostat} * NTPCs + id.TPC) * NPlanes + id.Plane);
+  });
+
+  bench.run("PlaneIDmapper::index()", [&planeMapper, next = cycle(planeIDs)]() mutable {
+    testing::doNotOptimize(planeMapper.index(next()));
+  });
+
+  bench.run("PlaneIDmapper::ID()", [&planeMapper, next = cycle(planeIndices)]() mutable {
+    testing::doNotOptimize(planeMapper.ID(next()));
+  });
+
+  bench.run("StaticPlaneIDmapper::index()",
+            [&staticPlaneMapper, next = cycle(planeIDs)]() mutable {
+              testing::doNotOptimize(staticPlaneMapper.index(next()));
+            });
+
+  bench.run("StaticPlaneIDmapper::ID()",
+            [&staticPlaneMapper, next = cycle(planeIndices)]() mutable {
+              testing::doNotOptimize(staticPlaneMapper.ID(next()));
+            });
+
+  bench.run("CompressedPlaneIDmapper::index()",
+            [&compressedPlaneMapper, next = cycle(compressedIDs)]() mutable {
+              testing::doNotOptimize(compressedPlaneMapper.index(next()));
+            });
+
+  bench.run("CompressedPlaneIDmapper::ID()",
+            [&compressedPlaneMapper, next = cycle(compressedIndices)]() mutable {
+              testing::doNotOptimize(compressedPlaneMapper.ID(next()));
+            });
+
+  bench.run("ROPIDmapper::index()", [&ROPmapper, next = cycle(ROPIDs)]() mutable {
+    testing::doNotOptimize(ROPmapper.index(next()));
+  });
+
+  bench.run("ROPIDmapper::ID()", [&ROPmapper, next = cycle(ROPindices)]() mutable {
+    testing::doNotOptimize(ROPmapper.ID(next()));
+  });
+
+  //
+  // whole container fill and reset
+  //
+  bench.run(
+    "std::fill (planes)",
+    [&planeVector]() {
+      std::fill(planeVector.begin(), planeVector.end(), 2.0);
+      testing::doNotOptimize(planeVector.data());
+    },
+    planeVector.size());
+
+  bench.run(
+    "PlaneDataContainer::fill()",
+    [&planeData]() {
+      planeData.fill(2.0);
+      testing::clobberMemory();
+    },
+    planeData.size());
+
+  bench.run(
+    "PlaneDataContainer::reset()",
+    [&planeData]() {
+      planeData.reset();
+      testing::clobberMemory();
+    },
+    planeData.size());
+
+  bench.run(
+    "std::fill (channels)",
+    [&channelVector]() {
+      std::fill(channelVector.begin(), channelVector.end(), 2.0f);
+      testing::doNotOptimize(channelVector.data());
+    },
+    channelVector.size());
+
+  bench.run(
+    "ChannelDataContainer::fill()",
+    [&channelData]() {
+      channelData.fill(2.0f);
+      testing::doNotOptimize(channelData.data());
+    },
+    channelData.size());
+
+  bench.run(
+    "ChannelDataContainer::reset()",
+    [&channelData]() {
+      channelData.reset();
+      testing::doNotOptimize(channelData.data());
+    },
+    channelData.size());
+
+  //
+  // report
+  //
+  std::cout << "Time per operation [ns]:\n";
+  unsigned int const nRegressions = bench.report(options, std::cout);
+  if (nRegressions > 0)
+    std::cerr << nRegressions << " performance regressions detected!" << std::endl;
+
+  return nRegressions;
+} // main()
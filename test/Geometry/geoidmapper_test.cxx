@@ -15,6 +15,10 @@
 #include "larcorealg/Geometry/GeometryIDmapper.h"
 #include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
 
+// C/C++ standard libraries
+#include <cstdint> // std::uint32_t, std::uint64_t
+#include <limits>
+
 //------------------------------------------------------------------------------
 void TPCIDmappingTest(geo::TPCIDmapper<> mapper, // copy here is intentional
                       std::size_t const NCryostats,
@@ -337,6 +341,198 @@ BOOST_AUTO_TEST_CASE(PlaneIDmappingTestCase)
 
 } // PlaneIDmappingTestCase
 
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(FastDividerTestCase)
+{
+
+  constexpr std::uint32_t MaxU32 = std::numeric_limits<std::uint32_t>::max();
+
+  std::uint32_t const divisors[] = {
+    1U, 2U, 3U, 7U, 10U, 480U, 641U, 65535U, 65536U, MaxU32 - 1U, MaxU32};
+  for (std::uint32_t const d : divisors) {
+    geo::details::FastDivider const divider{d};
+    BOOST_TEST(divider.divisor() == d);
+
+    std::uint64_t const special[] = {0U,
+                                     d - 1U,
+                                     d,
+                                     d + 1U,
+                                     MaxU32 - 1U,
+                                     MaxU32,
+                                     std::uint64_t{MaxU32} + 1U,
+                                     std::uint64_t{1} << 40U};
+    for (std::uint64_t const n : special) {
+      BOOST_TEST_CONTEXT("dividing " << n << " by " << d)
+      {
+        BOOST_TEST(divider.quotient(n) == n / d);
+        BOOST_TEST(divider.remainder(n) == n % d);
+      }
+    }
+
+    // a sample of dividends up to 32 bit
+    std::uint32_t n = 1U;
+    for (int i = 0; i < 20000; ++i) {
+      n = n * 1664525U + 1013904223U;
+      if (divider.quotient(n) != n / d) BOOST_ERROR("dividing " << n << " by " << d);
+      if (divider.remainder(n) != n % d) BOOST_ERROR("remainder of " << n << " by " << d);
+    }
+  } // for divisors
+
+  // all indices of a mapping with sizes which are not powers of 2
+  geo::PlaneIDmapper<> const mapper(3U, 7U, 5U);
+  for (std::size_t index = 0; index < mapper.size(); ++index)
+    BOOST_TEST(mapper.index(mapper.ID(index)) == index);
+
+} // FastDividerTestCase
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(StaticIDmappingTestCase)
+{
+
+  using StaticMapper_t = geo::StaticPlaneIDmapper<2U, 3U, 4U>;
+  static_assert(StaticMapper_t::size() == 24U);
+  static_assert(StaticMapper_t::dimensions() == 3U);
+  static_assert(StaticMapper_t::dimSize<1U>() == 3U);
+  static_assert(!StaticMapper_t::empty());
+
+  StaticMapper_t const mapper;
+  geo::PlaneIDmapper<> const dynMapper(2U, 3U, 4U);
+
+  BOOST_TEST(mapper.firstID() == dynMapper.firstID());
+  BOOST_TEST(mapper.lastID() == dynMapper.lastID());
+  for (std::size_t index = 0; index < mapper.size(); ++index) {
+    geo::PlaneID const id = mapper.ID(index);
+    BOOST_TEST(id == dynMapper.ID(index));
+    BOOST_TEST(mapper(id) == index);
+    BOOST_TEST(mapper.hasElement(id));
+  }
+
+  BOOST_TEST(mapper.hasElement(geo::CryostatID{1U}));
+  BOOST_TEST(!mapper.hasElement(geo::CryostatID{2U}));
+  BOOST_TEST(mapper.hasElement(geo::TPCID{1U, 2U}));
+  BOOST_TEST(!mapper.hasElement(geo::TPCID{1U, 3U}));
+  BOOST_TEST(!mapper.hasElement(geo::PlaneID{1U, 2U, 4U}));
+
+  geo::StaticTPCIDmapper<2U, 3U> const tpcMapper;
+  BOOST_TEST(tpcMapper.size() == 6U);
+  BOOST_TEST(tpcMapper.ID(5U) == (geo::TPCID{1U, 2U}));
+
+} // StaticIDmappingTestCase
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(CompressedIDmappingTestCase)
+{
+
+  // 2 cryostats with 3 TPCs each; TPC C:1 T:1 is missing, TPC C:0 T:2 has 2 planes
+  auto const nPlanes = [](geo::TPCID const& tpcid) -> unsigned int {
+    if ((tpcid.Cryostat == 1U) && (tpcid.TPC == 1U)) return 0U;
+    return ((tpcid.Cryostat == 0U) && (tpcid.TPC == 2U)) ? 2U : 3U;
+  };
+  geo::CompressedPlaneIDmapper<> const mapper{{2U, 3U}, nPlanes};
+
+  BOOST_TEST(mapper.size() == 3U + 3U + 2U + 3U + 0U + 3U);
+  BOOST_TEST(!mapper.empty());
+  BOOST_TEST(mapper.dimensions() == 3U);
+  BOOST_TEST(mapper.dimSize<0U>() == 2U);
+  BOOST_TEST(mapper.dimSize<1U>() == 3U);
+  BOOST_TEST(mapper.dimSize<2U>() == 3U);
+  BOOST_TEST(mapper.count(geo::TPCID{0U, 2U}) == 2U);
+  BOOST_TEST(mapper.count(geo::TPCID{1U, 1U}) == 0U);
+
+  BOOST_TEST(mapper.firstID() == (geo::PlaneID{0U, 0U, 0U}));
+  BOOST_TEST(mapper.lastID() == (geo::PlaneID{1U, 2U, 2U}));
+  BOOST_TEST(mapper.index({0U, 2U, 1U}) == 7U);
+  BOOST_TEST(mapper.index({1U, 2U, 0U}) == 11U);
+
+  // all the existing planes, in order
+  std::size_t expectedIndex = 0U;
+  for (unsigned int c = 0U; c < 2U; ++c) {
+    for (unsigned int t = 0U; t < 3U; ++t) {
+      geo::TPCID const tpcid{c, t};
+      BOOST_TEST(mapper.hasElement(tpcid) == (nPlanes(tpcid) > 0U));
+      for (unsigned int p = 0U; p < 3U; ++p) {
+        geo::PlaneID const planeid{tpcid, p};
+        BOOST_TEST_CONTEXT("plane " << planeid)
+        {
+          bool const exists = p < nPlanes(tpcid);
+          BOOST_TEST(mapper.hasElement(planeid) == exists);
+          if (!exists) continue;
+          BOOST_TEST(mapper(planeid) == expectedIndex);
+          BOOST_TEST(mapper(expectedIndex) == planeid);
+          ++expectedIndex;
+        }
+      } // for planes
+    }   // for TPCs
+  }     // for cryostats
+  BOOST_TEST(expectedIndex == mapper.size());
+
+  BOOST_TEST(mapper.hasElement(geo::CryostatID{1U}));
+  BOOST_TEST(!mapper.hasElement(geo::CryostatID{2U}));
+  BOOST_TEST(!mapper.hasElement(geo::TPCID{0U, 3U}));
+
+  geo::CompressedPlaneIDmapper<> emptyMapper = mapper;
+  emptyMapper.clear();
+  BOOST_TEST(emptyMapper.empty());
+  BOOST_TEST(!emptyMapper.hasElement(geo::PlaneID{0U, 0U, 0U}));
+
+} // CompressedIDmappingTestCase
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(FlatIDrangeTestCase)
+{
+
+  // 2 cryostats with 3 TPCs each; TPC C:1 T:1 is missing, TPC C:0 T:2 has 2 planes
+  auto const nPlanes = [](geo::TPCID const& tpcid) -> unsigned int {
+    if ((tpcid.Cryostat == 1U) && (tpcid.TPC == 1U)) return 0U;
+    return ((tpcid.Cryostat == 0U) && (tpcid.TPC == 2U)) ? 2U : 3U;
+  };
+  geo::CompressedPlaneIDmapper<> const mapper{{2U, 3U}, nPlanes};
+
+  geo::FlatGeoIDrange const planes{mapper};
+  BOOST_TEST(planes.size() == mapper.size());
+  BOOST_TEST(!planes.empty());
+
+  // forward iteration visits all the IDs in order, skipping the missing TPC
+  std::size_t index = 0U;
+  for (geo::PlaneID const& planeid : planes) {
+    BOOST_TEST_CONTEXT("index " << index)
+    {
+      BOOST_TEST(planeid == mapper.ID(index));
+      BOOST_TEST(planes[index] == planeid);
+    }
+    ++index;
+  } // for
+  BOOST_TEST(index == mapper.size());
+
+  // random access and backward iteration
+  auto it = planes.end();
+  BOOST_TEST(!it->isValid);
+  BOOST_TEST((it - planes.begin()) == static_cast<std::ptrdiff_t>(mapper.size()));
+  --it;
+  BOOST_TEST(*it == (geo::PlaneID{1U, 2U, 2U}));
+  it -= 3;
+  BOOST_TEST(*it == (geo::PlaneID{1U, 0U, 2U}));
+  --it;
+  BOOST_TEST(*it == (geo::PlaneID{1U, 0U, 1U}));
+  BOOST_TEST(planes.begin()[7] == (geo::PlaneID{0U, 2U, 1U}));
+  BOOST_TEST((planes.begin() + 8).index() == 8U);
+  BOOST_TEST((planes.begin() < it));
+
+  // split in two parts
+  auto const firstHalf = planes.subrange(0U, 5U);
+  auto const secondHalf = planes.subrange(5U, planes.size() + 1U);
+  BOOST_TEST(firstHalf.size() == 5U);
+  BOOST_TEST(secondHalf.size() == planes.size() - 5U);
+  BOOST_TEST(*secondHalf.begin() == (geo::PlaneID{0U, 1U, 2U}));
+  BOOST_TEST((firstHalf.end() == secondHalf.begin()));
+
+  geo::CompressedPlaneIDmapper<> const emptyMapper;
+  geo::FlatGeoIDrange const noPlanes{emptyMapper};
+  BOOST_TEST(noPlanes.empty());
+  BOOST_TEST((noPlanes.begin() == noPlanes.end()));
+
+} // FlatIDrangeTestCase
+
 //------------------------------------------------------------------------------
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,249 @@
+/**
+ * @file   geometry_alignment_test.cxx
+ * @brief  Test of the alignment updates of the geometry.
+ * @see    `geo::GeometryCore::ApplyAlignment()`
+ *
+ * Usage:
+ *
+ *     geometry_alignment_test configuration.fcl [GeometryParameterSet]
+ *
+ * The configuration file must contain a geometry service provider configuration
+ * under `services.Geometry` (or the path in the second argument), using the
+ * standard channel mapping.
+ *
+ * Two copies of the geometry are loaded; one of them is moved by
+ * `geo::GeometryCore::ApplyAlignment()`, and the positions and the wire
+ * coordinates of the moved volumes are compared with the ones of the nominal
+ * geometry. The fingerprints of the two geometries are also compared, before
+ * and after the alignment.
+ */
+
+// LArSoft libraries
+#include "larcorealg/Geometry/ChannelMapStandardAlg.h"
+#include "larcorealg/Geometry/GeometryAlignment.h"
+#include "larcorealg/Geometry/GeometryCore.h"
+#include "larcorealg/Geometry/PlaneGeo.h"
+#include "larcorealg/Geometry/StandaloneBasicSetup.h"    // SetupMessageFacility()...
+#include "larcorealg/Geometry/StandaloneGeometrySetup.h" // SetupGeometry()
+#include "larcorealg/Geometry/TPCGeo.h"
+#include "larcorealg/Geometry/WireGeo.h"
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+#include "larcoreobj/SimpleTypesAndConstants/geo_vectors.h"
+
+// utility libraries
+#include "cetlib_except/exception.h"
+#include "fhiclcpp/ParameterSet.h"
+#include "messagefacility/MessageLogger/MessageLogger.h"
+
+// C/C++ standard libraries
+#include <chrono>
+#include <cmath>     // std::abs()
+#include <cstdint>   // std::uint64_t
+#include <ios>       // std::hex, std::dec
+#include <stdexcept> // std::runtime_error
+#include <string>
+
+namespace {
+
+  /// Tolerance on positions [cm]
+  constexpr double Tolerance = 1e-6;
+
+  /// Tolerance on wire coordinates [wire pitch]; the standard channel mapping
+  /// stores its constants in single precision
+  constexpr double CoordinateTolerance = 1e-3;
+
+  /// Returns whether `a` and `b` are closer than `Tolerance`.
+  bool samePoint(geo::Point_t const& a, geo::Point_t const& b)
+  {
+    return (a - b).R() < Tolerance;
+  }
+
+  /// Compares the placement of `moved` plane with `nominal` moved by `shift`.
+  unsigned int checkMovedPlane(geo::PlaneGeo const& moved,
+                               geo::PlaneGeo const& nominal,
+                               geo::Vector_t const& shift,
+                               geo::GeometryCore const& movedGeom,
+                               geo::GeometryCore const& nominalGeom)
+  {
+    unsigned int nErrors = 0U;
+    std::string const planeName = std::string(moved.ID());
+
+    if (!samePoint(moved.GetCenter<geo::Point_t>(),
+                   nominal.GetCenter<geo::Point_t>() + shift)) {
+      mf::LogError("geometry_alignment_test") << planeName << ": center not moved as expected";
+      ++nErrors;
+    }
+    if (std::abs(moved.WirePitch() - nominal.WirePitch()) > Tolerance) {
+      mf::LogError("geometry_alignment_test") << planeName << ": wire pitch changed";
+      ++nErrors;
+    }
+    geo::PlaneGeo::Rect const& area = moved.ActiveArea();
+    geo::PlaneGeo::Rect const& nominalArea = nominal.ActiveArea();
+    if ((std::abs(area.width.lower - nominalArea.width.lower) > Tolerance) ||
+        (std::abs(area.depth.upper - nominalArea.depth.upper) > Tolerance)) {
+      mf::LogError("geometry_alignment_test") << planeName << ": active area changed";
+      ++nErrors;
+    }
+
+    // a few wires and their coordinates, in the moved and nominal frames
+    unsigned int const nWires = moved.Nwires();
+    for (unsigned int const wireNo : {0U, nWires / 3U, nWires / 2U, nWires - 1U}) {
+      geo::WireGeo const movedWire = moved.BuildWire(wireNo);
+      geo::WireGeo const nominalWire = nominal.BuildWire(wireNo);
+      geo::Point_t const nominalCenter = nominalWire.GetCenter<geo::Point_t>();
+      if (!samePoint(movedWire.GetCenter<geo::Point_t>(), nominalCenter + shift) ||
+          !samePoint(movedWire.GetStart<geo::Point_t>(),
+                     nominalWire.GetStart<geo::Point_t>() + shift) ||
+          (std::abs(movedWire.ThetaZ() - nominalWire.ThetaZ()) > Tolerance)) {
+        mf::LogError("geometry_alignment_test")
+          << planeName << ": wire " << wireNo << " not moved as expected";
+        ++nErrors;
+        continue;
+      }
+
+      double const movedCoord = movedGeom.WireCoordinate(nominalCenter + shift, moved.ID());
+      double const nominalCoord = nominalGeom.WireCoordinate(nominalCenter, nominal.ID());
+      if (std::abs(movedCoord - nominalCoord) > CoordinateTolerance) {
+        mf::LogError("geometry_alignment_test")
+          << planeName << ": wire coordinate of wire " << wireNo << " is " << movedCoord
+          << " after alignment, " << nominalCoord << " before";
+        ++nErrors;
+      }
+      geo::WireID const nearest = movedGeom.NearestWireID(nominalCenter + shift, moved.ID());
+      if (nearest.Wire != wireNo) {
+        mf::LogError("geometry_alignment_test")
+          << planeName << ": nearest wire to wire " << wireNo << " is " << nearest.Wire;
+        ++nErrors;
+      }
+    } // for wires
+
+    return nErrors;
+  } // checkMovedPlane()
+
+} // local namespace
+
+//------------------------------------------------------------------------------
+int main(int argc, char const** argv)
+{
+
+  //
+  // parameter parsing
+  //
+  std::string configPath;
+  std::string geoConfigPath = "services.Geometry";
+
+  int iParam = 0;
+
+  // first argument: configuration file (mandatory)
+  if (++iParam < argc)
+    configPath = argv[iParam];
+  else
+    throw std::runtime_error("No configuration file specified.");
+
+  // second argument: path of the geometry configuration
+  if (++iParam < argc) geoConfigPath = argv[iParam];
+
+  //
+  // testing environment setup
+  //
+  using namespace lar::standalone;
+
+  fhicl::ParameterSet const pset = ParseConfiguration(configPath);
+  SetupMessageFacility(pset, "geometry_alignment_test");
+
+  fhicl::ParameterSet const geoConfig = pset.get<fhicl::ParameterSet>(geoConfigPath);
+  auto const nominal = SetupGeometry<geo::ChannelMapStandardAlg>(geoConfig);
+  auto geom = SetupGeometry<geo::ChannelMapStandardAlg>(geoConfig);
+
+  unsigned int nErrors = 0U;
+
+  // identical geometries have the same fingerprint
+  if ((nominal->Fingerprint() == 0U) || (geom->Fingerprint() != nominal->Fingerprint())) {
+    mf::LogError("geometry_alignment_test")
+      << "Fingerprints of identical geometries: " << std::hex << nominal->Fingerprint()
+      << " and " << geom->Fingerprint() << std::dec;
+    ++nErrors;
+  }
+
+  //
+  // move a whole TPC
+  //
+  geo::TPCID const tpcid{0, 0};
+  geo::Vector_t const TPCshift{0.2, -0.1, 0.3};
+  geo::GeometryAlignment TPCalignment;
+  TPCalignment.TPCs[tpcid] = geo::makeAlignmentDelta(TPCshift);
+
+  auto const start = std::chrono::steady_clock::now();
+  geom->ApplyAlignment(TPCalignment);
+  std::chrono::duration<double, std::milli> const elapsed =
+    std::chrono::steady_clock::now() - start;
+  mf::LogVerbatim("geometry_alignment_test")
+    << "Alignment of " << std::string(tpcid) << " applied in " << elapsed.count() << " ms";
+
+  geo::TPCGeo const& TPC = geom->TPC(tpcid);
+  geo::TPCGeo const& nominalTPC = nominal->TPC(tpcid);
+  if (!samePoint(TPC.Center(), nominalTPC.Center() + TPCshift) ||
+      !samePoint(TPC.GetActiveVolumeCenter<geo::Point_t>(),
+                 nominalTPC.GetActiveVolumeCenter<geo::Point_t>() + TPCshift) ||
+      !samePoint(TPC.ActiveBoundingBox().Min(),
+                 nominalTPC.ActiveBoundingBox().Min() + TPCshift)) {
+    mf::LogError("geometry_alignment_test") << std::string(tpcid) << " not moved as expected";
+    ++nErrors;
+  }
+  if (geom->PositionToTPCID(nominalTPC.Center() + TPCshift) != tpcid) {
+    mf::LogError("geometry_alignment_test")
+      << "Center of the moved " << std::string(tpcid) << " not found in it";
+    ++nErrors;
+  }
+  for (unsigned int p = 0; p < TPC.Nplanes(); ++p)
+    nErrors += checkMovedPlane(TPC.Plane(p), nominalTPC.Plane(p), TPCshift, *geom, *nominal);
+
+  // the geometry content changed
+  std::uint64_t const TPCalignedFingerprint = geom->Fingerprint();
+  if (TPCalignedFingerprint == nominal->Fingerprint()) {
+    mf::LogError("geometry_alignment_test") << "Fingerprint not changed by TPC alignment";
+    ++nErrors;
+  }
+
+  // the channels are the same
+  if (geom->Nchannels() != nominal->Nchannels()) {
+    mf::LogError("geometry_alignment_test") << "Number of channels changed after alignment";
+    ++nErrors;
+  }
+
+  //
+  // move a single plane along the drift direction, on top of its TPC
+  //
+  geo::PlaneID const planeid{tpcid, 0};
+  geo::Vector_t const planeShift = 0.05 * TPC.DriftDir<geo::Vector_t>();
+  geo::GeometryAlignment planeAlignment;
+  planeAlignment.planes[planeid] = geo::makeAlignmentDelta(planeShift);
+  geom->ApplyAlignment(planeAlignment);
+
+  nErrors += checkMovedPlane(
+    geom->Plane(planeid), nominal->Plane(planeid), TPCshift + planeShift, *geom, *nominal);
+  for (unsigned int p = 1; p < TPC.Nplanes(); ++p)
+    nErrors += checkMovedPlane(TPC.Plane(p), nominalTPC.Plane(p), TPCshift, *geom, *nominal);
+  if (geom->Fingerprint() == TPCalignedFingerprint) {
+    mf::LogError("geometry_alignment_test") << "Fingerprint not changed by plane alignment";
+    ++nErrors;
+  }
+
+  //
+  // volumes not in the geometry are rejected
+  //
+  geo::GeometryAlignment badAlignment;
+  badAlignment.TPCs[geo::TPCID{0, nominal->NTPC(geo::CryostatID{0})}] =
+    geo::makeAlignmentDelta({0.1, 0.0, 0.0});
+  try {
+    geom->ApplyAlignment(badAlignment);
+    mf::LogError("geometry_alignment_test") << "Alignment of a non-existing TPC accepted";
+    ++nErrors;
+  }
+  catch (cet::exception const&) {
+  }
+
+  if (nErrors > 0) { mf::LogError("geometry_alignment_test") << nErrors << " errors detected!"; }
+
+  return nErrors;
+} // main()
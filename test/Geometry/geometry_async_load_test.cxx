@@ -0,0 +1,152 @@
+/**
+ * @file   geometry_async_load_test.cxx
+ * @brief  Test of the loading of the geometry in the background.
+ * @see    `geo::LoadGeometryAsync()`
+ *
+ * Usage:
+ *
+ *     geometry_async_load_test configuration.fcl [GeometryParameterSet]
+ *
+ * The configuration file must contain a geometry service provider configuration
+ * under `services.Geometry` (or the path in the second argument), using the
+ * standard channel mapping.
+ *
+ * The geometry is loaded once synchronously and once in the background with
+ * `geo::LoadGeometryAsync()`, and the two geometries are compared via their
+ * snapshots.
+ */
+
+// LArSoft libraries
+#include "larcorealg/Geometry/ChannelMapStandardAlg.h"
+#include "larcorealg/Geometry/GeometryCore.h"
+#include "larcorealg/Geometry/GeometryImport.h"
+#include "larcorealg/Geometry/GeometrySnapshot.h"
+#include "larcorealg/Geometry/StandaloneBasicSetup.h"    // SetupMessageFacility()...
+#include "larcorealg/Geometry/StandaloneGeometrySetup.h" // SetupGeometry()
+
+// utility libraries
+#include "cetlib_except/exception.h"
+#include "fhiclcpp/ParameterSet.h"
+#include "messagefacility/MessageLogger/MessageLogger.h"
+
+// C/C++ standard libraries
+#include <chrono>
+#include <memory> // std::make_unique()
+#include <sstream>
+#include <stdexcept> // std::runtime_error
+#include <string>
+
+namespace {
+
+  /// Returns the binary image of `snapshot`.
+  std::string snapshotImage(geo::GeometrySnapshot const& snapshot)
+  {
+    std::ostringstream out;
+    snapshot.write(out);
+    return out.str();
+  }
+
+} // local namespace
+
+//------------------------------------------------------------------------------
+int main(int argc, char const** argv)
+{
+
+  //
+  // parameter parsing
+  //
+  std::string configPath;
+  std::string geoConfigPath = "services.Geometry";
+
+  int iParam = 0;
+
+  // first argument: configuration file (mandatory)
+  if (++iParam < argc)
+    configPath = argv[iParam];
+  else
+    throw std::runtime_error("No configuration file specified.");
+
+  // second argument: path of the geometry configuration
+  if (++iParam < argc) geoConfigPath = argv[iParam];
+
+  //
+  // testing environment setup
+  //
+  using namespace lar::standalone;
+
+  fhicl::ParameterSet const pset = ParseConfiguration(configPath);
+  SetupMessageFacility(pset, "geometry_async_load_test");
+
+  fhicl::ParameterSet const geoConfig = pset.get<fhicl::ParameterSet>(geoConfigPath);
+  auto const nominal = SetupGeometry<geo::ChannelMapStandardAlg>(geoConfig);
+  fhicl::ParameterSet const sortingPars =
+    geoConfig.get<fhicl::ParameterSet>("SortingParameters", {});
+
+  unsigned int nErrors = 0U;
+
+  geo::GeometryLoadHandle const noHandle;
+  if (noHandle.valid() || noHandle.ready()) {
+    mf::LogError("geometry_async_load_test") << "Default handle is associated to a load";
+    ++nErrors;
+  }
+
+  //
+  // background load
+  //
+  geo::GeometryCore geom{geoConfig};
+  auto const start = std::chrono::steady_clock::now();
+  geo::GeometryLoadHandle const handle =
+    geo::LoadGeometryAsync(geom,
+                           nominal->GDMLFile(),
+                           nominal->ROOTFile(),
+                           std::make_unique<geo::ChannelMapStandardAlg>(sortingPars));
+  std::chrono::duration<double, std::milli> const startTime =
+    std::chrono::steady_clock::now() - start;
+  mf::LogVerbatim("geometry_async_load_test")
+    << "Load started in " << startTime.count() << " ms (ready: " << std::boolalpha
+    << handle.ready() << ")";
+
+  // the first access waits for the load
+  if (handle->Nchannels() != nominal->Nchannels()) {
+    mf::LogError("geometry_async_load_test")
+      << "Geometry loaded in background has " << handle->Nchannels() << " channels, "
+      << nominal->Nchannels() << " expected";
+    ++nErrors;
+  }
+  std::chrono::duration<double, std::milli> const loadTime =
+    std::chrono::steady_clock::now() - start;
+  mf::LogVerbatim("geometry_async_load_test") << "Load completed in " << loadTime.count() << " ms";
+
+  if (!handle.ready() || (&handle.get() != &geom)) {
+    mf::LogError("geometry_async_load_test") << "Handle not ready after access";
+    ++nErrors;
+  }
+  if (snapshotImage(handle->MakeGeometrySnapshot()) !=
+      snapshotImage(nominal->MakeGeometrySnapshot())) {
+    mf::LogError("geometry_async_load_test")
+      << "Geometry loaded in background differs from the one loaded synchronously";
+    ++nErrors;
+  }
+
+  //
+  // errors are reported on access
+  //
+  geo::GeometryCore badGeom{geoConfig};
+  geo::GeometryLoadHandle const badHandle =
+    geo::LoadGeometryAsync(badGeom, nominal->GDMLFile(), "");
+  try {
+    badHandle.wait();
+    mf::LogError("geometry_async_load_test") << "Load with no ROOT file succeeded";
+    ++nErrors;
+  }
+  catch (cet::exception const&) {
+  }
+  if (!badHandle.ready()) {
+    mf::LogError("geometry_async_load_test") << "Failed load not reported as complete";
+    ++nErrors;
+  }
+
+  if (nErrors > 0) { mf::LogError("geometry_async_load_test") << nErrors << " errors detected!"; }
+
+  return nErrors;
+} // main()
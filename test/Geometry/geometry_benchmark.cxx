@@ -0,0 +1,304 @@
+/**
+ * @file   geometry_benchmark.cxx
+ * @brief  Timing of the most used geometry queries on a standard detector.
+ * @see    `larcorealg/TestUtils/Benchmark.h`
+ *
+ * Usage:
+ *
+ *     geometry_benchmark configuration.fcl [options] [GeometryParameterSet]
+ *
+ * The configuration file must contain a geometry service provider configuration
+ * under `services.Geometry` (or the path in the second argument), using the
+ * standard channel mapping.
+ *
+ * Each query is timed on inputs randomly generated (with a fixed seed) within
+ * the active volume of the TPCs, and the time per query is printed.
+ * The options (`--json=FILE`, `--csv=FILE`, `--baseline=FILE`,
+ * `--tolerance=FRACTION`, `--warn-only`) are described in
+ * `testing::BenchmarkOptions_t`: the results can be written into files and
+ * compared with a baseline, in which case regressions make the program fail.
+ */
+
+// LArSoft libraries
+#include "larcorealg/Geometry/ChannelMapStandardAlg.h"
+#include "larcorealg/Geometry/Exceptions.h" // geo::InvalidWireError
+#include "larcorealg/Geometry/GeometryCore.h"
+#include "larcorealg/Geometry/TPCGeo.h"
+#include "larcorealg/Geometry/WireGeo.h"
+#include "larcorealg/TestUtils/Benchmark.h"
+#include "larcorealg/TestUtils/geometry_unit_test_base.h"
+#include "larcoreobj/SimpleTypesAndConstants/RawTypes.h" // raw::ChannelID_t
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+#include "larcoreobj/SimpleTypesAndConstants/geo_vectors.h"
+
+// utility libraries
+#include "messagefacility/MessageLogger/MessageLogger.h"
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <random>
+#include <sstream>
+#include <string>
+#include <utility> // std::pair
+#include <vector>
+
+//------------------------------------------------------------------------------
+//---  The test environment
+//---
+
+using StandardGeometryConfiguration =
+  testing::BasicGeometryEnvironmentConfiguration<geo::ChannelMapStandardAlg>;
+
+using StandardGeometryTestEnvironment =
+  testing::GeometryTesterEnvironment<StandardGeometryConfiguration>;
+
+//------------------------------------------------------------------------------
+//---  The inputs
+//---
+namespace {
+
+  /// Number of random inputs of each type; queries cycle through them.
+  constexpr std::size_t NInputs = 4096U;
+
+  /// A point in the active volume of a TPC, with one of its planes.
+  struct PointOnPlane_t {
+    geo::Point_t point;
+    geo::PlaneID planeID;
+  };
+
+  /// Returns a cycling accessor to the elements of `inputs`.
+  template <typename T>
+  auto cycle(std::vector<T> const& inputs)
+  {
+    return [&inputs, i = std::size_t{0}]() mutable -> T const& {
+      if (i == inputs.size()) i = 0U;
+      return inputs[i++];
+    };
+  }
+
+  /// Random points in the active volume of random TPCs, each with a plane
+  /// whose wires cover it.
+  std::vector<PointOnPlane_t> generatePoints(geo::GeometryCore const& geom, std::mt19937& engine)
+  {
+    std::vector<geo::TPCGeo const*> TPCs;
+    for (geo::TPCGeo const& TPC : geom.IterateTPCs())
+      TPCs.push_back(&TPC);
+    std::uniform_int_distribution<std::size_t> pickTPC{0U, TPCs.size() - 1U};
+    std::uniform_real_distribution<double> uniform{0.0, 1.0};
+
+    std::vector<PointOnPlane_t> points;
+    points.reserve(NInputs);
+    while (points.size() < NInputs) {
+      geo::TPCGeo const& TPC = *TPCs[pickTPC(engine)];
+      geo::BoxBoundedGeo const& box = TPC.ActiveBoundingBox();
+      geo::Point_t const point{box.MinX() + uniform(engine) * box.SizeX(),
+                               box.MinY() + uniform(engine) * box.SizeY(),
+                               box.MinZ() + uniform(engine) * box.SizeZ()};
+      std::uniform_int_distribution<unsigned int> pickPlane{0U, TPC.Nplanes() - 1U};
+      geo::PlaneID const planeID{TPC.ID(), pickPlane(engine)};
+      try {
+        geom.NearestWireID(point, planeID); // skip points off the wire plane
+      }
+      catch (geo::InvalidWireError const&) {
+        continue;
+      }
+      points.push_back({point, planeID});
+    } // while
+    return points;
+  } // generatePoints()
+
+  /// Random wires, from the whole detector.
+  std::vector<geo::WireID> generateWires(geo::GeometryCore const& geom, std::mt19937& engine)
+  {
+    std::vector<geo::WireID> allWires;
+    for (geo::WireID const& wireID : geom.IterateWireIDs())
+      allWires.push_back(wireID);
+    std::uniform_int_distribution<std::size_t> pickWire{0U, allWires.size() - 1U};
+
+    std::vector<geo::WireID> wires;
+    wires.reserve(NInputs);
+    while (wires.size() < NInputs)
+      wires.push_back(allWires[pickWire(engine)]);
+    return wires;
+  } // generateWires()
+
+  /// Pairs of random wires on the first two planes of the same TPC, crossing
+  /// at a random point of the TPC.
+  std::vector<std::pair<geo::WireID, geo::WireID>> generateWirePairs(
+    std::vector<PointOnPlane_t> const& points,
+    geo::GeometryCore const& geom)
+  {
+    std::vector<std::pair<geo::WireID, geo::WireID>> pairs;
+    pairs.reserve(points.size());
+    for (PointOnPlane_t const& p : points) {
+      geo::TPCID const& tpcid = p.planeID;
+      try {
+        pairs.emplace_back(geom.NearestWireID(p.point, geo::PlaneID{tpcid, 0U}),
+                           geom.NearestWireID(p.point, geo::PlaneID{tpcid, 1U}));
+      }
+      catch (geo::InvalidWireError const&) {
+      }
+    } // for
+    return pairs;
+  } // generateWirePairs()
+
+} // local namespace
+
+//------------------------------------------------------------------------------
+/**
+ * @brief Runs the benchmarks
+ * @param argc number of arguments in argv
+ * @param argv arguments to the function
+ * @return number of regressions with respect to the baseline (0 on success)
+ * @throw cet::exception most of error situations throw
+ *
+ * The arguments in argv are, besides the benchmark options:
+ * 0. name of the executable ("geometry_benchmark")
+ * 1. path to the FHiCL configuration file
+ * 2. FHiCL path to the configuration of the geometry
+ *    (default: services.Geometry)
+ *
+ */
+int main(int argc, char const** argv)
+{
+
+  StandardGeometryConfiguration config("geometry_benchmark");
+
+  //
+  // parameter parsing
+  //
+  testing::BenchmarkOptions_t options;
+  std::vector<std::string> params;
+  for (int iArg = 1; iArg < argc; ++iArg)
+    if (!options.parse(argv[iArg])) params.push_back(argv[iArg]);
+
+  // first argument: configuration file (mandatory)
+  if (params.size() > 0U) config.SetConfigurationPath(params[0]);
+
+  // second argument: path of the parameter set for geometry configuration
+  // (optional; default: "services.Geometry" from the inherited object)
+  if (params.size() > 1U) config.SetGeometryParameterSetPath(params[1]);
+
+  //
+  // testing environment setup
+  //
+  StandardGeometryTestEnvironment TestEnvironment(config);
+  geo::GeometryCore const& geom = *(TestEnvironment.Provider<geo::GeometryCore>());
+
+  //
+  // input generation
+  //
+  std::mt19937 engine{12345U};
+  std::vector<PointOnPlane_t> const points = generatePoints(geom, engine);
+  std::vector<geo::WireID> const wires = generateWires(geom, engine);
+  auto const wirePairs = generateWirePairs(points, geom);
+
+  std::uniform_int_distribution<raw::ChannelID_t> pickChannel{0U, geom.Nchannels() - 1U};
+  std::vector<raw::ChannelID_t> channels(NInputs);
+  for (raw::ChannelID_t& channel : channels)
+    channel = pickChannel(engine);
+
+  std::uniform_real_distribution<double> pickSlope{-5.0, 5.0};
+  std::vector<std::pair<double, double>> slopes(NInputs);
+  for (auto& slope : slopes)
+    slope = {pickSlope(engine), pickSlope(engine)};
+
+  //
+  // benchmarks
+  //
+  testing::Benchmark<> bench;
+
+  bench.run("NearestWireID", [next = cycle(points), &geom]() mutable {
+    PointOnPlane_t const& p = next();
+    testing::doNotOptimize(geom.NearestWireID(p.point, p.planeID));
+  });
+
+  bench.run("WireCoordinate", [next = cycle(points), &geom]() mutable {
+    PointOnPlane_t const& p = next();
+    testing::doNotOptimize(geom.WireCoordinate(p.point, p.planeID));
+  });
+
+  bench.run("ChannelToWire", [next = cycle(channels), &geom]() mutable {
+    testing::doNotOptimize(geom.ChannelToWire(next()));
+  });
+
+  bench.run("PlaneWireToChannel", [next = cycle(wires), &geom]() mutable {
+    testing::doNotOptimize(geom.PlaneWireToChannel(next()));
+  });
+
+  bench.run("FindTPCAtPosition", [next = cycle(points), &geom]() mutable {
+    testing::doNotOptimize(geom.FindTPCAtPosition(next().point));
+  });
+
+  bench.run("GetClosestOpDet", [next = cycle(points), &geom]() mutable {
+    testing::doNotOptimize(geom.GetClosestOpDet(next().point));
+  });
+
+  bench.run("WireIDsIntersect", [next = cycle(wirePairs), &geom]() mutable {
+    auto const& [wire1, wire2] = next();
+    geo::Point_t intersection;
+    testing::doNotOptimize(geom.WireIDsIntersect(wire1, wire2, intersection));
+    testing::doNotOptimize(intersection);
+  });
+
+  if (geom.MaxPlanes() == 3U) { // assumes all TPCs have three planes
+    bench.run("ThirdPlaneSlope", [next = cycle(slopes), nextPoint = cycle(points), &geom]() mutable {
+      auto const& [slope1, slope2] = next();
+      geo::TPCID const& tpcid = nextPoint().planeID;
+      testing::doNotOptimize(geom.ThirdPlaneSlope(
+        geo::PlaneID{tpcid, 0U}, slope1, geo::PlaneID{tpcid, 1U}, slope2, geo::PlaneID{tpcid, 2U}));
+    });
+  }
+
+  // iterators: one call is a whole loop, the time is per element
+  bench.run(
+    "IterateTPCs",
+    [&geom] {
+      for (geo::TPCGeo const& TPC : geom.IterateTPCs())
+        testing::doNotOptimize(&TPC);
+    },
+    geom.TotalNTPC());
+
+  std::size_t nPlanes = 0U;
+  for (geo::PlaneID const& planeID [[maybe_unused]] : geom.IteratePlaneIDs())
+    ++nPlanes;
+  bench.run(
+    "IteratePlaneIDs",
+    [&geom] {
+      for (geo::PlaneID const& planeID : geom.IteratePlaneIDs())
+        testing::doNotOptimize(planeID);
+    },
+    nPlanes);
+
+  std::size_t nWires = 0U;
+  for (geo::WireID const& wireID [[maybe_unused]] : geom.IterateWireIDs())
+    ++nWires;
+  bench.run(
+    "IterateWireIDs",
+    [&geom] {
+      for (geo::WireID const& wireID : geom.IterateWireIDs())
+        testing::doNotOptimize(wireID);
+    },
+    nWires);
+
+  bench.run(
+    "IterateWires",
+    [&geom] {
+      for (geo::WireGeo const& wire : geom.IterateWires())
+        testing::doNotOptimize(&wire);
+    },
+    nWires);
+
+  //
+  // report
+  //
+  std::ostringstream report;
+  unsigned int const nRegressions = bench.report(options, report);
+  mf::LogVerbatim("geometry_benchmark") << "Time per query [ns]:\n" << report.str();
+
+  if (nRegressions > 0) {
+    mf::LogError("geometry_benchmark") << nRegressions << " performance regressions detected!";
+  }
+
+  return nRegressions;
+} // main()
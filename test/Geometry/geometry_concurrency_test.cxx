@@ -0,0 +1,489 @@
+/**
+ * @file   geometry_concurrency_test.cxx
+ * @brief  Stress test of the geometry queries from concurrent threads.
+ *
+ * Usage:
+ *
+ *     geometry_concurrency_test configuration.fcl [options] [GeometryParameterSet]
+ *
+ * The configuration file must contain a geometry service provider configuration
+ * under `services.Geometry` (or the path in the second argument), using the
+ * standard channel mapping.
+ *
+ * The constant queries of `geo::GeometryCore` are grouped in families (TPC
+ * lookup, wires, channel mapping, optical detectors, ROOT navigation...).
+ * Each family is first run from many threads at the same time on a geometry
+ * that was never queried before, so that the caches built on demand are
+ * built concurrently, and the results of every thread are compared with the
+ * ones of the same queries run later from a single thread. Then the
+ * throughput of each family is measured with an increasing number of threads,
+ * and its scaling with respect to a single thread is printed.
+ *
+ * The options are:
+ * * `--threads=N`: largest number of threads (default: twice the number of
+ *   hardware threads, at least 4 and at most 16)
+ * * `--passes=N`: number of times each thread runs all the inputs
+ *   (default: 4)
+ *
+ * The test is meant to be also run in a build with thread sanitizer
+ * (`-fsanitize=thread`): the test itself shares no data among the threads
+ * other than the geometry, except through atomic variables.
+ */
+
+// LArSoft libraries
+#include "larcorealg/Geometry/ChannelMapStandardAlg.h"
+#include "larcorealg/Geometry/Exceptions.h" // geo::InvalidWireError
+#include "larcorealg/Geometry/GeometryCore.h"
+#include "larcorealg/Geometry/OpDetGeo.h"
+#include "larcorealg/Geometry/TPCGeo.h"
+#include "larcorealg/TestUtils/geometry_unit_test_base.h"
+#include "larcoreobj/SimpleTypesAndConstants/RawTypes.h" // raw::ChannelID_t
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+#include "larcoreobj/SimpleTypesAndConstants/geo_vectors.h"
+
+// utility libraries
+#include "messagefacility/MessageLogger/MessageLogger.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::max(), std::clamp()
+#include <atomic>
+#include <chrono>
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint64_t
+#include <cstring> // std::memcpy()
+#include <functional>
+#include <iomanip> // std::setw()
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility> // std::move()
+#include <vector>
+
+//------------------------------------------------------------------------------
+//---  The test environment
+//---
+
+using StandardGeometryConfiguration =
+  testing::BasicGeometryEnvironmentConfiguration<geo::ChannelMapStandardAlg>;
+
+using StandardGeometryTestEnvironment =
+  testing::GeometryTesterEnvironment<StandardGeometryConfiguration>;
+
+//------------------------------------------------------------------------------
+//---  The queries
+//---
+namespace {
+
+  /// Number of random inputs of each type.
+  constexpr std::size_t NInputs = 2048U;
+
+  /// Accumulates values into a hash, to compare results of the queries.
+  class Digest {
+  public:
+    Digest& add(std::uint64_t value)
+    {
+      fHash = (fHash ^ value) * 0x100000001B3ULL;
+      return *this;
+    }
+    Digest& add(double value)
+    {
+      std::uint64_t bits;
+      std::memcpy(&bits, &value, sizeof(bits));
+      return add(bits);
+    }
+    Digest& add(geo::Point_t const& point)
+    {
+      return add(point.X()).add(point.Y()).add(point.Z());
+    }
+    Digest& add(std::string const& s) { return add(std::uint64_t{std::hash<std::string>{}(s)}); }
+    Digest& add(geo::CryostatID const& id)
+    {
+      return add(std::uint64_t{id.isValid}).add(std::uint64_t{id.Cryostat});
+    }
+    Digest& add(geo::TPCID const& id)
+    {
+      return add(static_cast<geo::CryostatID const&>(id)).add(std::uint64_t{id.TPC});
+    }
+    Digest& add(geo::PlaneID const& id)
+    {
+      return add(static_cast<geo::TPCID const&>(id)).add(std::uint64_t{id.Plane});
+    }
+    Digest& add(geo::WireID const& id)
+    {
+      return add(static_cast<geo::PlaneID const&>(id)).add(std::uint64_t{id.Wire});
+    }
+
+    std::uint64_t value() const { return fHash; }
+
+  private:
+    std::uint64_t fHash = 0xCBF29CE484222325ULL;
+  }; // Digest
+
+  /// Marks in the digest a query which threw an exception.
+  constexpr std::uint64_t ExceptionMark = 0xDEADBEEFULL;
+
+  /// A family of queries: `query(i)` runs them on the input `i`, and returns
+  /// the digest of the results.
+  struct QueryFamily_t {
+    std::string name;
+    std::size_t nInputs = 0U;
+    std::function<std::uint64_t(std::size_t)> query;
+  };
+
+  /// A point in the active volume of a TPC, with one of its planes.
+  struct PointOnPlane_t {
+    geo::Point_t point;
+    geo::PlaneID planeID;
+  };
+
+  /// Random points in the active volume of random TPCs, with a random plane.
+  /// No geometry query is used, so that the caches are not built yet.
+  std::vector<PointOnPlane_t> generatePoints(geo::GeometryCore const& geom, std::mt19937& engine)
+  {
+    std::vector<geo::TPCGeo const*> TPCs;
+    for (geo::TPCGeo const& TPC : geom.IterateTPCs())
+      TPCs.push_back(&TPC);
+    std::uniform_int_distribution<std::size_t> pickTPC{0U, TPCs.size() - 1U};
+    std::uniform_real_distribution<double> uniform{0.0, 1.0};
+
+    std::vector<PointOnPlane_t> points;
+    points.reserve(NInputs);
+    while (points.size() < NInputs) {
+      geo::TPCGeo const& TPC = *TPCs[pickTPC(engine)];
+      geo::BoxBoundedGeo const& box = TPC.ActiveBoundingBox();
+      geo::Point_t const point{box.MinX() + uniform(engine) * box.SizeX(),
+                               box.MinY() + uniform(engine) * box.SizeY(),
+                               box.MinZ() + uniform(engine) * box.SizeZ()};
+      std::uniform_int_distribution<unsigned int> pickPlane{0U, TPC.Nplanes() - 1U};
+      points.push_back({point, geo::PlaneID{TPC.ID(), pickPlane(engine)}});
+    } // while
+    return points;
+  } // generatePoints()
+
+  /// Random wires on the plane of each of the `points`.
+  std::vector<geo::WireID> generateWires(std::vector<PointOnPlane_t> const& points,
+                                         geo::GeometryCore const& geom,
+                                         std::mt19937& engine)
+  {
+    std::vector<geo::WireID> wires;
+    wires.reserve(points.size());
+    for (PointOnPlane_t const& p : points) {
+      std::uniform_int_distribution<unsigned int> pickWire{0U, geom.Nwires(p.planeID) - 1U};
+      wires.emplace_back(p.planeID, pickWire(engine));
+    }
+    return wires;
+  } // generateWires()
+
+  /// Creates all the families of queries, on the specified inputs.
+  std::vector<QueryFamily_t> makeQueryFamilies(geo::GeometryCore const& geom,
+                                               std::vector<PointOnPlane_t> const& points,
+                                               std::vector<geo::WireID> const& wires,
+                                               std::vector<raw::ChannelID_t> const& channels)
+  {
+    std::vector<QueryFamily_t> families;
+
+    families.push_back({"TPC lookup", points.size(), [&geom, &points](std::size_t i) {
+                          geo::Point_t const& point = points[i].point;
+                          return Digest{}
+                            .add(geom.FindTPCAtPosition(point))
+                            .add(geom.PositionToCryostatID(point))
+                            .value();
+                        }});
+
+    families.push_back({"wire position", points.size(), [&geom, &points](std::size_t i) {
+                          PointOnPlane_t const& p = points[i];
+                          Digest digest;
+                          digest.add(geom.WireCoordinate(p.point, p.planeID));
+                          try {
+                            digest.add(geom.NearestWireID(p.point, p.planeID));
+                          }
+                          catch (geo::InvalidWireError const&) {
+                            digest.add(ExceptionMark);
+                          }
+                          return digest.value();
+                        }});
+
+    families.push_back({"wire geometry", wires.size(), [&geom, &wires](std::size_t i) {
+                          geo::WireGeo const& wire = geom.Wire(wires[i]);
+                          return Digest{}
+                            .add(wire.GetCenter())
+                            .add(wire.GetStart())
+                            .add(wire.ThetaZ())
+                            .value();
+                        }});
+
+    families.push_back(
+      {"wire intersection", wires.size() - 1U, [&geom, &wires](std::size_t i) {
+         // the next wire, moved to another plane of the same TPC
+         geo::WireID const& wire1 = wires[i];
+         geo::PlaneID const plane2{wire1.asTPCID(), (wire1.Plane + 1U) % geom.Nplanes(wire1)};
+         geo::WireID const wire2{plane2, wires[i + 1U].Wire % geom.Nwires(plane2)};
+         geo::Point_t intersection;
+         bool const crossing = geom.WireIDsIntersect(wire1, wire2, intersection);
+         Digest digest;
+         digest.add(std::uint64_t{crossing});
+         if (crossing) digest.add(intersection);
+         return digest.value();
+       }});
+
+    families.push_back(
+      {"channel mapping", channels.size(), [&geom, &channels, &wires](std::size_t i) {
+         Digest digest;
+         for (geo::WireID const& wireID : geom.ChannelToWire(channels[i]))
+           digest.add(wireID);
+         digest.add(static_cast<std::uint64_t>(geom.SignalType(channels[i])));
+         digest.add(std::uint64_t{geom.PlaneWireToChannel(wires[i % wires.size()])});
+         return digest.value();
+       }});
+
+    if (geom.NOpDets() > 0U) {
+      families.push_back({"optical detectors", points.size(), [&geom, &points](std::size_t i) {
+                            unsigned int const opDet = i % geom.NOpDets();
+                            return Digest{}
+                              .add(std::uint64_t{geom.GetClosestOpDet(points[i].point)})
+                              .add(geom.OpDetGeoFromOpDet(opDet).GetCenter())
+                              .value();
+                          }});
+    }
+
+    families.push_back({"ROOT navigation", points.size(), [&geom, &points](std::size_t i) {
+                          geo::Point_t const& point = points[i].point;
+                          return Digest{}
+                            .add(geom.MaterialName(point))
+                            .add(geom.VolumeName(point))
+                            .value();
+                        }});
+
+    if (geom.MaxPlanes() == 3U) { // assumes all TPCs have three planes
+      families.push_back({"third plane slope", points.size(), [&geom, &points](std::size_t i) {
+                            geo::TPCID const& tpcid = points[i].planeID;
+                            double const slope1 = points[i].point.X() / 100.0;
+                            double const slope2 = points[i].point.Y() / 100.0;
+                            return Digest{}
+                              .add(geom.ThirdPlaneSlope(geo::PlaneID{tpcid, 0U},
+                                                        slope1,
+                                                        geo::PlaneID{tpcid, 1U},
+                                                        slope2,
+                                                        geo::PlaneID{tpcid, 2U}))
+                              .value();
+                          }});
+    }
+
+    return families;
+  } // makeQueryFamilies()
+
+  //----------------------------------------------------------------------------
+  /// Result of a concurrent run of a query family.
+  struct RunResult_t {
+    /// Digest of each input, from each thread (empty if not recorded).
+    std::vector<std::vector<std::uint64_t>> digests;
+    std::size_t nInconsistent = 0U; ///< Results changing between passes.
+    std::size_t nExceptions = 0U;   ///< Unexpected exceptions.
+    double seconds = 0.0;           ///< Wall time of the run.
+  };
+
+  /**
+   * @brief Runs all the inputs of `family` from `nThreads` threads at once.
+   * @param family the queries to be run
+   * @param nThreads number of threads
+   * @param nPasses number of times each thread runs all the inputs
+   * @param record whether to keep the digests of the results
+   *
+   * The threads are all started before any query, and run through the inputs
+   * from different starting points. The result of each query in the passes
+   * after the first one of a thread is compared with the one of its first pass.
+   */
+  RunResult_t runConcurrently(QueryFamily_t const& family,
+                              unsigned int nThreads,
+                              unsigned int nPasses,
+                              bool record)
+  {
+    RunResult_t result;
+    result.digests.resize(nThreads);
+
+    std::atomic<bool> go{false};
+    std::atomic<unsigned int> ready{0U};
+    std::atomic<std::size_t> nInconsistent{0U};
+    std::atomic<std::size_t> nExceptions{0U};
+
+    auto const worker = [&](unsigned int iThread) {
+      std::vector<std::uint64_t> digests(family.nInputs);
+      std::size_t const offset = (family.nInputs * iThread) / nThreads;
+      std::size_t inconsistent = 0U, exceptions = 0U;
+
+      ready.fetch_add(1U, std::memory_order_release);
+      while (!go.load(std::memory_order_acquire))
+        std::this_thread::yield();
+
+      for (unsigned int pass = 0; pass < nPasses; ++pass) {
+        for (std::size_t k = 0; k < family.nInputs; ++k) {
+          std::size_t const i = (offset + k) % family.nInputs;
+          std::uint64_t digest = ExceptionMark;
+          try {
+            digest = family.query(i);
+          }
+          catch (...) {
+            ++exceptions;
+          }
+          if (pass == 0)
+            digests[i] = digest;
+          else if (digests[i] != digest)
+            ++inconsistent;
+        } // for inputs
+      }   // for passes
+
+      nInconsistent.fetch_add(inconsistent);
+      nExceptions.fetch_add(exceptions);
+      if (record) result.digests[iThread] = std::move(digests);
+    }; // worker
+
+    std::vector<std::thread> threads;
+    threads.reserve(nThreads);
+    for (unsigned int iThread = 0; iThread < nThreads; ++iThread)
+      threads.emplace_back(worker, iThread);
+    while (ready.load(std::memory_order_acquire) < nThreads)
+      std::this_thread::yield();
+
+    auto const start = std::chrono::steady_clock::now();
+    go.store(true, std::memory_order_release);
+    for (std::thread& thread : threads)
+      thread.join();
+    auto const stop = std::chrono::steady_clock::now();
+
+    result.seconds = std::chrono::duration<double>(stop - start).count();
+    result.nInconsistent = nInconsistent.load();
+    result.nExceptions = nExceptions.load();
+    return result;
+  } // runConcurrently()
+
+  /// Parses `arg` as `--name=N`; returns whether it matched.
+  bool parseNumberOption(std::string const& arg, std::string const& name, unsigned int& value)
+  {
+    std::string const prefix = "--" + name + "=";
+    if (arg.compare(0, prefix.length(), prefix) != 0) return false;
+    value = std::stoul(arg.substr(prefix.length()));
+    return true;
+  } // parseNumberOption()
+
+} // local namespace
+
+//------------------------------------------------------------------------------
+/**
+ * @brief Runs the test
+ * @param argc number of arguments in argv
+ * @param argv arguments to the function
+ * @return number of failures (0 on success)
+ * @throw cet::exception most of error situations throw
+ *
+ * The arguments in argv are, besides the options (see the file documentation):
+ * 0. name of the executable ("geometry_concurrency_test")
+ * 1. path to the FHiCL configuration file
+ * 2. FHiCL path to the configuration of the geometry
+ *    (default: services.Geometry)
+ *
+ */
+int main(int argc, char const** argv)
+{
+
+  StandardGeometryConfiguration config("geometry_concurrency_test");
+
+  //
+  // parameter parsing
+  //
+  unsigned int maxThreads = std::clamp(2U * std::thread::hardware_concurrency(), 4U, 16U);
+  unsigned int nPasses = 4U;
+  std::vector<std::string> params;
+  for (int iArg = 1; iArg < argc; ++iArg) {
+    std::string const arg = argv[iArg];
+    if (parseNumberOption(arg, "threads", maxThreads)) continue;
+    if (parseNumberOption(arg, "passes", nPasses)) continue;
+    params.push_back(arg);
+  }
+  maxThreads = std::max(maxThreads, 2U);
+  nPasses = std::max(nPasses, 2U);
+
+  // first argument: configuration file (mandatory)
+  if (params.size() > 0U) config.SetConfigurationPath(params[0]);
+
+  // second argument: path of the parameter set for geometry configuration
+  // (optional; default: "services.Geometry" from the inherited object)
+  if (params.size() > 1U) config.SetGeometryParameterSetPath(params[1]);
+
+  //
+  // testing environment setup
+  //
+  StandardGeometryTestEnvironment TestEnvironment(config);
+  geo::GeometryCore const& geom = *(TestEnvironment.Provider<geo::GeometryCore>());
+
+  //
+  // input generation
+  //
+  std::mt19937 engine{12345U};
+  std::vector<PointOnPlane_t> const points = generatePoints(geom, engine);
+  std::vector<geo::WireID> const wires = generateWires(points, geom, engine);
+
+  std::uniform_int_distribution<raw::ChannelID_t> pickChannel{0U, geom.Nchannels() - 1U};
+  std::vector<raw::ChannelID_t> channels(NInputs);
+  for (raw::ChannelID_t& channel : channels)
+    channel = pickChannel(engine);
+
+  std::vector<QueryFamily_t> const families = makeQueryFamilies(geom, points, wires, channels);
+
+  unsigned int nErrors = 0U;
+
+  //
+  // concurrent queries on a fresh geometry, compared with a single thread
+  //
+  for (QueryFamily_t const& family : families) {
+    RunResult_t const concurrent = runConcurrently(family, maxThreads, nPasses, true);
+    RunResult_t const reference = runConcurrently(family, 1U, 1U, true);
+    std::vector<std::uint64_t> const& expected = reference.digests.front();
+
+    std::size_t nMismatches = 0U;
+    for (std::vector<std::uint64_t> const& digests : concurrent.digests) {
+      for (std::size_t i = 0; i < family.nInputs; ++i)
+        if (digests[i] != expected[i]) ++nMismatches;
+    }
+
+    if (nMismatches + concurrent.nInconsistent + concurrent.nExceptions > 0U) {
+      mf::LogError("geometry_concurrency_test")
+        << "'" << family.name << "' from " << maxThreads << " threads: " << nMismatches
+        << " results different from a single thread, " << concurrent.nInconsistent
+        << " changing between passes, " << concurrent.nExceptions << " unexpected exceptions";
+      ++nErrors;
+    }
+  } // for families
+
+  //
+  // throughput scaling
+  //
+  std::vector<unsigned int> threadCounts;
+  for (unsigned int n = 1U; n < maxThreads; n *= 2U)
+    threadCounts.push_back(n);
+  threadCounts.push_back(maxThreads);
+
+  std::ostringstream log;
+  for (QueryFamily_t const& family : families) {
+    log << "\n  " << std::left << std::setw(18) << family.name << std::right;
+    double singleThread = 0.0;
+    for (unsigned int const nThreads : threadCounts) {
+      RunResult_t const run = runConcurrently(family, nThreads, nPasses, false);
+      double const nQueries = static_cast<double>(family.nInputs) * nPasses * nThreads;
+      double const throughput = (run.seconds > 0.0) ? nQueries / run.seconds / 1e6 : 0.0;
+      if (nThreads == 1U) singleThread = throughput;
+      log << "  " << std::setw(3) << nThreads << ": " << std::fixed << std::setprecision(2)
+          << std::setw(7) << throughput << " (x" << std::setprecision(1)
+          << ((singleThread > 0.0) ? throughput / singleThread : 0.0) << ")";
+    } // for threads
+  }   // for families
+  mf::LogVerbatim("geometry_concurrency_test")
+    << "Throughput of the queries [Mquery/s] (scaling with respect to one thread):" << log.str();
+
+  if (nErrors > 0) {
+    mf::LogError("geometry_concurrency_test")
+      << nErrors << " query families gave inconsistent results from concurrent threads!";
+  }
+
+  return nErrors;
+} // main()
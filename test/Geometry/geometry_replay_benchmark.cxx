@@ -0,0 +1,282 @@
+/**
+ * @file   geometry_replay_benchmark.cxx
+ * @brief  Timing of a recorded stream of geometry queries.
+ * @date   October 14, 2026
+ * @see    `larcorealg/Geometry/GeometryQueryRecorder.h`,
+ *         `larcorealg/TestUtils/Benchmark.h`
+ *
+ * Usage:
+ *
+ *     geometry_replay_benchmark configuration.fcl queries.geoq [options] [GeometryParameterSet]
+ *
+ * The configuration file must contain a geometry service provider configuration
+ * under `services.Geometry` (or the path in the third argument), using the
+ * standard channel mapping.
+ *
+ * The queries in `queries.geoq` are the ones recorded in a job by
+ * `geo::GeometryCore::EnableQueryRecording()` (e.g. with the `QueryRecording`
+ * configuration of the geometry). They are all run first once, to print how
+ * many of each kind there are and a checksum of their results, and then
+ * they are timed all together, in their order, and each kind separately.
+ * Running the same recording with two implementations of the geometry
+ * compares them on the same workload: the checksums are the same if the
+ * results are.
+ *
+ * Besides the options of `testing::BenchmarkOptions_t` (`--json=FILE`,
+ * `--csv=FILE`, `--baseline=FILE`, `--tolerance=FRACTION`, `--warn-only`):
+ * - `--generate=N`: writes into `queries.geoq` a synthetic stream of `N`
+ *   queries on points along random tracks, before replaying it;
+ * - `--checksum=HEX`: fails if the checksum of the results is not `HEX`.
+ */
+
+// LArSoft libraries
+#include "larcorealg/Geometry/ChannelMapStandardAlg.h"
+#include "larcorealg/Geometry/GeometryCore.h"
+#include "larcorealg/Geometry/GeometryQueryRecorder.h"
+#include "larcorealg/Geometry/TPCGeo.h"
+#include "larcorealg/TestUtils/Benchmark.h"
+#include "larcorealg/TestUtils/geometry_unit_test_base.h"
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+#include "larcoreobj/SimpleTypesAndConstants/geo_vectors.h"
+
+// utility libraries
+#include "messagefacility/MessageLogger/MessageLogger.h"
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint64_t
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+//------------------------------------------------------------------------------
+//---  The test environment
+//---
+
+using StandardGeometryConfiguration =
+  testing::BasicGeometryEnvironmentConfiguration<geo::ChannelMapStandardAlg>;
+
+using StandardGeometryTestEnvironment =
+  testing::GeometryTesterEnvironment<StandardGeometryConfiguration>;
+
+//------------------------------------------------------------------------------
+namespace {
+
+  using Kind_t = geo::RecordedQuery_t::Kind_t;
+
+  /// Number of consecutive points along each synthetic track.
+  constexpr unsigned int PointsPerTrack = 32U;
+
+  /**
+   * @brief Writes `n` synthetic queries into `path`.
+   *
+   * The points are along straight tracks in the active volume of random TPCs,
+   * so that consecutive queries are close to each other as in a real job; a
+   * few of them are beyond the wires. Each point is used for a wire and a TPC
+   * query, and its wires for channel and intersection queries.
+   */
+  void generateQueries(geo::GeometryCore const& geom, std::size_t n, std::string const& path)
+  {
+    std::vector<geo::TPCGeo const*> TPCs;
+    for (geo::TPCGeo const& TPC : geom.IterateTPCs())
+      TPCs.push_back(&TPC);
+
+    std::mt19937 engine{12345U};
+    std::uniform_int_distribution<std::size_t> pickTPC{0U, TPCs.size() - 1U};
+    std::uniform_real_distribution<double> uniform{0.0, 1.0};
+
+    geo::GeometryQueryRecorder recorder{path};
+    recorder.setGeometryFingerprint(geom.Fingerprint());
+    auto const record = [&recorder](geo::RecordedQuery_t const& query) { recorder.record(query); };
+
+    std::size_t nQueries = 0U;
+    while (nQueries < n) {
+      geo::TPCGeo const& TPC = *TPCs[pickTPC(engine)];
+      geo::BoxBoundedGeo const& box = TPC.ActiveBoundingBox();
+      auto const randomPoint = [&]() {
+        return geo::Point_t{box.MinX() + uniform(engine) * box.SizeX(),
+                            box.MinY() + uniform(engine) * box.SizeY(),
+                            box.MinZ() + uniform(engine) * box.SizeZ()};
+      };
+      geo::Point_t const start = randomPoint();
+      geo::Vector_t const step = (randomPoint() - start) / PointsPerTrack;
+
+      for (unsigned int i = 0; (i < PointsPerTrack) && (nQueries < n); ++i) {
+        geo::Point_t const point = start + static_cast<double>(i) * step;
+        geo::PlaneID const planeID{TPC.ID(), i % TPC.Nplanes()};
+
+        record({Kind_t::NearestWireID, point, planeID});
+        record({Kind_t::FindTPCAtPositionWithHint,
+                point,
+                geo::PlaneID{TPC.ID(), geo::PlaneID::InvalidID}});
+        nQueries += 2U;
+
+        auto const wire1 = geom.TryNearestWireID(point, geo::PlaneID{TPC.ID(), 0U});
+        auto const wire2 = geom.TryNearestWireID(point, geo::PlaneID{TPC.ID(), 1U});
+        if (!wire1 || !wire2) continue;
+        geo::RecordedQuery_t channelQuery;
+        channelQuery.kind = Kind_t::ChannelToWireIDs;
+        channelQuery.channel = geom.PlaneWireToChannel(*wire1);
+        record(channelQuery);
+        if (i % 4U == 0U) record({Kind_t::WireIDsIntersect, {}, {}, *wire1, *wire2});
+        nQueries += (i % 4U == 0U) ? 2U : 1U;
+      } // for points
+
+      // a query on the edge of the TPC, possibly beyond the wires
+      record({Kind_t::TryNearestWireID,
+              geo::Point_t{box.MaxX(), box.MaxY() + 1.0, box.MaxZ() + 1.0},
+              geo::PlaneID{TPC.ID(), 0U}});
+      ++nQueries;
+    } // while
+  } // generateQueries()
+
+  /// Prints the number of queries of each kind, and the result summary.
+  template <typename Stream>
+  void printReplay(Stream&& out, geo::QueryReplayResult_t const& result)
+  {
+    out << result.total() << " queries:";
+    for (std::size_t k = 0; k < result.calls.size(); ++k) {
+      if (result.calls[k] == 0U) continue;
+      out << "\n  " << geo::RecordedQuery_t::kindName(static_cast<Kind_t>(k)) << ": "
+          << result.calls[k];
+    }
+    out << "\n" << result.misses << " without result, " << result.throws
+        << " with exception; checksum: " << std::hex << result.checksum << std::dec;
+  } // printReplay()
+
+} // local namespace
+
+//------------------------------------------------------------------------------
+/**
+ * @brief Replays and times the recorded queries.
+ * @param argc number of arguments in argv
+ * @param argv arguments to the function
+ * @return number of regressions with respect to the baseline, plus one if the
+ *         checksum is not the expected one (0 on success)
+ * @throw cet::exception most of error situations throw
+ *
+ * The arguments in argv are, besides the options:
+ * 0. name of the executable ("geometry_replay_benchmark")
+ * 1. path to the FHiCL configuration file
+ * 2. path to the recorded queries
+ * 3. FHiCL path to the configuration of the geometry
+ *    (default: services.Geometry)
+ *
+ */
+int main(int argc, char const** argv)
+{
+
+  StandardGeometryConfiguration config("geometry_replay_benchmark");
+
+  //
+  // parameter parsing
+  //
+  testing::BenchmarkOptions_t options;
+  std::size_t nGenerate = 0U;
+  std::string expectedChecksum;
+  std::vector<std::string> params;
+  for (int iArg = 1; iArg < argc; ++iArg) {
+    std::string const arg = argv[iArg];
+    if (options.parse(arg)) continue;
+    if (arg.compare(0, 11, "--generate=") == 0)
+      nGenerate = std::stoul(arg.substr(11));
+    else if (arg.compare(0, 11, "--checksum=") == 0)
+      expectedChecksum = arg.substr(11);
+    else
+      params.push_back(arg);
+  } // for
+
+  // first argument: configuration file (mandatory)
+  if (params.size() > 0U) config.SetConfigurationPath(params[0]);
+
+  // second argument: recorded queries (mandatory)
+  if (params.size() < 2U) {
+    mf::LogError("geometry_replay_benchmark") << "The file of the recorded queries is required.";
+    return 1;
+  }
+  std::string const queryPath = params[1];
+
+  // third argument: path of the parameter set for geometry configuration
+  // (optional; default: "services.Geometry" from the inherited object)
+  if (params.size() > 2U) config.SetGeometryParameterSetPath(params[2]);
+
+  //
+  // testing environment setup
+  //
+  StandardGeometryTestEnvironment TestEnvironment(config);
+  geo::GeometryCore const& geom = *(TestEnvironment.Provider<geo::GeometryCore>());
+
+  //
+  // input
+  //
+  if (nGenerate > 0U) generateQueries(geom, nGenerate, queryPath);
+
+  geo::RecordedQueryLog_t const log = geo::readRecordedQueries(queryPath);
+  if (log.queries.empty()) {
+    mf::LogError("geometry_replay_benchmark") << "No query in '" << queryPath << "'.";
+    return 1;
+  }
+  if (log.fingerprint != geom.Fingerprint()) {
+    mf::LogWarning("geometry_replay_benchmark")
+      << "The queries in '" << queryPath << "' were recorded on a different geometry"
+      << " (fingerprint " << std::hex << log.fingerprint << " instead of " << geom.Fingerprint()
+      << std::dec << ").";
+  }
+
+  //
+  // results
+  //
+  geo::QueryReplayResult_t const result = geo::replayRecordedQueries(geom, log.queries);
+  printReplay(mf::LogVerbatim("geometry_replay_benchmark"), result);
+
+  unsigned int nErrors = 0U;
+  if (!expectedChecksum.empty() &&
+      (std::stoull(expectedChecksum, nullptr, 16) != result.checksum)) {
+    mf::LogError("geometry_replay_benchmark")
+      << "The checksum of the results is not the expected " << expectedChecksum << "!";
+    ++nErrors;
+  }
+
+  //
+  // benchmarks
+  //
+  testing::Benchmark<> bench;
+
+  bench.run(
+    "Replay",
+    [&geom, &queries = log.queries]() {
+      testing::doNotOptimize(geo::replayRecordedQueries(geom, queries).checksum);
+    },
+    log.queries.size());
+
+  // each kind of query, still in the recorded order
+  for (std::size_t k = 0; k < result.calls.size(); ++k) {
+    if (result.calls[k] == 0U) continue;
+    std::vector<geo::RecordedQuery_t> queries;
+    queries.reserve(result.calls[k]);
+    for (geo::RecordedQuery_t const& query : log.queries)
+      if (static_cast<std::size_t>(query.kind) == k) queries.push_back(query);
+
+    bench.run(
+      "Replay:" + geo::RecordedQuery_t::kindName(static_cast<Kind_t>(k)),
+      [&geom, &queries]() {
+        testing::doNotOptimize(geo::replayRecordedQueries(geom, queries).checksum);
+      },
+      queries.size());
+  } // for kinds
+
+  //
+  // report
+  //
+  std::ostringstream report;
+  unsigned int const nRegressions = bench.report(options, report);
+  mf::LogVerbatim("geometry_replay_benchmark") << "Time per query [ns]:\n" << report.str();
+
+  if (nRegressions > 0) {
+    mf::LogError("geometry_replay_benchmark")
+      << nRegressions << " performance regressions detected!";
+  }
+
+  return nRegressions + nErrors;
+} // main()
@@ -0,0 +1,222 @@
+/**
+ * @file   geometry_scaling_benchmark.cxx
+ * @brief  Timing of geometry queries on synthetic detectors of growing size.
+ * @see    `larcorealg/Geometry/SyntheticDetectorGDML.h`,
+ *         `larcorealg/TestUtils/Benchmark.h`
+ *
+ * Usage:
+ *
+ *     geometry_scaling_benchmark configuration.fcl [options] [GeometryParameterSet]
+ *
+ * The configuration file must contain a message facility configuration under
+ * `services.message` and a geometry configuration under `services.Geometry`
+ * (or the path in the second argument); the detector name and GDML file are
+ * replaced by the ones of each synthetic detector, which is written in the
+ * current directory (that must be in `FW_SEARCH_PATH`).
+ *
+ * For each detector size, the lookup queries are timed on random points (with
+ * a fixed seed) in the active volume of the TPCs, so that their scaling with
+ * the number of TPCs and optical detectors is exposed.
+ * The options (`--json=FILE`, `--csv=FILE`, `--baseline=FILE`,
+ * `--tolerance=FRACTION`, `--warn-only`) are described in
+ * `testing::BenchmarkOptions_t`.
+ */
+
+// LArSoft libraries
+#include "larcorealg/Geometry/ChannelMapStandardAlg.h"
+#include "larcorealg/Geometry/GeometryCore.h"
+#include "larcorealg/Geometry/StandaloneBasicSetup.h"
+#include "larcorealg/Geometry/StandaloneGeometrySetup.h"
+#include "larcorealg/Geometry/SyntheticDetectorGDML.h"
+#include "larcorealg/Geometry/TPCGeo.h"
+#include "larcorealg/TestUtils/Benchmark.h"
+#include "larcoreobj/SimpleTypesAndConstants/geo_vectors.h"
+
+// utility libraries
+#include "fhiclcpp/ParameterSet.h"
+#include "messagefacility/MessageLogger/MessageLogger.h"
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+//------------------------------------------------------------------------------
+namespace {
+
+  /// Number of random inputs; queries cycle through them.
+  constexpr std::size_t NInputs = 4096U;
+
+  /// A named detector size.
+  struct DetectorSize_t {
+    std::string label;
+    geo::SyntheticDetectorGDML::Config_t config;
+  };
+
+  /// Returns the detectors to be tested, from a small one to a far detector.
+  std::vector<DetectorSize_t> detectorSizes()
+  {
+    std::vector<DetectorSize_t> sizes;
+    geo::SyntheticDetectorGDML::Config_t config;
+    config.nWires = 200U;
+
+    config.name = "SyntheticSmall";
+    sizes.push_back({"small", config}); // 2 TPCs, 10 optical detectors
+
+    config.name = "SyntheticMedium";
+    config.nTPCsY = 2U;
+    config.nTPCsZ = 10U;
+    config.nOpDetsPerCryostat = 100U;
+    sizes.push_back({"medium", config}); // 40 TPCs, 100 optical detectors
+
+    config.name = "SyntheticLarge";
+    config.nCryostats = 2U;
+    config.nTPCsX = 4U;
+    config.nTPCsZ = 25U;
+    config.nOpDetsPerCryostat = 250U;
+    sizes.push_back({"large", config}); // 400 TPCs, 500 optical detectors
+
+    return sizes;
+  } // detectorSizes()
+
+  /// Returns a cycling accessor to the elements of `inputs`.
+  template <typename T>
+  auto cycle(std::vector<T> const& inputs)
+  {
+    return [&inputs, i = std::size_t{0}]() mutable -> T const& {
+      if (i == inputs.size()) i = 0U;
+      return inputs[i++];
+    };
+  }
+
+  /// Random points in the active volume of random TPCs.
+  std::vector<geo::Point_t> generatePoints(geo::GeometryCore const& geom, std::mt19937& engine)
+  {
+    std::vector<geo::TPCGeo const*> TPCs;
+    for (geo::TPCGeo const& TPC : geom.IterateTPCs())
+      TPCs.push_back(&TPC);
+    std::uniform_int_distribution<std::size_t> pickTPC{0U, TPCs.size() - 1U};
+    std::uniform_real_distribution<double> uniform{0.0, 1.0};
+
+    std::vector<geo::Point_t> points;
+    points.reserve(NInputs);
+    while (points.size() < NInputs) {
+      geo::BoxBoundedGeo const& box = TPCs[pickTPC(engine)]->ActiveBoundingBox();
+      points.emplace_back(box.MinX() + uniform(engine) * box.SizeX(),
+                          box.MinY() + uniform(engine) * box.SizeY(),
+                          box.MinZ() + uniform(engine) * box.SizeZ());
+    }
+    return points;
+  } // generatePoints()
+
+} // local namespace
+
+//------------------------------------------------------------------------------
+/**
+ * @brief Runs the benchmarks
+ * @param argc number of arguments in argv
+ * @param argv arguments to the function
+ * @return number of regressions with respect to the baseline (0 on success)
+ * @throw cet::exception most of error situations throw
+ *
+ * The arguments in argv are, besides the benchmark options:
+ * 0. name of the executable ("geometry_scaling_benchmark")
+ * 1. path to the FHiCL configuration file
+ * 2. FHiCL path to the configuration of the geometry
+ *    (default: services.Geometry)
+ *
+ */
+int main(int argc, char const** argv)
+{
+  //
+  // parameter parsing
+  //
+  testing::BenchmarkOptions_t options;
+  std::vector<std::string> params;
+  for (int iArg = 1; iArg < argc; ++iArg)
+    if (!options.parse(argv[iArg])) params.push_back(argv[iArg]);
+
+  if (params.empty()) {
+    std::cerr << "No configuration file specified." << std::endl;
+    return 1;
+  }
+  std::string const geoConfigPath = (params.size() > 1U) ? params[1] : "services.Geometry";
+
+  //
+  // environment setup
+  //
+  using namespace lar::standalone;
+
+  fhicl::ParameterSet const pset = ParseConfiguration(params[0]);
+  SetupMessageFacility(pset, "geometry_scaling_benchmark");
+
+  //
+  // benchmarks
+  //
+  testing::Benchmark<> bench;
+
+  for (DetectorSize_t const& size : detectorSizes()) {
+
+    geo::SyntheticDetectorGDML const detector{size.config};
+    std::string const GDMLfile = size.config.name + ".gdml";
+    std::ofstream{GDMLfile} << detector.gdml();
+
+    fhicl::ParameterSet geoConfig = pset.get<fhicl::ParameterSet>(geoConfigPath);
+    geoConfig.put_or_replace("Name", size.config.name);
+    geoConfig.put_or_replace("GDML", GDMLfile);
+    geoConfig.put_or_replace("ROOT", GDMLfile);
+    geoConfig.put_or_replace("RelativePath", std::string{});
+    geoConfig.put_or_replace("DisableWiresInG4", false);
+
+    auto const geom = SetupGeometry<geo::ChannelMapStandardAlg>(geoConfig);
+
+    mf::LogInfo("geometry_scaling_benchmark")
+      << "Detector '" << size.label << "': " << geom->TotalNTPC() << " TPCs, "
+      << geom->NOpDets() << " optical detectors, " << geom->Nchannels() << " channels";
+
+    std::mt19937 engine{12345U};
+    std::vector<geo::Point_t> const points = generatePoints(*geom, engine);
+
+    bench.run("FindTPCAtPosition [" + size.label + "]",
+              [next = cycle(points), &geom = *geom]() mutable {
+                testing::doNotOptimize(geom.FindTPCAtPosition(next()));
+              });
+
+    bench.run("PositionToCryostatID [" + size.label + "]",
+              [next = cycle(points), &geom = *geom]() mutable {
+                testing::doNotOptimize(geom.PositionToCryostatID(next()));
+              });
+
+    bench.run("GetClosestOpDet [" + size.label + "]",
+              [next = cycle(points), &geom = *geom]() mutable {
+                testing::doNotOptimize(geom.GetClosestOpDet(next()));
+              });
+
+    bench.run(
+      "IterateTPCs [" + size.label + "]",
+      [&geom = *geom] {
+        for (geo::TPCGeo const& TPC : geom.IterateTPCs())
+          testing::doNotOptimize(&TPC);
+      },
+      geom->TotalNTPC());
+
+  } // for sizes
+
+  //
+  // report
+  //
+  std::ostringstream report;
+  unsigned int const nRegressions = bench.report(options, report);
+  mf::LogVerbatim("geometry_scaling_benchmark") << "Time per query [ns]:\n" << report.str();
+
+  if (nRegressions > 0) {
+    mf::LogError("geometry_scaling_benchmark")
+      << nRegressions << " performance regressions detected!";
+  }
+
+  return nRegressions;
+} // main()
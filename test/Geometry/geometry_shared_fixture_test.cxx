@@ -0,0 +1,140 @@
+/**
+ * @file   geometry_shared_fixture_test.cxx
+ * @brief  Test of the sharing of the geometry among test environments.
+ * @see    `larcorealg/TestUtils/geometry_unit_test_base.h`
+ *
+ * Usage:
+ *
+ *     geometry_shared_fixture_test configuration.fcl [GeometryParameterSet]
+ *
+ * The configuration file must contain a geometry service provider configuration
+ * under `services.Geometry` (or the path in the second argument), using the
+ * standard channel mapping.
+ *
+ * The test verifies that:
+ * * environments with a shared geometry use the same geometry object;
+ * * the geometry snapshot is written into the cache, and read back by a
+ *   snapshot-only environment without loading the geometry;
+ * * the snapshots from the geometry and from the cache are the same.
+ */
+
+// LArSoft libraries
+#include "larcorealg/Geometry/ChannelMapStandardAlg.h"
+#include "larcorealg/Geometry/GeometryCore.h"
+#include "larcorealg/Geometry/GeometrySnapshot.h"
+#include "larcorealg/TestUtils/geometry_unit_test_base.h"
+
+// utility libraries
+#include "messagefacility/MessageLogger/MessageLogger.h"
+
+// C/C++ standard libraries
+#include <filesystem>
+#include <sstream>
+#include <string>
+
+//------------------------------------------------------------------------------
+//---  The test environment
+//---
+
+using StandardGeometryConfiguration =
+  testing::BasicGeometryEnvironmentConfiguration<geo::ChannelMapStandardAlg>;
+
+using StandardGeometryTestEnvironment =
+  testing::GeometryTesterEnvironment<StandardGeometryConfiguration>;
+
+namespace {
+
+  /// Returns the binary image of `snapshot`.
+  std::string snapshotImage(geo::GeometrySnapshot const& snapshot)
+  {
+    std::ostringstream out;
+    snapshot.write(out);
+    return out.str();
+  }
+
+} // local namespace
+
+//------------------------------------------------------------------------------
+//---  The tests
+//---
+int main(int argc, char const** argv)
+{
+
+  StandardGeometryConfiguration config("geometry_shared_fixture_test");
+
+  // first argument: configuration file (mandatory)
+  if (argc > 1) config.SetConfigurationPath(argv[1]);
+
+  // second argument: path of the parameter set for geometry configuration
+  // (optional; default: "services.Geometry" from the inherited object)
+  if (argc > 2) config.SetGeometryParameterSetPath(argv[2]);
+
+  // the cache starts empty
+  std::filesystem::path const cacheDir =
+    std::filesystem::current_path() / "geometry_shared_fixture_test_cache";
+  std::filesystem::remove_all(cacheDir);
+  std::filesystem::create_directories(cacheDir);
+
+  config.SetSharedGeometry();
+  config.SetGeometrySnapshotCache(cacheDir.string());
+
+  unsigned int nErrors = 0U;
+
+  std::string referenceImage;
+  {
+    StandardGeometryTestEnvironment first(config);
+    StandardGeometryTestEnvironment second(config);
+
+    geo::GeometryCore const* geom = first.Provider<geo::GeometryCore>();
+    if (!geom || (second.Provider<geo::GeometryCore>() != geom)) {
+      mf::LogError("geometry_shared_fixture_test")
+        << "Environments with shared geometry use different geometry objects!";
+      ++nErrors;
+    }
+
+    // the snapshot is made from the geometry and written into the cache
+    referenceImage = snapshotImage(first.Snapshot());
+    if (&second.Snapshot() != &first.Snapshot()) {
+      mf::LogError("geometry_shared_fixture_test")
+        << "Environments with shared geometry use different snapshots!";
+      ++nErrors;
+    }
+    if (referenceImage != snapshotImage(geom->MakeGeometrySnapshot())) {
+      mf::LogError("geometry_shared_fixture_test")
+        << "Snapshot of the environment differs from the one of the geometry!";
+      ++nErrors;
+    }
+  }
+
+  std::size_t nCached = 0U;
+  for (auto const& entry : std::filesystem::directory_iterator{cacheDir}) {
+    if (entry.path().extension() == ".snapshot") ++nCached;
+  }
+  if (nCached != 1U) {
+    mf::LogError("geometry_shared_fixture_test")
+      << nCached << " snapshots in '" << cacheDir.string() << "' (expected: 1)";
+    ++nErrors;
+  }
+
+  // a snapshot-only environment reads the cache and does not load the geometry
+  {
+    config.SetSharedGeometry(false);
+    config.SetSnapshotOnlyGeometry();
+    StandardGeometryTestEnvironment snapshotOnly(config);
+
+    if (snapshotOnly.Geometry()) {
+      mf::LogError("geometry_shared_fixture_test")
+        << "Snapshot-only environment loaded the geometry!";
+      ++nErrors;
+    }
+    if (snapshotImage(snapshotOnly.Snapshot()) != referenceImage) {
+      mf::LogError("geometry_shared_fixture_test")
+        << "Snapshot read from the cache differs from the one of the geometry!";
+      ++nErrors;
+    }
+  }
+
+  std::filesystem::remove_all(cacheDir);
+
+  return nErrors;
+} // main()
@@ -0,0 +1,145 @@
+/**
+ * @file   geometry_subset_test.cxx
+ * @brief  Test of the geometry built completely only for a subset of TPCs.
+ * @date   October 14, 2026
+ * @see    `geo::GeometryCore::SetBuildSubset()`
+ *
+ * Usage:
+ *
+ *     geometry_subset_test configuration.fcl [GeometryParameterSet]
+ *
+ * The configuration file must contain a geometry service provider configuration
+ * under `services.Geometry` (or the path in the second argument), using the
+ * standard channel mapping.
+ *
+ * The geometry is loaded once completely and once with only the first TPC in
+ * the build subset, and the two are compared: they must have the same
+ * elements, IDs and channels, while the wire objects outside the subset must
+ * not be built.
+ */
+
+// LArSoft libraries
+#include "larcorealg/Geometry/ChannelMapStandardAlg.h"
+#include "larcorealg/Geometry/GeometryCore.h"
+#include "larcorealg/Geometry/GeometrySubset.h"
+#include "larcorealg/Geometry/PlaneGeo.h"
+#include "larcorealg/Geometry/StandaloneBasicSetup.h"    // SetupMessageFacility()...
+#include "larcorealg/Geometry/StandaloneGeometrySetup.h" // SetupGeometry()
+#include "larcorealg/Geometry/WireGeo.h"
+
+// utility libraries
+#include "fhiclcpp/ParameterSet.h"
+#include "messagefacility/MessageLogger/MessageLogger.h"
+
+// C/C++ standard libraries
+#include <stdexcept> // std::runtime_error
+#include <string>
+#include <vector>
+
+//------------------------------------------------------------------------------
+int main(int argc, char const** argv)
+{
+
+  //
+  // parameter parsing
+  //
+  std::string configPath;
+  std::string geoConfigPath = "services.Geometry";
+
+  int iParam = 0;
+
+  // first argument: configuration file (mandatory)
+  if (++iParam < argc)
+    configPath = argv[iParam];
+  else
+    throw std::runtime_error("No configuration file specified.");
+
+  // second argument: path of the geometry configuration
+  if (++iParam < argc) geoConfigPath = argv[iParam];
+
+  //
+  // testing environment setup
+  //
+  using namespace lar::standalone;
+
+  fhicl::ParameterSet const pset = ParseConfiguration(configPath);
+  SetupMessageFacility(pset, "geometry_subset_test");
+
+  fhicl::ParameterSet const geoConfig = pset.get<fhicl::ParameterSet>(geoConfigPath);
+  auto const complete = SetupGeometry<geo::ChannelMapStandardAlg>(geoConfig);
+
+  geo::TPCID const selected{0, 0};
+  fhicl::ParameterSet subsetConfig = geoConfig;
+  fhicl::ParameterSet subsetPars;
+  subsetPars.put("TPCs", std::vector<std::vector<unsigned int>>{{0U, 0U}});
+  subsetConfig.put_or_replace("BuildSubset", subsetPars);
+  auto const partial = SetupGeometry<geo::ChannelMapStandardAlg>(subsetConfig);
+
+  unsigned int nErrors = 0U;
+
+  if (!partial->IsInBuildSubset(selected) || partial->BuildSubset().isWholeDetector()) {
+    mf::LogError("geometry_subset_test") << "Build subset not configured";
+    ++nErrors;
+  }
+
+  //
+  // the same detector, and the same channels
+  //
+  if ((partial->Fingerprint() != complete->Fingerprint()) ||
+      (partial->Nchannels() != complete->Nchannels()) ||
+      (partial->NOpDets() != complete->NOpDets())) {
+    mf::LogError("geometry_subset_test") << "Subset geometry differs from the complete one";
+    ++nErrors;
+  }
+
+  for (geo::PlaneGeo const& plane : partial->IteratePlanes()) {
+    geo::PlaneGeo const& completePlane = complete->Plane(plane.ID());
+    if (plane.Nwires() != completePlane.Nwires()) {
+      mf::LogError("geometry_subset_test")
+        << plane.ID() << " has " << plane.Nwires() << " wires, " << completePlane.Nwires()
+        << " expected";
+      ++nErrors;
+      continue;
+    }
+    bool const inSubset = partial->IsInBuildSubset(plane.ID());
+    if (!inSubset && !plane.HasLazyWires()) {
+      mf::LogError("geometry_subset_test") << plane.ID() << " outside the subset has its wires";
+      ++nErrors;
+    }
+    if (plane.Nwires() == 0U) continue;
+
+    // wires and channels are the same; outside the subset they are built on the fly
+    unsigned int const lastWire = plane.Nwires() - 1U;
+    for (unsigned int const wireNo : {0U, lastWire}) {
+      geo::WireID const wireID{plane.ID(), wireNo};
+      geo::WireGeo const wire = plane.BuildWire(wireNo);
+      geo::WireGeo const completeWire = completePlane.BuildWire(wireNo);
+      if ((wire.GetStart<geo::Point_t>() != completeWire.GetStart<geo::Point_t>()) ||
+          (wire.GetEnd<geo::Point_t>() != completeWire.GetEnd<geo::Point_t>()) ||
+          (partial->PlaneWireToChannel(wireID) != complete->PlaneWireToChannel(wireID))) {
+        mf::LogError("geometry_subset_test") << wireID << " differs from the complete geometry";
+        ++nErrors;
+      }
+      bool const hasWireObject = partial->ChannelToWireGeo(partial->PlaneWireToChannel(wireID));
+      if (hasWireObject != inSubset) {
+        mf::LogError("geometry_subset_test")
+          << "Channel of " << wireID << (inSubset ? " has no" : " has a") << " wire object";
+        ++nErrors;
+      }
+    } // for wires
+  }   // for planes
+
+  std::size_t const partialMemory = partial->MemoryUsage().totalBytes();
+  std::size_t const completeMemory = complete->MemoryUsage().totalBytes();
+  mf::LogVerbatim("geometry_subset_test")
+    << "Memory: " << (partialMemory / 1024) << " kiB with the subset, "
+    << (completeMemory / 1024) << " kiB complete";
+  if ((complete->TotalNTPC() > 1U) && (partialMemory >= completeMemory)) {
+    mf::LogError("geometry_subset_test") << "The subset does not save memory";
+    ++nErrors;
+  }
+
+  if (nErrors > 0) { mf::LogError("geometry_subset_test") << nErrors << " errors detected!"; }
+
+  return nErrors;
+} // main()
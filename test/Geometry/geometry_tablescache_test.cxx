@@ -0,0 +1,142 @@
+/**
+ * @file   geometry_tablescache_test.cxx
+ * @brief  Test of the file of the tables of the standard channel mapping.
+ * @date   October 14, 2026
+ * @see    `geo::ChannelMapStandardAlg`
+ *
+ * Usage:
+ *
+ *     geometry_tablescache_test configuration.fcl [GeometryParameterSet]
+ *
+ * The configuration file must contain a geometry service provider configuration
+ * under `services.Geometry` (or the path in the second argument).
+ *
+ * The geometry is loaded without the tables file, then once writing it and
+ * once reading it back, and once more after the file was spoiled: the
+ * channel mapping of all of them must be the same.
+ */
+
+// LArSoft libraries
+#include "larcorealg/Geometry/ChannelMapStandardAlg.h"
+#include "larcorealg/Geometry/GeometryCore.h"
+#include "larcorealg/Geometry/PlaneGeo.h"
+#include "larcorealg/Geometry/StandaloneBasicSetup.h"    // SetupMessageFacility()...
+#include "larcorealg/Geometry/StandaloneGeometrySetup.h" // SetupGeometry()
+
+// utility libraries
+#include "fhiclcpp/ParameterSet.h"
+#include "messagefacility/MessageLogger/MessageLogger.h"
+
+// C/C++ standard libraries
+#include <cstdio> // std::remove()
+#include <fstream>
+#include <memory>    // std::unique_ptr
+#include <stdexcept> // std::runtime_error
+#include <string>
+
+//------------------------------------------------------------------------------
+/// Returns the number of differences in the channel mapping of `test`.
+unsigned int compareMapping(geo::GeometryCore const& test,
+                            geo::GeometryCore const& ref,
+                            std::string const& what)
+{
+  unsigned int nErrors = 0U;
+  if (test.Nchannels() != ref.Nchannels()) {
+    mf::LogError("geometry_tablescache_test")
+      << what << ": " << test.Nchannels() << " channels, " << ref.Nchannels() << " expected";
+    return 1U;
+  }
+  for (geo::PlaneGeo const& plane : ref.IteratePlanes()) {
+    geo::PlaneID const& planeID = plane.ID();
+    if (test.Nwires(planeID) != plane.Nwires()) {
+      mf::LogError("geometry_tablescache_test") << what << ": " << planeID << " wires differ";
+      ++nErrors;
+      continue;
+    }
+    geo::Point_t const center = plane.GetBoxCenter<geo::Point_t>();
+    if ((test.WireCoordinate(center.Y(), center.Z(), planeID) !=
+         ref.WireCoordinate(center.Y(), center.Z(), planeID)) ||
+        (test.NearestWireID(center, planeID) != ref.NearestWireID(center, planeID))) {
+      mf::LogError("geometry_tablescache_test") << what << ": " << planeID << " coordinates differ";
+      ++nErrors;
+    }
+    if (plane.Nwires() == 0U) continue;
+    geo::WireID const lastWire{planeID, plane.Nwires() - 1U};
+    if ((test.PlaneWireToChannel(lastWire) != ref.PlaneWireToChannel(lastWire)) ||
+        (test.SignalType(planeID) != ref.SignalType(planeID))) {
+      mf::LogError("geometry_tablescache_test") << what << ": " << planeID << " channels differ";
+      ++nErrors;
+    }
+  } // for planes
+  return nErrors;
+} // compareMapping()
+
+//------------------------------------------------------------------------------
+int main(int argc, char const** argv)
+{
+
+  //
+  // parameter parsing
+  //
+  std::string configPath;
+  std::string geoConfigPath = "services.Geometry";
+
+  int iParam = 0;
+
+  // first argument: configuration file (mandatory)
+  if (++iParam < argc)
+    configPath = argv[iParam];
+  else
+    throw std::runtime_error("No configuration file specified.");
+
+  // second argument: path of the geometry configuration
+  if (++iParam < argc) geoConfigPath = argv[iParam];
+
+  //
+  // testing environment setup
+  //
+  using namespace lar::standalone;
+
+  fhicl::ParameterSet const pset = ParseConfiguration(configPath);
+  SetupMessageFacility(pset, "geometry_tablescache_test");
+
+  fhicl::ParameterSet const geoConfig = pset.get<fhicl::ParameterSet>(geoConfigPath);
+  auto const reference = SetupGeometry<geo::ChannelMapStandardAlg>(geoConfig);
+
+  std::string const tablesPath = "geometry_tablescache_test.dat";
+  std::remove(tablesPath.c_str());
+
+  fhicl::ParameterSet cachedConfig = geoConfig;
+  fhicl::ParameterSet sortingPars =
+    geoConfig.get<fhicl::ParameterSet>("SortingParameters", fhicl::ParameterSet{});
+  sortingPars.put_or_replace("TablesCacheFile", tablesPath);
+  cachedConfig.put_or_replace("SortingParameters", sortingPars);
+
+  unsigned int nErrors = 0U;
+
+  // first the file is written...
+  std::unique_ptr<geo::GeometryCore const> geom =
+    SetupGeometry<geo::ChannelMapStandardAlg>(cachedConfig);
+  if (!std::ifstream{tablesPath}) {
+    mf::LogError("geometry_tablescache_test") << "Tables file '" << tablesPath << "' not written";
+    ++nErrors;
+  }
+  nErrors += compareMapping(*geom, *reference, "written");
+
+  // ... then read
+  geom = SetupGeometry<geo::ChannelMapStandardAlg>(cachedConfig);
+  nErrors += compareMapping(*geom, *reference, "loaded");
+
+  // a file not for this geometry is replaced
+  std::ofstream{tablesPath, std::ios::binary | std::ios::trunc} << "not a tables file";
+  geom = SetupGeometry<geo::ChannelMapStandardAlg>(cachedConfig);
+  nErrors += compareMapping(*geom, *reference, "replaced");
+  geom = SetupGeometry<geo::ChannelMapStandardAlg>(cachedConfig);
+  nErrors += compareMapping(*geom, *reference, "reloaded");
+
+  std::remove(tablesPath.c_str());
+
+  if (nErrors > 0) { mf::LogError("geometry_tablescache_test") << nErrors << " errors detected!"; }
+
+  return nErrors;
+} // main()
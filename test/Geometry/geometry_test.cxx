@@ -21,6 +21,9 @@
 #include "larcorealg/Geometry/GeometryCore.h"
 #include "larcorealg/TestUtils/geometry_unit_test_base.h"
 
+// counts the allocations, for the `Allocations` test
+#include "larcorealg/TestUtils/CountAllocations.h"
+
 // utility libraries
 #include "messagefacility/MessageLogger/MessageLogger.h"
 
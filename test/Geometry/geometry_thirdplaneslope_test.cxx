@@ -21,6 +21,7 @@
 // utility libraries
 
 // C/C++ standard libraries
+#include <cmath> // std::abs(), std::sin()
 
 using boost::test_tools::tolerance;
 
@@ -84,6 +85,40 @@ BOOST_AUTO_TEST_CASE(AllTests)
 
   BOOST_TEST(slope_w == expected_slope_w, 0.01 % tolerance());
 
+  // the cached coefficients of each TPC give the same result
+  for (geo::TPCGeo const& TPC : geom.IterateTPCs()) {
+    unsigned int const nPlanes = TPC.Nplanes();
+    for (unsigned int p1 = 0; p1 < nPlanes; ++p1) {
+      for (unsigned int p2 = 0; p2 < nPlanes; ++p2) {
+        if (p1 == p2) continue;
+        geo::PlaneGeo const& plane1 = TPC.Plane(p1);
+        geo::PlaneGeo const& plane2 = TPC.Plane(p2);
+        if (std::abs(std::sin(plane1.PhiZ() - plane2.PhiZ())) < 1e-6) continue; // parallel
+        for (unsigned int p3 = 0; p3 < nPlanes; ++p3) {
+          geo::PlaneGeo const& plane3 = TPC.Plane(p3);
+          auto const& coeffs = TPC.ThirdPlaneSlopeCoefficients(p1, p2, p3);
+          for (double const s : {-2.5, -0.3, 0.0005, 0.7, 4.0}) {
+            double const expected =
+              geom.ComputeThirdPlaneSlope(plane1.PhiZ(), s, plane2.PhiZ(), 0.4, plane3.PhiZ());
+            BOOST_TEST(geom.ComputeThirdPlaneSlope(coeffs, s, 0.4) == expected,
+                       1e-6 % tolerance());
+
+            double const expected_dTdW = geom.ComputeThirdPlane_dTdW(plane1.PhiZ(),
+                                                                     plane1.WirePitch(),
+                                                                     s,
+                                                                     plane2.PhiZ(),
+                                                                     plane2.WirePitch(),
+                                                                     0.4,
+                                                                     plane3.PhiZ(),
+                                                                     plane3.WirePitch());
+            BOOST_TEST(geom.ComputeThirdPlane_dTdW(coeffs, s, 0.4) == expected_dTdW,
+                       1e-6 % tolerance());
+          } // for slopes
+        }   // for target plane
+      }     // for second plane
+    }       // for first plane
+  }         // for TPC
+
 } // BOOST_AUTO_TEST_CASE( AllTests )
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,173 @@
+/**
+ * @file   geometry_tpcsetview_test.cxx
+ * @brief  Test of the packed geometry of single TPC sets.
+ * @date   October 14, 2026
+ * @see    `geo::TPCsetView`
+ *
+ * Usage:
+ *
+ *     geometry_tpcsetview_test configuration.fcl [GeometryParameterSet]
+ *
+ * The configuration file must contain a geometry service provider configuration
+ * under `services.Geometry` (or the path in the second argument), using the
+ * standard channel mapping.
+ *
+ * A view is made of each TPC set, and its queries on random points in the
+ * TPCs of the set, a bit beyond their boundaries, are compared with the ones
+ * of `geo::GeometryCore`.
+ */
+
+// LArSoft libraries
+#include "larcorealg/Geometry/ChannelMapStandardAlg.h"
+#include "larcorealg/Geometry/GeometryCore.h"
+#include "larcorealg/Geometry/PlaneGeo.h"
+#include "larcorealg/Geometry/StandaloneBasicSetup.h"    // SetupMessageFacility()...
+#include "larcorealg/Geometry/StandaloneGeometrySetup.h" // SetupGeometry()
+#include "larcorealg/Geometry/TPCGeo.h"
+#include "larcorealg/Geometry/TPCsetView.h"
+
+// utility libraries
+#include "fhiclcpp/ParameterSet.h"
+#include "messagefacility/MessageLogger/MessageLogger.h"
+
+// C/C++ standard libraries
+#include <random>
+#include <stdexcept> // std::runtime_error
+#include <string>
+#include <vector>
+
+//------------------------------------------------------------------------------
+namespace {
+
+  /// Number of random points tested in each TPC.
+  constexpr unsigned int PointsPerTPC = 1000U;
+
+  /// Compares the queries of `view` with the ones of `geom`; returns the errors.
+  unsigned int testTPCset(geo::GeometryCore const& geom, geo::TPCsetView const& view)
+  {
+    unsigned int nErrors = 0U;
+    readout::TPCsetID const& tpcsetid = view.ID();
+
+    if ((view.NTPC() != geom.TPCsetToTPCIDs(tpcsetid).size()) ||
+        (view.NROPs() != geom.NROPs(tpcsetid))) {
+      mf::LogError("geometry_tpcsetview_test") << tpcsetid << " has the wrong content";
+      ++nErrors;
+    }
+
+    for (unsigned int r = 0; r < geom.NROPs(tpcsetid); ++r) {
+      readout::ROPID const ropid{tpcsetid, r};
+      if ((view.FirstChannelInROP(ropid) != geom.FirstChannelInROP(ropid)) ||
+          (view.Nchannels(ropid) != geom.Nchannels(ropid)) ||
+          (view.ROPtoWirePlanes(ropid) != geom.ROPtoWirePlanes(ropid))) {
+        mf::LogError("geometry_tpcsetview_test") << ropid << " differs from the geometry";
+        ++nErrors;
+      }
+    } // for ROPs
+
+    std::mt19937 engine{tpcsetid.TPCset + 1U};
+    std::uniform_real_distribution<double> uniform{-0.05, 1.05};
+
+    for (geo::TPCID const& tpcid : view.TPCIDs()) {
+      if (!geom.HasTPC(tpcid) || (geom.TPCtoTPCset(tpcid) != tpcsetid)) {
+        mf::LogError("geometry_tpcsetview_test") << tpcid << " is not in " << tpcsetid;
+        ++nErrors;
+        continue;
+      }
+      geo::TPCGeo const& TPC = geom.TPC(tpcid);
+      geo::BoxBoundedGeo const& box = TPC.BoundingBox();
+
+      for (unsigned int i = 0; i < PointsPerTPC; ++i) {
+        geo::Point_t const point{box.MinX() + uniform(engine) * box.SizeX(),
+                                 box.MinY() + uniform(engine) * box.SizeY(),
+                                 box.MinZ() + uniform(engine) * box.SizeZ()};
+
+        // the view knows only the TPCs of the set
+        geo::TPCID const expectedTPC = geom.FindTPCAtPosition(point);
+        geo::TPCID const foundTPC = view.FindTPCAtPosition(point);
+        if (foundTPC ? !geom.TPC(foundTPC).ContainsPosition(point, 1.0 + geom.DefaultWiggle()) :
+                       (expectedTPC && view.HasTPC(expectedTPC))) {
+          mf::LogError("geometry_tpcsetview_test")
+            << "TPC at " << point << ": " << foundTPC << ", expected " << expectedTPC;
+          ++nErrors;
+        }
+
+        for (geo::PlaneGeo const& plane : TPC.IteratePlanes()) {
+          geo::PlaneID const& planeid = plane.ID();
+          auto const expected = geom.TryNearestWireID(point, planeid);
+          auto const found = view.TryNearestWireID(point, planeid);
+          if (expected.has_value() != found.has_value()) {
+            mf::LogError("geometry_tpcsetview_test")
+              << planeid << " at " << point << ": wire "
+              << (found.has_value() ? "found" : "not found") << " by the view";
+            ++nErrors;
+            continue;
+          }
+          if (!found) continue;
+          if ((*found != *expected) ||
+              (view.PlaneWireToChannel(*found) != geom.PlaneWireToChannel(*expected))) {
+            mf::LogError("geometry_tpcsetview_test")
+              << planeid << " at " << point << ": " << *found << ", expected " << *expected;
+            ++nErrors;
+          }
+          if (view.ChannelToROP(view.PlaneWireToChannel(*found)) != geom.WirePlaneToROP(planeid)) {
+            mf::LogError("geometry_tpcsetview_test")
+              << "Readout plane of " << *found << " differs from the geometry";
+            ++nErrors;
+          }
+        } // for planes
+      }   // for points
+    }     // for TPCs
+
+    return nErrors;
+  } // testTPCset()
+
+} // local namespace
+
+//------------------------------------------------------------------------------
+int main(int argc, char const** argv)
+{
+
+  //
+  // parameter parsing
+  //
+  std::string configPath;
+  std::string geoConfigPath = "services.Geometry";
+
+  int iParam = 0;
+
+  // first argument: configuration file (mandatory)
+  if (++iParam < argc)
+    configPath = argv[iParam];
+  else
+    throw std::runtime_error("No configuration file specified.");
+
+  // second argument: path of the geometry configuration
+  if (++iParam < argc) geoConfigPath = argv[iParam];
+
+  //
+  // testing environment setup
+  //
+  using namespace lar::standalone;
+
+  fhicl::ParameterSet const pset = ParseConfiguration(configPath);
+  SetupMessageFacility(pset, "geometry_tpcsetview_test");
+
+  fhicl::ParameterSet const geoConfig = pset.get<fhicl::ParameterSet>(geoConfigPath);
+  auto const geom = SetupGeometry<geo::ChannelMapStandardAlg>(geoConfig);
+
+  unsigned int nErrors = 0U;
+
+  for (geo::CryostatID const& cid : geom->IterateCryostatIDs()) {
+    for (unsigned int s = 0; s < geom->NTPCsets(cid); ++s) {
+      geo::TPCsetView const view{*geom, readout::TPCsetID(cid, s)};
+      mf::LogVerbatim("geometry_tpcsetview_test")
+        << view.ID() << ": " << view.NTPC() << " TPCs, " << view.Nchannels() << " channels in "
+        << view.blockSize() << " bytes";
+      nErrors += testTPCset(*geom, view);
+    } // for TPC sets
+  }   // for cryostats
+
+  if (nErrors > 0) { mf::LogError("geometry_tpcsetview_test") << nErrors << " errors detected!"; }
+
+  return nErrors;
+} // main()
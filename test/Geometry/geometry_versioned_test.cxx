@@ -0,0 +1,152 @@
+/**
+ * @file   geometry_versioned_test.cxx
+ * @brief  Test of the replacement of the geometry under concurrent readers.
+ * @date   October 14, 2026
+ * @see    `geo::VersionedGeometry`
+ *
+ * Usage:
+ *
+ *     geometry_versioned_test configuration.fcl [GeometryParameterSet]
+ *
+ * The configuration file must contain a geometry service provider configuration
+ * under `services.Geometry` (or the path in the second argument), using the
+ * standard channel mapping.
+ *
+ * New versions of the geometry, each one shifting the first TPC a bit more
+ * along _x_, are published while reader threads query the current one.
+ * The readers check that each version they see is consistent, and that the
+ * versions they keep are not affected by the publication of newer ones.
+ */
+
+// LArSoft libraries
+#include "larcorealg/Geometry/ChannelMapStandardAlg.h"
+#include "larcorealg/Geometry/GeometryAlignment.h"
+#include "larcorealg/Geometry/GeometryCore.h"
+#include "larcorealg/Geometry/StandaloneBasicSetup.h"    // SetupMessageFacility()...
+#include "larcorealg/Geometry/StandaloneGeometrySetup.h" // SetupGeometry()
+#include "larcorealg/Geometry/TPCGeo.h"
+#include "larcorealg/Geometry/VersionedGeometry.h"
+
+// utility libraries
+#include "fhiclcpp/ParameterSet.h"
+#include "messagefacility/MessageLogger/MessageLogger.h"
+
+// C/C++ standard libraries
+#include <atomic>
+#include <cmath>     // std::abs()
+#include <stdexcept> // std::runtime_error
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+  /// Shift of the first TPC in each version [cm].
+  double shiftOf(geo::VersionedGeometry::Version_t version) { return 0.01 * (version - 1U); }
+
+} // local namespace
+
+//------------------------------------------------------------------------------
+int main(int argc, char const** argv)
+{
+
+  //
+  // parameter parsing
+  //
+  std::string configPath;
+  std::string geoConfigPath = "services.Geometry";
+
+  int iParam = 0;
+
+  // first argument: configuration file (mandatory)
+  if (++iParam < argc)
+    configPath = argv[iParam];
+  else
+    throw std::runtime_error("No configuration file specified.");
+
+  // second argument: path of the geometry configuration
+  if (++iParam < argc) geoConfigPath = argv[iParam];
+
+  //
+  // testing environment setup
+  //
+  using namespace lar::standalone;
+
+  fhicl::ParameterSet const pset = ParseConfiguration(configPath);
+  SetupMessageFacility(pset, "geometry_versioned_test");
+
+  fhicl::ParameterSet const geoConfig = pset.get<fhicl::ParameterSet>(geoConfigPath);
+
+  constexpr geo::VersionedGeometry::Version_t NVersions = 5U;
+  constexpr unsigned int NReaders = 4U;
+  geo::TPCID const tpcid{0, 0};
+
+  std::atomic<unsigned int> nErrors{0U};
+
+  geo::VersionedGeometry versions;
+  if (versions.acquire().valid() || (versions.version() != 0U)) {
+    mf::LogError("geometry_versioned_test") << "Geometry available before publication";
+    ++nErrors;
+  }
+
+  auto makeVersion = [&geoConfig, &tpcid](geo::VersionedGeometry::Version_t version) {
+    auto geom = SetupGeometry<geo::ChannelMapStandardAlg>(geoConfig);
+    geo::GeometryAlignment alignment;
+    alignment.TPCs[tpcid] = geo::makeAlignmentDelta({shiftOf(version), 0.0, 0.0});
+    geom->ApplyAlignment(alignment);
+    return geom;
+  };
+
+  versions.publish(makeVersion(1U));
+  geo::VersionedGeometry::Handle_t const first = versions.acquire();
+  double const nominalX = first->TPC(tpcid).GetCenter<geo::Point_t>().X();
+
+  //
+  // readers
+  //
+  std::atomic<bool> done{false};
+  std::vector<std::thread> readers;
+  for (unsigned int iReader = 0; iReader < NReaders; ++iReader) {
+    readers.emplace_back([&]() {
+      geo::VersionedGeometry::Version_t lastVersion = 0U;
+      while (!done) {
+        geo::VersionedGeometry::Handle_t const geom = versions.acquire();
+        geo::Point_t const center = geom->TPC(tpcid).GetCenter<geo::Point_t>();
+        double const expectedX = nominalX + shiftOf(geom.version());
+        if ((geom.version() < lastVersion) || (std::abs(center.X() - expectedX) > 1e-6) ||
+            (geom->PositionToTPCID(center) != tpcid)) {
+          ++nErrors;
+        }
+        lastVersion = geom.version();
+      }
+    });
+  }
+
+  //
+  // publication of new versions
+  //
+  for (geo::VersionedGeometry::Version_t version = 2U; version <= NVersions; ++version) {
+    if (versions.publish(makeVersion(version)) != version) {
+      mf::LogError("geometry_versioned_test") << "Version " << version << " not numbered so";
+      ++nErrors;
+    }
+  }
+  done = true;
+  for (std::thread& reader : readers)
+    reader.join();
+
+  // the first version is still held here, and it has not changed
+  if ((first.version() != 1U) || (first->TPC(tpcid).GetCenter<geo::Point_t>().X() != nominalX)) {
+    mf::LogError("geometry_versioned_test") << "First version changed after publications";
+    ++nErrors;
+  }
+  if (versions.version() != NVersions) {
+    mf::LogError("geometry_versioned_test")
+      << "Current version is " << versions.version() << ", " << NVersions << " expected";
+    ++nErrors;
+  }
+
+  if (nErrors > 0) { mf::LogError("geometry_versioned_test") << nErrors << " errors detected!"; }
+
+  return nErrors;
+} // main()
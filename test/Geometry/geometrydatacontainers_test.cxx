@@ -11,10 +11,22 @@
 
 // LArSoft libraries
 #include "larcorealg/CoreUtils/DebugUtils.h" // lar::debug::static_assert_on()
+#include "larcorealg/CoreUtils/Executor.h"
 #include "larcorealg/CoreUtils/counter.h"
 #include "larcorealg/Geometry/GeometryDataContainers.h"
 #include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
 
+// C/C++ standard libraries
+#include <atomic>
+#include <cstddef>    // std::byte
+#include <functional> // std::plus<>
+#include <iterator>   // std::iterator_traits<>
+#include <memory_resource>
+#include <new>     // std::bad_alloc
+#include <numeric> // std::transform_reduce()
+#include <type_traits>
+#include <vector>
+
 //------------------------------------------------------------------------------
 template <typename T>
 struct Summer {
@@ -28,6 +40,12 @@ struct Summer {
 
 }; // struct Summer
 
+//------------------------------------------------------------------------------
+template <typename Iter>
+constexpr bool isRandomAccess =
+  std::is_same_v<typename std::iterator_traits<Iter>::iterator_category,
+                 std::random_access_iterator_tag>;
+
 //------------------------------------------------------------------------------
 void TPCDataContainerTest(geo::TPCDataContainer<int> data, // copy here is intentional
                           std::size_t const NCryostats,
@@ -275,6 +293,42 @@ void TPCDataContainerTest(geo::TPCDataContainer<int> data, // copy here is inten
   auto summer2 = constData.apply(Summer<int>{});
   BOOST_TEST(summer2.get() == N * 28);
 
+  // parallel processing
+  static_assert(isRandomAccess<decltype(data.begin())>);
+  static_assert(isRandomAccess<decltype(constData.begin())>);
+  static_assert(isRandomAccess<decltype(data.item_begin())>);
+  static_assert(isRandomAccess<decltype(constData.item_begin())>);
+
+  auto const runner = geo::makeThreadTaskRunner(4U);
+  data.apply(runner, [](int& v) { v += 1; });
+  for (auto c : util::counter<unsigned int>(NCryostats))
+    for (auto t : util::counter<unsigned int>(NTPCs))
+      BOOST_TEST((data[{c, t}]) == 29);
+
+  std::atomic<int> parallelSum{0};
+  constData.apply(runner, [&parallelSum](int v) { parallelSum += v; });
+  BOOST_TEST(parallelSum.load() == N * 29);
+
+  data.apply(geo::TaskRunner_t{}, [](int& v) { v -= 1; }); // sequential
+  BOOST_TEST(data.first() == 28);
+
+  data.apply(lar::util::Executor::threads(3U), [](int& v) { v += 2; }); // executor
+  data.apply(lar::util::Executor{}, [](int& v) { v -= 2; });
+  BOOST_TEST(data.first() == 28);
+  BOOST_TEST(data.begin()[N - 1] == 28);
+
+  auto const itemBegin = constData.item_begin();
+  BOOST_TEST(static_cast<std::size_t>(constData.item_end() - itemBegin) == N);
+  BOOST_TEST(itemBegin[N - 1].first == constData.lastID());
+  int const weightedSum = std::transform_reduce(
+    itemBegin, constData.item_end(), 0, std::plus<>{}, [](auto const& item) {
+      return static_cast<int>(item.first.TPC) * item.second;
+    });
+  int expectedWeightedSum = 0;
+  for (auto t : util::counter<unsigned int>(NTPCs))
+    expectedWeightedSum += static_cast<int>(NCryostats * t) * 28;
+  BOOST_TEST(weightedSum == expectedWeightedSum);
+
   data.reset();
   for (auto c : util::counter<unsigned int>(NCryostats))
     for (auto t : util::counter<unsigned int>(NTPCs))
@@ -837,6 +891,166 @@ BOOST_AUTO_TEST_CASE(PlaneDataContainerTestCase)
 
 } // PlaneDataContainerTestCase
 
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(PMRDataContainerTestCase)
+{
+
+  // all the memory must come from the buffer: there is no upstream resource
+  std::byte buffer[4096];
+  std::pmr::monotonic_buffer_resource arena{
+    buffer, sizeof(buffer), std::pmr::null_memory_resource()};
+
+  geo::pmr::GeoIDdataContainer<int, geo::TPCIDmapper<>> genericData({2U, 3U}, 4, &arena);
+  BOOST_TEST(genericData.get_allocator().resource() == &arena);
+  BOOST_TEST(genericData.size() == 6U);
+  BOOST_TEST((genericData[{1U, 2U}]) == 4);
+
+  geo::pmr::PlaneDataContainer<int> planeData(2U, 3U, 4U, 5, &arena);
+  BOOST_TEST(planeData.get_allocator().resource() == &arena);
+  BOOST_TEST(planeData.size() == 24U);
+  BOOST_TEST((planeData[{1U, 2U, 3U}]) == 5);
+
+  geo::pmr::TPCDataContainer<int> tpcData(&arena);
+  BOOST_TEST(tpcData.empty());
+  tpcData.resize(2U, 3U, 7);
+  BOOST_TEST(tpcData.get_allocator().resource() == &arena);
+  BOOST_TEST((tpcData[{1U, 2U}]) == 7);
+
+  // containers with different allocators share the mapping
+  geo::TPCDataContainer<double> regularData;
+  regularData.resizeAs(tpcData, 2.5);
+  BOOST_TEST(regularData.size() == tpcData.size());
+  BOOST_TEST((regularData[{1U, 2U}]) == 2.5);
+
+  BOOST_CHECK_THROW((geo::pmr::TPCDataContainer<int>(1000U, 1000U, &arena)), std::bad_alloc);
+
+} // PMRDataContainerTestCase
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(ReuseDataContainerTestCase)
+{
+
+  geo::PlaneDataContainer<int> const large(2U, 3U, 4U, 1);
+  geo::PlaneDataContainer<int> const small(1U, 2U, 3U, 2);
+
+  // the storage of a container is reused when reset to a smaller mapping
+  geo::PlaneDataContainer<int> data;
+  data.resetAs(large.mapper(), 5);
+  BOOST_TEST(data.size() == 24U);
+  BOOST_TEST((data[{1U, 2U, 3U}]) == 5);
+  int const* const storage = &data.first();
+  data.resetAs(small.mapper(), 7);
+  BOOST_TEST(&data.first() == storage);
+  BOOST_TEST(data.size() == 6U);
+  BOOST_TEST(data.dimSize<2U>() == 3U);
+  for (int const value : data)
+    BOOST_TEST(value == 7);
+
+  data[{0U, 1U, 2U}] = 9;
+  data.reset();
+  BOOST_TEST((data[{0U, 1U, 2U}]) == 0);
+  data.reset(-1);
+  BOOST_TEST((data[{0U, 1U, 2U}]) == -1);
+  BOOST_TEST(&data.first() == storage);
+
+  // resizing keeps the existing elements
+  data.resizeAs(large.mapper(), 3);
+  BOOST_TEST(data.size() == 24U);
+  BOOST_TEST(&data.first() == storage);
+  BOOST_TEST(data.capacity() >= 24U);
+  BOOST_TEST(data.last() == 3);
+
+  geo::TPCDataContainer<double> tpcData;
+  tpcData.resizeAs(geo::TPCIDmapper<>{2U, 3U});
+  BOOST_TEST(tpcData.size() == 6U);
+  BOOST_TEST((tpcData[{1U, 2U}]) == 0.0);
+
+} // ReuseDataContainerTestCase
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(StaticDataContainerTestCase)
+{
+
+  using Data_t = geo::StaticPlaneDataContainer<int, 2U, 3U, 4U>;
+  static_assert(Data_t::size() == 24U);
+  static_assert(sizeof(Data_t) == 24U * sizeof(int));
+  static_assert(isRandomAccess<Data_t::iterator>);
+
+  Data_t data{3};
+  BOOST_TEST((data[{1U, 2U, 3U}]) == 3);
+  BOOST_TEST(data.hasPlane({1U, 2U, 3U}));
+  BOOST_TEST(!data.hasPlane({1U, 2U, 4U}));
+  BOOST_TEST(data.hasTPC({1U, 2U}));
+  BOOST_TEST(!data.hasCryostat(geo::CryostatID{2U}));
+  BOOST_CHECK_THROW(data.at({2U, 0U, 0U}), std::out_of_range);
+
+  for (auto&& [id, value] : data.items())
+    value = id.Cryostat * 100 + id.TPC * 10 + id.Plane;
+  BOOST_TEST(data.first() == 0);
+  BOOST_TEST(data.last() == 123);
+  BOOST_TEST((data.at({1U, 0U, 2U})) == 102);
+
+  int sum = 0;
+  data.apply([&sum](int v) { sum += v; });
+  BOOST_TEST(sum == 12 * 100 + 8 * (0 + 10 + 20) + 6 * (0 + 1 + 2 + 3));
+
+  std::atomic<int> atomicSum{0};
+  data.apply(geo::makeThreadTaskRunner(3U), [&atomicSum](int v) { atomicSum += v; });
+  BOOST_TEST(atomicSum.load() == sum);
+
+  geo::StaticTPCDataContainer<double, 2U, 3U> tpcData;
+  BOOST_TEST(tpcData.first() == 0.0);
+  tpcData[{1U, 1U}] = 5.0;
+  BOOST_TEST(tpcData.data()[4] == 5.0);
+  tpcData.reset();
+  BOOST_TEST((tpcData[{1U, 1U}]) == 0.0);
+
+} // StaticDataContainerTestCase
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(CompressedDataContainerTestCase)
+{
+
+  // one cryostat with 3 TPCs of 2, 3 and 0 planes
+  geo::CompressedPlaneIDmapper<> mapper{{1U, 3U},
+                                        [](geo::TPCID const& tpcid) {
+                                          unsigned int const n[] = {2U, 3U, 0U};
+                                          return n[tpcid.TPC];
+                                        }};
+  geo::CompressedPlaneDataContainer<int> data{mapper, -1};
+  BOOST_TEST(data.size() == 5U);
+  BOOST_TEST(data.hasPlane({0U, 1U, 2U}));
+  BOOST_TEST(!data.hasPlane({0U, 0U, 2U}));
+  BOOST_TEST(!data.hasTPC({0U, 2U}));
+  BOOST_TEST(data.hasCryostat(geo::CryostatID{0U}));
+  BOOST_CHECK_THROW(data.at({0U, 2U, 0U}), std::out_of_range);
+
+  for (auto&& [id, value] : data.items())
+    value = id.TPC * 10 + id.Plane;
+  BOOST_TEST((data[{0U, 0U, 1U}]) == 1);
+  BOOST_TEST((data[{0U, 1U, 0U}]) == 10);
+  BOOST_TEST(data.last() == 12);
+  BOOST_TEST(data.lastID() == (geo::PlaneID{0U, 1U, 2U}));
+
+  std::vector<geo::PlaneID> ids;
+  for (auto it = data.begin(); it != data.end(); ++it)
+    ids.push_back(it.ID());
+  BOOST_TEST(ids.size() == 5U);
+  BOOST_TEST(ids[2] == (geo::PlaneID{0U, 1U, 0U}));
+
+  geo::CompressedPlaneDataContainer<double> sameMapping{data.mapper()};
+  BOOST_TEST(sameMapping.size() == data.size());
+  BOOST_TEST((sameMapping[{0U, 1U, 2U}]) == 0.0);
+
+  geo::CompressedTPCDataContainer<int> tpcData{
+    {{2U}, [](geo::CryostatID const& cid) { return cid.Cryostat + 1U; }}, 7};
+  BOOST_TEST(tpcData.size() == 3U);
+  BOOST_TEST(tpcData.hasTPC({1U, 1U}));
+  BOOST_TEST(!tpcData.hasTPC({0U, 1U}));
+  BOOST_TEST((tpcData[{1U, 0U}]) == 7);
+
+} // CompressedDataContainerTestCase
+
 //------------------------------------------------------------------------------
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -14,6 +14,12 @@
 #include "larcorealg/Geometry/ReadoutDataContainers.h"
 #include "larcoreobj/SimpleTypesAndConstants/readout_types.h"
 
+// C/C++ standard libraries
+#include <atomic>
+#include <cstddef> // std::byte
+#include <memory_resource>
+#include <stdexcept> // std::out_of_range
+
 //------------------------------------------------------------------------------
 template <typename T>
 struct Summer {
@@ -810,6 +816,134 @@ BOOST_AUTO_TEST_CASE(ROPDataContainerTestCase)
 
 } // ROPDataContainerTestCase
 
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(PMRDataContainerTestCase)
+{
+
+  // all the memory must come from the buffer: there is no upstream resource
+  std::byte buffer[4096];
+  std::pmr::monotonic_buffer_resource arena{
+    buffer, sizeof(buffer), std::pmr::null_memory_resource()};
+
+  readout::pmr::TPCsetDataContainer<int> TPCsetData(2U, 3U, 4, &arena);
+  BOOST_TEST(TPCsetData.get_allocator().resource() == &arena);
+  BOOST_TEST((TPCsetData[{1U, 2U}]) == 4);
+
+  readout::pmr::ROPDataContainer<int> ROPdata(&arena);
+  ROPdata.resize(2U, 3U, 2U, 6);
+  BOOST_TEST(ROPdata.get_allocator().resource() == &arena);
+  BOOST_TEST(ROPdata.size() == 12U);
+  BOOST_TEST((ROPdata[{1U, 2U, 1U}]) == 6);
+
+} // PMRDataContainerTestCase
+
+//------------------------------------------------------------------------------
+/// Channel mapping with 2 readout planes per TPC set, of 10 and 13 channels.
+struct DummyChannelMap {
+  raw::ChannelID_t FirstChannelInROP(readout::ROPID const& ropid) const
+  {
+    return ropid.ROP * 10U + (ropid.TPCset + 2U * ropid.Cryostat) * 23U;
+  }
+  unsigned int Nchannels(readout::ROPID const& ropid) const { return 10U + ropid.ROP * 3U; }
+  unsigned int Nchannels() const { return 2U * 2U * 23U; }
+}; // DummyChannelMap
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(ChannelDataContainerTestCase)
+{
+
+  DummyChannelMap const channelMap;
+  readout::ChannelDataContainer<float> data(channelMap.Nchannels(), 1.5f);
+  BOOST_TEST(data.size() == 92U);
+  BOOST_TEST(data.hasChannel(91U));
+  BOOST_TEST(!data.hasChannel(92U));
+  BOOST_TEST(!data.hasChannel(raw::InvalidChannelID));
+  BOOST_TEST(data[37U] == 1.5f);
+  BOOST_CHECK_THROW(data.at(92U), std::out_of_range);
+
+  readout::ROPID const ropid{1U, 0U, 1U};
+  auto const ropData = data.ROPdata(channelMap, ropid);
+  BOOST_TEST(ropData.size() == 13U);
+  for (float& value : data.ROPdata(channelMap, ropid))
+    value = 2.0f;
+  BOOST_TEST(data[55U] == 1.5f);
+  BOOST_TEST(data[56U] == 2.0f);
+  BOOST_TEST(data[68U] == 2.0f);
+  BOOST_TEST(data[69U] == 1.5f);
+
+  auto const runner = geo::makeThreadTaskRunner(4U);
+  data.generate(runner, [](raw::ChannelID_t channel) { return channel * 0.5f; });
+  for (raw::ChannelID_t channel = 0; channel < data.size(); ++channel)
+    BOOST_TEST(data[channel] == channel * 0.5f);
+
+  std::atomic<unsigned int> nLarge{0U};
+  data.apply(runner, [&nLarge](float value) {
+    if (value >= 20.0f) ++nLarge;
+  });
+  BOOST_TEST(nLarge.load() == 52U);
+
+  data.resize(100U, -1.0f);
+  BOOST_TEST(data[99U] == -1.0f);
+  data.clear();
+  BOOST_TEST(data.empty());
+
+} // ChannelDataContainerTestCase
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(ChannelFlagsTestCase)
+{
+
+  DummyChannelMap const channelMap;
+  readout::ChannelDataContainer<bool> flags(channelMap.Nchannels());
+  BOOST_TEST(flags.size() == 92U);
+  BOOST_TEST(flags.count() == 0U);
+
+  flags.set(3U);
+  flags.set(63U);
+  flags.set(64U);
+  flags.set(91U);
+  BOOST_TEST(flags[63U]);
+  BOOST_TEST(!flags[62U]);
+  BOOST_TEST(flags.count() == 4U);
+  BOOST_TEST(flags.count(60U, 5U) == 2U);
+  BOOST_TEST(flags.ROPcount(channelMap, {1U, 0U, 1U}) == 2U); // channels 56-68
+  flags.reset(63U);
+  BOOST_TEST(!flags.test(63U));
+  BOOST_CHECK_THROW(flags.at(92U), std::out_of_range);
+
+  flags.fill(geo::makeThreadTaskRunner(3U), true);
+  BOOST_TEST(flags.count() == 92U);
+
+  flags.generate(geo::makeThreadTaskRunner(2U),
+                 [](raw::ChannelID_t channel) { return channel % 3U == 0U; });
+  BOOST_TEST(flags.count() == 31U);
+  BOOST_TEST(flags[90U]);
+  BOOST_TEST(!flags[91U]);
+
+  flags.resize(130U, true);
+  BOOST_TEST(flags.count() == 31U + 38U);
+  BOOST_TEST(flags.count(92U, 38U) == 38U);
+  flags.resize(65U);
+  BOOST_TEST(flags.count() == 22U);
+  flags.resize(70U, true);
+  BOOST_TEST(flags.count() == 22U + 5U);
+
+  // all the memory must come from the buffer: there is no upstream resource
+  std::byte buffer[512];
+  std::pmr::monotonic_buffer_resource arena{
+    buffer, sizeof(buffer), std::pmr::null_memory_resource()};
+  readout::pmr::ChannelDataContainer<bool> pmrFlags(1000U, true, &arena);
+  BOOST_TEST(pmrFlags.count() == 1000U);
+  BOOST_TEST(pmrFlags.get_allocator().resource() == &arena);
+
+  // the memory resource is the allocator, not the default value
+  readout::pmr::ChannelDataContainer<bool> unsetFlags(1000U, &arena);
+  BOOST_TEST(unsetFlags.size() == 1000U);
+  BOOST_TEST(unsetFlags.count() == 0U);
+  BOOST_TEST(unsetFlags.get_allocator().resource() == &arena);
+
+} // ChannelFlagsTestCase
+
 //------------------------------------------------------------------------------
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,84 @@
+/**
+ * @file   AllocationCounter_test.cc
+ * @brief  Test of the allocation count of the benchmarks.
+ * @date   October 14, 2026
+ * @see    `larcorealg/TestUtils/CountAllocations.h`
+ */
+
+// LArSoft libraries
+#include "larcorealg/TestUtils/Benchmark.h"
+#include "larcorealg/TestUtils/CountAllocations.h"
+
+// Boost libraries
+#define BOOST_TEST_MODULE (AllocationCounter_test)
+#include <boost/test/unit_test.hpp>
+
+// C/C++ standard libraries
+#include <chrono>
+#include <memory> // std::make_unique()
+#include <numeric> // std::accumulate()
+#include <sstream>
+#include <vector>
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(AllocationCountTestCase)
+{
+  BOOST_TEST(testing::allocationsCounted());
+
+  std::size_t const start = testing::allocationCount();
+  {
+    auto const p = std::make_unique<int>(5);
+    testing::doNotOptimize(p.get());
+    std::vector<double> v(100U);
+    testing::doNotOptimize(v.data());
+  }
+  BOOST_TEST(testing::allocationCount() - start == 2U);
+} // BOOST_AUTO_TEST_CASE(AllocationCountTestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(AllocationScopeTestCase)
+{
+  testing::AllocationScope scope;
+  BOOST_TEST(scope.counting());
+  BOOST_TEST(scope.count() == 0U);
+  {
+    std::vector<int> v(10U);
+    testing::doNotOptimize(v.data());
+  }
+  BOOST_TEST(scope.count() == 1U);
+  scope.reset();
+  BOOST_TEST(scope.count() == 0U);
+} // BOOST_AUTO_TEST_CASE(AllocationScopeTestCase)
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(BenchmarkAllocationsTestCase)
+{
+  testing::Benchmark<>::Config_t config;
+  config.warmupTime = std::chrono::milliseconds{2};
+  config.minSampleTime = std::chrono::microseconds{200};
+  config.samples = 10U;
+  config.hardwareCounters = false;
+  testing::Benchmark<> bench{config};
+
+  std::vector<double> data(100U, 1.0);
+  auto const& none = bench.run("sum", [&data] {
+    testing::doNotOptimize(std::accumulate(data.begin(), data.end(), 0.0));
+  });
+  auto const& two = bench.run(
+    "copy",
+    [&data] {
+      auto copy = data; // one allocation per call, two items
+      testing::doNotOptimize(copy.data());
+    },
+    2U);
+
+  BOOST_TEST(none.hasAllocations());
+  BOOST_TEST(none.allocationsPerItem == 0.0);
+  BOOST_TEST(two.allocationsPerItem == 0.5);
+
+  std::ostringstream table, json;
+  bench.printTable(table);
+  BOOST_TEST(table.str().find("alloc/item") != std::string::npos);
+  bench.writeJSON(json);
+  BOOST_TEST(json.str().find("\"allocations_per_item\": 0.5") != std::string::npos);
+} // BOOST_AUTO_TEST_CASE(BenchmarkAllocationsTestCase)
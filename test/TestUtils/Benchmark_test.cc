@@ -0,0 +1,213 @@
+/**
+ * @file   Benchmark_test.cc
+ * @brief  Test of `testing::Benchmark` and its statistics.
+ * @see    `larcorealg/TestUtils/Benchmark.h`
+ *
+ * The timing itself is not reproducible: only the statistics on fixed samples
+ * and the structure of the results are verified.
+ */
+
+// LArSoft libraries
+#include "larcorealg/TestUtils/Benchmark.h"
+
+// Boost libraries
+#define BOOST_TEST_MODULE (Benchmark_test)
+#include <boost/test/unit_test.hpp>
+
+// C/C++ standard libraries
+#include <algorithm> // std::count()
+#include <chrono>
+#include <cmath> // std::sqrt()
+#include <fstream>
+#include <numeric> // std::iota(), std::accumulate()
+#include <sstream>
+#include <string>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+void test_computeBenchmarkStats()
+{
+  // 1 ... 9, plus an outlier
+  std::vector<double> samples(9U);
+  std::iota(samples.begin(), samples.end(), 1.0);
+  samples.push_back(1000.0);
+
+  auto const stats = testing::computeBenchmarkStats(samples);
+  BOOST_TEST(stats.nSamples == 10U);
+  BOOST_TEST(stats.nOutliers == 1U);
+  BOOST_TEST(stats.min == 1.0);
+  BOOST_TEST(stats.max == 1000.0);
+  BOOST_TEST(stats.median == 5.5);
+  BOOST_TEST(stats.mean == 5.0);
+  BOOST_TEST(stats.stddev == std::sqrt(7.5), boost::test_tools::tolerance(1e-12));
+  BOOST_TEST(stats.p10 == 1.9, boost::test_tools::tolerance(1e-12));
+
+  // no rejection
+  auto const all = testing::computeBenchmarkStats(samples, 0.0);
+  BOOST_TEST(all.nOutliers == 0U);
+  BOOST_TEST(all.mean == 104.5);
+  BOOST_TEST(all.median == stats.median);
+
+  auto const none = testing::computeBenchmarkStats({});
+  BOOST_TEST(none.nSamples == 0U);
+  BOOST_TEST(none.mean == 0.0);
+
+} // test_computeBenchmarkStats()
+
+// -----------------------------------------------------------------------------
+void test_Benchmark()
+{
+  testing::Benchmark<>::Config_t config;
+  config.warmupTime = std::chrono::milliseconds{2};
+  config.minSampleTime = std::chrono::microseconds{200};
+  config.samples = 20U;
+  testing::Benchmark<> bench{config};
+
+  std::vector<double> data(1000U, 1.0);
+  unsigned int nCalls = 0U;
+  auto const& first = bench.run("sum", [&] {
+    ++nCalls;
+    testing::doNotOptimize(std::accumulate(data.begin(), data.end(), 0.0));
+  });
+  auto const& result = bench.run(
+    "scale \"x2\"",
+    [&] {
+      for (double& x : data)
+        x = 0.5 * x + 1.0;
+      testing::doNotOptimize(data.data());
+    },
+    data.size());
+
+  BOOST_TEST_REQUIRE(bench.results().size() == 2U);
+  auto const& sum = bench.results().front();
+  BOOST_TEST(sum.name == "sum");
+  BOOST_TEST(sum.itemsPerCall == 1U);
+  BOOST_TEST(sum.samples.size() == 20U);
+  BOOST_TEST(sum.stats.nSamples == 20U);
+  BOOST_TEST(sum.callsPerSample >= 1U);
+  BOOST_TEST(nCalls > sum.callsPerSample * 20U); // plus the warm-up
+  BOOST_TEST(sum.stats.median > 0.0);
+  BOOST_TEST(sum.nsPerItem() == sum.stats.median);
+
+  // the returned result is a copy, still valid after the following runs
+  BOOST_TEST(first.name == sum.name);
+  BOOST_TEST(first.stats.median == sum.stats.median);
+
+  BOOST_TEST(result.itemsPerCall == 1000U);
+  BOOST_TEST(result.nsPerItem() == result.stats.median / 1000.0);
+  BOOST_TEST(result.itemsPerSecond() == 1e9 / result.nsPerItem(), boost::test_tools::tolerance(1e-9));
+
+  std::ostringstream table;
+  bench.printTable(table);
+  std::string const tableStr = table.str();
+  BOOST_TEST_MESSAGE(tableStr);
+  BOOST_TEST(std::count(tableStr.begin(), tableStr.end(), '\n') == 3);
+
+  std::ostringstream csv;
+  bench.writeCSV(csv);
+  BOOST_TEST_MESSAGE(csv.str());
+  BOOST_TEST(csv.str().find("\n\"scale \"\"x2\"\"\",1000,") != std::string::npos);
+
+  std::ostringstream json;
+  bench.writeJSON(json);
+  BOOST_TEST_MESSAGE(json.str());
+  BOOST_TEST(json.str().find("{\"name\": \"scale \\\"x2\\\"\", \"items_per_call\": 1000")
+             != std::string::npos);
+
+  // hardware counters are reported only when they could be read
+  BOOST_TEST(csv.str().find(",cycles_per_item,instructions_per_item,") != std::string::npos);
+  BOOST_TEST(sum.hasCounters() == bench.hardwareCounters().available());
+  BOOST_TEST((json.str().find("\"counters_per_item\"") != std::string::npos) ==
+             bench.hardwareCounters().available());
+
+  // allocations are not counted in this program (no `CountAllocations.h`)
+  BOOST_TEST(!testing::allocationsCounted());
+  BOOST_TEST(!sum.hasAllocations());
+  BOOST_TEST(csv.str().find(",items_per_second,allocations_per_item,") != std::string::npos);
+  BOOST_TEST(json.str().find("\"allocations_per_item\"") == std::string::npos);
+
+} // test_Benchmark()
+
+// -----------------------------------------------------------------------------
+void test_Benchmark_baseline()
+{
+  BOOST_TEST((testing::splitCSVline("\"a,\"\"b\"\"\",1.5,") ==
+              std::vector<std::string>{"a,\"b\"", "1.5", ""}));
+
+  testing::BenchmarkOptions_t options;
+  BOOST_TEST(options.parse("--baseline=base.csv"));
+  BOOST_TEST(options.parse("--tolerance=0.1"));
+  BOOST_TEST(options.parse("--warn-only"));
+  BOOST_TEST(!options.parse("config.fcl"));
+  BOOST_TEST(options.baselinePath == "base.csv");
+  BOOST_TEST(options.tolerance == 0.1);
+  BOOST_TEST(options.warnOnly);
+  BOOST_TEST(options.JSONpath.empty());
+
+  testing::Benchmark<>::Config_t config;
+  config.warmupTime = std::chrono::milliseconds{1};
+  config.minSampleTime = std::chrono::microseconds{100};
+  config.samples = 10U;
+  config.hardwareCounters = false;
+  testing::Benchmark<> bench{config};
+  BOOST_TEST(!bench.hardwareCounters().available());
+  std::vector<double> data(100U, 1.0);
+  auto const sum = [&data] {
+    testing::doNotOptimize(std::accumulate(data.begin(), data.end(), 0.0));
+  };
+  bench.run("fast, \"quoted\"", sum);
+  bench.run("slow", sum);
+  bench.run("new", sum);
+
+  // the CSV output is read back as baseline
+  std::stringstream csv;
+  bench.writeCSV(csv);
+  auto const readBack = testing::readBenchmarkBaseline(csv);
+  BOOST_TEST(readBack.size() == 3U);
+  BOOST_TEST(readBack.count("fast, \"quoted\"") == 1U);
+  BOOST_TEST(!bench.results().front().hasCounters());
+
+  // a baseline where "slow" used to be much faster; "new" is not there
+  std::istringstream baselineCSV{"# comment\n"
+                                 "name,ns_per_item\n"
+                                 "\"fast, \"\"quoted\"\"\",1e12\n"
+                                 "slow,1e-6\n"};
+  auto const baseline = testing::readBenchmarkBaseline(baselineCSV);
+  BOOST_TEST(baseline.size() == 2U);
+
+  auto const comparisons = bench.compareToBaseline(baseline);
+  BOOST_TEST_REQUIRE(comparisons.size() == 3U);
+  BOOST_TEST(comparisons[0].hasBaseline());
+  BOOST_TEST(!comparisons[0].isRegression(0.25));
+  BOOST_TEST(comparisons[1].isRegression(0.25));
+  BOOST_TEST(comparisons[1].ratio() > 1.0);
+  BOOST_TEST(!comparisons[2].hasBaseline());
+  BOOST_TEST(!comparisons[2].isRegression(0.25));
+
+  // missing baseline file: no comparison
+  options = {};
+  options.baselinePath = "nonexistent_benchmark_baseline.csv";
+  std::ostringstream missing;
+  BOOST_TEST(bench.report(options, missing) == 0U);
+  BOOST_TEST(missing.str().find("comparison skipped") != std::string::npos);
+
+  // regressions fail, unless only warning is requested
+  options.baselinePath = "Benchmark_test_baseline.csv";
+  std::ofstream{options.baselinePath} << "name,ns_per_item\nslow,1e-6\n";
+  std::ostringstream regression;
+  BOOST_TEST(bench.report(options, regression) == 1U);
+  BOOST_TEST_MESSAGE(regression.str());
+  BOOST_TEST(regression.str().find("slow: ") != std::string::npos);
+  BOOST_TEST(regression.str().find("new: no baseline") != std::string::npos);
+  options.warnOnly = true;
+  BOOST_TEST(bench.report(options, std::ostringstream{}) == 0U);
+
+} // test_Benchmark_baseline()
+
+// -----------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(BenchmarkTestCase)
+{
+  test_computeBenchmarkStats();
+  test_Benchmark();
+  test_Benchmark_baseline();
+} // BOOST_AUTO_TEST_CASE(BenchmarkTestCase)
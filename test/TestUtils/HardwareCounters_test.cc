@@ -0,0 +1,107 @@
+/**
+ * @file   HardwareCounters_test.cc
+ * @brief  Test of `testing::HardwareCounters`.
+ * @see    `larcorealg/TestUtils/HardwareCounters.h`
+ *
+ * The counters are often not accessible (e.g. in containers): in that case
+ * only the graceful degradation is verified.
+ */
+
+// LArSoft libraries
+#include "larcorealg/TestUtils/Benchmark.h" // testing::doNotOptimize()
+#include "larcorealg/TestUtils/HardwareCounters.h"
+
+// Boost libraries
+#define BOOST_TEST_MODULE (HardwareCounters_test)
+#include <boost/test/unit_test.hpp>
+
+// C/C++ standard libraries
+#include <numeric> // std::accumulate()
+#include <string>
+#include <utility> // std::move()
+#include <vector>
+
+// -----------------------------------------------------------------------------
+void test_disabledCounters()
+{
+  testing::HardwareCounters counters{false};
+  BOOST_TEST(!counters.available());
+  BOOST_TEST(!counters.available(testing::HardwareCounter_t::Cycles));
+  BOOST_TEST(!counters.unavailableReason().empty());
+
+  counters.start();
+  counters.stop();
+  auto const values = counters.read();
+  BOOST_TEST(!values.any());
+  BOOST_TEST(values[testing::HardwareCounter_t::Instructions] == 0.0);
+
+} // test_disabledCounters()
+
+// -----------------------------------------------------------------------------
+void test_counters()
+{
+  testing::HardwareCounters counters;
+  if (!counters.available()) {
+    BOOST_TEST_MESSAGE("Hardware counters not available: " << counters.unavailableReason());
+    BOOST_TEST(!counters.unavailableReason().empty());
+    BOOST_TEST(!counters.read().any());
+    return;
+  }
+  if (!counters.unavailableReason().empty())
+    BOOST_TEST_MESSAGE("Some counters not available: " << counters.unavailableReason());
+
+  std::vector<double> data(100000U, 1.0);
+  counters.start();
+  for (int i = 0; i < 10; ++i)
+    testing::doNotOptimize(std::accumulate(data.begin(), data.end(), 0.0));
+  counters.stop();
+  auto const values = counters.read();
+  BOOST_TEST(values.any());
+
+  // at least one instruction per element
+  if (values.isValid(testing::HardwareCounter_t::Instructions)) {
+    BOOST_TEST(values[testing::HardwareCounter_t::Instructions] > 1e6);
+  }
+
+  // stopped counters do not change
+  testing::doNotOptimize(std::accumulate(data.begin(), data.end(), 0.0));
+  auto const later = counters.read();
+  for (std::size_t i = 0; i < testing::NHardwareCounters; ++i)
+    BOOST_TEST(later.values[i] == values.values[i]);
+
+  // moved counters keep working, and the original ones are released
+  testing::HardwareCounters moved{std::move(counters)};
+  BOOST_TEST(moved.available());
+  BOOST_TEST(!counters.available());
+
+} // test_counters()
+
+// -----------------------------------------------------------------------------
+void test_counterValues()
+{
+  testing::HardwareCounterValues_t a, b;
+  a.values.fill(2.0);
+  a.valid.fill(true);
+  b.values.fill(4.0);
+  b.valid.fill(true);
+  b.valid[static_cast<std::size_t>(testing::HardwareCounter_t::LLCMisses)] = false;
+
+  a += b;
+  a /= 2.0;
+  BOOST_TEST(a[testing::HardwareCounter_t::Cycles] == 3.0);
+  BOOST_TEST(a.isValid(testing::HardwareCounter_t::Cycles));
+  BOOST_TEST(!a.isValid(testing::HardwareCounter_t::LLCMisses));
+  BOOST_TEST(a.any());
+
+  BOOST_TEST(std::string{testing::hardwareCounterName(testing::HardwareCounter_t::BranchMisses)} ==
+             "branch_misses");
+
+} // test_counterValues()
+
+// -----------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(HardwareCountersTestCase)
+{
+  test_disabledCounters();
+  test_counters();
+  test_counterValues();
+} // BOOST_AUTO_TEST_CASE(HardwareCountersTestCase)
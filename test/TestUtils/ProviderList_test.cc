@@ -167,6 +167,16 @@ void NonConstTest(testing::ProviderList& l)
   BOOST_TEST(!l.erase<UncopiableDatumClass>("Never"));
   TestElement<UncopiableDatumClass>(l, "Never", false);
 
+  // share one, which survives the erasure from the list
+  auto shared = std::make_shared<UncopiableDatumClass>("shared uncopiable");
+  BOOST_TEST(l.share(shared, "Shared"));
+  BOOST_TEST(!l.share(shared, "Shared"));
+  TestElement<UncopiableDatumClass>(l, "Shared", true);
+  BOOST_TEST(&l.get<UncopiableDatumClass>("Shared") == shared.get());
+  BOOST_TEST(l.erase<UncopiableDatumClass>("Shared"));
+  TestElement<UncopiableDatumClass>(l, "Shared", false);
+  BOOST_TEST(TrackedMemory.count(shared.get()) == 1U);
+
 } // NonConstTest()
 
 //------------------------------------------------------------------------------